@@ -0,0 +1,956 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <getopt.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "opendcp.h"
+#include "opendcp_image.h"
+#include "opendcp_decoder.h"
+#include "opendcp_encoder.h"
+#include "aes.h"
+#include "sha1.h"
+#include "cpu.h"
+
+/* color kernels behind rgb_to_xyz() */
+int rgb_to_xyz_lut(opendcp_image_t *image, int index);
+int rgb_to_xyz_calculate(opendcp_image_t *image, int index);
+
+#define BENCH_SEED        0x0dc0ffee
+#define BENCH_MXF_FRAMES  48
+#define BENCH_PCM_SECONDS 10
+#define BENCH_PCM_CHANNELS 6
+#define BENCH_BUFFER_SIZE (16 * 1024 * 1024)
+
+typedef struct {
+    opendcp_t       *opendcp;
+    char            dir[MAX_FILENAME_LENGTH];
+    char            file[MAX_FILENAME_LENGTH];
+    opendcp_image_t *source;      /* synthetic frame the benchmark starts from */
+    opendcp_image_t *work;        /* copy of source the benchmark runs on      */
+    opendcp_encoder_t *encoder;
+    opendcp_decoder_t *decoder;
+    filelist_t      *filelist;
+    unsigned char   *in;
+    unsigned char   *out;
+    unsigned long long bytes;    /* bytes one run processes */
+} bench_ctx_t;
+
+typedef struct {
+    const char *name;
+    int  (*setup)(bench_ctx_t *ctx);
+    void (*reset)(bench_ctx_t *ctx);
+    int  (*run)(bench_ctx_t *ctx);
+    void (*teardown)(bench_ctx_t *ctx);
+} bench_t;
+
+static unsigned int bench_seed = BENCH_SEED;
+
+/* small lcg, the frames must be identical on every machine */
+static unsigned int bench_rand() {
+    bench_seed = bench_seed * 1664525u + 1013904223u;
+
+    return bench_seed >> 8;
+}
+
+/* 12-bit gradients with noise, close enough to film content for the entropy coder */
+static opendcp_image_t *bench_frame(int w, int h) {
+    opendcp_image_t *image;
+    int x, y, c, v;
+
+    image = opendcp_image_create(3, w, h);
+
+    if (!image) {
+        return NULL;
+    }
+
+    bench_seed = BENCH_SEED;
+
+    for (y = 0; y < h; y++) {
+        for (x = 0; x < w; x++) {
+            for (c = 0; c < 3; c++) {
+                v = (x * 4095 / w + y * 4095 / h * c) / (c + 1) + (int)(bench_rand() % 64) - 32;
+                v = v < 0 ? 0 : v > 4095 ? 4095 : v;
+                image->component[c].data[x + image->component[c].stride * y] = v;
+            }
+        }
+    }
+
+    return image;
+}
+
+static void bench_copy(opendcp_image_t *dst, opendcp_image_t *src) {
+    int c;
+
+    for (c = 0; c < src->n_components; c++) {
+        memcpy(dst->component[c].data, src->component[c].data, (size_t)src->component[c].stride * src->h * sizeof(int));
+    }
+}
+
+static void bench_path(bench_ctx_t *ctx, const char *name) {
+    snprintf(ctx->file, sizeof(ctx->file), "%s/%s", ctx->dir, name);
+}
+
+static void put_le16(unsigned char *p, unsigned int v) {
+    p[0] = v & 0xff;
+    p[1] = (v >> 8) & 0xff;
+}
+
+static void put_le32(unsigned char *p, unsigned int v) {
+    put_le16(p, v & 0xffff);
+    put_le16(p + 2, v >> 16);
+}
+
+static void put_be16(unsigned char *p, unsigned int v) {
+    p[0] = (v >> 8) & 0xff;
+    p[1] = v & 0xff;
+}
+
+static void put_be32(unsigned char *p, unsigned int v) {
+    put_be16(p, v >> 16);
+    put_be16(p + 2, v & 0xffff);
+}
+
+static int bench_write(const char *file, const unsigned char *data, size_t size) {
+    FILE *fp = fopen(file, "wb");
+    int  result = OPENDCP_NO_ERROR;
+
+    if (!fp) {
+        return OPENDCP_ERROR;
+    }
+
+    if (fwrite(data, 1, size, fp) != size) {
+        result = OPENDCP_ERROR;
+    }
+
+    fclose(fp);
+
+    return result;
+}
+
+/* 24-bit bottom-up bmp */
+static int bench_write_bmp(const char *file, opendcp_image_t *image) {
+    int           row = (image->w * 3 + 3) & ~3;
+    size_t        size = 54 + (size_t)row * image->h;
+    unsigned char *data, *p;
+    int           x, y, c, result;
+
+    data = calloc(1, size);
+
+    if (!data) {
+        return OPENDCP_ERROR;
+    }
+
+    data[0] = 'B';
+    data[1] = 'M';
+    put_le32(data + 2, size);
+    put_le32(data + 10, 54);
+    put_le32(data + 14, 40);
+    put_le32(data + 18, image->w);
+    put_le32(data + 22, image->h);
+    put_le16(data + 26, 1);
+    put_le16(data + 28, 24);
+    put_le32(data + 34, size - 54);
+
+    for (y = 0; y < image->h; y++) {
+        p = data + 54 + (size_t)row * (image->h - 1 - y);
+
+        for (x = 0; x < image->w; x++) {
+            for (c = 2; c >= 0; c--) {
+                *p++ = image->component[c].data[x + image->component[c].stride * y] >> 4;
+            }
+        }
+    }
+
+    result = bench_write(file, data, size);
+    free(data);
+
+    return result;
+}
+
+/* big endian 10-bit rgb dpx, packed method A */
+static int bench_write_dpx(const char *file, opendcp_image_t *image) {
+    size_t        size = 2048 + (size_t)image->w * image->h * 4;
+    unsigned char *data;
+    unsigned int  word;
+    int           i, result;
+
+    data = calloc(1, size);
+
+    if (!data) {
+        return OPENDCP_ERROR;
+    }
+
+    memcpy(data, "SDPX", 4);
+    put_be32(data + 4, 2048);
+    memcpy(data + 8, "V2.0", 4);
+    put_be32(data + 16, size);
+    put_be32(data + 24, 1664);
+    put_be32(data + 28, 384);
+    put_be32(data + 660, 0xffffffff);
+    put_be16(data + 770, 1);
+    put_be32(data + 772, image->w);
+    put_be32(data + 776, image->h);
+    data[800] = 50;
+    data[803] = 10;
+    put_be16(data + 804, 1);
+    put_be32(data + 808, 2048);
+
+    for (i = 0; i < image->w * image->h; i++) {
+        word = (unsigned int)(image->component[0].data[i] >> 2) << 22 |
+               (unsigned int)(image->component[1].data[i] >> 2) << 12 |
+               (unsigned int)(image->component[2].data[i] >> 2) << 2;
+        put_be32(data + 2048 + (size_t)i * 4, word);
+    }
+
+    result = bench_write(file, data, size);
+    free(data);
+
+    return result;
+}
+
+static uint16_t bench_half(float f) {
+    union { float f; uint32_t u; } v;
+    int e;
+
+    v.f = f;
+    e   = ((v.u >> 23) & 0xff) - 127 + 15;
+
+    if (e <= 0) {
+        return (v.u >> 16) & 0x8000;
+    }
+
+    return ((v.u >> 16) & 0x8000) | (e << 10) | ((v.u >> 13) & 0x3ff);
+}
+
+static unsigned char *bench_exr_attr(unsigned char *p, const char *name, const char *type, int size) {
+    strcpy((char *)p, name);
+    p += strlen(name) + 1;
+    strcpy((char *)p, type);
+    p += strlen(type) + 1;
+    put_le32(p, size);
+
+    return p + 4;
+}
+
+/* uncompressed half float scanline exr */
+static int bench_write_exr(const char *file, opendcp_image_t *image) {
+    static const char *channels = "BGR";
+    size_t        line = (size_t)image->w * 3 * 2;
+    size_t        size = 512 + (size_t)image->h * (8 + 8 + line);
+    unsigned char *data, *p, *table;
+    int           x, y, c, result;
+
+    data = calloc(1, size);
+
+    if (!data) {
+        return OPENDCP_ERROR;
+    }
+
+    p = data;
+    put_le32(p, 20000630);
+    put_le32(p + 4, 2);
+    p += 8;
+
+    p = bench_exr_attr(p, "channels", "chlist", 3 * 18 + 1);
+
+    for (c = 0; c < 3; c++) {
+        *p = channels[c];
+        p += 2;
+        put_le32(p, 1);
+        put_le32(p + 8, 1);
+        put_le32(p + 12, 1);
+        p += 16;
+    }
+
+    p++;
+    p = bench_exr_attr(p, "compression", "compression", 1);
+    *p++ = 0;
+    p = bench_exr_attr(p, "dataWindow", "box2i", 16);
+    put_le32(p + 8, image->w - 1);
+    put_le32(p + 12, image->h - 1);
+    p += 16;
+    p = bench_exr_attr(p, "displayWindow", "box2i", 16);
+    put_le32(p + 8, image->w - 1);
+    put_le32(p + 12, image->h - 1);
+    p += 16;
+    p = bench_exr_attr(p, "lineOrder", "lineOrder", 1);
+    *p++ = 0;
+    *p++ = 0;
+
+    table = p;
+    p    += (size_t)image->h * 8;
+
+    for (y = 0; y < image->h; y++) {
+        put_le32(table + (size_t)y * 8, (unsigned int)(p - data));
+        put_le32(p, y);
+        put_le32(p + 4, line);
+        p += 8;
+
+        /* channels are stored in name order, B G R */
+        for (c = 2; c >= 0; c--) {
+            for (x = 0; x < image->w; x++) {
+                put_le16(p, bench_half(image->component[c].data[x + image->component[c].stride * y] / 4095.0f));
+                p += 2;
+            }
+        }
+    }
+
+    result = bench_write(file, data, p - data);
+    free(data);
+
+    return result;
+}
+
+/* 24-bit 48kHz mono wav of a quiet tone plus noise */
+static int bench_write_wav(const char *file, int seconds, int channel) {
+    int           samples = 48000 * seconds;
+    size_t        size    = 44 + (size_t)samples * 3;
+    unsigned char *data, *p;
+    int           i, v;
+
+    data = malloc(size);
+
+    if (!data) {
+        return OPENDCP_ERROR;
+    }
+
+    memcpy(data, "RIFF", 4);
+    put_le32(data + 4, size - 8);
+    memcpy(data + 8, "WAVEfmt ", 8);
+    put_le32(data + 16, 16);
+    put_le16(data + 20, 1);
+    put_le16(data + 22, 1);
+    put_le32(data + 24, 48000);
+    put_le32(data + 28, 48000 * 3);
+    put_le16(data + 32, 3);
+    put_le16(data + 34, 24);
+    memcpy(data + 36, "data", 4);
+    put_le32(data + 40, samples * 3);
+
+    bench_seed = BENCH_SEED + channel;
+
+    for (i = 0, p = data + 44; i < samples; i++, p += 3) {
+        v = ((i * (channel + 1)) % 96 - 48) * 4096 + (int)(bench_rand() % 256);
+        p[0] = v & 0xff;
+        p[1] = (v >> 8) & 0xff;
+        p[2] = (v >> 16) & 0xff;
+    }
+
+    i = bench_write(file, data, size);
+    free(data);
+
+    return i;
+}
+
+static void bench_free_files(bench_ctx_t *ctx) {
+    int i;
+
+    if (!ctx->filelist) {
+        return;
+    }
+
+    for (i = 0; i < ctx->filelist->nfiles; i++) {
+        unlink(ctx->filelist->files[i]);
+    }
+
+    filelist_free(ctx->filelist);
+    ctx->filelist = NULL;
+}
+
+static void bench_teardown(bench_ctx_t *ctx) {
+    opendcp_image_free(ctx->source);
+    opendcp_image_free(ctx->work);
+    bench_free_files(ctx);
+
+    if (ctx->file[0]) {
+        unlink(ctx->file);
+    }
+
+    free(ctx->in);
+    free(ctx->out);
+}
+
+/* color conversion */
+static int xyz_setup(bench_ctx_t *ctx) {
+    ctx->source = bench_frame(2048, 1080);
+    ctx->work   = bench_frame(2048, 1080);
+    ctx->bytes  = 2048 * 1080 * 3 * sizeof(int);
+
+    return ctx->source && ctx->work ? OPENDCP_NO_ERROR : OPENDCP_ERROR;
+}
+
+static void xyz_reset(bench_ctx_t *ctx) {
+    bench_copy(ctx->work, ctx->source);
+}
+
+static int xyz_lut_run(bench_ctx_t *ctx) {
+    return rgb_to_xyz_lut(ctx->work, CP_SRGB);
+}
+
+static int xyz_calculate_run(bench_ctx_t *ctx) {
+    return rgb_to_xyz_calculate(ctx->work, CP_SRGB);
+}
+
+/* resize, 4K scope down to 2K flat */
+static int resize_setup(bench_ctx_t *ctx) {
+    ctx->source = bench_frame(4096, 1716);
+    ctx->bytes  = 4096 * 1716 * 3 * sizeof(int);
+
+    return ctx->source ? OPENDCP_NO_ERROR : OPENDCP_ERROR;
+}
+
+static void resize_reset(bench_ctx_t *ctx) {
+    opendcp_image_free(ctx->work);
+    ctx->work = opendcp_image_create(3, ctx->source->w, ctx->source->h);
+
+    if (ctx->work) {
+        bench_copy(ctx->work, ctx->source);
+    }
+}
+
+static int resize_nearest_run(bench_ctx_t *ctx) {
+    return ctx->work ? resize(&ctx->work, DCP_CINEMA2K, NEAREST_PIXEL) : OPENDCP_ERROR;
+}
+
+static int resize_bicubic_run(bench_ctx_t *ctx) {
+    return ctx->work ? resize(&ctx->work, DCP_CINEMA2K, BICUBIC) : OPENDCP_ERROR;
+}
+
+/* bicubic resize and xyz lut in one banded pass */
+static int conform_run(bench_ctx_t *ctx) {
+    return ctx->work ? conform_image(&ctx->work, DCP_CINEMA2K, BICUBIC, 1, CP_SRGB, 0) : OPENDCP_ERROR;
+}
+
+/* decoders, the source file is written once in setup */
+static int decode_setup(bench_ctx_t *ctx, const char *ext, int (*writer)(bench_ctx_t *ctx)) {
+    struct stat st;
+    char        name[32];
+
+    ctx->decoder = opendcp_decoder_find(NULL, (char *)ext, 0);
+
+    if (ctx->decoder->id == OPENDCP_DECODER_NONE) {
+        return OPENDCP_ERROR;
+    }
+
+    ctx->source = bench_frame(2048, 1080);
+
+    if (!ctx->source) {
+        return OPENDCP_ERROR;
+    }
+
+    snprintf(name, sizeof(name), "frame.%s", ext);
+    bench_path(ctx, name);
+
+    if (writer(ctx) != OPENDCP_NO_ERROR || stat(ctx->file, &st)) {
+        return OPENDCP_ERROR;
+    }
+
+    ctx->bytes = st.st_size;
+
+    return OPENDCP_NO_ERROR;
+}
+
+static int write_bmp(bench_ctx_t *ctx) {
+    return bench_write_bmp(ctx->file, ctx->source);
+}
+
+static int write_dpx(bench_ctx_t *ctx) {
+    return bench_write_dpx(ctx->file, ctx->source);
+}
+
+static int write_exr(bench_ctx_t *ctx) {
+    return bench_write_exr(ctx->file, ctx->source);
+}
+
+static int write_tif(bench_ctx_t *ctx) {
+    opendcp_encoder_t *encoder = opendcp_encoder_find(NULL, NULL, OPENDCP_ENCODER_TIFF);
+
+    return encoder->encode(ctx->opendcp, ctx->source, ctx->file);
+}
+
+static int write_j2c(bench_ctx_t *ctx) {
+    opendcp_encoder_t *encoder = opendcp_encoder_find(NULL, NULL, OPENDCP_ENCODER_OPENJPEG);
+    int               result;
+
+    if (opendcp_encoder_init(encoder, ctx->opendcp) != OPENDCP_NO_ERROR) {
+        return OPENDCP_ERROR;
+    }
+
+    result = encoder->encode(ctx->opendcp, ctx->source, ctx->file);
+    opendcp_encoder_shutdown(encoder, ctx->opendcp);
+
+    return result;
+}
+
+static int decode_bmp_setup(bench_ctx_t *ctx) {
+    return decode_setup(ctx, "bmp", write_bmp);
+}
+
+static int decode_dpx_setup(bench_ctx_t *ctx) {
+    return decode_setup(ctx, "dpx", write_dpx);
+}
+
+static int decode_exr_setup(bench_ctx_t *ctx) {
+    return decode_setup(ctx, "exr", write_exr);
+}
+
+static int decode_tif_setup(bench_ctx_t *ctx) {
+    return decode_setup(ctx, "tif", write_tif);
+}
+
+static int decode_j2c_setup(bench_ctx_t *ctx) {
+    return decode_setup(ctx, "j2c", write_j2c);
+}
+
+static int decode_run(bench_ctx_t *ctx) {
+    opendcp_image_t *image = NULL;
+    int             result;
+
+    result = ctx->decoder->decode(&image, ctx->file);
+
+    if (image) {
+        opendcp_image_free(image);
+    }
+
+    return result;
+}
+
+/* openjpeg to memory, the path the mxf pipeline uses */
+static int encode_setup(bench_ctx_t *ctx, int profile) {
+    ctx->opendcp->cinema_profile = profile;
+    ctx->encoder = opendcp_encoder_find(NULL, NULL, OPENDCP_ENCODER_OPENJPEG);
+    ctx->source  = profile == DCP_CINEMA4K ? bench_frame(4096, 2160) : bench_frame(2048, 1080);
+
+    if (!ctx->source) {
+        return OPENDCP_ERROR;
+    }
+
+    ctx->bytes = (unsigned long long)ctx->source->w * ctx->source->h * 3 * sizeof(int);
+
+    return opendcp_encoder_init(ctx->encoder, ctx->opendcp);
+}
+
+static int encode_2k_setup(bench_ctx_t *ctx) {
+    return encode_setup(ctx, DCP_CINEMA2K);
+}
+
+static int encode_4k_setup(bench_ctx_t *ctx) {
+    return encode_setup(ctx, DCP_CINEMA4K);
+}
+
+static int encode_run(bench_ctx_t *ctx) {
+    unsigned char *data = NULL;
+    int           length = 0;
+    int           result;
+
+    result = opendcp_encoder_encode_buffer(ctx->encoder, ctx->opendcp, ctx->source, &data, &length);
+    free(data);
+
+    return result;
+}
+
+static void encode_teardown(bench_ctx_t *ctx) {
+    opendcp_encoder_shutdown(ctx->encoder, ctx->opendcp);
+    ctx->opendcp->cinema_profile = DCP_CINEMA2K;
+    bench_teardown(ctx);
+}
+
+/* mxf wrapping of a short reel */
+static int mxf_j2k_setup(bench_ctx_t *ctx) {
+    struct stat   st;
+    unsigned char *data;
+    int           length, i;
+    char          name[32];
+
+    ctx->encoder = opendcp_encoder_find(NULL, NULL, OPENDCP_ENCODER_OPENJPEG);
+    ctx->source  = bench_frame(2048, 1080);
+
+    if (!ctx->source || opendcp_encoder_init(ctx->encoder, ctx->opendcp) != OPENDCP_NO_ERROR) {
+        return OPENDCP_ERROR;
+    }
+
+    i = opendcp_encoder_encode_buffer(ctx->encoder, ctx->opendcp, ctx->source, &data, &length);
+    opendcp_encoder_shutdown(ctx->encoder, ctx->opendcp);
+
+    if (i != OPENDCP_NO_ERROR) {
+        return OPENDCP_ERROR;
+    }
+
+    ctx->filelist = filelist_alloc(BENCH_MXF_FRAMES);
+
+    for (i = 0; ctx->filelist && i < BENCH_MXF_FRAMES; i++) {
+        snprintf(name, sizeof(name), "frame_%05d.j2c", i);
+        bench_path(ctx, name);
+        snprintf(ctx->filelist->files[i], MAX_FILENAME_LENGTH, "%s", ctx->file);
+
+        if (bench_write(ctx->file, data, length) != OPENDCP_NO_ERROR) {
+            break;
+        }
+    }
+
+    free(data);
+
+    if (!ctx->filelist || i < BENCH_MXF_FRAMES || stat(ctx->file, &st)) {
+        return OPENDCP_ERROR;
+    }
+
+    ctx->bytes = (unsigned long long)st.st_size * BENCH_MXF_FRAMES;
+    bench_path(ctx, "video.mxf");
+
+    return OPENDCP_NO_ERROR;
+}
+
+static int mxf_pcm_setup(bench_ctx_t *ctx) {
+    char name[32];
+    int  i;
+
+    ctx->filelist = filelist_alloc(BENCH_PCM_CHANNELS);
+
+    for (i = 0; ctx->filelist && i < BENCH_PCM_CHANNELS; i++) {
+        snprintf(name, sizeof(name), "channel_%d.wav", i);
+        bench_path(ctx, name);
+        snprintf(ctx->filelist->files[i], MAX_FILENAME_LENGTH, "%s", ctx->file);
+
+        if (bench_write_wav(ctx->file, BENCH_PCM_SECONDS, i) != OPENDCP_NO_ERROR) {
+            break;
+        }
+    }
+
+    if (!ctx->filelist || i < BENCH_PCM_CHANNELS) {
+        return OPENDCP_ERROR;
+    }
+
+    ctx->bytes = 48000ULL * 3 * BENCH_PCM_SECONDS * BENCH_PCM_CHANNELS;
+    bench_path(ctx, "audio.mxf");
+
+    return OPENDCP_NO_ERROR;
+}
+
+static int mxf_run(bench_ctx_t *ctx) {
+    ctx->opendcp->mxf.start_frame = 1;
+    ctx->opendcp->mxf.end_frame   = 0;
+    ctx->opendcp->mxf.duration    = 0;
+
+    return write_mxf(ctx->opendcp, ctx->filelist, ctx->file);
+}
+
+/* essence encryption and hashing */
+static int buffer_setup(bench_ctx_t *ctx) {
+    size_t i;
+
+    ctx->in  = malloc(BENCH_BUFFER_SIZE);
+    ctx->out = malloc(BENCH_BUFFER_SIZE);
+
+    if (!ctx->in || !ctx->out) {
+        return OPENDCP_ERROR;
+    }
+
+    bench_seed = BENCH_SEED;
+
+    for (i = 0; i < BENCH_BUFFER_SIZE; i++) {
+        ctx->in[i] = bench_rand();
+    }
+
+    ctx->bytes = BENCH_BUFFER_SIZE;
+
+    return OPENDCP_NO_ERROR;
+}
+
+static int aes_run(bench_ctx_t *ctx, int enc) {
+    static const unsigned char key_value[16] = { 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+                                                 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff };
+    unsigned char iv[AES_BLOCK_SIZE];
+    aes_key_t     key;
+
+    memset(iv, 0, sizeof(iv));
+
+    if (enc) {
+        AES_set_encrypt_key(key_value, 128, &key);
+    }
+    else {
+        AES_set_decrypt_key(key_value, 128, &key);
+    }
+
+    AES_cbc_encrypt(ctx->in, ctx->out, BENCH_BUFFER_SIZE, &key, iv, enc);
+
+    return OPENDCP_NO_ERROR;
+}
+
+static int aes_encrypt_run(bench_ctx_t *ctx) {
+    return aes_run(ctx, 1);
+}
+
+static int aes_decrypt_run(bench_ctx_t *ctx) {
+    return aes_run(ctx, 0);
+}
+
+static int sha1_run(bench_ctx_t *ctx) {
+    sha1_t ctx_sha1;
+    byte_t hash[20];
+
+    sha1_init(&ctx_sha1);
+    sha1_update(&ctx_sha1, ctx->in, BENCH_BUFFER_SIZE);
+    sha1_final(&ctx_sha1, hash);
+
+    return OPENDCP_NO_ERROR;
+}
+
+static const bench_t benchmarks[] = {
+    { "xyz_lut_2k",          xyz_setup,        xyz_reset,    xyz_lut_run,        bench_teardown  },
+    { "xyz_calculate_2k",    xyz_setup,        xyz_reset,    xyz_calculate_run,  bench_teardown  },
+    { "resize_nearest_4k2k", resize_setup,     resize_reset, resize_nearest_run, bench_teardown  },
+    { "resize_bicubic_4k2k", resize_setup,     resize_reset, resize_bicubic_run, bench_teardown  },
+    { "conform_4k2k",        resize_setup,     resize_reset, conform_run,        bench_teardown  },
+    { "decode_bmp_2k",       decode_bmp_setup, NULL,         decode_run,         bench_teardown  },
+    { "decode_dpx_2k",       decode_dpx_setup, NULL,         decode_run,         bench_teardown  },
+    { "decode_exr_2k",       decode_exr_setup, NULL,         decode_run,         bench_teardown  },
+    { "decode_tif_2k",       decode_tif_setup, NULL,         decode_run,         bench_teardown  },
+    { "decode_j2c_2k",       decode_j2c_setup, NULL,         decode_run,         bench_teardown  },
+    { "encode_openjpeg_2k",  encode_2k_setup,  NULL,         encode_run,         encode_teardown },
+    { "encode_openjpeg_4k",  encode_4k_setup,  NULL,         encode_run,         encode_teardown },
+    { "mxf_j2k",             mxf_j2k_setup,    NULL,         mxf_run,            bench_teardown  },
+    { "mxf_pcm",             mxf_pcm_setup,    NULL,         mxf_run,            bench_teardown  },
+    { "aes_cbc_encrypt",     buffer_setup,     NULL,         aes_encrypt_run,    bench_teardown  },
+    { "aes_cbc_decrypt",     buffer_setup,     NULL,         aes_decrypt_run,    bench_teardown  },
+    { "sha1",                buffer_setup,     NULL,         sha1_run,           bench_teardown  },
+    { NULL, NULL, NULL, NULL, NULL }
+};
+
+static int compare_ull(const void *a, const void *b) {
+    unsigned long long x = *(const unsigned long long *)a;
+    unsigned long long y = *(const unsigned long long *)b;
+
+    return x < y ? -1 : x > y;
+}
+
+static int bench_selected(const char *name, char *filter) {
+    char list[256], *token, *save;
+
+    if (!filter) {
+        return 1;
+    }
+
+    snprintf(list, sizeof(list), "%s", filter);
+
+    for (token = strtok_r(list, ",", &save); token; token = strtok_r(NULL, ",", &save)) {
+        if (strstr(name, token)) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/* one warm up run, then the min and median of the timed runs */
+static int bench_run(const bench_t *bench, bench_ctx_t *ctx, int iterations) {
+    unsigned long long *times, start, mean = 0;
+    int i, result = OPENDCP_NO_ERROR;
+
+    times = malloc(iterations * sizeof(*times));
+
+    if (!times) {
+        return OPENDCP_ERROR;
+    }
+
+    if (bench->setup(ctx) != OPENDCP_NO_ERROR) {
+        printf("%-22s skipped\n", bench->name);
+        bench->teardown(ctx);
+        free(times);
+        return OPENDCP_NO_ERROR;
+    }
+
+    for (i = -1; i < iterations && result == OPENDCP_NO_ERROR; i++) {
+        if (bench->reset) {
+            bench->reset(ctx);
+        }
+
+        start  = opendcp_metrics_now();
+        result = bench->run(ctx);
+
+        if (i >= 0) {
+            times[i] = opendcp_metrics_now() - start;
+            mean    += times[i];
+        }
+    }
+
+    bench->teardown(ctx);
+
+    if (result != OPENDCP_NO_ERROR) {
+        printf("%-22s failed\n", bench->name);
+        free(times);
+        return OPENDCP_ERROR;
+    }
+
+    qsort(times, iterations, sizeof(*times), compare_ull);
+
+    printf("%-22s %6d %10.3f %10.3f %10.3f %10.1f\n", bench->name, iterations,
+           times[0] / 1e6, times[iterations / 2] / 1e6, mean / 1e6 / iterations,
+           times[0] ? ctx->bytes / (times[0] / 1e9) / (1024 * 1024) : 0.0);
+
+    free(times);
+
+    return OPENDCP_NO_ERROR;
+}
+
+void version() {
+    FILE *fp;
+    char kernels[512];
+
+    fp = stdout;
+    fprintf(fp, "\n%s version %s %s\n\n", OPENDCP_NAME, OPENDCP_VERSION, OPENDCP_COPYRIGHT);
+    fprintf(fp, "%s\n\n", cpu_describe(kernels, sizeof(kernels)));
+
+    exit(0);
+}
+
+void dcp_usage() {
+    FILE *fp;
+    int  i;
+
+    fp = stdout;
+
+    fprintf(fp, "\n%s version %s %s\n\n", OPENDCP_NAME, OPENDCP_VERSION, OPENDCP_COPYRIGHT);
+    fprintf(fp, "Usage:\n");
+    fprintf(fp, "       opendcp_bench [options]\n\n");
+    fprintf(fp, "Options:\n");
+    fprintf(fp, "       -n | --iterations <count>      - timed runs per benchmark (default 10)\n");
+    fprintf(fp, "       -b | --bench <name,...>        - only run benchmarks whose name contains one of these\n");
+    fprintf(fp, "       -d | --tmp_dir <dir>           - directory for the generated files (default /tmp)\n");
+    fprintf(fp, "       -l | --log_level <level>       - sets the log level 0:Quiet, 1:Error (default), 2:Warn, 3:Info, 4:Debug\n");
+    fprintf(fp, "       -h | --help                    - show help\n");
+    fprintf(fp, "       -v | --version                 - show version\n");
+    fprintf(fp, "\nBenchmarks:\n");
+
+    for (i = 0; benchmarks[i].name; i++) {
+        fprintf(fp, "       %s\n", benchmarks[i].name);
+    }
+
+    fprintf(fp, "\n\n");
+
+    exit(0);
+}
+
+int main (int argc, char **argv) {
+    opendcp_t   *opendcp;
+    bench_ctx_t ctx;
+    char        *filter  = NULL;
+    char        *tmp_dir = "/tmp";
+    int         iterations = 10;
+    int         failed = 0;
+    int         c, i;
+    char        kernels[512];
+
+    opendcp = opendcp_create();
+
+    opendcp->log_level      = LOG_ERROR;
+    opendcp->cinema_profile = DCP_CINEMA2K;
+    opendcp->frame_rate     = 24;
+    opendcp->ns             = XML_NS_SMPTE;
+    opendcp->j2k.bw         = 250 * 1000000;
+    opendcp->j2k.rate_control = J2K_RATE_FIXED;
+
+    while (1)
+    {
+        static struct option long_options[] =
+        {
+            {"bench",          required_argument, 0, 'b'},
+            {"tmp_dir",        required_argument, 0, 'd'},
+            {"help",           no_argument,       0, 'h'},
+            {"log_level",      required_argument, 0, 'l'},
+            {"iterations",     required_argument, 0, 'n'},
+            {"version",        no_argument,       0, 'v'},
+            {0, 0, 0, 0}
+        };
+
+        int option_index = 0;
+
+        c = getopt_long (argc, argv, "b:d:l:n:hv", long_options, &option_index);
+
+        if (c == -1) {
+            break;
+        }
+
+        switch (c)
+        {
+            case 'b':
+                filter = optarg;
+                break;
+
+            case 'd':
+                tmp_dir = optarg;
+                break;
+
+            case 'l':
+                opendcp->log_level = atoi(optarg);
+                break;
+
+            case 'n':
+                iterations = atoi(optarg);
+
+                if (iterations < 1) {
+                    dcp_fatal(opendcp, "Iterations must be greater than 0");
+                }
+
+                break;
+
+            case 'h':
+                dcp_usage();
+                break;
+
+            case 'v':
+                version();
+                break;
+
+            default:
+                dcp_usage();
+        }
+    }
+
+    opendcp_log_init(opendcp->log_level);
+
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.opendcp = opendcp;
+    snprintf(ctx.dir, sizeof(ctx.dir), "%s/opendcp_bench_XXXXXX", tmp_dir);
+
+    if (!mkdtemp(ctx.dir)) {
+        dcp_fatal(opendcp, "Could not create a directory in %s", tmp_dir);
+    }
+
+    printf("%s\n\n", cpu_describe(kernels, sizeof(kernels)));
+    printf("%-22s %6s %10s %10s %10s %10s\n", "benchmark", "runs", "min ms", "median ms", "mean ms", "MB/s");
+
+    for (i = 0; benchmarks[i].name; i++) {
+        if (!bench_selected(benchmarks[i].name, filter)) {
+            continue;
+        }
+
+        memset(&ctx.file, 0, sizeof(ctx) - offsetof(bench_ctx_t, file));
+        failed |= bench_run(&benchmarks[i], &ctx, iterations) != OPENDCP_NO_ERROR;
+    }
+
+    rmdir(ctx.dir);
+    opendcp_delete(opendcp);
+
+    exit(failed);
+}
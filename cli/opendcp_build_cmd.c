@@ -0,0 +1,710 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2013 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <getopt.h>
+#include <signal.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <direct.h>
+#define build_mkdir(dir) _mkdir(dir)
+#define build_chdir(dir) _chdir(dir)
+#else
+#include <unistd.h>
+#define build_mkdir(dir) mkdir(dir, 0777)
+#define build_chdir(dir) chdir(dir)
+#endif
+#include <opendcp.h>
+#include <opendcp_encoder.h>
+#include <opendcp_decoder.h>
+#include "opendcp_cli.h"
+#include "cpu.h"
+
+/*
+   opendcp_build makes a single reel package in one run. The picture is
+   encoded straight into its mxf, while the sound and subtitle tracks are
+   wrapped on their own threads, each with a copy of the options and one
+   reader thread taken from the thread count. Every mxf is hashed as it
+   is written, so the packing list only reads the digests back, and the
+   composition and packing lists are signed in one session at the end.
+*/
+#define BUILD_TRACKS_MAX 3
+
+typedef struct {
+    const char  *essence;
+    char        output[MAX_FILENAME_LENGTH];
+    opendcp_t   *opendcp;
+    filelist_t  *filelist;
+    int         result;
+    double      seconds;
+    pthread_t   thread;
+    int         started;
+} build_track_t;
+
+cli_progress_t progress;
+
+#ifndef _WIN32
+/* the picture stops between frames once j2k.cancel is set */
+opendcp_t *sig_context = NULL;
+
+void sig_handler(int signum) {
+    UNUSED(signum);
+
+    if (sig_context) {
+        sig_context->j2k.cancel = 1;
+    }
+}
+#endif
+
+void version() {
+    FILE *fp;
+    char kernels[512];
+
+    fp = stdout;
+    fprintf(fp, "\n%s version %s %s\n\n", OPENDCP_NAME, OPENDCP_VERSION, OPENDCP_COPYRIGHT);
+    fprintf(fp, "%s\n\n", cpu_describe(kernels, sizeof(kernels)));
+
+    exit(0);
+}
+
+void dcp_usage() {
+    FILE *fp;
+    fp = stdout;
+
+    fprintf(fp, "\n%s version %s %s\n\n", OPENDCP_NAME, OPENDCP_VERSION, OPENDCP_COPYRIGHT);
+    fprintf(fp, "Builds a single reel DCP from an image sequence, wav files and a subtitle file in one run\n\n");
+    fprintf(fp, "Usage:\n");
+    fprintf(fp, "       opendcp_build -p <images> -o <dcp directory> [options ...]\n\n");
+    fprintf(fp, "Ex:\n");
+    fprintf(fp, "       opendcp_build -p tiffs -s wavs -o MyFilm_FTR --title MyFilm --kind feature\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "Required:\n");
+    fprintf(fp, "       -p | --picture <path>              - the image sequence, a directory or a single image\n");
+    fprintf(fp, "       -o | --output <dir>                - the package directory, created if it does not exist\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "Options:\n");
+    fprintf(fp, "       -s | --sound <path>                - a wav file, or a directory of one wav file per channel\n");
+    fprintf(fp, "       -u | --subtitle <file>             - a smpte timed text subtitle file\n");
+    fprintf(fp, "       -P | --profile <profile>           - jpeg2000 cinema profile cinema2k | cinema4k (default cinema2k)\n");
+    fprintf(fp, "       -b | --bw <mb/s>                   - max mb/s bandwidth (default 250)\n");
+    fprintf(fp, "       -c | --colorspace <color>          - select the input color space srgb, rec709, p3, srgb_complex, rec709_complex\n");
+    fprintf(fp, "       -x | --no_xyz                      - do not perform rgb->xyz color conversion\n");
+    fprintf(fp, "       -r | --rate <rate>                 - frame rate (default 24)\n");
+    fprintf(fp, "       -n | --ns <interop|smpte>          - generate interop or smpte mxf and xml (default smpte)\n");
+    fprintf(fp, "       -t | --title <title>               - DCP content title\n");
+    fprintf(fp, "       -k | --kind <kind>                 - content kind (test, feature, trailer, policy, teaser, etc)\n");
+    fprintf(fp, "       -m | --rating <rating>             - DCP MPAA rating G PG PG-13 R NC-17 (default none)\n");
+    fprintf(fp, "       -i | --issuer <issuer>             - issuer details\n");
+    fprintf(fp, "       -a | --annotation <annotation>     - asset annotations\n");
+#ifdef XMLSEC
+    fprintf(fp, "       -S | --sign                        - writes XML digital signature\n");
+    fprintf(fp, "       -1 | --root                        - root pem certificate used to sign XML files\n");
+    fprintf(fp, "       -2 | --ca                          - CA (intermediate) pem certificate used to sign XML files\n");
+    fprintf(fp, "       -3 | --signer                      - signer (leaf) pem certificate used to sign XML files\n");
+    fprintf(fp, "       -4 | --privatekey                  - private (signer) pem key used to sign XML files\n");
+#endif
+    fprintf(fp, "       -T | --threads <threads>           - threads shared by the tracks, one per sound or subtitle track and the rest encode the picture\n");
+    fprintf(fp, "       -l | --log_level <level>           - sets the log level 0:Quiet, 1:Error, 2:Warn (default),  3:Info, 4:Debug\n");
+    fprintf(fp, "       -h | --help                        - show help\n");
+    fprintf(fp, "       -v | --version                     - show version\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "       Packages of several reels are built with opendcp_j2k, opendcp_mxf and opendcp_xml.\n");
+    fprintf(fp, "\n\n");
+
+    fclose(fp);
+    exit(0);
+}
+
+int frame_done_cb(void *p) {
+    UNUSED(p);
+    cli_progress_add(&progress, 1);
+
+    return 0;
+}
+
+/* the files of a track in sequence order */
+filelist_t *build_filelist(const char *path, const char *filter) {
+    filelist_t *filelist = get_filelist(path, filter);
+    int        rc = OPENDCP_NO_ERROR;
+
+    if (!filelist || filelist->nfiles < 1) {
+        filelist_free(filelist);
+        return NULL;
+    }
+
+    if (order_sequence(filelist->files, filelist->nfiles, &rc) != OPENDCP_NO_ERROR) {
+        filelist_free(filelist);
+        return NULL;
+    }
+
+    if (rc != OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_WARN, "Filenames not sequential between %s and %s.", filelist->files[rc], filelist->files[rc + 1]);
+    }
+
+    return filelist;
+}
+
+/* a sound or subtitle track, with its own copy of the options */
+void build_track_init(opendcp_t *opendcp, build_track_t *track, const char *essence, const char *input,
+                      const char *filter, const char *dir, int duration) {
+    memset(track, 0, sizeof(*track));
+    track->essence  = essence;
+    track->filelist = build_filelist(input, filter);
+
+    if (!track->filelist) {
+        dcp_fatal(opendcp, "Could not read the %s files %s", essence, input);
+    }
+
+    track->opendcp = malloc(sizeof(opendcp_t));
+
+    if (!track->opendcp) {
+        dcp_fatal(opendcp, "Out of memory");
+    }
+
+    memcpy(track->opendcp, opendcp, sizeof(opendcp_t));
+    track->opendcp->threads  = 1;
+    track->opendcp->duration = duration;
+    snprintf(track->output, sizeof(track->output), "%s/%s.mxf", dir, essence);
+}
+
+void *build_track_thread(void *arg) {
+    build_track_t      *track = arg;
+    unsigned long long start = opendcp_metrics_now();
+
+    track->result  = write_mxf(track->opendcp, track->filelist, track->output);
+    track->seconds = (opendcp_metrics_now() - start) / 1e9;
+
+    return NULL;
+}
+
+/* adds the tracks to one reel and writes the xml of the package in the current directory */
+int build_xml(opendcp_t *opendcp, char *mxf_files[], int count) {
+    asset_t assets[BUILD_TRACKS_MAX];
+    asset_t *asset_ptr[BUILD_TRACKS_MAX];
+    reel_t  reel;
+    pkl_t   pkl;
+    cpl_t   cpl;
+    int     i;
+
+    create_pkl(&opendcp->dcp, &pkl);
+    add_pkl_to_dcp(&opendcp->dcp, &pkl);
+    create_cpl(&opendcp->dcp, &cpl);
+    add_cpl_to_pkl(&opendcp->dcp.pkl[0], &cpl);
+
+    for (i = 0; i < count; i++) {
+        if (add_asset(opendcp, &assets[i], mxf_files[i]) != OPENDCP_NO_ERROR) {
+            OPENDCP_LOG(LOG_ERROR, "Could not read asset %s", mxf_files[i]);
+            return OPENDCP_ERROR;
+        }
+
+        asset_ptr[i] = &assets[i];
+    }
+
+    /* the digests were recorded while the mxf files were written */
+    if (calculate_digests(opendcp, asset_ptr, count) != OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_ERROR, "Digest calculation failed");
+        return OPENDCP_ERROR;
+    }
+
+    create_reel(&opendcp->dcp, &reel);
+
+    for (i = 0; i < count; i++) {
+        add_asset_to_reel(opendcp, &reel, assets[i]);
+    }
+
+    if (validate_reel(opendcp, &reel, 0) != OPENDCP_NO_ERROR || !add_reel_to_cpl(&opendcp->dcp.pkl[0].cpl[0], &reel)) {
+        OPENDCP_LOG(LOG_ERROR, "Could not validate the reel");
+        return OPENDCP_ERROR;
+    }
+
+    if (opendcp->ns == XML_NS_SMPTE) {
+        sprintf(opendcp->dcp.assetmap.filename, "%s", "ASSETMAP.xml");
+        sprintf(opendcp->dcp.volindex.filename, "%s", "VOLINDEX.xml");
+    }
+    else {
+        sprintf(opendcp->dcp.assetmap.filename, "%s", "ASSETMAP");
+        sprintf(opendcp->dcp.volindex.filename, "%s", "VOLINDEX");
+    }
+
+#ifdef XMLSEC
+
+    /* load the signing keys once for the cpl and the pkl */
+    if (opendcp->xml_signature.sign && xml_sign_session_open(opendcp, 1) == NULL) {
+        OPENDCP_LOG(LOG_ERROR, "Loading XML signature keys failed");
+        return OPENDCP_ERROR;
+    }
+
+#endif
+
+    if (write_cpl(opendcp, &opendcp->dcp.pkl[0].cpl[0]) != OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_ERROR, "Writing composition playlist failed");
+        return OPENDCP_ERROR;
+    }
+
+    if (write_pkl(opendcp, &opendcp->dcp.pkl[0]) != OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_ERROR, "Writing packing list failed");
+        return OPENDCP_ERROR;
+    }
+
+#ifdef XMLSEC
+    xml_sign_session_close(opendcp->xml_signature.session);
+    opendcp->xml_signature.session = NULL;
+#endif
+
+    if (write_volumeindex(opendcp) != OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_ERROR, "Writing volume index failed");
+        return OPENDCP_ERROR;
+    }
+
+    if (write_assetmap(opendcp) != OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_ERROR, "Writing asset map failed");
+        return OPENDCP_ERROR;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+int main (int argc, char **argv) {
+    int c, i;
+    int result;
+    opendcp_t *opendcp;
+    char *picture_path = NULL;
+    char *sound_path = NULL;
+    char *subtitle_path = NULL;
+    char *out_path = NULL;
+    char *extensions;
+    char picture_file[MAX_FILENAME_LENGTH];
+    char sidecar[MAX_FILENAME_LENGTH + 8];
+    char *mxf_files[BUILD_TRACKS_MAX];
+    build_track_t tracks[BUILD_TRACKS_MAX - 1];
+    int ntracks = 0;
+    int nthreads;
+    int nframes;
+    j2k_frame_t *frames;
+    filelist_t *filelist;
+    struct stat st;
+    unsigned long long start;
+    double seconds;
+
+    if (argc <= 1) {
+        dcp_usage();
+    }
+
+#ifndef _WIN32
+    struct sigaction sig_action;
+    sig_action.sa_handler = sig_handler;
+    sig_action.sa_flags = 0;
+    sigemptyset(&sig_action.sa_mask);
+
+    sigaction(SIGINT,  &sig_action, NULL);
+    sigaction(SIGTERM, &sig_action, NULL);
+#endif
+
+    opendcp = opendcp_create();
+
+#ifndef _WIN32
+    sig_context = opendcp;
+#endif
+
+    /* set initial values */
+    opendcp->log_level       = LOG_WARN;
+    opendcp->cinema_profile  = DCP_CINEMA2K;
+    opendcp->frame_rate      = 24;
+    opendcp->ns              = XML_NS_SMPTE;
+    opendcp->j2k.xyz         = 1;
+    opendcp->j2k.encoder     = OPENDCP_ENCODER_OPENJPEG;
+    opendcp->j2k.start_frame = 1;
+    opendcp->j2k.bw          = 250;
+    opendcp->threads         = opendcp_pool_threads();
+
+    /* parse options */
+    while (1)
+    {
+        static struct option long_options[] =
+        {
+            {"picture",        required_argument, 0, 'p'},
+            {"sound",          required_argument, 0, 's'},
+            {"subtitle",       required_argument, 0, 'u'},
+            {"output",         required_argument, 0, 'o'},
+            {"profile",        required_argument, 0, 'P'},
+            {"bw",             required_argument, 0, 'b'},
+            {"colorspace",     required_argument, 0, 'c'},
+            {"no_xyz",         no_argument,       0, 'x'},
+            {"rate",           required_argument, 0, 'r'},
+            {"ns",             required_argument, 0, 'n'},
+            {"title",          required_argument, 0, 't'},
+            {"kind",           required_argument, 0, 'k'},
+            {"rating",         required_argument, 0, 'm'},
+            {"issuer",         required_argument, 0, 'i'},
+            {"annotation",     required_argument, 0, 'a'},
+            {"sign",           no_argument,       0, 'S'},
+            {"root",           required_argument, 0, '1'},
+            {"ca",             required_argument, 0, '2'},
+            {"signer",         required_argument, 0, '3'},
+            {"privatekey",     required_argument, 0, '4'},
+            {"threads",        required_argument, 0, 'T'},
+            {"log_level",      required_argument, 0, 'l'},
+            {"help",           no_argument,       0, 'h'},
+            {"version",        no_argument,       0, 'v'},
+            {0, 0, 0, 0}
+        };
+
+        /* getopt_long stores the option index here. */
+        int option_index = 0;
+
+        c = getopt_long (argc, argv, "a:b:c:i:k:l:m:n:o:p:r:s:t:u:P:T:1:2:3:4:hvxS",
+                         long_options, &option_index);
+
+        /* Detect the end of the options. */
+        if (c == -1) {
+            break;
+        }
+
+        switch (c)
+        {
+            case 'p':
+                picture_path = optarg;
+                break;
+
+            case 's':
+                sound_path = optarg;
+                break;
+
+            case 'u':
+                subtitle_path = optarg;
+                break;
+
+            case 'o':
+                out_path = optarg;
+                break;
+
+            case 'P':
+                if (!strcmp(optarg, "cinema2k")) {
+                    opendcp->cinema_profile = DCP_CINEMA2K;
+                }
+                else if (!strcmp(optarg, "cinema4k")) {
+                    opendcp->cinema_profile = DCP_CINEMA4K;
+                }
+                else {
+                    dcp_fatal(opendcp, "Invalid profile argument, must be cinema2k or cinema4k");
+                }
+
+                break;
+
+            case 'b':
+                opendcp->j2k.bw = atoi(optarg);
+
+                if (opendcp->j2k.bw < 1) {
+                    dcp_fatal(opendcp, "Bandwidth must be greater than 0");
+                }
+
+                break;
+
+            case 'c':
+                if (!strcmp(optarg, "srgb")) {
+                    opendcp->j2k.lut = CP_SRGB;
+                }
+                else if (!strcmp(optarg, "rec709")) {
+                    opendcp->j2k.lut = CP_REC709;
+                }
+                else if (!strcmp(optarg, "p3")) {
+                    opendcp->j2k.lut = CP_P3;
+                }
+                else if (!strcmp(optarg, "srgb_complex")) {
+                    opendcp->j2k.lut = CP_SRGB_COMPLEX;
+                }
+                else if (!strcmp(optarg, "rec709_complex")) {
+                    opendcp->j2k.lut = CP_REC709_COMPLEX;
+                }
+                else {
+                    dcp_fatal(opendcp, "Invalid colorspace argument");
+                }
+
+                break;
+
+            case 'x':
+                opendcp->j2k.xyz = 0;
+                break;
+
+            case 'r':
+                opendcp->frame_rate = atoi(optarg);
+
+                if (opendcp->frame_rate > 60 || opendcp->frame_rate < 1) {
+                    dcp_fatal(opendcp, "Invalid frame rate. Must be between 1 and 60");
+                }
+
+                break;
+
+            case 'n':
+                if (!strcmp(optarg, "smpte")) {
+                    opendcp->ns = XML_NS_SMPTE;
+                }
+                else if (!strcmp(optarg, "interop")) {
+                    opendcp->ns = XML_NS_INTEROP;
+                }
+                else {
+                    dcp_fatal(opendcp, "Invalid namespace argument, must be smpte or interop");
+                }
+
+                break;
+
+            case 't':
+                snprintf(opendcp->dcp.title, sizeof(opendcp->dcp.title), "%s", optarg);
+                break;
+
+            case 'k':
+                snprintf(opendcp->dcp.kind, sizeof(opendcp->dcp.kind), "%s", optarg);
+                break;
+
+            case 'm':
+                if (strcmp(optarg, "G") && strcmp(optarg, "PG") && strcmp(optarg, "PG-13") &&
+                    strcmp(optarg, "R") && strcmp(optarg, "NC-17")) {
+                    dcp_fatal(opendcp, "Invalid rating %s", optarg);
+                }
+
+                snprintf(opendcp->dcp.rating, sizeof(opendcp->dcp.rating), "%s", optarg);
+                break;
+
+            case 'i':
+                snprintf(opendcp->dcp.issuer, sizeof(opendcp->dcp.issuer), "%s", optarg);
+                break;
+
+            case 'a':
+                snprintf(opendcp->dcp.annotation, sizeof(opendcp->dcp.annotation), "%s", optarg);
+                break;
+
+#ifdef XMLSEC
+
+            case 'S':
+                opendcp->xml_signature.sign = 1;
+                break;
+#endif
+
+            case '1':
+                opendcp->xml_signature.root = optarg;
+                opendcp->xml_signature.use_external = 1;
+                break;
+
+            case '2':
+                opendcp->xml_signature.ca = optarg;
+                opendcp->xml_signature.use_external = 1;
+                break;
+
+            case '3':
+                opendcp->xml_signature.signer = optarg;
+                opendcp->xml_signature.use_external = 1;
+                break;
+
+            case '4':
+                opendcp->xml_signature.private_key = optarg;
+                opendcp->xml_signature.use_external = 1;
+                break;
+
+            case 'T':
+                opendcp->threads = atoi(optarg);
+
+                if (opendcp->threads < 1) {
+                    dcp_fatal(opendcp, "Threads must be greater than 0");
+                }
+
+                break;
+
+            case 'l':
+                opendcp->log_level = atoi(optarg);
+                break;
+
+            case 'h':
+                dcp_usage();
+                break;
+
+            case 'v':
+                version();
+                break;
+
+            default:
+                dcp_usage();
+        }
+    }
+
+    opendcp_log_init(opendcp->log_level);
+
+    if (opendcp->log_level > 0) {
+        printf("\nOpenDCP Build %s %s\n", OPENDCP_VERSION, OPENDCP_COPYRIGHT);
+    }
+
+    if (!picture_path) {
+        dcp_fatal(opendcp, "Missing picture input");
+    }
+
+    if (!out_path) {
+        dcp_fatal(opendcp, "Missing output directory");
+    }
+
+    if (out_path[strlen(out_path) - 1] == '/') {
+        out_path[strlen(out_path) - 1] = '\0';
+    }
+
+    if (stat(out_path, &st) != 0 && build_mkdir(out_path) != 0) {
+        dcp_fatal(opendcp, "Could not create output directory %s", out_path);
+    }
+
+    if (opendcp->xml_signature.sign && opendcp->xml_signature.use_external &&
+        (!opendcp->xml_signature.root || !opendcp->xml_signature.ca ||
+         !opendcp->xml_signature.signer || !opendcp->xml_signature.private_key)) {
+        dcp_fatal(opendcp, "XML digital signature certificates enabled, give the root, ca, signer and private key");
+    }
+
+    /* every track is hashed as it is written and the packing list carries the digests */
+    opendcp->mxf.digest_flag = 1;
+    opendcp->dcp.digest_flag = 1;
+
+    /* the picture frames, encoded in memory and wrapped as they are done */
+    extensions = opendcp_decoder_extensions();
+    filelist   = build_filelist(picture_path, extensions);
+    free(extensions);
+
+    if (!filelist) {
+        dcp_fatal(opendcp, "No input images located in %s", picture_path);
+    }
+
+    frames = malloc(filelist->nfiles * sizeof(j2k_frame_t));
+
+    if (!frames) {
+        dcp_fatal(opendcp, "Could not allocate frame list");
+    }
+
+    for (nframes = 0; nframes < filelist->nfiles; nframes++) {
+        frames[nframes].in_file  = filelist->files[nframes];
+        frames[nframes].out_file = NULL;
+    }
+
+    opendcp->j2k.end_frame = nframes;
+    snprintf(picture_file, sizeof(picture_file), "%s/picture.mxf", out_path);
+
+    /* sound and subtitle tracks run the length of the picture */
+    if (sound_path) {
+        build_track_init(opendcp, &tracks[ntracks++], "sound", sound_path, "wav", out_path, nframes);
+    }
+
+    if (subtitle_path) {
+        build_track_init(opendcp, &tracks[ntracks++], "subtitle", subtitle_path, "xml", out_path, nframes);
+    }
+
+    /* one thread for each of the other tracks, the picture encodes on the rest */
+    nthreads = opendcp->threads - ntracks > 0 ? opendcp->threads - ntracks : 1;
+    opendcp->threads = nthreads;
+    opendcp_pool_init(nthreads);
+    opendcp_log_async(1);
+
+    if (opendcp_encoder_enable("j2c", NULL, opendcp->j2k.encoder)) {
+        dcp_fatal(opendcp, "Could not enabled encoder");
+    }
+
+    start = opendcp_metrics_now();
+
+    for (i = 0; i < ntracks; i++) {
+        tracks[i].started = pthread_create(&tracks[i].thread, NULL, build_track_thread, &tracks[i]) == 0;
+
+        /* this thread wraps it after the picture instead */
+        if (!tracks[i].started) {
+            OPENDCP_LOG(LOG_WARN, "Could not start the %s track, it is wrapped after the picture", tracks[i].essence);
+        }
+    }
+
+    if (opendcp->log_level > 0 && opendcp->log_level < 3) {
+        opendcp->j2k.frame_done.callback = frame_done_cb;
+        cli_progress_start(&progress, "Picture", 0, nframes);
+    }
+
+    result = convert_to_j2k_mxf(opendcp, frames, nframes, picture_file);
+    cli_progress_stop(&progress);
+    seconds = (opendcp_metrics_now() - start) / 1e9;
+
+    if (opendcp->log_level > 0) {
+        printf("\n  %-8s %-40s %s %6d frames %8.1f fps\n", "picture", picture_file,
+               result == OPENDCP_NO_ERROR ? "done  " : "FAILED", nframes, seconds > 0 ? nframes / seconds : 0.0);
+    }
+
+    for (i = 0; i < ntracks; i++) {
+        if (tracks[i].started) {
+            pthread_join(tracks[i].thread, NULL);
+        }
+        else {
+            build_track_thread(&tracks[i]);
+        }
+
+        if (opendcp->log_level > 0) {
+            printf("  %-8s %-40s %s %8.1fs\n", tracks[i].essence, tracks[i].output,
+                   tracks[i].result == OPENDCP_NO_ERROR ? "done  " : "FAILED", tracks[i].seconds);
+        }
+
+        if (result == OPENDCP_NO_ERROR) {
+            result = tracks[i].result;
+        }
+    }
+
+    free(frames);
+    filelist_free(filelist);
+
+    if (opendcp->j2k.cancel) {
+        dcp_fatal(opendcp, "Build interrupted");
+    }
+
+    if (result != OPENDCP_NO_ERROR) {
+        dcp_fatal(opendcp, "Could not create the track files: %s", OPENDCP_ERROR_STRING[result]);
+    }
+
+    /* the package lists name the track files relative to the package */
+    if (build_chdir(out_path) != 0) {
+        dcp_fatal(opendcp, "Could not enter output directory %s", out_path);
+    }
+
+    mxf_files[0] = strrchr(picture_file, '/') + 1;
+
+    for (i = 0; i < ntracks; i++) {
+        mxf_files[i + 1] = strrchr(tracks[i].output, '/') + 1;
+    }
+
+    if (build_xml(opendcp, mxf_files, ntracks + 1) != OPENDCP_NO_ERROR) {
+        dcp_fatal(opendcp, "Could not write the package xml");
+    }
+
+    /* the digest sidecars have done their job and are not part of the package */
+    for (i = 0; i < ntracks + 1; i++) {
+        snprintf(sidecar, sizeof(sidecar), "%s%s", mxf_files[i], DIGEST_SIDECAR_EXT);
+        remove(sidecar);
+    }
+
+    for (i = 0; i < ntracks; i++) {
+        filelist_free(tracks[i].filelist);
+        free(tracks[i].opendcp);
+    }
+
+    OPENDCP_LOG(LOG_INFO, "DCP Complete in %.2f seconds", (opendcp_metrics_now() - start) / 1e9);
+
+    if (opendcp->log_level > 0) {
+        printf("\n");
+    }
+
+    opendcp_delete(opendcp);
+
+    exit(0);
+}
@@ -31,6 +31,14 @@
 #include <time.h>
 #include <sys/stat.h>
 #include <stdint.h>
+#include <limits.h>
+#include <errno.h>
+#include <pthread.h>
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif
 
 #include "opendcp.h"
 #include "opendcp_cli.h"
@@ -86,14 +94,140 @@ int file_selector(const char *filename, const char *filter) {
     return 0;
 }
 
-filelist_t *get_filelist(const char *path, const char *filter) {
-    DIR *d;
-    struct stat st_in;
+/* directory names collected into one growing buffer */
+typedef struct {
+    char   *names;
+    size_t used;
+    size_t size;
+    size_t *offsets;
+    size_t count;
+    size_t count_max;
+} scan_t;
+
+static int scan_add(scan_t *scan, const char *name, const char *filter) {
+    size_t len;
+
+    if (!file_selector(name, filter)) {
+        return OPENDCP_NO_ERROR;
+    }
+
+    len = strlen(name) + 1;
+
+    if (scan->used + len > scan->size) {
+        size_t size = scan->size ? scan->size * 2 : 64 * 1024;
+        char   *names;
+
+        while (size < scan->used + len) {
+            size *= 2;
+        }
+
+        if (!(names = realloc(scan->names, size))) {
+            return OPENDCP_ERROR;
+        }
+
+        scan->names = names;
+        scan->size  = size;
+    }
+
+    if (scan->count >= scan->count_max) {
+        size_t count_max = scan->count_max ? scan->count_max * 2 : 4096;
+        size_t *offsets;
+
+        if (count_max > INT_MAX || !(offsets = realloc(scan->offsets, count_max * sizeof(*offsets)))) {
+            return OPENDCP_ERROR;
+        }
+
+        scan->offsets   = offsets;
+        scan->count_max = count_max;
+    }
+
+    memcpy(scan->names + scan->used, name, len);
+    scan->offsets[scan->count++] = scan->used;
+    scan->used += len;
+
+    return OPENDCP_NO_ERROR;
+}
+
+#ifdef __linux__
+/* batch directory reads, a few hundred entries per call on large folders */
+#define SCAN_BUFFER_SIZE (256 * 1024)
+
+struct scan_dirent64 {
+    uint64_t       d_ino;
+    int64_t        d_off;
+    unsigned short d_reclen;
+    unsigned char  d_type;
+    char           d_name[];
+};
+
+static int scan_directory(const char *path, const char *filter, scan_t *scan) {
+    char *buffer;
+    long n;
+    int  fd, result = OPENDCP_NO_ERROR;
+
+    if ((fd = open(path, O_RDONLY | O_DIRECTORY)) < 0) {
+        return OPENDCP_ERROR;
+    }
+
+    if (!(buffer = malloc(SCAN_BUFFER_SIZE))) {
+        close(fd);
+        return OPENDCP_ERROR;
+    }
+
+    while (result == OPENDCP_NO_ERROR && (n = syscall(SYS_getdents64, fd, buffer, SCAN_BUFFER_SIZE)) > 0) {
+        long offset;
+
+        for (offset = 0; offset < n && result == OPENDCP_NO_ERROR; ) {
+            struct scan_dirent64 *de = (struct scan_dirent64 *)(buffer + offset);
+
+            if (de->d_type == DT_REG || de->d_type == DT_LNK || de->d_type == DT_UNKNOWN) {
+                result = scan_add(scan, de->d_name, filter);
+            }
+
+            offset += de->d_reclen;
+        }
+    }
+
+    if (n < 0) {
+        result = OPENDCP_ERROR;
+    }
+
+    free(buffer);
+    close(fd);
+
+    return result;
+}
+#else
+static int scan_directory(const char *path, const char *filter, scan_t *scan) {
+    DIR           *d;
     struct dirent *de;
-    char **names = 0, **tmp;
+    int           result = OPENDCP_NO_ERROR;
+
+    if ((d = opendir(path)) == NULL) {
+        return OPENDCP_ERROR;
+    }
+
+    while (result == OPENDCP_NO_ERROR && (de = readdir(d))) {
+        result = scan_add(scan, de->d_name, filter);
+    }
 
-    size_t cnt = 0, len = 0;
-    filelist_t *filelist;
+    closedir(d);
+
+    return result;
+}
+#endif
+
+filelist_t *get_filelist(const char *path, const char *filter) {
+    struct stat st_in;
+    scan_t      scan;
+    size_t      path_len, i;
+    char        *p;
+    filelist_t  *filelist;
+
+    /* an s3://bucket/prefix is listed like a directory */
+    if (opendcp_s3_url(path)) {
+        return opendcp_s3_list(path, filter);
+    }
 
     if (stat(path, &st_in) != 0 ) {
         OPENDCP_LOG(LOG_DEBUG, "path not found %s", path);
@@ -107,57 +241,39 @@ filelist_t *get_filelist(const char *path, const char *filter) {
         return filelist;
     }
 
-    if ((d = opendir(path)) == NULL) {
-        return(NULL);
-    }
-
     OPENDCP_LOG(LOG_DEBUG, "reading directory");
 
-    while ((de = readdir(d))) {
-        if (!file_selector(de->d_name, filter)) {
-            continue;
-        }
+    memset(&scan, 0, sizeof(scan));
 
-        if (cnt >= len) {
-            len = 2 * len + 1;
+    if (scan_directory(path, filter, &scan) != OPENDCP_NO_ERROR) {
+        free(scan.names);
+        free(scan.offsets);
+        return NULL;
+    }
 
-            if (len > SIZE_MAX / sizeof * names) {
-                break;
-            }
+    OPENDCP_LOG(LOG_DEBUG, "found %d files", scan.count);
 
-            tmp = realloc(names, len * sizeof * names);
+    /* every "<path>/<name>" goes into one buffer */
+    path_len = strlen(path);
+    filelist = filelist_alloc_arena(scan.count, scan.count * (path_len + 1) + scan.used);
 
-            if (!tmp) {
-                break;
-            }
+    if (filelist) {
+        p = filelist->arena;
 
-            names = tmp;
-        }
+        for (i = 0; i < scan.count; i++) {
+            char   *name = scan.names + scan.offsets[i];
+            size_t len   = strlen(name) + 1;
 
-        names[cnt] = malloc(strlen(de->d_name) + 1);
-
-        if (!names[cnt]) {
-            break;
+            filelist->files[i] = p;
+            memcpy(p, path, path_len);
+            p[path_len] = '/';
+            memcpy(p + path_len + 1, name, len);
+            p += path_len + 1 + len;
         }
-
-        snprintf(names[cnt++], strlen(de->d_name) + 1, "%s", de->d_name);
-        OPENDCP_LOG(LOG_DEBUG, "Found %s", de->d_name);
     }
 
-    closedir(d);
-
-    OPENDCP_LOG(LOG_DEBUG, "found %d files", cnt);
-    filelist = filelist_alloc(cnt);
-
-    if (names) {
-        while (cnt-- > 0) {
-            OPENDCP_LOG(LOG_DEBUG, "Adding file %s", names[cnt]);
-            snprintf(filelist->files[cnt], MAX_FILENAME_LENGTH, "%s/%s", path, names[cnt]);
-            free(names[cnt]);
-        }
-
-        free(names);
-    }
+    free(scan.names);
+    free(scan.offsets);
 
     return filelist;
 }
@@ -188,3 +304,130 @@ int find_ext_offset(char str[]) {
 
     return 0;
 }
+
+/* bar refreshes per second */
+#define CLI_PROGRESS_RATE 4
+
+static void cli_progress_render(cli_progress_t *progress) {
+    int    step  = 20;
+    int    count = progress->count;
+    int    total = progress->total > 0 ? progress->total : 1;
+    int    x, percent, left;
+    double elapsed, fps;
+    char   bar[32];
+
+    percent = (int)((long long)count * 100 / total);
+    elapsed = (opendcp_metrics_now() - progress->start) / 1e9;
+    fps     = elapsed > 0 ? (count - progress->first) / elapsed : 0;
+    left    = fps > 0 ? (int)((progress->total - count) / fps) : 0;
+
+    for (x = 0; x < step; x++) {
+        bar[x] = x < (long long)count * step / total ? '=' : ' ';
+    }
+
+    bar[step] = '\0';
+
+    printf("  %s [%s] %3d%% [%d/%d] %.1f fps ETA %d:%02d:%02d \r", progress->label, bar, percent,
+           count, progress->total, fps, left / 3600, left / 60 % 60, left % 60);
+    fflush(stdout);
+}
+
+static void *cli_progress_thread(void *arg) {
+    cli_progress_t  *progress = arg;
+    struct timespec ts;
+
+    pthread_mutex_lock(&progress->mutex);
+
+    while (progress->running) {
+        cli_progress_render(progress);
+
+        clock_gettime(CLOCK_REALTIME, &ts);
+        ts.tv_nsec += 1000000000L / CLI_PROGRESS_RATE;
+        ts.tv_sec  += ts.tv_nsec / 1000000000L;
+        ts.tv_nsec %= 1000000000L;
+
+        while (progress->running && pthread_cond_timedwait(&progress->stop, &progress->mutex, &ts) != ETIMEDOUT);
+    }
+
+    pthread_mutex_unlock(&progress->mutex);
+
+    return NULL;
+}
+
+/*!
+ @function cli_progress_start
+ @abstract Shows a progress bar, refreshed from its own thread.
+ @param progress The bar.
+ @param label The text in front of the bar.
+ @param count The work already done.
+ @param total The work to do.
+*/
+void cli_progress_start(cli_progress_t *progress, const char *label, int count, int total) {
+    memset(progress, 0, sizeof(*progress));
+    progress->label   = label;
+    progress->count   = count;
+    progress->first   = count;
+    progress->total   = total;
+    progress->start   = opendcp_metrics_now();
+    progress->running = 1;
+
+    pthread_mutex_init(&progress->mutex, NULL);
+    pthread_cond_init(&progress->stop, NULL);
+
+    /* without a thread the bar is only drawn when it stops */
+    if (pthread_create(&progress->thread, NULL, cli_progress_thread, progress)) {
+        progress->running = 0;
+    }
+}
+
+/*!
+ @function cli_progress_add
+ @abstract Counts finished work, safe from any thread.
+ @param progress The bar.
+ @param count The work finished.
+*/
+void cli_progress_add(cli_progress_t *progress, int count) {
+    __sync_add_and_fetch(&progress->count, count);
+}
+
+/*!
+ @function cli_progress_total
+ @abstract Changes the amount of work once it is known.
+ @param progress The bar.
+ @param total The work to do.
+*/
+void cli_progress_total(cli_progress_t *progress, int total) {
+    progress->total = total;
+}
+
+/*!
+ @function cli_progress_stop
+ @abstract Stops the render thread and draws the bar a last time.
+ @discussion Does nothing if the bar is not running, so it can be called on
+     both the done and the failure path.
+ @param progress The bar.
+*/
+void cli_progress_stop(cli_progress_t *progress) {
+    int running;
+
+    /* never started or already stopped */
+    if (!progress->label) {
+        return;
+    }
+
+    pthread_mutex_lock(&progress->mutex);
+    running = progress->running;
+    progress->running = 0;
+    pthread_cond_signal(&progress->stop);
+    pthread_mutex_unlock(&progress->mutex);
+
+    if (running) {
+        pthread_join(progress->thread, NULL);
+    }
+
+    cli_progress_render(progress);
+
+    pthread_cond_destroy(&progress->stop);
+    pthread_mutex_destroy(&progress->mutex);
+    progress->label = NULL;
+}
@@ -19,9 +19,33 @@
 #ifndef OPENDCP_CLI_H
 #define OPENDCP_CLI_H
 
+#include <pthread.h>
+
+/*!
+ @typedef cli_progress_t
+ @abstract progress bar shared by the frame threads
+ @discussion Frames are counted with an atomic add, a single thread renders
+     the bar a few times a second with the rate and the time left.
+*/
+typedef struct {
+    const char         *label;
+    volatile int       count;
+    int                total;
+    int                first;          /* count when the bar started, for the rate */
+    unsigned long long start;
+    int                running;
+    pthread_t          thread;
+    pthread_mutex_t    mutex;
+    pthread_cond_t     stop;
+} cli_progress_t;
+
 int check_extension(char *filename, char *pattern);
 char *get_basename(const char *filename);
 int find_ext_offset(char str[]);
 int find_seq_offset (char str1[], char str2[]);
 filelist_t *get_filelist(const char *path, const char *filter);
+void cli_progress_start(cli_progress_t *progress, const char *label, int count, int total);
+void cli_progress_add(cli_progress_t *progress, int count);
+void cli_progress_total(cli_progress_t *progress, int total);
+void cli_progress_stop(cli_progress_t *progress);
 #endif
@@ -0,0 +1,201 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+#include <getopt.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include "opendcp.h"
+#include "cpu.h"
+
+/* volumes a DCP is copied to at once */
+#define TARGETS_MAX 64
+
+void version() {
+    FILE *fp;
+    char kernels[512];
+
+    fp = stdout;
+    fprintf(fp, "\n%s version %s %s\n\n", OPENDCP_NAME, OPENDCP_VERSION, OPENDCP_COPYRIGHT);
+    fprintf(fp, "%s\n\n", cpu_describe(kernels, sizeof(kernels)));
+
+    exit(0);
+}
+
+void dcp_usage() {
+    FILE *fp;
+    fp = stdout;
+
+    fprintf(fp, "\n%s version %s %s\n\n", OPENDCP_NAME, OPENDCP_VERSION, OPENDCP_COPYRIGHT);
+    fprintf(fp, "Copies a DCP to several volumes at once, reading it once and checking it against its packing lists\n\n");
+    fprintf(fp, "Usage:\n");
+    fprintf(fp, "       opendcp_dcp_duplicate -i <dir> -o <dir> [-o <dir> ...] [options ...]\n\n");
+    fprintf(fp, "Required:\n");
+    fprintf(fp, "       -i | --input <dir>             - DCP directory holding the ASSETMAP\n");
+    fprintf(fp, "       -o | --output <dir>            - directory to copy the DCP into, once per target (up to %d)\n", TARGETS_MAX);
+    fprintf(fp, "\n");
+    fprintf(fp, "Options:\n");
+    fprintf(fp, "       -V | --verify                  - read every copy back and check it against its packing lists\n");
+    fprintf(fp, "       -t | --threads <threads>       - set number of assets hashed at once when verifying (default 4)\n");
+    fprintf(fp, "       -d | --device_io <count>       - set number of assets read at once from one device when verifying (default 2)\n");
+    fprintf(fp, "       -l | --log_level <level>       - Sets the log level 0:Quiet, 1:Error, 2:Warn (default),  3:Info, 4:Debug\n");
+    fprintf(fp, "       -h | --help                    - show help\n");
+    fprintf(fp, "       -v | --version                 - show version\n");
+    fprintf(fp, "\n\n");
+
+    fclose(fp);
+    exit(0);
+}
+
+int main (int argc, char **argv) {
+    int c;
+    int result;
+    opendcp_t *opendcp;
+    char *path = NULL;
+    const char *targets[TARGETS_MAX];
+    int ntargets = 0;
+    int verify = 0;
+    struct stat s;
+
+    if (argc <= 1) {
+        dcp_usage();
+    }
+
+    opendcp = opendcp_create();
+
+    /* set initial values */
+    opendcp->log_level = LOG_WARN;
+    opendcp->dcp.digest_threads = 4;
+
+    /* parse options */
+    while (1)
+    {
+        static struct option long_options[] =
+        {
+            {"help",           no_argument,       0, 'h'},
+            {"input",          required_argument, 0, 'i'},
+            {"output",         required_argument, 0, 'o'},
+            {"verify",         no_argument,       0, 'V'},
+            {"device_io",      required_argument, 0, 'd'},
+            {"log_level",      required_argument, 0, 'l'},
+            {"threads",        required_argument, 0, 't'},
+            {"version",        no_argument,       0, 'v'},
+            {0, 0, 0, 0}
+        };
+
+        /* getopt_long stores the option index here. */
+        int option_index = 0;
+
+        c = getopt_long (argc, argv, "i:o:d:l:t:hvV",
+                         long_options, &option_index);
+
+        /* Detect the end of the options. */
+        if (c == -1) {
+            break;
+        }
+
+        switch (c)
+        {
+            case 'i':
+                path = optarg;
+                break;
+
+            case 'o':
+                if (ntargets == TARGETS_MAX) {
+                    dcp_fatal(opendcp, "No more than %d targets can be written at once", TARGETS_MAX);
+                }
+
+                targets[ntargets++] = optarg;
+                break;
+
+            case 'V':
+                verify = 1;
+                break;
+
+            case 'd':
+                opendcp->dcp.digest_io_per_device = atoi(optarg);
+
+                if (opendcp->dcp.digest_io_per_device < 1) {
+                    dcp_fatal(opendcp, "Device reads must be greater than 0");
+                }
+
+                break;
+
+            case 'l':
+                opendcp->log_level = atoi(optarg);
+                break;
+
+            case 't':
+                opendcp->dcp.digest_threads = atoi(optarg);
+
+                if (opendcp->dcp.digest_threads < 1) {
+                    dcp_fatal(opendcp, "Threads must be greater than 0");
+                }
+
+                break;
+
+            case 'h':
+                dcp_usage();
+                break;
+
+            case 'v':
+                version();
+                break;
+        }
+    }
+
+    opendcp_log_init(opendcp->log_level);
+
+    if (path == NULL) {
+        dcp_fatal(opendcp, "Missing input directory");
+    }
+
+    if (stat(path, &s) != 0 || !S_ISDIR(s.st_mode)) {
+        dcp_fatal(opendcp, "Could not open directory: %s", path);
+    }
+
+    if (!ntargets) {
+        dcp_fatal(opendcp, "Missing output directory");
+    }
+
+    for (c = 0; c < ntargets; c++) {
+        if (!strcmp(targets[c], path)) {
+            dcp_fatal(opendcp, "The DCP can not be copied onto itself");
+        }
+    }
+
+    result = dcp_duplicate(opendcp, path, targets, ntargets, verify);
+
+    if (result == OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_INFO, "%s copied to %d target%s%s", path, ntargets, ntargets > 1 ? "s" : "", verify ? " and verified" : "");
+    }
+    else if (result == OPENDCP_VERIFY_DCP) {
+        OPENDCP_LOG(LOG_ERROR, "%s or one of its copies is NOT VALID", path);
+    }
+    else {
+        OPENDCP_LOG(LOG_ERROR, "%s could not be copied: %s", path, OPENDCP_ERROR_STRING[result]);
+    }
+
+    opendcp_delete(opendcp);
+
+    exit(result == OPENDCP_NO_ERROR ? OPENDCP_NO_ERROR : OPENDCP_ERROR);
+}
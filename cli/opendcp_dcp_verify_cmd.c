@@ -0,0 +1,181 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2013 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+#include <getopt.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include "opendcp.h"
+#include "cpu.h"
+
+void version() {
+    FILE *fp;
+    char kernels[512];
+
+    fp = stdout;
+    fprintf(fp, "\n%s version %s %s\n\n", OPENDCP_NAME, OPENDCP_VERSION, OPENDCP_COPYRIGHT);
+    fprintf(fp, "%s\n\n", cpu_describe(kernels, sizeof(kernels)));
+
+    exit(0);
+}
+
+void dcp_usage() {
+    FILE *fp;
+    fp = stdout;
+
+    fprintf(fp, "\n%s version %s %s\n\n", OPENDCP_NAME, OPENDCP_VERSION, OPENDCP_COPYRIGHT);
+    fprintf(fp, "Verifies the assets of a DCP against the hashes in its packing lists\n\n");
+    fprintf(fp, "Usage:\n");
+    fprintf(fp, "       opendcp_dcp_verify -i <dir> [options ...]\n\n");
+    fprintf(fp, "Required:\n");
+    fprintf(fp, "       -i | --input <dir>             - DCP directory holding the ASSETMAP\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "Options:\n");
+    fprintf(fp, "       -s | --structure               - only check the structure of the MXF assets, without hashing\n");
+    fprintf(fp, "       -t | --threads <threads>       - set number of assets hashed at once (default 4)\n");
+    fprintf(fp, "       -d | --device_io <count>       - set number of assets read at once from one device (default 2)\n");
+    fprintf(fp, "       -l | --log_level <level>       - Sets the log level 0:Quiet, 1:Error, 2:Warn (default),  3:Info, 4:Debug\n");
+    fprintf(fp, "       -h | --help                    - show help\n");
+    fprintf(fp, "       -v | --version                 - show version\n");
+    fprintf(fp, "\n\n");
+
+    fclose(fp);
+    exit(0);
+}
+
+int main (int argc, char **argv) {
+    int c;
+    int result;
+    opendcp_t *opendcp;
+    int structure = 0;
+    char *path = NULL;
+    struct stat s;
+
+    if (argc <= 1) {
+        dcp_usage();
+    }
+
+    opendcp = opendcp_create();
+
+    /* set initial values */
+    opendcp->log_level = LOG_WARN;
+    opendcp->dcp.digest_threads = 4;
+
+    /* parse options */
+    while (1)
+    {
+        static struct option long_options[] =
+        {
+            {"help",           no_argument,       0, 'h'},
+            {"input",          required_argument, 0, 'i'},
+            {"device_io",      required_argument, 0, 'd'},
+            {"log_level",      required_argument, 0, 'l'},
+            {"structure",      no_argument,       0, 's'},
+            {"threads",        required_argument, 0, 't'},
+            {"version",        no_argument,       0, 'v'},
+            {0, 0, 0, 0}
+        };
+
+        /* getopt_long stores the option index here. */
+        int option_index = 0;
+
+        c = getopt_long (argc, argv, "i:d:l:st:hv",
+                         long_options, &option_index);
+
+        /* Detect the end of the options. */
+        if (c == -1) {
+            break;
+        }
+
+        switch (c)
+        {
+            case 'i':
+                path = optarg;
+                break;
+
+            case 'd':
+                opendcp->dcp.digest_io_per_device = atoi(optarg);
+
+                if (opendcp->dcp.digest_io_per_device < 1) {
+                    dcp_fatal(opendcp, "Device reads must be greater than 0");
+                }
+
+                break;
+
+            case 'l':
+                opendcp->log_level = atoi(optarg);
+                break;
+
+            case 's':
+                structure = 1;
+                break;
+
+            case 't':
+                opendcp->dcp.digest_threads = atoi(optarg);
+
+                if (opendcp->dcp.digest_threads < 1) {
+                    dcp_fatal(opendcp, "Threads must be greater than 0");
+                }
+
+                break;
+
+            case 'h':
+                dcp_usage();
+                break;
+
+            case 'v':
+                version();
+                break;
+        }
+    }
+
+    opendcp_log_init(opendcp->log_level);
+
+    if (path == NULL) {
+        dcp_fatal(opendcp, "Missing input directory");
+    }
+
+    if (stat(path, &s) != 0 || !S_ISDIR(s.st_mode)) {
+        dcp_fatal(opendcp, "Could not open directory: %s", path);
+    }
+
+    if (structure) {
+        result = dcp_verify_structure(opendcp, path);
+    }
+    else {
+        result = dcp_verify(opendcp, path);
+    }
+
+    if (result == OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_INFO, "%s is VALID", path);
+    }
+    else if (result == OPENDCP_VERIFY_DCP) {
+        OPENDCP_LOG(LOG_ERROR, "%s is NOT VALID", path);
+    }
+    else {
+        OPENDCP_LOG(LOG_ERROR, "%s could not be verified: %s", path, OPENDCP_ERROR_STRING[result]);
+    }
+
+    opendcp_delete(opendcp);
+
+    exit(result == OPENDCP_NO_ERROR ? OPENDCP_NO_ERROR : OPENDCP_ERROR);
+}
@@ -22,16 +22,20 @@
 #include <stdio.h>
 #include <time.h>
 #include <sys/stat.h>
+#include <pthread.h>
 #include <opendcp.h>
 #include "opendcp_cli.h"
+#include "cpu.h"
 
 void progress_bar();
 
 void version() {
     FILE *fp;
+    char kernels[512];
 
     fp = stdout;
     fprintf(fp, "\n%s version %s %s\n\n", OPENDCP_NAME, OPENDCP_VERSION, OPENDCP_COPYRIGHT);
+    fprintf(fp, "%s\n\n", cpu_describe(kernels, sizeof(kernels)));
 
     exit(0);
 }
@@ -42,17 +46,33 @@ void dcp_usage() {
 
     fprintf(fp, "\n%s version %s %s\n\n", OPENDCP_NAME, OPENDCP_VERSION, OPENDCP_COPYRIGHT);
     fprintf(fp, "Usage:\n");
-    fprintf(fp, "       opendcp_extract -i <file> [options ...]\n\n");
+    fprintf(fp, "       opendcp_extract -i <file | dir> [-i <file | dir> ...] [options ...]\n\n");
     fprintf(fp, "Required:\n");
-    fprintf(fp, "       -i | --input <file>            - input mxf file\n");
+    fprintf(fp, "       -i | --input <file | dir>      - input mxf file, or a directory to extract every mxf in it, may be repeated\n");
     fprintf(fp, "\n");
     fprintf(fp, "Options:\n");
+    fprintf(fp, "       -o | --output <dir>            - directory the essence is written to (default current directory)\n");
+    fprintf(fp, "       -c | --concatenate             - write the picture frames into one <name>.j2c instead of one file each\n");
+    fprintf(fp, "       -F | --frame_store             - write the picture frames into a frame store <name>.j2p that opendcp_mxf can wrap\n");
+    fprintf(fp, "       -D | --decode <tif | dpx>      - decode the picture frames to <name>_000000.tif or .dpx images for review\n");
+    fprintf(fp, "       -r | --reduce <levels>         - resolution levels dropped when decoding, 1 decodes 4K at 2K (default 0)\n");
+    fprintf(fp, "       -C | --colorspace <color>      - rgb the decoded frames are converted to: (srgb (default), rec709, p3, srgb_complex, rec709_complex)\n");
+    fprintf(fp, "       -x | --xyz                     - keep the decoded frames in X'Y'Z'\n");
+    fprintf(fp, "       -w | --rewrap <interop | smpte> - write each mxf again as <name>.mxf with these labels instead of extracting it\n");
+    fprintf(fp, "       -j | --jobs <count>            - assets extracted at once (default 4)\n");
     fprintf(fp, "       -s | --start <frame>           - start frame\n");
     fprintf(fp, "       -d | --end  <frame>            - end frame\n");
     fprintf(fp, "       -l | --log_level <level>       - Sets the log level 0:Quiet, 1:Error, 2:Warn (default),  3:Info, 4:Debug\n");
     fprintf(fp, "       -k | --key <key>               - set encryption key (this enables encryption)\n");
+    fprintf(fp, "       -t | --threads <threads>       - set number of extraction threads, shared between the assets (default 4)\n");
     fprintf(fp, "       -h | --help                    - show help\n");
     fprintf(fp, "       -v | --version                 - show version\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "Picture frames are written to <name>_000000.j2c and on, sound to <name>.wav and subtitles\n");
+    fprintf(fp, "to <name>.xml with their images and fonts, where <name> is the mxf file name without .mxf.\n");
+    fprintf(fp, "A single input extracted to the current directory keeps the name opendcp_extract.\n");
+    fprintf(fp, "Decoded frames are 12 bit tif or 16 bit dpx, each extraction thread decodes its own frames.\n");
+    fprintf(fp, "Rewrapped tracks keep their essence as it is, --output must be another directory than the inputs.\n");
     fprintf(fp, "\n\n");
 
     fclose(fp);
@@ -62,17 +82,15 @@ void dcp_usage() {
 int total = 0;
 int val   = 0;
 
+/* assets are extracted on several threads, the progress is shared */
+pthread_mutex_t progress_mutex = PTHREAD_MUTEX_INITIALIZER;
+
 int frame_done_cb(void *p) {
-    val++;
     UNUSED(p);
+    pthread_mutex_lock(&progress_mutex);
+    val++;
     progress_bar();
-
-    return 0;
-}
-
-int write_done_cb(void *p) {
-    UNUSED(p);
-    printf("\n  MXF Complete\n");
+    pthread_mutex_unlock(&progress_mutex);
 
     return 0;
 }
@@ -82,7 +100,7 @@ void progress_bar() {
     int step = 20;
     float c = (float)step / total * (float)val;
 
-    printf("  MXF Creation [");
+    printf("  MXF Extraction [");
 
     for (x = 0; x < step; x++) {
         if (c > x) {
@@ -97,11 +115,102 @@ void progress_bar() {
     fflush(stdout);
 }
 
+typedef struct {
+    char      mxf[MAX_FILENAME_LENGTH];
+    char      output[MAX_FILENAME_LENGTH];
+    opendcp_t opendcp;
+    int       result;
+} extract_job_t;
+
+typedef struct {
+    extract_job_t   *jobs;
+    int             count;
+    int             alloc;
+    int             next;
+    int             rewrap;
+    pthread_mutex_t mutex;
+} extract_t;
+
+/* adds an mxf, or every mxf in a directory, to the assets to extract */
+void extract_add(opendcp_t *opendcp, extract_t *extract, const char *path) {
+    filelist_t *filelist = get_filelist(path, "mxf");
+    int        i;
+
+    if (!filelist || filelist->nfiles < 1) {
+        dcp_fatal(opendcp, "No mxf files found in %s", path);
+    }
+
+    for (i = 0; i < filelist->nfiles; i++) {
+        if (extract->count == extract->alloc) {
+            extract->alloc = extract->alloc ? extract->alloc * 2 : 16;
+            extract->jobs  = realloc(extract->jobs, extract->alloc * sizeof(extract_job_t));
+
+            if (!extract->jobs) {
+                dcp_fatal(opendcp, "Out of memory");
+            }
+        }
+
+        memset(&extract->jobs[extract->count], 0, sizeof(extract_job_t));
+        snprintf(extract->jobs[extract->count].mxf, MAX_FILENAME_LENGTH, "%s", filelist->files[i]);
+        extract->count++;
+    }
+
+    filelist_free(filelist);
+}
+
+/* names the essence after the mxf, <dir>/<name> without the .mxf */
+void extract_output(extract_job_t *job, const char *dir) {
+    const char *name = strrchr(job->mxf, '/');
+    char       *extension;
+
+    name = name ? name + 1 : job->mxf;
+    snprintf(job->output, MAX_FILENAME_LENGTH, "%s/%s", dir, name);
+    extension = strrchr(job->output, '.');
+
+    if (extension && extension > strrchr(job->output, '/')) {
+        *extension = '\0';
+    }
+}
+
+void *extract_worker(void *arg) {
+    extract_t     *extract = arg;
+    extract_job_t *job;
+    char          mxf[MAX_FILENAME_LENGTH + 4];
+
+    while (1) {
+        pthread_mutex_lock(&extract->mutex);
+        job = extract->next < extract->count ? &extract->jobs[extract->next++] : NULL;
+        pthread_mutex_unlock(&extract->mutex);
+
+        if (!job) {
+            return NULL;
+        }
+
+        if (extract->rewrap) {
+            snprintf(mxf, sizeof(mxf), "%s.mxf", job->output);
+            job->result = rewrap_mxf(&job->opendcp, job->mxf, mxf);
+        }
+        else {
+            job->result = read_mxf(&job->opendcp, job->mxf, job->output);
+        }
+
+        if (job->result != OPENDCP_NO_ERROR) {
+            OPENDCP_LOG(LOG_ERROR, "Could not %s %s: %s", extract->rewrap ? "rewrap" : "extract", job->mxf,
+                        OPENDCP_ERROR_STRING[job->result]);
+        }
+    }
+}
+
 int main (int argc, char **argv) {
     int c;
     opendcp_t *opendcp;
-    char *filename = NULL;
+    char *output_dir = NULL;
     int key_id_flag = 0;
+    int jobs = 4;
+    int i, failed = 0;
+    extract_t extract;
+    pthread_t *threads;
+    int *started;
 
     if (argc <= 1) {
         dcp_usage();
@@ -112,6 +221,10 @@ int main (int argc, char **argv) {
     /* set initial values */
     opendcp->log_level = LOG_WARN;
     opendcp->ns = XML_NS_SMPTE;
+    opendcp->threads = 4;
+
+    memset(&extract, 0, sizeof(extract));
+    pthread_mutex_init(&extract.mutex, NULL);
 
     /* parse options */
     while (1)
@@ -121,8 +234,18 @@ int main (int argc, char **argv) {
             {"key",            required_argument, 0, 'k'},
             {"help",           required_argument, 0, 'h'},
             {"input",          required_argument, 0, 'i'},
+            {"output",         required_argument, 0, 'o'},
+            {"concatenate",    no_argument,       0, 'c'},
+            {"frame_store",    no_argument,       0, 'F'},
+            {"decode",         required_argument, 0, 'D'},
+            {"reduce",         required_argument, 0, 'r'},
+            {"colorspace",     required_argument, 0, 'C'},
+            {"xyz",            no_argument,       0, 'x'},
+            {"rewrap",         required_argument, 0, 'w'},
+            {"jobs",           required_argument, 0, 'j'},
             {"start",          required_argument, 0, 's'},
             {"log_level",      required_argument, 0, 'l'},
+            {"threads",        required_argument, 0, 't'},
             {"version",        no_argument,       0, 'v'},
             {0, 0, 0, 0}
         };
@@ -130,7 +253,7 @@ int main (int argc, char **argv) {
         /* getopt_long stores the option index here. */
         int option_index = 0;
 
-        c = getopt_long (argc, argv, "i:k:s:l:hv",
+        c = getopt_long (argc, argv, "i:o:j:k:s:l:t:w:D:r:C:cFxhv",
                          long_options, &option_index);
 
         /* Detect the end of the options. */
@@ -166,13 +289,100 @@ int main (int argc, char **argv) {
                 break;
 
             case 'i':
-                filename = optarg;
+                extract_add(opendcp, &extract, optarg);
+                break;
+
+            case 'o':
+                output_dir = optarg;
+                break;
+
+            case 'c':
+                opendcp->mxf.extract_single = 1;
+                break;
+
+            case 'F':
+                opendcp->mxf.extract_pack = 1;
+                break;
+
+            case 'D':
+                if (strcmp(optarg, "tif") && strcmp(optarg, "dpx")) {
+                    dcp_fatal(opendcp, "Decoded frames must be tif or dpx");
+                }
+
+                opendcp->mxf.extract_image = optarg;
+                break;
+
+            case 'r':
+                opendcp->mxf.extract_reduce = atoi(optarg);
+
+                if (opendcp->mxf.extract_reduce < 0 || opendcp->mxf.extract_reduce > 5) {
+                    dcp_fatal(opendcp, "Reduce must be between 0 and 5");
+                }
+
+                break;
+
+            case 'C':
+                if (!strcmp(optarg, "srgb")) {
+                    opendcp->j2k.lut = CP_SRGB;
+                }
+                else if (!strcmp(optarg, "rec709")) {
+                    opendcp->j2k.lut = CP_REC709;
+                }
+                else if (!strcmp(optarg, "p3")) {
+                    opendcp->j2k.lut = CP_P3;
+                }
+                else if (!strcmp(optarg, "srgb_complex")) {
+                    opendcp->j2k.lut = CP_SRGB_COMPLEX;
+                }
+                else if (!strcmp(optarg, "rec709_complex")) {
+                    opendcp->j2k.lut = CP_REC709_COMPLEX;
+                }
+                else {
+                    dcp_fatal(opendcp, "Invalid colorspace argument");
+                }
+
+                break;
+
+            case 'x':
+                opendcp->mxf.extract_xyz = 1;
+                break;
+
+            case 'w':
+                if (!strcmp(optarg, "interop")) {
+                    opendcp->ns = XML_NS_INTEROP;
+                }
+                else if (!strcmp(optarg, "smpte")) {
+                    opendcp->ns = XML_NS_SMPTE;
+                }
+                else {
+                    dcp_fatal(opendcp, "Rewrap labels must be interop or smpte");
+                }
+
+                extract.rewrap = 1;
+                break;
+
+            case 'j':
+                jobs = atoi(optarg);
+
+                if (jobs < 1) {
+                    dcp_fatal(opendcp, "Jobs must be greater than 0");
+                }
+
                 break;
 
             case 'l':
                 opendcp->log_level = atoi(optarg);
                 break;
 
+            case 't':
+                opendcp->threads = atoi(optarg);
+
+                if (opendcp->threads < 1) {
+                    dcp_fatal(opendcp, "Threads must be greater than 0");
+                }
+
+                break;
+
             case 'h':
                 dcp_usage();
                 break;
@@ -202,32 +412,82 @@ int main (int argc, char **argv) {
         printf("\nOpenDCP Extract %s %s\n", OPENDCP_VERSION, OPENDCP_COPYRIGHT);
     }
 
-    /* set the callbacks (optional) for the mxf writer */
+    if (extract.count < 1) {
+        dcp_fatal(opendcp, "Missing input file");
+    }
+
+    if (opendcp->mxf.extract_image && (opendcp->mxf.extract_single || opendcp->mxf.extract_pack)) {
+        dcp_fatal(opendcp, "Decoded frames can not be concatenated or written to a frame store");
+    }
+
+    if (extract.rewrap && (opendcp->mxf.extract_image || opendcp->mxf.extract_single || opendcp->mxf.extract_pack ||
+                           opendcp->mxf.start_frame)) {
+        dcp_fatal(opendcp, "--rewrap writes whole tracks, it can not be used with --decode, --concatenate, --frame_store or --start");
+    }
+
+    /* set the callbacks (optional) for the mxf reader */
     if (opendcp->log_level > 0 && opendcp->log_level < 3) {
         opendcp->mxf.frame_done.callback = frame_done_cb;
-        opendcp->mxf.file_done.callback  = write_done_cb;
     }
 
-    int class = get_file_essence_class(filename, 1);
+    jobs = jobs < extract.count ? jobs : extract.count;
+
+    /* every asset gets its own copy of the options and a share of the threads */
+    for (i = 0; i < extract.count; i++) {
+        extract_job_t *job = &extract.jobs[i];
+        asset_t       asset;
+
+        memcpy(&job->opendcp, opendcp, sizeof(opendcp_t));
+        job->opendcp.threads = opendcp->threads / jobs > 0 ? opendcp->threads / jobs : 1;
+
+        if (extract.count == 1 && !output_dir) {
+            snprintf(job->output, MAX_FILENAME_LENGTH, "opendcp_extract");
+        }
+        else {
+            extract_output(job, output_dir ? output_dir : ".");
+        }
+
+        memset(&asset, 0, sizeof(asset));
+        snprintf(asset.filename, sizeof(asset.filename), "%s", job->mxf);
+
+        if (read_asset_info(&asset) == OPENDCP_NO_ERROR && asset.essence_class != ACT_TIMED_TEXT) {
+            total += asset.duration;
+        }
+    }
 
     if (opendcp->log_level > 0 && opendcp->log_level < 3) {
         progress_bar();
     }
 
-    total = opendcp->mxf.duration;
+    threads = malloc(jobs * sizeof(pthread_t));
+    started = calloc(jobs, sizeof(int));
 
-    if (read_j2k_mxf(opendcp, filename) != 0 )  {
-        OPENDCP_LOG(LOG_INFO, "Could not READ MXF file");
+    /* this thread is one of the workers, and takes over if the others can not be started */
+    for (i = 0; i < jobs - 1; i++) {
+        started[i] = threads && started && pthread_create(&threads[i], NULL, extract_worker, &extract) == 0;
     }
-    else {
-        OPENDCP_LOG(LOG_INFO, "MXF extract complete");
+
+    extract_worker(&extract);
+
+    for (i = 0; i < jobs - 1; i++) {
+        if (started && started[i]) {
+            pthread_join(threads[i], NULL);
+        }
+    }
+
+    for (i = 0; i < extract.count; i++) {
+        failed += extract.jobs[i].result != OPENDCP_NO_ERROR;
     }
 
     if (opendcp->log_level > 0) {
-        printf("\n");
+        printf("\n  %d of %d assets %s\n", extract.count - failed, extract.count, extract.rewrap ? "rewrapped" : "extracted");
     }
 
+    pthread_mutex_destroy(&extract.mutex);
+    free(threads);
+    free(started);
+    free(extract.jobs);
     opendcp_delete(opendcp);
 
-    exit(0);
+    exit(failed ? 1 : 0);
 }
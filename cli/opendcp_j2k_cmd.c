@@ -18,9 +18,7 @@
 
 #include <getopt.h>
 #include <signal.h>
-#ifdef OPENMP
-#include <omp.h>
-#endif
+#include <ctype.h>
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
@@ -28,34 +26,52 @@
 #include <unistd.h>
 #include <sys/stat.h>
 #include <opendcp.h>
+#include <opendcp_image.h>
 #include <opendcp_encoder.h>
 #include <opendcp_decoder.h>
+#include <opendcp_remote.h>
+#include <opendcp_worker.h>
 #include "opendcp_cli.h"
+#include "cpu.h"
+
+/* frames claimed at a time and seconds without a heartbeat before a claim is taken over */
+#define LEDGER_CHUNK 48
+#define LEDGER_STALE 60
+
+/* seconds a watched file must keep its size to count as rendered, and ms between scans */
+#define WATCH_SETTLE 2
+#define WATCH_POLL   1000
+
+/* stream frames handed to the pipeline at a time */
+#define STREAM_BATCH 1024
 
 #ifndef _WIN32
-sig_atomic_t SIGINT_received = 0;
+/* the conversion stops between frames once j2k.cancel is set */
+opendcp_t *sig_context = NULL;
 
 void sig_handler(int signum) {
-    SIGINT_received = 1;
-    #pragma omp flush(SIGINT_received)
+    UNUSED(signum);
+
+    if (sig_context) {
+        sig_context->j2k.cancel = 1;
+    }
 }
-#else
-int SIGINT_received = 0;
 #endif
 
 /* prototypes */
 char *basename_noext(const char *str);
 int   is_dir(char *path);
-void  build_j2k_filename(const char *in, char *path, char *out);
-void  progress_bar(int val, int total);
+void  build_j2k_filename(const char *in, char *path, char *out, const char *ext);
 void  version();
 void  dcp_usage();
 
 void version() {
     FILE *fp;
+    char kernels[512];
 
     fp = stdout;
     fprintf(fp, "\n%s version %s %s\n\n", OPENDCP_NAME, OPENDCP_VERSION, OPENDCP_COPYRIGHT);
+    fprintf(fp, "%s\n\n", cpu_describe(kernels, sizeof(kernels)));
 
     exit(0);
 }
@@ -68,25 +84,72 @@ void dcp_usage() {
     fprintf(fp, "Usage:\n");
     fprintf(fp, "       opendcp_j2k -i <file> -o <file> [options ...]\n\n");
     fprintf(fp, "Required:\n");
-    fprintf(fp, "       -i | --input <file>            - input file or directory\n");
-    fprintf(fp, "       -o | --output <file>           - output file or directory\n");
+    fprintf(fp, "       -i | --input <file>            - input file or directory, or an s3://bucket/prefix read with parallel ranged requests\n");
+    fprintf(fp, "       -o | --output <file>           - output file or directory (optional with --mxf or --frame_store)\n");
     fprintf(fp, "\n");
     fprintf(fp, "Options:\n");
     fprintf(fp, "       -r | --rate <rate>                 - frame rate (default 24)\n");
     fprintf(fp, "       -p | --profile <profile>           - profile cinema2k | cinema4k (default cinema2k)\n");
     fprintf(fp, "       -b | --bw                          - max Mbps bandwitdh (default: 250)\n");
+    fprintf(fp, "       -a | --rate_control <mode>         - adaptive | fixed | truncate, how the openjpeg encoder fills the bandwidth (default adaptive)\n");
+    fprintf(fp, "       -Y | --layers <Mb/s,...>           - openjpeg only, add lower quality layers at these rates, opendcp_mxf --rerate truncates to them\n");
     fprintf(fp, "       -3 | --3d                          - adjust frame rate for 3D\n");
-    fprintf(fp, "       -e | --encoder <openjpeg | kakadu> - jpeg2000 encoder (default openjpeg)\n");
+#ifdef HAVE_NVJPEG2K
+    fprintf(fp, "       -e | --encoder <openjpeg | kakadu | remote | worker | nvjpeg2k> - jpeg2000 encoder (default openjpeg)\n");
+#else
+    fprintf(fp, "       -e | --encoder <openjpeg | kakadu | remote | worker> - jpeg2000 encoder (default openjpeg)\n");
+#endif
+    fprintf(fp, "       -e raw                             - write raw planar .odr frames instead, another opendcp_j2k reads them without converting the color again\n");
+    fprintf(fp, "       -R | --remote <host[:port],...>    - remote encoder addresses, frames are shared among them (default localhost:%s)\n", OPENDCP_REMOTE_PORT);
+    fprintf(fp, "       -Z | --remote_compress             - compress frames sent to remote encoders\n");
+    fprintf(fp, "       -X | --remote_xyz                  - leave the rgb->xyz color conversion to the remote encoders\n");
+    fprintf(fp, "       -6 | --workers <count>             - encoder worker processes, frames reach them through shared memory (default: threads)\n");
+    fprintf(fp, "       -7 | --worker_encoder <openjpeg | kakadu> - encoder the worker processes run (default openjpeg)\n");
     fprintf(fp, "       -x | --no_xyz                      - do not perform rgb->xyz color conversion\n");
     fprintf(fp, "       -c | --colorspace <color>          - select source colorpsace: (srgb, rec709, p3, srgb_complex, rec709_complex)\n");
     fprintf(fp, "       -f | --calculate                   - Calculate RGB->XYZ values instead of using LUT\n");
+    fprintf(fp, "       -j | --xyz_fixed                   - use the LUT in fixed point for sources up to 12 bits, within one code value of it\n");
+    fprintf(fp, "       -u | --cube <file>                 - transform the frames with a 3d lut (.cube) instead of the colorspace profile\n");
+    fprintf(fp, "       -U | --cube_linear                 - the 3d lut outputs linear xyz, apply the dci companding to it\n");
     fprintf(fp, "       -g | --dpx <linear | film | video> - process dpx image as linear, log film, or log video (default linear)\n");
     fprintf(fp, "       -z | --resize                      - resize image to DCI compliant resolution\n");
+    fprintf(fp, "       -q | --resize_method <method>      - resize method nearest | bicubic (default nearest), implies --resize\n");
+    fprintf(fp, "       -A | --gpu                         - resize and color convert the frames with OpenCL, the cpus are left to the encoder\n");
     fprintf(fp, "       -s | --start                       - start frame\n");
     fprintf(fp, "       -d | --end                         - end frame\n");
-    fprintf(fp, "       -t | --threads <threads>           - set number of threads (default 4)\n");
-    fprintf(fp, "       -m | --tmp_dir                     - sets temporary directory (usually tmpfs one) to save there temporary tiffs for Kakadu\n");
+    fprintf(fp, "       -t | --threads <threads>           - set number of threads (default 4, or the tuning profile of the host)\n");
+    fprintf(fp, "       -0 | --autotune                    - time a sample of the frames with several thread counts and queue depths, use the fastest and save it as the tuning profile of the host\n");
+    fprintf(fp, "            --estimate <frames>           - convert this many frames spread over the sequence, 0 for as many as --autotune, and print the predicted time and size of the job instead of converting it\n");
+    fprintf(fp, "       -8 | --profile_storage <dir>       - time frame reads, mxf writes and digest reads in this directory, print the fastest settings and save them in the tuning profile of the host\n");
+    fprintf(fp, "       -N | --numa <nodes | auto>         - split the threads over this many numa nodes, auto uses all of them\n");
+    fprintf(fp, "       -B | --memory_budget <MB>          - keep fewer frames in flight to stay within this much memory, each gets more encoder threads\n");
+    fprintf(fp, "       -G | --huge_pages                  - back frame buffers with huge pages when the system has them, fewer tlb misses on 4K frames\n");
+    fprintf(fp, "       -4 | --no_cache_hints              - keep source frames and mxf files in the page cache, by default they are dropped once read or written\n");
+    fprintf(fp, "       -5 | --size_order                  - encode the largest source files of each stretch of frames first, so a costly frame does not finish alone at the end\n");
+    fprintf(fp, "       -9 | --strict_plan                 - fail frames that are not the file type and size of the first, instead of handling each on its own\n");
+    fprintf(fp, "       -m | --tmp_dir                     - sets temporary directory (usually tmpfs one) to save there temporary tiffs for Kakadu (default /dev/shm if available)\n");
+    fprintf(fp, "       -T | --tif_deflate                 - deflate the temporary tiffs for Kakadu, the strips are compressed on several threads\n");
+    fprintf(fp, "       -k | --htj2k                       - kakadu only, write HTJ2K intermediates or proxies, much faster but not DCI compliant\n");
+    fprintf(fp, "       -V | --transcode                   - kakadu only, the input is HTJ2K from --htj2k, re-code it to DCI compliant jpeg2000 without decoding\n");
     fprintf(fp, "       -n | --no_overwrite                - do not overwrite existing jpeg2000 files\n");
+    fprintf(fp, "       -C | --cache <dir>                 - reuse encoded frames whose source and settings are unchanged, new frames are added\n");
+    fprintf(fp, "       -D | --dedup                       - encode runs of identical source frames once, holds and slides are repeated\n");
+    fprintf(fp, "       -M | --mxf <file>                  - wrap the frames directly into an mxf file (SMPTE labels)\n");
+    fprintf(fp, "       -O | --dual <file>                 - with --mxf, also write the frames into this mxf with Interop labels, at the same time\n");
+    fprintf(fp, "       -2 | --mxf_2k <file>               - with --mxf and -p cinema4k, also encode every decoded frame at 2K into this mxf\n");
+    fprintf(fp, "       -L | --reels <frame,...>           - with --mxf, start a new reel at each of these frames, <mxf>_reel<n>.mxf and a draft cpl are written\n");
+    fprintf(fp, "       -F | --frame_store <file>          - write the frames into a single frame store file that opendcp_mxf can wrap\n");
+    fprintf(fp, "       -J | --ledger <dir>                - share the frames with other hosts running the same job against this directory on shared storage\n");
+    fprintf(fp, "       -K | --chunk <frames>              - with --ledger, frames a host claims at a time (default %d)\n", LEDGER_CHUNK);
+    fprintf(fp, "       -W | --watch <seconds>             - convert the frames of the input directory as they are rendered, until --end frames or this long without a new one (0 waits for --end)\n");
+    fprintf(fp, "       -I | --stream <WxH:bits[:xyz]>     - the input is - for stdin or a named pipe of headerless interleaved rgb (or xyz) frames, y4m streams need no format\n");
+    fprintf(fp, "       -S | --stats                       - print per stage timings when done\n");
+    fprintf(fp, "       -P | --metrics <file>              - write per stage timings as json, or prometheus text if the file ends in .prom\n");
+    fprintf(fp, "       -Q | --quality <file>              - decode every encoded frame again and write its psnr and ssim against the source as json\n");
+    fprintf(fp, "       -H | --quality_reduce <level>      - with --quality, decode at this reduced resolution level, faster and approximate (default 0)\n");
+    fprintf(fp, "       -y | --gamut <file>                - write the samples the xyz conversion of every frame clipped as json\n");
+    fprintf(fp, "       -1 | --checksum                    - record the crc32c of every jpeg2000 file written in %s, opendcp_mxf checks the files against it\n", J2K_MANIFEST_NAME);
+    fprintf(fp, "       -E | --trace <file>                - write a chrome trace of the stages of every frame, for chrome://tracing or perfetto\n");
     fprintf(fp, "       -l | --log_level <level>           - sets the log level 0:Quiet, 1:Error, 2:Warn (default),  3:Info, 4:Debug\n");
     fprintf(fp, "       -h | --help                        - show help\n");
     fprintf(fp, "       -v | --version                     - show version\n");
@@ -129,7 +192,7 @@ char *basename_noext(const char *str) {
     return strndup(base, ext - base);
 }
 
-void build_j2k_filename(const char *in, char *path, char *out) {
+void build_j2k_filename(const char *in, char *path, char *out, const char *ext) {
     OPENDCP_LOG(LOG_DEBUG, "Building filename from %s", in);
 
     if (!is_dir(path)) {
@@ -137,7 +200,7 @@ void build_j2k_filename(const char *in, char *path, char *out) {
     }
     else {
         char *base = basename_noext(in);
-        snprintf(out, MAX_FILENAME_LENGTH, "%s/%s.j2c", path, base);
+        snprintf(out, MAX_FILENAME_LENGTH, "%s/%s.%s", path, base, ext);
 
         if (base) {
             free(base);
@@ -145,6 +208,23 @@ void build_j2k_filename(const char *in, char *path, char *out) {
     }
 }
 
+/* stdin or a named pipe */
+int is_stream(char *path) {
+    struct stat st_in;
+
+    if (!strcmp(path, "-")) {
+        return 1;
+    }
+
+#ifdef S_ISFIFO
+    if (stat(path, &st_in) == 0 && S_ISFIFO(st_in.st_mode)) {
+        return 1;
+    }
+#endif
+
+    return 0;
+}
+
 int is_dir(char *path) {
     struct stat st_in;
 
@@ -159,42 +239,551 @@ int is_dir(char *path) {
     return 0;
 }
 
-void progress_bar(int val, int total) {
-    int x;
-    int step = 20;
-    float c = (float)step / total * (float)val;
-#ifdef OPENMP
-    int nthreads = omp_get_num_threads();
-#else
-    int nthreads = 1;
-#endif
-    printf("  JPEG2000 Conversion (%d thread", nthreads);
+cli_progress_t progress;
+int            progress_count = 0;
+int            nthreads       = 1;
+
+/* reels of a --reels split */
+#define REELS_MAX 64
+
+/* first frames of the reels after the first, in increasing order, returns the reel count or 0 */
+int parse_reels(const char *list, int *starts, int max) {
+    const char *p = list;
+    char       *end;
+    int        n = 1;
+
+    while (*p) {
+        long frame = strtol(p, &end, 10);
+
+        if (end == p || frame < 2 || n >= max || (n > 1 && frame <= starts[n - 1])) {
+            return 0;
+        }
+
+        starts[n++] = (int)frame;
+        p = *end == ',' ? end + 1 : end;
+
+        if (*end && *end != ',') {
+            return 0;
+        }
+    }
+
+    starts[0] = 1;
+
+    return n;
+}
+
+/* lower quality layers in Mb/s, increasing and below the bandwidth, returns the layer count or 0 */
+int parse_layers(const char *list, int bw, int *layer_bw, int max) {
+    const char *p = list;
+    char       *end;
+    int        n = 0;
+
+    while (*p) {
+        long mbps = strtol(p, &end, 10);
+
+        if (end == p || mbps < 1 || mbps >= bw || n >= max - 1 || (n && mbps * 1000000 <= layer_bw[n - 1])) {
+            return 0;
+        }
+
+        layer_bw[n++] = (int)mbps * 1000000;
+        p = *end == ',' ? end + 1 : end;
+
+        if (*end && *end != ',') {
+            return 0;
+        }
+    }
+
+    return n ? n + 1 : 0;
+}
+
+/* the mxf of a reel is named after the --mxf file */
+void build_reel_filename(const char *mxf_file, int reel, char *out) {
+    int length = strlen(mxf_file);
+
+    if (length > 4 && (!strcmp(mxf_file + length - 4, ".mxf") || !strcmp(mxf_file + length - 4, ".MXF"))) {
+        length -= 4;
+    }
+
+    snprintf(out, MAX_FILENAME_LENGTH, "%.*s_reel%d.mxf", length, mxf_file, reel + 1);
+}
+
+/* a composition playlist of the picture reels, to be completed with opendcp_xml once sound is added */
+int write_reel_cpl(opendcp_t *opendcp, char **mxf_files, int nreels) {
+    cpl_t   cpl;
+    reel_t  reel;
+    asset_t asset;
+    char    *dir = strdup(mxf_files[0]);
+    char    *slash = strrchr(dir, '/');
+    int     r, result = OPENDCP_NO_ERROR;
+
+    create_cpl(&opendcp->dcp, &cpl);
+
+    if (slash) {
+        slash[1] = '\0';
+        snprintf(cpl.filename, sizeof(cpl.filename), "%sCPL_%.40s.xml", dir, cpl.uuid);
+    }
+
+    free(dir);
+
+    for (r = 0; r < nreels && result == OPENDCP_NO_ERROR; r++) {
+        create_reel(&opendcp->dcp, &reel);
+        result = add_asset(opendcp, &asset, mxf_files[r]);
+
+        if (result == OPENDCP_NO_ERROR) {
+            result = add_asset_to_reel(opendcp, &reel, asset);
+        }
+
+        if (result == OPENDCP_NO_ERROR) {
+            result = validate_reel(opendcp, &reel, r);
+        }
+
+        if (result == OPENDCP_NO_ERROR && !add_reel_to_cpl(&cpl, &reel)) {
+            result = OPENDCP_ERROR;
+        }
+    }
+
+    if (result == OPENDCP_NO_ERROR) {
+        result = write_cpl(opendcp, &cpl);
+    }
+
+    if (result == OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_INFO, "draft composition playlist %s written", cpl.filename);
+    }
+
+    free(cpl.reel);
+
+    return result;
+}
+
+int frame_done_cb(void *p) {
+    UNUSED(p);
+    cli_progress_add(&progress, 1);
+
+    return 0;
+}
+
+void metrics_done(opendcp_t *opendcp, int stats, char *file) {
+    int format = OPENDCP_METRICS_JSON;
+
+    if (opendcp_trace_enabled) {
+        opendcp_trace_stop();
+    }
+
+    if (opendcp->log_level >= LOG_INFO) {
+        opendcp_io_report(stdout);
+
+        if (opendcp_huge_pages_enabled()) {
+            opendcp_huge_pages_report(stdout);
+        }
+    }
+
+    if (!opendcp->metrics) {
+        return;
+    }
+
+    if (stats) {
+        opendcp_metrics_report(opendcp->metrics, stdout);
+    }
+
+    if (file) {
+        if (strlen(file) > 5 && !strcmp(file + strlen(file) - 5, ".prom")) {
+            format = OPENDCP_METRICS_PROMETHEUS;
+        }
+
+        opendcp_metrics_dump(opendcp->metrics, file, format);
+    }
+
+    opendcp_metrics_delete(opendcp->metrics);
+    opendcp->metrics = NULL;
+}
+
+void estimate_report(opendcp_estimate_t *estimate, FILE *fp) {
+    int i;
+
+    fprintf(fp, "\nEstimate from %d of %d frames\n", estimate->sampled, estimate->frames);
+    fprintf(fp, "  %-10s %10s\n", "stage", "ms/frame");
+
+    for (i = 0; i < METRIC_STAGES; i++) {
+        if (estimate->stage_ms[i] > 0) {
+            fprintf(fp, "  %-10s %10.2f\n", opendcp_metrics_stage_name(i), estimate->stage_ms[i]);
+        }
+    }
+
+    fprintf(fp, "  %-10s %10.2f\n", "frame", estimate->frame_seconds * 1000);
+    fprintf(fp, "  serial fraction %.0f%%\n\n", estimate->serial * 100);
+    fprintf(fp, "  %-10s %12s\n", "threads", "wall time");
+
+    for (i = 0; i < estimate->counts; i++) {
+        int seconds = (int)(estimate->seconds[i] + 0.5);
+
+        fprintf(fp, "  %-10d %6d:%02d:%02d\n", estimate->threads[i],
+                seconds / 3600, seconds / 60 % 60, seconds % 60);
+    }
+
+    fprintf(fp, "\n  codestream %.1f KiB/frame, %.2f MiB in all\n",
+            estimate->frame_bytes / 1024, estimate->codestream_bytes / 1048576.0);
+    fprintf(fp, "  mxf        about %.2f MiB\n", estimate->mxf_bytes / 1048576.0);
+}
+
+void gamut_done(opendcp_t *opendcp, char *file) {
+    if (!opendcp->j2k.gamut) {
+        return;
+    }
+
+    opendcp_gamut_summary(opendcp->j2k.gamut);
+    opendcp_gamut_dump(opendcp->j2k.gamut, file);
+    opendcp_gamut_delete(opendcp->j2k.gamut);
+    opendcp->j2k.gamut = NULL;
+}
+
+void checksum_done(opendcp_t *opendcp) {
+    opendcp_manifest_close(opendcp->j2k.manifest);
+    opendcp->j2k.manifest = NULL;
+}
+
+void quality_done(opendcp_t *opendcp, char *file) {
+    if (!opendcp->j2k.quality) {
+        return;
+    }
+
+    opendcp_quality_summary(opendcp->j2k.quality);
+    opendcp_quality_dump(opendcp->j2k.quality, file);
+    opendcp_quality_delete(opendcp->j2k.quality);
+    opendcp->j2k.quality = NULL;
+}
+
+/* convert the chunks of the sequence this host claims, the frames of other hosts stay cancelled */
+int convert_ledger(opendcp_t *opendcp, j2k_frame_t *frames, int nframes, const char *dir, int chunk) {
+    opendcp_ledger_t *ledger;
+    int first, count, c;
+    int result = OPENDCP_NO_ERROR;
+
+    for (c = 0; c < nframes; c++) {
+        frames[c].result = OPENDCP_J2K_CANCELLED;
+    }
+
+    ledger = opendcp_ledger_open(opendcp, dir, nframes, chunk, LEDGER_STALE);
+
+    if (!ledger) {
+        OPENDCP_LOG(LOG_ERROR, "Could not join the job ledger %s", dir);
+        return OPENDCP_ERROR;
+    }
+
+    while (result == OPENDCP_NO_ERROR) {
+        result = opendcp_ledger_claim(ledger, &first, &count);
+
+        if (result != OPENDCP_NO_ERROR || !count) {
+            break;
+        }
+
+        OPENDCP_LOG(LOG_INFO, "converting frames %d to %d", first + 1, first + count);
+        result = convert_to_j2k_sequence(opendcp, frames + first, count);
+
+        if (result == OPENDCP_NO_ERROR) {
+            result = opendcp_ledger_done(ledger);
+        }
+        else {
+            opendcp_ledger_release(ledger);
+        }
+    }
+
+    opendcp_ledger_close(ledger);
+
+    return result;
+}
+
+/* the frame number of a file, the last run of digits in its name, or -1 */
+int watch_index(const char *file) {
+    const char *p = file + strlen(file);
+    int        index = -1, scale = 1;
+
+    while (p > file && p[-1] != '/' && !isdigit((unsigned char)p[-1])) {
+        p--;
+    }
+
+    while (p > file && isdigit((unsigned char)p[-1]) && scale <= 100000000) {
+        p--;
+        index  = (index < 0 ? 0 : index) + (*p - '0') * scale;
+        scale *= 10;
+    }
+
+    return index;
+}
+
+/* convert the frames of a folder as they are rendered, until total frames or idle seconds without a new one */
+int convert_watch(opendcp_t *opendcp, const char *in_path, const char *out_path, char *mxf_file, const char *extensions,
+                  int idle, int total) {
+    opendcp_watch_t  *watch;
+    j2k_mxf_writer_t *mxf = NULL;
+    filelist_t       *filelist;
+    j2k_frame_t      *frames;
+    time_t           last = time(NULL);
+    int              c, gap, state, index, nframes, rc, taken = 0, next = -1, result = OPENDCP_NO_ERROR;
+
+    watch = opendcp_watch_open(in_path, WATCH_SETTLE * 1000);
+
+    if (!watch) {
+        return OPENDCP_ERROR;
+    }
+
+    if (mxf_file) {
+        mxf = j2k_mxf_writer_open(opendcp, mxf_file);
+    }
+
+    OPENDCP_LOG(LOG_INFO, "watching %s for rendered frames", in_path);
+
+    while (result == OPENDCP_NO_ERROR && !opendcp->j2k.cancel && (!total || taken < total)) {
+        filelist = get_filelist(in_path, extensions);
+        nframes  = 0;
+        frames   = NULL;
+
+        if (filelist && filelist->nfiles > 0 && order_sequence(filelist->files, filelist->nfiles, &gap) == OPENDCP_NO_ERROR) {
+            frames = malloc(filelist->nfiles * sizeof(j2k_frame_t));
+        }
+
+        for (c = 0; frames && c < filelist->nfiles && (!total || taken + nframes < total); c++) {
+            char *file = filelist->files[c];
+            char *out  = NULL;
+
+            state = opendcp_watch_state(watch, file);
+
+            if (state == OPENDCP_WATCH_TAKEN) {
+                continue;
+            }
+
+            /* the track is wrapped in frame order, stop at the first frame still missing */
+            if (mxf) {
+                index = watch_index(file);
+
+                if (next >= 0 && index >= 0 && index < next) {
+                    OPENDCP_LOG(LOG_ERROR, "%s was rendered after later frames were wrapped", file);
+                    result = OPENDCP_ERROR;
+                    break;
+                }
+
+                if (state != OPENDCP_WATCH_READY || (next >= 0 && index > next)) {
+                    break;
+                }
+
+                next = index >= 0 ? index + 1 : -1;
+            }
+            else if (state != OPENDCP_WATCH_READY) {
+                continue;
+            }
+
+            opendcp_watch_take(watch, file);
+
+            if (out_path) {
+                out = malloc(MAX_FILENAME_LENGTH);
+                build_j2k_filename(file, (char *)out_path, out, opendcp->j2k.encoder == OPENDCP_ENCODER_RAW ? "odr" : "j2c");
+            }
+
+            if (!mxf && access(out, F_OK) == 0 && opendcp->j2k.no_overwrite) {
+                free(out);
+                taken++;
+                cli_progress_add(&progress, 1);
+                continue;
+            }
+
+            frames[nframes].in_file  = file;
+            frames[nframes].out_file = out;
+            nframes++;
+        }
+
+        if (nframes) {
+            if (!total) {
+                cli_progress_total(&progress, filelist->nfiles);
+            }
+
+            OPENDCP_LOG(LOG_INFO, "converting %d rendered frame%s", nframes, nframes > 1 ? "s" : "");
+
+            if (mxf) {
+                rc = convert_to_j2k_mxf_append(opendcp, frames, nframes, mxf);
+            }
+            else {
+                rc = convert_to_j2k_sequence(opendcp, frames, nframes);
+            }
+
+            if (result == OPENDCP_NO_ERROR) {
+                result = rc;
+            }
+
+            taken += nframes;
+            last   = time(NULL);
+        }
+
+        for (c = 0; c < nframes; c++) {
+            if (frames[c].result != OPENDCP_NO_ERROR && frames[c].result != OPENDCP_J2K_CANCELLED) {
+                OPENDCP_LOG(LOG_ERROR, "JPEG2000 conversion %s failed", frames[c].in_file);
+            }
+
+            free(frames[c].out_file);
+        }
+
+        free(frames);
+
+        if (filelist) {
+            filelist_free(filelist);
+        }
+
+        if (result != OPENDCP_NO_ERROR || (total && taken >= total)) {
+            break;
+        }
 
-    if (nthreads > 1) {
-        printf("s");
+        if (idle && time(NULL) - last >= idle) {
+            OPENDCP_LOG(LOG_INFO, "no frame rendered for %d seconds, done watching", idle);
+            break;
+        }
+
+        opendcp_watch_wait(watch, WATCH_POLL);
+    }
+
+    opendcp_watch_close(watch);
+
+    if (result == OPENDCP_NO_ERROR && opendcp->j2k.cancel) {
+        result = OPENDCP_J2K_CANCELLED;
+    }
+
+    if (result == OPENDCP_NO_ERROR && !taken) {
+        OPENDCP_LOG(mxf ? LOG_ERROR : LOG_WARN, "no frames were rendered into %s", in_path);
+    }
+
+    if (mxf) {
+        rc = j2k_mxf_writer_close(mxf);
+
+        if (result == OPENDCP_NO_ERROR) {
+            result = taken ? rc : OPENDCP_ERROR;
+        }
+    }
+
+    return result;
+}
+
+/* convert the frames of an input stream in batches until it ends or total frames are done */
+int convert_stream(opendcp_t *opendcp, char *in_path, char *out_path, char *mxf_file, int total) {
+    j2k_mxf_writer_t *mxf = NULL;
+    j2k_frame_t      *frames;
+    char             prefix[MAX_FILENAME_LENGTH];
+    int              c, nframes, rc, taken = 0, result = OPENDCP_NO_ERROR;
+
+    /* the frame names need a directory part for the output names */
+    snprintf(prefix, sizeof(prefix), "%s%s", strchr(in_path, '/') ? "" : "./", strcmp(in_path, "-") ? in_path : "stdin");
+
+    frames = malloc(STREAM_BATCH * sizeof(j2k_frame_t));
+
+    if (!frames) {
+        return OPENDCP_ERROR;
+    }
+
+    if (mxf_file) {
+        mxf = j2k_mxf_writer_open(opendcp, mxf_file);
+
+        if (!mxf) {
+            free(frames);
+            return OPENDCP_FILEWRITE_MXF;
+        }
     }
 
-    printf(") [");
+    while (result == OPENDCP_NO_ERROR && !opendcp->j2k.cancel && !opendcp_stream_ended() && (!total || taken < total)) {
+        nframes = total && total - taken < STREAM_BATCH ? total - taken : STREAM_BATCH;
 
-    for (x = 0; x < step; x++) {
-        if (c > x) {
-            printf("=");
+        for (c = 0; c < nframes; c++) {
+            frames[c].in_file  = malloc(MAX_FILENAME_LENGTH);
+            frames[c].out_file = NULL;
+            snprintf(frames[c].in_file, MAX_FILENAME_LENGTH, "%s_%06d.stream", prefix, taken + c + 1);
+
+            if (out_path) {
+                frames[c].out_file = malloc(MAX_FILENAME_LENGTH);
+                build_j2k_filename(frames[c].in_file, out_path, frames[c].out_file,
+                                   opendcp->j2k.encoder == OPENDCP_ENCODER_RAW ? "odr" : "j2c");
+            }
+        }
+
+        if (mxf) {
+            result = convert_to_j2k_mxf_append(opendcp, frames, nframes, mxf);
         }
         else {
-            printf(" ");
+            result = convert_to_j2k_sequence(opendcp, frames, nframes);
+        }
+
+        /* the frames past the end of the stream stay cancelled */
+        for (c = 0; c < nframes; c++) {
+            if (frames[c].result == OPENDCP_NO_ERROR) {
+                taken++;
+            }
+            else if (frames[c].result != OPENDCP_J2K_CANCELLED) {
+                OPENDCP_LOG(LOG_ERROR, "JPEG2000 conversion of stream frame %d failed", c + 1 + taken);
+            }
+
+            free(frames[c].in_file);
+            free(frames[c].out_file);
+        }
+    }
+
+    free(frames);
+
+    if (result == OPENDCP_NO_ERROR && opendcp->j2k.cancel) {
+        result = OPENDCP_J2K_CANCELLED;
+    }
+
+    if (result == OPENDCP_NO_ERROR && total && taken < total) {
+        OPENDCP_LOG(LOG_WARN, "the input stream ended after %d of %d frames", taken, total);
+    }
+
+    OPENDCP_LOG(LOG_INFO, "converted %d frames of %s", taken, in_path);
+
+    if (mxf) {
+        rc = j2k_mxf_writer_close(mxf);
+
+        if (result == OPENDCP_NO_ERROR) {
+            result = taken ? rc : OPENDCP_ERROR;
         }
     }
 
-    printf("] 100%% [%d/%d]\r", val, total);
-    fflush(stdout);
+    return result;
 }
 
+/* every letter and digit is taken, the options added since only have a long name */
+enum {
+    OPT_ESTIMATE = 256
+};
+
 int main (int argc, char **argv) {
-    int rc, c, result, count = 0;
-    int openmp_flag = 0;
+    int rc, c, result;
+    int nframes = 0;
+    j2k_frame_t *frames;
     opendcp_t *opendcp;
     char *in_path  = NULL;
     char *out_path = NULL;
+    char *mxf_file = NULL;
+    char *pack_file = NULL;
+    char *mxf_2k_file = NULL;
+    char *metrics_file = NULL;
+    char *quality_file = NULL;
+    int quality_reduce = 0;
+    char *gamut_file = NULL;
+    int checksum = 0;
+    int transcode = 0;
+    int autotune = 0;
+    int estimate = -1;
+    char *storage_dir = NULL;
+    int threads_set = 0;
+    char *trace_file = NULL;
+    char *cube_file = NULL;
+    int cube_linear = 0;
+    int stats = 0;
+    char *reel_list = NULL;
+    int reel_start[REELS_MAX];
+    int reel_frames[REELS_MAX];
+    char *reel_files[REELS_MAX];
+    int nreels = 0;
+    char *ledger_dir = NULL;
+    char *layer_list = NULL;
+    int ledger_chunk = LEDGER_CHUNK;
+    int watch_idle = -1;
+    char *stream_format = NULL;
+    char worker_command[MAX_PATH_LENGTH];
+    char progress_label[64];
     filelist_t *filelist;
 
 #ifndef _WIN32
@@ -212,6 +801,10 @@ int main (int argc, char **argv) {
 
     opendcp = opendcp_create();
 
+#ifndef _WIN32
+    sig_context = opendcp;
+#endif
+
     /* set initial values */
     opendcp->log_level       = LOG_WARN;
     opendcp->cinema_profile  = DCP_CINEMA2K;
@@ -221,26 +814,49 @@ int main (int argc, char **argv) {
     opendcp->j2k.start_frame = 1;
     opendcp->j2k.bw          = 250;
     opendcp->tmp_path        = NULL;
-#ifdef OPENMP
-    openmp_flag              = 1;
-    opendcp->threads         = omp_get_num_procs();
-#endif
+    opendcp->threads         = opendcp_pool_threads();
+
+    /* the worker processes are the opendcp_server installed next to this command */
+    if (strrchr(argv[0], '/')) {
+        snprintf(worker_command, sizeof(worker_command), "%.*s/%s", (int)(strrchr(argv[0], '/') - argv[0]), argv[0], OPENDCP_WORKER_COMMAND);
+        opendcp->worker.command = worker_command;
+    }
 
     /* parse options */
     while (1)
     {
         static struct option long_options[] =
         {
+            {"rate_control",   required_argument, 0, 'a'},
             {"bw",             required_argument, 0, 'b'},
+            {"cache",          required_argument, 0, 'C'},
+            {"dedup",          no_argument,       0, 'D'},
             {"colorspace",     required_argument, 0, 'c'},
             {"end",            required_argument, 0, 'd'},
             {"encoder",        required_argument, 0, 'e'},
             {"calculate",      required_argument, 0, 'f'},
+            {"xyz_fixed",      no_argument,       0, 'j'},
+            {"cube",           required_argument, 0, 'u'},
+            {"cube_linear",    no_argument,       0, 'U'},
             {"dpx ",           required_argument, 0, 'g'},
             {"help",           required_argument, 0, 'h'},
             {"input",          required_argument, 0, 'i'},
             {"log_level",      required_argument, 0, 'l'},
+            {"mxf",            required_argument, 0, 'M'},
+            {"dual",           required_argument, 0, 'O'},
+            {"mxf_2k",         required_argument, 0, '2'},
+            {"frame_store",    required_argument, 0, 'F'},
+            {"reels",          required_argument, 0, 'L'},
+            {"ledger",         required_argument, 0, 'J'},
+            {"chunk",          required_argument, 0, 'K'},
+            {"layers",         required_argument, 0, 'Y'},
             {"tmp_dir",        required_argument, 0, 'm'},
+            {"tif_deflate",    no_argument,       0, 'T'},
+            {"htj2k",          no_argument,       0, 'k'},
+            {"transcode",      no_argument,       0, 'V'},
+            {"autotune",       no_argument,       0, '0'},
+            {"estimate",       required_argument, 0, OPT_ESTIMATE},
+            {"profile_storage", required_argument, 0, '8'},
             {"output",         required_argument, 0, 'o'},
             {"profile",        required_argument, 0, 'p'},
             {"rate",           required_argument, 0, 'r'},
@@ -251,13 +867,35 @@ int main (int argc, char **argv) {
             {"version",        no_argument,       0, 'v'},
             {"no_xyz",         no_argument,       0, 'x'},
             {"resize",         no_argument,       0, 'z'},
+            {"resize_method",  required_argument, 0, 'q'},
+            {"remote",         required_argument, 0, 'R'},
+            {"remote_compress", no_argument,      0, 'Z'},
+            {"remote_xyz",     no_argument,       0, 'X'},
+            {"workers",        required_argument, 0, '6'},
+            {"worker_encoder", required_argument, 0, '7'},
+            {"stats",          no_argument,       0, 'S'},
+            {"metrics",        required_argument, 0, 'P'},
+            {"trace",          required_argument, 0, 'E'},
+            {"quality",        required_argument, 0, 'Q'},
+            {"quality_reduce", required_argument, 0, 'H'},
+            {"gamut",          required_argument, 0, 'y'},
+            {"checksum",       no_argument,       0, '1'},
+            {"watch",          required_argument, 0, 'W'},
+            {"stream",         required_argument, 0, 'I'},
+            {"numa",           required_argument, 0, 'N'},
+            {"memory_budget",  required_argument, 0, 'B'},
+            {"huge_pages",     no_argument,       0, 'G'},
+            {"no_cache_hints", no_argument,       0, '4'},
+            {"size_order",     no_argument,       0, '5'},
+            {"strict_plan",    no_argument,       0, '9'},
+            {"gpu",            no_argument,       0, 'A'},
             {0, 0, 0, 0}
         };
 
         /* getopt_long stores the option index here. */
         int option_index = 0;
 
-        c = getopt_long (argc, argv, "b:c:d:e:g:i:l:m:o:p:r:s:t:w:3fhnvxz",
+        c = getopt_long (argc, argv, "a:b:c:d:e:g:i:l:m:o:p:q:r:s:t:u:w:y:012:3456:7:8:9fhjknvxzAB:C:DE:F:GH:I:J:K:L:M:N:O:P:Q:R:STUVW:XY:Z",
                          long_options, &option_index);
 
         /* Detect the end of the options. */
@@ -280,6 +918,22 @@ int main (int argc, char **argv) {
                 opendcp->stereoscopic = 1;
                 break;
 
+            case 'a':
+                if (!strcmp(optarg, "adaptive")) {
+                    opendcp->j2k.rate_control = J2K_RATE_ADAPTIVE;
+                }
+                else if (!strcmp(optarg, "fixed")) {
+                    opendcp->j2k.rate_control = J2K_RATE_FIXED;
+                }
+                else if (!strcmp(optarg, "truncate")) {
+                    opendcp->j2k.rate_control = J2K_RATE_TRUNCATE;
+                }
+                else {
+                    dcp_fatal(opendcp, "Invalid rate control. Must be adaptive, fixed or truncate");
+                }
+
+                break;
+
             case 'b':
                 opendcp->j2k.bw = atoi(optarg);
                 break;
@@ -312,14 +966,26 @@ int main (int argc, char **argv) {
                 break;
 
             case 'f':
-                opendcp->j2k.xyz_method = 1;
+                opendcp->j2k.xyz_method = XYZ_METHOD_CALCULATE;
                 break;
 
-            case 'e':
-                if (!strcmp(optarg, "openjpeg")) {
-                    opendcp->j2k.encoder = OPENDCP_ENCODER_OPENJPEG;
-                }
-                else if (!strcmp(optarg, "kakadu")) {
+            case 'j':
+                opendcp->j2k.xyz_method = XYZ_METHOD_FIXED;
+                break;
+
+            case 'u':
+                cube_file = optarg;
+                break;
+
+            case 'U':
+                cube_linear = 1;
+                break;
+
+            case 'e':
+                if (!strcmp(optarg, "openjpeg")) {
+                    opendcp->j2k.encoder = OPENDCP_ENCODER_OPENJPEG;
+                }
+                else if (!strcmp(optarg, "kakadu")) {
                     opendcp->j2k.encoder = OPENDCP_ENCODER_KAKADU;
                 }
                 else if (!strcmp(optarg, "ragnarok")) {
@@ -328,6 +994,17 @@ int main (int argc, char **argv) {
                 else if (!strcmp(optarg, "remote")) {
                     opendcp->j2k.encoder = OPENDCP_ENCODER_REMOTE;
                 }
+                else if (!strcmp(optarg, "worker")) {
+                    opendcp->j2k.encoder = OPENDCP_ENCODER_WORKER;
+                }
+                else if (!strcmp(optarg, "raw")) {
+                    opendcp->j2k.encoder = OPENDCP_ENCODER_RAW;
+                }
+#ifdef HAVE_NVJPEG2K
+                else if (!strcmp(optarg, "nvjpeg2k")) {
+                    opendcp->j2k.encoder = OPENDCP_ENCODER_NVJPEG2K;
+                }
+#endif
                 else {
                     fprintf(stderr, "Invalid encoder argument\n");
                     exit(1);
@@ -400,6 +1077,7 @@ int main (int argc, char **argv) {
 
             case 't':
                 opendcp->threads = atoi(optarg);
+                threads_set = 1;
                 break;
 
             case 'x':
@@ -410,8 +1088,215 @@ int main (int argc, char **argv) {
                 version();
                 break;
 
+            case 'q':
+                if (!strcmp(optarg, "nearest")) {
+                    opendcp->j2k.resize = NEAREST_PIXEL;
+                }
+                else if (!strcmp(optarg, "bicubic")) {
+                    opendcp->j2k.resize = BICUBIC;
+                }
+                else {
+                    dcp_fatal(opendcp, "Invalid resize method. Must be nearest or bicubic");
+                }
+
+                break;
+
+            case 'C':
+                opendcp->j2k.cache_dir = optarg;
+                break;
+
+            case 'S':
+                stats = 1;
+                break;
+
+            case 'P':
+                metrics_file = optarg;
+                break;
+
+            case 'E':
+                trace_file = optarg;
+                break;
+
+            case 'Q':
+                quality_file = optarg;
+                break;
+
+            case 'y':
+                gamut_file = optarg;
+                break;
+
+            case '1':
+                checksum = 1;
+                break;
+
+            case 'H':
+                quality_reduce = atoi(optarg);
+
+                if (quality_reduce < 0 || quality_reduce > 5) {
+                    dcp_fatal(opendcp, "Invalid quality reduce level. Must be between 0 and 5");
+                }
+
+                break;
+
+            case 'N':
+                if (!strcmp(optarg, "auto")) {
+                    opendcp->numa = opendcp_numa_nodes();
+                }
+                else {
+                    opendcp->numa = atoi(optarg);
+                }
+
+                if (opendcp->numa < 0) {
+                    dcp_fatal(opendcp, "Invalid numa node count. Must be a number or auto");
+                }
+
+                break;
+
+            case 'B':
+                opendcp->memory_budget = atoi(optarg);
+
+                if (opendcp->memory_budget < 1) {
+                    dcp_fatal(opendcp, "Invalid memory budget. Must be a size in MB");
+                }
+
+                break;
+
+            case 'D':
+                opendcp->j2k.dedup = 1;
+                break;
+
+            case '5':
+                opendcp->j2k.size_order = 1;
+                break;
+
+            case '9':
+                opendcp->j2k.strict_plan = 1;
+                break;
+
+            case 'G':
+                opendcp_huge_pages(1);
+                break;
+
+            case '4':
+                opendcp_cache_hints(0);
+                break;
+
+            /* without a device the frames are conformed on the cpu */
+            case 'A':
+                opendcp_gpu(1);
+                break;
+
+            case 'T':
+                opendcp->j2k.tif_deflate = 1;
+                break;
+
+            case 'k':
+                opendcp->j2k.htj2k = 1;
+                break;
+
+            case 'V':
+                transcode = 1;
+                break;
+
+            case '0':
+                autotune = 1;
+                break;
+
+            case OPT_ESTIMATE:
+                estimate = atoi(optarg);
+                if (estimate < 0) {
+                    dcp_fatal(opendcp, "--estimate takes the number of frames to sample, 0 for the default");
+                }
+                break;
+
+            case '8':
+                storage_dir = optarg;
+                break;
+
+            case 'F':
+                pack_file = optarg;
+                break;
+
+            case 'M':
+                mxf_file = optarg;
+                break;
+
+            case 'O':
+                opendcp->mxf.dual_file = optarg;
+                break;
+
+            case '2':
+                mxf_2k_file = optarg;
+                break;
+
+            case 'L':
+                reel_list = optarg;
+                break;
+
+            case 'J':
+                ledger_dir = optarg;
+                break;
+
+            case 'Y':
+                layer_list = optarg;
+                break;
+
+            case 'K':
+                ledger_chunk = atoi(optarg);
+
+                if (ledger_chunk < 1) {
+                    dcp_fatal(opendcp, "Invalid chunk size. Must be a frame count");
+                }
+
+                break;
+
+            case 'I':
+                stream_format = optarg;
+                break;
+
+            case 'R':
+                opendcp->remote.host = optarg;
+                break;
+
+            case 'W':
+                watch_idle = atoi(optarg);
+
+                if (watch_idle < 0) {
+                    dcp_fatal(opendcp, "Invalid watch time. Must be seconds without a new frame, or 0");
+                }
+
+                break;
+
+            case 'X':
+                opendcp->remote.xyz = 1;
+                break;
+
+            case 'Z':
+                opendcp->remote.compress = 1;
+                break;
+
+            case '6':
+                opendcp->worker.count = atoi(optarg);
+
+                if (opendcp->worker.count < 1) {
+                    dcp_fatal(opendcp, "Invalid worker count. Must be at least 1");
+                }
+
+                break;
+
+            case '7':
+                if (strcmp(optarg, "openjpeg") && strcmp(optarg, "kakadu")) {
+                    dcp_fatal(opendcp, "Invalid worker encoder, must be openjpeg or kakadu");
+                }
+
+                opendcp->worker.encoder = optarg;
+                break;
+
             case 'z':
-                opendcp->j2k.resize = 1;
+                if (!opendcp->j2k.resize) {
+                    opendcp->j2k.resize = NEAREST_PIXEL;
+                }
+
                 break;
         }
     }
@@ -419,6 +1304,82 @@ int main (int argc, char **argv) {
     /* set log level */
     opendcp_log_init(opendcp->log_level);
 
+    /* a storage profile is all that runs, it is kept with the calibration of the host */
+    if (storage_dir) {
+        opendcp_storage_t storage;
+        opendcp_tune_t    tune;
+
+        if (opendcp_profile_storage(storage_dir, &storage) != OPENDCP_NO_ERROR) {
+            dcp_fatal(opendcp, "Could not profile the storage");
+        }
+
+        printf("Storage profile of %s\n", storage_dir);
+        printf("  Frame reads:  %d readers, %.1f MB/s\n", storage.readers, storage.read_mbps);
+        printf("  MXF writes:   %d buffers of %d KB%s, %.1f MB/s\n", storage.io_buffers, storage.io_buffer_size / 1024,
+               storage.direct_io ? ", direct I/O" : "", storage.write_mbps);
+        printf("  Digest reads: %d KB, %.1f MB/s\n", storage.digest_read_size / 1024, storage.digest_mbps);
+
+        if (opendcp_tune_load(&tune, NULL) != OPENDCP_NO_ERROR) {
+            memset(&tune, 0, sizeof(tune));
+        }
+
+        opendcp_tune_storage(&tune, &storage);
+
+        if (opendcp_tune_save(&tune, NULL) != OPENDCP_NO_ERROR) {
+            dcp_fatal(opendcp, "Could not save the tuning profile");
+        }
+
+        opendcp_delete(opendcp);
+        exit(0);
+    }
+
+    if (stats || metrics_file) {
+        opendcp->metrics = opendcp_metrics_create();
+    }
+
+    if (quality_file) {
+        if (opendcp->j2k.encoder == OPENDCP_ENCODER_RAW || (opendcp->j2k.encoder == OPENDCP_ENCODER_REMOTE && opendcp->remote.xyz)) {
+            dcp_fatal(opendcp, "--quality compares jpeg2000 frames with the xyz source, it can not be used with raw frames or --remote_xyz");
+        }
+
+        opendcp->j2k.quality = opendcp_quality_create(quality_reduce);
+    }
+
+    if (gamut_file) {
+        if (!opendcp->j2k.xyz || cube_file || (opendcp->j2k.encoder == OPENDCP_ENCODER_REMOTE && opendcp->remote.xyz)) {
+            dcp_fatal(opendcp, "--gamut reports the local xyz conversion, it can not be used with --no_xyz, a 3d lut or --remote_xyz");
+        }
+
+        opendcp->j2k.gamut = opendcp_gamut_create();
+    }
+
+    if (trace_file && opendcp_trace_start(trace_file) != OPENDCP_NO_ERROR) {
+        dcp_fatal(opendcp, "Could not start tracing");
+    }
+
+    /* encoder threads log per frame, keep subscriber output off their path */
+    opendcp_log_async(1);
+
+    /* settings an earlier --autotune or --profile_storage found for this host, unless given */
+    if (!autotune) {
+        opendcp_tune_t tune;
+
+        if (opendcp_tune_load(&tune, NULL) == OPENDCP_NO_ERROR) {
+            if (threads_set) {
+                opendcp_tune_apply_storage(opendcp, &tune);
+            } else {
+                opendcp_tune_apply(opendcp, &tune);
+            }
+
+            OPENDCP_LOG(LOG_INFO, "using the tuning profile of the host, %d threads", opendcp->threads);
+        }
+    }
+
+    nthreads = opendcp->threads > 0 ? opendcp->threads : 1;
+
+    /* image operations and codecs run their bands on this many threads */
+    opendcp_pool_init(nthreads);
+
     if (opendcp_encoder_enable("j2c", NULL, opendcp->j2k.encoder)) {
         dcp_fatal(opendcp, "Could not enabled encoder");
     }
@@ -432,9 +1393,18 @@ int main (int argc, char **argv) {
         else if (opendcp->j2k.encoder == OPENDCP_ENCODER_REMOTE)  {
             printf("  Encoder: Remote\n");
         }
+        else if (opendcp->j2k.encoder == OPENDCP_ENCODER_WORKER)  {
+            printf("  Encoder: Worker processes (%s)\n", opendcp->worker.encoder ? opendcp->worker.encoder : "openjpeg");
+        }
         else if (opendcp->j2k.encoder == OPENDCP_ENCODER_RAGNAROK)  {
             printf("  Encoder: Ragnarok\n");
         }
+        else if (opendcp->j2k.encoder == OPENDCP_ENCODER_NVJPEG2K)  {
+            printf("  Encoder: nvJPEG2000\n");
+        }
+        else if (opendcp->j2k.encoder == OPENDCP_ENCODER_RAW)  {
+            printf("  Encoder: Raw\n");
+        }
         else {
             printf("  Encoder: OpenJPEG\n");
         }
@@ -461,6 +1431,7 @@ int main (int argc, char **argv) {
     }
 
     /* encoder check */
+#ifndef HAVE_KAKADU_SDK
     if (opendcp->j2k.encoder == OPENDCP_ENCODER_KAKADU) {
         result = system("kdu_compress -u >/dev/null 2>&1");
 
@@ -468,15 +1439,55 @@ int main (int argc, char **argv) {
             dcp_fatal(opendcp, "kdu_compress was not found. Either add to path or remove -e 1 flag");
         }
     }
+#endif
+
+    /* htj2k is written and transcoded by kakadu */
+    if ((opendcp->j2k.htj2k || transcode) && opendcp->j2k.encoder != OPENDCP_ENCODER_KAKADU) {
+        dcp_fatal(opendcp, "--htj2k and --transcode require the kakadu encoder");
+    }
+
+    if (opendcp->j2k.htj2k && transcode) {
+        dcp_fatal(opendcp, "--transcode reads the frames --htj2k writes, use one of them");
+    }
+
+    if (transcode) {
+        if (mxf_file || pack_file || nreels || ledger_dir || watch_idle >= 0 || stream_format || !out_path) {
+            dcp_fatal(opendcp, "--transcode writes jpeg2000 files to --output, it can not be combined with --mxf, --frame_store, --reels, --ledger, --watch or --stream");
+        }
+
+        result = system("kdu_transcode -u >/dev/null 2>&1");
+
+        if (result >> 8 != 0) {
+            dcp_fatal(opendcp, "kdu_transcode was not found, add it to the path to use --transcode");
+        }
+    }
+
+    if (autotune && (transcode || watch_idle >= 0 || stream_format)) {
+        dcp_fatal(opendcp, "--autotune times the conversion of the input frames, it can not be combined with --transcode, --watch or --stream");
+    }
+
+    if (estimate >= 0 && (transcode || watch_idle >= 0 || stream_format)) {
+        dcp_fatal(opendcp, "--estimate times the conversion of the input frames, it can not be combined with --transcode, --watch or --stream");
+    }
 
     /* bandwidth check */
     if (opendcp->j2k.bw < 10 || opendcp->j2k.bw > 250) {
         dcp_fatal(opendcp, "Bandwidth must be between 10 and 250, but %d was specified", opendcp->j2k.bw);
     }
-    else {
-        opendcp->j2k.bw *= 1000000;
+    else if (layer_list) {
+        if (opendcp->j2k.encoder != OPENDCP_ENCODER_OPENJPEG) {
+            dcp_fatal(opendcp, "Quality layers are only written by the openjpeg encoder");
+        }
+
+        opendcp->j2k.layers = parse_layers(layer_list, opendcp->j2k.bw, opendcp->j2k.layer_bw, J2K_LAYERS_MAX);
+
+        if (!opendcp->j2k.layers) {
+            dcp_fatal(opendcp, "Invalid layer list, give up to %d increasing rates in Mb/s below the bandwidth", J2K_LAYERS_MAX - 1);
+        }
     }
 
+    opendcp->j2k.bw *= 1000000;
+
     /* input path check */
     if (in_path == NULL) {
         dcp_fatal(opendcp, "Missing input file");
@@ -486,24 +1497,267 @@ int main (int argc, char **argv) {
         in_path[strlen(in_path) - 1] = '\0';
     }
 
-    /* output path check */
-    if (out_path == NULL) {
+    /* output path check, the jpeg2000 files are optional when writing an mxf or frame store */
+    if (out_path == NULL && mxf_file == NULL && pack_file == NULL) {
         dcp_fatal(opendcp, "Missing output file");
     }
 
-    if (out_path[strlen(out_path) - 1] == '/') {
-        out_path[strlen(out_path) - 1] = '\0';
+    if (out_path) {
+        if (out_path[strlen(out_path) - 1] == '/') {
+            out_path[strlen(out_path) - 1] = '\0';
+        }
+
+        /* make sure path modes are ok */
+        if (is_dir(in_path) && !is_dir(out_path)) {
+            dcp_fatal(opendcp, "Input is a directory, so output must also be a directory");
+        }
+    }
+
+    /* the manifest goes next to the jpeg2000 files, an estimate writes none */
+    if (checksum && estimate < 0) {
+        char manifest_file[MAX_FILENAME_LENGTH];
+
+        if (!out_path) {
+            dcp_fatal(opendcp, "--checksum records the jpeg2000 files written, it needs an output path");
+        }
+
+        snprintf(manifest_file, sizeof(manifest_file), is_dir(out_path) ? "%s/%s" : "%s", out_path, J2K_MANIFEST_NAME);
+        opendcp->j2k.manifest = opendcp_manifest_open(manifest_file);
+
+        if (!opendcp->j2k.manifest) {
+            dcp_fatal(opendcp, "Could not open the checksum manifest of %s", out_path);
+        }
+    }
+
+    /* the 3d lut is loaded once and shared by every frame */
+    if (cube_file) {
+        if (opendcp->j2k.encoder == OPENDCP_ENCODER_REMOTE && opendcp->remote.xyz) {
+            dcp_fatal(opendcp, "A 3d lut can not be combined with remote rgb->xyz conversion");
+        }
+
+        opendcp->j2k.cube = opendcp_cube_load(cube_file, cube_linear);
+
+        if (!opendcp->j2k.cube) {
+            dcp_fatal(opendcp, "Could not load 3d lut %s", cube_file);
+        }
+    }
+    else if (cube_linear) {
+        dcp_fatal(opendcp, "--cube_linear needs a 3d lut, see --cube");
+    }
+
+    if (mxf_file && pack_file) {
+        dcp_fatal(opendcp, "Frames can be written to an mxf or a frame store, not both");
+    }
+
+    if ((mxf_file || pack_file) && opendcp->j2k.encoder == OPENDCP_ENCODER_RAW) {
+        dcp_fatal(opendcp, "Raw frames can not be wrapped, write them to an output directory");
+    }
+
+    if (pack_file && opendcp->stereoscopic) {
+        dcp_fatal(opendcp, "Stereoscopic frames can not be written to a frame store");
+    }
+
+    if (mxf_file) {
+        if (opendcp->stereoscopic) {
+            dcp_fatal(opendcp, "Stereoscopic frames can not be wrapped directly, use opendcp_mxf");
+        }
+
+        if (opendcp->ns == XML_NS_UNKNOWN) {
+            opendcp->ns = XML_NS_SMPTE;
+        }
+    }
+
+    if (opendcp->mxf.dual_file) {
+        if (!mxf_file) {
+            dcp_fatal(opendcp, "--dual writes a second mxf of the frames, it needs --mxf");
+        }
+
+        if (reel_list) {
+            dcp_fatal(opendcp, "--dual writes one mxf, it can not be used with --reels");
+        }
     }
 
-    /* make sure path modes are ok */
-    if (is_dir(in_path) && !is_dir(out_path)) {
-        dcp_fatal(opendcp, "Input is a directory, so output must also be a directory");
+    if (mxf_2k_file) {
+        if (!mxf_file || opendcp->cinema_profile != DCP_CINEMA4K) {
+            dcp_fatal(opendcp, "--mxf_2k writes a 2K track alongside a 4K one, it needs --mxf and -p cinema4k");
+        }
+
+        if (reel_list || opendcp->mxf.dual_file || opendcp->j2k.cache_dir || watch_idle >= 0 || stream_format) {
+            dcp_fatal(opendcp, "--mxf_2k can not be used with --reels, --dual, --cache, --watch or --stream");
+        }
+    }
+
+    if (reel_list) {
+        if (!mxf_file) {
+            dcp_fatal(opendcp, "--reels splits the frames into reel mxf files, it needs --mxf");
+        }
+
+        nreels = parse_reels(reel_list, reel_start, REELS_MAX);
+
+        if (nreels < 1) {
+            dcp_fatal(opendcp, "Invalid reel list, give the first frame of each reel after the first in increasing order");
+        }
+
+        memset(reel_frames, 0, sizeof(reel_frames));
+    }
+
+    if (ledger_dir) {
+        if (mxf_file || pack_file) {
+            dcp_fatal(opendcp, "--ledger shares a sequence of j2c files, it can not be used with --mxf or --frame_store");
+        }
+
+        if (!out_path) {
+            dcp_fatal(opendcp, "--ledger needs an output directory");
+        }
+
+        /* every host must build the same frame list */
+        if (opendcp->j2k.no_overwrite) {
+            OPENDCP_LOG(LOG_WARN, "--no_overwrite is ignored with --ledger, the ledger records the converted frames");
+            opendcp->j2k.no_overwrite = 0;
+        }
+    }
+
+    if (watch_idle >= 0) {
+        if (ledger_dir || reel_list || pack_file) {
+            dcp_fatal(opendcp, "--watch writes j2c files or an mxf, it can not be used with --ledger, --reels or --frame_store");
+        }
+
+        if (!is_dir(in_path)) {
+            dcp_fatal(opendcp, "--watch needs an input directory");
+        }
+
+        if (opendcp->j2k.start_frame != 1) {
+            dcp_fatal(opendcp, "--start can not be used with --watch, frames are converted as they are rendered");
+        }
+
+        if (!watch_idle && !opendcp->j2k.end_frame) {
+            dcp_fatal(opendcp, "--watch 0 needs --end, the number of frames to wait for");
+        }
+    }
+
+    /* frames in object storage are only read by the encoding pipeline */
+    if (opendcp_s3_url(in_path)) {
+        if (watch_idle >= 0 || stream_format || transcode || autotune || estimate >= 0 || opendcp->j2k.cache_dir || opendcp->j2k.dedup) {
+            dcp_fatal(opendcp, "An s3:// input can not be used with --watch, --stream, --transcode, --autotune, --estimate, --cache or --dedup");
+        }
+    }
+
+    /* raw frames from stdin or a named pipe, --end is the number to take */
+    if (stream_format || is_stream(in_path)) {
+        int  stream_w = 0, stream_h = 0, stream_bits = 0;
+        char stream_color[8] = "rgb";
+
+        if (stream_format && (sscanf(stream_format, "%dx%d:%d:%7s", &stream_w, &stream_h, &stream_bits, stream_color) < 3 ||
+                              (strcmp(stream_color, "rgb") && strcmp(stream_color, "xyz")))) {
+            dcp_fatal(opendcp, "Invalid stream format, give WxH:bits and optionally :xyz, such as 1998x1080:16");
+        }
+
+        if (watch_idle >= 0 || ledger_dir || reel_list || pack_file) {
+            dcp_fatal(opendcp, "A stream writes j2c files or an mxf, it can not be used with --watch, --ledger, --reels or --frame_store");
+        }
+
+        if (opendcp->j2k.cache_dir || opendcp->j2k.dedup) {
+            dcp_fatal(opendcp, "--cache and --dedup read the source frames twice, they can not be used with a stream");
+        }
+
+        if (opendcp->j2k.size_order) {
+            dcp_fatal(opendcp, "--size_order reorders source files, the frames of a stream come in order");
+        }
+
+        if (opendcp->stereoscopic) {
+            dcp_fatal(opendcp, "Stereoscopic frames can not be read from a stream");
+        }
+
+        if (opendcp->j2k.start_frame != 1) {
+            dcp_fatal(opendcp, "--start can not be used with a stream, frames are converted as they arrive");
+        }
+
+        if (out_path && !is_dir(out_path)) {
+            dcp_fatal(opendcp, "The frames of a stream are written to an output directory");
+        }
+
+        /* the frames are read in order by one lane */
+        if (opendcp->numa) {
+            OPENDCP_LOG(LOG_WARN, "a stream is read in frame order, numa placement is disabled");
+            opendcp->numa = 0;
+        }
+
+        if (opendcp_stream_open(in_path, stream_w, stream_h, stream_bits, !strcmp(stream_color, "xyz")) != OPENDCP_NO_ERROR) {
+            dcp_fatal(opendcp, "Could not read the input stream %s", in_path);
+        }
     }
 
     /* get file list */
     OPENDCP_LOG(LOG_DEBUG, "searching path %s", in_path);
 
-    char *extensions = opendcp_decoder_extensions();
+    char *extensions = transcode ? strdup("j2c;j2k") : opendcp_decoder_extensions();
+
+    /* the frames are picked up as they land, --end is the number to wait for */
+    if (watch_idle >= 0) {
+        if (opendcp->log_level > 0 && opendcp->log_level < 3) {
+            snprintf(progress_label, sizeof(progress_label), "JPEG2000 Watch (%d thread%s)", nthreads, nthreads > 1 ? "s" : "");
+            opendcp->j2k.frame_done.callback = frame_done_cb;
+            cli_progress_start(&progress, progress_label, 0, opendcp->j2k.end_frame);
+        }
+
+        result = convert_watch(opendcp, in_path, out_path, mxf_file, extensions, watch_idle, opendcp->j2k.end_frame);
+        free(extensions);
+
+        if (opendcp->log_level > 0 && opendcp->log_level < 3) {
+            cli_progress_stop(&progress);
+        }
+
+        if (result != OPENDCP_NO_ERROR) {
+            dcp_fatal(opendcp, "Exiting...");
+        }
+
+        if (opendcp->log_level > 0) {
+            printf("\n");
+        }
+
+        metrics_done(opendcp, stats, metrics_file);
+        quality_done(opendcp, quality_file);
+        gamut_done(opendcp, gamut_file);
+        checksum_done(opendcp);
+        opendcp_cube_delete(opendcp->j2k.cube);
+        opendcp_delete(opendcp);
+
+        exit(0);
+    }
+
+    if (stream_format || is_stream(in_path)) {
+        free(extensions);
+
+        if (opendcp->log_level > 0 && opendcp->log_level < 3) {
+            snprintf(progress_label, sizeof(progress_label), "JPEG2000 Stream (%d thread%s)", nthreads, nthreads > 1 ? "s" : "");
+            opendcp->j2k.frame_done.callback = frame_done_cb;
+            cli_progress_start(&progress, progress_label, 0, opendcp->j2k.end_frame);
+        }
+
+        result = convert_stream(opendcp, in_path, out_path, mxf_file, opendcp->j2k.end_frame);
+        opendcp_stream_close();
+
+        if (opendcp->log_level > 0 && opendcp->log_level < 3) {
+            cli_progress_stop(&progress);
+        }
+
+        if (result != OPENDCP_NO_ERROR) {
+            dcp_fatal(opendcp, "Exiting...");
+        }
+
+        if (opendcp->log_level > 0) {
+            printf("\n");
+        }
+
+        metrics_done(opendcp, stats, metrics_file);
+        quality_done(opendcp, quality_file);
+        gamut_done(opendcp, gamut_file);
+        checksum_done(opendcp);
+        opendcp_cube_delete(opendcp->j2k.cube);
+        opendcp_delete(opendcp);
+
+        exit(0);
+    }
 
     filelist = get_filelist(in_path, extensions);
 
@@ -533,32 +1787,24 @@ int main (int argc, char **argv) {
     OPENDCP_LOG(LOG_DEBUG, "checking file sequence", in_path);
 
     /* Sort files by index, and make sure they're sequential. */
-    if (order_indexed_files(filelist->files, filelist->nfiles) != OPENDCP_NO_ERROR) {
+    if (order_sequence(filelist->files, filelist->nfiles, &rc) != OPENDCP_NO_ERROR) {
         dcp_fatal(opendcp, "Could not order image files");
     }
 
-    rc = ensure_sequential(filelist->files, filelist->nfiles);
-
     if (rc != OPENDCP_NO_ERROR) {
         OPENDCP_LOG(LOG_WARN, "Filenames not sequential between %s and %s.", filelist->files[rc], filelist->files[rc + 1]);
     }
 
-    if (opendcp->log_level > 0 && opendcp->log_level < 3) {
-        progress_bar(0, 0);
-    }
+    /* build the conversion list, skipping existing files if requested */
+    frames = malloc((opendcp->j2k.end_frame - opendcp->j2k.start_frame + 1) * sizeof(j2k_frame_t));
 
-#ifdef OPENMP
-    omp_set_num_threads(opendcp->threads);
-    OPENDCP_LOG(LOG_DEBUG, "OpenMP Enable");
-#endif
-
-    count = opendcp->j2k.start_frame;
+    if (frames == NULL) {
+        dcp_fatal(opendcp, "Could not allocate frame list");
+    }
 
-    #pragma omp parallel for private(c)
+    progress_count = opendcp->j2k.start_frame - 1;
 
     for (c = opendcp->j2k.start_frame - 1; c < opendcp->j2k.end_frame; c++) {
-        #pragma omp flush(SIGINT_received)
-
         /* check for non-ascii filenames under windows */
 #ifdef _WIN32
 
@@ -569,47 +1815,156 @@ int main (int argc, char **argv) {
 
 #endif
 
-        char out[MAX_FILENAME_LENGTH];
-        build_j2k_filename(filelist->files[c], out_path, out);
+        char *out = NULL;
 
-        if (!SIGINT_received) {
-            OPENDCP_LOG(LOG_INFO, "JPEG2000 conversion %s started OPENMP: %d", filelist->files[c], openmp_flag);
+        if (out_path) {
+            out = malloc(MAX_FILENAME_LENGTH);
+            build_j2k_filename(filelist->files[c], out_path, out, opendcp->j2k.encoder == OPENDCP_ENCODER_RAW ? "odr" : "j2c");
+        }
 
-            if(access(out, F_OK) != 0 || opendcp->j2k.no_overwrite == 0) {
-                result = convert_to_j2k(opendcp, filelist->files[c], out);
-            }
-            else {
-                result = OPENDCP_NO_ERROR;
-            }
+        /* every frame is needed when wrapping, existing files are only skipped otherwise */
+        if (!mxf_file && !pack_file && access(out, F_OK) == 0 && opendcp->j2k.no_overwrite) {
+            free(out);
+            progress_count++;
+            continue;
+        }
 
-            if (count) {
-                if (opendcp->log_level > 0 && opendcp->log_level < 3) {
-                    progress_bar(count, opendcp->j2k.end_frame);
-                }
-            }
+        frames[nframes].in_file  = filelist->files[c];
+        frames[nframes].out_file = out;
+        nframes++;
 
-            if (result == OPENDCP_ERROR) {
-                OPENDCP_LOG(LOG_ERROR, "JPEG2000 conversion %s failed", filelist->files[c]);
-                dcp_fatal(opendcp, "Exiting...");
+        /* frame numbers are those of the input sequence, as --start and --end */
+        if (nreels) {
+            int r = nreels - 1;
+
+            while (r > 0 && c + 1 < reel_start[r]) {
+                r--;
             }
-            else {
-                OPENDCP_LOG(LOG_INFO, "JPEG2000 conversion %s complete", filelist->files[c]);
+
+            reel_frames[r]++;
+        }
+    }
+
+    if (nreels) {
+        for (c = 0; c < nreels; c++) {
+            if (reel_frames[c] < 1) {
+                dcp_fatal(opendcp, "Reel %d has no frames between the start and end frames", c + 1);
             }
 
-            count++;
+            reel_files[c] = malloc(MAX_FILENAME_LENGTH);
+            build_reel_filename(mxf_file, c, reel_files[c]);
+        }
+    }
+
+    if (autotune && nframes) {
+        opendcp_tune_t tune;
+
+        if (opendcp_autotune(opendcp, frames, nframes, &tune) != OPENDCP_NO_ERROR) {
+            dcp_fatal(opendcp, "Could not tune the conversion");
+        }
+
+        opendcp_tune_save(&tune, NULL);
+        opendcp_tune_apply(opendcp, &tune);
+        nthreads = opendcp->threads;
+        opendcp_pool_init(nthreads);
+    }
+
+    /* predict the job from a sample of it and leave the output untouched */
+    if (estimate >= 0) {
+        opendcp_estimate_t prediction;
+
+        if (!nframes || opendcp_estimate(opendcp, frames, nframes, estimate, &prediction) != OPENDCP_NO_ERROR) {
+            dcp_fatal(opendcp, "Could not estimate the conversion");
+        }
+
+        estimate_report(&prediction, stdout);
+
+        for (c = 0; c < nframes; c++) {
+            free(frames[c].out_file);
         }
+
+        free(frames);
+        filelist_free(filelist);
+        opendcp_metrics_delete(opendcp->metrics);
+        opendcp_quality_delete(opendcp->j2k.quality);
+        opendcp_gamut_delete(opendcp->j2k.gamut);
+        opendcp_cube_delete(opendcp->j2k.cube);
+        opendcp_delete(opendcp);
+
+        exit(0);
     }
 
     if (opendcp->log_level > 0 && opendcp->log_level < 3) {
-        progress_bar(count - 1, opendcp->j2k.end_frame);
+        snprintf(progress_label, sizeof(progress_label), "JPEG2000 Conversion (%d thread%s)", nthreads, nthreads > 1 ? "s" : "");
+        opendcp->j2k.frame_done.callback = frame_done_cb;
+        cli_progress_start(&progress, progress_label, progress_count, opendcp->j2k.end_frame);
+    }
+
+    if (nreels) {
+        result = convert_to_j2k_reels(opendcp, frames, nframes, reel_frames, nreels, reel_files);
+    }
+    else if (mxf_2k_file) {
+        result = convert_to_j2k_mxf_2k(opendcp, frames, nframes, mxf_file, mxf_2k_file);
+    }
+    else if (mxf_file) {
+        result = convert_to_j2k_mxf(opendcp, frames, nframes, mxf_file);
+    }
+    else if (pack_file) {
+        result = convert_to_j2k_pack(opendcp, frames, nframes, pack_file);
+    }
+    else if (ledger_dir) {
+        result = convert_ledger(opendcp, frames, nframes, ledger_dir, ledger_chunk);
+    }
+    else if (transcode) {
+        result = convert_htj2k_to_j2k_sequence(opendcp, frames, nframes);
+    }
+    else {
+        result = convert_to_j2k_sequence(opendcp, frames, nframes);
+    }
+
+    if (opendcp->log_level > 0 && opendcp->log_level < 3) {
+        cli_progress_stop(&progress);
+    }
+
+    for (c = 0; c < nframes; c++) {
+        if (frames[c].result == OPENDCP_NO_ERROR) {
+            OPENDCP_LOG(LOG_INFO, "JPEG2000 conversion %s complete", frames[c].in_file);
+        }
+        else if (frames[c].result != OPENDCP_J2K_CANCELLED) {
+            OPENDCP_LOG(LOG_ERROR, "JPEG2000 conversion %s failed", frames[c].in_file);
+        }
+
+        free(frames[c].out_file);
+    }
+
+    free(frames);
+
+    if (result != OPENDCP_NO_ERROR) {
+        filelist_free(filelist);
+        dcp_fatal(opendcp, "Exiting...");
     }
 
     filelist_free(filelist);
 
+    if (nreels) {
+        if (write_reel_cpl(opendcp, reel_files, nreels) != OPENDCP_NO_ERROR) {
+            OPENDCP_LOG(LOG_WARN, "Could not write the draft composition playlist");
+        }
+
+        for (c = 0; c < nreels; c++) {
+            free(reel_files[c]);
+        }
+    }
+
     if (opendcp->log_level > 0) {
         printf("\n");
     }
 
+    metrics_done(opendcp, stats, metrics_file);
+    quality_done(opendcp, quality_file);
+    gamut_done(opendcp, gamut_file);
+    checksum_done(opendcp);
+    opendcp_cube_delete(opendcp->j2k.cube);
     opendcp_delete(opendcp);
 
     exit(0);
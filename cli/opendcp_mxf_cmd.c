@@ -18,20 +18,36 @@
 
 #include <string.h>
 #include <getopt.h>
+#include <signal.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <time.h>
 #include <sys/stat.h>
+#include <pthread.h>
 #include <opendcp.h>
 #include "opendcp_cli.h"
+#include "cpu.h"
 
-void progress_bar();
+#ifndef _WIN32
+/* the wrap stops between frames once mxf.cancel is set */
+opendcp_t *sig_context = NULL;
+
+void sig_handler(int signum) {
+    UNUSED(signum);
+
+    if (sig_context) {
+        sig_context->mxf.cancel = 1;
+    }
+}
+#endif
 
 void version() {
     FILE *fp;
+    char kernels[512];
 
     fp = stdout;
     fprintf(fp, "\n%s version %s %s\n\n", OPENDCP_NAME, OPENDCP_VERSION, OPENDCP_COPYRIGHT);
+    fprintf(fp, "%s\n\n", cpu_describe(kernels, sizeof(kernels)));
 
     exit(0);
 }
@@ -42,15 +58,18 @@ void dcp_usage() {
 
     fprintf(fp, "\n%s version %s %s\n\n", OPENDCP_NAME, OPENDCP_VERSION, OPENDCP_COPYRIGHT);
     fprintf(fp, "Usage:\n");
-    fprintf(fp, "       opendcp_mxf -i <file> -o <file> [options ...]\n\n");
+    fprintf(fp, "       opendcp_mxf -i <file> -o <file> [options ...]\n");
+    fprintf(fp, "       opendcp_mxf -b <manifest> [options ...]\n\n");
     fprintf(fp, "Required:\n");
     fprintf(fp, "       -i | --input <file | dir>      - input file or directory.\n");
     fprintf(fp, "       -1 | --left <dir>              - left channel input images when creating a 3D essence\n");
     fprintf(fp, "       -2 | --right <dir>             - right channel input images when creating a 3D essence\n");
     fprintf(fp, "       -o | --output <file>           - output mxf file\n");
+    fprintf(fp, "       -b | --batch <manifest>        - wrap every track listed in the manifest instead, see below\n");
     fprintf(fp, "\n");
     fprintf(fp, "Options:\n");
     fprintf(fp, "       -n | --ns <interop | smpte>    - Generate SMPTE or MXF Interop labels (default smpte)\n");
+    fprintf(fp, "       -O | --dual <file>             - also write a 2D picture track here with the other labels, Interop for smpte and smpte for interop\n");
     fprintf(fp, "       -r | --rate <rate>             - frame rate (default 24)\n");
     fprintf(fp, "       -s | --start <frame>           - start frame\n");
     fprintf(fp, "       -d | --end  <frame>            - end frame\n");
@@ -58,8 +77,43 @@ void dcp_usage() {
     fprintf(fp, "       -l | --log_level <level>       - Sets the log level 0:Quiet, 1:Error, 2:Warn (default),  3:Info, 4:Debug\n");
     fprintf(fp, "       -k | --key <key>               - set encryption key (this enables encryption)\n");
     fprintf(fp, "       -u | --key_id <key id>         - set encryption key id (leaving blank generates a random uuid)\n");
+    fprintf(fp, "       -g | --digest                  - hash the mxf while writing and store it in <output>.sha1 for opendcp_xml\n");
+    fprintf(fp, "       -D | --direct_io               - write the mxf without going through the page cache (O_DIRECT)\n");
+    fprintf(fp, "       -U | --upload <s3://bucket/key> - also upload the mxf to object storage while it is written\n");
+    fprintf(fp, "       -W | --upload_threads <count>  - parts uploaded at once (default %d)\n", OPENDCP_UPLOAD_THREADS);
+    fprintf(fp, "       -Z | --upload_part <MB>        - upload part size, at least 5 (default %d)\n", OPENDCP_UPLOAD_PART_MB);
+    fprintf(fp, "       -R | --bitrate_report          - write picture codestream sizes and bit rates to <output>.bitrate.json\n");
+    fprintf(fp, "       -A | --loudness_report         - measure sound peaks and loudness while wrapping, written to <output>.loudness.json\n");
+    fprintf(fp, "       -L | --bitrate_limit           - stop as soon as a picture codestream is over the bit rate budget\n");
+    fprintf(fp, "       -m | --channel_map <list>      - sound channel order as source channels counted across the wav files,\n");
+    fprintf(fp, "                                        for example 1,2,3,4,5,6 or 0 for a silent channel (default all in order)\n");
+    fprintf(fp, "       -c | --checkpoint <frames>     - record the picture frames written every <frames> frames in <output>.resume\n");
+    fprintf(fp, "       -z | --resume                  - continue an interrupted picture mxf from its last checkpoint\n");
+    fprintf(fp, "       -H | --shards <count>          - wrap a long 2D picture mxf in <count> runs of frames at once, then join them\n");
+    fprintf(fp, "       -x | --replace <file>          - existing picture mxf, the input codestreams replace its frames from --at\n");
+    fprintf(fp, "       -a | --at <frame>              - first frame replaced with --replace (default 1)\n");
+    fprintf(fp, "       -e | --rerate <Mb/s>           - write the input, a picture mxf encoded with opendcp_j2k --layers, at this bit rate\n");
+    fprintf(fp, "       -X | --extract_2k              - write the 2K picture mxf held in the input, a 4K picture mxf\n");
+    fprintf(fp, "       -K | --rekey <key>             - encrypt the input, an encrypted 2D picture mxf, again with --key, <key> is its current key\n");
+    fprintf(fp, "       -V | --left_eye                - write the left eye of the input, a 3D picture mxf, as a 2D picture mxf, an encrypted\n");
+    fprintf(fp, "                                        input is decrypted with the --rekey key, the output is encrypted when --key is given\n");
+    fprintf(fp, "       -j | --jobs <count>            - tracks wrapped at once in batch mode (default 2)\n");
+    fprintf(fp, "       -t | --threads <count>         - reader threads, shared between the tracks in batch mode (default 4)\n");
+    fprintf(fp, "       -G | --huge_pages              - back frame buffers with huge pages when the system has them\n");
+    fprintf(fp, "       -4 | --no_cache_hints          - keep source frames and mxf files in the page cache, by default they are dropped once read or written\n");
+    fprintf(fp, "       -S | --stats                   - print per stage timings when done\n");
+    fprintf(fp, "       -P | --metrics <file>          - write per stage timings as json, or prometheus text if the file ends in .prom\n");
+    fprintf(fp, "       -E | --trace <file>            - write a chrome trace of the stages of every frame, for chrome://tracing or perfetto\n");
     fprintf(fp, "       -h | --help                    - show help\n");
     fprintf(fp, "       -v | --version                 - show version\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "Batch manifest:\n");
+    fprintf(fp, "       One track per line, blank lines and lines starting with # are skipped:\n");
+    fprintf(fp, "       <reel> picture  <dir>              <output>\n");
+    fprintf(fp, "       <reel> stereo   <left> <right>     <output>\n");
+    fprintf(fp, "       <reel> sound    <dir>              <output>\n");
+    fprintf(fp, "       <reel> subtitle <file>             <output>\n");
+    fprintf(fp, "       The other options apply to every track.\n");
     fprintf(fp, "\n\n");
 
     fclose(fp);
@@ -75,6 +129,12 @@ filelist_t *get_filelist_3d(char *in_path_left, char *in_path_right) {
     left  = get_filelist(in_path_left, "j2c,j2k");
     right = get_filelist(in_path_right, "j2c,j2k");
 
+    if (left == NULL || right == NULL) {
+        filelist_free(left);
+        filelist_free(right);
+        return NULL;
+    }
+
     if (left->nfiles != right->nfiles) {
         OPENDCP_LOG(LOG_ERROR, "Mismatching file count for 3D images left: %d right: %d", left->nfiles, right->nfiles);
         filelist_free(left);
@@ -83,16 +143,13 @@ filelist_t *get_filelist_3d(char *in_path_left, char *in_path_right) {
     }
 
     /* Sort files by index, and make sure they're sequential. */
-    if (order_indexed_files(left->files, left->nfiles) != OPENDCP_NO_ERROR ||
-            order_indexed_files(right->files, right->nfiles) != OPENDCP_NO_ERROR) {
+    if (order_sequence(left->files, left->nfiles, &rc) != OPENDCP_NO_ERROR) {
         OPENDCP_LOG(LOG_WARN, "Could not order image files");
         filelist_free(left);
         filelist_free(right);
         return NULL;
     }
 
-    rc = ensure_sequential(left->files, left->nfiles);
-
     if (rc != OPENDCP_NO_ERROR) {
         OPENDCP_LOG(LOG_WARN, "Filenames not sequential between %s and %s.", left->files[rc], left->files[rc + 1]);
         filelist_free(left);
@@ -100,7 +157,12 @@ filelist_t *get_filelist_3d(char *in_path_left, char *in_path_right) {
         return NULL;
     }
 
-    rc = ensure_sequential(right->files, left->nfiles);
+    if (order_sequence(right->files, right->nfiles, &rc) != OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_WARN, "Could not order image files");
+        filelist_free(left);
+        filelist_free(right);
+        return NULL;
+    }
 
     if (rc != OPENDCP_NO_ERROR) {
         OPENDCP_LOG(LOG_WARN, "Filenames not sequential between %s and %s.", right->files[rc], right->files[rc + 1]);
@@ -112,8 +174,8 @@ filelist_t *get_filelist_3d(char *in_path_left, char *in_path_right) {
     filelist = filelist_alloc(left->nfiles + right->nfiles);
 
     for (x = 0; x < filelist->nfiles; y++, x += 2) {
-        snprintf(filelist->files[x], sizeof(filelist->files[x]), "%s", left->files[y]);
-        snprintf(filelist->files[x + 1], sizeof(filelist->files[x + 1]), "%s", right->files[y]);
+        snprintf(filelist->files[x], MAX_FILENAME_LENGTH, "%s", left->files[y]);
+        snprintf(filelist->files[x + 1], MAX_FILENAME_LENGTH, "%s", right->files[y]);
     }
 
     filelist_free(left);
@@ -122,42 +184,402 @@ filelist_t *get_filelist_3d(char *in_path_left, char *in_path_right) {
     return filelist;
 }
 
-int total = 0;
-int val   = 0;
+cli_progress_t progress;
+int            total = 0;
 
+/* called every few frames, mxf.progress holds the frames written so far */
 int frame_done_cb(void *p) {
-    val++;
-    UNUSED(p);
-    progress_bar();
+    opendcp_t *opendcp = (opendcp_t *)p;
+
+    cli_progress_add(&progress, opendcp->mxf.progress.frames - progress.count);
 
     return 0;
 }
 
 int write_done_cb(void *p) {
     UNUSED(p);
+    cli_progress_stop(&progress);
     printf("\n  MXF Complete\n");
 
     return 0;
 }
 
-void progress_bar() {
-    int x;
-    int step = 20;
-    float c = (float)step / total * (float)val;
+void metrics_done(opendcp_t *opendcp, int stats, char *file) {
+    int format = OPENDCP_METRICS_JSON;
+
+    if (opendcp_trace_enabled) {
+        opendcp_trace_stop();
+    }
 
-    printf("  MXF Creation [");
+    if (opendcp->log_level >= LOG_INFO) {
+        opendcp_io_report(stdout);
 
-    for (x = 0; x < step; x++) {
-        if (c > x) {
-            printf("=");
+        if (opendcp_huge_pages_enabled()) {
+            opendcp_huge_pages_report(stdout);
         }
-        else {
-            printf(" ");
+    }
+
+    if (!opendcp->metrics) {
+        return;
+    }
+
+    if (stats) {
+        opendcp_metrics_report(opendcp->metrics, stdout);
+    }
+
+    if (file) {
+        if (strlen(file) > 5 && !strcmp(file + strlen(file) - 5, ".prom")) {
+            format = OPENDCP_METRICS_PROMETHEUS;
+        }
+
+        opendcp_metrics_dump(opendcp->metrics, file, format);
+    }
+
+    opendcp_metrics_delete(opendcp->metrics);
+    opendcp->metrics = NULL;
+}
+
+/* reads the input files of one track, 3D picture interleaves left and right */
+filelist_t *mxf_filelist(opendcp_t *opendcp, char *in_path, char *in_path_left, char *in_path_right) {
+    filelist_t *filelist;
+    int rc = OPENDCP_NO_ERROR;
+
+    if (opendcp->stereoscopic) {
+        return get_filelist_3d(in_path_left, in_path_right);
+    }
+
+    filelist = get_filelist(in_path, "j2c,j2k,wav");
+
+    if (!filelist) {
+        return NULL;
+    }
+
+    /* Sort files by index, and make sure they're sequential. */
+    if (order_sequence(filelist->files, filelist->nfiles, &rc) != OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_ERROR, "Could not order image files");
+        filelist_free(filelist);
+        return NULL;
+    }
+
+    if (rc != OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_WARN, "Filenames not sequential between %s and %s.", filelist->files[rc], filelist->files[rc + 1]);
+    }
+
+    return filelist;
+}
+
+/* the frames of a track, a frame store holds them all in one file */
+static int mxf_frame_count(filelist_t *filelist) {
+    opendcp_pack_t *pack;
+    int            count;
+
+    if (filelist->nfiles != 1 || !opendcp_pack_is(filelist->files[0])) {
+        return filelist->nfiles;
+    }
+
+    pack = opendcp_pack_open(filelist->files[0]);
+
+    if (!pack) {
+        return 0;
+    }
+
+    count = opendcp_pack_count(pack);
+    opendcp_pack_close(pack);
+
+    return count;
+}
+
+/* checks the requested frames against the files and sets the duration, returns an error message or NULL */
+char *mxf_frame_range(opendcp_t *opendcp, filelist_t *filelist) {
+    int frames = mxf_frame_count(filelist);
+
+#ifdef _WIN32
+    int c;
+
+    /* check for non-ascii filenames under windows */
+    for (c = 0; c < filelist->nfiles; c++) {
+        if (is_filename_ascii(filelist->files[c]) == 0) {
+            OPENDCP_LOG(LOG_ERROR, "Filename %s contains non-ascii characters, skipping", filelist->files[c]);
+            return "Filenames cannot contain non-ascii characters";
+        }
+    }
+#endif
+
+    if (opendcp->mxf.end_frame) {
+        if (opendcp->mxf.end_frame > frames) {
+            return "End frame is greater than the actual frame count";
+        }
+    }
+    else {
+        opendcp->mxf.end_frame = frames;
+    }
+
+    if (opendcp->mxf.start_frame) {
+        if (opendcp->mxf.start_frame > opendcp->mxf.end_frame) {
+            return "Start frame must be less than end frame";
         }
     }
+    else {
+        opendcp->mxf.start_frame = 1;
+    }
+
+    if (opendcp->mxf.slide) {
+        opendcp->mxf.duration = opendcp->mxf.duration * opendcp->frame_rate * frames;
+    }
+    else {
+        opendcp->mxf.duration = opendcp->mxf.end_frame - (opendcp->mxf.start_frame - 1);
+    }
+
+    if (opendcp->mxf.duration < 1) {
+        return "Duration must be at least 1 frame";
+    }
+
+    return NULL;
+}
+
+/* points the bit rate report of a track at <output>.bitrate.json when reports were asked for */
+void bitrate_report_path(opendcp_t *opendcp, char *path, size_t size, const char *output) {
+    if (opendcp->mxf.bitrate_report) {
+        snprintf(path, size, "%s.bitrate.json", output);
+        opendcp->mxf.bitrate_report = path;
+    }
+}
+
+/* points the loudness report of a track at <output>.loudness.json when reports were asked for */
+void loudness_report_path(opendcp_t *opendcp, char *path, size_t size, const char *output) {
+    if (opendcp->mxf.loudness_report) {
+        snprintf(path, size, "%s.loudness.json", output);
+        opendcp->mxf.loudness_report = path;
+    }
+}
+
+/*
+   Batch mode wraps every track of a reel manifest. Each track gets its
+   own copy of the options, a pool of workers takes the tracks in order
+   and the reader threads are split between the tracks wrapped at once.
+   Every mxf is an asset with its own key context, built from the one
+   key given on the command line.
+*/
+#define BATCH_LINE_LENGTH (4 * MAX_FILENAME_LENGTH)
+
+typedef struct {
+    char              reel[64];
+    char              output[MAX_FILENAME_LENGTH];
+    char              bitrate_report[MAX_FILENAME_LENGTH + 16];
+    char              loudness_report[MAX_FILENAME_LENGTH + 16];
+    opendcp_t         *opendcp;
+    filelist_t        *filelist;
+    int               frames;
+    int               result;
+    double            seconds;
+    unsigned long long bytes;
+} batch_job_t;
+
+typedef struct {
+    batch_job_t       *jobs;
+    int               count;
+    int               next;
+    pthread_mutex_t   mutex;
+} batch_t;
+
+int batch_frame_cb(void *p) {
+    batch_job_t *job = p;
+
+    job->frames++;
+
+    return 0;
+}
+
+/* parses one manifest line into a job, returns an error message or NULL */
+char *batch_job_init(opendcp_t *opendcp, batch_job_t *job, char *line) {
+    char essence[16], first[MAX_FILENAME_LENGTH], second[MAX_FILENAME_LENGTH], third[MAX_FILENAME_LENGTH];
+    char *output = second, *error;
+    int  fields;
+
+    memset(job, 0, sizeof(*job));
+    fields = sscanf(line, "%63s %15s %253s %253s %253s", job->reel, essence, first, second, third);
+
+    if (fields < 4) {
+        return "Manifest line needs a reel, an essence, the input and the output";
+    }
+
+    job->opendcp = malloc(sizeof(opendcp_t));
+
+    if (!job->opendcp) {
+        return "Out of memory";
+    }
+
+    memcpy(job->opendcp, opendcp, sizeof(opendcp_t));
+    job->opendcp->stereoscopic = 0;
+
+    if (!strcmp(essence, "stereo")) {
+        if (fields < 5) {
+            return "Stereo tracks need a left input, a right input and the output";
+        }
+
+        job->opendcp->stereoscopic = 1;
+        output = third;
+    }
+    else if (strcmp(essence, "picture") && strcmp(essence, "sound") && strcmp(essence, "subtitle")) {
+        return "Essence must be picture, stereo, sound or subtitle";
+    }
+
+    snprintf(job->output, sizeof(job->output), "%s", output);
+    bitrate_report_path(job->opendcp, job->bitrate_report, sizeof(job->bitrate_report), output);
+    loudness_report_path(job->opendcp, job->loudness_report, sizeof(job->loudness_report), output);
+    job->filelist = mxf_filelist(job->opendcp, first, first, second);
+
+    if (!job->filelist) {
+        return "Could not read input files";
+    }
+
+    if (job->filelist->nfiles < 1) {
+        return "No input files located";
+    }
+
+    error = mxf_frame_range(job->opendcp, job->filelist);
+
+    job->opendcp->mxf.frame_done.callback = batch_frame_cb;
+    job->opendcp->mxf.frame_done.argument = job;
+
+    return error;
+}
+
+void *batch_worker(void *arg) {
+    batch_t     *batch = arg;
+    batch_job_t *job;
+    struct stat st;
+
+    while (1) {
+        pthread_mutex_lock(&batch->mutex);
+        job = batch->next < batch->count ? &batch->jobs[batch->next++] : NULL;
+        pthread_mutex_unlock(&batch->mutex);
+
+        if (!job) {
+            return NULL;
+        }
+
+        unsigned long long start = opendcp_metrics_now();
+        job->result  = write_mxf(job->opendcp, job->filelist, job->output);
+        job->seconds = (opendcp_metrics_now() - start) / 1e9;
+
+        if (job->result == OPENDCP_NO_ERROR && stat(job->output, &st) == 0) {
+            job->bytes = st.st_size;
+        }
+
+        if (job->opendcp->log_level > 0) {
+            printf("  %-8s %-40s %s %6d frames %8.1f fps\n", job->reel, job->output,
+                   job->result == OPENDCP_NO_ERROR ? "done  " : "FAILED", job->frames,
+                   job->seconds > 0 ? job->frames / job->seconds : 0.0);
+            fflush(stdout);
+        }
+    }
+}
+
+/* wraps every track in the manifest, returns the number of failed tracks */
+int batch_run(opendcp_t *opendcp, char *manifest, int jobs) {
+    batch_t   batch;
+    pthread_t *threads;
+    int       *started;
+    char      line[BATCH_LINE_LENGTH], *p, *error;
+    int       i, alloc = 0, failed = 0, line_number = 0, frames = 0;
+    unsigned long long start, bytes = 0;
+    double    seconds;
+    FILE      *fp;
+
+    fp = fopen(manifest, "r");
+
+    if (!fp) {
+        dcp_fatal(opendcp, "Could not open manifest %s", manifest);
+    }
+
+    memset(&batch, 0, sizeof(batch));
+
+    /* set every track up first, so a bad line stops the batch before anything is written */
+    while (fgets(line, sizeof(line), fp)) {
+        line_number++;
+
+        for (p = line; *p == ' ' || *p == '\t'; p++);
+
+        if (*p == '#' || *p == '\n' || *p == '\r' || *p == '\0') {
+            continue;
+        }
+
+        if (batch.count == alloc) {
+            alloc = alloc ? alloc * 2 : 16;
+            batch.jobs = realloc(batch.jobs, alloc * sizeof(batch_job_t));
+
+            if (!batch.jobs) {
+                dcp_fatal(opendcp, "Out of memory");
+            }
+        }
+
+        error = batch_job_init(opendcp, &batch.jobs[batch.count], p);
+        batch.count++;
+
+        if (error) {
+            fclose(fp);
+            dcp_fatal(opendcp, "%s: line %d: %s", manifest, line_number, error);
+        }
+    }
+
+    fclose(fp);
+
+    if (batch.count < 1) {
+        dcp_fatal(opendcp, "No tracks in manifest %s", manifest);
+    }
+
+    jobs = jobs < batch.count ? jobs : batch.count;
+
+    for (i = 0; i < batch.count; i++) {
+        batch.jobs[i].opendcp->threads = opendcp->threads / jobs > 0 ? opendcp->threads / jobs : 1;
+    }
+
+    if (opendcp->log_level > 0) {
+        printf("  Wrapping %d tracks, %d at a time\n", batch.count, jobs);
+    }
+
+    threads = malloc(jobs * sizeof(pthread_t));
+    started = calloc(jobs, sizeof(int));
+    pthread_mutex_init(&batch.mutex, NULL);
+    start = opendcp_metrics_now();
+
+    /* this thread is one of the workers, and takes over if the others can not be started */
+    for (i = 0; i < jobs - 1; i++) {
+        started[i] = threads && started && pthread_create(&threads[i], NULL, batch_worker, &batch) == 0;
+    }
+
+    batch_worker(&batch);
+
+    for (i = 0; i < jobs - 1; i++) {
+        if (started && started[i]) {
+            pthread_join(threads[i], NULL);
+        }
+    }
+
+    seconds = (opendcp_metrics_now() - start) / 1e9;
+    pthread_mutex_destroy(&batch.mutex);
+    free(threads);
+    free(started);
+
+    for (i = 0; i < batch.count; i++) {
+        failed += batch.jobs[i].result != OPENDCP_NO_ERROR;
+        frames += batch.jobs[i].frames;
+        bytes  += batch.jobs[i].bytes;
+        filelist_free(batch.jobs[i].filelist);
+        free(batch.jobs[i].opendcp);
+    }
+
+    free(batch.jobs);
+
+    if (opendcp->log_level > 0) {
+        printf("  %d of %d tracks wrapped, %d frames in %.1f s, %.1f fps, %.1f MB/s\n",
+               batch.count - failed, batch.count, frames, seconds,
+               seconds > 0 ? frames / seconds : 0.0,
+               seconds > 0 ? bytes / seconds / (1024.0 * 1024.0) : 0.0);
+    }
 
-    printf("] 100%% [%d/%d]\r", val, total);
-    fflush(stdout);
+    return failed;
 }
 
 int main (int argc, char **argv) {
@@ -170,6 +592,31 @@ int main (int argc, char **argv) {
     filelist_t *filelist;
     char key_id[40];
     int key_id_flag = 0;
+    char *metrics_file = NULL;
+    char *trace_file = NULL;
+    char *batch_file = NULL;
+    char bitrate_file[MAX_FILENAME_LENGTH + 16] = "";
+    char loudness_file[MAX_FILENAME_LENGTH + 16] = "";
+    char *error;
+    int stats = 0;
+    int jobs = 2;
+    char *replace_file = NULL;
+    int replace_frame = 1;
+    int rerate = 0;
+    int extract_2k = 0;
+    int rekey = 0;
+    int left_eye = 0;
+    unsigned char rekey_value[16];
+    opendcp_tune_t tune;
+
+#ifndef _WIN32
+    struct sigaction sig_action;
+    sig_action.sa_handler = sig_handler;
+    sig_action.sa_flags = 0;
+    sigemptyset(&sig_action.sa_mask);
+
+    sigaction(SIGINT,  &sig_action, NULL);
+#endif
 
     if (argc <= 1) {
         dcp_usage();
@@ -177,6 +624,10 @@ int main (int argc, char **argv) {
 
     opendcp = opendcp_create();
 
+#ifndef _WIN32
+    sig_context = opendcp;
+#endif
+
     /* set initial values */
     opendcp->log_level = LOG_WARN;
     opendcp->ns = XML_NS_SMPTE;
@@ -196,11 +647,38 @@ int main (int argc, char **argv) {
             {"right",          required_argument, 0, '2'},
             {"ns",             required_argument, 0, 'n'},
             {"output",         required_argument, 0, 'o'},
+            {"dual",           required_argument, 0, 'O'},
             {"start",          required_argument, 0, 's'},
             {"end",            required_argument, 0, 'd'},
             {"rate",           required_argument, 0, 'r'},
             {"slideshow",      required_argument, 0, 'p'},
             {"log_level",      required_argument, 0, 'l'},
+            {"digest",         no_argument,       0, 'g'},
+            {"direct_io",      no_argument,       0, 'D'},
+            {"upload",         required_argument, 0, 'U'},
+            {"upload_threads", required_argument, 0, 'W'},
+            {"upload_part",    required_argument, 0, 'Z'},
+            {"bitrate_report", no_argument,       0, 'R'},
+            {"bitrate_limit",  no_argument,       0, 'L'},
+            {"loudness_report", no_argument,      0, 'A'},
+            {"channel_map",    required_argument, 0, 'm'},
+            {"stats",          no_argument,       0, 'S'},
+            {"huge_pages",     no_argument,       0, 'G'},
+            {"no_cache_hints", no_argument,       0, '4'},
+            {"metrics",        required_argument, 0, 'P'},
+            {"trace",          required_argument, 0, 'E'},
+            {"checkpoint",     required_argument, 0, 'c'},
+            {"resume",         no_argument,       0, 'z'},
+            {"shards",         required_argument, 0, 'H'},
+            {"replace",        required_argument, 0, 'x'},
+            {"rerate",         required_argument, 0, 'e'},
+            {"extract_2k",     no_argument,       0, 'X'},
+            {"rekey",          required_argument, 0, 'K'},
+            {"left_eye",       no_argument,       0, 'V'},
+            {"at",             required_argument, 0, 'a'},
+            {"batch",          required_argument, 0, 'b'},
+            {"jobs",           required_argument, 0, 'j'},
+            {"threads",        required_argument, 0, 't'},
             {"version",        no_argument,       0, 'v'},
             {0, 0, 0, 0}
         };
@@ -208,7 +686,7 @@ int main (int argc, char **argv) {
         /* getopt_long stores the option index here. */
         int option_index = 0;
 
-        c = getopt_long (argc, argv, "1:2:d:i:k:n:o:r:s:p:u:l:3hv",
+        c = getopt_long (argc, argv, "1:2:a:b:c:d:e:i:j:k:m:n:o:r:s:p:t:u:l:E:H:K:O:P:U:W:Z:x:34gADGLRSVXhvz",
                          long_options, &option_index);
 
         /* Detect the end of the options. */
@@ -238,6 +716,159 @@ int main (int argc, char **argv) {
                 opendcp->stereoscopic = 1;
                 break;
 
+            case 'g':
+                opendcp->mxf.digest_flag = 1;
+                break;
+
+            case 'S':
+                stats = 1;
+                break;
+
+            case 'G':
+                opendcp_huge_pages(1);
+                break;
+
+            case '4':
+                opendcp_cache_hints(0);
+                break;
+
+            case 'P':
+                metrics_file = optarg;
+                break;
+
+            case 'E':
+                trace_file = optarg;
+                break;
+
+            case 'D':
+                opendcp->mxf.direct_io = 1;
+                break;
+
+            case 'R':
+                opendcp->mxf.bitrate_report = bitrate_file;
+                break;
+
+            case 'L':
+                opendcp->mxf.bitrate_limit = 1;
+                break;
+
+            case 'A':
+                opendcp->mxf.loudness_report = loudness_file;
+                break;
+
+            case 'm':
+                opendcp->mxf.channel_map = optarg;
+                break;
+
+            case 'U':
+                opendcp->mxf.upload = optarg;
+
+                if (!opendcp_s3_url(optarg)) {
+                    dcp_fatal(opendcp, "Upload destination must be an s3://bucket/key url");
+                }
+
+                break;
+
+            case 'W':
+                opendcp->mxf.upload_threads = atoi(optarg);
+
+                if (opendcp->mxf.upload_threads < 1) {
+                    dcp_fatal(opendcp, "Upload threads must be greater than 0");
+                }
+
+                break;
+
+            case 'Z':
+                opendcp->mxf.upload_part_mb = atoi(optarg);
+
+                if (opendcp->mxf.upload_part_mb < 5) {
+                    dcp_fatal(opendcp, "Upload parts must be at least 5 MB");
+                }
+
+                break;
+
+            case 'b':
+                batch_file = optarg;
+                break;
+
+            case 'c':
+                opendcp->mxf.checkpoint = atoi(optarg);
+
+                if (opendcp->mxf.checkpoint < 1) {
+                    dcp_fatal(opendcp, "Checkpoint interval must be greater than 0");
+                }
+
+                break;
+
+            case 'z':
+                opendcp->mxf.resume = 1;
+                break;
+
+            case 'H':
+                opendcp->mxf.shards = atoi(optarg);
+
+                if (opendcp->mxf.shards < 1) {
+                    dcp_fatal(opendcp, "Shards must be greater than 0");
+                }
+
+                break;
+
+            case 'x':
+                replace_file = optarg;
+                break;
+
+            case 'e':
+                rerate = atoi(optarg);
+
+                if (rerate < 10 || rerate > 250) {
+                    dcp_fatal(opendcp, "Re-rate bandwidth must be between 10 and 250 Mb/s");
+                }
+
+                break;
+
+            case 'X':
+                extract_2k = 1;
+                break;
+
+            case 'K':
+                if (!is_key(optarg) || hex2bin(optarg, rekey_value, 16)) {
+                    dcp_fatal(opendcp, "Invalid re-key key format");
+                }
+
+                rekey = 1;
+                break;
+
+            case 'V':
+                left_eye = 1;
+                break;
+
+            case 'a':
+                replace_frame = atoi(optarg);
+
+                if (replace_frame < 1) {
+                    dcp_fatal(opendcp, "Replaced frame must be greater than 0");
+                }
+
+                break;
+
+            case 'j':
+                jobs = atoi(optarg);
+
+                if (jobs < 1) {
+                    dcp_fatal(opendcp, "Jobs must be greater than 0");
+                }
+
+                break;
+
+            case 't':
+                opendcp->threads = atoi(optarg);
+
+                if (opendcp->threads < 1) {
+                    dcp_fatal(opendcp, "Threads must be greater than 0");
+                }
+
+                break;
+
             case 'd':
                 opendcp->mxf.end_frame = atoi(optarg);
 
@@ -301,6 +932,10 @@ int main (int argc, char **argv) {
                 out_path = optarg;
                 break;
 
+            case 'O':
+                opendcp->mxf.dual_file = optarg;
+                break;
+
             case 'h':
                 dcp_usage();
                 break;
@@ -349,10 +984,61 @@ int main (int argc, char **argv) {
 
     opendcp_log_init(opendcp->log_level);
 
+    /* the mxf write buffers opendcp_j2k --profile_storage found for this host */
+    if (opendcp_tune_load(&tune, NULL) == OPENDCP_NO_ERROR) {
+        opendcp_tune_apply_storage(opendcp, &tune);
+    }
+
+    if (stats || metrics_file) {
+        opendcp->metrics = opendcp_metrics_create();
+    }
+
+    if (trace_file && opendcp_trace_start(trace_file) != OPENDCP_NO_ERROR) {
+        dcp_fatal(opendcp, "Could not start tracing");
+    }
+
     if (opendcp->log_level > 0) {
         printf("\nOpenDCP MXF %s %s\n", OPENDCP_VERSION, OPENDCP_COPYRIGHT);
     }
 
+    if (opendcp->mxf.dual_file) {
+        if (batch_file || opendcp->stereoscopic) {
+            dcp_fatal(opendcp, "--dual is written alongside a single 2D picture track");
+        }
+
+        if (replace_file || rerate || extract_2k || rekey || left_eye || opendcp->mxf.resume) {
+            dcp_fatal(opendcp, "--dual can not be used with --replace, --rerate, --extract_2k, --rekey, --left_eye or --resume");
+        }
+    }
+
+    if (opendcp->mxf.upload && (batch_file || replace_file || rerate || extract_2k || rekey || left_eye || opendcp->mxf.resume)) {
+        dcp_fatal(opendcp, "--upload can not be used with --batch, --replace, --rerate, --extract_2k, --rekey, --left_eye or --resume");
+    }
+
+    if (left_eye && (rerate || extract_2k || batch_file || replace_file || opendcp->stereoscopic)) {
+        dcp_fatal(opendcp, "--left_eye reads a 3D picture mxf, it can not be used with --rerate, --extract_2k, --batch, --replace or -3");
+    }
+
+    if (rekey && (rerate || extract_2k)) {
+        dcp_fatal(opendcp, "--rekey can not be used with --rerate or --extract_2k");
+    }
+
+    if (rekey && !left_eye && !opendcp->mxf.key_flag) {
+        dcp_fatal(opendcp, "--rekey needs the new key with --key");
+    }
+
+    if (batch_file) {
+        if (opendcp->mxf.key_flag && key_id_flag == 0) {
+            memset(opendcp->mxf.key_id, 0, sizeof(opendcp->mxf.key_id));
+        }
+
+        c = batch_run(opendcp, batch_file, jobs);
+        metrics_done(opendcp, stats, metrics_file);
+        opendcp_delete(opendcp);
+
+        exit(c ? OPENDCP_ERROR : 0);
+    }
+
     if (opendcp->stereoscopic) {
         if (in_path_left == NULL) {
             dcp_fatal(opendcp, "3D input detected, but missing left image input path");
@@ -371,24 +1057,64 @@ int main (int argc, char **argv) {
         dcp_fatal(opendcp, "Missing output file");
     }
 
-    if (opendcp->stereoscopic) {
-        filelist = get_filelist_3d(in_path_left, in_path_right);
+    if (opendcp->mxf.key_flag && key_id_flag == 0) {
+        memset(opendcp->mxf.key_id, 0, sizeof(opendcp->mxf.key_id));
     }
-    else {
-        filelist = get_filelist(in_path, "j2c,j2k,wav");
 
-        /* Sort files by index, and make sure they're sequential. */
-        if (order_indexed_files(filelist->files, filelist->nfiles) != OPENDCP_NO_ERROR) {
-            dcp_fatal(opendcp, "Could not order image files");
+    /* set the callbacks (optional) for the mxf writer */
+    if (opendcp->log_level > 0 && opendcp->log_level < 3) {
+        opendcp->mxf.frame_done.callback = frame_done_cb;
+        opendcp->mxf.frame_done.argument = opendcp;
+        opendcp->mxf.file_done.callback  = write_done_cb;
+        opendcp->mxf.progress_ms         = 100;
+    }
+
+    /* the input track is rewritten frame by frame in place of the input codestreams */
+    if (rerate || extract_2k || rekey || left_eye) {
+        asset_t asset;
+
+        memset(&asset, 0, sizeof(asset));
+        snprintf(asset.filename, sizeof(asset.filename), "%s", in_path);
+        total = read_asset_info(&asset) == OPENDCP_NO_ERROR ? asset.duration : 0;
+
+        if (opendcp->log_level > 0 && opendcp->log_level < 3) {
+            cli_progress_start(&progress, rerate ? "MXF Re-rate" : left_eye ? "MXF Left Eye" : rekey ? "MXF Re-key" : "MXF 2K Extract",
+                               0, total);
+        }
+
+        if (left_eye) {
+            c = left_eye_j2k_mxf(opendcp, in_path, rekey ? rekey_value : NULL, out_path);
+        }
+        else if (rerate) {
+            c = rerate_j2k_mxf(opendcp, in_path, rerate * 1000000, out_path);
+        }
+        else if (rekey) {
+            c = rekey_j2k_mxf(opendcp, in_path, rekey_value, out_path);
+        }
+        else {
+            c = extract_2k_j2k_mxf(opendcp, in_path, out_path);
         }
 
-        int rc = ensure_sequential(filelist->files, filelist->nfiles);
+        cli_progress_stop(&progress);
 
-        if (rc != OPENDCP_NO_ERROR) {
-            OPENDCP_LOG(LOG_WARN, "Filenames not sequential between %s and %s.", filelist->files[rc], filelist->files[rc + 1]);
+        if (c != OPENDCP_NO_ERROR) {
+            OPENDCP_LOG(LOG_ERROR, "Could not rewrite %s", in_path);
         }
+        else {
+            OPENDCP_LOG(LOG_INFO, "MXF rewrite complete");
+        }
+
+        metrics_done(opendcp, stats, metrics_file);
+        opendcp_delete(opendcp);
+
+        exit(c ? OPENDCP_ERROR : 0);
     }
 
+    bitrate_report_path(opendcp, bitrate_file, sizeof(bitrate_file), out_path);
+    loudness_report_path(opendcp, loudness_file, sizeof(loudness_file), out_path);
+
+    filelist = mxf_filelist(opendcp, in_path, in_path_left, in_path_right);
+
     if (!filelist) {
         dcp_fatal(opendcp, "Could not read input files");
     }
@@ -397,61 +1123,49 @@ int main (int argc, char **argv) {
         dcp_fatal(opendcp, "No input files located");
     }
 
-    if (opendcp->mxf.key_flag && key_id_flag == 0) {
-        memset(opendcp->mxf.key_id, 0, sizeof(opendcp->mxf.key_id));
+    error = mxf_frame_range(opendcp, filelist);
+
+    if (error) {
+        dcp_fatal(opendcp, error);
     }
 
-#ifdef _WIN32
+    int class = get_file_essence_class(filelist->files[0], 1);
 
-    /* check for non-ascii filenames under windows */
-    for (c = 0; c < filelist->nfiles; c++) {
-        if (is_filename_ascii(filelist->files[c]) == 0) {
-            OPENDCP_LOG(LOG_ERROR, "Filename %s contains non-ascii characters, skipping", filelist->files[c]);
-            dcp_fatal(opendcp, "Filenames cannot contain non-ascii characters");
-        }
+    if (opendcp->mxf.dual_file && class != ACT_PICTURE) {
+        dcp_fatal(opendcp, "--dual is written alongside a picture track");
     }
 
-#endif
+    /* only the new frames are wrapped, the rest of the track is copied */
+    if (replace_file) {
+        asset_t asset;
 
-    if (opendcp->mxf.end_frame) {
-        if (opendcp->mxf.end_frame > filelist->nfiles) {
-            dcp_fatal(opendcp, "End frame is greater than the actual frame count");
+        if (opendcp->stereoscopic || class != ACT_PICTURE) {
+            dcp_fatal(opendcp, "Frames can only be replaced with j2k codestreams in a 2D picture track");
         }
-    }
-    else {
-        opendcp->mxf.end_frame = filelist->nfiles;
-    }
 
-    if (opendcp->mxf.start_frame) {
-        if (opendcp->mxf.start_frame > opendcp->mxf.end_frame) {
-            dcp_fatal(opendcp, "Start frame must be less than end frame");
-        }
-    }
-    else {
-        opendcp->mxf.start_frame = 1;
-    }
+        memset(&asset, 0, sizeof(asset));
+        snprintf(asset.filename, sizeof(asset.filename), "%s", replace_file);
+        total = read_asset_info(&asset) == OPENDCP_NO_ERROR ? asset.duration : 0;
 
-    if (opendcp->mxf.slide) {
-        opendcp->mxf.duration = opendcp->mxf.duration * opendcp->frame_rate * filelist->nfiles;
-    }
-    else {
-        opendcp->mxf.duration = opendcp->mxf.end_frame - (opendcp->mxf.start_frame - 1);
-    }
+        if (opendcp->log_level > 0 && opendcp->log_level < 3) {
+            cli_progress_start(&progress, "MXF Replace", 0, total);
+        }
 
-    if (opendcp->mxf.duration < 1) {
-        dcp_fatal(opendcp, "Duration must be at least 1 frame");
-    }
+        c = replace_j2k_mxf(opendcp, replace_file, filelist, replace_frame - 1, out_path);
+        cli_progress_stop(&progress);
 
-    /* set the callbacks (optional) for the mxf writer */
-    if (opendcp->log_level > 0 && opendcp->log_level < 3) {
-        opendcp->mxf.frame_done.callback = frame_done_cb;
-        opendcp->mxf.file_done.callback  = write_done_cb;
-    }
+        if (c != OPENDCP_NO_ERROR) {
+            OPENDCP_LOG(LOG_ERROR, "Could not replace frames of %s", replace_file);
+        }
+        else {
+            OPENDCP_LOG(LOG_INFO, "MXF frame replacement complete");
+        }
 
-    int class = get_file_essence_class(filelist->files[0], 1);
+        filelist_free(filelist);
+        metrics_done(opendcp, stats, metrics_file);
+        opendcp_delete(opendcp);
 
-    if (opendcp->log_level > 0 && opendcp->log_level < 3) {
-        progress_bar();
+        exit(c ? OPENDCP_ERROR : 0);
     }
 
     if (class == ACT_SOUND) {
@@ -461,9 +1175,18 @@ int main (int argc, char **argv) {
         total = opendcp->mxf.duration;
     }
 
+    if (opendcp->log_level > 0 && opendcp->log_level < 3) {
+        cli_progress_start(&progress, "MXF Creation", 0, total);
+    }
+
     if (write_mxf(opendcp, filelist, out_path) != 0 )  {
+        cli_progress_stop(&progress);
         OPENDCP_LOG(LOG_INFO, "Could not create MXF file");
     }
+    else if (opendcp->mxf.cancel) {
+        cli_progress_stop(&progress);
+        OPENDCP_LOG(LOG_WARN, "MXF creation interrupted%s", opendcp->mxf.checkpoint ? ", run again with --resume to continue" : "");
+    }
     else {
         OPENDCP_LOG(LOG_INFO, "MXF creation complete");
     }
@@ -474,6 +1197,7 @@ int main (int argc, char **argv) {
         printf("\n");
     }
 
+    metrics_done(opendcp, stats, metrics_file);
     opendcp_delete(opendcp);
 
     exit(0);
@@ -0,0 +1,199 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2013 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+#include <getopt.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/types.h>
+
+#include "opendcp.h"
+#include "cpu.h"
+
+void version() {
+    FILE *fp;
+    char kernels[512];
+
+    fp = stdout;
+    fprintf(fp, "\n%s version %s %s\n\n", OPENDCP_NAME, OPENDCP_VERSION, OPENDCP_COPYRIGHT);
+    fprintf(fp, "%s\n\n", cpu_describe(kernels, sizeof(kernels)));
+
+    exit(0);
+}
+
+void dcp_usage() {
+    FILE *fp;
+    fp = stdout;
+
+    fprintf(fp, "\n%s version %s %s\n\n", OPENDCP_NAME, OPENDCP_VERSION, OPENDCP_COPYRIGHT);
+    fprintf(fp, "Compares the essence of two picture or sound MXF files frame by frame\n\n");
+    fprintf(fp, "Usage:\n");
+    fprintf(fp, "       opendcp_mxf_diff -a <file> -b <file> [options ...]\n\n");
+    fprintf(fp, "Required:\n");
+    fprintf(fp, "       -a | --input_a <file>          - first mxf file\n");
+    fprintf(fp, "       -b | --input_b <file>          - second mxf file\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "Options:\n");
+    fprintf(fp, "       -k | --key_a <key>             - decryption key of the first file\n");
+    fprintf(fp, "       -K | --key_b <key>             - decryption key of the second file\n");
+    fprintf(fp, "       -t | --threads <threads>       - set number of comparison threads (default 4)\n");
+    fprintf(fp, "       -l | --log_level <level>       - Sets the log level 0:Quiet, 1:Error, 2:Warn (default),  3:Info, 4:Debug\n");
+    fprintf(fp, "       -h | --help                    - show help\n");
+    fprintf(fp, "       -v | --version                 - show version\n");
+    fprintf(fp, "\n\n");
+
+    fclose(fp);
+    exit(0);
+}
+
+int main (int argc, char **argv) {
+    int c;
+    int result;
+    int first_diff, diffs;
+    opendcp_t *opendcp;
+    char *filename[2] = {NULL, NULL};
+    unsigned char key[2][16];
+    int key_flag[2] = {0, 0};
+    struct stat s;
+    struct timeval start, end;
+    double seconds;
+    int i;
+
+    if (argc <= 1) {
+        dcp_usage();
+    }
+
+    opendcp = opendcp_create();
+
+    /* set initial values */
+    opendcp->log_level = LOG_WARN;
+    opendcp->threads = 4;
+
+    /* parse options */
+    while (1)
+    {
+        static struct option long_options[] =
+        {
+            {"input_a",        required_argument, 0, 'a'},
+            {"input_b",        required_argument, 0, 'b'},
+            {"key_a",          required_argument, 0, 'k'},
+            {"key_b",          required_argument, 0, 'K'},
+            {"help",           no_argument,       0, 'h'},
+            {"log_level",      required_argument, 0, 'l'},
+            {"threads",        required_argument, 0, 't'},
+            {"version",        no_argument,       0, 'v'},
+            {0, 0, 0, 0}
+        };
+
+        /* getopt_long stores the option index here. */
+        int option_index = 0;
+
+        c = getopt_long (argc, argv, "a:b:k:K:l:t:hv",
+                         long_options, &option_index);
+
+        /* Detect the end of the options. */
+        if (c == -1) {
+            break;
+        }
+
+        switch (c)
+        {
+            case 'a':
+                filename[0] = optarg;
+                break;
+
+            case 'b':
+                filename[1] = optarg;
+                break;
+
+            case 'l':
+                opendcp->log_level = atoi(optarg);
+                break;
+
+            case 't':
+                opendcp->threads = atoi(optarg);
+
+                if (opendcp->threads < 1) {
+                    dcp_fatal(opendcp, "Threads must be greater than 0");
+                }
+
+                break;
+
+            case 'h':
+                dcp_usage();
+                break;
+
+            case 'k':
+            case 'K':
+                i = c == 'K';
+
+                if (!is_key(optarg) || hex2bin(optarg, key[i], 16)) {
+                    dcp_fatal(opendcp, "Invalid encryption key format");
+                }
+
+                key_flag[i] = 1;
+
+                break;
+
+            case 'v':
+                version();
+                break;
+        }
+    }
+
+    opendcp_log_init(opendcp->log_level);
+
+    for (i = 0; i < 2; i++) {
+        if (filename[i] == NULL) {
+            dcp_fatal(opendcp, "Missing input file");
+        }
+
+        if (stat(filename[i], &s) != 0 || !(s.st_mode & S_IFREG)) {
+            dcp_fatal(opendcp, "Could not open file: %s", filename[i]);
+        }
+    }
+
+    gettimeofday(&start, NULL);
+    result = compare_mxf(opendcp, filename[0], key_flag[0] ? key[0] : NULL,
+                         filename[1], key_flag[1] ? key[1] : NULL, &first_diff, &diffs);
+    gettimeofday(&end, NULL);
+
+    seconds = (end.tv_sec - start.tv_sec) + (end.tv_usec - start.tv_usec) / 1000000.0;
+
+    if (result == OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_INFO, "%s and %s have the same essence", filename[0], filename[1]);
+    }
+    else if (result == OPENDCP_COMPARE_MXF) {
+        OPENDCP_LOG(LOG_ERROR, "%s and %s DIFFER in %d frames, first differing frame is %d",
+                    filename[0], filename[1], diffs, first_diff);
+    }
+    else {
+        OPENDCP_LOG(LOG_ERROR, "%s and %s could not be compared: %s", filename[0], filename[1], OPENDCP_ERROR_STRING[result]);
+    }
+
+    if (seconds > 0) {
+        OPENDCP_LOG(LOG_INFO, "Compared in %.2f seconds", seconds);
+    }
+
+    opendcp_delete(opendcp);
+
+    exit(result == OPENDCP_NO_ERROR ? OPENDCP_NO_ERROR : OPENDCP_ERROR);
+}
@@ -0,0 +1,201 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2013 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+#include <getopt.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/types.h>
+
+#include "opendcp.h"
+#include "cpu.h"
+
+void version() {
+    FILE *fp;
+    char kernels[512];
+
+    fp = stdout;
+    fprintf(fp, "\n%s version %s %s\n\n", OPENDCP_NAME, OPENDCP_VERSION, OPENDCP_COPYRIGHT);
+    fprintf(fp, "%s\n\n", cpu_describe(kernels, sizeof(kernels)));
+
+    exit(0);
+}
+
+void dcp_usage() {
+    FILE *fp;
+    fp = stdout;
+
+    fprintf(fp, "\n%s version %s %s\n\n", OPENDCP_NAME, OPENDCP_VERSION, OPENDCP_COPYRIGHT);
+    fprintf(fp, "Verifies every frame of a picture or sound MXF file\n\n");
+    fprintf(fp, "Usage:\n");
+    fprintf(fp, "       opendcp_mxf_verify -i <file> [options ...]\n\n");
+    fprintf(fp, "Required:\n");
+    fprintf(fp, "       -i | --input <file>            - input mxf file\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "Options:\n");
+    fprintf(fp, "       -k | --key <key>               - decryption key, needed to check the frame HMAC values\n");
+    fprintf(fp, "       -s | --structure               - only check partitions, packets and index, without reading frames\n");
+    fprintf(fp, "       -t | --threads <threads>       - set number of verification threads (default 4)\n");
+    fprintf(fp, "       -l | --log_level <level>       - Sets the log level 0:Quiet, 1:Error, 2:Warn (default),  3:Info, 4:Debug\n");
+    fprintf(fp, "       -h | --help                    - show help\n");
+    fprintf(fp, "       -v | --version                 - show version\n");
+    fprintf(fp, "\n\n");
+
+    fclose(fp);
+    exit(0);
+}
+
+int main (int argc, char **argv) {
+    int c;
+    int result;
+    int bad_frame = -1;
+    int structure = 0;
+    opendcp_t *opendcp;
+    char *filename = NULL;
+    struct stat s;
+    struct timeval start, end;
+    double seconds;
+
+    if (argc <= 1) {
+        dcp_usage();
+    }
+
+    opendcp = opendcp_create();
+
+    /* set initial values */
+    opendcp->log_level = LOG_WARN;
+    opendcp->threads = 4;
+
+    /* parse options */
+    while (1)
+    {
+        static struct option long_options[] =
+        {
+            {"key",            required_argument, 0, 'k'},
+            {"help",           no_argument,       0, 'h'},
+            {"input",          required_argument, 0, 'i'},
+            {"log_level",      required_argument, 0, 'l'},
+            {"structure",      no_argument,       0, 's'},
+            {"threads",        required_argument, 0, 't'},
+            {"version",        no_argument,       0, 'v'},
+            {0, 0, 0, 0}
+        };
+
+        /* getopt_long stores the option index here. */
+        int option_index = 0;
+
+        c = getopt_long (argc, argv, "i:k:l:st:hv",
+                         long_options, &option_index);
+
+        /* Detect the end of the options. */
+        if (c == -1) {
+            break;
+        }
+
+        switch (c)
+        {
+            case 'i':
+                filename = optarg;
+                break;
+
+            case 'l':
+                opendcp->log_level = atoi(optarg);
+                break;
+
+            case 's':
+                structure = 1;
+                break;
+
+            case 't':
+                opendcp->threads = atoi(optarg);
+
+                if (opendcp->threads < 1) {
+                    dcp_fatal(opendcp, "Threads must be greater than 0");
+                }
+
+                break;
+
+            case 'h':
+                dcp_usage();
+                break;
+
+            case 'k':
+                if (!is_key(optarg)) {
+                    dcp_fatal(opendcp, "Invalid encryption key format");
+                }
+
+                if (hex2bin(optarg, opendcp->mxf.key_value, 16)) {
+                    dcp_fatal(opendcp, "Invalid encryption key format");
+                }
+
+                opendcp->mxf.key_flag = 1;
+
+                break;
+
+            case 'v':
+                version();
+                break;
+        }
+    }
+
+    opendcp_log_init(opendcp->log_level);
+
+    if (filename == NULL) {
+        dcp_fatal(opendcp, "Missing input file");
+    }
+
+    if (stat(filename, &s) != 0 || !(s.st_mode & S_IFREG)) {
+        dcp_fatal(opendcp, "Could not open file: %s", filename);
+    }
+
+    gettimeofday(&start, NULL);
+    if (structure) {
+        result = verify_mxf_structure(opendcp, filename);
+    }
+    else {
+        result = verify_mxf(opendcp, filename, &bad_frame);
+    }
+    gettimeofday(&end, NULL);
+
+    seconds = (end.tv_sec - start.tv_sec) + (end.tv_usec - start.tv_usec) / 1000000.0;
+
+    if (result == OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_INFO, "%s is VALID", filename);
+    }
+    else if (result == OPENDCP_VERIFY_MXF) {
+        OPENDCP_LOG(LOG_ERROR, "%s is NOT VALID, first bad frame is %d", filename, bad_frame);
+    }
+    else if (result == OPENDCP_VERIFY_MXF_STRUCTURE) {
+        OPENDCP_LOG(LOG_ERROR, "%s is NOT VALID, its structure is broken", filename);
+    }
+    else {
+        OPENDCP_LOG(LOG_ERROR, "%s could not be verified: %s", filename, OPENDCP_ERROR_STRING[result]);
+    }
+
+    if (seconds > 0) {
+        OPENDCP_LOG(LOG_INFO, "Verified %.1f MB in %.2f seconds (%.1f MB/s)",
+                    s.st_size / 1048576.0, seconds, s.st_size / 1048576.0 / seconds);
+    }
+
+    opendcp_delete(opendcp);
+
+    exit(result == OPENDCP_NO_ERROR ? OPENDCP_NO_ERROR : OPENDCP_ERROR);
+}
@@ -0,0 +1,684 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2013 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <getopt.h>
+#include <signal.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <netdb.h>
+#include <opendcp.h>
+#include <opendcp_image.h>
+#include <opendcp_encoder.h>
+#include <opendcp_remote.h>
+#include <opendcp_worker.h>
+#include "cpu.h"
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+#define SERVER_WORKERS_MAX 64
+#define SERVER_QUEUE_DEPTH 4    /* queued frames per worker before readers wait */
+
+/* a client connection, freed when its reader and all its frames are done */
+typedef struct {
+    int             fd;
+    int             refs;
+    pthread_mutex_t mutex;
+} connection_t;
+
+/* a frame waiting for a worker */
+typedef struct job {
+    connection_t  *connection;
+    uint32_t      id;
+    unsigned char *payload;
+    uint32_t      length;
+    struct job    *next;
+} job_t;
+
+typedef struct {
+    int             encoder;
+    char            *tmp_path;
+    int             workers;
+    int             queue_max;
+
+    /* job queue */
+    job_t           *head;
+    job_t           *tail;
+    int             queued;
+    pthread_mutex_t mutex;
+    pthread_cond_t  job_ready;
+    pthread_cond_t  job_taken;
+
+    /* stats, protected by mutex */
+    time_t          started;
+    int             connections;
+    int             active;
+    int             busy;           /* threads used by the frames being encoded */
+    unsigned long   frames;
+    unsigned long   failed;
+    double          encode_seconds;
+    double          bytes_in;
+    double          bytes_out;
+} server_t;
+
+static server_t server;
+
+void version() {
+    FILE *fp;
+    char kernels[512];
+
+    fp = stdout;
+    fprintf(fp, "\n%s version %s %s\n\n", OPENDCP_NAME, OPENDCP_VERSION, OPENDCP_COPYRIGHT);
+    fprintf(fp, "%s\n\n", cpu_describe(kernels, sizeof(kernels)));
+
+    exit(0);
+}
+
+void dcp_usage() {
+    FILE *fp;
+    fp = stdout;
+
+    fprintf(fp, "\n%s version %s %s\n\n", OPENDCP_NAME, OPENDCP_VERSION, OPENDCP_COPYRIGHT);
+    fprintf(fp, "Encodes JPEG2000 frames sent by opendcp_j2k --encoder remote\n\n");
+    fprintf(fp, "Usage:\n");
+    fprintf(fp, "       opendcp_server [options ...]\n\n");
+    fprintf(fp, "Options:\n");
+    fprintf(fp, "       -p | --port <port>                 - listen port (default %s)\n", OPENDCP_REMOTE_PORT);
+    fprintf(fp, "       -w | --workers <workers>           - number of frames encoded at once (default 4)\n");
+    fprintf(fp, "       -e | --encoder <openjpeg | kakadu> - jpeg2000 encoder (default openjpeg)\n");
+    fprintf(fp, "       -m | --tmp_dir                     - temporary directory for Kakadu (default /dev/shm if available)\n");
+    fprintf(fp, "       -W | --worker                      - run as an encoder worker process of opendcp_j2k --encoder worker\n");
+    fprintf(fp, "       -l | --log_level <level>           - sets the log level 0:Quiet, 1:Error, 2:Warn (default),  3:Info, 4:Debug\n");
+    fprintf(fp, "       -h | --help                        - show help\n");
+    fprintf(fp, "       -v | --version                     - show version\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "An HTTP GET on the port returns the server statistics, GET /health returns ok.\n");
+    fprintf(fp, "\n\n");
+
+    fclose(fp);
+    exit(0);
+}
+
+static double now_seconds() {
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+
+    return tv.tv_sec + tv.tv_usec / 1000000.0;
+}
+
+static void connection_put(connection_t *connection) {
+    int refs;
+
+    pthread_mutex_lock(&connection->mutex);
+    refs = --connection->refs;
+    pthread_mutex_unlock(&connection->mutex);
+
+    if (refs) {
+        return;
+    }
+
+    pthread_mutex_lock(&server.mutex);
+    server.connections--;
+    pthread_mutex_unlock(&server.mutex);
+
+    opendcp_remote_close_socket(connection->fd);
+    pthread_mutex_destroy(&connection->mutex);
+    free(connection);
+}
+
+/* kdu_compress only writes files, encode to a temporary file and read it back */
+static int encode_file(opendcp_t *opendcp, opendcp_encoder_t *encoder, opendcp_image_t *image, int worker,
+                       unsigned char **data, int *length) {
+    char file[MAX_PATH_LENGTH];
+    FILE *fp;
+    long size;
+    int  result;
+
+    snprintf(file, sizeof(file), "%s/opendcp_server_%d_%d.j2c", server.tmp_path ? server.tmp_path : ".", (int)getpid(), worker);
+
+    if (encoder->encode(opendcp, image, file) != OPENDCP_NO_ERROR || !(fp = fopen(file, "rb"))) {
+        remove(file);
+        return OPENDCP_ERROR;
+    }
+
+    fseek(fp, 0, SEEK_END);
+    size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+
+    *data  = malloc(size > 0 ? size : 1);
+    result = *data && size > 0 && fread(*data, 1, size, fp) == (size_t)size ? OPENDCP_NO_ERROR : OPENDCP_ERROR;
+    *length = size;
+
+    fclose(fp);
+    remove(file);
+
+    if (result != OPENDCP_NO_ERROR) {
+        free(*data);
+        *data = NULL;
+    }
+
+    return result;
+}
+
+/* encode a request, returns the result payload */
+static unsigned char *encode_request(opendcp_t *opendcp, opendcp_encoder_t *encoder, int worker,
+                                     const unsigned char *payload, uint32_t payload_length, uint32_t *length) {
+    opendcp_remote_params_t params;
+    opendcp_image_t         *image = NULL;
+    unsigned char           *data = NULL, *out;
+    int                     size = 0;
+    int                     result;
+
+    result = opendcp_remote_unpack_image(payload, payload_length, &params, &image);
+
+    if (result == OPENDCP_NO_ERROR) {
+        opendcp->cinema_profile = params.profile;
+        opendcp->j2k.bw         = params.bw;
+        opendcp->frame_rate     = params.frame_rate;
+        opendcp->stereoscopic   = params.stereoscopic;
+
+        if (params.xyz) {
+            if (image->n_components != 3 || image->precision > 12 || params.lut < 0 || params.lut >= CP_MAX ||
+                rgb_to_xyz(image, params.lut, params.xyz_method) != OPENDCP_NO_ERROR) {
+                OPENDCP_LOG(LOG_ERROR, "color conversion failed");
+                opendcp_image_free(image);
+                image = NULL;
+                result = OPENDCP_ERROR;
+            }
+        }
+    }
+
+    if (image) {
+        if (encoder->caps & OPENDCP_ENCODER_CAP_BUFFER) {
+            result = opendcp_encoder_encode_buffer(encoder, opendcp, image, &data, &size);
+        }
+        else {
+            result = encode_file(opendcp, encoder, image, worker, &data, &size);
+        }
+
+        opendcp_image_free(image);
+    }
+
+    if (result != OPENDCP_NO_ERROR) {
+        free(data);
+        data = NULL;
+        size = 0;
+    }
+
+    out = malloc(4 + size);
+
+    if (!out) {
+        free(data);
+        return NULL;
+    }
+
+    out[0] = out[1] = out[2] = 0;
+    out[3] = result == OPENDCP_NO_ERROR ? OPENDCP_NO_ERROR : OPENDCP_ERROR;
+
+    if (size) {
+        memcpy(out + 4, data, size);
+    }
+
+    free(data);
+    *length = 4 + size;
+
+    return out;
+}
+
+static void *worker_thread(void *arg) {
+    opendcp_t         *opendcp;
+    opendcp_encoder_t *encoder;
+    job_t             *job;
+    unsigned char     *result;
+    uint32_t          length = 0;
+    double            start;
+    int               worker = (int)(intptr_t)arg;
+    int               threads = 1;
+
+    /* each worker keeps its own context, so the encoder state it caches is reused */
+    opendcp = opendcp_create();
+    opendcp->tmp_path = server.tmp_path;
+    encoder = opendcp_encoder_find(NULL, NULL, server.encoder);
+
+    while (1) {
+        pthread_mutex_lock(&server.mutex);
+
+        while (!server.head) {
+            pthread_cond_wait(&server.job_ready, &server.mutex);
+        }
+
+        job = server.head;
+        server.head = job->next;
+
+        if (!server.head) {
+            server.tail = NULL;
+        }
+
+        /* a short queue leaves workers idle, their threads go into the frame */
+        if (opendcp_encoder_has_threads(encoder)) {
+            threads = opendcp_encoder_thread_share(server.workers, server.busy, server.workers - server.active, server.queued);
+        }
+
+        server.queued--;
+        server.active++;
+        server.busy += threads;
+        pthread_cond_signal(&server.job_taken);
+        pthread_mutex_unlock(&server.mutex);
+
+        opendcp_encoder_threads(encoder, threads);
+        start  = now_seconds();
+        result = encode_request(opendcp, encoder, worker, job->payload, job->length, &length);
+
+        pthread_mutex_lock(&server.mutex);
+        server.active--;
+        server.busy -= threads;
+        server.encode_seconds += now_seconds() - start;
+
+        if (result && result[3] == OPENDCP_NO_ERROR) {
+            server.frames++;
+            server.bytes_out += length - 4;
+        }
+        else {
+            server.failed++;
+        }
+
+        pthread_mutex_unlock(&server.mutex);
+
+        if (result) {
+            pthread_mutex_lock(&job->connection->mutex);
+
+            if (opendcp_remote_send(job->connection->fd, REMOTE_ENCODE_RESULT, job->id, result, length) != OPENDCP_NO_ERROR) {
+                /* the reader notices the broken connection and stops */
+                shutdown(job->connection->fd, SHUT_RDWR);
+            }
+
+            pthread_mutex_unlock(&job->connection->mutex);
+        }
+        else {
+            shutdown(job->connection->fd, SHUT_RDWR);
+        }
+
+        free(result);
+        free(job->payload);
+        connection_put(job->connection);
+        free(job);
+    }
+
+    return NULL;
+}
+
+/* the encoder of a worker process started by opendcp_j2k --encoder worker */
+typedef struct {
+    opendcp_t         *opendcp;
+    opendcp_encoder_t *encoder;
+} worker_process_t;
+
+static unsigned char *worker_process_encode(void *arg, const unsigned char *payload, uint32_t length, uint32_t *result_length) {
+    worker_process_t *process = arg;
+
+    return encode_request(process->opendcp, process->encoder, 0, payload, length, result_length);
+}
+
+static int worker_process(void) {
+    worker_process_t process;
+    int              result;
+
+    process.opendcp = opendcp_create();
+    process.opendcp->tmp_path = server.tmp_path;
+    process.encoder = opendcp_encoder_find(NULL, NULL, server.encoder);
+
+    result = opendcp_worker_serve(worker_process_encode, &process);
+
+    opendcp_delete(process.opendcp);
+
+    return result;
+}
+
+/* answer an http request with the server statistics */
+static void send_stats(int fd) {
+    char   request[1024];
+    char   body[1024];
+    char   response[1280];
+    double uptime;
+    int    n, health;
+
+    n = recv(fd, request, sizeof(request) - 1, 0);
+    request[n > 0 ? n : 0] = '\0';
+    health = !strncmp(request, "GET /health", 11);
+
+    pthread_mutex_lock(&server.mutex);
+    uptime = difftime(time(NULL), server.started);
+
+    if (health) {
+        snprintf(body, sizeof(body), "ok\n");
+    }
+    else {
+        snprintf(body, sizeof(body),
+                 "workers %d\n"
+                 "active %d\n"
+                 "queued %d\n"
+                 "connections %d\n"
+                 "frames %lu\n"
+                 "failed %lu\n"
+                 "uptime_seconds %.0f\n"
+                 "frames_per_second %.2f\n"
+                 "seconds_per_frame %.3f\n"
+                 "megabytes_in %.1f\n"
+                 "megabytes_out %.1f\n",
+                 server.workers, server.active, server.queued, server.connections,
+                 server.frames, server.failed, uptime,
+                 uptime > 0 ? server.frames / uptime : 0.0,
+                 server.frames ? server.encode_seconds / server.frames : 0.0,
+                 server.bytes_in / 1048576.0, server.bytes_out / 1048576.0);
+    }
+
+    pthread_mutex_unlock(&server.mutex);
+
+    n = snprintf(response, sizeof(response),
+                 "HTTP/1.0 200 OK\r\nContent-Type: text/plain\r\nContent-Length: %d\r\nConnection: close\r\n\r\n%s",
+                 (int)strlen(body), body);
+    send(fd, response, n, MSG_NOSIGNAL);
+}
+
+/* read the requests of a connection onto the job queue */
+static void *reader_thread(void *arg) {
+    connection_t            *connection = arg;
+    opendcp_remote_header_t header;
+    job_t                   *job;
+    char                    peek[4];
+
+    if (recv(connection->fd, peek, sizeof(peek), MSG_PEEK | MSG_WAITALL) == sizeof(peek) && !memcmp(peek, "GET ", 4)) {
+        send_stats(connection->fd);
+        connection_put(connection);
+        return NULL;
+    }
+
+    while (opendcp_remote_recv_header(connection->fd, &header) == OPENDCP_NO_ERROR) {
+        if (header.type != REMOTE_ENCODE_REQUEST) {
+            OPENDCP_LOG(LOG_ERROR, "unexpected message %u", header.type);
+            break;
+        }
+
+        job = calloc(1, sizeof(job_t));
+
+        if (!job || !(job->payload = malloc(header.length ? header.length : 1))) {
+            free(job);
+            break;
+        }
+
+        if (opendcp_remote_recv(connection->fd, job->payload, header.length) != OPENDCP_NO_ERROR) {
+            free(job->payload);
+            free(job);
+            break;
+        }
+
+        job->connection = connection;
+        job->id         = header.id;
+        job->length     = header.length;
+
+        pthread_mutex_lock(&connection->mutex);
+        connection->refs++;
+        pthread_mutex_unlock(&connection->mutex);
+
+        pthread_mutex_lock(&server.mutex);
+
+        /* hold the client back rather than buffer without limit */
+        while (server.queued >= server.queue_max) {
+            pthread_cond_wait(&server.job_taken, &server.mutex);
+        }
+
+        if (server.tail) {
+            server.tail->next = job;
+        }
+        else {
+            server.head = job;
+        }
+
+        server.tail = job;
+        server.queued++;
+        server.bytes_in += header.length;
+        pthread_cond_signal(&server.job_ready);
+        pthread_mutex_unlock(&server.mutex);
+    }
+
+    OPENDCP_LOG(LOG_INFO, "connection closed");
+    connection_put(connection);
+
+    return NULL;
+}
+
+static int server_listen(const char *port) {
+    struct addrinfo hints, *addr, *a;
+    int fd = -1;
+    int one = 1;
+    int rc;
+
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family   = AF_INET6;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags    = AI_PASSIVE;
+
+    /* fall back to ipv4 only hosts */
+    if (getaddrinfo(NULL, port, &hints, &addr)) {
+        hints.ai_family = AF_INET;
+
+        if ((rc = getaddrinfo(NULL, port, &hints, &addr))) {
+            OPENDCP_LOG(LOG_ERROR, "invalid port %s: %s", port, gai_strerror(rc));
+            return -1;
+        }
+    }
+
+    for (a = addr; a; a = a->ai_next) {
+        fd = socket(a->ai_family, a->ai_socktype, a->ai_protocol);
+
+        if (fd < 0) {
+            continue;
+        }
+
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, (void *)&one, sizeof(one));
+
+        if (bind(fd, a->ai_addr, a->ai_addrlen) == 0 && listen(fd, 16) == 0) {
+            break;
+        }
+
+        close(fd);
+        fd = -1;
+    }
+
+    freeaddrinfo(addr);
+
+    return fd;
+}
+
+int main (int argc, char **argv) {
+    int c, i, fd, listen_fd, result;
+    int log_level = LOG_WARN;
+    int worker = 0;
+    char *port = OPENDCP_REMOTE_PORT;
+    connection_t *connection;
+    pthread_t thread;
+
+    memset(&server, 0, sizeof(server));
+    server.encoder = OPENDCP_ENCODER_OPENJPEG;
+    server.workers = 4;
+
+    /* parse options */
+    while (1)
+    {
+        static struct option long_options[] =
+        {
+            {"encoder",        required_argument, 0, 'e'},
+            {"help",           no_argument,       0, 'h'},
+            {"log_level",      required_argument, 0, 'l'},
+            {"tmp_dir",        required_argument, 0, 'm'},
+            {"port",           required_argument, 0, 'p'},
+            {"version",        no_argument,       0, 'v'},
+            {"workers",        required_argument, 0, 'w'},
+            {"worker",         no_argument,       0, 'W'},
+            {0, 0, 0, 0}
+        };
+
+        /* getopt_long stores the option index here. */
+        int option_index = 0;
+
+        c = getopt_long (argc, argv, "e:l:m:p:w:hvW",
+                         long_options, &option_index);
+
+        /* Detect the end of the options. */
+        if (c == -1) {
+            break;
+        }
+
+        switch (c)
+        {
+            case 'e':
+                if (!strcmp(optarg, "openjpeg")) {
+                    server.encoder = OPENDCP_ENCODER_OPENJPEG;
+                }
+                else if (!strcmp(optarg, "kakadu")) {
+                    server.encoder = OPENDCP_ENCODER_KAKADU;
+                }
+                else {
+                    fprintf(stderr, "Invalid encoder argument\n");
+                    exit(OPENDCP_ERROR);
+                }
+
+                break;
+
+            case 'l':
+                log_level = atoi(optarg);
+                break;
+
+            case 'm':
+                server.tmp_path = optarg;
+                break;
+
+            case 'p':
+                port = optarg;
+                break;
+
+            case 'w':
+                server.workers = atoi(optarg);
+                break;
+
+            case 'W':
+                worker = 1;
+                break;
+
+            case 'h':
+                dcp_usage();
+                break;
+
+            case 'v':
+                version();
+                break;
+        }
+    }
+
+    opendcp_log_init(log_level);
+    opendcp_log_async(1);
+
+    if (server.workers < 1 || server.workers > SERVER_WORKERS_MAX) {
+        fprintf(stderr, "Workers must be between 1 and %d\n", SERVER_WORKERS_MAX);
+        exit(OPENDCP_ERROR);
+    }
+
+    /* keep kdu_compress staging files off the disk */
+    if (!server.tmp_path && !access("/dev/shm", W_OK)) {
+        server.tmp_path = "/dev/shm";
+    }
+
+    if (opendcp_encoder_enable("j2c", NULL, server.encoder)) {
+        fprintf(stderr, "Could not enable encoder\n");
+        exit(OPENDCP_ERROR);
+    }
+
+    /* frames come through shared memory instead of a socket */
+    if (worker) {
+        result = worker_process();
+        opendcp_log_flush();
+        exit(result);
+    }
+
+    signal(SIGPIPE, SIG_IGN);
+
+    listen_fd = server_listen(port);
+
+    if (listen_fd < 0) {
+        fprintf(stderr, "Could not listen on port %s\n", port);
+        exit(OPENDCP_ERROR);
+    }
+
+    server.queue_max = server.workers * SERVER_QUEUE_DEPTH;
+    server.started   = time(NULL);
+    pthread_mutex_init(&server.mutex, NULL);
+    pthread_cond_init(&server.job_ready, NULL);
+    pthread_cond_init(&server.job_taken, NULL);
+
+    for (i = 0; i < server.workers; i++) {
+        if (pthread_create(&thread, NULL, worker_thread, (void *)(intptr_t)i)) {
+            fprintf(stderr, "Could not start worker threads\n");
+            exit(OPENDCP_ERROR);
+        }
+
+        pthread_detach(thread);
+    }
+
+    OPENDCP_LOG(LOG_INFO, "listening on port %s with %d workers", port, server.workers);
+
+    while (1) {
+        fd = accept(listen_fd, NULL, NULL);
+
+        if (fd < 0) {
+            continue;
+        }
+
+        connection = calloc(1, sizeof(connection_t));
+
+        if (!connection) {
+            close(fd);
+            continue;
+        }
+
+        connection->fd   = fd;
+        connection->refs = 1;
+        pthread_mutex_init(&connection->mutex, NULL);
+
+        pthread_mutex_lock(&server.mutex);
+        server.connections++;
+        pthread_mutex_unlock(&server.mutex);
+
+        if (pthread_create(&thread, NULL, reader_thread, connection)) {
+            connection_put(connection);
+            continue;
+        }
+
+        pthread_detach(thread);
+    }
+
+    return OPENDCP_NO_ERROR;
+}
@@ -20,10 +20,19 @@
 #include <getopt.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <inttypes.h>
 #include <time.h>
 #include <sys/stat.h>
+#ifdef _WIN32
+#include <direct.h>
+#define batch_mkdir(dir) _mkdir(dir)
+#else
+#include <unistd.h>
+#define batch_mkdir(dir) mkdir(dir, 0777)
+#endif
 
 #include "opendcp.h"
+#include "cpu.h"
 
 void progress_bar();
 
@@ -38,9 +47,11 @@ typedef struct {
 
 void version() {
     FILE *fp;
+    char kernels[512];
 
     fp = stdout;
     fprintf(fp, "\n%s version %s %s\n\n", OPENDCP_NAME, OPENDCP_VERSION, OPENDCP_COPYRIGHT);
+    fprintf(fp, "%s\n\n", cpu_describe(kernels, sizeof(kernels)));
 
     exit(0);
 }
@@ -67,6 +78,8 @@ void dcp_usage() {
     fprintf(fp, "       -h | --help                    - Show help\n");
     fprintf(fp, "       -v | --version                 - Show version\n");
     fprintf(fp, "       -d | --digest                  - Generates digest (used to validate DCP asset integrity)\n");
+    fprintf(fp, "       -c | --digest_cache <file>     - Reuse digests of unchanged assets recorded in <file>\n");
+    fprintf(fp, "       -f | --verify                  - Recalculate every digest, ignoring cached values\n");
 #ifdef XMLSEC
     fprintf(fp, "       -s | --sign                    - Writes XML digital signature\n");
     fprintf(fp, "       -1 | --root                    - Root pem certificate used to sign XML files\n");
@@ -85,6 +98,14 @@ void dcp_usage() {
     fprintf(fp, "       -x | --width                   - Force aspect width (overrides detect value)\n");
     fprintf(fp, "       -y | --height                  - Force aspect height (overrides detected value)\n");
     fprintf(fp, "       -l | --log_level <level>       - Set the log level 0:Quiet, 1:Error, 2:Warn (default),  3:Info, 4:Debug\n");
+    fprintf(fp, "       -B | --batch <manifest>        - build every version listed in the manifest instead of --reel, see below\n");
+    fprintf(fp, "       -j | --jobs <count>            - documents signed at once in batch mode (default 4)\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "Batch manifest, one entry per line, # starts a comment:\n");
+    fprintf(fp, "       version <directory> [<title> [<rating>]]  - starts a version, its package is written to the directory\n");
+    fprintf(fp, "       reel <mxf> [<mxf> [<mxf>]]                - adds a reel to the version above it\n");
+    fprintf(fp, "       Every asset is probed and hashed once, however many versions use it, and linked\n");
+    fprintf(fp, "       into the directory of each version that is not already in it.\n");
     fprintf(fp, "\n\n");
 
     fclose(fp);
@@ -132,6 +153,429 @@ void progress_bar() {
     fflush(stdout);
 }
 
+/*
+   Batch mode builds many versions of a composition that share most of
+   their assets, such as the languages and ratings of a feature. Each
+   distinct asset is probed and hashed once, the packages are written
+   from copies of it, and the cpls, then the pkls, of all versions are
+   signed together in one signing session.
+*/
+#define BATCH_LINE_LENGTH (4 * MAX_FILENAME_LENGTH)
+#define BATCH_SIGN_JOBS   4
+
+typedef struct {
+    char       directory[MAX_FILENAME_LENGTH];
+    char       title[80];
+    char       rating[6];
+    int        reel_count;
+    int        asset_count[MAX_REELS];
+    int        asset[MAX_REELS][3];     /* index into the distinct assets */
+    opendcp_t  *opendcp;
+} batch_version_t;
+
+typedef struct {
+    batch_version_t *versions;
+    int             version_count;
+    int             version_alloc;
+    asset_t         *assets;
+    int             asset_count;
+    int             asset_alloc;
+} batch_t;
+
+static int is_rating(const char *rating) {
+    return !strcmp(rating, "G") || !strcmp(rating, "PG") || !strcmp(rating, "PG-13") ||
+           !strcmp(rating, "R") || !strcmp(rating, "NC-17");
+}
+
+/* index of the distinct asset with this file name, added if it is new */
+static int batch_asset(batch_t *batch, const char *filename) {
+    int i;
+
+    for (i = 0; i < batch->asset_count; i++) {
+        if (!strcmp(batch->assets[i].filename, filename)) {
+            return i;
+        }
+    }
+
+    if (batch->asset_count == batch->asset_alloc) {
+        batch->asset_alloc = batch->asset_alloc ? batch->asset_alloc * 2 : 16;
+        batch->assets      = realloc(batch->assets, batch->asset_alloc * sizeof(asset_t));
+
+        if (!batch->assets) {
+            return -1;
+        }
+    }
+
+    memset(&batch->assets[batch->asset_count], 0, sizeof(asset_t));
+    snprintf(batch->assets[batch->asset_count].filename, MAX_FILENAME_LENGTH, "%s", filename);
+
+    return batch->asset_count++;
+}
+
+/* parses one manifest line, returns an error message or NULL */
+static char *batch_line(opendcp_t *opendcp, batch_t *batch, char *line) {
+    char            keyword[16], first[MAX_FILENAME_LENGTH], second[MAX_FILENAME_LENGTH], third[MAX_FILENAME_LENGTH];
+    char            *files[3] = {first, second, third};
+    batch_version_t *version;
+    int             fields, i;
+
+    fields = sscanf(line, "%15s %253s %253s %253s", keyword, first, second, third);
+
+    if (!strcmp(keyword, "version")) {
+        if (fields < 2) {
+            return "A version needs the directory of its package";
+        }
+
+        if (strlen(first) + 48 > MAX_FILENAME_LENGTH) {
+            return "The directory name is too long";
+        }
+
+        if (batch->version_count == batch->version_alloc) {
+            batch->version_alloc = batch->version_alloc ? batch->version_alloc * 2 : 16;
+            batch->versions      = realloc(batch->versions, batch->version_alloc * sizeof(batch_version_t));
+
+            if (!batch->versions) {
+                return "Out of memory";
+            }
+        }
+
+        version = &batch->versions[batch->version_count++];
+        memset(version, 0, sizeof(batch_version_t));
+        snprintf(version->directory, sizeof(version->directory), "%s", first);
+        snprintf(version->title, sizeof(version->title), "%s", fields > 2 ? second : opendcp->dcp.title);
+        snprintf(version->rating, sizeof(version->rating), "%s", fields > 3 ? third : opendcp->dcp.rating);
+
+        if (version->rating[0] && !is_rating(version->rating)) {
+            return "Invalid rating";
+        }
+
+        return NULL;
+    }
+
+    if (strcmp(keyword, "reel")) {
+        return "Lines start with version or reel";
+    }
+
+    if (!batch->version_count) {
+        return "A reel must follow a version";
+    }
+
+    version = &batch->versions[batch->version_count - 1];
+
+    if (fields < 2) {
+        return "A reel needs at least a picture track";
+    }
+
+    if (version->reel_count == MAX_REELS) {
+        return "Too many reels";
+    }
+
+    for (i = 0; i < fields - 1; i++) {
+        int index = batch_asset(batch, files[i]);
+
+        if (index < 0) {
+            return "Out of memory";
+        }
+
+        version->asset[version->reel_count][i] = index;
+    }
+
+    version->asset_count[version->reel_count++] = fields - 1;
+
+    return NULL;
+}
+
+/* the asset in the package directory, linked or else copied there if it is elsewhere */
+static int batch_place(const char *directory, const char *filename, char *placed) {
+    struct stat a, b;
+    char        *name = strrchr(filename, '/');
+
+    name = name ? name + 1 : (char *)filename;
+
+    if (snprintf(placed, MAX_FILENAME_LENGTH, "%s/%s", directory, name) >= MAX_FILENAME_LENGTH) {
+        return OPENDCP_ERROR;
+    }
+
+    /* already there, or placed by an earlier run */
+    if (!stat(placed, &a) && !stat(filename, &b) && a.st_dev == b.st_dev && a.st_ino == b.st_ino) {
+        return OPENDCP_NO_ERROR;
+    }
+
+#ifndef _WIN32
+    if (!link(filename, placed)) {
+        return OPENDCP_NO_ERROR;
+    }
+#endif
+
+    OPENDCP_LOG(LOG_INFO, "copying %s to %s", filename, directory);
+
+    return opendcp_copy_file(filename, placed, NULL, NULL, NULL);
+}
+
+/* sets up the composition of a version from copies of the distinct assets */
+static void batch_compose(opendcp_t *opendcp, batch_t *batch, batch_version_t *version) {
+    opendcp_t *v;
+    pkl_t     pkl;
+    cpl_t     cpl;
+    int       r, a;
+
+    v = opendcp_clone(opendcp);
+
+    if (!v) {
+        dcp_fatal(opendcp, "Out of memory");
+    }
+
+    version->opendcp = v;
+    v->ns = XML_NS_UNKNOWN;
+    batch_mkdir(version->directory);
+    snprintf(v->dcp.title, sizeof(v->dcp.title), "%s", version->title);
+    snprintf(v->dcp.rating, sizeof(v->dcp.rating), "%s", version->rating);
+
+    create_pkl(&v->dcp, &pkl);
+    create_cpl(&v->dcp, &cpl);
+    snprintf(pkl.filename, sizeof(pkl.filename), "%s/PKL_%.40s.xml", version->directory,
+             v->dcp.basename[0] ? v->dcp.basename : pkl.uuid);
+    snprintf(cpl.filename, sizeof(cpl.filename), "%s/CPL_%.40s.xml", version->directory,
+             v->dcp.basename[0] ? v->dcp.basename : cpl.uuid);
+
+    if (!add_pkl_to_dcp(&v->dcp, &pkl) || !add_cpl_to_pkl(&v->dcp.pkl[0], &cpl)) {
+        dcp_fatal(opendcp, "Out of memory");
+    }
+
+    for (r = 0; r < version->reel_count; r++) {
+        reel_t reel;
+
+        create_reel(&v->dcp, &reel);
+
+        for (a = 0; a < version->asset_count[r]; a++) {
+            asset_t asset = batch->assets[version->asset[r][a]];
+
+            if (batch_place(version->directory, batch->assets[version->asset[r][a]].filename, asset.filename) != OPENDCP_NO_ERROR) {
+                dcp_fatal(opendcp, "Could not place %s in %s", asset.filename, version->directory);
+            }
+
+            if (add_asset_to_reel(v, &reel, asset) != OPENDCP_NO_ERROR) {
+                dcp_fatal(opendcp, "Could not add %s to reel %d of %s", asset.filename, r + 1, version->directory);
+            }
+        }
+
+        if (validate_reel(v, &reel, r) != OPENDCP_NO_ERROR || !add_reel_to_cpl(&v->dcp.pkl[0].cpl[0], &reel)) {
+            dcp_fatal(opendcp, "Could not validate reel %d of %s", r + 1, version->directory);
+        }
+    }
+
+    snprintf(v->dcp.assetmap.filename, sizeof(v->dcp.assetmap.filename), "%s/%s", version->directory,
+             v->ns == XML_NS_SMPTE ? "ASSETMAP.xml" : "ASSETMAP");
+    snprintf(v->dcp.volindex.filename, sizeof(v->dcp.volindex.filename), "%s/%s", version->directory,
+             v->ns == XML_NS_SMPTE ? "VOLINDEX.xml" : "VOLINDEX");
+}
+
+#ifdef XMLSEC
+/* signs one document of every version together, cpls or pkls */
+static void batch_sign(opendcp_t *opendcp, batch_t *batch, int cpls) {
+    char **files = malloc(batch->version_count * sizeof(char *));
+    int  i;
+
+    if (!files) {
+        dcp_fatal(opendcp, "Out of memory");
+    }
+
+    for (i = 0; i < batch->version_count; i++) {
+        pkl_t *pkl = &batch->versions[i].opendcp->dcp.pkl[0];
+
+        files[i] = cpls ? pkl->cpl[0].filename : pkl->filename;
+    }
+
+    if (xml_sign_session_sign(opendcp->xml_signature.session, files, batch->version_count) != OPENDCP_NO_ERROR) {
+        dcp_fatal(opendcp, "Signing the %s failed", cpls ? "composition playlists" : "packing lists");
+    }
+
+    free(files);
+}
+#endif
+
+/* builds every version in the manifest */
+static void batch_run(opendcp_t *opendcp, char *manifest, int jobs) {
+    batch_t            batch;
+    asset_t            **asset_ptr;
+    char               line[BATCH_LINE_LENGTH], *p, *error;
+    int                i, line_number = 0;
+    unsigned long long digest_size = 0;
+    FILE               *fp;
+
+    fp = fopen(manifest, "r");
+
+    if (!fp) {
+        dcp_fatal(opendcp, "Could not open manifest %s", manifest);
+    }
+
+    memset(&batch, 0, sizeof(batch));
+
+    while (fgets(line, sizeof(line), fp)) {
+        line_number++;
+
+        for (p = line; *p == ' ' || *p == '\t'; p++);
+
+        if (*p == '#' || *p == '\n' || *p == '\r' || *p == '\0') {
+            continue;
+        }
+
+        error = batch_line(opendcp, &batch, p);
+
+        if (error) {
+            fclose(fp);
+            dcp_fatal(opendcp, "%s: line %d: %s", manifest, line_number, error);
+        }
+    }
+
+    fclose(fp);
+
+    if (batch.version_count < 1) {
+        dcp_fatal(opendcp, "No versions in manifest %s", manifest);
+    }
+
+    for (i = 0; i < batch.version_count; i++) {
+        if (batch.versions[i].reel_count < 1) {
+            dcp_fatal(opendcp, "Version %s has no reels", batch.versions[i].directory);
+        }
+    }
+
+    /* probe and hash each distinct asset once */
+    asset_ptr = malloc(batch.asset_count * sizeof(asset_t *));
+
+    if (!asset_ptr) {
+        dcp_fatal(opendcp, "Out of memory");
+    }
+
+    for (i = 0; i < batch.asset_count; i++) {
+        char filename[MAX_FILENAME_LENGTH];
+
+        snprintf(filename, sizeof(filename), "%s", batch.assets[i].filename);
+
+        if (add_asset(opendcp, &batch.assets[i], filename) != OPENDCP_NO_ERROR) {
+            dcp_fatal(opendcp, "Could not read asset %s", filename);
+        }
+
+        asset_ptr[i] = &batch.assets[i];
+        digest_size += strtoull(batch.assets[i].size, NULL, 10);
+    }
+
+    if (opendcp->log_level > 0) {
+        printf("  Building %d versions from %d distinct assets\n", batch.version_count, batch.asset_count);
+    }
+
+    val   = 0;
+    total = digest_size / read_size;
+    sprintf(progress_string, "%-.25s %.25s", "Assets", "Digest Calculation");
+
+    if (opendcp->log_level > 0 && opendcp->log_level < 3) {
+        printf("\n");
+        progress_bar();
+    }
+
+    if (calculate_digests(opendcp, asset_ptr, batch.asset_count) != OPENDCP_NO_ERROR) {
+        dcp_fatal(opendcp, "Digest calculation failed");
+    }
+
+    free(asset_ptr);
+
+    for (i = 0; i < batch.version_count; i++) {
+        batch_compose(opendcp, &batch, &batch.versions[i]);
+    }
+
+#ifdef XMLSEC
+
+    /* one session signs the documents of every version */
+    if (opendcp->xml_signature.sign) {
+        if (xml_sign_session_open(opendcp, jobs) == NULL) {
+            dcp_fatal(opendcp, "Loading XML signature keys failed");
+        }
+
+        for (i = 0; i < batch.version_count; i++) {
+            batch.versions[i].opendcp->xml_signature.session = opendcp->xml_signature.session;
+            batch.versions[i].opendcp->xml_signature.defer   = 1;
+        }
+    }
+
+#else
+    UNUSED(jobs);
+#endif
+
+    for (i = 0; i < batch.version_count; i++) {
+        if (write_cpl(batch.versions[i].opendcp, &batch.versions[i].opendcp->dcp.pkl[0].cpl[0]) != OPENDCP_NO_ERROR) {
+            dcp_fatal(opendcp, "Writing composition playlist of %s failed", batch.versions[i].directory);
+        }
+    }
+
+#ifdef XMLSEC
+
+    if (opendcp->xml_signature.sign) {
+        batch_sign(opendcp, &batch, 1);
+
+        for (i = 0; i < batch.version_count; i++) {
+            cpl_t       *cpl = &batch.versions[i].opendcp->dcp.pkl[0].cpl[0];
+            struct stat st;
+
+            stat(cpl->filename, &st);
+            sprintf(cpl->size, "%"PRIu64, (uint64_t)st.st_size);
+
+            if (calculate_digest(batch.versions[i].opendcp, cpl->filename, cpl->digest) != OPENDCP_NO_ERROR) {
+                dcp_fatal(opendcp, "Digest calculation of %s failed", cpl->filename);
+            }
+        }
+    }
+
+#endif
+
+    for (i = 0; i < batch.version_count; i++) {
+        if (write_pkl(batch.versions[i].opendcp, &batch.versions[i].opendcp->dcp.pkl[0]) != OPENDCP_NO_ERROR) {
+            dcp_fatal(opendcp, "Writing packing list of %s failed", batch.versions[i].directory);
+        }
+    }
+
+#ifdef XMLSEC
+
+    if (opendcp->xml_signature.sign) {
+        batch_sign(opendcp, &batch, 0);
+
+        for (i = 0; i < batch.version_count; i++) {
+            pkl_t       *pkl = &batch.versions[i].opendcp->dcp.pkl[0];
+            struct stat st;
+
+            stat(pkl->filename, &st);
+            sprintf(pkl->size, "%"PRIu64, (uint64_t)st.st_size);
+        }
+    }
+
+    for (i = 0; i < batch.version_count; i++) {
+        batch.versions[i].opendcp->xml_signature.session = NULL;
+    }
+
+    xml_sign_session_close(opendcp->xml_signature.session);
+#endif
+
+    for (i = 0; i < batch.version_count; i++) {
+        opendcp_t *v = batch.versions[i].opendcp;
+
+        if (write_volumeindex(v) != OPENDCP_NO_ERROR || write_assetmap(v) != OPENDCP_NO_ERROR) {
+            dcp_fatal(opendcp, "Writing the asset map of %s failed", batch.versions[i].directory);
+        }
+
+        if (opendcp->log_level > 0) {
+            printf("\n  %-50s %d reels", batch.versions[i].directory, batch.versions[i].reel_count);
+        }
+
+        opendcp_delete(v);
+    }
+
+    if (opendcp->log_level > 0) {
+        printf("\n");
+    }
+
+    free(batch.versions);
+    free(batch.assets);
+}
+
 int main (int argc, char **argv) {
     int c, j;
     int reel_count = 0;
@@ -139,7 +583,10 @@ int main (int argc, char **argv) {
     int width  = 0;
     char buffer[80];
     opendcp_t *opendcp;
+    opendcp_tune_t tune;
     reel_list_t reel_list[MAX_REELS];
+    char *batch_file = NULL;
+    int jobs = BATCH_SIGN_JOBS;
 
     if ( argc <= 1 ) {
         dcp_usage();
@@ -155,6 +602,8 @@ int main (int argc, char **argv) {
             {"annotation",     required_argument, 0, 'a'},
             {"base",           required_argument, 0, 'b'},
             {"digest",         no_argument,       0, 'd'},
+            {"digest_cache",   required_argument, 0, 'c'},
+            {"verify",         no_argument,       0, 'f'},
             {"duration",       required_argument, 0, 'n'},
             {"entry",          required_argument, 0, 'e'},
             {"help",           no_argument,       0, 'h'},
@@ -172,13 +621,15 @@ int main (int argc, char **argv) {
             {"height",         required_argument, 0, 'y'},
             {"width",          required_argument, 0, 'x'},
             {"version",        no_argument,       0, 'v'},
+            {"batch",          required_argument, 0, 'B'},
+            {"jobs",           required_argument, 0, 'j'},
             {0, 0, 0, 0}
         };
 
         /* getopt_long stores the option index here. */
         int option_index = 0;
 
-        c = getopt_long (argc, argv, "a:b:e:svdhi:k:r:l:m:n:t:x:y:p:1:2:3:",
+        c = getopt_long (argc, argv, "a:b:c:e:svdfhi:j:k:r:l:m:n:t:x:y:p:B:1:2:3:",
                          long_options, &option_index);
 
         /* Detect the end of the options. */
@@ -209,6 +660,14 @@ int main (int argc, char **argv) {
                 opendcp->dcp.digest_flag = 1;
                 break;
 
+            case 'c':
+                snprintf(opendcp->dcp.digest_cache, sizeof(opendcp->dcp.digest_cache), "%s", optarg);
+                break;
+
+            case 'f':
+                opendcp->dcp.digest_verify = 1;
+                break;
+
             case 'e':
                 opendcp->entry_point = atoi(optarg);
                 break;
@@ -302,6 +761,19 @@ int main (int argc, char **argv) {
                 version();
                 break;
 
+            case 'B':
+                batch_file = optarg;
+                break;
+
+            case 'j':
+                jobs = atoi(optarg);
+
+                if (jobs < 1) {
+                    dcp_fatal(opendcp, "Invalid job count %s", optarg);
+                }
+
+                break;
+
             default:
                 dcp_usage();
         }
@@ -309,11 +781,20 @@ int main (int argc, char **argv) {
 
     opendcp_log_init(opendcp->log_level);
 
+    /* the digest read size opendcp_j2k --profile_storage found for this host */
+    if (opendcp_tune_load(&tune, NULL) == OPENDCP_NO_ERROR) {
+        opendcp_tune_apply_storage(opendcp, &tune);
+    }
+
     if (opendcp->log_level > 0) {
         printf("\nOpenDCP XML %s %s\n", OPENDCP_VERSION, OPENDCP_COPYRIGHT);
     }
 
-    if (reel_count < 1) {
+    if (batch_file && reel_count) {
+        dcp_fatal(opendcp, "--batch takes its reels from the manifest, it can not be combined with --reel");
+    }
+
+    if (reel_count < 1 && !batch_file) {
         dcp_fatal(opendcp, "No reels supplied");
     }
 
@@ -391,45 +872,91 @@ int main (int argc, char **argv) {
         sprintf(opendcp->dcp.aspect_ratio, "%d %d", width, height);
     }
 
+    if (batch_file) {
+        if (opendcp->log_level > 0 && opendcp->log_level < 3) {
+            opendcp->dcp.sha1_update.callback = sha1_update_done_cb;
+        }
+
+        batch_run(opendcp, batch_file, jobs);
+
+        OPENDCP_LOG(LOG_INFO, "DCP Complete");
+
+        if (opendcp->log_level >= LOG_INFO) {
+            opendcp_io_report(stdout);
+        }
+
+        opendcp_delete(opendcp);
+
+        exit(0);
+    }
+
     /* add pkl to the DCP (only one PKL currently support) */
     pkl_t pkl;
-    create_pkl(opendcp->dcp, &pkl);
-    add_pkl_to_dcp(&opendcp->dcp, pkl);
+    create_pkl(&opendcp->dcp, &pkl);
+    add_pkl_to_dcp(&opendcp->dcp, &pkl);
 
     /* add cpl to the DCP/PKL (only one CPL currently support) */
     cpl_t cpl;
-    create_cpl(opendcp->dcp, &cpl);
-    add_cpl_to_pkl(&opendcp->dcp.pkl[0], cpl);
+    create_cpl(&opendcp->dcp, &cpl);
+    add_cpl_to_pkl(&opendcp->dcp.pkl[0], &cpl);
 
     /* set the callbacks (optional) for the digest generator */
     if (opendcp->log_level > 0 && opendcp->log_level < 3) {
         opendcp->dcp.sha1_update.callback = sha1_update_done_cb;
     }
 
-    /* Add and validate reels */
+    /* add every asset up front so the digests can be calculated together */
+    int asset_total = 0;
+    int asset_index = 0;
+    unsigned long long digest_size = 0;
+
+    for (c = 0; c < reel_count; c++) {
+        asset_total += reel_list[c].asset_count;
+    }
+
+    asset_t *assets     = malloc(asset_total * sizeof(asset_t));
+    asset_t **asset_ptr = malloc(asset_total * sizeof(asset_t *));
+
+    if (!assets || !asset_ptr) {
+        dcp_fatal(opendcp, "Could not allocate assets");
+    }
+
     for (c = 0; c < reel_count; c++) {
         int a;
-        reel_t reel;
-        create_reel(opendcp->dcp, &reel);
 
         for (a = 0; a < reel_list[c].asset_count; a++) {
-            val   = 0;
-            asset_t asset;
-            add_asset(opendcp, &asset, reel_list[c].asset_list[a].filename);
-            sprintf(progress_string, "%-.25s %.25s", asset.filename, "Digest Calculation");
-            total = atoi(asset.size) / read_size;
-
-            if (opendcp->log_level > 0 && opendcp->log_level < 3) {
-                printf("\n");
-                progress_bar();
-            }
+            add_asset(opendcp, &assets[asset_index], reel_list[c].asset_list[a].filename);
+            asset_ptr[asset_index] = &assets[asset_index];
+            digest_size += strtoull(assets[asset_index].size, NULL, 10);
+            asset_index++;
+        }
+    }
+
+    val   = 0;
+    total = digest_size / read_size;
+    sprintf(progress_string, "%-.25s %.25s", "Assets", "Digest Calculation");
+
+    if (opendcp->log_level > 0 && opendcp->log_level < 3) {
+        printf("\n");
+        progress_bar();
+    }
+
+    if (calculate_digests(opendcp, asset_ptr, asset_total) != OPENDCP_NO_ERROR) {
+        dcp_fatal(opendcp, "Digest calculation failed");
+    }
 
-            calculate_digest(opendcp, asset.filename, asset.digest);
-            add_asset_to_reel(opendcp, &reel, asset);
+    /* Add and validate reels */
+    for (c = 0, asset_index = 0; c < reel_count; c++) {
+        int a;
+        reel_t reel;
+        create_reel(&opendcp->dcp, &reel);
+
+        for (a = 0; a < reel_list[c].asset_count; a++) {
+            add_asset_to_reel(opendcp, &reel, assets[asset_index++]);
         }
 
         if (validate_reel(opendcp, &reel, c) == OPENDCP_NO_ERROR) {
-            add_reel_to_cpl(&opendcp->dcp.pkl[0].cpl[0], reel);
+            add_reel_to_cpl(&opendcp->dcp.pkl[0].cpl[0], &reel);
         }
         else {
             sprintf(buffer, "Could not validate reel %d\n", c + 1);
@@ -437,6 +964,9 @@ int main (int argc, char **argv) {
         }
     }
 
+    free(asset_ptr);
+    free(assets);
+
     /* set ASSETMAP/VOLINDEX path */
     if (opendcp->ns == XML_NS_SMPTE) {
         sprintf(opendcp->dcp.assetmap.filename, "%s", "ASSETMAP.xml");
@@ -447,6 +977,17 @@ int main (int argc, char **argv) {
         sprintf(opendcp->dcp.volindex.filename, "%s", "VOLINDEX");
     }
 
+#ifdef XMLSEC
+
+    /* load the signing keys once for the cpl and the pkl */
+    if (opendcp->xml_signature.sign) {
+        if (xml_sign_session_open(opendcp, 1) == NULL) {
+            dcp_fatal(opendcp, "Loading XML signature keys failed");
+        }
+    }
+
+#endif
+
     /* Write CPL File */
     if (opendcp->log_level > 0 && opendcp->log_level < 3) {
         printf("\n");
@@ -469,6 +1010,10 @@ int main (int argc, char **argv) {
         dcp_fatal(opendcp, "Writing packing list failed");
     }
 
+#ifdef XMLSEC
+    xml_sign_session_close(opendcp->xml_signature.session);
+#endif
+
     if (opendcp->log_level > 0 && opendcp->log_level < 3) {
         printf("\n");
         sprintf(progress_string, "%-.50s", opendcp->dcp.assetmap.filename);
@@ -491,6 +1036,10 @@ int main (int argc, char **argv) {
 
     OPENDCP_LOG(LOG_INFO, "DCP Complete");
 
+    if (opendcp->log_level >= LOG_INFO) {
+        opendcp_io_report(stdout);
+    }
+
     opendcp_delete(opendcp);
 
     exit(0);
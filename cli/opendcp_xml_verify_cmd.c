@@ -26,51 +26,161 @@
 
 #include "opendcp.h"
 
+#define VERIFY_THREADS 4
+
 void dcp_usage() {
     FILE *fp;
     fp = stdout;
 
     fprintf(fp, "\n%s version %s %s\n\n", OPENDCP_NAME, OPENDCP_VERSION, OPENDCP_COPYRIGHT);
-    fprintf(fp, "Verifies the digital signature of an XML file\n\n");
+    fprintf(fp, "Verifies the digital signature of XML files\n\n");
     fprintf(fp, "Usage:\n");
-    fprintf(fp, "       opendcp_xml_verify <xml file>\n\n");
+    fprintf(fp, "       opendcp_xml_verify [options] <xml file|directory> ...\n\n");
+    fprintf(fp, "Options:\n");
+    fprintf(fp, "       -t | --threads <threads>      - Number of files verified at once (default %d)\n", VERIFY_THREADS);
+    fprintf(fp, "       -l | --log_level <level>      - Set the log level 0:Quiet, 1:Error, 2:Warn, 3:Info (default), 4:Debug\n");
+    fprintf(fp, "       -h | --help                   - Show help\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "Directories are searched for signed CPLs and PKLs, and a summary is shown\n");
+    fprintf(fp, "once every file has been checked.\n\n");
 
     fclose(fp);
     exit(0);
 }
 
 int main (int argc, char **argv) {
-    int result;
-    char *filename;
+    xml_verify_session_t *session;
+    char   **files = NULL;
+    int    *results;
+    int    nfiles = 0, nvalid = 0;
+    int    threads = VERIFY_THREADS;
+    int    log_level = LOG_INFO;
+    int    batch = 0;
+    int    c, i, result = OPENDCP_NO_ERROR;
+    char   **list;
     struct stat s;
 
     if ( argc <= 1 ) {
         dcp_usage();
     }
 
-    opendcp_log_init(33);
+    /* parse options */
+    while (1)
+    {
+        static struct option long_options[] =
+        {
+            {"help",           no_argument,       0, 'h'},
+            {"log_level",      required_argument, 0, 'l'},
+            {"threads",        required_argument, 0, 't'},
+            {0, 0, 0, 0}
+        };
+
+        /* getopt_long stores the option index here. */
+        int option_index = 0;
+
+        c = getopt_long (argc, argv, "hl:t:",
+                         long_options, &option_index);
+
+        /* Detect the end of the options. */
+        if (c == -1) {
+            break;
+        }
+
+        switch (c)
+        {
+            case 'h':
+                dcp_usage();
+                break;
+
+            case 'l':
+                log_level = atoi(optarg);
+                break;
+
+            case 't':
+                threads = atoi(optarg);
+                break;
 
-    filename = argv[1];
+            default:
+                dcp_usage();
+        }
+    }
 
-    if( stat(filename, &s) == 0 ) {
-        if( !(s.st_mode & S_IFREG) ) {
-            OPENDCP_LOG(LOG_ERROR, "%s not a file", filename);
+    if (optind >= argc) {
+        dcp_usage();
+    }
+
+    opendcp_log_init(log_level);
+
+    /* gather the files, directories are searched for signed cpls and pkls */
+    for (i = optind; i < argc && result == OPENDCP_NO_ERROR; i++) {
+        if (stat(argv[i], &s) != 0) {
+            OPENDCP_LOG(LOG_ERROR, "could not open file: %s", argv[i]);
+            exit(OPENDCP_ERROR);
+        }
+
+        if (S_ISDIR(s.st_mode)) {
+            result = xml_verify_find(argv[i], &files, &nfiles);
+            batch = 1;
+        }
+        else if (S_ISREG(s.st_mode)) {
+            list = realloc(files, (nfiles + 1) * sizeof(char *));
+
+            if (!list) {
+                result = OPENDCP_ERROR;
+                break;
+            }
+
+            files = list;
+            files[nfiles++] = argv[i];
+        }
+        else {
+            OPENDCP_LOG(LOG_ERROR, "%s not a file", argv[i]);
             exit(OPENDCP_ERROR);
         }
     }
-    else {
-        OPENDCP_LOG(LOG_ERROR, "could not open file: %s", filename);
+
+    batch = batch || nfiles > 1;
+
+    if (result != OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_ERROR, "could not gather the files to verify");
         exit(OPENDCP_ERROR);
     }
 
-    result = xml_verify(filename);
-
-    if (result == OPENDCP_NO_ERROR) {
-        OPENDCP_LOG(LOG_INFO, "%s Signature is VALID", filename);
-        exit(OPENDCP_NO_ERROR);
+    if (!nfiles) {
+        OPENDCP_LOG(LOG_ERROR, "no signed CPL or PKL files found");
+        exit(OPENDCP_ERROR);
     }
-    else {
-        OPENDCP_LOG(LOG_ERROR, "%s Signature is NOT VALID", filename);
+
+    results = calloc(nfiles, sizeof(int));
+    session = xml_verify_session_open(threads);
+
+    if (!results || !session) {
+        OPENDCP_LOG(LOG_ERROR, "could not set up signature verification");
         exit(OPENDCP_ERROR);
     }
+
+    result = xml_verify_session_verify(session, files, results, nfiles);
+    xml_verify_session_close(session);
+
+    for (i = 0; i < nfiles; i++) {
+        if (results[i] == OPENDCP_NO_ERROR) {
+            OPENDCP_LOG(LOG_INFO, "%s Signature is VALID", files[i]);
+            nvalid++;
+        }
+        else {
+            OPENDCP_LOG(LOG_ERROR, "%s Signature is NOT VALID", files[i]);
+        }
+    }
+
+    if (batch) {
+        fprintf(stdout, "Verified %d files: %d valid, %d not valid\n", nfiles, nvalid, nfiles - nvalid);
+
+        for (i = 0; i < nfiles; i++) {
+            if (results[i] != OPENDCP_NO_ERROR) {
+                fprintf(stdout, "  NOT VALID  %s\n", files[i]);
+            }
+        }
+    }
+
+    exit(result == OPENDCP_NO_ERROR ? OPENDCP_NO_ERROR : OPENDCP_ERROR);
 }
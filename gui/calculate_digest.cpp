@@ -19,59 +19,35 @@
 #include "mainwindow.h"
 #include "ui_mainwindow.h"
 
+#include <QEventLoop>
 #include <stdio.h>
 #include <stdlib.h>
 #include <opendcp.h>
+#include "digest_job.h"
 
-int calculateDigestCallback(void *p)
+// the assets are hashed together on a worker thread, the event loop keeps the window live
+int MainWindow::calculateDigests(opendcp_t *opendcp, asset_t *assets[], int count)
 {
-    QProgressDialog *progress = static_cast<QProgressDialog *>(p);
-    progress->setValue(progress->value()+1);
+    QEventLoop loop;
+    DigestJob  *job = new DigestJob(this);
 
-    if (progress->wasCanceled()) {
-        progress->hide();
-        return 1;
-    }
-
-    return 0;
-}
-
-int calculateDigestDoneCallback(void *p)
-{
-    QProgressDialog *progress = static_cast<QProgressDialog *>(p);
-    progress->setValue(progress->maximum());
-    progress->hide();
-
-    return 0;
-}
-
-QString MainWindow::calculateDigest(opendcp_t *opendcp, QString text, QString filename)
-{
-    char assetDigest[40];
-    int  result;
-
-    QFileInfo file(filename);
-    qint64 len = file.size() / FILE_READ_SIZE;
-
-    QString msg;
-    msg.sprintf("Calculating %s %s SHA1 Digest", text.toUtf8().data(), file.fileName().toUtf8().data());
-
-    QProgressDialog *progress = new QProgressDialog(msg, "Cancel", 0, len+1, this);
+    QProgressDialog *progress = new QProgressDialog(tr("Calculating SHA1 Digests"), tr("Cancel"), 0, 1000, this);
     progress->setWindowModality(Qt::WindowModal);
+    progress->setMinimumDuration(500);
 
-    opendcp->dcp.sha1_update.callback = calculateDigestCallback;
-    opendcp->dcp.sha1_update.argument = progress;
+    connect(job, SIGNAL(progress(int)), progress, SLOT(setValue(int)));
+    connect(progress, SIGNAL(canceled()), job, SLOT(cancel()));
+    connect(job, SIGNAL(finished()), &loop, SLOT(quit()));
 
-    opendcp->dcp.sha1_done.callback = calculateDigestDoneCallback;
-    opendcp->dcp.sha1_done.argument = progress;
+    job->init(opendcp, assets, count);
+    job->start();
+    loop.exec();
 
-    result = calculate_digest(opendcp, filename.toUtf8().data(), assetDigest);
+    int rc = job->rc;
 
     progress->hide();
+    delete progress;
+    delete job;
 
-    if (result == OPENDCP_NO_ERROR) {
-        return assetDigest;
-    } else {
-        return NULL;
-    }
+    return rc;
 }
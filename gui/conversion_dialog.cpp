@@ -49,6 +49,7 @@ void ConversionDialog::init(int nFrames, int threadCount)
 
     labelText.sprintf("Conversion using %d threads(s)", threadCount);
     labelThreadCount->setText(labelText);
+    labelStages->clear();
 
     setButtons(RUN);
 }
@@ -80,10 +81,35 @@ void ConversionDialog::update()
     }
 }
 
+// several frames done at once, from writers that batch their progress
+void ConversionDialog::update(int frames)
+{
+    QString labelText;
+
+    if (m_canceled == true) {
+        return;
+    }
+
+    m_currentCount += frames;
+
+    if (m_currentCount > m_totalCount) {
+        m_currentCount = m_totalCount;
+    }
+
+    labelText.sprintf("Completed frame %d of %d.",m_currentCount, m_totalCount);
+
+    labelTotal->setText(labelText);
+    progressBar->setValue(m_currentCount);
+}
+
 void ConversionDialog::setResult(int result) {
     m_result = result;
 }
 
+void ConversionDialog::setStageText(QString text) {
+    labelStages->setText(text);
+}
+
 void ConversionDialog::finished()
 {
     QString t;
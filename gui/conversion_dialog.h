@@ -27,6 +27,7 @@ class ConversionDialog : public QDialog, private Ui::ConversionDialog {
 public:
     ConversionDialog(QWidget *parent = 0);
     void init(int nFrames, int threadCount);
+    bool canceled() const { return m_canceled; }
 
 private:
     int  m_totalCount;
@@ -41,8 +42,10 @@ signals:
 
 public slots:
     void update();
+    void update(int frames);
     void finished();
     void setResult(int);
+    void setStageText(QString);
 
 private slots:
     void stop();
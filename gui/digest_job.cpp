@@ -0,0 +1,107 @@
+/*
+     OpenDCP: Builds Digital Cinema Packages
+     Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+     This program is free software: you can redistribute it and/or modify
+     it under the terms of the GNU General Public License as published by
+     the Free Software Foundation, either version 3 of the License, or
+     (at your option) any later version.
+
+     This program is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU General Public License for more details.
+
+     You should have received a copy of the GNU General Public License
+     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <QFileInfo>
+
+#include <opendcp.h>
+#include "digest_job.h"
+
+// progress is sent at most this often, however fast the hashing goes
+#define DIGEST_REPORT_MS 100
+
+DigestJob::DigestJob(QObject *parent)
+    : QThread(parent)
+{
+    context   = NULL;
+    jobAssets = NULL;
+    jobCount  = 0;
+    reset();
+}
+
+DigestJob::~DigestJob()
+{
+
+}
+
+void DigestJob::reset()
+{
+    cancelled = 0;
+    rc        = 0;
+    steps     = 0;
+    total     = 0;
+    reported  = -1;
+}
+
+void DigestJob::cancel() {
+    cancelled = 1;
+}
+
+// progress is in per mille, only sent when it moved and the last one is old enough
+void DigestJob::report(int value) {
+    if (value == reported || (reported >= 0 && value < 1000 && !lastReport.hasExpired(DIGEST_REPORT_MS))) {
+        return;
+    }
+
+    reported = value;
+    lastReport.restart();
+
+    emit progress(value);
+}
+
+// calculate_digests serializes the callbacks, so the counters need no lock
+int DigestJob::updateCb(void *data) {
+    DigestJob *self = static_cast<DigestJob*>(data);
+
+    self->steps++;
+    self->report(self->total ? (int)(qMin(self->steps, self->total) * 1000 / self->total) : 0);
+
+    return self->cancelled;
+}
+
+int DigestJob::doneCb(void *data) {
+    // a cached digest has no update steps, count one for the file
+    return updateCb(data);
+}
+
+void DigestJob::init(opendcp_t *opendcp, asset_t *assets[], int count)
+{
+    context   = opendcp;
+    jobAssets = assets;
+    jobCount  = count;
+    reset();
+
+    // one step per FILE_READ_SIZE read and one for each finished file
+    for (int i = 0; i < count; i++) {
+        total += QFileInfo(QString::fromUtf8(assets[i]->filename)).size() / FILE_READ_SIZE + 1;
+    }
+}
+
+void DigestJob::run()
+{
+    context->dcp.sha1_update.callback = DigestJob::updateCb;
+    context->dcp.sha1_update.argument = this;
+    context->dcp.sha1_done.callback   = DigestJob::doneCb;
+    context->dcp.sha1_done.argument   = this;
+
+    lastReport.start();
+    rc = calculate_digests(context, jobAssets, jobCount);
+
+    if (rc == OPENDCP_NO_ERROR) {
+        report(1000);
+    }
+}
@@ -0,0 +1,61 @@
+/*
+     OpenDCP: Builds Digital Cinema Packages
+     Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+     This program is free software: you can redistribute it and/or modify
+     it under the terms of the GNU General Public License as published by
+     the Free Software Foundation, either version 3 of the License, or
+     (at your option) any later version.
+
+     This program is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU General Public License for more details.
+
+     You should have received a copy of the GNU General Public License
+     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __DIGEST_JOB_H__
+#define __DIGEST_JOB_H__
+
+#include <QtGui>
+#include <QObject>
+#include <QElapsedTimer>
+#include <opendcp.h>
+
+// hashes the assets of a dcp together on worker threads, off the ui thread
+class DigestJob : public QThread
+{
+    Q_OBJECT
+
+public:
+    DigestJob(QObject *parent);
+
+    ~DigestJob();
+    void run();
+    void init(opendcp_t *opendcp, asset_t *assets[], int count);
+    int  rc;
+    int  cancelled;
+
+private:
+    opendcp_t       *context;
+    asset_t         **jobAssets;
+    int             jobCount;
+    qint64          steps;
+    qint64          total;
+    int             reported;
+    QElapsedTimer   lastReport;
+    void reset();
+    void report(int value);
+    static int updateCb(void *data);
+    static int doneCb(void *data);
+
+signals:
+    void progress(int);
+
+public slots:
+    void cancel();
+};
+
+#endif // __DIGEST_JOB_H__
@@ -0,0 +1,82 @@
+/*
+     OpenDCP: Builds Digital Cinema Packages
+     Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+     This program is free software: you can redistribute it and/or modify
+     it under the terms of the GNU General Public License as published by
+     the Free Software Foundation, either version 3 of the License, or
+     (at your option) any later version.
+
+     This program is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU General Public License for more details.
+
+     You should have received a copy of the GNU General Public License
+     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <QFile>
+
+#include <opendcp.h>
+#include "file_copier.h"
+
+FileCopier::FileCopier(QObject *parent)
+    : QThread(parent)
+{
+    reset();
+}
+
+FileCopier::~FileCopier()
+{
+
+}
+
+void FileCopier::reset()
+{
+    cancelled = 0;
+    rc        = 0;
+}
+
+void FileCopier::cancel() {
+    cancelled = 1;
+}
+
+int FileCopier::progressCb(void *data, uint64_t copied, uint64_t total) {
+    FileCopier *self = static_cast<FileCopier*>(data);
+
+    // progress is reported in per mille so large files fit an int
+    emit self->progress(total ? (int)(copied * 1000 / total) : 1000);
+
+    return self->cancelled;
+}
+
+void FileCopier::init(QString source, QString destination, QString digest)
+{
+    copySource      = source;
+    copyDestination = destination;
+    copyDigest      = digest;
+    reset();
+}
+
+void FileCopier::run()
+{
+    unsigned char sha1[20];
+
+    // hash on copy only when there is a digest to check against
+    rc = opendcp_copy_file(QFile::encodeName(copySource).data(),
+                           QFile::encodeName(copyDestination).data(),
+                           copyDigest.isEmpty() ? NULL : sha1,
+                           FileCopier::progressCb, this);
+
+    if (rc == OPENDCP_NO_ERROR && !copyDigest.isEmpty()) {
+        QByteArray digest = QByteArray((const char *)sha1, sizeof(sha1)).toBase64();
+
+        if (digest != copyDigest.toLatin1()) {
+            QFile::remove(copyDestination);
+            rc = OPENDCP_VERIFY_DCP;
+        }
+    }
+
+    emit setResult(rc);
+}
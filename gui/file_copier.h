@@ -0,0 +1,54 @@
+/*
+     OpenDCP: Builds Digital Cinema Packages
+     Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+     This program is free software: you can redistribute it and/or modify
+     it under the terms of the GNU General Public License as published by
+     the Free Software Foundation, either version 3 of the License, or
+     (at your option) any later version.
+
+     This program is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU General Public License for more details.
+
+     You should have received a copy of the GNU General Public License
+     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __FILE_COPIER_H__
+#define __FILE_COPIER_H__
+
+#include <QtGui>
+#include <QObject>
+#include <opendcp.h>
+
+class FileCopier : public QThread
+{
+    Q_OBJECT
+
+public:
+    FileCopier(QObject *parent);
+
+    ~FileCopier();
+    void run();
+    void init(QString source, QString destination, QString digest);
+    int  rc;
+    int  cancelled;
+
+private:
+    QString         copySource;
+    QString         copyDestination;
+    QString         copyDigest;
+    void reset();
+    static int progressCb(void *data, uint64_t copied, uint64_t total);
+
+signals:
+    void setResult(int);
+    void progress(int);
+
+public slots:
+    void cancel();
+};
+
+#endif // __FILE_COPIER_H__
@@ -21,35 +21,33 @@
 
 #include <QtGui>
 #include <QDir>
+#include <QEventLoop>
 #include <stdio.h>
 #include <stdlib.h>
+#include "file_copier.h"
 
-void MainWindow::fileCopy(QString source, QString destination)
+int MainWindow::fileCopy(QString source, QString destination, QString digest)
 {
-    int pg = 0;
+    QEventLoop loop;
+    FileCopier *copier = new FileCopier(this);
 
-    QFile src(source);
-    QFile dst(destination);
+    QProgressDialog *progress = new QProgressDialog("Copy in progress.", "Cancel", 0, 1000, this);
+    progress->setWindowModality(Qt::WindowModal);
 
-    if (!src.open(QFile::ReadOnly) || !dst.open(QFile::WriteOnly)) {
-        return;
-    }
+    // the copy runs in the kernel where it can, the dialog only follows it
+    connect(copier, SIGNAL(progress(int)), progress, SLOT(setValue(int)));
+    connect(progress, SIGNAL(canceled()), copier, SLOT(cancel()));
+    connect(copier, SIGNAL(finished()), &loop, SLOT(quit()));
 
-    qint64 len = src.bytesAvailable();
+    copier->init(source, destination, digest);
+    copier->start();
+    loop.exec();
 
-    QProgressDialog *progress = new QProgressDialog("Copy in progress.", "Cancel", 0, len, this);
-    progress->setWindowModality(Qt::WindowModal);
+    int rc = copier->rc;
+
+    progress->hide();
+    delete progress;
+    delete copier;
 
-    while (!src.atEnd()) {
-        QByteArray bytearray = src.read(4096);
-        dst.write(bytearray);
-        qint64 act = bytearray.length();
-        pg = pg + act;
-        progress->setValue(pg);
-        if (progress->wasCanceled()) {
-            progress->hide();
-            break;
-        }
-        qApp->processEvents();
-    }
+    return rc;
 }
@@ -19,6 +19,7 @@
 #include "mainwindow.h"
 #include "ui_mainwindow.h"
 #include "conversion_dialog.h"
+#include "j2k_encoder.h"
 #include <QtGui>
 #include <QDir>
 #include <QPixmap>
@@ -150,42 +151,37 @@ void MainWindow::j2kBwSliderUpdate() {
     ui->bwValueLabel->setText(bwValueLabel);
 }
 
-// globals for threads
-opendcp_t *context;
-int iterations = 0;
-
 void MainWindow::preview(QString filename)
 {
-    QImage image;
+    previewFile = filename;
+    ui->previewLabel->setText(tr("Loading preview..."));
+    previewService->request(filename, ui->previewLabel->size());
+}
 
-    if (!image.load(filename)) {
-        ui->previewLabel->setText(tr("Image preview not supported for this file"));
-    } else {
-        QPixmap pixmap(QPixmap::fromImage(image).scaled(ui->previewLabel->size(), Qt::KeepAspectRatio));
-        ui->previewLabel->setPixmap(pixmap);
+void MainWindow::previewReady(QString filename, QImage image)
+{
+    if (filename == previewFile) {
+        ui->previewLabel->setPixmap(QPixmap::fromImage(image));
     }
 }
 
-int j2kEncode(QStringList pair) {
-    int rc = convert_to_j2k(context,pair.at(0).toAscii().data(),pair.at(1).toAscii().data());
-
-    return rc;
+void MainWindow::previewFailed(QString filename)
+{
+    if (filename == previewFile) {
+        ui->previewLabel->setText(tr("Image preview not supported for this file"));
+    }
 }
 
-void MainWindow::j2kConvert() {
+void MainWindow::j2kConvert(opendcp_t *context) {
     int threadCount = 0;
     QString detailText;
     QString inFile;
     QString outFile;
-    QList<QStringList> list;
     QFileInfoList inLeftList;
     QFileInfoList inRightList;
+    J2kEncoder *encoder = new J2kEncoder(this);
 
-    // reset iterations
-    iterations = 0;
-
-    // set thread limit
-    QThreadPool::globalInstance()->setMaxThreadCount(ui->threadsSpinBox->value());
+    encoder->init(context);
 
     QString outLeftDir = ui->outJ2kLeftEdit->text();
     QString outRightDir = ui->outJ2kRightEdit->text();
@@ -207,72 +203,71 @@ void MainWindow::j2kConvert() {
 
     // build conversion list
     for (int i = ui->startSpinBox->value() - 1; i < ui->endSpinBox->value(); i++) {
-        QStringList pair;
-
         inFile  = inLeftList.at(i).absoluteFilePath();
         outFile = outLeftDir % "/" % inLeftList.at(i).completeBaseName() % ".j2c";
-        pair << inFile << outFile;
 
         if (is_filename_ascii(inFile.toUtf8().data()) == 0) {
             QString message = tr("Unicode is not supported. Filenames must contain only ASCII characters. File: ") + inFile.toUtf8().data();
             QMessageBox::critical(this, tr("Invalid Characters in filename"), message);
+            delete encoder;
             return;
         }
 
         if (!QFileInfo(outFile).exists() || context->j2k.no_overwrite == 0) {
-            list.append(pair);
-            iterations++;
+            encoder->addFrame(inFile, outFile);
         }
 
         if (context->stereoscopic) {
-            pair.clear();
             inFile  = inRightList.at(i).absoluteFilePath();
             outFile = outRightDir % "/" % inRightList.at(i).completeBaseName() % ".j2c";
-            pair << inFile << outFile ;
 
             if (!QFileInfo(outFile).exists() || context->j2k.no_overwrite == 0) {
-                list.append(pair);
-                iterations++;
+                encoder->addFrame(inFile, outFile);
             }
         }
     }
 
-    if (iterations < 1) {
+    if (encoder->frameCount() < 1) {
         QMessageBox::warning(this, tr("No images to encode"),
                                    tr("No images need to be encoded"));
+        delete encoder;
         return;
     }
 
-    threadCount = QThreadPool::globalInstance()->maxThreadCount();
+    threadCount = ui->threadsSpinBox->value();
+    context->threads = threadCount;
+
+    // the tuned readers and queue depth hold for the thread count they were found with
+    opendcp_tune_t tune;
+    if (opendcp_tune_load(&tune, NULL) == OPENDCP_NO_ERROR && tune.threads == threadCount) {
+        context->j2k.readers     = tune.readers;
+        context->j2k.queue_depth = tune.queue_depth;
+    }
+
+    // the image and codec bands share one pool with this many threads
+    opendcp_pool_init(threadCount);
 
     ConversionDialog *dialog = new ConversionDialog();
-    dialog->init(iterations, threadCount);
 
-    // Create a QFutureWatcher and conncect signals and slots.
-    QFutureWatcher<int>  futureWatcher;
-    QFuture<int>         result = QtConcurrent::mapped(list, j2kEncode);
-    QObject::connect(dialog,         SIGNAL(cancel()), &futureWatcher, SLOT(cancel()));
-    QObject::connect(&futureWatcher, SIGNAL(progressValueChanged(int)), dialog, SLOT(update()));
-    QObject::connect(&futureWatcher, SIGNAL(finished()), dialog, SLOT(finished()));
+    connect(encoder, SIGNAL(frameDone()),             dialog,  SLOT(update()));
+    connect(encoder, SIGNAL(stageUpdate(QString)),    dialog,  SLOT(setStageText(QString)));
+    connect(encoder, SIGNAL(setResult(int)),          dialog,  SLOT(setResult(int)));
+    connect(encoder, SIGNAL(finished()),              dialog,  SLOT(finished()));
+    connect(dialog,  SIGNAL(cancel()),                encoder, SLOT(cancel()));
 
-    // Start the computation
-    futureWatcher.setFuture(result);
+    dialog->init(encoder->frameCount(), threadCount);
 
-    // open conversion dialog box
+    encoder->start();
     dialog->exec();
 
     // wait to ensure all threads are finished
-    futureWatcher.waitForFinished();
+    encoder->wait();
 
-    for (int i = 0; i < result.resultCount(); i++) {
-        if (futureWatcher.resultAt(i)) {
-            QFileInfo filename = list.at(i).at(0);
-            detailText.append(filename.fileName());
-            detailText.append("\n");
-        }
-    }
+    QStringList failed = encoder->failedFiles();
+
+    if (!failed.isEmpty()) {
+        detailText = failed.join("\n") + "\n";
 
-    if (!detailText.isEmpty()) {
         QMessageBox msgBox;
         msgBox.setText(tr("JPEG2000 Encoding Failure"));
         msgBox.setIcon(QMessageBox::Critical);
@@ -283,6 +278,7 @@ void MainWindow::j2kConvert() {
     }
 
     delete dialog;
+    delete encoder;
 
     return;
 }
@@ -337,8 +333,8 @@ void MainWindow::processOptions(opendcp_t *opendcp) {
 }
 
 void MainWindow::j2kStart() {
-    // create opendcp context
-    context = opendcp_create();
+    // each conversion has a context of its own
+    opendcp_t *context = opendcp_create();
 
 
     // get all options
@@ -385,7 +381,7 @@ void MainWindow::j2kStart() {
     }
     */
 
-    j2kConvert();
+    j2kConvert(context);
 
 Done:
     opendcp_delete(context);
@@ -0,0 +1,140 @@
+/*
+     OpenDCP: Builds Digital Cinema Packages
+     Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+     This program is free software: you can redistribute it and/or modify
+     it under the terms of the GNU General Public License as published by
+     the Free Software Foundation, either version 3 of the License, or
+     (at your option) any later version.
+
+     This program is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU General Public License for more details.
+
+     You should have received a copy of the GNU General Public License
+     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <QFile>
+#include <QFileInfo>
+
+#include <opendcp.h>
+#include "j2k_encoder.h"
+
+// stage rates are sent to the dialog at most this often
+#define STAGE_UPDATE_MS 500
+
+J2kEncoder::J2kEncoder(QObject *parent)
+    : QThread(parent)
+{
+    opendcpJ2k = NULL;
+    reset();
+}
+
+J2kEncoder::~J2kEncoder()
+{
+    wait();
+
+    if (opendcpJ2k && opendcpJ2k->metrics) {
+        opendcp_metrics_delete(opendcpJ2k->metrics);
+        opendcpJ2k->metrics = NULL;
+    }
+}
+
+void J2kEncoder::reset()
+{
+    rc = 0;
+    names.clear();
+    frames.clear();
+}
+
+void J2kEncoder::init(opendcp_t *opendcp)
+{
+    opendcpJ2k = opendcp;
+    reset();
+}
+
+// the names are converted once here, the pipeline only sees the byte arrays
+void J2kEncoder::addFrame(const QString &inFile, const QString &outFile)
+{
+    names.append(QFile::encodeName(inFile));
+    names.append(QFile::encodeName(outFile));
+}
+
+QStringList J2kEncoder::failedFiles() const
+{
+    QStringList failed;
+
+    for (int i = 0; i < frames.size(); i++) {
+        if (frames[i].result != OPENDCP_NO_ERROR && frames[i].result != OPENDCP_J2K_CANCELLED) {
+            failed.append(QFileInfo(QFile::decodeName(frames[i].in_file)).fileName());
+        }
+    }
+
+    return failed;
+}
+
+void J2kEncoder::cancel() {
+    opendcpJ2k->j2k.cancel = 1;
+}
+
+QString J2kEncoder::stageText()
+{
+    QString text;
+    double  fps, mbps;
+
+    for (int stage = 0; stage < METRIC_STAGES; stage++) {
+        if (!opendcp_metrics_rate(opendcpJ2k->metrics, stage, &fps, &mbps)) {
+            continue;
+        }
+
+        if (!text.isEmpty()) {
+            text.append("   ");
+        }
+
+        text.append(QString("%1 %2 fps").arg(opendcp_metrics_stage_name(stage)).arg(fps, 0, 'f', 1));
+    }
+
+    return text;
+}
+
+// runs on a pipeline thread, the pipeline serializes the calls
+int J2kEncoder::frameDoneCb(void *data) {
+    J2kEncoder *self = static_cast<J2kEncoder*>(data);
+
+    emit self->frameDone();
+
+    if (self->statsTimer.elapsed() >= STAGE_UPDATE_MS) {
+        self->statsTimer.restart();
+        emit self->stageUpdate(self->stageText());
+    }
+
+    return 0;
+}
+
+void J2kEncoder::run()
+{
+    frames.resize(frameCount());
+
+    for (int i = 0; i < frames.size(); i++) {
+        frames[i].in_file  = names[2 * i].data();
+        frames[i].out_file = names[2 * i + 1].data();
+        frames[i].result   = OPENDCP_NO_ERROR;
+    }
+
+    opendcpJ2k->j2k.cancel              = 0;
+    opendcpJ2k->j2k.frame_done.callback = J2kEncoder::frameDoneCb;
+    opendcpJ2k->j2k.frame_done.argument = this;
+
+    if (!opendcpJ2k->metrics) {
+        opendcpJ2k->metrics = opendcp_metrics_create();
+    }
+
+    statsTimer.start();
+    rc = convert_to_j2k_sequence(opendcpJ2k, frames.data(), frames.size());
+
+    emit stageUpdate(stageText());
+    emit setResult(rc);
+    emit finished();
+}
@@ -0,0 +1,61 @@
+/*
+     OpenDCP: Builds Digital Cinema Packages
+     Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+     This program is free software: you can redistribute it and/or modify
+     it under the terms of the GNU General Public License as published by
+     the Free Software Foundation, either version 3 of the License, or
+     (at your option) any later version.
+
+     This program is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU General Public License for more details.
+
+     You should have received a copy of the GNU General Public License
+     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __J2K_ENCODER_H__
+#define __J2K_ENCODER_H__
+
+#include <QtGui>
+#include <QObject>
+#include <QElapsedTimer>
+#include <opendcp.h>
+
+class J2kEncoder : public QThread
+{
+    Q_OBJECT
+
+public:
+    J2kEncoder(QObject *parent);
+
+    ~J2kEncoder();
+    void run();
+    void init(opendcp_t *opendcp);
+    void addFrame(const QString &inFile, const QString &outFile);
+    int  frameCount() const { return names.size() / 2; }
+    QStringList failedFiles() const;
+    int  rc;
+
+private:
+    opendcp_t         *opendcpJ2k;
+    QList<QByteArray>  names;       // encoded in and out file names, the frames point into them
+    QVector<j2k_frame_t> frames;
+    QElapsedTimer      statsTimer;
+    void reset();
+    QString stageText();
+    static int frameDoneCb(void *data);
+
+signals:
+    void finished();
+    void setResult(int);
+    void frameDone();
+    void stageUpdate(QString);
+
+public slots:
+    void cancel();
+};
+
+#endif // __J2K_ENCODER_H__
@@ -19,30 +19,52 @@
 #include "mainwindow.h"
 #include "ui_mainwindow.h"
 #include "generate_title.h"
+#include "preview_service.h"
+#include "mxf_player.h"
 #include "settings.h"
 #include "opendcp.h"
 #include "opendcp_encoder.h"
 
 
+// queued log messages are taken on the ui thread this often
+#define LOGGER_DRAIN_MS 100
+
 Logger::Logger()
 {
     cb.level = LOG_WARN;
     cb.callback = &Logger::log_receiver;
     cb.argument = (void *)this;
+    cb.batch = 1;
     opendcp_log_subscribe(&cb);
+
+    // the encode threads only queue their messages, the log list is only touched here
+    connect(&drainTimer, SIGNAL(timeout()), this, SLOT(drain()));
+    drainTimer.start(LOGGER_DRAIN_MS);
 }
 
 Logger::~Logger()
 {
+    drainTimer.stop();
+    opendcp_log_unsubscribe(&cb);
+}
 
+void Logger::drain()
+{
+    opendcp_log_drain(&cb);
 }
 
 void Logger::log_receiver(void *arg, void *message)
 {
-    QString m;
-    m = (char *) message;
+    opendcp_log_batch_t *batch = (opendcp_log_batch_t *)message;
     Logger *self = (Logger *)arg;
-    self->log << m;
+
+    for (int i = 0; i < batch->count; i++) {
+        self->log << QString::fromUtf8(batch->messages[i]);
+    }
+
+    if (batch->dropped) {
+        self->log << QString("%1 log messages dropped").arg(batch->dropped);
+    }
 }
 
 MainWindow::MainWindow(QWidget *parent) :
@@ -58,6 +80,10 @@ MainWindow::MainWindow(QWidget *parent) :
     textEdit = new QPlainTextEdit;
 
     generateTitle   = new GenerateTitle(this);
+    previewService  = new PreviewService(this);
+
+    connect(previewService, SIGNAL(previewReady(QString, QImage)), this, SLOT(previewReady(QString, QImage)));
+    connect(previewService, SIGNAL(previewFailed(QString)),        this, SLOT(previewFailed(QString)));
 
     // create menus
     createActions();
@@ -93,6 +119,8 @@ void MainWindow::createMenus()
     fileMenu->addAction(saveAct);
     fileMenu->addAction(saveAsAct);
     fileMenu->addSeparator();
+    fileMenu->addAction(playAct);
+    fileMenu->addSeparator();
     fileMenu->addAction(exitAct);
 
     editMenu = menuBar()->addMenu("&Edit");
@@ -130,6 +158,10 @@ void MainWindow::createActions()
     saveAsAct->setStatusTip(tr("Save the document under a new name"));
     connect(saveAsAct, SIGNAL(triggered()), this, SLOT(saveAs()));
 
+    playAct = new QAction("P&lay MXF...", this);
+    playAct->setStatusTip(tr("Play a picture track to spot check it"));
+    connect(playAct, SIGNAL(triggered()), this, SLOT(play()));
+
     exitAct = new QAction("E&xit", this);
     exitAct->setShortcuts(QKeySequence::Quit);
     exitAct->setStatusTip(tr("Exit the application"));
@@ -188,6 +220,9 @@ void MainWindow::setInitialUiState()
     #ifdef HAVE_RAGNAROK
     ui->encoderComboBox->addItem("Ragnarok", QVariant(OPENDCP_ENCODER_RAGNAROK));
     #endif
+    #ifdef HAVE_NVJPEG2K
+    ui->encoderComboBox->addItem("nvJPEG2000", QVariant(OPENDCP_ENCODER_NVJPEG2K));
+    #endif
     QProcess *kdu;
     kdu = new QProcess(this);
     int exitCode = kdu->execute("kdu_compress", QStringList() << "-version");
@@ -201,8 +236,14 @@ void MainWindow::setInitialUiState()
 #ifdef Q_OS_WIN32
     ui->threadsSpinBox->setMaximum(6);
 #endif
-    ui->threadsSpinBox->setMaximum(QThreadPool::globalInstance()->maxThreadCount());
-    ui->threadsSpinBox->setValue(QThread::idealThreadCount());
+    ui->threadsSpinBox->setMaximum(opendcp_pool_threads());
+    ui->threadsSpinBox->setValue(opendcp_pool_threads());
+
+    // the thread count an earlier opendcp_j2k --autotune found for this host
+    opendcp_tune_t tune;
+    if (opendcp_tune_load(&tune, NULL) == OPENDCP_NO_ERROR) {
+        ui->threadsSpinBox->setValue(tune.threads);
+    }
 
     ui->mxfSourceTypeComboBox->setCurrentIndex(0);
     ui->mxfInputStack->setCurrentIndex(0);
@@ -339,6 +380,21 @@ void MainWindow::preferences()
     }
 }
 
+// the player deletes itself when it is closed
+void MainWindow::play()
+{
+    QString file = QFileDialog::getOpenFileName(this, tr("Play Picture Track"), lastDir, tr("MXF Files (*.mxf)"));
+
+    if (file.isEmpty()) {
+        return;
+    }
+
+    lastDir = QFileInfo(file).absolutePath();
+
+    MxfPlayer *player = new MxfPlayer(this, file);
+    player->show();
+}
+
 void MainWindow::newFile()
 {
     return;
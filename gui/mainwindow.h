@@ -23,6 +23,8 @@
 #include "settings.h"
 
 class GenerateTitle;
+class PreviewService;
+class MxfJobQueue;
 
 namespace Ui {
     class MainWindow;
@@ -38,8 +40,12 @@ public:
 
     QStringList log;
 
+private slots:
+    void drain();
+
 private:
     opendcp_log_cb_t cb;
+    QTimer           drainTimer;
     static void log_receiver(void *, void *);
 };
 
@@ -87,12 +93,15 @@ public slots:
 
     void getTitle();
     void preview(QString filename);
+    void previewReady(QString filename, QImage image);
+    void previewFailed(QString filename);
 
 private slots:
     void newFile();
     void open();
     bool save();
     bool saveAs();
+    void play();
     void preferences();
     void log();
     void about();
@@ -101,10 +110,10 @@ protected:
     void setInitialUiState();
     void connectSlots();
     void j2kConnectSlots();
-    void j2kConvert();
+    void j2kConvert(opendcp_t *context);
     void mxfConnectSlots();
-    void mxfCreatePicture();
-    void mxfCreateAudio();
+    void mxfCreatePicture(MxfJobQueue *queue, int sourceType);
+    void mxfCreateAudio(MxfJobQueue *queue);
 
     void connectXmlSlots();
     void showImage(QImage image);
@@ -116,8 +125,8 @@ protected slots:
 public:
     explicit MainWindow(QWidget *parent = 0);
     ~MainWindow();
-    void fileCopy(QString source, QString destination);
-    QString calculateDigest(opendcp_t *opendcp, QString text, QString filename);
+    int  fileCopy(QString source, QString destination, QString digest = QString());
+    int  calculateDigests(opendcp_t *opendcp, asset_t *assets[], int count);
     void log_msg(char *msg);
 
 private:
@@ -126,10 +135,12 @@ private:
 
     void loadLanguage(const QString& rLanguage);
     void createLanguageMenu(void);
-    void mxfStartThread(opendcp_t *opendcp, QFileInfoList inputList, QString outputFile);
+    void mxfStartJobs(MxfJobQueue *queue);
+    int  mxfPictureRequested();
+    int  mxfSoundRequested();
     void processOptions(opendcp_t *opendcp);
     void mxfAddInputWavFiles(QFileInfoList *inputList);
-    int  mxfCopy(QString source, QString destination);
+    int  mxfCopy(QString source, QString destination, QString digest = QString());
 
     filelist_t *QStringToFilelist(QFileInfoList list);
     int checkWavInfo(QFileInfoList filelist, int frameRate);
@@ -141,6 +152,8 @@ private:
     QSignalMapper       wavSignalMapper;
 
     GenerateTitle       *generateTitle;
+    PreviewService      *previewService;
+    QString             previewFile;
     QString             lastDir;
     QTextEdit           *logViewer;
 
@@ -159,6 +172,7 @@ private:
     QAction *openAct;
     QAction *saveAct;
     QAction *saveAsAct;
+    QAction *playAct;
     QAction *exitAct;
     QAction *cutAct;
     QAction *copyAct;
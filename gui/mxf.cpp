@@ -21,7 +21,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <opendcp.h>
-#include "mxf_writer.h"
+#include "mxf_job_queue.h"
 #include "conversion_dialog.h"
 
 enum MXF_ESSENCE_TYPE {
@@ -178,7 +178,7 @@ void MainWindow::wavInputSlot(QWidget *w)
 
     if (rc == OPENDCP_INVALID_WAV_BITDEPTH) {
         QMessageBox::warning(this, tr("Invalid Wav"),
-                                   tr("The selected wav file is not 24-bit"));
+                                   tr("The selected wav file is not 8, 16, 24 or 32-bit"));
         return;
     }
 
@@ -384,7 +384,8 @@ int MainWindow::checkWavInfo(QFileInfoList filelist, int frameRate) {
             }
         }
 
-        if (wav.bitdepth != 24) {
+        /* other depths and rates are converted to 24-bit when wrapped */
+        if (wav.bitdepth != 8 && wav.bitdepth != 16 && wav.bitdepth != 24 && wav.bitdepth != 32) {
             return OPENDCP_INVALID_WAV_BITDEPTH;
         }
 
@@ -493,15 +494,65 @@ void MainWindow::mxfStart() {
     // set log level
     opendcp_log_init(4);
 
-    // create picture mxf file
+    MxfJobQueue *queue = new MxfJobQueue(this);
+
+    // wrap the selected essence, plus the other one when its page is filled in,
+    // both writers run at once
     if (ui->mxfSourceTypeComboBox->currentIndex() == JPEG2000 || ui->mxfSourceTypeComboBox->currentIndex() == MPEG2) {
-        mxfCreatePicture();
+        mxfCreatePicture(queue, ui->mxfSourceTypeComboBox->currentIndex());
+
+        if (mxfSoundRequested()) {
+            mxfCreateAudio(queue);
+        }
     }
 
-    // create sound mxf file
     if (ui->mxfSourceTypeComboBox->currentIndex() == WAV) {
-        mxfCreateAudio();
+        mxfCreateAudio(queue);
+
+        if (mxfPictureRequested()) {
+            mxfCreatePicture(queue, QFileInfo(ui->pictureLeftEdit->text()).isDir() ? JPEG2000 : MPEG2);
+        }
     }
+
+    mxfStartJobs(queue);
+
+    delete queue;
+}
+
+int MainWindow::mxfPictureRequested() {
+    if (ui->pMxfOutEdit->text().isEmpty() || ui->pictureLeftEdit->text().isEmpty()) {
+        return 0;
+    }
+
+    if (ui->mxfStereoscopicCheckBox->checkState() && ui->pictureRightEdit->text().isEmpty()) {
+        return 0;
+    }
+
+    return 1;
+}
+
+int MainWindow::mxfSoundRequested() {
+    if (ui->aMxfOutEdit->text().isEmpty()) {
+        return 0;
+    }
+
+    if (!ui->mxfSoundTypeRadioMono->isChecked()) {
+        return !ui->aMultiEdit->text().isEmpty();
+    }
+
+    if (ui->mxfSoundRadio2->isChecked()) {
+        return !mxfCheckSoundInput20();
+    }
+
+    if (ui->mxfSoundRadio5->isChecked()) {
+        return !mxfCheckSoundInput51();
+    }
+
+    if (ui->mxfSoundRadio7->isChecked()) {
+        return !mxfCheckSoundInput71();
+    }
+
+    return 0;
 }
 
 void MainWindow::mxfCreateSubtitle() {
@@ -534,14 +585,17 @@ void MainWindow::mxfCreateSubtitle() {
         opendcp->mxf.key_flag = 1;
     }
 
-    mxfStartThread(opendcp, inputList, outputFile);
+    MxfJobQueue *queue = new MxfJobQueue(this);
 
-    opendcp_delete(opendcp);
+    queue->addJob(opendcp, inputList, outputFile);
+    mxfStartJobs(queue);
+
+    delete queue;
 
     return;
 }
 
-void MainWindow::mxfCreateAudio() {
+void MainWindow::mxfCreateAudio(MxfJobQueue *queue) {
     QFileInfoList inputList;
     QString       outputFile;
 
@@ -560,7 +614,8 @@ void MainWindow::mxfCreateAudio() {
     mxfAddInputWavFiles(&inputList);
 
     if (checkWavInfo(inputList, opendcp->frame_rate)) {
-        QMessageBox::critical(this, tr("Invalid Wav Files"),tr("Input WAV files must be 24-bit"));
+        QMessageBox::critical(this, tr("Invalid Wav Files"),tr("Input WAV files must be 8, 16, 24 or 32-bit"));
+        opendcp_delete(opendcp);
         return;
     }
 
@@ -579,14 +634,12 @@ void MainWindow::mxfCreateAudio() {
         opendcp->mxf.key_flag = 1;
     }
 
-    mxfStartThread(opendcp, inputList, outputFile);
-
-    opendcp_delete(opendcp);
+    queue->addJob(opendcp, inputList, outputFile);
 
     return;
 }
 
-void MainWindow::mxfCreatePicture() {
+void MainWindow::mxfCreatePicture(MxfJobQueue *queue, int sourceType) {
     QDir          pLeftDir;
     QDir          pRightDir;
     QFileInfoList pLeftList;
@@ -606,7 +659,7 @@ void MainWindow::mxfCreatePicture() {
     opendcp->frame_rate = ui->mxfFrameRateComboBox->currentText().toInt();
     opendcp->stereoscopic = DISABLED;
 
-    if (ui->mxfSourceTypeComboBox->currentIndex() == JPEG2000) {
+    if (sourceType == JPEG2000) {
         pLeftDir.cd(ui->pictureLeftEdit->text());
         pLeftDir.setNameFilters(QStringList() << "*.j2c");
         pLeftDir.setFilter(QDir::Files | QDir::NoSymLinks);
@@ -666,10 +719,12 @@ void MainWindow::mxfCreatePicture() {
     if (inputList.size() < 1) {
         QMessageBox::critical(this, tr("MXF Creation Error"), tr("No input files found."));
         goto Done;
-    } else {
-        mxfStartThread(opendcp, inputList, outputFile);
     }
 
+    queue->addJob(opendcp, inputList, outputFile);
+
+    return;
+
 Done:
 
     opendcp_delete(opendcp);
@@ -677,24 +732,24 @@ Done:
     return;
 }
 
-void MainWindow::mxfStartThread(opendcp_t *opendcp, QFileInfoList inputList, QString outputFile)
+void MainWindow::mxfStartJobs(MxfJobQueue *queue)
 {
-    ConversionDialog *dialog = new ConversionDialog();
-    MxfWriter        *writer = new MxfWriter(this);
+    if (!queue->jobCount()) {
+        return;
+    }
 
-    connect(writer, SIGNAL(frameDone()),    dialog,  SLOT(update()));
-    connect(writer, SIGNAL(setResult(int)), dialog,  SLOT(setResult(int)));
-    connect(writer, SIGNAL(finished()),     dialog,  SLOT(finished()));
-    connect(dialog, SIGNAL(cancel()),       writer,  SLOT(cancel()));
+    ConversionDialog *dialog = new ConversionDialog();
 
-    writer->init(opendcp, inputList, outputFile);
+    connect(queue,  SIGNAL(framesDone(int)), dialog,  SLOT(update(int)));
+    connect(queue,  SIGNAL(setResult(int)), dialog,  SLOT(setResult(int)));
+    connect(queue,  SIGNAL(finished()),     dialog,  SLOT(finished()));
+    connect(dialog, SIGNAL(cancel()),       queue,   SLOT(cancel()));
 
-    dialog->init(opendcp->mxf.duration, 1);
+    dialog->init(queue->frameCount(), queue->jobCount());
     dialog->setWindowTitle("MXF Conversion");
 
-    writer->start();
+    queue->start();
     dialog->exec();
 
     delete dialog;
-    delete writer;
 }
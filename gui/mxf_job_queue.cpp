@@ -0,0 +1,123 @@
+/*
+     OpenDCP: Builds Digital Cinema Packages
+     Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+     This program is free software: you can redistribute it and/or modify
+     it under the terms of the GNU General Public License as published by
+     the Free Software Foundation, either version 3 of the License, or
+     (at your option) any later version.
+
+     This program is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU General Public License for more details.
+
+     You should have received a copy of the GNU General Public License
+     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opendcp.h>
+#include "mxf_job_queue.h"
+#include "mxf_writer.h"
+
+MxfJobQueue::MxfJobQueue(QObject *parent)
+    : QObject(parent)
+{
+    rc      = 0;
+    running = 0;
+}
+
+MxfJobQueue::~MxfJobQueue()
+{
+    // writers are only deleted once every one of them has returned
+    while (!writers.isEmpty()) {
+        MxfWriter *writer = writers.takeFirst();
+        writer->wait();
+        delete writer;
+    }
+
+    while (!jobs.isEmpty()) {
+        opendcp_delete(jobs.takeFirst().opendcp);
+    }
+}
+
+// the queue owns opendcp from here on and deletes it with the queue
+void MxfJobQueue::addJob(opendcp_t *opendcp, QFileInfoList fileList, QString outputFile)
+{
+    Job job;
+
+    job.opendcp    = opendcp;
+    job.fileList   = fileList;
+    job.outputFile = outputFile;
+
+    jobs.append(job);
+}
+
+int MxfJobQueue::jobCount()
+{
+    return jobs.size();
+}
+
+int MxfJobQueue::frameCount()
+{
+    int frames = 0;
+
+    for (int i = 0; i < jobs.size(); i++) {
+        frames += jobs.at(i).opendcp->mxf.duration;
+    }
+
+    return frames;
+}
+
+void MxfJobQueue::start()
+{
+    rc      = 0;
+    running = jobs.size();
+
+    if (!running) {
+        emit finished();
+        return;
+    }
+
+    // every essence gets its own writer, so a reel takes as long as its slowest wrap
+    for (int i = 0; i < jobs.size(); i++) {
+        MxfWriter *writer = new MxfWriter(0);
+
+        connect(writer, SIGNAL(framesDone(int)), this, SIGNAL(framesDone(int)));
+        connect(writer, SIGNAL(setResult(int)), this, SLOT(writerResult(int)));
+        connect(writer, SIGNAL(finished()),     this, SLOT(writerFinished()));
+
+        writer->init(jobs.at(i).opendcp, jobs.at(i).fileList, jobs.at(i).outputFile);
+        writers.append(writer);
+    }
+
+    for (int i = 0; i < writers.size(); i++) {
+        writers.at(i)->start();
+    }
+}
+
+void MxfJobQueue::cancel()
+{
+    for (int i = 0; i < writers.size(); i++) {
+        writers.at(i)->cancel();
+    }
+}
+
+void MxfJobQueue::writerResult(int result)
+{
+    // the first failure is the one reported
+    if (result != OPENDCP_NO_ERROR && rc == OPENDCP_NO_ERROR) {
+        rc = result;
+        emit setResult(rc);
+    }
+}
+
+void MxfJobQueue::writerFinished()
+{
+    if (--running > 0) {
+        return;
+    }
+
+    emit setResult(rc);
+    emit finished();
+}
@@ -0,0 +1,66 @@
+/*
+     OpenDCP: Builds Digital Cinema Packages
+     Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+     This program is free software: you can redistribute it and/or modify
+     it under the terms of the GNU General Public License as published by
+     the Free Software Foundation, either version 3 of the License, or
+     (at your option) any later version.
+
+     This program is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU General Public License for more details.
+
+     You should have received a copy of the GNU General Public License
+     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __MXF_JOB_QUEUE_H__
+#define __MXF_JOB_QUEUE_H__
+
+#include <QtGui>
+#include <QObject>
+#include <opendcp.h>
+
+class MxfWriter;
+
+class MxfJobQueue : public QObject
+{
+    Q_OBJECT
+
+public:
+    MxfJobQueue(QObject *parent);
+
+    ~MxfJobQueue();
+    void addJob(opendcp_t *opendcp, QFileInfoList fileList, QString outputFile);
+    void start();
+    int  jobCount();
+    int  frameCount();
+    int  rc;
+
+private:
+    struct Job {
+        opendcp_t     *opendcp;
+        QFileInfoList  fileList;
+        QString        outputFile;
+    };
+
+    QList<Job>          jobs;
+    QList<MxfWriter *>  writers;
+    int                 running;
+
+signals:
+    void finished();
+    void setResult(int);
+    void framesDone(int);
+
+public slots:
+    void cancel();
+
+private slots:
+    void writerResult(int);
+    void writerFinished();
+};
+
+#endif // __MXF_JOB_QUEUE_H__
@@ -0,0 +1,362 @@
+/*
+     OpenDCP: Builds Digital Cinema Packages
+     Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+     This program is free software: you can redistribute it and/or modify
+     it under the terms of the GNU General Public License as published by
+     the Free Software Foundation, either version 3 of the License, or
+     (at your option) any later version.
+
+     This program is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU General Public License for more details.
+
+     You should have received a copy of the GNU General Public License
+     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <QFile>
+#include <QFileInfo>
+#include <QFileDialog>
+#include <QMessageBox>
+
+#include <opendcp.h>
+#include <opendcp_image.h>
+#include <opendcp_decoder.h>
+#include "mxf_player.h"
+
+// frames are decoded down to about this width
+#define PLAYER_WIDTH   1024
+#define PLAYER_REDUCE  5
+
+// the cache always holds a few frames, whatever the budget
+#define PLAYER_SLOTS_MIN 8
+
+#define PLAYER_THREADS_MAX 8
+
+void MxfPlayerWorker::run()
+{
+    player->work();
+}
+
+MxfPlayer::MxfPlayer(QWidget *parent, const QString &file, int cacheMegabytes)
+    : QDialog(parent)
+{
+    QByteArray name = QFile::encodeName(file);
+
+    path       = file;
+    opendcp    = opendcp_create();
+    reader     = j2k_mxf_reader_open(opendcp, name.data(), &info);
+    reduce     = 0;
+    playhead   = 0;
+    quit       = false;
+    overlayGeneration = 0;
+    playing    = false;
+    startFrame = 0;
+    shownFrame = -1;
+    dropped    = 0;
+
+    setWindowTitle(QFileInfo(file).fileName());
+    setAttribute(Qt::WA_DeleteOnClose);
+
+    display    = new QLabel(this);
+    status     = new QLabel(this);
+    slider     = new QSlider(Qt::Horizontal, this);
+    playButton = new QPushButton(tr("Play"), this);
+    subtitleButton = new QPushButton(tr("Subtitles..."), this);
+
+    display->setAlignment(Qt::AlignCenter);
+    display->setMinimumSize(PLAYER_WIDTH / 2, PLAYER_WIDTH / 4);
+    display->setStyleSheet("background-color: black");
+
+    QHBoxLayout *controls = new QHBoxLayout;
+    controls->addWidget(playButton);
+    controls->addWidget(slider);
+    controls->addWidget(status);
+    controls->addWidget(subtitleButton);
+
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->addWidget(display, 1);
+    layout->addLayout(controls);
+
+    if (!reader || info.frames < 1 || info.edit_rate_num < 1 || info.edit_rate_den < 1) {
+        playButton->setEnabled(false);
+        slider->setEnabled(false);
+        subtitleButton->setEnabled(false);
+        status->setText(tr("Not a readable 2D picture track"));
+        return;
+    }
+
+    while (reduce < PLAYER_REDUCE && (info.w >> reduce) > PLAYER_WIDTH) {
+        reduce++;
+    }
+
+    // the ring is sized by the memory budget of the reduced frames
+    qint64 frameBytes = (qint64)((info.w >> reduce) + 1) * ((info.h >> reduce) + 1) * 4;
+    qint64 slots      = (qint64)cacheMegabytes * 1024 * 1024 / frameBytes;
+
+    slots = qBound((qint64)PLAYER_SLOTS_MIN, slots, (qint64)info.frames);
+    ring.resize(slots);
+
+    for (int i = 0; i < ring.size(); i++) {
+        ring[i].frame = -1;
+        ring[i].state = SLOT_EMPTY;
+    }
+
+    slider->setRange(0, info.frames - 1);
+    showStatus();
+
+    connect(playButton, SIGNAL(clicked()),         this, SLOT(togglePlay()));
+    connect(subtitleButton, SIGNAL(clicked()),     this, SLOT(loadSubtitles()));
+    connect(slider,     SIGNAL(valueChanged(int)), this, SLOT(seek(int)));
+    connect(&timer,     SIGNAL(timeout()),         this, SLOT(tick()));
+
+    // keep one core for the interface
+    int threads = qBound(1, QThread::idealThreadCount() - 1, PLAYER_THREADS_MAX);
+
+    for (int i = 0; i < threads; i++) {
+        MxfPlayerWorker *worker = new MxfPlayerWorker(this);
+
+        workers.append(worker);
+        worker->start(QThread::LowPriority);
+    }
+
+    // polled at a few times the edit rate, the clock decides which frame is due
+    timer.start(qMax(1, 250 * info.edit_rate_den / info.edit_rate_num));
+}
+
+MxfPlayer::~MxfPlayer()
+{
+    timer.stop();
+
+    mutex.lock();
+    quit = true;
+    wake.wakeAll();
+    mutex.unlock();
+
+    foreach (MxfPlayerWorker *worker, workers) {
+        worker->wait();
+        delete worker;
+    }
+
+    j2k_mxf_reader_close(reader);
+    opendcp_delete(opendcp);
+}
+
+// mutex held, the first frame from the playhead on that is neither cached nor being decoded
+int MxfPlayer::nextFrame()
+{
+    int last = qMin(playhead + ring.size(), info.frames);
+
+    for (int f = playhead; f < last; f++) {
+        Slot &slot = ring[f % ring.size()];
+
+        if (slot.frame != f || slot.state == SLOT_EMPTY) {
+            return f;
+        }
+    }
+
+    return -1;
+}
+
+void MxfPlayer::work()
+{
+    mutex.lock();
+
+    while (!quit) {
+        int frame = nextFrame();
+
+        if (frame < 0) {
+            wake.wait(&mutex);
+            continue;
+        }
+
+        // a frame that was in the slot has fallen behind the playhead
+        Slot &slot = ring[frame % ring.size()];
+        slot.frame = frame;
+        slot.state = SLOT_DECODING;
+        slot.image = QImage();
+
+        QSharedPointer<SubtitleTimeline> overlay = subtitles;
+        int generation = overlayGeneration;
+        mutex.unlock();
+
+        QImage image = decode(frame);
+
+        // ahead of the playhead, so showing the frame costs nothing more
+        if (overlay && !image.isNull()) {
+            overlay->paint(image, frame);
+        }
+
+        mutex.lock();
+
+        // the slot may have been taken for another frame after a seek, or
+        // the subtitles changed while it was decoded
+        if (slot.frame == frame && generation != overlayGeneration) {
+            slot.state = SLOT_EMPTY;
+        } else if (slot.frame == frame) {
+            slot.image = image;
+            slot.state = image.isNull() ? SLOT_FAILED : SLOT_READY;
+        }
+    }
+
+    mutex.unlock();
+}
+
+QImage MxfPlayer::decode(int frame)
+{
+    opendcp_image_t *image = NULL;
+    unsigned char   *data;
+    int             length;
+
+    if (j2k_mxf_reader_read(reader, frame, &data, &length) != OPENDCP_NO_ERROR) {
+        return QImage();
+    }
+
+    int result = opendcp_decode_openjpeg_buffer(&image, data, length, reduce);
+    free(data);
+
+    if (result != OPENDCP_NO_ERROR || !image) {
+        return QImage();
+    }
+
+    // for an srgb display, straight into the scan lines
+    QImage qimage(image->w, image->h, QImage::Format_RGB32);
+
+    if (xyz_to_rgb_pack(image, CP_SRGB, RGB_PACK_RGB32, qimage.bits(), qimage.bytesPerLine()) != OPENDCP_NO_ERROR) {
+        qimage = QImage();
+    }
+
+    opendcp_image_free(image);
+
+    return qimage;
+}
+
+// the workers decode ahead of the new position
+void MxfPlayer::setPlayhead(int frame)
+{
+    mutex.lock();
+    playhead = frame;
+    wake.wakeAll();
+    mutex.unlock();
+}
+
+void MxfPlayer::showStatus()
+{
+    QString text = QString("%1 / %2").arg(shownFrame < 0 ? 0 : shownFrame + 1).arg(info.frames);
+
+    if (dropped) {
+        text += tr(", %1 late").arg(dropped);
+    }
+
+    status->setText(text);
+}
+
+// shows the frame that is due, late frames are skipped so playback keeps to the edit rate
+void MxfPlayer::tick()
+{
+    int due = playhead;
+
+    if (playing) {
+        due = startFrame + (int)(clock.elapsed() * info.edit_rate_num / (1000LL * info.edit_rate_den));
+
+        if (due >= info.frames) {
+            togglePlay();
+            due = info.frames - 1;
+        }
+
+        // frames passed over that were never shown were late
+        if (due > playhead) {
+            dropped += due - playhead - (shownFrame >= playhead && shownFrame < due ? 1 : 0);
+            setPlayhead(due);
+        }
+    }
+
+    if (due == shownFrame) {
+        return;
+    }
+
+    mutex.lock();
+    const Slot &slot = ring[due % ring.size()];
+    QImage     image;
+
+    if (slot.frame == due && slot.state == SLOT_READY) {
+        image = slot.image;
+    }
+
+    mutex.unlock();
+
+    if (image.isNull()) {
+        return;
+    }
+
+    shownFrame = due;
+    display->setPixmap(QPixmap::fromImage(image.scaled(display->size(), Qt::KeepAspectRatio, Qt::FastTransformation)));
+
+    slider->blockSignals(true);
+    slider->setValue(due);
+    slider->blockSignals(false);
+
+    showStatus();
+}
+
+void MxfPlayer::togglePlay()
+{
+    playing = !playing;
+    playButton->setText(playing ? tr("Pause") : tr("Play"));
+
+    if (playing) {
+        startFrame = playhead < info.frames - 1 ? playhead : 0;
+        dropped    = 0;
+        clock.start();
+        setPlayhead(startFrame);
+    }
+}
+
+// the subtitle file is indexed once here, the workers draw it into the frames ahead of the playhead
+void MxfPlayer::loadSubtitles()
+{
+    QString file = QFileDialog::getOpenFileName(this, tr("Subtitles"), QFileInfo(path).absolutePath(),
+                                                tr("Subtitle Files (*.xml)"));
+
+    if (file.isEmpty()) {
+        return;
+    }
+
+    QSharedPointer<SubtitleTimeline> timeline(new SubtitleTimeline(info.edit_rate_num, info.edit_rate_den, reduce));
+
+    if (!timeline->load(file)) {
+        QMessageBox::warning(this, tr("Subtitles"), tr("Could not read %1: %2").arg(file, timeline->error()));
+        return;
+    }
+
+    mutex.lock();
+    subtitles = timeline;
+    overlayGeneration++;
+
+    for (int i = 0; i < ring.size(); i++) {
+        if (ring[i].state != SLOT_DECODING) {
+            ring[i].frame = -1;
+            ring[i].state = SLOT_EMPTY;
+            ring[i].image = QImage();
+        }
+    }
+
+    wake.wakeAll();
+    mutex.unlock();
+
+    // shown again once a worker has drawn it
+    shownFrame = -1;
+    subtitleButton->setToolTip(tr("%1 subtitles from %2").arg(timeline->count()).arg(QFileInfo(file).fileName()));
+}
+
+void MxfPlayer::seek(int frame)
+{
+    if (playing) {
+        startFrame = frame;
+        clock.start();
+    }
+
+    setPlayhead(frame);
+}
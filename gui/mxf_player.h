@@ -0,0 +1,107 @@
+/*
+     OpenDCP: Builds Digital Cinema Packages
+     Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+     This program is free software: you can redistribute it and/or modify
+     it under the terms of the GNU General Public License as published by
+     the Free Software Foundation, either version 3 of the License, or
+     (at your option) any later version.
+
+     This program is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU General Public License for more details.
+
+     You should have received a copy of the GNU General Public License
+     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __MXF_PLAYER_H__
+#define __MXF_PLAYER_H__
+
+#include <QtGui>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QElapsedTimer>
+#include <QSharedPointer>
+#include <opendcp.h>
+#include "subtitle_timeline.h"
+
+class MxfPlayer;
+
+// decodes frames ahead of the playhead into the player's cache
+class MxfPlayerWorker : public QThread
+{
+public:
+    MxfPlayerWorker(MxfPlayer *player) : player(player) {}
+    void run();
+
+private:
+    MxfPlayer *player;
+};
+
+// plays a picture track at its edit rate, frames are decoded at a reduced resolution on a pool of workers
+class MxfPlayer : public QDialog
+{
+    Q_OBJECT
+
+    friend class MxfPlayerWorker;
+
+public:
+    MxfPlayer(QWidget *parent, const QString &file, int cacheMegabytes = 512);
+    ~MxfPlayer();
+    bool isOpen() const { return reader != NULL; }
+
+private slots:
+    void tick();
+    void togglePlay();
+    void seek(int frame);
+    void loadSubtitles();
+
+private:
+    enum SlotState { SLOT_EMPTY, SLOT_DECODING, SLOT_READY, SLOT_FAILED };
+
+    struct Slot {
+        int       frame;
+        SlotState state;
+        QImage    image;
+    };
+
+    QString                 path;
+    opendcp_t               *opendcp;
+    j2k_mxf_reader_t        *reader;
+    j2k_mxf_reader_info_t   info;
+    int                     reduce;
+
+    // a ring of decoded frames, frame f lives in slot f % size while it is ahead of the playhead
+    QVector<Slot>           ring;
+    QMutex                  mutex;
+    QWaitCondition          wake;
+    int                     playhead;
+    bool                    quit;
+    QList<MxfPlayerWorker*> workers;
+
+    // drawn into the frames by the workers, a new file sends the cached frames back to them
+    QSharedPointer<SubtitleTimeline> subtitles;
+    int                     overlayGeneration;
+
+    QLabel                  *display;
+    QLabel                  *status;
+    QSlider                 *slider;
+    QPushButton             *playButton;
+    QPushButton             *subtitleButton;
+    QTimer                  timer;
+    QElapsedTimer           clock;
+    bool                    playing;
+    int                     startFrame;
+    int                     shownFrame;
+    int                     dropped;
+
+    void   work();
+    int    nextFrame();
+    QImage decode(int frame);
+    void   setPlayhead(int frame);
+    void   showStatus();
+};
+
+#endif // __MXF_PLAYER_H__
@@ -23,9 +23,13 @@
 #include <opendcp.h>
 #include "mxf_writer.h"
 
+// written frames are sent to the dialog at most this often
+#define MXF_PROGRESS_MS 100
+
 MxfWriter::MxfWriter(QObject *parent)
     : QThread(parent)
 {
+    opendcpMxf = 0;
     reset();
 }
 
@@ -37,16 +41,25 @@ MxfWriter::~MxfWriter()
 void MxfWriter::reset()
 {
     cancelled = 0;
+    reported  = 0;
     rc        = 0;
 }
 
 void MxfWriter::cancel() {
     cancelled = 1;
+
+    if (opendcpMxf) {
+        opendcpMxf->mxf.cancel = 1;
+    }
 }
 
+// called every MXF_PROGRESS_MS with the frames written since the last call
 int MxfWriter::frameDoneCb(void *data) {
     MxfWriter *self = static_cast<MxfWriter*>(data);
-    emit self->frameDone();
+    int frames = self->opendcpMxf->mxf.progress.frames;
+
+    emit self->framesDone(frames - self->reported);
+    self->reported = frames;
 
     return self->cancelled;
 }
@@ -70,6 +83,8 @@ void MxfWriter::run()
 
     opendcpMxf->mxf.frame_done.callback = MxfWriter::frameDoneCb;
     opendcpMxf->mxf.frame_done.argument = this;
+    opendcpMxf->mxf.progress_ms         = MXF_PROGRESS_MS;
+    opendcpMxf->mxf.cancel              = cancelled;
 
     filelist_t *fileList = filelist_alloc(mxfFileList.size());
 
@@ -37,6 +37,7 @@ public:
     void init(opendcp_t *opendcp, QFileInfoList fileList, QString outputFile);
     int  rc;
     int  cancelled;
+    int  reported;
 
 private:
     opendcp_t      *opendcpMxf;
@@ -49,7 +50,7 @@ signals:
     void finished();
     void setResult(int);
     void errorMessage(QString);
-    void frameDone();
+    void framesDone(int);
 
 public slots:
     void cancel();
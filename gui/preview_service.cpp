@@ -0,0 +1,187 @@
+/*
+     OpenDCP: Builds Digital Cinema Packages
+     Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+     This program is free software: you can redistribute it and/or modify
+     it under the terms of the GNU General Public License as published by
+     the Free Software Foundation, either version 3 of the License, or
+     (at your option) any later version.
+
+     This program is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU General Public License for more details.
+
+     You should have received a copy of the GNU General Public License
+     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <QFile>
+#include <QFileInfo>
+
+#include <opendcp.h>
+#include <opendcp_image.h>
+#include <opendcp_decoder.h>
+#include "preview_service.h"
+
+PreviewService::PreviewService(QObject *parent, int cacheSize)
+    : QThread(parent)
+{
+    cache.setMaxCost(cacheSize);
+    pending = false;
+    quit    = false;
+}
+
+PreviewService::~PreviewService()
+{
+    mutex.lock();
+    quit = true;
+    wake.wakeOne();
+    mutex.unlock();
+
+    wait();
+}
+
+QString PreviewService::cacheKey(const QString &file, const QSize &size)
+{
+    return QString("%1|%2x%3").arg(file).arg(size.width()).arg(size.height());
+}
+
+// a cached preview is handed back at once, anything else replaces the request waiting for the thread
+void PreviewService::request(const QString &file, const QSize &size)
+{
+    mutex.lock();
+    QImage *image = cache.object(cacheKey(file, size));
+
+    if (image) {
+        QImage copy = *image;
+
+        mutex.unlock();
+        emit previewReady(file, copy);
+        return;
+    }
+
+    pendingFile = file;
+    pendingSize = size;
+    pending     = true;
+    wake.wakeOne();
+    mutex.unlock();
+
+    if (!isRunning()) {
+        start(QThread::LowPriority);
+    }
+}
+
+// a newer request makes the one being decoded pointless
+bool PreviewService::stale(const QString &file)
+{
+    QMutexLocker locker(&mutex);
+
+    return quit || (pending && pendingFile != file);
+}
+
+QImage PreviewService::decode(const QString &file, const QSize &size)
+{
+    opendcp_image_t   *image = NULL;
+    opendcp_decoder_t *decoder;
+    QByteArray        name = QFile::encodeName(file);
+    QByteArray        extension = QFileInfo(file).suffix().toLower().toAscii();
+    int               result, w, h, resolutions, reduce = 0;
+
+    decoder = opendcp_decoder_find(NULL, extension.data(), 0);
+
+    // formats libopendcp does not read are left to qt
+    if (!decoder || decoder->id == OPENDCP_DECODER_NONE) {
+        QImage qimage;
+
+        if (!qimage.load(file)) {
+            return QImage();
+        }
+
+        return qimage.scaled(size, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+    }
+
+    // only decode as many jpeg2000 resolution levels as the preview shows
+    if (decoder->id == OPENDCP_DECODER_OPENJPEG) {
+        if (opendcp_openjpeg_info(name.data(), &w, &h, &resolutions) != OPENDCP_NO_ERROR) {
+            return QImage();
+        }
+
+        while (reduce < resolutions - 1 && (w >> (reduce + 1)) >= size.width() && (h >> (reduce + 1)) >= size.height()) {
+            reduce++;
+        }
+
+        result = opendcp_decode_openjpeg_reduced(&image, name.data(), reduce, 0, 0, 0, 0);
+    } else {
+        result = decoder->decode(&image, name.data());
+    }
+
+    if (result != OPENDCP_NO_ERROR || !image) {
+        return QImage();
+    }
+
+    QSize  scaled = QSize(image->w, image->h).scaled(size, Qt::KeepAspectRatio);
+    QImage qimage(scaled.width() > 0 ? scaled.width() : 1, scaled.height() > 0 ? scaled.height() : 1, QImage::Format_RGB32);
+    int    shift = image->precision > 8 ? image->precision - 8 : 0;
+    int    mono  = image->n_components < 3;
+
+    // nearest neighbour straight into the preview size, full frames are never converted
+    for (int y = 0; y < qimage.height(); y++) {
+        QRgb *line = (QRgb *)qimage.scanLine(y);
+        int   sy   = y * image->h / qimage.height();
+
+        for (int x = 0; x < qimage.width(); x++) {
+            int sx = x * image->w / qimage.width();
+            int r  = opendcp_image_get_sample(image, 0, sx, sy) >> shift;
+            int g  = mono ? r : opendcp_image_get_sample(image, 1, sx, sy) >> shift;
+            int b  = mono ? r : opendcp_image_get_sample(image, 2, sx, sy) >> shift;
+
+            line[x] = qRgb(qBound(0, r, 255), qBound(0, g, 255), qBound(0, b, 255));
+        }
+    }
+
+    opendcp_image_free(image);
+
+    return qimage;
+}
+
+void PreviewService::run()
+{
+    QString file;
+    QSize   size;
+
+    while (1) {
+        mutex.lock();
+
+        while (!pending && !quit) {
+            wake.wait(&mutex);
+        }
+
+        if (quit) {
+            mutex.unlock();
+            break;
+        }
+
+        file    = pendingFile;
+        size    = pendingSize;
+        pending = false;
+        mutex.unlock();
+
+        QImage image = decode(file, size);
+
+        if (stale(file)) {
+            continue;
+        }
+
+        if (image.isNull()) {
+            emit previewFailed(file);
+            continue;
+        }
+
+        mutex.lock();
+        cache.insert(cacheKey(file, size), new QImage(image));
+        mutex.unlock();
+
+        emit previewReady(file, image);
+    }
+}
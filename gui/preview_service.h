@@ -0,0 +1,59 @@
+/*
+     OpenDCP: Builds Digital Cinema Packages
+     Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+     This program is free software: you can redistribute it and/or modify
+     it under the terms of the GNU General Public License as published by
+     the Free Software Foundation, either version 3 of the License, or
+     (at your option) any later version.
+
+     This program is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU General Public License for more details.
+
+     You should have received a copy of the GNU General Public License
+     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __PREVIEW_SERVICE_H__
+#define __PREVIEW_SERVICE_H__
+
+#include <QtGui>
+#include <QObject>
+#include <QCache>
+#include <QMutex>
+#include <QWaitCondition>
+#include <opendcp.h>
+
+// decodes previews on its own thread, only the newest request is kept
+class PreviewService : public QThread
+{
+    Q_OBJECT
+
+public:
+    PreviewService(QObject *parent, int cacheSize = 32);
+
+    ~PreviewService();
+    void run();
+    void request(const QString &file, const QSize &size);
+
+private:
+    QCache<QString, QImage> cache;     // scaled previews, least recently used are dropped
+    QMutex                  mutex;
+    QWaitCondition          wake;
+    QString                 pendingFile;
+    QSize                   pendingSize;
+    bool                    pending;
+    bool                    quit;
+
+    static QString cacheKey(const QString &file, const QSize &size);
+    QImage decode(const QString &file, const QSize &size);
+    bool   stale(const QString &file);
+
+signals:
+    void previewReady(QString file, QImage image);
+    void previewFailed(QString file);
+};
+
+#endif // __PREVIEW_SERVICE_H__
@@ -0,0 +1,274 @@
+/*
+     OpenDCP: Builds Digital Cinema Packages
+     Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+     This program is free software: you can redistribute it and/or modify
+     it under the terms of the GNU General Public License as published by
+     the Free Software Foundation, either version 3 of the License, or
+     (at your option) any later version.
+
+     This program is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU General Public License for more details.
+
+     You should have received a copy of the GNU General Public License
+     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <QFile>
+#include <QFileInfo>
+#include <QDir>
+#include <QXmlStreamReader>
+#include <math.h>
+
+#include "subtitle_timeline.h"
+
+// interop times count ticks of 4 ms, smpte ones edit units of the TimeCodeRate
+#define SUBTITLE_INTEROP_TICKS 250
+
+// font sizes are in points of a 1080 line screen
+#define SUBTITLE_SCREEN_LINES  1080
+#define SUBTITLE_FONT_SIZE     42
+
+// interop and smpte spell the placement attributes differently
+static QString attribute(const QXmlStreamAttributes &attributes, const char *interop, const char *smpte)
+{
+    if (attributes.hasAttribute(interop)) {
+        return attributes.value(interop).toString();
+    }
+
+    return attributes.value(smpte).toString();
+}
+
+SubtitleTimeline::SubtitleTimeline(int editRateNum, int editRateDen, int reduce, int cacheMegabytes)
+{
+    rateNum = editRateNum;
+    rateDen = editRateDen;
+    scale   = 1 << reduce;
+    longest = 0;
+
+    images.setMaxCost(cacheMegabytes * 1024);
+}
+
+// frame of a time, HH:MM:SS:TT in ticks of tickRate or HH:MM:SS.sss, -1 when it is neither
+int SubtitleTimeline::frames(const QString &time, int tickRate) const
+{
+    QStringList parts = time.trimmed().split(QRegExp("[:.]"));
+
+    if (parts.size() != 4 || tickRate < 1) {
+        return -1;
+    }
+
+    double seconds = parts[0].toInt() * 3600 + parts[1].toInt() * 60 + parts[2].toInt();
+
+    if (time.contains('.')) {
+        seconds += ("0." + parts[3]).toDouble();
+    } else {
+        seconds += parts[3].toInt() / (double)tickRate;
+    }
+
+    return (int)floor(seconds * rateNum / rateDen + 0.5);
+}
+
+// builds the index once, painting a frame then only searches it
+bool SubtitleTimeline::load(const QString &file)
+{
+    QFile in(file);
+
+    events.clear();
+    longest = 0;
+
+    if (!in.open(QIODevice::ReadOnly)) {
+        loadError = in.errorString();
+        return false;
+    }
+
+    QXmlStreamReader xml(&in);
+    QDir             dir = QFileInfo(file).absoluteDir();
+    QList<Element>   fonts;
+    Element          font;
+    Event            event;
+    bool             inSubtitle = false;
+    int              tickRate   = SUBTITLE_INTEROP_TICKS;
+
+    font.size   = SUBTITLE_FONT_SIZE;
+    font.italic = false;
+    font.color  = Qt::white;
+
+    while (!xml.atEnd()) {
+        xml.readNext();
+
+        if (xml.isStartElement()) {
+            QStringRef           name       = xml.name();
+            QXmlStreamAttributes attributes = xml.attributes();
+
+            if (name == "TimeCodeRate") {
+                tickRate = xml.readElementText().toInt();
+            } else if (name == "Font") {
+                fonts.append(font);
+
+                if (attributes.hasAttribute("Size")) {
+                    font.size = attributes.value("Size").toString().toInt();
+                }
+
+                if (attributes.hasAttribute("Italic")) {
+                    font.italic = attributes.value("Italic") == "yes";
+                }
+
+                if (attributes.hasAttribute("Color")) {
+                    font.color = QColor::fromRgba(attributes.value("Color").toString().toUInt(0, 16));
+                }
+            } else if (name == "Subtitle") {
+                event.in   = frames(attributes.value("TimeIn").toString(), tickRate);
+                event.out  = frames(attributes.value("TimeOut").toString(), tickRate);
+                event.elements.clear();
+                inSubtitle = true;
+            } else if (inSubtitle && (name == "Text" || name == "Image")) {
+                Element element   = font;
+                element.halign    = attribute(attributes, "HAlign", "Halign");
+                element.valign    = attribute(attributes, "VAlign", "Valign");
+                element.hposition = attribute(attributes, "HPosition", "Hposition").toDouble();
+                element.vposition = attribute(attributes, "VPosition", "Vposition").toDouble();
+
+                if (name == "Text") {
+                    element.text = xml.readElementText(QXmlStreamReader::IncludeChildElements).trimmed();
+                } else {
+                    // a smpte subpicture is an ancillary resource, named by its id next to the file
+                    QString reference = xml.readElementText().trimmed();
+
+                    if (reference.startsWith("urn:uuid:")) {
+                        reference = reference.mid(9) + ".png";
+                    }
+
+                    element.image = dir.filePath(reference);
+                }
+
+                event.elements.append(element);
+            }
+        } else if (xml.isEndElement()) {
+            if (xml.name() == "Font" && !fonts.isEmpty()) {
+                font = fonts.takeLast();
+            } else if (xml.name() == "Subtitle") {
+                if (event.in >= 0 && event.out > event.in && !event.elements.isEmpty()) {
+                    events.append(event);
+                    longest = qMax(longest, event.out - event.in);
+                }
+
+                inSubtitle = false;
+            }
+        }
+    }
+
+    if (xml.hasError()) {
+        loadError = QString("%1, line %2").arg(xml.errorString()).arg(xml.lineNumber());
+        events.clear();
+        return false;
+    }
+
+    qStableSort(events.begin(), events.end());
+
+    return true;
+}
+
+// decoded once, by the first worker that composes a frame showing it
+QImage SubtitleTimeline::subpicture(const QString &file)
+{
+    mutex.lock();
+    QImage *cached = images.object(file);
+    QImage image   = cached ? *cached : QImage();
+    mutex.unlock();
+
+    if (cached) {
+        return image;
+    }
+
+    image = QImage(file);
+
+    if (!image.isNull() && scale > 1) {
+        image = image.scaled(qMax(1, image.width() / scale), qMax(1, image.height() / scale),
+                             Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+    }
+
+    // a missing file is kept as well, it is not looked for again every frame
+    mutex.lock();
+    images.insert(file, new QImage(image), qMax(1, image.byteCount() / 1024));
+    mutex.unlock();
+
+    return image;
+}
+
+void SubtitleTimeline::paintElement(QPainter &painter, const QSize &size, const Element &element)
+{
+    double w  = size.width();
+    double h  = size.height();
+    double dx = w * element.hposition / 100;
+    double dy = h * element.vposition / 100;
+
+    if (!element.image.isEmpty()) {
+        QImage image = subpicture(element.image);
+
+        if (image.isNull()) {
+            return;
+        }
+
+        double x = element.halign == "left" ? dx : element.halign == "right" ? w - dx - image.width()
+                                                                             : (w - image.width()) / 2 + dx;
+        double y = element.valign == "top" ? dy : element.valign == "bottom" ? h - dy - image.height()
+                                                                             : (h - image.height()) / 2 + dy;
+
+        painter.drawImage(QPointF(x, y), image);
+        return;
+    }
+
+    QFont font;
+    font.setPixelSize(qMax(1, (int)(element.size * h / SUBTITLE_SCREEN_LINES)));
+    font.setItalic(element.italic);
+
+    QFontMetricsF metrics(font);
+    QPainterPath  path;
+
+    double x = element.halign == "left" ? dx : element.halign == "right" ? w - dx - metrics.width(element.text)
+                                                                         : (w - metrics.width(element.text)) / 2 + dx;
+    double y = element.valign == "top" ? dy + metrics.ascent() : element.valign == "bottom" ? h - dy - metrics.descent()
+                                                                                            : h / 2 + dy + (metrics.ascent() - metrics.descent()) / 2;
+
+    // outlined, readable over any picture
+    path.addText(QPointF(x, y), font, element.text);
+    painter.strokePath(path, QPen(QColor(0, 0, 0, element.color.alpha()), qMax(1.0, font.pixelSize() / 12.0)));
+    painter.fillPath(path, element.color);
+}
+
+void SubtitleTimeline::paint(QImage &image, int frame)
+{
+    // the first event that starts after the frame, the ones showing are before it
+    int lo = 0;
+    int hi = events.size();
+
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+
+        if (events[mid].in <= frame) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    QPainter painter;
+
+    for (int i = lo - 1; i >= 0 && events[i].in + longest >= frame; i--) {
+        if (events[i].out <= frame) {
+            continue;
+        }
+
+        if (!painter.isActive()) {
+            painter.begin(&image);
+            painter.setRenderHint(QPainter::Antialiasing);
+        }
+
+        foreach (const Element &element, events[i].elements) {
+            paintElement(painter, image.size(), element);
+        }
+    }
+}
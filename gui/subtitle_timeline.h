@@ -0,0 +1,77 @@
+/*
+     OpenDCP: Builds Digital Cinema Packages
+     Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+     This program is free software: you can redistribute it and/or modify
+     it under the terms of the GNU General Public License as published by
+     the Free Software Foundation, either version 3 of the License, or
+     (at your option) any later version.
+
+     This program is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU General Public License for more details.
+
+     You should have received a copy of the GNU General Public License
+     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __SUBTITLE_TIMELINE_H__
+#define __SUBTITLE_TIMELINE_H__
+
+#include <QtGui>
+#include <QCache>
+#include <QMutex>
+
+// the subtitles of a reel by frame, read once from an interop or smpte subtitle file
+class SubtitleTimeline
+{
+public:
+    SubtitleTimeline(int editRateNum, int editRateDen, int reduce, int cacheMegabytes = 64);
+
+    bool    load(const QString &file);
+    QString error() const { return loadError; }
+    int     count() const { return events.size(); }
+
+    // draws the subtitles showing at frame, safe on any thread
+    void    paint(QImage &image, int frame);
+
+private:
+    // a line of text or a subpicture, placed as a fraction of the screen
+    struct Element {
+        QString text;
+        QString image;      // png file, empty for text
+        QString halign;
+        QString valign;
+        double  hposition;
+        double  vposition;
+        int     size;
+        bool    italic;
+        QColor  color;
+    };
+
+    struct Event {
+        int             in;
+        int             out;
+        QList<Element>  elements;
+
+        bool operator<(const Event &other) const { return in < other.in; }
+    };
+
+    int                     rateNum;
+    int                     rateDen;
+    int                     scale;
+    int                     longest;    // frames of the longest event, bounds the search back
+    QList<Event>            events;     // by in point
+    QString                 loadError;
+
+    // decoded subpictures scaled to the frames, least recently used are dropped
+    QCache<QString, QImage> images;
+    QMutex                  mutex;
+
+    int    frames(const QString &time, int tickRate) const;
+    QImage subpicture(const QString &file);
+    void   paintElement(QPainter &painter, const QSize &size, const Element &element);
+};
+
+#endif // __SUBTITLE_TIMELINE_H__
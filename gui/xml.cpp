@@ -55,7 +55,7 @@ void MainWindow::getTitle() {
     }
 }
 
-int MainWindow::mxfCopy(QString source, QString destination) {
+int MainWindow::mxfCopy(QString source, QString destination, QString digest) {
     QFileInfo   sourceFileInfo;
     QFileInfo   destinationFileInfo;
 
@@ -83,12 +83,13 @@ int MainWindow::mxfCopy(QString source, QString destination) {
 
     // copy/move the file
     if (ui->rbMoveMxf->isChecked()) {
-        QFile::rename(sourceFileInfo.absoluteFilePath(), destinationFileInfo.absoluteFilePath());
-    } else {
-        fileCopy(sourceFileInfo.absoluteFilePath(), destinationFileInfo.absoluteFilePath());
+        if (QFile::rename(sourceFileInfo.absoluteFilePath(), destinationFileInfo.absoluteFilePath())) {
+            return OPENDCP_NO_ERROR;
+        }
     }
 
-    return OPENDCP_NO_ERROR;
+    // a move across file systems falls back to a copy
+    return fileCopy(sourceFileInfo.absoluteFilePath(), destinationFileInfo.absoluteFilePath(), digest);
 }
 
 void MainWindow::startDcp()
@@ -98,6 +99,7 @@ void MainWindow::startDcp()
     QString     DCP_FAIL_MSG;
     QString     message; 
     int         rc;
+    reel_t     *reel;
 
     // get dcp destination directory
     path = QFileDialog::getExistingDirectory(this, tr("Choose destination folder"), lastDir);
@@ -147,58 +149,49 @@ void MainWindow::startDcp()
 
     // add pkl to the DCP (only one PKL currently support)
     pkl_t pkl;
-    create_pkl(xmlContext->dcp, &pkl);
-    add_pkl_to_dcp(&xmlContext->dcp, pkl);
+    create_pkl(&xmlContext->dcp, &pkl);
+    add_pkl_to_dcp(&xmlContext->dcp, &pkl);
 
     // add cpl to the DCP/PKL (only one CPL currently support)
     cpl_t cpl;
-    create_cpl(xmlContext->dcp, &cpl);
-    add_cpl_to_pkl(&xmlContext->dcp.pkl[0], cpl);
+    create_cpl(&xmlContext->dcp, &cpl);
+    add_cpl_to_pkl(&xmlContext->dcp.pkl[0], &cpl);
 
     // add reel
     reel_t reel;
-    create_reel(xmlContext->dcp, &reel);
-    add_reel_to_cpl(&xmlContext->dcp.pkl[0].cpl[0], reel);
+    create_reel(&xmlContext->dcp, &reel);
+    add_reel_to_cpl(&xmlContext->dcp.pkl[0].cpl[0], &reel);
+
+    // add assets, their digests are calculated together before they join the reel
+    asset_t pictureTrack, soundTrack, subtitleTrack;
+    asset_t *assets[3];
+    int     count;
+
+    count = 0;
 
-    // add assets
     if (!ui->reelPictureEdit->text().isEmpty()) {
-        asset_t asset;
-        add_asset(xmlContext, &asset, ui->reelPictureEdit->text().toUtf8().data());
-        QString digest = calculateDigest(xmlContext, "Picture", QString::fromStdString(asset.filename));
-        if (digest == NULL) {
-            QMessageBox::critical(this, DCP_FAIL_MSG,
-                                 tr("Calculate Digest Did Not Complete"));
-            goto Done;
-        }
-        //QString digest = xmlCalculateDigestStartThread(xmlContext, asset.filename);
-        snprintf(asset.digest, sizeof(asset.digest),"%s", digest.toUtf8().data());
-        add_asset_to_reel(xmlContext, &xmlContext->dcp.pkl[0].cpl[0].reel[0], asset);
+        add_asset(xmlContext, &pictureTrack, ui->reelPictureEdit->text().toUtf8().data());
+        assets[count++] = &pictureTrack;
     }
 
     if (!ui->reelSoundEdit->text().isEmpty()) {
-        asset_t asset;
-        add_asset(xmlContext, &asset, ui->reelSoundEdit->text().toUtf8().data());
-        QString digest = calculateDigest(xmlContext, "Sound", QString::fromStdString(asset.filename));
-        if (digest == NULL) {
-            QMessageBox::critical(this, DCP_FAIL_MSG,
-                                 tr("Calculate Digest Did Not Complete"));
-            goto Done;
-        }
-        snprintf(asset.digest, sizeof(asset.digest), "%s", digest.toUtf8().data());
-        add_asset_to_reel(xmlContext, &xmlContext->dcp.pkl[0].cpl[0].reel[0], asset);
+        add_asset(xmlContext, &soundTrack, ui->reelSoundEdit->text().toUtf8().data());
+        assets[count++] = &soundTrack;
     }
 
     if (!ui->reelSubtitleEdit->text().isEmpty()) {
-        asset_t asset;
-        add_asset(xmlContext, &asset, ui->reelSubtitleEdit->text().toUtf8().data());
-        QString digest = calculateDigest(xmlContext, "Subtitle", QString::fromStdString(asset.filename));
-        if (digest == NULL) {
-            QMessageBox::critical(this, DCP_FAIL_MSG,
-                                 tr("Calculate Digest Did Not Complete"));
-            goto Done;
-        }
-        snprintf(asset.digest, sizeof(asset.digest), "%s", digest.toUtf8().data());
-        add_asset_to_reel(xmlContext, &xmlContext->dcp.pkl[0].cpl[0].reel[0], asset);
+        add_asset(xmlContext, &subtitleTrack, ui->reelSubtitleEdit->text().toUtf8().data());
+        assets[count++] = &subtitleTrack;
+    }
+
+    if (calculateDigests(xmlContext, assets, count) != OPENDCP_NO_ERROR) {
+        QMessageBox::critical(this, DCP_FAIL_MSG,
+                             tr("Calculate Digest Did Not Complete"));
+        goto Done;
+    }
+
+    for (int i = 0; i < count; i++) {
+        add_asset_to_reel(xmlContext, &xmlContext->dcp.pkl[0].cpl[0].reel[0], *assets[i]);
     }
 
     // adjust durations
@@ -245,14 +238,15 @@ void MainWindow::startDcp()
         goto Done;
     }
 
-    // copy picture mxf
-    mxfCopy(QString::fromUtf8(xmlContext->dcp.pkl[0].cpl[0].reel[0].main_picture.filename), path);
-
-    // copy audio mxf
-    mxfCopy(QString::fromUtf8(xmlContext->dcp.pkl[0].cpl[0].reel[0].main_sound.filename), path);
+    // copy the mxfs, checking each against the digest written to the packing list
+    reel = &xmlContext->dcp.pkl[0].cpl[0].reel[0];
 
-    // copy subtitle mxf
-    mxfCopy(QString::fromUtf8(xmlContext->dcp.pkl[0].cpl[0].reel[0].main_subtitle.filename), path);
+    if (mxfCopy(QString::fromUtf8(reel->main_picture.filename), path, QString::fromLatin1(reel->main_picture.digest)) != OPENDCP_NO_ERROR ||
+        mxfCopy(QString::fromUtf8(reel->main_sound.filename), path, QString::fromLatin1(reel->main_sound.digest)) != OPENDCP_NO_ERROR ||
+        mxfCopy(QString::fromUtf8(reel->main_subtitle.filename), path, QString::fromLatin1(reel->main_subtitle.digest)) != OPENDCP_NO_ERROR) {
+        QMessageBox::critical(this, DCP_FAIL_MSG, tr("Failed to copy MXF file."));
+        goto Done;
+    }
 
     msgBox.setText("DCP Created successfully");
     msgBox.exec();
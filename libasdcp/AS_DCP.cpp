@@ -30,7 +30,11 @@ THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include "AS_DCP_internal.h"
+#include <KM_mutex.h>
 #include <assert.h>
+#ifndef KM_WIN32
+#include <sys/mman.h>
+#endif
 
 const char*
 ASDCP::Version()
@@ -79,20 +83,261 @@ ASDCP::DecodeRational(const char* str_rational, Rational& rational)
 }
 
 
+//------------------------------------------------------------------------------------------
+//
+// frame buffer memory pool
+
+// Blocks under the minimum are not worth keeping. A block is only handed to
+// a buffer that needs at least half of it, so a few large frames do not pin
+// their memory under many small buffers.
+static const ui32_t FrameBufferPoolSlots = 32;
+static const ui64_t FrameBufferPoolBytes = 512 * 1024 * 1024;
+static const ui32_t FrameBufferPoolMinBlock = 64 * 1024;
+
+// Blocks of at least a huge page are mapped with huge pages when enabled,
+// rounded up to whole huge pages.
+static const ui32_t FrameBufferHugePage = 2 * 1024 * 1024;
+
+struct FrameBufferBlock
+{
+  byte_t* Data;
+  ui32_t  Size;
+  bool    Mapped;
+};
+
+static Kumu::Mutex      s_FrameBufferPoolLock;
+static FrameBufferBlock s_FrameBufferPool[FrameBufferPoolSlots];
+static ui32_t           s_FrameBufferPoolCount = 0;
+static ui64_t           s_FrameBufferPoolTotal = 0;
+static bool             s_FrameBufferHuge = false;
+static ui32_t           s_FrameBufferHugeExplicit = 0;
+static ui32_t           s_FrameBufferHugeTransparent = 0;
+static ui32_t           s_FrameBufferHugeFallback = 0;
+
+// Maps a block backed by huge pages, explicit ones first, then transparent
+// ones on a mapping trimmed to start on a huge page. Returns 0 when the
+// system grants neither.
+static byte_t*
+frame_buffer_huge_map(ui32_t size)
+{
+  byte_t* data = 0;
+  bool is_explicit = false;
+
+#ifdef KM_WIN32
+  SIZE_T page = GetLargePageMinimum();
+
+  if ( page != 0 && size % page == 0 )
+    data = (byte_t*)VirtualAlloc(0, size, MEM_COMMIT | MEM_RESERVE | MEM_LARGE_PAGES, PAGE_READWRITE);
+
+  is_explicit = ( data != 0 );
+#else
+# ifdef MAP_HUGETLB
+  void* map = mmap(0, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+  if ( map != MAP_FAILED )
+    {
+      data = (byte_t*)map;
+      is_explicit = true;
+    }
+# endif
+
+# ifdef MADV_HUGEPAGE
+  if ( data == 0 )
+    {
+      byte_t* map = (byte_t*)mmap(0, (size_t)size + FrameBufferHugePage, PROT_READ | PROT_WRITE,
+				  MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+      if ( map != (byte_t*)MAP_FAILED )
+	{
+	  size_t head = ( FrameBufferHugePage - (size_t)map % FrameBufferHugePage ) % FrameBufferHugePage;
+
+	  if ( head != 0 )
+	    munmap(map, head);
+
+	  munmap(map + head + size, FrameBufferHugePage - head);
+
+	  if ( madvise(map + head, size, MADV_HUGEPAGE) == 0 )
+	    data = map + head;
+	  else
+	    munmap(map + head, size);
+	}
+    }
+# endif
+#endif
+
+  Kumu::AutoMutex Lock(s_FrameBufferPoolLock);
+
+  if ( data == 0 )
+    s_FrameBufferHugeFallback++;
+  else if ( is_explicit )
+    s_FrameBufferHugeExplicit++;
+  else
+    s_FrameBufferHugeTransparent++;
+
+  return data;
+}
+
+// Frees a block with the allocator it came from.
+static void
+frame_buffer_block_free(byte_t* data, ui32_t size, bool mapped)
+{
+  if ( ! mapped )
+    {
+      free(data);
+      return;
+    }
+
+#ifdef KM_WIN32
+  VirtualFree(data, 0, MEM_RELEASE);
+#else
+  munmap(data, size);
+#endif
+}
+
+// Takes the smallest pooled block that fits, otherwise allocates with an
+// eighth of headroom rounded up to the minimum block, the hysteresis that
+// lets frames a little larger than the last fit in the same block.
+static byte_t*
+frame_buffer_pool_take(ui32_t need, ui32_t* size, bool* mapped)
+{
+  bool huge;
+
+  {
+    Kumu::AutoMutex Lock(s_FrameBufferPoolLock);
+    ui32_t best = FrameBufferPoolSlots;
+
+    for ( ui32_t i = 0; i < s_FrameBufferPoolCount; i++ )
+      {
+	const FrameBufferBlock& Block = s_FrameBufferPool[i];
+
+	if ( Block.Size >= need && (ui64_t)Block.Size <= (ui64_t)need * 2
+	     && ( best == FrameBufferPoolSlots || Block.Size < s_FrameBufferPool[best].Size ) )
+	  best = i;
+      }
+
+    if ( best != FrameBufferPoolSlots )
+      {
+	byte_t* data = s_FrameBufferPool[best].Data;
+	*size = s_FrameBufferPool[best].Size;
+	*mapped = s_FrameBufferPool[best].Mapped;
+	s_FrameBufferPoolTotal -= *size;
+	s_FrameBufferPool[best] = s_FrameBufferPool[--s_FrameBufferPoolCount];
+	return data;
+      }
+
+    huge = s_FrameBufferHuge;
+  }
+
+  ui64_t alloc = need;
+
+  if ( need >= FrameBufferPoolMinBlock )
+    {
+      alloc += need / 8 + FrameBufferPoolMinBlock - 1;
+      alloc -= alloc % FrameBufferPoolMinBlock;
+      alloc = Kumu::xmin<ui64_t>(alloc, 0xffffffffUL);
+    }
+
+  *mapped = false;
+
+  if ( huge && alloc >= FrameBufferHugePage )
+    {
+      ui64_t pages = ( alloc + FrameBufferHugePage - 1 ) / FrameBufferHugePage * FrameBufferHugePage;
+
+      if ( pages <= 0xffffffffUL )
+	{
+	  byte_t* data = frame_buffer_huge_map((ui32_t)pages);
+
+	  if ( data != 0 )
+	    {
+	      *size = (ui32_t)pages;
+	      *mapped = true;
+	      return data;
+	    }
+	}
+    }
+
+  byte_t* data = (byte_t*)malloc((size_t)alloc);
+
+  if ( data == 0 && alloc > need )
+    {
+      alloc = need;
+      data = (byte_t*)malloc(need);
+    }
+
+  *size = data ? (ui32_t)alloc : 0;
+  return data;
+}
+
+// Keeps a block for the next buffer, or frees it when the pool is full.
+static void
+frame_buffer_pool_give(byte_t* data, ui32_t size, bool mapped)
+{
+  if ( data == 0 )
+    return;
+
+  if ( size >= FrameBufferPoolMinBlock )
+    {
+      Kumu::AutoMutex Lock(s_FrameBufferPoolLock);
+
+      if ( s_FrameBufferPoolCount < FrameBufferPoolSlots && s_FrameBufferPoolTotal + size <= FrameBufferPoolBytes )
+	{
+	  s_FrameBufferPool[s_FrameBufferPoolCount].Data = data;
+	  s_FrameBufferPool[s_FrameBufferPoolCount].Mapped = mapped;
+	  s_FrameBufferPool[s_FrameBufferPoolCount++].Size = size;
+	  s_FrameBufferPoolTotal += size;
+	  return;
+	}
+    }
+
+  frame_buffer_block_free(data, size, mapped);
+}
+
+//
+void
+ASDCP::FrameBufferPoolFlush()
+{
+  Kumu::AutoMutex Lock(s_FrameBufferPoolLock);
+
+  for ( ui32_t i = 0; i < s_FrameBufferPoolCount; i++ )
+    frame_buffer_block_free(s_FrameBufferPool[i].Data, s_FrameBufferPool[i].Size, s_FrameBufferPool[i].Mapped);
+
+  s_FrameBufferPoolCount = 0;
+  s_FrameBufferPoolTotal = 0;
+}
+
+//
+void
+ASDCP::FrameBufferHugePages(bool enable)
+{
+  Kumu::AutoMutex Lock(s_FrameBufferPoolLock);
+  s_FrameBufferHuge = enable;
+}
+
+//
+void
+ASDCP::FrameBufferHugePageStats(ui32_t& explicit_pages, ui32_t& transparent, ui32_t& fallback)
+{
+  Kumu::AutoMutex Lock(s_FrameBufferPoolLock);
+  explicit_pages = s_FrameBufferHugeExplicit;
+  transparent = s_FrameBufferHugeTransparent;
+  fallback = s_FrameBufferHugeFallback;
+}
+
 //------------------------------------------------------------------------------------------
 //
 // frame buffer base class implementation
 
 ASDCP::FrameBuffer::FrameBuffer() :
-  m_Data(0), m_Capacity(0), m_OwnMem(false), m_Size(0),
-  m_FrameNumber(0), m_SourceLength(0), m_PlaintextOffset(0)
+  m_Data(0), m_Capacity(0), m_Allocated(0), m_Mapped(false), m_OwnMem(false), m_Size(0),
+  m_FrameNumber(0), m_SourceLength(0), m_PlaintextOffset(0),
+  m_AllowView(false), m_View(false)
 {
 }
 
 ASDCP::FrameBuffer::~FrameBuffer()
 {
   if ( m_OwnMem && m_Data != 0 )
-    free(m_Data);
+    frame_buffer_pool_give(m_Data, m_Allocated, m_Mapped);
 }
 
 // Instructs the object to use an externally allocated buffer. The external
@@ -103,6 +348,8 @@ ASDCP::FrameBuffer::~FrameBuffer()
 ASDCP::Result_t
 ASDCP::FrameBuffer::SetData(byte_t* buf_addr, ui32_t buf_size)
 {
+  m_View = false;
+
   // if buf_addr is null and we have an external memory reference,
   // drop the reference and place the object in the initialized-
   // but-no-buffer-allocated state
@@ -118,9 +365,11 @@ ASDCP::FrameBuffer::SetData(byte_t* buf_addr, ui32_t buf_size)
     }
 
   if ( m_OwnMem && m_Data != 0 )
-    free(m_Data);
+    frame_buffer_pool_give(m_Data, m_Allocated, m_Mapped);
 
   m_OwnMem = false;
+  m_Allocated = 0;
+  m_Mapped = false;
   m_Capacity = buf_size;
   m_Data = buf_addr;
   m_Size = 0;
@@ -134,21 +383,36 @@ ASDCP::FrameBuffer::SetData(byte_t* buf_addr, ui32_t buf_size)
 ASDCP::Result_t
 ASDCP::FrameBuffer::Capacity(ui32_t cap_size)
 {
+  if ( m_View )
+    SetData(0, 0);
+
   if ( ! m_OwnMem && m_Data != 0 )
     return RESULT_CAPEXTMEM; // cannot resize external memory
 
   if ( m_Capacity < cap_size )
     {
+      // the headroom of the allocation takes it
+      if ( m_Data != 0 && cap_size <= m_Allocated )
+	{
+	  m_Capacity = cap_size;
+	  m_Size = 0;
+	  return RESULT_OK;
+	}
+
       if ( m_Data != 0 )
 	{
 	  assert(m_OwnMem);
-	  free(m_Data);
+	  frame_buffer_pool_give(m_Data, m_Allocated, m_Mapped);
 	}
 
-      m_Data = (byte_t*)malloc(cap_size);
+      m_Data = frame_buffer_pool_take(cap_size, &m_Allocated, &m_Mapped);
 
       if ( m_Data == 0 )
-	return RESULT_ALLOC;
+	{
+	  m_Capacity = m_Allocated = 0;
+	  m_Mapped = false;
+	  return RESULT_ALLOC;
+	}
 
       m_Capacity = cap_size;
       m_OwnMem = true;
@@ -158,6 +422,16 @@ ASDCP::FrameBuffer::Capacity(ui32_t cap_size)
   return RESULT_OK;
 }
 
+// The view is never written through or freed, m_OwnMem stays false so
+// the buffer treats it as external memory.
+void
+ASDCP::FrameBuffer::SetView(const byte_t* buf_addr, ui32_t size)
+{
+  SetData(const_cast<byte_t*>(buf_addr), size);
+  m_Size = size;
+  m_View = ( buf_addr != 0 );
+}
+
 
 //
 // end AS_DCP.cpp
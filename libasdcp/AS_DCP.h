@@ -93,6 +93,7 @@ This project depends upon the following libraries:
 #include <string>
 #include <cstring>
 #include <list>
+#include <map>
 
 //--------------------------------------------------------------------------------
 // common integer types
@@ -523,6 +524,8 @@ namespace ASDCP {
     protected:
       byte_t* m_Data;          // pointer to memory area containing frame data
       ui32_t  m_Capacity;      // size of memory area pointed to by m_Data
+      ui32_t  m_Allocated;     // size of the owned allocation behind m_Data, at least m_Capacity
+      bool    m_Mapped;        // the owned allocation is a huge page mapping, not heap memory
       bool    m_OwnMem;        // if false, m_Data points to externally allocated memory
       ui32_t  m_Size;          // size of frame data in memory area pointed to by m_Data
       ui32_t  m_FrameNumber;   // delivery-order frame number
@@ -537,6 +540,8 @@ namespace ASDCP {
       // following variables:
       ui32_t  m_SourceLength;       // plaintext length (delivered plaintext+decrypted ciphertext)
       ui32_t  m_PlaintextOffset;    // offset to first byte of ciphertext
+      bool    m_AllowView;          // a reader may point m_Data at its mapped file
+      bool    m_View;               // m_Data points into a reader's mapped file
 
      public:
       FrameBuffer();
@@ -550,9 +555,22 @@ namespace ASDCP {
 
       // Sets the size of the internally allocate buffer. Returns RESULT_CAPEXTMEM
       // if the object is using an externally allocated buffer via SetData();
-      // Resets content size to zero.
+      // Resets content size to zero. A view is dropped first. The capacity
+      // never shrinks. Memory comes from the frame buffer pool with some
+      // headroom, so a buffer that grows by a little does not reallocate.
       Result_t Capacity(ui32_t cap);
 
+      // Lets a reader deliver unencrypted essence as a view into the memory
+      // mapped file instead of copying it into the buffer. A view is read-only
+      // and valid until the reader is closed; reading another frame into the
+      // buffer replaces it.
+      inline void    AllowView(bool allow) { m_AllowView = allow; }
+      inline bool    AllowView() const { return m_AllowView; }
+      inline bool    IsView() const { return m_View; }
+
+      // Used by readers, points the buffer at size bytes of mapped file data.
+      void           SetView(const byte_t* buf_addr, ui32_t size);
+
       // returns the size of the buffer
       inline ui32_t  Capacity() const { return m_Capacity; }
 
@@ -589,6 +607,25 @@ namespace ASDCP {
       inline ui32_t  PlaintextOffset() const { return m_PlaintextOffset; }
     };
 
+  // Encrypts a frame into an encrypted source value (IV, check value,
+  // plaintext region and ciphertext) using the context's current IV.
+  Result_t EncryptFrameBuffer(const ASDCP::FrameBuffer&, ASDCP::FrameBuffer&, AESEncContext*);
+
+  // The memory of destroyed and regrown frame buffers is kept in a process
+  // wide pool and handed to the next buffer that needs about that much, so
+  // the readers, writers and pipelines of a reel stop allocating once the
+  // largest frames have been seen. Releases the pooled memory.
+  void FrameBufferPoolFlush();
+
+  // Maps frame buffer blocks of 2 MB and more allocated from then on with
+  // huge pages, explicit ones where reserved, otherwise transparent ones.
+  // A block the system grants neither comes from the heap. Disabled by default.
+  void FrameBufferHugePages(bool enable);
+
+  // Counts the blocks mapped with explicit and with transparent huge pages,
+  // and the blocks that fell back to the heap.
+  void FrameBufferHugePageStats(ui32_t& explicit_pages, ui32_t& transparent, ui32_t& fallback);
+
   //---------------------------------------------------------------------------------
   // Accessors in the MXFReader and MXFWriter classes below return these types to
   // provide direct access to MXF metadata structures declared in MXF.h and Metadata.h
@@ -600,6 +637,12 @@ namespace ASDCP {
     class RIP;
   };
 
+  // As EssenceType() above, but leaves the parsed header partition in the given
+  // OP1aHeader (which should use DefaultCompositeDict()) so that its metadata can
+  // be inspected without opening the file with a full MXFReader. Only the header
+  // partition is read; the index and footer are not touched.
+  Result_t EssenceType(const std::string& filename, EssenceType_t& type, MXF::OP1aHeader& header);
+
   //---------------------------------------------------------------------------------
   // MPEG2 video elementary stream support
 
@@ -775,6 +818,24 @@ namespace ASDCP {
 
 	  // Closes the MXF file, writing the index and revised header.
 	  Result_t Finalize();
+
+	  // Computes the SHA-1 of the MXF file while it is written. Call after OpenWrite();
+	  // the 20 byte value is available from FileDigest() once Finalize() returns.
+	  Result_t EnableFileDigest();
+	  Result_t FileDigest(byte_t* digest) const;
+
+	  // Writes the file through an asynchronous I/O queue where the platform has one
+	  // (io_uring on Linux), or else through large coalesced writes. With direct_io the
+	  // aligned blocks bypass the page cache. buffer_count buffers of buffer_size bytes
+	  // are in flight at once. Call after OpenWrite(); returns RESULT_NOTIMPL where
+	  // neither is available and the file is written as before.
+	  Result_t EnableAsyncIO(bool direct_io = false, ui32_t buffer_count = 8,
+				 ui32_t buffer_size = 1024 * 1024);
+
+	  // Keeps the index out of memory by writing each full index segment to the
+	  // named temporary file, which Finalize() copies into the footer and removes.
+	  // Call after OpenWrite() and before the first frame.
+	  Result_t EnableIndexSpill(const std::string& filename);
 	};
 
       // A class which reads MPEG frame data from an AS-DCP format MXF file.
@@ -952,6 +1013,10 @@ namespace ASDCP {
 	  Result_t ReadFrame(FrameBuffer&) const;
 
 	  Result_t Seek(ui32_t frame_number) const;
+
+	  // Reads the file the given number of seconds at a time, ReadFrame() then
+	  // copies frames out of the buffer. Call after OpenRead().
+	  Result_t EnableReadAhead(ui32_t seconds = 4) const;
 	};
 
 
@@ -986,6 +1051,24 @@ namespace ASDCP {
 
 	  // Closes the MXF file, writing the index and revised header.
 	  Result_t Finalize();
+
+	  // Computes the SHA-1 of the MXF file while it is written. Call after OpenWrite();
+	  // the 20 byte value is available from FileDigest() once Finalize() returns.
+	  Result_t EnableFileDigest();
+	  Result_t FileDigest(byte_t* digest) const;
+
+	  // Writes the file through an asynchronous I/O queue where the platform has one
+	  // (io_uring on Linux), or else through large coalesced writes. With direct_io the
+	  // aligned blocks bypass the page cache. buffer_count buffers of buffer_size bytes
+	  // are in flight at once. Call after OpenWrite(); returns RESULT_NOTIMPL where
+	  // neither is available and the file is written as before.
+	  Result_t EnableAsyncIO(bool direct_io = false, ui32_t buffer_count = 8,
+				 ui32_t buffer_size = 1024 * 1024);
+
+	  // Hands a copy of every write of the file to the observer, e.g. to upload it
+	  // while it is written. Call after OpenWrite() and before the first frame; the
+	  // observer must outlive the writer or its Finalize().
+	  Result_t SetWriteObserver(Kumu::WriteObserver* observer);
 	};
 
       //
@@ -1029,6 +1112,12 @@ namespace ASDCP {
 	  // out of range, or if optional decrypt or HAMC operations fail.
 	  Result_t ReadFrame(ui32_t frame_number, FrameBuffer&, AESDecContext* = 0, HMACContext* = 0) const;
 
+	  // Reads frame_count frames starting at frame_number into the given buffers,
+	  // one per frame. Frames that follow each other in the file are fetched with
+	  // a single large read. Decryption and HMAC work as for ReadFrame().
+	  Result_t ReadFrames(ui32_t frame_number, ui32_t frame_count, FrameBuffer** FrameBufs,
+			      AESDecContext* = 0, HMACContext* = 0) const;
+
 	  // Using the index table read from the footer partition, lookup the frame number
 	  // and return the offset into the file at which to read that frame of essence.
 	  // Returns RESULT_INIT if the file is not open, and RESULT_RANGE if the frame number is
@@ -1148,6 +1237,11 @@ namespace ASDCP {
 	  // encrypted headers.
 	  Result_t OpenReadFrame(const std::string& filename, FrameBuffer&) const;
 
+	  // Opens a file for reading and parses only the codestream header. The
+	  // file is read in small pieces up to the SOD marker, the frame data is
+	  // not loaded. Use this when only FillPictureDescriptor() is needed.
+	  Result_t OpenReadHeader(const std::string& filename) const;
+
 	  // Fill a PictureDescriptor struct with the values from the file's codestream.
 	  // Returns RESULT_INIT if the file is not open.
 	  Result_t FillPictureDescriptor(PictureDescriptor&) const;
@@ -1174,8 +1268,8 @@ namespace ASDCP {
 	  // alphabetically by filename. The parser will automatically parse enough data
 	  // from the first file to provide a complete set of stream metadata for the
 	  // MXFWriter below.  If the "pedantic" parameter is given and is true, the
-	  // parser will check the metadata for each codestream and fail if a
-	  // mismatch is detected.
+	  // parser will read the main header of every codestream before returning
+	  // and fail, logging each offending file, if a mismatch is detected.
 	  Result_t OpenRead(const std::string& filename, bool pedantic = false) const;
 
 	  // Opens a file sequence for reading.  The sequence is expected to contain one or
@@ -1183,8 +1277,8 @@ namespace ASDCP {
 	  // picture. The parser will automatically parse enough data
 	  // from the first file to provide a complete set of stream metadata for the
 	  // MXFWriter below.  If the "pedantic" parameter is given and is true, the
-	  // parser will check the metadata for each codestream and fail if a
-	  // mismatch is detected.
+	  // parser will read the main header of every codestream before returning
+	  // and fail, logging each offending file, if a mismatch is detected.
 	  Result_t OpenRead(const std::list<std::string>& file_list, bool pedantic = false) const;
 
 	  // Fill a PictureDescriptor struct with the values from the first file's codestream.
@@ -1227,14 +1321,78 @@ namespace ASDCP {
 	  Result_t OpenWrite(const std::string& filename, const WriterInfo&,
 			     const PictureDescriptor&, ui32_t HeaderSize = 16384);
 
+	  // Reopens a file left unfinished by an interrupted writer. The header and
+	  // body partition are written again, so the WriterInfo (AssetUUID, ContextID,
+	  // label set), PictureDescriptor and HeaderSize must be those the file was
+	  // opened with. Enable the digest, async I/O or index spill as after
+	  // OpenWrite(), then call ResumeFrames() before the next frame.
+	  Result_t OpenResume(const std::string& filename, const WriterInfo&,
+			      const PictureDescriptor&, ui32_t HeaderSize = 16384);
+
+	  // Indexes the complete frames already in the file, at most frames of them,
+	  // cuts off whatever follows them and continues the file from there. The
+	  // frames kept are returned in recovered, the next WriteFrame() writes frame
+	  // number recovered.
+	  Result_t ResumeFrames(ui32_t frames, ui32_t& recovered);
+
+	  // Writes out the frames held in buffers and commits the file to disk.
+	  // Returns the frames written, which a later ResumeFrames() can keep.
+	  Result_t Checkpoint(ui32_t& frames);
+
+	  // Appends frame_count frames of the picture track file filename, starting at
+	  // frame_number, copied as they are stored. The packets are not parsed,
+	  // decrypted or hashed again, so the file must use the same label set and
+	  // cryptographic context, and with HMAC the frames must keep their frame
+	  // numbers and the asset UUID of the file they come from.
+	  Result_t CopyFrames(const std::string& filename, ui32_t frame_number, ui32_t frame_count);
+
+	  // Numbers the frames of the file from frame_number on in their integrity
+	  // packs, for a run of frames that CopyFrames() will put at frame_number of
+	  // another file with the same AssetUUID. The file itself still starts at its
+	  // frame 0, so its own HMAC checks fail. Call before the first frame.
+	  Result_t SetFirstFrameNumber(ui32_t frame_number);
+
 	  // Writes a frame of essence to the MXF file. If the optional AESEncContext
 	  // argument is present, the essence is encrypted prior to writing.
 	  // Fails if the file is not open, is finalized, or an operating system
 	  // error occurs.
 	  Result_t WriteFrame(const FrameBuffer&, AESEncContext* = 0, HMACContext* = 0);
 
+	  // Writes a frame already encrypted into the second buffer with
+	  // EncryptFrameBuffer(), so frames can be encrypted on other threads.
+	  // The first buffer must hold the plaintext frame that was encrypted.
+	  Result_t WriteEncryptedFrame(const FrameBuffer&, const ASDCP::FrameBuffer&, HMACContext* = 0);
+
 	  // Closes the MXF file, writing the index and revised header.
 	  Result_t Finalize();
+
+	  // Computes the SHA-1 of the MXF file while it is written. Call after OpenWrite();
+	  // the 20 byte value is available from FileDigest() once Finalize() returns.
+	  Result_t EnableFileDigest();
+	  Result_t FileDigest(byte_t* digest) const;
+
+	  // Writes the file through an asynchronous I/O queue where the platform has one
+	  // (io_uring on Linux), or else through large coalesced writes. With direct_io the
+	  // aligned blocks bypass the page cache. buffer_count buffers of buffer_size bytes
+	  // are in flight at once. Call after OpenWrite(); returns RESULT_NOTIMPL where
+	  // neither is available and the file is written as before.
+	  Result_t EnableAsyncIO(bool direct_io = false, ui32_t buffer_count = 8,
+				 ui32_t buffer_size = 1024 * 1024);
+
+	  // Reserves disk space for a file of up to size bytes, so a long track is laid
+	  // out in few extents. What the track does not use is released by Finalize().
+	  // Call after OpenWrite(); returns RESULT_NOTIMPL where space cannot be reserved.
+	  Result_t Preallocate(ui64_t size);
+
+	  // Keeps the index out of memory by writing each full index segment to the
+	  // named temporary file, which Finalize() copies into the footer and removes.
+	  // Call after OpenWrite() and before the first frame.
+	  Result_t EnableIndexSpill(const std::string& filename);
+
+	  // Hands a copy of every write of the file to the observer, e.g. to upload it
+	  // while it is written. Call after OpenWrite() and before the first frame; the
+	  // observer must outlive the writer or its Finalize().
+	  Result_t SetWriteObserver(Kumu::WriteObserver* observer);
 	};
 
       //
@@ -1276,8 +1434,17 @@ namespace ASDCP {
 	  // not NULL, the HMAC will be calculated (if the file supports it).
 	  // Returns RESULT_INIT if the file is not open, failure if the frame number is
 	  // out of range, or if optional decrypt or HAMC operations fail.
+	  // ReadFrame() may be called from several threads at once on one open
+	  // reader, provided each thread has its own FrameBuffer and contexts;
+	  // frames are read at their offsets and do not share a file position.
 	  Result_t ReadFrame(ui32_t frame_number, FrameBuffer&, AESDecContext* = 0, HMACContext* = 0) const;
 
+	  // Reads frame_count frames starting at frame_number into the given buffers,
+	  // one per frame. Frames that follow each other in the file are fetched with
+	  // a single large read. Decryption and HMAC work as for ReadFrame().
+	  Result_t ReadFrames(ui32_t frame_number, ui32_t frame_count, FrameBuffer** FrameBufs,
+			      AESDecContext* = 0, HMACContext* = 0) const;
+
 	  // Using the index table read from the footer partition, lookup the frame number
 	  // and return the offset into the file at which to read that frame of essence.
 	  // Returns RESULT_INIT if the file is not open, and RESULT_FRAME if the frame number is
@@ -1347,9 +1514,43 @@ namespace ASDCP {
 	  Result_t WriteFrame(const FrameBuffer&, StereoscopicPhase_t phase,
 			      AESEncContext* = 0, HMACContext* = 0);
 
+	  // Writes a frame already encrypted into the second buffer with
+	  // EncryptFrameBuffer(), in the same phase order as WriteFrame().
+	  // The first buffer must hold the plaintext frame that was encrypted.
+	  Result_t WriteEncryptedFrame(const FrameBuffer&, const ASDCP::FrameBuffer&,
+				       StereoscopicPhase_t phase, HMACContext* = 0);
+
 	  // Closes the MXF file, writing the index and revised header.  Returns
 	  // RESULT_SPHASE if WriteFrame was called an odd number of times.
 	  Result_t Finalize();
+
+	  // Computes the SHA-1 of the MXF file while it is written. Call after OpenWrite();
+	  // the 20 byte value is available from FileDigest() once Finalize() returns.
+	  Result_t EnableFileDigest();
+	  Result_t FileDigest(byte_t* digest) const;
+
+	  // Writes the file through an asynchronous I/O queue where the platform has one
+	  // (io_uring on Linux), or else through large coalesced writes. With direct_io the
+	  // aligned blocks bypass the page cache. buffer_count buffers of buffer_size bytes
+	  // are in flight at once. Call after OpenWrite(); returns RESULT_NOTIMPL where
+	  // neither is available and the file is written as before.
+	  Result_t EnableAsyncIO(bool direct_io = false, ui32_t buffer_count = 8,
+				 ui32_t buffer_size = 1024 * 1024);
+
+	  // Reserves disk space for a file of up to size bytes, so a long track is laid
+	  // out in few extents. What the track does not use is released by Finalize().
+	  // Call after OpenWrite(); returns RESULT_NOTIMPL where space cannot be reserved.
+	  Result_t Preallocate(ui64_t size);
+
+	  // Keeps the index out of memory by writing each full index segment to the
+	  // named temporary file, which Finalize() copies into the footer and removes.
+	  // Call after OpenWrite() and before the first frame.
+	  Result_t EnableIndexSpill(const std::string& filename);
+
+	  // Hands a copy of every write of the file to the observer, e.g. to upload it
+	  // while it is written. Call after OpenWrite() and before the first frame; the
+	  // observer must outlive the writer or its Finalize().
+	  Result_t SetWriteObserver(Kumu::WriteObserver* observer);
 	};
 
       //
@@ -1403,6 +1604,13 @@ namespace ASDCP {
 	  Result_t ReadFrame(ui32_t frame_number, StereoscopicPhase_t phase,
 			     FrameBuffer&, AESDecContext* = 0, HMACContext* = 0) const;
 
+	  // Reads the left eye of a frame at its offset in the file, without
+	  // reading the right eye and without moving the position the ReadFrame
+	  // calls use, so several threads can share the reader. A plaintext frame
+	  // is a view of the mapped file when the buffer allows views. Decryption
+	  // and HMAC are as for ReadFrame.
+	  Result_t ReadLeftFrame(ui32_t frame_number, FrameBuffer&, AESDecContext* = 0, HMACContext* = 0) const;
+
 	  // Using the index table read from the footer partition, lookup the frame number
 	  // and return the offset into the file at which to read that frame of essence.
 	  // Returns RESULT_INIT if the file is not open, and RESULT_FRAME if the frame number is
@@ -1482,11 +1690,14 @@ namespace ASDCP {
       };
 
       // Resolves resource references by testing the named directory for file names containing
-      // the respective UUID.
+      // the respective UUID. The directory tree is scanned once by OpenRead(), ResolveRID()
+      // looks the UUID up in that index and may be called from several threads at once.
       //
       class LocalFilenameResolver : public ASDCP::TimedText::IResourceResolver
 	{
 	  std::string m_Dirname;
+	  std::multimap<std::string, std::string> m_Index; // UUID in file name -> path
+	  void IndexPath(const std::string& dirname);
 	  ASDCP_NO_COPY_CONSTRUCT(LocalFilenameResolver);
 
 	public:
@@ -1575,6 +1786,19 @@ namespace ASDCP {
 
 	  // Closes the MXF file, writing the index and revised header.
 	  Result_t Finalize();
+
+	  // Computes the SHA-1 of the MXF file while it is written. Call after OpenWrite();
+	  // the 20 byte value is available from FileDigest() once Finalize() returns.
+	  Result_t EnableFileDigest();
+	  Result_t FileDigest(byte_t* digest) const;
+
+	  // Writes the file through an asynchronous I/O queue where the platform has one
+	  // (io_uring on Linux), or else through large coalesced writes. With direct_io the
+	  // aligned blocks bypass the page cache. buffer_count buffers of buffer_size bytes
+	  // are in flight at once. Call after OpenWrite(); returns RESULT_NOTIMPL where
+	  // neither is available and the file is written as before.
+	  Result_t EnableAsyncIO(bool direct_io = false, ui32_t buffer_count = 8,
+				 ui32_t buffer_size = 1024 * 1024);
 	};
 
       //
@@ -1711,9 +1935,15 @@ namespace ASDCP {
 
 	  // Opens a file sequence for reading.  The sequence is expected to contain one or
 	  // more filenames, each naming a file containing the bytestream for exactly one
-	  // frame.
+	  // frame. The files are read ahead in batches, several at a time.
 	  Result_t OpenRead(const std::list<std::string>& file_list) const;
 
+	  // Opens a single file holding the bytestreams of all frames back to back.
+	  // With a frame_size the frames are that many bytes each, otherwise they
+	  // are split on their IA bitstream framing (SMPTE ST 2098-2). The file is
+	  // read in large blocks and the frames are cut out of them.
+	  Result_t OpenReadStream(const std::string& filename, ui32_t frame_size = 0) const;
+
 	  // Fill a DCDataDescriptor struct with default values.
 	  // Returns RESULT_INIT if the directory is not open.
 	  Result_t FillDCDataDescriptor(DCDataDescriptor&) const;
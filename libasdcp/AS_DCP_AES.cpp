@@ -134,23 +134,9 @@ ASDCP::AESEncContext::EncryptBlock(const byte_t* pt_buf, byte_t* ct_buf, ui32_t
     return  RESULT_INIT;
 
   h__AESContext* Ctx = m_Context;
-  byte_t tmp_buf[CBC_BLOCK_SIZE];
-  const byte_t* in_p = pt_buf;
-  byte_t* out_p = ct_buf;
 
-  while ( block_size )
-    {
-      // xor with the previous block
-      for ( ui32_t i = 0; i < CBC_BLOCK_SIZE; i++ )
-	tmp_buf[i] = in_p[i] ^ Ctx->m_IVec[i]; 
-          
-      AES_encrypt(tmp_buf, Ctx->m_IVec, Ctx);
-      memcpy(out_p, Ctx->m_IVec, CBC_BLOCK_SIZE);
-
-      in_p += CBC_BLOCK_SIZE;
-      out_p += CBC_BLOCK_SIZE;
-      block_size -= CBC_BLOCK_SIZE;
-    }
+  // chains from and leaves the last ciphertext block in m_IVec
+  AES_cbc_encrypt(pt_buf, ct_buf, block_size, Ctx, Ctx->m_IVec, AES_ENCRYPT);
 
   return RESULT_OK;
 }
@@ -219,24 +205,10 @@ ASDCP::AESDecContext::DecryptBlock(const byte_t* ct_buf, byte_t* pt_buf, ui32_t
   if ( m_Context.empty() )
     return  RESULT_INIT;
 
-  register h__AESContext* Ctx = m_Context;
-
-  const byte_t* in_p = ct_buf;
-  byte_t* out_p = pt_buf;
-
-  while ( block_size )
-    {
-      AES_decrypt(in_p, out_p, Ctx);  
-
-      for ( ui32_t i = 0; i < CBC_BLOCK_SIZE; i++ )
-	out_p[i] ^= Ctx->m_IVec[i];
-
-      memcpy(Ctx->m_IVec, in_p, CBC_BLOCK_SIZE);
+  h__AESContext* Ctx = m_Context;
 
-      in_p += CBC_BLOCK_SIZE;
-      out_p += CBC_BLOCK_SIZE;
-      block_size -= CBC_BLOCK_SIZE;
-    }
+  // leaves the last ciphertext block in m_IVec for the next call
+  AES_cbc_encrypt(ct_buf, pt_buf, block_size, Ctx, Ctx->m_IVec, AES_DECRYPT);
 
   return RESULT_OK;
 }
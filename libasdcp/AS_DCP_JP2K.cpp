@@ -625,6 +625,21 @@ ASDCP::JP2K::MXFReader::ReadFrame(ui32_t FrameNum, FrameBuffer& FrameBuf,
   return RESULT_INIT;
 }
 
+//
+ASDCP::Result_t
+ASDCP::JP2K::MXFReader::ReadFrames(ui32_t FrameNum, ui32_t FrameCount, FrameBuffer** FrameBufs,
+				    AESDecContext* Ctx, HMACContext* HMAC) const
+{
+  if ( ! ( m_Reader && m_Reader->m_File.IsOpen() ) )
+    return RESULT_INIT;
+
+  ASDCP_TEST_NULL(FrameBufs);
+  std::vector<ASDCP::FrameBuffer*> Bufs(FrameBufs, FrameBufs + FrameCount);
+  assert(m_Reader->m_Dict);
+  return m_Reader->ReadEKLVFrames(FrameNum, FrameCount, Bufs.empty() ? 0 : &Bufs[0],
+				  m_Reader->m_Dict->ul(MDD_JPEG2000Essence), Ctx, HMAC);
+}
+
 ASDCP::Result_t
 ASDCP::JP2K::MXFReader::LocateFrame(ui32_t FrameNum, Kumu::fpos_t& streamOffset, i8_t& temporalOffset, i8_t& keyFrameOffset) const
 {
@@ -771,6 +786,16 @@ public:
 
     return result;
   }
+
+  // the index points at the left eye, the right eye is left unread
+  Result_t ReadLeftFrame(ui32_t FrameNum, FrameBuffer& FrameBuf, AESDecContext* Ctx, HMACContext* HMAC)
+  {
+    if ( ! m_File.IsOpen() )
+      return RESULT_INIT;
+
+    assert(m_Dict);
+    return ReadLeadingEKLVFrame(FrameNum, FrameNum * 2 + 1, FrameBuf, m_Dict->ul(MDD_JPEG2000Essence), Ctx, HMAC);
+  }
 };
 
 
@@ -868,6 +893,16 @@ ASDCP::JP2K::MXFSReader::ReadFrame(ui32_t FrameNum, StereoscopicPhase_t phase, F
   return RESULT_INIT;
 }
 
+//
+ASDCP::Result_t
+ASDCP::JP2K::MXFSReader::ReadLeftFrame(ui32_t FrameNum, FrameBuffer& FrameBuf, AESDecContext* Ctx, HMACContext* HMAC) const
+{
+  if ( m_Reader )
+    return m_Reader->ReadLeftFrame(FrameNum, FrameBuf, Ctx, HMAC);
+
+  return RESULT_INIT;
+}
+
 ASDCP::Result_t
 ASDCP::JP2K::MXFSReader::LocateFrame(ui32_t FrameNum, Kumu::fpos_t& streamOffset, i8_t& temporalOffset, i8_t& keyFrameOffset) const
 {
@@ -945,6 +980,8 @@ class lh__Writer : public ASDCP::h__ASDCPWriter
 
   JPEG2000PictureSubDescriptor* m_EssenceSubDescriptor;
 
+  Result_t InitDescriptors(EssenceType_t type, ui32_t HeaderSize);
+
 public:
   PictureDescriptor m_PDesc;
   byte_t            m_EssenceUL[SMPTE_UL_LENGTH];
@@ -956,9 +993,15 @@ public:
   virtual ~lh__Writer(){}
 
   Result_t OpenWrite(const std::string&, EssenceType_t type, ui32_t HeaderSize);
+  Result_t OpenResume(const std::string&, EssenceType_t type, ui32_t HeaderSize);
   Result_t SetSourceStream(const PictureDescriptor&, const std::string& label,
 			   ASDCP::Rational LocalEditRate = ASDCP::Rational(0,0));
-  Result_t WriteFrame(const JP2K::FrameBuffer&, bool add_index, AESEncContext*, HMACContext*);
+  Result_t ResumeFrames(ui32_t frames, ui32_t& recovered);
+  Result_t Checkpoint(ui32_t& frames);
+  Result_t CopyFrames(const std::string& filename, ui32_t frame_number, ui32_t frame_count);
+  Result_t SetFirstFrameNumber(ui32_t frame_number);
+  Result_t WriteFrame(const JP2K::FrameBuffer&, bool add_index, AESEncContext*, HMACContext*,
+		      const ASDCP::FrameBuffer* EncFrameBuf = 0);
   Result_t Finalize();
 };
 
@@ -973,33 +1016,57 @@ lh__Writer::OpenWrite(const std::string& filename, EssenceType_t type, ui32_t He
   Result_t result = m_File.OpenWrite(filename);
 
   if ( ASDCP_SUCCESS(result) )
-    {
-      m_HeaderSize = HeaderSize;
-      RGBAEssenceDescriptor* tmp_rgba = new RGBAEssenceDescriptor(m_Dict);
-      tmp_rgba->ComponentMaxRef = 4095;
-      tmp_rgba->ComponentMinRef = 0;
+    result = InitDescriptors(type, HeaderSize);
 
-      m_EssenceDescriptor = tmp_rgba;
-      m_EssenceSubDescriptor = new JPEG2000PictureSubDescriptor(m_Dict);
-      m_EssenceSubDescriptorList.push_back((InterchangeObject*)m_EssenceSubDescriptor);
+  return result;
+}
 
-      GenRandomValue(m_EssenceSubDescriptor->InstanceUID);
-      m_EssenceDescriptor->SubDescriptors.push_back(m_EssenceSubDescriptor->InstanceUID);
+// Open a partially written file to continue it. The header is written again
+// by SetSourceStream(), the frames after it are kept by ResumeFrames().
+ASDCP::Result_t
+lh__Writer::OpenResume(const std::string& filename, EssenceType_t type, ui32_t HeaderSize)
+{
+  if ( ! m_State.Test_BEGIN() )
+    return RESULT_STATE;
 
-      if ( type == ASDCP::ESS_JPEG_2000_S && m_Info.LabelSetType == LS_MXF_SMPTE )
-	{
-	  InterchangeObject* StereoSubDesc = new StereoscopicPictureSubDescriptor(m_Dict);
-	  m_EssenceSubDescriptorList.push_back(StereoSubDesc);
-	  GenRandomValue(StereoSubDesc->InstanceUID);
-	  m_EssenceDescriptor->SubDescriptors.push_back(StereoSubDesc->InstanceUID);
-	}
+  Result_t result = m_File.OpenModify(filename);
 
-      result = m_State.Goto_INIT();
-    }
+  if ( ASDCP_SUCCESS(result) )
+    result = m_File.Seek(0);
+
+  if ( ASDCP_SUCCESS(result) )
+    result = InitDescriptors(type, HeaderSize);
 
   return result;
 }
 
+//
+ASDCP::Result_t
+lh__Writer::InitDescriptors(EssenceType_t type, ui32_t HeaderSize)
+{
+  m_HeaderSize = HeaderSize;
+  RGBAEssenceDescriptor* tmp_rgba = new RGBAEssenceDescriptor(m_Dict);
+  tmp_rgba->ComponentMaxRef = 4095;
+  tmp_rgba->ComponentMinRef = 0;
+
+  m_EssenceDescriptor = tmp_rgba;
+  m_EssenceSubDescriptor = new JPEG2000PictureSubDescriptor(m_Dict);
+  m_EssenceSubDescriptorList.push_back((InterchangeObject*)m_EssenceSubDescriptor);
+
+  GenRandomValue(m_EssenceSubDescriptor->InstanceUID);
+  m_EssenceDescriptor->SubDescriptors.push_back(m_EssenceSubDescriptor->InstanceUID);
+
+  if ( type == ASDCP::ESS_JPEG_2000_S && m_Info.LabelSetType == LS_MXF_SMPTE )
+    {
+      InterchangeObject* StereoSubDesc = new StereoscopicPictureSubDescriptor(m_Dict);
+      m_EssenceSubDescriptorList.push_back(StereoSubDesc);
+      GenRandomValue(StereoSubDesc->InstanceUID);
+      m_EssenceDescriptor->SubDescriptors.push_back(StereoSubDesc->InstanceUID);
+    }
+
+  return m_State.Goto_INIT();
+}
+
 // Automatically sets the MXF file's metadata from the first jpeg codestream stream.
 ASDCP::Result_t
 lh__Writer::SetSourceStream(const PictureDescriptor& PDesc, const std::string& label, ASDCP::Rational LocalEditRate)
@@ -1054,7 +1121,7 @@ lh__Writer::SetSourceStream(const PictureDescriptor& PDesc, const std::string& l
 //
 ASDCP::Result_t
 lh__Writer::WriteFrame(const JP2K::FrameBuffer& FrameBuf, bool add_index,
-		       AESEncContext* Ctx, HMACContext* HMAC)
+		       AESEncContext* Ctx, HMACContext* HMAC, const ASDCP::FrameBuffer* EncFrameBuf)
 {
   Result_t result = RESULT_OK;
 
@@ -1064,7 +1131,7 @@ lh__Writer::WriteFrame(const JP2K::FrameBuffer& FrameBuf, bool add_index,
   ui64_t StreamOffset = m_StreamOffset;
 
   if ( ASDCP_SUCCESS(result) )
-    result = WriteEKLVPacket(FrameBuf, m_EssenceUL, Ctx, HMAC);
+    result = WriteEKLVPacket(FrameBuf, m_EssenceUL, Ctx, HMAC, EncFrameBuf);
 
   if ( ASDCP_SUCCESS(result) && add_index )
     {  
@@ -1078,6 +1145,200 @@ lh__Writer::WriteFrame(const JP2K::FrameBuffer& FrameBuf, bool add_index,
 }
 
 
+// Walks the essence packets that follow the header written again by
+// SetSourceStream(), indexing them as WriteFrame() did. Only the packet keys
+// and lengths are read. The first packet that is not complete ends the
+// frames kept, the file is cut there and writing goes on after the last one.
+ASDCP::Result_t
+lh__Writer::ResumeFrames(ui32_t frames, ui32_t& recovered)
+{
+  if ( ! m_State.Test_READY() )
+    return RESULT_STATE;
+
+  const byte_t* key = m_Info.EncryptedEssence ? m_Dict->ul(MDD_CryptEssence) : m_EssenceUL;
+  Kumu::fpos_t here = m_File.Tell();
+  Kumu::fsize_t size = m_File.Size();
+  Result_t result = RESULT_OK;
+  byte_t klv[SMPTE_UL_LENGTH + 9];
+  ui32_t read_count;
+
+  recovered = 0;
+
+  while ( recovered < frames && here + SMPTE_UL_LENGTH + 1 < size )
+    {
+      ui64_t length = 0;
+
+      result = m_File.Seek(here);
+
+      if ( ASDCP_SUCCESS(result) )
+	result = m_File.Read(klv, (ui32_t)std::min<Kumu::fsize_t>(sizeof(klv), size - here), &read_count);
+
+      if ( ASDCP_FAILURE(result) )
+	break;
+
+      ui32_t ber_size = Kumu::BER_length(klv + SMPTE_UL_LENGTH);
+
+      if ( memcmp(klv, key, SMPTE_UL_LENGTH) != 0 || ber_size == 0 || SMPTE_UL_LENGTH + ber_size > read_count
+	   || ! Kumu::read_BER(klv + SMPTE_UL_LENGTH, &length) )
+	break;
+
+      ui64_t packet_length = SMPTE_UL_LENGTH + ber_size + length;
+
+      if ( (ui64_t)here + packet_length > (ui64_t)size )
+	break;
+
+      IndexTableSegment::IndexEntry Entry;
+      Entry.StreamOffset = m_StreamOffset;
+      m_FooterPart.PushIndexEntry(Entry);
+
+      m_StreamOffset += packet_length;
+      here += packet_length;
+      recovered++;
+    }
+
+  if ( result == RESULT_ENDOFFILE )
+    result = RESULT_OK;
+
+  m_FramesWritten = recovered;
+
+  if ( ASDCP_SUCCESS(result) )
+    result = m_File.Truncate(here);
+
+  if ( ASDCP_SUCCESS(result) )
+    result = m_File.Seek(here);
+
+  if ( ASDCP_SUCCESS(result) )
+    result = m_State.Goto_RUNNING();
+
+  return result;
+}
+
+// Writes out the queued frames and commits them to disk.
+ASDCP::Result_t
+lh__Writer::Checkpoint(ui32_t& frames)
+{
+  if ( ! m_State.Test_READY() && ! m_State.Test_RUNNING() )
+    return RESULT_STATE;
+
+  frames = m_FramesWritten;
+  return m_File.Sync();
+}
+
+
+// Copies the essence packets of a run of frames from another picture track
+// file as they are, indexing them from the source index. Only the key and
+// length of the first and last packets are read.
+ASDCP::Result_t
+lh__Writer::CopyFrames(const std::string& filename, ui32_t frame_number, ui32_t frame_count)
+{
+  if ( m_State.Test_READY() )
+    {
+      Result_t result = m_State.Goto_RUNNING(); // first time through
+
+      if ( ASDCP_FAILURE(result) )
+	return result;
+    }
+
+  if ( ! m_State.Test_RUNNING() )
+    return RESULT_STATE;
+
+  if ( frame_count == 0 )
+    return RESULT_OK;
+
+  JP2K::MXFReader   Reader;
+  PictureDescriptor PDesc;
+  WriterInfo        Info;
+  Kumu::FileReader  File;
+  std::vector<Kumu::fpos_t> Offsets(frame_count + 1);
+  i8_t temporal_offset, key_frame_offset;
+
+  PDesc.ContainerDuration = 0;
+  Result_t result = Reader.OpenRead(filename);
+
+  if ( ASDCP_SUCCESS(result) )
+    result = Reader.FillPictureDescriptor(PDesc);
+
+  if ( ASDCP_SUCCESS(result) )
+    result = Reader.FillWriterInfo(Info);
+
+  if ( ASDCP_SUCCESS(result) )
+    {
+      if ( (ui64_t)frame_number + frame_count > PDesc.ContainerDuration )
+	result = RESULT_RANGE;
+      else if ( Info.EncryptedEssence != m_Info.EncryptedEssence || Info.LabelSetType != m_Info.LabelSetType )
+	result = RESULT_FORMAT;
+    }
+
+  for ( ui32_t i = 0; i < frame_count && ASDCP_SUCCESS(result); i++ )
+    result = Reader.LocateFrame(frame_number + i, Offsets[i], temporal_offset, key_frame_offset);
+
+  if ( ASDCP_SUCCESS(result) )
+    result = File.OpenRead(filename);
+
+  // the last packet ends where the next frame starts or after its own length
+  const byte_t* key = m_Info.EncryptedEssence ? m_Dict->ul(MDD_CryptEssence) : m_EssenceUL;
+  Kumu::fpos_t last = Offsets[frame_count - 1];
+  byte_t klv[SMPTE_UL_LENGTH + 9];
+  ui32_t read_count = 0;
+  ui64_t length = 0;
+
+  if ( ASDCP_SUCCESS(result) )
+    result = File.Seek(last);
+
+  if ( ASDCP_SUCCESS(result) )
+    result = File.Read(klv, sizeof(klv), &read_count);
+
+  if ( ASDCP_SUCCESS(result) )
+    {
+      ui32_t ber_size = Kumu::BER_length(klv + SMPTE_UL_LENGTH);
+
+      if ( memcmp(klv, key, SMPTE_UL_LENGTH) != 0 || ber_size == 0 || SMPTE_UL_LENGTH + ber_size > read_count
+	   || ! Kumu::read_BER(klv + SMPTE_UL_LENGTH, &length) )
+	{
+	  DefaultLogSink().Error("Frame %u of %s is not a picture essence packet\n", frame_number + frame_count - 1,
+				 filename.c_str());
+	  result = RESULT_FORMAT;
+	}
+      else
+	{
+	  Offsets[frame_count] = last + SMPTE_UL_LENGTH + ber_size + length;
+	}
+    }
+
+  File.Close();
+  Reader.Close();
+
+  if ( ASDCP_SUCCESS(result) )
+    result = m_File.CopyFrom(filename, Offsets[0], Offsets[frame_count] - Offsets[0]);
+
+  if ( ASDCP_SUCCESS(result) )
+    {
+      for ( ui32_t i = 0; i < frame_count; i++ )
+	{
+	  IndexTableSegment::IndexEntry Entry;
+	  Entry.StreamOffset = m_StreamOffset + (Offsets[i] - Offsets[0]);
+	  m_FooterPart.PushIndexEntry(Entry);
+	}
+
+      m_StreamOffset += Offsets[frame_count] - Offsets[0];
+      m_FramesWritten += frame_count;
+    }
+
+  return result;
+}
+
+// The integrity packs of the frames written from here on are numbered
+// from frame_number, the index and durations are not changed.
+ASDCP::Result_t
+lh__Writer::SetFirstFrameNumber(ui32_t frame_number)
+{
+  if ( ! m_State.Test_READY() || m_FramesWritten != 0 )
+    return RESULT_STATE;
+
+  m_SequenceBase = frame_number;
+  return RESULT_OK;
+}
+
 // Closes the MXF file, writing the index and other closing information.
 //
 ASDCP::Result_t
@@ -1185,6 +1446,69 @@ ASDCP::JP2K::MXFWriter::OpenWrite(const std::string& filename, const WriterInfo&
 }
 
 
+// Open a file left unfinished by an interrupted writer, see ResumeFrames().
+ASDCP::Result_t
+ASDCP::JP2K::MXFWriter::OpenResume(const std::string& filename, const WriterInfo& Info,
+				   const PictureDescriptor& PDesc, ui32_t HeaderSize)
+{
+  if ( Info.LabelSetType == LS_MXF_SMPTE )
+    m_Writer = new h__Writer(DefaultSMPTEDict());
+  else
+    m_Writer = new h__Writer(DefaultInteropDict());
+
+  m_Writer->m_Info = Info;
+
+  Result_t result = m_Writer->OpenResume(filename, ASDCP::ESS_JPEG_2000, HeaderSize);
+
+  if ( ASDCP_SUCCESS(result) )
+    result = m_Writer->SetSourceStream(PDesc, JP2K_PACKAGE_LABEL);
+
+  if ( ASDCP_FAILURE(result) )
+    m_Writer.release();
+
+  return result;
+}
+
+//
+ASDCP::Result_t
+ASDCP::JP2K::MXFWriter::ResumeFrames(ui32_t frames, ui32_t& recovered)
+{
+  if ( m_Writer.empty() )
+    return RESULT_INIT;
+
+  return m_Writer->ResumeFrames(frames, recovered);
+}
+
+//
+ASDCP::Result_t
+ASDCP::JP2K::MXFWriter::Checkpoint(ui32_t& frames)
+{
+  if ( m_Writer.empty() )
+    return RESULT_INIT;
+
+  return m_Writer->Checkpoint(frames);
+}
+
+//
+ASDCP::Result_t
+ASDCP::JP2K::MXFWriter::CopyFrames(const std::string& filename, ui32_t frame_number, ui32_t frame_count)
+{
+  if ( m_Writer.empty() )
+    return RESULT_INIT;
+
+  return m_Writer->CopyFrames(filename, frame_number, frame_count);
+}
+
+//
+ASDCP::Result_t
+ASDCP::JP2K::MXFWriter::SetFirstFrameNumber(ui32_t frame_number)
+{
+  if ( m_Writer.empty() )
+    return RESULT_INIT;
+
+  return m_Writer->SetFirstFrameNumber(frame_number);
+}
+
 // Writes a frame of essence to the MXF file. If the optional AESEncContext
 // argument is present, the essence is encrypted prior to writing.
 // Fails if the file is not open, is finalized, or an operating system
@@ -1198,6 +1522,19 @@ ASDCP::JP2K::MXFWriter::WriteFrame(const FrameBuffer& FrameBuf, AESEncContext* C
   return m_Writer->WriteFrame(FrameBuf, true, Ctx, HMAC);
 }
 
+// Writes a frame whose essence has already been encrypted into CtFrameBuf
+// by EncryptFrameBuffer(). FrameBuf supplies the source length and plaintext
+// offset recorded in the packet.
+ASDCP::Result_t
+ASDCP::JP2K::MXFWriter::WriteEncryptedFrame(const FrameBuffer& FrameBuf, const ASDCP::FrameBuffer& CtFrameBuf,
+					    HMACContext* HMAC)
+{
+  if ( m_Writer.empty() )
+    return RESULT_INIT;
+
+  return m_Writer->WriteFrame(FrameBuf, true, 0, HMAC, &CtFrameBuf);
+}
+
 // Closes the MXF file, writing the index and other closing information.
 ASDCP::Result_t
 ASDCP::JP2K::MXFWriter::Finalize()
@@ -1208,6 +1545,66 @@ ASDCP::JP2K::MXFWriter::Finalize()
   return m_Writer->Finalize();
 }
 
+//
+ASDCP::Result_t
+ASDCP::JP2K::MXFWriter::EnableFileDigest()
+{
+  if ( m_Writer.empty() )
+    return RESULT_INIT;
+
+  return m_Writer->m_File.EnableDigest();
+}
+
+//
+ASDCP::Result_t
+ASDCP::JP2K::MXFWriter::EnableAsyncIO(bool direct_io, ui32_t buffer_count, ui32_t buffer_size)
+{
+  if ( m_Writer.empty() )
+    return RESULT_INIT;
+
+  return m_Writer->m_File.EnableQueuedWrites(direct_io, buffer_count, buffer_size);
+}
+
+//
+ASDCP::Result_t
+ASDCP::JP2K::MXFWriter::Preallocate(ui64_t size)
+{
+  if ( m_Writer.empty() )
+    return RESULT_INIT;
+
+  return m_Writer->m_File.Preallocate(size);
+}
+
+//
+ASDCP::Result_t
+ASDCP::JP2K::MXFWriter::EnableIndexSpill(const std::string& filename)
+{
+  if ( m_Writer.empty() )
+    return RESULT_INIT;
+
+  return m_Writer->m_FooterPart.EnableIndexSpill(filename);
+}
+
+//
+ASDCP::Result_t
+ASDCP::JP2K::MXFWriter::SetWriteObserver(Kumu::WriteObserver* observer)
+{
+  if ( m_Writer.empty() )
+    return RESULT_INIT;
+
+  return m_Writer->m_File.SetObserver(observer);
+}
+
+//
+ASDCP::Result_t
+ASDCP::JP2K::MXFWriter::FileDigest(byte_t* digest) const
+{
+  if ( m_Writer.empty() )
+    return RESULT_INIT;
+
+  return m_Writer->m_File.Digest(digest);
+}
+
 
 //------------------------------------------------------------------------------------------
 //
@@ -1224,7 +1621,7 @@ public:
 
   //
   Result_t WriteFrame(const FrameBuffer& FrameBuf, StereoscopicPhase_t phase,
-		      AESEncContext* Ctx, HMACContext* HMAC)
+		      AESEncContext* Ctx, HMACContext* HMAC, const ASDCP::FrameBuffer* EncFrameBuf = 0)
   {
     if ( m_NextPhase != phase )
       return RESULT_SPHASE;
@@ -1232,11 +1629,11 @@ public:
     if ( phase == SP_LEFT )
       {
 	m_NextPhase = SP_RIGHT;
-	return lh__Writer::WriteFrame(FrameBuf, true, Ctx, HMAC);
+	return lh__Writer::WriteFrame(FrameBuf, true, Ctx, HMAC, EncFrameBuf);
       }
 
     m_NextPhase = SP_LEFT;
-    return lh__Writer::WriteFrame(FrameBuf, false, Ctx, HMAC);
+    return lh__Writer::WriteFrame(FrameBuf, false, Ctx, HMAC, EncFrameBuf);
   }
 
   //
@@ -1403,6 +1800,18 @@ ASDCP::JP2K::MXFSWriter::WriteFrame(const FrameBuffer& FrameBuf, StereoscopicPha
   return m_Writer->WriteFrame(FrameBuf, phase, Ctx, HMAC);
 }
 
+// Writes a frame whose essence has already been encrypted into CtFrameBuf
+// by EncryptFrameBuffer(), in the given phase.
+ASDCP::Result_t
+ASDCP::JP2K::MXFSWriter::WriteEncryptedFrame(const FrameBuffer& FrameBuf, const ASDCP::FrameBuffer& CtFrameBuf,
+					     StereoscopicPhase_t phase, HMACContext* HMAC)
+{
+  if ( m_Writer.empty() )
+    return RESULT_INIT;
+
+  return m_Writer->WriteFrame(FrameBuf, phase, 0, HMAC, &CtFrameBuf);
+}
+
 // Closes the MXF file, writing the index and other closing information.
 ASDCP::Result_t
 ASDCP::JP2K::MXFSWriter::Finalize()
@@ -1413,6 +1822,66 @@ ASDCP::JP2K::MXFSWriter::Finalize()
   return m_Writer->Finalize();
 }
 
+//
+ASDCP::Result_t
+ASDCP::JP2K::MXFSWriter::EnableFileDigest()
+{
+  if ( m_Writer.empty() )
+    return RESULT_INIT;
+
+  return m_Writer->m_File.EnableDigest();
+}
+
+//
+ASDCP::Result_t
+ASDCP::JP2K::MXFSWriter::EnableAsyncIO(bool direct_io, ui32_t buffer_count, ui32_t buffer_size)
+{
+  if ( m_Writer.empty() )
+    return RESULT_INIT;
+
+  return m_Writer->m_File.EnableQueuedWrites(direct_io, buffer_count, buffer_size);
+}
+
+//
+ASDCP::Result_t
+ASDCP::JP2K::MXFSWriter::Preallocate(ui64_t size)
+{
+  if ( m_Writer.empty() )
+    return RESULT_INIT;
+
+  return m_Writer->m_File.Preallocate(size);
+}
+
+//
+ASDCP::Result_t
+ASDCP::JP2K::MXFSWriter::EnableIndexSpill(const std::string& filename)
+{
+  if ( m_Writer.empty() )
+    return RESULT_INIT;
+
+  return m_Writer->m_FooterPart.EnableIndexSpill(filename);
+}
+
+//
+ASDCP::Result_t
+ASDCP::JP2K::MXFSWriter::SetWriteObserver(Kumu::WriteObserver* observer)
+{
+  if ( m_Writer.empty() )
+    return RESULT_INIT;
+
+  return m_Writer->m_File.SetObserver(observer);
+}
+
+//
+ASDCP::Result_t
+ASDCP::JP2K::MXFSWriter::FileDigest(byte_t* digest) const
+{
+  if ( m_Writer.empty() )
+    return RESULT_INIT;
+
+  return m_Writer->m_File.Digest(digest);
+}
+
 //
 // end AS_DCP_JP2K.cpp
 //
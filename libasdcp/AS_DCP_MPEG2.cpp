@@ -756,6 +756,46 @@ ASDCP::MPEG2::MXFWriter::Finalize()
   return m_Writer->Finalize();
 }
 
+//
+ASDCP::Result_t
+ASDCP::MPEG2::MXFWriter::EnableFileDigest()
+{
+  if ( m_Writer.empty() )
+    return RESULT_INIT;
+
+  return m_Writer->m_File.EnableDigest();
+}
+
+//
+ASDCP::Result_t
+ASDCP::MPEG2::MXFWriter::EnableAsyncIO(bool direct_io, ui32_t buffer_count, ui32_t buffer_size)
+{
+  if ( m_Writer.empty() )
+    return RESULT_INIT;
+
+  return m_Writer->m_File.EnableQueuedWrites(direct_io, buffer_count, buffer_size);
+}
+
+//
+ASDCP::Result_t
+ASDCP::MPEG2::MXFWriter::EnableIndexSpill(const std::string& filename)
+{
+  if ( m_Writer.empty() )
+    return RESULT_INIT;
+
+  return m_Writer->m_FooterPart.EnableIndexSpill(filename);
+}
+
+//
+ASDCP::Result_t
+ASDCP::MPEG2::MXFWriter::FileDigest(byte_t* digest) const
+{
+  if ( m_Writer.empty() )
+    return RESULT_INIT;
+
+  return m_Writer->m_File.Digest(digest);
+}
+
 
 //
 // end AS_DCP_MPEG2.cpp
@@ -162,13 +162,21 @@ ASDCP::MD_to_CryptoInfo(CryptographicContext* InfoObj, WriterInfo& Info, const D
 //
 ASDCP::Result_t
 ASDCP::EssenceType(const std::string& filename, EssenceType_t& type)
+{
+  const Dictionary* Dict = &DefaultCompositeDict();
+  OP1aHeader TestHeader(Dict);
+  return EssenceType(filename, type, TestHeader);
+}
+
+//
+ASDCP::Result_t
+ASDCP::EssenceType(const std::string& filename, EssenceType_t& type, MXF::OP1aHeader& TestHeader)
 {
   const Dictionary* m_Dict = &DefaultCompositeDict();
   InterchangeObject* md_object = 0;
 
   assert(m_Dict);
   Kumu::FileReader   Reader;
-  OP1aHeader TestHeader(m_Dict);
 
   Result_t result = Reader.OpenRead(filename);
 
@@ -323,14 +331,16 @@ ASDCP::RawEssenceType(const std::string& filename, EssenceType_t& type)
 
 		  if ( ASDCP_SUCCESS(result) )
 		    {
-		      switch ( WavHeader.samplespersec )
+		      // other rates are converted to the nearest of these when wrapped
+		      if ( WavHeader.samplespersec == 0 )
 			{
-			case 48000: type = ESS_PCM_24b_48k; break;
-			case 96000: type = ESS_PCM_24b_96k; break;
-			default:
 			  DefaultLogSink().Error("Unexpected sample rate: %d\n", WavHeader.samplespersec);
 			  result = RESULT_FORMAT;
 			}
+		      else
+			{
+			  type = WavHeader.samplespersec > 48000 ? ESS_PCM_24b_96k : ESS_PCM_24b_48k;
+			}
 		    }
 		}
 	      else
@@ -339,14 +349,16 @@ ASDCP::RawEssenceType(const std::string& filename, EssenceType_t& type)
 		
 		  if ( ASDCP_SUCCESS(result) )
 		    {
-		      switch ( RF64Header.samplespersec )
+		      // other rates are converted to the nearest of these when wrapped
+		      if ( RF64Header.samplespersec == 0 )
 			{
-			case 48000: type = ESS_PCM_24b_48k; break;
-			case 96000: type = ESS_PCM_24b_96k; break;
-			default:
-			  DefaultLogSink().Error("Unexpected sample rate: %d\n", WavHeader.samplespersec);
+			  DefaultLogSink().Error("Unexpected sample rate: %d\n", RF64Header.samplespersec);
 			  result = RESULT_FORMAT;
 			}
+		      else
+			{
+			  type = RF64Header.samplespersec > 48000 ? ESS_PCM_24b_96k : ESS_PCM_24b_48k;
+			}
 		    }
 		}
 	    }
@@ -434,6 +446,7 @@ Result_t
 ASDCP::EncryptFrameBuffer(const ASDCP::FrameBuffer& FBin, ASDCP::FrameBuffer& FBout, AESEncContext* Ctx)
 {
   ASDCP_TEST_NULL(Ctx);
+  Kumu::TraceSpan span("encrypt");
   FBout.Size(0);
 
   // size the buffer
@@ -563,16 +576,25 @@ Result_t
 ASDCP::IntegrityPack::CalcValues(const ASDCP::FrameBuffer& FB, const byte_t* AssetID,
 				 ui32_t sequence, HMACContext* HMAC)
 {
-  ASDCP_TEST_NULL(AssetID);
   ASDCP_TEST_NULL(HMAC);
-  byte_t* p = Data;
   HMAC->Reset();
 
-  static byte_t ber_4[MXF_BER_LENGTH] = {0x83, 0, 0, 0};
-
   // update HMAC with essence data
   HMAC->Update(FB.RoData(), FB.Size());
 
+  return CalcValues(AssetID, sequence, HMAC);
+}
+
+//
+Result_t
+ASDCP::IntegrityPack::CalcValues(const byte_t* AssetID, ui32_t sequence, HMACContext* HMAC)
+{
+  ASDCP_TEST_NULL(AssetID);
+  ASDCP_TEST_NULL(HMAC);
+  byte_t* p = Data;
+
+  static byte_t ber_4[MXF_BER_LENGTH] = {0x83, 0, 0, 0};
+
   // track file ID length
   memcpy(p, ber_4, MXF_BER_LENGTH);
   *(p+3) = UUIDlen;;
@@ -609,15 +631,12 @@ ASDCP::IntegrityPack::CalcValues(const ASDCP::FrameBuffer& FB, const byte_t* Ass
 }
 
 
-Result_t
-ASDCP::IntegrityPack::TestValues(const ASDCP::FrameBuffer& FB, const byte_t* AssetID,
-				 ui32_t sequence, HMACContext* HMAC)
+// Tests the AssetID and sequence of an integrity pack, HMACValue is set to
+// the HMAC it holds.
+static Result_t
+test_intpack_fields(const byte_t* intpack, const byte_t* AssetID, ui32_t sequence, const byte_t** HMACValue)
 {
-  ASDCP_TEST_NULL(AssetID);
-  ASDCP_TEST_NULL(HMAC);
-
-  // find the start of the intpack
-  byte_t* p = (byte_t*)FB.RoData() + ( FB.Size() - klv_intpack_size );
+  byte_t* p = (byte_t*)intpack;
 
   // test the AssetID length
   if ( ! Kumu::read_test_BER(&p, UUIDlen) )
@@ -650,12 +669,145 @@ ASDCP::IntegrityPack::TestValues(const ASDCP::FrameBuffer& FB, const byte_t* Ass
   if ( ! Kumu::read_test_BER(&p, HMAC_SIZE) )
         return RESULT_HMACFAIL;
 
+  *HMACValue = p;
+  return RESULT_OK;
+}
+
+//
+Result_t
+ASDCP::IntegrityPack::TestValues(const ASDCP::FrameBuffer& FB, const byte_t* AssetID,
+				 ui32_t sequence, HMACContext* HMAC)
+{
+  ASDCP_TEST_NULL(AssetID);
+  ASDCP_TEST_NULL(HMAC);
+  const byte_t* HMACValue = 0;
+
+  // find the start of the intpack
+  Result_t result = test_intpack_fields(FB.RoData() + ( FB.Size() - klv_intpack_size ), AssetID, sequence, &HMACValue);
+
+  if ( ASDCP_FAILURE(result) )
+    return result;
+
   // test the HMAC
   HMAC->Reset();
   HMAC->Update(FB.RoData(), FB.Size() - HMAC_SIZE);
   HMAC->Finalize();
 
-  return HMAC->TestHMACValue(p);
+  return HMAC->TestHMACValue(HMACValue);
+}
+
+// the ciphertext is hashed and decrypted this much at a time, so the
+// bytes the HMAC has just read are still in cache for the decryption
+static const ui32_t DecryptChunkSize = 64 * 1024;
+
+// Decrypts an encrypted source value and tests its integrity pack in one
+// pass, every chunk is fed to the HMAC before it is decrypted. Out may be
+// the value's own buffer as long as it does not start after ESV, as when a
+// packet was read straight into the frame buffer. ESVLength includes the
+// integrity pack when there is one.
+Result_t
+ASDCP::DecryptAndTestESV(const byte_t* ESV, ui32_t ESVLength, ui32_t SourceLength, ui32_t PlaintextOffset,
+			 byte_t* Out, AESDecContext* Ctx, const byte_t* AssetID, ui32_t Sequence, HMACContext* HMAC)
+{
+  ASDCP_TEST_NULL(ESV);
+  ASDCP_TEST_NULL(Out);
+  ASDCP_TEST_NULL(Ctx);
+
+  ui32_t ct_size = SourceLength - PlaintextOffset;
+  ui32_t diff = ct_size % CBC_BLOCK_SIZE;
+  ui32_t block_size = ct_size - diff;
+  ui32_t esv_length = calc_esv_length(SourceLength, PlaintextOffset);
+  const byte_t* HMACValue = 0;
+  Result_t result = RESULT_OK;
+  assert(block_size);
+
+  if ( ESVLength < esv_length + ( HMAC ? klv_intpack_size : 0 ) )
+    return RESULT_FORMAT;
+
+  const byte_t* intpack = ESV + esv_length;
+
+  // the integrity pack lies past the plaintext, its fields are tested first
+  if ( HMAC )
+    {
+      ASDCP_TEST_NULL(AssetID);
+      result = test_intpack_fields(intpack, AssetID, Sequence, &HMACValue);
+
+      if ( ASDCP_FAILURE(result) )
+	return result;
+
+      HMAC->Reset();
+      HMAC->Update(ESV, CBC_BLOCK_SIZE * 2);
+    }
+
+  const byte_t* buf = ESV;
+
+  // get ivec
+  Ctx->SetIVec(buf);
+  buf += CBC_BLOCK_SIZE;
+
+  // decrypt and test check value
+  byte_t CheckValue[CBC_BLOCK_SIZE];
+  result = Ctx->DecryptBlock(buf, CheckValue, CBC_BLOCK_SIZE);
+  buf += CBC_BLOCK_SIZE;
+
+  if ( memcmp(CheckValue, ESV_CheckValue, CBC_BLOCK_SIZE) != 0 )
+    return RESULT_CHECKFAIL;
+
+  // move the plaintext region, a chunk is hashed before it is overwritten
+  for ( ui32_t done = 0; done < PlaintextOffset; )
+    {
+      ui32_t chunk = Kumu::xmin(DecryptChunkSize, PlaintextOffset - done);
+
+      if ( HMAC )
+	HMAC->Update(buf, chunk);
+
+      memmove(Out + done, buf, chunk);
+      buf += chunk;
+      done += chunk;
+    }
+
+  // decrypt all but last block
+  for ( ui32_t done = 0; ASDCP_SUCCESS(result) && done < block_size; )
+    {
+      ui32_t chunk = Kumu::xmin(DecryptChunkSize, block_size - done);
+
+      if ( HMAC )
+	HMAC->Update(buf, chunk);
+
+      result = Ctx->DecryptBlock(buf, Out + PlaintextOffset + done, chunk);
+      buf += chunk;
+      done += chunk;
+    }
+
+  // decrypt last block
+  if ( ASDCP_SUCCESS(result) )
+    {
+      byte_t the_last_block[CBC_BLOCK_SIZE];
+
+      if ( HMAC )
+	HMAC->Update(buf, CBC_BLOCK_SIZE);
+
+      result = Ctx->DecryptBlock(buf, the_last_block, CBC_BLOCK_SIZE);
+
+      if ( the_last_block[diff] != 0 )
+	{
+	  DefaultLogSink().Error("Unexpected non-zero padding value.\n");
+	  return RESULT_FORMAT;
+	}
+
+      if ( diff > 0 )
+	memcpy(Out + PlaintextOffset + block_size, the_last_block, diff);
+    }
+
+  // test the HMAC
+  if ( ASDCP_SUCCESS(result) && HMAC )
+    {
+      HMAC->Update(intpack, klv_intpack_size - HMAC_SIZE);
+      HMAC->Finalize();
+      result = HMAC->TestHMACValue(HMACValue);
+    }
+
+  return result;
 }
 
 //
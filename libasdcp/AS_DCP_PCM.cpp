@@ -441,6 +441,24 @@ ASDCP::PCM::MXFReader::ReadFrame(ui32_t FrameNum, FrameBuffer& FrameBuf,
   return RESULT_INIT;
 }
 
+//
+ASDCP::Result_t
+ASDCP::PCM::MXFReader::ReadFrames(ui32_t FrameNum, ui32_t FrameCount, FrameBuffer** FrameBufs,
+				  AESDecContext* Ctx, HMACContext* HMAC) const
+{
+  if ( ! ( m_Reader && m_Reader->m_File.IsOpen() ) )
+    return RESULT_INIT;
+
+  if ( FrameNum + FrameCount > m_Reader->m_ADesc.ContainerDuration )
+    return RESULT_RANGE;
+
+  ASDCP_TEST_NULL(FrameBufs);
+  std::vector<ASDCP::FrameBuffer*> Bufs(FrameBufs, FrameBufs + FrameCount);
+  assert(m_Reader->m_Dict);
+  return m_Reader->ReadEKLVFrames(FrameNum, FrameCount, Bufs.empty() ? 0 : &Bufs[0],
+				  m_Reader->m_Dict->ul(MDD_WAVEssence), Ctx, HMAC);
+}
+
 
 ASDCP::Result_t
 ASDCP::PCM::MXFReader::LocateFrame(ui32_t FrameNum, Kumu::fpos_t& streamOffset, i8_t& temporalOffset, i8_t& keyFrameOffset) const
@@ -754,6 +772,46 @@ ASDCP::PCM::MXFWriter::Finalize()
   return m_Writer->Finalize();
 }
 
+//
+ASDCP::Result_t
+ASDCP::PCM::MXFWriter::EnableFileDigest()
+{
+  if ( m_Writer.empty() )
+    return RESULT_INIT;
+
+  return m_Writer->m_File.EnableDigest();
+}
+
+//
+ASDCP::Result_t
+ASDCP::PCM::MXFWriter::EnableAsyncIO(bool direct_io, ui32_t buffer_count, ui32_t buffer_size)
+{
+  if ( m_Writer.empty() )
+    return RESULT_INIT;
+
+  return m_Writer->m_File.EnableQueuedWrites(direct_io, buffer_count, buffer_size);
+}
+
+//
+ASDCP::Result_t
+ASDCP::PCM::MXFWriter::SetWriteObserver(Kumu::WriteObserver* observer)
+{
+  if ( m_Writer.empty() )
+    return RESULT_INIT;
+
+  return m_Writer->m_File.SetObserver(observer);
+}
+
+//
+ASDCP::Result_t
+ASDCP::PCM::MXFWriter::FileDigest(byte_t* digest) const
+{
+  if ( m_Writer.empty() )
+    return RESULT_INIT;
+
+  return m_Writer->m_File.Digest(digest);
+}
+
 //
 // end AS_DCP_PCM.cpp
 //
@@ -804,6 +804,36 @@ ASDCP::TimedText::MXFWriter::Finalize()
   return m_Writer->Finalize();
 }
 
+//
+ASDCP::Result_t
+ASDCP::TimedText::MXFWriter::EnableFileDigest()
+{
+  if ( m_Writer.empty() )
+    return RESULT_INIT;
+
+  return m_Writer->m_File.EnableDigest();
+}
+
+//
+ASDCP::Result_t
+ASDCP::TimedText::MXFWriter::EnableAsyncIO(bool direct_io, ui32_t buffer_count, ui32_t buffer_size)
+{
+  if ( m_Writer.empty() )
+    return RESULT_INIT;
+
+  return m_Writer->m_File.EnableQueuedWrites(direct_io, buffer_count, buffer_size);
+}
+
+//
+ASDCP::Result_t
+ASDCP::TimedText::MXFWriter::FileDigest(byte_t* digest) const
+{
+  if ( m_Writer.empty() )
+    return RESULT_INIT;
+
+  return m_Writer->m_File.Digest(digest);
+}
+
 
 
 //
@@ -140,6 +140,8 @@ namespace ASDCP
 
   Result_t EncryptFrameBuffer(const ASDCP::FrameBuffer&, ASDCP::FrameBuffer&, AESEncContext*);
   Result_t DecryptFrameBuffer(const ASDCP::FrameBuffer&, ASDCP::FrameBuffer&, AESDecContext*);
+  Result_t DecryptAndTestESV(const byte_t* ESV, ui32_t ESVLength, ui32_t SourceLength, ui32_t PlaintextOffset,
+			     byte_t* Out, AESDecContext* Ctx, const byte_t* AssetID, ui32_t Sequence, HMACContext* HMAC);
 
   Result_t MD_to_JP2K_PDesc(const ASDCP::MXF::GenericPictureEssenceDescriptor&  EssenceDescriptor,
 			    const ASDCP::MXF::JPEG2000PictureSubDescriptor& EssenceSubDescriptor,
@@ -162,10 +164,14 @@ namespace ASDCP
 			    ui32_t FrameNum, ui32_t SequenceNum, ASDCP::FrameBuffer& FrameBuf,
 			    const byte_t* EssenceUL, AESDecContext* Ctx, HMACContext* HMAC);
 
+  Result_t Decode_EKLV_Value(const ASDCP::Dictionary& Dict, const ASDCP::WriterInfo& Info, const UL& Key,
+			     byte_t* Value, ui64_t PacketLength, ui32_t FrameNum, ui32_t SequenceNum,
+			     ASDCP::FrameBuffer& FrameBuf, const byte_t* EssenceUL, AESDecContext* Ctx, HMACContext* HMAC);
+
   Result_t Write_EKLV_Packet(Kumu::FileWriter& File, const ASDCP::Dictionary& Dict, const MXF::OP1aHeader& HeaderPart,
 			     const ASDCP::WriterInfo& Info, ASDCP::FrameBuffer& CtFrameBuf, ui32_t& FramesWritten,
 			     ui64_t & StreamOffset, const ASDCP::FrameBuffer& FrameBuf, const byte_t* EssenceUL,
-			     AESEncContext* Ctx, HMACContext* HMAC);
+			     AESEncContext* Ctx, HMACContext* HMAC, const ASDCP::FrameBuffer* EncFrameBuf = 0);
 
   //
  class KLReader : public ASDCP::KLVPacket
@@ -849,6 +855,22 @@ namespace ASDCP
       ASDCP_NO_COPY_CONSTRUCT(h__ASDCPReader);
       h__ASDCPReader();
 
+      // absolute position of a frame's KLV packet and the bytes up to the next one
+      struct FrameIndexEntry
+      {
+	Kumu::fpos_t Offset;
+	ui32_t       Size;
+      };
+
+      std::vector<FrameIndexEntry> m_FrameIndex;
+      Kumu::ByteString             m_SpanBuf;
+      bool                         m_MapTried;
+      Kumu::Mutex                  m_FileLock; // the file position, the span buffer and the map attempt
+
+      void     FlattenIndex();
+      Result_t LocateSpan(ui32_t FrameNum, FrameIndexEntry& Span);
+      Result_t ReadFrameView(ui32_t FrameNum, ASDCP::FrameBuffer& FrameBuf, const byte_t* EssenceUL, bool& Done);
+
     public:
       Partition m_BodyPart;
 
@@ -858,6 +880,10 @@ namespace ASDCP
       Result_t OpenMXFRead(const std::string& filename);
       Result_t ReadEKLVFrame(ui32_t FrameNum, ASDCP::FrameBuffer& FrameBuf,
 			     const byte_t* EssenceUL, AESDecContext* Ctx, HMACContext* HMAC);
+      Result_t ReadEKLVFrames(ui32_t FrameNum, ui32_t FrameCount, ASDCP::FrameBuffer* const* FrameBufs,
+			      const byte_t* EssenceUL, AESDecContext* Ctx, HMACContext* HMAC);
+      Result_t ReadLeadingEKLVFrame(ui32_t FrameNum, ui32_t SequenceNum, ASDCP::FrameBuffer& FrameBuf,
+				    const byte_t* EssenceUL, AESDecContext* Ctx, HMACContext* HMAC);
       Result_t LocateFrame(ui32_t FrameNum, Kumu::fpos_t& streamOffset,
                            i8_t& temporalOffset, i8_t& keyFrameOffset);
     };
@@ -871,6 +897,7 @@ namespace ASDCP
     public:
       Partition          m_BodyPart;
       OPAtomIndexFooter  m_FooterPart;
+      ui32_t             m_SequenceBase; // frame number of the first frame, for the integrity packs
 
       h__ASDCPWriter(const Dictionary&);
       virtual ~h__ASDCPWriter();
@@ -883,7 +910,7 @@ namespace ASDCP
 
       Result_t CreateBodyPart(const MXF::Rational& EditRate, ui32_t BytesPerEditUnit = 0);
       Result_t WriteEKLVPacket(const ASDCP::FrameBuffer& FrameBuf,const byte_t* EssenceUL,
-			       AESEncContext* Ctx, HMACContext* HMAC);
+			       AESEncContext* Ctx, HMACContext* HMAC, const ASDCP::FrameBuffer* EncFrameBuf = 0);
       Result_t WriteASDCPFooter();
     };
 
@@ -902,6 +929,8 @@ namespace ASDCP
       ~IntegrityPack() {}
 
       Result_t CalcValues(const ASDCP::FrameBuffer&, const byte_t* AssetID, ui32_t sequence, HMACContext* HMAC);
+      // as above, with the essence already passed to HMAC->Update() since the last Reset()
+      Result_t CalcValues(const byte_t* AssetID, ui32_t sequence, HMACContext* HMAC);
       Result_t TestValues(const ASDCP::FrameBuffer&, const byte_t* AssetID, ui32_t sequence, HMACContext* HMAC);
     };
 
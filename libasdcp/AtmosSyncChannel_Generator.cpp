@@ -41,7 +41,10 @@ ASDCP::PCM::AtmosSyncChannelGenerator::AtmosSyncChannelGenerator(ui16_t bitsPerS
     : m_syncEncoder(),
       m_audioTrackUUID(),
       m_ADesc(),
-      m_syncSignalBuffer(NULL),
+      m_symbolCodes(NULL),
+      m_symbolPatterns(NULL),
+      m_numSymbolsPerFrame(0),
+      m_numBytesPerSymbol(0),
       m_numSamplesPerFrame(0),
       m_currentFrameNumber(0),
       m_numBytesPerFrame(0),
@@ -63,7 +66,35 @@ ASDCP::PCM::AtmosSyncChannelGenerator::AtmosSyncChannelGenerator(ui16_t bitsPerS
     {
         ui32_t frameRate = editRate.Numerator/editRate.Denominator; // intentionally allowing for imprecise cast to int
         m_isSyncEncoderInitialized = (SyncEncoderInit(&m_syncEncoder, sampleRate, frameRate, &m_audioTrackUUID) == SYNC_ENCODER_ERROR_NONE);
-        m_syncSignalBuffer = new float[m_numSamplesPerFrame];
+
+        if (m_isSyncEncoderInitialized)
+        {
+            /**
+             * A symbol only takes one of SYNC_SYMBOL_CODES shapes, convert each of
+             * them to 24 bit samples once so a frame is a run of pattern copies.
+             */
+            i32_t symbolLength = m_syncEncoder.iSymbolLength;
+            float* symbol = new float[symbolLength];
+
+            m_numSymbolsPerFrame = GetSyncEncoderSymbolCount(&m_syncEncoder);
+            m_numBytesPerSymbol = symbolLength * NUM_BYTES_PER_INT24;
+            m_symbolCodes = new byte_t[m_numSymbolsPerFrame];
+            m_symbolPatterns = new byte_t[SYNC_SYMBOL_CODES * m_numBytesPerSymbol];
+
+            for (int code = 0; code < SYNC_SYMBOL_CODES; ++code)
+            {
+                byte_t* pattern = m_symbolPatterns + code * m_numBytesPerSymbol;
+                GetSyncEncoderSymbol(&m_syncEncoder, code, symbol);
+
+                for (i32_t i = 0; i < symbolLength; ++i)
+                {
+                    i32_t sample = convertSampleFloatToInt24(symbol[i]);
+                    memcpy(pattern + i * NUM_BYTES_PER_INT24, ((byte_t*)(&sample))+1, NUM_BYTES_PER_INT24);
+                }
+            }
+
+            delete [] symbol;
+        }
     }
     else
     {
@@ -73,7 +104,8 @@ ASDCP::PCM::AtmosSyncChannelGenerator::AtmosSyncChannelGenerator(ui16_t bitsPerS
 
 ASDCP::PCM::AtmosSyncChannelGenerator::~AtmosSyncChannelGenerator()
 {
-    delete [] m_syncSignalBuffer;
+    delete [] m_symbolCodes;
+    delete [] m_symbolPatterns;
 }
 
 ASDCP::Result_t
@@ -100,19 +132,23 @@ ASDCP::PCM::AtmosSyncChannelGenerator::ReadFrame(FrameBuffer& OutFB)
         /**
          * Generate sync signal frame.
          */
-        int ret = EncodeSync(&m_syncEncoder, m_numSamplesPerFrame, m_syncSignalBuffer, m_currentFrameNumber);
+        int ret = EncodeSyncSymbols(&m_syncEncoder, m_numSamplesPerFrame, m_symbolCodes, m_currentFrameNumber);
         if (ret == SYNC_ENCODER_ERROR_NONE)
         {
-            for (unsigned int i = 0; i < m_numSamplesPerFrame; ++i)
+            for (ui32_t i = 0; i < m_numSymbolsPerFrame; ++i)
             {
                 /**
-                 * Convert each encoded float sample to a signed 24 bit integer and
-                 * copy into the essence buffer.
+                 * Copy the precomputed 24 bit samples of each symbol into the
+                 * essence buffer.
                  */
-                i32_t sample = convertSampleFloatToInt24(m_syncSignalBuffer[i]);
-                memcpy(frameEssence, ((byte_t*)(&sample))+1, NUM_BYTES_PER_INT24);
-                frameEssence += NUM_BYTES_PER_INT24;
+                memcpy(frameEssence, m_symbolPatterns + m_symbolCodes[i] * m_numBytesPerSymbol, m_numBytesPerSymbol);
+                frameEssence += m_numBytesPerSymbol;
             }
+
+            /**
+             * Samples past the last whole symbol carry no signal.
+             */
+            memset(frameEssence, 0, OutFB.Data() + m_numBytesPerFrame - frameEssence);
         }
         else
         {
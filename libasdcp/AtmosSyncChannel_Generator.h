@@ -56,7 +56,10 @@ namespace ASDCP
             SYNCENCODER  m_syncEncoder;
             UUIDINFORMATION m_audioTrackUUID;
             AudioDescriptor m_ADesc;
-            float *m_syncSignalBuffer;
+            byte_t *m_symbolCodes;
+            byte_t *m_symbolPatterns;
+            ui32_t m_numSymbolsPerFrame;
+            ui32_t m_numBytesPerSymbol;
             ui32_t m_numSamplesPerFrame;
             ui32_t m_currentFrameNumber;
             ui32_t m_numBytesPerFrame;
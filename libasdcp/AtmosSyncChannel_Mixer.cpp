@@ -336,25 +336,23 @@ ASDCP::AtmosSyncChannelMixer::ReadFrame(PCM::FrameBuffer& OutFB)
   {
     OutFB.Size(bufSize);
     byte_t* Out_p = OutFB.Data();
-    byte_t* End_p = Out_p + OutFB.Size();
+    ui32_t numSamples = bufSize / m_ADesc.BlockAlign;
     ui32_t bytesWritten = 0;
+    ui32_t offset = 0;
     OutputList::iterator iter;
     OutputList::iterator lastOutput = m_outputs.end();
 
-    while ( Out_p < End_p && ASDCP_SUCCESS(result) )
-	{
-        iter = m_outputs.begin();
-        while ( iter != lastOutput && ASDCP_SUCCESS(result) )
-        {
-            result = ((*iter).second)->PutSample((*iter).first, Out_p, &bytesWritten);
-            Out_p += bytesWritten;
-            ++iter;
-        }
+    // each output fills its channels of every sample in the frame at once
+    for ( iter = m_outputs.begin(); iter != lastOutput && ASDCP_SUCCESS(result); ++iter )
+    {
+        result = ((*iter).second)->PutFrame((*iter).first, numSamples, Out_p + offset,
+                                            m_ADesc.BlockAlign, &bytesWritten);
+        offset += bytesWritten;
     }
 
     if ( ASDCP_SUCCESS(result) )
     {
-      assert(Out_p == End_p);
+      assert(offset == m_ADesc.BlockAlign);
       OutFB.FrameNumber(m_FramesRead++);
     }
   }
@@ -34,6 +34,8 @@ THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <algorithm>
 #include <list>
 #include <string>
+#include <vector>
+#include <pthread.h>
 
 #include "KM_fileio.h"
 #include "KM_log.h"
@@ -65,11 +67,13 @@ class ASDCP::DCData::FileList : public std::list<std::string>
         return *this;
     }
 
-    //
+    // The entry types come with the directory listing, only entries of an
+    // unknown type cost a stat.
     Result_t InitFromDirectory(const std::string& path)
     {
-        char next_file[Kumu::MaxFilePath];
-        Kumu::DirScanner Scanner;
+        std::string next_file;
+        Kumu::DirectoryEntryType_t next_type;
+        Kumu::DirScannerEx Scanner;
 
         Result_t result = Scanner.Open(path);
 
@@ -77,7 +81,7 @@ class ASDCP::DCData::FileList : public std::list<std::string>
         {
             m_DirName = path;
 
-            while ( ASDCP_SUCCESS(Scanner.GetNext(next_file)) )
+            while ( ASDCP_SUCCESS(Scanner.GetNext(next_file, next_type)) )
             {
                 if ( next_file[0] == '.' ) // no hidden files or internal links
                     continue;
@@ -86,7 +90,8 @@ class ASDCP::DCData::FileList : public std::list<std::string>
                 Str += "/";
                 Str += next_file;
 
-                if ( ! Kumu::PathIsDirectory(Str) )
+                if ( next_type == Kumu::DET_FILE
+                     || ( next_type != Kumu::DET_DIR && ! Kumu::PathIsDirectory(Str) ) )
                     push_back(Str);
             }
 
@@ -99,6 +104,108 @@ class ASDCP::DCData::FileList : public std::list<std::string>
 
 //------------------------------------------------------------------------------------------
 
+// Frames are read ahead in batches. A sequence of per-frame files reads the
+// next DCDataBatchFrames files on up to DCDataReadThreads threads, so the
+// opens of many small files overlap instead of following one another. A
+// stream holding every frame is read in blocks of DCDataStreamBlock bytes
+// and the frames are cut out of the block.
+static const ui32_t DCDataBatchFrames = 64;
+static const ui32_t DCDataReadThreads = 4;
+static const ui32_t DCDataStreamBlock = 8 * 1024 * 1024;
+
+// IA bitstream framing (SMPTE ST 2098-2): a preamble element followed by
+// an IA frame element, each a one byte tag and a four byte big-endian length.
+static const byte_t IAPreambleTag   = 0x01;
+static const byte_t IAFrameTag      = 0x02;
+static const ui32_t IAElementHeader = 5;
+
+static inline ui32_t
+ia_element_length(const byte_t* p)
+{
+  return ( (ui32_t)p[1] << 24 ) | ( (ui32_t)p[2] << 16 ) | ( (ui32_t)p[3] << 8 ) | p[4];
+}
+
+//
+static Result_t
+copy_frame(const byte_t* data, ui32_t size, ASDCP::FrameBuffer& FB)
+{
+  if ( FB.Capacity() < size )
+    {
+      Kumu::DefaultLogSink().Error("FrameBuf.Capacity: %u frame length: %u\n", FB.Capacity(), size);
+      return ASDCP::RESULT_SMALLBUF;
+    }
+
+  if ( size > 0 )
+    memcpy(FB.Data(), data, size);
+
+  FB.Size(size);
+  return ASDCP::RESULT_OK;
+}
+
+//
+struct DCDataBatch
+{
+  std::vector<std::string>          Files;
+  std::vector<std::vector<byte_t> > Data;
+  std::vector<Result_t>             Results;
+  ui32_t                            Next;
+  Kumu::Mutex                       Lock;
+};
+
+//
+static Result_t
+read_whole_file(const std::string& filename, std::vector<byte_t>& data)
+{
+  Kumu::FileReader Reader;
+  Result_t result = Reader.OpenRead(filename);
+
+  if ( ASDCP_SUCCESS(result) )
+    {
+      Kumu::fsize_t file_size = Reader.Size();
+      ui32_t read_count = 0;
+
+      if ( file_size > 0xFFFFFFFFL )
+	return ASDCP::RESULT_ALLOC;
+
+      data.resize((size_t)file_size);
+
+      if ( file_size > 0 )
+	result = Reader.Read(&data[0], (ui32_t)file_size, &read_count);
+
+      if ( ASDCP_SUCCESS(result) )
+	data.resize(read_count);
+    }
+
+  return result;
+}
+
+// Takes the next unread file of the batch until there are none left.
+static void*
+batch_read_thread(void* arg)
+{
+  DCDataBatch* Batch = (DCDataBatch*)arg;
+
+  for (;;)
+    {
+      ui32_t i;
+
+      {
+	Kumu::AutoMutex Lock(Batch->Lock);
+	i = Batch->Next++;
+      }
+
+      if ( i >= Batch->Files.size() )
+	break;
+
+      // each thread writes only its own slots
+      Batch->Results[i] = read_whole_file(Batch->Files[i], Batch->Data[i]);
+    }
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------------------
+
 class ASDCP::DCData::SequenceParser::h__SequenceParser
 {
   ui32_t             m_FramesRead;
@@ -107,14 +214,28 @@ class ASDCP::DCData::SequenceParser::h__SequenceParser
   FileList::iterator m_CurrentFile;
   BytestreamParser   m_Parser;
 
+  DCDataBatch        m_Batch;
+  ui32_t             m_BatchPos;
+
+  bool               m_IsStream;
+  ui32_t             m_FrameSize;
+  Kumu::FileReader   m_Stream;
+  std::vector<byte_t> m_Block;
+  ui32_t             m_BlockPos;
+  ui32_t             m_BlockEnd;
+
   Result_t OpenRead();
+  Result_t FillBatch();
+  Result_t FillBlock(ui32_t needed);
+  Result_t CountStreamFrames(const std::string& filename, ui32_t& count);
+  Result_t ReadStreamFrame(FrameBuffer&);
 
   ASDCP_NO_COPY_CONSTRUCT(h__SequenceParser);
 
  public:
   DCDataDescriptor  m_DDesc;
 
-  h__SequenceParser() : m_FramesRead(0)
+  h__SequenceParser() : m_FramesRead(0), m_BatchPos(0), m_IsStream(false), m_FrameSize(0), m_BlockPos(0), m_BlockEnd(0)
   {
     memset(&m_DDesc, 0, sizeof(m_DDesc));
     m_DDesc.EditRate = Rational(24,1);
@@ -127,12 +248,20 @@ class ASDCP::DCData::SequenceParser::h__SequenceParser
 
   Result_t OpenRead(const std::string& filename);
   Result_t OpenRead(const std::list<std::string>& file_list);
-  void     Close() {}
+  Result_t OpenReadStream(const std::string& filename, ui32_t frame_size);
+  void     Close() { m_Stream.Close(); }
 
   Result_t Reset()
   {
     m_FramesRead = 0;
     m_CurrentFile = m_FileList.begin();
+    m_Batch.Files.clear();
+    m_BatchPos = 0;
+    m_BlockPos = m_BlockEnd = 0;
+
+    if ( m_IsStream )
+      return m_Stream.Seek(0);
+
     return RESULT_OK;
   }
 
@@ -193,21 +322,245 @@ ASDCP::DCData::SequenceParser::h__SequenceParser::OpenRead(const std::list<std::
   return OpenRead();
 }
 
+// Walks the element headers of the stream, on a mapping of the file when
+// one can be had, so only the header pages are touched.
+ASDCP::Result_t
+ASDCP::DCData::SequenceParser::h__SequenceParser::CountStreamFrames(const std::string& filename, ui32_t& count)
+{
+  Kumu::FileReader Reader;
+  Result_t result = Reader.OpenRead(filename);
+  Kumu::fsize_t file_size = 0, pos = 0;
+  byte_t header[IAElementHeader];
+  ui32_t read_count;
+
+  count = 0;
+
+  if ( ASDCP_SUCCESS(result) )
+    {
+      file_size = Reader.Size();
+      Reader.Map();
+    }
+
+  while ( ASDCP_SUCCESS(result) && pos < file_size )
+    {
+      Kumu::fsize_t frame_start = pos;
+
+      for ( ui32_t e = 0; e < 2 && ASDCP_SUCCESS(result); e++ )
+	{
+	  result = Reader.Seek(pos);
+
+	  if ( ASDCP_SUCCESS(result) )
+	    result = Reader.Read(header, IAElementHeader, &read_count);
+
+	  if ( ASDCP_SUCCESS(result)
+	       && ( read_count != IAElementHeader || header[0] != ( e == 0 ? IAPreambleTag : IAFrameTag ) ) )
+	    {
+	      Kumu::DefaultLogSink().Error("%s: no IA frame at offset %llu\n", filename.c_str(), (unsigned long long)frame_start);
+	      result = RESULT_RAW_FORMAT;
+	    }
+
+	  if ( ASDCP_SUCCESS(result) )
+	    pos += IAElementHeader + ia_element_length(header);
+	}
+
+      if ( ASDCP_SUCCESS(result) && pos > file_size )
+	{
+	  Kumu::DefaultLogSink().Error("%s: the IA frame at offset %llu is truncated\n", filename.c_str(), (unsigned long long)frame_start);
+	  result = RESULT_RAW_FORMAT;
+	}
+
+      if ( ASDCP_SUCCESS(result) )
+	count++;
+    }
+
+  return result;
+}
+
 //
 ASDCP::Result_t
-ASDCP::DCData::SequenceParser::h__SequenceParser::ReadFrame(FrameBuffer& FB)
+ASDCP::DCData::SequenceParser::h__SequenceParser::OpenReadStream(const std::string& filename, ui32_t frame_size)
 {
-  if ( m_CurrentFile == m_FileList.end() )
+  Result_t result = m_Stream.OpenRead(filename);
+  ui32_t frame_count = 0;
+
+  if ( ASDCP_FAILURE(result) )
+    return result;
+
+  if ( frame_size > 0 )
+    {
+      Kumu::fsize_t file_size = m_Stream.Size();
+
+      if ( file_size == 0 || file_size % frame_size != 0 || file_size / frame_size > 0xFFFFFFFFL )
+	{
+	  Kumu::DefaultLogSink().Error("%s: the stream is not a whole number of %u byte frames\n", filename.c_str(), frame_size);
+	  return RESULT_RAW_FORMAT;
+	}
+
+      frame_count = (ui32_t)(file_size / frame_size);
+    }
+  else
+    {
+      result = CountStreamFrames(filename, frame_count);
+
+      if ( ASDCP_SUCCESS(result) && frame_count == 0 )
+	result = RESULT_ENDOFFILE;
+    }
+
+  if ( ASDCP_SUCCESS(result) )
+    {
+      m_IsStream = true;
+      m_FrameSize = frame_size;
+      m_DDesc.ContainerDuration = frame_count;
+    }
+
+  return result;
+}
+
+//
+ASDCP::Result_t
+ASDCP::DCData::SequenceParser::h__SequenceParser::FillBatch()
+{
+  m_Batch.Files.clear();
+
+  while ( m_CurrentFile != m_FileList.end() && m_Batch.Files.size() < DCDataBatchFrames )
+    m_Batch.Files.push_back(*m_CurrentFile++);
+
+  if ( m_Batch.Files.empty() )
     return RESULT_ENDOFFILE;
 
-  // open the file
-  Result_t result = m_Parser.OpenReadFrame((*m_CurrentFile).c_str(), FB);
+  m_Batch.Data.resize(m_Batch.Files.size());
+  m_Batch.Results.assign(m_Batch.Files.size(), RESULT_OK);
+  m_Batch.Next = 0;
+  m_BatchPos = 0;
+
+  ui32_t thread_count = std::min<ui32_t>(DCDataReadThreads, m_Batch.Files.size());
+  std::vector<pthread_t> Threads(thread_count);
+  std::vector<bool> Started(thread_count, false);
+
+  // the calling thread is the last reader
+  for ( ui32_t t = 0; t + 1 < thread_count; t++ )
+    Started[t] = ( pthread_create(&Threads[t], 0, batch_read_thread, &m_Batch) == 0 );
+
+  batch_read_thread(&m_Batch);
+
+  for ( ui32_t t = 0; t + 1 < thread_count; t++ )
+    {
+      if ( Started[t] )
+	pthread_join(Threads[t], 0);
+    }
+
+  return RESULT_OK;
+}
+
+// Makes the next needed bytes of the stream available in the block, moving
+// the unread rest of the block to its start and growing it for a frame
+// larger than a block. Returns RESULT_ENDOFFILE when the stream ends first.
+ASDCP::Result_t
+ASDCP::DCData::SequenceParser::h__SequenceParser::FillBlock(ui32_t needed)
+{
+  ui32_t avail = m_BlockEnd - m_BlockPos;
+
+  if ( avail >= needed )
+    return RESULT_OK;
+
+  if ( m_BlockPos > 0 )
+    {
+      memmove(&m_Block[0], &m_Block[m_BlockPos], avail);
+      m_BlockPos = 0;
+      m_BlockEnd = avail;
+    }
+
+  if ( m_Block.size() < std::max(needed, DCDataStreamBlock) )
+    m_Block.resize(std::max(needed, DCDataStreamBlock));
+
+  while ( m_BlockEnd < needed )
+    {
+      ui32_t read_count = 0;
+      Result_t result = m_Stream.Read(&m_Block[m_BlockEnd], m_Block.size() - m_BlockEnd, &read_count);
+
+      if ( result == RESULT_ENDOFFILE || ( ASDCP_SUCCESS(result) && read_count == 0 ) )
+	return RESULT_ENDOFFILE;
+
+      if ( ASDCP_FAILURE(result) )
+	return result;
+
+      m_BlockEnd += read_count;
+    }
+
+  return RESULT_OK;
+}
+
+//
+ASDCP::Result_t
+ASDCP::DCData::SequenceParser::h__SequenceParser::ReadStreamFrame(FrameBuffer& FB)
+{
+  ui32_t frame_size = m_FrameSize;
+  Result_t result = RESULT_OK;
+
+  if ( frame_size == 0 )
+    {
+      result = FillBlock(IAElementHeader);
+
+      if ( ASDCP_SUCCESS(result) )
+	{
+	  ui32_t frame_header = IAElementHeader + ia_element_length(&m_Block[m_BlockPos]) + IAElementHeader;
+
+	  result = FillBlock(frame_header);
+
+	  if ( ASDCP_SUCCESS(result) )
+	    frame_size = frame_header + ia_element_length(&m_Block[m_BlockPos + frame_header - IAElementHeader]);
+	}
+    }
 
   if ( ASDCP_SUCCESS(result) )
-  {
-      FB.FrameNumber(m_FramesRead++);
-      m_CurrentFile++;
-  }
+    result = FillBlock(frame_size);
+
+  // a stream that stops inside a frame was cut short
+  if ( result == RESULT_ENDOFFILE && m_BlockEnd > m_BlockPos )
+    {
+      Kumu::DefaultLogSink().Error("The DCData stream ends inside frame %u\n", m_FramesRead);
+      result = RESULT_RAW_FORMAT;
+    }
+
+  if ( ASDCP_SUCCESS(result) )
+    result = copy_frame(&m_Block[m_BlockPos], frame_size, FB);
+
+  if ( ASDCP_SUCCESS(result) )
+    m_BlockPos += frame_size;
+
+  return result;
+}
+
+//
+ASDCP::Result_t
+ASDCP::DCData::SequenceParser::h__SequenceParser::ReadFrame(FrameBuffer& FB)
+{
+  Result_t result = RESULT_OK;
+
+  if ( m_IsStream )
+    {
+      result = ReadStreamFrame(FB);
+    }
+  else
+    {
+      if ( m_BatchPos == m_Batch.Files.size() )
+	result = FillBatch();
+
+      if ( ASDCP_SUCCESS(result) )
+	result = m_Batch.Results[m_BatchPos];
+
+      if ( ASDCP_SUCCESS(result) )
+	{
+	  const std::vector<byte_t>& Data = m_Batch.Data[m_BatchPos];
+	  result = copy_frame(Data.empty() ? 0 : &Data[0], Data.size(), FB);
+	}
+
+      if ( ASDCP_SUCCESS(result) )
+	m_BatchPos++;
+    }
+
+  if ( ASDCP_SUCCESS(result) )
+    FB.FrameNumber(m_FramesRead++);
 
   return result;
 }
@@ -252,6 +605,20 @@ ASDCP::DCData::SequenceParser::OpenRead(const std::list<std::string>& file_list)
   return result;
 }
 
+//
+Result_t
+ASDCP::DCData::SequenceParser::OpenReadStream(const std::string& filename, ui32_t frame_size) const
+{
+  const_cast<ASDCP::DCData::SequenceParser*>(this)->m_Parser = new h__SequenceParser;
+
+  Result_t result = m_Parser->OpenReadStream(filename, frame_size);
+
+  if ( ASDCP_FAILURE(result) )
+    const_cast<ASDCP::DCData::SequenceParser*>(this)->m_Parser.release();
+
+  return result;
+}
+
 
 // Rewinds the stream to the beginning.
 ASDCP::Result_t
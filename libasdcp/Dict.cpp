@@ -140,14 +140,25 @@ ASDCP::SMPTE_390_OPAtom_Entry() {
 //------------------------------------------------------------------------------------------
 //
 
-ASDCP::Dictionary::Dictionary() {}
+ASDCP::Dictionary::Dictionary() { memset(m_md_present, 0, sizeof(m_md_present)); }
 ASDCP::Dictionary::~Dictionary() {}
 
+// the key FindULAnyVersion probes with, version and stream number cleared
+static inline void
+loose_ul(const byte_t* ul, byte_t* key)
+{
+  memcpy(key, ul, ASDCP::SMPTE_UL_LENGTH);
+  key[7] = 0;
+  key[15] = 0;
+}
+
 //
 void
 ASDCP::Dictionary::Init()
 {
   m_md_lookup.clear();
+  m_md_loose_lookup.clear();
+  memset(m_md_present, 0, sizeof(m_md_present));
   memset(m_MDD_Table, 0, sizeof(m_MDD_Table));
 
   for ( ui32_t x = 0; x < (ui32_t)ASDCP::MDD_Max; ++x )
@@ -173,6 +184,52 @@ ASDCP::Dictionary::Init()
     }
 }
 
+// adds one present entry to the UL tables
+void
+ASDCP::Dictionary::IndexEntry(ui32_t index, bool report_dupes)
+{
+  const byte_t* ul = m_MDD_Table[index].ul;
+  byte_t key[SMPTE_UL_LENGTH];
+
+#define MDD_AUTHORING_MODE
+#ifdef MDD_AUTHORING_MODE
+  ui32_t* dupe = m_md_lookup.find(ul);
+  if ( dupe != 0 && report_dupes )
+    {
+      char buf[64];
+      fprintf(stderr, "DUPE! %s (%02x, %02x) %s | (%02x, %02x) %s\n",
+	      UL(ul).EncodeString(buf, 64),
+	      m_MDD_Table[*dupe].tag.a, m_MDD_Table[*dupe].tag.b,
+	      m_MDD_Table[*dupe].name,
+	      m_MDD_Table[index].tag.a, m_MDD_Table[index].tag.b, m_MDD_Table[index].name);
+    }
+#endif
+
+  m_md_lookup.insert(ul, index);
+
+  // of the entries sharing a loose key the lowest UL answers, as the ordered map did
+  loose_ul(ul, key);
+  ui32_t count = m_md_loose_lookup.size();
+  ui32_t& loose = m_md_loose_lookup.get(key);
+
+  if ( m_md_loose_lookup.size() != count || UL(ul) < UL(m_MDD_Table[loose].ul) )
+    loose = index;
+}
+
+// rebuilds the UL tables after an entry went away
+void
+ASDCP::Dictionary::Reindex()
+{
+  m_md_lookup.clear();
+  m_md_loose_lookup.clear();
+
+  for ( ui32_t x = 0; x < (ui32_t)ASDCP::MDD_Max; ++x )
+    {
+      if ( m_md_present[x] )
+	IndexEntry(x, false);
+    }
+}
+
 //
 bool
 ASDCP::Dictionary::AddEntry(const MDDEntry& Entry, ui32_t index)
@@ -184,35 +241,18 @@ ASDCP::Dictionary::AddEntry(const MDDEntry& Entry, ui32_t index)
     }
 
   bool result = true;
-  // is this index already there?
-  std::map<ui32_t, ASDCP::UL>::iterator rii = m_md_rev_lookup.find(index);
 
-  if ( rii != m_md_rev_lookup.end() )
+  // is this index already there?
+  if ( m_md_present[index] )
     {
       DeleteEntry(index);
       result = false;
     }
 
-  UL TmpUL(Entry.ul);
-
-#define MDD_AUTHORING_MODE
-#ifdef MDD_AUTHORING_MODE
-  char buf[64];
-  std::map<ASDCP::UL, ui32_t>::iterator ii = m_md_lookup.find(TmpUL);
-  if ( ii != m_md_lookup.end() )
-    {
-      fprintf(stderr, "DUPE! %s (%02x, %02x) %s | (%02x, %02x) %s\n",
-	      TmpUL.EncodeString(buf, 64),
-	      m_MDD_Table[ii->second].tag.a, m_MDD_Table[ii->second].tag.b,
-	      m_MDD_Table[ii->second].name,
-	      Entry.tag.a, Entry.tag.b, Entry.name);
-    }
-#endif
-
-  m_md_lookup.insert(std::map<UL, ui32_t>::value_type(TmpUL, index));
-  m_md_rev_lookup.insert(std::map<ui32_t, UL>::value_type(index, TmpUL));
-  m_md_sym_lookup.insert(std::map<std::string, ui32_t>::value_type(Entry.name, index));
   m_MDD_Table[index] = Entry;
+  m_md_present[index] = true;
+  IndexEntry(index, true);
+  m_md_sym_lookup.insert(std::map<std::string, ui32_t>::value_type(Entry.name, index));
 
   return result;
 }
@@ -221,22 +261,16 @@ ASDCP::Dictionary::AddEntry(const MDDEntry& Entry, ui32_t index)
 bool
 ASDCP::Dictionary::DeleteEntry(ui32_t index)
 {
-  std::map<ui32_t, ASDCP::UL>::iterator rii = m_md_rev_lookup.find(index);
-  if ( rii != m_md_rev_lookup.end() )
-    {
-      std::map<ASDCP::UL, ui32_t>::iterator ii = m_md_lookup.find(rii->second);
-      assert(ii != m_md_lookup.end());
+  if ( index >= (ui32_t)MDD_Max || ! m_md_present[index] )
+    return false;
 
-      MDDEntry NilEntry;
-      memset(&NilEntry, 0, sizeof(NilEntry));
+  MDDEntry NilEntry;
+  memset(&NilEntry, 0, sizeof(NilEntry));
 
-      m_md_lookup.erase(ii);
-      m_md_rev_lookup.erase(rii);
-      m_MDD_Table[index] = NilEntry;
-      return true;
-    }
-
-  return false;
+  m_md_present[index] = false;
+  m_MDD_Table[index] = NilEntry;
+  Reindex();
+  return true;
 }
 
 //
@@ -244,9 +278,8 @@ const ASDCP::MDDEntry&
 ASDCP::Dictionary::Type(MDD_t type_id) const
 {
   assert(m_MDD_Table[0].name[0]);
-  std::map<ui32_t, ASDCP::UL>::const_iterator rii = m_md_rev_lookup.find(type_id);
 
-  if ( rii == m_md_rev_lookup.end() )
+  if ( ! m_md_present[type_id] )
     Kumu::DefaultLogSink().Warn("UL Dictionary: unknown UL type_id: %d\n", type_id);
 
   return m_MDD_Table[type_id];
@@ -257,39 +290,24 @@ const ASDCP::MDDEntry*
 ASDCP::Dictionary::FindULAnyVersion(const byte_t* ul_buf) const
 {
   assert(m_MDD_Table[0].name[0]);
-  byte_t search_ul[SMPTE_UL_LENGTH];
-  memcpy(search_ul, ul_buf, SMPTE_UL_LENGTH);
-  memset(search_ul+7, 0, SMPTE_UL_LENGTH-7);
-
-  UL target(ul_buf);
-  const ASDCP::MDDEntry *found_entry = 0;
+  const ui32_t* index = m_md_lookup.find(ul_buf);
 
-  std::map<UL, ui32_t>::const_iterator lower = m_md_lookup.lower_bound(UL(search_ul));
-
-  for ( ; lower != m_md_lookup.end(); ++lower )
+  if ( index == 0 )
     {
-      if ( lower->first.MatchExact(target) )
-	{
-	  found_entry = &m_MDD_Table[lower->second];
-	  break;
-	}
-      else if ( found_entry == 0 && lower->first.MatchIgnoreStream(target) )
-	{
-	  found_entry = &m_MDD_Table[lower->second];
-	}
-      else if ( found_entry != 0 && ! lower->first.MatchIgnoreStream(target) )
-	{
-	  break;
-	}
+      byte_t key[SMPTE_UL_LENGTH];
+      loose_ul(ul_buf, key);
+      index = m_md_loose_lookup.find(key);
     }
 
-  if ( found_entry == 0 )
+  if ( index == 0 )
     {
       char buf[64];
+      UL target(ul_buf);
       Kumu::DefaultLogSink().Warn("UL Dictionary: unknown UL: %s\n", target.EncodeString(buf, 64));
+      return 0;
     }
 
-  return found_entry;
+  return &m_MDD_Table[*index];
 }
 
 //
@@ -297,9 +315,9 @@ const ASDCP::MDDEntry*
 ASDCP::Dictionary::FindULExact(const byte_t* ul_buf) const
 {
   assert(m_MDD_Table[0].name[0]);
-  std::map<UL, ui32_t>::const_iterator i = m_md_lookup.find(UL(ul_buf));
-  
-  if ( i == m_md_lookup.end() )
+  const ui32_t* index = m_md_lookup.find(ul_buf);
+
+  if ( index == 0 )
     {
       char buf[64];
       UL tmp_ul(ul_buf);
@@ -307,7 +325,7 @@ ASDCP::Dictionary::FindULExact(const byte_t* ul_buf) const
       return 0;
     }
 
-  return &m_MDD_Table[i->second];
+  return &m_MDD_Table[*index];
 }
 
 //
@@ -36,6 +36,9 @@ THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <KM_log.h>
 using Kumu::DefaultLogSink;
 
+// header-only reads fetch the codestream this many bytes at a time
+static const ui32_t HeaderChunkSize = 512;
+
 //------------------------------------------------------------------------------------------
 
 class ASDCP::JP2K::CodestreamParser::h__CodestreamParser
@@ -45,6 +48,7 @@ class ASDCP::JP2K::CodestreamParser::h__CodestreamParser
 public:
   PictureDescriptor  m_PDesc;
   Kumu::FileReader   m_File;
+  Kumu::ByteString   m_Header;
 
   h__CodestreamParser()
   {
@@ -90,6 +94,80 @@ public:
 
     return result;
   }
+
+  // Reads the codestream a chunk at a time until the SOD marker has been
+  // seen, then parses the markers before it. No frame data is read beyond
+  // the last chunk.
+  Result_t OpenReadHeader(const std::string& filename)
+  {
+    m_File.Close();
+    m_Header.Length(0);
+    Result_t result = m_File.OpenRead(filename);
+    ui32_t header_length = 0; // end of the last whole marker
+    ui32_t want = 2;
+
+    while ( ASDCP_SUCCESS(result) )
+      {
+	if ( m_Header.Length() < want )
+	  {
+	    ui32_t read_size = Kumu::xmax(want - m_Header.Length(), HeaderChunkSize);
+	    ui32_t read_count = 0;
+	    result = m_Header.Capacity(m_Header.Length() + read_size);
+
+	    if ( ASDCP_SUCCESS(result) )
+	      result = m_File.Read(m_Header.Data() + m_Header.Length(), read_size, &read_count);
+
+	    if ( result == RESULT_ENDOFFILE )
+	      {
+		DefaultLogSink().Error("No SOD marker in %s\n", filename.c_str());
+		result = RESULT_RAW_ESS;
+	      }
+
+	    if ( ASDCP_SUCCESS(result) )
+	      m_Header.Length(m_Header.Length() + read_count);
+
+	    continue;
+	  }
+
+	// SOC and SOD are the only main and tile-part header markers without a segment
+	const byte_t* p = m_Header.RoData() + header_length;
+	ui16_t type = 0xff00 | p[1];
+
+	if ( p[0] != 0xff )
+	  {
+	    result = RESULT_RAW_ESS;
+	  }
+	else if ( type == MRK_SOD )
+	  {
+	    header_length += 2;
+	    break;
+	  }
+	else if ( type == MRK_SOC )
+	  {
+	    header_length += 2;
+	    want = header_length + 2;
+	  }
+	else if ( m_Header.Length() < header_length + 4 )
+	  {
+	    want = header_length + 4;
+	  }
+	else
+	  {
+	    header_length += 2 + ( ( p[2] << 8 ) | p[3] );
+	    want = header_length + 2;
+	  }
+      }
+
+    if ( ASDCP_SUCCESS(result) )
+      {
+	FrameBuffer FB;
+	FB.SetData(m_Header.Data(), header_length);
+	FB.Size(header_length);
+	result = ParseMetadataIntoDesc(FB, m_PDesc);
+      }
+
+    return result;
+  }
 };
 
 ASDCP::Result_t
@@ -203,6 +281,15 @@ ASDCP::JP2K::CodestreamParser::OpenReadFrame(const std::string& filename, FrameB
   return m_Parser->OpenReadFrame(filename, FB);
 }
 
+// Opens a file and parses only the codestream header, enough to fill a
+// PictureDescriptor without reading the frame.
+ASDCP::Result_t
+ASDCP::JP2K::CodestreamParser::OpenReadHeader(const std::string& filename) const
+{
+  const_cast<ASDCP::JP2K::CodestreamParser*>(this)->m_Parser = new h__CodestreamParser;
+  return m_Parser->OpenReadHeader(filename);
+}
+
 //
 ASDCP::Result_t
 ASDCP::JP2K::CodestreamParser::FillPictureDescriptor(PictureDescriptor& PDesc) const
@@ -32,9 +32,12 @@ THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <AS_DCP.h>
 #include <KM_fileio.h>
 #include <KM_log.h>
+#include <KM_mutex.h>
 #include <list>
+#include <vector>
 #include <string>
 #include <algorithm>
+#include <pthread.h>
 #include <string.h>
 #include <assert.h>
 
@@ -102,6 +105,7 @@ class ASDCP::JP2K::SequenceParser::h__SequenceParser
   bool               m_Pedantic;
 
   Result_t OpenRead();
+  Result_t ValidateSequence();
 
   ASDCP_NO_COPY_CONSTRUCT(h__SequenceParser);
 
@@ -143,7 +147,6 @@ ASDCP::JP2K::SequenceParser::h__SequenceParser::OpenRead()
 
   m_CurrentFile = m_FileList.begin();
   CodestreamParser Parser;
-  FrameBuffer TmpBuffer;
 
   Kumu::fsize_t file_size = Kumu::FileSize((*m_CurrentFile).c_str());
 
@@ -151,11 +154,8 @@ ASDCP::JP2K::SequenceParser::h__SequenceParser::OpenRead()
     return RESULT_NOT_FOUND;
 
   assert(file_size <= 0xFFFFFFFFL);
-  Result_t result = TmpBuffer.Capacity((ui32_t) file_size);
+  Result_t result = Parser.OpenReadHeader((*m_CurrentFile).c_str());
 
-  if ( ASDCP_SUCCESS(result) )
-    result = Parser.OpenReadFrame((*m_CurrentFile).c_str(), TmpBuffer);
-      
   if ( ASDCP_SUCCESS(result) )
     result = Parser.FillPictureDescriptor(m_PDesc);
 
@@ -163,6 +163,9 @@ ASDCP::JP2K::SequenceParser::h__SequenceParser::OpenRead()
   if ( ASDCP_SUCCESS(result) )
     m_PDesc.ContainerDuration = m_FileList.size();
 
+  if ( ASDCP_SUCCESS(result) && m_Pedantic )
+    result = ValidateSequence();
+
   return result;
 }
 
@@ -229,7 +232,7 @@ operator==(const ASDCP::JP2K::CodingStyleDefault_t& lhs, const ASDCP::JP2K::Codi
 
   for ( ui32_t i = 0; i < sizeof(ui16_t); i++ )
     {
-      if ( lhs.SGcod.NumberOfLayers[i] != lhs.SGcod.NumberOfLayers[i]  )
+      if ( lhs.SGcod.NumberOfLayers[i] != rhs.SGcod.NumberOfLayers[i]  )
 	return false;
     }
 
@@ -281,6 +284,146 @@ operator==(const ASDCP::JP2K::PictureDescriptor& lhs, const ASDCP::JP2K::Picture
   return true;
 }
 
+//------------------------------------------------------------------------------------------
+
+// pedantic opens check this many codestreams at once
+static const ui32_t ValidateThreads = 8;
+
+// Names the first group of codestream parameters that differ, 0 if none do.
+static const char*
+descriptor_mismatch(const JP2K::PictureDescriptor& lhs, const JP2K::PictureDescriptor& rhs)
+{
+  if ( lhs.StoredWidth != rhs.StoredWidth || lhs.StoredHeight != rhs.StoredHeight
+       || lhs.Rsize != rhs.Rsize || lhs.Xsize != rhs.Xsize || lhs.Ysize != rhs.Ysize
+       || lhs.XOsize != rhs.XOsize || lhs.YOsize != rhs.YOsize )
+    return "image size (SIZ)";
+
+  if ( lhs.XTsize != rhs.XTsize || lhs.YTsize != rhs.YTsize
+       || lhs.XTOsize != rhs.XTOsize || lhs.YTOsize != rhs.YTOsize )
+    return "tiling (SIZ)";
+
+  if ( lhs.Csize != rhs.Csize )
+    return "component count (SIZ)";
+
+  for ( ui32_t i = 0; i < JP2K::MaxComponents; i++ )
+    {
+      if ( ! ( lhs.ImageComponents[i] == rhs.ImageComponents[i] ) )
+	return "component depth or sampling (SIZ)";
+    }
+
+  if ( ! ( lhs.CodingStyleDefault == rhs.CodingStyleDefault ) )
+    return "coding style (COD)";
+
+  if ( ! ( lhs.QuantizationDefault == rhs.QuantizationDefault ) )
+    return "quantization (QCD)";
+
+  if ( ! ( lhs == rhs ) )
+    return "picture parameters";
+
+  return 0;
+}
+
+// offender entry for a file whose header could not be read or parsed
+static const char* UnreadableHeader = "unreadable";
+
+//
+struct ValidateState
+{
+  const std::vector<std::string>* Files;
+  const JP2K::PictureDescriptor*  PDesc;
+  std::vector<const char*>        Offenders;
+  ui32_t                          Next;
+  Kumu::Mutex                     Lock;
+};
+
+// Takes the next unchecked codestream until there are none left.
+static void*
+validate_thread(void* arg)
+{
+  ValidateState* State = (ValidateState*)arg;
+  JP2K::CodestreamParser Parser;
+
+  for (;;)
+    {
+      ui32_t i;
+
+      {
+	Kumu::AutoMutex Lock(State->Lock);
+	i = State->Next++;
+      }
+
+      if ( i >= State->Files->size() )
+	break;
+
+      JP2K::PictureDescriptor PDesc;
+      Result_t result = Parser.OpenReadHeader((*State->Files)[i]);
+
+      if ( ASDCP_SUCCESS(result) )
+	result = Parser.FillPictureDescriptor(PDesc);
+
+      // each thread writes only its own slots
+      if ( ASDCP_FAILURE(result) )
+	State->Offenders[i] = UnreadableHeader;
+      else
+	State->Offenders[i] = descriptor_mismatch(*State->PDesc, PDesc);
+    }
+
+  return 0;
+}
+
+// Parses only the header of every file in the list, several at a time,
+// and compares it to the descriptor taken from the first file. Every file
+// that does not match is reported before any frame is read.
+ASDCP::Result_t
+ASDCP::JP2K::SequenceParser::h__SequenceParser::ValidateSequence()
+{
+  std::vector<std::string> Files(m_FileList.begin(), m_FileList.end());
+  ValidateState State;
+  State.Files = &Files;
+  State.PDesc = &m_PDesc;
+  State.Offenders.assign(Files.size(), (const char*)0);
+  State.Next = 1; // the descriptor came from the first file
+
+  ui32_t thread_count = std::min<ui32_t>(ValidateThreads, Files.size() / 64 + 1);
+  std::vector<pthread_t> Threads(thread_count);
+  std::vector<bool> Started(thread_count, false);
+
+  // the calling thread is the last worker
+  for ( ui32_t t = 0; t + 1 < thread_count; t++ )
+    Started[t] = ( pthread_create(&Threads[t], 0, validate_thread, &State) == 0 );
+
+  validate_thread(&State);
+
+  for ( ui32_t t = 0; t + 1 < thread_count; t++ )
+    {
+      if ( Started[t] )
+	pthread_join(Threads[t], 0);
+    }
+
+  ui32_t bad_count = 0;
+
+  for ( ui32_t i = 0; i < Files.size(); i++ )
+    {
+      if ( State.Offenders[i] == 0 )
+	continue;
+
+      if ( State.Offenders[i] == UnreadableHeader )
+	Kumu::DefaultLogSink().Error("Frame %u (%s): cannot read codestream header\n", i + 1, Files[i].c_str());
+      else
+	Kumu::DefaultLogSink().Error("Frame %u (%s): %s does not match the first frame\n",
+				     i + 1, Files[i].c_str(), State.Offenders[i]);
+      bad_count++;
+    }
+
+  if ( bad_count > 0 )
+    {
+      Kumu::DefaultLogSink().Error("%u of %u JPEG-2000 codestreams do not match\n", bad_count, (ui32_t)Files.size());
+      return RESULT_RAW_FORMAT;
+    }
+
+  return RESULT_OK;
+}
+
 //
 ASDCP::Result_t
 ASDCP::JP2K::SequenceParser::h__SequenceParser::ReadFrame(FrameBuffer& FB)
@@ -291,18 +434,6 @@ ASDCP::JP2K::SequenceParser::h__SequenceParser::ReadFrame(FrameBuffer& FB)
   // open the file
   Result_t result = m_Parser.OpenReadFrame((*m_CurrentFile).c_str(), FB);
 
-  if ( ASDCP_SUCCESS(result) && m_Pedantic )
-    {
-      PictureDescriptor PDesc;
-      result = m_Parser.FillPictureDescriptor(PDesc);
-
-      if ( ASDCP_SUCCESS(result) && ! ( m_PDesc == PDesc ) )
-	{
-	  Kumu::DefaultLogSink().Error("JPEG-2000 codestream parameters do not match at frame %d\n", m_FramesRead + 1);
-	  result = RESULT_RAW_FORMAT;
-	}
-    }
-
   if ( ASDCP_SUCCESS(result) )
     {
       FB.FrameNumber(m_FramesRead++);
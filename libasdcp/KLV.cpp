@@ -199,10 +199,71 @@ ASDCP::KLVFilePacket::InitFromFile(const Kumu::FileReader& Reader, const UL& lab
   return result;
 }
 
+// A mapped file is parsed in place, the key and value point into the
+// mapping and stay valid until the file is closed.
+ASDCP::Result_t
+ASDCP::KLVFilePacket::InitFromView(const Kumu::FileReader& Reader)
+{
+  Kumu::fpos_t pos = Reader.Tell();
+  const byte_t* view = 0;
+  ui32_t read_count = 0;
+  m_Buffer.Size(0);
+
+  Result_t result = Reader.ReadView(&view, tmp_read_size, &read_count);
+
+  if ( ASDCP_FAILURE(result) )
+    return result;
+
+  if ( read_count < (SMPTE_UL_LENGTH + 1) )
+    {
+      DefaultLogSink().Error("Short read of Key and Length got %u\n", read_count);
+      return RESULT_READFAIL;
+    }
+
+  result = KLVPacket::InitFromBuffer(view, read_count);
+
+  if ( ASDCP_FAILURE(result) )
+    return result;
+
+  if ( m_ValueLength > MAX_KLV_PACKET_LENGTH )
+    {
+      Kumu::ui64Printer tmp_size_str(m_ValueLength);
+      DefaultLogSink().Error("Packet length %s exceeds internal limit\n", tmp_size_str.c_str());
+      return RESULT_FAIL;
+    }
+
+  ui32_t packet_length = (ui32_t)PacketLength();
+  result = Reader.Seek(pos);
+
+  if ( ASDCP_SUCCESS(result) )
+    result = Reader.ReadView(&view, packet_length, &read_count);
+
+  if ( ASDCP_SUCCESS(result) && read_count != packet_length )
+    {
+      DefaultLogSink().Error("Short read of packet body, expecting %u, got %u\n",
+			     packet_length, read_count);
+      result = RESULT_READFAIL;
+    }
+
+  if ( ASDCP_FAILURE(result) )
+    {
+      m_KeyStart = m_ValueStart = 0;
+      m_KLLength = m_ValueLength = 0;
+      return result;
+    }
+
+  m_KeyStart = view;
+  m_ValueStart = view + m_KLLength;
+  return RESULT_OK;
+}
+
 // TODO: refactor to use InitFromBuffer
 ASDCP::Result_t
 ASDCP::KLVFilePacket::InitFromFile(const Kumu::FileReader& Reader)
 {
+  if ( Reader.IsMapped() )
+    return InitFromView(Reader);
+
   ui32_t read_count;
   byte_t tmp_data[tmp_read_size];
   ui64_t tmp_size;
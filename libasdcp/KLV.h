@@ -37,6 +37,7 @@ THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "AS_DCP.h"
 #include "MDD.h"
 #include <map>
+#include <vector>
 
 
 namespace ASDCP
@@ -96,6 +97,140 @@ inline const char* ui64sz(ui64_t i, char* buf)
 
   using Kumu::UUID;
 
+  // Open addressed table keyed on 16 byte labels. Each key is hashed once
+  // on insert and the hash is kept with the slot, so growing the table and
+  // probing never touch the key bytes again. With IgnoreVersion the UL
+  // version byte is left out of the hash and the compare, matching
+  // UL::operator==.
+  template <class T, bool IgnoreVersion = false>
+    class LabelTable
+    {
+      struct Slot
+      {
+	byte_t key[16];
+	ui32_t hash;
+	bool   used;
+	T      value;
+	Slot() : hash(0), used(false), value() {}
+      };
+
+      std::vector<Slot> m_Slots;
+      ui32_t m_Count;
+
+      static inline bool Match(const byte_t* a, const byte_t* b) {
+	for ( ui32_t i = 0; i < 16; i++ )
+	  {
+	    if ( a[i] != b[i] && ! ( IgnoreVersion && i == 7 ) )
+	      return false;
+	  }
+
+	return true;
+      }
+
+      void Grow() {
+	std::vector<Slot> old_slots;
+	old_slots.swap(m_Slots);
+	m_Slots.resize(old_slots.empty() ? 64 : old_slots.size() * 2);
+	ui32_t mask = m_Slots.size() - 1;
+
+	for ( ui32_t i = 0; i < old_slots.size(); i++ )
+	  {
+	    if ( ! old_slots[i].used )
+	      continue;
+
+	    ui32_t j = old_slots[i].hash & mask;
+
+	    while ( m_Slots[j].used )
+	      j = ( j + 1 ) & mask;
+
+	    m_Slots[j] = old_slots[i];
+	  }
+      }
+
+      Slot* Lookup(const byte_t* key, ui32_t hash) const {
+	if ( m_Slots.empty() )
+	  return 0;
+
+	ui32_t mask = m_Slots.size() - 1;
+
+	for ( ui32_t j = hash & mask; m_Slots[j].used; j = ( j + 1 ) & mask )
+	  {
+	    if ( m_Slots[j].hash == hash && Match(m_Slots[j].key, key) )
+	      return const_cast<Slot*>(&m_Slots[j]);
+	  }
+
+	return 0;
+      }
+
+    public:
+      LabelTable() : m_Count(0) {}
+
+      // FNV-1a over the label
+      static inline ui32_t Hash(const byte_t* key) {
+	ui32_t hash = 2166136261U;
+
+	for ( ui32_t i = 0; i < 16; i++ )
+	  {
+	    if ( IgnoreVersion && i == 7 )
+	      continue;
+
+	    hash = ( hash ^ key[i] ) * 16777619U;
+	  }
+
+	return hash;
+      }
+
+      inline ui32_t size() const { return m_Count; }
+      inline bool empty() const { return m_Count == 0; }
+      inline void clear() { m_Slots.clear(); m_Count = 0; }
+
+      T* find(const byte_t* key) {
+	Slot* slot = Lookup(key, Hash(key));
+	return slot ? &slot->value : 0;
+      }
+
+      const T* find(const byte_t* key) const {
+	const Slot* slot = Lookup(key, Hash(key));
+	return slot ? &slot->value : 0;
+      }
+
+      // returns the value for key, adding a default one if there is none
+      T& get(const byte_t* key) {
+	ui32_t hash = Hash(key);
+	Slot* slot = Lookup(key, hash);
+
+	if ( slot )
+	  return slot->value;
+
+	if ( ( m_Count + 1 ) * 2 > m_Slots.size() )
+	  Grow();
+
+	ui32_t mask = m_Slots.size() - 1;
+	ui32_t j = hash & mask;
+
+	while ( m_Slots[j].used )
+	  j = ( j + 1 ) & mask;
+
+	memcpy(m_Slots[j].key, key, 16);
+	m_Slots[j].hash = hash;
+	m_Slots[j].used = true;
+	m_Count++;
+	return m_Slots[j].value;
+      }
+
+      // like std::map::insert, an existing value is kept
+      bool insert(const byte_t* key, const T& value) {
+	ui32_t count = m_Count;
+	T& slot_value = get(key);
+
+	if ( m_Count == count )
+	  return false;
+
+	slot_value = value;
+	return true;
+      }
+    };
+
   // Universal Label
   class UL : public Kumu::Identifier<SMPTE_UL_LENGTH>
     {
@@ -143,11 +278,14 @@ inline const char* ui64sz(ui64_t i, char* buf)
   //
   class Dictionary
     {
-      std::map<ASDCP::UL, ui32_t>   m_md_lookup;
+      LabelTable<ui32_t>            m_md_lookup;       // exact UL
+      LabelTable<ui32_t>            m_md_loose_lookup; // UL without version and stream bytes
       std::map<std::string, ui32_t> m_md_sym_lookup;
-      std::map<ui32_t, ASDCP::UL>   m_md_rev_lookup;
+      bool                          m_md_present[(ui32_t)ASDCP::MDD_Max];
 
       ASDCP_NO_COPY_CONSTRUCT(Dictionary);
+      void IndexEntry(ui32_t index, bool report_dupes);
+      void Reindex();
 
     public:
       MDDEntry m_MDD_Table[(ui32_t)ASDCP::MDD_Max];
@@ -241,8 +379,10 @@ inline const char* ui64sz(ui64_t i, char* buf)
     {
       ASDCP_NO_COPY_CONSTRUCT(KLVFilePacket);
 
+      Result_t InitFromView(const Kumu::FileReader&);
+
     public:
-      ASDCP::FrameBuffer m_Buffer;
+      ASDCP::FrameBuffer m_Buffer; // holds the packet unless the file is mapped
 
       KLVFilePacket() {}
       virtual ~KLVFilePacket() {}
@@ -31,9 +31,12 @@ THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <KM_fileio.h>
 #include <KM_log.h>
+#include <KM_mutex.h>
 #include <fcntl.h>
+#include <time.h>
 
 #include <assert.h>
+#include <openssl/sha.h>
 
 #ifdef KM_WIN32
 #include <direct.h>
@@ -69,6 +72,7 @@ struct iovec {
 #else
 # if defined(__linux__)
 #   include <sys/statfs.h>
+#   include <sys/syscall.h>
 # else
 #  include <sys/param.h>
 #  include <sys/mount.h>
@@ -76,6 +80,7 @@ struct iovec {
 
 #include <sys/stat.h>
 #include <sys/uio.h>
+#include <sys/mman.h>
 typedef struct stat     fstat_t;
 #endif
 
@@ -83,6 +88,152 @@ typedef struct stat     fstat_t;
 #include <sys/statfs.h>
 #endif
 
+#if defined(KM_HAVE_IO_URING) && defined(__linux__)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <errno.h>
+
+// the io_uring calls share one number on every architecture
+#ifndef __NR_io_uring_setup
+#define __NR_io_uring_setup    425
+#define __NR_io_uring_enter    426
+#define __NR_io_uring_register 427
+#endif
+#else
+#undef KM_HAVE_IO_URING
+#endif
+
+// FileWriter write queue, see EnableBuffering() and EnableAsyncIO()
+#define KM_WRITE_QUEUE
+
+//------------------------------------------------------------------------------------------
+// I/O accounting
+
+static Kumu::Mutex   s_IOStatsLock;
+static Kumu::IOStats s_IOStats;
+
+//
+void
+Kumu::IOStats::Add(const IOStats& rhs)
+{
+  Reads += rhs.Reads;
+  ReadBytes += rhs.ReadBytes;
+  Writes += rhs.Writes;
+  WriteBytes += rhs.WriteBytes;
+  Seeks += rhs.Seeks;
+  BlockedNanos += rhs.BlockedNanos;
+}
+
+//
+void
+Kumu::GetIOStats(IOStats& stats)
+{
+  AutoMutex lock(s_IOStatsLock);
+  stats = s_IOStats;
+}
+
+//
+void
+Kumu::ResetIOStats()
+{
+  AutoMutex lock(s_IOStatsLock);
+  s_IOStats = IOStats();
+}
+
+// a monotonic clock in nanoseconds, for the time spent blocked in I/O calls
+static ui64_t
+io_clock()
+{
+#ifdef KM_WIN32
+  LARGE_INTEGER count, frequency;
+  ::QueryPerformanceCounter(&count);
+  ::QueryPerformanceFrequency(&frequency);
+  return (ui64_t)( (double)count.QuadPart * 1e9 / (double)frequency.QuadPart );
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (ui64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+// counts one call that started at start
+static inline void
+io_count(Kumu::IOStats& stats, ui64_t& calls, ui64_t start)
+{
+  calls++;
+  stats.BlockedNanos += io_clock() - start;
+}
+
+// adds the counts of a file that is being closed to the process totals
+static void
+io_close(const Kumu::IOStats& stats)
+{
+  AutoMutex lock(s_IOStatsLock);
+  s_IOStats.Add(stats);
+}
+
+//------------------------------------------------------------------------------------------
+// page cache hints
+
+static ui32_t s_StreamOnceWindow = 64 * 1024 * 1024;
+
+//
+void
+Kumu::SetStreamOnceWindow(ui32_t window)
+{
+  s_StreamOnceWindow = window;
+}
+
+#ifndef KM_WIN32
+// hints for a file that was just opened, returns the window to drop pages behind
+static ui32_t
+cache_open(int fd, bool reading)
+{
+  ui32_t window = s_StreamOnceWindow;
+
+  if ( window == 0 )
+    return 0;
+
+#if defined(KM_MACOSX) && defined(F_NOCACHE)
+  fcntl(fd, F_NOCACHE, 1);
+  return 0; // nothing is kept that would need dropping
+#elif defined(POSIX_FADV_SEQUENTIAL)
+  posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+  if ( reading )
+    posix_fadvise(fd, 0, window, POSIX_FADV_WILLNEED);
+
+  return window;
+#else
+  return 0;
+#endif
+}
+
+// drops the pages more than window bytes behind pos, writing them back first when dirty
+static void
+cache_drop(int fd, Kumu::fpos_t& dropped, Kumu::fpos_t pos, ui32_t window, bool dirty)
+{
+#ifdef POSIX_FADV_DONTNEED
+  Kumu::fpos_t end = pos - window;
+
+  if ( end <= dropped )
+    return;
+
+#if defined(__linux__) && defined(SYNC_FILE_RANGE_WRITE)
+  // dirty pages are not dropped, wait for them to be written
+  if ( dirty )
+    sync_file_range(fd, dropped, end - dropped,
+		    SYNC_FILE_RANGE_WAIT_BEFORE|SYNC_FILE_RANGE_WRITE|SYNC_FILE_RANGE_WAIT_AFTER);
+#endif
+
+  posix_fadvise(fd, dropped, end - dropped, POSIX_FADV_DONTNEED);
+  dropped = end;
+#endif
+}
+#endif // KM_WIN32
+
 //
 static Kumu::Result_t
 do_stat(const char* path, fstat_t* stat_info)
@@ -733,186 +884,1576 @@ Kumu::FileReader::Size() const
   return 0;
 }
 
-// these are declared here instead of in the header file
-// because we have a mem_ptr that is managing a hidden class
-Kumu::FileWriter::FileWriter() {}
-Kumu::FileWriter::~FileWriter() {}
-
 //
-Kumu::Result_t
-Kumu::FileWriter::Writev(const byte_t* buf, ui32_t buf_len)
+class Kumu::FileWriter::h__digest
 {
-  assert( ! m_IOVec.empty() );
-  register h__iovec* iov = m_IOVec;
-  KM_TEST_NULL_L(buf);
+public:
+  SHA_CTX        m_Context;
+  Kumu::fpos_t   m_Offset;  // bytes hashed so far
+  bool           m_Stale;   // the file was not written strictly in order
+  bool           m_Done;
+  byte_t         m_Value[SHA_DIGEST_LENGTH];
+
+  h__digest() : m_Offset(0), m_Stale(false), m_Done(false) { SHA1_Init(&m_Context); }
+
+  //
+  void Update(Kumu::fpos_t pos, const byte_t* buf, ui32_t buf_len)
+  {
+    if ( m_Stale || pos != m_Offset )
+      {
+	m_Stale = true;
+	return;
+      }
 
-  if ( iov->m_Count >= IOVecMaxEntries )
-    {
-      DefaultLogSink().Error("The iovec is full! Only %u entries allowed before a flush.\n",
-			     IOVecMaxEntries);
-      return RESULT_WRITEFAIL;
-    }
+    Kumu::TraceSpan span("digest");
+    SHA1_Update(&m_Context, buf, buf_len);
+    m_Offset += buf_len;
+  }
 
-  iov->m_iovec[iov->m_Count].iov_base = (char*)buf; // stupid iovec uses char*
-  iov->m_iovec[iov->m_Count].iov_len = buf_len;
-  iov->m_Count++;
+  //
+  Result_t Final(const std::string& filename)
+  {
+    if ( ! m_Stale )
+      {
+	SHA1_Final(m_Value, &m_Context);
+	m_Done = true;
+	return RESULT_OK;
+      }
 
-  return RESULT_OK;
-}
+    // hash the finished file again from the top
+    const ui32_t buf_len = 1024 * 1024;
+    ByteString   buffer;
+    FileReader   reader;
+    ui32_t       read_count = 0;
+    Result_t     result = buffer.Capacity(buf_len);
 
+    if ( KM_SUCCESS(result) )
+      result = reader.OpenRead(filename);
 
-#ifdef KM_WIN32
+    if ( KM_SUCCESS(result) )
+      {
+	SHA1_Init(&m_Context);
+
+	while ( KM_SUCCESS(result = reader.Read(buffer.Data(), buf_len, &read_count)) )
+	  SHA1_Update(&m_Context, buffer.Data(), read_count);
+
+	if ( result == RESULT_ENDOFFILE )
+	  {
+	    SHA1_Final(m_Value, &m_Context);
+	    m_Done = true;
+	    result = RESULT_OK;
+	  }
+      }
+
+    return result;
+  }
+};
+
+#ifdef KM_WRITE_QUEUE
 //------------------------------------------------------------------------------------------
-//
+// FileWriter write queue. Writes are gathered into large aligned buffers, each written
+// at an explicit offset either with pwrite() or, when EnableAsyncIO() found io_uring, in
+// the background with at most one operation per buffer in flight. The kernel file
+// pointer is only brought up to date when the queue is drained. On win32 the buffers
+// are written with WriteFile() at the offset of an OVERLAPPED, in the background
+// through a second handle opened with FILE_FLAG_OVERLAPPED.
+
+//
+class Kumu::FileWriter::h__queue
+{
+  KM_NO_COPY_CONSTRUCT(h__queue);
+
+  struct buffer_t
+  {
+    byte_t*      data;
+    ui32_t       capacity; // bytes this buffer may take before it is written
+    ui32_t       length;   // bytes held, or requested for a read
+    ui32_t       done;     // bytes completed
+    Kumu::fpos_t offset;
+    bool         busy;
+    bool         read;
+#ifdef KM_HAVE_IO_URING
+    struct iovec iov;
+#endif
+#ifdef KM_WIN32
+    FileHandle   file;     // the handle of the operation in flight
+#endif
+  };
+
+#ifdef KM_HAVE_IO_URING
+  void*         m_SqMap;
+  size_t        m_SqMapSize;
+  void*         m_CqMap;
+  size_t        m_CqMapSize;
+  io_uring_sqe* m_Sqes;
+  size_t        m_SqesSize;
+  unsigned*     m_SqTail;
+  unsigned*     m_SqMask;
+  unsigned*     m_SqArray;
+  unsigned*     m_CqHead;
+  unsigned*     m_CqTail;
+  unsigned*     m_CqMask;
+  io_uring_cqe* m_Cqes;
+#endif
+  int           m_Ring;    // -1 when writing synchronously
+  bool          m_Fixed;   // buffers are registered with the ring
+#ifdef KM_WIN32
+  OVERLAPPED*   m_Overlapped; // one per buffer, the event is set when its operation is done
+  FileHandle    m_Async;      // overlapped handle for background I/O, or INVALID_HANDLE_VALUE
+#endif
 
-Kumu::Result_t
-Kumu::FileReader::OpenRead(const std::string& filename) const
-{
-  const_cast<FileReader*>(this)->m_Filename = filename;
-  
-  // suppress popup window on error
-  UINT prev = ::SetErrorMode(SEM_FAILCRITICALERRORS|SEM_NOOPENFILEERRORBOX);
+  buffer_t*     m_Buffers;
+  ui32_t        m_BufferCount;
+  ui32_t        m_BufferSize;
+  ui32_t        m_Alignment;
+  ui32_t        m_Current;
+  FileHandle    m_File;
+  FileHandle    m_Direct;  // O_DIRECT descriptor (unbuffered handle on win32) for aligned writes
+  Kumu::IOStats* m_Stats;  // the counts of the file
 
-  const_cast<FileReader*>(this)->m_Handle = ::CreateFileA(filename.c_str(),
-			  (GENERIC_READ),                // open for reading
-			  FILE_SHARE_READ,               // share for reading
-			  NULL,                          // no security
-			  OPEN_EXISTING,                 // read
-			  FILE_ATTRIBUTE_NORMAL,         // normal file
-			  NULL                           // no template file
-			  );
+public:
+  Kumu::fpos_t  m_Position;  // where the next Write() lands
+  bool          m_Error;
 
-  ::SetErrorMode(prev);
+  h__queue() :
+#ifdef KM_HAVE_IO_URING
+    m_SqMap(MAP_FAILED), m_SqMapSize(0), m_CqMap(MAP_FAILED), m_CqMapSize(0),
+    m_Sqes((io_uring_sqe*)MAP_FAILED), m_SqesSize(0),
+#endif
+    m_Ring(-1), m_Fixed(false),
+#ifdef KM_WIN32
+    m_Overlapped(0), m_Async(INVALID_HANDLE_VALUE),
+#endif
+    m_Buffers(0), m_BufferCount(0), m_BufferSize(0), m_Alignment(1),
+    m_Current(0), m_File(INVALID_HANDLE_VALUE), m_Direct(INVALID_HANDLE_VALUE), m_Stats(0),
+    m_Position(0), m_Error(false) {}
 
-  return ( m_Handle == INVALID_HANDLE_VALUE ) ?
-    Kumu::RESULT_FILEOPEN : Kumu::RESULT_OK;
-}
+  //
+  ~h__queue()
+  {
+#ifdef KM_WIN32
+    // nothing may complete into the buffers once they are freed
+    for ( ui32_t i = 0; m_Buffers != 0 && i < m_BufferCount; i++ )
+      {
+	if ( m_Buffers[i].busy )
+	  {
+	    DWORD count;
+	    ::GetOverlappedResult(m_Buffers[i].file, &m_Overlapped[i], &count, TRUE);
+	  }
+      }
 
-//
-Kumu::Result_t
-Kumu::FileReader::Close() const
-{
-  if ( m_Handle == INVALID_HANDLE_VALUE )
-    return Kumu::RESULT_FILEOPEN;
+    if ( m_Overlapped != 0 )
+      {
+	for ( ui32_t i = 0; i < m_BufferCount; i++ )
+	  {
+	    if ( m_Overlapped[i].hEvent != NULL )
+	      ::CloseHandle(m_Overlapped[i].hEvent);
+	  }
 
-  // suppress popup window on error
-  UINT prev = ::SetErrorMode(SEM_FAILCRITICALERRORS|SEM_NOOPENFILEERRORBOX);
-  BOOL result = ::CloseHandle(m_Handle);
-  ::SetErrorMode(prev);
-  const_cast<FileReader*>(this)->m_Handle = INVALID_HANDLE_VALUE;
+	delete [] m_Overlapped;
+      }
 
-  return ( result == 0 ) ? Kumu::RESULT_FAIL : Kumu::RESULT_OK;
-}
+    if ( m_Async != INVALID_HANDLE_VALUE )
+      ::CloseHandle(m_Async);
 
-//
-Kumu::Result_t
-Kumu::FileReader::Seek(Kumu::fpos_t position, SeekPos_t whence) const
-{
-  if ( m_Handle == INVALID_HANDLE_VALUE )
-    return Kumu::RESULT_STATE;
+    if ( m_Direct != INVALID_HANDLE_VALUE )
+      ::CloseHandle(m_Direct);
+#else
+    if ( m_Ring != -1 )
+      close(m_Ring); // waits for anything still in flight
+#endif
 
-  LARGE_INTEGER in;
-  UINT prev = ::SetErrorMode(SEM_FAILCRITICALERRORS|SEM_NOOPENFILEERRORBOX);
-  in.QuadPart = position;
-  in.LowPart = ::SetFilePointer(m_Handle, in.LowPart, &in.HighPart, whence);
-  HRESULT LastError = GetLastError();
-  ::SetErrorMode(prev);
+#ifdef KM_HAVE_IO_URING
+    if ( m_Sqes != MAP_FAILED )
+      munmap(m_Sqes, m_SqesSize);
 
-  if ( (LastError != NO_ERROR
-	&& (in.LowPart == INVALID_SET_FILE_POINTER
-	    || in.LowPart == ERROR_NEGATIVE_SEEK )) )
-    return Kumu::RESULT_READFAIL;
-  
-  return Kumu::RESULT_OK;
-}
+    if ( m_CqMap != MAP_FAILED && m_CqMap != m_SqMap )
+      munmap(m_CqMap, m_CqMapSize);
 
-//
-Kumu::Result_t
-Kumu::FileReader::Tell(Kumu::fpos_t* pos) const
-{
-  KM_TEST_NULL_L(pos);
+    if ( m_SqMap != MAP_FAILED )
+      munmap(m_SqMap, m_SqMapSize);
+#endif
 
-  if ( m_Handle == INVALID_HANDLE_VALUE )
-    return Kumu::RESULT_FILEOPEN;
+#ifndef KM_WIN32
+    if ( m_Direct != INVALID_HANDLE_VALUE )
+      close(m_Direct);
+#endif
 
-  LARGE_INTEGER in;
-  UINT prev = ::SetErrorMode(SEM_FAILCRITICALERRORS|SEM_NOOPENFILEERRORBOX);
-  in.QuadPart = (__int64)0;
-  in.LowPart = ::SetFilePointer(m_Handle, in.LowPart, &in.HighPart, FILE_CURRENT);
-  HRESULT LastError = GetLastError();
-  ::SetErrorMode(prev);
+    if ( m_Buffers != 0 )
+      {
+	for ( ui32_t i = 0; i < m_BufferCount; i++ )
+	  queue_free(m_Buffers[i].data);
 
-  if ( (LastError != NO_ERROR
-	&& (in.LowPart == INVALID_SET_FILE_POINTER
-	    || in.LowPart == ERROR_NEGATIVE_SEEK )) )
-    return Kumu::RESULT_READFAIL;
+	delete [] m_Buffers;
+      }
+  }
 
-  *pos = (Kumu::fpos_t)in.QuadPart;
-  return Kumu::RESULT_OK;
-}
+  //
+  Result_t Init(FileHandle fd, Kumu::IOStats* stats, Kumu::fpos_t position, ui32_t buffer_count,
+		ui32_t buffer_size, ui32_t alignment)
+  {
+    if ( alignment == 0 || ( alignment & ( alignment - 1 ) ) != 0 )
+      return RESULT_PARAM;
 
-//
-Kumu::Result_t
-Kumu::FileReader::Read(byte_t* buf, ui32_t buf_len, ui32_t* read_count) const
-{
-  KM_TEST_NULL_L(buf);
-  Result_t result = Kumu::RESULT_OK;
-  DWORD    tmp_count;
-  ui32_t tmp_int;
+    if ( alignment < sizeof(void*) )
+      alignment = sizeof(void*);
 
-  if ( read_count == 0 )
-    read_count = &tmp_int;
+    // whole blocks, so a full buffer that starts on a boundary also ends on one
+    buffer_size = ( buffer_size + alignment - 1 ) & ~( alignment - 1 );
 
-  *read_count = 0;
+    m_Buffers = new buffer_t[buffer_count];
+    memset(m_Buffers, 0, buffer_count * sizeof(buffer_t));
+    m_BufferCount = buffer_count;
+    m_BufferSize = buffer_size;
+    m_Alignment = alignment;
 
-  if ( m_Handle == INVALID_HANDLE_VALUE )
-    return Kumu::RESULT_FILEOPEN;
-  
-  UINT prev = ::SetErrorMode(SEM_FAILCRITICALERRORS|SEM_NOOPENFILEERRORBOX);
-  if ( ::ReadFile(m_Handle, buf, buf_len, &tmp_count, NULL) == 0 )
-    result = Kumu::RESULT_READFAIL;
+    for ( ui32_t i = 0; i < buffer_count; i++ )
+      {
+	m_Buffers[i].data = queue_alloc(buffer_size, alignment < 4096 ? 4096 : alignment);
 
-  ::SetErrorMode(prev);
+	if ( m_Buffers[i].data == 0 )
+	  return RESULT_ALLOC;
 
-  if ( tmp_count == 0 ) /* EOF */
-    result = Kumu::RESULT_ENDOFFILE;
+#ifdef KM_HAVE_IO_URING
+	m_Buffers[i].iov.iov_base = m_Buffers[i].data;
+	m_Buffers[i].iov.iov_len = buffer_size;
+#endif
+      }
 
-  if ( KM_SUCCESS(result) )
-    *read_count = tmp_count;
+#ifdef KM_WIN32
+    m_Overlapped = new OVERLAPPED[buffer_count];
+    memset(m_Overlapped, 0, buffer_count * sizeof(OVERLAPPED));
 
-  return result;
-}
+    for ( ui32_t i = 0; i < buffer_count; i++ )
+      {
+	m_Overlapped[i].hEvent = ::CreateEvent(NULL, TRUE, FALSE, NULL);
 
+	if ( m_Overlapped[i].hEvent == NULL )
+	  return RESULT_ALLOC;
+      }
+#endif
 
+    m_File = fd;
+    m_Stats = stats;
+    m_Position = position;
+    return RESULT_OK;
+  }
 
-//------------------------------------------------------------------------------------------
-//
+  // an O_DIRECT descriptor used for the block aligned writes, the rest go through the
+  // page cache
+  Result_t OpenDirect(const std::string& filename)
+  {
+#ifdef KM_WIN32
+    // unbuffered writes must be sector aligned, the alignment is a multiple of 512
+    if ( m_Alignment < 512 || ( m_Alignment % 512 ) != 0 )
+      return RESULT_PARAM;
 
-//
-Kumu::Result_t
-Kumu::FileWriter::OpenWrite(const std::string& filename)
-{
-  m_Filename = filename;
-  
-  // suppress popup window on error
-  UINT prev = ::SetErrorMode(SEM_FAILCRITICALERRORS|SEM_NOOPENFILEERRORBOX);
+    m_Direct = open_overlapped(filename, FILE_FLAG_NO_BUFFERING);
 
-  m_Handle = ::CreateFileA(filename.c_str(),
-			  (GENERIC_WRITE|GENERIC_READ),  // open for reading
-			  FILE_SHARE_READ,               // share for reading
-			  NULL,                          // no security
-			  CREATE_ALWAYS,                 // overwrite (beware!)
-			  FILE_ATTRIBUTE_NORMAL,         // normal file
-			  NULL                           // no template file
-			  );
+    if ( m_Direct == INVALID_HANDLE_VALUE )
+      {
+	DefaultLogSink().Error("Error opening file %s for unbuffered I/O: %lu\n", filename.c_str(), ::GetLastError());
+	return RESULT_FILEOPEN;
+      }
 
-  ::SetErrorMode(prev);
+    return RESULT_OK;
+#elif defined(O_DIRECT)
+    m_Direct = open(filename.c_str(), O_WRONLY|O_DIRECT, 0);
 
+    if ( m_Direct == -1 )
+      {
+	DefaultLogSink().Error("Error opening file %s for direct I/O: %s\n", filename.c_str(), strerror(errno));
+	return RESULT_FILEOPEN;
+      }
+
+    return RESULT_OK;
+#else
+    return RESULT_NOTIMPL;
+#endif
+  }
+
+  //
+  Result_t InitRing(const std::string& filename)
+  {
+#ifdef KM_WIN32
+    m_Async = open_overlapped(filename, 0);
+
+    if ( m_Async == INVALID_HANDLE_VALUE )
+      return RESULT_NOTIMPL;
+
+    return RESULT_OK;
+#elif defined(KM_HAVE_IO_URING)
+    (void)filename; // the ring works on the descriptor the writer already has
+    io_uring_params params;
+    memset(&params, 0, sizeof(params));
+
+    int ring = syscall(__NR_io_uring_setup, m_BufferCount, &params);
+
+    if ( ring == -1 )
+      return RESULT_NOTIMPL;
+
+    m_Ring = ring;
+    m_SqMapSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    m_CqMapSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+    if ( params.features & IORING_FEAT_SINGLE_MMAP )
+      {
+	if ( m_CqMapSize > m_SqMapSize )
+	  m_SqMapSize = m_CqMapSize;
+
+	m_CqMapSize = m_SqMapSize;
+      }
+
+    m_SqMap = mmap(0, m_SqMapSize, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_POPULATE, m_Ring, IORING_OFF_SQ_RING);
+
+    if ( m_SqMap == MAP_FAILED )
+      return RESULT_ALLOC;
+
+    if ( params.features & IORING_FEAT_SINGLE_MMAP )
+      m_CqMap = m_SqMap;
+    else
+      m_CqMap = mmap(0, m_CqMapSize, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_POPULATE, m_Ring, IORING_OFF_CQ_RING);
+
+    if ( m_CqMap == MAP_FAILED )
+      return RESULT_ALLOC;
+
+    m_SqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    m_Sqes = (io_uring_sqe*)mmap(0, m_SqesSize, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_POPULATE, m_Ring, IORING_OFF_SQES);
+
+    if ( m_Sqes == MAP_FAILED )
+      return RESULT_ALLOC;
+
+    byte_t* sq = (byte_t*)m_SqMap;
+    byte_t* cq = (byte_t*)m_CqMap;
+    m_SqTail  = (unsigned*)(sq + params.sq_off.tail);
+    m_SqMask  = (unsigned*)(sq + params.sq_off.ring_mask);
+    m_SqArray = (unsigned*)(sq + params.sq_off.array);
+    m_CqHead  = (unsigned*)(cq + params.cq_off.head);
+    m_CqTail  = (unsigned*)(cq + params.cq_off.tail);
+    m_CqMask  = (unsigned*)(cq + params.cq_off.ring_mask);
+    m_Cqes    = (io_uring_cqe*)(cq + params.cq_off.cqes);
+
+    // registration pins the pages and is limited by RLIMIT_MEMLOCK, without it
+    // the same buffers are passed with each request
+    struct iovec* iov = new struct iovec[m_BufferCount];
+
+    for ( ui32_t i = 0; i < m_BufferCount; i++ )
+      iov[i] = m_Buffers[i].iov;
+
+    m_Fixed = ( syscall(__NR_io_uring_register, m_Ring, IORING_REGISTER_BUFFERS, iov, m_BufferCount) == 0 );
+    delete [] iov;
+    return RESULT_OK;
+#else
+    (void)filename;
+    return RESULT_NOTIMPL;
+#endif
+  }
+
+  //
+  bool IsAsync() const
+  {
+#ifdef KM_WIN32
+    return m_Async != INVALID_HANDLE_VALUE;
+#else
+    return m_Ring != -1;
+#endif
+  }
+
+  //
+  void Submit(ui32_t index)
+  {
+    buffer_t& buf = m_Buffers[index];
+    Kumu::fpos_t offset = buf.offset + buf.done;
+    byte_t* data = buf.data + buf.done;
+    ui32_t length = buf.length - buf.done;
+    FileHandle fd = m_File;
+
+#ifdef KM_WIN32
+    if ( m_Async != INVALID_HANDLE_VALUE )
+      fd = m_Async;
+#endif
+
+    if ( m_Direct != INVALID_HANDLE_VALUE && ! buf.read
+	 && ( offset % m_Alignment ) == 0 && ( length % m_Alignment ) == 0
+	 && ( (size_t)data % m_Alignment ) == 0 )
+      fd = m_Direct;
+
+    buf.busy = true;
+
+#ifdef KM_HAVE_IO_URING
+    if ( m_Ring != -1 )
+      {
+	unsigned tail = *m_SqTail;
+	unsigned slot = tail & *m_SqMask;
+	io_uring_sqe* sqe = &m_Sqes[slot];
+
+	memset(sqe, 0, sizeof(io_uring_sqe));
+	sqe->fd = fd;
+	sqe->off = offset;
+	sqe->user_data = index;
+
+	if ( m_Fixed )
+	  {
+	    sqe->opcode = buf.read ? IORING_OP_READ_FIXED : IORING_OP_WRITE_FIXED;
+	    sqe->addr = (unsigned long)data;
+	    sqe->len = length;
+	    sqe->buf_index = index;
+	  }
+	else
+	  {
+	    buf.iov.iov_base = data;
+	    buf.iov.iov_len = length;
+	    sqe->opcode = buf.read ? IORING_OP_READV : IORING_OP_WRITEV;
+	    sqe->addr = (unsigned long)&buf.iov;
+	    sqe->len = 1;
+	  }
+
+	m_SqArray[slot] = slot;
+	__atomic_store_n(m_SqTail, tail + 1, __ATOMIC_RELEASE);
+
+	ui64_t start = io_clock();
+
+	while ( syscall(__NR_io_uring_enter, m_Ring, 1, 0, 0, 0, 0) == -1 && errno == EINTR )
+	  ;
+
+	io_count(*m_Stats, buf.read ? m_Stats->Reads : m_Stats->Writes, start);
+	return;
+      }
+#endif
+
+#ifdef KM_WIN32
+    OVERLAPPED& ov = m_Overlapped[index];
+    ::ResetEvent(ov.hEvent);
+    ov.Internal = ov.InternalHigh = 0;
+    ov.Offset = (DWORD)offset;
+    ov.OffsetHigh = (DWORD)( (ui64_t)offset >> 32 );
+    buf.file = fd;
+
+    DWORD count = 0;
+    ui64_t start = io_clock();
+    BOOL ok = buf.read ? ::ReadFile(fd, data, length, &count, &ov) : ::WriteFile(fd, data, length, &count, &ov);
+    DWORD error = ok ? ERROR_SUCCESS : ::GetLastError();
+
+    // the handles other than the file's own are overlapped, Reap() collects them
+    if ( fd != m_File && ( ok || error == ERROR_IO_PENDING ) )
+      {
+	if ( IsAsync() )
+	  {
+	    io_count(*m_Stats, buf.read ? m_Stats->Reads : m_Stats->Writes, start);
+	    return;
+	  }
+
+	ok = ::GetOverlappedResult(fd, &ov, &count, TRUE);
+	error = ok ? ERROR_SUCCESS : ::GetLastError();
+      }
+
+    io_count(*m_Stats, buf.read ? m_Stats->Reads : m_Stats->Writes, start);
+
+    Complete(index, ok ? (i32_t)count : ( error == ERROR_HANDLE_EOF ? 0 : -EIO ));
+#else
+    ssize_t res;
+    ui64_t start = io_clock();
+
+    do {
+      res = buf.read ? pread(fd, data, length, offset) : pwrite(fd, data, length, offset);
+    } while ( res == -1 && errno == EINTR );
+
+    io_count(*m_Stats, buf.read ? m_Stats->Reads : m_Stats->Writes, start);
+
+    Complete(index, res == -1 ? -errno : (i32_t)res);
+#endif
+  }
+
+  // account for a finished operation, resubmitting what is left of a short one
+  void Complete(ui32_t index, i32_t res)
+  {
+    if ( index >= m_BufferCount )
+      return;
+
+    buffer_t& buf = m_Buffers[index];
+    buf.busy = false;
+
+    if ( res == -EAGAIN || res == -EINTR )
+      {
+	Submit(index);
+	return;
+      }
+
+    if ( res < 0 || ( res == 0 && ! buf.read ) )
+      {
+	DefaultLogSink().Error("Buffered %s failed: %s\n", buf.read ? "read" : "write",
+			       strerror(res < 0 ? -res : EIO));
+	m_Error = true;
+	buf.length = buf.done = 0;
+	return;
+      }
+
+    buf.done += res;
+    ( buf.read ? m_Stats->ReadBytes : m_Stats->WriteBytes ) += res;
+
+    if ( res == 0 ) // end of file
+      buf.length = buf.done;
+    else if ( buf.done < buf.length )
+      Submit(index);
+    else if ( ! buf.read )
+      buf.length = buf.done = 0; // free for the next Write()
+  }
+
+  // wait for one completion
+  void Reap()
+  {
+#ifdef KM_HAVE_IO_URING
+    if ( m_Ring == -1 )
+      return;
+
+    unsigned head = *m_CqHead;
+    ui64_t start = io_clock();
+
+    while ( head == __atomic_load_n(m_CqTail, __ATOMIC_ACQUIRE) )
+      {
+	if ( syscall(__NR_io_uring_enter, m_Ring, 0, 1, IORING_ENTER_GETEVENTS, 0, 0) == -1
+	     && errno != EINTR )
+	  {
+	    DefaultLogSink().Error("io_uring wait failed: %s\n", strerror(errno));
+	    m_Error = true;
+	    return;
+	  }
+      }
+
+    m_Stats->BlockedNanos += io_clock() - start;
+    io_uring_cqe* cqe = &m_Cqes[head & *m_CqMask];
+    ui32_t index = (ui32_t)cqe->user_data;
+    i32_t res = cqe->res;
+    __atomic_store_n(m_CqHead, head + 1, __ATOMIC_RELEASE);
+    Complete(index, res);
+#elif defined(KM_WIN32)
+    if ( ! IsAsync() )
+      return;
+
+    HANDLE events[MAXIMUM_WAIT_OBJECTS];
+    ui32_t which[MAXIMUM_WAIT_OBJECTS];
+    DWORD count = 0;
+
+    for ( ui32_t i = 0; i < m_BufferCount; i++ )
+      {
+	if ( m_Buffers[i].busy )
+	  {
+	    events[count] = m_Overlapped[i].hEvent;
+	    which[count++] = i;
+	  }
+      }
+
+    if ( count == 0 )
+      return;
+
+    ui64_t start = io_clock();
+    DWORD wait = ::WaitForMultipleObjects(count, events, FALSE, INFINITE);
+    m_Stats->BlockedNanos += io_clock() - start;
+
+    if ( wait >= WAIT_OBJECT_0 + count )
+      {
+	DefaultLogSink().Error("Overlapped I/O wait failed: %lu\n", ::GetLastError());
+	m_Error = true;
+	return;
+      }
+
+    ui32_t index = which[wait - WAIT_OBJECT_0];
+    DWORD done = 0;
+
+    if ( ::GetOverlappedResult(m_Buffers[index].file, &m_Overlapped[index], &done, FALSE) )
+      Complete(index, (i32_t)done);
+    else
+      Complete(index, ::GetLastError() == ERROR_HANDLE_EOF ? 0 : -EIO);
+#endif
+  }
+
+  //
+  bool Wait(ui32_t index)
+  {
+    while ( m_Buffers[index].busy && ! m_Error )
+      Reap();
+
+    return ! m_Error;
+  }
+
+  // write out the partly filled buffer
+  void Flush()
+  {
+    buffer_t& buf = m_Buffers[m_Current];
+
+    if ( buf.busy || buf.length == 0 )
+      return;
+
+    buf.read = false;
+    Submit(m_Current);
+    m_Current = ( m_Current + 1 ) % m_BufferCount;
+  }
+
+  //
+  Result_t Drain()
+  {
+    Flush();
+
+    for ( ui32_t i = 0; i < m_BufferCount; i++ )
+      {
+	while ( m_Buffers[i].busy && ! m_Error )
+	  Reap();
+
+	m_Buffers[i].length = m_Buffers[i].done = 0;
+      }
+
+    ui64_t start = io_clock();
+#ifdef KM_WIN32
+    LARGE_INTEGER pos;
+    pos.QuadPart = m_Position;
+    BOOL moved = ::SetFilePointerEx(m_File, pos, NULL, FILE_BEGIN);
+    io_count(*m_Stats, m_Stats->Seeks, start);
+
+    if ( ! moved )
+      return RESULT_BADSEEK;
+#else
+    Kumu::fpos_t pos = lseek(m_File, m_Position, SEEK_SET);
+    io_count(*m_Stats, m_Stats->Seeks, start);
+
+    if ( pos == -1L )
+      return RESULT_BADSEEK;
+#endif
+
+    return m_Error ? RESULT_WRITEFAIL : RESULT_OK;
+  }
+
+  //
+  Result_t Write(const byte_t* buf, ui32_t buf_len)
+  {
+    while ( buf_len > 0 )
+      {
+	buffer_t& cur = m_Buffers[m_Current];
+
+	if ( ! Wait(m_Current) )
+	  return RESULT_WRITEFAIL;
+
+	if ( cur.length == 0 )
+	  {
+	    // stop at the next block boundary so the buffers after this one are aligned
+	    cur.offset = m_Position;
+	    cur.done = 0;
+	    cur.capacity = m_BufferSize - (ui32_t)( m_Position % m_Alignment );
+	  }
+
+	ui32_t count = cur.capacity - cur.length;
+
+	if ( count > buf_len )
+	  count = buf_len;
+
+	memcpy(cur.data + cur.length, buf, count);
+	cur.length += count;
+	m_Position += count;
+	buf += count;
+	buf_len -= count;
+
+	if ( cur.length == cur.capacity )
+	  Flush();
+      }
+
+    return m_Error ? RESULT_WRITEFAIL : RESULT_OK;
+  }
+
+  // hash the file from the top with every buffer used as read ahead, call after Drain()
+  Result_t HashFile(SHA_CTX* context)
+  {
+#ifdef KM_WIN32
+    LARGE_INTEGER info;
+
+    if ( ! ::GetFileSizeEx(m_File, &info) )
+      return RESULT_READFAIL;
+
+    Kumu::fpos_t size = info.QuadPart;
+#else
+    fstat_t info;
+
+    if ( fstat(m_File, &info) == -1 )
+      return RESULT_READFAIL;
+
+    Kumu::fpos_t size = info.st_size;
+#endif
+    Kumu::fpos_t next = 0;
+    ui32_t i;
+
+    // synchronously one buffer is enough
+    ui32_t count = IsAsync() ? m_BufferCount : 1;
+
+    for ( i = 0; i < count && next < size; i++ )
+      {
+	ReadAt(i, next, size);
+	next += m_BufferSize;
+      }
+
+    for ( i = 0; ! m_Error; i = ( i + 1 ) % count )
+      {
+	buffer_t& buf = m_Buffers[i];
+
+	if ( ! buf.read )
+	  break; // nothing was asked of this buffer, the file is done
+
+	if ( ! Wait(i) )
+	  break;
+
+	SHA1_Update(context, buf.data, buf.done);
+	buf.read = false;
+	buf.length = buf.done = 0;
+
+	if ( next < size )
+	  {
+	    ReadAt(i, next, size);
+	    next += m_BufferSize;
+	  }
+      }
+
+    return m_Error ? RESULT_READFAIL : RESULT_OK;
+  }
+
+private:
+  //
+  static byte_t* queue_alloc(ui32_t size, ui32_t alignment)
+  {
+#ifdef KM_WIN32
+    return (byte_t*)_aligned_malloc(size, alignment);
+#else
+    void* data = 0;
+    return posix_memalign(&data, alignment, size) == 0 ? (byte_t*)data : 0;
+#endif
+  }
+
+  //
+  static void queue_free(byte_t* data)
+  {
+#ifdef KM_WIN32
+    _aligned_free(data);
+#else
+    free(data);
+#endif
+  }
+
+#ifdef KM_WIN32
+  // a second handle of the file, OpenWrite() shares the file for writing so it may be opened
+  static FileHandle open_overlapped(const std::string& filename, DWORD flags)
+  {
+    UINT prev = ::SetErrorMode(SEM_FAILCRITICALERRORS|SEM_NOOPENFILEERRORBOX);
+    FileHandle handle = ::CreateFileA(filename.c_str(), (GENERIC_WRITE|GENERIC_READ),
+				      (FILE_SHARE_READ|FILE_SHARE_WRITE), NULL, OPEN_EXISTING,
+				      (FILE_ATTRIBUTE_NORMAL|FILE_FLAG_OVERLAPPED|flags), NULL);
+    ::SetErrorMode(prev);
+    return handle;
+  }
+#endif
+
+  //
+  void ReadAt(ui32_t index, Kumu::fpos_t offset, Kumu::fpos_t size)
+  {
+    buffer_t& buf = m_Buffers[index];
+    buf.read = true;
+    buf.offset = offset;
+    buf.done = 0;
+    buf.length = ( size - offset < (Kumu::fpos_t)m_BufferSize ) ? (ui32_t)(size - offset) : m_BufferSize;
+    Submit(index);
+  }
+};
+
+#else // KM_WRITE_QUEUE
+
+class Kumu::FileWriter::h__queue
+{
+public:
+  Kumu::fpos_t m_Position;
+};
+
+#endif // KM_WRITE_QUEUE
+
+// these are declared here instead of in the header file
+// because we have a mem_ptr that is managing a hidden class
+Kumu::FileWriter::FileWriter() : m_Reserved(0), m_Observer(0) {}
+
+Kumu::FileWriter::~FileWriter()
+{
+#ifdef KM_WRITE_QUEUE
+  // the queued data must be on disk before the buffers go away
+  if ( ! m_Queue.empty() )
+    m_Queue->Drain();
+#endif
+}
+
+//
+Kumu::Result_t
+Kumu::FileWriter::EnableBuffering(ui32_t buffer_size, ui32_t alignment, bool direct_io)
+{
+  if ( ! IsOpen() )
+    return RESULT_STATE;
+
+#ifdef KM_WRITE_QUEUE
+  if ( buffer_size == 0 )
+    return RESULT_PARAM;
+
+  if ( ! m_Queue.empty() )
+    return RESULT_STATE;
+
+  h__queue* queue = new h__queue;
+  Result_t result = queue->Init(m_Handle, &m_Stats, FileReader::Tell(), 1, buffer_size, alignment);
+
+  if ( KM_SUCCESS(result) && direct_io )
+    result = queue->OpenDirect(m_Filename);
+
+  if ( KM_FAILURE(result) )
+    {
+      delete queue;
+      return result;
+    }
+
+  m_Queue = queue;
+  return RESULT_OK;
+#else
+  return RESULT_NOTIMPL;
+#endif
+}
+
+//
+Kumu::Result_t
+Kumu::FileWriter::EnableAsyncIO(ui32_t buffer_count, ui32_t buffer_size, bool direct_io)
+{
+  if ( ! IsOpen() )
+    return RESULT_STATE;
+
+#if defined(KM_HAVE_IO_URING) || defined(KM_WIN32)
+  if ( buffer_count == 0 || buffer_size == 0 )
+    return RESULT_PARAM;
+
+#ifdef KM_WIN32
+  // Reap() waits on the events of all buffers at once
+  if ( buffer_count > MAXIMUM_WAIT_OBJECTS )
+    buffer_count = MAXIMUM_WAIT_OBJECTS;
+#endif
+
+  if ( ! m_Queue.empty() )
+    return m_Queue->IsAsync() ? RESULT_OK : RESULT_STATE;
+
+  h__queue* queue = new h__queue;
+  Result_t result = queue->Init(m_Handle, &m_Stats, FileReader::Tell(), buffer_count, buffer_size, 4096);
+
+  if ( KM_SUCCESS(result) )
+    result = queue->InitRing(m_Filename);
+
+  if ( KM_SUCCESS(result) && direct_io )
+    result = queue->OpenDirect(m_Filename);
+
+  if ( KM_FAILURE(result) )
+    {
+      delete queue;
+      return result;
+    }
+
+  m_Queue = queue;
+  return RESULT_OK;
+#else
+  return RESULT_NOTIMPL;
+#endif
+}
+
+//
+Kumu::Result_t
+Kumu::FileWriter::EnableQueuedWrites(bool direct_io, ui32_t buffer_count, ui32_t buffer_size)
+{
+  Result_t result = EnableAsyncIO(buffer_count, buffer_size, direct_io);
+
+  if ( result == RESULT_NOTIMPL )
+    result = EnableBuffering(buffer_count * buffer_size, 4096, direct_io);
+
+  return result;
+}
+
+//
+Kumu::Result_t
+Kumu::FileWriter::Seek(Kumu::fpos_t position, SeekPos_t whence) const
+{
+#ifdef KM_WRITE_QUEUE
+  if ( ! m_Queue.empty() )
+    {
+      // writes to the same region must not be in flight together
+      Result_t result = m_Queue->Drain();
+
+      if ( KM_SUCCESS(result) )
+	result = FileReader::Seek(position, whence);
+
+      if ( KM_SUCCESS(result) )
+	result = FileReader::Tell(&m_Queue->m_Position);
+
+      return result;
+    }
+#endif
+
+  return FileReader::Seek(position, whence);
+}
+
+//
+Kumu::Result_t
+Kumu::FileWriter::Tell(Kumu::fpos_t* pos) const
+{
+  KM_TEST_NULL_L(pos);
+
+  if ( ! m_Queue.empty() )
+    {
+      *pos = m_Queue->m_Position;
+      return RESULT_OK;
+    }
+
+  return FileReader::Tell(pos);
+}
+
+//
+Kumu::Result_t
+Kumu::FileWriter::Read(byte_t* buf, ui32_t buf_len, ui32_t* read_count) const
+{
+#ifdef KM_WRITE_QUEUE
+  if ( ! m_Queue.empty() )
+    {
+      Result_t result = m_Queue->Drain();
+
+      if ( KM_SUCCESS(result) )
+	result = FileReader::Read(buf, buf_len, read_count);
+
+      FileReader::Tell(&m_Queue->m_Position);
+      return result;
+    }
+#endif
+
+  return FileReader::Read(buf, buf_len, read_count);
+}
+
+//
+Kumu::fsize_t
+Kumu::FileWriter::Size() const
+{
+#ifdef KM_WRITE_QUEUE
+  if ( ! m_Queue.empty() )
+    m_Queue->Drain();
+#endif
+
+  return FileReader::Size();
+}
+
+//
+Kumu::Result_t
+Kumu::FileWriter::EnableDigest()
+{
+  if ( ! IsOpen() )
+    return RESULT_STATE;
+
+  if ( m_Digest.empty() )
+    {
+      m_Digest = new h__digest;
+
+      // anything already on disk is picked up when the file is closed
+      if ( Tell() != 0 )
+	m_Digest->m_Stale = true;
+    }
+
+  return RESULT_OK;
+}
+
+//
+Kumu::Result_t
+Kumu::FileWriter::Digest(byte_t* digest) const
+{
+  KM_TEST_NULL_L(digest);
+
+  if ( m_Digest.empty() || ! m_Digest->m_Done )
+    return RESULT_STATE;
+
+  memcpy(digest, m_Digest->m_Value, SHA_DIGEST_LENGTH);
+  return RESULT_OK;
+}
+
+//
+Kumu::Result_t
+Kumu::FileWriter::SetObserver(WriteObserver* observer)
+{
+  if ( ! IsOpen() )
+    return RESULT_STATE;
+
+  m_Observer = observer;
+  return RESULT_OK;
+}
+
+// bytes moved per read when a copy goes through user space
+static const ui32_t CopyBufferSize = 8 * 1024 * 1024;
+
+// CopyFrom() when the kernel cannot move the data
+static Kumu::Result_t
+copy_through_buffer(Kumu::FileWriter& writer, const std::string& filename, Kumu::fpos_t offset, ui64_t length)
+{
+  Kumu::FileReader reader;
+  Kumu::ByteString buffer;
+  Kumu::Result_t result = reader.OpenRead(filename);
+
+  if ( KM_SUCCESS(result) )
+    result = reader.Seek(offset);
+
+  if ( KM_SUCCESS(result) )
+    result = buffer.Capacity((ui32_t)std::min<ui64_t>(length, CopyBufferSize));
+
+  while ( KM_SUCCESS(result) && length > 0 )
+    {
+      ui32_t read_count = 0;
+      result = reader.Read(buffer.Data(), (ui32_t)std::min<ui64_t>(length, buffer.Capacity()), &read_count);
+
+      if ( KM_SUCCESS(result) && read_count == 0 )
+	result = Kumu::RESULT_ENDOFFILE;
+
+      if ( KM_SUCCESS(result) )
+	result = writer.Write(buffer.Data(), read_count);
+
+      length -= read_count;
+    }
+
+  return result;
+}
+
+//
+Kumu::Result_t
+Kumu::FileWriter::Close()
+{
+  m_Observer = 0; // the queue is drained below, its data was observed when written
+
+#ifdef KM_WRITE_QUEUE
+  if ( ! m_Queue.empty() )
+    {
+      Result_t queue_result = m_Queue->Drain();
+
+      // the file is still open, read it back through the ring
+      if ( KM_SUCCESS(queue_result) && ! m_Digest.empty() && m_Digest->m_Stale )
+	{
+	  SHA1_Init(&m_Digest->m_Context);
+	  queue_result = m_Queue->HashFile(&m_Digest->m_Context);
+
+	  if ( KM_SUCCESS(queue_result) )
+	    m_Digest->m_Stale = false;
+	}
+
+      m_Queue.set(0);
+
+      if ( KM_FAILURE(queue_result) )
+	{
+	  ReleaseReserve();
+	  FileReader::Close();
+	  return queue_result;
+	}
+    }
+#endif
+
+  ReleaseReserve();
+  Result_t result = FileReader::Close();
+
+  if ( KM_SUCCESS(result) && ! m_Digest.empty() && ! m_Digest->m_Done )
+    result = m_Digest->Final(m_Filename);
+
+  return result;
+}
+
+//
+Kumu::Result_t
+Kumu::FileWriter::Writev(const byte_t* buf, ui32_t buf_len)
+{
+  assert( ! m_IOVec.empty() );
+  register h__iovec* iov = m_IOVec;
+  KM_TEST_NULL_L(buf);
+
+  if ( iov->m_Count >= IOVecMaxEntries )
+    {
+      DefaultLogSink().Error("The iovec is full! Only %u entries allowed before a flush.\n",
+			     IOVecMaxEntries);
+      return RESULT_WRITEFAIL;
+    }
+
+  iov->m_iovec[iov->m_Count].iov_base = (char*)buf; // stupid iovec uses char*
+  iov->m_iovec[iov->m_Count].iov_len = buf_len;
+  iov->m_Count++;
+
+  return RESULT_OK;
+}
+
+
+// Reads from a mapped file, the view is the next buf_len bytes or what is
+// left of the file, whichever is shorter.
+Kumu::Result_t
+Kumu::FileReader::ReadView(const byte_t** view, ui32_t buf_len, ui32_t* read_count) const
+{
+  KM_TEST_NULL_L(view);
+  ui32_t tmp_int = 0;
+
+  if ( read_count == 0 )
+    read_count = &tmp_int;
+
+  *read_count = 0;
+  *view = 0;
+
+  if ( m_Map == 0 )
+    return RESULT_STATE;
+
+  if ( m_MapPos < 0 || m_MapPos >= m_MapSize )
+    return RESULT_ENDOFFILE;
+
+  fsize_t left = m_MapSize - m_MapPos;
+  *read_count = ( left < (fsize_t)buf_len ) ? (ui32_t)left : buf_len;
+  *view = m_Map + m_MapPos;
+  m_MapPos += *read_count;
+  return RESULT_OK;
+}
+
+// Reads from a mapped file at offset, the file position is not used.
+Kumu::Result_t
+Kumu::FileReader::ReadViewAt(Kumu::fpos_t offset, const byte_t** view, ui32_t buf_len, ui32_t* read_count) const
+{
+  KM_TEST_NULL_L(view);
+  ui32_t tmp_int = 0;
+
+  if ( read_count == 0 )
+    read_count = &tmp_int;
+
+  *read_count = 0;
+  *view = 0;
+
+  if ( m_Map == 0 )
+    return RESULT_STATE;
+
+  if ( offset < 0 || offset >= m_MapSize )
+    return RESULT_ENDOFFILE;
+
+  fsize_t left = m_MapSize - offset;
+  *read_count = ( left < (fsize_t)buf_len ) ? (ui32_t)left : buf_len;
+  *view = m_Map + offset;
+  return RESULT_OK;
+}
+
+// moves the position of a mapped file, like lseek() it may pass the end
+static Kumu::Result_t
+map_seek(Kumu::fpos_t& map_pos, Kumu::fsize_t map_size, Kumu::fpos_t position, Kumu::SeekPos_t whence)
+{
+  Kumu::fpos_t base = 0;
+
+  if ( whence == Kumu::SP_POS )
+    base = map_pos;
+  else if ( whence == Kumu::SP_END )
+    base = map_size;
+
+  if ( base + position < 0 )
+    return Kumu::RESULT_BADSEEK;
+
+  map_pos = base + position;
+  return Kumu::RESULT_OK;
+}
+
+// copies out of a mapped file
+static Kumu::Result_t
+map_read(const Kumu::FileReader& Reader, byte_t* buf, ui32_t buf_len, ui32_t* read_count)
+{
+  const byte_t* view = 0;
+  Kumu::Result_t result = Reader.ReadView(&view, buf_len, read_count);
+
+  if ( KM_SUCCESS(result) )
+    memcpy(buf, view, *read_count);
+
+  return result;
+}
+
+#ifdef KM_WIN32
+//------------------------------------------------------------------------------------------
+//
+
+Kumu::Result_t
+Kumu::FileReader::OpenRead(const std::string& filename) const
+{
+  const_cast<FileReader*>(this)->m_Filename = filename;
+  
+  // suppress popup window on error
+  UINT prev = ::SetErrorMode(SEM_FAILCRITICALERRORS|SEM_NOOPENFILEERRORBOX);
+
+  const_cast<FileReader*>(this)->m_Handle = ::CreateFileA(filename.c_str(),
+			  (GENERIC_READ),                // open for reading
+			  FILE_SHARE_READ,               // share for reading
+			  NULL,                          // no security
+			  OPEN_EXISTING,                 // read
+			  ( s_StreamOnceWindow != 0 ? FILE_FLAG_SEQUENTIAL_SCAN : FILE_ATTRIBUTE_NORMAL ),
+			  NULL                           // no template file
+			  );
+
+  ::SetErrorMode(prev);
+  m_Stats = IOStats();
+
+  return ( m_Handle == INVALID_HANDLE_VALUE ) ?
+    Kumu::RESULT_FILEOPEN : Kumu::RESULT_OK;
+}
+
+//
+Kumu::Result_t
+Kumu::FileReader::Close() const
+{
+  if ( m_Handle == INVALID_HANDLE_VALUE )
+    return Kumu::RESULT_FILEOPEN;
+
+  if ( m_Map != 0 )
+    {
+      ::UnmapViewOfFile(m_Map);
+      ::CloseHandle(m_MapHandle);
+      m_Map = 0;
+      m_MapHandle = 0;
+      m_MapSize = m_MapPos = 0;
+    }
+
+  if ( m_AtHandle != INVALID_HANDLE_VALUE )
+    {
+      ::CloseHandle(m_AtHandle);
+      m_AtHandle = INVALID_HANDLE_VALUE;
+    }
+
+  // suppress popup window on error
+  UINT prev = ::SetErrorMode(SEM_FAILCRITICALERRORS|SEM_NOOPENFILEERRORBOX);
+  BOOL result = ::CloseHandle(m_Handle);
+  ::SetErrorMode(prev);
+  const_cast<FileReader*>(this)->m_Handle = INVALID_HANDLE_VALUE;
+  io_close(m_Stats);
+
+  return ( result == 0 ) ? Kumu::RESULT_FAIL : Kumu::RESULT_OK;
+}
+
+//
+Kumu::Result_t
+Kumu::FileReader::Seek(Kumu::fpos_t position, SeekPos_t whence) const
+{
+  if ( m_Handle == INVALID_HANDLE_VALUE )
+    return Kumu::RESULT_STATE;
+
+  if ( m_Map != 0 )
+    return map_seek(m_MapPos, m_MapSize, position, whence);
+
+  LARGE_INTEGER in;
+  UINT prev = ::SetErrorMode(SEM_FAILCRITICALERRORS|SEM_NOOPENFILEERRORBOX);
+  in.QuadPart = position;
+  ui64_t start = io_clock();
+  in.LowPart = ::SetFilePointer(m_Handle, in.LowPart, &in.HighPart, whence);
+  HRESULT LastError = GetLastError();
+  io_count(m_Stats, m_Stats.Seeks, start);
+  ::SetErrorMode(prev);
+
+  if ( (LastError != NO_ERROR
+	&& (in.LowPart == INVALID_SET_FILE_POINTER
+	    || in.LowPart == ERROR_NEGATIVE_SEEK )) )
+    return Kumu::RESULT_READFAIL;
+  
+  return Kumu::RESULT_OK;
+}
+
+//
+Kumu::Result_t
+Kumu::FileReader::Tell(Kumu::fpos_t* pos) const
+{
+  KM_TEST_NULL_L(pos);
+
+  if ( m_Handle == INVALID_HANDLE_VALUE )
+    return Kumu::RESULT_FILEOPEN;
+
+  if ( m_Map != 0 )
+    {
+      *pos = m_MapPos;
+      return Kumu::RESULT_OK;
+    }
+
+  LARGE_INTEGER in;
+  UINT prev = ::SetErrorMode(SEM_FAILCRITICALERRORS|SEM_NOOPENFILEERRORBOX);
+  in.QuadPart = (__int64)0;
+  ui64_t start = io_clock();
+  in.LowPart = ::SetFilePointer(m_Handle, in.LowPart, &in.HighPart, FILE_CURRENT);
+  HRESULT LastError = GetLastError();
+  io_count(m_Stats, m_Stats.Seeks, start);
+  ::SetErrorMode(prev);
+
+  if ( (LastError != NO_ERROR
+	&& (in.LowPart == INVALID_SET_FILE_POINTER
+	    || in.LowPart == ERROR_NEGATIVE_SEEK )) )
+    return Kumu::RESULT_READFAIL;
+
+  *pos = (Kumu::fpos_t)in.QuadPart;
+  return Kumu::RESULT_OK;
+}
+
+//
+Kumu::Result_t
+Kumu::FileReader::Read(byte_t* buf, ui32_t buf_len, ui32_t* read_count) const
+{
+  KM_TEST_NULL_L(buf);
+  Result_t result = Kumu::RESULT_OK;
+  DWORD    tmp_count;
+  ui32_t tmp_int;
+
+  if ( read_count == 0 )
+    read_count = &tmp_int;
+
+  *read_count = 0;
+
+  if ( m_Handle == INVALID_HANDLE_VALUE )
+    return Kumu::RESULT_FILEOPEN;
+
+  if ( m_Map != 0 )
+    return map_read(*this, buf, buf_len, read_count);
+  
+  UINT prev = ::SetErrorMode(SEM_FAILCRITICALERRORS|SEM_NOOPENFILEERRORBOX);
+  ui64_t start = io_clock();
+  if ( ::ReadFile(m_Handle, buf, buf_len, &tmp_count, NULL) == 0 )
+    result = Kumu::RESULT_READFAIL;
+
+  io_count(m_Stats, m_Stats.Reads, start);
+  ::SetErrorMode(prev);
+
+  if ( tmp_count == 0 ) /* EOF */
+    result = Kumu::RESULT_ENDOFFILE;
+
+  if ( KM_SUCCESS(result) )
+    {
+      m_Stats.ReadBytes += tmp_count;
+      *read_count = tmp_count;
+    }
+
+  return result;
+}
+
+// The handle of the reader is synchronous, a read through it at an offset
+// would still move its file pointer. Positional reads get a handle of their
+// own, opened for overlapped i/o, which has no file pointer.
+Kumu::Result_t
+Kumu::FileReader::ReadAt(Kumu::fpos_t offset, byte_t* buf, ui32_t buf_len, ui32_t* read_count) const
+{
+  KM_TEST_NULL_L(buf);
+  ui32_t tmp_int;
+
+  if ( read_count == 0 )
+    read_count = &tmp_int;
+
+  *read_count = 0;
+
+  if ( m_Handle == INVALID_HANDLE_VALUE )
+    return Kumu::RESULT_FILEOPEN;
+
+  if ( offset < 0 )
+    return Kumu::RESULT_PARAM;
+
+  HANDLE handle;
+
+  {
+    AutoMutex lock(m_AtLock);
+
+    if ( m_AtHandle == INVALID_HANDLE_VALUE )
+      m_AtHandle = ::CreateFileA(m_Filename.c_str(), GENERIC_READ, (FILE_SHARE_READ|FILE_SHARE_WRITE),
+				 NULL, OPEN_EXISTING, FILE_FLAG_OVERLAPPED, NULL);
+
+    handle = m_AtHandle;
+  }
+
+  if ( handle == INVALID_HANDLE_VALUE )
+    return Kumu::RESULT_READFAIL;
+
+  OVERLAPPED ov;
+  memset(&ov, 0, sizeof(ov));
+  ov.Offset = (DWORD)((ui64_t)offset & 0xffffffff);
+  ov.OffsetHigh = (DWORD)((ui64_t)offset >> 32);
+  ov.hEvent = ::CreateEvent(NULL, TRUE, FALSE, NULL);
+
+  if ( ov.hEvent == NULL )
+    return Kumu::RESULT_READFAIL;
+
+  Result_t result = Kumu::RESULT_OK;
+  DWORD tmp_count = 0;
+  UINT prev = ::SetErrorMode(SEM_FAILCRITICALERRORS|SEM_NOOPENFILEERRORBOX);
+  ui64_t start = io_clock();
+
+  if ( ::ReadFile(handle, buf, buf_len, NULL, &ov) == 0 && ::GetLastError() != ERROR_IO_PENDING )
+    result = ( ::GetLastError() == ERROR_HANDLE_EOF ) ? Kumu::RESULT_ENDOFFILE : Kumu::RESULT_READFAIL;
+  else if ( ::GetOverlappedResult(handle, &ov, &tmp_count, TRUE) == 0 )
+    result = ( ::GetLastError() == ERROR_HANDLE_EOF ) ? Kumu::RESULT_ENDOFFILE : Kumu::RESULT_READFAIL;
+  else if ( tmp_count == 0 )
+    result = Kumu::RESULT_ENDOFFILE;
+
+  ::SetErrorMode(prev);
+  ::CloseHandle(ov.hEvent);
+
+  {
+    AutoMutex lock(m_AtLock);
+    io_count(m_Stats, m_Stats.Reads, start);
+    m_Stats.ReadBytes += tmp_count;
+  }
+
+  if ( KM_SUCCESS(result) )
+    *read_count = tmp_count;
+
+  return result;
+}
+
+//
+Kumu::Result_t
+Kumu::FileReader::Map() const
+{
+  if ( m_Handle == INVALID_HANDLE_VALUE )
+    return Kumu::RESULT_FILEOPEN;
+
+  if ( m_Map != 0 )
+    return Kumu::RESULT_OK;
+
+  LARGE_INTEGER size;
+  Kumu::fpos_t pos = 0;
+
+  if ( ::GetFileSizeEx(m_Handle, &size) == 0 || size.QuadPart == 0
+       || (ui64_t)size.QuadPart > (ui64_t)((size_t)-1) || KM_FAILURE(Tell(&pos)) )
+    return Kumu::RESULT_FAIL;
+
+  HANDLE mapping = ::CreateFileMapping(m_Handle, NULL, PAGE_READONLY, 0, 0, NULL);
+
+  if ( mapping == NULL )
+    return Kumu::RESULT_FAIL;
+
+  const byte_t* view = (const byte_t*)::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+  if ( view == NULL )
+    {
+      ::CloseHandle(mapping);
+      return Kumu::RESULT_FAIL;
+    }
+
+  m_Map = view;
+  m_MapHandle = mapping;
+  m_MapSize = size.QuadPart;
+  m_MapPos = pos;
+  return Kumu::RESULT_OK;
+}
+
+
+
+//------------------------------------------------------------------------------------------
+//
+
+//
+Kumu::Result_t
+Kumu::FileWriter::OpenWrite(const std::string& filename)
+{
+  m_Filename = filename;
+  
+  // suppress popup window on error
+  UINT prev = ::SetErrorMode(SEM_FAILCRITICALERRORS|SEM_NOOPENFILEERRORBOX);
+
+  m_Handle = ::CreateFileA(filename.c_str(),
+			  (GENERIC_WRITE|GENERIC_READ),  // open for reading
+			  (FILE_SHARE_READ|FILE_SHARE_WRITE), // the write queue opens overlapped handles
+			  NULL,                          // no security
+			  CREATE_ALWAYS,                 // overwrite (beware!)
+			  FILE_ATTRIBUTE_NORMAL,         // normal file
+			  NULL                           // no template file
+			  );
+
+  ::SetErrorMode(prev);
+  m_Stats = IOStats();
+
+  if ( m_Handle == INVALID_HANDLE_VALUE )
+    return Kumu::RESULT_FILEOPEN;
+  
+  m_IOVec = new h__iovec;
+  return Kumu::RESULT_OK;
+}
+
+//
+Kumu::Result_t
+Kumu::FileWriter::Sync()
+{
+  Result_t result = Writev();
+
+  // seeking drains the write queue
+  if ( KM_SUCCESS(result) && ! m_Queue.empty() )
+    result = Seek(Tell());
+
+  ui64_t start = io_clock();
+
+  if ( KM_SUCCESS(result) && ! ::FlushFileBuffers(m_Handle) )
+    result = Kumu::RESULT_WRITEFAIL;
+
+  m_Stats.BlockedNanos += io_clock() - start;
+  return result;
+}
+
+//
+Kumu::Result_t
+Kumu::FileWriter::Truncate(Kumu::fpos_t size)
+{
+  if ( m_Handle == INVALID_HANDLE_VALUE || m_Observer != 0 )
+    return Kumu::RESULT_STATE;
+
+  Kumu::fpos_t here = Tell();
+  Result_t result = Seek(size);
+
+  if ( KM_SUCCESS(result) && ! ::SetEndOfFile(m_Handle) )
+    result = Kumu::RESULT_WRITEFAIL;
+
+  if ( KM_SUCCESS(result) )
+    result = Seek(here);
+
+  return result;
+}
+
+//
+Kumu::Result_t
+Kumu::FileWriter::Preallocate(ui64_t size)
+{
   if ( m_Handle == INVALID_HANDLE_VALUE )
-    return Kumu::RESULT_FILEOPEN;
-  
-  m_IOVec = new h__iovec;
+    return Kumu::RESULT_STATE;
+
+#if defined(_WIN32_WINNT) && _WIN32_WINNT >= 0x0600
+  FILE_ALLOCATION_INFO info;
+  info.AllocationSize.QuadPart = size;
+
+  if ( ! ::SetFileInformationByHandle(m_Handle, FileAllocationInfo, &info, sizeof(info)) )
+    return Kumu::RESULT_NOTIMPL;
+
+  m_Reserved = size;
   return Kumu::RESULT_OK;
+#else
+  return Kumu::RESULT_NOTIMPL;
+#endif
+}
+
+// gives back the reserved space past the end of the file
+void
+Kumu::FileWriter::ReleaseReserve()
+{
+  if ( m_Reserved == 0 || m_Handle == INVALID_HANDLE_VALUE )
+    return;
+
+  m_Reserved = 0;
+
+#if defined(_WIN32_WINNT) && _WIN32_WINNT >= 0x0600
+  LARGE_INTEGER size;
+  FILE_ALLOCATION_INFO info;
+
+  if ( ::GetFileSizeEx(m_Handle, &size) )
+    {
+      info.AllocationSize = size;
+      ::SetFileInformationByHandle(m_Handle, FileAllocationInfo, &info, sizeof(info));
+    }
+#endif
+}
+
+//
+Kumu::Result_t
+Kumu::FileWriter::CopyFrom(const std::string& filename, Kumu::fpos_t offset, ui64_t length)
+{
+  Result_t result = Writev();
+
+  if ( KM_SUCCESS(result) )
+    result = copy_through_buffer(*this, filename, offset, length);
+
+  return result;
 }
 
 //
@@ -930,6 +2471,30 @@ Kumu::FileWriter::Writev(ui32_t* bytes_written)
     return Kumu::RESULT_STATE;
 
   *bytes_written = 0;
+
+  // the queue gathers the entries into one write per buffer
+  if ( ! m_Queue.empty() )
+    {
+      Result_t result = Kumu::RESULT_OK;
+
+      for ( int i = 0; i < iov->m_Count && KM_SUCCESS(result); i++ )
+	{
+	  if ( ! m_Digest.empty() )
+	    m_Digest->Update(m_Queue->m_Position, (byte_t*)iov->m_iovec[i].iov_base, iov->m_iovec[i].iov_len);
+
+	  if ( m_Observer != 0 )
+	    result = m_Observer->Written(m_Queue->m_Position, (byte_t*)iov->m_iovec[i].iov_base, iov->m_iovec[i].iov_len);
+
+	  if ( KM_SUCCESS(result) )
+	    result = m_Queue->Write((byte_t*)iov->m_iovec[i].iov_base, iov->m_iovec[i].iov_len);
+	  *bytes_written += iov->m_iovec[i].iov_len;
+	}
+
+      iov->m_Count = 0;
+      return result;
+    }
+
+  Kumu::fpos_t pos = ( m_Digest.empty() && m_Observer == 0 ) ? 0 : Tell();
   UINT prev = ::SetErrorMode(SEM_FAILCRITICALERRORS|SEM_NOOPENFILEERRORBOX);
   Result_t result = Kumu::RESULT_OK;
 
@@ -937,11 +2502,14 @@ Kumu::FileWriter::Writev(ui32_t* bytes_written)
   for ( register int i = 0; i < iov->m_Count; i++ )
     {
       ui32_t tmp_count = 0;
+      ui64_t start = io_clock();
       BOOL wr_result = ::WriteFile(m_Handle,
 				   iov->m_iovec[i].iov_base,
 				   iov->m_iovec[i].iov_len,
 				   (DWORD*)&tmp_count,
 				   NULL);
+      io_count(m_Stats, m_Stats.Writes, start);
+      m_Stats.WriteBytes += tmp_count;
 
       if ( wr_result == 0 || tmp_count != iov->m_iovec[i].iov_len)
 	{
@@ -949,7 +2517,16 @@ Kumu::FileWriter::Writev(ui32_t* bytes_written)
 	  break;
 	}
 
+      if ( ! m_Digest.empty() )
+	m_Digest->Update(pos + *bytes_written, (byte_t*)iov->m_iovec[i].iov_base, tmp_count);
+
+      if ( m_Observer != 0 )
+	result = m_Observer->Written(pos + *bytes_written, (byte_t*)iov->m_iovec[i].iov_base, tmp_count);
+
       *bytes_written += tmp_count;
+
+      if ( KM_FAILURE(result) )
+	break;
     }
 
   ::SetErrorMode(prev);
@@ -971,14 +2548,42 @@ Kumu::FileWriter::Write(const byte_t* buf, ui32_t buf_len, ui32_t* bytes_written
   if ( m_Handle == INVALID_HANDLE_VALUE )
     return Kumu::RESULT_STATE;
 
+  Kumu::fpos_t pos = ( m_Digest.empty() && m_Observer == 0 ) ? 0 : Tell();
+
+  if ( ! m_Queue.empty() )
+    {
+      if ( ! m_Digest.empty() )
+	m_Digest->Update(pos, buf, buf_len);
+
+      if ( m_Observer != 0 )
+	{
+	  Result_t result = m_Observer->Written(pos, buf, buf_len);
+
+	  if ( KM_FAILURE(result) )
+	    return result;
+	}
+
+      *bytes_written = buf_len;
+      return m_Queue->Write(buf, buf_len);
+    }
+
   // suppress popup window on error
   UINT prev = ::SetErrorMode(SEM_FAILCRITICALERRORS|SEM_NOOPENFILEERRORBOX);
+  ui64_t start = io_clock();
   BOOL result = ::WriteFile(m_Handle, buf, buf_len, (DWORD*)bytes_written, NULL);
+  io_count(m_Stats, m_Stats.Writes, start);
+  m_Stats.WriteBytes += *bytes_written;
   ::SetErrorMode(prev);
 
   if ( result == 0 || *bytes_written != buf_len )
     return Kumu::RESULT_WRITEFAIL;
 
+  if ( ! m_Digest.empty() )
+    m_Digest->Update(pos, buf, buf_len);
+
+  if ( m_Observer != 0 )
+    return m_Observer->Written(pos, buf, buf_len);
+
   return Kumu::RESULT_OK;
 }
 
@@ -992,7 +2597,15 @@ Kumu::FileReader::OpenRead(const std::string& filename) const
 {
   const_cast<FileReader*>(this)->m_Filename = filename;
   const_cast<FileReader*>(this)->m_Handle = open(filename.c_str(), O_RDONLY, 0);
-  return ( m_Handle == -1L ) ? RESULT_FILEOPEN : RESULT_OK;
+  m_Stats = IOStats();
+
+  if ( m_Handle == -1L )
+    return RESULT_FILEOPEN;
+
+  m_CacheWindow = cache_open(m_Handle, true);
+  m_CacheCount = 0;
+  m_CacheDropped = 0;
+  return RESULT_OK;
 }
 
 //
@@ -1002,8 +2615,16 @@ Kumu::FileReader::Close() const
   if ( m_Handle == -1L )
     return RESULT_FILEOPEN;
 
+  if ( m_Map != 0 )
+    {
+      munmap((void*)m_Map, m_MapSize);
+      m_Map = 0;
+      m_MapSize = m_MapPos = 0;
+    }
+
   close(m_Handle);
   const_cast<FileReader*>(this)->m_Handle = -1L;
+  io_close(m_Stats);
   return RESULT_OK;
 }
 
@@ -1014,7 +2635,14 @@ Kumu::FileReader::Seek(Kumu::fpos_t position, SeekPos_t whence) const
   if ( m_Handle == -1L )
     return RESULT_FILEOPEN;
 
-  if ( lseek(m_Handle, position, whence) == -1L )
+  if ( m_Map != 0 )
+    return map_seek(m_MapPos, m_MapSize, position, whence);
+
+  ui64_t start = io_clock();
+  Kumu::fpos_t tmp_pos = lseek(m_Handle, position, whence);
+  io_count(m_Stats, m_Stats.Seeks, start);
+
+  if ( tmp_pos == -1L )
     return RESULT_BADSEEK;
 
   return RESULT_OK;
@@ -1029,9 +2657,17 @@ Kumu::FileReader::Tell(Kumu::fpos_t* pos) const
   if ( m_Handle == -1L )
     return RESULT_FILEOPEN;
 
-  Kumu::fpos_t tmp_pos;
+  if ( m_Map != 0 )
+    {
+      *pos = m_MapPos;
+      return RESULT_OK;
+    }
+
+  ui64_t start = io_clock();
+  Kumu::fpos_t tmp_pos = lseek(m_Handle, 0, SEEK_CUR);
+  io_count(m_Stats, m_Stats.Seeks, start);
 
-  if (  (tmp_pos = lseek(m_Handle, 0, SEEK_CUR)) == -1 )
+  if ( tmp_pos == -1 )
     return RESULT_READFAIL;
 
   *pos = tmp_pos;
@@ -1054,13 +2690,107 @@ Kumu::FileReader::Read(byte_t* buf, ui32_t buf_len, ui32_t* read_count) const
   if ( m_Handle == -1L )
     return RESULT_FILEOPEN;
 
-  if ( (tmp_count = read(m_Handle, buf, buf_len)) == -1L )
+  if ( m_Map != 0 )
+    return map_read(*this, buf, buf_len, read_count);
+
+  ui64_t start = io_clock();
+  tmp_count = read(m_Handle, buf, buf_len);
+  io_count(m_Stats, m_Stats.Reads, start);
+
+  if ( tmp_count == -1L )
     return RESULT_READFAIL;
 
+  m_Stats.ReadBytes += tmp_count;
   *read_count = tmp_count;
+
+  // a quarter of the window at a time
+  if ( m_CacheWindow != 0 && ( m_CacheCount += tmp_count ) >= m_CacheWindow / 4 )
+    {
+      m_CacheCount = 0;
+      cache_drop(m_Handle, m_CacheDropped, lseek(m_Handle, 0, SEEK_CUR), m_CacheWindow, false);
+    }
+
   return (tmp_count == 0 ? RESULT_ENDOFFILE : RESULT_OK);
 }
 
+//
+Kumu::Result_t
+Kumu::FileReader::ReadAt(Kumu::fpos_t offset, byte_t* buf, ui32_t buf_len, ui32_t* read_count) const
+{
+  KM_TEST_NULL_L(buf);
+  ui32_t tmp_int = 0;
+
+  if ( read_count == 0 )
+    read_count = &tmp_int;
+
+  *read_count = 0;
+
+  if ( m_Handle == -1L )
+    return RESULT_FILEOPEN;
+
+  if ( offset < 0 )
+    return RESULT_PARAM;
+
+  ui64_t start = io_clock();
+  ui32_t count = 0;
+  ssize_t res = 0;
+
+  // a positional read may come back short before the end of the file
+  while ( count < buf_len )
+    {
+      res = pread(m_Handle, buf + count, buf_len - count, offset + count);
+
+      if ( res == -1L && errno == EINTR )
+	continue;
+
+      if ( res <= 0 )
+	break;
+
+      count += (ui32_t)res;
+    }
+
+  {
+    AutoMutex lock(m_AtLock);
+    io_count(m_Stats, m_Stats.Reads, start);
+    m_Stats.ReadBytes += count;
+  }
+
+  if ( res == -1L )
+    return RESULT_READFAIL;
+
+  *read_count = count;
+  return ( count == 0 && buf_len != 0 ) ? RESULT_ENDOFFILE : RESULT_OK;
+}
+
+//
+Kumu::Result_t
+Kumu::FileReader::Map() const
+{
+  if ( m_Handle == -1L )
+    return RESULT_FILEOPEN;
+
+  if ( m_Map != 0 )
+    return RESULT_OK;
+
+  fstat_t info;
+  Kumu::fpos_t pos = 0;
+
+  if ( KM_FAILURE(do_fstat(m_Handle, &info)) || ( info.st_mode & S_IFREG ) == 0 || info.st_size == 0
+       || (ui64_t)info.st_size > (ui64_t)((size_t)-1) || KM_FAILURE(Tell(&pos)) )
+    return RESULT_FAIL;
+
+  void* view = mmap(0, info.st_size, PROT_READ, MAP_SHARED, m_Handle, 0);
+
+  if ( view == MAP_FAILED )
+    return RESULT_FAIL;
+
+  posix_madvise(view, info.st_size, POSIX_MADV_SEQUENTIAL);
+  m_Map = (const byte_t*)view;
+  m_MapSize = info.st_size;
+  m_MapPos = pos;
+  return RESULT_OK;
+}
+
 
 //------------------------------------------------------------------------------------------
 //
@@ -1071,6 +2801,7 @@ Kumu::FileWriter::OpenWrite(const std::string& filename)
 {
   m_Filename = filename;
   m_Handle = open(filename.c_str(), O_RDWR|O_CREAT|O_TRUNC, 0666);
+  m_Stats = IOStats();
 
   if ( m_Handle == -1L )
     {
@@ -1078,6 +2809,9 @@ Kumu::FileWriter::OpenWrite(const std::string& filename)
       return RESULT_FILEOPEN;
     }
 
+  m_CacheWindow = cache_open(m_Handle, false);
+  m_CacheCount = 0;
+  m_CacheDropped = 0;
   m_IOVec = new h__iovec;
   return RESULT_OK;
 }
@@ -1088,6 +2822,8 @@ Kumu::FileWriter::OpenModify(const std::string& filename)
 {
   m_Filename = filename;
   m_Handle = open(filename.c_str(), O_RDWR|O_CREAT, 0666);
+  m_Stats = IOStats();
+  m_CacheWindow = 0; // a modified file is not written once
 
   if ( m_Handle == -1L )
     {
@@ -1099,6 +2835,163 @@ Kumu::FileWriter::OpenModify(const std::string& filename)
   return RESULT_OK;
 }
 
+//
+Kumu::Result_t
+Kumu::FileWriter::Sync()
+{
+  Result_t result = Writev();
+
+  // seeking drains the write queue
+  if ( KM_SUCCESS(result) && ! m_Queue.empty() )
+    result = Seek(Tell());
+
+  ui64_t start = io_clock();
+
+  if ( KM_SUCCESS(result) && fsync(m_Handle) == -1L )
+    {
+      DefaultLogSink().Error("Error syncing file %s: %s\n", m_Filename.c_str(), strerror(errno));
+      result = RESULT_WRITEFAIL;
+    }
+
+  m_Stats.BlockedNanos += io_clock() - start;
+  return result;
+}
+
+//
+Kumu::Result_t
+Kumu::FileWriter::Truncate(Kumu::fpos_t size)
+{
+  if ( m_Handle == -1L || m_Observer != 0 )
+    return RESULT_STATE;
+
+  Result_t result = m_Queue.empty() ? RESULT_OK : Seek(Tell());
+
+  if ( KM_SUCCESS(result) && ftruncate(m_Handle, size) == -1L )
+    {
+      DefaultLogSink().Error("Error truncating file %s: %s\n", m_Filename.c_str(), strerror(errno));
+      result = RESULT_WRITEFAIL;
+    }
+
+  return result;
+}
+
+//
+Kumu::Result_t
+Kumu::FileWriter::Preallocate(ui64_t size)
+{
+  if ( m_Handle == -1L )
+    return RESULT_STATE;
+
+#if defined(__linux__) && defined(FALLOC_FL_KEEP_SIZE)
+  if ( fallocate(m_Handle, FALLOC_FL_KEEP_SIZE, 0, (off_t)size) == -1 )
+    {
+      if ( errno == EOPNOTSUPP || errno == ENOSYS )
+	return RESULT_NOTIMPL;
+
+      // a failed reservation may leave part of the space allocated
+      m_Reserved = size;
+      DefaultLogSink().Warn("Cannot reserve %llu bytes for %s: %s\n",
+			    (unsigned long long)size, m_Filename.c_str(), strerror(errno));
+      return RESULT_FAIL;
+    }
+#elif defined(KM_MACOSX) && defined(F_PREALLOCATE)
+  fstat_t info;
+
+  if ( fstat(m_Handle, &info) == -1 )
+    return RESULT_FAIL;
+
+  if ( (ui64_t)info.st_size >= size )
+    return RESULT_OK;
+
+  // contiguous if the file system can, anywhere otherwise
+  fstore_t store = { F_ALLOCATECONTIG, F_PEOFPOSMODE, 0, (off_t)(size - info.st_size), 0 };
+
+  if ( fcntl(m_Handle, F_PREALLOCATE, &store) == -1 )
+    {
+      store.fst_flags = F_ALLOCATEALL;
+
+      if ( fcntl(m_Handle, F_PREALLOCATE, &store) == -1 )
+	return RESULT_NOTIMPL;
+    }
+#else
+  return RESULT_NOTIMPL;
+#endif
+
+  m_Reserved = size;
+  return RESULT_OK;
+}
+
+// gives back the reserved space past the end of the file
+void
+Kumu::FileWriter::ReleaseReserve()
+{
+  if ( m_Reserved == 0 || m_Handle == -1L )
+    return;
+
+  fstat_t info;
+  ui64_t reserved = m_Reserved;
+  m_Reserved = 0;
+
+  if ( fstat(m_Handle, &info) == -1 || (ui64_t)info.st_size >= reserved )
+    return;
+
+  // cutting a file to its own length drops the blocks past the end
+  if ( ftruncate(m_Handle, info.st_size) == -1 )
+    DefaultLogSink().Warn("Cannot release the space reserved for %s: %s\n", m_Filename.c_str(), strerror(errno));
+}
+
+//
+Kumu::Result_t
+Kumu::FileWriter::CopyFrom(const std::string& filename, Kumu::fpos_t offset, ui64_t length)
+{
+  if ( m_Handle == -1L )
+    return RESULT_STATE;
+
+  Result_t result = Writev();
+
+#if defined(__linux__) && defined(SYS_copy_file_range)
+  // the bytes must pass through Write() to be hashed, observed or queued
+  if ( KM_SUCCESS(result) && m_Digest.empty() && m_Observer == 0 && m_Queue.empty() && length > 0 )
+    {
+      int in = open(filename.c_str(), O_RDONLY);
+
+      if ( in == -1L )
+	{
+	  DefaultLogSink().Error("Error opening file %s: %s\n", filename.c_str(), strerror(errno));
+	  return RESULT_FILEOPEN;
+	}
+
+      loff_t in_offset = offset;
+
+      while ( length > 0 )
+	{
+	  ui64_t start = io_clock();
+	  ssize_t n = syscall(SYS_copy_file_range, in, &in_offset, m_Handle, (loff_t*)0,
+			      (size_t)std::min<ui64_t>(length, 1024 * 1024 * 1024), 0);
+	  io_count(m_Stats, m_Stats.Writes, start);
+
+	  if ( n == -1L && errno == EINTR )
+	    continue;
+
+	  // refused for this pair of files, the rest goes through the buffer
+	  if ( n <= 0 )
+	    break;
+
+	  m_Stats.WriteBytes += n;
+	  length -= n;
+	}
+
+      close(in);
+      offset = in_offset;
+    }
+#endif
+
+  if ( KM_SUCCESS(result) && length > 0 )
+    result = copy_through_buffer(*this, filename, offset, length);
+
+  return result;
+}
+
 //
 Kumu::Result_t
 Kumu::FileWriter::Writev(ui32_t* bytes_written)
@@ -1113,18 +3006,65 @@ Kumu::FileWriter::Writev(ui32_t* bytes_written)
   if ( m_Handle == -1L )
     return RESULT_STATE;
 
+#ifdef KM_WRITE_QUEUE
+  if ( ! m_Queue.empty() )
+    {
+      Result_t result = RESULT_OK;
+      *bytes_written = 0;
+
+      for ( int i = 0; i < iov->m_Count && KM_SUCCESS(result); i++ )
+	{
+	  if ( ! m_Digest.empty() )
+	    m_Digest->Update(m_Queue->m_Position, (byte_t*)iov->m_iovec[i].iov_base, iov->m_iovec[i].iov_len);
+
+	  if ( m_Observer != 0 )
+	    result = m_Observer->Written(m_Queue->m_Position, (byte_t*)iov->m_iovec[i].iov_base, iov->m_iovec[i].iov_len);
+
+	  if ( KM_SUCCESS(result) )
+	    result = m_Queue->Write((byte_t*)iov->m_iovec[i].iov_base, iov->m_iovec[i].iov_len);
+	  *bytes_written += iov->m_iovec[i].iov_len;
+	}
+
+      iov->m_Count = 0;
+      DropBehind(*bytes_written);
+      return result;
+    }
+#endif
+
   int total_size = 0;
   for ( int i = 0; i < iov->m_Count; i++ )
     total_size += iov->m_iovec[i].iov_len;
 
+  Kumu::fpos_t pos = ( m_Digest.empty() && m_Observer == 0 ) ? 0 : Tell();
+  ui64_t start = io_clock();
   int write_size = writev(m_Handle, iov->m_iovec, iov->m_Count);
-  
+  io_count(m_Stats, m_Stats.Writes, start);
+
   if ( write_size == -1L || write_size != total_size )
     return RESULT_WRITEFAIL;
 
+  m_Stats.WriteBytes += write_size;
+
+  Result_t result = RESULT_OK;
+
+  if ( ! m_Digest.empty() || m_Observer != 0 )
+    {
+      for ( int i = 0; i < iov->m_Count; i++ )
+	{
+	  if ( ! m_Digest.empty() )
+	    m_Digest->Update(pos, (byte_t*)iov->m_iovec[i].iov_base, iov->m_iovec[i].iov_len);
+
+	  if ( m_Observer != 0 && KM_SUCCESS(result) )
+	    result = m_Observer->Written(pos, (byte_t*)iov->m_iovec[i].iov_base, iov->m_iovec[i].iov_len);
+
+	  pos += iov->m_iovec[i].iov_len;
+	}
+    }
+
   iov->m_Count = 0;
   *bytes_written = write_size;  
-  return RESULT_OK;
+  DropBehind(write_size);
+  return result;
 }
 
 //
@@ -1140,15 +3080,60 @@ Kumu::FileWriter::Write(const byte_t* buf, ui32_t buf_len, ui32_t* bytes_written
   if ( m_Handle == -1L )
     return RESULT_STATE;
 
+  Kumu::fpos_t pos = ( m_Digest.empty() && m_Observer == 0 ) ? 0 : Tell();
+
+#ifdef KM_WRITE_QUEUE
+  if ( ! m_Queue.empty() )
+    {
+      if ( ! m_Digest.empty() )
+	m_Digest->Update(pos, buf, buf_len);
+
+      if ( m_Observer != 0 )
+	{
+	  Result_t result = m_Observer->Written(pos, buf, buf_len);
+
+	  if ( KM_FAILURE(result) )
+	    return result;
+	}
+
+      *bytes_written = buf_len;
+      Result_t result = m_Queue->Write(buf, buf_len);
+      DropBehind(buf_len);
+      return result;
+    }
+#endif
+
+  ui64_t start = io_clock();
   int write_size = write(m_Handle, buf, buf_len);
+  io_count(m_Stats, m_Stats.Writes, start);
 
   if ( write_size == -1L || (ui32_t)write_size != buf_len )
     return RESULT_WRITEFAIL;
 
+  m_Stats.WriteBytes += write_size;
+
+  if ( ! m_Digest.empty() )
+    m_Digest->Update(pos, buf, buf_len);
+
   *bytes_written = write_size;
-  return RESULT_OK;
+  DropBehind(write_size);
+  return ( m_Observer != 0 ) ? m_Observer->Written(pos, buf, buf_len) : RESULT_OK;
 }
 
+// drops what was written more than the window behind the file position
+void
+Kumu::FileWriter::DropBehind(ui32_t count)
+{
+  // Close() reads the file back when the streamed digest can not be used
+  if ( m_CacheWindow == 0 || ! m_Digest.empty() )
+    return;
+
+  if ( ( m_CacheCount += count ) < m_CacheWindow / 4 )
+    return;
+
+  m_CacheCount = 0;
+  cache_drop(m_Handle, m_CacheDropped, Tell(), m_CacheWindow, true);
+}
 
 #endif // KM_WIN32
 
@@ -33,6 +33,7 @@ THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define _KM_FILEIO_H_
 
 #include <KM_util.h>
+#include <KM_mutex.h>
 #include <string>
 
 #ifdef KM_WIN32
@@ -304,6 +305,37 @@ namespace Kumu
   // File I/O
   //------------------------------------------------------------------------------------------
 
+  // I/O accounting. Every FileReader and FileWriter counts the system calls it
+  // makes on its file and the time spent in them, including the writes of the
+  // write queue. The counts are reset when a file is opened and are added to the
+  // process totals when it is closed. Reads of a mapped file are not counted.
+  struct IOStats
+  {
+    ui64_t Reads;        // read calls
+    ui64_t ReadBytes;
+    ui64_t Writes;       // write calls, each queued buffer written is one
+    ui64_t WriteBytes;
+    ui64_t Seeks;        // lseek() calls, those made by Tell() included
+    ui64_t BlockedNanos; // time spent in the calls above and in fsync()
+
+    IOStats() : Reads(0), ReadBytes(0), Writes(0), WriteBytes(0), Seeks(0), BlockedNanos(0) {}
+    void Add(const IOStats& rhs);
+  };
+
+  void GetIOStats(IOStats& stats); // totals of the files closed so far
+  void ResetIOStats();
+
+  // Page cache hints for files that are read or written once, such as the frames
+  // and MXF files of an encode, so they do not push everything else out of the
+  // cache. Files opened afterwards by OpenRead() and OpenWrite() are read ahead
+  // sequentially and their pages more than window bytes behind the file position
+  // are dropped as it moves on. A writer writes them back first, and keeps them
+  // while a digest is enabled since Close() may read the file again. On macOS the
+  // files are not cached at all (F_NOCACHE), on win32 reads are only marked
+  // sequential. Mapped files are not affected. 0 disables the hints, the default
+  // window is 64 MB.
+  void SetStreamOnceWindow(ui32_t window);
+
   //
   class FileReader
     {
@@ -312,9 +344,26 @@ namespace Kumu
     protected:
       std::string m_Filename;
       FileHandle  m_Handle;
+      mutable const byte_t* m_Map;
+      mutable fsize_t       m_MapSize;
+      mutable Kumu::fpos_t  m_MapPos;
+      mutable IOStats       m_Stats;
+      mutable ui32_t        m_CacheWindow;  // see SetStreamOnceWindow(), 0 when off
+      mutable ui32_t        m_CacheCount;   // bytes moved since pages were last dropped
+      mutable Kumu::fpos_t  m_CacheDropped; // the pages below were dropped
+      mutable Mutex         m_AtLock;       // the counts of ReadAt() calls, made from any thread
+#ifdef KM_WIN32
+      mutable FileHandle    m_MapHandle;
+      mutable FileHandle    m_AtHandle;     // overlapped handle of ReadAt(), opened by the first call
+#endif
 
     public:
-      FileReader() : m_Handle(INVALID_HANDLE_VALUE) {}
+      FileReader() : m_Handle(INVALID_HANDLE_VALUE), m_Map(0), m_MapSize(0), m_MapPos(0),
+	m_CacheWindow(0), m_CacheCount(0), m_CacheDropped(0)
+#ifdef KM_WIN32
+	, m_MapHandle(0), m_AtHandle(INVALID_HANDLE_VALUE)
+#endif
+	{}
       virtual ~FileReader() { Close(); }
 
       Result_t OpenRead(const std::string&) const;                          // open the file for reading
@@ -324,6 +373,32 @@ namespace Kumu
       Result_t Tell(Kumu::fpos_t* pos) const;                        // report the file pointer's location
       Result_t Read(byte_t*, ui32_t, ui32_t* = 0) const;             // read a buffer of data
 
+      // Optional read-only mapping of the whole file, for readers that only
+      // look at the data. Once mapped, Seek(), Tell() and Read() work on the
+      // mapping and ReadView() hands out pointers into it instead of copying.
+      // Views stay valid until the file is closed. Map() fails, leaving the
+      // file readable as before, on empty files or when the address space
+      // can not hold the file.
+      Result_t Map() const;                                          // map the open file
+      Result_t ReadView(const byte_t**, ui32_t, ui32_t* = 0) const;  // advance as Read(), returning a view
+
+      // Positional reads, at an absolute offset and without using or moving the
+      // file pointer, so several threads may call them at once on one open file
+      // (pread() on POSIX, an overlapped handle of its own on win32). A read
+      // that ends at the end of the file is short, one that starts there
+      // returns RESULT_ENDOFFILE. ReadViewAt() needs a mapped file; Map() must
+      // not race with it.
+      Result_t ReadAt(Kumu::fpos_t, byte_t*, ui32_t, ui32_t* = 0) const;             // read a buffer at an offset
+      Result_t ReadViewAt(Kumu::fpos_t, const byte_t**, ui32_t, ui32_t* = 0) const;  // as ReadAt(), returning a view
+
+      inline bool IsMapped() const {                                 // returns true if the file is mapped
+	return m_Map != 0;
+      }
+
+      inline const IOStats& Stats() const {                          // the counts since the file was opened
+	return m_Stats;
+      }
+
       inline Kumu::fpos_t Tell() const                               // report the file pointer's location
 	{
 	  Kumu::fpos_t tmp_pos;
@@ -336,13 +411,33 @@ namespace Kumu
       }
     };
 
+  // Receives a copy of everything a FileWriter writes, with the offset it is
+  // written at, e.g. to upload a file while it is being written. A region may
+  // be written again (the MXF header rewritten when the file is finalized).
+  // A failure returned by Written() fails the write.
+  class WriteObserver
+    {
+    public:
+      virtual ~WriteObserver() {}
+      virtual Result_t Written(Kumu::fpos_t offset, const byte_t* buf, ui32_t buf_len) = 0;
+    };
+
   //
   class FileWriter : public FileReader
     {
       class h__iovec;
       mem_ptr<h__iovec>  m_IOVec;
+      class h__digest;
+      mem_ptr<h__digest> m_Digest;
+      class h__queue;
+      mem_ptr<h__queue>  m_Queue;
+      ui64_t             m_Reserved;
+      WriteObserver*     m_Observer;
       KM_NO_COPY_CONSTRUCT(FileWriter);
 
+      void ReleaseReserve();
+      void DropBehind(ui32_t count);
+
     public:
       FileWriter();
       virtual ~FileWriter();
@@ -361,6 +456,78 @@ namespace Kumu
       // the iovec list will be written to disk before the given buffer,as though
       // you had called Writev() first.
       Result_t Write(const byte_t*, ui32_t, ui32_t* = 0);            // write buffer to disk
+
+      // Optional SHA-1 of the file contents. Bytes are hashed as they are written.
+      // If a region that was already hashed is written again (e.g., the MXF header
+      // that is rewritten when the file is finalized) the streamed value cannot be
+      // used and Close() recomputes the digest from the file, while it is still in
+      // the page cache. EnableDigest() must be called while the file is open.
+      Result_t EnableDigest();
+      Result_t Digest(byte_t* digest) const;                          // 20 bytes, valid after Close()
+      Result_t Close();                                              // close the file, completing the digest
+
+      // Optional copy of every write to an observer, which is not owned and must
+      // outlive the file. With an observer CopyFrom() always goes through a buffer
+      // and Truncate() fails, the observer cannot take back what it was given.
+      // Must be called while the file is open.
+      Result_t SetObserver(WriteObserver*);
+
+      // Sync() writes out the iovec list and anything held by the write queue, then
+      // commits the file to disk. Truncate() cuts the file to the given size, the
+      // queue is drained first and the file position is not changed.
+      Result_t Sync();
+      Result_t Truncate(Kumu::fpos_t size);
+
+      // Reserves disk space for a file of up to size bytes without changing its
+      // length (fallocate on Linux, F_PREALLOCATE on macOS, the allocation size
+      // on Windows), so a long write is laid out in few extents. The part that
+      // was not written is released by Close(). Returns RESULT_NOTIMPL where the
+      // platform or file system cannot reserve space; the file is written as before.
+      Result_t Preallocate(ui64_t size);
+
+      // Appends length bytes of the named file, starting at offset, at the file
+      // position. The kernel copies the data where it can (copy_file_range on
+      // Linux); with a digest or write buffering it is read and written through
+      // a large buffer instead, so it is hashed and queued as by Write().
+      Result_t CopyFrom(const std::string& filename, Kumu::fpos_t offset, ui64_t length);
+
+      // Optional write coalescing. Writes are gathered into a buffer of
+      // buffer_size bytes, rounded up to the alignment, which is written when it is
+      // full or the file is seeked, read or closed. Full buffers start and end on an
+      // alignment boundary; with direct_io those are written with O_DIRECT (without
+      // buffering on win32, where the alignment must be a multiple of the sector
+      // size) and the rest, such as the header rewritten at the end, through the
+      // page cache.
+      // A write error is reported by a later Write(), Seek() or Close().
+      // Must be called while the file is open.
+      Result_t EnableBuffering(ui32_t buffer_size = 8 * 1024 * 1024, ui32_t alignment = 4096,
+			       bool direct_io = false);
+
+      // Optional asynchronous I/O (io_uring on Linux, overlapped I/O on win32). As
+      // EnableBuffering(), with buffer_count buffers written in the background, so the
+      // caller may reuse its buffers as soon as Write() returns. The digest, when it
+      // must be recomputed at Close(), is read back the same way. Returns
+      // RESULT_NOTIMPL where neither is available, the file is then written as before.
+      Result_t EnableAsyncIO(ui32_t buffer_count = 8, ui32_t buffer_size = 1024 * 1024,
+			     bool direct_io = false);
+
+      // EnableAsyncIO(), falling back to EnableBuffering() with a buffer as large
+      // as all of the buffers together
+      Result_t EnableQueuedWrites(bool direct_io = false, ui32_t buffer_count = 8,
+				  ui32_t buffer_size = 1024 * 1024);
+
+      // these account for data still held by the write queue
+      Result_t Seek(Kumu::fpos_t = 0, SeekPos_t = SP_BEGIN) const;
+      Result_t Tell(Kumu::fpos_t* pos) const;
+      Result_t Read(byte_t*, ui32_t, ui32_t* = 0) const;
+      fsize_t  Size() const;
+
+      inline Kumu::fpos_t Tell() const
+	{
+	  Kumu::fpos_t tmp_pos;
+	  Tell(&tmp_pos);
+	  return tmp_pos;
+	}
    };
 
   Result_t CreateDirectoriesInPath(const std::string& Path);
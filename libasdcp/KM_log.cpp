@@ -83,6 +83,26 @@ Kumu::DefaultLogSink()
   return *s_DefaultLogSink;
 }
 
+//
+Kumu::TraceClock_t Kumu::g_TraceClock = 0;
+Kumu::TraceSink_t  Kumu::g_TraceSink = 0;
+
+//
+void
+Kumu::SetTraceSink(TraceClock_t clock, TraceSink_t sink)
+{
+  // spans started after the clock is cleared are not recorded
+  if ( clock == 0 || sink == 0 )
+    {
+      g_TraceClock = 0;
+      g_TraceSink = 0;
+      return;
+    }
+
+  g_TraceSink = sink;
+  g_TraceClock = clock;
+}
+
 
 //------------------------------------------------------------------------------------------
 //
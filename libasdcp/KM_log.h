@@ -217,6 +217,32 @@ namespace Kumu
   ILogSink& DefaultLogSink();
 
 
+  // Trace spans for an application's timeline. The clock returns the time
+  // and the sink records a span named name from start to now on the calling
+  // thread. Spans cost one test of a pointer while no sink is set, names
+  // must be string literals.
+  typedef ui64_t (*TraceClock_t)();
+  typedef void (*TraceSink_t)(const char* name, ui64_t start);
+
+  extern TraceClock_t g_TraceClock;
+  extern TraceSink_t  g_TraceSink;
+
+  // Sets the clock and sink spans are reported to, zero stops tracing.
+  void SetTraceSink(TraceClock_t clock = 0, TraceSink_t sink = 0);
+
+  // records a span over the scope it is declared in
+  class TraceSpan
+    {
+      const char* m_Name;
+      ui64_t      m_Start;
+      KM_NO_COPY_CONSTRUCT(TraceSpan);
+
+    public:
+      TraceSpan(const char* name) : m_Name(name), m_Start(g_TraceClock ? g_TraceClock() : 0) {}
+      ~TraceSpan() { if ( m_Start && g_TraceSink ) g_TraceSink(m_Name, m_Start); }
+    };
+
+
   // attach a log sink as a listener until deleted
   class LogSinkListenContext
     {
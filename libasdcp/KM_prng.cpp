@@ -65,6 +65,14 @@ public:
   byte_t    m_ctr_buf[RNG_BLOCK_SIZE];
   Mutex     m_Lock;
 
+  // keyed from another generator, no lock or device read needed
+  h__RNG(const byte_t* key_fodder)
+  {
+    memset(&m_Context, 0, sizeof(m_Context));
+    memset(m_ctr_buf, 0, RNG_BLOCK_SIZE);
+    set_key(key_fodder);
+  }
+
   h__RNG()
   {
     memset(m_ctr_buf, 0, RNG_BLOCK_SIZE);
@@ -143,6 +151,105 @@ public:
 
 
 static h__RNG* s_RNG = 0;
+static Mutex   s_RNGLock; // guards creating s_RNG and drawing thread keys from it
+
+// The shared generator, seeded from the system on first use.
+static h__RNG*
+shared_rng()
+{
+  AutoMutex Lock(s_RNGLock);
+
+  if ( s_RNG == 0 )
+    s_RNG = new h__RNG;
+
+  return s_RNG;
+}
+
+// A generator for the calling thread, keyed once from the shared one. Every
+// encrypted frame takes a fresh IV, with one generator behind a lock the
+// encrypting threads would take turns.
+static h__RNG*
+new_thread_rng()
+{
+  byte_t rng_key[RNG_KEY_SIZE];
+  h__RNG* shared = shared_rng();
+
+  AutoMutex Lock(s_RNGLock);
+  shared->fill_rand(rng_key, RNG_KEY_SIZE);
+  h__RNG* rng = new h__RNG(rng_key);
+
+  // move the shared generator on so no other thread gets the same key
+  shared->fill_rand(rng_key, RNG_KEY_SIZE);
+  shared->set_key(rng_key);
+  memset(rng_key, 0, RNG_KEY_SIZE);
+  return rng;
+}
+
+#ifdef KM_WIN32
+
+static volatile DWORD s_ThreadRNGIndex = FLS_OUT_OF_INDEXES;
+
+static void WINAPI
+delete_thread_rng(void* rng)
+{
+  delete (h__RNG*)rng;
+}
+
+static h__RNG*
+thread_rng()
+{
+  if ( s_ThreadRNGIndex == FLS_OUT_OF_INDEXES )
+    {
+      AutoMutex Lock(s_RNGLock);
+
+      if ( s_ThreadRNGIndex == FLS_OUT_OF_INDEXES )
+	s_ThreadRNGIndex = FlsAlloc(delete_thread_rng);
+    }
+
+  h__RNG* rng = (h__RNG*)FlsGetValue(s_ThreadRNGIndex);
+
+  if ( rng == 0 )
+    {
+      rng = new_thread_rng();
+      FlsSetValue(s_ThreadRNGIndex, rng);
+    }
+
+  return rng;
+}
+
+#else // KM_WIN32
+
+static pthread_key_t  s_ThreadRNGKey;
+static pthread_once_t s_ThreadRNGOnce = PTHREAD_ONCE_INIT;
+
+static void
+delete_thread_rng(void* rng)
+{
+  delete (h__RNG*)rng;
+}
+
+static void
+create_thread_rng_key()
+{
+  pthread_key_create(&s_ThreadRNGKey, delete_thread_rng);
+}
+
+static h__RNG*
+thread_rng()
+{
+  pthread_once(&s_ThreadRNGOnce, create_thread_rng_key);
+  h__RNG* rng = (h__RNG*)pthread_getspecific(s_ThreadRNGKey);
+
+  if ( rng == 0 )
+    {
+      rng = new_thread_rng();
+      pthread_setspecific(s_ThreadRNGKey, rng);
+    }
+
+  return rng;
+}
+
+#endif // KM_WIN32
 
 
 //------------------------------------------------------------------------------------------
@@ -151,18 +258,19 @@ static h__RNG* s_RNG = 0;
 
 Kumu::FortunaRNG::FortunaRNG()
 {
-  if ( s_RNG == 0 )
-    s_RNG = new h__RNG;
+  shared_rng();
 }
 
 Kumu::FortunaRNG::~FortunaRNG() {}
 
-//
+// Each thread has its own generator, keyed from the shared one the first
+// time the thread asks for random bytes. Calls on different threads do not
+// contend for a lock.
 const byte_t*
 Kumu::FortunaRNG::FillRandom(byte_t* buf, ui32_t len)
 {
   assert(buf);
-  assert(s_RNG);
+  h__RNG* rng = thread_rng();
   const byte_t* front_of_buffer = buf;
 
   while ( len )
@@ -170,14 +278,14 @@ Kumu::FortunaRNG::FillRandom(byte_t* buf, ui32_t len)
       // 2^20 bytes max per seeding, use 2^19 to save
       // room for generating reseed values
       ui32_t gen_size = xmin(len, MAX_SEQUENCE_LEN);
-      s_RNG->fill_rand(buf, gen_size);
+      rng->fill_rand(buf, gen_size);
       buf += gen_size;
       len -= gen_size;
 	  
       // re-seed the generator
       byte_t rng_key[RNG_KEY_SIZE];
-      s_RNG->fill_rand(rng_key, RNG_KEY_SIZE);
-      s_RNG->set_key(rng_key);
+      rng->fill_rand(rng_key, RNG_KEY_SIZE);
+      rng->set_key(rng_key);
   }
   
   return front_of_buffer;
@@ -34,6 +34,7 @@ THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <KM_mutex.h>
 #include <stack>
 #include <map>
+#include <new>
 
 #ifdef HAVE_EXPAT
 # ifdef HAVE_XERCES_C
@@ -90,7 +91,52 @@ public:
 };
 
 
-Kumu::XMLElement::XMLElement(const char* name) : m_Namespace(0), m_NamespaceOwner(0)
+// A bump allocator for the elements of one document. Blocks are only
+// released when the arena is destroyed, element destructors still run
+// so their strings and lists are freed.
+//
+const ui32_t c_xml_arena_block_size = 64 * 1024;
+
+class Kumu::XMLArena
+{
+  KM_NO_COPY_CONSTRUCT(XMLArena);
+
+  std::list<byte_t*> m_Blocks;
+  ui32_t             m_Used;
+  ui32_t             m_Size;
+
+public:
+  XMLArena() : m_Used(0), m_Size(0) {}
+
+  ~XMLArena()
+  {
+    while ( ! m_Blocks.empty() )
+      {
+	delete [] m_Blocks.back();
+	m_Blocks.pop_back();
+      }
+  }
+
+  void* Alloc(ui32_t size)
+  {
+    size = ( size + 15 ) & ~15;
+
+    if ( m_Blocks.empty() || m_Used + size > m_Size )
+      {
+	m_Size = ( size > c_xml_arena_block_size ) ? size : c_xml_arena_block_size;
+	m_Blocks.push_back(new byte_t[m_Size]);
+	m_Used = 0;
+      }
+
+    void* p = m_Blocks.back() + m_Used;
+    m_Used += size;
+    return p;
+  }
+};
+
+//
+Kumu::XMLElement::XMLElement(const char* name) :
+  m_Namespace(0), m_NamespaceOwner(0), m_Arena(0), m_ArenaOwner(false), m_InArena(false)
 {
   m_Name = name;
 }
@@ -98,9 +144,35 @@ Kumu::XMLElement::XMLElement(const char* name) : m_Namespace(0), m_NamespaceOwne
 Kumu::XMLElement::~XMLElement()
 {
   for ( Elem_i i = m_ChildList.begin(); i != m_ChildList.end(); i++ )
-    delete *i;
+    DestroyChild(*i);
 
   delete (ns_map*)m_NamespaceOwner;
+
+  if ( m_ArenaOwner )
+    delete m_Arena;
+}
+
+//
+void
+Kumu::XMLElement::EnableArena()
+{
+  assert(m_ChildList.empty());
+
+  if ( m_Arena == 0 )
+    {
+      m_Arena = new XMLArena;
+      m_ArenaOwner = true;
+    }
+}
+
+// arena elements are destroyed in place, their memory goes with the arena
+void
+Kumu::XMLElement::DestroyChild(XMLElement* element)
+{
+  if ( element->m_InArena )
+    element->~XMLElement();
+  else
+    delete element;
 }
 
 //
@@ -126,7 +198,19 @@ Kumu::XMLElement::AddChild(Kumu::XMLElement* element)
 Kumu::XMLElement*
 Kumu::XMLElement::AddChild(const char* name)
 {
-  XMLElement* tmpE = new XMLElement(name);
+  XMLElement* tmpE;
+
+  if ( m_Arena != 0 )
+    {
+      tmpE = new (m_Arena->Alloc(sizeof(XMLElement))) XMLElement(name);
+      tmpE->m_Arena = m_Arena;
+      tmpE->m_InArena = true;
+    }
+  else
+    {
+      tmpE = new XMLElement(name);
+    }
+
   m_ChildList.push_back(tmpE);
   return tmpE;
 }
@@ -145,6 +229,13 @@ Kumu::XMLElement::AppendBody(const std::string& value)
   m_Body += value;
 }
 
+//
+void
+Kumu::XMLElement::AppendBody(const char* value, ui32_t length)
+{
+  m_Body.append(value, length);
+}
+
 //
 void
 Kumu::XMLElement::SetBody(const std::string& value)
@@ -158,9 +249,8 @@ Kumu::XMLElement::AddChildWithContent(const char* name, const char* value)
 {
   assert(name);
   assert(value);
-  XMLElement* tmpE = new XMLElement(name);
+  XMLElement* tmpE = AddChild(name);
   tmpE->m_Body = value;
-  m_ChildList.push_back(tmpE);
   return tmpE;
 }
 
@@ -168,10 +258,9 @@ Kumu::XMLElement::AddChildWithContent(const char* name, const char* value)
 Kumu::XMLElement*
 Kumu::XMLElement::AddChildWithPrefixedContent(const char* name, const char* prefix, const char* value)
 {
-  XMLElement* tmpE = new XMLElement(name);
+  XMLElement* tmpE = AddChild(name);
   tmpE->m_Body = prefix;
   tmpE->m_Body += value;
-  m_ChildList.push_back(tmpE);
   return tmpE;
 }
 
@@ -345,7 +434,7 @@ Kumu::XMLElement::DeleteChildren()
 {
   while ( ! m_ChildList.empty() )
     {
-      delete m_ChildList.back();
+      DestroyChild(m_ChildList.back());
       m_ChildList.pop_back();
     }
 }
@@ -360,7 +449,7 @@ Kumu::XMLElement::DeleteChild(const XMLElement* element)
 	{
 	  if ( *i == element )
 	    {
-	      delete *i;
+	      DestroyChild(*i);
 	      m_ChildList.erase(i);
 	      return;
 	    }
@@ -501,11 +590,7 @@ xph_char(void* p, const XML_Char* data, int len)
   ExpatParseContext* Ctx = (ExpatParseContext*)p;
 
   if ( len > 0 )
-    {
-      std::string tmp_str;
-      tmp_str.assign(data, len);
-      Ctx->Scope.top()->AppendBody(tmp_str);
-    }
+    Ctx->Scope.top()->AppendBody(data, len);
 }
 
 //
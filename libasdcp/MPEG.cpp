@@ -31,6 +31,7 @@ THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <MPEG.h>
 #include <KM_log.h>
+#include <string.h>
 using Kumu::DefaultLogSink;
 
 // walk a buffer stopping at the end of the buffer or the end of a VES
@@ -159,6 +160,28 @@ ASDCP::MPEG2::VESParser::Parse(const byte_t* buf, ui32_t buf_len)
   // copy interesting data to a buffer and pass to delegate for processing
   for ( register const byte_t* p = buf; p < end_p; p++ )
     {
+      // between headers only a 01 byte can complete a start code, so skip to
+      // the next one with memchr, counting the zeros that precede it
+      if ( m_State->Test_IDLE() && *p != 1 )
+	{
+	  const byte_t* next_p = (const byte_t*)memchr(p, 1, end_p - p);
+
+	  if ( next_p == 0 )
+	    next_p = end_p;
+
+	  const byte_t* zero_p = next_p;
+
+	  while ( zero_p > p && zero_p[-1] == 0 )
+	    zero_p--;
+
+	  m_ZeroCount = ( zero_p == p ) ? m_ZeroCount + (ui32_t)( next_p - p ) : (ui32_t)( next_p - zero_p );
+	  run_len += (ui32_t)( next_p - p );
+	  p = next_p;
+
+	  if ( p == end_p )
+	    break;
+	}
+
       if ( m_State->Test_IN_HEADER() )
 	{
 	  assert(run_len==0);
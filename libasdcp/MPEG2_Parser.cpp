@@ -41,6 +41,9 @@ using namespace ASDCP::MPEG2;
 // data will be read from a VES file in chunks of this size
 const ui32_t VESReadSize = 4 * Kumu::Kilobyte;
 
+// frames are parsed in place from blocks of this size
+const ui32_t VESBlockSize = Kumu::Megabyte;
+
 
 //------------------------------------------------------------------------------------------
 
@@ -364,11 +367,13 @@ class ASDCP::MPEG2::Parser::h__Parser
   ui32_t           m_FrameNumber;
   bool             m_EOF;
   ASDCP::MPEG2::FrameBuffer  m_TmpBuffer;
+  Kumu::ByteString m_Block;
+  ui32_t           m_BlockPos;
 
   ASDCP_NO_COPY_CONSTRUCT(h__Parser);
 
 public:
-  h__Parser() : m_TmpBuffer(VESReadSize*8) {}
+  h__Parser() : m_FrameNumber(0), m_EOF(false), m_TmpBuffer(VESReadSize*8), m_Block(VESBlockSize), m_BlockPos(0) {}
   ~h__Parser() { Close(); }
 
   Result_t OpenRead(const std::string& filename);
@@ -387,6 +392,9 @@ ASDCP::MPEG2::Parser::h__Parser::Reset()
   m_EOF = false;
   m_FileReader.Seek(0);
   m_ParserDelegate.Reset();
+  m_TmpBuffer.Size(0);
+  m_Block.Length(0);
+  m_BlockPos = 0;
   return RESULT_OK;
 }
 
@@ -438,6 +446,8 @@ ASDCP::MPEG2::Parser::h__Parser::OpenRead(const std::string& filename)
       m_ParamsDelegate.m_VDesc.ContainerDuration = (ui32_t) tmp;
       m_Parser.SetDelegate(&m_ParserDelegate);
       m_FileReader.Seek(0);
+      m_Block.Length(0);
+      m_BlockPos = 0;
     }
 
   if ( ASDCP_FAILURE(result) )
@@ -456,17 +466,18 @@ ASDCP::MPEG2::Parser::h__Parser::ReadFrame(FrameBuffer& FB)
 {
   Result_t result = RESULT_OK;
   ui32_t write_offset = 0;
-  ui32_t read_count = 0;
 
   FB.Size(0);
 
   if ( m_EOF )
     return RESULT_ENDOFFILE;
 
-  // Data is read in VESReadSize chunks. Each chunk is parsed, and the
+  // Data is read in VESBlockSize blocks and parsed where it lies. The
   // process is stopped when a Sequence or Picture header is found or when
-  // the input file is exhausted. The partial next frame is cached for the
-  // next call.
+  // the input file is exhausted. Only the bytes of the current frame are
+  // copied into the frame buffer, the rest of the block is left for the
+  // next call. A start code split across two blocks can leave a few bytes
+  // of the next frame in the frame buffer, those are cached in m_TmpBuffer.
   m_ParserDelegate.Reset();
   m_Parser.Reset();
 
@@ -480,44 +491,67 @@ ASDCP::MPEG2::Parser::h__Parser::ReadFrame(FrameBuffer& FB)
 
   while ( ! m_ParserDelegate.m_CompletePicture && result == RESULT_OK )
     {
-      if ( FB.Capacity() < ( write_offset + VESReadSize ) )
+      if ( m_BlockPos == m_Block.Length() )
 	{
-	  DefaultLogSink().Error("FrameBuf.Capacity: %u FrameLength: %u\n",
-				 FB.Capacity(), ( write_offset + VESReadSize ));
-	  return RESULT_SMALLBUF;
+	  ui32_t read_count = 0;
+	  m_Block.Length(0);
+	  m_BlockPos = 0;
+
+	  result = m_FileReader.Read(m_Block.Data(), m_Block.Capacity(), &read_count);
+
+	  if ( result == RESULT_ENDOFFILE || read_count == 0 )
+	    {
+	      m_EOF = true;
+
+	      if ( write_offset > 0 )
+		result = RESULT_OK;
+
+	      break;
+	    }
+
+	  m_Block.Length(read_count);
 	}
 
-      result = m_FileReader.Read(FB.Data() + write_offset, VESReadSize, &read_count);
+      if ( ASDCP_FAILURE(result) )
+	break;
 
-      if ( result == RESULT_ENDOFFILE || read_count == 0 )
-	{
-	  m_EOF = true;
+      const byte_t* chunk = m_Block.RoData() + m_BlockPos;
+      ui32_t chunk_len = m_Block.Length() - m_BlockPos;
 
-	  if ( write_offset > 0 )
-	    result = RESULT_OK;
+      result = m_Parser.Parse(chunk, chunk_len);
+
+      if ( m_ParserDelegate.m_CompletePicture )
+	{
+	  // the start code ending the frame began in the previous block
+	  if ( m_ParserDelegate.m_FrameSize < write_offset )
+	    {
+	      ui32_t diff = write_offset - m_ParserDelegate.m_FrameSize;
+	      assert(diff <= m_TmpBuffer.Capacity());
+
+	      memcpy(m_TmpBuffer.Data(), FB.RoData() + m_ParserDelegate.m_FrameSize, diff);
+	      m_TmpBuffer.Size(diff);
+	      break;
+	    }
+
+	  chunk_len = m_ParserDelegate.m_FrameSize - write_offset;
 	}
 
       if ( ASDCP_SUCCESS(result) )
 	{
-	  result = m_Parser.Parse(FB.RoData() + write_offset, read_count);
-	  write_offset += read_count;
+	  if ( FB.Capacity() < ( write_offset + chunk_len ) )
+	    {
+	      DefaultLogSink().Error("FrameBuf.Capacity: %u FrameLength: %u\n",
+				     FB.Capacity(), ( write_offset + chunk_len ));
+	      return RESULT_SMALLBUF;
+	    }
+
+	  memcpy(FB.Data() + write_offset, chunk, chunk_len);
+	  write_offset += chunk_len;
+	  m_BlockPos += chunk_len;
 	}
-
-      if ( m_EOF )
-	break;
     }
-  assert(m_ParserDelegate.m_FrameSize <= write_offset);
 
-  if ( ASDCP_SUCCESS(result)
-       && m_ParserDelegate.m_FrameSize < write_offset )
-    {
-      assert(m_TmpBuffer.Size() == 0);
-      ui32_t diff = write_offset - m_ParserDelegate.m_FrameSize;
-      assert(diff <= m_TmpBuffer.Capacity());
-
-      memcpy(m_TmpBuffer.Data(), FB.RoData() + m_ParserDelegate.m_FrameSize, diff);
-      m_TmpBuffer.Size(diff);
-    }
+  assert(m_ParserDelegate.m_FrameSize <= write_offset);
 
   if ( ASDCP_SUCCESS(result) )
     {
@@ -32,6 +32,7 @@ THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "MXF.h"
 #include "Metadata.h"
 #include <KM_log.h>
+#include <new>
 
 using Kumu::DefaultLogSink;
 using Kumu::GenRandomValue;
@@ -194,8 +195,14 @@ void
 ASDCP::MXF::Partition::PacketList::AddPacket(InterchangeObject* ThePacket) // takes ownership
 {
   assert(ThePacket);
-  m_Map.insert(std::map<UUID, InterchangeObject*>::value_type(ThePacket->InstanceUID, ThePacket));
+  m_Map.insert(ThePacket->InstanceUID.Value(), ThePacket);
   m_List.push_back(ThePacket);
+
+  // HasUL never matches a packet without a label, so neither does the index
+  UL packet_ul = ThePacket->GetUL();
+
+  if ( packet_ul.HasValue() )
+    m_TypeMap.get(packet_ul.Value()).push_back(ThePacket);
 }
 
 //
@@ -204,15 +211,15 @@ ASDCP::MXF::Partition::PacketList::GetMDObjectByID(const UUID& ObjectID, Interch
 {
   ASDCP_TEST_NULL(Object);
 
-  std::map<UUID, InterchangeObject*>::iterator mi = m_Map.find(ObjectID);
-  
-  if ( mi == m_Map.end() )
+  InterchangeObject** mi = m_Map.find(ObjectID.Value());
+
+  if ( mi == 0 )
     {
       *Object = 0;
       return RESULT_FAIL;
     }
 
-  *Object = (*mi).second;
+  *Object = *mi;
   return RESULT_OK;
 }
 
@@ -222,19 +229,14 @@ ASDCP::MXF::Partition::PacketList::GetMDObjectByType(const byte_t* ObjectID, Int
 {
   ASDCP_TEST_NULL(ObjectID);
   ASDCP_TEST_NULL(Object);
-  std::list<InterchangeObject*>::iterator li;
+  std::vector<InterchangeObject*>* objects = m_TypeMap.find(ObjectID);
   *Object = 0;
 
-  for ( li = m_List.begin(); li != m_List.end(); li++ )
-    {
-      if ( (*li)->HasUL(ObjectID) )
-	{
-	  *Object = *li;
-	  return RESULT_OK;
-	}
-    }
+  if ( objects == 0 || objects->empty() )
+    return RESULT_FAIL;
 
-  return RESULT_FAIL;
+  *Object = objects->front();
+  return RESULT_OK;
 }
 
 //
@@ -242,15 +244,111 @@ ASDCP::Result_t
 ASDCP::MXF::Partition::PacketList::GetMDObjectsByType(const byte_t* ObjectID, std::list<InterchangeObject*>& ObjectList)
 {
   ASDCP_TEST_NULL(ObjectID);
-  std::list<InterchangeObject*>::iterator li;
+  std::vector<InterchangeObject*>* objects = m_TypeMap.find(ObjectID);
+
+  if ( objects != 0 )
+    ObjectList.insert(ObjectList.end(), objects->begin(), objects->end());
+
+  return ObjectList.empty() ? RESULT_FAIL : RESULT_OK;
+}
+
+//------------------------------------------------------------------------------------------
+//
+
+#ifdef _MSC_VER
+#define ASDCP_THREAD_LOCAL __declspec(thread)
+#else
+#define ASDCP_THREAD_LOCAL __thread
+#endif
+
+static const ui32_t ArenaBlockSize = 64 * 1024;
+static const ui32_t ArenaHeaderSize = 16; // keeps objects 16 byte aligned
+
+// the arena InterchangeObject::operator new draws from on this thread
+static ASDCP_THREAD_LOCAL ASDCP::MXF::ObjectArena* s_CurrentArena = 0;
+
+//
+class ArenaScope
+{
+  ASDCP::MXF::ObjectArena* m_Previous;
 
-  for ( li = m_List.begin(); li != m_List.end(); li++ )
+public:
+  ArenaScope(ASDCP::MXF::ObjectArena* arena) : m_Previous(s_CurrentArena) { s_CurrentArena = arena; }
+  ~ArenaScope() { s_CurrentArena = m_Previous; }
+};
+
+//
+ASDCP::MXF::ObjectArena::~ObjectArena()
+{
+  while ( ! m_Blocks.empty() )
     {
-      if ( (*li)->HasUL(ObjectID) )
-	ObjectList.push_back(*li);
+      free(m_Blocks.back());
+      m_Blocks.pop_back();
     }
+}
 
-  return ObjectList.empty() ? RESULT_FAIL : RESULT_OK;
+//
+void*
+ASDCP::MXF::ObjectArena::Alloc(ui32_t size)
+{
+  size = ( size + 15 ) & ~15;
+
+  // large items get a block of their own and leave the current one alone
+  if ( size > ArenaBlockSize / 4 )
+    {
+      byte_t* block = (byte_t*)malloc(size);
+
+      if ( block == 0 )
+	throw std::bad_alloc();
+
+      m_Blocks.insert(m_Blocks.begin(), block);
+      return block;
+    }
+
+  if ( size > m_Remainder )
+    {
+      m_Next = (byte_t*)malloc(ArenaBlockSize);
+
+      if ( m_Next == 0 )
+	throw std::bad_alloc();
+
+      m_Blocks.push_back(m_Next);
+      m_Remainder = ArenaBlockSize;
+    }
+
+  void* p = m_Next;
+  m_Next += size;
+  m_Remainder -= size;
+  return p;
+}
+
+//
+void*
+ASDCP::MXF::InterchangeObject::operator new(size_t size)
+{
+  ObjectArena* arena = s_CurrentArena;
+  byte_t* p;
+
+  if ( arena != 0 )
+    p = (byte_t*)arena->Alloc(size + ArenaHeaderSize);
+  else
+    p = (byte_t*)::operator new(size + ArenaHeaderSize);
+
+  *(ObjectArena**)p = arena;
+  return p + ArenaHeaderSize;
+}
+
+// arena memory goes back with the arena
+void
+ASDCP::MXF::InterchangeObject::operator delete(void* p)
+{
+  if ( p == 0 )
+    return;
+
+  byte_t* block = (byte_t*)p - ArenaHeaderSize;
+
+  if ( *(ObjectArena**)block == 0 )
+    ::operator delete(block);
 }
 
 //------------------------------------------------------------------------------------------
@@ -331,9 +429,34 @@ ASDCP::MXF::Partition::WriteToFile(Kumu::FileWriter& Writer, UL& PartitionLabel)
   ASDCP::FrameBuffer Buffer;
   Result_t result = Buffer.Capacity(1024);
 
+  if ( ASDCP_SUCCESS(result) )
+    result = WriteToBuffer(Buffer, PartitionLabel);
+
   if ( ASDCP_SUCCESS(result) )
     {
-      Kumu::MemIOWriter MemWRT(Buffer.Data(), Buffer.Capacity());
+      ui32_t write_count;
+      result = Writer.Write(Buffer.RoData(), Buffer.Size(), &write_count);
+    }
+
+  return result;
+}
+
+//
+ASDCP::Result_t
+ASDCP::MXF::Partition::WriteToBuffer(ASDCP::FrameBuffer& Buffer, UL& PartitionLabel)
+{
+  Result_t result = RESULT_OK;
+
+  if ( Buffer.Size() + kl_length > Buffer.Capacity() )
+    {
+      DefaultLogSink().Error("Small write buffer\n");
+      return RESULT_SMALLBUF;
+    }
+
+  if ( ASDCP_SUCCESS(result) )
+    {
+      Kumu::MemIOWriter MemWRT(Buffer.Data() + Buffer.Size() + kl_length,
+			       Buffer.Capacity() - Buffer.Size() - kl_length);
       result = RESULT_KLV_CODING(__LINE__, __FILE__);
       if ( MemWRT.WriteUi16BE(MajorVersion) )
 	if ( MemWRT.WriteUi16BE(MinorVersion) )
@@ -349,18 +472,11 @@ ASDCP::MXF::Partition::WriteToFile(Kumu::FileWriter& Writer, UL& PartitionLabel)
 			    if ( OperationalPattern.Archive(&MemWRT) )
 			      if ( EssenceContainers.Archive(&MemWRT) )
 				{
-				  Buffer.Size(MemWRT.Length());
-				  result = RESULT_OK;
-				}
-    }
+				  result = WriteKLToBuffer(Buffer, PartitionLabel, MemWRT.Length());
 
-  if ( ASDCP_SUCCESS(result) )
-    {
-      ui32_t write_count;
-      result = WriteKLToFile(Writer, PartitionLabel.Value(), Buffer.Size());
-
-      if ( ASDCP_SUCCESS(result) )
-	result = Writer.Write(Buffer.RoData(), Buffer.Size(), &write_count);
+				  if ( ASDCP_SUCCESS(result) )
+				    Buffer.Size(Buffer.Size() + MemWRT.Length());
+				}
     }
 
   return result;
@@ -410,7 +526,7 @@ ASDCP::MXF::Partition::Dump(FILE* stream)
 //------------------------------------------------------------------------------------------
 //
 
-class ASDCP::MXF::Primer::h__PrimerLookup : public std::map<UL, TagValue>
+class ASDCP::MXF::Primer::h__PrimerLookup : public ASDCP::LabelTable<TagValue>
 {
 public:
   void InitWithBatch(ASDCP::MXF::Batch<ASDCP::MXF::Primer::LocalTagEntry>& Batch)
@@ -418,7 +534,7 @@ public:
     ASDCP::MXF::Batch<ASDCP::MXF::Primer::LocalTagEntry>::iterator i = Batch.begin();
 
     for ( ; i != Batch.end(); i++ )
-      insert(std::map<UL, TagValue>::value_type((*i).UL, (*i).Tag));
+      insert((*i).UL.Value(), (*i).Tag);
   }
 };
 
@@ -507,9 +623,9 @@ ASDCP::MXF::Primer::InsertTag(const MDDEntry& Entry, ASDCP::TagValue& Tag)
 {
   assert(m_Lookup);
   UL TestUL(Entry.ul);
-  std::map<UL, TagValue>::iterator i = m_Lookup->find(TestUL);
+  TagValue* i = m_Lookup->find(TestUL.Value());
 
-  if ( i == m_Lookup->end() )
+  if ( i == 0 )
     {
       if ( Entry.tag.a == 0 && Entry.tag.b == 0 )
 	{
@@ -527,11 +643,11 @@ ASDCP::MXF::Primer::InsertTag(const MDDEntry& Entry, ASDCP::TagValue& Tag)
       TmpEntry.Tag = Tag;
 
       LocalTagEntryBatch.insert(TmpEntry);
-      m_Lookup->insert(std::map<UL, TagValue>::value_type(TmpEntry.UL, TmpEntry.Tag));
+      m_Lookup->insert(TmpEntry.UL.Value(), TmpEntry.Tag);
     }
   else
     {
-      Tag = (*i).second;
+      Tag = *i;
     }
    
   return RESULT_OK;
@@ -548,12 +664,12 @@ ASDCP::MXF::Primer::TagForKey(const ASDCP::UL& Key, ASDCP::TagValue& Tag)
       return RESULT_FAIL;
     }
 
-  std::map<UL, TagValue>::iterator i = m_Lookup->find(Key);
+  TagValue* i = m_Lookup->find(Key.Value());
 
-  if ( i == m_Lookup->end() )
+  if ( i == 0 )
     return RESULT_FALSE;
 
-  Tag = (*i).second;
+  Tag = *i;
   return RESULT_OK;
 }
 
@@ -774,6 +890,7 @@ ASDCP::MXF::OP1aHeader::InitFromBuffer(const byte_t* p, ui32_t l)
   assert(m_Dict);
   Result_t result = RESULT_OK;
   const byte_t* end_p = p + l;
+  ArenaScope arena_scope(&m_PacketList->m_Arena);
 
   while ( ASDCP_SUCCESS(result) && p < end_p )
     {
@@ -885,12 +1002,25 @@ ASDCP::MXF::OP1aHeader::WriteToFile(Kumu::FileWriter& Writer, ui32_t HeaderSize)
       return RESULT_PARAM;
     }
 
+  // the whole region is built in memory and written at once
   ASDCP::FrameBuffer HeaderBuffer;
   HeaderByteCount = HeaderSize - ArchiveSize();
   assert (HeaderByteCount <= 0xFFFFFFFFL);
-  Result_t result = HeaderBuffer.Capacity((ui32_t) HeaderByteCount); 
+  Result_t result = HeaderBuffer.Capacity(HeaderSize);
   m_Preface->m_Lookup = &m_Primer;
 
+  if ( ASDCP_SUCCESS(result) )
+    {
+      UL TmpUL(m_Dict->ul(MDD_ClosedCompleteHeader));
+      result = Partition::WriteToBuffer(HeaderBuffer, TmpUL);
+    }
+
+  // the primer gets its tags as the objects are archived, it goes in after them
+  ASDCP::FrameBuffer MetadataBuffer;
+
+  if ( ASDCP_SUCCESS(result) )
+    result = MetadataBuffer.Capacity(HeaderSize);
+
   std::list<InterchangeObject*>::iterator pl_i = m_PacketList->m_List.begin();
   for ( ; pl_i != m_PacketList->m_List.end() && ASDCP_SUCCESS(result); pl_i++ )
     {
@@ -898,34 +1028,27 @@ ASDCP::MXF::OP1aHeader::WriteToFile(Kumu::FileWriter& Writer, ui32_t HeaderSize)
       object->m_Lookup = &m_Primer;
 
       ASDCP::FrameBuffer WriteWrapper;
-      WriteWrapper.SetData(HeaderBuffer.Data() + HeaderBuffer.Size(),
-			   HeaderBuffer.Capacity() - HeaderBuffer.Size());
+      WriteWrapper.SetData(MetadataBuffer.Data() + MetadataBuffer.Size(),
+			   MetadataBuffer.Capacity() - MetadataBuffer.Size());
       result = object->WriteToBuffer(WriteWrapper);
-      HeaderBuffer.Size(HeaderBuffer.Size() + WriteWrapper.Size());
+      MetadataBuffer.Size(MetadataBuffer.Size() + WriteWrapper.Size());
     }
 
   if ( ASDCP_SUCCESS(result) )
     {
-      UL TmpUL(m_Dict->ul(MDD_ClosedCompleteHeader));
-      result = Partition::WriteToFile(Writer, TmpUL);
-    }
-
-  if ( ASDCP_SUCCESS(result) )
-    result = m_Primer.WriteToFile(Writer);
-
-  if ( ASDCP_SUCCESS(result) )
-    {
-      ui32_t write_count;
-      Writer.Write(HeaderBuffer.RoData(), HeaderBuffer.Size(), &write_count);
-      assert(write_count == HeaderBuffer.Size());
+      ASDCP::FrameBuffer WriteWrapper;
+      WriteWrapper.SetData(HeaderBuffer.Data() + HeaderBuffer.Size(),
+			   HeaderBuffer.Capacity() - HeaderBuffer.Size());
+      result = m_Primer.WriteToBuffer(WriteWrapper);
+      HeaderBuffer.Size(HeaderBuffer.Size() + WriteWrapper.Size());
     }
 
   // KLV Fill
   if ( ASDCP_SUCCESS(result) )
     {
-      Kumu::fpos_t pos = Writer.Tell();
+      ui64_t pos = (ui64_t)HeaderBuffer.Size() + MetadataBuffer.Size();
 
-      if ( pos > (Kumu::fpos_t)HeaderByteCount )
+      if ( pos > HeaderByteCount )
 	{
 	  char intbuf[IntBufferLen];
 	  DefaultLogSink().Error("Header size %s exceeds specified value %u\n",
@@ -934,7 +1057,6 @@ ASDCP::MXF::OP1aHeader::WriteToFile(Kumu::FileWriter& Writer, ui32_t HeaderSize)
 	  return RESULT_FAIL;
 	}
 
-      ASDCP::FrameBuffer NilBuf;
       ui32_t klv_fill_length = HeaderSize - (ui32_t)pos;
 
       if ( klv_fill_length < kl_length )
@@ -943,21 +1065,26 @@ ASDCP::MXF::OP1aHeader::WriteToFile(Kumu::FileWriter& Writer, ui32_t HeaderSize)
 	  return RESULT_FAIL;
 	}
 
-      klv_fill_length -= kl_length;
-      result = WriteKLToFile(Writer, m_Dict->ul(MDD_KLVFill), klv_fill_length);
+      memcpy(HeaderBuffer.Data() + HeaderBuffer.Size(), MetadataBuffer.RoData(), MetadataBuffer.Size());
+      HeaderBuffer.Size((ui32_t)pos);
 
-      if ( ASDCP_SUCCESS(result) )
-	result = NilBuf.Capacity(klv_fill_length);
+      klv_fill_length -= kl_length;
+      result = WriteKLToBuffer(HeaderBuffer, m_Dict->ul(MDD_KLVFill), klv_fill_length);
 
       if ( ASDCP_SUCCESS(result) )
 	{
-	  memset(NilBuf.Data(), 0, klv_fill_length);
-	  ui32_t write_count;
-	  Writer.Write(NilBuf.RoData(), klv_fill_length, &write_count);
-	  assert(write_count == klv_fill_length);
+	  memset(HeaderBuffer.Data() + HeaderBuffer.Size(), 0, klv_fill_length);
+	  HeaderBuffer.Size(HeaderSize);
 	}
     }
 
+  if ( ASDCP_SUCCESS(result) )
+    {
+      ui32_t write_count = 0;
+      result = Writer.Write(HeaderBuffer.RoData(), HeaderBuffer.Size(), &write_count);
+      assert(ASDCP_FAILURE(result) || write_count == HeaderBuffer.Size());
+    }
+
   return result;
 }
 
@@ -984,14 +1111,25 @@ ASDCP::MXF::OP1aHeader::Dump(FILE* stream)
 
 ASDCP::MXF::OPAtomIndexFooter::OPAtomIndexFooter(const Dictionary*& d) :
   Partition(d), m_Dict(d),
-  m_CurrentSegment(0), m_BytesPerEditUnit(0), m_BodySID(0),
+  m_CurrentSegment(0), m_BytesPerEditUnit(0), m_BodySID(0), m_SpillBytes(0),
   m_ECOffset(0), m_Lookup(0)
 {
   BodySID = 0;
   IndexSID = 129;
 }
 
-ASDCP::MXF::OPAtomIndexFooter::~OPAtomIndexFooter() {}
+// a spilling footer owns its current segment until it is written
+ASDCP::MXF::OPAtomIndexFooter::~OPAtomIndexFooter()
+{
+  if ( ! m_SpillFile.empty() )
+    delete m_CurrentSegment;
+
+  if ( ! m_SpillFilename.empty() )
+    {
+      m_SpillFile.set(0);
+      Kumu::DeleteFile(m_SpillFilename);
+    }
+}
 
 //
 ASDCP::Result_t
@@ -1058,7 +1196,8 @@ ASDCP::MXF::OPAtomIndexFooter::InitFromBuffer(const byte_t* p, ui32_t l)
 {
   Result_t result = RESULT_OK;
   const byte_t* end_p = p + l;
-  
+  ArenaScope arena_scope(&m_PacketList->m_Arena);
+
   while ( ASDCP_SUCCESS(result) && p < end_p )
     {
       // parse the packets and index them by uid, discard KLVFill items
@@ -1094,16 +1233,22 @@ ASDCP::MXF::OPAtomIndexFooter::WriteToFile(Kumu::FileWriter& Writer, ui64_t dura
 {
   assert(m_Dict);
   ASDCP::FrameBuffer FooterBuffer;
-  ui32_t   footer_size = m_PacketList->m_List.size() * MaxIndexSegmentSize; // segment-count * max-segment-size
-  Result_t result = FooterBuffer.Capacity(footer_size); 
   ui32_t   iseg_count = 0;
 
   if ( m_CurrentSegment != 0 )
     {
       m_CurrentSegment->IndexDuration = m_CurrentSegment->IndexEntryArray.size();
+
+      // the last segment goes in memory behind the spilled ones
+      if ( ! m_SpillFile.empty() )
+	AddChildObject(m_CurrentSegment);
+
       m_CurrentSegment = 0;
     }
 
+  ui32_t   footer_size = m_PacketList->m_List.size() * MaxIndexSegmentSize; // segment-count * max-segment-size
+  Result_t result = FooterBuffer.Capacity(footer_size); 
+
   std::list<InterchangeObject*>::iterator pl_i = m_PacketList->m_List.begin();
   for ( ; pl_i != m_PacketList->m_List.end() && ASDCP_SUCCESS(result); pl_i++ )
     {
@@ -1133,11 +1278,14 @@ ASDCP::MXF::OPAtomIndexFooter::WriteToFile(Kumu::FileWriter& Writer, ui64_t dura
 
   if ( ASDCP_SUCCESS(result) )
     {
-      IndexByteCount = FooterBuffer.Size();
+      IndexByteCount = m_SpillBytes + FooterBuffer.Size();
       UL FooterUL(m_Dict->ul(MDD_CompleteFooter));
       result = Partition::WriteToFile(Writer, FooterUL);
     }
 
+  if ( ASDCP_SUCCESS(result) && ! m_SpillFilename.empty() )
+    result = WriteSpilledSegments(Writer);
+
   if ( ASDCP_SUCCESS(result) )
     {
       ui32_t write_count = 0;
@@ -1281,7 +1429,10 @@ ASDCP::MXF::OPAtomIndexFooter::PushIndexEntry(const IndexTableSegment::IndexEntr
     { // no, set up a new segment
       m_CurrentSegment = new IndexTableSegment(m_Dict);
       assert(m_CurrentSegment);
-      AddChildObject(m_CurrentSegment);
+
+      if ( m_SpillFile.empty() )
+	AddChildObject(m_CurrentSegment);
+
       m_CurrentSegment->DeltaEntryArray.push_back(m_DefaultDeltaEntry);
       m_CurrentSegment->IndexEditRate = m_EditRate;
       m_CurrentSegment->IndexStartPosition = 0;
@@ -1291,9 +1442,21 @@ ASDCP::MXF::OPAtomIndexFooter::PushIndexEntry(const IndexTableSegment::IndexEntr
       m_CurrentSegment->IndexDuration = m_CurrentSegment->IndexEntryArray.size();
       ui64_t StartPosition = m_CurrentSegment->IndexStartPosition + m_CurrentSegment->IndexDuration;
 
+      if ( ! m_SpillFile.empty() && ASDCP_FAILURE(SpillSegment()) )
+	{
+	  // keep this and the following segments in memory, behind the spilled ones
+	  DefaultLogSink().Warn("Could not spill index segment, keeping the index in memory.\n");
+	  AddChildObject(m_CurrentSegment);
+	  m_SpillFile->Close();
+	  m_SpillFile.set(0);
+	}
+
       m_CurrentSegment = new IndexTableSegment(m_Dict);
       assert(m_CurrentSegment);
-      AddChildObject(m_CurrentSegment);
+
+      if ( m_SpillFile.empty() )
+	AddChildObject(m_CurrentSegment);
+
       m_CurrentSegment->DeltaEntryArray.push_back(m_DefaultDeltaEntry);
       m_CurrentSegment->IndexEditRate = m_EditRate;
       m_CurrentSegment->IndexStartPosition = StartPosition;
@@ -1302,6 +1465,110 @@ ASDCP::MXF::OPAtomIndexFooter::PushIndexEntry(const IndexTableSegment::IndexEntr
   m_CurrentSegment->IndexEntryArray.push_back(Entry);
 }
 
+//
+ASDCP::Result_t
+ASDCP::MXF::OPAtomIndexFooter::EnableIndexSpill(const std::string& filename)
+{
+  if ( m_BytesPerEditUnit != 0 || m_CurrentSegment != 0 || ! m_SpillFilename.empty() )
+    return RESULT_STATE;
+
+  m_SpillFile = new Kumu::FileWriter;
+  Result_t result = m_SpillFile->OpenWrite(filename);
+
+  if ( ASDCP_FAILURE(result) )
+    {
+      m_SpillFile.set(0);
+      return result;
+    }
+
+  m_SpillFilename = filename;
+  m_SpillBytes = 0;
+  return RESULT_OK;
+}
+
+// writes the full current segment to the spill file and drops it
+ASDCP::Result_t
+ASDCP::MXF::OPAtomIndexFooter::SpillSegment()
+{
+  assert(m_CurrentSegment);
+  ASDCP::FrameBuffer SegmentBuffer;
+  Result_t result = SegmentBuffer.Capacity(MaxIndexSegmentSize);
+
+  if ( ! m_CurrentSegment->InstanceUID.HasValue() )
+    GenRandomValue(m_CurrentSegment->InstanceUID);
+
+  m_CurrentSegment->m_Lookup = m_Lookup;
+
+  if ( ASDCP_SUCCESS(result) )
+    result = m_CurrentSegment->WriteToBuffer(SegmentBuffer);
+
+  ui32_t write_count = 0;
+
+  if ( ASDCP_SUCCESS(result) )
+    result = m_SpillFile->Write(SegmentBuffer.RoData(), SegmentBuffer.Size(), &write_count);
+
+  if ( ASDCP_SUCCESS(result) && write_count != SegmentBuffer.Size() )
+    result = RESULT_WRITEFAIL;
+
+  if ( ASDCP_SUCCESS(result) )
+    {
+      m_SpillBytes += write_count;
+      delete m_CurrentSegment;
+      m_CurrentSegment = 0;
+    }
+
+  return result;
+}
+
+// copies the spilled segments into the footer and removes the spill file
+ASDCP::Result_t
+ASDCP::MXF::OPAtomIndexFooter::WriteSpilledSegments(Kumu::FileWriter& Writer)
+{
+  Result_t result = RESULT_OK;
+
+  if ( ! m_SpillFile.empty() )
+    {
+      result = m_SpillFile->Close();
+      m_SpillFile.set(0);
+    }
+
+  Kumu::FileReader Reader;
+  ASDCP::FrameBuffer CopyBuffer;
+  ui64_t remainder = m_SpillBytes;
+
+  if ( ASDCP_SUCCESS(result) && remainder > 0 )
+    result = Reader.OpenRead(m_SpillFilename);
+
+  if ( ASDCP_SUCCESS(result) && remainder > 0 )
+    result = CopyBuffer.Capacity(Kumu::Megabyte);
+
+  while ( ASDCP_SUCCESS(result) && remainder > 0 )
+    {
+      ui32_t read_count = 0, write_count = 0;
+      ui32_t chunk = remainder < CopyBuffer.Capacity() ? (ui32_t)remainder : CopyBuffer.Capacity();
+      result = Reader.Read(CopyBuffer.Data(), chunk, &read_count);
+
+      if ( ASDCP_SUCCESS(result) && read_count != chunk )
+	result = RESULT_READFAIL;
+
+      if ( ASDCP_SUCCESS(result) )
+	result = Writer.Write(CopyBuffer.RoData(), chunk, &write_count);
+
+      if ( ASDCP_SUCCESS(result) && write_count != chunk )
+	result = RESULT_WRITEFAIL;
+
+      remainder -= chunk;
+    }
+
+  if ( ASDCP_FAILURE(result) )
+    DefaultLogSink().Error("Could not copy the spilled index segments from %s.\n", m_SpillFilename.c_str());
+
+  Reader.Close();
+  Kumu::DeleteFile(m_SpillFilename);
+  m_SpillFilename.clear();
+  return result;
+}
+
 //------------------------------------------------------------------------------------------
 //
 
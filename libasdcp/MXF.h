@@ -114,6 +114,24 @@ namespace ASDCP
 	};
 
 
+      // Bump allocator for the metadata objects parsed into one partition.
+      // Memory is only returned when the arena is destroyed, so a header with
+      // thousands of sets costs a handful of block allocations.
+      class ObjectArena
+	{
+	  std::vector<byte_t*> m_Blocks;
+	  byte_t* m_Next;
+	  ui32_t  m_Remainder;
+
+	  ObjectArena(const ObjectArena&);
+	  ObjectArena& operator=(const ObjectArena&);
+
+	public:
+	  ObjectArena() : m_Next(0), m_Remainder(0) {}
+	  ~ObjectArena();
+	  void* Alloc(ui32_t size); // 16 byte aligned
+	};
+
       //
       class Partition : public ASDCP::KLVFilePacket
 	{
@@ -124,8 +142,10 @@ namespace ASDCP
 	  class PacketList
 	  {
 	  public:
+	    ObjectArena m_Arena; // declared first so it outlives the objects
 	    std::list<InterchangeObject*> m_List;
-	    std::map<UUID, InterchangeObject*> m_Map;
+	    LabelTable<InterchangeObject*> m_Map;
+	    LabelTable<std::vector<InterchangeObject*>, true> m_TypeMap; // objects by UL, in list order
 
 	    ~PacketList();
 	    void AddPacket(InterchangeObject* ThePacket); // takes ownership
@@ -159,6 +179,7 @@ namespace ASDCP
 	  virtual Result_t InitFromFile(const Kumu::FileReader& Reader);
 	  virtual Result_t InitFromBuffer(const byte_t* p, ui32_t l);
 	  virtual Result_t WriteToFile(Kumu::FileWriter& Writer, UL& PartitionLabel);
+	  virtual Result_t WriteToBuffer(ASDCP::FrameBuffer& Buffer, UL& PartitionLabel); // appends the packet
 	  virtual ui32_t   ArchiveSize(); // returns the size of the archived structure
 	  virtual void     Dump(FILE* = 0);
 	};
@@ -301,6 +322,11 @@ namespace ASDCP
 	InterchangeObject(const Dictionary*& d) : m_Dict(d), m_Lookup(0) {}
 	  virtual ~InterchangeObject() {}
 
+	  // objects created while a partition parses its sets come from the
+	  // partition's ObjectArena, all others from the heap
+	  static void* operator new(size_t size);
+	  static void  operator delete(void* p);
+
 	  virtual void Copy(const InterchangeObject& rhs);
           virtual Result_t InitFromTLVSet(TLVReader& TLVSet);
 	  virtual Result_t InitFromBuffer(const byte_t* p, ui32_t l);
@@ -442,6 +468,9 @@ namespace ASDCP
 	  virtual Result_t InitFromFile(const Kumu::FileReader& Reader);
 	  virtual Result_t InitFromPartitionBuffer(const byte_t* p, ui32_t l);
 	  virtual Result_t InitFromBuffer(const byte_t* p, ui32_t l);
+	  // Writes the partition pack, primer, metadata and KLV fill as one
+	  // HeaderLength buffer, so rewriting a finished file's header at offset
+	  // 0 is a single write of the same size that never moves the essence.
 	  virtual Result_t WriteToFile(Kumu::FileWriter& Writer, ui32_t HeaderLength = 16384);
 	  virtual void     Dump(FILE* = 0);
 	  virtual Result_t GetMDObjectByID(const UUID&, InterchangeObject** = 0);
@@ -465,9 +494,17 @@ namespace ASDCP
 	  ui32_t              m_BodySID;
 	  IndexTableSegment::DeltaEntry m_DefaultDeltaEntry;
 
+	  // full segments written out of memory, see EnableIndexSpill()
+	  mem_ptr<Kumu::FileWriter> m_SpillFile;
+	  std::string         m_SpillFilename;
+	  ui64_t              m_SpillBytes;
+
 	  ASDCP_NO_COPY_CONSTRUCT(OPAtomIndexFooter);
 	  OPAtomIndexFooter();
 
+	  Result_t SpillSegment();
+	  Result_t WriteSpilledSegments(Kumu::FileWriter& Writer);
+
 	public:
 	  const Dictionary*&   m_Dict;
 	  Kumu::fpos_t        m_ECOffset;
@@ -490,6 +527,12 @@ namespace ASDCP
 	  virtual void     SetDeltaParams(const IndexTableSegment::DeltaEntry&);
 	  virtual void     SetIndexParamsCBR(IPrimerLookup* lookup, ui32_t size, const Rational& Rate);
 	  virtual void     SetIndexParamsVBR(IPrimerLookup* lookup, const Rational& Rate, Kumu::fpos_t offset);
+
+	  // Writes each VBR index segment to the named temporary file as soon as it
+	  // is full, so memory does not grow with the duration. WriteToFile() copies
+	  // the segments into the footer and removes the file. Lookup() does not see
+	  // spilled segments. Call before the first PushIndexEntry().
+	  virtual Result_t EnableIndexSpill(const std::string& filename);
 	};
 
       //---------------------------------------------------------------------------------
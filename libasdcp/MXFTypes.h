@@ -200,7 +200,7 @@ namespace ASDCP
 
       //
       template <class T>
-	class SimpleArray : public std::list<T>, public Kumu::IArchive
+	class SimpleArray : public std::vector<T>, public Kumu::IArchive
 	{
 	public:
 	  SimpleArray() {}
@@ -230,7 +230,7 @@ namespace ASDCP
 	  ui32_t ArchiveLength() const {
 	    ui32_t arch_size = 0;
 
-	    typename std::list<T>::const_iterator l_i = this->begin();
+	    typename std::vector<T>::const_iterator l_i = this->begin();
 
 	    for ( ; l_i != this->end(); l_i++ )
 	      arch_size += l_i->ArchiveLength();
@@ -241,7 +241,7 @@ namespace ASDCP
 	  //
 	  bool Archive(Kumu::MemIOWriter* Writer) const {
 	    bool result = true;
-	    typename std::list<T>::const_iterator l_i = this->begin();
+	    typename std::vector<T>::const_iterator l_i = this->begin();
 
 	    for ( ; l_i != this->end() && result; l_i++ )
 	      result = (*l_i).Archive(Writer);
@@ -257,7 +257,7 @@ namespace ASDCP
 	      if ( stream == 0 )
 		stream = stderr;
 
-	      typename std::list<T>::iterator i = this->begin();
+	      typename std::vector<T>::iterator i = this->begin();
 	      for ( ; i != this->end(); i++ )
 		fprintf(stream, "  %s\n", (*i).EncodeString(identbuf, IdentBufferLen));
 	    }
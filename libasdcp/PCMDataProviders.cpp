@@ -38,6 +38,44 @@ using namespace Kumu;
 
 ASDCP::PCMDataProviderInterface::~PCMDataProviderInterface() {}
 
+// Copies count samples of Width bytes, src advancing by src_stride and dst by dst_stride.
+// A constant Width lets the compiler turn each sample into a few register moves.
+template <ui32_t Width>
+static void
+copy_samples(byte_t* dst, ui32_t dst_stride, const byte_t* src, ui32_t src_stride, ui32_t count)
+{
+  for ( ui32_t i = 0; i < count; ++i, dst += dst_stride, src += src_stride )
+    ::memcpy(dst, src, Width);
+}
+
+//
+static void
+interleave_samples(byte_t* dst, ui32_t dst_stride, const byte_t* src, ui32_t src_stride,
+                   ui32_t width, ui32_t count)
+{
+  if ( dst_stride == width && src_stride == width )
+    {
+      ::memcpy(dst, src, width * count);
+      return;
+    }
+
+  switch ( width )
+    {
+    case 2:  copy_samples<2>(dst, dst_stride, src, src_stride, count); break;
+    case 3:  copy_samples<3>(dst, dst_stride, src, src_stride, count); break;
+    case 4:  copy_samples<4>(dst, dst_stride, src, src_stride, count); break;
+    case 6:  copy_samples<6>(dst, dst_stride, src, src_stride, count); break;
+    case 12: copy_samples<12>(dst, dst_stride, src, src_stride, count); break;
+    case 15: copy_samples<15>(dst, dst_stride, src, src_stride, count); break;
+    case 18: copy_samples<18>(dst, dst_stride, src, src_stride, count); break;
+    case 24: copy_samples<24>(dst, dst_stride, src, src_stride, count); break;
+
+    default:
+      for ( ui32_t i = 0; i < count; ++i, dst += dst_stride, src += src_stride )
+	::memcpy(dst, src, width);
+    }
+}
+
 //
 ASDCP::WAVDataProvider::WAVDataProvider()
     : m_Parser(), m_FB(), m_ADesc(), m_SampleSize(0), m_ptr(NULL)
@@ -63,6 +101,26 @@ ASDCP::WAVDataProvider::PutSample(const ui32_t numChannels, byte_t* buf, ui32_t*
   return RESULT_OK;
 }
 
+// Adjacent calls for the same file pick up where the previous one stopped within the
+// first sample, so a file may be split around another provider's channels.
+Result_t
+ASDCP::WAVDataProvider::PutFrame(const ui32_t numChannels, const ui32_t numSamples, byte_t* buf,
+                                 const ui32_t stride, ui32_t* bytesWritten)
+{
+  ASDCP_TEST_NULL(buf);
+  ASDCP_TEST_NULL(m_ptr);
+  if ( numChannels > m_ADesc.ChannelCount)
+  {
+    DefaultLogSink().Error("Requested %u channels from a wav file with %u channel.", numChannels,
+                           m_ADesc.ChannelCount);
+    return RESULT_FAIL;
+  }
+  *bytesWritten = m_SampleSize * numChannels;
+  interleave_samples(buf, stride, m_ptr, m_ADesc.BlockAlign, *bytesWritten, numSamples);
+  m_ptr += *bytesWritten;
+  return RESULT_OK;
+}
+
 Result_t
 ASDCP::WAVDataProvider::ReadFrame()
 {
@@ -135,6 +193,25 @@ ASDCP::AtmosSyncDataProvider::PutSample(const ui32_t numChannels, byte_t* buf, u
   return RESULT_OK;
 }
 
+Result_t
+ASDCP::AtmosSyncDataProvider::PutFrame(const ui32_t numChannels, const ui32_t numSamples, byte_t* buf,
+                                       const ui32_t stride, ui32_t* bytesWritten)
+{
+  ASDCP_TEST_NULL(buf);
+  ASDCP_TEST_NULL(m_ptr);
+  if ( numChannels > m_ADesc.ChannelCount)
+  {
+    DefaultLogSink().Error("Requested %u channels from a wav file with %u channel.", numChannels,
+                           m_ADesc.ChannelCount);
+    return RESULT_FAIL;
+  }
+
+  (*bytesWritten) = m_SampleSize;
+  interleave_samples(buf, stride, m_ptr, m_SampleSize, m_SampleSize, numSamples);
+  m_ptr += m_SampleSize * numSamples;
+  return RESULT_OK;
+}
+
 Result_t
 ASDCP::AtmosSyncDataProvider::ReadFrame()
 {
@@ -188,6 +265,32 @@ ASDCP::SilenceDataProvider::PutSample(const ui32_t numChannels, byte_t* buf, ui3
   return RESULT_OK;
 }
 
+Result_t
+ASDCP::SilenceDataProvider::PutFrame(const ui32_t numChannels, const ui32_t numSamples, byte_t* buf,
+                                     const ui32_t stride, ui32_t* bytesWritten)
+{
+  ASDCP_TEST_NULL(buf);
+  if ( numChannels > m_ADesc.ChannelCount)
+  {
+    DefaultLogSink().Error("Requested %u channels from a wav file with %u channel.", numChannels,
+                           m_ADesc.ChannelCount);
+    return RESULT_FAIL;
+  }
+  (*bytesWritten) = m_SampleSize * numChannels;
+
+  if ( stride == (*bytesWritten) )
+    {
+      ::memset(buf, 0, (*bytesWritten) * numSamples);
+    }
+  else
+    {
+      for ( ui32_t i = 0; i < numSamples; ++i, buf += stride )
+	::memset(buf, 0, (*bytesWritten));
+    }
+
+  return RESULT_OK;
+}
+
 Result_t
 ASDCP::SilenceDataProvider::ReadFrame()
 {
@@ -47,6 +47,9 @@ namespace ASDCP
       PCMDataProviderInterface() {};
       virtual ~PCMDataProviderInterface() = 0;
       virtual Result_t PutSample(const ui32_t numChannels, byte_t* buf, ui32_t* bytesWritten) = 0;
+      // writes numSamples samples of numChannels channels, one every stride bytes of buf
+      virtual Result_t PutFrame(const ui32_t numChannels, const ui32_t numSamples, byte_t* buf,
+                                const ui32_t stride, ui32_t* bytesWritten) = 0;
       virtual Result_t ReadFrame() = 0;
       virtual Result_t FillAudioDescriptor(PCM::AudioDescriptor& ADesc) const = 0;
       virtual Result_t Reset() = 0;
@@ -66,6 +69,8 @@ namespace ASDCP
       WAVDataProvider();
       virtual ~WAVDataProvider();
       virtual Result_t PutSample(const ui32_t numChannels, byte_t* buf, ui32_t* bytesWritten);
+      virtual Result_t PutFrame(const ui32_t numChannels, const ui32_t numSamples, byte_t* buf,
+                                const ui32_t stride, ui32_t* bytesWritten);
       virtual Result_t ReadFrame();
       virtual Result_t FillAudioDescriptor(PCM::AudioDescriptor& ADesc) const;
       virtual Result_t Reset();
@@ -88,6 +93,8 @@ namespace ASDCP
                             const ASDCP::Rational& PictureRate, const byte_t* uuid);
       virtual ~AtmosSyncDataProvider();
       virtual Result_t PutSample(const ui32_t numChannels, byte_t* buf, ui32_t* bytesWritten);
+      virtual Result_t PutFrame(const ui32_t numChannels, const ui32_t numSamples, byte_t* buf,
+                                const ui32_t stride, ui32_t* bytesWritten);
       virtual Result_t ReadFrame();
       virtual Result_t FillAudioDescriptor(PCM::AudioDescriptor& ADesc) const;
       virtual Result_t Reset();
@@ -105,6 +112,8 @@ namespace ASDCP
                           const ui32_t sampleRate, const ASDCP::Rational& editRate);
       virtual ~SilenceDataProvider();
       virtual Result_t PutSample(const ui32_t numChannels, byte_t* buf, ui32_t* bytesWritten);
+      virtual Result_t PutFrame(const ui32_t numChannels, const ui32_t numSamples, byte_t* buf,
+                                const ui32_t stride, ui32_t* bytesWritten);
       virtual Result_t ReadFrame();
       virtual Result_t FillAudioDescriptor(PCM::AudioDescriptor& ADesc) const;
       virtual Result_t Reset();
@@ -246,6 +246,20 @@ ASDCP::PCMParserList::Reset()
   return result;
 }
 
+// Has every parser read its file in large blocks, with many mono channel
+// files this turns per-frame small reads into a few large ones per file.
+Result_t
+ASDCP::PCMParserList::EnableReadAhead(ui32_t seconds)
+{
+  Result_t result = RESULT_OK;
+  PCMParserList::iterator self_i;
+
+  for ( self_i = begin(); self_i != end() && ASDCP_SUCCESS(result) ; self_i++ )
+    result = (*self_i)->Parser.EnableReadAhead(seconds);
+
+  return result;
+}
+
 
 //
 Result_t
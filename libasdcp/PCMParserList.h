@@ -79,6 +79,7 @@ namespace ASDCP
       Result_t Reset();
       Result_t ReadFrame(PCM::FrameBuffer& OutFB);
       Result_t Seek(ui32_t frame_number);
+      Result_t EnableReadAhead(ui32_t seconds = 4);
     };
 }
 
@@ -50,9 +50,16 @@ class ASDCP::PCM::WAVParser::h__WAVParser
   ui32_t           m_DataStart;
   ui64_t           m_DataLength;
   ui64_t           m_ReadCount;
+  ui64_t           m_DataRead;       // bytes of the data chunk read from the file
   ui32_t           m_FrameBufferSize;
   ui32_t           m_FramesRead;
   Rational         m_PictureRate;
+  Kumu::ByteString m_ReadAhead;
+  ui32_t           m_ReadAheadPos;
+  bool             m_FileEOF;
+
+  Result_t FillReadAhead();
+  Result_t ReadData(byte_t* buf, ui32_t buf_len, ui32_t* read_count);
 
   ASDCP_NO_COPY_CONSTRUCT(h__WAVParser);
 
@@ -61,8 +68,8 @@ public:
 
 
   h__WAVParser() :
-    m_EOF(false), m_DataStart(0), m_DataLength(0), m_ReadCount(0),
-    m_FrameBufferSize(0), m_FramesRead(0) {}
+    m_EOF(false), m_DataStart(0), m_DataLength(0), m_ReadCount(0), m_DataRead(0),
+    m_FrameBufferSize(0), m_FramesRead(0), m_ReadAheadPos(0), m_FileEOF(false) {}
 
   ~h__WAVParser()
   {
@@ -74,6 +81,7 @@ public:
   void     Reset();
   Result_t ReadFrame(FrameBuffer&);
   Result_t Seek(ui32_t frame_number);
+  Result_t EnableReadAhead(ui32_t seconds);
 };
 
 
@@ -91,6 +99,74 @@ ASDCP::PCM::WAVParser::h__WAVParser::Reset()
   m_FileReader.Seek(m_DataStart);
   m_FramesRead = 0;
   m_ReadCount = 0;
+  m_DataRead = 0;
+  m_ReadAhead.Length(0);
+  m_ReadAheadPos = 0;
+  m_FileEOF = false;
+}
+
+// Reads seconds of audio per file read instead of one frame, so a list of
+// parsers over separate channel files does few large reads rather than one
+// small read per file for every frame.
+ASDCP::Result_t
+ASDCP::PCM::WAVParser::h__WAVParser::EnableReadAhead(ui32_t seconds)
+{
+  if ( m_FrameBufferSize == 0 )
+    return RESULT_STATE;
+
+  ui32_t frames = (ui32_t)ceil(m_ADesc.EditRate.Quotient() * seconds);
+
+  if ( frames < 2 )
+    return RESULT_OK;
+
+  Result_t result = m_ReadAhead.Capacity(frames * m_FrameBufferSize);
+
+  if ( ASDCP_SUCCESS(result) )
+    {
+      m_ReadAhead.Length(0);
+      m_ReadAheadPos = 0;
+    }
+
+  return result;
+}
+
+// Reads no further than the end of the data chunk. The 64 bit length of an
+// RF64 or BW64 file stays exact past 4 GB, and the chunks that follow the
+// audio are never read as samples.
+ASDCP::Result_t
+ASDCP::PCM::WAVParser::h__WAVParser::ReadData(byte_t* buf, ui32_t buf_len, ui32_t* read_count)
+{
+  *read_count = 0;
+
+  if ( m_DataRead >= m_DataLength )
+    return RESULT_ENDOFFILE;
+
+  ui32_t request = (ui32_t)Kumu::xmin((ui64_t)buf_len, m_DataLength - m_DataRead);
+  Result_t result = m_FileReader.Read(buf, request, read_count);
+  m_DataRead += *read_count;
+
+  if ( ASDCP_SUCCESS(result) && *read_count < buf_len )
+    result = RESULT_ENDOFFILE;
+
+  return result;
+}
+
+//
+ASDCP::Result_t
+ASDCP::PCM::WAVParser::h__WAVParser::FillReadAhead()
+{
+  ui32_t read_count = 0;
+  Result_t result = ReadData(m_ReadAhead.Data(), m_ReadAhead.Capacity(), &read_count);
+
+  if ( result == RESULT_ENDOFFILE )
+    {
+      m_FileEOF = true;
+      result = RESULT_OK;
+    }
+
+  m_ReadAhead.Length(ASDCP_SUCCESS(result) ? read_count : 0);
+  m_ReadAheadPos = 0;
+  return result;
 }
 
 //
@@ -170,7 +246,34 @@ ASDCP::PCM::WAVParser::h__WAVParser::ReadFrame(FrameBuffer& FB)
     }
 
   ui32_t read_count = 0;
-  Result_t result = m_FileReader.Read(FB.Data(), m_FrameBufferSize, &read_count);
+  Result_t result = RESULT_OK;
+
+  if ( m_ReadAhead.Capacity() > 0 )
+    {
+      while ( ASDCP_SUCCESS(result) && read_count < m_FrameBufferSize )
+	{
+	  if ( m_ReadAheadPos == m_ReadAhead.Length() )
+	    {
+	      if ( m_FileEOF )
+		break;
+
+	      result = FillReadAhead();
+	      continue;
+	    }
+
+	  ui32_t copy_count = Kumu::xmin(m_FrameBufferSize - read_count, m_ReadAhead.Length() - m_ReadAheadPos);
+	  memcpy(FB.Data() + read_count, m_ReadAhead.RoData() + m_ReadAheadPos, copy_count);
+	  m_ReadAheadPos += copy_count;
+	  read_count += copy_count;
+	}
+
+      if ( ASDCP_SUCCESS(result) && read_count < m_FrameBufferSize )
+	result = RESULT_ENDOFFILE;
+    }
+  else
+    {
+      result = ReadData(FB.Data(), m_FrameBufferSize, &read_count);
+    }
 
   if ( result == RESULT_ENDOFFILE )
     {
@@ -202,7 +305,12 @@ ASDCP::Result_t ASDCP::PCM::WAVParser::h__WAVParser::Seek(ui32_t frame_number)
 {
   m_FramesRead = frame_number - 1;
   m_ReadCount = 0;
-  return m_FileReader.Seek(m_DataStart + m_FrameBufferSize * frame_number);
+  m_DataRead = (ui64_t)m_FrameBufferSize * frame_number;
+  m_ReadAhead.Length(0);
+  m_ReadAheadPos = 0;
+  m_FileEOF = false;
+  m_EOF = false;
+  return m_FileReader.Seek(m_DataStart + (Kumu::fpos_t)m_DataRead);
 }
 
 
@@ -271,6 +379,16 @@ ASDCP::Result_t ASDCP::PCM::WAVParser::Seek(ui32_t frame_number) const
   return m_Parser->Seek(frame_number);;
 }
 
+//
+ASDCP::Result_t
+ASDCP::PCM::WAVParser::EnableReadAhead(ui32_t seconds) const
+{
+  if ( m_Parser.empty() )
+    return RESULT_INIT;
+
+  return m_Parser->EnableReadAhead(seconds);
+}
+
 //
 // end PCM_Parser.cpp
 //
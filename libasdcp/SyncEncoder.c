@@ -43,6 +43,11 @@ FLOAT SEWriteBits(	INT			iSampleRate,		/* In:	Sample rate of signal */
 					BYTE		*pbyData,			/* In:	Data to write */
 					FLOAT		fSymbolPhase);		/* In:	Symbol phase */
 
+FLOAT SEWriteSymbols(	BYTE		*pbySymbols,		/* Out: Symbol codes */
+						INT			iBits,				/* In:	Number of bits to write */
+						BYTE		*pbyData,			/* In:	Data to write */
+						FLOAT		fSymbolPhase);		/* In:	Symbol phase */
+
 
 
 INT SyncEncoderInit(LPSYNCENCODER		pSyncEncoder,	/* Out: SYNCENCODER structure to be initialized */
@@ -188,6 +193,49 @@ INT EncodeSync(	LPSYNCENCODER	pSyncEncoder,	/* In:	Sync encoder structure */
 	return pSyncEncoder->iError;
 }
 
+INT EncodeSyncSymbols(	LPSYNCENCODER	pSyncEncoder,	/* In:	Sync encoder structure */
+						INT				iBufferLength,	/* In:	Length of audio buffer */
+						BYTE			*pbySymbols,	/* Out: One symbol code per symbol of the buffer */
+						INT				iFrameIndex)	/* In:	Frame Index */
+{
+	INT		n;
+	INT		iSymbolIndex;
+
+
+	if(pSyncEncoder->iError != SYNC_ENCODER_ERROR_NONE){
+		return pSyncEncoder->iError;
+	}
+	if(iBufferLength != pSyncEncoder->iAudioBufferLength){
+		return SYNC_ENCODER_ERROR_INVALID_BL;
+	}
+
+	iSymbolIndex = 0;
+	for(n = 0; n < pSyncEncoder->iPacketsPerFrame; n ++){
+		/* Construct message */
+		ConstructFrame(pSyncEncoder,iFrameIndex);
+
+		/* Write Message */
+		pSyncEncoder->fSymbolPhase = SEWriteSymbols(&pbySymbols[iSymbolIndex],
+													pSyncEncoder->iPacketBits,
+													pSyncEncoder->abyPacket,
+													pSyncEncoder->fSymbolPhase);
+
+		iSymbolIndex += pSyncEncoder->iPacketBits;
+
+	}
+
+	return pSyncEncoder->iError;
+}
+
+INT GetSyncEncoderSymbolCount(LPSYNCENCODER pSyncEncoder)	/* In: Sync encoder structure */
+{
+	if(pSyncEncoder->iError != SYNC_ENCODER_ERROR_NONE){
+		return pSyncEncoder->iError;
+	}
+
+	return pSyncEncoder->iPacketBits * pSyncEncoder->iPacketsPerFrame;
+}
+
 void ConstructFrame(LPSYNCENCODER	pSyncEncoder,
 					INT				iFrameIndex)
 {
@@ -280,6 +328,37 @@ static FLOAT g_afSymbol1_96[SYMBOL_LENGTH_96] = {
 /* Symbol gain */
 static FLOAT g_fGain = 0.1f;
 
+INT GetSyncEncoderSymbol(	LPSYNCENCODER	pSyncEncoder,	/* In:	Sync encoder structure */
+							INT				iSymbol,		/* In:	Symbol code */
+							FLOAT			*pfAudioBuffer)	/* Out: iSymbolLength samples of the symbol */
+{
+	INT		k;
+	FLOAT	*pfSymbol;
+	FLOAT	fSymbolPhase;
+
+	if(pSyncEncoder->iError != SYNC_ENCODER_ERROR_NONE){
+		return pSyncEncoder->iError;
+	}
+
+	if(pSyncEncoder->iSampleRate == 48000){
+		pfSymbol = (iSymbol & SYNC_SYMBOL_ONE) ? g_afSymbol1_48 : g_afSymbol0_48;
+	}
+	else{
+		pfSymbol = (iSymbol & SYNC_SYMBOL_ONE) ? g_afSymbol1_96 : g_afSymbol0_96;
+	}
+
+	fSymbolPhase = (iSymbol & SYNC_SYMBOL_NEGATIVE) ? -1.0f : 1.0f;
+
+	/* Same arithmetic as SEWriteBits so the samples are identical */
+	for(k = 0; k < pSyncEncoder->iSymbolLength; k ++){
+		*pfAudioBuffer =  *pfSymbol * fSymbolPhase * g_fGain;
+		pfAudioBuffer ++;
+		pfSymbol ++;
+	}
+
+	return pSyncEncoder->iSymbolLength;
+}
+
 FLOAT SEWriteBits(	INT			iSampleRate,		/* In:	Sample rate of signal */
 					FLOAT		*pfAudioBuffer,		/* Out: Audio buffer containing signal */
 					INT			iBits,				/* In:	Number of bits to write */
@@ -344,3 +423,39 @@ FLOAT SEWriteBits(	INT			iSampleRate,		/* In:	Sample rate of signal */
 
 	return fSymbolPhase;
 }
+
+FLOAT SEWriteSymbols(	BYTE		*pbySymbols,		/* Out: Symbol codes */
+						INT			iBits,				/* In:	Number of bits to write */
+						BYTE		*pbyData,			/* In:	Data to write */
+						FLOAT		fSymbolPhase)		/* In:	Symbol phase */
+{
+	INT		n;
+	INT		i;
+	BYTE	byByte;
+
+	/* Write bits */
+	n = 0;
+	i = 0;
+	while(n < iBits){
+
+		/* Grab next byte of data */
+		if(i == 0){
+			byByte = *pbyData;
+			pbyData ++;
+		}
+
+		*pbySymbols = (BYTE)(((byByte & 0x80) ? SYNC_SYMBOL_ONE : 0) | ((fSymbolPhase < 0.0f) ? SYNC_SYMBOL_NEGATIVE : 0));
+		pbySymbols ++;
+
+		fSymbolPhase *= (byByte & 0x80) ? 1.0f : -1.0f;
+
+		byByte <<= 1;
+
+		n ++;
+
+		i ++;
+		i &= 0x7;
+	}
+
+	return fSymbolPhase;
+}
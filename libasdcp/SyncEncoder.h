@@ -78,6 +78,24 @@ INT EncodeSync(	LPSYNCENCODER	pSyncEncoder,	/* In:	Sync encoder structure */
 				FLOAT			*pfAudioBuffer,	/* Out: Audio buffer with signal */
 				INT				iFrameIndex);	/* In:	Frame Index */
 
+/* Symbol codes written by EncodeSyncSymbols */
+enum{
+	SYNC_SYMBOL_ONE = 1,					/* Symbol carries a one bit */
+	SYNC_SYMBOL_NEGATIVE = 2,				/* Symbol is written with negative phase */
+	SYNC_SYMBOL_CODES = 4,					/* Number of distinct symbol codes */
+};
+
+INT GetSyncEncoderSymbolCount(LPSYNCENCODER pSyncEncoder);
+
+INT GetSyncEncoderSymbol(	LPSYNCENCODER	pSyncEncoder,	/* In:	Sync encoder structure */
+							INT				iSymbol,		/* In:	Symbol code */
+							FLOAT			*pfAudioBuffer);/* Out: iSymbolLength samples of the symbol */
+
+INT EncodeSyncSymbols(	LPSYNCENCODER	pSyncEncoder,	/* In:	Sync encoder structure */
+						INT				iBufferLength,	/* In:	Length of audio buffer */
+						BYTE			*pbySymbols,	/* Out: One symbol code per symbol of the buffer */
+						INT				iFrameIndex);	/* In:	Frame Index */
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -33,6 +33,12 @@ THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "AS_DCP_internal.h"
 #include "S12MTimecode.h"
 #include "KM_xml.h"
+#include <deque>
+#include <vector>
+
+#ifdef HAVE_EXPAT
+#include <expat.h>
+#endif
 
 using namespace Kumu;
 using namespace ASDCP;
@@ -41,25 +47,88 @@ using Kumu::DefaultLogSink;
 
 const char* c_dcst_namespace_name = "http://www.smpte-ra.org/schemas/428-7/2007/DCST";
 
+// image subtitle documents can be large, the whole text is kept for ReadTimedTextResource()
+const ui32_t c_max_subtitle_document_size = 64 * Kumu::Megabyte;
+
 //------------------------------------------------------------------------------------------
 
 
 ASDCP::TimedText::LocalFilenameResolver::LocalFilenameResolver() {}
 ASDCP::TimedText::LocalFilenameResolver::~LocalFilenameResolver() {}
 
+// true if the 36 characters at p are a UUID formatted the way UUID::EncodeHex() writes them
+static bool
+is_uuid_text(const char* p)
+{
+  for ( ui32_t i = 0; i < 36; i++ )
+    {
+      if ( i == 8 || i == 13 || i == 18 || i == 23 )
+	{
+	  if ( p[i] != '-' )
+	    return false;
+	}
+      else if ( ! ( ( p[i] >= '0' && p[i] <= '9' ) || ( p[i] >= 'a' && p[i] <= 'f' ) ) )
+	{
+	  return false;
+	}
+    }
+
+  return true;
+}
+
+// Records every UUID found in the names of the files below dirname. Hidden files are
+// skipped and subdirectories are searched, the same files FindInPath() would visit.
+void
+ASDCP::TimedText::LocalFilenameResolver::IndexPath(const std::string& dirname)
+{
+  char name_buf[MaxFilePath];
+  DirScanner Dir;
+
+  if ( KM_FAILURE(Dir.Open(dirname.c_str())) )
+    return;
+
+  while ( KM_SUCCESS(Dir.GetNext(name_buf)) )
+    {
+      if ( name_buf[0] == '.' ) continue; // no hidden files
+      std::string tmp_path = dirname + '/' + name_buf;
+
+      if ( PathIsDirectory(tmp_path.c_str()) )
+	{
+	  IndexPath(tmp_path);
+	  continue;
+	}
+
+      ui32_t name_len = strlen(name_buf);
+
+      for ( ui32_t i = 0; i + 36 <= name_len; i++ )
+	{
+	  if ( is_uuid_text(name_buf + i) )
+	    m_Index.insert(std::multimap<std::string, std::string>::value_type(std::string(name_buf + i, 36), tmp_path));
+	}
+    }
+}
+
 //
 Result_t
 ASDCP::TimedText::LocalFilenameResolver::OpenRead(const std::string& dirname)
 {
+  Result_t result = RESULT_OK;
+  m_Index.clear();
+
   if ( PathIsDirectory(dirname) )
     {
       m_Dirname = dirname;
-      return RESULT_OK;
+    }
+  else
+    {
+      DefaultLogSink().Error("Path '%s' is not a directory, defaulting to '.'\n", dirname.c_str());
+      m_Dirname = ".";
+      result = RESULT_FALSE;
     }
 
-  DefaultLogSink().Error("Path '%s' is not a directory, defaulting to '.'\n", dirname.c_str());
-  m_Dirname = ".";
-  return RESULT_FALSE;
+  // one directory scan serves every resource, image subtitles can have thousands
+  IndexPath(m_Dirname);
+  return result;
 }
 
 //
@@ -69,19 +138,17 @@ ASDCP::TimedText::LocalFilenameResolver::ResolveRID(const byte_t* uuid, TimedTex
   Result_t result = RESULT_NOT_FOUND;
   char buf[64];
   UUID RID(uuid);
-  PathList_t found_list;
+  RID.EncodeHex(buf, 64);
 
-#ifndef KM_WIN32
-  // TODO, fix this for win32 (needs regex)
-  FindInPath(PathMatchRegex(RID.EncodeHex(buf, 64)), m_Dirname, found_list);
-#endif
+  ui32_t match_count = m_Index.count(buf);
 
-  if ( found_list.size() == 1 )
+  if ( match_count == 1 )
     {
+      const std::string& path = (*m_Index.find(buf)).second;
       FileReader Reader;
-      DefaultLogSink().Debug("Retrieving resource %s from file %s\n", buf, found_list.front().c_str());
+      DefaultLogSink().Debug("Retrieving resource %s from file %s\n", buf, path.c_str());
 
-      result = Reader.OpenRead(found_list.front().c_str());
+      result = Reader.OpenRead(path.c_str());
 
       if ( KM_SUCCESS(result) )
 	{
@@ -95,7 +162,7 @@ ASDCP::TimedText::LocalFilenameResolver::ResolveRID(const byte_t* uuid, TimedTex
 	    FrameBuf.Size(read_count);
 	}
     }
-  else if ( ! found_list.empty() )
+  else if ( match_count > 1 )
     {
       DefaultLogSink().Error("More than one file in %s matches %s.\n", m_Dirname.c_str(), buf);
       result = RESULT_RAW_FORMAT;
@@ -108,9 +175,23 @@ ASDCP::TimedText::LocalFilenameResolver::ResolveRID(const byte_t* uuid, TimedTex
 
 typedef std::map<Kumu::UUID, TimedText::MIMEType_t> ResourceTypeMap_t;
 
+// The parts of a subtitle document that OpenRead() needs to fill the descriptor.
+struct SubtitleDocumentInfo
+{
+  bool HasNamespace, HasId, HasEditRate, HasStartTime;
+  std::string NamespaceName;
+  std::string Id;        // bodies of the first of each of these children of the root
+  std::string EditRate;
+  std::string StartTime;
+  std::deque<std::string> FontIDs;   // LoadFont bodies, anywhere in the document
+  std::deque<std::string> ImageIDs;  // Image bodies, anywhere in the document
+  std::deque<std::string> TimeOuts;  // TimeOut attribute of every Subtitle element
+
+  SubtitleDocumentInfo() : HasNamespace(false), HasId(false), HasEditRate(false), HasStartTime(false) {}
+};
+
 class ASDCP::TimedText::DCSubtitleParser::h__SubtitleParser
 {
-  XMLElement  m_Root;
   ResourceTypeMap_t m_ResourceTypes;
   Result_t OpenRead();
 
@@ -122,7 +203,7 @@ public:
   TimedTextDescriptor  m_TDesc;
   mem_ptr<LocalFilenameResolver> m_DefaultResolver;
 
-  h__SubtitleParser() : m_Root("**ParserRoot**")
+  h__SubtitleParser()
   {
     memset(&m_TDesc.AssetID, 0, UUIDlen);
   }
@@ -147,14 +228,21 @@ public:
 
 //
 bool
-get_UUID_from_element(XMLElement* Element, UUID& ID)
+get_UUID_from_text(const std::string& Body, UUID& ID)
 {
-  assert(Element);
-  const char* p = Element->GetBody().c_str();
+  const char* p = Body.c_str();
   if ( strncmp(p, "urn:uuid:", 9) == 0 )    p += 9;
   return ID.DecodeHex(p);
 }
 
+//
+bool
+get_UUID_from_element(XMLElement* Element, UUID& ID)
+{
+  assert(Element);
+  return get_UUID_from_text(Element->GetBody(), ID);
+}
+
 //
 bool
 get_UUID_from_child_element(const char* name, XMLElement* Parent, UUID& outID)
@@ -165,11 +253,206 @@ get_UUID_from_child_element(const char* name, XMLElement* Parent, UUID& outID)
   return get_UUID_from_element(Child, outID);
 }
 
+#ifdef HAVE_EXPAT
+
+// Image subtitle documents can have many thousands of elements. Rather than
+// building an XMLElement tree, one expat pass keeps only the element bodies
+// and attributes listed in SubtitleDocumentInfo.
+//
+class SubtitleScanContext
+{
+  KM_NO_COPY_CONSTRUCT(SubtitleScanContext);
+  SubtitleScanContext();
+
+public:
+  SubtitleDocumentInfo& Info;
+  std::vector<std::string*> Scope; // per open element, the Info string its text goes to, or 0
+
+  SubtitleScanContext(SubtitleDocumentInfo& info) : Info(info) {}
+};
+
+//
+static void
+ssc_start(void* p, const XML_Char* name, const XML_Char** attrs)
+{
+  assert(p);  assert(name);  assert(attrs);
+  SubtitleScanContext* Ctx = (SubtitleScanContext*)p;
+  SubtitleDocumentInfo& Info = Ctx->Info;
+  std::string* Body = 0;
+
+  const char* local_name = strchr(name, '|');
+  if ( local_name != 0 )
+    local_name++;
+  else
+    local_name = name;
+
+  if ( Ctx->Scope.empty() )
+    {
+      if ( local_name != name )
+	{
+	  Info.HasNamespace = true;
+	  Info.NamespaceName.assign(name, local_name - name - 1);
+	}
+    }
+  else if ( strcmp(local_name, "LoadFont") == 0 )
+    {
+      Info.FontIDs.push_back(std::string());
+      Body = &Info.FontIDs.back();
+    }
+  else if ( strcmp(local_name, "Image") == 0 )
+    {
+      Info.ImageIDs.push_back(std::string());
+      Body = &Info.ImageIDs.back();
+    }
+  else if ( strcmp(local_name, "Subtitle") == 0 )
+    {
+      Info.TimeOuts.push_back(std::string());
+
+      for ( int i = 0; attrs[i] != 0; i += 2 )
+	{
+	  const char* attr_name = strchr(attrs[i], '|');
+	  attr_name = ( attr_name == 0 ) ? attrs[i] : attr_name + 1;
+
+	  if ( strcmp(attr_name, "TimeOut") == 0 )
+	    Info.TimeOuts.back() = attrs[i+1];
+	}
+    }
+  else if ( Ctx->Scope.size() == 1 )
+    {
+      if ( ! Info.HasId && strcmp(local_name, "Id") == 0 )
+	{
+	  Info.HasId = true;
+	  Body = &Info.Id;
+	}
+      else if ( ! Info.HasEditRate && strcmp(local_name, "EditRate") == 0 )
+	{
+	  Info.HasEditRate = true;
+	  Body = &Info.EditRate;
+	}
+      else if ( ! Info.HasStartTime && strcmp(local_name, "StartTime") == 0 )
+	{
+	  Info.HasStartTime = true;
+	  Body = &Info.StartTime;
+	}
+    }
+
+  Ctx->Scope.push_back(Body);
+}
+
+//
+static void
+ssc_end(void* p, const XML_Char* name)
+{
+  assert(p);  assert(name);
+  SubtitleScanContext* Ctx = (SubtitleScanContext*)p;
+  Ctx->Scope.pop_back();
+}
+
+//
+static void
+ssc_char(void* p, const XML_Char* data, int len)
+{
+  assert(p);  assert(data);
+  SubtitleScanContext* Ctx = (SubtitleScanContext*)p;
+
+  if ( len > 0 && ! Ctx->Scope.empty() && Ctx->Scope.back() != 0 )
+    Ctx->Scope.back()->append(data, len);
+}
+
+//
+static bool
+scan_subtitle_document(const std::string& xml_doc, SubtitleDocumentInfo& Info)
+{
+  if ( xml_doc.empty() )
+    return false;
+
+  XML_Parser Parser = XML_ParserCreateNS("UTF-8", '|');
+
+  if ( Parser == 0 )
+    {
+      DefaultLogSink().Error("Error allocating memory for XML parser.\n");
+      return false;
+    }
+
+  SubtitleScanContext Ctx(Info);
+  XML_SetUserData(Parser, (void*)&Ctx);
+  XML_SetElementHandler(Parser, ssc_start, ssc_end);
+  XML_SetCharacterDataHandler(Parser, ssc_char);
+
+  if ( ! XML_Parse(Parser, xml_doc.c_str(), xml_doc.size(), 1) )
+    {
+      DefaultLogSink().Error("XML Parse error on line %d: %s\n",
+			     XML_GetCurrentLineNumber(Parser),
+			     XML_ErrorString(XML_GetErrorCode(Parser)));
+      XML_ParserFree(Parser);
+      return false;
+    }
+
+  XML_ParserFree(Parser);
+  return true;
+}
+
+#else // HAVE_EXPAT
+
+// Without expat the document is parsed into an XMLElement tree and the
+// same fields are copied out of it.
+//
+static bool
+scan_subtitle_document(const std::string& xml_doc, SubtitleDocumentInfo& Info)
+{
+  XMLElement Root("**ParserRoot**");
+  ElementList List;
+  Elem_i i;
+
+  Root.EnableArena();
+
+  if ( ! Root.ParseString(xml_doc.c_str()) )
+    return false;
+
+  const XMLNamespace* ns = Root.Namespace();
+
+  if ( ns != 0 )
+    {
+      Info.HasNamespace = true;
+      Info.NamespaceName = ns->Name();
+    }
+
+  XMLElement* Child = Root.GetChildWithName("Id");
+  if ( ( Info.HasId = ( Child != 0 ) ) )  Info.Id = Child->GetBody();
+
+  Child = Root.GetChildWithName("EditRate");
+  if ( ( Info.HasEditRate = ( Child != 0 ) ) )  Info.EditRate = Child->GetBody();
+
+  Child = Root.GetChildWithName("StartTime");
+  if ( ( Info.HasStartTime = ( Child != 0 ) ) )  Info.StartTime = Child->GetBody();
+
+  Root.GetChildrenWithName("LoadFont", List);
+  for ( i = List.begin(); i != List.end(); i++ )
+    Info.FontIDs.push_back((*i)->GetBody());
+
+  List.clear();
+  Root.GetChildrenWithName("Image", List);
+  for ( i = List.begin(); i != List.end(); i++ )
+    Info.ImageIDs.push_back((*i)->GetBody());
+
+  List.clear();
+  Root.GetChildrenWithName("Subtitle", List);
+  for ( i = List.begin(); i != List.end(); i++ )
+    {
+      const char* TimeOut = (*i)->GetAttrWithName("TimeOut");
+      Info.TimeOuts.push_back(TimeOut == 0 ? "" : TimeOut);
+    }
+
+  return true;
+}
+
+#endif // HAVE_EXPAT
+
 //
 Result_t
 ASDCP::TimedText::DCSubtitleParser::h__SubtitleParser::OpenRead(const std::string& filename)
 {
-  Result_t result = ReadFileIntoString(filename, m_XMLDoc);
+  Result_t result = ReadFileIntoString(filename, m_XMLDoc, c_max_subtitle_document_size);
 
   if ( KM_SUCCESS(result) )
     result = OpenRead();
@@ -200,43 +483,44 @@ ASDCP::TimedText::DCSubtitleParser::h__SubtitleParser::OpenRead(const std::strin
 Result_t
 ASDCP::TimedText::DCSubtitleParser::h__SubtitleParser::OpenRead()
 {
-  if ( ! m_Root.ParseString(m_XMLDoc.c_str()) )
+  SubtitleDocumentInfo Info;
+  std::deque<std::string>::const_iterator i;
+
+  if ( ! scan_subtitle_document(m_XMLDoc, Info) )
     return RESULT_FORMAT;
 
   m_TDesc.EncodingName = "UTF-8"; // the XML parser demands UTF-8
   m_TDesc.ResourceList.clear();
   m_TDesc.ContainerDuration = 0;
-  const XMLNamespace* ns = m_Root.Namespace();
 
-  if ( ns == 0 )
+  if ( ! Info.HasNamespace )
     {
       DefaultLogSink(). Warn("Document has no namespace name, assuming \"%s\".\n", c_dcst_namespace_name);
       m_TDesc.NamespaceName = c_dcst_namespace_name;
     }
   else
     {
-      m_TDesc.NamespaceName = ns->Name();
+      m_TDesc.NamespaceName = Info.NamespaceName;
     }
 
   UUID DocID;
-  if ( ! get_UUID_from_child_element("Id", &m_Root, DocID) )
+  if ( ! Info.HasId || ! get_UUID_from_text(Info.Id, DocID) )
     {
       DefaultLogSink(). Error("Id element missing from input document.\n");
       return RESULT_FORMAT;
     }
 
   memcpy(m_TDesc.AssetID, DocID.Value(), DocID.Size());
-  XMLElement* EditRate = m_Root.GetChildWithName("EditRate");
 
-  if ( EditRate == 0 )
+  if ( ! Info.HasEditRate )
     {
       DefaultLogSink().Error("EditRate element missing from input document.\n");
       return RESULT_FORMAT;
     }
 
-  if ( ! DecodeRational(EditRate->GetBody().c_str(), m_TDesc.EditRate) )
+  if ( ! DecodeRational(Info.EditRate.c_str(), m_TDesc.EditRate) )
     {
-      DefaultLogSink().Error("Error decoding edit rate value: \"%s\"\n", EditRate->GetBody().c_str());
+      DefaultLogSink().Error("Error decoding edit rate value: \"%s\"\n", Info.EditRate.c_str());
       return RESULT_FORMAT;
     }
 
@@ -260,13 +544,10 @@ ASDCP::TimedText::DCSubtitleParser::h__SubtitleParser::OpenRead()
     }
 
   // list of fonts
-  ElementList FontList;
-  m_Root.GetChildrenWithName("LoadFont", FontList);
-
-  for ( Elem_i i = FontList.begin(); i != FontList.end(); i++ )
+  for ( i = Info.FontIDs.begin(); i != Info.FontIDs.end(); i++ )
     {
       UUID AssetID;
-      if ( ! get_UUID_from_element(*i, AssetID) )
+      if ( ! get_UUID_from_text(*i, AssetID) )
 	{
 	  DefaultLogSink(). Error("LoadFont element does not contain a urn:uuid value as expected.\n");
 	  return RESULT_FORMAT;
@@ -280,14 +561,12 @@ ASDCP::TimedText::DCSubtitleParser::h__SubtitleParser::OpenRead()
     }
 
   // list of images
-  ElementList ImageList;
-  m_Root.GetChildrenWithName("Image", ImageList);
   std::set<Kumu::UUID> visited_items;
 
-  for ( Elem_i i = ImageList.begin(); i != ImageList.end(); i++ )
+  for ( i = Info.ImageIDs.begin(); i != Info.ImageIDs.end(); i++ )
     {
       UUID AssetID;
-      if ( ! get_UUID_from_element(*i, AssetID) )
+      if ( ! get_UUID_from_text(*i, AssetID) )
 	{
 	  DefaultLogSink(). Error("Image element does not contain a urn:uuid value as expected.\n");
 	  return RESULT_FORMAT;
@@ -309,13 +588,9 @@ ASDCP::TimedText::DCSubtitleParser::h__SubtitleParser::OpenRead()
   // the last instance to be displayed, e.g., element n and element n-1 may have the
   // same start time but n-1 may have a greater duration making it the last to be seen.
   // We must scan the list to accumulate the latest TimeOut value.
-  ElementList InstanceList;
-  ElementList::const_iterator ei;
   ui32_t end_count = 0;
-  
-  m_Root.GetChildrenWithName("Subtitle", InstanceList);
 
-  if ( InstanceList.empty() )
+  if ( Info.TimeOuts.empty() )
     {
       DefaultLogSink(). Error("XML document contains no Subtitle elements.\n");
       return RESULT_FORMAT;
@@ -326,14 +601,13 @@ ASDCP::TimedText::DCSubtitleParser::h__SubtitleParser::OpenRead()
 
   S12MTimecode beginTC;
   beginTC.SetFPS(TCFrameRate);
-  XMLElement* StartTime = m_Root.GetChildWithName("StartTime");
 
-  if ( StartTime != 0 )
-    beginTC.DecodeString(StartTime->GetBody());
+  if ( Info.HasStartTime )
+    beginTC.DecodeString(Info.StartTime);
 
-  for ( ei = InstanceList.begin(); ei != InstanceList.end(); ei++ )
+  for ( i = Info.TimeOuts.begin(); i != Info.TimeOuts.end(); i++ )
     {
-      S12MTimecode tmpTC((*ei)->GetAttrWithName("TimeOut"), TCFrameRate);
+      S12MTimecode tmpTC(*i, TCFrameRate);
       if ( end_count < tmpTC.GetFrames() )
 	end_count = tmpTC.GetFrames();
     }
@@ -349,7 +623,6 @@ ASDCP::TimedText::DCSubtitleParser::h__SubtitleParser::OpenRead()
   return RESULT_OK;
 }
 
-
 //
 Result_t
 ASDCP::TimedText::DCSubtitleParser::h__SubtitleParser::ReadAncillaryResource(const byte_t* uuid, FrameBuffer& FrameBuf,
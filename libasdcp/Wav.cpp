@@ -513,9 +513,9 @@ ASDCP::RF64::SimpleRF64Header::ReadFromBuffer(const byte_t* buf, ui32_t buf_len,
     const byte_t* end_p = p + buf_len;
 
     fourcc test_RF64(p); p += 4;
-    if ( test_RF64 != FCC_RF64 )
+    if ( test_RF64 != FCC_RF64 && test_RF64 != FCC_BW64 )
     {
-        DefaultLogSink().Debug("File does not begin with RF64 header\n");
+        DefaultLogSink().Debug("File does not begin with RF64 or BW64 header\n");
         return RESULT_RAW_FORMAT;
     }
 
@@ -535,22 +535,36 @@ ASDCP::RF64::SimpleRF64Header::ReadFromBuffer(const byte_t* buf, ui32_t buf_len,
         return RESULT_RAW_FORMAT;
     }
     ui32_t ds64_len = KM_i32_LE(*(ui32_t*)p); p += 4;
+    if ( ds64_len < 16 || ds64_len > buf_len - 20 )
+    {
+        DefaultLogSink().Error("Invalid ds64 chunk size %u\n", ds64_len);
+        return RESULT_RAW_FORMAT;
+    }
+
     ui64_t RIFF_len = ((tmp_len == MAX_RIFF_LEN) ? KM_i64_LE(*(ui64_t*)p) : tmp_len); p += 8;
     data_len = KM_i64_LE(*(ui64_t*)p); p += 8;
     p += (ds64_len - 16); // skip rest of ds64 chunk
 
+    if ( data_len > RIFF_len )
+    {
+        DefaultLogSink().Error("Data size %llu larger than file: %llu\n", data_len, RIFF_len);
+        return RESULT_RAW_FORMAT;
+    }
+
     fourcc test_fcc;
 
-    while ( p < end_p )
+    // the data chunk is the last one read, the 64 bit sizes of ds64 let
+    // the chunks after it (axml, chna in BW64) sit past the 4 GB mark
+    while ( p + 8 <= end_p )
     {
         test_fcc = fourcc(p); p += 4;
         ui32_t chunk_size = KM_i32_LE(*(ui32_t*)p); p += 4;
 
         if ( test_fcc == Wav::FCC_data )
         {
-            if ( chunk_size > RIFF_len )
+            if ( chunk_size != MAX_RIFF_LEN && chunk_size > RIFF_len )
             {
-                DefaultLogSink().Error("Chunk size %u larger than file: %u\n", chunk_size, RIFF_len);
+                DefaultLogSink().Error("Chunk size %u larger than file: %llu\n", chunk_size, RIFF_len);
                 return RESULT_RAW_FORMAT;
             }
 
@@ -576,10 +590,11 @@ ASDCP::RF64::SimpleRF64Header::ReadFromBuffer(const byte_t* buf, ui32_t buf_len,
             blockalign = KM_i16_LE(*(ui16_t*)p); p += 2;
             bitspersample = KM_i16_LE(*(ui16_t*)p); p += 2;
             p += chunk_size - 16; // 16 is the number of bytes read in this block
+            p += chunk_size & 1;  // chunks are word aligned
         }
         else
         {
-            p += chunk_size;
+            p += chunk_size + (chunk_size & 1);
         }
     }
 
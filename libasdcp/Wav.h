@@ -122,6 +122,7 @@ namespace ASDCP
   namespace RF64
     {
       const fourcc FCC_RF64("RF64");
+      const fourcc FCC_BW64("BW64"); // ITU-R BS.2088, laid out as RF64
       const fourcc FCC_ds64("ds64");
 
 
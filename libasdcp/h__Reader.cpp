@@ -64,7 +64,8 @@ ASDCP::default_md_object_init()
 //
 
 //
-ASDCP::h__ASDCPReader::h__ASDCPReader(const Dictionary& d) : MXF::TrackFileReader<OP1aHeader, OPAtomIndexFooter>(d), m_BodyPart(m_Dict) {}
+ASDCP::h__ASDCPReader::h__ASDCPReader(const Dictionary& d) :
+  MXF::TrackFileReader<OP1aHeader, OPAtomIndexFooter>(d), m_MapTried(false), m_BodyPart(m_Dict) {}
 ASDCP::h__ASDCPReader::~h__ASDCPReader() {}
 
 
@@ -152,19 +153,443 @@ ASDCP::h__ASDCPReader::OpenMXFRead(const std::string& filename)
 	  m_IndexAccess.m_Lookup = &m_HeaderPart.m_Primer;
 	  result = m_IndexAccess.InitFromFile(m_File);
 	}
+
+      if ( ASDCP_SUCCESS(result) )
+	FlattenIndex();
     }
 
   m_File.Seek(m_HeaderPart.BodyOffset);
   return result;
 }
 
+// Copies the VBR index segments into one array of absolute frame positions.
+// A frame's size is the distance to the next frame or partition, the last
+// frame ends at the footer. Left empty for CBR indexes or anything unexpected, in which
+// case frames are located through the footer as before.
+void
+ASDCP::h__ASDCPReader::FlattenIndex()
+{
+  std::list<InterchangeObject*> segments;
+  std::list<InterchangeObject*>::iterator si;
+  std::vector<Kumu::fpos_t> offsets;
+  const Kumu::fpos_t unset = ~(Kumu::fpos_t)0;
+
+  m_FrameIndex.clear();
+
+  if ( KM_FAILURE(m_IndexAccess.GetMDObjectsByType(OBJ_TYPE_ARGS(IndexTableSegment), segments)) )
+    return;
+
+  for ( si = segments.begin(); si != segments.end(); ++si )
+    {
+      IndexTableSegment* segment = dynamic_cast<IndexTableSegment*>(*si);
+
+      if ( segment == 0 )
+	continue;
+
+      if ( segment->EditUnitByteCount > 0 )
+	return;
+
+      ui64_t count = Kumu::xmin(segment->IndexDuration, (ui64_t)segment->IndexEntryArray.size());
+      ui64_t end = segment->IndexStartPosition + count;
+
+      if ( end > 0xFFFFFFFFL )
+	return;
+
+      if ( end > offsets.size() )
+	offsets.resize((ui32_t)end, unset);
+
+      for ( ui64_t i = 0; i < count; ++i )
+	offsets[(ui32_t)(segment->IndexStartPosition + i)] = m_HeaderPart.BodyOffset + segment->IndexEntryArray[(ui32_t)i].StreamOffset;
+    }
+
+  if ( offsets.empty() )
+    return;
+
+  // partitions (generic stream data, body partitions) also end a frame
+  std::vector<Kumu::fpos_t> partitions;
+  RIP::const_pair_iterator pi;
+
+  for ( pi = m_RIP.PairArray.begin(); pi != m_RIP.PairArray.end(); ++pi )
+    partitions.push_back((*pi).ByteOffset);
+
+  partitions.push_back(m_HeaderPart.FooterPartition);
+  std::sort(partitions.begin(), partitions.end());
+
+  offsets.push_back(m_HeaderPart.FooterPartition);
+  m_FrameIndex.resize(offsets.size() - 1);
+
+  for ( ui32_t i = 0; i < m_FrameIndex.size(); ++i )
+    {
+      if ( offsets[i] == unset || offsets[i + 1] == unset )
+	{
+	  m_FrameIndex.clear();
+	  return;
+	}
+
+      Kumu::fpos_t end = offsets[i + 1];
+      std::vector<Kumu::fpos_t>::const_iterator next = std::upper_bound(partitions.begin(), partitions.end(), offsets[i]);
+
+      if ( next != partitions.end() && *next < end )
+	end = *next;
+
+      if ( end <= offsets[i] || end - offsets[i] > 0xFFFFFFFFL )
+	{
+	  m_FrameIndex.clear();
+	  return;
+	}
+
+      m_FrameIndex[i].Offset = offsets[i];
+      m_FrameIndex[i].Size = (ui32_t)(end - offsets[i]);
+    }
+}
+
+// Delivers a plaintext frame as a view into the mapped file. The file is
+// mapped the first time a buffer that allows views is read. Done is false,
+// and the buffer holds no view, when the frame must be read the usual way.
+// The view is taken at the frame's offset, the file position is not used.
+Result_t
+ASDCP::h__ASDCPReader::ReadFrameView(ui32_t FrameNum, ASDCP::FrameBuffer& FrameBuf, const byte_t* EssenceUL, bool& Done)
+{
+  Done = false;
+
+  {
+    Kumu::AutoMutex lock(m_FileLock);
+
+    if ( ! m_File.IsMapped() && ! m_MapTried )
+      {
+	m_MapTried = true;
+
+	if ( KM_FAILURE(m_File.Map()) )
+	  DefaultLogSink().Debug("Could not map the file, frames will be copied.\n");
+      }
+  }
+
+  FrameIndexEntry Span;
+  Result_t result = LocateSpan(FrameNum, Span);
+
+  if ( ASDCP_FAILURE(result) )
+    return result;
+
+  if ( ! m_File.IsMapped() )
+    return FrameBuf.IsView() ? FrameBuf.Capacity(Span.Size) : RESULT_OK;
+
+  const byte_t* view = 0;
+  ui32_t read_count = 0;
+  result = m_File.ReadViewAt(Span.Offset, &view, Span.Size, &read_count);
+
+  KLVPacket Packet;
+
+  if ( ASDCP_SUCCESS(result) && read_count >= SMPTE_UL_LENGTH + MXF_BER_LENGTH
+       && ASDCP_SUCCESS(Packet.InitFromBuffer(view, read_count))
+       && Packet.PacketLength() <= read_count && Packet.GetUL().MatchIgnoreStream(EssenceUL) )
+    {
+      FrameBuf.SetView(view + Packet.KLLength(), (ui32_t)Packet.ValueLength());
+      FrameBuf.FrameNumber(FrameNum);
+      FrameBuf.SourceLength(0);
+      FrameBuf.PlaintextOffset(0);
+      Done = true;
+      return RESULT_OK;
+    }
+
+  // anything unexpected is left to the copying path and its diagnostics
+  return FrameBuf.IsView() ? FrameBuf.Capacity(Span.Size) : RESULT_OK;
+}
+
 // AS-DCP method of reading a plaintext or encrypted frame
 Result_t
 ASDCP::h__ASDCPReader::ReadEKLVFrame(ui32_t FrameNum, ASDCP::FrameBuffer& FrameBuf,
 				     const byte_t* EssenceUL, AESDecContext* Ctx, HMACContext* HMAC)
 {
-  return ASDCP::MXF::TrackFileReader<OP1aHeader, OPAtomIndexFooter>::ReadEKLVFrame(m_HeaderPart.BodyOffset, FrameNum, FrameBuf,
-										     EssenceUL, Ctx, HMAC);
+  if ( FrameBuf.AllowView() && ! m_Info.EncryptedEssence )
+    {
+      bool done = false;
+      Result_t result = ReadFrameView(FrameNum, FrameBuf, EssenceUL, done);
+
+      if ( ASDCP_FAILURE(result) || done )
+	return result;
+    }
+  else if ( FrameBuf.IsView() )
+    {
+      FrameIndexEntry Span;
+      Result_t result = LocateSpan(FrameNum, Span);
+
+      if ( ASDCP_SUCCESS(result) )
+	result = FrameBuf.Capacity(Span.Size);
+
+      if ( ASDCP_FAILURE(result) )
+	return result;
+    }
+
+  if ( FrameNum >= m_FrameIndex.size()
+       || ( ! m_Info.EncryptedEssence && FrameBuf.Capacity() < m_FrameIndex[FrameNum].Size ) )
+    {
+      // the generic path seeks and reads through the shared position
+      Kumu::AutoMutex lock(m_FileLock);
+      return ASDCP::MXF::TrackFileReader<OP1aHeader, OPAtomIndexFooter>::ReadEKLVFrame(m_HeaderPart.BodyOffset, FrameNum, FrameBuf,
+											 EssenceUL, Ctx, HMAC);
+    }
+
+  // read the whole packet, key and length included, in one go and at its
+  // offset, so that threads sharing the reader do not contend for the file
+  // position. Plaintext goes straight into the caller's buffer.
+  const FrameIndexEntry& Entry = m_FrameIndex[FrameNum];
+
+  // a frame that is decrypted is read into its own buffer when it fits,
+  // otherwise into one of this call's
+  bool in_place = ! m_Info.EncryptedEssence
+    || ( Ctx != 0 && ! FrameBuf.IsView() && FrameBuf.Capacity() >= Entry.Size );
+  ASDCP::FrameBuffer CtFrameBuf;
+  ASDCP::FrameBuffer& ReadBuf = in_place ? FrameBuf : CtFrameBuf;
+  Result_t result = RESULT_OK;
+  ui32_t read_count = 0;
+
+  if ( ReadBuf.Capacity() < Entry.Size )
+    result = ReadBuf.Capacity(Entry.Size);
+
+  if ( ASDCP_SUCCESS(result) )
+    result = m_File.ReadAt(Entry.Offset, ReadBuf.Data(), Entry.Size, &read_count);
+
+  if ( ASDCP_FAILURE(result) )
+    return result;
+
+  if ( read_count < SMPTE_UL_LENGTH + MXF_BER_LENGTH )
+    return RESULT_READFAIL;
+
+  KLVPacket Packet;
+  result = Packet.InitFromBuffer(ReadBuf.RoData(), read_count);
+
+  if ( ASDCP_SUCCESS(result) && Packet.PacketLength() > read_count )
+    {
+      // the index spacing does not hold the packet, read it the usual way
+      Kumu::AutoMutex lock(m_FileLock);
+      m_LastPosition = Entry.Offset;
+      result = m_File.Seek(Entry.Offset);
+
+      if ( ASDCP_SUCCESS(result) )
+	result = ReadEKLVPacket(FrameNum, FrameNum + 1, FrameBuf, EssenceUL, Ctx, HMAC);
+
+      return result;
+    }
+
+  if ( ASDCP_SUCCESS(result) )
+    {
+      if ( m_Info.EncryptedEssence )
+	ReadBuf.Size((ui32_t)Packet.PacketLength());
+
+      result = Decode_EKLV_Value(*m_Dict, m_Info, Packet.GetUL(), ReadBuf.Data() + Packet.KLLength(),
+				 Packet.ValueLength(), FrameNum, FrameNum + 1, FrameBuf, EssenceUL, Ctx, HMAC);
+    }
+
+  return result;
+}
+
+// Finds the bytes from a frame's packet up to the next frame. Uses the
+// flattened index where there is one, otherwise the footer, ending the
+// frame at the next frame's position or at the footer partition.
+Result_t
+ASDCP::h__ASDCPReader::LocateSpan(ui32_t FrameNum, FrameIndexEntry& Span)
+{
+  if ( FrameNum < m_FrameIndex.size() )
+    {
+      Span = m_FrameIndex[FrameNum];
+      return RESULT_OK;
+    }
+
+  IndexTableSegment::IndexEntry TmpEntry;
+
+  if ( KM_FAILURE(m_IndexAccess.Lookup(FrameNum, TmpEntry)) )
+    {
+      DefaultLogSink().Error("Frame value out of range: %u\n", FrameNum);
+      return RESULT_RANGE;
+    }
+
+  Kumu::fpos_t begin = m_HeaderPart.BodyOffset + TmpEntry.StreamOffset;
+  Kumu::fpos_t end = m_HeaderPart.FooterPartition;
+
+  if ( KM_SUCCESS(m_IndexAccess.Lookup(FrameNum + 1, TmpEntry)) )
+    {
+      Kumu::fpos_t next = m_HeaderPart.BodyOffset + TmpEntry.StreamOffset;
+
+      if ( next < end )
+        end = next;
+    }
+
+  if ( end <= begin || end - begin > 0xFFFFFFFFL )
+    return RESULT_RANGE;
+
+  Span.Offset = begin;
+  Span.Size = (ui32_t)(end - begin);
+  return RESULT_OK;
+}
+
+// the key of a packet and the longest BER length
+static const ui32_t LeadingKLMax = SMPTE_UL_LENGTH + 9;
+
+// Reads the packet a frame's index entry points at and nothing after it,
+// the left eye of a stereoscopic frame, whose span holds the right eye too.
+// The key and length are read first and then the packet, both at their
+// offsets, so threads sharing the reader do not contend for the file
+// position. SequenceNum is the place of the packet in the track.
+Result_t
+ASDCP::h__ASDCPReader::ReadLeadingEKLVFrame(ui32_t FrameNum, ui32_t SequenceNum, ASDCP::FrameBuffer& FrameBuf,
+					    const byte_t* EssenceUL, AESDecContext* Ctx, HMACContext* HMAC)
+{
+  if ( FrameBuf.AllowView() && ! m_Info.EncryptedEssence )
+    {
+      bool done = false;
+      Result_t result = ReadFrameView(FrameNum, FrameBuf, EssenceUL, done);
+
+      if ( ASDCP_FAILURE(result) || done )
+	return result;
+    }
+
+  FrameIndexEntry Span;
+  byte_t kl[LeadingKLMax];
+  ui32_t read_count = 0;
+  Result_t result = LocateSpan(FrameNum, Span);
+
+  if ( ASDCP_SUCCESS(result) )
+    result = m_File.ReadAt(Span.Offset, kl, Kumu::xmin(Span.Size, LeadingKLMax), &read_count);
+
+  if ( ASDCP_FAILURE(result) )
+    return result;
+
+  if ( read_count < SMPTE_UL_LENGTH + MXF_BER_LENGTH )
+    return RESULT_READFAIL;
+
+  KLVPacket Packet;
+  result = Packet.InitFromBuffer(kl, read_count);
+
+  if ( ASDCP_SUCCESS(result) && Packet.PacketLength() > Span.Size )
+    {
+      DefaultLogSink().Error("Frame %u is larger than its index entry.\n", FrameNum);
+      result = RESULT_FORMAT;
+    }
+
+  if ( ASDCP_FAILURE(result) )
+    return result;
+
+  // as in ReadEKLVFrame, a frame that is decrypted is read into its own
+  // buffer when it fits, otherwise into one of this call's
+  ui32_t length = (ui32_t)Packet.PacketLength();
+  bool in_place = ! m_Info.EncryptedEssence
+    || ( Ctx != 0 && ! FrameBuf.IsView() && FrameBuf.Capacity() >= length );
+  ASDCP::FrameBuffer CtFrameBuf;
+  ASDCP::FrameBuffer& ReadBuf = in_place ? FrameBuf : CtFrameBuf;
+
+  if ( ReadBuf.IsView() || ReadBuf.Capacity() < length )
+    result = ReadBuf.Capacity(length);
+
+  if ( ASDCP_SUCCESS(result) )
+    result = m_File.ReadAt(Span.Offset, ReadBuf.Data(), length, &read_count);
+
+  if ( ASDCP_FAILURE(result) )
+    return result;
+
+  if ( read_count != length )
+    return RESULT_READFAIL;
+
+  if ( m_Info.EncryptedEssence )
+    ReadBuf.Size(length);
+
+  return Decode_EKLV_Value(*m_Dict, m_Info, Packet.GetUL(), ReadBuf.Data() + Packet.KLLength(),
+			   Packet.ValueLength(), FrameNum, SequenceNum, FrameBuf, EssenceUL, Ctx, HMAC);
+}
+
+// Reads a run of frames, adjacent frames are fetched with one read of up to
+// ReadFramesMaxSpan bytes and then split into the caller's buffers.
+static const ui32_t ReadFramesMaxSpan = 64 * 1024 * 1024;
+
+Result_t
+ASDCP::h__ASDCPReader::ReadEKLVFrames(ui32_t FrameNum, ui32_t FrameCount, ASDCP::FrameBuffer* const* FrameBufs,
+				      const byte_t* EssenceUL, AESDecContext* Ctx, HMACContext* HMAC)
+{
+  ASDCP_TEST_NULL(FrameBufs);
+  std::vector<FrameIndexEntry> spans;
+  Result_t result = RESULT_OK;
+  ui32_t i = 0;
+
+  // views are taken straight from the mapping, there is nothing to batch
+  if ( FrameCount > 0 && FrameBufs[0] != 0 && FrameBufs[0]->AllowView() && ! m_Info.EncryptedEssence )
+    {
+      for ( ; ASDCP_SUCCESS(result) && i < FrameCount; i++ )
+	{
+	  ASDCP_TEST_NULL(FrameBufs[i]);
+	  result = ReadEKLVFrame(FrameNum + i, *FrameBufs[i], EssenceUL, Ctx, HMAC);
+	}
+
+      return result;
+    }
+
+  while ( ASDCP_SUCCESS(result) && i < FrameCount )
+    {
+      // gather the frames that follow each other in the file
+      FrameIndexEntry Span;
+      spans.clear();
+      result = LocateSpan(FrameNum + i, Span);
+
+      if ( ASDCP_FAILURE(result) )
+	break;
+
+      Kumu::fpos_t begin = Span.Offset;
+      Kumu::fpos_t end = Span.Offset + Span.Size;
+      spans.push_back(Span);
+
+      while ( i + spans.size() < FrameCount
+	      && KM_SUCCESS(LocateSpan(FrameNum + i + spans.size(), Span))
+	      && Span.Offset == end && end + Span.Size - begin <= ReadFramesMaxSpan )
+	{
+	  end += Span.Size;
+	  spans.push_back(Span);
+	}
+
+      if ( spans.size() == 1 || end - begin > ReadFramesMaxSpan )
+	{
+	  ASDCP_TEST_NULL(FrameBufs[i]);
+	  result = ReadEKLVFrame(FrameNum + i, *FrameBufs[i], EssenceUL, Ctx, HMAC);
+	  i++;
+	  continue;
+	}
+
+      ui32_t span_length = (ui32_t)(end - begin);
+      ui32_t read_count = 0;
+
+      // the span buffer is shared, runs are read one at a time
+      Kumu::AutoMutex lock(m_FileLock);
+
+      if ( m_SpanBuf.Capacity() < span_length )
+	result = m_SpanBuf.Capacity(span_length);
+
+      if ( ASDCP_SUCCESS(result) )
+	result = m_File.ReadAt(begin, m_SpanBuf.Data(), span_length, &read_count);
+
+      if ( ASDCP_FAILURE(result) || read_count != span_length )
+	return ASDCP_FAILURE(result) ? result : RESULT_READFAIL;
+
+      for ( ui32_t k = 0; ASDCP_SUCCESS(result) && k < spans.size(); k++, i++ )
+	{
+	  ASDCP_TEST_NULL(FrameBufs[i]);
+	  byte_t* p = m_SpanBuf.Data() + (ui32_t)(spans[k].Offset - begin);
+	  KLVPacket Packet;
+
+	  if ( spans[k].Size < SMPTE_UL_LENGTH + MXF_BER_LENGTH )
+	    return RESULT_FORMAT;
+
+	  result = Packet.InitFromBuffer(p, spans[k].Size);
+
+	  if ( ASDCP_SUCCESS(result) && Packet.PacketLength() > spans[k].Size )
+	    {
+	      DefaultLogSink().Error("Frame %u is larger than its index entry.\n", FrameNum + i);
+	      result = RESULT_FORMAT;
+	    }
+
+	  if ( ASDCP_SUCCESS(result) )
+	    result = Decode_EKLV_Value(*m_Dict, m_Info, Packet.GetUL(), p + Packet.KLLength(), Packet.ValueLength(),
+				       FrameNum + i, FrameNum + i + 1, *FrameBufs[i], EssenceUL, Ctx, HMAC);
+	}
+    }
+
+  return result;
 }
 
 Result_t
@@ -265,11 +690,17 @@ ASDCP::Read_EKLV_Packet(Kumu::FileReader& File, const ASDCP::Dictionary& Dict,
 	  return RESULT_FORMAT;
 	}
 
-      // read encrypted triplet value into internal buffer
+      // read encrypted triplet value into internal buffer, or straight
+      // into the frame buffer when it is decrypted there
       assert(PacketLength <= 0xFFFFFFFFL);
-      CtFrameBuf.Capacity((ui32_t) PacketLength);
+      bool in_place = Ctx != 0 && ! FrameBuf.IsView() && FrameBuf.Capacity() >= PacketLength;
+      ASDCP::FrameBuffer& ReadBuf = in_place ? FrameBuf : CtFrameBuf;
+
+      if ( ! in_place )
+	CtFrameBuf.Capacity((ui32_t) PacketLength);
+
       ui32_t read_count;
-      result = File.Read(CtFrameBuf.Data(), (ui32_t) PacketLength, &read_count);
+      result = File.Read(ReadBuf.Data(), (ui32_t) PacketLength, &read_count);
 
       if ( ASDCP_FAILURE(result) )
 	return result;
@@ -280,10 +711,84 @@ ASDCP::Read_EKLV_Packet(Kumu::FileReader& File, const ASDCP::Dictionary& Dict,
           return RESULT_FORMAT;
         }
 
-      CtFrameBuf.Size((ui32_t) PacketLength);
+      ReadBuf.Size((ui32_t) PacketLength);
+
+      return Decode_EKLV_Value(Dict, Info, Key, ReadBuf.Data(), PacketLength, FrameNum, SequenceNum,
+			       FrameBuf, EssenceUL, Ctx, HMAC);
+    }
+  else if ( Key.MatchIgnoreStream(EssenceUL) ) // ignore the stream number
+    { // read plaintext frame
+       if ( FrameBuf.Capacity() < PacketLength )
+	{
+	  char intbuf[IntBufferLen];
+	  DefaultLogSink().Error("FrameBuf.Capacity: %u FrameLength: %s\n",
+				 FrameBuf.Capacity(), ui64sz(PacketLength, intbuf));
+	  return RESULT_SMALLBUF;
+	}
+
+      // read the data into the supplied buffer
+      ui32_t read_count;
+      assert(PacketLength <= 0xFFFFFFFFL);
+      result = File.Read(FrameBuf.Data(), (ui32_t) PacketLength, &read_count);
+	  
+      if ( ASDCP_FAILURE(result) )
+	return result;
+
+      if ( read_count != PacketLength )
+	{
+	  char intbuf1[IntBufferLen];
+	  char intbuf2[IntBufferLen];
+	  DefaultLogSink().Error("read_count: %s != FrameLength: %s\n",
+				 ui64sz(read_count, intbuf1),
+				 ui64sz(PacketLength, intbuf2) );
+	  
+	  return RESULT_READFAIL;
+	}
+
+      FrameBuf.FrameNumber(FrameNum);
+      FrameBuf.Size(read_count);
+    }
+  else
+    {
+      char strbuf[IntBufferLen];
+      const MDDEntry* Entry = Dict.FindULAnyVersion(Key.Value());
+
+      if ( Entry == 0 )
+	{
+	  DefaultLogSink().Warn("Unexpected Essence UL found: %s.\n", Key.EncodeString(strbuf, IntBufferLen));
+	}
+      else
+	{
+	  DefaultLogSink().Warn("Unexpected Essence UL found: %s.\n", Entry->name);
+	}
+
+      return RESULT_FORMAT;
+    }
+
+  return result;
+}
+
+
+// decodes a KLV packet value already in memory, Value holds the PacketLength
+// bytes that follow the key and length. A plaintext value is moved into
+// FrameBuf unless it is already there.
+Result_t
+ASDCP::Decode_EKLV_Value(const ASDCP::Dictionary& Dict, const ASDCP::WriterInfo& Info, const UL& Key,
+			 byte_t* Value, ui64_t PacketLength, ui32_t FrameNum, ui32_t SequenceNum,
+			 ASDCP::FrameBuffer& FrameBuf, const byte_t* EssenceUL, AESDecContext* Ctx, HMACContext* HMAC)
+{
+  Result_t result = RESULT_OK;
+
+  if ( Key.MatchIgnoreStream(Dict.ul(MDD_CryptEssence)) )  // ignore the stream numbers
+    {
+      if ( ! Info.EncryptedEssence )
+	{
+	  DefaultLogSink().Error("EKLV packet found, no Cryptographic Context in header.\n");
+	  return RESULT_FORMAT;
+	}
 
       // should be const but mxflib::ReadBER is not
-      byte_t* ess_p = CtFrameBuf.Data();
+      byte_t* ess_p = Value;
 
       // read context ID length
       if ( ! Kumu::read_test_BER(&ess_p, UUIDlen) )
@@ -361,23 +866,14 @@ ASDCP::Read_EKLV_Packet(Kumu::FileReader& File, const ASDCP::Dictionary& Dict,
 
       if ( Ctx )
 	{
-	  // wrap the pointer and length as a FrameBuffer for use by
-	  // DecryptFrameBuffer() and TestValues()
-	  FrameBuffer TmpWrapper;
-	  TmpWrapper.SetData(ess_p, tmp_len);
-	  TmpWrapper.Size(tmp_len);
-	  TmpWrapper.SourceLength(SourceLength);
-	  TmpWrapper.PlaintextOffset(PlaintextOffset);
-
-	  result = DecryptFrameBuffer(TmpWrapper, FrameBuf, Ctx);
+	  // the integrity pack is tested while decrypting, the value may be
+	  // in FrameBuf already and is overwritten by the plaintext
+	  result = DecryptAndTestESV(ess_p, tmp_len, SourceLength, PlaintextOffset, FrameBuf.Data(), Ctx,
+				     Info.AssetUUID, SequenceNum, Info.UsesHMAC ? HMAC : 0);
 	  FrameBuf.FrameNumber(FrameNum);
-  
-	  // detect and test integrity pack
-	  if ( ASDCP_SUCCESS(result) && Info.UsesHMAC && HMAC )
-	    {
-	      IntegrityPack IntPack;
-	      result = IntPack.TestValues(TmpWrapper, Info.AssetUUID, SequenceNum, HMAC);
-	    }
+
+	  if ( ASDCP_SUCCESS(result) )
+	    FrameBuf.Size(SourceLength);
 	}
       else // return ciphertext to caller
 	{
@@ -394,11 +890,19 @@ ASDCP::Read_EKLV_Packet(Kumu::FileReader& File, const ASDCP::Dictionary& Dict,
 	  FrameBuf.FrameNumber(FrameNum);
 	  FrameBuf.SourceLength(SourceLength);
 	  FrameBuf.PlaintextOffset(PlaintextOffset);
+
+	  // the MIC covers the ciphertext, so the integrity pack can be
+	  // tested without decrypting
+	  if ( Info.UsesHMAC && HMAC )
+	    {
+	      IntegrityPack IntPack;
+	      result = IntPack.TestValues(FrameBuf, Info.AssetUUID, SequenceNum, HMAC);
+	    }
 	}
     }
   else if ( Key.MatchIgnoreStream(EssenceUL) ) // ignore the stream number
-    { // read plaintext frame
-       if ( FrameBuf.Capacity() < PacketLength )
+    {
+      if ( FrameBuf.Capacity() < PacketLength )
 	{
 	  char intbuf[IntBufferLen];
 	  DefaultLogSink().Error("FrameBuf.Capacity: %u FrameLength: %s\n",
@@ -406,27 +910,11 @@ ASDCP::Read_EKLV_Packet(Kumu::FileReader& File, const ASDCP::Dictionary& Dict,
 	  return RESULT_SMALLBUF;
 	}
 
-      // read the data into the supplied buffer
-      ui32_t read_count;
-      assert(PacketLength <= 0xFFFFFFFFL);
-      result = File.Read(FrameBuf.Data(), (ui32_t) PacketLength, &read_count);
-	  
-      if ( ASDCP_FAILURE(result) )
-	return result;
-
-      if ( read_count != PacketLength )
-	{
-	  char intbuf1[IntBufferLen];
-	  char intbuf2[IntBufferLen];
-	  DefaultLogSink().Error("read_count: %s != FrameLength: %s\n",
-				 ui64sz(read_count, intbuf1),
-				 ui64sz(PacketLength, intbuf2) );
-	  
-	  return RESULT_READFAIL;
-	}
+      if ( Value != FrameBuf.Data() )
+	memmove(FrameBuf.Data(), Value, (ui32_t) PacketLength);
 
       FrameBuf.FrameNumber(FrameNum);
-      FrameBuf.Size(read_count);
+      FrameBuf.Size((ui32_t) PacketLength);
     }
   else
     {
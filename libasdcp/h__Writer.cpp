@@ -85,7 +85,7 @@ ASDCP::AddDMScrypt(Partition& HeaderPart, SourcePackage& Package,
 
 //
 ASDCP::h__ASDCPWriter::h__ASDCPWriter(const Dictionary& d) :
-  MXF::TrackFileWriter<OP1aHeader>(d), m_BodyPart(m_Dict), m_FooterPart(m_Dict) {}
+  MXF::TrackFileWriter<OP1aHeader>(d), m_BodyPart(m_Dict), m_FooterPart(m_Dict), m_SequenceBase(0) {}
 
 ASDCP::h__ASDCPWriter::~h__ASDCPWriter() {}
 
@@ -157,6 +157,11 @@ ASDCP::h__ASDCPWriter::WriteASDCPHeader(const std::string& PackageLabel, const U
   AddSourceClip(EditRate, EditRate, TCFrameRate, TrackName, EssenceUL, DataDefinition, PackageLabel);
   AddEssenceDescriptor(WrappingUL);
 
+  // what Finalize() sets is present from the start, so the header it writes
+  // again has the same length and fits the KLV fill reserved here
+  if ( m_EssenceDescriptor->ContainerDuration.empty() )
+    m_EssenceDescriptor->ContainerDuration = 0;
+
   Result_t result = m_HeaderPart.WriteToFile(m_File, m_HeaderSize);
 
   if ( KM_SUCCESS(result) )
@@ -168,10 +173,13 @@ ASDCP::h__ASDCPWriter::WriteASDCPHeader(const std::string& PackageLabel, const U
 //
 Result_t
 ASDCP::h__ASDCPWriter::WriteEKLVPacket(const ASDCP::FrameBuffer& FrameBuf,const byte_t* EssenceUL,
-				       AESEncContext* Ctx, HMACContext* HMAC)
+				       AESEncContext* Ctx, HMACContext* HMAC, const ASDCP::FrameBuffer* EncFrameBuf)
 {
-  return Write_EKLV_Packet(m_File, *m_Dict, m_HeaderPart, m_Info, m_CtFrameBuf, m_FramesWritten,
-			   m_StreamOffset, FrameBuf, EssenceUL, Ctx, HMAC);
+  // the frames of a file copied into another keep the sequence numbers they get there
+  ui32_t sequence = m_SequenceBase + m_FramesWritten;
+
+  return Write_EKLV_Packet(m_File, *m_Dict, m_HeaderPart, m_Info, m_CtFrameBuf, sequence,
+			   m_StreamOffset, FrameBuf, EssenceUL, Ctx, HMAC, EncFrameBuf);
 }
 
 // standard method of writing the header and footer of a completed MXF file
@@ -225,12 +233,112 @@ ASDCP::h__ASDCPWriter::WriteASDCPFooter()
 //
 
 
-// standard method of writing a plaintext or encrypted frame
+// the encrypted source value is made and written this many bytes at a time
+static const ui32_t ESVChunkSize = 64 * 1024;
+
+// add a chunk of the encrypted source value to the HMAC and write it
+static ASDCP::Result_t
+write_esv_chunk(Kumu::FileWriter& File, HMACContext* HMAC, const byte_t* chunk, ui32_t& length)
+{
+  if ( length == 0 )
+    return RESULT_OK;
+
+  if ( HMAC )
+    HMAC->Update(chunk, length);
+
+  ASDCP::Result_t result = File.Writev(chunk, length);
+
+  if ( ASDCP_SUCCESS(result) )
+    result = File.Writev();
+
+  length = 0;
+  return result;
+}
+
+// Encrypts FrameBuf as EncryptFrameBuffer() does, but a cache sized chunk at a
+// time: each chunk is encrypted into ChunkBuf, added to the HMAC (when given)
+// and written before the next, so the whole ciphertext is never held and read
+// back. HMAC must have been Reset().
+static ASDCP::Result_t
+write_encrypted_source_value(Kumu::FileWriter& File, const ASDCP::FrameBuffer& FrameBuf,
+			     ASDCP::FrameBuffer& ChunkBuf, AESEncContext* Ctx, HMACContext* HMAC)
+{
+  Result_t result = ChunkBuf.Capacity(ESVChunkSize);
+
+  if ( ASDCP_FAILURE(result) )
+    return result;
+
+  byte_t* chunk = ChunkBuf.Data();
+  const byte_t* src = FrameBuf.RoData();
+  ui32_t pto = FrameBuf.PlaintextOffset();
+  ui32_t ct_size = FrameBuf.Size() - pto;
+  ui32_t diff = ct_size % CBC_BLOCK_SIZE;
+  ui32_t block_size = ct_size - diff;
+  ui32_t length = 0;
+  ui32_t offset, n;
+
+  // write the IV and encrypt the check value
+  Ctx->GetIVec(chunk);
+  result = Ctx->EncryptBlock(ESV_CheckValue, chunk + CBC_BLOCK_SIZE, CBC_BLOCK_SIZE);
+  length = CBC_BLOCK_SIZE * 2;
+
+  // optional plaintext region
+  for ( offset = 0; ASDCP_SUCCESS(result) && offset < pto; offset += n )
+    {
+      if ( length == ESVChunkSize )
+	result = write_esv_chunk(File, HMAC, chunk, length);
+
+      n = std::min(pto - offset, ESVChunkSize - length);
+      memcpy(chunk + length, src + offset, n);
+      length += n;
+    }
+
+  // ciphertext region, whole blocks, the CBC chain carries over in Ctx
+  for ( offset = 0; ASDCP_SUCCESS(result) && offset < block_size; offset += n )
+    {
+      if ( ESVChunkSize - length < CBC_BLOCK_SIZE )
+	result = write_esv_chunk(File, HMAC, chunk, length);
+
+      if ( ASDCP_FAILURE(result) )
+	break;
+
+      n = std::min(block_size - offset, (ESVChunkSize - length) & ~(CBC_BLOCK_SIZE - 1));
+      result = Ctx->EncryptBlock(src + pto + offset, chunk + length, n);
+      length += n;
+    }
+
+  // construct and encrypt the padding
+  if ( ASDCP_SUCCESS(result) && ESVChunkSize - length < CBC_BLOCK_SIZE )
+    result = write_esv_chunk(File, HMAC, chunk, length);
+
+  if ( ASDCP_SUCCESS(result) )
+    {
+      byte_t the_last_block[CBC_BLOCK_SIZE];
+
+      if ( diff > 0 )
+	memcpy(the_last_block, src + pto + block_size, diff);
+
+      for (ui32_t i = 0; diff < CBC_BLOCK_SIZE; diff++, i++ )
+	the_last_block[diff] = i;
+
+      result = Ctx->EncryptBlock(the_last_block, chunk + length, CBC_BLOCK_SIZE);
+      length += CBC_BLOCK_SIZE;
+    }
+
+  if ( ASDCP_SUCCESS(result) )
+    result = write_esv_chunk(File, HMAC, chunk, length);
+
+  return result;
+}
+
+// standard method of writing a plaintext or encrypted frame. If EncFrameBuf is
+// given it holds FrameBuf already encrypted by EncryptFrameBuffer() and Ctx is
+// not used.
 Result_t
 ASDCP::Write_EKLV_Packet(Kumu::FileWriter& File, const ASDCP::Dictionary& Dict, const MXF::OP1aHeader& HeaderPart,
 			 const ASDCP::WriterInfo& Info, ASDCP::FrameBuffer& CtFrameBuf, ui32_t& FramesWritten,
 			 ui64_t & StreamOffset, const ASDCP::FrameBuffer& FrameBuf, const byte_t* EssenceUL,
-			 AESEncContext* Ctx, HMACContext* HMAC)
+			 AESEncContext* Ctx, HMACContext* HMAC, const ASDCP::FrameBuffer* EncFrameBuf)
 {
   Result_t result = RESULT_OK;
   IntegrityPack IntPack;
@@ -246,7 +354,7 @@ ASDCP::Write_EKLV_Packet(Kumu::FileWriter& File, const ASDCP::Dictionary& Dict,
 
   if ( Info.EncryptedEssence )
     {
-      if ( ! Ctx )
+      if ( ! Ctx && ! EncFrameBuf )
 	return RESULT_CRYPT_CTX;
 
       if ( Info.UsesHMAC && ! HMAC )
@@ -255,19 +363,23 @@ ASDCP::Write_EKLV_Packet(Kumu::FileWriter& File, const ASDCP::Dictionary& Dict,
       if ( FrameBuf.PlaintextOffset() > FrameBuf.Size() )
 	return RESULT_LARGE_PTO;
 
-      // encrypt the essence data (create encrypted source value)
-      result = EncryptFrameBuffer(FrameBuf, CtFrameBuf, Ctx);
+      // without EncFrameBuf the encrypted source value is made while it is written
+      const ASDCP::FrameBuffer* EncBuf = EncFrameBuf;
+      ui32_t ESVLength = EncBuf ? EncBuf->Size() : calc_esv_length(FrameBuf.Size(), FrameBuf.PlaintextOffset());
 
       // create HMAC
-      if ( ASDCP_SUCCESS(result) && Info.UsesHMAC )
-      	result = IntPack.CalcValues(CtFrameBuf, Info.AssetUUID, FramesWritten + 1, HMAC);
+      if ( EncBuf && Info.UsesHMAC )
+	{
+	  Kumu::TraceSpan span("hmac");
+	  result = IntPack.CalcValues(*EncBuf, Info.AssetUUID, FramesWritten + 1, HMAC);
+	}
 
       if ( ASDCP_SUCCESS(result) )
 	{ // write UL
 	  Overhead.WriteRaw(Dict.ul(MDD_CryptEssence), SMPTE_UL_LENGTH);
 
 	  // construct encrypted triplet header
-	  ui32_t ETLength = klv_cryptinfo_size + CtFrameBuf.Size();
+	  ui32_t ETLength = klv_cryptinfo_size + ESVLength;
 	  ui32_t BER_length = MXF_BER_LENGTH;
 
 	  if ( Info.UsesHMAC )
@@ -297,7 +409,7 @@ ASDCP::Write_EKLV_Packet(Kumu::FileWriter& File, const ASDCP::Dictionary& Dict,
 		       && Overhead.WriteRaw((byte_t*)EssenceUL, SMPTE_UL_LENGTH)    // write the essence UL
 		       && Overhead.WriteBER(sizeof(ui64_t), MXF_BER_LENGTH)         // write SourceLength length
 		       && Overhead.WriteUi64BE(FrameBuf.Size())                     // write SourceLength
-		       && Overhead.WriteBER(CtFrameBuf.Size(), BER_length) ) )    // write ESV length
+		       && Overhead.WriteBER(ESVLength, BER_length) ) )         // write ESV length
 		{
 		  result = RESULT_KLV_CODING;
 		}
@@ -310,13 +422,35 @@ ASDCP::Write_EKLV_Packet(Kumu::FileWriter& File, const ASDCP::Dictionary& Dict,
       if ( ASDCP_SUCCESS(result) )
 	{
 	  StreamOffset += Overhead.Length();
+
 	  // write encrypted source value
-	  result = File.Writev((byte_t*)CtFrameBuf.RoData(), CtFrameBuf.Size());
+	  if ( EncBuf )
+	    {
+	      result = File.Writev((byte_t*)EncBuf->RoData(), EncBuf->Size());
+	    }
+	  else
+	    {
+	      // the header goes out first, the value follows chunk by chunk
+	      result = File.Writev();
+
+	      if ( Info.UsesHMAC )
+		HMAC->Reset();
+
+	      if ( ASDCP_SUCCESS(result) )
+		{
+		  // the hmac is updated and the chunks written as they are encrypted
+		  Kumu::TraceSpan span("encrypt");
+		  result = write_encrypted_source_value(File, FrameBuf, CtFrameBuf, Ctx, Info.UsesHMAC ? HMAC : 0);
+		}
+
+	      if ( ASDCP_SUCCESS(result) && Info.UsesHMAC )
+		result = IntPack.CalcValues(Info.AssetUUID, FramesWritten + 1, HMAC);
+	    }
 	}
 
       if ( ASDCP_SUCCESS(result) )
 	{
-	  StreamOffset += CtFrameBuf.Size();
+	  StreamOffset += ESVLength;
 
 	  byte_t hmoverhead[512];
 	  Kumu::MemIOWriter HMACOverhead(hmoverhead, 512);
@@ -19,6 +19,7 @@
 #include <stdlib.h>
 #include <memory.h>
 #include "aes.h"
+#include "cpu.h"
 
 #include <stdio.h>
 
@@ -34,6 +35,23 @@
 #define AES_192_ROUNDS 12
 #define AES_256_ROUNDS 14
 
+// AES-NI or the ARMv8 crypto extensions are used when the compiler can
+// target them and the cpu reports them at runtime
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define AES_HW 1
+#define AES_HW_X86 1
+#include <emmintrin.h>
+#include <tmmintrin.h>
+#include <wmmintrin.h>
+#elif defined(__aarch64__) && (defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_AES))
+#define AES_HW 1
+#define AES_HW_ARM 1
+#include <arm_neon.h>
+#endif
+
+// blocks in flight for CBC decryption, which unlike encryption is parallel
+#define AES_HW_CBC_BLOCKS 8
+
 /*********************** FUNCTION DECLARATIONS **********************/
 void ccm_prepare_first_ctr_blk(byte_t counter[], const byte_t nonce[], int nonce_len, int payload_len_store_size);
 void ccm_prepare_first_format_blk(byte_t buf[], int assoc_len, int payload_len, int payload_len_store_size, int mac_len, const byte_t nonce[], int nonce_len);
@@ -1068,6 +1086,289 @@ void aes_decrypt(const byte_t in[], byte_t out[], const word_t key[], int keysiz
 	out[15] = state[3][3];
 }
 
+/////////////////
+// Hardware AES
+/////////////////
+
+#ifdef AES_HW
+static int aes_rounds(int keysize)
+{
+	switch (keysize) {
+		case 192: return AES_192_ROUNDS;
+		case 256: return AES_256_ROUNDS;
+		default:  return AES_128_ROUNDS;
+	}
+}
+#endif
+
+#ifdef AES_HW_X86
+static int aes_hw_supported(void)
+{
+	return cpu_has(CPU_AES | CPU_SSSE3);
+}
+
+// The schedule words are big endian, the AES instructions want the round keys in byte order.
+__attribute__((target("aes,ssse3")))
+static inline int aes_hw_load_schedule(const aes_key_t *key, __m128i rk[])
+{
+	const __m128i bswap = _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+	int idx, rounds = aes_rounds(key->size);
+
+	for (idx = 0; idx <= rounds; idx++)
+		rk[idx] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)&key->schedule[4 * idx]), bswap);
+
+	return rounds;
+}
+
+// The equivalent inverse cipher wants the round keys reversed and the
+// middle ones passed through InvMixColumns.
+__attribute__((target("aes,ssse3")))
+static inline int aes_hw_load_dec_schedule(const aes_key_t *key, __m128i dk[])
+{
+	__m128i rk[AES_MAXNR + 1];
+	int idx, rounds = aes_hw_load_schedule(key, rk);
+
+	dk[0] = rk[rounds];
+	for (idx = 1; idx < rounds; idx++)
+		dk[idx] = _mm_aesimc_si128(rk[rounds - idx]);
+	dk[rounds] = rk[0];
+
+	return rounds;
+}
+
+__attribute__((target("aes,ssse3")))
+static void aes_hw_encrypt(const unsigned char *in, unsigned char *out, const aes_key_t *key)
+{
+	__m128i rk[AES_MAXNR + 1];
+	__m128i block;
+	int idx, rounds = aes_hw_load_schedule(key, rk);
+
+	block = _mm_xor_si128(_mm_loadu_si128((const __m128i *)in), rk[0]);
+	for (idx = 1; idx < rounds; idx++)
+		block = _mm_aesenc_si128(block, rk[idx]);
+	block = _mm_aesenclast_si128(block, rk[rounds]);
+
+	_mm_storeu_si128((__m128i *)out, block);
+}
+
+__attribute__((target("aes,ssse3")))
+static void aes_hw_decrypt(const unsigned char *in, unsigned char *out, const aes_key_t *key)
+{
+	__m128i dk[AES_MAXNR + 1];
+	__m128i block;
+	int idx, rounds = aes_hw_load_dec_schedule(key, dk);
+
+	block = _mm_xor_si128(_mm_loadu_si128((const __m128i *)in), dk[0]);
+	for (idx = 1; idx < rounds; idx++)
+		block = _mm_aesdec_si128(block, dk[idx]);
+	block = _mm_aesdeclast_si128(block, dk[rounds]);
+
+	_mm_storeu_si128((__m128i *)out, block);
+}
+
+// CBC encryption is serial, keeping the chain value and round keys in registers
+// is what makes this faster than calling aes_hw_encrypt per block.
+__attribute__((target("aes,ssse3")))
+static void aes_hw_cbc_encrypt(const unsigned char *in, unsigned char *out, size_t length, const aes_key_t *key, unsigned char *ivec)
+{
+	__m128i rk[AES_MAXNR + 1];
+	__m128i chain;
+	int idx, rounds = aes_hw_load_schedule(key, rk);
+
+	chain = _mm_loadu_si128((const __m128i *)ivec);
+
+	for (; length >= AES_BLOCK_SIZE; length -= AES_BLOCK_SIZE) {
+		chain = _mm_xor_si128(chain, _mm_loadu_si128((const __m128i *)in));
+		chain = _mm_xor_si128(chain, rk[0]);
+		for (idx = 1; idx < rounds; idx++)
+			chain = _mm_aesenc_si128(chain, rk[idx]);
+		chain = _mm_aesenclast_si128(chain, rk[rounds]);
+		_mm_storeu_si128((__m128i *)out, chain);
+		in += AES_BLOCK_SIZE;
+		out += AES_BLOCK_SIZE;
+	}
+
+	_mm_storeu_si128((__m128i *)ivec, chain);
+}
+
+// Blocks decrypt independently, so several are kept in flight to hide the
+// latency of aesdec. All ciphertext is loaded before storing so in may equal out.
+__attribute__((target("aes,ssse3")))
+static void aes_hw_cbc_decrypt(const unsigned char *in, unsigned char *out, size_t length, const aes_key_t *key, unsigned char *ivec)
+{
+	__m128i dk[AES_MAXNR + 1];
+	__m128i ct[AES_HW_CBC_BLOCKS], block[AES_HW_CBC_BLOCKS];
+	__m128i chain;
+	int idx, blk, rounds = aes_hw_load_dec_schedule(key, dk);
+
+	chain = _mm_loadu_si128((const __m128i *)ivec);
+
+	for (; length >= AES_HW_CBC_BLOCKS * AES_BLOCK_SIZE; length -= AES_HW_CBC_BLOCKS * AES_BLOCK_SIZE) {
+		for (blk = 0; blk < AES_HW_CBC_BLOCKS; blk++) {
+			ct[blk] = _mm_loadu_si128((const __m128i *)in + blk);
+			block[blk] = _mm_xor_si128(ct[blk], dk[0]);
+		}
+		for (idx = 1; idx < rounds; idx++)
+			for (blk = 0; blk < AES_HW_CBC_BLOCKS; blk++)
+				block[blk] = _mm_aesdec_si128(block[blk], dk[idx]);
+		for (blk = 0; blk < AES_HW_CBC_BLOCKS; blk++)
+			block[blk] = _mm_aesdeclast_si128(block[blk], dk[rounds]);
+
+		_mm_storeu_si128((__m128i *)out, _mm_xor_si128(block[0], chain));
+		for (blk = 1; blk < AES_HW_CBC_BLOCKS; blk++)
+			_mm_storeu_si128((__m128i *)out + blk, _mm_xor_si128(block[blk], ct[blk - 1]));
+		chain = ct[AES_HW_CBC_BLOCKS - 1];
+
+		in += AES_HW_CBC_BLOCKS * AES_BLOCK_SIZE;
+		out += AES_HW_CBC_BLOCKS * AES_BLOCK_SIZE;
+	}
+
+	for (; length >= AES_BLOCK_SIZE; length -= AES_BLOCK_SIZE) {
+		ct[0] = _mm_loadu_si128((const __m128i *)in);
+		block[0] = _mm_xor_si128(ct[0], dk[0]);
+		for (idx = 1; idx < rounds; idx++)
+			block[0] = _mm_aesdec_si128(block[0], dk[idx]);
+		block[0] = _mm_aesdeclast_si128(block[0], dk[rounds]);
+		_mm_storeu_si128((__m128i *)out, _mm_xor_si128(block[0], chain));
+		chain = ct[0];
+		in += AES_BLOCK_SIZE;
+		out += AES_BLOCK_SIZE;
+	}
+
+	_mm_storeu_si128((__m128i *)ivec, chain);
+}
+#elif defined(AES_HW_ARM)
+static int aes_hw_supported(void)
+{
+	return cpu_has(CPU_ARM_AES);
+}
+
+// The schedule words are big endian, the AES instructions want the round keys in byte order.
+static inline int aes_hw_load_schedule(const aes_key_t *key, uint8x16_t rk[])
+{
+	int idx, rounds = aes_rounds(key->size);
+
+	for (idx = 0; idx <= rounds; idx++)
+		rk[idx] = vreinterpretq_u8_u32(vld1q_u32((const uint32_t *)&key->schedule[4 * idx]));
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	for (idx = 0; idx <= rounds; idx++)
+		rk[idx] = vrev32q_u8(rk[idx]);
+#endif
+
+	return rounds;
+}
+
+static inline int aes_hw_load_dec_schedule(const aes_key_t *key, uint8x16_t dk[])
+{
+	uint8x16_t rk[AES_MAXNR + 1];
+	int idx, rounds = aes_hw_load_schedule(key, rk);
+
+	dk[0] = rk[rounds];
+	for (idx = 1; idx < rounds; idx++)
+		dk[idx] = vaesimcq_u8(rk[rounds - idx]);
+	dk[rounds] = rk[0];
+
+	return rounds;
+}
+
+// aese xors the round key before SubBytes/ShiftRows, so the final key is a plain xor
+static inline uint8x16_t aes_hw_encrypt_block(uint8x16_t block, const uint8x16_t rk[], int rounds)
+{
+	int idx;
+
+	for (idx = 0; idx < rounds - 1; idx++)
+		block = vaesmcq_u8(vaeseq_u8(block, rk[idx]));
+	block = vaeseq_u8(block, rk[rounds - 1]);
+
+	return veorq_u8(block, rk[rounds]);
+}
+
+static inline uint8x16_t aes_hw_decrypt_block(uint8x16_t block, const uint8x16_t dk[], int rounds)
+{
+	int idx;
+
+	for (idx = 0; idx < rounds - 1; idx++)
+		block = vaesimcq_u8(vaesdq_u8(block, dk[idx]));
+	block = vaesdq_u8(block, dk[rounds - 1]);
+
+	return veorq_u8(block, dk[rounds]);
+}
+
+static void aes_hw_encrypt(const unsigned char *in, unsigned char *out, const aes_key_t *key)
+{
+	uint8x16_t rk[AES_MAXNR + 1];
+	int rounds = aes_hw_load_schedule(key, rk);
+
+	vst1q_u8(out, aes_hw_encrypt_block(vld1q_u8(in), rk, rounds));
+}
+
+static void aes_hw_decrypt(const unsigned char *in, unsigned char *out, const aes_key_t *key)
+{
+	uint8x16_t dk[AES_MAXNR + 1];
+	int rounds = aes_hw_load_dec_schedule(key, dk);
+
+	vst1q_u8(out, aes_hw_decrypt_block(vld1q_u8(in), dk, rounds));
+}
+
+static void aes_hw_cbc_encrypt(const unsigned char *in, unsigned char *out, size_t length, const aes_key_t *key, unsigned char *ivec)
+{
+	uint8x16_t rk[AES_MAXNR + 1];
+	uint8x16_t chain;
+	int rounds = aes_hw_load_schedule(key, rk);
+
+	chain = vld1q_u8(ivec);
+
+	for (; length >= AES_BLOCK_SIZE; length -= AES_BLOCK_SIZE) {
+		chain = aes_hw_encrypt_block(veorq_u8(chain, vld1q_u8(in)), rk, rounds);
+		vst1q_u8(out, chain);
+		in += AES_BLOCK_SIZE;
+		out += AES_BLOCK_SIZE;
+	}
+
+	vst1q_u8(ivec, chain);
+}
+
+static void aes_hw_cbc_decrypt(const unsigned char *in, unsigned char *out, size_t length, const aes_key_t *key, unsigned char *ivec)
+{
+	uint8x16_t dk[AES_MAXNR + 1];
+	uint8x16_t ct[AES_HW_CBC_BLOCKS], block[AES_HW_CBC_BLOCKS];
+	uint8x16_t chain;
+	int blk, rounds = aes_hw_load_dec_schedule(key, dk);
+
+	chain = vld1q_u8(ivec);
+
+	for (; length >= AES_HW_CBC_BLOCKS * AES_BLOCK_SIZE; length -= AES_HW_CBC_BLOCKS * AES_BLOCK_SIZE) {
+		for (blk = 0; blk < AES_HW_CBC_BLOCKS; blk++)
+			ct[blk] = vld1q_u8(in + blk * AES_BLOCK_SIZE);
+		for (blk = 0; blk < AES_HW_CBC_BLOCKS; blk++)
+			block[blk] = aes_hw_decrypt_block(ct[blk], dk, rounds);
+
+		vst1q_u8(out, veorq_u8(block[0], chain));
+		for (blk = 1; blk < AES_HW_CBC_BLOCKS; blk++)
+			vst1q_u8(out + blk * AES_BLOCK_SIZE, veorq_u8(block[blk], ct[blk - 1]));
+		chain = ct[AES_HW_CBC_BLOCKS - 1];
+
+		in += AES_HW_CBC_BLOCKS * AES_BLOCK_SIZE;
+		out += AES_HW_CBC_BLOCKS * AES_BLOCK_SIZE;
+	}
+
+	for (; length >= AES_BLOCK_SIZE; length -= AES_BLOCK_SIZE) {
+		ct[0] = vld1q_u8(in);
+		vst1q_u8(out, veorq_u8(aes_hw_decrypt_block(ct[0], dk, rounds), chain));
+		chain = ct[0];
+		in += AES_BLOCK_SIZE;
+		out += AES_BLOCK_SIZE;
+	}
+
+	vst1q_u8(ivec, chain);
+}
+#else
+static int aes_hw_supported(void)
+{
+	return 0;
+}
+#endif
+
 int AES_set_encrypt_key (const unsigned char *user_key, const int bits, aes_key_t *key) {
      key->size = bits;
      aes_key_setup(user_key, key->schedule, key->size);
@@ -1083,10 +1384,22 @@ int AES_set_decrypt_key (const unsigned char *user_key, const int bits, aes_key_
 }
 
 void AES_encrypt(const unsigned char *in, unsigned char *out, const aes_key_t *key) {
+#ifdef AES_HW
+    if (aes_hw_supported()) {
+        aes_hw_encrypt(in, out, key);
+        return;
+    }
+#endif
     aes_encrypt(in, out, key->schedule, key->size);
 }
 
 void AES_decrypt(const unsigned char *in, unsigned char *out, const aes_key_t *key) {
+#ifdef AES_HW
+    if (aes_hw_supported()) {
+        aes_hw_decrypt(in, out, key);
+        return;
+    }
+#endif
     aes_decrypt(in, out, key->schedule, key->size);
 }
 
@@ -1094,6 +1407,45 @@ void AES_decrypt_cbc(const unsigned char *in, int in_len, unsigned char *out, co
     aes_encrypt_cbc(in, in_len, out, key->schedule, key->size, iv);
 }
 
+void AES_cbc_encrypt(const unsigned char *in, unsigned char *out, size_t length, const aes_key_t *key, unsigned char *ivec, const int enc) {
+    byte_t buf[AES_BLOCK_SIZE];
+    int idx;
+
+    if (enc == AES_ENCRYPT) {
+#ifdef AES_HW
+        if (aes_hw_supported()) {
+            aes_hw_cbc_encrypt(in, out, length, key, ivec);
+            return;
+        }
+#endif
+        for (; length >= AES_BLOCK_SIZE; length -= AES_BLOCK_SIZE) {
+            for (idx = 0; idx < AES_BLOCK_SIZE; idx++)
+                buf[idx] = in[idx] ^ ivec[idx];
+            aes_encrypt(buf, ivec, key->schedule, key->size);
+            memcpy(out, ivec, AES_BLOCK_SIZE);
+            in += AES_BLOCK_SIZE;
+            out += AES_BLOCK_SIZE;
+        }
+    }
+    else {
+#ifdef AES_HW
+        if (aes_hw_supported()) {
+            aes_hw_cbc_decrypt(in, out, length, key, ivec);
+            return;
+        }
+#endif
+        for (; length >= AES_BLOCK_SIZE; length -= AES_BLOCK_SIZE) {
+            memcpy(buf, in, AES_BLOCK_SIZE);
+            aes_decrypt(in, out, key->schedule, key->size);
+            for (idx = 0; idx < AES_BLOCK_SIZE; idx++)
+                out[idx] ^= ivec[idx];
+            memcpy(ivec, buf, AES_BLOCK_SIZE);
+            in += AES_BLOCK_SIZE;
+            out += AES_BLOCK_SIZE;
+        }
+    }
+}
+
 /*******************
 ** AES DEBUGGING FUNCTIONS
 *******************/
@@ -117,7 +117,11 @@ int aes_decrypt_ccm(const byte_t ciphertext[],             // IN  - Ciphertext,
 
 /*********************** OPENSSL COMPATIBLE DECLARATIONS **********************/
 #define AES_MAXNR 14
+#define AES_ENCRYPT 1
+#define AES_DECRYPT 0
 
+// Must stay the same size as OpenSSL's AES_KEY, libasdcp allocates keys
+// through openssl/aes.h.
 typedef struct aes_key_st {
     word_t schedule[4 * (AES_MAXNR + 1)];
     int size;
@@ -129,6 +133,8 @@ int AES_set_decrypt_key (const unsigned char *user_key, const int bits, aes_key_
 void AES_encrypt(const unsigned char *in, unsigned char *out, const aes_key_t *key);
 void AES_decrypt(const unsigned char *in, unsigned char *out, const aes_key_t *key);
 void AES_decrypt_cbc(const unsigned char *in, int in_len, unsigned char *out, const aes_key_t *key, byte_t *iv);
+// CBC over length bytes (a multiple of AES_BLOCK_SIZE), ivec is updated for chaining.
+void AES_cbc_encrypt(const unsigned char *in, unsigned char *out, size_t length, const aes_key_t *key, unsigned char *ivec, const int enc);
 
 ///////////////////
 // Test functions
@@ -0,0 +1,270 @@
+/*********************************************************************
+* Filename:   cpu.c
+* Copyright:
+* Disclaimer: This code is presented "as is" without any guarantees.
+* Details:    Runtime cpu feature detection for the SIMD kernels.
+              The cpu is probed once when the library is loaded (cpuid
+              and xgetbv on x86, hwcaps on arm) and the result capped by
+              the OPENDCP_ISA environment variable, so every kernel of
+              a run, and every benchmark, sees the same ISA level.
+*********************************************************************/
+
+/*************************** HEADER FILES ***************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cpu.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define CPU_X86 1
+#include <cpuid.h>
+#elif defined(__aarch64__)
+#define CPU_ARM 1
+#ifdef __linux__
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+#endif
+
+/**************************** DATA TYPES ****************************/
+typedef struct {
+	const char   *name;
+	unsigned int mask;                  // features usable at this level
+	unsigned int requires;              // features that make a cpu this level
+} cpu_level_t;
+
+typedef struct {
+	const char   *kernel;
+	const char   *variant;
+	unsigned int requires;
+} cpu_variant_t;
+
+/**************************** VARIABLES *****************************/
+// Lowest level first. The crypto, crc32 and f16c extensions come with
+// the level whose vector instructions their kernels are built on.
+#if defined(CPU_X86)
+static const cpu_level_t levels[] = {
+	{"scalar", 0, 0},
+	{"sse2",   CPU_SSE2, CPU_SSE2},
+	{"ssse3",  CPU_SSE2 | CPU_SSSE3 | CPU_AES | CPU_SHA, CPU_SSE2 | CPU_SSSE3},
+	{"sse4.1", CPU_SSE2 | CPU_SSSE3 | CPU_AES | CPU_SHA | CPU_SSE41 | CPU_SSE42, CPU_SSE2 | CPU_SSSE3 | CPU_SSE41},
+	{"avx2",   CPU_SSE2 | CPU_SSSE3 | CPU_AES | CPU_SHA | CPU_SSE41 | CPU_SSE42 | CPU_AVX2 | CPU_F16C, CPU_SSE2 | CPU_SSSE3 | CPU_SSE41 | CPU_AVX2},
+};
+#elif defined(CPU_ARM)
+static const cpu_level_t levels[] = {
+	{"scalar", 0, 0},
+	{"neon",   CPU_NEON, CPU_NEON},
+	{"armv8",  CPU_NEON | CPU_ARM_AES | CPU_ARM_SHA1 | CPU_ARM_CRC32, CPU_NEON | CPU_ARM_AES},
+};
+#else
+static const cpu_level_t levels[] = {
+	{"scalar", 0, 0},
+};
+#endif
+
+#define CPU_LEVELS (sizeof(levels) / sizeof(levels[0]))
+
+// The variants behind each runtime dispatch, preferred first. A kernel
+// runs the first variant whose features are all present, "c" otherwise.
+static const cpu_variant_t variants[] = {
+	{"aes",           "aes-ni", CPU_AES | CPU_SSSE3},
+	{"aes",           "armv8",  CPU_ARM_AES},
+	{"sha1",          "sha-ni", CPU_SHA | CPU_SSSE3},
+	{"sha1",          "ssse3",  CPU_SSSE3},
+	{"sha1",          "armv8",  CPU_ARM_SHA1},
+	{"crc32c",        "sse4.2", CPU_SSE42},
+	{"crc32c",        "armv8",  CPU_ARM_CRC32},
+	{"rgb_to_xyz",    "avx2",   CPU_AVX2},
+	{"rgb_to_xyz",    "sse4.1", CPU_SSE41},
+	{"rgb_to_xyz",    "neon",   CPU_NEON},
+	{"ycbcr_to_rgb",  "avx2",   CPU_AVX2},
+	{"xyz_to_rgb",    "avx2",   CPU_AVX2},
+	{"xyz_to_rgb",    "neon",   CPU_NEON},
+	{"cube",          "avx2",   CPU_AVX2},
+	{"xyz_stats",     "avx2",   CPU_AVX2},
+	{"quality",       "avx2",   CPU_AVX2},
+	{"quality",       "sse4.1", CPU_SSE41},
+	{"readrows",      "ssse3",  CPU_SSSE3},
+	{"deinterleave",  "ssse3",  CPU_SSSE3},
+	{"deinterleave",  "neon",   CPU_NEON},
+	{"half_float",    "f16c",   CPU_F16C},
+	{"half_float",    "neon",   CPU_NEON},
+	{NULL,            NULL,     0}
+};
+
+static unsigned int cpu_mask = 0;
+static const char   *cpu_name = NULL;
+
+/*********************** FUNCTION DEFINITIONS ***********************/
+#if defined(CPU_X86)
+static unsigned int cpu_detect(void)
+{
+	unsigned int eax, ebx, ecx, edx, xcr0 = 0;
+	unsigned int features = 0;
+	int max;
+
+	max = __get_cpuid_max(0, NULL);
+	if (max < 1 || !__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+		return 0;
+
+	if (edx & bit_SSE2)
+		features |= CPU_SSE2;
+	if (ecx & bit_SSSE3)
+		features |= CPU_SSSE3;
+	if (ecx & bit_SSE4_1)
+		features |= CPU_SSE41;
+	if (ecx & bit_SSE4_2)
+		features |= CPU_SSE42;
+	if (ecx & bit_AES)
+		features |= CPU_AES;
+
+	// the ymm registers have to be saved by the os as well
+	if (ecx & bit_OSXSAVE) {
+		__asm__ volatile ("xgetbv" : "=a" (xcr0), "=d" (edx) : "c" (0));
+	}
+
+	if ((xcr0 & 0x6) == 0x6 && (ecx & bit_AVX)) {
+		if (ecx & bit_F16C)
+			features |= CPU_F16C;
+		if (max >= 7) {
+			__cpuid_count(7, 0, eax, ebx, ecx, edx);
+			if (ebx & bit_AVX2)
+				features |= CPU_AVX2;
+		}
+	}
+
+	if (max >= 7) {
+		__cpuid_count(7, 0, eax, ebx, ecx, edx);
+		if (ebx & (1 << 29))
+			features |= CPU_SHA;
+	}
+
+	return features;
+}
+#elif defined(CPU_ARM)
+static unsigned int cpu_detect(void)
+{
+	unsigned int features = CPU_NEON;
+
+	// the crypto kernels only exist when the compiler could target them
+#if defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_AES)
+#ifdef __linux__
+	if (getauxval(AT_HWCAP) & HWCAP_AES)
+		features |= CPU_ARM_AES;
+#else
+	features |= CPU_ARM_AES;
+#endif
+#endif
+#if defined(__ARM_FEATURE_CRYPTO)
+#ifdef __linux__
+	if (getauxval(AT_HWCAP) & HWCAP_SHA1)
+		features |= CPU_ARM_SHA1;
+#else
+	features |= CPU_ARM_SHA1;
+#endif
+#endif
+#if defined(__ARM_FEATURE_CRC32)
+#ifdef __linux__
+	if (getauxval(AT_HWCAP) & HWCAP_CRC32)
+		features |= CPU_ARM_CRC32;
+#else
+	features |= CPU_ARM_CRC32;
+#endif
+#endif
+
+	return features;
+}
+#else
+static unsigned int cpu_detect(void)
+{
+	return 0;
+}
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((constructor))
+#endif
+static void cpu_init(void)
+{
+	const char *env = getenv(CPU_ENV_ISA);
+	unsigned int detected = cpu_detect();
+	unsigned int cap = levels[CPU_LEVELS - 1].mask;
+	size_t idx;
+
+	if (env && *env) {
+		for (idx = 0; idx < CPU_LEVELS; idx++) {
+			if (!strcmp(env, levels[idx].name))
+				break;
+		}
+		if (idx < CPU_LEVELS)
+			cap = levels[idx].mask;
+		else
+			fprintf(stderr, "%s: unknown ISA level %s, ignored\n", CPU_ENV_ISA, env);
+	}
+
+	cpu_mask = detected & cap;
+
+	// the highest level the capped features still reach
+	cpu_name = levels[0].name;
+	for (idx = 1; idx < CPU_LEVELS; idx++) {
+		if ((cpu_mask & levels[idx].requires) == levels[idx].requires)
+			cpu_name = levels[idx].name;
+	}
+}
+
+unsigned int cpu_features(void)
+{
+	// a race here only probes the cpu twice
+	if (!cpu_name)
+		cpu_init();
+
+	return cpu_mask;
+}
+
+int cpu_has(unsigned int mask)
+{
+	return (cpu_features() & mask) == mask;
+}
+
+const char *cpu_level(void)
+{
+	cpu_features();
+
+	return cpu_name;
+}
+
+const char *cpu_kernel(const char *name)
+{
+	const cpu_variant_t *v;
+	int known = 0;
+
+	for (v = variants; v->kernel; v++) {
+		if (strcmp(v->kernel, name))
+			continue;
+		known = 1;
+		if (cpu_has(v->requires))
+			return v->variant;
+	}
+
+	return known ? "c" : NULL;
+}
+
+char *cpu_describe(char *buf, size_t len)
+{
+	const cpu_variant_t *v;
+	size_t used;
+
+	if (!len)
+		return buf;
+
+	used = snprintf(buf, len, "isa %s:", cpu_level());
+
+	for (v = variants; v->kernel && used < len; v++) {
+		// each kernel once
+		if (v != variants && !strcmp(v[-1].kernel, v->kernel))
+			continue;
+		used += snprintf(buf + used, len - used, " %s=%s", v->kernel, cpu_kernel(v->kernel));
+	}
+
+	return buf;
+}
@@ -0,0 +1,62 @@
+/*********************************************************************
+* Filename:   cpu.h
+* Copyright:
+* Disclaimer: This code is presented "as is" without any guarantees.
+* Details:    Defines the API for the runtime cpu feature detection
+              shared by the SIMD kernels of libcrypto and libopendcp.
+*********************************************************************/
+
+#ifndef CPU_H
+#define CPU_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*************************** HEADER FILES ***************************/
+#include <stddef.h>
+
+/****************************** MACROS ******************************/
+// x86 features
+#define CPU_SSE2        0x0001
+#define CPU_SSSE3       0x0002
+#define CPU_SSE41       0x0004
+#define CPU_AVX2        0x0008
+#define CPU_F16C        0x0010
+#define CPU_AES         0x0020          // AES-NI
+#define CPU_SHA         0x0040          // SHA-NI
+#define CPU_SSE42       0x0080          // SSE4.2, for its crc32 instruction
+
+// arm features
+#define CPU_NEON        0x0100
+#define CPU_ARM_AES     0x0200          // ARMv8 AES instructions
+#define CPU_ARM_SHA1    0x0400          // ARMv8 SHA1 instructions
+#define CPU_ARM_CRC32   0x0800          // ARMv8 CRC32 instructions
+
+// forces a lower ISA level, e.g. OPENDCP_ISA=sse4.1 or OPENDCP_ISA=scalar
+#define CPU_ENV_ISA     "OPENDCP_ISA"
+
+/*********************** FUNCTION DECLARATIONS **********************/
+// Features the kernels may use: what the cpu and os support, capped by
+// OPENDCP_ISA. Detected once when the library is loaded.
+unsigned int cpu_features(void);
+
+// Non zero when every feature in the mask is usable.
+int cpu_has(unsigned int mask);
+
+// Name of the ISA level in effect, "avx2", "sse4.1", ..., "scalar".
+const char *cpu_level(void);
+
+// Variant selected for a kernel, e.g. cpu_kernel("sha1") is "sha-ni",
+// NULL for an unknown kernel.
+const char *cpu_kernel(const char *name);
+
+// One line listing the ISA level and the variant of every kernel, for
+// --version and verbose logs. Returns buf.
+char *cpu_describe(char *buf, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif   // CPU_H
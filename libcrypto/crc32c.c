@@ -0,0 +1,165 @@
+/*********************************************************************
+* Filename:   crc32c.c
+* Copyright:
+* Disclaimer: This code is presented "as is" without any guarantees.
+* Details:    Implementation of the CRC-32C (Castagnoli) checksum, as
+              used by iSCSI and ext4. Data is checksummed with the crc32
+              instructions of SSE4.2 or ARMv8 when the cpu has them,
+              otherwise eight bytes at a time with the slicing-by-8
+              tables.
+*********************************************************************/
+
+/*************************** HEADER FILES ***************************/
+#include <stdlib.h>
+#include <memory.h>
+#include <pthread.h>
+#include "crc32c.h"
+#include "cpu.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define CRC32C_HW_X86 1
+#include <nmmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#define CRC32C_HW_ARM 1
+#include <arm_acle.h>
+#endif
+
+/****************************** MACROS ******************************/
+#define CRC32C_POLY 0x82f63b78          // reflected Castagnoli polynomial
+
+typedef word_t (*crc32c_update_t)(word_t crc, const byte_t data[], size_t len);
+
+/**************************** VARIABLES *****************************/
+static word_t crc32c_table[8][256];
+static crc32c_update_t crc32c_update = NULL;
+static pthread_once_t crc32c_once = PTHREAD_ONCE_INIT;
+
+/*********************** FUNCTION DEFINITIONS ***********************/
+static void crc32c_init_tables(void)
+{
+	word_t crc;
+	int i, j;
+
+	for (i = 0; i < 256; i++) {
+		crc = i;
+		for (j = 0; j < 8; j++)
+			crc = (crc >> 1) ^ (CRC32C_POLY & (0 - (crc & 1)));
+		crc32c_table[0][i] = crc;
+	}
+
+	for (i = 0; i < 256; i++) {
+		crc = crc32c_table[0][i];
+		for (j = 1; j < 8; j++) {
+			crc = crc32c_table[0][crc & 0xff] ^ (crc >> 8);
+			crc32c_table[j][i] = crc;
+		}
+	}
+}
+
+static word_t crc32c_sw(word_t crc, const byte_t data[], size_t len)
+{
+	word_t lo, hi;
+
+	for (; len && ((size_t)data & 7); len--)
+		crc = crc32c_table[0][(crc ^ *data++) & 0xff] ^ (crc >> 8);
+
+	for (; len >= 8; len -= 8, data += 8) {
+		lo = crc ^ (data[0] | data[1] << 8 | data[2] << 16 | (word_t)data[3] << 24);
+		hi = data[4] | data[5] << 8 | data[6] << 16 | (word_t)data[7] << 24;
+		crc = crc32c_table[7][lo & 0xff] ^ crc32c_table[6][(lo >> 8) & 0xff] ^
+		      crc32c_table[5][(lo >> 16) & 0xff] ^ crc32c_table[4][lo >> 24] ^
+		      crc32c_table[3][hi & 0xff] ^ crc32c_table[2][(hi >> 8) & 0xff] ^
+		      crc32c_table[1][(hi >> 16) & 0xff] ^ crc32c_table[0][hi >> 24];
+	}
+
+	for (; len; len--)
+		crc = crc32c_table[0][(crc ^ *data++) & 0xff] ^ (crc >> 8);
+
+	return crc;
+}
+
+#if defined(CRC32C_HW_X86)
+__attribute__((target("sse4.2")))
+static word_t crc32c_sse42(word_t crc, const byte_t data[], size_t len)
+{
+	for (; len && ((size_t)data & 7); len--)
+		crc = _mm_crc32_u8(crc, *data++);
+
+#if defined(__x86_64__)
+	{
+		unsigned long long crc64 = crc, v;
+
+		for (; len >= 8; len -= 8, data += 8) {
+			memcpy(&v, data, sizeof(v));
+			crc64 = _mm_crc32_u64(crc64, v);
+		}
+		crc = (word_t)crc64;
+	}
+#else
+	{
+		unsigned int v;
+
+		for (; len >= 4; len -= 4, data += 4) {
+			memcpy(&v, data, sizeof(v));
+			crc = _mm_crc32_u32(crc, v);
+		}
+	}
+#endif
+
+	for (; len; len--)
+		crc = _mm_crc32_u8(crc, *data++);
+
+	return crc;
+}
+
+static crc32c_update_t crc32c_select(void)
+{
+	if (cpu_has(CPU_SSE42))
+		return crc32c_sse42;
+	return crc32c_sw;
+}
+#elif defined(CRC32C_HW_ARM)
+static word_t crc32c_armv8(word_t crc, const byte_t data[], size_t len)
+{
+	unsigned long long v;
+
+	for (; len && ((size_t)data & 7); len--)
+		crc = __crc32cb(crc, *data++);
+
+	for (; len >= 8; len -= 8, data += 8) {
+		memcpy(&v, data, sizeof(v));
+		crc = __crc32cd(crc, v);
+	}
+
+	for (; len; len--)
+		crc = __crc32cb(crc, *data++);
+
+	return crc;
+}
+
+static crc32c_update_t crc32c_select(void)
+{
+	if (cpu_has(CPU_ARM_CRC32))
+		return crc32c_armv8;
+	return crc32c_sw;
+}
+#else
+static crc32c_update_t crc32c_select(void)
+{
+	return crc32c_sw;
+}
+#endif
+
+static void crc32c_init(void)
+{
+	crc32c_init_tables();
+	crc32c_update = crc32c_select();
+}
+
+word_t crc32c(word_t crc, const byte_t data[], size_t len)
+{
+	// the tables and the kernel are set up once, before any thread uses them
+	pthread_once(&crc32c_once, crc32c_init);
+
+	return ~crc32c_update(~crc, data, len);
+}
@@ -0,0 +1,31 @@
+/*********************************************************************
+* Filename:   crc32c.h
+* Copyright:
+* Disclaimer: This code is presented "as is" without any guarantees.
+* Details:    Defines the API for the corresponding CRC-32C implementation.
+*********************************************************************/
+
+#ifndef CRC32C_H
+#define CRC32C_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*************************** HEADER FILES ***************************/
+#include <stddef.h>
+
+/**************************** DATA TYPES ****************************/
+typedef unsigned char byte_t;             // 8-bit byte
+typedef unsigned int  word_t;             // 32-bit word, change to "long" for 16-bit machines
+
+/*********************** FUNCTION DECLARATIONS **********************/
+// CRC-32C (Castagnoli) of len bytes, continuing from crc. Start with 0,
+// pass the previous result to checksum data in several pieces.
+word_t crc32c(word_t crc, const byte_t data[], size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif   // CRC32C_H
@@ -25,12 +25,13 @@ extern "C" {
 typedef unsigned char byte_t;             // 8-bit byte
 typedef unsigned int  word_t;             // 32-bit word, change to "long" for 16-bit machines
 
+// Must not be larger than OpenSSL's SHA_CTX, libasdcp allocates contexts
+// through openssl/sha.h.
 typedef struct {
-    byte_t data[64];
+    word_t state[5];
     word_t datalen;
     unsigned long long bitlen;
-    word_t state[5];
-    word_t k[4];
+    byte_t data[64];
 } sha1_t;
 
 /*********************** FUNCTION DECLARATIONS **********************/
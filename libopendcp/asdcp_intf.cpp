@@ -21,9 +21,17 @@
 #include <KM_prng.h>
 #include <KM_memio.h>
 #include <KM_util.h>
+#include <KM_log.h>
 #include <WavFileWriter.h>
+#include <Metadata.h>
 #include <iostream>
+#include <algorithm>
+#include <map>
+#include <vector>
 #include <assert.h>
+#include <pthread.h>
+#include <sys/time.h>
+#include <sys/stat.h>
 
 //#include "md5.h"
 #include "sha1.h"
@@ -39,6 +47,7 @@ int write_j2k_s_mxf(opendcp_t *opendcp, filelist_t *filelist, char *output_file)
 int write_pcm_mxf(opendcp_t *opendcp, filelist_t *filelist, char *output_file);
 int write_tt_mxf(opendcp_t *opendcp, filelist_t *filelist, char *output_file);
 int write_mpeg2_mxf(opendcp_t *opendcp, filelist_t *filelist, char *output_file);
+static int read_asset_info_full(asset_t *asset);
 
 /* generate a random UUID */
 extern "C" void uuid_random(char *uuid) {
@@ -57,43 +66,414 @@ extern "C" void asdcp_bin2hex(const byte_t *bin_buf, int bin_len, char *str_buf,
     Kumu::bin2hex(bin_buf, bin_len, str_buf, str_len);
 }
 
+/* true when both paths name one file, however they are spelled; a file that is not there yet is never the same */
+static int is_same_file(const char *a, const char *b) {
+#ifdef _WIN32
+    char full_a[MAX_PATH], full_b[MAX_PATH];
+
+    if (!_fullpath(full_a, a, sizeof(full_a)) || !_fullpath(full_b, b, sizeof(full_b))) {
+        return !strcmp(a, b);
+    }
+
+    return !_stricmp(full_a, full_b);
+#else
+    struct stat st_a, st_b;
+
+    if (stat(a, &st_a) || stat(b, &st_b)) {
+        return !strcmp(a, b);
+    }
+
+    return st_a.st_dev == st_b.st_dev && st_a.st_ino == st_b.st_ino;
+#endif
+}
+
+/* passes libasdcp messages on to the opendcp log */
+class opendcp_log_sink : public Kumu::ILogSink {
+public:
+    void WriteEntry(const Kumu::LogEntry &entry) {
+        std::string msg;
+        int         level;
+
+        switch (entry.Type) {
+            case Kumu::LOG_DEBUG:
+                level = LOG_DEBUG;
+                break;
+            case Kumu::LOG_INFO:
+            case Kumu::LOG_NOTICE:
+                level = LOG_INFO;
+                break;
+            case Kumu::LOG_WARN:
+            case Kumu::LOG_ALERT:
+                level = LOG_WARN;
+                break;
+            default:
+                level = LOG_ERROR;
+                break;
+        }
+
+        if (level > opendcp_log_threshold) {
+            return;
+        }
+
+        msg = entry.Msg;
+
+        while (!msg.empty() && (msg[msg.size() - 1] == '\n' || msg[msg.size() - 1] == '\r')) {
+            msg.erase(msg.size() - 1);
+        }
+
+        opendcp_log(level, "libasdcp", "asdcp", 0, "%s", msg.c_str());
+    }
+};
+
+static opendcp_log_sink asdcp_log_sink;
+
+/* route the libasdcp default log sink into opendcp_log */
+extern "C" void opendcp_log_asdcp(void) {
+    Kumu::SetDefaultLogSink(&asdcp_log_sink);
+}
+
+static ui64_t asdcp_trace_clock() {
+    return opendcp_metrics_now();
+}
+
+static void asdcp_trace_sink(const char *name, ui64_t start) {
+    opendcp_trace_span(name, start);
+}
+
+/* route the libasdcp encryption and digest spans into the opendcp trace, or stop them */
+extern "C" void opendcp_trace_asdcp(int enable) {
+    if (enable) {
+        Kumu::SetTraceSink(asdcp_trace_clock, asdcp_trace_sink);
+    }
+    else {
+        Kumu::SetTraceSink();
+    }
+}
+
+/* back the libasdcp frame buffers with huge pages, or stop */
+extern "C" void opendcp_huge_pages_asdcp(int enable) {
+    ASDCP::FrameBufferHugePages(enable != 0);
+}
+
+/* drop the pages of mxf files behind the position they are read or written at, or stop */
+extern "C" void opendcp_cache_hints_asdcp(int enable) {
+    Kumu::SetStreamOnceWindow(enable ? 64 * 1024 * 1024 : 0);
+}
+
+/* the libasdcp frame buffer blocks that got huge pages */
+extern "C" void opendcp_huge_pages_asdcp_stats(opendcp_huge_stats_t *stats) {
+    ui32_t explicit_pages, transparent, fallback;
+
+    ASDCP::FrameBufferHugePageStats(explicit_pages, transparent, fallback);
+
+    stats->explicit_pages = explicit_pages;
+    stats->transparent    = transparent;
+    stats->fallback       = fallback;
+}
+
+/*!
+ @function opendcp_io_report
+ @abstract Prints the libasdcp file I/O totals.
+ @discussion The counts are those of the files closed so far: system
+             calls, bytes and the time spent blocked in them.
+ @param fp The stream to print to.
+*/
+extern "C" void opendcp_io_report(FILE *fp) {
+    Kumu::IOStats io;
+    double        blocked;
+
+    Kumu::GetIOStats(io);
+    blocked = io.BlockedNanos / 1e9;
+
+    fprintf(fp, "\n%-8s %10s %12s %10s\n", "io", "calls", "MB", "MB/call");
+    fprintf(fp, "%-8s %10llu %12.1f %10.3f\n", "read", (unsigned long long)io.Reads, io.ReadBytes / 1e6,
+            io.Reads ? io.ReadBytes / 1e6 / io.Reads : 0.0);
+    fprintf(fp, "%-8s %10llu %12.1f %10.3f\n", "write", (unsigned long long)io.Writes, io.WriteBytes / 1e6,
+            io.Writes ? io.WriteBytes / 1e6 / io.Writes : 0.0);
+    fprintf(fp, "%-8s %10llu\n", "seek", (unsigned long long)io.Seeks);
+    fprintf(fp, "blocked %.2fs", blocked);
+
+    if (blocked > 0) {
+        fprintf(fp, ", %.1f MB/s while blocked", (io.ReadBytes + io.WriteBytes) / 1e6 / blocked);
+    }
+
+    fprintf(fp, "\n");
+}
+
+/*
+   Read-ahead for calculate_digest. A reader thread fills a ring of large
+   buffers while the caller hashes the previous ones, so file reads overlap
+   SHA-1. Hashing still advances in FILE_READ_SIZE steps, one sha1_update
+   callback each, so progress counts are the same as before.
+*/
+#define DIGEST_BUFFER_ALIGN 4096
+
+typedef struct {
+    byte_t *data;
+    ui32_t  length;
+    int     full;
+} digest_buffer_t;
+
+typedef struct {
+    Kumu::FileReader *reader;
+    digest_buffer_t  buffers[DIGEST_READ_BUFFERS];
+    ui32_t           size;
+    int              done;
+    int              error;
+    int              stop;
+    pthread_mutex_t  mutex;
+    pthread_cond_t   cond;
+} digest_reader_t;
+
+static byte_t *digest_buffer_alloc(size_t size) {
+#ifdef _WIN32
+    return (byte_t *)_aligned_malloc(size, DIGEST_BUFFER_ALIGN);
+#else
+    void *ptr = NULL;
+
+    if (posix_memalign(&ptr, DIGEST_BUFFER_ALIGN, size)) {
+        return NULL;
+    }
+
+    return (byte_t *)ptr;
+#endif
+}
+
+static void digest_buffer_free(byte_t *ptr) {
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    free(ptr);
+#endif
+}
+
+static void *digest_reader_thread(void *arg) {
+    digest_reader_t *dr = (digest_reader_t *)arg;
+    ui32_t           read_length;
+    int              index = 0;
+
+    while (1) {
+        digest_buffer_t *buffer = &dr->buffers[index];
+
+        pthread_mutex_lock(&dr->mutex);
+
+        while (buffer->full && !dr->stop) {
+            pthread_cond_wait(&dr->cond, &dr->mutex);
+        }
+
+        if (dr->stop) {
+            pthread_mutex_unlock(&dr->mutex);
+            break;
+        }
+
+        pthread_mutex_unlock(&dr->mutex);
+
+        read_length = 0;
+        Result_t result = dr->reader->Read(buffer->data, dr->size, &read_length);
+
+        pthread_mutex_lock(&dr->mutex);
+
+        if (ASDCP_SUCCESS(result) && read_length > 0) {
+            buffer->length = read_length;
+            buffer->full   = 1;
+        }
+        else {
+            dr->done  = 1;
+            dr->error = result != RESULT_ENDOFFILE && ASDCP_FAILURE(result);
+        }
+
+        pthread_cond_broadcast(&dr->cond);
+        pthread_mutex_unlock(&dr->mutex);
+
+        if (dr->done) {
+            break;
+        }
+
+        index = (index + 1) % DIGEST_READ_BUFFERS;
+    }
+
+    return NULL;
+}
+
+/*
+   Digest sidecar: an mxf written with mxf.digest_flag gets a small
+   "<file>.sha1" next to it holding "<digest> <size> <mtime>". As long as
+   the size and mtime still match, calculate_digest takes the digest from
+   it instead of reading the whole file again.
+*/
+static void write_digest_sidecar(opendcp_t *opendcp, const char *filename, const byte_t *digest) {
+    struct stat st;
+    char        sha_buffer[64];
+    std::string path = std::string(filename) + DIGEST_SIDECAR_EXT;
+    FILE        *fp;
+
+    sprintf(opendcp->mxf.digest, "%.36s", Kumu::base64encode(digest, 20, sha_buffer, 64));
+
+    if (stat(filename, &st)) {
+        return;
+    }
+
+    fp = fopen(path.c_str(), "w");
+
+    if (!fp) {
+        OPENDCP_LOG(LOG_WARN, "Could not write digest file %s", path.c_str());
+        return;
+    }
+
+    fprintf(fp, "%s %lld %lld\n", opendcp->mxf.digest, (long long)st.st_size, (long long)st.st_mtime);
+    fclose(fp);
+
+    digest_cache_store(opendcp, filename, opendcp->mxf.digest);
+}
+
+static int read_digest_sidecar(const char *filename, char *digest) {
+    struct stat st;
+    char        sha_buffer[64];
+    long long   size, mtime;
+    std::string path = std::string(filename) + DIGEST_SIDECAR_EXT;
+    FILE        *fp;
+    int         found = 0;
+
+    if (stat(filename, &st)) {
+        return 0;
+    }
+
+    fp = fopen(path.c_str(), "r");
+
+    if (!fp) {
+        return 0;
+    }
+
+    if (fscanf(fp, "%63s %lld %lld", sha_buffer, &size, &mtime) == 3 &&
+        size == (long long)st.st_size && mtime == (long long)st.st_mtime) {
+        sprintf(digest, "%.36s", sha_buffer);
+        found = 1;
+    }
+
+    fclose(fp);
+
+    return found;
+}
+
 /* calcuate the SHA1 digest of a file */
 extern "C" int calculate_digest(opendcp_t *opendcp, const char *filename, char *digest) {
     using namespace Kumu;
 
-    FileReader    reader;
-    sha1_t        sha_context;
-    ByteString    read_buffer(FILE_READ_SIZE);
-    ui32_t        read_length;
-    const ui32_t  sha_length = 20;
-    byte_t        byte_buffer[sha_length];
-    char          sha_buffer[64];
-    Result_t      result = RESULT_OK;
+    FileReader      reader;
+    sha1_t          sha_context;
+    digest_reader_t dr;
+    pthread_t       thread;
+    const ui32_t    sha_length = 20;
+    byte_t          byte_buffer[sha_length];
+    char            sha_buffer[64];
+    Result_t        result = RESULT_OK;
+    int             cancelled = 0;
+    int             index = 0;
+    int             i;
+
+    /* previously calculated digests, unless asked to verify them */
+    if (!opendcp->dcp.digest_verify &&
+        (read_digest_sidecar(filename, digest) || digest_cache_lookup(opendcp, filename, digest) == OPENDCP_NO_ERROR)) {
+        if (opendcp->dcp.sha1_done.callback(opendcp->dcp.sha1_done.argument)) {
+            return OPENDCP_CALC_DIGEST;
+        }
+
+        return OPENDCP_NO_ERROR;
+    }
 
     result = reader.OpenRead(filename);
+
+    if (ASDCP_FAILURE(result)) {
+        opendcp->dcp.sha1_done.callback(opendcp->dcp.sha1_done.argument);
+        return OPENDCP_CALC_DIGEST;
+    }
+
+    memset(&dr, 0, sizeof(dr));
+    dr.reader = &reader;
+    dr.size   = opendcp->dcp.digest_read_size > 0 ? opendcp->dcp.digest_read_size : DIGEST_READ_SIZE;
+
+    /* whole FILE_READ_SIZE steps keep one callback per FILE_READ_SIZE bytes */
+    dr.size   = (dr.size + FILE_READ_SIZE - 1) / FILE_READ_SIZE * FILE_READ_SIZE;
+
+    for (i = 0; i < DIGEST_READ_BUFFERS; i++) {
+        dr.buffers[i].data = digest_buffer_alloc(dr.size);
+
+        if (!dr.buffers[i].data) {
+            while (i--) {
+                digest_buffer_free(dr.buffers[i].data);
+            }
+            return OPENDCP_CALC_DIGEST;
+        }
+    }
+
+    pthread_mutex_init(&dr.mutex, NULL);
+    pthread_cond_init(&dr.cond, NULL);
+    pthread_create(&thread, NULL, digest_reader_thread, &dr);
+
     sha1_init(&sha_context);
 
-    while (ASDCP_SUCCESS(result)) {
-        read_length = 0;
-        result = reader.Read(read_buffer.Data(), read_buffer.Capacity(), &read_length);
+    while (!cancelled) {
+        digest_buffer_t *buffer = &dr.buffers[index];
 
-        if (ASDCP_SUCCESS(result)) {
-            sha1_update(&sha_context, read_buffer.Data(), read_length);
+        pthread_mutex_lock(&dr.mutex);
+
+        while (!buffer->full && !dr.done) {
+            pthread_cond_wait(&dr.cond, &dr.mutex);
+        }
+
+        pthread_mutex_unlock(&dr.mutex);
+
+        if (!buffer->full) {
+            break;
+        }
+
+        for (ui32_t offset = 0; offset < buffer->length; offset += FILE_READ_SIZE) {
+            ui32_t             length = buffer->length - offset < FILE_READ_SIZE ? buffer->length - offset : FILE_READ_SIZE;
+            unsigned long long start = opendcp_trace_enabled ? opendcp_metrics_now() : 0;
+
+            sha1_update(&sha_context, buffer->data + offset, length);
+            opendcp_trace_span("hash", start);
 
             /* update callback (also check for interrupt) */
             if (opendcp->dcp.sha1_update.callback(opendcp->dcp.sha1_update.argument)) {
-                return OPENDCP_CALC_DIGEST;
+                cancelled = 1;
+                break;
             }
         }
+
+        pthread_mutex_lock(&dr.mutex);
+        buffer->full = 0;
+        pthread_cond_broadcast(&dr.cond);
+        pthread_mutex_unlock(&dr.mutex);
+
+        index = (index + 1) % DIGEST_READ_BUFFERS;
     }
 
-    if (result == RESULT_ENDOFFILE) {
-        result = RESULT_OK;
+    pthread_mutex_lock(&dr.mutex);
+    dr.stop = 1;
+    pthread_cond_broadcast(&dr.cond);
+    pthread_mutex_unlock(&dr.mutex);
+    pthread_join(thread, NULL);
+
+    pthread_cond_destroy(&dr.cond);
+    pthread_mutex_destroy(&dr.mutex);
+
+    for (i = 0; i < DIGEST_READ_BUFFERS; i++) {
+        digest_buffer_free(dr.buffers[i].data);
+    }
+
+    if (cancelled) {
+        return OPENDCP_CALC_DIGEST;
+    }
+
+    if (dr.error) {
+        result = RESULT_READFAIL;
     }
 
     if (ASDCP_SUCCESS(result)) {
         sha1_final(&sha_context, byte_buffer);
         sprintf(digest, "%.36s", base64encode(byte_buffer, sha_length, sha_buffer, 64));
+        digest_cache_store(opendcp, filename, digest);
     }
 
     if (opendcp->dcp.sha1_done.callback(opendcp->dcp.sha1_done.argument)) {
@@ -151,13 +531,94 @@ extern "C" int get_wav_info(const char *filename, int frame_rate, wav_info_t *wa
     return OPENDCP_NO_ERROR;
 }
 
+/*
+   Asset info cache. read_asset_info results are kept per filename and
+   reused while the file's size and mtime are unchanged, so re-probing the
+   same assets (the GUI does so on every field change) costs one stat().
+*/
+typedef struct {
+    long long size;
+    long long mtime;
+    asset_t   asset;
+} asset_info_entry_t;
+
+static std::map<std::string, asset_info_entry_t> asset_info_cache;
+static pthread_mutex_t asset_info_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* copy the fields read_asset_info fills in */
+static void copy_asset_info(asset_t *dst, const asset_t *src) {
+    dst->essence_type       = src->essence_type;
+    dst->essence_class      = src->essence_class;
+    dst->duration           = src->duration;
+    dst->intrinsic_duration = src->intrinsic_duration;
+    dst->entry_point        = src->entry_point;
+    dst->xml_ns             = src->xml_ns;
+    dst->stereoscopic       = src->stereoscopic;
+    dst->encrypted          = src->encrypted;
+    memcpy(dst->uuid, src->uuid, sizeof(dst->uuid));
+    memcpy(dst->aspect_ratio, src->aspect_ratio, sizeof(dst->aspect_ratio));
+    memcpy(dst->edit_rate, src->edit_rate, sizeof(dst->edit_rate));
+    memcpy(dst->sample_rate, src->sample_rate, sizeof(dst->sample_rate));
+    memcpy(dst->frame_rate, src->frame_rate, sizeof(dst->frame_rate));
+    memcpy(dst->key_id, src->key_id, sizeof(dst->key_id));
+}
+
+static int asset_info_cache_get(const char *filename, asset_t *asset) {
+    struct stat st;
+    int         found = 0;
+
+    if (stat(filename, &st)) {
+        return 0;
+    }
+
+    pthread_mutex_lock(&asset_info_mutex);
+
+    std::map<std::string, asset_info_entry_t>::iterator i = asset_info_cache.find(filename);
+
+    if (i != asset_info_cache.end() && i->second.size == (long long)st.st_size && i->second.mtime == (long long)st.st_mtime) {
+        copy_asset_info(asset, &i->second.asset);
+        found = 1;
+    }
+
+    pthread_mutex_unlock(&asset_info_mutex);
+
+    return found;
+}
+
+static void asset_info_cache_put(const asset_t *asset) {
+    struct stat        st;
+    asset_info_entry_t entry;
+
+    if (stat(asset->filename, &st)) {
+        return;
+    }
+
+    memset(&entry, 0, sizeof(entry));
+    entry.size  = (long long)st.st_size;
+    entry.mtime = (long long)st.st_mtime;
+    copy_asset_info(&entry.asset, asset);
+
+    pthread_mutex_lock(&asset_info_mutex);
+    asset_info_cache[asset->filename] = entry;
+    pthread_mutex_unlock(&asset_info_mutex);
+}
+
 /* get the essence class of a file */
 extern "C" int get_file_essence_class(char *filename, int raw) {
     Result_t      result = RESULT_OK;
     EssenceType_t essence_type;
+    asset_t       asset;
 
     OPENDCP_LOG(LOG_DEBUG, "Reading file EssenceType: %s", filename);
 
+    if (!raw && asset_info_cache_get(filename, &asset)) {
+        return asset.essence_class;
+    }
+
+    if (raw && opendcp_pack_is(filename)) {
+        return ACT_PICTURE;
+    }
+
     if (raw) {
         result = ASDCP::RawEssenceType(filename, essence_type);
     }
@@ -235,8 +696,166 @@ extern "C" int get_file_essence_type(char *filename) {
     return AET_UNKNOWN;
 }
 
+/*
+   Header-only probe: parse the header partition and take the asset
+   information straight from its metadata, without the index footer and
+   the rest of a full MXFReader::OpenRead. Anything unexpected returns an
+   error and read_asset_info falls back to the full readers.
+*/
+static int probe_asset_info(asset_t *asset) {
+    using namespace ASDCP::MXF;
+
+    const Dictionary   *m_Dict = &DefaultCompositeDict();
+    OP1aHeader         header(m_Dict);
+    EssenceType_t      essence_type;
+    InterchangeObject  *object = 0;
+    FileDescriptor     *desc = 0;
+    ASDCP::Rational    edit_rate;
+    char               uuid_buffer[64];
+    int                essence_class;
+    std::list<InterchangeObject*> tracks;
+
+    if (ASDCP_FAILURE(ASDCP::EssenceType(asset->filename, essence_type, header))) {
+        return OPENDCP_DETECT_TRACK_TYPE;
+    }
+
+    switch (essence_type) {
+        case ESS_JPEG_2000:
+        case ESS_JPEG_2000_S:
+            essence_class = ACT_PICTURE;
+            header.GetMDObjectByType(OBJ_TYPE_ARGS(RGBAEssenceDescriptor), &object);
+            break;
+
+        case ESS_MPEG2_VES:
+            essence_class = ACT_PICTURE;
+            header.GetMDObjectByType(OBJ_TYPE_ARGS(MPEG2VideoDescriptor), &object);
+            break;
+
+        case ESS_PCM_24b_48k:
+        case ESS_PCM_24b_96k:
+            essence_class = ACT_SOUND;
+            header.GetMDObjectByType(OBJ_TYPE_ARGS(WaveAudioDescriptor), &object);
+            break;
+
+        case ESS_TIMED_TEXT:
+            essence_class = ACT_TIMED_TEXT;
+            header.GetMDObjectByType(OBJ_TYPE_ARGS(TimedTextDescriptor), &object);
+            break;
+
+        default:
+            return OPENDCP_UNKNOWN_TRACK_TYPE;
+    }
+
+    desc = static_cast<FileDescriptor*>(object);
+
+    if (!desc || desc->ContainerDuration.empty() || desc->ContainerDuration.const_get() == 0) {
+        return OPENDCP_ERROR;
+    }
+
+    header.GetMDObjectsByType(OBJ_TYPE_ARGS(Track), tracks);
+
+    if (tracks.empty() || ASDCP_FAILURE(header.GetMDObjectByType(OBJ_TYPE_ARGS(SourcePackage), &object))) {
+        return OPENDCP_ERROR;
+    }
+
+    if (header.OperationalPattern.MatchExact(MXFInterop_OPAtom_Entry().ul)) {
+        asset->xml_ns = LS_MXF_INTEROP;
+    }
+    else if (header.OperationalPattern.MatchExact(SMPTE_390_OPAtom_Entry().ul)) {
+        asset->xml_ns = LS_MXF_SMPTE;
+    }
+    else {
+        return OPENDCP_ERROR;
+    }
+
+    sprintf(asset->uuid, "%.36s", Kumu::bin2UUIDhex(static_cast<SourcePackage*>(object)->PackageUID.Value() + 16, 16, uuid_buffer, 64));
+
+    /* picture tracks carry the edit rate, the descriptor the sample rate */
+    edit_rate = essence_class == ACT_PICTURE ? static_cast<Track*>(tracks.front())->EditRate : desc->SampleRate;
+
+    asset->essence_type       = essence_type;
+    asset->essence_class      = essence_class;
+    asset->duration           = (int)desc->ContainerDuration.const_get();
+    asset->intrinsic_duration = asset->duration;
+    asset->entry_point        = 0;
+    sprintf(asset->edit_rate, "%d %d", edit_rate.Numerator, edit_rate.Denominator);
+
+    switch (essence_type) {
+        case ESS_JPEG_2000:
+        case ESS_JPEG_2000_S:
+        {
+            GenericPictureEssenceDescriptor *pdesc = static_cast<GenericPictureEssenceDescriptor*>(desc);
+
+            /* interop stereoscopic essence is labelled as plain j2k */
+            if (essence_type == ESS_JPEG_2000_S || edit_rate != desc->SampleRate) {
+                asset->stereoscopic = 1;
+            }
+
+            sprintf(asset->aspect_ratio, "%d %d", pdesc->AspectRatio.Numerator, pdesc->AspectRatio.Denominator);
+            sprintf(asset->sample_rate, "%d %d", desc->SampleRate.Numerator, desc->SampleRate.Denominator);
+            sprintf(asset->frame_rate, "%d %d", desc->SampleRate.Numerator, desc->SampleRate.Denominator);
+            break;
+        }
+
+        case ESS_MPEG2_VES:
+        {
+            GenericPictureEssenceDescriptor *pdesc = static_cast<GenericPictureEssenceDescriptor*>(desc);
+
+            sprintf(asset->aspect_ratio, "%d %d", pdesc->AspectRatio.Numerator, pdesc->AspectRatio.Denominator);
+            sprintf(asset->sample_rate, "%d %d", desc->SampleRate.Numerator, desc->SampleRate.Denominator);
+            sprintf(asset->frame_rate, "%d", desc->SampleRate.Numerator);
+            break;
+        }
+
+        case ESS_PCM_24b_48k:
+        case ESS_PCM_24b_96k:
+        {
+            WaveAudioDescriptor *adesc = static_cast<WaveAudioDescriptor*>(desc);
+
+            sprintf(asset->sample_rate, "%d %d", adesc->AudioSamplingRate.Numerator, adesc->AudioSamplingRate.Denominator);
+            break;
+        }
+
+        default:
+            break;
+    }
+
+    /* add encrypted info, if applicable */
+    if (ASDCP_SUCCESS(header.GetMDObjectByType(OBJ_TYPE_ARGS(CryptographicContext), &object))) {
+        asset->encrypted = 1;
+        sprintf(asset->key_id, "%.36s", Kumu::bin2UUIDhex(static_cast<CryptographicContext*>(object)->CryptographicKeyID.Value(), 16, uuid_buffer, 64));
+    }
+    else {
+        asset->encrypted = 0;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
 /* read asset file information */
 extern "C" int read_asset_info(asset_t *asset) {
+    int result;
+
+    if (asset_info_cache_get(asset->filename, asset)) {
+        return OPENDCP_NO_ERROR;
+    }
+
+    result = probe_asset_info(asset);
+
+    if (result != OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_DEBUG, "header probe failed, opening %s with the essence reader", asset->filename);
+        result = read_asset_info_full(asset);
+    }
+
+    if (result == OPENDCP_NO_ERROR) {
+        asset_info_cache_put(asset);
+    }
+
+    return result;
+}
+
+/* read asset file information with the full essence readers */
+static int read_asset_info_full(asset_t *asset) {
     EssenceType_t essence_type;
     WriterInfo info;
     Result_t result = RESULT_OK;
@@ -417,6 +1036,16 @@ extern "C" int write_mxf(opendcp_t *opendcp, filelist_t *filelist, char *output_
     Result_t      result = RESULT_OK;
     EssenceType_t essence_type;
 
+    /* a frame store holds the codestreams of a 2D picture track */
+    if (filelist->nfiles == 1 && opendcp_pack_is(filelist->files[0])) {
+        if (opendcp->stereoscopic) {
+            OPENDCP_LOG(LOG_ERROR, "stereoscopic tracks can not be wrapped from a frame store");
+            return OPENDCP_INVALID_PICTURE_TRACK;
+        }
+
+        return write_j2k_mxf(opendcp, filelist, output_file);
+    }
+
     result = ASDCP::RawEssenceType(filelist->files[0], essence_type);
 
     if (ASDCP_FAILURE(result)) {
@@ -469,7 +1098,8 @@ typedef struct {
     HMACContext   *hmac_context;
 } writer_info_t;
 
-Result_t fill_writer_info(opendcp_t *opendcp, writer_info_t *writer_info) {
+/* fill_writer_info with the given label set instead of the one of opendcp->ns */
+static Result_t fill_writer_info_labels(opendcp_t *opendcp, writer_info_t *writer_info, LabelSet_t label_set) {
     Kumu::FortunaRNG        rng;
     byte_t                  iv_buf[CBC_BLOCK_SIZE];
     Result_t                result = RESULT_OK;
@@ -477,17 +1107,7 @@ Result_t fill_writer_info(opendcp_t *opendcp, writer_info_t *writer_info) {
     writer_info->info.ProductVersion = OPENDCP_VERSION;
     writer_info->info.CompanyName = OPENDCP_NAME;
     writer_info->info.ProductName = OPENDCP_NAME;
-
-    /* set the label type */
-    if (opendcp->ns == XML_NS_INTEROP) {
-        writer_info->info.LabelSetType = LS_MXF_INTEROP;
-    }
-    else if (opendcp->ns == XML_NS_SMPTE) {
-        writer_info->info.LabelSetType = LS_MXF_SMPTE;
-    }
-    else {
-        writer_info->info.LabelSetType = LS_MXF_UNKNOWN;
-    }
+    writer_info->info.LabelSetType = label_set;
 
     /* generate a random UUID for this essence */
     Kumu::GenRandomUUID(writer_info->info.AssetUUID);
@@ -531,629 +1151,5163 @@ Result_t fill_writer_info(opendcp_t *opendcp, writer_info_t *writer_info) {
     return result;
 }
 
-/* write out j2k mxf file */
-int write_j2k_mxf(opendcp_t *opendcp, filelist_t *filelist, char *output_file) {
-    JP2K::MXFWriter         mxf_writer;
-    JP2K::PictureDescriptor picture_desc;
-    JP2K::CodestreamParser  j2k_parser;
-    JP2K::FrameBuffer       frame_buffer(FRAME_BUFFER_SIZE);
-    writer_info_t           writer_info;
-    Result_t                result = RESULT_OK;
-    ui32_t                  start_frame;
-    ui32_t                  mxf_duration;
-    ui32_t                  slide_duration = 0;
-
-    /* set the starting frame */
-    if (opendcp->mxf.start_frame && filelist->nfiles >= (opendcp->mxf.start_frame - 1)) {
-        start_frame = opendcp->mxf.start_frame - 1;  /* adjust for zero base */
+Result_t fill_writer_info(opendcp_t *opendcp, writer_info_t *writer_info) {
+    /* set the label type */
+    if (opendcp->ns == XML_NS_INTEROP) {
+        return fill_writer_info_labels(opendcp, writer_info, LS_MXF_INTEROP);
     }
-    else {
-        start_frame = 0;
+    else if (opendcp->ns == XML_NS_SMPTE) {
+        return fill_writer_info_labels(opendcp, writer_info, LS_MXF_SMPTE);
     }
 
-    OPENDCP_LOG(LOG_DEBUG, "j2k_parser.OpenReadFrame(%s)", filelist->files[start_frame]);
-    result = j2k_parser.OpenReadFrame(filelist->files[start_frame], frame_buffer);
+    return fill_writer_info_labels(opendcp, writer_info, LS_MXF_UNKNOWN);
+}
 
-    if (ASDCP_FAILURE(result)) {
-        return OPENDCP_FILEOPEN_J2K;
-    }
+/*
+   Read-ahead for write_j2k_mxf and write_j2k_s_mxf. Prefetch threads each
+   own a codestream parser and fill a ring of frame buffers in file order
+   while the writer wraps the previous frames, so file reads and parsing
+   overlap the MXF write. For 3D the left and right eyes of a frame are
+   adjacent files and are read by different threads. A slot is refilled
+   once the writer has moved past its frame.
+   When encrypting, each thread also encrypts its frames with its own
+   context and a fresh IV, every packet carries its IV so frames do not
+   depend on each other.
+*/
+#define PREFETCH_THREADS_MAX 8
 
-    Rational edit_rate(opendcp->frame_rate, 1);
-    j2k_parser.FillPictureDescriptor(picture_desc);
-    picture_desc.EditRate = edit_rate;
+typedef struct {
+    JP2K::FrameBuffer *frame_buffer;
+    FrameBuffer       *ct_buffer;
+    int               failed;
+    ui32_t            seq;
+    int               ready;
+} j2k_prefetch_slot_t;
 
-    fill_writer_info(opendcp, &writer_info);
+typedef struct {
+    opendcp_t           *opendcp;
+    filelist_t          *filelist;
+    opendcp_pack_t      *pack;          /* frames come from a frame store instead of the file list */
+    opendcp_manifest_t  *manifest;      /* checksums of the codestreams, when they were recorded */
+    int                 encrypt;
+    ui32_t              start;
+    ui32_t              count;
+    ui32_t              next;
+    ui32_t              consumed;
+    int                 stop;
+    j2k_prefetch_slot_t *slots;
+    ui32_t              nslots;
+    pthread_mutex_t     mutex;
+    pthread_cond_t      cond;
+} j2k_prefetch_t;
+
+static void *j2k_prefetch_thread(void *arg) {
+    j2k_prefetch_t         *prefetch = (j2k_prefetch_t *)arg;
+    JP2K::CodestreamParser j2k_parser;
+    AESEncContext          aes_context;
+    Kumu::FortunaRNG       rng;
+    byte_t                 iv_buf[CBC_BLOCK_SIZE];
+    ui32_t                 seq;
+
+    if (prefetch->encrypt) {
+        aes_context.InitKey(prefetch->opendcp->mxf.key_value);
+    }
 
-    result = mxf_writer.OpenWrite(output_file, writer_info.info, picture_desc);
+    while (1) {
+        pthread_mutex_lock(&prefetch->mutex);
 
-    if (ASDCP_FAILURE(result)) {
-        return OPENDCP_FILEWRITE_MXF;
-    }
+        while (!prefetch->stop && prefetch->next < prefetch->count && prefetch->next >= prefetch->consumed + prefetch->nslots) {
+            pthread_cond_wait(&prefetch->cond, &prefetch->mutex);
+        }
 
-    /* set the duration of the output mxf */
-    if (opendcp->mxf.slide) {
-        mxf_duration = opendcp->mxf.duration;
-        slide_duration = mxf_duration / filelist->nfiles;
-    }
-    else if (opendcp->mxf.duration && (filelist->nfiles >= opendcp->mxf.duration)) {
-        mxf_duration = opendcp->mxf.duration;
-    }
-    else {
-        mxf_duration = filelist->nfiles;
-    }
+        if (prefetch->stop || prefetch->next >= prefetch->count) {
+            pthread_mutex_unlock(&prefetch->mutex);
+            break;
+        }
 
-    ui32_t read  = 1;
-    ui32_t i = start_frame;
+        seq = prefetch->next++;
+        pthread_mutex_unlock(&prefetch->mutex);
 
-    /* read each input frame and write to the output mxf until duration is reached */
-    while ( ASDCP_SUCCESS(result) && mxf_duration--) {
-        if (read) {
-            result = j2k_parser.OpenReadFrame(filelist->files[i], frame_buffer);
+        j2k_prefetch_slot_t *slot = &prefetch->slots[seq % prefetch->nslots];
+        unsigned long long read_start = opendcp_metrics_now();
+        Result_t result = RESULT_OK;
 
-            if (opendcp->mxf.delete_intermediate) {
-                unlink(filelist->files[i]);
-            }
+        if (prefetch->pack) {
+            unsigned int size = 0;
 
-            if (ASDCP_FAILURE(result)) {
-                return OPENDCP_FILEOPEN_J2K;
+            if (opendcp_pack_read(prefetch->pack, prefetch->start + seq, slot->frame_buffer->Data(),
+                                  slot->frame_buffer->Capacity(), &size) == OPENDCP_NO_ERROR) {
+                slot->frame_buffer->Size(size);
             }
-
-            if (opendcp->mxf.encrypt_header_flag) {
-                frame_buffer.PlaintextOffset(0);
+            else {
+                result = RESULT_READFAIL;
             }
+        }
+        else {
+            char *file = prefetch->filelist->files[prefetch->start + seq];
 
-            if (opendcp->mxf.slide) {
-                read = 0;
+            OPENDCP_LOG(LOG_DEBUG, "j2k_parser.OpenReadFrame(%s)", file);
+            result = j2k_parser.OpenReadFrame(file, *slot->frame_buffer);
+
+            if (ASDCP_SUCCESS(result) && prefetch->manifest &&
+                opendcp_manifest_check(prefetch->manifest, file, slot->frame_buffer->RoData(), slot->frame_buffer->Size()) != OPENDCP_NO_ERROR) {
+                result = RESULT_READFAIL;
             }
-        }
 
-        if (opendcp->mxf.slide) {
-            if (mxf_duration % slide_duration == 0) {
-                i++;
-                read = 1;
+            if (prefetch->opendcp->mxf.delete_intermediate) {
+                unlink(file);
             }
         }
-        else {
-            i++;
+
+        opendcp_metrics_record(prefetch->opendcp->metrics, METRIC_READ, read_start,
+                               ASDCP_SUCCESS(result) ? slot->frame_buffer->Size() : 0);
+
+        if (ASDCP_SUCCESS(result) && prefetch->opendcp->mxf.encrypt_header_flag) {
+            slot->frame_buffer->PlaintextOffset(0);
         }
 
-        /* write the frame */
-        result = mxf_writer.WriteFrame(frame_buffer, writer_info.aes_context, writer_info.hmac_context);
+        if (ASDCP_SUCCESS(result) && prefetch->encrypt) {
+            result = aes_context.SetIVec(rng.FillRandom(iv_buf, CBC_BLOCK_SIZE));
 
-        /* frame done callback (also check for interrupt) */
-        if (opendcp->mxf.frame_done.callback(opendcp->mxf.frame_done.argument)) {
-            return OPENDCP_NO_ERROR;
+            if (ASDCP_SUCCESS(result)) {
+                result = EncryptFrameBuffer(*slot->frame_buffer, *slot->ct_buffer, &aes_context);
+            }
         }
-    }
 
-    if (result == RESULT_ENDOFFILE) {
-        result = RESULT_OK;
+        pthread_mutex_lock(&prefetch->mutex);
+        slot->failed = ASDCP_FAILURE(result);
+        slot->seq    = seq;
+        slot->ready  = 1;
+        pthread_cond_broadcast(&prefetch->cond);
+        pthread_mutex_unlock(&prefetch->mutex);
     }
 
-    if (ASDCP_FAILURE(result)) {
-        return OPENDCP_FILEWRITE_MXF;
-    }
+    return NULL;
+}
 
-    result = mxf_writer.Finalize();
+/* wait for a prefetched frame */
+static j2k_prefetch_slot_t *j2k_prefetch_get(j2k_prefetch_t *prefetch, ui32_t seq) {
+    j2k_prefetch_slot_t *slot = &prefetch->slots[seq % prefetch->nslots];
 
-    /* file done callback */
-    opendcp->mxf.file_done.callback(opendcp->mxf.file_done.argument);
+    pthread_mutex_lock(&prefetch->mutex);
 
-    if (ASDCP_FAILURE(result)) {
-        return OPENDCP_FINALIZE_MXF;
+    while (!(slot->ready && slot->seq == seq)) {
+        pthread_cond_wait(&prefetch->cond, &prefetch->mutex);
     }
 
-    return OPENDCP_NO_ERROR;
+    pthread_mutex_unlock(&prefetch->mutex);
+
+    return slot;
 }
 
-/* write out 3D j2k mxf file */
-int write_j2k_s_mxf(opendcp_t *opendcp, filelist_t *filelist, char *output_file) {
-    JP2K::MXFSWriter        mxf_writer;
-    JP2K::PictureDescriptor picture_desc;
-    JP2K::CodestreamParser  j2k_parser_left;
-    JP2K::CodestreamParser  j2k_parser_right;
-    JP2K::FrameBuffer       frame_buffer_left(FRAME_BUFFER_SIZE);
-    JP2K::FrameBuffer       frame_buffer_right(FRAME_BUFFER_SIZE);
-    writer_info_t           writer_info;
-    Result_t                result = RESULT_OK;
-    ui32_t                  start_frame;
-    ui32_t                  mxf_duration;
-    ui32_t                  slide_duration = 0;
+/* hand a frame's slot back to the prefetch threads */
+static void j2k_prefetch_release(j2k_prefetch_t *prefetch, ui32_t seq) {
+    pthread_mutex_lock(&prefetch->mutex);
+    prefetch->slots[seq % prefetch->nslots].ready = 0;
+    prefetch->consumed = seq + 1;
+    pthread_cond_broadcast(&prefetch->cond);
+    pthread_mutex_unlock(&prefetch->mutex);
+}
 
-    /* set the starting frame */
-    if (opendcp->mxf.start_frame && filelist->nfiles >= (opendcp->mxf.start_frame - 1)) {
-        start_frame = opendcp->mxf.start_frame - 1; /* adjust for zero base */
-    }
-    else {
-        start_frame = 0;
-    }
+static void j2k_prefetch_stop(j2k_prefetch_t *prefetch) {
+    pthread_mutex_lock(&prefetch->mutex);
+    prefetch->stop = 1;
+    pthread_cond_broadcast(&prefetch->cond);
+    pthread_mutex_unlock(&prefetch->mutex);
+}
 
-    result = j2k_parser_left.OpenReadFrame(filelist->files[0], frame_buffer_left);
+static double elapsed_seconds(struct timeval *start) {
+    struct timeval now;
 
-    if (ASDCP_FAILURE(result)) {
-        return OPENDCP_FILEOPEN_J2K;
-    }
+    gettimeofday(&now, NULL);
 
-    result = j2k_parser_right.OpenReadFrame(filelist->files[1], frame_buffer_right);
+    return (now.tv_sec - start->tv_sec) + (now.tv_usec - start->tv_usec) / 1000000.0;
+}
 
-    if (ASDCP_FAILURE(result)) {
-        return OPENDCP_FILEOPEN_J2K;
-    }
+/*
+   Frame done reporting of the writers. The cancel flag is checked after
+   every frame, frame_done is only called every mxf.progress_frames frames
+   or mxf.progress_ms milliseconds, with the totals in mxf.progress.
+*/
+typedef struct {
+    opendcp_t      *opendcp;
+    struct timeval start;
+    struct timeval last;           /* time of the last frame_done call */
+    int            reported;       /* frames at the last frame_done call */
+} mxf_progress_t;
+
+static void mxf_progress_init(mxf_progress_t *p, opendcp_t *opendcp) {
+    p->opendcp  = opendcp;
+    p->reported = 0;
+    gettimeofday(&p->start, NULL);
+    p->last = p->start;
+    memset(&opendcp->mxf.progress, 0, sizeof(opendcp->mxf.progress));
+}
 
-    Rational edit_rate(opendcp->frame_rate, 1);
-    j2k_parser_left.FillPictureDescriptor(picture_desc);
-    picture_desc.EditRate = edit_rate;
+static int mxf_progress_report(mxf_progress_t *p) {
+    mxf_t  *mxf     = &p->opendcp->mxf;
+    double seconds  = elapsed_seconds(&p->start);
 
-    fill_writer_info(opendcp, &writer_info);
+    gettimeofday(&p->last, NULL);
+    p->reported = mxf->progress.frames;
 
-    result = mxf_writer.OpenWrite(output_file, writer_info.info, picture_desc);
+    mxf->progress.fps           = seconds > 0 ? mxf->progress.frames / seconds : 0.0;
+    mxf->progress.mb_per_second = seconds > 0 ? mxf->progress.bytes / 1048576.0 / seconds : 0.0;
 
-    if (ASDCP_FAILURE(result)) {
-        return OPENDCP_FILEWRITE_MXF;
+    return mxf->frame_done.callback(mxf->frame_done.argument);
+}
+
+/* count written frames, returns non-zero once the writer should stop */
+static int mxf_progress_add(mxf_progress_t *p, int frames, ui64_t bytes) {
+    mxf_t *mxf = &p->opendcp->mxf;
+    int   due;
+
+    mxf->progress.frames += frames;
+    mxf->progress.bytes  += bytes;
+
+    if (mxf->cancel) {
+        return 1;
     }
 
-    /* set the duration of the output mxf, set to half the filecount since it is 3D */
-    if ((filelist->nfiles / 2) < opendcp->duration || !opendcp->duration) {
-        mxf_duration = filelist->nfiles / 2;
+    if (mxf->progress_frames <= 0 && mxf->progress_ms <= 0) {
+        due = 1;
     }
     else {
-        mxf_duration = opendcp->duration;
-    }
+        due = mxf->progress_frames > 0 && mxf->progress.frames - p->reported >= mxf->progress_frames;
 
-    /* set the duration of the output mxf, set to half the filecount since it is 3D */
-    if (opendcp->mxf.slide) {
-        mxf_duration = opendcp->mxf.duration;
-        slide_duration = mxf_duration / (filelist->nfiles / 2);
-    }
-    else if (opendcp->mxf.duration && (filelist->nfiles / 2 >= opendcp->mxf.duration)) {
-        mxf_duration = opendcp->mxf.duration;
+        if (!due && mxf->progress_ms > 0) {
+            due = elapsed_seconds(&p->last) * 1000.0 >= mxf->progress_ms;
+        }
     }
-    else {
-        mxf_duration = filelist->nfiles / 2;
+
+    return due ? mxf_progress_report(p) : 0;
+}
+
+static int mxf_progress_frame(mxf_progress_t *p, ui64_t bytes) {
+    return mxf_progress_add(p, 1, bytes);
+}
+
+/* report the frames written since the last call, before file_done */
+static int mxf_progress_flush(mxf_progress_t *p) {
+    if (p->opendcp->mxf.progress.frames == p->reported) {
+        return 0;
     }
 
-    ui32_t read = 1;
-    ui32_t i = start_frame;
+    return mxf_progress_report(p);
+}
 
-    /* read each input frame and write to the output mxf until duration is reached */
-    while (ASDCP_SUCCESS(result) && mxf_duration--) {
-        if (read) {
-            result = j2k_parser_left.OpenReadFrame(filelist->files[i], frame_buffer_left);
+/* queue the file writes with the buffers of opendcp->mxf, 0 keeps the libasdcp defaults */
+template <class Writer>
+static void mxf_async_io(Writer &writer, opendcp_t *opendcp) {
+    ui32_t count = opendcp->mxf.io_buffers > 0 ? opendcp->mxf.io_buffers : 8;
+    ui32_t size  = opendcp->mxf.io_buffer_size > 0 ? opendcp->mxf.io_buffer_size : Kumu::Megabyte;
 
-            if (opendcp->mxf.delete_intermediate) {
-                unlink(filelist->files[i]);
-            }
+    writer.EnableAsyncIO(opendcp->mxf.direct_io != 0, count, size);
+}
 
-            if (ASDCP_FAILURE(result)) {
-                return OPENDCP_FILEOPEN_J2K;
-            }
+/*
+   Tracks long enough to need several index segments write each full
+   segment to a file next to the mxf instead of holding the whole index
+   until the footer, tracks of unknown length always do.
+*/
+#define INDEX_SPILL_FRAMES 20000
 
-            i++;
+template <class Writer>
+static void mxf_index_spill(Writer &writer, const char *output_file, ui32_t frames) {
+    if (frames >= INDEX_SPILL_FRAMES) {
+        writer.EnableIndexSpill(std::string(output_file) + ".index");
+    }
+}
 
-            result = j2k_parser_right.OpenReadFrame(filelist->files[i], frame_buffer_right);
+/* the bytes a picture track takes besides its codestreams, per frame and for the header and footer */
+#define PREALLOCATE_FRAME_OVERHEAD 256
+#define PREALLOCATE_FILE_OVERHEAD  (1024 * 1024)
 
-            if (opendcp->mxf.delete_intermediate) {
-                unlink(filelist->files[i]);
-            }
+/*
+   Reserve the disk space of a picture track before it is written, so a
+   long reel is laid out in few extents. The size is what the track takes
+   at the bit rate limit, Finalize() releases what it did not use. A track
+   that would not fit the free space at that rate is written without it.
+*/
+template <class Writer>
+static void mxf_preallocate(Writer &writer, opendcp_t *opendcp, const char *output_file, ui32_t frames) {
+    int           bw   = opendcp->j2k.bw ? opendcp->j2k.bw : MAX_DCP_JPEG_BITRATE;
+    int           rate = opendcp->frame_rate > 0 ? opendcp->frame_rate : 24;
+    ui64_t        size = (ui64_t)frames * ((ui64_t)bw / 8 / rate + PREALLOCATE_FRAME_OVERHEAD) + PREALLOCATE_FILE_OVERHEAD;
+    std::string   dir  = Kumu::PathDirname(output_file);
+    Kumu::fsize_t free_space, total_space;
+
+    if (!frames) {
+        return;
+    }
 
-            if (ASDCP_FAILURE(result)) {
-                return OPENDCP_FILEOPEN_J2K;
-            }
+    if (KM_SUCCESS(Kumu::FreeSpaceForPath(dir.empty() ? "." : dir, free_space, total_space)) && size > (ui64_t)free_space) {
+        OPENDCP_LOG(LOG_DEBUG, "not reserving space for %s, it may not fit", output_file);
+        return;
+    }
 
-            if (opendcp->mxf.encrypt_header_flag) {
-                frame_buffer_left.PlaintextOffset(0);
-            }
+    if (ASDCP_FAILURE(writer.Preallocate(size))) {
+        OPENDCP_LOG(LOG_DEBUG, "could not reserve space for %s", output_file);
+    }
+}
 
-            if (opendcp->mxf.encrypt_header_flag) {
-                frame_buffer_right.PlaintextOffset(0);
-            }
+/*
+   Upload of an mxf to object storage while it is written. The writer hands
+   every write of the file to the upload, which sends the file in parts as
+   it grows, so the upload finishes shortly after Finalize() instead of
+   starting then. Declared before the writer, so it outlives it.
+*/
+class mxf_upload : public Kumu::WriteObserver {
+public:
+    opendcp_upload_t *upload;
 
-            if (opendcp->mxf.slide) {
-                read = 0;
-            }
-        }
+    mxf_upload() : upload(NULL) {}
+    ~mxf_upload() { opendcp_upload_abort(upload); }
 
-        if (opendcp->mxf.slide) {
-            if (mxf_duration % slide_duration == 0) {
-                i++;
-                read = 1;
-            }
+    Kumu::Result_t Written(Kumu::fpos_t offset, const byte_t *buf, ui32_t buf_len) {
+        return opendcp_upload_write(upload, offset, buf, buf_len) == OPENDCP_NO_ERROR ? Kumu::RESULT_OK : Kumu::RESULT_WRITEFAIL;
+    }
+
+    /* start the upload of the file the writer just opened, when mxf.upload is set */
+    template <class Writer>
+    int open(Writer &writer, opendcp_t *opendcp) {
+        if (!opendcp->mxf.upload) {
+            return OPENDCP_NO_ERROR;
         }
-        else {
-            i++;
+
+        upload = opendcp_upload_open(opendcp->mxf.upload, opendcp->mxf.upload_part_mb, opendcp->mxf.upload_threads, 0);
+
+        if (!upload || ASDCP_FAILURE(writer.SetWriteObserver(this))) {
+            return OPENDCP_UPLOAD;
         }
 
-        /* write the frame */
-        result = mxf_writer.WriteFrame(frame_buffer_left, JP2K::SP_LEFT, writer_info.aes_context, writer_info.hmac_context);
+        return OPENDCP_NO_ERROR;
+    }
 
-        /* frame done callback (also check for interrupt) */
-        opendcp->mxf.frame_done.callback(opendcp->mxf.frame_done.argument);
+    /* complete the upload once the writer is finalized */
+    int close() {
+        opendcp_upload_t *done = upload;
 
-        /* write the frame */
-        result = mxf_writer.WriteFrame(frame_buffer_right, JP2K::SP_RIGHT, writer_info.aes_context, writer_info.hmac_context);
+        upload = NULL;
 
-        /* frame done callback (also check for interrupt) */
-        opendcp->mxf.frame_done.callback(opendcp->mxf.frame_done.argument);
+        return done ? opendcp_upload_close(done) : OPENDCP_NO_ERROR;
     }
+};
 
-    if (result == RESULT_ENDOFFILE) {
-        result = RESULT_OK;
-    }
+/* log the codestream bit rates of a picture track, write the report when asked and free the statistics */
+static void bitrate_done(opendcp_t *opendcp, opendcp_bitrate_t *bitrate) {
+    opendcp_bitrate_summary(bitrate);
 
-    if (ASDCP_FAILURE(result)) {
-        return OPENDCP_FILEWRITE_MXF;
+    if (bitrate && opendcp->mxf.bitrate_report) {
+        opendcp_bitrate_dump(bitrate, opendcp->mxf.bitrate_report);
     }
 
-    result = mxf_writer.Finalize();
+    opendcp_bitrate_delete(bitrate);
+}
 
-    opendcp->mxf.file_done.callback(opendcp->mxf.file_done.argument);
+/*
+   Resume checkpoints of write_j2k_mxf. Every mxf.checkpoint frames the
+   frames written are committed to disk and recorded next to the mxf,
+   with the identifiers its header is rebuilt from. With mxf.resume an
+   unfinished file is reopened, the frames after the last checkpoint are
+   cut off and the wrap goes on from there. Frame IVs are stored in each
+   packet and the HMAC sequence is the frame number, so no cipher state
+   is kept. The sidecar is removed once the file is finalized.
+*/
+#define RESUME_SIDECAR_EXT ".resume"
 
-    if (ASDCP_FAILURE(result)) {
-        return OPENDCP_FINALIZE_MXF;
+typedef struct {
+    ui32_t frames;
+    ui32_t start_frame;
+    ui32_t duration;
+    int    label_set;
+    int    encrypted;
+    int    hmac;
+    byte_t asset_uuid[UUIDlen];
+    byte_t context_id[UUIDlen];
+    byte_t key_id[UUIDlen];
+} mxf_checkpoint_t;
+
+/* written to a temporary file and renamed, so a crash leaves the old or the new checkpoint */
+static int write_resume_sidecar(const char *filename, const mxf_checkpoint_t *checkpoint) {
+    std::string path = std::string(filename) + RESUME_SIDECAR_EXT;
+    std::string tmp  = path + ".tmp";
+    char        asset_uuid[64], context_id[64], key_id[64];
+    FILE        *fp;
+    int         rc;
+
+    fp = fopen(tmp.c_str(), "w");
+
+    if (!fp) {
+        OPENDCP_LOG(LOG_WARN, "Could not write checkpoint %s", path.c_str());
+        return OPENDCP_ERROR;
+    }
+
+    rc = fprintf(fp, "%u %u %u %d %d %d %s %s %s\n", checkpoint->frames, checkpoint->start_frame,
+                 checkpoint->duration, checkpoint->label_set, checkpoint->encrypted, checkpoint->hmac,
+                 Kumu::bin2hex(checkpoint->asset_uuid, UUIDlen, asset_uuid, sizeof(asset_uuid)),
+                 Kumu::bin2hex(checkpoint->context_id, UUIDlen, context_id, sizeof(context_id)),
+                 Kumu::bin2hex(checkpoint->key_id, UUIDlen, key_id, sizeof(key_id)));
+
+    if (fclose(fp) || rc < 0 || rename(tmp.c_str(), path.c_str())) {
+        OPENDCP_LOG(LOG_WARN, "Could not write checkpoint %s", path.c_str());
+        unlink(tmp.c_str());
+        return OPENDCP_ERROR;
     }
 
     return OPENDCP_NO_ERROR;
 }
 
-/* write out pcm audio mxf file */
-int write_pcm_mxf(opendcp_t *opendcp, filelist_t *filelist, char *output_file) {
-    PCM::FrameBuffer     frame_buffer;
-    PCM::AudioDescriptor audio_desc;
-    PCM::MXFWriter       mxf_writer;
-    writer_info_t        writer_info;
-    Result_t             result = RESULT_OK;
-    ui32_t               mxf_duration;
-    i32_t                file_index = 0;
+static int read_resume_sidecar(const char *filename, mxf_checkpoint_t *checkpoint) {
+    std::string path = std::string(filename) + RESUME_SIDECAR_EXT;
+    char        asset_uuid[64], context_id[64], key_id[64];
+    ui32_t      count[3];
+    FILE        *fp;
+    int         found;
 
-    PCM::WAVParser       pcm_parser_channel[MAX_AUDIO_CHANNELS];
-    PCM::FrameBuffer     frame_buffer_channel[MAX_AUDIO_CHANNELS];
-    PCM::AudioDescriptor audio_desc_channel[MAX_AUDIO_CHANNELS];
+    fp = fopen(path.c_str(), "r");
 
-    Rational edit_rate(opendcp->frame_rate, 1);
+    if (!fp) {
+        return 0;
+    }
 
-    /* read first file */
-    result = pcm_parser_channel[0].OpenRead(filelist->files[0], edit_rate);
+    found = fscanf(fp, "%u %u %u %d %d %d %63s %63s %63s", &checkpoint->frames, &checkpoint->start_frame,
+                   &checkpoint->duration, &checkpoint->label_set, &checkpoint->encrypted, &checkpoint->hmac,
+                   asset_uuid, context_id, key_id) == 9 &&
+            !Kumu::hex2bin(asset_uuid, checkpoint->asset_uuid, UUIDlen, &count[0]) && count[0] == UUIDlen &&
+            !Kumu::hex2bin(context_id, checkpoint->context_id, UUIDlen, &count[1]) && count[1] == UUIDlen &&
+            !Kumu::hex2bin(key_id, checkpoint->key_id, UUIDlen, &count[2]) && count[2] == UUIDlen;
 
-    if (ASDCP_FAILURE(result)) {
-        return OPENDCP_FILEOPEN_WAV;
+    fclose(fp);
+
+    return found;
+}
+
+static void remove_resume_sidecar(const char *filename) {
+    unlink((std::string(filename) + RESUME_SIDECAR_EXT).c_str());
+}
+
+/* commit the frames written so far and record them */
+static int mxf_checkpoint(JP2K::MXFWriter &writer, const char *filename, mxf_checkpoint_t *checkpoint) {
+    if (ASDCP_FAILURE(writer.Checkpoint(checkpoint->frames))) {
+        OPENDCP_LOG(LOG_WARN, "Could not commit %s to disk", filename);
+        return OPENDCP_ERROR;
     }
 
-    /* read audio descriptor */
-    pcm_parser_channel[0].FillAudioDescriptor(audio_desc);
-    audio_desc.ChannelCount = 0;
-    audio_desc.BlockAlign   = 0;
+    return write_resume_sidecar(filename, checkpoint);
+}
 
-    for (file_index = 0; file_index < filelist->nfiles; file_index++) {
-        result = pcm_parser_channel[file_index].OpenRead(filelist->files[file_index], edit_rate);
+/*
+   A second 2D picture track written from the same codestreams with the
+   other label set, so one encode gives both an SMPTE and an Interop
+   track. It has a writer thread of its own: the caller hands it each
+   frame before writing the frame to its own track and waits for it
+   before the frame's buffer is reused. An encrypted track keeps the key
+   id of the first one, so the same key opens both.
+*/
+typedef struct {
+    JP2K::MXFWriter         mxf_writer;
+    writer_info_t           writer_info;
+    opendcp_t               *opendcp;
+    const char              *output_file;
+    const JP2K::FrameBuffer *frame;       /* the frame being written, NULL when idle */
+    const FrameBuffer       *ct_frame;    /* its ciphertext when it was encrypted ahead */
+    int                     failed;
+    int                     stop;
+    pthread_t               thread;
+    pthread_mutex_t         mutex;
+    pthread_cond_t          cond;
+} j2k_dual_t;
+
+static void *j2k_dual_thread(void *arg) {
+    j2k_dual_t *dual = (j2k_dual_t *)arg;
+
+    pthread_mutex_lock(&dual->mutex);
+
+    while (1) {
+        while (!dual->stop && !dual->frame) {
+            pthread_cond_wait(&dual->cond, &dual->mutex);
+        }
 
-        if (ASDCP_FAILURE(result)) {
-            OPENDCP_LOG(LOG_ERROR, "could not open %s", filelist->files[file_index]);
-            return OPENDCP_FILEOPEN_WAV;
+        if (!dual->frame) {
+            break;
         }
 
-        pcm_parser_channel[file_index].FillAudioDescriptor(audio_desc_channel[file_index]);
+        const JP2K::FrameBuffer *frame    = dual->frame;
+        const FrameBuffer       *ct_frame = dual->ct_frame;
+        int                     failed    = dual->failed;
 
-        if (audio_desc_channel[file_index].AudioSamplingRate != audio_desc.AudioSamplingRate) {
-            OPENDCP_LOG(LOG_ERROR, "mismatched sampling rate");
-            return OPENDCP_FILEOPEN_WAV;
-        }
+        pthread_mutex_unlock(&dual->mutex);
 
-        if (audio_desc_channel[file_index].QuantizationBits != audio_desc.QuantizationBits) {
-            OPENDCP_LOG(LOG_ERROR, "mismatched bit rate");
-            return OPENDCP_FILEOPEN_WAV;
-        }
+        /* after a failure the frames are only taken */
+        if (!failed) {
+            unsigned long long write_start = opendcp_metrics_now();
+            Result_t           result      = RESULT_OK;
 
-        if (audio_desc_channel[file_index].ContainerDuration != audio_desc.ContainerDuration) {
-            OPENDCP_LOG(LOG_ERROR, "mismatched duration");
-            return OPENDCP_FILEOPEN_WAV;
-        }
+            if (ct_frame) {
+                result = dual->mxf_writer.WriteEncryptedFrame(*frame, *ct_frame, dual->writer_info.hmac_context);
+            }
+            else {
+                result = dual->mxf_writer.WriteFrame(*frame, dual->writer_info.aes_context, dual->writer_info.hmac_context);
+            }
 
-        frame_buffer_channel[file_index].Capacity(PCM::CalcFrameBufferSize(audio_desc_channel[file_index]));
-    }
+            opendcp_metrics_record(dual->opendcp->metrics, METRIC_WRITE, write_start, frame->Size());
+            failed = ASDCP_FAILURE(result);
+        }
 
-    if (ASDCP_FAILURE(result)) {
-        return OPENDCP_FILEOPEN_WAV;
+        pthread_mutex_lock(&dual->mutex);
+        dual->failed = failed;
+        dual->frame  = NULL;
+        pthread_cond_broadcast(&dual->cond);
     }
 
-    /*  set total audio characteristics */
-    for (file_index = 0; file_index < filelist->nfiles; file_index++) {
-        audio_desc.ChannelCount += audio_desc_channel[file_index].ChannelCount;
-    }
+    pthread_mutex_unlock(&dual->mutex);
 
-    audio_desc.BlockAlign = audio_desc.ChannelCount * 24 / 8;
-    audio_desc.EditRate = edit_rate;
-    audio_desc.AvgBps   = audio_desc.AvgBps * filelist->nfiles;
+    return NULL;
+}
 
-    /* set total frame buffer size */
-    frame_buffer.Capacity(PCM::CalcFrameBufferSize(audio_desc));
-    frame_buffer.Size(PCM::CalcFrameBufferSize(audio_desc));
+/* open the second track of opendcp->mxf.dual_file, NULL without one, frames is 0 if the length is not known */
+static int j2k_dual_open(opendcp_t *opendcp, const writer_info_t *primary, JP2K::PictureDescriptor &picture_desc,
+                         ui32_t frames, j2k_dual_t **out) {
+    j2k_dual_t *dual;
+    LabelSet_t label_set;
+    Result_t   result = RESULT_OK;
 
-    /* fill write info */
-    fill_writer_info(opendcp, &writer_info);
-    result = mxf_writer.OpenWrite(output_file, writer_info.info, audio_desc);
+    *out = NULL;
 
-    if (ASDCP_FAILURE(result)) {
-        return OPENDCP_FILEWRITE_MXF;
+    if (!opendcp->mxf.dual_file) {
+        return OPENDCP_NO_ERROR;
     }
 
-    /* set duration */
-    if (!opendcp->duration) {
-        mxf_duration = 0xffffffff;
+    if (primary->info.LabelSetType == LS_MXF_SMPTE) {
+        label_set = LS_MXF_INTEROP;
+    }
+    else if (primary->info.LabelSetType == LS_MXF_INTEROP) {
+        label_set = LS_MXF_SMPTE;
     }
     else {
-        mxf_duration = opendcp->duration;
+        OPENDCP_LOG(LOG_ERROR, "A dual track needs an SMPTE or Interop track to pair with");
+        return OPENDCP_FILEWRITE_MXF;
     }
 
-    /* start parsing */
-    while (ASDCP_SUCCESS(result) && mxf_duration--) {
-        byte_t *data_s = frame_buffer.Data();
-        byte_t *data_e = data_s + frame_buffer.Capacity();
-        byte_t sample_size = PCM::CalcSampleSize(audio_desc_channel[0]);
-        int    offset = 0;
-
-        /* read a frame from each file */
-        for (file_index = 0; file_index < filelist->nfiles; file_index++) {
-            memset(frame_buffer_channel[file_index].Data(), 0, frame_buffer_channel[file_index].Capacity());
-            result = pcm_parser_channel[file_index].ReadFrame(frame_buffer_channel[file_index]);
-
-            if (ASDCP_FAILURE(result)) {
-                continue;
-            }
-
-            if (frame_buffer_channel[file_index].Size() != frame_buffer_channel[file_index].Capacity()) {
-                OPENDCP_LOG(LOG_INFO, "frame size mismatch, expect size: %d did match actual size: %d",
-                            frame_buffer_channel[file_index].Capacity(), frame_buffer_channel[file_index].Size());
-                result = RESULT_ENDOFFILE;
-                continue;
-            }
-        }
-
-        /* write sample from each frame to output buffer */
-        if (ASDCP_SUCCESS(result)) {
-            while (data_s < data_e) {
-                for (file_index = 0; file_index < filelist->nfiles; file_index++) {
-                    byte_t *frame = frame_buffer_channel[file_index].Data() + offset;
-                    memcpy(data_s, frame, sample_size);
-                    data_s += sample_size;
-                }
+    if (opendcp->mxf.resume) {
+        OPENDCP_LOG(LOG_ERROR, "A track written with a dual track can not be resumed");
+        return OPENDCP_FILEWRITE_MXF;
+    }
 
-                offset += sample_size;
-            }
+    dual = new j2k_dual_t;
+    dual->writer_info.aes_context  = NULL;
+    dual->writer_info.hmac_context = NULL;
+    dual->opendcp     = opendcp;
+    dual->output_file = opendcp->mxf.dual_file;
+    dual->frame       = NULL;
+    dual->ct_frame    = NULL;
+    dual->failed      = 0;
+    dual->stop        = 0;
 
-            /* write the frame */
-            result = mxf_writer.WriteFrame(frame_buffer, writer_info.aes_context, writer_info.hmac_context);
+    result = fill_writer_info_labels(opendcp, &dual->writer_info, label_set);
 
-            /* frame done callback (also check for interrupt) */
-            opendcp->mxf.frame_done.callback(opendcp->mxf.frame_done.argument);
-        }
-    }
+    memcpy(dual->writer_info.info.CryptographicKeyID, primary->info.CryptographicKeyID, UUIDlen);
 
-    if (result == RESULT_ENDOFFILE) {
-        result = RESULT_OK;
+    if (ASDCP_SUCCESS(result)) {
+        result = dual->mxf_writer.OpenWrite(dual->output_file, dual->writer_info.info, picture_desc);
     }
 
     if (ASDCP_FAILURE(result)) {
+        OPENDCP_LOG(LOG_ERROR, "Could not open dual track %s", dual->output_file);
+        delete dual->writer_info.aes_context;
+        delete dual->writer_info.hmac_context;
+        delete dual;
         return OPENDCP_FILEWRITE_MXF;
     }
 
-    /* write footer information */
-    result = mxf_writer.Finalize();
+    if (opendcp->mxf.digest_flag) {
+        dual->mxf_writer.EnableFileDigest();
+    }
 
-    opendcp->mxf.file_done.callback(opendcp->mxf.file_done.argument);
+    mxf_async_io(dual->mxf_writer, opendcp);
+    mxf_index_spill(dual->mxf_writer, dual->output_file, frames ? frames : INDEX_SPILL_FRAMES);
+    mxf_preallocate(dual->mxf_writer, opendcp, dual->output_file, frames);
 
-    if (ASDCP_FAILURE(result)) {
-        return OPENDCP_FINALIZE_MXF;
-    }
+    pthread_mutex_init(&dual->mutex, NULL);
+    pthread_cond_init(&dual->cond, NULL);
+    pthread_create(&dual->thread, NULL, j2k_dual_thread, dual);
+
+    OPENDCP_LOG(LOG_INFO, "writing %s track %s alongside", label_set == LS_MXF_SMPTE ? "SMPTE" : "Interop", dual->output_file);
+    *out = dual;
 
     return OPENDCP_NO_ERROR;
 }
 
-/* write out timed text mxf file */
-int write_tt_mxf(opendcp_t *opendcp, filelist_t *filelist, char *output_file) {
-    TimedText::DCSubtitleParser    tt_parser;
-    TimedText::MXFWriter           mxf_writer;
-    TimedText::FrameBuffer         frame_buffer(FRAME_BUFFER_SIZE);
-    TimedText::TimedTextDescriptor tt_desc;
-    TimedText::ResourceList_t::const_iterator resource_iterator;
-    writer_info_t                  writer_info;
-    std::string                    xml_doc;
-    Result_t                       result = RESULT_OK;
+/* hand a frame to the second track, it must stay valid until j2k_dual_wait */
+static void j2k_dual_write(j2k_dual_t *dual, const JP2K::FrameBuffer &frame, const FrameBuffer *ct_frame) {
+    if (!dual) {
+        return;
+    }
 
-    result = tt_parser.OpenRead(filelist->files[0]);
+    pthread_mutex_lock(&dual->mutex);
+    dual->frame    = &frame;
+    dual->ct_frame = ct_frame;
+    pthread_cond_broadcast(&dual->cond);
+    pthread_mutex_unlock(&dual->mutex);
+}
 
-    if (ASDCP_FAILURE(result)) {
-        return OPENDCP_FILEOPEN_TT;
+/* wait until the second track has written the frame */
+static int j2k_dual_wait(j2k_dual_t *dual) {
+    int failed;
+
+    if (!dual) {
+        return OPENDCP_NO_ERROR;
     }
 
-    tt_parser.FillTimedTextDescriptor(tt_desc);
+    pthread_mutex_lock(&dual->mutex);
 
-    fill_writer_info(opendcp, &writer_info);
+    while (dual->frame) {
+        pthread_cond_wait(&dual->cond, &dual->mutex);
+    }
 
-    result = mxf_writer.OpenWrite(output_file, writer_info.info, tt_desc);
-    result = tt_parser.ReadTimedTextResource(xml_doc);
+    failed = dual->failed;
+    pthread_mutex_unlock(&dual->mutex);
 
-    if (ASDCP_FAILURE(result)) {
-        return OPENDCP_FILEOPEN_TT;
-    }
+    return failed ? OPENDCP_FILEWRITE_MXF : OPENDCP_NO_ERROR;
+}
 
-    result = mxf_writer.WriteTimedTextResource(xml_doc, writer_info.aes_context, writer_info.hmac_context);
+/* stop the second track's thread, finalize the track when the first one is complete, and free it */
+static int j2k_dual_close(j2k_dual_t *dual, int finalize) {
+    Result_t result = RESULT_OK;
+    byte_t   digest[20];
+    int      rc = OPENDCP_NO_ERROR;
 
-    if (ASDCP_FAILURE(result)) {
-        return OPENDCP_FILEWRITE_MXF;
+    if (!dual) {
+        return OPENDCP_NO_ERROR;
     }
 
-    resource_iterator = tt_desc.ResourceList.begin();
+    pthread_mutex_lock(&dual->mutex);
+    dual->stop = 1;
+    pthread_cond_broadcast(&dual->cond);
+    pthread_mutex_unlock(&dual->mutex);
+    pthread_join(dual->thread, NULL);
 
-    while (ASDCP_SUCCESS(result) && resource_iterator != tt_desc.ResourceList.end()) {
-        result = tt_parser.ReadAncillaryResource((*resource_iterator++).ResourceID, frame_buffer);
+    if (finalize && !dual->failed) {
+        result = dual->mxf_writer.Finalize();
 
         if (ASDCP_FAILURE(result)) {
-            return OPENDCP_FILEOPEN_TT;
+            OPENDCP_LOG(LOG_ERROR, "Could not finalize dual track %s", dual->output_file);
+            rc = OPENDCP_FINALIZE_MXF;
+        }
+        else if (dual->opendcp->mxf.digest_flag && ASDCP_SUCCESS(dual->mxf_writer.FileDigest(digest))) {
+            write_digest_sidecar(dual->opendcp, dual->output_file, digest);
         }
-
-        result = mxf_writer.WriteAncillaryResource(frame_buffer, writer_info.aes_context, writer_info.hmac_context);
-    }
-
-    if (result == RESULT_ENDOFFILE) {
-        result = RESULT_OK;
     }
-
-    if (ASDCP_FAILURE(result)) {
-        return OPENDCP_FILEWRITE_MXF;
+    else if (finalize) {
+        OPENDCP_LOG(LOG_ERROR, "Could not write dual track %s", dual->output_file);
+        rc = OPENDCP_FILEWRITE_MXF;
     }
 
-    result = mxf_writer.Finalize();
-
-    if (ASDCP_FAILURE(result)) {
-        return OPENDCP_FINALIZE_MXF;
-    }
+    pthread_cond_destroy(&dual->cond);
+    pthread_mutex_destroy(&dual->mutex);
+    delete dual->writer_info.aes_context;
+    delete dual->writer_info.hmac_context;
+    delete dual;
 
-    return OPENDCP_NO_ERROR;
+    return rc;
 }
 
-/* write out mpeg2 mxf file */
-int write_mpeg2_mxf(opendcp_t *opendcp, filelist_t *filelist, char *output_file) {
-    MPEG2::FrameBuffer     frame_buffer(FRAME_BUFFER_SIZE);
-    MPEG2::Parser          mpeg2_parser;
-    MPEG2::MXFWriter       mxf_writer;
-    MPEG2::VideoDescriptor video_desc;
-    writer_info_t          writer_info;
-    Result_t               result = RESULT_OK;
-    ui32_t                 mxf_duration;
+/*
+   Sharded wrapping for write_j2k_mxf. With mxf.shards above 1 a long
+   track is cut into that many runs of frames and each run is wrapped by
+   a thread of its own into a shard file, <output>.shard<n>, with the
+   AssetUUID and cryptographic context of the track and its integrity
+   packs numbered from the run's first frame. The track is then written
+   with one header, the runs appended with CopyFrames, which moves them
+   in the kernel where the system can, and one index and footer, so the
+   packets are the ones a single writer would have made.
+   The frame sizes are given to the bit rate statistics in frame order
+   once the shards are done, progress is reported from the shard threads.
+*/
+#define SHARDS_MAX       16
+#define SHARD_FRAMES_MIN 240
 
-    result = mpeg2_parser.OpenRead(filelist->files[0]);
+typedef struct {
+    opendcp_t               *opendcp;
+    filelist_t              *filelist;
+    opendcp_pack_t          *pack;
+    opendcp_manifest_t      *manifest;
+    const WriterInfo        *info;
+    JP2K::PictureDescriptor *picture_desc;
+    ui32_t                  *sizes;       /* codestream size of every frame of the track */
+    ui64_t                  bytes;
+    int                     stop;
+    mxf_progress_t          progress;
+    pthread_mutex_t         mutex;
+} j2k_shards_t;
 
-    if (ASDCP_FAILURE(result)) {
-        return OPENDCP_FILEOPEN_MPEG2;
-    }
+typedef struct {
+    j2k_shards_t *shards;
+    char         file[MAX_FILENAME_LENGTH];
+    ui32_t       first;                   /* frame of the track the run starts at */
+    ui32_t       start;                   /* input frame of the first frame */
+    ui32_t       count;
+    int          rc;
+    pthread_t    thread;
+} j2k_shard_t;
+
+static void *j2k_shard_thread(void *arg) {
+    j2k_shard_t            *shard  = (j2k_shard_t *)arg;
+    j2k_shards_t           *shards = shard->shards;
+    opendcp_t              *opendcp = shards->opendcp;
+    JP2K::MXFWriter        mxf_writer;
+    JP2K::CodestreamParser j2k_parser;
+    JP2K::FrameBuffer      frame_buffer(FRAME_BUFFER_SIZE);
+    AESEncContext          aes_context;
+    HMACContext            hmac_context;
+    AESEncContext          *aes = NULL;
+    HMACContext            *hmac = NULL;
+    Kumu::FortunaRNG       rng;
+    byte_t                 iv_buf[CBC_BLOCK_SIZE];
+    int                    stop = 0;
+
+    Result_t result = mxf_writer.OpenWrite(shard->file, *shards->info, *shards->picture_desc);
 
-    mpeg2_parser.FillVideoDescriptor(video_desc);
+    if (ASDCP_SUCCESS(result)) {
+        result = mxf_writer.SetFirstFrameNumber(shard->first);
+    }
 
-    fill_writer_info(opendcp, &writer_info);
+    if (ASDCP_SUCCESS(result) && shards->info->EncryptedEssence) {
+        aes = &aes_context;
+        result = aes_context.InitKey(opendcp->mxf.key_value);
 
-    result = mxf_writer.OpenWrite(output_file, writer_info.info, video_desc);
+        if (ASDCP_SUCCESS(result)) {
+            result = aes_context.SetIVec(rng.FillRandom(iv_buf, CBC_BLOCK_SIZE));
+        }
 
-    if (ASDCP_FAILURE(result)) {
-        return OPENDCP_FILEWRITE_MXF;
+        if (ASDCP_SUCCESS(result) && shards->info->UsesHMAC) {
+            hmac = &hmac_context;
+            result = hmac_context.InitKey(opendcp->mxf.key_value, shards->info->LabelSetType);
+        }
     }
 
-    result = mpeg2_parser.Reset();
-
     if (ASDCP_FAILURE(result)) {
-        return OPENDCP_PARSER_RESET;
-    }
-
-    if (!opendcp->duration) {
-        mxf_duration = 0xffffffff;
+        OPENDCP_LOG(LOG_ERROR, "Could not open shard %s", shard->file);
+        shard->rc = OPENDCP_FILEWRITE_MXF;
     }
     else {
-        mxf_duration = opendcp->duration;
+        mxf_async_io(mxf_writer, opendcp);
     }
 
-    while (ASDCP_SUCCESS(result) && mxf_duration--) {
-        result = mpeg2_parser.ReadFrame(frame_buffer);
+    for (ui32_t i = 0; shard->rc == OPENDCP_NO_ERROR && !stop && i < shard->count; i++) {
+        ui32_t             frame = shard->start + i;
+        unsigned long long read_start = opendcp_metrics_now();
+
+        if (shards->pack) {
+            unsigned int size = 0;
+
+            if (opendcp_pack_read(shards->pack, frame, frame_buffer.Data(), frame_buffer.Capacity(), &size) == OPENDCP_NO_ERROR) {
+                frame_buffer.Size(size);
+            }
+            else {
+                result = RESULT_READFAIL;
+            }
+        }
+        else {
+            result = j2k_parser.OpenReadFrame(shards->filelist->files[frame], frame_buffer);
+
+            if (ASDCP_SUCCESS(result) && shards->manifest &&
+                opendcp_manifest_check(shards->manifest, shards->filelist->files[frame], frame_buffer.RoData(), frame_buffer.Size()) != OPENDCP_NO_ERROR) {
+                result = RESULT_READFAIL;
+            }
+
+            if (opendcp->mxf.delete_intermediate) {
+                unlink(shards->filelist->files[frame]);
+            }
+        }
+
+        opendcp_metrics_record(opendcp->metrics, METRIC_READ, read_start, ASDCP_SUCCESS(result) ? frame_buffer.Size() : 0);
 
         if (ASDCP_FAILURE(result)) {
-            continue;
+            shard->rc = OPENDCP_FILEOPEN_J2K;
+            break;
         }
 
         if (opendcp->mxf.encrypt_header_flag) {
             frame_buffer.PlaintextOffset(0);
         }
 
-        result = mxf_writer.WriteFrame(frame_buffer, writer_info.aes_context, writer_info.hmac_context);
-    }
+        unsigned long long write_start = opendcp_metrics_now();
+        result = mxf_writer.WriteFrame(frame_buffer, aes, hmac);
+        opendcp_metrics_record(opendcp->metrics, METRIC_WRITE, write_start, frame_buffer.Size());
 
-    if (result == RESULT_ENDOFFILE) {
-        result = RESULT_OK;
-    }
+        if (ASDCP_FAILURE(result)) {
+            shard->rc = OPENDCP_FILEWRITE_MXF;
+            break;
+        }
 
-    if (ASDCP_FAILURE(result)) {
-        return OPENDCP_FILEWRITE_MXF;
+        shards->sizes[shard->first + i] = frame_buffer.Size();
+
+        pthread_mutex_lock(&shards->mutex);
+        shards->bytes += frame_buffer.Size();
+
+        if (!shards->stop && mxf_progress_frame(&shards->progress, frame_buffer.Size())) {
+            shards->stop = 1;
+        }
+
+        stop = shards->stop;
+        pthread_mutex_unlock(&shards->mutex);
     }
 
-    result = mxf_writer.Finalize();
+    if (shard->rc == OPENDCP_NO_ERROR && !stop && ASDCP_FAILURE(mxf_writer.Finalize())) {
+        shard->rc = OPENDCP_FINALIZE_MXF;
+    }
 
-    if (ASDCP_FAILURE(result)) {
-        return OPENDCP_FINALIZE_MXF;
+    /* one failed shard stops the others */
+    if (shard->rc != OPENDCP_NO_ERROR) {
+        pthread_mutex_lock(&shards->mutex);
+        shards->stop = 1;
+        pthread_mutex_unlock(&shards->mutex);
     }
 
-    return OPENDCP_NO_ERROR;
+    return NULL;
 }
 
-extern "C" int read_j2k_mxf(opendcp_t *opendcp, const char *mxf_file) {
-    AESDecContext     *context = 0;
-    HMACContext       *hmac = 0;
-    JP2K::MXFReader    reader;
-    JP2K::FrameBuffer  frame_buffer(FRAME_BUFFER_SIZE);
-    ui32_t             frame_count = 0;
+/* true when write_j2k_mxf_frames hands the track to write_j2k_mxf_shards */
+static int j2k_shards_usable(opendcp_t *opendcp, ui32_t duration) {
+    return opendcp->mxf.shards > 1 && duration >= SHARD_FRAMES_MIN * 2 && !opendcp->mxf.slide &&
+           !opendcp->mxf.resume && !opendcp->mxf.checkpoint && !opendcp->mxf.dual_file && !opendcp->mxf.upload;
+}
 
-    Result_t result = reader.OpenRead(mxf_file);
+/* write out j2k mxf file, duration frames from input frame start_frame, in runs wrapped at once */
+static int write_j2k_mxf_shards(opendcp_t *opendcp, filelist_t *filelist, opendcp_pack_t *pack, char *output_file,
+                                writer_info_t *writer_info, JP2K::PictureDescriptor &picture_desc,
+                                ui32_t start_frame, ui32_t duration) {
+    JP2K::MXFWriter   mxf_writer;
+    j2k_shards_t      shards;
+    j2k_shard_t       shard[SHARDS_MAX];
+    int               started[SHARDS_MAX];
+    opendcp_bitrate_t *bitrate;
+    byte_t            digest[20];
+    struct timeval    start_time;
+    Result_t          result = RESULT_OK;
+    int               nshards, s;
+    int               rc = OPENDCP_NO_ERROR;
+
+    nshards = opendcp->mxf.shards > SHARDS_MAX ? SHARDS_MAX : opendcp->mxf.shards;
+
+    if (duration / nshards < SHARD_FRAMES_MIN) {
+        nshards = duration / SHARD_FRAMES_MIN;
+    }
 
-    if (!ASDCP_SUCCESS(result)) {
-        OPENDCP_LOG(LOG_ERROR, "Could not read file");
-        return OPENDCP_FILEREAD_MXF;
+    shards.opendcp      = opendcp;
+    shards.filelist     = filelist;
+    shards.pack         = pack;
+    shards.manifest     = pack ? NULL : opendcp_manifest_load(filelist->files[0]);
+    shards.info         = &writer_info->info;
+    shards.picture_desc = &picture_desc;
+    shards.sizes        = new ui32_t[duration];
+    shards.bytes        = 0;
+    shards.stop         = 0;
+    pthread_mutex_init(&shards.mutex, NULL);
+    mxf_progress_init(&shards.progress, opendcp);
+
+    opendcp_metrics_threads(opendcp->metrics, METRIC_READ, nshards);
+    opendcp_metrics_threads(opendcp->metrics, METRIC_WRITE, nshards);
+
+    OPENDCP_LOG(LOG_INFO, "wrapping %u frames of %s in %d shards", duration, output_file, nshards);
+    gettimeofday(&start_time, NULL);
+
+    for (s = 0; s < nshards; s++) {
+        shard[s].shards = &shards;
+        shard[s].first  = (ui32_t)((ui64_t)duration * s / nshards);
+        shard[s].count  = (ui32_t)((ui64_t)duration * (s + 1) / nshards) - shard[s].first;
+        shard[s].start  = start_frame + shard[s].first;
+        shard[s].rc     = OPENDCP_NO_ERROR;
+        snprintf(shard[s].file, sizeof(shard[s].file), "%s.shard%d", output_file, s);
+        unlink(shard[s].file);
+        started[s] = pthread_create(&shard[s].thread, NULL, j2k_shard_thread, &shard[s]) == 0;
+
+        /* the shards already running stop at their next frame */
+        if (!started[s]) {
+            OPENDCP_LOG(LOG_ERROR, "Could not start the thread of shard %d", s);
+            shard[s].rc = OPENDCP_FILEWRITE_MXF;
+            pthread_mutex_lock(&shards.mutex);
+            shards.stop = 1;
+            pthread_mutex_unlock(&shards.mutex);
+        }
     }
 
-    JP2K::PictureDescriptor picture_desc;
-    reader.FillPictureDescriptor(picture_desc);
+    for (s = 0; s < nshards; s++) {
+        if (started[s]) {
+            pthread_join(shard[s].thread, NULL);
+        }
 
-    frame_count = picture_desc.ContainerDuration;
-    OPENDCP_LOG(LOG_INFO, "Detected %d frames", frame_count);
+        if (rc == OPENDCP_NO_ERROR) {
+            rc = shard[s].rc;
+        }
+    }
 
-    if (opendcp->mxf.key_flag) {
-        OPENDCP_LOG(LOG_INFO, "Initialize decryption key");
-        context = new AESDecContext;
-        result = context->InitKey(opendcp->mxf.key_value);
+    double seconds = elapsed_seconds(&start_time);
+    OPENDCP_LOG(LOG_INFO, "wrapped %u frames, %.1f MB in %.2fs, %.1f MB/s", duration, shards.bytes / 1048576.0, seconds,
+                seconds > 0 ? shards.bytes / 1048576.0 / seconds : 0.0);
 
-        if (ASDCP_SUCCESS(result)) {
-            WriterInfo info;
-            reader.FillWriterInfo(info);
+    /* the statistics and the bit rate limit see the frames in order */
+    if (rc == OPENDCP_NO_ERROR && !shards.stop) {
+        bitrate = opendcp_bitrate_create(opendcp, 0);
 
-            if (info.UsesHMAC) {
-                hmac = new HMACContext;
-                result = hmac->InitKey(opendcp->mxf.key_value, info.LabelSetType);
+        for (ui32_t i = 0; rc == OPENDCP_NO_ERROR && i < duration; i++) {
+            if (opendcp_bitrate_add(bitrate, shards.sizes[i]) != OPENDCP_NO_ERROR) {
+                rc = OPENDCP_BITRATE;
             }
-            else {
-                OPENDCP_LOG(LOG_ERROR, "File does not contain HMAC values");
-            }
-        }
-        else {
-            OPENDCP_LOG(LOG_ERROR, "Failed to load decryption key");
         }
+
+        bitrate_done(opendcp, bitrate);
     }
 
-    ui32_t last_frame = opendcp->mxf.start_frame + (opendcp->mxf.duration ? opendcp->mxf.duration : frame_count);
+    /* stitch the runs together under one header and index */
+    if (rc == OPENDCP_NO_ERROR && !shards.stop) {
+        result = mxf_writer.OpenWrite(output_file, writer_info->info, picture_desc);
 
-    if ( last_frame > frame_count ) {
-        last_frame = frame_count;
-    }
+        if (ASDCP_SUCCESS(result)) {
+            if (opendcp->mxf.digest_flag) {
+                mxf_writer.EnableFileDigest();
+            }
 
-    char name_format[64];
-    snprintf(name_format,  64, "%%s%%0%du.j2c", 6);
+            mxf_async_io(mxf_writer, opendcp);
+            mxf_index_spill(mxf_writer, output_file, duration);
+            mxf_preallocate(mxf_writer, opendcp, output_file, duration);
+        }
 
-    for ( ui32_t i = opendcp->mxf.start_frame; ASDCP_SUCCESS(result) && i < last_frame; i++ ) {
-        result = reader.ReadFrame(i, frame_buffer, context, hmac);
+        for (s = 0; ASDCP_SUCCESS(result) && s < nshards; s++) {
+            result = mxf_writer.CopyFrames(shard[s].file, 0, shard[s].count);
+        }
 
-        if (!ASDCP_SUCCESS(result)) {
-            OPENDCP_LOG(LOG_ERROR, "Failed to extract frame %d (%s)", i, result.Label());
-            continue;
+        if (ASDCP_FAILURE(result)) {
+            OPENDCP_LOG(LOG_ERROR, "Could not join the shards of %s", output_file);
+            rc = OPENDCP_FILEWRITE_MXF;
         }
+        else {
+            mxf_progress_flush(&shards.progress);
 
-        Kumu::FileWriter output;
-        char filename[256];
-        ui32_t write_count;
-        snprintf(filename, 256, name_format, "opendcp_extract_", i);
-        result = output.OpenWrite(filename);
+            if (ASDCP_FAILURE(mxf_writer.Finalize())) {
+                rc = OPENDCP_FINALIZE_MXF;
+            }
 
-        if (ASDCP_SUCCESS(result)) {
-            result = output.Write(frame_buffer.Data(), frame_buffer.Size(), &write_count);
+            /* file done callback */
+            opendcp->mxf.file_done.callback(opendcp->mxf.file_done.argument);
         }
 
-        if (!ASDCP_SUCCESS(result)) {
-            OPENDCP_LOG(LOG_ERROR, "Failed to write file %s", filename);
+        if (rc == OPENDCP_NO_ERROR && opendcp->mxf.digest_flag && ASDCP_SUCCESS(mxf_writer.FileDigest(digest))) {
+            write_digest_sidecar(opendcp, output_file, digest);
         }
     }
 
+    for (s = 0; s < nshards; s++) {
+        unlink(shard[s].file);
+    }
+
+    pthread_mutex_destroy(&shards.mutex);
+    opendcp_manifest_close(shards.manifest);
+    delete [] shards.sizes;
+
+    return rc;
+}
+
+/* write out j2k mxf file, the frames are the files of the list or the frames of a store */
+static int write_j2k_mxf_frames(opendcp_t *opendcp, filelist_t *filelist, opendcp_pack_t *pack, char *output_file) {
+    mxf_upload              upload;
+    JP2K::MXFWriter         mxf_writer;
+    JP2K::PictureDescriptor picture_desc;
+    JP2K::CodestreamParser  j2k_parser;
+    writer_info_t           writer_info;
+    byte_t                  digest[20];
+    Result_t                result = RESULT_OK;
+    ui32_t                  start_frame;
+    ui32_t                  mxf_duration;
+    ui32_t                  slide_duration = 0;
+    j2k_prefetch_t          prefetch;
+    pthread_t               threads[PREFETCH_THREADS_MAX];
+    int                     nthreads, t;
+    ui64_t                  bytes = 0;
+    ui32_t                  frames = 0;
+    struct timeval          start_time;
+    opendcp_bitrate_t       *bitrate;
+    j2k_dual_t              *dual;
+    mxf_progress_t          progress;
+    mxf_checkpoint_t        checkpoint;
+    ui32_t                  recovered = 0;
+    int                     resume = 0;
+    int                     cancelled = 0;
+    int                     rc = OPENDCP_NO_ERROR;
+    int                     dual_rc;
+    int                     nframes = pack ? (int)opendcp_pack_count(pack) : filelist->nfiles;
+
+    /* set the starting frame */
+    if (opendcp->mxf.start_frame && nframes >= (opendcp->mxf.start_frame - 1)) {
+        start_frame = opendcp->mxf.start_frame - 1;  /* adjust for zero base */
+    }
+    else {
+        start_frame = 0;
+    }
+
+    if ((int)start_frame >= nframes) {
+        return OPENDCP_FILEOPEN_J2K;
+    }
+
+    if (pack) {
+        JP2K::FrameBuffer frame_buffer(FRAME_BUFFER_SIZE);
+        unsigned int      size = 0;
+
+        if (opendcp_pack_read(pack, start_frame, frame_buffer.Data(), frame_buffer.Capacity(), &size) != OPENDCP_NO_ERROR) {
+            return OPENDCP_FRAME_STORE;
+        }
+
+        frame_buffer.Size(size);
+        result = JP2K::ParseMetadataIntoDesc(frame_buffer, picture_desc);
+    }
+    else {
+        OPENDCP_LOG(LOG_DEBUG, "j2k_parser.OpenReadHeader(%s)", filelist->files[start_frame]);
+        result = j2k_parser.OpenReadHeader(filelist->files[start_frame]);
+
+        if (ASDCP_SUCCESS(result)) {
+            j2k_parser.FillPictureDescriptor(picture_desc);
+        }
+    }
+
+    if (ASDCP_FAILURE(result)) {
+        return OPENDCP_FILEOPEN_J2K;
+    }
+
+    Rational edit_rate(opendcp->frame_rate, 1);
+    picture_desc.EditRate = edit_rate;
+
+    fill_writer_info(opendcp, &writer_info);
+
+    /* set the duration of the output mxf */
+    if (opendcp->mxf.slide) {
+        mxf_duration = opendcp->mxf.duration;
+        slide_duration = mxf_duration / nframes;
+    }
+    else if (opendcp->mxf.duration && (nframes >= opendcp->mxf.duration)) {
+        mxf_duration = opendcp->mxf.duration;
+    }
+    else {
+        mxf_duration = nframes;
+    }
+
+    /* a long track is wrapped in runs of frames at once */
+    if (j2k_shards_usable(opendcp, mxf_duration) && start_frame + mxf_duration <= (ui32_t)nframes) {
+        return write_j2k_mxf_shards(opendcp, filelist, pack, output_file, &writer_info, picture_desc, start_frame, mxf_duration);
+    }
+
+    /* the header of a resumed file is rebuilt with the identifiers it was started with */
+    if (opendcp->mxf.resume && !opendcp->mxf.slide) {
+        resume = read_resume_sidecar(output_file, &checkpoint);
+
+        if (!resume) {
+            OPENDCP_LOG(LOG_WARN, "No checkpoint for %s, writing it from the start", output_file);
+        }
+        else if (checkpoint.start_frame != start_frame || checkpoint.duration != mxf_duration ||
+                 checkpoint.label_set != (int)writer_info.info.LabelSetType ||
+                 checkpoint.encrypted != (int)writer_info.info.EncryptedEssence ||
+                 checkpoint.hmac != (int)writer_info.info.UsesHMAC) {
+            OPENDCP_LOG(LOG_ERROR, "%s was started with other frames or settings, it cannot be resumed", output_file);
+            return OPENDCP_FILEWRITE_MXF;
+        }
+        else {
+            memcpy(writer_info.info.AssetUUID, checkpoint.asset_uuid, UUIDlen);
+            memcpy(writer_info.info.ContextID, checkpoint.context_id, UUIDlen);
+            memcpy(writer_info.info.CryptographicKeyID, checkpoint.key_id, UUIDlen);
+        }
+    }
+
+    if (resume) {
+        result = mxf_writer.OpenResume(output_file, writer_info.info, picture_desc);
+    }
+    else {
+        result = mxf_writer.OpenWrite(output_file, writer_info.info, picture_desc);
+    }
+
+    if (ASDCP_FAILURE(result)) {
+        return OPENDCP_FILEWRITE_MXF;
+    }
+
+    if (opendcp->mxf.digest_flag) {
+        mxf_writer.EnableFileDigest();
+    }
+
+    /* a resumed file is cut back to its checkpoint, which an upload can not follow */
+    if (opendcp->mxf.upload && resume) {
+        OPENDCP_LOG(LOG_ERROR, "a resumed mxf can not be uploaded while it is written");
+        return OPENDCP_UPLOAD;
+    }
+
+    if (upload.open(mxf_writer, opendcp) != OPENDCP_NO_ERROR) {
+        return OPENDCP_UPLOAD;
+    }
+
+    /* queue the file writes in large blocks, overlapped with the wrapping where io_uring is available */
+    mxf_async_io(mxf_writer, opendcp);
+    mxf_index_spill(mxf_writer, output_file, nframes);
+    mxf_preallocate(mxf_writer, opendcp, output_file, mxf_duration);
+
+    /* keep the frames of the last checkpoint that are complete in the file, then go on after them */
+    if (resume) {
+        if (ASDCP_FAILURE(mxf_writer.ResumeFrames(checkpoint.frames, recovered))) {
+            return OPENDCP_FILEWRITE_MXF;
+        }
+
+        OPENDCP_LOG(LOG_INFO, "resuming %s after frame %u", output_file, recovered);
+        start_frame  += recovered;
+        mxf_duration -= recovered;
+    }
+
+    if (opendcp->mxf.checkpoint > 0 && !opendcp->mxf.slide) {
+        checkpoint.frames      = recovered;
+        checkpoint.start_frame = start_frame - recovered;
+        checkpoint.duration    = mxf_duration + recovered;
+        checkpoint.label_set   = writer_info.info.LabelSetType;
+        checkpoint.encrypted   = writer_info.info.EncryptedEssence;
+        checkpoint.hmac        = writer_info.info.UsesHMAC;
+        memcpy(checkpoint.asset_uuid, writer_info.info.AssetUUID, UUIDlen);
+        memcpy(checkpoint.context_id, writer_info.info.ContextID, UUIDlen);
+        memcpy(checkpoint.key_id, writer_info.info.CryptographicKeyID, UUIDlen);
+        write_resume_sidecar(output_file, &checkpoint);
+    }
+
+    rc = j2k_dual_open(opendcp, &writer_info, picture_desc, mxf_duration, &dual);
+
+    if (rc != OPENDCP_NO_ERROR) {
+        return rc;
+    }
+
+    /* start the read-ahead, files are read once each and in order */
+    nthreads = opendcp->threads > 0 ? opendcp->threads : 2;
+    nthreads = nthreads > PREFETCH_THREADS_MAX ? PREFETCH_THREADS_MAX : nthreads;
+
+    memset(&prefetch, 0, sizeof(prefetch));
+    prefetch.opendcp  = opendcp;
+    prefetch.filelist = filelist;
+    prefetch.pack     = pack;
+    prefetch.manifest = pack ? NULL : opendcp_manifest_load(filelist->files[0]);
+    prefetch.encrypt  = writer_info.aes_context != NULL;
+    prefetch.start    = start_frame;
+    prefetch.count    = nframes - start_frame;
+    prefetch.nslots   = nthreads * 2;
+    prefetch.slots    = new j2k_prefetch_slot_t[prefetch.nslots];
+
+    if (!opendcp->mxf.slide && prefetch.count > mxf_duration) {
+        prefetch.count = mxf_duration;
+    }
+
+    for (ui32_t k = 0; k < prefetch.nslots; k++) {
+        prefetch.slots[k].frame_buffer = new JP2K::FrameBuffer(FRAME_BUFFER_SIZE);
+        prefetch.slots[k].ct_buffer    = prefetch.encrypt ? new FrameBuffer : NULL;
+        prefetch.slots[k].ready        = 0;
+    }
+
+    pthread_mutex_init(&prefetch.mutex, NULL);
+    pthread_cond_init(&prefetch.cond, NULL);
+
+    for (t = 0; t < nthreads; t++) {
+        pthread_create(&threads[t], NULL, j2k_prefetch_thread, &prefetch);
+    }
+
+    opendcp_metrics_threads(opendcp->metrics, METRIC_READ, nthreads);
+    opendcp_metrics_threads(opendcp->metrics, METRIC_WRITE, dual ? 2 : 1);
+
+    bitrate = opendcp_bitrate_create(opendcp, 0);
+    gettimeofday(&start_time, NULL);
+    mxf_progress_init(&progress, opendcp);
+    opendcp->mxf.progress.frames = progress.reported = recovered;
+
+    ui32_t read  = 1;
+    ui32_t seq   = 0;
+    j2k_prefetch_slot_t *slot = NULL;
+
+    /* take each input frame from the read-ahead and write to the output mxf until duration is reached */
+    while ( ASDCP_SUCCESS(result) && mxf_duration--) {
+        if (read) {
+            if (slot) {
+                j2k_prefetch_release(&prefetch, seq++);
+                slot = NULL;
+            }
+
+            if (seq >= prefetch.count) {
+                rc = OPENDCP_FILEOPEN_J2K;
+                break;
+            }
+
+            slot = j2k_prefetch_get(&prefetch, seq);
+
+            if (slot->failed) {
+                rc = OPENDCP_FILEOPEN_J2K;
+                break;
+            }
+
+            read = 0;
+        }
+
+        if (opendcp->mxf.slide) {
+            if (mxf_duration % slide_duration == 0) {
+                read = 1;
+            }
+        }
+        else {
+            read = 1;
+        }
+
+        /* write the frame, to the dual track at the same time */
+        j2k_dual_write(dual, *slot->frame_buffer, prefetch.encrypt ? slot->ct_buffer : NULL);
+        unsigned long long write_start = opendcp_metrics_now();
+
+        if (prefetch.encrypt) {
+            result = mxf_writer.WriteEncryptedFrame(*slot->frame_buffer, *slot->ct_buffer, writer_info.hmac_context);
+        }
+        else {
+            result = mxf_writer.WriteFrame(*slot->frame_buffer, writer_info.aes_context, writer_info.hmac_context);
+        }
+
+        opendcp_metrics_record(opendcp->metrics, METRIC_WRITE, write_start, slot->frame_buffer->Size());
+
+        if (j2k_dual_wait(dual) != OPENDCP_NO_ERROR) {
+            rc = OPENDCP_FILEWRITE_MXF;
+            break;
+        }
+        bytes += slot->frame_buffer->Size();
+        frames++;
+
+        if (ASDCP_SUCCESS(result) && opendcp_bitrate_add(bitrate, slot->frame_buffer->Size()) != OPENDCP_NO_ERROR) {
+            rc = OPENDCP_BITRATE;
+            break;
+        }
+
+        /* frame done callback (also check for interrupt) */
+        if (mxf_progress_frame(&progress, slot->frame_buffer->Size())) {
+            cancelled = 1;
+            break;
+        }
+
+        if (opendcp->mxf.checkpoint > 0 && !opendcp->mxf.slide && ASDCP_SUCCESS(result) &&
+            (recovered + frames) % opendcp->mxf.checkpoint == 0) {
+            mxf_checkpoint(mxf_writer, output_file, &checkpoint);
+        }
+    }
+
+    /* an interrupted file can be resumed from its last frame */
+    if (cancelled && opendcp->mxf.checkpoint > 0 && !opendcp->mxf.slide && ASDCP_SUCCESS(result)) {
+        mxf_checkpoint(mxf_writer, output_file, &checkpoint);
+    }
+
+    j2k_prefetch_stop(&prefetch);
+
+    for (t = 0; t < nthreads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+
+    bitrate_done(opendcp, bitrate);
+
+    double seconds = elapsed_seconds(&start_time);
+    OPENDCP_LOG(LOG_INFO, "wrapped %u frames, %.1f MB in %.2fs, %.1f MB/s", frames, bytes / 1048576.0, seconds,
+                seconds > 0 ? bytes / 1048576.0 / seconds : 0.0);
+
+    pthread_cond_destroy(&prefetch.cond);
+    pthread_mutex_destroy(&prefetch.mutex);
+    opendcp_manifest_close(prefetch.manifest);
+
+    for (ui32_t k = 0; k < prefetch.nslots; k++) {
+        delete prefetch.slots[k].frame_buffer;
+        delete prefetch.slots[k].ct_buffer;
+    }
+
+    delete [] prefetch.slots;
+
+    if (result == RESULT_ENDOFFILE) {
+        result = RESULT_OK;
+    }
+
+    /* the dual track is finalized first, the digest of the first track is the one kept in mxf.digest */
+    dual_rc = j2k_dual_close(dual, rc == OPENDCP_NO_ERROR && !cancelled && ASDCP_SUCCESS(result));
+
+    if (rc != OPENDCP_NO_ERROR || cancelled) {
+        return rc;
+    }
+
+    if (ASDCP_FAILURE(result)) {
+        return OPENDCP_FILEWRITE_MXF;
+    }
+
+    mxf_progress_flush(&progress);
+    result = mxf_writer.Finalize();
+
+    if (ASDCP_SUCCESS(result)) {
+        remove_resume_sidecar(output_file);
+    }
+
+    /* file done callback */
+    opendcp->mxf.file_done.callback(opendcp->mxf.file_done.argument);
+
+    if (ASDCP_FAILURE(result)) {
+        return OPENDCP_FINALIZE_MXF;
+    }
+
+    if (upload.close() != OPENDCP_NO_ERROR) {
+        return OPENDCP_UPLOAD;
+    }
+
+    if (opendcp->mxf.digest_flag && ASDCP_SUCCESS(mxf_writer.FileDigest(digest))) {
+        write_digest_sidecar(opendcp, output_file, digest);
+    }
+
+    return dual_rc;
+}
+
+/* write out j2k mxf file, a single input that is a frame store is read front to back */
+int write_j2k_mxf(opendcp_t *opendcp, filelist_t *filelist, char *output_file) {
+    opendcp_pack_t *pack;
+    int            rc;
+
+    if (filelist->nfiles != 1 || !opendcp_pack_is(filelist->files[0])) {
+        return write_j2k_mxf_frames(opendcp, filelist, NULL, output_file);
+    }
+
+    pack = opendcp_pack_open(filelist->files[0]);
+
+    if (!pack) {
+        return OPENDCP_FRAME_STORE;
+    }
+
+    rc = write_j2k_mxf_frames(opendcp, filelist, pack, output_file);
+    opendcp_pack_close(pack);
+
+    if (rc == OPENDCP_NO_ERROR && opendcp->mxf.delete_intermediate) {
+        unlink(filelist->files[0]);
+    }
+
+    return rc;
+}
+
+/* j2k mxf writer fed with codestreams held in memory */
+struct j2k_mxf_writer {
+    JP2K::MXFWriter         mxf_writer;
+    JP2K::PictureDescriptor picture_desc;
+    writer_info_t           writer_info;
+    opendcp_t               *opendcp;
+    char                    *output_file;
+    opendcp_bitrate_t       *bitrate;
+    j2k_dual_t              *dual;
+    int                     open;
+};
+
+extern "C" j2k_mxf_writer_t *j2k_mxf_writer_open(opendcp_t *opendcp, char *output_file) {
+    j2k_mxf_writer_t *writer = new j2k_mxf_writer_t;
+
+    writer->writer_info.aes_context  = NULL;
+    writer->writer_info.hmac_context = NULL;
+    writer->opendcp     = opendcp;
+    writer->output_file = output_file;
+    writer->bitrate     = opendcp_bitrate_create(opendcp, 0);
+    writer->dual        = NULL;
+    writer->open        = 0;
+
+    return writer;
+}
+
+/* write one frame, the mxf file is created from the first frame's descriptor */
+extern "C" int j2k_mxf_writer_write(j2k_mxf_writer_t *writer, unsigned char *data, int length) {
+    JP2K::FrameBuffer frame_buffer;
+    Result_t          result = RESULT_OK;
+    byte_t            start_of_data = 0;
+
+    frame_buffer.SetData(data, length);
+    frame_buffer.Size(length);
+
+    if (!writer->open) {
+        result = JP2K::ParseMetadataIntoDesc(frame_buffer, writer->picture_desc, &start_of_data);
+
+        if (ASDCP_FAILURE(result)) {
+            return OPENDCP_FILEOPEN_J2K;
+        }
+
+        Rational edit_rate(writer->opendcp->frame_rate, 1);
+        writer->picture_desc.EditRate = edit_rate;
+
+        fill_writer_info(writer->opendcp, &writer->writer_info);
+
+        result = writer->mxf_writer.OpenWrite(writer->output_file, writer->writer_info.info, writer->picture_desc);
+
+        if (ASDCP_FAILURE(result)) {
+            return OPENDCP_FILEWRITE_MXF;
+        }
+
+        if (writer->opendcp->mxf.digest_flag) {
+            writer->mxf_writer.EnableFileDigest();
+        }
+
+        mxf_async_io(writer->mxf_writer, writer->opendcp);
+        mxf_index_spill(writer->mxf_writer, writer->output_file, INDEX_SPILL_FRAMES);
+
+        if (j2k_dual_open(writer->opendcp, &writer->writer_info, writer->picture_desc, 0, &writer->dual) != OPENDCP_NO_ERROR) {
+            return OPENDCP_FILEWRITE_MXF;
+        }
+
+        writer->open = 1;
+    }
+    else {
+        JP2K::PictureDescriptor picture_desc;
+        result = JP2K::ParseMetadataIntoDesc(frame_buffer, picture_desc, &start_of_data);
+
+        if (ASDCP_FAILURE(result)) {
+            return OPENDCP_FILEOPEN_J2K;
+        }
+    }
+
+    if (writer->opendcp->mxf.encrypt_header_flag) {
+        frame_buffer.PlaintextOffset(0);
+    }
+    else {
+        frame_buffer.PlaintextOffset(start_of_data);
+    }
+
+    j2k_dual_write(writer->dual, frame_buffer, NULL);
+    result = writer->mxf_writer.WriteFrame(frame_buffer, writer->writer_info.aes_context, writer->writer_info.hmac_context);
+
+    if (j2k_dual_wait(writer->dual) != OPENDCP_NO_ERROR || ASDCP_FAILURE(result)) {
+        return OPENDCP_FILEWRITE_MXF;
+    }
+
+    return opendcp_bitrate_add(writer->bitrate, length);
+}
+
+/* finalize the mxf file and free the writer */
+extern "C" int j2k_mxf_writer_close(j2k_mxf_writer_t *writer) {
+    Result_t result = RESULT_OK;
+    int      open   = writer->open;
+    byte_t   digest[20];
+    int      dual_rc;
+
+    dual_rc = j2k_dual_close(writer->dual, open);
+
+    if (open) {
+        result = writer->mxf_writer.Finalize();
+        writer->opendcp->mxf.file_done.callback(writer->opendcp->mxf.file_done.argument);
+
+        if (ASDCP_SUCCESS(result) && writer->opendcp->mxf.digest_flag &&
+            ASDCP_SUCCESS(writer->mxf_writer.FileDigest(digest))) {
+            write_digest_sidecar(writer->opendcp, writer->output_file, digest);
+        }
+    }
+
+    bitrate_done(writer->opendcp, writer->bitrate);
+
+    delete writer->writer_info.aes_context;
+    delete writer->writer_info.hmac_context;
+    delete writer;
+
+    if (!open) {
+        return OPENDCP_FILEWRITE_MXF;
+    }
+
+    if (ASDCP_FAILURE(result)) {
+        return OPENDCP_FINALIZE_MXF;
+    }
+
+    return dual_rc;
+}
+
+/* rename the finished file over the one it replaces */
+static int replace_commit(const char *temp_file, const char *output_file) {
+#ifdef _WIN32
+    unlink(output_file);
+#endif
+
+    if (rename(temp_file, output_file)) {
+        OPENDCP_LOG(LOG_ERROR, "Could not rename %s to %s", temp_file, output_file);
+        unlink(temp_file);
+        return OPENDCP_FILEWRITE_MXF;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*!
+ @function replace_j2k_mxf
+ @abstract Writes a picture track with a run of its frames replaced.
+ @discussion The frames before and after the run are copied from the
+             existing track as stored, without being parsed or decrypted,
+             with copy_file_range where the kernel allows it. Only the new
+             codestreams are wrapped, and encrypted with mxf.key_value when
+             the track is encrypted. The asset, context and key ids are
+             kept, so the track replaces the old one in a CPL, and the
+             index and footer are written again.
+ @param opendcp The options, mxf.key_value must be the key of an encrypted track.
+ @param mxf_file The existing flat 2D picture track.
+ @param filelist The new codestreams, one per frame replaced.
+ @param first_frame The first frame replaced, counted from 0.
+ @param output_file The new track, which may be mxf_file itself.
+ @return OPENDCP_NO_ERROR, OPENDCP_FILEREAD_MXF, OPENDCP_FILEOPEN_J2K,
+         OPENDCP_FILEWRITE_MXF or OPENDCP_FINALIZE_MXF.
+*/
+extern "C" int replace_j2k_mxf(opendcp_t *opendcp, const char *mxf_file, filelist_t *filelist, int first_frame,
+                               const char *output_file) {
+    JP2K::MXFReader         reader;
+    JP2K::MXFWriter         mxf_writer;
+    JP2K::PictureDescriptor picture_desc;
+    JP2K::CodestreamParser  j2k_parser;
+    JP2K::FrameBuffer       frame_buffer(FRAME_BUFFER_SIZE);
+    writer_info_t           writer_info;
+    mxf_progress_t          progress;
+    opendcp_manifest_t      *manifest;
+    byte_t                  digest[20];
+    char                    temp_file[MAX_FILENAME_LENGTH + 16];
+    const char              *write_file = output_file;
+    ui32_t                  duration, tail, i;
+    Result_t                result = RESULT_OK;
+    int                     rc = OPENDCP_NO_ERROR;
+
+    writer_info.aes_context  = NULL;
+    writer_info.hmac_context = NULL;
+
+    result = reader.OpenRead(mxf_file);
+
+    if (ASDCP_SUCCESS(result)) {
+        result = reader.FillPictureDescriptor(picture_desc);
+    }
+
+    if (ASDCP_SUCCESS(result)) {
+        result = reader.FillWriterInfo(writer_info.info);
+    }
+
+    if (ASDCP_FAILURE(result)) {
+        OPENDCP_LOG(LOG_ERROR, "Could not read picture track %s", mxf_file);
+        return OPENDCP_FILEREAD_MXF;
+    }
+
+    duration = picture_desc.ContainerDuration;
+
+    if (first_frame < 0 || filelist->nfiles < 1 || (ui64_t)first_frame + filelist->nfiles > duration) {
+        OPENDCP_LOG(LOG_ERROR, "Frames %d to %d are not in %s, it has %u frames", first_frame + 1,
+                    first_frame + filelist->nfiles, mxf_file, duration);
+        return OPENDCP_FILEREAD_MXF;
+    }
+
+    /* the new frames are encrypted as the old ones, the key is checked on a frame being replaced */
+    if (writer_info.info.EncryptedEssence) {
+        AESDecContext dec_context;
+        HMACContext   hmac_check;
+        HMACContext   *hmac = NULL;
+
+        if (!opendcp->mxf.key_flag) {
+            OPENDCP_LOG(LOG_ERROR, "%s is encrypted, its key is needed to encrypt the new frames", mxf_file);
+            return OPENDCP_FILEREAD_MXF;
+        }
+
+        if (writer_info.info.UsesHMAC && ASDCP_SUCCESS(hmac_check.InitKey(opendcp->mxf.key_value,
+                                                                           writer_info.info.LabelSetType))) {
+            hmac = &hmac_check;
+        }
+
+        if (ASDCP_FAILURE(dec_context.InitKey(opendcp->mxf.key_value)) ||
+            ASDCP_FAILURE(reader.ReadFrame(first_frame, frame_buffer, &dec_context, hmac))) {
+            OPENDCP_LOG(LOG_ERROR, "The key does not decrypt %s", mxf_file);
+            return OPENDCP_FILEREAD_MXF;
+        }
+
+        Kumu::FortunaRNG rng;
+        byte_t           iv_buf[CBC_BLOCK_SIZE];
+
+        writer_info.aes_context = new AESEncContext;
+        result = writer_info.aes_context->InitKey(opendcp->mxf.key_value);
+
+        if (ASDCP_SUCCESS(result)) {
+            result = writer_info.aes_context->SetIVec(rng.FillRandom(iv_buf, CBC_BLOCK_SIZE));
+        }
+
+        if (ASDCP_SUCCESS(result) && writer_info.info.UsesHMAC) {
+            writer_info.hmac_context = new HMACContext;
+            result = writer_info.hmac_context->InitKey(opendcp->mxf.key_value, writer_info.info.LabelSetType);
+        }
+    }
+
+    reader.Close();
+
+    writer_info.info.ProductVersion = OPENDCP_VERSION;
+    writer_info.info.CompanyName    = OPENDCP_NAME;
+    writer_info.info.ProductName    = OPENDCP_NAME;
+
+    /* replacing in place writes next to the track, which is still being read */
+    if (is_same_file(mxf_file, output_file)) {
+        snprintf(temp_file, sizeof(temp_file), "%s.replace", output_file);
+        write_file = temp_file;
+    }
+
+    if (ASDCP_SUCCESS(result)) {
+        result = mxf_writer.OpenWrite(write_file, writer_info.info, picture_desc);
+    }
+
+    if (ASDCP_FAILURE(result)) {
+        delete writer_info.aes_context;
+        delete writer_info.hmac_context;
+        return OPENDCP_FILEWRITE_MXF;
+    }
+
+    if (opendcp->mxf.digest_flag) {
+        mxf_writer.EnableFileDigest();
+    }
+
+    mxf_async_io(mxf_writer, opendcp);
+    mxf_index_spill(mxf_writer, write_file, duration);
+    mxf_preallocate(mxf_writer, opendcp, write_file, duration);
+    mxf_progress_init(&progress, opendcp);
+
+    OPENDCP_LOG(LOG_INFO, "replacing frames %d to %d of %s", first_frame + 1, first_frame + filelist->nfiles, mxf_file);
+
+    manifest = opendcp_manifest_load(filelist->files[0]);
+
+    result = mxf_writer.CopyFrames(mxf_file, 0, first_frame);
+
+    if (ASDCP_SUCCESS(result) && mxf_progress_add(&progress, first_frame, 0)) {
+        rc = OPENDCP_FILEWRITE_MXF;
+    }
+
+    for (i = 0; rc == OPENDCP_NO_ERROR && ASDCP_SUCCESS(result) && i < (ui32_t)filelist->nfiles; i++) {
+        JP2K::PictureDescriptor frame_desc;
+        byte_t                  start_of_data = 0;
+
+        if (ASDCP_FAILURE(j2k_parser.OpenReadFrame(filelist->files[i], frame_buffer)) ||
+            (manifest && opendcp_manifest_check(manifest, filelist->files[i], frame_buffer.RoData(), frame_buffer.Size()) != OPENDCP_NO_ERROR) ||
+            ASDCP_FAILURE(JP2K::ParseMetadataIntoDesc(frame_buffer, frame_desc, &start_of_data))) {
+            OPENDCP_LOG(LOG_ERROR, "Could not read codestream %s", filelist->files[i]);
+            rc = OPENDCP_FILEOPEN_J2K;
+            break;
+        }
+
+        if (frame_desc.StoredWidth != picture_desc.StoredWidth || frame_desc.StoredHeight != picture_desc.StoredHeight) {
+            OPENDCP_LOG(LOG_ERROR, "%s is %ux%u, the track is %ux%u", filelist->files[i], frame_desc.StoredWidth,
+                        frame_desc.StoredHeight, picture_desc.StoredWidth, picture_desc.StoredHeight);
+            rc = OPENDCP_FILEOPEN_J2K;
+            break;
+        }
+
+        frame_buffer.PlaintextOffset(opendcp->mxf.encrypt_header_flag ? 0 : start_of_data);
+        result = mxf_writer.WriteFrame(frame_buffer, writer_info.aes_context, writer_info.hmac_context);
+
+        if (ASDCP_SUCCESS(result) && mxf_progress_frame(&progress, frame_buffer.Size())) {
+            rc = OPENDCP_FILEWRITE_MXF;
+        }
+    }
+
+    opendcp_manifest_close(manifest);
+    tail = duration - first_frame - filelist->nfiles;
+
+    if (rc == OPENDCP_NO_ERROR && ASDCP_SUCCESS(result)) {
+        result = mxf_writer.CopyFrames(mxf_file, first_frame + filelist->nfiles, tail);
+
+        if (ASDCP_SUCCESS(result) && mxf_progress_add(&progress, tail, 0)) {
+            rc = OPENDCP_FILEWRITE_MXF;
+        }
+    }
+
+    if (rc == OPENDCP_NO_ERROR && ASDCP_FAILURE(result)) {
+        rc = OPENDCP_FILEWRITE_MXF;
+    }
+
+    if (rc == OPENDCP_NO_ERROR) {
+        mxf_progress_flush(&progress);
+
+        if (ASDCP_FAILURE(mxf_writer.Finalize())) {
+            rc = OPENDCP_FINALIZE_MXF;
+        }
+
+        opendcp->mxf.file_done.callback(opendcp->mxf.file_done.argument);
+    }
+
+    delete writer_info.aes_context;
+    delete writer_info.hmac_context;
+
+    if (rc != OPENDCP_NO_ERROR) {
+        if (write_file == temp_file) {
+            unlink(temp_file);
+        }
+
+        return rc;
+    }
+
+    if (write_file == temp_file) {
+        rc = replace_commit(temp_file, output_file);
+    }
+
+    if (rc == OPENDCP_NO_ERROR && opendcp->mxf.digest_flag && ASDCP_SUCCESS(mxf_writer.FileDigest(digest))) {
+        write_digest_sidecar(opendcp, output_file, digest);
+    }
+
+    return rc;
+}
+
+/* write out 3D j2k mxf file */
+int write_j2k_s_mxf(opendcp_t *opendcp, filelist_t *filelist, char *output_file) {
+    mxf_upload              upload;
+    JP2K::MXFSWriter        mxf_writer;
+    JP2K::PictureDescriptor picture_desc;
+    JP2K::CodestreamParser  j2k_parser;
+    writer_info_t           writer_info;
+    byte_t                  digest[20];
+    Result_t                result = RESULT_OK;
+    ui32_t                  start_frame;
+    ui32_t                  mxf_duration;
+    ui32_t                  slide_duration = 0;
+    j2k_prefetch_t          prefetch;
+    pthread_t               threads[PREFETCH_THREADS_MAX];
+    int                     nthreads, t;
+    ui64_t                  bytes = 0;
+    ui32_t                  frames = 0;
+    struct timeval          start_time;
+    opendcp_bitrate_t       *bitrate;
+    mxf_progress_t          progress;
+    ui64_t                  pair_bytes;
+    int                     cancelled = 0;
+    int                     rc = OPENDCP_NO_ERROR;
+
+    /* set the starting frame */
+    if (opendcp->mxf.start_frame && filelist->nfiles >= (opendcp->mxf.start_frame - 1)) {
+        start_frame = opendcp->mxf.start_frame - 1; /* adjust for zero base */
+    }
+    else {
+        start_frame = 0;
+    }
+
+    if ((ui32_t)filelist->nfiles < start_frame + 2) {
+        return OPENDCP_FILEOPEN_J2K;
+    }
+
+    if (opendcp->mxf.dual_file) {
+        OPENDCP_LOG(LOG_ERROR, "A dual track can only be written with a 2D picture track");
+        return OPENDCP_FILEWRITE_MXF;
+    }
+
+    result = j2k_parser.OpenReadHeader(filelist->files[start_frame]);
+
+    if (ASDCP_FAILURE(result)) {
+        return OPENDCP_FILEOPEN_J2K;
+    }
+
+    Rational edit_rate(opendcp->frame_rate, 1);
+    j2k_parser.FillPictureDescriptor(picture_desc);
+    picture_desc.EditRate = edit_rate;
+
+    fill_writer_info(opendcp, &writer_info);
+
+    result = mxf_writer.OpenWrite(output_file, writer_info.info, picture_desc);
+
+    if (ASDCP_FAILURE(result)) {
+        return OPENDCP_FILEWRITE_MXF;
+    }
+
+    if (opendcp->mxf.digest_flag) {
+        mxf_writer.EnableFileDigest();
+    }
+
+    if (upload.open(mxf_writer, opendcp) != OPENDCP_NO_ERROR) {
+        return OPENDCP_UPLOAD;
+    }
+
+    mxf_async_io(mxf_writer, opendcp);
+    mxf_index_spill(mxf_writer, output_file, filelist->nfiles / 2);
+
+    /* set the duration of the output mxf, set to half the filecount since it is 3D */
+    if (opendcp->mxf.slide) {
+        mxf_duration = opendcp->mxf.duration;
+        slide_duration = mxf_duration / (filelist->nfiles / 2);
+    }
+    else if (opendcp->mxf.duration && (filelist->nfiles / 2 >= opendcp->mxf.duration)) {
+        mxf_duration = opendcp->mxf.duration;
+    }
+    else {
+        mxf_duration = filelist->nfiles / 2;
+    }
+
+    mxf_preallocate(mxf_writer, opendcp, output_file, mxf_duration);
+
+    /* read ahead over the interleaved file list, so both eyes of a frame are read in parallel */
+    nthreads = opendcp->threads > 0 ? opendcp->threads : 2;
+    nthreads = nthreads > PREFETCH_THREADS_MAX ? PREFETCH_THREADS_MAX : nthreads;
+    nthreads = nthreads < 2 ? 2 : nthreads;
+
+    memset(&prefetch, 0, sizeof(prefetch));
+    prefetch.opendcp  = opendcp;
+    prefetch.filelist = filelist;
+    prefetch.manifest = opendcp_manifest_load(filelist->files[0]);
+    prefetch.encrypt  = writer_info.aes_context != NULL;
+    prefetch.start    = start_frame;
+    prefetch.count    = (filelist->nfiles - start_frame) & ~1u;
+    prefetch.nslots   = nthreads * 2;
+    prefetch.slots    = new j2k_prefetch_slot_t[prefetch.nslots];
+
+    if (!opendcp->mxf.slide && prefetch.count > mxf_duration * 2) {
+        prefetch.count = mxf_duration * 2;
+    }
+
+    for (ui32_t k = 0; k < prefetch.nslots; k++) {
+        prefetch.slots[k].frame_buffer = new JP2K::FrameBuffer(FRAME_BUFFER_SIZE);
+        prefetch.slots[k].ct_buffer    = prefetch.encrypt ? new FrameBuffer : NULL;
+        prefetch.slots[k].ready        = 0;
+    }
+
+    pthread_mutex_init(&prefetch.mutex, NULL);
+    pthread_cond_init(&prefetch.cond, NULL);
+
+    for (t = 0; t < nthreads; t++) {
+        pthread_create(&threads[t], NULL, j2k_prefetch_thread, &prefetch);
+    }
+
+    opendcp_metrics_threads(opendcp->metrics, METRIC_READ, nthreads);
+    opendcp_metrics_threads(opendcp->metrics, METRIC_WRITE, 1);
+
+    bitrate = opendcp_bitrate_create(opendcp, 1);
+    gettimeofday(&start_time, NULL);
+    mxf_progress_init(&progress, opendcp);
+
+    ui32_t read  = 1;
+    ui32_t seq   = 0;
+    j2k_prefetch_slot_t *eye[2] = { NULL, NULL };
+    JP2K::StereoscopicPhase_t phase[2] = { JP2K::SP_LEFT, JP2K::SP_RIGHT };
+
+    /* take each left/right pair from the read-ahead and write to the output mxf until duration is reached */
+    while (ASDCP_SUCCESS(result) && mxf_duration--) {
+        if (read) {
+            if (eye[0]) {
+                j2k_prefetch_release(&prefetch, seq++);
+                j2k_prefetch_release(&prefetch, seq++);
+                eye[0] = eye[1] = NULL;
+            }
+
+            if (seq + 1 >= prefetch.count) {
+                rc = OPENDCP_FILEOPEN_J2K;
+                break;
+            }
+
+            eye[0] = j2k_prefetch_get(&prefetch, seq);
+            eye[1] = j2k_prefetch_get(&prefetch, seq + 1);
+
+            if (eye[0]->failed || eye[1]->failed) {
+                rc = OPENDCP_FILEOPEN_J2K;
+                break;
+            }
+
+            read = 0;
+        }
+
+        if (opendcp->mxf.slide) {
+            if (mxf_duration % slide_duration == 0) {
+                read = 1;
+            }
+        }
+        else {
+            read = 1;
+        }
+
+        /* write the left then the right eye */
+        pair_bytes = 0;
+
+        for (t = 0; t < 2 && ASDCP_SUCCESS(result) && rc == OPENDCP_NO_ERROR; t++) {
+            unsigned long long write_start = opendcp_metrics_now();
+
+            if (prefetch.encrypt) {
+                result = mxf_writer.WriteEncryptedFrame(*eye[t]->frame_buffer, *eye[t]->ct_buffer, phase[t], writer_info.hmac_context);
+            }
+            else {
+                result = mxf_writer.WriteFrame(*eye[t]->frame_buffer, phase[t], writer_info.aes_context, writer_info.hmac_context);
+            }
+
+            opendcp_metrics_record(opendcp->metrics, METRIC_WRITE, write_start, eye[t]->frame_buffer->Size());
+            bytes += eye[t]->frame_buffer->Size();
+            pair_bytes += eye[t]->frame_buffer->Size();
+
+            if (ASDCP_SUCCESS(result) && opendcp_bitrate_add(bitrate, eye[t]->frame_buffer->Size()) != OPENDCP_NO_ERROR) {
+                rc = OPENDCP_BITRATE;
+            }
+        }
+        frames++;
+
+        /* frame done callback (also check for interrupt), once per pair */
+        if (mxf_progress_frame(&progress, pair_bytes)) {
+            cancelled = 1;
+        }
+
+        if (cancelled || rc != OPENDCP_NO_ERROR) {
+            break;
+        }
+    }
+
+    j2k_prefetch_stop(&prefetch);
+
+    for (t = 0; t < nthreads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+
+    bitrate_done(opendcp, bitrate);
+
+    double seconds = elapsed_seconds(&start_time);
+    OPENDCP_LOG(LOG_INFO, "wrapped %u stereoscopic frames, %.1f MB in %.2fs, %.1f MB/s", frames, bytes / 1048576.0, seconds,
+                seconds > 0 ? bytes / 1048576.0 / seconds : 0.0);
+
+    pthread_cond_destroy(&prefetch.cond);
+    pthread_mutex_destroy(&prefetch.mutex);
+    opendcp_manifest_close(prefetch.manifest);
+
+    for (ui32_t k = 0; k < prefetch.nslots; k++) {
+        delete prefetch.slots[k].frame_buffer;
+        delete prefetch.slots[k].ct_buffer;
+    }
+
+    delete [] prefetch.slots;
+
+    if (rc != OPENDCP_NO_ERROR || cancelled) {
+        return rc;
+    }
+
+    if (result == RESULT_ENDOFFILE) {
+        result = RESULT_OK;
+    }
+
+    if (ASDCP_FAILURE(result)) {
+        return OPENDCP_FILEWRITE_MXF;
+    }
+
+    mxf_progress_flush(&progress);
+    result = mxf_writer.Finalize();
+
+    opendcp->mxf.file_done.callback(opendcp->mxf.file_done.argument);
+
+    if (ASDCP_FAILURE(result)) {
+        return OPENDCP_FINALIZE_MXF;
+    }
+
+    if (upload.close() != OPENDCP_NO_ERROR) {
+        return OPENDCP_UPLOAD;
+    }
+
+    if (opendcp->mxf.digest_flag && ASDCP_SUCCESS(mxf_writer.FileDigest(digest))) {
+        write_digest_sidecar(opendcp, output_file, digest);
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+#define PCM_READ_AHEAD_SECONDS 4
+
+/* source channels of all input files together, a channel map picks from these */
+#define PCM_SOURCE_CHANNELS_MAX 64
+
+/*
+   Interleaving of 24-bit channels into one multichannel frame. A channel
+   is a pointer into a source frame and the stride between its samples, so
+   mono files and channels inside a multichannel file are remapped in the
+   same pass without splitting the file first. Each sample moves with a
+   single 32-bit load and store, the spare byte of the store is overwritten
+   by the next channel's sample, so only the last sample of the frame needs
+   an exact 3 byte copy. The channel count is a template argument so the
+   channel loop unrolls into straight moves.
+*/
+typedef void (*pcm_interleave_t)(byte_t *out, byte_t *const *in, const ui32_t *stride, ui32_t samples);
+
+template <int N>
+static void pcm_interleave_24(byte_t *out, byte_t *const *in, const ui32_t *stride, ui32_t samples) {
+    ui32_t i;
+    int    c;
+
+    if (!samples) {
+        return;
+    }
+
+    for (i = 0; i < samples - 1; i++) {
+        for (c = 0; c < N; c++) {
+            ui32_t word;
+            memcpy(&word, in[c] + i * stride[c], 4);
+            memcpy(out, &word, 4);
+            out += 3;
+        }
+    }
+
+    for (c = 0; c < N; c++) {
+        memcpy(out, in[c] + i * stride[c], 3);
+        out += 3;
+    }
+}
+
+static const pcm_interleave_t pcm_interleave_24_table[MAX_AUDIO_CHANNELS + 1] = {
+    NULL,
+    pcm_interleave_24<1>,  pcm_interleave_24<2>,  pcm_interleave_24<3>,  pcm_interleave_24<4>,
+    pcm_interleave_24<5>,  pcm_interleave_24<6>,  pcm_interleave_24<7>,  pcm_interleave_24<8>,
+    pcm_interleave_24<9>,  pcm_interleave_24<10>, pcm_interleave_24<11>, pcm_interleave_24<12>,
+    pcm_interleave_24<13>, pcm_interleave_24<14>, pcm_interleave_24<15>, pcm_interleave_24<16>
+};
+
+/* generic interleaving, one sample_size block from each channel in turn */
+static void pcm_interleave(byte_t *out, byte_t *const *in, const ui32_t *stride, int channels,
+                           ui32_t sample_size, ui32_t samples) {
+    ui32_t i;
+    int    c;
+
+    for (i = 0; i < samples; i++) {
+        for (c = 0; c < channels; c++) {
+            memcpy(out, in[c] + i * stride[c], sample_size);
+            out += sample_size;
+        }
+    }
+}
+
+/* parses a channel map such as "3,1,2", 1-based source channels with 0 for silence, returns the channel count or -1 */
+static int pcm_channel_map(const char *text, int sources, int *map) {
+    int  count = 0;
+    long channel;
+    char *end;
+
+    while (*text) {
+        channel = strtol(text, &end, 10);
+
+        if (end == text || channel < 0 || channel > sources || count >= MAX_AUDIO_CHANNELS) {
+            return -1;
+        }
+
+        map[count++] = (int)channel - 1;
+        text         = end;
+
+        if (*text == ',') {
+            text++;
+        }
+        else if (*text) {
+            return -1;
+        }
+    }
+
+    return count;
+}
+
+/* log the peaks and loudness of a sound track, write the report and free the analysis */
+static void loudness_done(opendcp_t *opendcp, opendcp_loudness_t *loudness) {
+    opendcp_loudness_summary(loudness);
+
+    if (loudness) {
+        opendcp_loudness_dump(loudness, opendcp->mxf.loudness_report);
+    }
+
+    opendcp_loudness_delete(loudness);
+}
+
+/* source block rate for conversion, the largest divisor of the sample rate up to 100 so every block is a whole number of samples */
+static int pcm_block_rate(int rate) {
+    int block_rate;
+
+    for (block_rate = 100; block_rate > 1 && rate % block_rate; block_rate--);
+
+    return block_rate;
+}
+
+/* read the next frame of every file, a short frame ends the track */
+static Result_t pcm_read_frames(PCM::WAVParser *parser, PCM::FrameBuffer *buffer, int nfiles) {
+    Result_t result = RESULT_OK;
+    int      file_index;
+
+    for (file_index = 0; file_index < nfiles; file_index++) {
+        result = parser[file_index].ReadFrame(buffer[file_index]);
+
+        if (ASDCP_FAILURE(result)) {
+            break;
+        }
+
+        if (buffer[file_index].Size() != buffer[file_index].Capacity()) {
+            OPENDCP_LOG(LOG_INFO, "frame size mismatch, expect size: %d did match actual size: %d",
+                        buffer[file_index].Capacity(), buffer[file_index].Size());
+            result = RESULT_ENDOFFILE;
+            break;
+        }
+    }
+
+    return result;
+}
+
+/* write out pcm audio mxf file */
+int write_pcm_mxf(opendcp_t *opendcp, filelist_t *filelist, char *output_file) {
+    mxf_upload           upload;
+    PCM::FrameBuffer     frame_buffer;
+    PCM::FrameBuffer     silence;
+    PCM::FrameBuffer     converted;
+    PCM::AudioDescriptor audio_desc;
+    PCM::MXFWriter       mxf_writer;
+    writer_info_t        writer_info;
+    byte_t               digest[20];
+    Result_t             result = RESULT_OK;
+    ui32_t               mxf_duration;
+    i32_t                file_index = 0;
+    mxf_progress_t       progress;
+    int                  cancelled = 0;
+
+    PCM::WAVParser       pcm_parser_channel[MAX_AUDIO_CHANNELS];
+    PCM::FrameBuffer     frame_buffer_channel[MAX_AUDIO_CHANNELS];
+    PCM::AudioDescriptor audio_desc_channel[MAX_AUDIO_CHANNELS];
+
+    Rational edit_rate(opendcp->frame_rate, 1);
+
+    if (filelist->nfiles > MAX_AUDIO_CHANNELS) {
+        OPENDCP_LOG(LOG_ERROR, "too many wav files, at most %d are supported", MAX_AUDIO_CHANNELS);
+        return OPENDCP_INVALID_WAV_CHANNELS;
+    }
+
+    /* read first file */
+    result = pcm_parser_channel[0].OpenRead(filelist->files[0], edit_rate);
+
+    if (ASDCP_FAILURE(result)) {
+        return OPENDCP_FILEOPEN_WAV;
+    }
+
+    /* read audio descriptor */
+    pcm_parser_channel[0].FillAudioDescriptor(audio_desc);
+    audio_desc.ChannelCount = 0;
+    audio_desc.BlockAlign   = 0;
+
+    /* anything but 24-bit 48 or 96 kHz is converted, the files are then read in short blocks */
+    int      in_rate   = (int)audio_desc.AudioSamplingRate.Quotient();
+    int      out_rate  = opendcp_audio_rate(in_rate);
+    int      convert   = in_rate != out_rate || audio_desc.QuantizationBits != 24;
+    Rational read_rate = convert ? Rational(pcm_block_rate(in_rate), 1) : edit_rate;
+
+    for (file_index = 0; file_index < filelist->nfiles; file_index++) {
+        result = pcm_parser_channel[file_index].OpenRead(filelist->files[file_index], read_rate);
+
+        if (ASDCP_FAILURE(result)) {
+            OPENDCP_LOG(LOG_ERROR, "could not open %s", filelist->files[file_index]);
+            return OPENDCP_FILEOPEN_WAV;
+        }
+
+        /* read each channel file seconds at a time rather than one frame per file, per frame */
+        pcm_parser_channel[file_index].EnableReadAhead(PCM_READ_AHEAD_SECONDS);
+        pcm_parser_channel[file_index].FillAudioDescriptor(audio_desc_channel[file_index]);
+
+        if (audio_desc_channel[file_index].AudioSamplingRate != audio_desc.AudioSamplingRate) {
+            OPENDCP_LOG(LOG_ERROR, "mismatched sampling rate");
+            return OPENDCP_FILEOPEN_WAV;
+        }
+
+        if (audio_desc_channel[file_index].QuantizationBits != audio_desc.QuantizationBits) {
+            OPENDCP_LOG(LOG_ERROR, "mismatched bit rate");
+            return OPENDCP_FILEOPEN_WAV;
+        }
+
+        if (audio_desc_channel[file_index].ContainerDuration != audio_desc_channel[0].ContainerDuration) {
+            OPENDCP_LOG(LOG_ERROR, "mismatched duration");
+            return OPENDCP_FILEOPEN_WAV;
+        }
+
+        frame_buffer_channel[file_index].Capacity(PCM::CalcFrameBufferSize(audio_desc_channel[file_index]));
+    }
+
+    if (ASDCP_FAILURE(result)) {
+        return OPENDCP_FILEOPEN_WAV;
+    }
+
+    /* every channel of every file, in file order */
+    byte_t *read_data[PCM_SOURCE_CHANNELS_MAX];
+    ui32_t read_stride[PCM_SOURCE_CHANNELS_MAX];
+    byte_t *source_data[PCM_SOURCE_CHANNELS_MAX];
+    ui32_t source_stride[PCM_SOURCE_CHANNELS_MAX];
+    ui32_t read_size     = (audio_desc.QuantizationBits + 7) / 8;
+    ui32_t read_samples  = PCM::CalcSamplesPerFrame(audio_desc_channel[0]);
+    ui32_t read_blocks   = audio_desc_channel[0].ContainerDuration;
+    int    sources       = 0;
+    int    map[MAX_AUDIO_CHANNELS];
+    int    channels, c;
+
+    /* the wrapped track is always 24-bit */
+    audio_desc.AudioSamplingRate = Rational(out_rate, 1);
+    audio_desc.QuantizationBits  = 24;
+    audio_desc.EditRate          = edit_rate;
+
+    ui32_t sample_size = 3;
+    ui32_t samples     = PCM::CalcSamplesPerFrame(audio_desc);
+
+    for (file_index = 0; file_index < filelist->nfiles; file_index++) {
+        ui32_t file_channels = audio_desc_channel[file_index].ChannelCount;
+        ui32_t file_stride   = PCM::CalcSampleSize(audio_desc_channel[file_index]);
+
+        if (sources + file_channels > PCM_SOURCE_CHANNELS_MAX) {
+            OPENDCP_LOG(LOG_ERROR, "too many source channels, at most %d are supported", PCM_SOURCE_CHANNELS_MAX);
+            return OPENDCP_INVALID_WAV_CHANNELS;
+        }
+
+        for (ui32_t i = 0; i < file_channels; i++, sources++) {
+            read_data[sources]   = frame_buffer_channel[file_index].Data() + i * read_size;
+            read_stride[sources] = file_stride;
+        }
+    }
+
+    /* converted channels are written back to back, one edit unit each */
+    if (convert) {
+        converted.Capacity(sources * samples * sample_size);
+    }
+
+    for (c = 0; c < sources; c++) {
+        source_data[c]   = convert ? converted.Data() + c * samples * sample_size : read_data[c];
+        source_stride[c] = convert ? sample_size : read_stride[c];
+    }
+
+    /* without a map every source channel is written in order */
+    if (opendcp->mxf.channel_map && *opendcp->mxf.channel_map) {
+        channels = pcm_channel_map(opendcp->mxf.channel_map, sources, map);
+
+        if (channels < 1) {
+            OPENDCP_LOG(LOG_ERROR, "invalid channel map %s, expected up to %d of the source channels 1-%d or 0 for silence",
+                        opendcp->mxf.channel_map, MAX_AUDIO_CHANNELS, sources);
+            return OPENDCP_INVALID_WAV_CHANNELS;
+        }
+    }
+    else {
+        if (sources > MAX_AUDIO_CHANNELS) {
+            OPENDCP_LOG(LOG_ERROR, "%d source channels, at most %d are supported without a channel map", sources, MAX_AUDIO_CHANNELS);
+            return OPENDCP_INVALID_WAV_CHANNELS;
+        }
+
+        for (channels = 0; channels < sources; channels++) {
+            map[channels] = channels;
+        }
+    }
+
+    byte_t *channel_data[MAX_AUDIO_CHANNELS];
+    ui32_t channel_stride[MAX_AUDIO_CHANNELS];
+
+    for (c = 0; c < channels; c++) {
+        if (map[c] < 0) {
+            if (!silence.Capacity()) {
+                silence.Capacity(sample_size * samples);
+                memset(silence.Data(), 0, silence.Capacity());
+            }
+
+            channel_data[c]   = silence.Data();
+            channel_stride[c] = sample_size;
+        }
+        else {
+            channel_data[c]   = source_data[map[c]];
+            channel_stride[c] = source_stride[map[c]];
+        }
+    }
+
+    /*  set total audio characteristics */
+    audio_desc.ChannelCount = channels;
+    audio_desc.BlockAlign   = channels * sample_size;
+    audio_desc.AvgBps       = out_rate * audio_desc.BlockAlign;
+
+    if (convert) {
+        audio_desc.ContainerDuration = (ui32_t)((ui64_t)read_blocks * read_samples * out_rate / in_rate / samples);
+    }
+
+    /* conversion runs per edit unit as the blocks are read, no file is buffered whole */
+    opendcp_audio_t *audio = NULL;
+
+    if (convert) {
+        audio = opendcp_audio_create(in_rate, audio_desc_channel[0].QuantizationBits, out_rate, sources, opendcp->threads);
+
+        if (!audio) {
+            return OPENDCP_INVALID_WAV_BITDEPTH;
+        }
+    }
+
+    /* set total frame buffer size */
+    frame_buffer.Capacity(PCM::CalcFrameBufferSize(audio_desc));
+    frame_buffer.Size(PCM::CalcFrameBufferSize(audio_desc));
+
+    /* fill write info */
+    fill_writer_info(opendcp, &writer_info);
+    result = mxf_writer.OpenWrite(output_file, writer_info.info, audio_desc);
+
+    if (ASDCP_FAILURE(result)) {
+        opendcp_audio_delete(audio);
+        return OPENDCP_FILEWRITE_MXF;
+    }
+
+    if (upload.open(mxf_writer, opendcp) != OPENDCP_NO_ERROR) {
+        opendcp_audio_delete(audio);
+        return OPENDCP_UPLOAD;
+    }
+
+    /* the analysis measures each written edit unit on its own threads */
+    opendcp_loudness_t *loudness = NULL;
+
+    if (opendcp->mxf.loudness_report) {
+        loudness = opendcp_loudness_create(out_rate, channels, opendcp->threads);
+    }
+
+    if (opendcp->mxf.digest_flag) {
+        mxf_writer.EnableFileDigest();
+    }
+
+    mxf_async_io(mxf_writer, opendcp);
+
+    /* set duration */
+    if (!opendcp->duration) {
+        mxf_duration = 0xffffffff;
+    }
+    else {
+        mxf_duration = opendcp->duration;
+    }
+
+    /* pick the interleaver, 24-bit sources have a dedicated one per channel count */
+    pcm_interleave_t interleave = NULL;
+
+    if (sample_size == 3) {
+        interleave = pcm_interleave_24_table[channels];
+    }
+
+    int flushed = 0;
+
+    mxf_progress_init(&progress, opendcp);
+
+    /* start parsing */
+    while (ASDCP_SUCCESS(result) && mxf_duration--) {
+        if (!audio) {
+            /* read a frame from each file, every sample is overwritten so the buffers are not cleared */
+            result = pcm_read_frames(pcm_parser_channel, frame_buffer_channel, filelist->nfiles);
+        }
+        else {
+            /* queue source blocks until every channel can fill the edit unit, whole blocks only */
+            while (ASDCP_SUCCESS(result) && opendcp_audio_ready(audio) < (int)samples) {
+                if (!read_blocks) {
+                    if (flushed || opendcp_audio_flush(audio) != OPENDCP_NO_ERROR) {
+                        result = RESULT_ENDOFFILE;
+                    }
+
+                    flushed = 1;
+                    continue;
+                }
+
+                result = pcm_read_frames(pcm_parser_channel, frame_buffer_channel, filelist->nfiles);
+                read_blocks--;
+
+                for (c = 0; ASDCP_SUCCESS(result) && c < sources; c++) {
+                    if (opendcp_audio_push(audio, c, read_data[c], read_stride[c], read_samples) != OPENDCP_NO_ERROR) {
+                        result = RESULT_ALLOC;
+                    }
+                }
+            }
+
+            if (ASDCP_SUCCESS(result)) {
+                opendcp_audio_pull(audio, source_data, samples);
+            }
+        }
+
+        /* write sample from each channel to output buffer */
+        if (ASDCP_SUCCESS(result)) {
+            if (interleave) {
+                interleave(frame_buffer.Data(), channel_data, channel_stride, samples);
+            }
+            else {
+                pcm_interleave(frame_buffer.Data(), channel_data, channel_stride, channels, sample_size, samples);
+            }
+            if (opendcp_loudness_add(loudness, channel_data, channel_stride, samples) != OPENDCP_NO_ERROR) {
+                OPENDCP_LOG(LOG_WARN, "loudness analysis stopped, out of memory");
+                opendcp_loudness_delete(loudness);
+                loudness = NULL;
+            }
+
+            /* write the frame */
+            result = mxf_writer.WriteFrame(frame_buffer, writer_info.aes_context, writer_info.hmac_context);
+
+            /* frame done callback (also check for interrupt) */
+            if (ASDCP_SUCCESS(result) && mxf_progress_frame(&progress, frame_buffer.Size())) {
+                cancelled = 1;
+                break;
+            }
+        }
+    }
+
+    opendcp_audio_delete(audio);
+
+    if (cancelled) {
+        opendcp_loudness_delete(loudness);
+        return OPENDCP_NO_ERROR;
+    }
+
+    if (result == RESULT_ENDOFFILE) {
+        result = RESULT_OK;
+    }
+
+    if (ASDCP_SUCCESS(result)) {
+        loudness_done(opendcp, loudness);
+    }
+    else {
+        opendcp_loudness_delete(loudness);
+        return OPENDCP_FILEWRITE_MXF;
+    }
+
+    mxf_progress_flush(&progress);
+
+    /* write footer information */
+    result = mxf_writer.Finalize();
+
+    opendcp->mxf.file_done.callback(opendcp->mxf.file_done.argument);
+
+    if (ASDCP_FAILURE(result)) {
+        return OPENDCP_FINALIZE_MXF;
+    }
+
+    if (upload.close() != OPENDCP_NO_ERROR) {
+        return OPENDCP_UPLOAD;
+    }
+
+    if (opendcp->mxf.digest_flag && ASDCP_SUCCESS(mxf_writer.FileDigest(digest))) {
+        write_digest_sidecar(opendcp, output_file, digest);
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*
+   Ancillary resource prefetch for write_tt_mxf. Worker threads read the
+   next resources into a ring of frame buffers while the current one is
+   encrypted and written, SMPTE image subtitles can carry thousands of
+   PNGs. Each buffer starts empty and grows to the largest resource it has
+   held, so there is no fixed per-resource buffer size. Resources are
+   written in list order.
+*/
+#define TT_PREFETCH_DEPTH   8
+#define TT_PREFETCH_THREADS 4
+
+enum {
+    TT_SLOT_FREE = 0,
+    TT_SLOT_LOADING,
+    TT_SLOT_READY
+};
+
+struct tt_slot_t {
+    TimedText::FrameBuffer buffer;
+    Result_t               result;
+    int                    state;
+
+    tt_slot_t() : result(RESULT_OK), state(TT_SLOT_FREE) {}
+};
+
+typedef struct {
+    const TimedText::DCSubtitleParser *parser;
+    const TimedText::IResourceResolver *resolver;
+    std::vector<const byte_t *>       ids;
+    tt_slot_t                         slots[TT_PREFETCH_DEPTH];
+    ui32_t                            next;
+    int                               stop;
+    pthread_mutex_t                   mutex;
+    pthread_cond_t                    cond;
+} tt_prefetch_t;
+
+static void *tt_prefetch_thread(void *arg) {
+    tt_prefetch_t *tp = (tt_prefetch_t *)arg;
+    tt_slot_t     *slot;
+    ui32_t        index;
+
+    pthread_mutex_lock(&tp->mutex);
+
+    while (!tp->stop && tp->next < tp->ids.size()) {
+        slot = &tp->slots[tp->next % TT_PREFETCH_DEPTH];
+
+        /* the slot still holds a resource the writer has not taken */
+        if (slot->state != TT_SLOT_FREE) {
+            pthread_cond_wait(&tp->cond, &tp->mutex);
+            continue;
+        }
+
+        index       = tp->next++;
+        slot->state = TT_SLOT_LOADING;
+        pthread_mutex_unlock(&tp->mutex);
+
+        Result_t result = tp->parser->ReadAncillaryResource(tp->ids[index], slot->buffer, tp->resolver);
+
+        pthread_mutex_lock(&tp->mutex);
+        slot->result = result;
+        slot->state  = TT_SLOT_READY;
+        pthread_cond_broadcast(&tp->cond);
+    }
+
+    pthread_mutex_unlock(&tp->mutex);
+
+    return NULL;
+}
+
+/* write out timed text mxf file */
+int write_tt_mxf(opendcp_t *opendcp, filelist_t *filelist, char *output_file) {
+    TimedText::DCSubtitleParser    tt_parser;
+    TimedText::MXFWriter           mxf_writer;
+    TimedText::TimedTextDescriptor tt_desc;
+    TimedText::ResourceList_t::const_iterator resource_iterator;
+    TimedText::LocalFilenameResolver resolver;
+    std::string                    dirname;
+    tt_prefetch_t                  tp;
+    pthread_t                      threads[TT_PREFETCH_THREADS];
+    writer_info_t                  writer_info;
+    byte_t                         digest[20];
+    std::string                    xml_doc;
+    Result_t                       result = RESULT_OK;
+    int                            read_error = 0;
+    int                            nthreads, i;
+    ui32_t                         index;
+
+    result = tt_parser.OpenRead(filelist->files[0]);
+
+    if (ASDCP_FAILURE(result)) {
+        return OPENDCP_FILEOPEN_TT;
+    }
+
+    tt_parser.FillTimedTextDescriptor(tt_desc);
+
+    fill_writer_info(opendcp, &writer_info);
+
+    result = mxf_writer.OpenWrite(output_file, writer_info.info, tt_desc);
+
+    if (ASDCP_FAILURE(result)) {
+        return OPENDCP_FILEWRITE_MXF;
+    }
+
+    if (opendcp->mxf.digest_flag) {
+        mxf_writer.EnableFileDigest();
+    }
+
+    mxf_async_io(mxf_writer, opendcp);
+
+    result = tt_parser.ReadTimedTextResource(xml_doc);
+
+    if (ASDCP_FAILURE(result)) {
+        return OPENDCP_FILEOPEN_TT;
+    }
+
+    result = mxf_writer.WriteTimedTextResource(xml_doc, writer_info.aes_context, writer_info.hmac_context);
+
+    if (ASDCP_FAILURE(result)) {
+        return OPENDCP_FILEWRITE_MXF;
+    }
+
+    /* resolved up front, the parser's default resolver is created on first use and is not thread safe */
+    dirname = Kumu::PathDirname(filelist->files[0]);
+    resolver.OpenRead(dirname.empty() ? "." : dirname);
+
+    tp.parser   = &tt_parser;
+    tp.resolver = &resolver;
+    tp.next     = 0;
+    tp.stop     = 0;
+
+    for (resource_iterator = tt_desc.ResourceList.begin(); resource_iterator != tt_desc.ResourceList.end(); resource_iterator++) {
+        tp.ids.push_back((*resource_iterator).ResourceID);
+    }
+
+    nthreads = tp.ids.size() < TT_PREFETCH_THREADS ? tp.ids.size() : TT_PREFETCH_THREADS;
+
+    pthread_mutex_init(&tp.mutex, NULL);
+    pthread_cond_init(&tp.cond, NULL);
+
+    for (i = 0; i < nthreads; i++) {
+        if (pthread_create(&threads[i], NULL, tt_prefetch_thread, &tp)) {
+            break;
+        }
+    }
+
+    nthreads = i;
+
+    /* no worker could be started, read the resources here */
+    if (!nthreads) {
+        tp.stop = 1;
+    }
+
+    for (index = 0; ASDCP_SUCCESS(result) && index < tp.ids.size(); index++) {
+        tt_slot_t *slot = &tp.slots[index % TT_PREFETCH_DEPTH];
+
+        if (!nthreads) {
+            slot->result = tt_parser.ReadAncillaryResource(tp.ids[index], slot->buffer, &resolver);
+            slot->state  = TT_SLOT_READY;
+        }
+
+        pthread_mutex_lock(&tp.mutex);
+
+        while (slot->state != TT_SLOT_READY) {
+            pthread_cond_wait(&tp.cond, &tp.mutex);
+        }
+
+        pthread_mutex_unlock(&tp.mutex);
+
+        result = slot->result;
+
+        if (ASDCP_FAILURE(result)) {
+            read_error = 1;
+            break;
+        }
+
+        result = mxf_writer.WriteAncillaryResource(slot->buffer, writer_info.aes_context, writer_info.hmac_context);
+
+        pthread_mutex_lock(&tp.mutex);
+        slot->state = TT_SLOT_FREE;
+        pthread_cond_broadcast(&tp.cond);
+        pthread_mutex_unlock(&tp.mutex);
+    }
+
+    pthread_mutex_lock(&tp.mutex);
+    tp.stop = 1;
+    pthread_cond_broadcast(&tp.cond);
+    pthread_mutex_unlock(&tp.mutex);
+
+    for (i = 0; i < nthreads; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    pthread_cond_destroy(&tp.cond);
+    pthread_mutex_destroy(&tp.mutex);
+
+    if (read_error) {
+        return OPENDCP_FILEOPEN_TT;
+    }
+
+    if (result == RESULT_ENDOFFILE) {
+        result = RESULT_OK;
+    }
+
+    if (ASDCP_FAILURE(result)) {
+        return OPENDCP_FILEWRITE_MXF;
+    }
+
+    result = mxf_writer.Finalize();
+
+    if (ASDCP_FAILURE(result)) {
+        return OPENDCP_FINALIZE_MXF;
+    }
+
+    if (opendcp->mxf.digest_flag && ASDCP_SUCCESS(mxf_writer.FileDigest(digest))) {
+        write_digest_sidecar(opendcp, output_file, digest);
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* write out mpeg2 mxf file */
+int write_mpeg2_mxf(opendcp_t *opendcp, filelist_t *filelist, char *output_file) {
+    MPEG2::FrameBuffer     frame_buffer(FRAME_BUFFER_SIZE);
+    MPEG2::Parser          mpeg2_parser;
+    MPEG2::MXFWriter       mxf_writer;
+    MPEG2::VideoDescriptor video_desc;
+    writer_info_t          writer_info;
+    byte_t                 digest[20];
+    Result_t               result = RESULT_OK;
+    ui32_t                 mxf_duration;
+
+    result = mpeg2_parser.OpenRead(filelist->files[0]);
+
+    if (ASDCP_FAILURE(result)) {
+        return OPENDCP_FILEOPEN_MPEG2;
+    }
+
+    mpeg2_parser.FillVideoDescriptor(video_desc);
+
+    fill_writer_info(opendcp, &writer_info);
+
+    result = mxf_writer.OpenWrite(output_file, writer_info.info, video_desc);
+
+    if (ASDCP_FAILURE(result)) {
+        return OPENDCP_FILEWRITE_MXF;
+    }
+
+    if (opendcp->mxf.digest_flag) {
+        mxf_writer.EnableFileDigest();
+    }
+
+    mxf_async_io(mxf_writer, opendcp);
+    mxf_index_spill(mxf_writer, output_file, INDEX_SPILL_FRAMES);
+
+    result = mpeg2_parser.Reset();
+
+    if (ASDCP_FAILURE(result)) {
+        return OPENDCP_PARSER_RESET;
+    }
+
+    if (!opendcp->duration) {
+        mxf_duration = 0xffffffff;
+    }
+    else {
+        mxf_duration = opendcp->duration;
+    }
+
+    while (ASDCP_SUCCESS(result) && mxf_duration--) {
+        result = mpeg2_parser.ReadFrame(frame_buffer);
+
+        if (ASDCP_FAILURE(result)) {
+            continue;
+        }
+
+        if (opendcp->mxf.encrypt_header_flag) {
+            frame_buffer.PlaintextOffset(0);
+        }
+
+        result = mxf_writer.WriteFrame(frame_buffer, writer_info.aes_context, writer_info.hmac_context);
+    }
+
+    if (result == RESULT_ENDOFFILE) {
+        result = RESULT_OK;
+    }
+
+    if (ASDCP_FAILURE(result)) {
+        return OPENDCP_FILEWRITE_MXF;
+    }
+
+    result = mxf_writer.Finalize();
+
+    if (ASDCP_FAILURE(result)) {
+        return OPENDCP_FINALIZE_MXF;
+    }
+
+    if (opendcp->mxf.digest_flag && ASDCP_SUCCESS(mxf_writer.FileDigest(digest))) {
+        write_digest_sidecar(opendcp, output_file, digest);
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*
+   Parallel extraction for read_j2k_mxf. The frame range is split into
+   contiguous blocks, one per thread, and each thread opens the mxf with
+   its own reader and decryption contexts so frames are read, decrypted
+   and written out concurrently while every reader still moves forward
+   through the file. Frames are fetched EXTRACT_BATCH_FRAMES at a time
+   with ReadFrames so neighbouring frames come in with one read.
+
+   Extracting to one codestream file has the threads take batches in
+   turn from a shared counter instead, and each thread appends its batch
+   once the batch before it is written, so the file stays in frame order.
+*/
+#define EXTRACT_THREADS_MAX  8
+#define EXTRACT_BATCH_FRAMES 4
+
+/* sound is staged and written this many bytes at a time */
+#define EXTRACT_WAV_BUFFER_SIZE (8 * 1024 * 1024)
+
+typedef struct {
+    Kumu::FileWriter *writer;
+    opendcp_pack_t   *pack;        /* frames go to a frame store instead of the writer */
+    pthread_mutex_t  mutex;
+    pthread_cond_t   cond;
+    ui32_t           claimed;      /* first frame of the batch no thread has taken yet */
+    ui32_t           next;         /* first frame of the batch to append next */
+    int              abort;
+} j2k_extract_file_t;
+
+typedef struct {
+    opendcp_t          *opendcp;
+    const char         *mxf_file;
+    const char         *output;
+    j2k_extract_file_t *file;      /* every frame goes to this file when set */
+    ui32_t             first;
+    ui32_t             last;
+    int                uses_hmac;
+    int                failed;
+} j2k_extract_t;
+
+/* first frame of the next batch for a thread, taken from the shared counter when extracting to one file */
+static ui32_t j2k_extract_next(j2k_extract_t *extract, ui32_t frame) {
+    j2k_extract_file_t *file = extract->file;
+
+    if (!file) {
+        return frame + EXTRACT_BATCH_FRAMES;
+    }
+
+    pthread_mutex_lock(&file->mutex);
+    frame          = file->abort ? extract->last : file->claimed;
+    file->claimed += EXTRACT_BATCH_FRAMES;
+    pthread_mutex_unlock(&file->mutex);
+
+    return frame;
+}
+
+/* appends a batch to the codestream file in frame order, returns false once another thread failed */
+static bool j2k_extract_append(j2k_extract_file_t *file, ui32_t first, JP2K::FrameBuffer *frames, ui32_t count, Result_t &result) {
+    ui32_t write_count;
+
+    pthread_mutex_lock(&file->mutex);
+
+    while (file->next != first && !file->abort) {
+        pthread_cond_wait(&file->cond, &file->mutex);
+    }
+
+    if (file->abort) {
+        pthread_mutex_unlock(&file->mutex);
+        return false;
+    }
+
+    for ( ui32_t k = 0; ASDCP_SUCCESS(result) && k < count; k++ ) {
+        if (file->pack) {
+            result = opendcp_pack_add(file->pack, frames[k].RoData(), frames[k].Size()) == OPENDCP_NO_ERROR ? RESULT_OK : RESULT_WRITEFAIL;
+        }
+        else {
+            result = file->writer->Write(frames[k].RoData(), frames[k].Size(), &write_count);
+        }
+    }
+
+    if (ASDCP_SUCCESS(result)) {
+        file->next = first + count;
+    }
+    else {
+        OPENDCP_LOG(LOG_ERROR, "Failed to write frames %d-%d", first, first + count - 1);
+        file->abort = 1;
+    }
+
+    pthread_cond_broadcast(&file->cond);
+    pthread_mutex_unlock(&file->mutex);
+
+    return ASDCP_SUCCESS(result);
+}
+
+/* a failed thread lets the others waiting for their turn go */
+static void j2k_extract_abort(j2k_extract_file_t *file) {
+    if (file) {
+        pthread_mutex_lock(&file->mutex);
+        file->abort = 1;
+        pthread_cond_broadcast(&file->cond);
+        pthread_mutex_unlock(&file->mutex);
+    }
+}
+
+static void *j2k_extract_thread(void *arg) {
+    j2k_extract_t     *extract = (j2k_extract_t *)arg;
+    opendcp_t         *opendcp = extract->opendcp;
+    AESDecContext     *context = 0;
+    HMACContext       *hmac = 0;
+    JP2K::MXFReader    reader;
+    JP2K::FrameBuffer  frame_buffers[EXTRACT_BATCH_FRAMES];
+    JP2K::FrameBuffer *batch[EXTRACT_BATCH_FRAMES];
+    WriterInfo         info;
+
+    Result_t result = reader.OpenRead(extract->mxf_file);
+
+    /* unencrypted frames are written straight from the mapped file */
+    for ( ui32_t k = 0; ASDCP_SUCCESS(result) && k < EXTRACT_BATCH_FRAMES; k++ ) {
+        result = frame_buffers[k].Capacity(FRAME_BUFFER_SIZE);
+        frame_buffers[k].AllowView(true);
+        batch[k] = &frame_buffers[k];
+    }
+
+    if (ASDCP_SUCCESS(result) && opendcp->mxf.key_flag) {
+        context = new AESDecContext;
+        result = context->InitKey(opendcp->mxf.key_value);
+
+        if (ASDCP_SUCCESS(result) && extract->uses_hmac) {
+            reader.FillWriterInfo(info);
+            hmac = new HMACContext;
+            result = hmac->InitKey(opendcp->mxf.key_value, info.LabelSetType);
+        }
+    }
+
+    ui32_t first = extract->file ? j2k_extract_next(extract, 0) : extract->first;
+
+    for ( ui32_t i = first; ASDCP_SUCCESS(result) && i < extract->last; i = j2k_extract_next(extract, i) ) {
+        ui32_t count = extract->last - i < EXTRACT_BATCH_FRAMES ? extract->last - i : EXTRACT_BATCH_FRAMES;
+        result = reader.ReadFrames(i, count, batch, context, hmac);
+
+        if (!ASDCP_SUCCESS(result)) {
+            OPENDCP_LOG(LOG_ERROR, "Failed to extract frames %d-%d (%s)", i, i + count - 1, result.Label());
+            continue;
+        }
+
+        if (extract->file) {
+            if (!j2k_extract_append(extract->file, i, frame_buffers, count, result)) {
+                break;
+            }
+
+            for ( ui32_t k = 0; k < count; k++ ) {
+                opendcp->mxf.frame_done.callback(opendcp->mxf.frame_done.argument);
+            }
+
+            continue;
+        }
+
+        for ( ui32_t k = 0; ASDCP_SUCCESS(result) && k < count; k++ ) {
+            Kumu::FileWriter output;
+            char filename[MAX_FILENAME_LENGTH + 16];
+            ui32_t write_count;
+
+            if (opendcp->mxf.extract_image) {
+                snprintf(filename, sizeof(filename), "%s_%06u.%s", extract->output, i + k, opendcp->mxf.extract_image);
+
+                if (convert_from_j2k(opendcp, frame_buffers[k].RoData(), frame_buffers[k].Size(), filename) != OPENDCP_NO_ERROR) {
+                    OPENDCP_LOG(LOG_ERROR, "Failed to write file %s", filename);
+                    result = RESULT_WRITEFAIL;
+                }
+
+                opendcp->mxf.frame_done.callback(opendcp->mxf.frame_done.argument);
+                continue;
+            }
+
+            snprintf(filename, sizeof(filename), "%s_%06u.j2c", extract->output, i + k);
+            result = output.OpenWrite(filename);
+
+            if (ASDCP_SUCCESS(result)) {
+                result = output.Write(frame_buffers[k].RoData(), frame_buffers[k].Size(), &write_count);
+            }
+
+            if (!ASDCP_SUCCESS(result)) {
+                OPENDCP_LOG(LOG_ERROR, "Failed to write file %s", filename);
+            }
+
+            opendcp->mxf.frame_done.callback(opendcp->mxf.frame_done.argument);
+        }
+    }
+
+    extract->failed = ASDCP_FAILURE(result) || (extract->file && extract->file->abort);
+
+    if (ASDCP_FAILURE(result)) {
+        j2k_extract_abort(extract->file);
+    }
+
+    delete context;
+    delete hmac;
+
+    return NULL;
+}
+
+/*!
+ @function read_j2k_mxf
+ @abstract Extracts the JPEG2000 codestreams of a picture track.
+ @discussion Frames are written to <output>_000000.j2c and on, one after
+             another to <output>.j2c when mxf.extract_single is set, or to
+             the frame store <output>.j2p when mxf.extract_pack is set.
+             With mxf.extract_image the threads decode the frames to
+             <output>_000000.tif or .dpx and on instead.
+ @param opendcp The options, mxf.start_frame and mxf.duration pick the frames.
+ @param mxf_file The picture track.
+ @param output The path the extracted files are named after.
+ @return OPENDCP_NO_ERROR, OPENDCP_FILEREAD_MXF or OPENDCP_FILEWRITE_EXTRACT.
+*/
+extern "C" int read_j2k_mxf(opendcp_t *opendcp, const char *mxf_file, const char *output) {
+    JP2K::MXFReader    reader;
+    ui32_t             frame_count = 0;
+    int                uses_hmac = 0;
+    j2k_extract_t      extract[EXTRACT_THREADS_MAX];
+    pthread_t          threads[EXTRACT_THREADS_MAX];
+    int                started[EXTRACT_THREADS_MAX];
+    int                nthreads, t;
+    int                rc = OPENDCP_NO_ERROR;
+
+    Result_t result = reader.OpenRead(mxf_file);
+
+    if (!ASDCP_SUCCESS(result)) {
+        OPENDCP_LOG(LOG_ERROR, "Could not read file");
+        return OPENDCP_FILEREAD_MXF;
+    }
+
+    JP2K::PictureDescriptor picture_desc;
+    reader.FillPictureDescriptor(picture_desc);
+
+    frame_count = picture_desc.ContainerDuration;
+    OPENDCP_LOG(LOG_INFO, "Detected %d frames", frame_count);
+
+    /* check the key once here, each extraction thread sets up its own contexts */
+    if (opendcp->mxf.key_flag) {
+        AESDecContext context;
+        OPENDCP_LOG(LOG_INFO, "Initialize decryption key");
+        result = context.InitKey(opendcp->mxf.key_value);
+
+        if (ASDCP_SUCCESS(result)) {
+            WriterInfo info;
+            reader.FillWriterInfo(info);
+
+            if (info.UsesHMAC) {
+                uses_hmac = 1;
+            }
+            else {
+                OPENDCP_LOG(LOG_ERROR, "File does not contain HMAC values");
+            }
+        }
+        else {
+            OPENDCP_LOG(LOG_ERROR, "Failed to load decryption key");
+            return OPENDCP_FILEREAD_MXF;
+        }
+    }
+
+    reader.Close();
+
+    ui32_t last_frame = opendcp->mxf.start_frame + (opendcp->mxf.duration ? opendcp->mxf.duration : frame_count);
+
+    if ( last_frame > frame_count ) {
+        last_frame = frame_count;
+    }
+
+    if ( (ui32_t)opendcp->mxf.start_frame >= last_frame ) {
+        return OPENDCP_NO_ERROR;
+    }
+
+    j2k_extract_file_t single;
+    Kumu::FileWriter   single_writer;
+    int                to_single = opendcp->mxf.extract_single || opendcp->mxf.extract_pack;
+
+    if (to_single && opendcp->mxf.extract_image) {
+        OPENDCP_LOG(LOG_ERROR, "Decoded frames can not go into one file");
+        return OPENDCP_FILEWRITE_EXTRACT;
+    }
+
+    if (to_single) {
+        char filename[MAX_FILENAME_LENGTH + 16];
+        snprintf(filename, sizeof(filename), "%s.%s", output, opendcp->mxf.extract_pack ? "j2p" : "j2c");
+
+        single.pack = NULL;
+
+        if (opendcp->mxf.extract_pack) {
+            single.pack = opendcp_pack_create(filename);
+        }
+
+        if (opendcp->mxf.extract_pack ? !single.pack : ASDCP_FAILURE(single_writer.OpenWrite(filename))) {
+            OPENDCP_LOG(LOG_ERROR, "Failed to write file %s", filename);
+            return OPENDCP_FILEWRITE_EXTRACT;
+        }
+
+        single.writer  = &single_writer;
+        single.claimed = opendcp->mxf.start_frame;
+        single.next    = opendcp->mxf.start_frame;
+        single.abort   = 0;
+        pthread_mutex_init(&single.mutex, NULL);
+        pthread_cond_init(&single.cond, NULL);
+    }
+
+    /* split the frame range into one contiguous block per thread, extraction to one file shares the batches out */
+    ui32_t total = last_frame - opendcp->mxf.start_frame;
+    nthreads = opendcp->threads > 0 ? opendcp->threads : 1;
+    nthreads = nthreads > EXTRACT_THREADS_MAX ? EXTRACT_THREADS_MAX : nthreads;
+    nthreads = (ui32_t)nthreads > total ? (int)total : nthreads;
+
+    ui32_t block = (total + nthreads - 1) / nthreads;
+
+    for (t = 0; t < nthreads; t++) {
+        extract[t].opendcp     = opendcp;
+        extract[t].mxf_file    = mxf_file;
+        extract[t].output      = output;
+        extract[t].uses_hmac   = uses_hmac;
+        extract[t].failed      = 0;
+
+        extract[t].file        = to_single ? &single : NULL;
+        extract[t].first       = opendcp->mxf.start_frame + t * block;
+        extract[t].last        = extract[t].file ? last_frame : (extract[t].first + block > last_frame ? last_frame : extract[t].first + block);
+
+        /* run the last block on this thread, or all of them if a thread can not be started */
+        started[t] = t < nthreads - 1 && pthread_create(&threads[t], NULL, j2k_extract_thread, &extract[t]) == 0;
+
+        if (!started[t]) {
+            j2k_extract_thread(&extract[t]);
+        }
+    }
+
+    for (t = 0; t < nthreads; t++) {
+        if (started[t]) {
+            pthread_join(threads[t], NULL);
+        }
+
+        if (extract[t].failed) {
+            rc = OPENDCP_FILEREAD_MXF;
+        }
+    }
+
+    if (to_single) {
+        pthread_cond_destroy(&single.cond);
+        pthread_mutex_destroy(&single.mutex);
+
+        if (single.pack && rc != OPENDCP_NO_ERROR) {
+            opendcp_pack_abort(single.pack);
+        }
+        else if (single.pack ? opendcp_pack_close(single.pack) != OPENDCP_NO_ERROR : ASDCP_FAILURE(single_writer.Close())) {
+            rc = rc == OPENDCP_NO_ERROR ? OPENDCP_FILEWRITE_EXTRACT : rc;
+        }
+    }
+
+    opendcp->mxf.file_done.callback(opendcp->mxf.file_done.argument);
+
+    return rc;
+}
+
+/* random access to the frames of a picture track, decoding threads share it and read in parallel */
+struct j2k_mxf_reader {
+    JP2K::MXFReader   reader;
+    int               key_flag;
+    byte_t            key_value[16];
+    int               uses_hmac;
+    LabelSet_t        label_set;
+};
+
+/*!
+ @function j2k_mxf_reader_open
+ @abstract Opens a 2D picture track to read single frames from it.
+ @discussion Frames are looked up in the index, so they can be read in any
+             order. Encrypted tracks are decrypted with mxf.key_value.
+ @param opendcp The options.
+ @param mxf_file The picture track.
+ @param info Receives the frame count, size and edit rate of the track.
+ @return The reader, or NULL if the track can not be read.
+*/
+extern "C" j2k_mxf_reader_t *j2k_mxf_reader_open(opendcp_t *opendcp, const char *mxf_file, j2k_mxf_reader_info_t *info) {
+    j2k_mxf_reader_t        *reader = new j2k_mxf_reader_t;
+    JP2K::PictureDescriptor picture_desc;
+    WriterInfo              writer_info;
+    AESDecContext           context;
+
+    reader->key_flag  = opendcp->mxf.key_flag;
+    reader->uses_hmac = 0;
+    reader->label_set = LS_MXF_UNKNOWN;
+
+    Result_t result = reader->reader.OpenRead(mxf_file);
+
+    /* the key is tried once here, each read sets up contexts of its own */
+    if (ASDCP_SUCCESS(result) && opendcp->mxf.key_flag) {
+        memcpy(reader->key_value, opendcp->mxf.key_value, sizeof(reader->key_value));
+        result = context.InitKey(reader->key_value);
+        reader->reader.FillWriterInfo(writer_info);
+        reader->uses_hmac = writer_info.UsesHMAC;
+        reader->label_set = writer_info.LabelSetType;
+    }
+
+    if (ASDCP_FAILURE(result)) {
+        OPENDCP_LOG(LOG_ERROR, "Could not read picture track %s (%s)", mxf_file, result.Label());
+        delete reader;
+        return NULL;
+    }
+
+    reader->reader.FillPictureDescriptor(picture_desc);
+    info->frames        = picture_desc.ContainerDuration;
+    info->w             = picture_desc.StoredWidth;
+    info->h             = picture_desc.StoredHeight;
+    info->edit_rate_num = picture_desc.EditRate.Numerator;
+    info->edit_rate_den = picture_desc.EditRate.Denominator;
+
+    return reader;
+}
+
+/*!
+ @function j2k_mxf_reader_read
+ @abstract Reads the codestream of one frame.
+ @discussion May be called from several threads at once. The frame is read
+             at its offset in the track without a lock, the buffer and the
+             decryption contexts belong to the call.
+ @param reader The reader.
+ @param frame The frame number, from 0.
+ @param data Set to the codestream, which the caller frees.
+ @param length Set to the length of the codestream in bytes.
+ @return OPENDCP_NO_ERROR or OPENDCP_FILEREAD_MXF.
+*/
+extern "C" int j2k_mxf_reader_read(j2k_mxf_reader_t *reader, int frame, unsigned char **data, int *length) {
+    JP2K::FrameBuffer frame_buffer;
+    AESDecContext     context;
+    HMACContext       hmac;
+    Result_t          result = frame_buffer.Capacity(FRAME_BUFFER_SIZE);
+
+    if (ASDCP_SUCCESS(result) && reader->key_flag) {
+        result = context.InitKey(reader->key_value);
+
+        if (ASDCP_SUCCESS(result) && reader->uses_hmac) {
+            result = hmac.InitKey(reader->key_value, reader->label_set);
+        }
+    }
+
+    if (ASDCP_SUCCESS(result)) {
+        result = reader->reader.ReadFrame(frame, frame_buffer, reader->key_flag ? &context : NULL,
+                                          reader->key_flag && reader->uses_hmac ? &hmac : NULL);
+    }
+
+    if (ASDCP_SUCCESS(result)) {
+        *length = frame_buffer.Size();
+        *data   = (unsigned char *)malloc(*length);
+
+        if (*data) {
+            memcpy(*data, frame_buffer.RoData(), *length);
+        } else {
+            result = RESULT_ALLOC;
+        }
+    }
+
+    if (ASDCP_FAILURE(result)) {
+        OPENDCP_LOG(LOG_ERROR, "Failed to read frame %d (%s)", frame, result.Label());
+        return OPENDCP_FILEREAD_MXF;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+extern "C" void j2k_mxf_reader_close(j2k_mxf_reader_t *reader) {
+    if (!reader) {
+        return;
+    }
+
+    reader->reader.Close();
+    delete reader;
+}
+
+/* decryption contexts for a track encrypted with key, none without a key, the hmac only when the track carries one */
+template <class Reader>
+static int decrypt_contexts(const byte_t *key, Reader &reader, AESDecContext **context, HMACContext **hmac) {
+    WriterInfo info;
+
+    *context = NULL;
+    *hmac    = NULL;
+
+    if (!key) {
+        return OPENDCP_NO_ERROR;
+    }
+
+    *context = new AESDecContext;
+
+    if (ASDCP_FAILURE((*context)->InitKey(key))) {
+        OPENDCP_LOG(LOG_ERROR, "Failed to load decryption key");
+        return OPENDCP_FILEREAD_MXF;
+    }
+
+    reader.FillWriterInfo(info);
+
+    if (info.UsesHMAC) {
+        *hmac = new HMACContext;
+
+        if (ASDCP_FAILURE((*hmac)->InitKey(key, info.LabelSetType))) {
+            return OPENDCP_FILEREAD_MXF;
+        }
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* decryption contexts for extracting a track with the key of the options */
+template <class Reader>
+static int extract_contexts(opendcp_t *opendcp, Reader &reader, AESDecContext **context, HMACContext **hmac) {
+    return decrypt_contexts(opendcp->mxf.key_flag ? opendcp->mxf.key_value : NULL, reader, context, hmac);
+}
+
+/*!
+ @function read_pcm_mxf
+ @abstract Extracts a sound track to <output>.wav.
+ @discussion The frames are read straight into a large staging buffer
+             that is written out whenever it fills, so the wav is written
+             a few big blocks at a time. Tracks over 4 GB become RF64.
+ @param opendcp The options, mxf.start_frame and mxf.duration pick the frames.
+ @param mxf_file The sound track.
+ @param output The path the wav is named after.
+ @return OPENDCP_NO_ERROR, OPENDCP_FILEREAD_MXF or OPENDCP_FILEWRITE_EXTRACT.
+*/
+extern "C" int read_pcm_mxf(opendcp_t *opendcp, const char *mxf_file, const char *output) {
+    PCM::MXFReader       reader;
+    PCM::AudioDescriptor audio_desc;
+    PCM::FrameBuffer     frame_buffer;
+    Kumu::FileWriter     writer;
+    AESDecContext        *context;
+    HMACContext          *hmac;
+    char                 filename[MAX_FILENAME_LENGTH + 16];
+    ui32_t               write_count, used = 0;
+    int                  rc;
+
+    Result_t result = reader.OpenRead(mxf_file);
+
+    if (ASDCP_FAILURE(result)) {
+        OPENDCP_LOG(LOG_ERROR, "Could not read file %s", mxf_file);
+        return OPENDCP_FILEREAD_MXF;
+    }
+
+    reader.FillAudioDescriptor(audio_desc);
+
+    rc = extract_contexts(opendcp, reader, &context, &hmac);
+
+    ui32_t frame_size = PCM::CalcFrameBufferSize(audio_desc);
+    ui32_t last_frame = opendcp->mxf.start_frame + (opendcp->mxf.duration ? opendcp->mxf.duration : audio_desc.ContainerDuration);
+
+    if (last_frame > audio_desc.ContainerDuration) {
+        last_frame = audio_desc.ContainerDuration;
+    }
+
+    ui32_t first_frame = (ui32_t)opendcp->mxf.start_frame < last_frame ? opendcp->mxf.start_frame : last_frame;
+
+    /* the header carries the length of the extracted frames only */
+    audio_desc.ContainerDuration = last_frame - first_frame;
+    snprintf(filename, sizeof(filename), "%s.wav", output);
+
+    if (rc == OPENDCP_NO_ERROR && (ASDCP_FAILURE(writer.OpenWrite(filename)) ||
+                                   ASDCP_FAILURE(RF64::SimpleRF64Header(audio_desc).WriteToFile(writer)))) {
+        OPENDCP_LOG(LOG_ERROR, "Failed to write file %s", filename);
+        rc = OPENDCP_FILEWRITE_EXTRACT;
+    }
+
+    ui32_t staging_size = frame_size > EXTRACT_WAV_BUFFER_SIZE ? frame_size : EXTRACT_WAV_BUFFER_SIZE / frame_size * frame_size;
+    byte_t *staging     = rc == OPENDCP_NO_ERROR ? new byte_t[staging_size] : NULL;
+
+    for (ui32_t i = first_frame; rc == OPENDCP_NO_ERROR && i < last_frame; i++) {
+        /* each frame is read in place at the end of the staged data */
+        frame_buffer.SetData(staging + used, frame_size);
+        result = reader.ReadFrame(i, frame_buffer, context, hmac);
+
+        if (ASDCP_FAILURE(result)) {
+            OPENDCP_LOG(LOG_ERROR, "Failed to extract frame %d (%s)", i, result.Label());
+            rc = OPENDCP_FILEREAD_MXF;
+            break;
+        }
+
+        used += frame_buffer.Size();
+
+        if (used + frame_size > staging_size || i + 1 == last_frame) {
+            if (ASDCP_FAILURE(writer.Write(staging, used, &write_count))) {
+                OPENDCP_LOG(LOG_ERROR, "Failed to write file %s", filename);
+                rc = OPENDCP_FILEWRITE_EXTRACT;
+            }
+
+            used = 0;
+        }
+
+        opendcp->mxf.frame_done.callback(opendcp->mxf.frame_done.argument);
+    }
+
+    if (ASDCP_FAILURE(writer.Close()) && rc == OPENDCP_NO_ERROR) {
+        rc = OPENDCP_FILEWRITE_EXTRACT;
+    }
+
+    delete [] staging;
+    delete context;
+    delete hmac;
+
+    opendcp->mxf.file_done.callback(opendcp->mxf.file_done.argument);
+
+    return rc;
+}
+
+static int extract_write(const char *filename, const byte_t *data, ui32_t size) {
+    Kumu::FileWriter writer;
+    ui32_t           write_count;
+
+    if (ASDCP_FAILURE(writer.OpenWrite(filename)) || ASDCP_FAILURE(writer.Write(data, size, &write_count)) ||
+        ASDCP_FAILURE(writer.Close())) {
+        OPENDCP_LOG(LOG_ERROR, "Failed to write file %s", filename);
+        return OPENDCP_FILEWRITE_EXTRACT;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*!
+ @function read_tt_mxf
+ @abstract Extracts a subtitle track to <output>.xml and its resources.
+ @discussion Every ancillary resource, the subtitle images and fonts, is
+             written next to the document as <output>_<uuid>.png or .ttf.
+ @param opendcp The options.
+ @param mxf_file The subtitle track.
+ @param output The path the document and resources are named after.
+ @return OPENDCP_NO_ERROR, OPENDCP_FILEREAD_MXF or OPENDCP_FILEWRITE_EXTRACT.
+*/
+extern "C" int read_tt_mxf(opendcp_t *opendcp, const char *mxf_file, const char *output) {
+    TimedText::MXFReader          reader;
+    TimedText::TimedTextDescriptor tt_desc;
+    TimedText::FrameBuffer        frame_buffer;
+    AESDecContext                 *context;
+    HMACContext                   *hmac;
+    std::string                   xml;
+    char                          filename[MAX_FILENAME_LENGTH + 64];
+    char                          uuid[64];
+    int                           rc;
+
+    Result_t result = reader.OpenRead(mxf_file);
+
+    if (ASDCP_FAILURE(result)) {
+        OPENDCP_LOG(LOG_ERROR, "Could not read file %s", mxf_file);
+        return OPENDCP_FILEREAD_MXF;
+    }
+
+    reader.FillTimedTextDescriptor(tt_desc);
+
+    rc = extract_contexts(opendcp, reader, &context, &hmac);
+
+    if (rc == OPENDCP_NO_ERROR && ASDCP_FAILURE(reader.ReadTimedTextResource(xml, context, hmac))) {
+        OPENDCP_LOG(LOG_ERROR, "Failed to extract the subtitle document");
+        rc = OPENDCP_FILEREAD_MXF;
+    }
+
+    if (rc == OPENDCP_NO_ERROR) {
+        snprintf(filename, sizeof(filename), "%s.xml", output);
+        rc = extract_write(filename, (const byte_t *)xml.c_str(), xml.size());
+    }
+
+    if (rc == OPENDCP_NO_ERROR) {
+        frame_buffer.Capacity(FRAME_BUFFER_SIZE);
+    }
+
+    TimedText::ResourceList_t::const_iterator ri;
+
+    for (ri = tt_desc.ResourceList.begin(); rc == OPENDCP_NO_ERROR && ri != tt_desc.ResourceList.end(); ri++) {
+        result = reader.ReadAncillaryResource(ri->ResourceID, frame_buffer, context, hmac);
+
+        Kumu::UUID(ri->ResourceID).EncodeHex(uuid, sizeof(uuid));
+
+        if (ASDCP_FAILURE(result)) {
+            OPENDCP_LOG(LOG_ERROR, "Failed to extract resource %s (%s)", uuid, result.Label());
+            rc = OPENDCP_FILEREAD_MXF;
+            break;
+        }
+
+        snprintf(filename, sizeof(filename), "%s_%s%s", output, uuid,
+                 ri->Type == TimedText::MT_PNG ? ".png" : ri->Type == TimedText::MT_OPENTYPE ? ".ttf" : ".bin");
+        rc = extract_write(filename, frame_buffer.RoData(), frame_buffer.Size());
+    }
+
+    delete context;
+    delete hmac;
+
+    opendcp->mxf.file_done.callback(opendcp->mxf.file_done.argument);
+
+    return rc;
+}
+
+/*!
+ @function read_mxf
+ @abstract Extracts the essence of a picture, sound or subtitle track.
+ @discussion Picture tracks become codestreams, sound a wav file and
+             subtitles their document and resources, all named after
+             output. Each call has its own readers, so tracks can be
+             extracted on several threads at once.
+ @param opendcp The options.
+ @param mxf_file The track.
+ @param output The path the extracted files are named after.
+ @return OPENDCP_NO_ERROR or an error of the track's extractor.
+*/
+extern "C" int read_mxf(opendcp_t *opendcp, const char *mxf_file, const char *output) {
+    EssenceType_t essence_type;
+
+    if (ASDCP_FAILURE(ASDCP::EssenceType(mxf_file, essence_type))) {
+        return OPENDCP_DETECT_TRACK_TYPE;
+    }
+
+    switch (essence_type) {
+        case ESS_JPEG_2000:
+            return read_j2k_mxf(opendcp, mxf_file, output);
+
+        case ESS_PCM_24b_48k:
+        case ESS_PCM_24b_96k:
+            return read_pcm_mxf(opendcp, mxf_file, output);
+
+        case ESS_TIMED_TEXT:
+            return read_tt_mxf(opendcp, mxf_file, output);
+
+        default:
+            OPENDCP_LOG(LOG_ERROR, "Extracting %s is not supported", mxf_file);
+            return OPENDCP_INVALID_TRACK_TYPE;
+    }
+}
+
+/*
+   Transcoding for rerate_j2k_mxf, extract_2k_j2k_mxf, rekey_j2k_mxf and
+   rewrap_mxf. The threads share one reader, frames are read at their
+   offsets in the track so the reads do not contend for a file position.
+   Each thread owns its buffers and decryption contexts, takes frames
+   from a shared counter and rewrites the codestream of each with the
+   given function. An encrypted new track is encrypted on the threads
+   too, each frame with a fresh IV. The frames are then written through
+   the one writer in turn, so the new track stays in frame order while
+   the rewriting runs in parallel. The first frame is rewritten before
+   the writer is opened, its codestream gives the picture descriptor of
+   the new track. Without a rewrite function the codestreams are written
+   as they are read, straight from the mapped source when it is not
+   encrypted, and the new track takes the label set of the options
+   instead of that of the source. The left eyes of a stereoscopic track
+   are read the same way, at the offsets the index gives for them, and
+   the right eyes are not read at all.
+*/
+#define TRANSCODE_THREADS_MAX 8
+
+typedef int (*j2k_rewrite_t)(const byte_t *data, ui32_t size, byte_t *out, ui32_t capacity, ui32_t *out_size, void *argument);
+
+typedef struct {
+    opendcp_t       *opendcp;
+    const char      *mxf_file;
+    JP2K::MXFReader *reader;
+    JP2K::MXFSReader *stereo;      /* read instead of reader when set, the left eyes only */
+    JP2K::MXFWriter *writer;
+    writer_info_t   *writer_info;
+    mxf_progress_t  *progress;
+    j2k_rewrite_t   rewrite;
+    void            *argument;
+    const byte_t    *key;          /* key of the source frames, NULL when they are not encrypted */
+    pthread_mutex_t mutex;
+    pthread_cond_t  cond;
+    ui32_t          claimed;       /* next frame no thread has taken yet */
+    ui32_t          next;          /* next frame to write */
+    ui32_t          last;
+    int             rc;
+} j2k_transcode_t;
+
+/* the decryption contexts of a thread, for the reader the frames come from */
+static int j2k_transcode_contexts(j2k_transcode_t *transcode, AESDecContext **context, HMACContext **hmac) {
+    if (transcode->stereo) {
+        return decrypt_contexts(transcode->key, *transcode->stereo, context, hmac);
+    }
+
+    return decrypt_contexts(transcode->key, *transcode->reader, context, hmac);
+}
+
+/* reads a frame and rewrites it into frame, out is the buffer to write, the plaintext offset is set for encryption */
+static int j2k_transcode_frame(j2k_transcode_t *transcode, AESDecContext *context, HMACContext *hmac,
+                               ui32_t i, JP2K::FrameBuffer &source, JP2K::FrameBuffer &frame, JP2K::PictureDescriptor &desc,
+                               JP2K::FrameBuffer **out) {
+    byte_t   start_of_data = 0;
+    ui32_t   size = 0;
+    Result_t result = transcode->stereo ? transcode->stereo->ReadLeftFrame(i, source, context, hmac)
+                                        : transcode->reader->ReadFrame(i, source, context, hmac);
+
+    if (ASDCP_FAILURE(result)) {
+        OPENDCP_LOG(LOG_ERROR, "Failed to read frame %u of %s", i, transcode->mxf_file);
+        return OPENDCP_FILEREAD_MXF;
+    }
+
+    *out = transcode->rewrite ? &frame : &source;
+
+    if (transcode->rewrite) {
+        if (transcode->rewrite(source.RoData(), source.Size(), frame.Data(), frame.Capacity(), &size, transcode->argument) != OPENDCP_NO_ERROR) {
+            OPENDCP_LOG(LOG_ERROR, "Could not rewrite the codestream of frame %u", i);
+            return OPENDCP_FILEOPEN_J2K;
+        }
+
+        frame.Size(size);
+    }
+
+    if (ASDCP_FAILURE(JP2K::ParseMetadataIntoDesc(**out, desc, &start_of_data))) {
+        OPENDCP_LOG(LOG_ERROR, "The codestream of frame %u is invalid", i);
+        return OPENDCP_FILEOPEN_J2K;
+    }
+
+    (*out)->PlaintextOffset(transcode->opendcp->mxf.encrypt_header_flag ? 0 : start_of_data);
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* waits for the turn of frame i and writes it, with its ciphertext when ct is set, a failure stops the other threads */
+static int j2k_transcode_write(j2k_transcode_t *transcode, ui32_t i, JP2K::FrameBuffer &frame, const FrameBuffer *ct, int rc) {
+    pthread_mutex_lock(&transcode->mutex);
+
+    while (rc == OPENDCP_NO_ERROR && transcode->next != i && transcode->rc == OPENDCP_NO_ERROR) {
+        pthread_cond_wait(&transcode->cond, &transcode->mutex);
+    }
+
+    if (rc == OPENDCP_NO_ERROR && transcode->rc == OPENDCP_NO_ERROR) {
+        Result_t result = ct ? transcode->writer->WriteEncryptedFrame(frame, *ct, transcode->writer_info->hmac_context)
+                             : transcode->writer->WriteFrame(frame, transcode->writer_info->aes_context,
+                                                             transcode->writer_info->hmac_context);
+
+        if (ASDCP_FAILURE(result) || mxf_progress_frame(transcode->progress, frame.Size())) {
+            rc = OPENDCP_FILEWRITE_MXF;
+        }
+
+        transcode->next++;
+    }
+
+    if (rc != OPENDCP_NO_ERROR && transcode->rc == OPENDCP_NO_ERROR) {
+        transcode->rc = rc;
+    }
+
+    rc = transcode->rc;
+    pthread_cond_broadcast(&transcode->cond);
+    pthread_mutex_unlock(&transcode->mutex);
+
+    return rc;
+}
+
+static void *j2k_transcode_thread(void *arg) {
+    j2k_transcode_t         *transcode = (j2k_transcode_t *)arg;
+    AESDecContext           *context = NULL;
+    HMACContext             *hmac = NULL;
+    AESEncContext           aes_context;
+    Kumu::FortunaRNG        rng;
+    byte_t                  iv_buf[CBC_BLOCK_SIZE];
+    JP2K::FrameBuffer       source(FRAME_BUFFER_SIZE);
+    JP2K::FrameBuffer       frame(transcode->rewrite ? FRAME_BUFFER_SIZE : 0);
+    JP2K::FrameBuffer       *out = &frame;
+    FrameBuffer             ct;
+    JP2K::PictureDescriptor desc;
+    int                     encrypt = transcode->writer_info->aes_context != NULL;
+    int                     rc = j2k_transcode_contexts(transcode, &context, &hmac);
+
+    source.AllowView(true);
+
+    if (rc == OPENDCP_NO_ERROR && encrypt && ASDCP_FAILURE(aes_context.InitKey(transcode->opendcp->mxf.key_value))) {
+        rc = OPENDCP_FILEWRITE_MXF;
+    }
+
+    while (1) {
+        ui32_t i;
+
+        pthread_mutex_lock(&transcode->mutex);
+        i = transcode->rc == OPENDCP_NO_ERROR ? transcode->claimed++ : transcode->last;
+        pthread_mutex_unlock(&transcode->mutex);
+
+        if (i >= transcode->last) {
+            break;
+        }
+
+        if (rc == OPENDCP_NO_ERROR) {
+            rc = j2k_transcode_frame(transcode, context, hmac, i, source, frame, desc, &out);
+        }
+
+        if (rc == OPENDCP_NO_ERROR && encrypt &&
+            (ASDCP_FAILURE(aes_context.SetIVec(rng.FillRandom(iv_buf, CBC_BLOCK_SIZE))) ||
+             ASDCP_FAILURE(EncryptFrameBuffer(*out, ct, &aes_context)))) {
+            OPENDCP_LOG(LOG_ERROR, "Could not encrypt frame %u", i);
+            rc = OPENDCP_FILEWRITE_MXF;
+        }
+
+        if (j2k_transcode_write(transcode, i, *out, encrypt ? &ct : NULL, rc) != OPENDCP_NO_ERROR) {
+            break;
+        }
+    }
+
+    delete context;
+    delete hmac;
+
+    return NULL;
+}
+
+/* wraps every frame of a picture track, rewritten by rewrite, into a new track, the source is decrypted with key,
+   a stereoscopic source gives its left eyes when left_eye is set */
+static int transcode_j2k_mxf(opendcp_t *opendcp, const char *mxf_file, const char *output_file, j2k_rewrite_t rewrite,
+                             void *argument, const byte_t *key, int left_eye) {
+    JP2K::MXFReader         reader;
+    JP2K::MXFSReader        stereo;
+    JP2K::MXFWriter         mxf_writer;
+    JP2K::PictureDescriptor source_desc;
+    JP2K::PictureDescriptor picture_desc;
+    JP2K::FrameBuffer       source(FRAME_BUFFER_SIZE);
+    JP2K::FrameBuffer       frame(rewrite ? FRAME_BUFFER_SIZE : 0);
+    JP2K::FrameBuffer       *out = &frame;
+    WriterInfo              source_info;
+    writer_info_t           writer_info;
+    mxf_progress_t          progress;
+    j2k_transcode_t         transcode;
+    AESDecContext           *context = NULL;
+    HMACContext             *hmac = NULL;
+    pthread_t               threads[TRANSCODE_THREADS_MAX];
+    int                     started[TRANSCODE_THREADS_MAX];
+    byte_t                  digest[20];
+    int                     nthreads, t;
+    int                     rc = OPENDCP_NO_ERROR;
+
+    writer_info.aes_context  = NULL;
+    writer_info.hmac_context = NULL;
+
+    if (is_same_file(mxf_file, output_file)) {
+        OPENDCP_LOG(LOG_ERROR, "The new track must be written to another file than %s", mxf_file);
+        return OPENDCP_FILEWRITE_MXF;
+    }
+
+    Result_t result = left_eye ? stereo.OpenRead(mxf_file) : reader.OpenRead(mxf_file);
+
+    if (ASDCP_SUCCESS(result)) {
+        result = left_eye ? stereo.FillPictureDescriptor(source_desc) : reader.FillPictureDescriptor(source_desc);
+    }
+
+    if (ASDCP_SUCCESS(result)) {
+        result = left_eye ? stereo.FillWriterInfo(source_info) : reader.FillWriterInfo(source_info);
+    }
+
+    if (ASDCP_FAILURE(result) || source_desc.ContainerDuration == 0) {
+        OPENDCP_LOG(LOG_ERROR, "Could not read picture track %s", mxf_file);
+        return OPENDCP_FILEREAD_MXF;
+    }
+
+    if (source_info.EncryptedEssence && !key) {
+        OPENDCP_LOG(LOG_ERROR, "%s is encrypted, its key is needed to read the frames", mxf_file);
+        return OPENDCP_FILEREAD_MXF;
+    }
+
+    transcode.opendcp     = opendcp;
+    transcode.mxf_file    = mxf_file;
+    transcode.reader      = &reader;
+    transcode.stereo      = left_eye ? &stereo : NULL;
+    transcode.writer      = &mxf_writer;
+    transcode.writer_info = &writer_info;
+    transcode.progress    = &progress;
+    transcode.rewrite     = rewrite;
+    transcode.argument    = argument;
+    transcode.key         = source_info.EncryptedEssence ? key : NULL;
+    transcode.claimed     = 1;
+    transcode.next        = 1;
+    transcode.last        = source_desc.ContainerDuration;
+    transcode.rc          = OPENDCP_NO_ERROR;
+
+    source.AllowView(true);
+    rc = j2k_transcode_contexts(&transcode, &context, &hmac);
+
+    if (rc == OPENDCP_NO_ERROR) {
+        rc = j2k_transcode_frame(&transcode, context, hmac, 0, source, frame, picture_desc, &out);
+    }
+
+    delete context;
+    delete hmac;
+
+    if (rc != OPENDCP_NO_ERROR) {
+        return rc;
+    }
+
+    picture_desc.EditRate          = source_desc.EditRate;
+    picture_desc.SampleRate        = left_eye ? source_desc.EditRate : source_desc.SampleRate;
+    picture_desc.AspectRatio       = source_desc.AspectRatio;
+    picture_desc.ContainerDuration = source_desc.ContainerDuration;
+
+    /* a new asset, encrypted with the key of the source under the same key id unless it is re-keyed */
+    result = fill_writer_info(opendcp, &writer_info);
+
+    if (rewrite || left_eye) {
+        writer_info.info.LabelSetType = source_info.LabelSetType;
+    }
+
+    if (source_info.EncryptedEssence && key == opendcp->mxf.key_value &&
+        !is_key_value_set(opendcp->mxf.key_id, sizeof(opendcp->mxf.key_id))) {
+        memcpy(writer_info.info.CryptographicKeyID, source_info.CryptographicKeyID, UUIDlen);
+    }
+
+    if (ASDCP_SUCCESS(result)) {
+        result = mxf_writer.OpenWrite(output_file, writer_info.info, picture_desc);
+    }
+
+    if (ASDCP_FAILURE(result)) {
+        delete writer_info.aes_context;
+        delete writer_info.hmac_context;
+        return OPENDCP_FILEWRITE_MXF;
+    }
+
+    if (opendcp->mxf.digest_flag) {
+        mxf_writer.EnableFileDigest();
+    }
+
+    mxf_async_io(mxf_writer, opendcp);
+    mxf_index_spill(mxf_writer, output_file, transcode.last);
+    mxf_progress_init(&progress, opendcp);
+
+    result = mxf_writer.WriteFrame(*out, writer_info.aes_context, writer_info.hmac_context);
+
+    if (ASDCP_FAILURE(result) || mxf_progress_frame(&progress, out->Size())) {
+        transcode.rc = OPENDCP_FILEWRITE_MXF;
+    }
+
+    pthread_mutex_init(&transcode.mutex, NULL);
+    pthread_cond_init(&transcode.cond, NULL);
+
+    nthreads = opendcp->threads > 0 ? opendcp->threads : 1;
+    nthreads = nthreads > TRANSCODE_THREADS_MAX ? TRANSCODE_THREADS_MAX : nthreads;
+
+    /* the last worker runs on this thread, as does any that can not be started */
+    for (t = 0; t < nthreads; t++) {
+        started[t] = t < nthreads - 1 && pthread_create(&threads[t], NULL, j2k_transcode_thread, &transcode) == 0;
+
+        if (!started[t]) {
+            j2k_transcode_thread(&transcode);
+        }
+    }
+
+    for (t = 0; t < nthreads; t++) {
+        if (started[t]) {
+            pthread_join(threads[t], NULL);
+        }
+    }
+
+    pthread_cond_destroy(&transcode.cond);
+    pthread_mutex_destroy(&transcode.mutex);
+
+    reader.Close();
+    stereo.Close();
+    rc = transcode.rc;
+
+    if (rc == OPENDCP_NO_ERROR) {
+        mxf_progress_flush(&progress);
+
+        if (ASDCP_FAILURE(mxf_writer.Finalize())) {
+            rc = OPENDCP_FINALIZE_MXF;
+        }
+
+        opendcp->mxf.file_done.callback(opendcp->mxf.file_done.argument);
+    }
+
+    delete writer_info.aes_context;
+    delete writer_info.hmac_context;
+
+    if (rc != OPENDCP_NO_ERROR) {
+        unlink(output_file);
+        return rc;
+    }
+
+    if (opendcp->mxf.digest_flag && ASDCP_SUCCESS(mxf_writer.FileDigest(digest))) {
+        write_digest_sidecar(opendcp, output_file, digest);
+    }
+
+    return rc;
+}
+
+/* the rewrite of rerate_j2k_mxf, the budget is the codestream size of a frame */
+static int rerate_rewrite(const byte_t *data, ui32_t size, byte_t *out, ui32_t capacity, ui32_t *out_size, void *argument) {
+    int layers;
+
+    return opendcp_codestream_rerate(data, size, *(ui32_t *)argument, out, capacity, out_size, &layers);
+}
+
+/*!
+ @function rerate_j2k_mxf
+ @abstract Writes a picture track at a lower bit rate from a layered master.
+ @discussion The master is a track encoded with quality layers, opendcp_j2k
+             --layers. Each codestream is cut to the most layers that fit
+             the bit rate, without decoding, and written as a single layer
+             codestream with the DCI profile, so the new track is
+             compliant. Frames are read, cut and written on mxf threads.
+             The new track is a new asset, encrypted with mxf.key_value
+             when the master is.
+ @param opendcp The options, mxf.key_value must be the key of an encrypted master.
+ @param mxf_file The layered 2D picture track.
+ @param bw The bit rate of the new track, in bits per second.
+ @param output_file The new track.
+ @return OPENDCP_NO_ERROR, OPENDCP_FILEREAD_MXF, OPENDCP_FILEOPEN_J2K,
+         OPENDCP_FILEWRITE_MXF or OPENDCP_FINALIZE_MXF.
+*/
+extern "C" int rerate_j2k_mxf(opendcp_t *opendcp, const char *mxf_file, int bw, const char *output_file) {
+    JP2K::MXFReader         reader;
+    JP2K::PictureDescriptor desc;
+    EssenceType_t           essence_type;
+    ui32_t                  budget;
+
+    if (ASDCP_FAILURE(ASDCP::EssenceType(mxf_file, essence_type)) || essence_type != ESS_JPEG_2000 ||
+        ASDCP_FAILURE(reader.OpenRead(mxf_file)) || ASDCP_FAILURE(reader.FillPictureDescriptor(desc)) ||
+        desc.EditRate.Numerator == 0) {
+        OPENDCP_LOG(LOG_ERROR, "%s is not a 2D picture track", mxf_file);
+        return OPENDCP_FILEREAD_MXF;
+    }
+
+    reader.Close();
+
+    budget = (ui32_t)((double)bw / 8 * desc.EditRate.Denominator / desc.EditRate.Numerator);
+    OPENDCP_LOG(LOG_INFO, "re-rating %s to %d Mb/s, %u bytes a frame", mxf_file, bw / 1000000, budget);
+
+    return transcode_j2k_mxf(opendcp, mxf_file, output_file, rerate_rewrite, &budget,
+                             opendcp->mxf.key_flag ? opendcp->mxf.key_value : NULL, 0);
+}
+
+static int extract_2k_rewrite(const byte_t *data, ui32_t size, byte_t *out, ui32_t capacity, ui32_t *out_size, void *) {
+    return opendcp_codestream_extract_2k(data, size, out, capacity, out_size);
+}
+
+/*!
+ @function extract_2k_j2k_mxf
+ @abstract Writes the 2K picture track held in a 4K picture track.
+ @discussion Each codestream has the packets of its highest resolution
+             left out, without decoding, and is written as a DCI 2K
+             codestream. Frames are read, rewritten and written on mxf
+             threads. The new track is a new asset of the same frame rate,
+             encrypted with mxf.key_value when the 4K track is.
+ @param opendcp The options, mxf.key_value must be the key of an encrypted track.
+ @param mxf_file The 4K 2D picture track.
+ @param output_file The 2K track.
+ @return OPENDCP_NO_ERROR, OPENDCP_FILEREAD_MXF, OPENDCP_FILEOPEN_J2K,
+         OPENDCP_FILEWRITE_MXF or OPENDCP_FINALIZE_MXF.
+*/
+extern "C" int extract_2k_j2k_mxf(opendcp_t *opendcp, const char *mxf_file, const char *output_file) {
+    EssenceType_t essence_type;
+
+    if (ASDCP_FAILURE(ASDCP::EssenceType(mxf_file, essence_type)) || essence_type != ESS_JPEG_2000) {
+        OPENDCP_LOG(LOG_ERROR, "%s is not a 2D picture track", mxf_file);
+        return OPENDCP_FILEREAD_MXF;
+    }
+
+    OPENDCP_LOG(LOG_INFO, "extracting the 2K track of %s", mxf_file);
+
+    return transcode_j2k_mxf(opendcp, mxf_file, output_file, extract_2k_rewrite, NULL,
+                             opendcp->mxf.key_flag ? opendcp->mxf.key_value : NULL, 0);
+}
+
+/* the rewrite of rekey_j2k_mxf, the codestream is kept as it is */
+static int rekey_rewrite(const byte_t *data, ui32_t size, byte_t *out, ui32_t capacity, ui32_t *out_size, void *) {
+    if (size > capacity) {
+        return OPENDCP_ERROR;
+    }
+
+    memcpy(out, data, size);
+    *out_size = size;
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*!
+ @function rekey_j2k_mxf
+ @abstract Writes an encrypted picture track again under a new key.
+ @discussion Each frame is decrypted with the old key, checked against its
+             HMAC when the track has one, and encrypted with mxf.key_value
+             and a fresh IV, without touching the codestream. Frames are
+             read, decrypted and encrypted on mxf threads and written in
+             order, with no intermediate files. The new track is a new
+             asset under mxf.key_id, a random key id when it is not set.
+ @param opendcp The options, mxf.key_value is the new key.
+ @param mxf_file The encrypted 2D picture track.
+ @param old_key The key mxf_file is encrypted with.
+ @param output_file The re-keyed track.
+ @return OPENDCP_NO_ERROR, OPENDCP_FILEREAD_MXF, OPENDCP_FILEOPEN_J2K,
+         OPENDCP_FILEWRITE_MXF or OPENDCP_FINALIZE_MXF.
+*/
+extern "C" int rekey_j2k_mxf(opendcp_t *opendcp, const char *mxf_file, const unsigned char *old_key, const char *output_file) {
+    JP2K::MXFReader reader;
+    WriterInfo      info;
+    EssenceType_t   essence_type;
+
+    if (ASDCP_FAILURE(ASDCP::EssenceType(mxf_file, essence_type)) || essence_type != ESS_JPEG_2000 ||
+        ASDCP_FAILURE(reader.OpenRead(mxf_file)) || ASDCP_FAILURE(reader.FillWriterInfo(info))) {
+        OPENDCP_LOG(LOG_ERROR, "%s is not a 2D picture track", mxf_file);
+        return OPENDCP_FILEREAD_MXF;
+    }
+
+    reader.Close();
+
+    if (!info.EncryptedEssence) {
+        OPENDCP_LOG(LOG_ERROR, "%s is not encrypted", mxf_file);
+        return OPENDCP_FILEREAD_MXF;
+    }
+
+    if (!opendcp->mxf.key_flag) {
+        OPENDCP_LOG(LOG_ERROR, "A new key is needed to re-key %s", mxf_file);
+        return OPENDCP_FILEWRITE_MXF;
+    }
+
+    OPENDCP_LOG(LOG_INFO, "re-keying %s", mxf_file);
+
+    return transcode_j2k_mxf(opendcp, mxf_file, output_file, rekey_rewrite, NULL, old_key, 0);
+}
+
+/*!
+ @function left_eye_j2k_mxf
+ @abstract Writes the left eyes of a stereoscopic picture track as a 2D track.
+ @discussion The 2D version of a 3D master, without decoding or extracting
+             codestreams. Only the left eye packets are read, at the
+             offsets the index gives, plaintext ones as views of the mapped
+             file. Frames are read and written on mxf threads in order,
+             the new track keeps the label set of the source and is a new
+             asset. An encrypted master is decrypted with key, the new
+             track is encrypted with mxf.key_value when mxf.key_flag is set
+             and is plaintext otherwise.
+ @param opendcp The options.
+ @param mxf_file The stereoscopic picture track.
+ @param key The key mxf_file is encrypted with, NULL when it is not encrypted.
+ @param output_file The 2D track.
+ @return OPENDCP_NO_ERROR, OPENDCP_FILEREAD_MXF, OPENDCP_FILEOPEN_J2K,
+         OPENDCP_FILEWRITE_MXF or OPENDCP_FINALIZE_MXF.
+*/
+extern "C" int left_eye_j2k_mxf(opendcp_t *opendcp, const char *mxf_file, const unsigned char *key, const char *output_file) {
+    EssenceType_t essence_type;
+
+    if (ASDCP_FAILURE(ASDCP::EssenceType(mxf_file, essence_type)) || essence_type != ESS_JPEG_2000_S) {
+        OPENDCP_LOG(LOG_ERROR, "%s is not a stereoscopic picture track", mxf_file);
+        return OPENDCP_FILEREAD_MXF;
+    }
+
+    OPENDCP_LOG(LOG_INFO, "writing the left eye of %s", mxf_file);
+
+    return transcode_j2k_mxf(opendcp, mxf_file, output_file, NULL, NULL, key, 1);
+}
+
+/* sound frames read at once when rewrapping, a few seconds of sound in one read */
+#define REWRAP_PCM_FRAMES 96
+
+/* the writer info of a rewrapped track, a new asset with the label set of the options under the key id of the source */
+static int rewrap_writer_info(opendcp_t *opendcp, const char *mxf_file, WriterInfo &source_info, writer_info_t *writer_info) {
+    writer_info->aes_context  = NULL;
+    writer_info->hmac_context = NULL;
+
+    if (source_info.EncryptedEssence != (opendcp->mxf.key_flag != 0)) {
+        OPENDCP_LOG(LOG_ERROR, source_info.EncryptedEssence ? "%s is encrypted, its key is needed to rewrap it"
+                                                            : "%s is not encrypted, it is rewrapped without a key", mxf_file);
+        return OPENDCP_FILEREAD_MXF;
+    }
+
+    if (ASDCP_FAILURE(fill_writer_info(opendcp, writer_info))) {
+        delete writer_info->aes_context;
+        delete writer_info->hmac_context;
+        return OPENDCP_FILEWRITE_MXF;
+    }
+
+    if (source_info.EncryptedEssence && !is_key_value_set(opendcp->mxf.key_id, sizeof(opendcp->mxf.key_id))) {
+        memcpy(writer_info->info.CryptographicKeyID, source_info.CryptographicKeyID, UUIDlen);
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* finishes a rewrapped track, removed when it failed */
+template <class Writer>
+static int rewrap_finish(opendcp_t *opendcp, Writer &mxf_writer, writer_info_t *writer_info, const char *output_file, int rc) {
+    byte_t digest[20];
+
+    if (rc == OPENDCP_NO_ERROR && ASDCP_FAILURE(mxf_writer.Finalize())) {
+        rc = OPENDCP_FINALIZE_MXF;
+    }
+
+    delete writer_info->aes_context;
+    delete writer_info->hmac_context;
+
+    if (rc != OPENDCP_NO_ERROR) {
+        unlink(output_file);
+        return rc;
+    }
+
+    if (opendcp->mxf.digest_flag && ASDCP_SUCCESS(mxf_writer.FileDigest(digest))) {
+        write_digest_sidecar(opendcp, output_file, digest);
+    }
+
+    opendcp->mxf.file_done.callback(opendcp->mxf.file_done.argument);
+
+    return rc;
+}
+
+/* both eyes of every frame, as they are read */
+static int rewrap_stereo_mxf(opendcp_t *opendcp, const char *mxf_file, const char *output_file) {
+    JP2K::MXFSReader        reader;
+    JP2K::MXFSWriter        mxf_writer;
+    JP2K::PictureDescriptor picture_desc;
+    JP2K::FrameBuffer       frame(FRAME_BUFFER_SIZE);
+    WriterInfo              source_info;
+    writer_info_t           writer_info;
+    mxf_progress_t          progress;
+    AESDecContext           *context = NULL;
+    HMACContext             *hmac = NULL;
+    int                     rc;
+
+    if (ASDCP_FAILURE(reader.OpenRead(mxf_file)) || ASDCP_FAILURE(reader.FillPictureDescriptor(picture_desc)) ||
+        ASDCP_FAILURE(reader.FillWriterInfo(source_info))) {
+        OPENDCP_LOG(LOG_ERROR, "Could not read picture track %s", mxf_file);
+        return OPENDCP_FILEREAD_MXF;
+    }
+
+    rc = rewrap_writer_info(opendcp, mxf_file, source_info, &writer_info);
+
+    if (rc != OPENDCP_NO_ERROR) {
+        return rc;
+    }
+
+    if (ASDCP_FAILURE(mxf_writer.OpenWrite(output_file, writer_info.info, picture_desc))) {
+        delete writer_info.aes_context;
+        delete writer_info.hmac_context;
+        return OPENDCP_FILEWRITE_MXF;
+    }
+
+    if (opendcp->mxf.digest_flag) {
+        mxf_writer.EnableFileDigest();
+    }
+
+    mxf_async_io(mxf_writer, opendcp);
+    mxf_index_spill(mxf_writer, output_file, picture_desc.ContainerDuration);
+    mxf_progress_init(&progress, opendcp);
+
+    frame.AllowView(true);
+    rc = extract_contexts(opendcp, reader, &context, &hmac);
+
+    for (ui32_t i = 0; rc == OPENDCP_NO_ERROR && i < picture_desc.ContainerDuration; i++) {
+        ui64_t bytes = 0;
+
+        for (int eye = 0; rc == OPENDCP_NO_ERROR && eye < 2; eye++) {
+            JP2K::StereoscopicPhase_t phase = eye ? JP2K::SP_RIGHT : JP2K::SP_LEFT;
+
+            if (ASDCP_FAILURE(reader.ReadFrame(i, phase, frame, context, hmac))) {
+                OPENDCP_LOG(LOG_ERROR, "Failed to read frame %u of %s", i, mxf_file);
+                rc = OPENDCP_FILEREAD_MXF;
+            }
+            else if (ASDCP_FAILURE(mxf_writer.WriteFrame(frame, phase, writer_info.aes_context, writer_info.hmac_context))) {
+                rc = OPENDCP_FILEWRITE_MXF;
+            }
+
+            bytes += frame.Size();
+        }
+
+        if (rc == OPENDCP_NO_ERROR && mxf_progress_frame(&progress, bytes)) {
+            rc = OPENDCP_FILEWRITE_MXF;
+        }
+    }
+
+    mxf_progress_flush(&progress);
+    reader.Close();
+    delete context;
+    delete hmac;
+
+    return rewrap_finish(opendcp, mxf_writer, &writer_info, output_file, rc);
+}
+
+/* the sound frames, REWRAP_PCM_FRAMES at a time with one read */
+static int rewrap_pcm_mxf(opendcp_t *opendcp, const char *mxf_file, const char *output_file) {
+    PCM::MXFReader       reader;
+    PCM::MXFWriter       mxf_writer;
+    PCM::AudioDescriptor audio_desc;
+    PCM::FrameBuffer     frames[REWRAP_PCM_FRAMES];
+    PCM::FrameBuffer     *buffers[REWRAP_PCM_FRAMES];
+    WriterInfo           source_info;
+    writer_info_t        writer_info;
+    mxf_progress_t       progress;
+    AESDecContext        *context = NULL;
+    HMACContext          *hmac = NULL;
+    int                  rc;
+
+    if (ASDCP_FAILURE(reader.OpenRead(mxf_file)) || ASDCP_FAILURE(reader.FillAudioDescriptor(audio_desc)) ||
+        ASDCP_FAILURE(reader.FillWriterInfo(source_info))) {
+        OPENDCP_LOG(LOG_ERROR, "Could not read sound track %s", mxf_file);
+        return OPENDCP_FILEREAD_MXF;
+    }
+
+    rc = rewrap_writer_info(opendcp, mxf_file, source_info, &writer_info);
+
+    if (rc != OPENDCP_NO_ERROR) {
+        return rc;
+    }
+
+    if (ASDCP_FAILURE(mxf_writer.OpenWrite(output_file, writer_info.info, audio_desc))) {
+        delete writer_info.aes_context;
+        delete writer_info.hmac_context;
+        return OPENDCP_FILEWRITE_MXF;
+    }
+
+    if (opendcp->mxf.digest_flag) {
+        mxf_writer.EnableFileDigest();
+    }
+
+    mxf_async_io(mxf_writer, opendcp);
+    mxf_progress_init(&progress, opendcp);
+
+    for (int k = 0; k < REWRAP_PCM_FRAMES; k++) {
+        frames[k].Capacity(PCM::CalcFrameBufferSize(audio_desc));
+        frames[k].AllowView(true);
+        buffers[k] = &frames[k];
+    }
+
+    rc = extract_contexts(opendcp, reader, &context, &hmac);
+
+    for (ui32_t i = 0; rc == OPENDCP_NO_ERROR && i < audio_desc.ContainerDuration; i += REWRAP_PCM_FRAMES) {
+        ui32_t count = audio_desc.ContainerDuration - i < REWRAP_PCM_FRAMES ? audio_desc.ContainerDuration - i : REWRAP_PCM_FRAMES;
+
+        if (ASDCP_FAILURE(reader.ReadFrames(i, count, buffers, context, hmac))) {
+            OPENDCP_LOG(LOG_ERROR, "Failed to read frames %u to %u of %s", i, i + count - 1, mxf_file);
+            rc = OPENDCP_FILEREAD_MXF;
+        }
+
+        for (ui32_t k = 0; rc == OPENDCP_NO_ERROR && k < count; k++) {
+            if (ASDCP_FAILURE(mxf_writer.WriteFrame(frames[k], writer_info.aes_context, writer_info.hmac_context)) ||
+                mxf_progress_frame(&progress, frames[k].Size())) {
+                rc = OPENDCP_FILEWRITE_MXF;
+            }
+        }
+    }
+
+    mxf_progress_flush(&progress);
+    reader.Close();
+    delete context;
+    delete hmac;
+
+    return rewrap_finish(opendcp, mxf_writer, &writer_info, output_file, rc);
+}
+
+/* the subtitle document and its resources, the document itself is not converted */
+static int rewrap_tt_mxf(opendcp_t *opendcp, const char *mxf_file, const char *output_file) {
+    TimedText::MXFReader           reader;
+    TimedText::MXFWriter           mxf_writer;
+    TimedText::TimedTextDescriptor tt_desc;
+    TimedText::FrameBuffer         frame_buffer(FRAME_BUFFER_SIZE);
+    WriterInfo                     source_info;
+    writer_info_t                  writer_info;
+    AESDecContext                  *context = NULL;
+    HMACContext                    *hmac = NULL;
+    std::string                    xml;
+    int                            rc;
+
+    if (ASDCP_FAILURE(reader.OpenRead(mxf_file)) || ASDCP_FAILURE(reader.FillTimedTextDescriptor(tt_desc)) ||
+        ASDCP_FAILURE(reader.FillWriterInfo(source_info))) {
+        OPENDCP_LOG(LOG_ERROR, "Could not read subtitle track %s", mxf_file);
+        return OPENDCP_FILEREAD_MXF;
+    }
+
+    rc = rewrap_writer_info(opendcp, mxf_file, source_info, &writer_info);
+
+    if (rc != OPENDCP_NO_ERROR) {
+        return rc;
+    }
+
+    rc = extract_contexts(opendcp, reader, &context, &hmac);
+
+    if (rc == OPENDCP_NO_ERROR && ASDCP_FAILURE(reader.ReadTimedTextResource(xml, context, hmac))) {
+        OPENDCP_LOG(LOG_ERROR, "Failed to read the subtitle document of %s", mxf_file);
+        rc = OPENDCP_FILEREAD_MXF;
+    }
+
+    if (rc == OPENDCP_NO_ERROR && ASDCP_FAILURE(mxf_writer.OpenWrite(output_file, writer_info.info, tt_desc))) {
+        rc = OPENDCP_FILEWRITE_MXF;
+    }
+
+    if (rc != OPENDCP_NO_ERROR) {
+        delete context;
+        delete hmac;
+        delete writer_info.aes_context;
+        delete writer_info.hmac_context;
+        return rc;
+    }
+
+    if (opendcp->mxf.digest_flag) {
+        mxf_writer.EnableFileDigest();
+    }
+
+    mxf_async_io(mxf_writer, opendcp);
+
+    if (ASDCP_FAILURE(mxf_writer.WriteTimedTextResource(xml, writer_info.aes_context, writer_info.hmac_context))) {
+        rc = OPENDCP_FILEWRITE_MXF;
+    }
+
+    TimedText::ResourceList_t::const_iterator ri;
+
+    for (ri = tt_desc.ResourceList.begin(); rc == OPENDCP_NO_ERROR && ri != tt_desc.ResourceList.end(); ri++) {
+        if (ASDCP_FAILURE(reader.ReadAncillaryResource(ri->ResourceID, frame_buffer, context, hmac))) {
+            OPENDCP_LOG(LOG_ERROR, "Failed to read a resource of %s", mxf_file);
+            rc = OPENDCP_FILEREAD_MXF;
+        }
+        else if (ASDCP_FAILURE(mxf_writer.WriteAncillaryResource(frame_buffer, writer_info.aes_context, writer_info.hmac_context))) {
+            rc = OPENDCP_FILEWRITE_MXF;
+        }
+    }
+
+    reader.Close();
+    delete context;
+    delete hmac;
+
+    return rewrap_finish(opendcp, mxf_writer, &writer_info, output_file, rc);
+}
+
+/*!
+ @function rewrap_mxf
+ @abstract Writes a track again with the label set of opendcp->ns.
+ @discussion Converts a track between Interop and SMPTE without touching
+             its essence. Picture frames are read through the index and
+             written as they are, from the mapped file when they are not
+             encrypted, sound is read many frames at a time and subtitles
+             keep their document and resources. An encrypted track needs
+             its key, it is encrypted again with the same key under the
+             same key id unless mxf.key_id is set. Each call has its own
+             readers and writer, so tracks can be rewrapped on several
+             threads at once.
+ @param opendcp The options, ns picks the label set of the new track.
+ @param mxf_file The track.
+ @param output_file The rewrapped track.
+ @return OPENDCP_NO_ERROR, OPENDCP_DETECT_TRACK_TYPE, OPENDCP_INVALID_TRACK_TYPE,
+         OPENDCP_FILEREAD_MXF, OPENDCP_FILEWRITE_MXF or OPENDCP_FINALIZE_MXF.
+*/
+extern "C" int rewrap_mxf(opendcp_t *opendcp, const char *mxf_file, const char *output_file) {
+    EssenceType_t essence_type;
+
+    if (is_same_file(mxf_file, output_file)) {
+        OPENDCP_LOG(LOG_ERROR, "The rewrapped track must be written to another file than %s", mxf_file);
+        return OPENDCP_FILEWRITE_MXF;
+    }
+
+    if (ASDCP_FAILURE(ASDCP::EssenceType(mxf_file, essence_type))) {
+        return OPENDCP_DETECT_TRACK_TYPE;
+    }
+
+    OPENDCP_LOG(LOG_INFO, "rewrapping %s as %s", mxf_file, opendcp->ns == XML_NS_INTEROP ? "interop" : "smpte");
+
+    switch (essence_type) {
+        case ESS_JPEG_2000:
+            return transcode_j2k_mxf(opendcp, mxf_file, output_file, NULL, NULL,
+                                     opendcp->mxf.key_flag ? opendcp->mxf.key_value : NULL, 0);
+
+        case ESS_JPEG_2000_S:
+            return rewrap_stereo_mxf(opendcp, mxf_file, output_file);
+
+        case ESS_PCM_24b_48k:
+        case ESS_PCM_24b_96k:
+            return rewrap_pcm_mxf(opendcp, mxf_file, output_file);
+
+        case ESS_TIMED_TEXT:
+            return rewrap_tt_mxf(opendcp, mxf_file, output_file);
+
+        default:
+            OPENDCP_LOG(LOG_ERROR, "Rewrapping %s is not supported", mxf_file);
+            return OPENDCP_INVALID_TRACK_TYPE;
+    }
+}
+
+/*
+   Parallel integrity check for verify_mxf. As with extraction, the frame
+   range is split into contiguous blocks, which run on the thread pool and
+   each read their frames with a reader of their own. Frames are read in
+   batches and, when a key is given, each frame's integrity pack (MIC and
+   sequence number) is tested on the ciphertext, so nothing is decrypted.
+   A block stops once a lower frame is already known to be bad.
+*/
+#define VERIFY_BATCH_FRAMES 8
+
+typedef struct {
+    opendcp_t       *opendcp;
+    const char      *mxf_file;
+    EssenceType_t   essence_type;
+    ui32_t          first;
+    ui32_t          last;
+    int             uses_hmac;
+    ui32_t          *first_bad;
+    pthread_mutex_t *mutex;
+} mxf_verify_t;
+
+/* record a bad frame, returns false if the thread should stop */
+static bool mxf_verify_report(mxf_verify_t *verify, ui32_t frame, Result_t result) {
+    pthread_mutex_lock(verify->mutex);
+
+    if (ASDCP_FAILURE(result) && frame < *verify->first_bad) {
+        OPENDCP_LOG(LOG_DEBUG, "Frame %d failed verification (%s)", frame, result.Label());
+        *verify->first_bad = frame;
+    }
+
+    bool more = ASDCP_SUCCESS(result) && frame < *verify->first_bad;
+    pthread_mutex_unlock(verify->mutex);
+
+    return more;
+}
+
+template <class Reader, class Buffer>
+static void mxf_verify_frames(mxf_verify_t *verify, Reader &reader, ui32_t buffer_size, HMACContext *hmac) {
+    Buffer  frame_buffers[VERIFY_BATCH_FRAMES];
+    Buffer *batch[VERIFY_BATCH_FRAMES];
+
+    for (ui32_t k = 0; k < VERIFY_BATCH_FRAMES; k++) {
+        if (ASDCP_FAILURE(frame_buffers[k].Capacity(buffer_size))) {
+            mxf_verify_report(verify, verify->first, RESULT_ALLOC);
+            return;
+        }
+
+        /* plaintext frames are checked in place in the mapped file */
+        frame_buffers[k].AllowView(true);
+        batch[k] = &frame_buffers[k];
+    }
+
+    for (ui32_t i = verify->first; i < verify->last; i += VERIFY_BATCH_FRAMES) {
+        ui32_t count = verify->last - i < VERIFY_BATCH_FRAMES ? verify->last - i : VERIFY_BATCH_FRAMES;
+        Result_t result = reader.ReadFrames(i, count, batch, 0, hmac);
+
+        /* a batch failed, find the frame responsible */
+        if (ASDCP_FAILURE(result)) {
+            for (ui32_t k = 0; k < count; k++) {
+                result = reader.ReadFrame(i + k, frame_buffers[k], 0, hmac);
+
+                if (ASDCP_FAILURE(result)) {
+                    mxf_verify_report(verify, i + k, result);
+                    return;
+                }
+            }
+        }
+
+        if (!mxf_verify_report(verify, i + count - 1, result)) {
+            return;
+        }
+    }
+}
+
+static void mxf_verify_stereo_frames(mxf_verify_t *verify, JP2K::MXFSReader &reader, HMACContext *hmac) {
+    JP2K::FrameBuffer frame_buffer(FRAME_BUFFER_SIZE);
+
+    for (ui32_t i = verify->first; i < verify->last; i++) {
+        Result_t result = reader.ReadFrame(i, JP2K::SP_LEFT, frame_buffer, 0, hmac);
+
+        if (ASDCP_SUCCESS(result)) {
+            result = reader.ReadFrame(i, JP2K::SP_RIGHT, frame_buffer, 0, hmac);
+        }
+
+        if (!mxf_verify_report(verify, i, result)) {
+            return;
+        }
+    }
+}
+
+static void *mxf_verify_thread(void *arg) {
+    mxf_verify_t *verify = (mxf_verify_t *)arg;
+    opendcp_t    *opendcp = verify->opendcp;
+    HMACContext  *hmac = 0;
+    Result_t      result = RESULT_OK;
+
+    if (opendcp->mxf.key_flag && verify->uses_hmac) {
+        hmac = new HMACContext;
+    }
+
+    if (verify->essence_type == ESS_JPEG_2000) {
+        JP2K::MXFReader reader;
+        WriterInfo      info;
+        result = reader.OpenRead(verify->mxf_file);
+
+        if (ASDCP_SUCCESS(result) && hmac) {
+            reader.FillWriterInfo(info);
+            result = hmac->InitKey(opendcp->mxf.key_value, info.LabelSetType);
+        }
+
+        if (ASDCP_SUCCESS(result)) {
+            mxf_verify_frames<JP2K::MXFReader, JP2K::FrameBuffer>(verify, reader, FRAME_BUFFER_SIZE, hmac);
+        }
+    }
+    else if (verify->essence_type == ESS_JPEG_2000_S) {
+        JP2K::MXFSReader reader;
+        WriterInfo       info;
+        result = reader.OpenRead(verify->mxf_file);
+
+        if (ASDCP_SUCCESS(result) && hmac) {
+            reader.FillWriterInfo(info);
+            result = hmac->InitKey(opendcp->mxf.key_value, info.LabelSetType);
+        }
+
+        if (ASDCP_SUCCESS(result)) {
+            mxf_verify_stereo_frames(verify, reader, hmac);
+        }
+    }
+    else {
+        PCM::MXFReader       reader;
+        PCM::AudioDescriptor audio_desc;
+        WriterInfo           info;
+        result = reader.OpenRead(verify->mxf_file);
+
+        if (ASDCP_SUCCESS(result) && hmac) {
+            reader.FillWriterInfo(info);
+            result = hmac->InitKey(opendcp->mxf.key_value, info.LabelSetType);
+        }
+
+        if (ASDCP_SUCCESS(result)) {
+            /* leave room for the ciphertext padding, iv, check value and integrity pack */
+            reader.FillAudioDescriptor(audio_desc);
+            mxf_verify_frames<PCM::MXFReader, PCM::FrameBuffer>(verify, reader, PCM::CalcFrameBufferSize(audio_desc) + Kumu::Kilobyte, hmac);
+        }
+    }
+
+    if (ASDCP_FAILURE(result)) {
+        mxf_verify_report(verify, verify->first, result);
+    }
+
+    delete hmac;
+
+    return NULL;
+}
+
+/* check every frame of a j2k or pcm mxf, and its integrity pack when a key is set */
+extern "C" int verify_mxf(opendcp_t *opendcp, const char *mxf_file, int *bad_frame) {
+    EssenceType_t   essence_type;
+    WriterInfo      info;
+    ui32_t          frame_count = 0;
+    ui32_t          first_bad;
+    int             uses_hmac = 0;
+    std::vector<mxf_verify_t> verify;
+    int             nthreads, t;
+    pthread_mutex_t mutex;
+    Result_t        result = RESULT_OK;
+
+    *bad_frame = -1;
+
+    result = ASDCP::EssenceType(mxf_file, essence_type);
+
+    if (ASDCP_FAILURE(result)) {
+        OPENDCP_LOG(LOG_ERROR, "Could not read file %s", mxf_file);
+        return OPENDCP_FILEREAD_MXF;
+    }
+
+    if (essence_type == ESS_JPEG_2000) {
+        JP2K::MXFReader reader;
+        JP2K::PictureDescriptor picture_desc;
+        result = reader.OpenRead(mxf_file);
+        reader.FillPictureDescriptor(picture_desc);
+        reader.FillWriterInfo(info);
+        frame_count = picture_desc.ContainerDuration;
+    }
+    else if (essence_type == ESS_JPEG_2000_S) {
+        JP2K::MXFSReader reader;
+        JP2K::PictureDescriptor picture_desc;
+        result = reader.OpenRead(mxf_file);
+        reader.FillPictureDescriptor(picture_desc);
+        reader.FillWriterInfo(info);
+        frame_count = picture_desc.ContainerDuration;
+    }
+    else if (essence_type == ESS_PCM_24b_48k || essence_type == ESS_PCM_24b_96k) {
+        PCM::MXFReader reader;
+        PCM::AudioDescriptor audio_desc;
+        result = reader.OpenRead(mxf_file);
+        reader.FillAudioDescriptor(audio_desc);
+        reader.FillWriterInfo(info);
+        frame_count = audio_desc.ContainerDuration;
+    }
+    else {
+        OPENDCP_LOG(LOG_ERROR, "%s is not a picture or sound track", mxf_file);
+        return OPENDCP_INVALID_TRACK_TYPE;
+    }
+
+    if (ASDCP_FAILURE(result)) {
+        OPENDCP_LOG(LOG_ERROR, "Could not read file %s", mxf_file);
+        return OPENDCP_FILEREAD_MXF;
+    }
+
+    OPENDCP_LOG(LOG_INFO, "Detected %d frames", frame_count);
+
+    if (info.EncryptedEssence && info.UsesHMAC && opendcp->mxf.key_flag) {
+        uses_hmac = 1;
+    }
+    else if (info.EncryptedEssence && !info.UsesHMAC) {
+        OPENDCP_LOG(LOG_WARN, "File does not contain HMAC values, only the frame structure is checked");
+    }
+    else if (info.EncryptedEssence) {
+        OPENDCP_LOG(LOG_WARN, "No key given, only the frame structure is checked");
+    }
+
+    if (!frame_count) {
+        return OPENDCP_NO_ERROR;
+    }
+
+    nthreads = opendcp->threads > 0 ? opendcp->threads : opendcp_pool_threads();
+    nthreads = (ui32_t)nthreads > frame_count ? (int)frame_count : nthreads;
+
+    ui32_t block = (frame_count + nthreads - 1) / nthreads;
+    verify.resize(nthreads);
+    first_bad = frame_count;
+    pthread_mutex_init(&mutex, NULL);
+
+    for (t = 0; t < nthreads; t++) {
+        verify[t].opendcp      = opendcp;
+        verify[t].mxf_file     = mxf_file;
+        verify[t].essence_type = essence_type;
+        verify[t].first        = t * block > frame_count ? frame_count : t * block;
+        verify[t].last         = verify[t].first + block > frame_count ? frame_count : verify[t].first + block;
+        verify[t].uses_hmac    = uses_hmac;
+        verify[t].first_bad    = &first_bad;
+        verify[t].mutex        = &mutex;
+    }
+
+    opendcp_pool_run(mxf_verify_thread, &verify[0], sizeof(mxf_verify_t), nthreads, POOL_PRIORITY_NORMAL);
+
+    pthread_mutex_destroy(&mutex);
+
+    if (first_bad < frame_count) {
+        *bad_frame = first_bad;
+        return OPENDCP_VERIFY_MXF;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*
+   Structural check for verify_mxf_structure. Only the key and length of
+   each packet are read, with a small positional read per packet, so the
+   essence itself is never touched. The partition packs, the header
+   metadata and the index footer are the only values parsed. The packets
+   have to tile the file, the partitions have to match the RIP and link to
+   each other, and every index entry has to land on the key of an essence
+   packet, as a reader locating that frame would expect it.
+*/
+#define STRUCTURE_KL_READ       32
+#define STRUCTURE_PARTITION_MAX 4096
+
+/* the second half of the keys, version byte (7) not compared */
+static const byte_t structure_partition_ul[] = {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x05, 0x01, 0x01,
+                                                0x0d, 0x01, 0x02, 0x01, 0x01};
+static const byte_t structure_essence_ul[]   = {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x02, 0x01, 0x01,
+                                                0x0d, 0x01, 0x03, 0x01};
+static const byte_t structure_crypt_ul[]     = {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x04, 0x01, 0x01,
+                                                0x0d, 0x01, 0x03, 0x01, 0x02, 0x7e, 0x01, 0x00};
+
+static bool structure_match(const byte_t *key, const byte_t *ul, ui32_t len) {
+    for (ui32_t i = 0; i < len; i++) {
+        if (i != 7 && key[i] != ul[i]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* a partition pack, as found while walking the packets */
+typedef struct {
+    ui64_t offset;
+    ui64_t end;
+    ui64_t previous;
+    ui64_t footer;
+    ui64_t this_partition;
+    byte_t kind;
+} mxf_structure_partition_t;
+
+/* walk every packet of the file, false once the packets stop making sense */
+static bool mxf_structure_walk(const Kumu::FileReader &file, const char *mxf_file, const Dictionary *m_Dict,
+                               std::vector<mxf_structure_partition_t> &partitions,
+                               std::vector<ui64_t> &essence, bool *has_rip) {
+    ui64_t size = file.Size();
+    ui64_t pos = 0;
+    byte_t kl[STRUCTURE_KL_READ];
+    byte_t value[STRUCTURE_PARTITION_MAX];
+
+    *has_rip = false;
+
+    while (pos < size) {
+        ui32_t read_count = 0;
+        ui64_t length = 0;
+        ui32_t ber_size;
+
+        if (ASDCP_FAILURE(file.ReadAt(pos, kl, STRUCTURE_KL_READ, &read_count)) || read_count < SMPTE_UL_LENGTH + 1
+            || !structure_match(kl, structure_partition_ul, 4)) {
+            OPENDCP_LOG(LOG_ERROR, "%s: no packet key at offset %llu", mxf_file, (unsigned long long)pos);
+            return false;
+        }
+
+        if (kl[SMPTE_UL_LENGTH] & 0x80) {
+            ber_size = (kl[SMPTE_UL_LENGTH] & 0x0f) + 1;
+
+            if (SMPTE_UL_LENGTH + ber_size > read_count || !Kumu::read_BER(kl + SMPTE_UL_LENGTH, &length)) {
+                OPENDCP_LOG(LOG_ERROR, "%s: bad packet length at offset %llu", mxf_file, (unsigned long long)pos);
+                return false;
+            }
+        }
+        else {
+            ber_size = 1;
+            length = kl[SMPTE_UL_LENGTH];
+        }
+
+        ui64_t value_pos = pos + SMPTE_UL_LENGTH + ber_size;
+
+        if (length > size - value_pos) {
+            OPENDCP_LOG(LOG_ERROR, "%s: packet at offset %llu runs past the end of the file", mxf_file,
+                        (unsigned long long)pos);
+            return false;
+        }
+
+        if (*has_rip) {
+            OPENDCP_LOG(LOG_ERROR, "%s: packet at offset %llu follows the RIP", mxf_file, (unsigned long long)pos);
+            return false;
+        }
+
+        if (structure_match(kl, structure_partition_ul, sizeof(structure_partition_ul))
+            && kl[13] >= 0x02 && kl[13] <= 0x04) {
+            MXF::Partition            pack(m_Dict);
+            mxf_structure_partition_t partition;
+            ui32_t                    value_count = 0;
+            ui32_t                    value_length = length > STRUCTURE_PARTITION_MAX ? STRUCTURE_PARTITION_MAX : (ui32_t)length;
+
+            if (ASDCP_FAILURE(file.ReadAt(value_pos, value, value_length, &value_count)) || value_count != value_length
+                || ASDCP_FAILURE(pack.InitFromBuffer(value, value_length))) {
+                OPENDCP_LOG(LOG_ERROR, "%s: unreadable partition pack at offset %llu", mxf_file, (unsigned long long)pos);
+                return false;
+            }
+
+            partition.offset         = pos;
+            partition.end            = value_pos + length;
+            partition.previous       = pack.PreviousPartition;
+            partition.footer         = pack.FooterPartition;
+            partition.this_partition = pack.ThisPartition;
+            partition.kind           = kl[13];
+            partitions.push_back(partition);
+        }
+        else if (structure_match(kl, structure_partition_ul, sizeof(structure_partition_ul)) && kl[13] == 0x11) {
+            *has_rip = true;
+        }
+        else if (structure_match(kl, structure_essence_ul, sizeof(structure_essence_ul))
+                 || structure_match(kl, structure_crypt_ul, sizeof(structure_crypt_ul))) {
+            essence.push_back(pos);
+        }
+
+        pos = value_pos + length;
+    }
+
+    return true;
+}
+
+/*!
+ @function verify_mxf_structure
+ @abstract Check the structure of an MXF file without reading its essence.
+ @discussion The file is walked packet by packet, reading only each key and
+     length, then checked for: packets that tile the file up to a final RIP,
+     partitions that match the RIP and point to their previous partition and
+     the footer, index entries that each start an essence packet in order, a
+     whole number of essence packets per edit unit and an index as long as
+     the container duration. Every problem found is logged. No frame is
+     read or decrypted, so this is much faster than verify_mxf and works on
+     encrypted files without the key, but it does not find damaged essence.
+ @param opendcp The opendcp context.
+ @param mxf_file The MXF file to check.
+ @return OPENDCP_NO_ERROR if the file is sound, OPENDCP_VERIFY_MXF_STRUCTURE
+     if it is not, or OPENDCP_FILEREAD_MXF if it could not be opened.
+*/
+extern "C" int verify_mxf_structure(opendcp_t *opendcp, const char *mxf_file) {
+    using namespace ASDCP::MXF;
+
+    const Dictionary  *m_Dict = &DefaultCompositeDict();
+    Kumu::FileReader  file;
+    OP1aHeader        header(m_Dict);
+    OPAtomIndexFooter footer(m_Dict);
+    RIP               rip(m_Dict);
+    InterchangeObject *object = 0;
+    ui64_t            body_offset = 0;
+    ui64_t            edit_units = 0;
+    ui64_t            last_entry = 0;
+    bool              has_rip;
+    int               problems = 0;
+    std::vector<mxf_structure_partition_t> partitions;
+    std::vector<ui64_t> essence;
+    std::list<InterchangeObject*> segments;
+
+    UNUSED(opendcp);
+
+    if (ASDCP_FAILURE(file.OpenRead(mxf_file))) {
+        OPENDCP_LOG(LOG_ERROR, "Could not read file %s", mxf_file);
+        return OPENDCP_FILEREAD_MXF;
+    }
+
+    if (!mxf_structure_walk(file, mxf_file, m_Dict, partitions, essence, &has_rip)) {
+        return OPENDCP_VERIFY_MXF_STRUCTURE;
+    }
+
+    OPENDCP_LOG(LOG_DEBUG, "%s: %u partitions, %u essence packets", mxf_file,
+                (unsigned)partitions.size(), (unsigned)essence.size());
+
+    /* partitions, in the file and in the RIP */
+    if (partitions.empty() || partitions.front().offset != 0 || partitions.front().kind != 0x02) {
+        OPENDCP_LOG(LOG_ERROR, "%s: file does not start with a header partition", mxf_file);
+        return OPENDCP_VERIFY_MXF_STRUCTURE;
+    }
+
+    if (partitions.back().kind != 0x04) {
+        OPENDCP_LOG(LOG_ERROR, "%s: file does not end with a footer partition", mxf_file);
+        problems++;
+    }
+
+    for (ui32_t i = 0; i < partitions.size(); i++) {
+        if (partitions[i].this_partition != partitions[i].offset) {
+            OPENDCP_LOG(LOG_ERROR, "%s: partition at %llu claims to be at %llu", mxf_file,
+                        (unsigned long long)partitions[i].offset, (unsigned long long)partitions[i].this_partition);
+            problems++;
+        }
+
+        if (partitions[i].previous != (i ? partitions[i - 1].offset : 0)) {
+            OPENDCP_LOG(LOG_ERROR, "%s: partition at %llu links to a previous partition at %llu", mxf_file,
+                        (unsigned long long)partitions[i].offset, (unsigned long long)partitions[i].previous);
+            problems++;
+        }
+
+        if (partitions[i].footer && partitions[i].footer != partitions.back().offset) {
+            OPENDCP_LOG(LOG_ERROR, "%s: partition at %llu links to a footer at %llu", mxf_file,
+                        (unsigned long long)partitions[i].offset, (unsigned long long)partitions[i].footer);
+            problems++;
+        }
+    }
+
+    if (!has_rip || ASDCP_FAILURE(SeekToRIP(file)) || ASDCP_FAILURE(rip.InitFromFile(file))) {
+        OPENDCP_LOG(LOG_ERROR, "%s: file has no RIP", mxf_file);
+        problems++;
+    }
+    else {
+        RIP::const_pair_iterator pi = rip.PairArray.begin();
+        ui32_t                   i = 0;
+
+        for (; pi != rip.PairArray.end() && i < partitions.size(); ++pi, ++i) {
+            if ((*pi).ByteOffset != partitions[i].offset) {
+                break;
+            }
+        }
+
+        if (pi != rip.PairArray.end() || i != partitions.size()) {
+            OPENDCP_LOG(LOG_ERROR, "%s: RIP lists %u partitions that do not match the %u in the file", mxf_file,
+                        (unsigned)rip.PairArray.size(), (unsigned)partitions.size());
+            problems++;
+        }
+    }
+
+    /* the header metadata, then the index it describes */
+    if (ASDCP_FAILURE(file.Seek(0)) || ASDCP_FAILURE(header.InitFromFile(file))) {
+        OPENDCP_LOG(LOG_ERROR, "%s: unreadable header metadata", mxf_file);
+        return OPENDCP_VERIFY_MXF_STRUCTURE;
+    }
+
+    /* where the readers expect the essence, see h__ASDCPReader::OpenMXFRead */
+    if (partitions.size() > 2) {
+        body_offset = partitions[1].end;
+    }
+    else {
+        Kumu::fpos_t tell = 0;
+        file.Tell(&tell);
+        body_offset = tell;
+    }
+
+    if (ASDCP_FAILURE(file.Seek(partitions.back().offset))) {
+        return OPENDCP_VERIFY_MXF_STRUCTURE;
+    }
+
+    footer.m_Lookup = &header.m_Primer;
+
+    if (ASDCP_FAILURE(footer.InitFromFile(file))
+        || ASDCP_FAILURE(footer.GetMDObjectsByType(OBJ_TYPE_ARGS(IndexTableSegment), segments))) {
+        OPENDCP_LOG(LOG_ERROR, "%s: footer has no index", mxf_file);
+        return OPENDCP_VERIFY_MXF_STRUCTURE;
+    }
+
+    for (std::list<InterchangeObject*>::iterator si = segments.begin(); si != segments.end(); ++si) {
+        IndexTableSegment *segment = dynamic_cast<IndexTableSegment*>(*si);
+
+        if (!segment) {
+            continue;
+        }
+
+        if (segment->IndexStartPosition != edit_units) {
+            OPENDCP_LOG(LOG_ERROR, "%s: index segment starts at edit unit %llu, expected %llu", mxf_file,
+                        (unsigned long long)segment->IndexStartPosition, (unsigned long long)edit_units);
+            problems++;
+        }
+
+        /* constant bytes per edit unit, every packet the same size */
+        if (segment->EditUnitByteCount > 0) {
+            for (ui64_t i = 0; i < segment->IndexDuration && i < essence.size(); i++) {
+                ui64_t expected = body_offset + (segment->IndexStartPosition + i) * segment->EditUnitByteCount;
+
+                if (essence[i] != expected) {
+                    OPENDCP_LOG(LOG_ERROR, "%s: edit unit %llu is at %llu, the index has %llu", mxf_file,
+                                (unsigned long long)(segment->IndexStartPosition + i),
+                                (unsigned long long)essence[i], (unsigned long long)expected);
+                    problems++;
+                    break;
+                }
+            }
+
+            edit_units = segment->IndexStartPosition + segment->IndexDuration;
+            continue;
+        }
+
+        for (ui32_t i = 0; i < segment->IndexEntryArray.size(); i++) {
+            ui64_t position = body_offset + segment->IndexEntryArray[i].StreamOffset;
+
+            if (!std::binary_search(essence.begin(), essence.end(), position)) {
+                OPENDCP_LOG(LOG_ERROR, "%s: index entry %llu points to %llu, which is not an essence packet",
+                            mxf_file, (unsigned long long)(segment->IndexStartPosition + i),
+                            (unsigned long long)position);
+                problems++;
+                break;
+            }
+
+            if (segment->IndexStartPosition + i > 0 && position <= last_entry) {
+                OPENDCP_LOG(LOG_ERROR, "%s: index entry %llu points before the previous entry", mxf_file,
+                            (unsigned long long)(segment->IndexStartPosition + i));
+                problems++;
+                break;
+            }
+
+            last_entry = position;
+        }
+
+        edit_units = segment->IndexStartPosition + segment->IndexEntryArray.size();
+    }
+
+    /* edit units, against the packets and the container duration */
+    if (!edit_units || essence.size() % edit_units) {
+        OPENDCP_LOG(LOG_ERROR, "%s: %u essence packets for %llu indexed edit units", mxf_file,
+                    (unsigned)essence.size(), (unsigned long long)edit_units);
+        problems++;
+    }
+
+    SourcePackage *package = header.GetSourcePackage();
+
+    if (package && ASDCP_SUCCESS(header.GetMDObjectByID(package->Descriptor, &object))) {
+        FileDescriptor *desc = dynamic_cast<FileDescriptor*>(object);
+
+        if (desc && !desc->ContainerDuration.empty() && desc->ContainerDuration.get() != edit_units) {
+            OPENDCP_LOG(LOG_ERROR, "%s: container duration is %llu, the index has %llu edit units", mxf_file,
+                        (unsigned long long)desc->ContainerDuration.get(), (unsigned long long)edit_units);
+            problems++;
+        }
+    }
+
+    return problems ? OPENDCP_VERIFY_MXF_STRUCTURE : OPENDCP_NO_ERROR;
+}
+
+/*
+   Essence comparison for compare_mxf. Both files are read through their
+   index, never from their headers, so a rewrap, re-key or copy compares
+   equal whatever its UUIDs and timestamps. The frame range is split into
+   one block per thread of the pool, every block opens both files with
+   readers of its own and compares each frame pair by length and content.
+   Plaintext frames are compared in place in the mapped files, encrypted
+   ones are decrypted first when the file's key is given.
+*/
+static bool mxf_diff_equal(const FrameBuffer &a, const FrameBuffer &b) {
+    return a.Size() == b.Size() && !memcmp(a.RoData(), b.RoData(), a.Size());
+}
+
+typedef struct {
+    opendcp_t       *opendcp;
+    const char      *mxf_file[2];
+    const byte_t    *key[2];
+    EssenceType_t   essence_type;
+    ui32_t          buffer_size;
+    ui32_t          first;
+    ui32_t          last;
+    ui32_t          *first_diff;
+    ui32_t          *diffs;
+    Result_t        *error;
+    pthread_mutex_t *mutex;
+} mxf_diff_t;
+
+static void mxf_diff_report(mxf_diff_t *diff, ui32_t frame, ui32_t count, Result_t result) {
+    pthread_mutex_lock(diff->mutex);
+
+    if (ASDCP_FAILURE(result)) {
+        OPENDCP_LOG(LOG_ERROR, "Could not read frame %d (%s)", frame, result.Label());
+        *diff->error = result;
+    }
+    else if (count) {
+        *diff->diffs += count;
+
+        if (frame < *diff->first_diff) {
+            *diff->first_diff = frame;
+        }
+    }
+
+    pthread_mutex_unlock(diff->mutex);
+}
+
+/* open a reader, with a decryption context when the essence is encrypted and a key is given */
+template <class Reader>
+static Result_t mxf_diff_open(Reader &reader, const char *mxf_file, const byte_t *key, AESDecContext **context) {
+    WriterInfo info;
+    Result_t   result = reader.OpenRead(mxf_file);
+
+    *context = 0;
+
+    if (ASDCP_SUCCESS(result)) {
+        result = reader.FillWriterInfo(info);
+    }
+
+    if (ASDCP_SUCCESS(result) && info.EncryptedEssence && key) {
+        *context = new AESDecContext;
+        result = (*context)->InitKey(key);
+    }
+
+    return result;
+}
+
+template <class Reader, class Buffer>
+static void mxf_diff_frames(mxf_diff_t *diff) {
+    Reader        reader[2];
+    Buffer        frame_buffer[2];
+    AESDecContext *context[2] = {0, 0};
+    Result_t      result = RESULT_OK;
+    ui32_t        count = 0, first = diff->last;
+
+    for (int f = 0; f < 2 && ASDCP_SUCCESS(result); f++) {
+        result = mxf_diff_open(reader[f], diff->mxf_file[f], diff->key[f], &context[f]);
+
+        if (ASDCP_SUCCESS(result)) {
+            result = frame_buffer[f].Capacity(diff->buffer_size);
+            frame_buffer[f].AllowView(true);
+        }
+    }
+
+    for (ui32_t i = diff->first; i < diff->last && ASDCP_SUCCESS(result); i++) {
+        result = reader[0].ReadFrame(i, frame_buffer[0], context[0], 0);
+
+        if (ASDCP_SUCCESS(result)) {
+            result = reader[1].ReadFrame(i, frame_buffer[1], context[1], 0);
+        }
+
+        if (ASDCP_SUCCESS(result) && !mxf_diff_equal(frame_buffer[0], frame_buffer[1])) {
+            OPENDCP_LOG(LOG_DEBUG, "Frame %d differs", i);
+            first = count++ ? first : i;
+        }
+    }
+
+    mxf_diff_report(diff, first, count, result);
+    delete context[0];
+    delete context[1];
+}
+
+static void mxf_diff_stereo_frames(mxf_diff_t *diff) {
+    JP2K::MXFSReader  reader[2];
+    JP2K::FrameBuffer frame_buffer[2];
+    AESDecContext     *context[2] = {0, 0};
+    Result_t          result = RESULT_OK;
+    ui32_t            count = 0, first = diff->last;
+
+    for (int f = 0; f < 2 && ASDCP_SUCCESS(result); f++) {
+        result = mxf_diff_open(reader[f], diff->mxf_file[f], diff->key[f], &context[f]);
+
+        if (ASDCP_SUCCESS(result)) {
+            result = frame_buffer[f].Capacity(diff->buffer_size);
+        }
+    }
+
+    for (ui32_t i = diff->first; i < diff->last && ASDCP_SUCCESS(result); i++) {
+        bool same = true;
+
+        for (int eye = 0; eye < 2 && same && ASDCP_SUCCESS(result); eye++) {
+            JP2K::StereoscopicPhase_t phase = eye ? JP2K::SP_RIGHT : JP2K::SP_LEFT;
+            result = reader[0].ReadFrame(i, phase, frame_buffer[0], context[0], 0);
+
+            if (ASDCP_SUCCESS(result)) {
+                result = reader[1].ReadFrame(i, phase, frame_buffer[1], context[1], 0);
+            }
+
+            same = ASDCP_FAILURE(result) || mxf_diff_equal(frame_buffer[0], frame_buffer[1]);
+        }
+
+        if (!same) {
+            OPENDCP_LOG(LOG_DEBUG, "Frame %d differs", i);
+            first = count++ ? first : i;
+        }
+    }
+
+    mxf_diff_report(diff, first, count, result);
+    delete context[0];
+    delete context[1];
+}
+
+static void *mxf_diff_thread(void *arg) {
+    mxf_diff_t *diff = (mxf_diff_t *)arg;
+
+    if (diff->essence_type == ESS_JPEG_2000) {
+        mxf_diff_frames<JP2K::MXFReader, JP2K::FrameBuffer>(diff);
+    }
+    else if (diff->essence_type == ESS_JPEG_2000_S) {
+        mxf_diff_stereo_frames(diff);
+    }
+    else {
+        mxf_diff_frames<PCM::MXFReader, PCM::FrameBuffer>(diff);
+    }
+
+    return NULL;
+}
+
+/* the frame count and read buffer size of a picture or sound track */
+static Result_t mxf_diff_info(const char *mxf_file, EssenceType_t *essence_type, ui32_t *frame_count,
+                              ui32_t *buffer_size, bool *encrypted) {
+    WriterInfo info;
+    Result_t   result = ASDCP::EssenceType(mxf_file, *essence_type);
+
+    if (ASDCP_FAILURE(result)) {
+        return result;
+    }
+
+    if (*essence_type == ESS_JPEG_2000) {
+        JP2K::MXFReader         reader;
+        JP2K::PictureDescriptor picture_desc;
+        result = reader.OpenRead(mxf_file);
+        reader.FillPictureDescriptor(picture_desc);
+        reader.FillWriterInfo(info);
+        *frame_count = picture_desc.ContainerDuration;
+        *buffer_size = FRAME_BUFFER_SIZE;
+    }
+    else if (*essence_type == ESS_JPEG_2000_S) {
+        JP2K::MXFSReader        reader;
+        JP2K::PictureDescriptor picture_desc;
+        result = reader.OpenRead(mxf_file);
+        reader.FillPictureDescriptor(picture_desc);
+        reader.FillWriterInfo(info);
+        *frame_count = picture_desc.ContainerDuration;
+        *buffer_size = FRAME_BUFFER_SIZE;
+    }
+    else if (*essence_type == ESS_PCM_24b_48k || *essence_type == ESS_PCM_24b_96k) {
+        PCM::MXFReader       reader;
+        PCM::AudioDescriptor audio_desc;
+        result = reader.OpenRead(mxf_file);
+        reader.FillAudioDescriptor(audio_desc);
+        reader.FillWriterInfo(info);
+
+        /* leave room for the ciphertext padding, iv and check value */
+        *frame_count = audio_desc.ContainerDuration;
+        *buffer_size = PCM::CalcFrameBufferSize(audio_desc) + Kumu::Kilobyte;
+    }
+    else {
+        return RESULT_FORMAT;
+    }
+
+    *encrypted = info.EncryptedEssence;
+
+    return result;
+}
+
+/*!
+ @function compare_mxf
+ @abstract Compare the essence of two picture or sound MXF files frame by frame.
+ @discussion Both files are read through their index in opendcp->threads
+     blocks on the thread pool and each pair of frames is compared byte for
+     byte, so header metadata such as UUIDs and dates is ignored and nothing
+     is written. Encrypted frames are decrypted with the key of their file;
+     without one the ciphertext is compared, which only matches for copies.
+     Frames past the end of the shorter file count as differing.
+ @param opendcp The opendcp context.
+ @param mxf_a The first file.
+ @param key_a The 16 byte key of the first file, or NULL.
+ @param mxf_b The second file.
+ @param key_b The 16 byte key of the second file, or NULL.
+ @param first_diff Set to the first differing frame, -1 if none.
+ @param diffs Set to the number of differing frames.
+ @return OPENDCP_NO_ERROR if the essence is the same, OPENDCP_COMPARE_MXF if
+     it is not, otherwise the error that stopped the comparison.
+*/
+extern "C" int compare_mxf(opendcp_t *opendcp, const char *mxf_a, const unsigned char *key_a,
+                           const char *mxf_b, const unsigned char *key_b, int *first_diff, int *diffs) {
+    const char      *mxf_file[2] = {mxf_a, mxf_b};
+    const byte_t    *key[2] = {key_a, key_b};
+    EssenceType_t   essence_type[2];
+    ui32_t          frame_count[2], buffer_size[2];
+    bool            encrypted[2];
+    ui32_t          frames, first = ~(ui32_t)0, count = 0;
+    std::vector<mxf_diff_t> diff;
+    int             nthreads, t;
+    pthread_mutex_t mutex;
+    Result_t        error = RESULT_OK;
+
+    *first_diff = -1;
+    *diffs = 0;
+
+    for (int f = 0; f < 2; f++) {
+        Result_t result = mxf_diff_info(mxf_file[f], &essence_type[f], &frame_count[f], &buffer_size[f], &encrypted[f]);
+
+        if (result == RESULT_FORMAT) {
+            OPENDCP_LOG(LOG_ERROR, "%s is not a picture or sound track", mxf_file[f]);
+            return OPENDCP_INVALID_TRACK_TYPE;
+        }
+
+        if (ASDCP_FAILURE(result)) {
+            OPENDCP_LOG(LOG_ERROR, "Could not read file %s", mxf_file[f]);
+            return OPENDCP_FILEREAD_MXF;
+        }
+
+        if (encrypted[f] && !key[f]) {
+            OPENDCP_LOG(LOG_WARN, "%s is encrypted and no key was given, its ciphertext is compared", mxf_file[f]);
+        }
+    }
+
+    if (essence_type[0] != essence_type[1]) {
+        OPENDCP_LOG(LOG_ERROR, "%s and %s are different kinds of track", mxf_a, mxf_b);
+        return OPENDCP_INVALID_TRACK_TYPE;
+    }
+
+    frames = frame_count[0] < frame_count[1] ? frame_count[0] : frame_count[1];
+
+    if (frame_count[0] != frame_count[1]) {
+        OPENDCP_LOG(LOG_WARN, "%s has %d frames, %s has %d", mxf_a, frame_count[0], mxf_b, frame_count[1]);
+        first = frames;
+        count = (frame_count[0] > frame_count[1] ? frame_count[0] : frame_count[1]) - frames;
+    }
+
+    nthreads = opendcp->threads > 0 ? opendcp->threads : opendcp_pool_threads();
+    nthreads = (ui32_t)nthreads > frames ? (int)frames : nthreads;
+
+    ui32_t block = nthreads ? (frames + nthreads - 1) / nthreads : 0;
+    diff.resize(nthreads);
+    pthread_mutex_init(&mutex, NULL);
+
+    for (t = 0; t < nthreads; t++) {
+        diff[t].opendcp      = opendcp;
+        diff[t].mxf_file[0]  = mxf_a;
+        diff[t].mxf_file[1]  = mxf_b;
+        diff[t].key[0]       = key_a;
+        diff[t].key[1]       = key_b;
+        diff[t].essence_type = essence_type[0];
+        diff[t].buffer_size  = buffer_size[0] > buffer_size[1] ? buffer_size[0] : buffer_size[1];
+        diff[t].first        = t * block > frames ? frames : t * block;
+        diff[t].last         = diff[t].first + block > frames ? frames : diff[t].first + block;
+        diff[t].first_diff   = &first;
+        diff[t].diffs        = &count;
+        diff[t].error        = &error;
+        diff[t].mutex        = &mutex;
+    }
+
+    if (nthreads) {
+        opendcp_pool_run(mxf_diff_thread, &diff[0], sizeof(mxf_diff_t), nthreads, POOL_PRIORITY_NORMAL);
+    }
+
+    pthread_mutex_destroy(&mutex);
+
+    if (ASDCP_FAILURE(error)) {
+        return OPENDCP_FILEREAD_MXF;
+    }
+
+    if (count) {
+        *first_diff = first;
+        *diffs = count;
+        return OPENDCP_COMPARE_MXF;
+    }
+
     return OPENDCP_NO_ERROR;
 }
@@ -19,6 +19,14 @@
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
 #include "opendcp.h"
 #include "opendcp_decoder.h"
 
@@ -33,6 +41,117 @@ opendcp_decoder_t opendcp_decoders[] = {
     FOREACH_OPENDCP_DECODER(GENERATE_DECODER_STRUCT)
 };
 
+/* source frames are read once, their pages leave the cache once decoded */
+static int file_cache_hints = 1;
+
+/*!
+ @function opendcp_cache_hints
+ @abstract Enables the page cache hints for files read or written once.
+ @discussion On by default. The decoders drop the pages of a source frame
+     once it is decoded and libasdcp drops the pages of mxf files behind the
+     position it reads or writes (see Kumu::SetStreamOnceWindow), so a long
+     encode does not push the files of other jobs out of the cache.
+ @param enable 1 to give the hints, 0 to leave caching to the system.
+*/
+void opendcp_cache_hints(int enable) {
+    file_cache_hints = enable ? 1 : 0;
+    opendcp_cache_hints_asdcp(file_cache_hints);
+}
+
+/*!
+ @function opendcp_file_cache
+ @abstract Gives the page cache hints for a source frame.
+ @discussion Called when the file is opened, it is read sequentially, and
+     when it is done, its pages are dropped. On macOS the file is not cached
+     at all. Nothing is done when the hints are disabled.
+ @param fd The file.
+ @param done 0 when the file was opened, 1 when it was decoded.
+*/
+void opendcp_file_cache(int fd, int done) {
+#ifndef _WIN32
+    if (!file_cache_hints || fd < 0) {
+        return;
+    }
+
+#if defined(__APPLE__) && defined(F_NOCACHE)
+    if (!done) {
+        fcntl(fd, F_NOCACHE, 1);
+    }
+#elif defined(POSIX_FADV_DONTNEED)
+    posix_fadvise(fd, 0, 0, done ? POSIX_FADV_DONTNEED : POSIX_FADV_SEQUENTIAL);
+#endif
+#else
+    UNUSED(fd);
+    UNUSED(done);
+#endif
+}
+
+/* band callback for decodes started on this thread */
+static __thread opendcp_decoder_band_t *decoder_band = NULL;
+
+/*!
+ @function opendcp_decoder_band_set
+ @abstract Sets the band callback for decodes started on the calling thread.
+ @discussion The callback stays set until it is cleared with NULL. Decoders
+     that hand bands to worker threads pass the callback along with them.
+ @param band The callback, NULL to clear it.
+*/
+void opendcp_decoder_band_set(opendcp_decoder_band_t *band) {
+    decoder_band = band;
+}
+
+/*!
+ @function opendcp_decoder_band_get
+ @abstract Returns the band callback of the calling thread.
+ @discussion Decoders read the callback once when they start.
+ @return The callback or NULL if none is set.
+*/
+opendcp_decoder_band_t *opendcp_decoder_band_get() {
+    return decoder_band;
+}
+
+/* in-memory source for decodes started on this thread */
+static __thread const opendcp_decoder_input_t *decoder_input = NULL;
+
+/*!
+ @function opendcp_decoder_input_set
+ @abstract Sets the in-memory source for decodes started on the calling thread.
+ @discussion Decoders that hand work to other threads pass the input along
+     with them.
+ @param input The input, NULL to clear it.
+*/
+void opendcp_decoder_input_set(const opendcp_decoder_input_t *input) {
+    decoder_input = input;
+}
+
+/*!
+ @function opendcp_decoder_input_get
+ @abstract Returns the in-memory source of the calling thread for a file.
+ @param file The file about to be opened.
+ @return The input when it is set and names file, NULL to read the file.
+*/
+const opendcp_decoder_input_t *opendcp_decoder_input_get(const char *file) {
+    if (decoder_input && file && !strcmp(decoder_input->name, file)) {
+        return decoder_input;
+    }
+
+    return NULL;
+}
+
+/*!
+ @function opendcp_decoder_band
+ @abstract Reports a band of decoded rows.
+ @param band The callback from opendcp_decoder_band_get, may be NULL.
+ @param image The image being decoded.
+ @param y0 The first row of the band.
+ @param y1 The row after the last row of the band.
+*/
+void opendcp_decoder_band(opendcp_decoder_band_t *band, opendcp_image_t *image, int y0, int y1) {
+    if (band && band->rows && y1 > y0) {
+        band->rows(band->arg, image, y0, y1);
+    }
+}
+
 /*!
  @function opendcp_decoder_find
  @abstract Find an decoder structure
@@ -77,8 +196,141 @@ char *opendcp_decoder_extensions() {
     extensions = malloc(sizeof(char) * 256);
 
     for (x = 0; x < OPENDCP_DECODER_NONE; x++) {
+        /* stream frames are not files of a sequence */
+        if (x == OPENDCP_DECODER_STREAM) {
+            continue;
+        }
+
         sprintf(extensions, "%s;%s", extensions, opendcp_decoders[x].extensions);
     }
 
     return extensions;
 }
+
+/*!
+ @function opendcp_file_map
+ @abstract Map a whole file read-only
+ @discussion The file is memory mapped (mmap or MapViewOfFile) and read into
+     a heap buffer if that fails. When the thread has a decoder input for the
+     file its data is used as is. Release it with opendcp_file_unmap().
+ @param map Pointer to the opendcp_file_map_t to fill.
+ @param file The name of the file.
+ @return OPENDCP_ERROR value
+*/
+int opendcp_file_map(opendcp_file_map_t *map, const char *file) {
+    const opendcp_decoder_input_t *input;
+    FILE        *fp;
+    struct stat st;
+
+    memset(map, 0, sizeof(*map));
+    map->fd = -1;
+
+    if ((input = opendcp_decoder_input_get(file))) {
+        map->data     = input->data;
+        map->size     = input->size;
+        map->borrowed = 1;
+        return input->size ? OPENDCP_NO_ERROR : OPENDCP_ERROR;
+    }
+
+    if (stat(file, &st) || st.st_size <= 0) {
+        return OPENDCP_ERROR;
+    }
+
+    map->size = (size_t)st.st_size;
+
+#ifdef _WIN32
+    {
+        HANDLE handle, mapping;
+
+        handle = CreateFileA(file, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+
+        if (handle != INVALID_HANDLE_VALUE) {
+            mapping = CreateFileMappingA(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+
+            if (mapping) {
+                map->data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, map->size);
+                CloseHandle(mapping);
+            }
+
+            CloseHandle(handle);
+        }
+    }
+#else
+    {
+        int  fd;
+        void *base;
+
+        fd = open(file, O_RDONLY);
+
+        if (fd >= 0) {
+            base = mmap(NULL, map->size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+            if (base != MAP_FAILED) {
+#ifdef POSIX_MADV_SEQUENTIAL
+                posix_madvise(base, map->size, POSIX_MADV_SEQUENTIAL);
+#endif
+                opendcp_file_cache(fd, 0);
+                map->data = base;
+                map->fd   = fd;
+            } else {
+                close(fd);
+            }
+        }
+    }
+#endif
+
+    if (map->data) {
+        return OPENDCP_NO_ERROR;
+    }
+
+    /* fall back to reading the file into memory */
+    fp = fopen(file, "rb");
+
+    if (!fp) {
+        return OPENDCP_ERROR;
+    }
+
+    map->buffer = malloc(map->size);
+    opendcp_file_cache(fileno(fp), 0);
+
+    if (!map->buffer || fread(map->buffer, 1, map->size, fp) != map->size) {
+        free(map->buffer);
+        map->buffer = NULL;
+        fclose(fp);
+        return OPENDCP_ERROR;
+    }
+
+    opendcp_file_cache(fileno(fp), 1);
+    fclose(fp);
+    map->data = map->buffer;
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*!
+ @function opendcp_file_unmap
+ @abstract Release a file mapped by opendcp_file_map
+ @param map Pointer to the opendcp_file_map_t to release.
+*/
+void opendcp_file_unmap(opendcp_file_map_t *map) {
+    if (map->borrowed) {
+        /* owned by the decoder input */
+    } else if (map->buffer) {
+        free(map->buffer);
+    } else if (map->data) {
+#ifdef _WIN32
+        UnmapViewOfFile((void *)map->data);
+#else
+        munmap((void *)map->data, map->size);
+#endif
+    }
+
+    /* the pages can only be dropped once nothing maps them */
+    if (map->fd >= 0) {
+        opendcp_file_cache(map->fd, 1);
+        close(map->fd);
+    }
+
+    memset(map, 0, sizeof(*map));
+    map->fd = -1;
+}
@@ -16,12 +16,18 @@
      along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 #define FOREACH_OPENDCP_DECODER(OPENDCP_DECODER) \
             OPENDCP_DECODER(OPENDCP_DECODER_BMP,  bmp, "bmp", 1)  \
             OPENDCP_DECODER(OPENDCP_DECODER_DPX,  dpx, "dpx", 1)  \
             OPENDCP_DECODER(OPENDCP_DECODER_OPENJPEG,  openjpeg, "j2c;j2k;jp2;jpf", 1) \
             OPENDCP_DECODER(OPENDCP_DECODER_TIFF, tif, "tif;tiff", 1)  \
             OPENDCP_DECODER(OPENDCP_DECODER_EXR, exr, "exr", 1) \
+            OPENDCP_DECODER(OPENDCP_DECODER_RAW,  raw, "odr", 1) \
+            OPENDCP_DECODER(OPENDCP_DECODER_STREAM, stream, "stream", 1) \
             OPENDCP_DECODER(OPENDCP_DECODER_NONE, none, "none", 1)
 
 #define GENERATE_DECODER_ENUM(DECODER, NAME, EXT, ENABLED) DECODER,
@@ -62,5 +68,77 @@ typedef struct {
     int  (*decode)(opendcp_image_t **image_ptr, const char *infile);
 } opendcp_decoder_t;
 
+/*!
+ @typedef opendcp_file_map_t
+ @abstract read-only view of a whole file
+ @discussion Filled by opendcp_file_map(), the file is memory mapped when
+     possible and read into memory otherwise.
+ @field data The file contents.
+ @field size The size of the file in bytes.
+ @field buffer Heap copy of the file when it could not be mapped.
+ @field fd The mapped file, kept open for the page cache hints, -1 if none.
+ @field borrowed The data is the decoder input of the thread, nothing to release.
+*/
+typedef struct {
+    const unsigned char *data;
+    size_t              size;
+    void                *buffer;
+    int                 fd;
+    int                 borrowed;
+} opendcp_file_map_t;
+
+/*!
+ @typedef opendcp_decoder_input_t
+ @abstract in-memory contents of a source file
+ @discussion Set on a thread before decoding a file that is not on the file
+     system, e.g. a frame fetched from object storage. opendcp_file_map and
+     the decoders that open the file themselves read the named file from
+     data instead. The data must stay valid until the decode returns.
+ @field name The file name the decoder is called with.
+ @field data The file contents.
+ @field size The size of the file in bytes.
+*/
+typedef struct {
+    const char          *name;
+    const unsigned char *data;
+    size_t              size;
+} opendcp_decoder_input_t;
+
+/*!
+ @typedef opendcp_decoder_band_t
+ @abstract rows decoded callback
+ @discussion Decoders that fill the image in horizontal bands call rows for
+     each band as it is complete, so the next stage can process the rows
+     while they are still in cache. Bands of one image may be reported from
+     several threads at once.
+ @field rows Called with the rows [y0, y1) that were just decoded.
+ @field arg Passed back to rows.
+ @field precision Bits per sample the caller takes. At 16, 16-bit sources
+     keep every bit and set image->precision, otherwise samples have 12 bits.
+*/
+typedef struct {
+    void (*rows)(void *arg, opendcp_image_t *image, int y0, int y1);
+    void *arg;
+    int  precision;
+} opendcp_decoder_band_t;
+
 opendcp_decoder_t *opendcp_decoder_find(char *name, char *ext, int id);
 char *opendcp_decoder_extensions();
+int  opendcp_file_map(opendcp_file_map_t *map, const char *file);
+void opendcp_file_unmap(opendcp_file_map_t *map);
+void opendcp_file_cache(int fd, int done);
+void opendcp_decoder_band_set(opendcp_decoder_band_t *band);
+opendcp_decoder_band_t *opendcp_decoder_band_get();
+void opendcp_decoder_input_set(const opendcp_decoder_input_t *input);
+const opendcp_decoder_input_t *opendcp_decoder_input_get(const char *file);
+void opendcp_decoder_band(opendcp_decoder_band_t *band, opendcp_image_t *image, int y0, int y1);
+int  opendcp_openjpeg_info(const char *sfile, int *w, int *h, int *resolutions);
+int  opendcp_decode_openjpeg_reduced(opendcp_image_t **image_ptr, const char *sfile, int reduce, int x0, int y0, int x1, int y1);
+int  opendcp_decode_openjpeg_buffer(opendcp_image_t **image_ptr, const unsigned char *data, int length, int reduce);
+int  opendcp_stream_open(const char *path, int w, int h, int bits, int xyz);
+int  opendcp_stream_ended(void);
+void opendcp_stream_close(void);
+
+#ifdef __cplusplus
+}
+#endif
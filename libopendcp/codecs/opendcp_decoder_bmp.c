@@ -23,9 +23,23 @@
 #include <stdint.h>
 #include "opendcp.h"
 #include "opendcp_image.h"
+#include "opendcp_decoder.h"
+#include "cpu.h"
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
 
 #define MAGIC_NUMBER 0x4D42
 
+/* rows decoded before the band is reported */
+#define BMP_BAND 64
+
+/* bytes of the magic number, file header and image header */
+#define BMP_HEADER_SIZE 54
+
 typedef enum {
     BMP_R         = 0,
     BMP_G         = 1,
@@ -76,18 +90,6 @@ typedef struct {
     int                      row_order;
 } bmp_image_t;
 
-/* BMPs are sometimes bottom to top, so invert if needed */
-static inline int invert_row(bmp_image_t bmp, int index) {
-    int w = bmp.image.width;
-    int h = bmp.image.height;
-
-    if (bmp.row_order == BMP_BOTTOM) {
-      index = (h - index / w) * w + ((index % w) - w);
-    }
-
-    return index;
-}
-
 void print_bmp_header(bmp_image_t *bmp) {
     OPENDCP_LOG(LOG_DEBUG,"%-15.15s: file size:    %d","read_bmp",bmp->file.size);
     OPENDCP_LOG(LOG_DEBUG,"%-15.15s: data offset:  %d","read_bmp",bmp->file.offset);
@@ -107,6 +109,114 @@ void print_bmp_header(bmp_image_t *bmp) {
     OPENDCP_LOG(LOG_DEBUG,"%-15.15s: row_order:    %d","read_bmp",bmp->row_order);
 }
 
+/*
+   8-bit BGR(A) pixels are deinterleaved straight from the mapped file into
+   the planes, a row at a time and in top-down order whatever the order of
+   the rows in the file. The kernels take 16 pixels at a time, scale the
+   samples to 12 bits and return the number of pixels done.
+*/
+#if defined(__GNUC__) && defined(__x86_64__)
+__attribute__((target("ssse3")))
+static int bmp_deinterleave_8_ssse3(int *dst[3], const uint8_t *src, int count, int spp) {
+    int     i, c, q, r, k, off;
+    int8_t  shuffle[3][4][4][16];
+    __m128i mask[3][4][4];
+    __m128i in[4];
+    __m128i v;
+
+    /* byte shuffles gathering sample c of pixels 4q to 4q+3 from each register into 32-bit lanes */
+    for (c = 0; c < 3; c++) {
+        for (q = 0; q < 4; q++) {
+            for (r = 0; r < spp; r++) {
+                memset(shuffle[c][q][r], 0x80, 16);
+                for (k = 0; k < 4; k++) {
+                    off = (4 * q + k) * spp + c;
+                    if (off / 16 == r) {
+                        shuffle[c][q][r][4 * k] = (int8_t)(off % 16);
+                    }
+                }
+                mask[c][q][r] = _mm_loadu_si128((const __m128i *)shuffle[c][q][r]);
+            }
+        }
+    }
+
+    for (i = 0; i + 16 <= count; i += 16) {
+        for (r = 0; r < spp; r++) {
+            in[r] = _mm_loadu_si128((const __m128i *)(src + (size_t)i * spp + r * 16));
+        }
+
+        for (c = 0; c < 3; c++) {
+            for (q = 0; q < 4; q++) {
+                /* the samples of four pixels span one or two registers */
+                r = (4 * q * spp + c) / 16;
+                v = _mm_shuffle_epi8(in[r], mask[c][q][r]);
+                if (r + 1 < spp && ((4 * q + 3) * spp + c) / 16 > r) {
+                    v = _mm_or_si128(v, _mm_shuffle_epi8(in[r + 1], mask[c][q][r + 1]));
+                }
+                _mm_storeu_si128((__m128i *)(dst[c] + i + 4 * q), _mm_slli_epi32(v, 4));
+            }
+        }
+    }
+
+    return i;
+}
+#elif defined(__aarch64__)
+static int bmp_deinterleave_8_neon(int *dst[3], const uint8_t *src, int count, int spp) {
+    int         i, c;
+    uint8x16_t  v[3];
+    uint16x8_t  lo, hi;
+
+    for (i = 0; i + 16 <= count; i += 16) {
+        if (spp == 4) {
+            uint8x16x4_t in = vld4q_u8(src + (size_t)i * 4);
+            v[0] = in.val[0]; v[1] = in.val[1]; v[2] = in.val[2];
+        } else {
+            uint8x16x3_t in = vld3q_u8(src + (size_t)i * 3);
+            v[0] = in.val[0]; v[1] = in.val[1]; v[2] = in.val[2];
+        }
+
+        for (c = 0; c < 3; c++) {
+            lo = vmovl_u8(vget_low_u8(v[c]));
+            hi = vmovl_u8(vget_high_u8(v[c]));
+            vst1q_s32(dst[c] + i,      vreinterpretq_s32_u32(vshll_n_u16(vget_low_u16(lo), 4)));
+            vst1q_s32(dst[c] + i + 4,  vreinterpretq_s32_u32(vshll_n_u16(vget_high_u16(lo), 4)));
+            vst1q_s32(dst[c] + i + 8,  vreinterpretq_s32_u32(vshll_n_u16(vget_low_u16(hi), 4)));
+            vst1q_s32(dst[c] + i + 12, vreinterpretq_s32_u32(vshll_n_u16(vget_high_u16(hi), 4)));
+        }
+    }
+
+    return i;
+}
+#endif
+
+/* pixels are stored B G R (A), the planes are filled R G B */
+static void bmp_deinterleave_8(opendcp_image_t *image, const uint8_t *src, int y, int w, int spp) {
+    int *dst[3];
+    int i = 0;
+    int c;
+
+    for (c = 0; c < 3; c++) {
+        dst[c] = image->component[BMP_B - c].data + (size_t)y * image->component[BMP_B - c].stride;
+    }
+
+#if defined(__GNUC__) && defined(__x86_64__)
+    if (cpu_has(CPU_SSSE3)) {
+        i = bmp_deinterleave_8_ssse3(dst, src, w, spp);
+    }
+#elif defined(__aarch64__)
+    if (cpu_has(CPU_NEON)) {
+        i = bmp_deinterleave_8_neon(dst, src, w, spp);
+    }
+#endif
+
+    /* remaining pixels */
+    for (; i < w; i++) {
+        for (c = 0; c < 3; c++) {
+            dst[c][i] = src[(size_t)i * spp + c] << 4;
+        }
+    }
+}
+
 /*!
  @function opendcp_decode_bmp
  @abstract Read an image file and populates an opendcp_image_t structure.
@@ -117,33 +227,33 @@ void print_bmp_header(bmp_image_t *bmp) {
  @return OPENDCP_ERROR value
 */
 int opendcp_decode_bmp(opendcp_image_t **image_ptr, const char *sfile) {
-    bmp_magic_num_t magic;
-    bmp_image_t     bmp;
-    FILE            *bmp_fp;
-    opendcp_image_t *image = 00;
-    int             pixels = 0;
-    int             i,w,h;
-    size_t          readsize;
-
-    /* open bmp using filename or file descriptor */
+    bmp_magic_num_t    magic;
+    bmp_image_t        bmp;
+    opendcp_file_map_t map;
+    opendcp_image_t    *image = 00;
+    opendcp_decoder_band_t *band = opendcp_decoder_band_get();
+    const uint8_t      *src;
+    size_t             row_size;
+    int                y, y0, y1, w, h, spp;
+
+    /* map the whole file, the header and image data are read from memory */
     OPENDCP_LOG(LOG_DEBUG,"%-15.15s: opening bmp file %s","read_bmp",sfile);
 
-    bmp_fp = fopen(sfile, "rb");
-
-    if (!bmp_fp) {
+    if (opendcp_file_map(&map, sfile) != OPENDCP_NO_ERROR) {
         OPENDCP_LOG(LOG_ERROR,"%-15.15s: opening bmp file %s","read_bmp",sfile);
         return OPENDCP_FATAL;
     }
 
-    readsize = fread(&magic, 1, sizeof(bmp_magic_num_t), bmp_fp);
-    if (readsize != sizeof(bmp_magic_num_t)) {
-        OPENDCP_LOG(LOG_ERROR,"%-15.15s: failed to read magic number expected %d read %d","read_bmp", sizeof(bmp_magic_num_t), readsize);
+    if (map.size < BMP_HEADER_SIZE) {
+        OPENDCP_LOG(LOG_ERROR,"%-15.15s: failed to read header expected %d read %d","read_bmp", BMP_HEADER_SIZE, (int)map.size);
+        opendcp_file_unmap(&map);
+        return OPENDCP_FATAL;
     }
 
-    readsize = fread(&bmp, 1, sizeof(bmp_image_t), bmp_fp);
-    if (readsize != sizeof(bmp_image_t)) {
-        OPENDCP_LOG(LOG_ERROR,"%-15.15s: failed to header expected %d read %d","read_bmp", sizeof(bmp_image_t), readsize);
-    }
+    memset(&bmp, 0, sizeof(bmp));
+    memcpy(&magic, map.data, sizeof(bmp_magic_num_t));
+    memcpy(&bmp.file, map.data + sizeof(bmp_magic_num_t), sizeof(bmp_file_header_t));
+    memcpy(&bmp.image, map.data + sizeof(bmp_magic_num_t) + sizeof(bmp_file_header_t), sizeof(bmp_image_header_t));
 
     if (magic.magic_num != MAGIC_NUMBER) {
          OPENDCP_LOG(LOG_ERROR,"%s is not a valid BMP file", sfile);
@@ -157,7 +267,6 @@ int opendcp_decode_bmp(opendcp_image_t **image_ptr, const char *sfile) {
 
     w = bmp.image.width;
     h = abs(bmp.image.height);
-    pixels = w * h;
 
     print_bmp_header(&bmp);
 
@@ -171,68 +280,54 @@ int opendcp_decode_bmp(opendcp_image_t **image_ptr, const char *sfile) {
         case BMP_PNG:
         default:
             OPENDCP_LOG(LOG_ERROR, "Unsupported image compression: %d", bmp.image.compression);
+            opendcp_file_unmap(&map);
             return OPENDCP_FATAL;
             break;
     }
 
-    /* apparently, some applications don't fill in the image size */
-    if (bmp.image.image_size == 0) {
-        OPENDCP_LOG(LOG_DEBUG, "BMP missing file size field, will attempt to calculate");
-        bmp.image.image_size = bmp.file.size - sizeof(bmp_magic_num_t) - sizeof(bmp_image_t);
+    if (bmp.image.bpp != 24 && bmp.image.bpp != 32) {
+        OPENDCP_LOG(LOG_ERROR, "%d-bit depth is not supported.",bmp.image.bpp);
+        opendcp_file_unmap(&map);
+        return OPENDCP_FATAL;
     }
 
-    if (bmp.image.bpp < 24 || bmp.image.bpp > 32) {
-        OPENDCP_LOG(LOG_ERROR, "%d-bit depth is not supported.",bmp.image.bpp);
+    /* rows are padded to 4 bytes, the image data has to be in the file */
+    spp      = bmp.image.bpp / 8;
+    row_size = (((size_t)bmp.image.bpp * w + 31) / 32) * 4;
+    OPENDCP_LOG(LOG_DEBUG, "%-15.15s: row size %d", "read_bmp", (int)row_size);
+
+    if (w <= 0 || h == 0 || bmp.file.offset > map.size || (map.size - bmp.file.offset) / row_size < (size_t)h) {
+        OPENDCP_LOG(LOG_ERROR,"%s is not a valid BMP file", sfile);
+        opendcp_file_unmap(&map);
         return OPENDCP_FATAL;
     }
 
     /* create the image */
     OPENDCP_LOG(LOG_DEBUG,"%-15.15s: allocating opendcp image","read_bmp");
     image = opendcp_image_create(3, w, h);
+
+    if (image == NULL) {
+        opendcp_file_unmap(&map);
+        return OPENDCP_FATAL;
+    }
+
     OPENDCP_LOG(LOG_DEBUG,"%-15.15s: image allocated","read_bmp");
 
-    int row_size = ((bmp.image.bpp * w + 31) / 32) * 4;
-    OPENDCP_LOG(LOG_DEBUG, "%-15,15s: row size %d data size %d", "read_bmp", row_size, sizeof(uint8_t));
-
-    fseek(bmp_fp, bmp.file.offset, SEEK_SET);
-
-    /* RGB(A) */
-    if (bmp.image.compression == BMP_RGB) {
-        /* 16-bits per pixel */
-        if (bmp.image.bpp == 16 ) {
-            uint8_t data[2];
-            for (i=0; i<pixels; i++) {
-                fread(&data,sizeof(data),1,bmp_fp);
-                int p = invert_row(bmp, i);
-                image->component[BMP_B].data[p] = data[0] << 2;
-                image->component[BMP_G].data[p] = data[0] << 4;
-                image->component[BMP_R].data[p] = data[1] << 2;
-            }
-        /* 24-bits per pixel */
-        } else if (bmp.image.bpp == 24 ) {
-            uint8_t data[3];
-            for (i=0; i<pixels; i++) {
-                fread(&data, sizeof(uint8_t), sizeof(data), bmp_fp);
-                int p = invert_row(bmp, i);
-                image->component[BMP_B].data[p] = data[0] << 4;
-                image->component[BMP_G].data[p] = data[1] << 4;
-                image->component[BMP_R].data[p] = data[2] << 4;;
-            }
-        /* 32-bits per pixel */
-        } else if (bmp.image.bpp == 32 ) {
-            uint8_t data[4];
-            for (i=0; i<pixels; i++) {
-                fread(&data, sizeof(uint8_t), sizeof(data), bmp_fp);
-                int p = invert_row(bmp, i);
-                image->component[BMP_B].data[p] = data[0] << 4;
-                image->component[BMP_G].data[p] = data[1] << 4;
-                image->component[BMP_R].data[p] = data[2] << 4;
-            }
+    src = map.data + bmp.file.offset;
+
+    /* decode in bands of rows so the next stage can take them from cache */
+    for (y0 = 0; y0 < h; y0 = y1) {
+        y1 = y0 + BMP_BAND < h ? y0 + BMP_BAND : h;
+
+        for (y = y0; y < y1; y++) {
+            /* bottom-up files store the last row first */
+            bmp_deinterleave_8(image, src + row_size * (bmp.row_order == BMP_BOTTOM ? h - 1 - y : y), y, w, spp);
         }
+
+        opendcp_decoder_band(band, image, y0, y1);
     }
-    /* RGB(A) */
 
-    fclose(bmp_fp);
+    opendcp_file_unmap(&map);
 
     OPENDCP_LOG(LOG_DEBUG,"%-15.15s: BMP read complete","read_bmp");
     *image_ptr = image;
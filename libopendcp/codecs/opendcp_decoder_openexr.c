@@ -1,6 +1,7 @@
 /* opendcp_decoder_exr.c */
 
-// FOR TWO FUNCTION: uncompress_rle() and unfilter_buffer() 
+// FOR FUNCTIONS: uncompress_rle(), unfilter_buffer() and the PIZ huffman,
+// wavelet and lut functions (huf_*, wav_*, piz_*)
 ///////////////////////////////////////////////////////////////////////////
 //
 // Copyright (c) 2002, Industrial Light & Magic, a division of Lucas
@@ -47,21 +48,33 @@
 #include <string.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <pthread.h>
+#include <zlib.h>
 #include "opendcp.h"
 #include "opendcp_image.h"
+#include "opendcp_decoder.h"
+#include "cpu.h"
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
 
 #define MAGIC_NUMBER_EXR 0x762f3101
+#define EXR_MAX_CHANNELS 64   /* channels whose layout is kept, for PIZ */
+#define EXR_THREADS      4    /* threads decoding chunks */
 
 typedef enum {
     EXR_COMPRESSION_NO       = 0,          /* no compression                  */
     EXR_COMPRESSION_RLE      = 1,          /* 8-bit run-length-encoded (not supported) */
     EXR_COMPRESSION_ZIPS     = 2,          /* zip single line (not supported) */
     EXR_COMPRESSION_ZIP      = 3,          /* zip 16 lines                    */
-    EXR_COMPRESSION_PIZ      = 4,          /* piz (not supported)             */
-    EXR_COMPRESSION_PXR24    = 5           /* pixar 24 bit (not supported)    */
-    EXR_COMPRESSION_B44      = 6           /* b44 (not supported)             */
-    EXR_COMPRESSION_B44A     = 7           /* b44a (not supported)            */
-    EXR_COMPRESSION_DWAA     = 8            /* dwaa 32 lines (not supported)  */
+    EXR_COMPRESSION_PIZ      = 4,          /* piz 32 lines                    */
+    EXR_COMPRESSION_PXR24    = 5,          /* pixar 24 bit (not supported)    */
+    EXR_COMPRESSION_B44      = 6,          /* b44 (not supported)             */
+    EXR_COMPRESSION_B44A     = 7,          /* b44a (not supported)            */
+    EXR_COMPRESSION_DWAA     = 8,           /* dwaa 32 lines (not supported)  */
     EXR_COMPRESSION_DWAB     = 9            /* dwab 256 lines (not supported) */
 } exr_compression_enum;
 
@@ -73,7 +86,7 @@ typedef enum {
 
 typedef struct {
     char name[255];            /* channel name                                      */
-    unsigned char dataType;    /* channel data type, int, half, float               */
+    unsigned char data_type;   /* channel data type, int, half, float               */
     unsigned char non_linear;  /* non linear, only use for B44 and B44A compression */
     unsigned int sample_x;     /* sample x direction, only support == 1             */
     unsigned int sample_y;     /* sample y direction, only support == 1             */
@@ -84,6 +97,8 @@ typedef struct {
     unsigned short num_channels; /* number channels                                   */
     exr_channel channel[3];      /* channel array, only read data for B, G, R channel */
     unsigned short data_width;   /* channel data width for all channels, for uncompress buffer size */
+    unsigned short total_channels;            /* number of channels in the file          */
+    unsigned char width[EXR_MAX_CHANNELS];     /* sample width in bytes of every channel */
 } exr_channel_list;
 
 /* exr window */
@@ -99,24 +114,16 @@ typedef struct {
     exr_channel_list channel_list;    /* channel list */
     unsigned char compression;        /* compression */
     exr_window dataWindow;            /* data window */
+    exr_window displayWindow;         /* display window */
 } exr_attributes;
 
 /* exr chunk data */
 typedef struct {
    unsigned int num_chunks;        /* number chunks */
-   unsigned long *chunk_table;     /* chunk table - address for chunks in file (from begin file) */
+   uint64_t *chunk_table;          /* chunk table - address for chunks in file (from begin file) */
 } exr_chunk_data;
 
-/* exr image data */
-typedef struct {
-   unsigned short width;    /* width      */
-   unsigned short height;   /* height     */
-   float *channel_b;        /* channel b  */ 
-   float *channel_g;        /* channel g  */
-   float *channel_r;        /* channel r  */
-} exr_image_data;
-
-#pragma mark ---- Half --> Float
+/* ---- Half --> Float */
 /* for change half become float */
 typedef union {
     unsigned int i;
@@ -213,7 +220,61 @@ float half2float( unsigned short half ) {
 }
 
 
-#pragma mark ---- Read Attributes
+/* every half converted once with half2float() */
+static float half_table[65536];
+static pthread_once_t half_table_once = PTHREAD_ONCE_INIT;
+
+static void build_half_table( void ) {
+
+   unsigned int half;
+
+   for( half = 0; half < 65536; half++ )
+      half_table[half] = half2float( (unsigned short)half );
+}
+
+// ---- convert a row of little endian halves, F16C/NEON where available; these
+// ---- are identical to the table except for the payload of signaling NaNs
+#if defined(__GNUC__) && defined(__x86_64__)
+__attribute__((target("avx,f16c")))
+static unsigned int half_row_f16c( const unsigned char *buffer, float *channel_data, unsigned int count ) {
+
+   unsigned int index;
+
+   for( index = 0; index + 8 <= count; index += 8 )
+      _mm256_storeu_ps( channel_data + index, _mm256_cvtph_ps( _mm_loadu_si128( (const __m128i *)(buffer + index*2) ) ) );
+
+   return index;
+}
+#elif defined(__aarch64__)
+static unsigned int half_row_neon( const unsigned char *buffer, float *channel_data, unsigned int count ) {
+
+   unsigned int index;
+
+   for( index = 0; index + 4 <= count; index += 4 )
+      vst1q_f32( channel_data + index, vcvt_f32_f16( vreinterpret_f16_u16( vld1_u16( (const uint16_t *)(buffer + index*2) ) ) ) );
+
+   return index;
+}
+#endif
+
+static void half_row( const unsigned char *buffer, float *channel_data, unsigned int count ) {
+
+   unsigned int index = 0;
+
+#if defined(__GNUC__) && defined(__x86_64__)
+   if( cpu_has( CPU_F16C ) )
+      index = half_row_f16c( buffer, channel_data, count );
+#elif defined(__aarch64__)
+   if( cpu_has( CPU_NEON ) )
+      index = half_row_neon( buffer, channel_data, count );
+#endif
+
+   for( ; index < count; index++ )
+      channel_data[index] = half_table[buffer[index*2] | buffer[index*2+1] << 8];
+}
+
+
+/* ---- Read Attributes */
 unsigned char read_string_255_from_file( FILE *fp, char *string ) {
 
    unsigned char index = 0;
@@ -231,6 +292,7 @@ exr_channel_list read_channel_data( FILE *exr_fp) {
    unsigned char finish = 0x00;
    channel_list.num_channels = 0;
    channel_list.data_width = 0;
+   channel_list.total_channels = 0;
    unsigned short channel_index = 0;
    unsigned short offset = 0;
       
@@ -242,14 +304,14 @@ exr_channel_list read_channel_data( FILE *exr_fp) {
       if( stringLength ) {
          unsigned char find_channel = 0x00;
 
-         if( channel.name[0] == 'B' ) {
-            find_channel = 0x01;
-         }
-         else if( channel.name[0] == 'G' ) {
+         if( !strcmp( channel.name, "B" ) || !strcmp( channel.name, "G" ) || !strcmp( channel.name, "R" ) ) {
             find_channel = 0x01;
          }
-         else if( channel.name[0] == 'R' ) {
-            find_channel = 0x01;
+
+         // ---- keep the channel count honest if names repeat
+         if( find_channel && channel_index >= 3 ) {
+            find_channel = 0x00;
+            channel_list.num_channels++;
          }
 
          if( find_channel ) {
@@ -283,6 +345,9 @@ exr_channel_list read_channel_data( FILE *exr_fp) {
                offset += 4;
                channel_list.data_width += 4;
             }
+            if( channel_list.total_channels < EXR_MAX_CHANNELS )
+               channel_list.width[channel_list.total_channels] = channel.data_type == EXR_HALF ? 2 : 4;
+            channel_list.total_channels++;
             // ---- save channel
             channel_list.channel[channel_index] = channel;
             channel_list.num_channels++;
@@ -300,6 +365,9 @@ exr_channel_list read_channel_data( FILE *exr_fp) {
                offset += 4;
                channel_list.data_width += 4;
             }
+            if( channel_list.total_channels < EXR_MAX_CHANNELS )
+               channel_list.width[channel_list.total_channels] = data_type == EXR_HALF ? 2 : 4;
+            channel_list.total_channels++;
             fseek( exr_fp, ftell( exr_fp ) + 15, SEEK_SET );
          }
    }
@@ -317,6 +385,8 @@ exr_attributes read_attributes( FILE *exr_fp ) {
    exr_attributes attributes;
    unsigned char finish = 0;
 
+   memset( &attributes, 0, sizeof( attributes ) );
+
    // ---- read attributes, after last attribute have byte == 0x00 
    do {
       // ---- read attribute name
@@ -364,19 +434,25 @@ exr_attributes read_attributes( FILE *exr_fp ) {
    return attributes;
 }
 
+/* rows stored in each chunk */
+static unsigned int rows_per_chunk( unsigned char compression ) {
+
+   if( compression == EXR_COMPRESSION_ZIP )
+      return 16;
+   else if( compression == EXR_COMPRESSION_PIZ )
+      return 32;
+
+   return 1;
+}
+
 exr_chunk_data read_chunk_data( FILE *exr_fp, exr_attributes *attributes ) {
 
    exr_chunk_data chunk_data;
    unsigned short num_rows = (attributes->dataWindow.top - attributes->dataWindow.bottom) + 1;
+   unsigned int chunk_rows = rows_per_chunk( attributes->compression );
 
-   // ---- if EXR_COMPRESSION_ZIP, 16 rows per chunk
-   if( attributes->compression == EXR_COMPRESSION_ZIP ) { //
-      chunk_data.num_chunks = num_rows >> 4;
-      if( num_rows & 0xf )
-         chunk_data.num_chunks++;
-   }
-   else
-      chunk_data.num_chunks = num_rows;
+   // ---- ZIP has 16 and PIZ 32 rows per chunk, the last one may be short
+   chunk_data.num_chunks = (num_rows + chunk_rows - 1) / chunk_rows;
    
    // ---- get memory for chunk table
    chunk_data.chunk_table = malloc( chunk_data.num_chunks << 3 );  // 8 bytes for each table element
@@ -392,7 +468,7 @@ exr_chunk_data read_chunk_data( FILE *exr_fp, exr_attributes *attributes ) {
 }
 
 
-#pragma mark ---- Compression
+/* ---- Compression */
 /* unfilter buffer - from OpenEXR library */
 void unfilter_buffer( unsigned char *buffer, unsigned char *unfilteredBuffer, unsigned int length ) {
 
@@ -474,9 +550,10 @@ void uncompress_rle( unsigned char *compressed_buffer, unsigned int compressed_b
 }
 
 /* uncompress zip with zlib */
-void uncompress_zip( unsigned char *compressed_buffer, unsigned int compressed_buffer_length, unsigned char *uncompressed_buffer, unsigned int uncompressed_buffer_length ) {
+int uncompress_zip( unsigned char *compressed_buffer, unsigned int compressed_buffer_length, unsigned char *uncompressed_buffer, unsigned int uncompressed_buffer_length ) {
 
    int err;
+   int result = OPENDCP_NO_ERROR;
    z_stream d_stream; // decompression stream data struct
    
    d_stream.zalloc = Z_NULL;
@@ -492,6 +569,7 @@ void uncompress_zip( unsigned char *compressed_buffer, unsigned int compressed_b
 
    if( err != Z_OK ) {
       OPENDCP_LOG(LOG_ERROR,"uncompress_zip: error inflateInit %d (%x) d_stream.avail_in %d", err, err, d_stream.avail_in );
+      return OPENDCP_ERROR;
    }
    
    // ---- give data to decompress
@@ -501,6 +579,7 @@ void uncompress_zip( unsigned char *compressed_buffer, unsigned int compressed_b
    err = inflate(&d_stream, Z_STREAM_END);
  
    if( err != Z_STREAM_END ) {
+      result = OPENDCP_ERROR;
       if( err == Z_OK) {
          OPENDCP_LOG(LOG_ERROR,"uncompress_zip: Z_OK d_stream.avail_out %d d_stream.total_out %lu",
                d_stream.avail_out, d_stream.total_out );
@@ -514,37 +593,33 @@ void uncompress_zip( unsigned char *compressed_buffer, unsigned int compressed_b
    err = inflateEnd( &d_stream );
    if( err != Z_OK )
       OPENDCP_LOG(LOG_ERROR,"ExrZIP: uncompress: error inflateEnd %d (%x) c_stream.avail_in %d", err, err, d_stream.avail_in );
+
+   return result;
 }
 
 /* copy half data */
-void copy_half_data( unsigned char *buffer, float *channel_data, unsigned short num_rows, unsigned short num_columns, unsigned short start_row_number, exr_channel *channel ) {
+void copy_half_data( unsigned char *buffer, float *channel_data, unsigned short num_rows, unsigned short num_columns, unsigned short start_row_number, unsigned short data_width, exr_channel *channel ) {
 
    // ---- calculate offset for channel data,
    unsigned int channel_data_offset = num_columns*start_row_number;
 
+   pthread_once( &half_table_once, build_half_table );
+
    unsigned short row_index = 0;
    while( row_index < num_rows ) {
       // ---- calculate offset for channels
-      unsigned int buffer_offset = num_columns*channel->offset*row_index;
-
-      unsigned short column_index = 0;
-      while( column_index < num_columns ) {
-         // ---- combine data for half number
-         unsigned short half = buffer[buffer_offset] | buffer[buffer_offset+1] << 8;
+      unsigned int buffer_offset = num_columns*(row_index*data_width + channel->offset);
 
-         // ---- convert half and save float data in channel
-         channel_data[channel_data_offset] = half2float( half );
+      // ---- convert the halves of this row and save float data in channel
+      half_row( buffer + buffer_offset, channel_data + channel_data_offset, num_columns );
 
-         channel_data_offset++;
-         buffer_offset += 2;
-         column_index++;
-      }
+      channel_data_offset += num_columns;
       row_index++;
    }
 }
 
 /* copy float data */
-void copy_float_data( unsigned char *buffer, float *channel_data, unsigned short num_rows, unsigned short num_columns, unsigned short start_row_number, exr_channel *channel ) {
+void copy_float_data( unsigned char *buffer, float *channel_data, unsigned short num_rows, unsigned short num_columns, unsigned short start_row_number, unsigned short data_width, exr_channel *channel ) {
 
    // ---- calculate offset for channel data,
    unsigned int channel_data_offset = num_columns*start_row_number;
@@ -554,7 +629,7 @@ void copy_float_data( unsigned char *buffer, float *channel_data, unsigned short
    unsigned short row_index = 0;
    while( row_index < num_rows ) {
       // ---- calculate offset for channels
-      unsigned int buffer_offset = num_columns*channel->offset*row_index;
+      unsigned int buffer_offset = num_columns*(row_index*data_width + channel->offset);
 
       unsigned short column_index = 0;
       while( column_index < num_columns ) {
@@ -572,205 +647,685 @@ void copy_float_data( unsigned char *buffer, float *channel_data, unsigned short
    }
 }
 
-/* compression no */
-void read_data_compression_no( FILE *exr_fp, exr_chunk_data *chunk_data, exr_attributes *attributes, exr_image_data *image_data ) {
+/* ---- PIZ */
+/* piz huffman, wavelet and lut - from OpenEXR library */
+#define USHORT_RANGE        (1 << 16)
+#define BITMAP_SIZE         (USHORT_RANGE >> 3)
+#define HUF_ENCBITS         16
+#define HUF_DECBITS         14
+#define HUF_ENCSIZE         ((1 << HUF_ENCBITS) + 1)
+#define HUF_DECSIZE         (1 << HUF_DECBITS)
+#define HUF_DECMASK         (HUF_DECSIZE - 1)
+#define SHORT_ZEROCODE_RUN  59
+#define LONG_ZEROCODE_RUN   63
+#define SHORTEST_LONG_RUN   (2 + LONG_ZEROCODE_RUN - SHORT_ZEROCODE_RUN)
+
+/* huffman decoding table entry */
+typedef struct {
+   int len;            /* code length, 0 for long codes  */
+   int lit;            /* symbol, or number of long codes */
+   int *p;             /* long code symbols              */
+} huf_dec;
 
-   unsigned int num_columns = (attributes->dataWindow.right - attributes->dataWindow.left) + 1;
-  
-   unsigned short channel_data_width = attributes->channel_list.data_width;
+/* per thread piz scratch buffers */
+typedef struct {
+   uint64_t *freq;               /* [HUF_ENCSIZE] code table    */
+   huf_dec *hdec;                /* [HUF_DECSIZE] decode table  */
+   unsigned short *lut;          /* [USHORT_RANGE] reverse lut  */
+   unsigned char *bitmap;        /* [BITMAP_SIZE]               */
+   unsigned short *tmp;          /* wavelet data of one chunk   */
+} exr_piz;
 
-   unsigned char *data_buffer = malloc( num_columns*channel_data_width );
+static unsigned int read_le32( const unsigned char *p ) {
 
-   unsigned short chunk_number = 0;
-   while( chunk_number < chunk_data->num_chunks ) {
-      // ---- begin chunk
-      fseek( exr_fp, chunk_data->chunk_table[chunk_number], SEEK_SET );
+   return p[0] | p[1] << 8 | p[2] << 16 | (unsigned int)p[3] << 24;
+}
 
-      // ---- read row number
-      unsigned int row_number = 0;
-      fread( &row_number, 4, 1, exr_fp );
+// ---- read n bits, refilling the bit buffer a byte at a time
+static uint64_t huf_get_bits( int n, uint64_t *c, int *lc, const unsigned char **in ) {
 
-      // ---- read data length
-      unsigned int data_length = 0; 
-      fread( &data_length, 4, 1, exr_fp );
+   while( *lc < n ) {
+      *c = (*c << 8) | *(*in)++;
+      *lc += 8;
+   }
+   *lc -= n;
 
-      // ---- read compressed data
-      fread( data_buffer, 1, data_length, exr_fp );
+   return (*c >> *lc) & ((1 << n) - 1);
+}
 
-      // ---- copy data from buffer
-      if( attributes->channel_list.channel[0].data_type == EXR_HALF )
-         copy_half_data( data_buffer, image_data->channel_b, 1, num_columns, row_number, &(attributes->channel_list.channel[0]) );
-      else
-         copy_float_data( data_buffer, image_data->channel_b, 1, num_columns, row_number, &(attributes->channel_list.channel[0]) );
+// ---- build canonical codes from code lengths
+static void huf_canonical_code_table( uint64_t *hcode ) {
 
-      if( attributes->channel_list.channel[1].data_type == EXR_HALF )
-         copy_half_data( data_buffer, image_data->channel_g, 1, num_columns, row_number, &(attributes->channel_list.channel[1]) );
-      else
-         copy_float_data( data_buffer, image_data->channel_g, 1, num_columns, row_number, &(attributes->channel_list.channel[1]) );
+   uint64_t n[59];
+   uint64_t c = 0;
+   int i;
 
-      if( attributes->channel_list.channel[2].data_type == EXR_HALF )
-         copy_half_data( data_buffer, image_data->channel_r, 1, num_columns, row_number, &(attributes->channel_list.channel[2]) );
-      else
-         copy_float_data( data_buffer, image_data->channel_r, 1, num_columns, row_number, &(attributes->channel_list.channel[2]) );
+   memset( n, 0, sizeof( n ) );
+
+   for( i = 0; i < HUF_ENCSIZE; i++ )
+      n[hcode[i]] += 1;
+
+   for( i = 58; i > 0; --i ) {
+      uint64_t nc = ((c + n[i]) >> 1);
+      n[i] = c;
+      c = nc;
+   }
 
-      // ---- next chunk
-      chunk_number++;
+   for( i = 0; i < HUF_ENCSIZE; i++ ) {
+      int l = (int)hcode[i];
+      if( l > 0 )
+         hcode[i] = l | (n[l]++ << 6);
    }
 }
 
-/* compression RLE */
-void read_data_compression_rle( FILE *exr_fp, exr_chunk_data *chunk_data, exr_attributes *attributes, exr_image_data *image_data ) {
+// ---- unpack the code lengths, zero runs are run length encoded
+static int huf_unpack_enc_table( const unsigned char **pcode, int ni, int im, int iM, uint64_t *hcode ) {
 
-   unsigned int num_columns = (attributes->dataWindow.right - attributes->dataWindow.left) + 1;
-  
-   unsigned short channel_data_width = attributes->channel_list.data_width;
+   const unsigned char *p = *pcode;
+   uint64_t c = 0;
+   int lc = 0;
 
-   unsigned int uncompressed_data_length = num_columns*channel_data_width;
+   for( ; im <= iM; im++ ) {
+      if( p - *pcode >= ni )
+         return OPENDCP_ERROR;
 
-   unsigned char *compressed_buffer = malloc( uncompressed_data_length << 1 );
-   unsigned char *uncompressed_buffer = malloc( uncompressed_data_length );
-   unsigned char *unfiltered_buffer = malloc( uncompressed_data_length ); 
+      uint64_t l = hcode[im] = huf_get_bits( 6, &c, &lc, &p );
 
-   unsigned short chunk_number = 0;
-   while( chunk_number < chunk_data->num_chunks ) {
-      // ---- begin chunk
-      fseek( exr_fp, chunk_data->chunk_table[chunk_number], SEEK_SET );
+      if( l == LONG_ZEROCODE_RUN ) {
+         if( p - *pcode >= ni )
+            return OPENDCP_ERROR;
 
-      // ---- read row number
-      unsigned int row_number = 0;
-      fread( &row_number, 4, 1, exr_fp );
+         int zerun = (int)huf_get_bits( 8, &c, &lc, &p ) + SHORTEST_LONG_RUN;
 
-      // ---- read data length
-      unsigned int data_length = 0; 
-      fread( &data_length, 4, 1, exr_fp );
+         if( im + zerun > iM + 1 )
+            return OPENDCP_ERROR;
 
-      // ---- read compressed data
-      fread( compressed_buffer, 1, data_length, exr_fp );
+         while( zerun-- )
+            hcode[im++] = 0;
+         im--;
+      }
+      else if( l >= SHORT_ZEROCODE_RUN ) {
+         int zerun = (int)l - SHORT_ZEROCODE_RUN + 2;
 
-      // ---- uncompress rle
-      uncompress_rle( compressed_buffer, data_length, uncompressed_buffer, uncompressed_data_length );
-      
-      // ---- unfilter data
-      unfilter_buffer( uncompressed_buffer, unfiltered_buffer, uncompressed_data_length );
+         if( im + zerun > iM + 1 )
+            return OPENDCP_ERROR;
 
-      // ---- copy data from buffer
-      if( attributes->channel_list.channel[0].data_type == EXR_HALF )
-         copy_half_data( unfiltered_buffer, image_data->channel_b, 1, num_columns, row_number, &(attributes->channel_list.channel[0]) );
-      else
-         copy_float_data( unfiltered_buffer, image_data->channel_b, 1, num_columns, row_number, &(attributes->channel_list.channel[0]) );
+         while( zerun-- )
+            hcode[im++] = 0;
+         im--;
+      }
+   }
 
-      if( attributes->channel_list.channel[1].data_type == EXR_HALF )
-         copy_half_data( unfiltered_buffer, image_data->channel_g, 1, num_columns, row_number, &(attributes->channel_list.channel[1]) );
-      else
-         copy_float_data( unfiltered_buffer, image_data->channel_g, 1, num_columns, row_number, &(attributes->channel_list.channel[1]) );
+   *pcode = p;
+   huf_canonical_code_table( hcode );
+
+   return OPENDCP_NO_ERROR;
+}
+
+static void huf_free_dec_table( huf_dec *hdecod ) {
+
+   int i;
+
+   for( i = 0; i < HUF_DECSIZE; i++ ) {
+      free( hdecod[i].p );
+      hdecod[i].p = NULL;
+   }
+}
+
+// ---- short codes index the table directly, longer ones share an entry
+static int huf_build_dec_table( const uint64_t *hcode, int im, int iM, huf_dec *hdecod ) {
+
+   for( ; im <= iM; im++ ) {
+      uint64_t c = hcode[im] >> 6;
+      int l = (int)(hcode[im] & 63);
+
+      if( c >> l )
+         return OPENDCP_ERROR;
+
+      if( l > HUF_DECBITS ) {
+         huf_dec *pl = hdecod + (c >> (l - HUF_DECBITS));
+         int *p;
+
+         if( pl->len )
+            return OPENDCP_ERROR;
 
-      if( attributes->channel_list.channel[2].data_type == EXR_HALF )
-         copy_half_data( unfiltered_buffer, image_data->channel_r, 1, num_columns, row_number, &(attributes->channel_list.channel[2]) );
+         p = realloc( pl->p, (pl->lit + 1) * sizeof( int ) );
+         if( !p )
+            return OPENDCP_ERROR;
+
+         pl->p = p;
+         pl->p[pl->lit++] = im;
+      }
+      else if( l ) {
+         huf_dec *pl = hdecod + (c << (HUF_DECBITS - l));
+         int i;
+
+         for( i = 1 << (HUF_DECBITS - l); i > 0; i--, pl++ ) {
+            if( pl->len || pl->p )
+               return OPENDCP_ERROR;
+            pl->len = l;
+            pl->lit = im;
+         }
+      }
+   }
+
+   return OPENDCP_NO_ERROR;
+}
+
+// ---- emit a symbol, rlc repeats the previous one
+static int huf_get_code( int po, int rlc, uint64_t *c, int *lc, const unsigned char **in, const unsigned char *ie,
+                         unsigned short **out, unsigned short *ob, unsigned short *oe ) {
+
+   if( po == rlc ) {
+      if( *lc < 8 ) {
+         if( *in >= ie )
+            return OPENDCP_ERROR;
+         *c = (*c << 8) | *(*in)++;
+         *lc += 8;
+      }
+      *lc -= 8;
+
+      unsigned char cs = (unsigned char)(*c >> *lc);
+
+      if( *out + cs > oe || *out - 1 < ob )
+         return OPENDCP_ERROR;
+
+      unsigned short s = (*out)[-1];
+      while( cs-- > 0 )
+         *(*out)++ = s;
+   }
+   else if( *out < oe )
+      *(*out)++ = (unsigned short)po;
+   else
+      return OPENDCP_ERROR;
+
+   return OPENDCP_NO_ERROR;
+}
+
+static int huf_decode( const uint64_t *hcode, const huf_dec *hdecod, const unsigned char *in, int ni, int rlc, int no, unsigned short *out ) {
+
+   uint64_t c = 0;
+   int lc = 0;
+   unsigned short *outb = out;
+   unsigned short *oe = out + no;
+   const unsigned char *ie = in + (ni + 7) / 8;
+
+   while( in < ie ) {
+      c = (c << 8) | *in++;
+      lc += 8;
+
+      while( lc >= HUF_DECBITS ) {
+         const huf_dec *pl = hdecod + ((c >> (lc - HUF_DECBITS)) & HUF_DECMASK);
+
+         if( pl->len ) {
+            lc -= pl->len;
+            if( lc < 0 || huf_get_code( pl->lit, rlc, &c, &lc, &in, ie, &out, outb, oe ) != OPENDCP_NO_ERROR )
+               return OPENDCP_ERROR;
+         }
+         else {
+            int j;
+
+            if( !pl->p )
+               return OPENDCP_ERROR;
+
+            for( j = 0; j < pl->lit; j++ ) {
+               int l = (int)(hcode[pl->p[j]] & 63);
+
+               while( lc < l && in < ie ) {
+                  c = (c << 8) | *in++;
+                  lc += 8;
+               }
+
+               if( lc >= l && (hcode[pl->p[j]] >> 6) == ((c >> (lc - l)) & (((uint64_t)1 << l) - 1)) ) {
+                  lc -= l;
+                  if( huf_get_code( pl->p[j], rlc, &c, &lc, &in, ie, &out, outb, oe ) != OPENDCP_NO_ERROR )
+                     return OPENDCP_ERROR;
+                  break;
+               }
+            }
+
+            if( j == pl->lit )
+               return OPENDCP_ERROR;
+         }
+      }
+   }
+
+   // ---- get the remaining (short) codes
+   int i = (8 - ni) & 7;
+   c >>= i;
+   lc -= i;
+
+   while( lc > 0 ) {
+      const huf_dec *pl = hdecod + ((c << (HUF_DECBITS - lc)) & HUF_DECMASK);
+
+      if( pl->len && pl->len <= lc ) {
+         lc -= pl->len;
+         if( huf_get_code( pl->lit, rlc, &c, &lc, &in, ie, &out, outb, oe ) != OPENDCP_NO_ERROR )
+            return OPENDCP_ERROR;
+      }
       else
-         copy_float_data( unfiltered_buffer, image_data->channel_r, 1, num_columns, row_number, &(attributes->channel_list.channel[2]) );
+         return OPENDCP_ERROR;
+   }
+
+   return (out - outb == no) ? OPENDCP_NO_ERROR : OPENDCP_ERROR;
+}
+
+static int huf_uncompress( const unsigned char *compressed, int nCompressed, unsigned short *raw, int nRaw, exr_piz *piz ) {
+
+   int result;
+
+   if( nCompressed == 0 )
+      return nRaw ? OPENDCP_ERROR : OPENDCP_NO_ERROR;
 
-      // ---- next chunk
-      chunk_number++;
+   if( nCompressed < 20 )
+      return OPENDCP_ERROR;
+
+   unsigned int im = read_le32( compressed );
+   unsigned int iM = read_le32( compressed + 4 );
+   unsigned int nBits = read_le32( compressed + 12 );
+   const unsigned char *ptr = compressed + 20;
+
+   if( im >= HUF_ENCSIZE || iM >= HUF_ENCSIZE )
+      return OPENDCP_ERROR;
+
+   memset( piz->freq, 0, HUF_ENCSIZE * sizeof( uint64_t ) );
+   memset( piz->hdec, 0, HUF_DECSIZE * sizeof( huf_dec ) );
+
+   result = huf_unpack_enc_table( &ptr, nCompressed - (int)(ptr - compressed), im, iM, piz->freq );
+
+   if( result == OPENDCP_NO_ERROR && (uint64_t)nBits > 8 * (uint64_t)(nCompressed - (ptr - compressed)) )
+      result = OPENDCP_ERROR;
+
+   if( result == OPENDCP_NO_ERROR )
+      result = huf_build_dec_table( piz->freq, im, iM, piz->hdec );
+
+   if( result == OPENDCP_NO_ERROR )
+      result = huf_decode( piz->freq, piz->hdec, ptr, nBits, iM, nRaw, raw );
+
+   huf_free_dec_table( piz->hdec );
+
+   return result;
+}
+
+// ---- inverse wavelet steps, 14 bit and modulo 16 bit
+static void wav_dec14( unsigned short l, unsigned short h, unsigned short *a, unsigned short *b ) {
+
+   short ls = (short)l;
+   short hs = (short)h;
+   int hi = hs;
+   int ai = ls + (hi & 1) + (hi >> 1);
+
+   *a = (unsigned short)(short)ai;
+   *b = (unsigned short)(short)(ai - hi);
+}
+
+static void wav_dec16( unsigned short l, unsigned short h, unsigned short *a, unsigned short *b ) {
+
+   int m = l;
+   int d = h;
+   int bb = (m - (d >> 1)) & 0xffff;
+   int aa = (d + bb - 0x8000) & 0xffff;
+
+   *b = (unsigned short)bb;
+   *a = (unsigned short)aa;
+}
+
+static void wav_2d_decode( unsigned short *in, int nx, int ox, int ny, int oy, unsigned short mx ) {
+
+   void (*wdec)( unsigned short, unsigned short, unsigned short *, unsigned short * ) = (mx < (1 << 14)) ? wav_dec14 : wav_dec16;
+   int n = (nx > ny) ? ny : nx;
+   int p = 1;
+   int p2;
+
+   // ---- search max level
+   while( p <= n )
+      p <<= 1;
+
+   p >>= 1;
+   p2 = p;
+   p >>= 1;
+
+   // ---- hierarchical loop on smaller dimension n
+   while( p >= 1 ) {
+      unsigned short *py = in;
+      unsigned short *ey = in + oy * (ny - p2);
+      int oy1 = oy * p;
+      int oy2 = oy * p2;
+      int ox1 = ox * p;
+      int ox2 = ox * p2;
+      unsigned short i00, i01, i10, i11;
+
+      // ---- y loop
+      for( ; py <= ey; py += oy2 ) {
+         unsigned short *px = py;
+         unsigned short *ex = py + ox * (nx - p2);
+
+         // ---- x loop
+         for( ; px <= ex; px += ox2 ) {
+            unsigned short *p01 = px + ox1;
+            unsigned short *p10 = px + oy1;
+            unsigned short *p11 = p10 + ox1;
+
+            wdec( *px, *p10, &i00, &i10 );
+            wdec( *p01, *p11, &i01, &i11 );
+            wdec( i00, i01, px, p01 );
+            wdec( i10, i11, p10, p11 );
+         }
+
+         // ---- decode (1D) odd column (still in y loop)
+         if( nx & p ) {
+            unsigned short *p10 = px + oy1;
+
+            wdec( *px, *p10, &i00, p10 );
+            *px = i00;
+         }
+      }
+
+      // ---- decode (1D) odd line (must loop in x)
+      if( ny & p ) {
+         unsigned short *px = py;
+         unsigned short *ex = py + ox * (nx - p2);
+
+         for( ; px <= ex; px += ox2 ) {
+            unsigned short *p01 = px + ox1;
+
+            wdec( *px, *p01, &i00, p01 );
+            *px = i00;
+         }
+      }
+
+      p2 = p;
+      p >>= 1;
    }
+}
 
-   // ---- free memory
-   free( compressed_buffer );
-   free( uncompressed_buffer );
-   free( unfiltered_buffer );
+// ---- values present in the chunk, index 0 always maps to 0
+static unsigned short piz_reverse_lut( const unsigned char *bitmap, unsigned short *lut ) {
+
+   int k = 0;
+   int i, n;
+
+   for( i = 0; i < USHORT_RANGE; ++i ) {
+      if( (i == 0) || (bitmap[i >> 3] & (1 << (i & 7))) )
+         lut[k++] = (unsigned short)i;
+   }
+
+   n = k - 1;
+
+   while( k < USHORT_RANGE )
+      lut[k++] = 0;
+
+   return (unsigned short)n;
 }
 
-/* compression ZIPS an ZIP */
-void read_data_compression_zip( FILE *exr_fp, exr_chunk_data *chunk_data, exr_attributes *attributes, exr_image_data *image_data ) {
+/* uncompress piz into the scanline layout used by the other compressions */
+static int piz_uncompress( const unsigned char *compressed, unsigned int compressed_length, unsigned char *uncompressed,
+                           unsigned int num_rows, unsigned int num_columns, exr_channel_list *channel_list, exr_piz *piz ) {
 
-   unsigned int num_columns = (attributes->dataWindow.right - attributes->dataWindow.left) + 1;
-   unsigned char num_rows = 1;
-   unsigned char *compressed_buffer = NULL;
-   unsigned char *uncompressed_buffer = NULL;
-   unsigned char *unfiltered_buffer = NULL;
-  
-   unsigned short channel_data_width = attributes->channel_list.data_width;
+   const unsigned char *in = compressed;
+   const unsigned char *in_end = compressed + compressed_length;
+   unsigned int start[EXR_MAX_CHANNELS];
+   unsigned int total = 0;
+   unsigned int channel, row, index, j;
+
+   // ---- planar layout of every channel in the wavelet buffer
+   for( channel = 0; channel < channel_list->total_channels; channel++ ) {
+      start[channel] = total;
+      total += num_columns * num_rows * (channel_list->width[channel] / 2);
+   }
+
+   if( compressed_length < 4 )
+      return OPENDCP_ERROR;
+
+   unsigned short min_non_zero = in[0] | in[1] << 8;
+   unsigned short max_non_zero = in[2] | in[3] << 8;
+   in += 4;
 
-   unsigned int uncompressed_data_length = num_columns*channel_data_width;
+   if( max_non_zero >= BITMAP_SIZE )
+      return OPENDCP_ERROR;
 
-   // ---- check if use ZIP
-   if( attributes->compression == EXR_COMPRESSION_ZIP ) {
-       uncompressed_data_length <<= 4;  // multiply 16
-       num_rows = 16;
+   memset( piz->bitmap, 0, BITMAP_SIZE );
+
+   if( min_non_zero <= max_non_zero ) {
+      if( (unsigned int)(in_end - in) < (unsigned int)(max_non_zero - min_non_zero + 1) )
+         return OPENDCP_ERROR;
+      memcpy( piz->bitmap + min_non_zero, in, max_non_zero - min_non_zero + 1 );
+      in += max_non_zero - min_non_zero + 1;
    }
 
-   compressed_buffer = malloc( uncompressed_data_length << 1 );
-   uncompressed_buffer = malloc( uncompressed_data_length );
-   unfiltered_buffer = malloc( uncompressed_data_length ); 
+   unsigned short max_value = piz_reverse_lut( piz->bitmap, piz->lut );
+
+   if( in_end - in < 4 )
+      return OPENDCP_ERROR;
 
-   unsigned short chunk_number = 0;
-   while( chunk_number < chunk_data->num_chunks ) {
-      // ---- begin chunk
-      fseek( exr_fp, chunk_data->chunk_table[chunk_number], SEEK_SET );
+   unsigned int length = read_le32( in );
+   in += 4;
 
-      // ---- read row number
-      unsigned int row_number = 0;
-      fread( &row_number, 4, 1, exr_fp );
+   if( length > (unsigned int)(in_end - in) )
+      return OPENDCP_ERROR;
 
-      // ---- read data length
-      unsigned int data_length = 0; 
-      fread( &data_length, 4, 1, exr_fp );
+   if( huf_uncompress( in, length, piz->tmp, total, piz ) != OPENDCP_NO_ERROR )
+      return OPENDCP_ERROR;
+
+   // ---- wavelet decoding
+   for( channel = 0; channel < channel_list->total_channels; channel++ ) {
+      unsigned int size = channel_list->width[channel] / 2;
+      for( j = 0; j < size; j++ )
+         wav_2d_decode( piz->tmp + start[channel] + j, num_columns, size, num_rows, num_columns * size, max_value );
+   }
 
-      // ---- check if use ZIP and number row remain, only for last chunk
-      if( attributes->compression == EXR_COMPRESSION_ZIP ) {
-         // ---- calculate number row reamin in image, check if have 16 rows for this chunk
-         unsigned short num_rows_remain = image_data->height - row_number;
-         if( num_rows_remain < 16 ) {
-            uncompressed_data_length = (uncompressed_data_length >> 4)*num_rows_remain;
-            num_rows = num_rows_remain;
+   // ---- expand the pixel data to their original range
+   for( index = 0; index < total; index++ )
+      piz->tmp[index] = piz->lut[piz->tmp[index]];
+
+   // ---- rearrange the pixel data into scanlines, little endian
+   for( row = 0; row < num_rows; row++ ) {
+      for( channel = 0; channel < channel_list->total_channels; channel++ ) {
+         unsigned int n = num_columns * (channel_list->width[channel] / 2);
+         unsigned short *src = piz->tmp + start[channel] + row * n;
+         for( index = 0; index < n; index++ ) {
+            *uncompressed++ = src[index] & 0xff;
+            *uncompressed++ = src[index] >> 8;
          }
       }
+   }
 
-      // ---- read compressed data
-      fread( compressed_buffer, 1, data_length, exr_fp );
+   return OPENDCP_NO_ERROR;
+}
 
-      // ---- uncompress zip
-      uncompress_zip( compressed_buffer, data_length, uncompressed_buffer, uncompressed_data_length );
-      
-      // ---- unfilter data
+
+/* ---- Read Chunks */
+/* shared state for decoding the chunks of one image */
+typedef struct {
+   const unsigned char *data;        /* mapped file     */
+   size_t size;                      /* file size       */
+   exr_chunk_data *chunk_data;
+   exr_attributes *attributes;
+   opendcp_image_t *image;
+   unsigned int num_columns;
+   unsigned int height;
+   unsigned int chunk_rows;
+} exr_decode;
+
+/* range of chunks decoded by one thread */
+typedef struct {
+   exr_decode *decode;
+   unsigned int start;
+   unsigned int end;
+   int result;
+} exr_band;
+
+/* opendcp component of an exr channel, images are stored R, G, B */
+static int channel_component( exr_channel *channel ) {
+
+   if( !strcmp( channel->name, "R" ) )
+      return 0;
+   else if( !strcmp( channel->name, "G" ) )
+      return 1;
+
+   return 2;
+}
+
+/* decode one chunk straight from the mapped file */
+static int decode_chunk( exr_decode *decode, unsigned int chunk_number, unsigned char *uncompressed_buffer, unsigned char *unfiltered_buffer, exr_piz *piz ) {
+
+   exr_attributes *attributes = decode->attributes;
+   unsigned short channel_data_width = attributes->channel_list.data_width;
+   uint64_t offset = decode->chunk_data->chunk_table[chunk_number];
+   const unsigned char *chunk, *data_buffer;
+   unsigned int channel;
+
+   if( offset > decode->size || decode->size - offset < 8 )
+      return OPENDCP_ERROR;
+
+   chunk = decode->data + offset;
+
+   // ---- read row number and data length
+   int row_number = (int)read_le32( chunk ) - attributes->dataWindow.bottom;
+   unsigned int data_length = read_le32( chunk + 4 );
+
+   if( row_number < 0 || (unsigned int)row_number >= decode->height || data_length > decode->size - offset - 8 )
+      return OPENDCP_ERROR;
+
+   // ---- the last chunk may have fewer rows
+   unsigned int num_rows = decode->height - row_number;
+   if( num_rows > decode->chunk_rows )
+      num_rows = decode->chunk_rows;
+
+   unsigned int uncompressed_data_length = num_rows * decode->num_columns * channel_data_width;
+   unsigned char *compressed_buffer = (unsigned char *)chunk + 8;
+
+   // ---- chunks that would not get smaller are stored uncompressed
+   if( attributes->compression == EXR_COMPRESSION_NO || data_length == uncompressed_data_length ) {
+      if( data_length < uncompressed_data_length )
+         return OPENDCP_ERROR;
+      data_buffer = compressed_buffer;
+   }
+   else if( attributes->compression == EXR_COMPRESSION_RLE ) {
+      uncompress_rle( compressed_buffer, data_length, uncompressed_buffer, uncompressed_data_length );
       unfilter_buffer( uncompressed_buffer, unfiltered_buffer, uncompressed_data_length );
+      data_buffer = unfiltered_buffer;
+   }
+   else if( attributes->compression == EXR_COMPRESSION_PIZ ) {
+      if( piz_uncompress( compressed_buffer, data_length, unfiltered_buffer, num_rows, decode->num_columns, &attributes->channel_list, piz ) != OPENDCP_NO_ERROR )
+         return OPENDCP_ERROR;
+      data_buffer = unfiltered_buffer;
+   }
+   else {
+      if( uncompress_zip( compressed_buffer, data_length, uncompressed_buffer, uncompressed_data_length ) != OPENDCP_NO_ERROR )
+         return OPENDCP_ERROR;
+      unfilter_buffer( uncompressed_buffer, unfiltered_buffer, uncompressed_data_length );
+      data_buffer = unfiltered_buffer;
+   }
 
-      // ---- copy data from buffer
-      if( attributes->channel_list.channel[0].data_type == EXR_HALF )
-         copy_half_data( unfiltered_buffer, image_data->channel_b, num_rows, num_columns, row_number, &(attributes->channel_list.channel[0]) );
-      else
-         copy_float_data( unfiltered_buffer, image_data->channel_b, num_rows, num_columns, row_number, &(attributes->channel_list.channel[0]) );
+   // ---- copy data from buffer
+   for( channel = 0; channel < 3; channel++ ) {
+      exr_channel *c = &(attributes->channel_list.channel[channel]);
+      float *channel_data = decode->image->component[channel_component( c )].float_data;
 
-      if( attributes->channel_list.channel[1].data_type == EXR_HALF )
-         copy_half_data( unfiltered_buffer, image_data->channel_g, num_rows, num_columns, row_number, &(attributes->channel_list.channel[1]) );
+      if( c->data_type == EXR_HALF )
+         copy_half_data( (unsigned char *)data_buffer, channel_data, num_rows, decode->num_columns, row_number, channel_data_width, c );
       else
-         copy_float_data( unfiltered_buffer, image_data->channel_g, num_rows, num_columns, row_number, &(attributes->channel_list.channel[1]) );
+         copy_float_data( (unsigned char *)data_buffer, channel_data, num_rows, decode->num_columns, row_number, channel_data_width, c );
+   }
 
-      if( attributes->channel_list.channel[2].data_type == EXR_HALF )
-         copy_half_data( unfiltered_buffer, image_data->channel_r, num_rows, num_columns, row_number, &(attributes->channel_list.channel[2]) );
-      else
-         copy_float_data( unfiltered_buffer, image_data->channel_r, num_rows, num_columns, row_number, &(attributes->channel_list.channel[2]) );
+   return OPENDCP_NO_ERROR;
+}
 
-      // ---- next chunk
-      chunk_number++;
+static void *decode_band( void *arg ) {
+
+   exr_band *band = (exr_band *)arg;
+   exr_decode *decode = band->decode;
+   unsigned int chunk_length = decode->chunk_rows * decode->num_columns * decode->attributes->channel_list.data_width;
+   unsigned char *uncompressed_buffer = malloc( chunk_length );
+   unsigned char *unfiltered_buffer = malloc( chunk_length );
+   exr_piz piz;
+   unsigned int chunk_number;
+
+   memset( &piz, 0, sizeof( piz ) );
+   band->result = OPENDCP_ERROR;
+
+   if( decode->attributes->compression == EXR_COMPRESSION_PIZ ) {
+      piz.freq = malloc( HUF_ENCSIZE * sizeof( uint64_t ) );
+      piz.hdec = calloc( HUF_DECSIZE, sizeof( huf_dec ) );
+      piz.lut = malloc( USHORT_RANGE * sizeof( unsigned short ) );
+      piz.bitmap = malloc( BITMAP_SIZE );
+      piz.tmp = malloc( chunk_length );
+   }
+
+   if( uncompressed_buffer && unfiltered_buffer &&
+       (decode->attributes->compression != EXR_COMPRESSION_PIZ || (piz.freq && piz.hdec && piz.lut && piz.bitmap && piz.tmp)) ) {
+      band->result = OPENDCP_NO_ERROR;
+
+      for( chunk_number = band->start; chunk_number < band->end; chunk_number++ ) {
+         if( decode_chunk( decode, chunk_number, uncompressed_buffer, unfiltered_buffer, &piz ) != OPENDCP_NO_ERROR ) {
+            OPENDCP_LOG(LOG_ERROR,"failed to decode exr chunk %d", chunk_number);
+            band->result = OPENDCP_ERROR;
+            break;
+         }
+      }
    }
 
    // ---- free memory
-   free( compressed_buffer );
    free( uncompressed_buffer );
    free( unfiltered_buffer );
+   free( piz.freq );
+   free( piz.hdec );
+   free( piz.lut );
+   free( piz.bitmap );
+   free( piz.tmp );
+
+   return NULL;
 }
 
+/* chunks are independent, decode them in bands on the thread pool */
+static int decode_chunks( exr_decode *decode ) {
+
+   exr_band band[EXR_THREADS];
+   unsigned int num_chunks = decode->chunk_data->num_chunks;
+   int i, n;
+   int result = OPENDCP_NO_ERROR;
+
+   n = num_chunks < EXR_THREADS ? (int)num_chunks : EXR_THREADS;
+
+   for( i = 0; i < n; i++ ) {
+      band[i].decode = decode;
+      band[i].start = num_chunks * i / n;
+      band[i].end = num_chunks * (i + 1) / n;
+   }
 
-#pragma mark ---- Read EXR File
+   opendcp_pool_run( decode_band, band, sizeof( exr_band ), n, POOL_PRIORITY_NORMAL );
+
+   for( i = 0; i < n; i++ ) {
+      if( band[i].result != OPENDCP_NO_ERROR )
+         result = OPENDCP_ERROR;
+   }
+
+   return result;
+}
+
+
+/* ---- Read EXR File */
 /* decode exr file */
 int opendcp_decode_exr(opendcp_image_t **image_ptr, const char *sfile) {
 
    FILE *exr_fp;
+   const opendcp_decoder_input_t *input;
+   opendcp_image_t *image = NULL;
+   opendcp_file_map_t map;
+   exr_decode decode;
+   int result;
     
    /* open exr using filename or file descriptor */
    OPENDCP_LOG(LOG_DEBUG,"%-15.15s: opening exr file %s","read_exr",sfile);
 
-   exr_fp = fopen(sfile, "rb");
+   input = opendcp_decoder_input_get(sfile);
+
+#ifndef _WIN32
+   exr_fp = input ? fmemopen((void *)input->data, input->size, "rb") : fopen(sfile, "rb");
+#else
+   exr_fp = input ? NULL : fopen(sfile, "rb");
+#endif
     
    if (!exr_fp) {
       OPENDCP_LOG(LOG_ERROR,"%-15.15s: opening exr file %s","read_bmp",sfile);
@@ -785,9 +1340,10 @@ int opendcp_decode_exr(opendcp_image_t **image_ptr, const char *sfile) {
    magicNumber |= fgetc(exr_fp) << 8;
    magicNumber |= fgetc(exr_fp);
     
-   if (readsize != MAGIC_NUMBER_EXR ) {
+   if (magicNumber != MAGIC_NUMBER_EXR ) {
       OPENDCP_LOG(LOG_ERROR,"%-15.15s: failed to read magic number expected 0x%08x read 0x%08x","read_exr", MAGIC_NUMBER_EXR, magicNumber );
       OPENDCP_LOG(LOG_ERROR,"%s is not a valid EXR file", sfile);
+      fclose(exr_fp);
       return OPENDCP_FATAL;
    }
    
@@ -795,77 +1351,89 @@ int opendcp_decode_exr(opendcp_image_t **image_ptr, const char *sfile) {
    unsigned char version = fgetc(exr_fp);
    if( version != 2 ) {
      OPENDCP_LOG(LOG_ERROR,"Only support exr file version 2, this file version %d", version);
+     fclose(exr_fp);
      return OPENDCP_FATAL;
    }
 
    // ---- file type: normal, deep pixel, multipart (only support normal)
    unsigned char type = fgetc(exr_fp);
-   if( type & 0x1a != 0x00 ) {
+   if( (type & 0x1a) != 0x00 ) {
       OPENDCP_LOG(LOG_ERROR,"Only support normal scanline exr file, no tile, deep pixel, multipart file");
-     return OPENDCP_FATAL;
+      fclose(exr_fp);
+      return OPENDCP_FATAL;
    }
    
    // ---- skip two bytes, not used
    fgetc(exr_fp);
    fgetc(exr_fp);
 
-   // ---- read EXR attritubes need for dcp
-   exr_attributes attritbute = read_attributes( exr_fp );
+   // ---- read EXR attributes need for dcp
+   exr_attributes attributes = read_attributes( exr_fp );
    
    // ---- check compression
-   if( attributes.compression > EXR_COMPRESSION_ZIP ) {
-      OPENDCP_LOG(LOG_ERROR,"Only support NO, RLE, ZIPS, ZIP compression in exr file");
+   if( attributes.compression > EXR_COMPRESSION_PIZ ) {
+      OPENDCP_LOG(LOG_ERROR,"Only support NO, RLE, ZIPS, ZIP, PIZ compression in exr file");
+      fclose(exr_fp);
+      return OPENDCP_FATAL;
+   }
+
+   if( attributes.compression == EXR_COMPRESSION_PIZ && attributes.channel_list.total_channels > EXR_MAX_CHANNELS ) {
+      OPENDCP_LOG(LOG_ERROR,"PIZ compressed exr file has more than %d channels", EXR_MAX_CHANNELS);
+      fclose(exr_fp);
       return OPENDCP_FATAL;
    }
     
    // ---- check number channels, need all B, G, R channels
     if( attributes.channel_list.num_channels != 3 ) {
       OPENDCP_LOG(LOG_ERROR,"Exr file not have all B, G, R channels");
+      fclose(exr_fp);
       return OPENDCP_FATAL;
    }
    
    // ---- read offset table
    exr_chunk_data chunk_data = read_chunk_data( exr_fp, &attributes );
 
-    // ---- for store image data
-   exr_image_data image_data;
-   image_data.width = attributes.dataWindow.right - attributes.dataWindow.left + 1;
-   image_data.height = attributes.dataWindow.top - attributes.dataWindow.bottom + 1;
-   // ---- create buffers for image data
-   image_data.channel_b = malloc( image_data.width*image_data.height * sizeof( float ) );
-   image_data.channel_g = malloc( image_data.width*image_data.height * sizeof( float ) );
-   image_data.channel_r = malloc( image_data.width*image_data.height * sizeof( float ) );
- 
-   // ---- read file data
-   if( attributes.compression == EXR_COMPRESSION_NO )
-      read_data_compression_no( exr_fp, &chunk_data, &attributes, &image_data );
-   else if( attributes.compression == EXR_COMPRESSION_RLE )
-      read_data_compression_rle( exr_fp, &chunk_data, &attributes, &image_data );
-   else if( (attributes.compression == EXR_COMPRESSION_ZIPS) || (attributes.compression == EXR_COMPRESSION_ZIP) )
-      read_data_compression_zip( exr_fp , &chunk_data, &attributes, &image_data );
-
-   // ---- close file
+   // ---- close file, the chunks are read from the mapped file
    fclose( exr_fp );
- 
-    /* create the image (float data) */
-   image = opendcp_image_create_float(3, image_data.width, mage_data.height);
-  
-   unsigned int image_size = image_data.width * mage_data.height;
-   for (index = 0; index < image_size; index++) {
-    // ---- need copy float data from exr image data to float opendcp image data
-      // ----- correct channel order?
-      image->component[0].float_data[index] = image_data.channel_b[index];
-      image->component[1].float_data[index] = image_data.channel_g[index];
-      image->component[2].float_data[index] = image_data.channel_r[index];
+
+   if( opendcp_file_map( &map, sfile ) != OPENDCP_NO_ERROR ) {
+      OPENDCP_LOG(LOG_ERROR,"%-15.15s: failed to map exr file %s","read_exr",sfile);
+      free( chunk_data.chunk_table );
+      return OPENDCP_FATAL;
+   }
+
+   /* create the image (float data) */
+   decode.num_columns = attributes.dataWindow.right - attributes.dataWindow.left + 1;
+   decode.height = attributes.dataWindow.top - attributes.dataWindow.bottom + 1;
+   image = opendcp_image_create_float(3, decode.num_columns, decode.height);
+
+   if (!image) {
+      OPENDCP_LOG(LOG_ERROR,"%-15.15s: failed to create image %s","read_exr",sfile);
+      opendcp_file_unmap( &map );
+      free( chunk_data.chunk_table );
+      return OPENDCP_FATAL;
    }
+
+   // ---- read file data
+   decode.data = map.data;
+   decode.size = map.size;
+   decode.chunk_data = &chunk_data;
+   decode.attributes = &attributes;
+   decode.image = image;
+   decode.chunk_rows = rows_per_chunk( attributes.compression );
+
+   result = decode_chunks( &decode );
+
+   opendcp_file_unmap( &map );
  
    // ---- free chunk table
    free( chunk_data.chunk_table );
- 
-   // ---- free exr image data
-   free( image_data.channel_b );
-   free( image_data.channel_g );
-   free( image_data.channel_r );
+
+   if( result != OPENDCP_NO_ERROR ) {
+      OPENDCP_LOG(LOG_ERROR,"%-15.15s: failed to decode exr image %s","read_exr",sfile);
+      opendcp_image_free( image );
+      return OPENDCP_FATAL;
+   }
 
    OPENDCP_LOG(LOG_DEBUG,"done reading exr image");
    *image_ptr = image;
@@ -24,6 +24,7 @@
 #include <openjpeg.h>
 #include "opendcp.h"
 #include "opendcp_image.h"
+#include "opendcp_decoder.h"
 
 #define JP2_MAGIC_NUMBER 0x0A870A0D
 #define J2K_MAGIC_NUMBER 0x51FF4FFF
@@ -60,17 +61,25 @@ int fill_j2k_image(opj_image_t *opj_image, j2k_image_t *j2k_image) {
 int detect_format(const char *sfile) {
     FILE *fp;
     j2k_header_t     j2k;
+    const opendcp_decoder_input_t *input = opendcp_decoder_input_get(sfile);
 
-    fp = fopen(sfile, "rb");
+    memset(&j2k, 0, sizeof(j2k));
 
-    if (!fp) {
-        OPENDCP_LOG(LOG_DEBUG,"failed to open %s for reading", sfile);
-        return OPENDCP_ERROR;
+    if (input) {
+        memcpy(&j2k, input->data, input->size < sizeof(j2k) ? input->size : sizeof(j2k));
+    } else {
+        fp = fopen(sfile, "rb");
+
+        if (!fp) {
+            OPENDCP_LOG(LOG_DEBUG,"failed to open %s for reading", sfile);
+            return OPENDCP_ERROR;
+        }
+
+        fread(&j2k, sizeof(j2k_header_t), 1, fp);
+        fclose(fp);
     }
 
-    fread(&j2k, sizeof(j2k_header_t), 1, fp);
     OPENDCP_LOG(LOG_DEBUG,"reading file header %s", sfile);
-    fclose(fp);
 
     OPENDCP_LOG(LOG_DEBUG,"magic_number %d (0x%x)", j2k.magic_num, j2k.magic_num);
 
@@ -83,24 +92,124 @@ int detect_format(const char *sfile) {
     return -1;
 }
 
-/*!
- @function opendcp_decode_openjpeg
- @abstract Read an image file and populates an opendcp_image_t structure.
- @discussion This function will read and decode a file and place the
-     decoded image in an opendcp_image_t struct.
- @param image_ptr Pointer to the destination opendcp_image_t struct.
- @param sfile The name if the source image file.
- @return OPENDCP_ERROR value
-*/
-int opendcp_decode_openjpeg(opendcp_image_t **image_ptr, const char *sfile) {
-    opj_stream_t      *l_stream = NULL; 
-    opj_codec_t       *l_codec = NULL;
-    opj_image_t       *opj_image = NULL;
-    opendcp_image_t   *image = 00;
+/* create a codec and read the codestream header from a stream, it is destroyed on failure */
+static int j2k_open_stream(opj_stream_t *stream, int format, int reduce, const char *name, opj_codec_t **codec, opj_image_t **opj_image) {
     opj_dparameters_t parameters;
-    j2k_image_t       j2k;
-    int               index, result;
+    int               result;
+
+    opj_set_default_decoder_parameters(&parameters);
+    parameters.cp_reduce = reduce;
+
+    *opj_image = NULL;
+
+    *codec = opj_create_decompress(format);
+    if (!*codec) {
+        OPENDCP_LOG(LOG_ERROR,"failed to create decoder");
+        opj_stream_destroy(stream);
+        return OPENDCP_ERROR;
+    }
+
+    result = opj_setup_decoder(*codec, &parameters);
+    if (!result) {
+        OPENDCP_LOG(LOG_ERROR,"could setup decoder %s", name);
+        opj_stream_destroy(stream);
+        opj_destroy_codec(*codec);
+        return OPENDCP_ERROR;
+    }
+
+    result = opj_read_header(stream, *codec, opj_image);
+    if (!result) {
+        OPENDCP_LOG(LOG_ERROR,"failed to read header %s", name);
+        opj_stream_destroy(stream);
+        opj_destroy_codec(*codec);
+        opj_image_destroy(*opj_image);
+        return OPENDCP_ERROR;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* a codestream held in memory, read through an opj stream */
+typedef struct {
+    const unsigned char *data;
+    OPJ_SIZE_T          length;
+    OPJ_SIZE_T          offset;
+} j2k_memory_t;
 
+static OPJ_SIZE_T j2k_memory_read(void *buffer, OPJ_SIZE_T size, void *user) {
+    j2k_memory_t *m = user;
+
+    if (m->offset >= m->length) {
+        return (OPJ_SIZE_T)-1;
+    }
+
+    if (size > m->length - m->offset) {
+        size = m->length - m->offset;
+    }
+
+    memcpy(buffer, m->data + m->offset, size);
+    m->offset += size;
+
+    return size;
+}
+
+static OPJ_OFF_T j2k_memory_skip(OPJ_OFF_T size, void *user) {
+    j2k_memory_t *m = user;
+
+    if (size < 0 && (OPJ_SIZE_T)-size > m->offset) {
+        size = -(OPJ_OFF_T)m->offset;
+    } else if (size > 0 && (OPJ_SIZE_T)size > m->length - m->offset) {
+        size = m->length - m->offset;
+    }
+
+    m->offset += size;
+
+    return size;
+}
+
+static OPJ_BOOL j2k_memory_seek(OPJ_OFF_T offset, void *user) {
+    j2k_memory_t *m = user;
+
+    if (offset < 0 || (OPJ_SIZE_T)offset > m->length) {
+        return OPJ_FALSE;
+    }
+
+    m->offset = offset;
+
+    return OPJ_TRUE;
+}
+
+/* a stream over a codestream in memory, the position is freed with the stream */
+static opj_stream_t *j2k_memory_stream(const unsigned char *data, size_t length) {
+    opj_stream_t *stream;
+    j2k_memory_t *m;
+
+    if (!(m = malloc(sizeof(*m)))) {
+        return NULL;
+    }
+
+    m->data   = data;
+    m->length = length;
+    m->offset = 0;
+
+    stream = opj_stream_create(OPJ_J2K_STREAM_CHUNK_SIZE, 1);
+    if (!stream) {
+        free(m);
+        return NULL;
+    }
+
+    opj_stream_set_user_data(stream, m, free);
+    opj_stream_set_user_data_length(stream, length);
+    opj_stream_set_read_function(stream, j2k_memory_read);
+    opj_stream_set_skip_function(stream, j2k_memory_skip);
+    opj_stream_set_seek_function(stream, j2k_memory_seek);
+
+    return stream;
+}
+
+/* create a codec and read the codestream header, nothing is allocated on failure */
+static int j2k_open(const char *sfile, int reduce, opj_stream_t **stream, opj_codec_t **codec, opj_image_t **opj_image) {
+    const opendcp_decoder_input_t *input;
     int format = detect_format(sfile);
 
     if (format < 0) {
@@ -108,63 +217,120 @@ int opendcp_decode_openjpeg(opendcp_image_t **image_ptr, const char *sfile) {
         return OPENDCP_ERROR;
     }
 
-    opj_set_default_decoder_parameters(&parameters);
+    input = opendcp_decoder_input_get(sfile);
 
-    l_stream = opj_stream_create_default_file_stream(sfile,1);
-    if (!l_stream) {
+    if (input) {
+        *stream = j2k_memory_stream(input->data, input->size);
+    } else {
+        *stream = opj_stream_create_default_file_stream(sfile,1);
+    }
+
+    if (!*stream) {
         OPENDCP_LOG(LOG_ERROR,"could not create input file stream %s", sfile);
         return OPENDCP_ERROR;
     }
 
+    return j2k_open_stream(*stream, format, reduce, sfile, codec, opj_image);
+}
 
-    l_codec = opj_create_decompress(format);
-    if (!l_codec) {
-        OPENDCP_LOG(LOG_ERROR,"failed to create decoder");
-        opj_stream_destroy(l_stream);
+static void j2k_close(opj_stream_t *stream, opj_codec_t *codec, opj_image_t *opj_image) {
+    opj_stream_destroy(stream);
+    opj_destroy_codec(codec);
+    opj_image_destroy(opj_image);
+}
+
+/*!
+ @function opendcp_openjpeg_info
+ @abstract Read the dimensions of a JPEG2000 file without decoding it.
+ @discussion Only the main header is parsed, which lets callers pick a
+     reduction level before decoding.
+ @param sfile The name if the source image file.
+ @param w Receives the full resolution width.
+ @param h Receives the full resolution height.
+ @param resolutions Receives the number of resolution levels, may be NULL.
+ @return OPENDCP_ERROR value
+*/
+int opendcp_openjpeg_info(const char *sfile, int *w, int *h, int *resolutions) {
+    opj_stream_t *l_stream;
+    opj_codec_t  *l_codec;
+    opj_image_t  *opj_image;
+
+    if (j2k_open(sfile, 0, &l_stream, &l_codec, &opj_image) != OPENDCP_NO_ERROR) {
         return OPENDCP_ERROR;
     }
 
-    result = opj_setup_decoder(l_codec, &parameters);
-    if (!result) {
-        OPENDCP_LOG(LOG_ERROR,"could setup decoder %s", sfile);
-        opj_stream_destroy(l_stream);
-        opj_destroy_codec(l_codec);
-        return OPENDCP_ERROR;
+    *w = opj_image->x1 - opj_image->x0;
+    *h = opj_image->y1 - opj_image->y0;
+
+    if (resolutions) {
+        opj_codestream_info_v2_t *info = opj_get_cstr_info(l_codec);
+
+        *resolutions = 1;
+        if (info) {
+            if (info->m_default_tile_info.tccp_info) {
+                *resolutions = info->m_default_tile_info.tccp_info[0].numresolutions;
+            }
+            opj_destroy_cstr_info(&info);
+        }
     }
-  
-    result = opj_read_header(l_stream, l_codec, &opj_image);
-    if (!result) {
-        OPENDCP_LOG(LOG_ERROR,"failed to read header %s", sfile);
-        opj_stream_destroy(l_stream);
-        opj_destroy_codec(l_codec);
-        opj_image_destroy(opj_image);
-        return OPENDCP_ERROR;
+
+    j2k_close(l_stream, l_codec, opj_image);
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* decode an opened codestream into a 12 bit opendcp image, the codec and stream are closed */
+static int j2k_decode(opj_stream_t *l_stream, opj_codec_t *l_codec, opj_image_t *opj_image, const char *sfile,
+                      int x0, int y0, int x1, int y1, opendcp_image_t **image_ptr) {
+    opendcp_image_t   *image = 00;
+    j2k_image_t       j2k;
+    int               index, result;
+
+    if (x0 || y0 || x1 || y1) {
+        if (!x1) {
+            x1 = opj_image->x1;
+        }
+        if (!y1) {
+            y1 = opj_image->y1;
+        }
+        if (!opj_set_decode_area(l_codec, opj_image, x0, y0, x1, y1)) {
+            OPENDCP_LOG(LOG_ERROR,"invalid decode area %d,%d %d,%d %s", x0, y0, x1, y1, sfile);
+            j2k_close(l_stream, l_codec, opj_image);
+            return OPENDCP_ERROR;
+        }
     }
 
     result = opj_decode(l_codec, l_stream, opj_image);
     if (!result) {
         OPENDCP_LOG(LOG_ERROR,"failed decode %s", sfile);
-        opj_stream_destroy(l_stream);
-        opj_destroy_codec(l_codec);
-        opj_image_destroy(opj_image);
+        j2k_close(l_stream, l_codec, opj_image);
         return OPENDCP_ERROR;
     }
 
     result = opj_end_decompress(l_codec, l_stream);
     if (!result) {
         OPENDCP_LOG(LOG_ERROR,"failed close decompressor  %s", sfile);
-        opj_stream_destroy(l_stream);
-        opj_destroy_codec(l_codec);
-        opj_image_destroy(opj_image);
+        j2k_close(l_stream, l_codec, opj_image);
+        return OPENDCP_ERROR;
+    }
+
+    if (opj_image->numcomps < 3) {
+        OPENDCP_LOG(LOG_ERROR,"%d component images are not supported %s", opj_image->numcomps, sfile);
+        j2k_close(l_stream, l_codec, opj_image);
         return OPENDCP_ERROR;
     }
 
     fill_j2k_image(opj_image, &j2k);
 
     /* create the image */
-    OPENDCP_LOG(LOG_DEBUG,"allocating opendcp image %d bits", j2k.bps);
+    OPENDCP_LOG(LOG_DEBUG,"allocating opendcp image %d bits %dx%d", j2k.bps, j2k.w, j2k.h);
     image = opendcp_image_create(3, j2k.w, j2k.h);
 
+    if (!image) {
+        j2k_close(l_stream, l_codec, opj_image);
+        return OPENDCP_ERROR;
+    }
+
     for (index = 0; index < j2k.size; index++) {
         switch (j2k.bps) {
             case 8:
@@ -186,11 +352,100 @@ int opendcp_decode_openjpeg(opendcp_image_t **image_ptr, const char *sfile) {
     }
 
     OPENDCP_LOG(LOG_DEBUG,"done reading image");
-    opj_stream_destroy(l_stream);
-    opj_destroy_codec(l_codec);
-    opj_image_destroy(opj_image);
+    j2k_close(l_stream, l_codec, opj_image);
 
     *image_ptr = image;
 
     return OPENDCP_NO_ERROR;
 }
+
+/*!
+ @function opendcp_decode_openjpeg_reduced
+ @abstract Read part of a JPEG2000 file, optionally at a lower resolution.
+ @discussion Only the requested resolution levels and region are decoded,
+     the resulting image is the size of the region divided by 2^reduce.
+ @param image_ptr Pointer to the destination opendcp_image_t struct.
+ @param sfile The name if the source image file.
+ @param reduce Number of highest resolution levels to discard.
+ @param x0 Left edge of the region in full resolution coordinates.
+ @param y0 Top edge of the region in full resolution coordinates.
+ @param x1 Right edge of the region, 0 decodes to the image edge.
+ @param y1 Bottom edge of the region, 0 decodes to the image edge.
+ @return OPENDCP_ERROR value
+*/
+int opendcp_decode_openjpeg_reduced(opendcp_image_t **image_ptr, const char *sfile, int reduce, int x0, int y0, int x1, int y1) {
+    opj_stream_t      *l_stream = NULL;
+    opj_codec_t       *l_codec = NULL;
+    opj_image_t       *opj_image = NULL;
+
+    if (j2k_open(sfile, reduce, &l_stream, &l_codec, &opj_image) != OPENDCP_NO_ERROR) {
+        return OPENDCP_ERROR;
+    }
+
+    return j2k_decode(l_stream, l_codec, opj_image, sfile, x0, y0, x1, y1, image_ptr);
+}
+
+/*!
+ @function opendcp_decode_openjpeg_buffer
+ @abstract Decode a JPEG2000 codestream held in memory.
+ @discussion Used for frames read from an MXF, which need not be written
+     out first. Each call creates its own codec, so threads may decode
+     frames concurrently.
+ @param image_ptr Pointer to the destination opendcp_image_t struct.
+ @param data The codestream.
+ @param length The length of the codestream in bytes.
+ @param reduce Number of highest resolution levels to discard.
+ @return OPENDCP_ERROR value
+*/
+int opendcp_decode_openjpeg_buffer(opendcp_image_t **image_ptr, const unsigned char *data, int length, int reduce) {
+    opj_stream_t *l_stream;
+    opj_codec_t  *l_codec = NULL;
+    opj_image_t  *opj_image = NULL;
+    j2k_memory_t memory;
+    int          format = OPJ_CODEC_JP2;
+
+    if (length < 4) {
+        OPENDCP_LOG(LOG_ERROR,"codestream of %d bytes is too short", length);
+        return OPENDCP_ERROR;
+    }
+
+    /* the SOC and SIZ markers start a raw codestream */
+    if (data[0] == 0xff && data[1] == 0x4f && data[2] == 0xff && data[3] == 0x51) {
+        format = OPJ_CODEC_J2K;
+    }
+
+    memory.data   = data;
+    memory.length = length;
+    memory.offset = 0;
+
+    l_stream = opj_stream_create(OPJ_J2K_STREAM_CHUNK_SIZE, 1);
+    if (!l_stream) {
+        OPENDCP_LOG(LOG_ERROR,"could not create input memory stream");
+        return OPENDCP_ERROR;
+    }
+
+    opj_stream_set_user_data(l_stream, &memory, NULL);
+    opj_stream_set_user_data_length(l_stream, length);
+    opj_stream_set_read_function(l_stream, j2k_memory_read);
+    opj_stream_set_skip_function(l_stream, j2k_memory_skip);
+    opj_stream_set_seek_function(l_stream, j2k_memory_seek);
+
+    if (j2k_open_stream(l_stream, format, reduce, "memory", &l_codec, &opj_image) != OPENDCP_NO_ERROR) {
+        return OPENDCP_ERROR;
+    }
+
+    return j2k_decode(l_stream, l_codec, opj_image, "memory", 0, 0, 0, 0, image_ptr);
+}
+
+/*!
+ @function opendcp_decode_openjpeg
+ @abstract Read an image file and populates an opendcp_image_t structure.
+ @discussion This function will read and decode a file and place the
+     decoded image in an opendcp_image_t struct.
+ @param image_ptr Pointer to the destination opendcp_image_t struct.
+ @param sfile The name if the source image file.
+ @return OPENDCP_ERROR value
+*/
+int opendcp_decode_openjpeg(opendcp_image_t **image_ptr, const char *sfile) {
+    return opendcp_decode_openjpeg_reduced(image_ptr, sfile, 0, 0, 0, 0, 0);
+}
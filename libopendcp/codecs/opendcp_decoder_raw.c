@@ -0,0 +1,122 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2013 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "opendcp.h"
+#include "opendcp_image.h"
+#include "opendcp_decoder.h"
+#include "opendcp_raw.h"
+
+/* rows widened before the band is reported */
+#define RAW_BAND 64
+
+/*!
+ @function opendcp_decode_raw
+ @abstract Reads a raw planar intermediate frame into an opendcp_image_t.
+ @discussion The file is mapped and the planes are widened to int samples.
+     Frames flagged as xyz are marked as color converted, so the rgb->xyz
+     conversion is not applied again, other frames are reported in bands.
+ @param image_ptr Pointer to the destination opendcp_image_t struct.
+ @param sfile The name if the source image file.
+ @return OPENDCP_ERROR value
+*/
+int opendcp_decode_raw(opendcp_image_t **image_ptr, const char *sfile) {
+    opendcp_raw_header_t   header;
+    opendcp_file_map_t     map;
+    opendcp_image_t        *image;
+    opendcp_decoder_band_t *band = opendcp_decoder_band_get();
+    const uint8_t          *src;
+    size_t                 i, start, end, samples;
+    int                    c, y0, y1, shift = 0;
+
+    OPENDCP_LOG(LOG_DEBUG, "raw decode begin");
+
+    if (opendcp_file_map(&map, sfile) != OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_ERROR, "Failed to open %s for reading", sfile);
+        return OPENDCP_ERROR;
+    }
+
+    if (!opendcp_raw_header_read(&header, map.data, map.size)) {
+        OPENDCP_LOG(LOG_ERROR, "%s is not a raw frame", sfile);
+        opendcp_file_unmap(&map);
+        return OPENDCP_ERROR;
+    }
+
+    samples = (size_t)header.w * header.h;
+
+    if (header.w == 0 || header.h == 0 || header.w > 65536 || header.h > 65536 || header.components != 3 ||
+        (header.precision != 12 && header.precision != 16) || header.plane_size < samples * 2 ||
+        header.header_size > map.size || (map.size - header.header_size) / 3 < header.plane_size) {
+        OPENDCP_LOG(LOG_ERROR, "%s is truncated or has an invalid image size", sfile);
+        opendcp_file_unmap(&map);
+        return OPENDCP_ERROR;
+    }
+
+    image = opendcp_image_create(3, header.w, header.h);
+
+    if (!image) {
+        opendcp_file_unmap(&map);
+        return OPENDCP_ERROR;
+    }
+
+    /* 16-bit samples are kept whole when the caller takes them and converts them itself */
+    if (header.precision == 16) {
+        if (band && band->precision >= 16 && !(header.flags & OPENDCP_RAW_XYZ)) {
+            image->precision = 16;
+            image->bpp       = 16;
+        } else {
+            shift = 4;
+        }
+    }
+
+    src = map.data + header.header_size;
+
+    for (y0 = 0; y0 < image->h; y0 = y1) {
+        y1    = y0 + RAW_BAND < image->h ? y0 + RAW_BAND : image->h;
+        start = (size_t)y0 * image->w;
+        end   = (size_t)y1 * image->w;
+
+        for (c = 0; c < 3; c++) {
+            const uint8_t *p = src + c * header.plane_size;
+            int           *d = image->component[c].data;
+
+            for (i = start; i < end; i++) {
+                d[i] = (p[2 * i] | (p[2 * i + 1] << 8)) >> shift;
+            }
+        }
+
+        if (!(header.flags & OPENDCP_RAW_XYZ)) {
+            opendcp_decoder_band(band, image, y0, y1);
+        }
+    }
+
+    /* already converted, the color conversion skips the frame */
+    if (header.flags & OPENDCP_RAW_XYZ) {
+        image->xyz_rows = image->h;
+    }
+
+    opendcp_file_unmap(&map);
+
+    OPENDCP_LOG(LOG_DEBUG, "raw decode done");
+    *image_ptr = image;
+
+    return OPENDCP_NO_ERROR;
+}
@@ -0,0 +1,464 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+#include "opendcp.h"
+#include "opendcp_image.h"
+#include "opendcp_decoder.h"
+
+/*
+   Raw frames read from stdin or a named pipe, so a renderer or ffmpeg can
+   feed the pipeline without writing an image sequence first. A stream is
+   either headerless, interleaved samples of a size given up front, or a
+   yuv4mpeg stream, which carries its size in the header and a FRAME line
+   before each frame. Samples wider than 8 bits are 16-bit little endian
+   words, as ffmpeg writes rgb48le and yuv444p12le.
+
+   The frames are named <label>_<frame>.stream so they pass through the
+   pipeline like files. Reader threads take them strictly in frame order:
+   a thread reads the bytes of its frame under the stream lock, after the
+   thread of the frame before, and widens them outside of it.
+*/
+
+/* rows widened before the band is reported */
+#define STREAM_BAND 64
+
+/* longest yuv4mpeg header or frame line */
+#define STREAM_LINE 1024
+
+typedef struct {
+    int             fd;
+    int             w;
+    int             h;
+    int             bits;
+    int             xyz;          /* the samples are already X'Y'Z' */
+    int             y4m;          /* a FRAME line comes before each frame */
+    int             ycbcr;        /* y4m planes are Y'CbCr, converted with the rec709 matrix */
+    int             full;         /* full range Y'CbCr */
+    size_t          frame_size;
+    unsigned char   peek[9];      /* bytes read to tell a y4m stream apart */
+    int             peeked;
+    int             frame;        /* the next frame of the stream, from 1 */
+    int             end;          /* the stream ended or failed, no more frames */
+    pthread_mutex_t mutex;
+    pthread_cond_t  advanced;
+} stream_t;
+
+static stream_t *stream = NULL;
+
+/* read up to size bytes, less only at the end of the stream */
+static ssize_t stream_read(stream_t *s, unsigned char *buffer, size_t size) {
+    size_t  done = 0;
+    ssize_t n;
+
+    if (s->peeked) {
+        done = (size_t)s->peeked < size ? (size_t)s->peeked : size;
+        memcpy(buffer, s->peek, done);
+        memmove(s->peek, s->peek + done, s->peeked - done);
+        s->peeked -= done;
+    }
+
+    while (done < size) {
+        n = read(s->fd, buffer + done, size - done);
+
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+
+        if (n < 0) {
+            return -1;
+        }
+
+        if (n == 0) {
+            break;
+        }
+
+        done += n;
+    }
+
+    return done;
+}
+
+/* a yuv4mpeg line without its newline, -1 at the end of the stream or if it is too long */
+static int stream_line(stream_t *s, char *line) {
+    int i;
+
+    for (i = 0; i < STREAM_LINE; i++) {
+        if (stream_read(s, (unsigned char *)&line[i], 1) != 1) {
+            return -1;
+        }
+
+        if (line[i] == '\n') {
+            line[i] = '\0';
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+/* the W, H, C and XOPENDCP parameters of a yuv4mpeg header */
+static int stream_y4m_header(stream_t *s, char *header) {
+    char *tag;
+
+    s->y4m   = 1;
+    s->ycbcr = 1;
+    s->bits  = 8;
+
+    for (tag = strtok(header, " "); tag; tag = strtok(NULL, " ")) {
+        if (tag[0] == 'W') {
+            s->w = atoi(tag + 1);
+        } else if (tag[0] == 'H') {
+            s->h = atoi(tag + 1);
+        } else if (tag[0] == 'C') {
+            if (strncmp(tag + 1, "444", 3) || (tag[4] && tag[4] != 'p')) {
+                OPENDCP_LOG(LOG_ERROR, "y4m colorspace %s is not supported, write 4:4:4 frames (yuv444p12le)", tag + 1);
+                return OPENDCP_ERROR;
+            }
+
+            s->bits = tag[4] == 'p' ? atoi(tag + 5) : 8;
+        } else if (!strcmp(tag, "XCOLORRANGE=FULL")) {
+            s->full = 1;
+        } else if (!strcmp(tag, "XOPENDCP=RGB")) {
+            s->ycbcr = 0;
+        } else if (!strcmp(tag, "XOPENDCP=XYZ")) {
+            s->ycbcr = 0;
+            s->xyz   = 1;
+        }
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*!
+ @function opendcp_stream_open
+ @abstract Starts reading raw frames from stdin or a named pipe.
+ @discussion A stream that begins with a yuv4mpeg header is read as such,
+     its 4:4:4 planes are Y'CbCr unless the header has an XOPENDCP=RGB or
+     XOPENDCP=XYZ tag. Other streams are headerless interleaved frames of
+     the given size and depth. Frames of the stream are decoded by naming
+     them <label>_<frame>.stream, with frames numbered from 1, and must be
+     decoded in that order. There is one stream at a time.
+ @param path The named pipe or file, "-" for stdin.
+ @param w The width of headerless frames.
+ @param h The height of headerless frames.
+ @param bits Bits per sample of headerless frames, 8 to 16.
+ @param xyz Headerless frames are X'Y'Z' and skip the color conversion.
+ @return OPENDCP_NO_ERROR or OPENDCP_ERROR.
+*/
+int opendcp_stream_open(const char *path, int w, int h, int bits, int xyz) {
+    char     line[STREAM_LINE + 1];
+    stream_t *s;
+
+    if (stream) {
+        OPENDCP_LOG(LOG_ERROR, "an input stream is already open");
+        return OPENDCP_ERROR;
+    }
+
+    s = calloc(1, sizeof(stream_t));
+
+    if (!s) {
+        return OPENDCP_ERROR;
+    }
+
+    if (!strcmp(path, "-")) {
+        s->fd = 0;
+#ifdef _WIN32
+        _setmode(0, _O_BINARY);
+#endif
+    } else {
+        s->fd = open(path, O_RDONLY);
+    }
+
+    if (s->fd < 0) {
+        OPENDCP_LOG(LOG_ERROR, "could not open input stream %s", path);
+        free(s);
+        return OPENDCP_ERROR;
+    }
+
+    s->w      = w;
+    s->h      = h;
+    s->bits   = bits;
+    s->xyz    = xyz;
+    s->frame  = 1;
+    s->peeked = stream_read(s, s->peek, sizeof(s->peek));
+
+    if (s->peeked == sizeof(s->peek) && !memcmp(s->peek, "YUV4MPEG2", sizeof(s->peek))) {
+        s->peeked = 0;
+        s->xyz    = 0;
+
+        if (stream_line(s, line) < 0 || stream_y4m_header(s, line) != OPENDCP_NO_ERROR) {
+            OPENDCP_LOG(LOG_ERROR, "invalid y4m header in %s", path);
+            s->w = 0;
+        }
+    } else if (s->peeked < 0) {
+        s->peeked = 0;
+        s->w      = 0;
+    }
+
+    if (s->w < 1 || s->h < 1 || s->w > 65536 || s->h > 65536 || s->bits < 8 || s->bits > 16) {
+        OPENDCP_LOG(LOG_ERROR, "input stream %s needs a frame size and a depth of 8 to 16 bits", path);
+
+        if (s->fd) {
+            close(s->fd);
+        }
+
+        free(s);
+        return OPENDCP_ERROR;
+    }
+
+    s->frame_size = (size_t)s->w * s->h * 3 * (s->bits > 8 ? 2 : 1);
+
+    pthread_mutex_init(&s->mutex, NULL);
+    pthread_cond_init(&s->advanced, NULL);
+
+    OPENDCP_LOG(LOG_INFO, "reading %dx%d %d-bit %s frames from %s", s->w, s->h, s->bits,
+                s->ycbcr ? "y'cbcr" : s->xyz ? "xyz" : "rgb", path);
+
+    stream = s;
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*!
+ @function opendcp_stream_ended
+ @abstract Tells whether the input stream has no more frames.
+ @return 1 if the stream ended or failed, 0 while it has more frames.
+*/
+int opendcp_stream_ended(void) {
+    int ended;
+
+    if (!stream) {
+        return 1;
+    }
+
+    pthread_mutex_lock(&stream->mutex);
+    ended = stream->end;
+    pthread_mutex_unlock(&stream->mutex);
+
+    return ended;
+}
+
+/*!
+ @function opendcp_stream_close
+ @abstract Closes the input stream.
+ @discussion No stream frame may be decoding.
+*/
+void opendcp_stream_close(void) {
+    if (!stream) {
+        return;
+    }
+
+    if (stream->fd) {
+        close(stream->fd);
+    }
+
+    pthread_cond_destroy(&stream->advanced);
+    pthread_mutex_destroy(&stream->mutex);
+    free(stream);
+    stream = NULL;
+}
+
+/* the frame number of a stream frame name, <label>_<frame>.stream */
+static int stream_frame(const char *sfile) {
+    const char *p = strrchr(sfile, '_');
+
+    return p ? atoi(p + 1) : 0;
+}
+
+/* read the bytes of a frame once the frame before has been read */
+static int stream_take(stream_t *s, int frame, unsigned char *buffer) {
+    char    line[STREAM_LINE + 1];
+    ssize_t n;
+    int     result = OPENDCP_NO_ERROR;
+
+    pthread_mutex_lock(&s->mutex);
+
+    while (!s->end && s->frame < frame) {
+        pthread_cond_wait(&s->advanced, &s->mutex);
+    }
+
+    if (s->end) {
+        pthread_mutex_unlock(&s->mutex);
+        return OPENDCP_STREAM_END;
+    }
+
+    if (s->frame != frame) {
+        OPENDCP_LOG(LOG_ERROR, "stream frame %d was already read", frame);
+        pthread_mutex_unlock(&s->mutex);
+        return OPENDCP_ERROR;
+    }
+
+    if (s->y4m && stream_line(s, line) < 0) {
+        result = OPENDCP_STREAM_END;
+    } else if (s->y4m && strncmp(line, "FRAME", 5)) {
+        OPENDCP_LOG(LOG_ERROR, "stream frame %d does not start with a y4m FRAME line", frame);
+        result = OPENDCP_ERROR;
+    } else {
+        n = stream_read(s, buffer, s->frame_size);
+
+        if (n == 0 && !s->y4m) {
+            result = OPENDCP_STREAM_END;
+        } else if (n != (ssize_t)s->frame_size) {
+            OPENDCP_LOG(LOG_ERROR, "input stream ended within frame %d", frame);
+            result = OPENDCP_ERROR;
+        }
+    }
+
+    if (result == OPENDCP_NO_ERROR) {
+        s->frame++;
+    } else {
+        s->end = 1;
+    }
+
+    pthread_cond_broadcast(&s->advanced);
+    pthread_mutex_unlock(&s->mutex);
+
+    return result;
+}
+
+/* rec709 Y'CbCr to R'G'B' of a row range, the planes are overwritten */
+static void stream_ycbcr(stream_t *s, opendcp_image_t *image, size_t start, size_t end, int max) {
+    int    *y = image->component[0].data, *cb = image->component[1].data, *cr = image->component[2].data;
+    double scale = (1 << s->bits) - 1, black = 0, range = scale, chroma = scale, mid = 1 << (s->bits - 1);
+    double l, u, v, r, g, b;
+    size_t i;
+
+    if (!s->full) {
+        black  = 16  << (s->bits - 8);
+        range  = 219 << (s->bits - 8);
+        chroma = 224 << (s->bits - 8);
+    }
+
+    for (i = start; i < end; i++) {
+        l = (y[i] - black) / range;
+        u = (cb[i] - mid) / chroma;
+        v = (cr[i] - mid) / chroma;
+        r = l + 1.5748 * v;
+        g = l - 0.1873 * u - 0.4681 * v;
+        b = l + 1.8556 * u;
+
+        y[i]  = r <= 0 ? 0 : r >= 1 ? max : (int)(r * max + 0.5);
+        cb[i] = g <= 0 ? 0 : g >= 1 ? max : (int)(g * max + 0.5);
+        cr[i] = b <= 0 ? 0 : b >= 1 ? max : (int)(b * max + 0.5);
+    }
+}
+
+/*!
+ @function opendcp_decode_stream
+ @abstract Reads a frame of the input stream into an opendcp_image_t.
+ @discussion Blocks until the frames before it have been read. Samples are
+     scaled to 12 bits, 16-bit sources are kept whole when the caller takes
+     them. X'Y'Z' frames are marked as color converted, other frames are
+     reported in bands.
+ @param image_ptr Pointer to the destination opendcp_image_t struct.
+ @param sfile The frame name, see opendcp_stream_open.
+ @return OPENDCP_NO_ERROR, OPENDCP_STREAM_END once the stream has no more
+     frames, or OPENDCP_ERROR.
+*/
+int opendcp_decode_stream(opendcp_image_t **image_ptr, const char *sfile) {
+    opendcp_decoder_band_t *band = opendcp_decoder_band_get();
+    opendcp_image_t        *image;
+    unsigned char          *buffer;
+    size_t                 i, start, end, samples;
+    int                    c, y0, y1, wide, shift, precision = 12, result;
+
+    if (!stream) {
+        OPENDCP_LOG(LOG_ERROR, "no input stream is open for %s", sfile);
+        return OPENDCP_ERROR;
+    }
+
+    buffer = malloc(stream->frame_size);
+
+    if (!buffer) {
+        return OPENDCP_ERROR;
+    }
+
+    result = stream_take(stream, stream_frame(sfile), buffer);
+
+    if (result != OPENDCP_NO_ERROR) {
+        free(buffer);
+        return result;
+    }
+
+    image = opendcp_image_create(3, stream->w, stream->h);
+
+    if (!image) {
+        free(buffer);
+        return OPENDCP_ERROR;
+    }
+
+    /* 16-bit samples are kept whole when the caller takes them and converts them itself */
+    if (stream->bits == 16 && band && band->precision >= 16 && !stream->xyz) {
+        image->precision = 16;
+        image->bpp       = 16;
+        precision        = 16;
+    }
+
+    /* y'cbcr samples are scaled by the matrix */
+    wide    = stream->bits > 8;
+    shift   = stream->ycbcr ? 0 : stream->bits - precision;
+    samples = (size_t)stream->w * stream->h;
+
+    for (y0 = 0; y0 < image->h; y0 = y1) {
+        y1    = y0 + STREAM_BAND < image->h ? y0 + STREAM_BAND : image->h;
+        start = (size_t)y0 * image->w;
+        end   = (size_t)y1 * image->w;
+
+        for (c = 0; c < 3; c++) {
+            int *d = image->component[c].data;
+
+            for (i = start; i < end; i++) {
+                /* y4m frames are planar, headerless frames interleaved */
+                size_t   s = stream->y4m ? c * samples + i : i * 3 + c;
+                unsigned v = wide ? buffer[2 * s] | (buffer[2 * s + 1] << 8) : buffer[s];
+
+                d[i] = shift >= 0 ? (int)(v >> shift) : (int)(v << -shift);
+            }
+        }
+
+        if (stream->ycbcr) {
+            stream_ycbcr(stream, image, start, end, (1 << precision) - 1);
+        }
+
+        if (!stream->xyz) {
+            opendcp_decoder_band(band, image, y0, y1);
+        }
+    }
+
+    /* already converted, the color conversion skips the frame */
+    if (stream->xyz) {
+        image->xyz_rows = image->h;
+    }
+
+    free(buffer);
+    *image_ptr = image;
+
+    return OPENDCP_NO_ERROR;
+}
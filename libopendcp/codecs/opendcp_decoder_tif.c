@@ -24,6 +24,17 @@
 #include <tiffio.h>
 #include "opendcp.h"
 #include "opendcp_image.h"
+#include "opendcp_decoder.h"
+#include "cpu.h"
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+/* threads used to decode the strips of compressed images */
+#define TIF_THREADS 4
 
 typedef struct {
     TIFF       *fp;
@@ -39,15 +50,489 @@ typedef struct {
     uint16_t   spp;
     uint16_t   photo;
     uint16_t   planar;
+    uint16_t   compression;
+    uint32_t   rows_per_strip;
     int        supported;
+    int        shift;           /* 16-bit samples are shifted down to 12 bits unless kept whole */
+    opendcp_decoder_band_t *band;   /* rows decoded callback of the calling thread */
+    const opendcp_decoder_input_t *input;   /* in-memory file of the calling thread */
 } tiff_image_t;
 
+/* read position of a libtiff handle on an in-memory file */
+typedef struct {
+    const opendcp_decoder_input_t *input;
+    toff_t                        offset;
+} tif_memory_t;
+
+static tsize_t tif_memory_read(thandle_t handle, tdata_t buf, tsize_t size) {
+    tif_memory_t *m = (tif_memory_t *)handle;
+    toff_t       n;
+
+    if (size < 0 || m->offset >= m->input->size) {
+        return 0;
+    }
+
+    n = m->input->size - m->offset;
+    n = n < (toff_t)size ? n : (toff_t)size;
+    memcpy(buf, m->input->data + m->offset, (size_t)n);
+    m->offset += n;
+
+    return (tsize_t)n;
+}
+
+static tsize_t tif_memory_write(thandle_t handle, tdata_t buf, tsize_t size) {
+    UNUSED(handle);
+    UNUSED(buf);
+    UNUSED(size);
+
+    return -1;
+}
+
+static toff_t tif_memory_seek(thandle_t handle, toff_t offset, int whence) {
+    tif_memory_t *m = (tif_memory_t *)handle;
+
+    switch (whence) {
+        case SEEK_SET: m->offset = offset; break;
+        case SEEK_CUR: m->offset += offset; break;
+        case SEEK_END: m->offset = m->input->size + offset; break;
+        default: return (toff_t)-1;
+    }
+
+    return m->offset;
+}
+
+static int tif_memory_close(thandle_t handle) {
+    free(handle);
+
+    return 0;
+}
+
+static toff_t tif_memory_size(thandle_t handle) {
+    return ((tif_memory_t *)handle)->input->size;
+}
+
+static int tif_memory_map(thandle_t handle, tdata_t *base, toff_t *size) {
+    tif_memory_t *m = (tif_memory_t *)handle;
+
+    *base = (tdata_t)m->input->data;
+    *size = m->input->size;
+
+    return 1;
+}
+
+static void tif_memory_unmap(thandle_t handle, tdata_t base, toff_t size) {
+    UNUSED(handle);
+    UNUSED(base);
+    UNUSED(size);
+}
+
+/* open the file, or the in-memory copy the caller decodes from */
+static TIFF *tif_open(const char *sfile, const opendcp_decoder_input_t *input) {
+    tif_memory_t *m;
+    TIFF         *fp;
+
+    if (!input) {
+        return TIFFOpen(sfile, "r");
+    }
+
+    if (!(m = malloc(sizeof(*m)))) {
+        return NULL;
+    }
+
+    m->input  = input;
+    m->offset = 0;
+
+    fp = TIFFClientOpen(sfile, "r", (thandle_t)m, tif_memory_read, tif_memory_write, tif_memory_seek,
+                        tif_memory_close, tif_memory_size, tif_memory_map, tif_memory_unmap);
+
+    /* the close proc is only called by TIFFClose */
+    if (!fp) {
+        free(m);
+    }
+
+    return fp;
+}
+
+/* report the rows of a strip once it is in the image */
+static void tif_strip_done(tiff_image_t *tif, opendcp_image_t *image, tstrip_t strip) {
+    uint32_t y0 = strip * tif->rows_per_strip;
+    uint32_t y1 = y0 + tif->rows_per_strip;
+
+    opendcp_decoder_band(tif->band, image, y0, y1 < (uint32_t)tif->h ? y1 : (uint32_t)tif->h);
+}
+
 void opendcp_tif_set_strip(tiff_image_t *tif) {
     tif->strip_num  = TIFFNumberOfStrips(tif->fp);
     tif->strip_size = TIFFStripSize(tif->fp);
     tif->strip_data = _TIFFmalloc(tif->strip_size);
 }
 
+/* convert one decoded RGB strip starting at pixel index */
+static void tif_rgb_strip(tiff_image_t *tif, opendcp_image_t *image, uint8_t *data, tsize_t read_size, uint32_t index) {
+    tsize_t i;
+
+    /* 8 bits per pixel */
+    if (tif->bps==8) {
+        for (i=0; i<read_size && index<tif->image_size; i+=tif->spp) {
+            /* rounded to 12 bits */
+            image->component[0].data[index] = data[i+0] << 4; // R
+            image->component[1].data[index] = data[i+1] << 4; // G
+            image->component[2].data[index] = data[i+2] << 4; // B
+            index++;
+        }
+    /*12 bits per pixel*/
+    } else if (tif->bps==12) {
+        for (i=0; i<read_size && (index+1)<tif->image_size; i+=(3*tif->spp)) {
+            image->component[0].data[index]   = ( data[i+0] << 4)         | (data[i+1] >> 4); // R
+            image->component[1].data[index]   = ((data[i+1] & 0x0f) << 8) | (data[i+2]);      // G
+            image->component[2].data[index]   = ( data[i+3] << 4)         | (data[i+4] >> 4); // B
+            if (tif->spp == 4) {
+                /* skip alpha channel */
+                image->component[0].data[index+1] = ( data[i+6] << 4)         | (data[i+7] >> 4);  // R
+                image->component[1].data[index+1] = ((data[i+7] & 0x0f) << 8) | (data[i+8]);       // G
+                image->component[2].data[index+1] = ( data[i+9] << 4)         | (data[i+10] >> 4); // B
+            } else {
+                image->component[0].data[index+1] = ((data[i+4] & 0x0f) << 8) | (data[i+5]);       // R
+                image->component[1].data[index+1] = ( data[i+6] <<4 )         | (data[i+7] >> 4);  // G
+                image->component[2].data[index+1] = ((data[i+7] & 0x0f) << 8) | (data[i+8]);       // B
+            }
+            index+=2;
+        }
+    /* 16 bits per pixel */
+    } else if (tif->bps==16) {
+        for (i=0; i<read_size && index<tif->image_size; i+=(2*tif->spp)) {
+            /* rounded to 12 bits unless kept whole */
+            image->component[0].data[index] = ((data[i+1] << 8) | data[i+0]) >> tif->shift; // R
+            image->component[1].data[index] = ((data[i+3] << 8) | data[i+2]) >> tif->shift; // G
+            image->component[2].data[index] = ((data[i+5] << 8) | data[i+4]) >> tif->shift; // B
+            index++;
+        }
+    }
+}
+
+/*
+   Uncompressed 16-bit RGB(A) samples are deinterleaved straight from the
+   mapped file. The kernels take 8 pixels at a time, swap the samples when
+   the file is big endian and return the number of pixels done.
+*/
+#if defined(__GNUC__) && defined(__x86_64__)
+__attribute__((target("ssse3")))
+static uint32_t tif_deinterleave_16_ssse3(opendcp_image_t *image, const uint8_t *src, uint32_t index, uint32_t count, int spp, int big, int shift) {
+    uint32_t i;
+    int      c, r, k, off;
+    int8_t   shuffle[3][4][16];
+    __m128i  mask[3][4];
+    __m128i  in[4];
+    __m128i  v;
+    __m128i  zero = _mm_setzero_si128();
+
+    /* byte shuffles gathering sample c of 8 pixels from each register */
+    for (c = 0; c < 3; c++) {
+        for (r = 0; r < spp; r++) {
+            for (k = 0; k < 8; k++) {
+                off = (k * spp + c) * 2;
+                if (off / 16 == r) {
+                    shuffle[c][r][2 * k]     = (int8_t)(off % 16 + big);
+                    shuffle[c][r][2 * k + 1] = (int8_t)(off % 16 + !big);
+                } else {
+                    shuffle[c][r][2 * k]     = (int8_t)0x80;
+                    shuffle[c][r][2 * k + 1] = (int8_t)0x80;
+                }
+            }
+            mask[c][r] = _mm_loadu_si128((const __m128i *)shuffle[c][r]);
+        }
+    }
+
+    for (i = 0; i + 8 <= count; i += 8) {
+        for (r = 0; r < spp; r++) {
+            in[r] = _mm_loadu_si128((const __m128i *)(src + (size_t)i * spp * 2 + r * 16));
+        }
+
+        for (c = 0; c < 3; c++) {
+            v = _mm_shuffle_epi8(in[0], mask[c][0]);
+            for (r = 1; r < spp; r++) {
+                v = _mm_or_si128(v, _mm_shuffle_epi8(in[r], mask[c][r]));
+            }
+            v = _mm_srl_epi16(v, _mm_cvtsi32_si128(shift));
+            _mm_storeu_si128((__m128i *)(image->component[c].data + index + i),     _mm_unpacklo_epi16(v, zero));
+            _mm_storeu_si128((__m128i *)(image->component[c].data + index + i + 4), _mm_unpackhi_epi16(v, zero));
+        }
+    }
+
+    return i;
+}
+#elif defined(__aarch64__)
+static uint32_t tif_deinterleave_16_neon(opendcp_image_t *image, const uint8_t *src, uint32_t index, uint32_t count, int spp, int big, int shift) {
+    uint32_t    i;
+    int         c;
+    uint16x8_t  v[4];
+
+    for (i = 0; i + 8 <= count; i += 8) {
+        const uint16_t *p = (const uint16_t *)(src + (size_t)i * spp * 2);
+
+        if (spp == 4) {
+            uint16x8x4_t in = vld4q_u16(p);
+            v[0] = in.val[0]; v[1] = in.val[1]; v[2] = in.val[2];
+        } else {
+            uint16x8x3_t in = vld3q_u16(p);
+            v[0] = in.val[0]; v[1] = in.val[1]; v[2] = in.val[2];
+        }
+
+        for (c = 0; c < 3; c++) {
+            if (big) {
+                v[c] = vreinterpretq_u16_u8(vrev16q_u8(vreinterpretq_u8_u16(v[c])));
+            }
+            v[c] = vshlq_u16(v[c], vdupq_n_s16(-shift));
+            vst1q_s32(image->component[c].data + index + i,     vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(v[c]))));
+            vst1q_s32(image->component[c].data + index + i + 4, vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(v[c]))));
+        }
+    }
+
+    return i;
+}
+#endif
+
+static void tif_deinterleave_16(opendcp_image_t *image, const uint8_t *src, uint32_t index, uint32_t count, int spp, int big, int shift) {
+    uint32_t      i = 0;
+    int           c;
+    const uint8_t *p;
+
+#if defined(__GNUC__) && defined(__x86_64__)
+    if (cpu_has(CPU_SSSE3)) {
+        i = tif_deinterleave_16_ssse3(image, src, index, count, spp, big, shift);
+    }
+#elif defined(__aarch64__)
+    if (cpu_has(CPU_NEON)) {
+        i = tif_deinterleave_16_neon(image, src, index, count, spp, big, shift);
+    }
+#endif
+
+    /* remaining pixels */
+    for (; i < count; i++) {
+        p = src + (size_t)i * spp * 2;
+        for (c = 0; c < 3; c++) {
+            image->component[c].data[index + i] = (big ? (p[2*c] << 8) | p[2*c+1] : (p[2*c+1] << 8) | p[2*c]) >> shift;
+        }
+    }
+}
+
+/* uncompressed 16-bit RGB(A) read from the mapped file, no strip copies */
+static int tif_decode_rgb16_mapped(tiff_image_t *tif, opendcp_image_t *image, const char *sfile) {
+    opendcp_file_map_t map;
+    toff_t   *offsets = NULL;
+    toff_t   *counts  = NULL;
+    uint32_t strip, rows, index;
+    size_t   bytes;
+    int      big;
+
+    if (!TIFFGetField(tif->fp, TIFFTAG_STRIPOFFSETS, &offsets) ||
+        !TIFFGetField(tif->fp, TIFFTAG_STRIPBYTECOUNTS, &counts)) {
+        return OPENDCP_ERROR;
+    }
+
+    if (opendcp_file_map(&map, sfile) != OPENDCP_NO_ERROR) {
+        return OPENDCP_ERROR;
+    }
+
+    big = TIFFIsBigEndian(tif->fp) ? 1 : 0;
+
+    for (strip = 0, index = 0; strip < tif->strip_num && index < tif->image_size; strip++) {
+        rows  = tif->h - strip * tif->rows_per_strip;
+        rows  = rows < tif->rows_per_strip ? rows : tif->rows_per_strip;
+        bytes = (size_t)rows * tif->w * tif->spp * 2;
+
+        if (counts[strip] < bytes || offsets[strip] > map.size || map.size - offsets[strip] < bytes) {
+            opendcp_file_unmap(&map);
+            return OPENDCP_ERROR;
+        }
+
+        tif_deinterleave_16(image, map.data + offsets[strip], index, rows * tif->w, tif->spp, big, tif->shift);
+        tif_strip_done(tif, image, strip);
+        index += rows * tif->w;
+    }
+
+    opendcp_file_unmap(&map);
+
+    return OPENDCP_NO_ERROR;
+}
+
+typedef struct {
+    const char      *sfile;
+    tiff_image_t    *tif;
+    opendcp_image_t *image;
+    TIFF            *fp;      /* handle for this band, NULL to open one */
+    tstrip_t        start;
+    tstrip_t        end;
+    int             result;
+} tif_band_t;
+
+/* decode a range of strips, libtiff handles are not shared between threads */
+static void *tif_band_decode(void *arg) {
+    tif_band_t *band = (tif_band_t *)arg;
+    TIFF       *fp   = band->fp;
+    tdata_t    buffer;
+    tsize_t    read_size;
+    tstrip_t   strip;
+
+    band->result = OPENDCP_ERROR;
+
+    if (!fp && !(fp = tif_open(band->sfile, band->tif->input))) {
+        return NULL;
+    }
+
+    buffer = _TIFFmalloc(band->tif->strip_size);
+
+    if (buffer) {
+        band->result = OPENDCP_NO_ERROR;
+
+        for (strip = band->start; strip < band->end; strip++) {
+            read_size = TIFFReadEncodedStrip(fp, strip, buffer, band->tif->strip_size);
+
+            if (read_size < 0) {
+                band->result = OPENDCP_ERROR;
+                break;
+            }
+
+            tif_rgb_strip(band->tif, band->image, (uint8_t *)buffer, read_size, strip * band->tif->rows_per_strip * band->tif->w);
+            tif_strip_done(band->tif, band->image, strip);
+        }
+
+        _TIFFfree(buffer);
+    }
+
+    if (fp != band->fp) {
+        TIFFClose(fp);
+    }
+
+    return NULL;
+}
+
+/* decode compressed strips in bands on the thread pool, the first on this thread */
+static int tif_decode_rgb_parallel(tiff_image_t *tif, opendcp_image_t *image, const char *sfile) {
+    tif_band_t band[TIF_THREADS];
+    int        i, n;
+    int        result = OPENDCP_NO_ERROR;
+
+    n = tif->strip_num < TIF_THREADS ? (int)tif->strip_num : TIF_THREADS;
+
+    for (i = 0; i < n; i++) {
+        band[i].sfile = sfile;
+        band[i].tif   = tif;
+        band[i].image = image;
+        band[i].fp    = i ? NULL : tif->fp;
+        band[i].start = tif->strip_num * i / n;
+        band[i].end   = tif->strip_num * (i + 1) / n;
+    }
+
+    opendcp_pool_run(tif_band_decode, band, sizeof(tif_band_t), n, POOL_PRIORITY_NORMAL);
+
+    for (i = 0; i < n; i++) {
+        if (band[i].result != OPENDCP_NO_ERROR) {
+            result = OPENDCP_ERROR;
+        }
+    }
+
+    return result;
+}
+
+/* 8-bit YCbCr strips unpacked to Cb Y Cr and converted a band at a time, full range only */
+static int tif_decode_ycbcr(tiff_image_t *tif, opendcp_image_t *image) {
+    uint16_t sub_h = 1, sub_v = 1;
+    float    *ref  = NULL;
+    float    *coef = NULL;
+    tsize_t  row_bytes;
+    uint32_t y, y0, rows;
+    int      x, c, start, end, *p[3];
+    uint8_t  *data, *s;
+
+    if (tif->bps != 8 || tif->spp != 3 || tif->planar == PLANARCONFIG_SEPARATE ||
+        tif->compression == COMPRESSION_JPEG || tif->compression == COMPRESSION_OJPEG || TIFFIsTiled(tif->fp)) {
+        return OPENDCP_ERROR;
+    }
+
+    TIFFGetFieldDefaulted(tif->fp, TIFFTAG_YCBCRSUBSAMPLING, &sub_h, &sub_v);
+
+    if (sub_v != 1 || (sub_h != 1 && sub_h != 2)) {
+        return OPENDCP_ERROR;
+    }
+
+    /* other ranges and coefficients are left to libtiff */
+    if (TIFFGetField(tif->fp, TIFFTAG_REFERENCEBLACKWHITE, &ref) && ref &&
+        (ref[0] != 0 || ref[1] != 255 || ref[2] != 128 || ref[3] != 255 || ref[4] != 128 || ref[5] != 255)) {
+        return OPENDCP_ERROR;
+    }
+
+    if (TIFFGetField(tif->fp, TIFFTAG_YCBCRCOEFFICIENTS, &coef) && coef &&
+        (fabsf(coef[0] - 0.299f) > 1e-4f || fabsf(coef[1] - 0.587f) > 1e-4f || fabsf(coef[2] - 0.114f) > 1e-4f)) {
+        return OPENDCP_ERROR;
+    }
+
+    /* 2x1 data units are Y0 Y1 Cb Cr */
+    row_bytes = sub_h == 2 ? (tsize_t)(tif->w + 1) / 2 * 4 : (tsize_t)tif->w * 3;
+
+    opendcp_tif_set_strip(tif);
+
+    if (!tif->strip_data) {
+        return OPENDCP_ERROR;
+    }
+
+    for (tif->strip = 0; tif->strip < tif->strip_num; tif->strip++) {
+        y0   = tif->strip * tif->rows_per_strip;
+        rows = y0 + tif->rows_per_strip < (uint32_t)tif->h ? tif->rows_per_strip : tif->h - y0;
+
+        tif->read_size = TIFFReadEncodedStrip(tif->fp, tif->strip, tif->strip_data, tif->strip_size);
+
+        if (tif->read_size < row_bytes * (tsize_t)rows) {
+            _TIFFfree(tif->strip_data);
+            return OPENDCP_ERROR;
+        }
+
+        data = (uint8_t *)tif->strip_data;
+
+        for (y = y0; y < y0 + rows; y++, data += row_bytes) {
+            for (c = 0; c < 3; c++) {
+                p[c] = image->component[c].data + (size_t)y * tif->w;
+            }
+
+            if (sub_h == 2) {
+                for (x = 0, s = data; x < tif->w; x += 2, s += 4) {
+                    p[0][x] = s[0];
+                    p[1][x] = s[2];
+                    p[2][x] = s[3];
+                    if (x + 1 < tif->w) {
+                        p[0][x + 1] = s[1];
+                        p[1][x + 1] = s[2];
+                        p[2][x + 1] = s[3];
+                    }
+                }
+            } else {
+                for (x = 0, s = data; x < tif->w; x++, s += 3) {
+                    p[0][x] = s[0];
+                    p[1][x] = s[1];
+                    p[2][x] = s[2];
+                }
+            }
+        }
+
+        /* convert the strip while it is in cache */
+        start = (int)y0 * tif->w;
+        end   = (int)(y0 + rows) * tif->w;
+        ycbcr_to_rgb(image, start, end, 8);
+
+        for (c = 0; c < 3; c++) {
+            for (x = start; x < end; x++) {
+                image->component[c].data[x] <<= 4;
+            }
+        }
+
+        tif_strip_done(tif, image, tif->strip);
+    }
+
+    _TIFFfree(tif->strip_data);
+
+    return OPENDCP_NO_ERROR;
+}
+
 /*!
  @function opendcp_decode_tif
  @abstract Read an image file and populates an opendcp_image_t structure.
@@ -64,24 +549,36 @@ int opendcp_decode_tif(opendcp_image_t **image_ptr, const char *sfile) {
 
     TIFFSetWarningHandler(NULL);
     memset(&tif, 0, sizeof(tiff_image_t));
+    tif.band = opendcp_decoder_band_get();
+    tif.input = opendcp_decoder_input_get(sfile);
 
-    /* open tiff using filename or file descriptor */
+    /* open tiff using filename or the in-memory file */
     OPENDCP_LOG(LOG_DEBUG,"opening tiff file %s", sfile);
-    tif.fp = TIFFOpen(sfile, "r");
+    tif.fp = tif_open(sfile, tif.input);
 
     if (!tif.fp) {
         OPENDCP_LOG(LOG_ERROR,"failed to open %s for reading", sfile);
         return OPENDCP_ERROR;
     }
 
+    if (!tif.input) {
+        opendcp_file_cache(TIFFFileno(tif.fp), 0);
+    }
+
     TIFFGetField(tif.fp, TIFFTAG_IMAGEWIDTH, &tif.w);
     TIFFGetField(tif.fp, TIFFTAG_IMAGELENGTH, &tif.h);
     TIFFGetField(tif.fp, TIFFTAG_BITSPERSAMPLE, &tif.bps);
     TIFFGetField(tif.fp, TIFFTAG_SAMPLESPERPIXEL, &tif.spp);
     TIFFGetField(tif.fp, TIFFTAG_PHOTOMETRIC, &tif.photo);
     TIFFGetField(tif.fp, TIFFTAG_PLANARCONFIG, &tif.planar);
+    TIFFGetFieldDefaulted(tif.fp, TIFFTAG_COMPRESSION, &tif.compression);
+    TIFFGetFieldDefaulted(tif.fp, TIFFTAG_ROWSPERSTRIP, &tif.rows_per_strip);
     tif.image_size = tif.w * tif.h;
 
+    if (tif.rows_per_strip == 0 || tif.rows_per_strip > (uint32_t)tif.h) {
+        tif.rows_per_strip = tif.h;
+    }
+
     OPENDCP_LOG(LOG_DEBUG,"tif attributes photo: %d bps: %d spp: %d planar: %d",tif.photo,tif.bps,tif.spp,tif.planar);
 
     /* check if image is supported */
@@ -163,74 +660,81 @@ int opendcp_decode_tif(opendcp_image_t **image_ptr, const char *sfile) {
 
     /* YUV */
     else if (tif.photo == PHOTOMETRIC_YCBCR) {
-        uint32_t *raster = (uint32_t*) _TIFFmalloc(tif.image_size * sizeof(uint32_t));
-        TIFFReadRGBAImageOriented(tif.fp, tif.w, tif.h, raster, ORIENTATION_TOPLEFT,0);
-        /* 8/16/24 bits per pixel */
-        if (tif.bps==8 || tif.bps==16 || tif.bps==24) {
-            for (i=0;i<tif.image_size;i++) {
-                image->component[0].data[i] = (raster[i] & 0xFF)       << 4;
-                image->component[1].data[i] = (raster[i] >> 8 & 0xFF)  << 4;
-                image->component[2].data[i] = (raster[i] >> 16 & 0xFF) << 4;
+        /* left to libtiff when the raw samples can not be converted here */
+        if (tif_decode_ycbcr(&tif, image) != OPENDCP_NO_ERROR) {
+            uint32_t *raster = (uint32_t*) _TIFFmalloc(tif.image_size * sizeof(uint32_t));
+
+            /* the strips are decoded again, rows already reported do not count */
+            image->xyz_rows = 0;
+            opendcp_xyz_stats_reset(&image->xyz_stats);
+
+            TIFFReadRGBAImageOriented(tif.fp, tif.w, tif.h, raster, ORIENTATION_TOPLEFT,0);
+            /* 8/16/24 bits per pixel */
+            if (tif.bps==8 || tif.bps==16 || tif.bps==24) {
+                for (i=0;i<tif.image_size;i++) {
+                    image->component[0].data[i] = (raster[i] & 0xFF)       << 4;
+                    image->component[1].data[i] = (raster[i] >> 8 & 0xFF)  << 4;
+                    image->component[2].data[i] = (raster[i] >> 16 & 0xFF) << 4;
+                }
             }
+            _TIFFfree(raster);
         }
-        _TIFFfree(raster);
     }
 
     /* RGB(A) and GRAYSCALE */
     else if (tif.photo == PHOTOMETRIC_RGB) {
-        opendcp_tif_set_strip(&tif);
-        uint8_t *data  = (uint8_t *)tif.strip_data;
+        int done = 0;
 
-        /* 8 bits per pixel */
-        if (tif.bps==8) {
-            index = 0;
-            for (tif.strip = 0; tif.strip < tif.strip_num; tif.strip++) {
-                tif.read_size = TIFFReadEncodedStrip(tif.fp, tif.strip, tif.strip_data, tif.strip_size);
-                for (i=0; i<tif.read_size && index<tif.image_size; i+=tif.spp) {
-                    /* rounded to 12 bits */
-                    image->component[0].data[index] = data[i+0] << 4; // R
-                    image->component[1].data[index] = data[i+1] << 4; // G
-                    image->component[2].data[index] = data[i+2] << 4; // B
-                    index++;
-                }
+        /* 16-bit samples are kept whole when the caller takes them */
+        tif.shift = 4;
+
+        if (tif.bps == 16 && tif.band && tif.band->precision >= 16) {
+            tif.shift        = 0;
+            image->precision = 16;
+            image->bpp       = 16;
+        }
+
+        tif.strip_num  = TIFFNumberOfStrips(tif.fp);
+        tif.strip_size = TIFFStripSize(tif.fp);
+
+        /* uncompressed 16-bit, read from the mapped file */
+        if (tif.compression == COMPRESSION_NONE && tif.bps == 16 && (tif.spp == 3 || tif.spp == 4) &&
+            tif.planar != PLANARCONFIG_SEPARATE && !TIFFIsTiled(tif.fp)) {
+            done = tif_decode_rgb16_mapped(&tif, image, sfile) == OPENDCP_NO_ERROR;
+
+            /* the strips are decoded again, rows already reported do not count */
+            if (!done) {
+                image->xyz_rows = 0;
+                opendcp_xyz_stats_reset(&image->xyz_stats);
             }
-        /*12 bits per pixel*/
-        } else if (tif.bps==12) {
-            index = 0;
-            for (tif.strip = 0; tif.strip < tif.strip_num; tif.strip++) {
-                tif.read_size = TIFFReadEncodedStrip(tif.fp, tif.strip, tif.strip_data, tif.strip_size);
-                for (i=0; i<tif.read_size && (index+1)<tif.image_size; i+=(3*tif.spp)) {
-                    image->component[0].data[index]   = ( data[i+0] << 4)         | (data[i+1] >> 4); // R
-                    image->component[1].data[index]   = ((data[i+1] & 0x0f) << 8) | (data[i+2]);      // G
-                    image->component[2].data[index]   = ( data[i+3] << 4)         | (data[i+4] >> 4); // B
-                    if (tif.spp == 4) {
-                        /* skip alpha channel */
-                        image->component[0].data[index+1] = ( data[i+6] << 4)         | (data[i+7] >> 4);  // R
-                        image->component[1].data[index+1] = ((data[i+7] & 0x0f) << 8) | (data[i+8]);       // G
-                        image->component[2].data[index+1] = ( data[i+9] << 4)         | (data[i+10] >> 4); // B
-                    } else {
-                        image->component[0].data[index+1] = ((data[i+4] & 0x0f) << 8) | (data[i+5]);       // R
-                        image->component[1].data[index+1] = ( data[i+6] <<4 )         | (data[i+7] >> 4);  // G
-                        image->component[2].data[index+1] = ((data[i+7] & 0x0f) << 8) | (data[i+8]);       // B
-                    }
-                    index+=2;
-                }
+        }
+
+        /* compressed, strips are independent */
+        if (!done && tif.compression != COMPRESSION_NONE && tif.strip_num > 1 && !TIFFIsTiled(tif.fp)) {
+            if (tif_decode_rgb_parallel(&tif, image, sfile) != OPENDCP_NO_ERROR) {
+                TIFFClose(tif.fp);
+                opendcp_image_free(image);
+                OPENDCP_LOG(LOG_ERROR,"failed to decode tiff strips %s",sfile);
+                return OPENDCP_ERROR;
             }
-        /* 16 bits per pixel */
-        } else if (tif.bps==16) {
+            done = 1;
+        }
+
+        if (!done) {
+            opendcp_tif_set_strip(&tif);
             index = 0;
             for (tif.strip = 0; tif.strip < tif.strip_num; tif.strip++) {
                 tif.read_size = TIFFReadEncodedStrip(tif.fp, tif.strip, tif.strip_data, tif.strip_size);
-                for (i=0; i<tif.read_size && index<tif.image_size; i+=(2*tif.spp)) {
-                    /* rounded to 12 bits */
-                    image->component[0].data[index] = ((data[i+1] << 8) | data[i+0]) >> 4; // R
-                    image->component[1].data[index] = ((data[i+3] << 8) | data[i+2]) >> 4; // G
-                    image->component[2].data[index] = ((data[i+5] << 8) | data[i+4]) >> 4; // B
-                    index++;
-                }
+                tif_rgb_strip(&tif, image, (uint8_t *)tif.strip_data, tif.read_size, index);
+                tif_strip_done(&tif, image, tif.strip);
+                index += tif.rows_per_strip * tif.w;
             }
+            _TIFFfree(tif.strip_data);
         }
-        _TIFFfree(tif.strip_data);
+    }
+
+    if (!tif.input) {
+        opendcp_file_cache(TIFFFileno(tif.fp), 1);
     }
 
     TIFFClose(tif.fp);
@@ -70,6 +70,28 @@ opendcp_encoder_t *opendcp_encoder_find(char *name, char *ext, int id) {
     return &opendcp_encoders[OPENDCP_ENCODER_NONE];
 }
 
+/*!
+ @function opendcp_encoder_select
+ @abstract Find the encoder with an id that services a file extension.
+ @discussion This gives the encoder opendcp_encoder_enable followed by
+     opendcp_encoder_find would, without changing which encoders are
+     enabled, so conversions running at once may each use their own.
+ @param ext  The file extension of desired file type
+ @param id The id of the encoder
+ @return Returns an opendcp_encoder_t structure on success, opendcp_encoder_none if not found
+*/
+opendcp_encoder_t *opendcp_encoder_select(char *ext, int id) {
+    int x;
+
+    for (x = 0; x < OPENDCP_ENCODER_NONE; x++) {
+        if (opendcp_encoders[x].id == id && strcasefind(opendcp_encoders[x].extensions, ext)) {
+            return &opendcp_encoders[x];
+        }
+    }
+
+    return &opendcp_encoders[OPENDCP_ENCODER_NONE];
+}
+
 /*!
  @function opendcp_encoder_enable
  @abstract Changes which encoders will be enabled for a given file extension.
@@ -103,3 +125,152 @@ int opendcp_encoder_enable(char *ext, char *name, int id) {
 
     return OPENDCP_NO_ERROR;
 }
+
+/*!
+ @function opendcp_encoder_init
+ @abstract Prepares an encoder for a conversion.
+ @discussion The capabilities of the encoder are checked against the
+     settings of the context and its init hook is run.
+ @param encoder The encoder.
+ @param opendcp The opendcp context of the conversion.
+ @return Returns OPENDCP_NO_ERROR if the encoder can be used, OPENDCP_ERROR otherwise
+*/
+int opendcp_encoder_init(opendcp_encoder_t *encoder, opendcp_t *opendcp) {
+    if (opendcp->cinema_profile == DCP_CINEMA4K && !(encoder->caps & OPENDCP_ENCODER_CAP_4K)) {
+        OPENDCP_LOG(LOG_ERROR, "%s encoder does not support 4K", encoder->name);
+        return OPENDCP_ERROR;
+    }
+
+    if (encoder->hooks && encoder->hooks->init) {
+        return encoder->hooks->init(opendcp);
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*!
+ @function opendcp_encoder_shutdown
+ @abstract Releases what an encoder holds once a conversion has finished.
+ @param encoder The encoder.
+ @param opendcp The opendcp context of the conversion.
+*/
+void opendcp_encoder_shutdown(opendcp_encoder_t *encoder, opendcp_t *opendcp) {
+    if (encoder->hooks && encoder->hooks->shutdown) {
+        encoder->hooks->shutdown(opendcp);
+    }
+}
+
+/*!
+ @function opendcp_encoder_batch_size
+ @abstract Returns how many frames to hand the encoder at once.
+ @param encoder The encoder.
+ @return The preferred batch size, 1 if the encoder has no batch entry point
+*/
+int opendcp_encoder_batch_size(opendcp_encoder_t *encoder) {
+    if (!encoder->hooks || !encoder->hooks->encode_batch || encoder->hooks->batch_size < 1) {
+        return 1;
+    }
+
+    return encoder->hooks->batch_size;
+}
+
+/*!
+ @function opendcp_encoder_has_threads
+ @abstract Tells whether the encoder can use several threads inside a frame.
+ @param encoder The encoder.
+ @return 1 if the encoder has a threads hook, otherwise 0
+*/
+int opendcp_encoder_has_threads(opendcp_encoder_t *encoder) {
+    return encoder->hooks && encoder->hooks->threads;
+}
+
+/*!
+ @function opendcp_encoder_threads
+ @abstract Sets how many threads the next frame encoded by the calling thread may use.
+ @discussion Encoders without a threads hook ignore the count.
+ @param encoder The encoder.
+ @param count The thread count, 1 encodes the frame on the calling thread only.
+*/
+void opendcp_encoder_threads(opendcp_encoder_t *encoder, int count) {
+    if (opendcp_encoder_has_threads(encoder)) {
+        encoder->hooks->threads(count > 0 ? count : 1);
+    }
+}
+
+/*!
+ @function opendcp_encoder_thread_share
+ @abstract Returns how many threads a frame that starts encoding now may use.
+ @discussion With a long queue every encoder thread works on its own frame
+     and each frame gets one thread. When fewer frames are waiting than
+     encoders are idle, the threads the idle encoders leave unused are
+     shared among the frames that remain, so the last frames of a job or a
+     single preview frame are encoded with intra-frame threads.
+ @param threads The thread budget.
+ @param busy The threads used by the frames being encoded.
+ @param idle The encoders not encoding a frame, including the caller.
+ @param pending The frames waiting to be encoded, including this one.
+ @return The thread count, at least 1
+*/
+int opendcp_encoder_thread_share(int threads, int busy, int idle, int pending) {
+    int frames = pending < idle ? pending : idle;
+    int count;
+
+    count = (threads - busy) / (frames > 0 ? frames : 1);
+
+    return count > 1 ? count : 1;
+}
+
+/*!
+ @function opendcp_encoder_encode_buffer
+ @abstract Encodes a frame to memory.
+ @discussion The encoder must have OPENDCP_ENCODER_CAP_BUFFER set.
+ @param encoder The encoder.
+ @param opendcp The opendcp context.
+ @param opendcp_image The image to encode, it is not freed.
+ @param data Receives the codestream, to be freed by the caller.
+ @param length Receives the codestream length.
+ @return Returns OPENDCP_NO_ERROR on success, OPENDCP_ERROR on failure
+*/
+int opendcp_encoder_encode_buffer(opendcp_encoder_t *encoder, opendcp_t *opendcp, opendcp_image_t *opendcp_image, unsigned char **data, int *length) {
+    if (!(encoder->caps & OPENDCP_ENCODER_CAP_BUFFER) || !encoder->hooks || !encoder->hooks->encode_buffer) {
+        OPENDCP_LOG(LOG_ERROR, "%s encoder can not encode to memory", encoder->name);
+        return OPENDCP_ERROR;
+    }
+
+    return encoder->hooks->encode_buffer(opendcp, opendcp_image, data, length);
+}
+
+/*!
+ @function opendcp_encoder_encode_batch
+ @abstract Encodes several frames to memory.
+ @discussion Encoders without a batch entry point encode the frames one at
+     a time with their encode_buffer hook.
+ @param encoder The encoder.
+ @param opendcp The opendcp context.
+ @param images The images to encode, they are not freed.
+ @param count The number of images.
+ @param data Receives the codestream of each frame, NULL for a failed frame.
+ @param lengths Receives the codestream length of each frame.
+ @param results Receives the result of each frame.
+ @return Returns OPENDCP_NO_ERROR if every frame was encoded, OPENDCP_ERROR otherwise
+*/
+int opendcp_encoder_encode_batch(opendcp_encoder_t *encoder, opendcp_t *opendcp, opendcp_image_t **images, int count, unsigned char **data, int *lengths, int *results) {
+    int result = OPENDCP_NO_ERROR;
+    int i;
+
+    if (encoder->hooks && encoder->hooks->encode_batch) {
+        return encoder->hooks->encode_batch(opendcp, images, count, data, lengths, results);
+    }
+
+    for (i = 0; i < count; i++) {
+        data[i]    = NULL;
+        lengths[i] = 0;
+        results[i] = opendcp_encoder_encode_buffer(encoder, opendcp, images[i], &data[i], &lengths[i]);
+
+        if (results[i] != OPENDCP_NO_ERROR) {
+            result = OPENDCP_ERROR;
+        }
+    }
+
+    return result;
+}
@@ -19,19 +19,45 @@
 #include "opendcp.h"
 #include "opendcp_image.h"
 
+/*!
+ *  @enum OPENDCP_ENCODER_CAPS
+ *  @abstract Capability flags of an encoder.
+ *  @constant OPENDCP_ENCODER_CAP_THREAD_SAFE Frames may be encoded in several threads at once.
+ *  @constant OPENDCP_ENCODER_CAP_BUFFER The encoder can encode to memory through its encode_buffer hook.
+ *  @constant OPENDCP_ENCODER_CAP_4K The encoder supports the cinema4k profile.
+*/
+enum OPENDCP_ENCODER_CAPS {
+    OPENDCP_ENCODER_CAP_THREAD_SAFE = 0x01,
+    OPENDCP_ENCODER_CAP_BUFFER      = 0x02,
+    OPENDCP_ENCODER_CAP_4K          = 0x04
+};
+
+#define ENCODER_CAPS_FILE   (OPENDCP_ENCODER_CAP_THREAD_SAFE | OPENDCP_ENCODER_CAP_4K)
+#define ENCODER_CAPS_BUFFER (ENCODER_CAPS_FILE | OPENDCP_ENCODER_CAP_BUFFER)
+
+#ifdef HAVE_KAKADU_SDK
+#define ENCODER_CAPS_KAKADU ENCODER_CAPS_BUFFER
+#else
+#define ENCODER_CAPS_KAKADU ENCODER_CAPS_FILE
+#endif
+
 #define FOREACH_OPENDCP_ENCODER(OPENDCP_ENCODER) \
-            OPENDCP_ENCODER(OPENDCP_ENCODER_KAKADU,   kakadu,   "j2c;j2k",  0)  \
-            OPENDCP_ENCODER(OPENDCP_ENCODER_OPENJPEG, openjpeg, "j2c;j2k",  1)  \
-            OPENDCP_ENCODER(OPENDCP_ENCODER_RAGNAROK, ragnarok, "j2c;j2k",  0)  \
-            OPENDCP_ENCODER(OPENDCP_ENCODER_REMOTE,   remote,   "j2c;j2k",  0)  \
-            OPENDCP_ENCODER(OPENDCP_ENCODER_TIFF,     tif,      "tif;tiff", 1)  \
-            OPENDCP_ENCODER(OPENDCP_ENCODER_NONE,     none,     "none",     1)
+            OPENDCP_ENCODER(OPENDCP_ENCODER_KAKADU,   kakadu,   "j2c;j2k",  0, ENCODER_CAPS_KAKADU, &opendcp_kakadu_hooks)    \
+            OPENDCP_ENCODER(OPENDCP_ENCODER_OPENJPEG, openjpeg, "j2c;j2k",  1, ENCODER_CAPS_BUFFER, &opendcp_openjpeg_hooks)  \
+            OPENDCP_ENCODER(OPENDCP_ENCODER_RAGNAROK, ragnarok, "j2c;j2k",  0, ENCODER_CAPS_FILE,   NULL)                     \
+            OPENDCP_ENCODER(OPENDCP_ENCODER_REMOTE,   remote,   "j2c;j2k",  0, ENCODER_CAPS_BUFFER, &opendcp_remote_hooks)    \
+            OPENDCP_ENCODER(OPENDCP_ENCODER_WORKER,   worker,   "j2c;j2k",  0, ENCODER_CAPS_BUFFER, &opendcp_worker_hooks)    \
+            OPENDCP_ENCODER(OPENDCP_ENCODER_NVJPEG2K, nvjpeg2k, "j2c;j2k",  0, ENCODER_CAPS_BUFFER, &opendcp_nvjpeg2k_hooks)  \
+            OPENDCP_ENCODER(OPENDCP_ENCODER_TIFF,     tif,      "tif;tiff", 1, ENCODER_CAPS_FILE,   NULL)                     \
+            OPENDCP_ENCODER(OPENDCP_ENCODER_DPX,      dpx,      "dpx",      1, ENCODER_CAPS_FILE,   NULL)                     \
+            OPENDCP_ENCODER(OPENDCP_ENCODER_RAW,      raw,      "odr",      1, ENCODER_CAPS_FILE,   NULL)                     \
+            OPENDCP_ENCODER(OPENDCP_ENCODER_NONE,     none,     "none",     1, ENCODER_CAPS_FILE,   NULL)
 
-#define GENERATE_ENCODER_ENUM(ENCODER, NAME, EXT, ENABLED) ENCODER,
-#define GENERATE_ENCODER_STRING(ENCODER, NAME, EXT, ENABLED) #NAME,
-#define GENERATE_ENCODER_NAME(ENCODER, NAME, EXT, ENABLED) #ENCODER,
-#define GENERATE_ENCODER_STRUCT(ENCODER, NAME, EXT, ENABLED) { ENCODER, ENABLED, #NAME, EXT, opendcp_encode_ ## NAME },
-#define GENERATE_ENCODER_EXTERN(ENCODER, NAME, EXT, ENABLED) extern int opendcp_encode_ ## NAME(opendcp_t *opendcp, opendcp_image_t *opendcp_image, char *output_file);
+#define GENERATE_ENCODER_ENUM(ENCODER, NAME, EXT, ENABLED, CAPS, HOOKS) ENCODER,
+#define GENERATE_ENCODER_STRING(ENCODER, NAME, EXT, ENABLED, CAPS, HOOKS) #NAME,
+#define GENERATE_ENCODER_NAME(ENCODER, NAME, EXT, ENABLED, CAPS, HOOKS) #ENCODER,
+#define GENERATE_ENCODER_STRUCT(ENCODER, NAME, EXT, ENABLED, CAPS, HOOKS) { ENCODER, ENABLED, #NAME, EXT, opendcp_encode_ ## NAME, CAPS, HOOKS },
+#define GENERATE_ENCODER_EXTERN(ENCODER, NAME, EXT, ENABLED, CAPS, HOOKS) extern int opendcp_encode_ ## NAME(opendcp_t *opendcp, opendcp_image_t *opendcp_image, char *output_file);
 
 /*!
  *  @enum OPENDCP_ENCODERS
@@ -43,6 +69,32 @@ enum OPENDCP_ENCODERS {
 
 FOREACH_OPENDCP_ENCODER(GENERATE_ENCODER_EXTERN)
 
+/*!
+ @typedef opendcp_encoder_hooks_t
+ @abstract optional entry points of an encoder
+ @discussion Every hook may be NULL.
+ @field init Called before a conversion starts, returns OPENDCP_NO_ERROR if the encoder can be used.
+ @field shutdown Called once a conversion has finished.
+ @field encode_buffer Encodes a frame to memory, the codestream is freed by the caller.
+ @field encode_batch Encodes several frames at once, setting a codestream, length and result for each.
+ @field batch_size The number of frames the encoder prefers to be given to encode_batch.
+ @field threads Sets how many threads the encoder may use inside the next frame the calling thread encodes.
+*/
+typedef struct {
+    int  (*init) (opendcp_t *opendcp);
+    void (*shutdown) (opendcp_t *opendcp);
+    int  (*encode_buffer) (opendcp_t *opendcp, opendcp_image_t *opendcp_image, unsigned char **data, int *length);
+    int  (*encode_batch) (opendcp_t *opendcp, opendcp_image_t **images, int count, unsigned char **data, int *lengths, int *results);
+    int  batch_size;
+    void (*threads) (int count);
+} opendcp_encoder_hooks_t;
+
+extern const opendcp_encoder_hooks_t opendcp_kakadu_hooks;
+extern const opendcp_encoder_hooks_t opendcp_openjpeg_hooks;
+extern const opendcp_encoder_hooks_t opendcp_remote_hooks;
+extern const opendcp_encoder_hooks_t opendcp_worker_hooks;
+extern const opendcp_encoder_hooks_t opendcp_nvjpeg2k_hooks;
+
 /*!
  @typedef opendcp_encoder_t
  @abstract opendcp encoder structure
@@ -52,6 +104,8 @@ FOREACH_OPENDCP_ENCODER(GENERATE_ENCODER_EXTERN)
  @field name The string name of this encoder.
  @field extensions A semicolon separated string of file extensions this encoder can service.
  @field encode The encode function that will be invoked by this encoder
+ @field caps The OPENDCP_ENCODER_CAPS flags of this encoder.
+ @field hooks The optional entry points of this encoder, may be NULL.
 */
 typedef struct {
     int  id;
@@ -59,7 +113,25 @@ typedef struct {
     char *name;
     char *extensions;
     int (*encode) (opendcp_t *opendcp, opendcp_image_t *opendcp_image, char *output_file);
+    int  caps;
+    const opendcp_encoder_hooks_t *hooks;
 } opendcp_encoder_t;
 
 int opendcp_encoder_enable(char *ext, char *name, int id);
 opendcp_encoder_t *opendcp_encoder_find(char *name, char *ext, int id);
+opendcp_encoder_t *opendcp_encoder_select(char *ext, int id);
+int  opendcp_encoder_init(opendcp_encoder_t *encoder, opendcp_t *opendcp);
+void opendcp_encoder_shutdown(opendcp_encoder_t *encoder, opendcp_t *opendcp);
+int  opendcp_encoder_batch_size(opendcp_encoder_t *encoder);
+int  opendcp_encoder_has_threads(opendcp_encoder_t *encoder);
+void opendcp_encoder_threads(opendcp_encoder_t *encoder, int count);
+int  opendcp_encoder_thread_share(int threads, int busy, int idle, int pending);
+int  opendcp_encoder_encode_buffer(opendcp_encoder_t *encoder, opendcp_t *opendcp, opendcp_image_t *opendcp_image, unsigned char **data, int *length);
+int  opendcp_encoder_encode_batch(opendcp_encoder_t *encoder, opendcp_t *opendcp, opendcp_image_t **images, int count, unsigned char **data, int *lengths, int *results);
+int opendcp_encode_openjpeg_buffer(opendcp_t *opendcp, opendcp_image_t *opendcp_image, unsigned char **data, int *length);
+int opendcp_encode_kakadu_buffer(opendcp_t *opendcp, opendcp_image_t *opendcp_image, unsigned char **data, int *length);
+const char *opendcp_kakadu_profile(opendcp_t *opendcp);
+int opendcp_transcode_kakadu(opendcp_t *opendcp, const char *sfile, const char *dfile);
+int opendcp_encode_nvjpeg2k_buffer(opendcp_t *opendcp, opendcp_image_t *opendcp_image, unsigned char **data, int *length);
+int opendcp_encode_remote_buffer(opendcp_t *opendcp, opendcp_image_t *opendcp_image, unsigned char **data, int *length);
+int opendcp_encode_worker_buffer(opendcp_t *opendcp, opendcp_image_t *opendcp_image, unsigned char **data, int *length);
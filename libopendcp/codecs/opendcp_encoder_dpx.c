@@ -0,0 +1,181 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "opendcp.h"
+#include "opendcp_image.h"
+
+#define DPX_MAGIC_NUMBER    0x53445058
+#define DPX_HEADER_SIZE     2048
+#define DPX_GENERIC_SIZE    1664
+#define DPX_INDUSTRY_SIZE   384
+#define DPX_DESCRIPTOR_RGB  50
+#define DPX_TRANSFER_USER   0
+
+static void dpx_put_u32(unsigned char *p, uint32_t v) {
+    p[0] = (unsigned char)(v >> 24);
+    p[1] = (unsigned char)(v >> 16);
+    p[2] = (unsigned char)(v >> 8);
+    p[3] = (unsigned char)v;
+}
+
+static void dpx_put_u16(unsigned char *p, uint16_t v) {
+    p[0] = (unsigned char)(v >> 8);
+    p[1] = (unsigned char)v;
+}
+
+static void dpx_put_float(unsigned char *p, float f) {
+    uint32_t v;
+
+    memcpy(&v, &f, sizeof(v));
+    dpx_put_u32(p, v);
+}
+
+/* the file, image and orientation headers, undefined fields are all ones */
+static void dpx_header(unsigned char *h, const char *dfile, int w, int ht, uint32_t file_size) {
+    memset(h, 0xff, DPX_HEADER_SIZE);
+
+    /* file information */
+    dpx_put_u32(h, DPX_MAGIC_NUMBER);
+    dpx_put_u32(h + 4, DPX_HEADER_SIZE);
+    memset(h + 8, 0, 8);
+    memcpy(h + 8, "V2.0", 4);
+    dpx_put_u32(h + 16, file_size);
+    dpx_put_u32(h + 20, 1);
+    dpx_put_u32(h + 24, DPX_GENERIC_SIZE);
+    dpx_put_u32(h + 28, DPX_INDUSTRY_SIZE);
+    dpx_put_u32(h + 32, 0);
+    memset(h + 36, 0, 624);
+    snprintf((char *)h + 36, 100, "%s", dfile);
+    snprintf((char *)h + 160, 100, "%s", OPENDCP_NAME);
+
+    /* image information, one element of pixel interleaved 16 bit rgb */
+    dpx_put_u16(h + 768, 0);
+    dpx_put_u16(h + 770, 1);
+    dpx_put_u32(h + 772, w);
+    dpx_put_u32(h + 776, ht);
+    dpx_put_u32(h + 780, 0);
+    dpx_put_u32(h + 784, 0);
+    dpx_put_float(h + 788, 0.0f);
+    dpx_put_u32(h + 792, 65535);
+    dpx_put_float(h + 796, 1.0f);
+    h[800] = DPX_DESCRIPTOR_RGB;
+    h[801] = DPX_TRANSFER_USER;
+    h[802] = DPX_TRANSFER_USER;
+    h[803] = 16;
+    dpx_put_u16(h + 804, 0);
+    dpx_put_u16(h + 806, 0);
+    dpx_put_u32(h + 808, DPX_HEADER_SIZE);
+    dpx_put_u32(h + 812, 0);
+    dpx_put_u32(h + 816, 0);
+    memset(h + 820, 0, 32);
+
+    /* the text fields of the orientation and film headers */
+    memset(h + 1432, 0, 188);
+    memset(h + 1664, 0, 48);
+}
+
+/*!
+ @function opendcp_encode_dpx
+ @abstract Writes an image as a 16 bit RGB DPX file.
+ @discussion Samples of any precision are scaled to 16 bits. The header
+     and pixels are built in one buffer and written at once, so the frames
+     of several threads do not interleave small writes.
+ @param opendcp An opendcp_t context struct
+ @param image The source image
+ @param dfile The output file
+ @return An OPENDCP_ERROR value
+*/
+int opendcp_encode_dpx(opendcp_t *opendcp, opendcp_image_t *image, const char *dfile) {
+    size_t        size = DPX_HEADER_SIZE + (size_t)image->w * image->h * 6;
+    unsigned char *data, *p;
+    int           *row;
+    int           x, y, c, max;
+    FILE          *fp;
+    int           result = OPENDCP_NO_ERROR;
+
+    UNUSED(opendcp);
+
+    if (image->n_components < 3 || size > 0xffffffffUL) {
+        OPENDCP_LOG(LOG_ERROR, "can not write a dpx of this image: %s", dfile);
+        return OPENDCP_ERROR;
+    }
+
+    data = malloc(size);
+    row  = malloc((size_t)image->w * 3 * sizeof(int));
+
+    if (!data || !row) {
+        OPENDCP_LOG(LOG_ERROR, "dpx memory allocation error: %s", dfile);
+        free(data);
+        free(row);
+        return OPENDCP_ERROR;
+    }
+
+    dpx_header(data, dfile, image->w, image->h, (uint32_t)size);
+
+    max = (1 << image->precision) - 1;
+    p   = data + DPX_HEADER_SIZE;
+
+    /* the rows of the three components are read first, then interleaved */
+    for (y = 0; y < image->h; y++) {
+        for (c = 0; c < 3; c++) {
+            opendcp_image_get_row(image, c, y, &row[c * image->w]);
+        }
+
+        for (x = 0; x < image->w; x++) {
+            for (c = 0; c < 3; c++) {
+                int v = row[c * image->w + x];
+
+                v = v < 0 ? 0 : (v > max ? max : v);
+                dpx_put_u16(p, (uint16_t)(((uint32_t)v * 65535 + max / 2) / max));
+                p += 2;
+            }
+        }
+    }
+
+    free(row);
+
+    fp = fopen(dfile, "wb");
+
+    OPENDCP_LOG(LOG_DEBUG, "creating file %s for writing", dfile);
+
+    if (!fp) {
+        OPENDCP_LOG(LOG_ERROR, "failed to open file %s for writing", dfile);
+        free(data);
+        return OPENDCP_ERROR;
+    }
+
+    if (fwrite(data, 1, size, fp) != size) {
+        result = OPENDCP_ERROR;
+    }
+
+    if (fclose(fp)) {
+        result = OPENDCP_ERROR;
+    }
+
+    free(data);
+
+    if (result != OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_ERROR, "failed to write dpx %s", dfile);
+    }
+
+    return result;
+}
@@ -17,10 +17,99 @@
 */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <libgen.h>
+#include <unistd.h>
+#include <pthread.h>
+#ifdef __linux__
+#include <sys/vfs.h>
+#endif
 #include "opendcp.h"
 #include "opendcp_encoder.h"
 
+#ifndef HAVE_KAKADU_SDK
+#define TMPFS_MAGIC 0x01021994
+#define SHM_PATH    "/dev/shm"
+
+static pthread_once_t kakadu_shm_once = PTHREAD_ONCE_INIT;
+static int            kakadu_shm;
+
+/* use the ram backed shared memory mount when there is one */
+static void kakadu_shm_init(void) {
+#ifdef __linux__
+    struct statfs fs;
+
+    kakadu_shm = !statfs(SHM_PATH, &fs) && fs.f_type == TMPFS_MAGIC && !access(SHM_PATH, W_OK);
+#endif
+}
+
+/* the directory temporary tiffs are staged in, tmp_path if set */
+static const char *kakadu_tmp_path(opendcp_t *opendcp) {
+    if (opendcp->tmp_path) {
+        return opendcp->tmp_path;
+    }
+
+    pthread_once(&kakadu_shm_once, kakadu_shm_init);
+
+    return kakadu_shm ? SHM_PATH : ".";
+}
+#endif
+
+/*
+   HTJ2K mezzanine. Intermediates and proxies need not be DCI compliant, so
+   with j2k.htj2k their frames are coded with the high throughput block
+   coder of part 15, several times faster than the part 1 coder. The rest
+   of the codestream keeps the structure and rate limits of the cinema
+   profile, so kdu_transcode can re-code the code blocks with the part 1
+   coder at mastering without touching the coefficients.
+*/
+#define KAKADU_HT_STRUCTURE "Cmodes=HT Cblk={32,32} Corder=CPRL Cprecincts={256,256},{128,128}"
+
+/*!
+ @function opendcp_kakadu_profile
+ @abstract Returns the kakadu parameters of the codestream structure.
+ @discussion The DCI profile, or with j2k.htj2k the cinema structure coded
+     with the HT block coder. The parameters are separated by spaces.
+ @param opendcp An opendcp_t context struct
+ @return The parameters, a static string.
+*/
+const char *opendcp_kakadu_profile(opendcp_t *opendcp) {
+    if (opendcp->j2k.htj2k) {
+        return opendcp->cinema_profile == DCP_CINEMA2K ? KAKADU_HT_STRUCTURE " Clevels=5" : KAKADU_HT_STRUCTURE " Clevels=6";
+    }
+
+    return opendcp->cinema_profile == DCP_CINEMA2K ? "Sprofile=CINEMA2K" : "Sprofile=CINEMA4K";
+}
+
+/*!
+ @function opendcp_transcode_kakadu
+ @abstract Transcodes an HTJ2K codestream to a DCI compliant one.
+ @discussion The code blocks are re-coded with the part 1 block coder by
+     kdu_transcode, the coefficients and so the picture are unchanged.
+     May be called from several threads at once.
+ @param opendcp An opendcp_t context struct
+ @param sfile The HTJ2K codestream
+ @param dfile The output file
+ @return An OPENDCP_ERROR value
+*/
+int opendcp_transcode_kakadu(opendcp_t *opendcp, const char *sfile, const char *dfile) {
+    char cmd[MAX_PATH_LENGTH * 2 + 128];
+    FILE *cmdfp;
+
+    snprintf(cmd, sizeof(cmd), "kdu_transcode -i \"%s\" -o \"%s\" Cmodes=0 Sprofile=%s",
+             sfile, dfile, opendcp->cinema_profile == DCP_CINEMA2K ? "CINEMA2K" : "CINEMA4K");
+
+    OPENDCP_LOG(LOG_DEBUG, cmd);
+
+    cmdfp = popen(cmd, "r");
+
+    if (!cmdfp || pclose(cmdfp)) {
+        return OPENDCP_ERROR;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
 /*!
  @function opendcp_encoder_kakadu
  @abstract Encode image to file.
@@ -31,13 +120,33 @@
  @return An OPENDCP_ERROR value
 */
 int opendcp_encode_kakadu(opendcp_t *opendcp, opendcp_image_t *simage, char *dfile) {
+#ifdef HAVE_KAKADU_SDK
+    unsigned char *data;
+    int length;
+    FILE *fp;
+    int result;
+
+    if (opendcp_encode_kakadu_buffer(opendcp, simage, &data, &length) != OPENDCP_NO_ERROR) {
+        return OPENDCP_ERROR;
+    }
+
+    fp = fopen(dfile, "wb");
+    result = fp && fwrite(data, 1, length, fp) == (size_t)length ? OPENDCP_NO_ERROR : OPENDCP_ERROR;
+
+    if (fp) {
+        fclose(fp);
+    }
+
+    free(data);
+
+    return result;
+#else
     int result;
     int max_cs_len;
     int max_comp_size;
     char k_lengths[128];
-    char temp_file[255];
-    char temp_path[255];
-    char cmd[512];
+    char temp_file[MAX_PATH_LENGTH];
+    char cmd[MAX_PATH_LENGTH * 2 + 256];
     FILE *cmdfp = NULL;
     int bw;
 
@@ -47,13 +156,7 @@ int opendcp_encode_kakadu(opendcp_t *opendcp, opendcp_image_t *simage, char *dfi
         bw = MAX_DCP_JPEG_BITRATE;
     }
 
-    if (opendcp->tmp_path == NULL) {
-        sprintf(temp_path,"./");
-    } else {
-        sprintf(temp_path,"%s", opendcp->tmp_path);
-    }
-
-    sprintf(temp_file, "%s/tmp_%s.tif", temp_path, basename(dfile));
+    snprintf(temp_file, sizeof(temp_file), "%s/tmp_%d_%s.tif", kakadu_tmp_path(opendcp), (int)getpid(), basename(dfile));
     OPENDCP_LOG(LOG_DEBUG, "writing temporary tif %s", temp_file);
     result = opendcp_encode_tif(opendcp, simage, temp_file);
 
@@ -74,11 +177,7 @@ int opendcp_encode_kakadu(opendcp_t *opendcp, opendcp_image_t *simage, char *dfi
 
     sprintf(k_lengths,"Creslengths=%d Creslengths:C0=%d,%d Creslengths:C1=%d,%d Creslengths:C2=%d,%d",max_cs_len,max_cs_len,max_comp_size,max_cs_len,max_comp_size,max_cs_len,max_comp_size);
 
-    if (opendcp->cinema_profile == DCP_CINEMA2K) {
-        sprintf(cmd,"kdu_compress -i \"%s\" -o \"%s\" Sprofile=CINEMA2K %s -quiet",temp_file, dfile, k_lengths);
-    } else {
-        sprintf(cmd,"kdu_compress -i \"%s\" -o \"%s\" Sprofile=CINEMA4K %s -quiet",temp_file, dfile, k_lengths);
-    }
+    snprintf(cmd, sizeof(cmd), "kdu_compress -i \"%s\" -o \"%s\" %s %s -quiet", temp_file, dfile, opendcp_kakadu_profile(opendcp), k_lengths);
 
     OPENDCP_LOG(LOG_DEBUG, cmd);
 
@@ -92,4 +191,18 @@ int opendcp_encode_kakadu(opendcp_t *opendcp, opendcp_image_t *simage, char *dfi
     }
 
     return OPENDCP_NO_ERROR;
+#endif
 }
+
+const opendcp_encoder_hooks_t opendcp_kakadu_hooks = {
+    NULL,
+    NULL,
+#ifdef HAVE_KAKADU_SDK
+    opendcp_encode_kakadu_buffer,
+#else
+    NULL,
+#endif
+    NULL,
+    1,
+    NULL
+};
@@ -0,0 +1,270 @@
+/*
+     OpenDCP: Builds Digital Cinema Packages
+     Copyright (c) 2010-2013 Terrence Meiczinger, All Rights Reserved
+
+     This program is free software: you can redistribute it and/or modify
+     it under the terms of the GNU General Public License as published by
+     the Free Software Foundation, either version 3 of the License, or
+     (at your option) any later version.
+
+     This program is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU General Public License for more details.
+
+     You should have received a copy of the GNU General Public License
+     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include <kdu_messaging.h>
+#include <kdu_compressed.h>
+#include <kdu_sample_processing.h>
+#include <kdu_stripe_compressor.h>
+
+#include "opendcp.h"
+#include "opendcp_image.h"
+
+extern "C" {
+#include "opendcp_encoder.h"
+}
+
+using namespace kdu_core;
+using namespace kdu_supp;
+
+/* kakadu reports errors through a message object, turn them into exceptions */
+class kakadu_error_handler : public kdu_message {
+public:
+    kakadu_error_handler() {
+        message[0] = '\0';
+    }
+
+    void put_text(const char *text) {
+        size_t n = strlen(message);
+        snprintf(message + n, sizeof(message) - n, "%s", text);
+    }
+
+    void flush(bool end_of_message) {
+        if (end_of_message) {
+            OPENDCP_LOG(LOG_ERROR, "kakadu: %s", message);
+            message[0] = '\0';
+            throw KDU_ERROR_EXCEPTION;
+        }
+    }
+
+private:
+    char message[1024];
+};
+
+/* accumulates the codestream in memory */
+class kakadu_buffer_target : public kdu_compressed_target {
+public:
+    kakadu_buffer_target() : data(NULL), length(0), capacity(0) {}
+
+    bool write(const kdu_byte *buf, int num_bytes) {
+        if (length + num_bytes > capacity) {
+            size_t        size = capacity ? capacity : 1024 * 1024;
+            unsigned char *ptr;
+
+            while (length + num_bytes > size) {
+                size *= 2;
+            }
+
+            ptr = (unsigned char *)realloc(data, size);
+
+            if (!ptr) {
+                return false;
+            }
+
+            data     = ptr;
+            capacity = size;
+        }
+
+        memcpy(data + length, buf, num_bytes);
+        length += num_bytes;
+
+        return true;
+    }
+
+    unsigned char *data;
+    size_t        length;
+    size_t        capacity;
+};
+
+/*
+   Each encoding thread keeps a compressor and a kakadu thread environment,
+   so the worker threads kakadu starts are reused from frame to frame. The
+   processors are shared out between the opendcp threads.
+*/
+typedef struct {
+    kdu_thread_env        env;
+    kdu_stripe_compressor compressor;
+} kakadu_context_t;
+
+static pthread_once_t       kakadu_once = PTHREAD_ONCE_INIT;
+static pthread_key_t        kakadu_context_key;
+static kakadu_error_handler kakadu_errors;
+
+static void kakadu_context_free(void *arg) {
+    kakadu_context_t *context = (kakadu_context_t *)arg;
+
+    if (context->env.exists()) {
+        context->env.destroy();
+    }
+
+    delete context;
+}
+
+static void kakadu_init(void) {
+    pthread_key_create(&kakadu_context_key, kakadu_context_free);
+    kdu_customize_errors(&kakadu_errors);
+}
+
+static kakadu_context_t *kakadu_context(opendcp_t *opendcp) {
+    kakadu_context_t *context;
+    int              threads, i;
+
+    pthread_once(&kakadu_once, kakadu_init);
+
+    context = (kakadu_context_t *)pthread_getspecific(kakadu_context_key);
+
+    if (context) {
+        return context;
+    }
+
+    context = new kakadu_context_t;
+    threads = kdu_get_num_processors() / (opendcp->threads > 0 ? opendcp->threads : 1);
+
+    context->env.create();
+
+    for (i = 1; i < threads; i++) {
+        if (!context->env.add_thread()) {
+            break;
+        }
+    }
+
+    pthread_setspecific(kakadu_context_key, context);
+
+    OPENDCP_LOG(LOG_DEBUG, "kakadu encoder context set up with %d threads", context->env.get_num_threads());
+
+    return context;
+}
+
+/*!
+ @function opendcp_encode_kakadu_buffer
+ @abstract Encode an image to a memory buffer with the Kakadu SDK.
+ @discussion The image is compressed in process, from the component planes
+     of the opendcp image, with the same profile and rate limits as the
+     kdu_compress encoder.
+ @param opendcp An opendcp_t context struct
+ @param opendcp_image The source image, with int samples
+ @param data Receives the codestream, to be freed by the caller
+ @param length Receives the codestream length
+ @return An OPENDCP_ERROR value
+*/
+extern "C" int opendcp_encode_kakadu_buffer(opendcp_t *opendcp, opendcp_image_t *opendcp_image, unsigned char **data, int *length) {
+    kakadu_context_t     *context;
+    kakadu_buffer_target target;
+    kdu_codestream       codestream;
+    siz_params           siz;
+    kdu_params           *siz_ref = &siz;
+    kdu_int32            *buffers[4];
+    int                  heights[4], gaps[4], rows[4], precisions[4];
+    bool                 is_signed[4];
+    kdu_long             layer_size;
+    char                 option[64];
+    char                 profile[128];
+    char                 *token, *save;
+    int                  max_cs_len, max_comp_size;
+    int                  bw, c;
+
+    if (opendcp_image->sample_type != SAMPLE_TYPE_INT32 || opendcp_image->n_components > 4) {
+        OPENDCP_LOG(LOG_ERROR, "kakadu encoder requires an int image");
+        return OPENDCP_ERROR;
+    }
+
+    if (opendcp->j2k.bw) {
+        bw = opendcp->j2k.bw;
+    } else {
+        bw = MAX_DCP_JPEG_BITRATE;
+    }
+
+    /* set the max image and component sizes based on frame_rate */
+    max_cs_len = ((float)bw)/8/opendcp->frame_rate;
+
+    /* adjust cs for 3D */
+    if (opendcp->stereoscopic) {
+        max_cs_len = max_cs_len/2;
+    }
+
+    max_comp_size = ((float)max_cs_len)/1.25;
+    layer_size    = max_cs_len;
+
+    context = kakadu_context(opendcp);
+
+    try {
+        siz.set(Scomponents, 0, 0, opendcp_image->n_components);
+        siz.set(Sdims, 0, 0, opendcp_image->h);
+        siz.set(Sdims, 0, 1, opendcp_image->w);
+        siz.set(Sprecision, 0, 0, opendcp_image->precision);
+        siz.set(Ssigned, 0, 0, false);
+        siz_ref->finalize();
+
+        codestream.create(&siz, &target, NULL, 0, 0, &context->env);
+
+        /* the profile holds several parameters, parse_string takes one at a time */
+        snprintf(profile, sizeof(profile), "%s", opendcp_kakadu_profile(opendcp));
+
+        for (token = strtok_r(profile, " ", &save); token; token = strtok_r(NULL, " ", &save)) {
+            codestream.access_siz()->parse_string(token);
+        }
+
+        snprintf(option, sizeof(option), "Creslengths=%d", max_cs_len);
+        codestream.access_siz()->parse_string(option);
+
+        for (c = 0; c < opendcp_image->n_components; c++) {
+            snprintf(option, sizeof(option), "Creslengths:C%d=%d,%d", c, max_cs_len, max_comp_size);
+            codestream.access_siz()->parse_string(option);
+        }
+
+        codestream.access_siz()->finalize_all();
+
+        for (c = 0; c < opendcp_image->n_components; c++) {
+            buffers[c]    = (kdu_int32 *)opendcp_image->component[c].data;
+            heights[c]    = opendcp_image->h;
+            gaps[c]       = 1;
+            rows[c]       = opendcp_image->component[c].stride;
+            precisions[c] = opendcp_image->precision;
+            is_signed[c]  = false;
+        }
+
+        context->compressor.start(codestream, 1, &layer_size, NULL, 0, false, false, false,
+                                  0.0, 0, false, &context->env);
+        context->compressor.push_stripe(buffers, heights, gaps, rows, precisions, is_signed);
+        context->compressor.finish();
+        codestream.destroy();
+    }
+    catch (kdu_exception e) {
+        context->env.handle_exception(e);
+
+        if (codestream.exists()) {
+            codestream.destroy();
+        }
+
+        /* the compressor may be left mid frame, start the next frame afresh */
+        pthread_setspecific(kakadu_context_key, NULL);
+        kakadu_context_free(context);
+        free(target.data);
+
+        return OPENDCP_ERROR;
+    }
+
+    *data   = target.data;
+    *length = target.length;
+
+    return OPENDCP_NO_ERROR;
+}
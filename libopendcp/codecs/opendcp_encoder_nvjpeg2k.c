@@ -0,0 +1,387 @@
+/*
+     OpenDCP: Builds Digital Cinema Packages
+     Copyright (c) 2010-2013 Terrence Meiczinger, All Rights Reserved
+
+     This program is free software: you can redistribute it and/or modify
+     it under the terms of the GNU General Public License as published by
+     the Free Software Foundation, either version 3 of the License, or
+     (at your option) any later version.
+
+     This program is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU General Public License for more details.
+
+     You should have received a copy of the GNU General Public License
+     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "opendcp.h"
+#include "opendcp_image.h"
+#include "opendcp_encoder.h"
+
+#ifdef HAVE_NVJPEG2K
+#include <cuda_runtime.h>
+#include <nvjpeg2k.h>
+
+#define NVJPEG2K_MAX_COMPONENTS 3
+#define NVJPEG2K_PSNR_START     50.0    /* quality of the first attempt at a frame */
+#define NVJPEG2K_PSNR_MIN       20.0
+#define NVJPEG2K_PSNR_STEP      2.0
+
+/*
+   Each encoding thread owns a CUDA stream, an encoder state and its device
+   planes, with pinned host planes to stage the samples in, so uploads are
+   asynchronous and several threads keep the GPU busy with their frames at
+   once. The buffers are kept until the frame geometry changes.
+
+   nvjpeg2k has no byte rate control, only a target PSNR. The context
+   remembers the PSNR that last fit the frame budget and starts the next
+   frame from it, lowering it until the codestream fits.
+*/
+typedef struct {
+    nvjpeg2kEncoder_t      encoder;
+    nvjpeg2kEncodeState_t  state;
+    nvjpeg2kEncodeParams_t params;
+    cudaStream_t           stream;
+    int                    w;
+    int                    h;
+    int                    n_components;
+    uint16_t               *host[NVJPEG2K_MAX_COMPONENTS];
+    void                   *device[NVJPEG2K_MAX_COMPONENTS];
+    size_t                 pitch[NVJPEG2K_MAX_COMPONENTS];
+    double                 psnr;
+} nvjpeg2k_context_t;
+
+static pthread_once_t nvjpeg2k_once = PTHREAD_ONCE_INIT;
+static pthread_key_t  nvjpeg2k_context_key;
+
+static void nvjpeg2k_planes_free(nvjpeg2k_context_t *context) {
+    int c;
+
+    for (c = 0; c < NVJPEG2K_MAX_COMPONENTS; c++) {
+        if (context->host[c]) {
+            cudaFreeHost(context->host[c]);
+            context->host[c] = NULL;
+        }
+
+        if (context->device[c]) {
+            cudaFree(context->device[c]);
+            context->device[c] = NULL;
+        }
+    }
+
+    context->w = context->h = context->n_components = 0;
+}
+
+static void nvjpeg2k_context_free(void *arg) {
+    nvjpeg2k_context_t *context = arg;
+
+    nvjpeg2k_planes_free(context);
+
+    if (context->params) {
+        nvjpeg2kEncodeParamsDestroy(context->params);
+    }
+
+    if (context->state) {
+        nvjpeg2kEncodeStateDestroy(context->state);
+    }
+
+    if (context->encoder) {
+        nvjpeg2kEncoderDestroy(context->encoder);
+    }
+
+    if (context->stream) {
+        cudaStreamDestroy(context->stream);
+    }
+
+    free(context);
+}
+
+static void nvjpeg2k_init(void) {
+    pthread_key_create(&nvjpeg2k_context_key, nvjpeg2k_context_free);
+}
+
+static nvjpeg2k_context_t *nvjpeg2k_context(opendcp_image_t *image) {
+    nvjpeg2k_context_t *context;
+    int c;
+
+    pthread_once(&nvjpeg2k_once, nvjpeg2k_init);
+
+    context = pthread_getspecific(nvjpeg2k_context_key);
+
+    if (!context) {
+        context = calloc(1, sizeof(nvjpeg2k_context_t));
+
+        if (!context) {
+            return NULL;
+        }
+
+        if (cudaStreamCreateWithFlags(&context->stream, cudaStreamNonBlocking) != cudaSuccess ||
+            nvjpeg2kEncoderCreateSimple(&context->encoder) != NVJPEG2K_STATUS_SUCCESS ||
+            nvjpeg2kEncodeStateCreate(context->encoder, &context->state) != NVJPEG2K_STATUS_SUCCESS ||
+            nvjpeg2kEncodeParamsCreate(&context->params) != NVJPEG2K_STATUS_SUCCESS) {
+            OPENDCP_LOG(LOG_ERROR, "could not initialize the nvjpeg2k encoder");
+            nvjpeg2k_context_free(context);
+            return NULL;
+        }
+
+        context->psnr = NVJPEG2K_PSNR_START;
+        pthread_setspecific(nvjpeg2k_context_key, context);
+    }
+
+    if (context->w == image->w && context->h == image->h && context->n_components == image->n_components) {
+        return context;
+    }
+
+    nvjpeg2k_planes_free(context);
+
+    for (c = 0; c < image->n_components; c++) {
+        if (cudaMallocHost((void **)&context->host[c], (size_t)image->w * image->h * sizeof(uint16_t)) != cudaSuccess ||
+            cudaMallocPitch(&context->device[c], &context->pitch[c], image->w * sizeof(uint16_t), image->h) != cudaSuccess) {
+            OPENDCP_LOG(LOG_ERROR, "could not allocate nvjpeg2k buffers");
+            nvjpeg2k_planes_free(context);
+            return NULL;
+        }
+    }
+
+    context->w            = image->w;
+    context->h            = image->h;
+    context->n_components = image->n_components;
+
+    OPENDCP_LOG(LOG_DEBUG, "nvjpeg2k encoder context set up for %dx%d", image->w, image->h);
+
+    return context;
+}
+
+static int nvjpeg2k_configure(opendcp_t *opendcp, nvjpeg2k_context_t *context, opendcp_image_t *image) {
+    nvjpeg2kImageComponentInfo_t info[NVJPEG2K_MAX_COMPONENTS];
+    nvjpeg2kEncodeConfig_t       config;
+    int c;
+
+    memset(&config, 0, sizeof(config));
+
+    for (c = 0; c < image->n_components; c++) {
+        info[c].component_width  = image->w;
+        info[c].component_height = image->h;
+        info[c].precision        = image->precision;
+        info[c].sgn              = 0;
+    }
+
+    /* the cinema settings of set_cinema_encoder_parameters */
+    config.stream_type     = NVJPEG2K_STREAM_J2K;
+    config.color_space     = NVJPEG2K_COLORSPACE_UNKNOWN;
+    config.image_width     = image->w;
+    config.image_height    = image->h;
+    config.num_components  = image->n_components;
+    config.image_comp_info = info;
+    config.code_block_w    = 32;
+    config.code_block_h    = 32;
+    config.irreversible    = 1;
+    config.mct_mode        = image->n_components >= 3;
+    config.prog_order      = NVJPEG2K_CPRL;
+    config.num_resolutions = opendcp->cinema_profile == DCP_CINEMA4K ? 7 : 6;
+    config.rsiz            = opendcp->cinema_profile == DCP_CINEMA4K ? 4 : 3;
+
+    if (nvjpeg2kEncodeParamsSetEncodeConfig(context->params, &config) != NVJPEG2K_STATUS_SUCCESS) {
+        OPENDCP_LOG(LOG_ERROR, "nvjpeg2k rejected the encode settings");
+        return OPENDCP_ERROR;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* encode at the context psnr, returns the codestream length or -1 */
+static long nvjpeg2k_encode_frame(nvjpeg2k_context_t *context, nvjpeg2kImage_t *input, unsigned char **data) {
+    size_t length = 0;
+
+    if (nvjpeg2kEncodeParamsSetQuality(context->params, context->psnr) != NVJPEG2K_STATUS_SUCCESS ||
+        nvjpeg2kEncode(context->encoder, context->state, context->params, input, context->stream) != NVJPEG2K_STATUS_SUCCESS ||
+        nvjpeg2kEncodeRetrieveBitstream(context->encoder, context->state, NULL, &length, context->stream) != NVJPEG2K_STATUS_SUCCESS) {
+        return -1;
+    }
+
+    *data = malloc(length);
+
+    if (!*data) {
+        return -1;
+    }
+
+    if (nvjpeg2kEncodeRetrieveBitstream(context->encoder, context->state, *data, &length, context->stream) != NVJPEG2K_STATUS_SUCCESS ||
+        cudaStreamSynchronize(context->stream) != cudaSuccess) {
+        free(*data);
+        *data = NULL;
+        return -1;
+    }
+
+    return length;
+}
+#endif
+
+/* check for a GPU before the first frame */
+static int nvjpeg2k_init_encoder(opendcp_t *opendcp) {
+#ifdef HAVE_NVJPEG2K
+    int devices = 0;
+
+    UNUSED(opendcp);
+
+    if (cudaGetDeviceCount(&devices) != cudaSuccess || devices < 1) {
+        OPENDCP_LOG(LOG_ERROR, "no CUDA device found for the nvjpeg2k encoder");
+        return OPENDCP_ERROR;
+    }
+
+    return OPENDCP_NO_ERROR;
+#else
+    UNUSED(opendcp);
+
+    OPENDCP_LOG(LOG_ERROR, "OpenDCP was built without nvjpeg2k support");
+
+    return OPENDCP_ERROR;
+#endif
+}
+
+/*!
+ @function opendcp_encode_nvjpeg2k_buffer
+ @abstract Encode an image to a memory buffer on the GPU with nvjpeg2k.
+ @param opendcp An opendcp_t context struct
+ @param opendcp_image The source image, with int samples
+ @param data Receives the codestream, to be freed by the caller
+ @param length Receives the codestream length
+ @return An OPENDCP_ERROR value
+*/
+int opendcp_encode_nvjpeg2k_buffer(opendcp_t *opendcp, opendcp_image_t *opendcp_image, unsigned char **data, int *length) {
+#ifdef HAVE_NVJPEG2K
+    nvjpeg2k_context_t *context;
+    nvjpeg2kImage_t    input;
+    unsigned char      *out = NULL;
+    long               size;
+    int                max_cs_len, bw;
+    int                c, x, y;
+
+    if (opendcp_image->sample_type != SAMPLE_TYPE_INT32 || opendcp_image->n_components > NVJPEG2K_MAX_COMPONENTS) {
+        OPENDCP_LOG(LOG_ERROR, "nvjpeg2k encoder requires an int image of up to 3 components");
+        return OPENDCP_ERROR;
+    }
+
+    if (opendcp->j2k.bw) {
+        bw = opendcp->j2k.bw;
+    } else {
+        bw = MAX_DCP_JPEG_BITRATE;
+    }
+
+    /* set the max image size based on frame_rate */
+    max_cs_len = ((float)bw)/8/opendcp->frame_rate;
+
+    /* adjust cs for 3D */
+    if (opendcp->stereoscopic) {
+        max_cs_len = max_cs_len/2;
+    }
+
+    context = nvjpeg2k_context(opendcp_image);
+
+    if (!context || nvjpeg2k_configure(opendcp, context, opendcp_image) != OPENDCP_NO_ERROR) {
+        return OPENDCP_ERROR;
+    }
+
+    /* stage the planes as 16-bit samples and upload them */
+    for (c = 0; c < opendcp_image->n_components; c++) {
+        const opendcp_image_component_t *component = &opendcp_image->component[c];
+        uint16_t *d = context->host[c];
+
+        for (y = 0; y < opendcp_image->h; y++) {
+            const int *s = component->data + (size_t)y * component->stride;
+
+            for (x = 0; x < opendcp_image->w; x++) {
+                *d++ = s[x];
+            }
+        }
+
+        if (cudaMemcpy2DAsync(context->device[c], context->pitch[c], context->host[c], opendcp_image->w * sizeof(uint16_t),
+                              opendcp_image->w * sizeof(uint16_t), opendcp_image->h, cudaMemcpyHostToDevice,
+                              context->stream) != cudaSuccess) {
+            OPENDCP_LOG(LOG_ERROR, "could not upload frame to the GPU");
+            return OPENDCP_ERROR;
+        }
+    }
+
+    input.pixel_data     = context->device;
+    input.pitch_in_bytes = context->pitch;
+    input.pixel_type     = NVJPEG2K_UINT16;
+    input.num_components = opendcp_image->n_components;
+
+    while ((size = nvjpeg2k_encode_frame(context, &input, &out)) > max_cs_len && context->psnr > NVJPEG2K_PSNR_MIN) {
+        free(out);
+        out = NULL;
+        context->psnr -= NVJPEG2K_PSNR_STEP;
+        OPENDCP_LOG(LOG_DEBUG, "nvjpeg2k frame over budget, retrying at %.1f dB", context->psnr);
+    }
+
+    if (size < 0 || size > max_cs_len) {
+        OPENDCP_LOG(LOG_ERROR, "nvjpeg2k encode failed");
+        free(out);
+        return OPENDCP_ERROR;
+    }
+
+    /* frames well under budget let the next one aim higher */
+    if (size < max_cs_len * 0.75 && context->psnr < NVJPEG2K_PSNR_START) {
+        context->psnr += NVJPEG2K_PSNR_STEP / 2;
+    }
+
+    *data   = out;
+    *length = size;
+
+    return OPENDCP_NO_ERROR;
+#else
+    UNUSED(opendcp);
+    UNUSED(opendcp_image);
+    UNUSED(data);
+    UNUSED(length);
+
+    OPENDCP_LOG(LOG_ERROR, "OpenDCP was built without nvjpeg2k support");
+
+    return OPENDCP_ERROR;
+#endif
+}
+
+/*!
+ @function opendcp_encode_nvjpeg2k
+ @abstract Encode image to file on the GPU with nvjpeg2k.
+ @param opendcp An opendcp_t context struct
+ @param opendcp_image The source image memory buffer to encoder
+ @param dfile The output file
+ @return An OPENDCP_ERROR value
+*/
+int opendcp_encode_nvjpeg2k(opendcp_t *opendcp, opendcp_image_t *opendcp_image, char *dfile) {
+    unsigned char *data;
+    int length;
+    FILE *fp;
+    int result;
+
+    if (opendcp_encode_nvjpeg2k_buffer(opendcp, opendcp_image, &data, &length) != OPENDCP_NO_ERROR) {
+        return OPENDCP_ERROR;
+    }
+
+    fp = fopen(dfile, "wb");
+    result = fp && fwrite(data, 1, length, fp) == (size_t)length ? OPENDCP_NO_ERROR : OPENDCP_ERROR;
+
+    if (fp) {
+        fclose(fp);
+    }
+
+    free(data);
+
+    return result;
+}
+
+const opendcp_encoder_hooks_t opendcp_nvjpeg2k_hooks = {
+    nvjpeg2k_init_encoder,
+    NULL,
+    opendcp_encode_nvjpeg2k_buffer,
+    NULL,
+    1,
+    NULL
+};
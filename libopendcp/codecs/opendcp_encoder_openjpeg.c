@@ -21,27 +21,28 @@
 #include <stdlib.h>
 #include <openjpeg.h>
 #include <stdbool.h>
-#ifdef OPENMP
-#include <omp.h>
-#endif
+#include <pthread.h>
+#include <sys/stat.h>
 #include "opendcp.h"
+#include "opendcp_encoder.h"
 
 void set_cinema_encoder_parameters(opendcp_t *opendcp, opj_cparameters_t *parameters);
-static int initialize_4K_poc(opj_poc_t *POC, int numres);
+static int initialize_4K_poc(opj_poc_t *POC, int numres, int numlayers);
 int opendcp_to_opj(opendcp_image_t *opendcp, opj_image_t **opj_ptr);
+static void opendcp_opj_release(opendcp_image_t *opendcp, opj_image_t *opj);
 
-static int initialize_4K_poc(opj_poc_t *POC, int numres) {
+static int initialize_4K_poc(opj_poc_t *POC, int numres, int numlayers) {
     POC[0].tile    = 1;
     POC[0].resno0  = 0;
     POC[0].compno0 = 0;
-    POC[0].layno1  = 1;
+    POC[0].layno1  = numlayers;
     POC[0].resno1  = numres-1;
     POC[0].compno1 = 3;
     POC[0].prg1    = OPJ_CPRL;
     POC[1].tile    = 1;
     POC[1].resno0  = numres-1;
     POC[1].compno0 = 0;
-    POC[1].layno1  = 1;
+    POC[1].layno1  = numlayers;
     POC[1].resno1  = numres;
     POC[1].compno1 = 3;
     POC[1].prg1    = OPJ_CPRL;
@@ -81,26 +82,51 @@ void set_cinema_encoder_parameters(opendcp_t *opendcp, opj_cparameters_t *parame
     parameters->irreversible = 1;
 
     parameters->tcp_rates[0] = 0;
-    parameters->tcp_numlayers++;
+    parameters->tcp_numlayers = opendcp->j2k.layers > 1 ? opendcp->j2k.layers : 1;
     parameters->cp_disto_alloc = 1;
 
     parameters->rsiz = OPJ_PROFILE_CINEMA_2K;
 
     if ( opendcp->cinema_profile == DCP_CINEMA4K ) {
             parameters->rsiz = OPJ_PROFILE_CINEMA_4K;
-            parameters->numpocs = initialize_4K_poc(parameters->POC,parameters->numresolution);
+            parameters->numpocs = initialize_4K_poc(parameters->POC,parameters->numresolution,parameters->tcp_numlayers);
+    }
+
+    /* openjpeg holds the cinema profiles to one layer, a layered master is coded without a profile
+       but with the precincts the profiles set, opendcp_codestream_rerate restores the profile */
+    if (opendcp->j2k.layers > 1) {
+        int i;
+
+        parameters->rsiz     = OPJ_PROFILE_NONE;
+        parameters->res_spec = parameters->numresolution - 1;
+
+        for (i = 0; i < parameters->res_spec; i++) {
+            parameters->prcw_init[i] = 256;
+            parameters->prch_init[i] = 256;
+        }
     }
 }
 
+/*
+   The int planes of an opendcp image are handed to OpenJPEG as they are,
+   the opj_image_t is created without data and its components point at the
+   opendcp planes. OpenJPEG transforms the single tile in place, so the
+   opendcp image is overwritten by the encode and must not be used after.
+   The planes are detached again before the opj_image_t is destroyed.
+*/
+
 /* convert opendcp to openjpeg image format */
 int opendcp_to_opj(opendcp_image_t *opendcp, opj_image_t **opj_ptr) {
     OPJ_COLOR_SPACE color_space;
     opj_image_cmptparm_t cmptparm[3];
     opj_image_t *opj = NULL;
-    int j, size;
+    int j, adopt;
 
     color_space = OPJ_CLRSPC_SRGB;
 
+    /* int planes without row padding can be adopted, others are copied */
+    adopt = (opendcp->sample_type == SAMPLE_TYPE_INT32);
+
     /* initialize image components */
     memset(&cmptparm[0], 0, opendcp->n_components * sizeof(opj_image_cmptparm_t));
     for (j = 0;j <  opendcp->n_components;j++) {
@@ -111,10 +137,18 @@ int opendcp_to_opj(opendcp_image_t *opendcp, opj_image_t **opj_ptr) {
             cmptparm[j].sgnd = opendcp->signed_bit;
             cmptparm[j].dx = opendcp->dx;
             cmptparm[j].dy = opendcp->dy;
+
+            if (opendcp->component[j].stride != opendcp->w) {
+                adopt = 0;
+            }
     }
 
     /* create the image */
-    opj = opj_image_create(opendcp->n_components, &cmptparm[0], color_space);
+    if (adopt) {
+        opj = opj_image_tile_create(opendcp->n_components, &cmptparm[0], color_space);
+    } else {
+        opj = opj_image_create(opendcp->n_components, &cmptparm[0], color_space);
+    }
 
     if (!opj) {
         OPENDCP_LOG(LOG_ERROR,"Failed to create image");
@@ -127,34 +161,169 @@ int opendcp_to_opj(opendcp_image_t *opendcp, opj_image_t **opj_ptr) {
     opj->x1 = opendcp->x1;
     opj->y1 = opendcp->y1;
 
-    size = opendcp->w * opendcp->h;
+    for (j = 0; j < opendcp->n_components; j++) {
+        if (adopt) {
+            opj->comps[j].data = (OPJ_INT32 *)opendcp->component[j].data;
+        } else {
+            int y;
 
-    memcpy(opj->comps[0].data,opendcp->component[0].data,size*sizeof(int));
-    memcpy(opj->comps[1].data,opendcp->component[1].data,size*sizeof(int));
-    memcpy(opj->comps[2].data,opendcp->component[2].data,size*sizeof(int));
+            for (y = 0; y < opendcp->h; y++) {
+                opendcp_image_get_row(opendcp, j, y, (int *)&opj->comps[j].data[opendcp->w * y]);
+            }
+        }
+    }
 
     *opj_ptr = opj;
     return OPENDCP_NO_ERROR;
 }
 
-/*!
- @function opendcp_encoder_openjpeg
- @abstract Encode image to file.
- @discussion This function will take the opendcp_image_t struct and encode it.
- @param opendcp An opendcp_t context struct
- @param simage The source image memory buffer to encoder
- @param dfile The output file
- @return An OPENDCP_ERROR value
+/* detach planes lent by opendcp_to_opj and destroy the openjpeg image */
+static void opendcp_opj_release(opendcp_image_t *opendcp, opj_image_t *opj) {
+    OPJ_UINT32 j;
+
+    for (j = 0; j < opj->numcomps; j++) {
+        if ((int)j < opendcp->n_components && opj->comps[j].data == (OPJ_INT32 *)opendcp->component[j].data) {
+            opj->comps[j].data = NULL;
+        }
+    }
+
+    opj_image_destroy(opj);
+}
+
+/*
+   Every frame of a job is encoded with the same cinema parameters, so they
+   are computed once per thread and kept in a thread specific context. The
+   context is rebuilt when the job or the image geometry changes. A thread
+   keeps a context per cinema profile, so encoding the 2K and 4K versions
+   of the same frames does not reset the rate control of either. OpenJPEG
+   modifies the parameters while setting up a codec, so each frame sets up
+   its codec from a copy.
 */
-int opendcp_encode_openjpeg(opendcp_t *opendcp, opendcp_image_t *opendcp_image, char *dfile) {
-    bool result;
-    int max_comp_size;
-    int max_cs_len;
+typedef struct {
+    opendcp_t         *opendcp;
+    int               profile;
+    int               bw;
+    int               frame_rate;
+    int               stereoscopic;
+    OPJ_UINT32        numcomps;
+    OPJ_UINT32        w;
+    OPJ_UINT32        h;
+    OPJ_UINT32        prec;
+    int               rate_control;
+    int               budget;       /* codestream bytes allowed per frame */
+    double            gain;         /* fraction of the budget requested from the allocator */
+    double            fill;         /* smoothed size/budget of the current scene */
+    int               frames;       /* frames seen in the current scene */
     opj_cparameters_t parameters;
-    opj_codec_t* l_codec = 00;
-    opj_image_t *opj_image = NULL;
-    opj_stream_t *l_stream = 00;
-    int bw;
+} openjpeg_context_t;
+
+typedef struct {
+    openjpeg_context_t profiles[2];   /* 2K and 4K */
+    openjpeg_context_t *current;      /* context of the last frame set up */
+} openjpeg_contexts_t;
+
+/* adaptive rate control aims for this fraction of the budget */
+#define RATE_TARGET_FILL 0.995
+#define RATE_GAIN_MIN    0.8
+#define RATE_SCENE_CUT   0.25
+
+/* growable output buffer for in-memory encodes */
+typedef struct {
+    unsigned char *data;
+    OPJ_SIZE_T    length;
+    OPJ_SIZE_T    capacity;
+    OPJ_SIZE_T    offset;
+} openjpeg_buffer_t;
+
+/* opj_codec_set_threads exists from openjpeg 2.2, the encoder uses it from 2.4 */
+#if defined(OPJ_VERSION_MAJOR) && (OPJ_VERSION_MAJOR > 2 || (OPJ_VERSION_MAJOR == 2 && OPJ_VERSION_MINOR >= 2))
+#define OPENJPEG_CODEC_THREADS 1
+
+/* threads the next frame of the calling thread may use, set by the pipeline */
+static __thread int openjpeg_threads = 1;
+#endif
+
+static pthread_once_t openjpeg_context_once = PTHREAD_ONCE_INIT;
+static pthread_key_t  openjpeg_context_key;
+
+static void openjpeg_context_free(void *arg) {
+    openjpeg_contexts_t *contexts = arg;
+    int                 i;
+
+    for (i = 0; i < 2; i++) {
+        if (contexts->profiles[i].parameters.cp_comment) {
+            free(contexts->profiles[i].parameters.cp_comment);
+        }
+    }
+
+    free(contexts);
+}
+
+static void openjpeg_context_init(void) {
+    pthread_key_create(&openjpeg_context_key, openjpeg_context_free);
+}
+
+static int openjpeg_context_matches(openjpeg_context_t *context, opendcp_t *opendcp, opj_image_t *opj_image) {
+    return context->opendcp      == opendcp &&
+           context->profile      == opendcp->cinema_profile &&
+           context->bw           == opendcp->j2k.bw &&
+           context->frame_rate   == opendcp->frame_rate &&
+           context->stereoscopic == opendcp->stereoscopic &&
+           context->rate_control == opendcp->j2k.rate_control &&
+           context->numcomps     == opj_image->numcomps &&
+           context->w            == opj_image->comps[0].w &&
+           context->h            == opj_image->comps[0].h &&
+           context->prec         == opj_image->comps[0].prec;
+}
+
+/* compression ratio that gives a codestream of size bytes */
+static float openjpeg_ratio(opj_image_t *opj_image, double size) {
+    return ((float) (opj_image->numcomps * opj_image->comps[0].w * opj_image->comps[0].h * opj_image->comps[0].prec))/
+           (size * 8 * opj_image->comps[0].dx * opj_image->comps[0].dy);
+}
+
+/* return the context of this thread, set up for the job and image */
+static openjpeg_context_t *openjpeg_context(opendcp_t *opendcp, opj_image_t *opj_image) {
+    openjpeg_contexts_t *contexts;
+    openjpeg_context_t  *context;
+    int max_cs_len;
+    int bw, i;
+
+    pthread_once(&openjpeg_context_once, openjpeg_context_init);
+
+    contexts = pthread_getspecific(openjpeg_context_key);
+
+    if (!contexts) {
+        contexts = calloc(1, sizeof(openjpeg_contexts_t));
+
+        if (!contexts) {
+            return NULL;
+        }
+
+        pthread_setspecific(openjpeg_context_key, contexts);
+    }
+
+    context = &contexts->profiles[opendcp->cinema_profile == DCP_CINEMA4K];
+    contexts->current = context;
+
+    if (context->opendcp && openjpeg_context_matches(context, opendcp, opj_image)) {
+        return context;
+    }
+
+    if (context->parameters.cp_comment) {
+        free(context->parameters.cp_comment);
+    }
+
+    context->opendcp      = opendcp;
+    context->profile      = opendcp->cinema_profile;
+    context->bw           = opendcp->j2k.bw;
+    context->frame_rate   = opendcp->frame_rate;
+    context->stereoscopic = opendcp->stereoscopic;
+    context->rate_control = opendcp->j2k.rate_control;
+    context->numcomps     = opj_image->numcomps;
+    context->w            = opj_image->comps[0].w;
+    context->h            = opj_image->comps[0].h;
+    context->prec         = opj_image->comps[0].prec;
 
     if (opendcp->j2k.bw) {
         bw = opendcp->j2k.bw;
@@ -170,85 +339,340 @@ int opendcp_encode_openjpeg(opendcp_t *opendcp, opendcp_image_t *opendcp_image,
         max_cs_len = max_cs_len/2;
     }
 
-    max_comp_size = ((float)max_cs_len)/1.25;
-
-    opendcp_to_opj(opendcp_image, &opj_image);
+    context->budget = max_cs_len;
+    context->gain   = 1.0;
+    context->fill   = 0.0;
+    context->frames = 0;
 
     /* set encoding parameters to default values */
-    opj_setup_encoder(l_codec, &parameters, opj_image);
-    opj_set_default_encoder_parameters(&parameters);
+    opj_set_default_encoder_parameters(&context->parameters);
 
     /* set default cinema parameters */
-    set_cinema_encoder_parameters(opendcp, &parameters);
+    set_cinema_encoder_parameters(opendcp, &context->parameters);
 
-    parameters.cp_comment = (char*)malloc(strlen(OPENDCP_NAME)+1);
-    sprintf(parameters.cp_comment,"%s", OPENDCP_NAME);
+    context->parameters.cp_comment = (char*)malloc(strlen(OPENDCP_NAME)+1);
+    sprintf(context->parameters.cp_comment,"%s", OPENDCP_NAME);
 
     /* Decide if MCT should be used */
-    parameters.tcp_mct = opj_image->numcomps >= 3 ? 1 : 0;
+    context->parameters.tcp_mct = opj_image->numcomps >= 3 ? 1 : 0;
 
     /* set max image */
-    parameters.max_comp_size = max_comp_size;
-    parameters.tcp_rates[0]= ((float) (opj_image->numcomps * opj_image->comps[0].w * opj_image->comps[0].h * opj_image->comps[0].prec))/
-                              (max_cs_len * 8 * opj_image->comps[0].dx * opj_image->comps[0].dy);
+    context->parameters.max_comp_size = ((float)max_cs_len)/1.25;
+    context->parameters.tcp_rates[context->parameters.tcp_numlayers - 1] = openjpeg_ratio(opj_image, max_cs_len);
+
+    /* the lower layers of a master take the bit rates it is re-rated to */
+    for (i = 0; i < context->parameters.tcp_numlayers - 1; i++) {
+        double size = (double)opendcp->j2k.layer_bw[i] / 8 / opendcp->frame_rate;
+
+        context->parameters.tcp_rates[i] = openjpeg_ratio(opj_image, opendcp->stereoscopic ? size / 2 : size);
+    }
+
+    OPENDCP_LOG(LOG_DEBUG, "j2k encoder context set up for %dx%d", context->w, context->h);
+
+    return context;
+}
+
+/* set the rate of the next frame */
+static void openjpeg_rate_setup(openjpeg_context_t *context, opj_cparameters_t *parameters, opj_image_t *opj_image) {
+    int    top = parameters->tcp_numlayers - 1;
+    double request;
+
+    switch (context->rate_control) {
+        case J2K_RATE_FIXED:
+            break;
+        case J2K_RATE_TRUNCATE:
+            /* code every pass and let the allocator cut the frame down to the budget after tier-1 */
+            parameters->tcp_rates[top] = 0;
+            parameters->max_cs_size    = context->budget;
+            break;
+        default:
+            request = context->budget * context->gain;
+            parameters->tcp_rates[top] = openjpeg_ratio(opj_image, request);
+            parameters->max_cs_size    = request;
+            break;
+    }
+}
+
+/*
+   The allocator's estimate of the header overhead is not exact, frames a
+   rate limited scene produces land a little above or below the request. The
+   sizes of the previous frames of the scene correct the request of the next
+   one, so codestreams fill the budget without going over it. Frames of simple
+   scenes fit whole and say nothing about the allocator, they are left out.
+*/
+static void openjpeg_rate_update(long size) {
+    openjpeg_contexts_t *contexts;
+    openjpeg_context_t  *context;
+    double              fill, change;
+
+    contexts = pthread_getspecific(openjpeg_context_key);
+    context  = contexts ? contexts->current : NULL;
+
+    if (!context || size <= 0) {
+        return;
+    }
+
+    if (size > context->budget) {
+        OPENDCP_LOG(LOG_WARN, "j2k frame is %ld bytes, %ld over the budget", size, size - context->budget);
+    }
+
+    if (context->rate_control != J2K_RATE_ADAPTIVE) {
+        return;
+    }
+
+    fill   = (double)size / context->budget;
+    change = fill > context->fill ? fill - context->fill : context->fill - fill;
+
+    if (!context->frames || change > RATE_SCENE_CUT) {
+        context->fill   = fill;
+        context->frames = 0;
+    } else {
+        context->fill = 0.75 * context->fill + 0.25 * fill;
+    }
+
+    context->frames++;
+
+    if (context->fill >= context->gain * 0.9) {
+        context->gain *= 1.0 + 0.5 * (RATE_TARGET_FILL / fill - 1.0);
+
+        if (context->gain > 1.0) {
+            context->gain = 1.0;
+        } else if (context->gain < RATE_GAIN_MIN) {
+            context->gain = RATE_GAIN_MIN;
+        }
+    }
+
+    OPENDCP_LOG(LOG_DEBUG, "j2k frame %ld bytes, %.1f%% of budget, next request %.1f%%",
+                size, fill * 100, context->gain * 100);
+}
+
+static OPJ_SIZE_T openjpeg_buffer_write(void *data, OPJ_SIZE_T size, void *user) {
+    openjpeg_buffer_t *buffer = user;
+
+    if (buffer->offset + size > buffer->capacity) {
+        OPJ_SIZE_T    capacity = buffer->capacity ? buffer->capacity : 1024 * 1024;
+        unsigned char *ptr;
+
+        while (buffer->offset + size > capacity) {
+            capacity *= 2;
+        }
+
+        ptr = realloc(buffer->data, capacity);
+
+        if (!ptr) {
+            return (OPJ_SIZE_T)-1;
+        }
+
+        buffer->data     = ptr;
+        buffer->capacity = capacity;
+    }
+
+    memcpy(buffer->data + buffer->offset, data, size);
+    buffer->offset += size;
+
+    if (buffer->offset > buffer->length) {
+        buffer->length = buffer->offset;
+    }
+
+    return size;
+}
+
+static OPJ_OFF_T openjpeg_buffer_skip(OPJ_OFF_T size, void *user) {
+    openjpeg_buffer_t *buffer = user;
+
+    if ((OPJ_OFF_T)buffer->offset + size < 0) {
+        return -1;
+    }
+
+    buffer->offset += size;
+
+    return size;
+}
+
+static OPJ_BOOL openjpeg_buffer_seek(OPJ_OFF_T offset, void *user) {
+    openjpeg_buffer_t *buffer = user;
+
+    if (offset < 0) {
+        return OPJ_FALSE;
+    }
+
+    buffer->offset = offset;
+
+    return OPJ_TRUE;
+}
+
+/* encode an image to an openjpeg stream */
+static int openjpeg_encode_stream(opendcp_t *opendcp, opendcp_image_t *opendcp_image, opj_stream_t *l_stream, const char *name) {
+    bool result;
+    openjpeg_context_t *context;
+    opj_cparameters_t parameters;
+    opj_codec_t* l_codec = 00;
+    opj_image_t *opj_image = NULL;
+
+    if (opendcp_to_opj(opendcp_image, &opj_image) != OPENDCP_NO_ERROR) {
+        return OPENDCP_ERROR;
+    }
+
+    context = openjpeg_context(opendcp, opj_image);
+
+    if (!context) {
+        OPENDCP_LOG(LOG_ERROR,"unable to allocate j2k encoder context");
+        opendcp_opj_release(opendcp_image, opj_image);
+        return OPENDCP_ERROR;
+    }
+
+    parameters = context->parameters;
+    openjpeg_rate_setup(context, &parameters, opj_image);
 
     /* get a J2K compressor handle */
-    OPENDCP_LOG(LOG_DEBUG, "creating compressor %s", dfile);
+    OPENDCP_LOG(LOG_DEBUG, "creating compressor %s", name);
     l_codec = opj_create_compress(OPJ_CODEC_J2K);
 
     /* setup the encoder parameters using the current image and user parameters */
     OPENDCP_LOG(LOG_DEBUG, "setting up j2k encoder");
-    opj_setup_encoder(l_codec, &parameters, opj_image);
-
-    /* open a byte stream for writing */
-    /* allocate memory for all tiles */
-    OPENDCP_LOG(LOG_DEBUG, "opening J2k output stream");
-    l_stream = opj_stream_create_default_file_stream(dfile, OPJ_FALSE);
+    result = opj_setup_encoder(l_codec, &parameters, opj_image);
 
-    if (! l_stream){
-        return OPENDCP_ERROR;
+#ifdef OPENJPEG_CODEC_THREADS
+    /* older releases refuse threads for the compressor, the frame is then encoded on this thread */
+    if (result && openjpeg_threads > 1 && opj_has_thread_support() &&
+        !opj_codec_set_threads(l_codec, openjpeg_threads)) {
+        OPENDCP_LOG(LOG_DEBUG, "openjpeg can not use %d threads for %s", openjpeg_threads, name);
     }
+#endif
 
-    OPENDCP_LOG(LOG_INFO,"starting compression %s", dfile);
-    result = opj_start_compress(l_codec, opj_image, l_stream);
-    OPENDCP_LOG(LOG_DEBUG, "compression started %s", dfile);
+    if (result) {
+        OPENDCP_LOG(LOG_INFO,"starting compression %s", name);
+        result = opj_start_compress(l_codec, opj_image, l_stream);
+    }
 
     if (!result) {
-        OPENDCP_LOG(LOG_ERROR,"unable to start compression jpeg2000 file %s", dfile);
-        opj_stream_destroy(l_stream);
+        OPENDCP_LOG(LOG_ERROR,"unable to start compression jpeg2000 file %s", name);
         opj_destroy_codec(l_codec);
-        opj_image_destroy(opj_image);
+        opendcp_opj_release(opendcp_image, opj_image);
         return OPENDCP_ERROR;
     }
 
-    OPENDCP_LOG(LOG_INFO,"starting encoding %s", dfile);
+    OPENDCP_LOG(LOG_INFO,"starting encoding %s", name);
     result = opj_encode(l_codec, l_stream);
-    OPENDCP_LOG(LOG_INFO,"encoding started %s", dfile);
 
     if (!result) {
-        OPENDCP_LOG(LOG_ERROR,"unable to encode jpeg2000 file %s", dfile);
-        opj_stream_destroy(l_stream);
+        OPENDCP_LOG(LOG_ERROR,"unable to encode jpeg2000 file %s", name);
         opj_destroy_codec(l_codec);
-        opj_image_destroy(opj_image);
+        opendcp_opj_release(opendcp_image, opj_image);
         return OPENDCP_ERROR;
     }
 
-    OPENDCP_LOG(LOG_DEBUG, "finishing compression %s", dfile);
+    OPENDCP_LOG(LOG_DEBUG, "finishing compression %s", name);
     result = opj_end_compress(l_codec, l_stream);
 
+    /* free openjpeg structure */
+    opj_destroy_codec(l_codec);
+    opendcp_opj_release(opendcp_image, opj_image);
+
     if (!result) {
-        OPENDCP_LOG(LOG_ERROR,"unable to finish compression jpeg2000 file %s", dfile);
+        OPENDCP_LOG(LOG_ERROR,"unable to finish compression jpeg2000 file %s", name);
+        return OPENDCP_ERROR;
     }
 
-    OPENDCP_LOG(LOG_DEBUG, "encoding complete %s", dfile);
-    /* free openjpeg structure */
+    OPENDCP_LOG(LOG_DEBUG, "encoding complete %s", name);
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*!
+ @function opendcp_encoder_openjpeg
+ @abstract Encode image to file.
+ @discussion This function will take the opendcp_image_t struct and encode it.
+ @param opendcp An opendcp_t context struct
+ @param simage The source image memory buffer to encoder
+ @param dfile The output file
+ @return An OPENDCP_ERROR value
+*/
+int opendcp_encode_openjpeg(opendcp_t *opendcp, opendcp_image_t *opendcp_image, char *dfile) {
+    opj_stream_t *l_stream = 00;
+    struct stat  st;
+    int result;
+
+    /* open a byte stream for writing */
+    OPENDCP_LOG(LOG_DEBUG, "opening J2k output stream");
+    l_stream = opj_stream_create_default_file_stream(dfile, OPJ_FALSE);
+
+    if (! l_stream){
+        return OPENDCP_ERROR;
+    }
+
+    result = openjpeg_encode_stream(opendcp, opendcp_image, l_stream, dfile);
+
     opj_stream_destroy(l_stream);
-    opj_destroy_codec(l_codec);
-    opj_image_destroy(opj_image);
 
-    /* free user parameters structure */
-    if(parameters.cp_comment) free(parameters.cp_comment);
-    if(parameters.cp_matrice) free(parameters.cp_matrice);
+    if (result == OPENDCP_NO_ERROR && !stat(dfile, &st)) {
+        openjpeg_rate_update(st.st_size);
+    }
+
+    return result;
+}
+
+/*!
+ @function opendcp_encode_openjpeg_buffer
+ @abstract Encode image to a memory buffer.
+ @discussion This function will take the opendcp_image_t struct and encode it
+     into a codestream held in memory. The caller frees the buffer.
+ @param opendcp An opendcp_t context struct
+ @param opendcp_image The source image to encode
+ @param data Set to the encoded codestream
+ @param length Set to the length of the codestream in bytes
+ @return An OPENDCP_ERROR value
+*/
+int opendcp_encode_openjpeg_buffer(opendcp_t *opendcp, opendcp_image_t *opendcp_image, unsigned char **data, int *length) {
+    opj_stream_t      *l_stream = 00;
+    openjpeg_buffer_t buffer;
+    int result;
+
+    memset(&buffer, 0, sizeof(buffer));
+
+    l_stream = opj_stream_create(OPJ_J2K_STREAM_CHUNK_SIZE, OPJ_FALSE);
+
+    if (! l_stream){
+        return OPENDCP_ERROR;
+    }
+
+    opj_stream_set_user_data(l_stream, &buffer, NULL);
+    opj_stream_set_write_function(l_stream, openjpeg_buffer_write);
+    opj_stream_set_skip_function(l_stream, openjpeg_buffer_skip);
+    opj_stream_set_seek_function(l_stream, openjpeg_buffer_seek);
+
+    result = openjpeg_encode_stream(opendcp, opendcp_image, l_stream, "memory");
+
+    opj_stream_destroy(l_stream);
+
+    if (result != OPENDCP_NO_ERROR) {
+        free(buffer.data);
+        return OPENDCP_ERROR;
+    }
+
+    *data   = buffer.data;
+    *length = buffer.length;
+
+    openjpeg_rate_update(buffer.length);
 
     return OPENDCP_NO_ERROR;
 }
+
+#ifdef OPENJPEG_CODEC_THREADS
+static void openjpeg_set_threads(int count) {
+    openjpeg_threads = count;
+}
+#endif
+
+const opendcp_encoder_hooks_t opendcp_openjpeg_hooks = {
+    NULL,
+    NULL,
+    opendcp_encode_openjpeg_buffer,
+    NULL,
+    1,
+#ifdef OPENJPEG_CODEC_THREADS
+    openjpeg_set_threads
+#else
+    NULL
+#endif
+};
@@ -20,10 +20,76 @@
 #include <string.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <pthread.h>
 #include "opendcp.h"
 
 #ifdef HAVE_RAGNAROK
 #include <opendcp_encoder_ragnarok.h>
+
+/* interleave buffer of each encoding thread, grown to the largest frame */
+typedef struct {
+    unsigned char *data;
+    size_t        size;
+} ragnarok_buffer_t;
+
+static pthread_once_t ragnarok_buffer_once = PTHREAD_ONCE_INIT;
+static pthread_key_t  ragnarok_buffer_key;
+
+static void ragnarok_buffer_free(void *arg) {
+    ragnarok_buffer_t *buffer = arg;
+
+    free(buffer->data);
+    free(buffer);
+}
+
+static void ragnarok_buffer_init(void) {
+    pthread_key_create(&ragnarok_buffer_key, ragnarok_buffer_free);
+}
+
+static unsigned char *ragnarok_buffer(size_t size) {
+    ragnarok_buffer_t *buffer;
+    unsigned char     *data;
+
+    pthread_once(&ragnarok_buffer_once, ragnarok_buffer_init);
+
+    buffer = pthread_getspecific(ragnarok_buffer_key);
+
+    if (!buffer) {
+        buffer = calloc(1, sizeof(ragnarok_buffer_t));
+
+        if (!buffer) {
+            return NULL;
+        }
+
+        pthread_setspecific(ragnarok_buffer_key, buffer);
+    }
+
+    if (buffer->size < size) {
+        data = realloc(buffer->data, size);
+
+        if (!data) {
+            return NULL;
+        }
+
+        buffer->data = data;
+        buffer->size = size;
+    }
+
+    return buffer->data;
+}
+
+/* interleave one row of the three 12-bit planes into 8-bit samples */
+static void ragnarok_interleave_row(unsigned char *restrict d, const int *restrict r,
+                                    const int *restrict g, const int *restrict b, int w) {
+    int x;
+
+    for (x = 0; x < w; x++) {
+        d[0] = r[x] >> 4;
+        d[1] = g[x] >> 4;
+        d[2] = b[x] >> 4;
+        d += 3;
+    }
+}
 #endif
 
 /*!
@@ -37,7 +103,7 @@
 */
 int opendcp_encode_ragnarok(opendcp_t *opendcp, opendcp_image_t *opendcp_image, char *dfile) {
     int max_cs_len;
-    int bw, i, x;
+    int bw;
 
     if (opendcp->j2k.bw) {
         bw = opendcp->j2k.bw;
@@ -55,6 +121,13 @@ int opendcp_encode_ragnarok(opendcp_t *opendcp, opendcp_image_t *opendcp_image,
 
 #ifdef HAVE_RAGNAROK
     ragnarok_t ragnarok;
+    unsigned char *b;
+    int y;
+
+    if (opendcp_image->n_components != 3 || opendcp_image->sample_type != SAMPLE_TYPE_INT32) {
+        OPENDCP_LOG(LOG_ERROR, "ragnarok encoder requires a 3 component int image");
+        return OPENDCP_ERROR;
+    }
 
     ragnarok.h = opendcp_image->h;
     ragnarok.w = opendcp_image->w;
@@ -62,19 +135,26 @@ int opendcp_encode_ragnarok(opendcp_t *opendcp, opendcp_image_t *opendcp_image,
     ragnarok.max_cs_len   = max_cs_len;
     ragnarok.profile = opendcp->cinema_profile;
 
-    int size = ragnarok.h * ragnarok.w;
-    int n_samples = size * ragnarok.n_components;
-    unsigned char *b = malloc(n_samples * sizeof(int *));
+    b = ragnarok_buffer((size_t)ragnarok.w * ragnarok.h * ragnarok.n_components);
 
-    for (i = 0, x = 0; x < size; x++) {
-        b[i++] = opendcp_image->component[0].data[x] >> 4;
-        b[i++] = opendcp_image->component[1].data[x] >> 4;
-        b[i++] = opendcp_image->component[2].data[x] >> 4;
+    if (!b) {
+        OPENDCP_LOG(LOG_ERROR, "unable to allocate ragnarok buffer");
+        return OPENDCP_ERROR;
     }
 
-    ragnarok_encode(&ragnarok, b, dfile); 
+    for (y = 0; y < opendcp_image->h; y++) {
+        ragnarok_interleave_row(b + (size_t)y * opendcp_image->w * 3,
+                                opendcp_image->component[0].data + (size_t)y * opendcp_image->component[0].stride,
+                                opendcp_image->component[1].data + (size_t)y * opendcp_image->component[1].stride,
+                                opendcp_image->component[2].data + (size_t)y * opendcp_image->component[2].stride,
+                                opendcp_image->w);
+    }
 
-    free(b);
+    ragnarok_encode(&ragnarok, b, dfile);
+#else
+    UNUSED(opendcp_image);
+    UNUSED(dfile);
+    UNUSED(max_cs_len);
 #endif
 
     return OPENDCP_NO_ERROR;
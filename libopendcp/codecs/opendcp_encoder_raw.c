@@ -0,0 +1,186 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2013 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _WIN32
+#define _GNU_SOURCE
+#endif
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <errno.h>
+#include <fcntl.h>
+#ifdef _WIN32
+#include <io.h>
+#include <malloc.h>
+#else
+#include <unistd.h>
+#endif
+#include "opendcp.h"
+#include "opendcp_image.h"
+#include "opendcp_raw.h"
+
+#ifdef _WIN32
+#define RAW_OPEN_FLAGS (O_WRONLY | O_CREAT | O_TRUNC | O_BINARY)
+#else
+#define RAW_OPEN_FLAGS (O_WRONLY | O_CREAT | O_TRUNC)
+#endif
+
+static void *raw_alloc(size_t size) {
+#ifdef _WIN32
+    return _aligned_malloc(size, OPENDCP_RAW_ALIGN);
+#else
+    void *ptr = NULL;
+
+    if (posix_memalign(&ptr, OPENDCP_RAW_ALIGN, size)) {
+        return NULL;
+    }
+
+    return ptr;
+#endif
+}
+
+static void raw_free(void *ptr) {
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    free(ptr);
+#endif
+}
+
+static int raw_write(int fd, const uint8_t *data, size_t size) {
+    while (size) {
+        int n = write(fd, data, size > 0x40000000 ? 0x40000000 : (unsigned int)size);
+
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+
+        if (n <= 0) {
+            return OPENDCP_ERROR;
+        }
+
+        data += n;
+        size -= n;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* open for writing, bypassing the page cache when the file system allows it */
+static int raw_open(const char *file) {
+    int fd = -1;
+
+#ifdef O_DIRECT
+    fd = open(file, RAW_OPEN_FLAGS | O_DIRECT, 0644);
+#endif
+
+    if (fd < 0) {
+        fd = open(file, RAW_OPEN_FLAGS, 0644);
+    }
+
+    return fd;
+}
+
+/*!
+ @function opendcp_encode_raw
+ @abstract Writes an image as a raw planar intermediate frame.
+ @discussion The samples are written as they are, flagged as xyz when the
+     color conversion or a 3d lut was applied, so the decoder of the next
+     tool skips the conversion. The header and each plane are written from
+     aligned blocks, with O_DIRECT when the file system supports it.
+ @param opendcp An opendcp_t context struct
+ @param image The source image, int samples of 12 or 16 bits
+ @param dfile The output file
+ @return An OPENDCP_ERROR value
+*/
+int opendcp_encode_raw(opendcp_t *opendcp, opendcp_image_t *image, char *dfile) {
+    opendcp_raw_header_t header;
+    size_t   samples = (size_t)image->w * image->h;
+    uint8_t  *block;
+    uint16_t *plane;
+    size_t   i;
+    int      fd, c;
+    int      result = OPENDCP_NO_ERROR;
+
+    if (image->use_float || image->sample_type != SAMPLE_TYPE_INT32) {
+        OPENDCP_LOG(LOG_ERROR, "raw frames take int samples only");
+        return OPENDCP_ERROR;
+    }
+
+    memset(&header, 0, sizeof(header));
+    header.header_size = OPENDCP_RAW_ALIGN;
+    header.w           = image->w;
+    header.h           = image->h;
+    header.components  = 3;
+    header.precision   = image->precision > 12 ? 16 : 12;
+    header.flags       = opendcp->j2k.xyz || opendcp->j2k.cube ? OPENDCP_RAW_XYZ : 0;
+    header.plane_size  = (samples * 2 + OPENDCP_RAW_ALIGN - 1) / OPENDCP_RAW_ALIGN * OPENDCP_RAW_ALIGN;
+
+    block = raw_alloc(header.plane_size);
+
+    if (!block) {
+        OPENDCP_LOG(LOG_ERROR, "raw memory allocation error: %s", dfile);
+        return OPENDCP_ERROR;
+    }
+
+    fd = raw_open(dfile);
+
+    OPENDCP_LOG(LOG_DEBUG, "creating file %s for writing", dfile);
+
+    if (fd < 0) {
+        OPENDCP_LOG(LOG_ERROR, "failed to open file %s for writing", dfile);
+        raw_free(block);
+        return OPENDCP_ERROR;
+    }
+
+    memset(block, 0, header.header_size);
+    opendcp_raw_header_write(&header, block);
+    result = raw_write(fd, block, header.header_size);
+
+    /* the padding after each plane is zero */
+    memset(block + samples * 2, 0, header.plane_size - samples * 2);
+    plane = (uint16_t *)block;
+
+    for (c = 0; c < 3 && result == OPENDCP_NO_ERROR; c++) {
+        const int *data = image->component[c].data;
+
+        for (i = 0; i < samples; i++) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+            plane[i] = (uint16_t)(((data[i] & 0xff) << 8) | ((data[i] >> 8) & 0xff));
+#else
+            plane[i] = (uint16_t)data[i];
+#endif
+        }
+
+        result = raw_write(fd, block, header.plane_size);
+    }
+
+    if (close(fd)) {
+        result = OPENDCP_ERROR;
+    }
+
+    raw_free(block);
+
+    if (result != OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_ERROR, "failed to write raw frame %s", dfile);
+    }
+
+    return result;
+}
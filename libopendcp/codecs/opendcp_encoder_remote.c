@@ -1,471 +1,618 @@
+/*
+     OpenDCP: Builds Digital Cinema Packages
+     Copyright (c) 2010-2013 Terrence Meiczinger, All Rights Reserved
+
+     This program is free software: you can redistribute it and/or modify
+     it under the terms of the GNU General Public License as published by
+     the Free Software Foundation, either version 3 of the License, or
+     (at your option) any later version.
+
+     This program is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU General Public License for more details.
+
+     You should have received a copy of the GNU General Public License
+     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
 #include <stdio.h>
 #include <stdlib.h>
-#include <unistd.h>
 #include <string.h>
+#include <pthread.h>
+#include <time.h>
 #include <sys/types.h>
+#include <sys/time.h>
 #if WIN32
 #include <winsock2.h>
-#include <ws2ipdef.h>
-#include <ws2tcpip.h>
-#include <pthread.h>
 #else
 #include <sys/socket.h>
-#include <netinet/in.h>
-#include <netdb.h>
 #endif
 
-#include <md5.h>
 #include "opendcp.h"
 #include "opendcp_image.h"
+#include "opendcp_remote.h"
+#include "opendcp_encoder.h"
+
+#define REMOTE_RETRIES      3    /* further nodes a failed frame is tried on */
+#define REMOTE_BACKOFF_MAX  30   /* seconds a failing node is rested at most */
+
+/* a frame sent to an encoder and waiting for its codestream */
+typedef struct remote_request {
+    uint32_t              id;
+    int                   done;
+    int                   result;
+    unsigned char         *data;
+    int                   length;
+    struct remote_request *next;
+} remote_request_t;
+
+/*
+   A connection to one encoder. It is shared by the threads sending to that
+   node, and a receiver thread hands each result to the thread waiting on
+   its id. The node holds one reference and every request another; the last
+   reference frees it, so a failed connection can be replaced while its
+   requests are still being failed.
+*/
+typedef struct {
+    int              fd;
+    int              refs;
+    int              failed;
+    uint32_t         next_id;
+    remote_request_t *pending;
+    pthread_t        receiver;
+    pthread_mutex_t  mutex;
+    pthread_mutex_t  send_mutex;
+    pthread_cond_t   cond;
+} remote_client_t;
+
+/* an encode node and what has been observed of it */
+typedef struct {
+    char             host[256];
+    char             port[16];
+    remote_client_t  *client;
+    pthread_mutex_t  connect_mutex;
+    int              in_flight;
+    int              frames;
+    int              failures;        /* consecutive failures */
+    int              failed_total;
+    double           latency;         /* running average seconds per frame */
+    double           retry_at;        /* a failing node is not used before this time */
+} remote_node_t;
+
+/*
+   Frames are pulled by the nodes: each frame goes to the node expected to
+   finish it first, from its average frame time and the frames already in
+   flight on it, so faster nodes take a larger share. A frame that fails is
+   tried again on the best other node and the failing node is rested for an
+   increasing time. The caller keeps the frame order, it only waits for the
+   codestream of the frame it sent.
+*/
+struct opendcp_remote_farm {
+    int              nnodes;
+    remote_node_t    *nodes;
+    int              window;
+    pthread_mutex_t  mutex;
+    pthread_cond_t   cond;
+};
+
+static pthread_mutex_t remote_farm_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static double remote_now() {
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+
+    return tv.tv_sec + tv.tv_usec / 1000000.0;
+}
 
-#define OPENDCP_ERROR 1
-#define OPENDCP_NO_ERROR 0
+/* fail every pending request, called with the client mutex held */
+static void remote_client_fail(remote_client_t *client) {
+    remote_request_t *r;
 
-#define MD5_DIGEST_LENGTH 16
-#define CHUNK_SIZE 1024
-#define READ_SIZE 512
-#define HEADER_LENGTH 1024
+    client->failed = 1;
 
-char* itoa(int value, char* result, int base) {
-    if (base < 2 || base > 36) { 
-        *result = '\0';
-        return result;
-    }
-    
-    char* ptr = result, *ptr1 = result, tmp_char;
-    int tmp_value;
-    
-    do {
-        tmp_value = value;
-        value /= base;
-        *ptr++ = "zyxwvutsrqponmlkjihgfedcba9876543210123456789abcdefghijklmnopqrstuvwxyz" [35 + (tmp_value - value * base)];
-    } while ( value );
-    
-    // Apply negative sign
-    if (tmp_value < 0) {
-        *ptr++ = '-';
+    for (r = client->pending; r; r = r->next) {
+        if (!r->done) {
+            r->done   = 1;
+            r->result = OPENDCP_ERROR;
+        }
     }
 
-    *ptr-- = '\0';
+    pthread_cond_broadcast(&client->cond);
+}
 
-    while(ptr1 < ptr) {
-        tmp_char = *ptr;
-        *ptr--= *ptr1;
-        *ptr1++ = tmp_char;
-    }
+static void *remote_client_receive(void *arg) {
+    remote_client_t         *client = arg;
+    opendcp_remote_header_t header;
+    remote_request_t        *r;
+    unsigned char           *payload;
+    unsigned char           status[4];
+    int                     length;
+
+    while (opendcp_remote_recv_header(client->fd, &header) == OPENDCP_NO_ERROR) {
+        if (header.type != REMOTE_ENCODE_RESULT || header.length < sizeof(status)) {
+            OPENDCP_LOG(LOG_ERROR, "unexpected remote encoder message %u", header.type);
+            break;
+        }
 
-    return result;
-}
+        if (opendcp_remote_recv(client->fd, status, sizeof(status)) != OPENDCP_NO_ERROR) {
+            break;
+        }
 
-typedef struct {
-    char header[HEADER_LENGTH];
-    int  data_length;
-    char *data;
-} message_t;
-
-void copy_var(const char *src, char *dst, int len) {
-    int c;
-    
-    for (c = 0; c < len; c++) {
-        dst[c] = src[c];
-    }
-    dst[len] = '\0';
-}
+        length  = header.length - sizeof(status);
+        payload = malloc(length > 0 ? length : 1);
 
-int get_parameter(const char *data, size_t data_len, const char *name, char *dst, int dst_len) {
-    const char *value_start, *data_end, *value_end;
-    int len;
-    char search[data_len];
-    
-    if (dst == NULL || dst_len == 0) {
-        len = -2;
-    } else if (data == NULL || name == NULL || data_len == 0) {
-        len = -1;
-        dst[0] = '\0';
-    } else {
-        data_end = data + data_len;
-        len = -1;
-        dst[0] = '\0';
-        
-        snprintf(search, data_len, ":%s=", name);
-        
-        if ((value_start = strstr(data, search))) {
-            value_start += strlen(search);
-            value_end = (const char *) memchr(value_start, ':', (size_t)(data_end - value_start));
-            
-            if (value_end == NULL) {
-                value_end = data_end;
-            }
-                     
-            len = value_end - value_start < dst_len ? value_end - value_start : dst_len;
-            copy_var(value_start, dst, len);
-        } 
+        if (!payload || opendcp_remote_recv(client->fd, payload, length) != OPENDCP_NO_ERROR) {
+            free(payload);
+            break;
+        }
+
+        pthread_mutex_lock(&client->mutex);
+
+        for (r = client->pending; r && r->id != header.id; r = r->next);
+
+        if (r && !r->done) {
+            r->result = ((status[0] << 24) | (status[1] << 16) | (status[2] << 8) | status[3]) ? OPENDCP_ERROR : OPENDCP_NO_ERROR;
+            r->data   = payload;
+            r->length = length;
+            r->done   = 1;
+            payload   = NULL;
+            pthread_cond_broadcast(&client->cond);
+        }
+
+        pthread_mutex_unlock(&client->mutex);
+
+        free(payload);
     }
-    
-    return len;
+
+    pthread_mutex_lock(&client->mutex);
+    remote_client_fail(client);
+    pthread_mutex_unlock(&client->mutex);
+
+    return NULL;
 }
 
-char *calculate_checksum(char *file) {
-    FILE *fp;
-    int bytes, i;
-    md5_t ctx;
-    unsigned char data[1024];
-    unsigned char c[MD5_DIGEST_LENGTH];
-
-    char *md5 = malloc(MD5_DIGEST_LENGTH *2 + 1);
-    
-    fp = fopen(file, "rb");
-    
-    if (!fp) {
-      return NULL;
+static remote_client_t *remote_client_open(const char *host, const char *port) {
+    remote_client_t *client;
+
+    client = calloc(1, sizeof(remote_client_t));
+
+    if (!client) {
+        return NULL;
     }
-    
-    md5_init(&ctx);
-    
-    while ((bytes = fread(data, 1, 1024, fp)) != 0) {
-        md5_update(&ctx, data, bytes);
+
+    client->fd   = opendcp_remote_connect(host, port);
+    client->refs = 1;
+
+    if (client->fd < 0) {
+        free(client);
+        return NULL;
     }
-    
-    md5_final(c, &ctx);
-    
-    for (i = 0; i < MD5_DIGEST_LENGTH; ++i) {
-        snprintf(&md5[i*2], MD5_DIGEST_LENGTH*2, "%02x", c[i]);
+
+    pthread_mutex_init(&client->mutex, NULL);
+    pthread_mutex_init(&client->send_mutex, NULL);
+    pthread_cond_init(&client->cond, NULL);
+
+    if (pthread_create(&client->receiver, NULL, remote_client_receive, client)) {
+        opendcp_remote_close_socket(client->fd);
+        pthread_cond_destroy(&client->cond);
+        pthread_mutex_destroy(&client->send_mutex);
+        pthread_mutex_destroy(&client->mutex);
+        free(client);
+        return NULL;
     }
-    
-    fclose(fp);
 
-    return md5;
+    return client;
 }
 
-int get_file_length(char *filename) {
-    FILE *fp;
-    int file_length;
+static void remote_client_put(remote_client_t *client) {
+    int refs;
 
-    fp = fopen(filename, "rb");
+    pthread_mutex_lock(&client->mutex);
+    refs = --client->refs;
+    pthread_mutex_unlock(&client->mutex);
 
-    if (!fp) {
-        printf("could not open file\n");
-        return -1;
+    if (refs) {
+        return;
     }
 
-    fseek(fp, 0, SEEK_END);
-    file_length = ftell(fp);
-    fseek(fp, 0, SEEK_SET);
-
-    fclose(fp);
+    /* wake the receiver and wait for it */
+    shutdown(client->fd, SHUT_RDWR);
+    pthread_join(client->receiver, NULL);
+    opendcp_remote_close_socket(client->fd);
 
-    return file_length;
+    pthread_cond_destroy(&client->cond);
+    pthread_mutex_destroy(&client->send_mutex);
+    pthread_mutex_destroy(&client->mutex);
+    free(client);
 }
 
-int read_file(char *filename, char *buffer, int buffer_size) {
-    FILE *fp;
+/* send a request and wait for its result */
+static int remote_client_encode(remote_client_t *client, const unsigned char *payload, uint32_t payload_length,
+                                unsigned char **data, int *length) {
+    remote_request_t request, **r;
+    int              result;
 
-    fp = fopen(filename, "rb");
-    fread(buffer, 1, buffer_size, fp);
-    fclose(fp);
+    memset(&request, 0, sizeof(request));
 
-    return OPENDCP_NO_ERROR;
-}
+    pthread_mutex_lock(&client->mutex);
 
-int write_file(char *file, char *data, int data_length) {
-    FILE *fp = fopen(file, "wb");
-    
-    if (fp == NULL) {
-        fprintf(stderr, "Could not open file %s\n", file);
-        return 1;
+    if (client->failed) {
+        pthread_mutex_unlock(&client->mutex);
+        return OPENDCP_ERROR;
     }
-    
-    printf("writing %d\n", data_length);
-    fwrite(data, 1, data_length, fp);
-    fclose(fp);
-    
-    return 0;
-}
 
-static int set_sock_timeout(int sockfd, int milliseconds) {
-    struct timeval t;
-    t.tv_sec = milliseconds / 1000;
-    t.tv_usec = (milliseconds * 1000) % 1000000;
+    request.id      = client->next_id++;
+    request.next    = client->pending;
+    client->pending = &request;
 
-    return setsockopt(sockfd, SOL_SOCKET, SO_RCVTIMEO, (void *) &t, sizeof(t)) ||
-        setsockopt(sockfd, SOL_SOCKET, SO_SNDTIMEO, (void *) &t, sizeof(t));
-}
+    pthread_mutex_unlock(&client->mutex);
 
-int receive_data(int connection, char *buffer, int buffer_size) {
-    int total = 0;
-    int n = 0;
-    int recv_size;
-    int left = buffer_size;
-
-    while (total < buffer_size) {
-        recv_size = left > CHUNK_SIZE ? CHUNK_SIZE : left;
-        n = recv(connection, buffer + total, recv_size, 0);
-        
-        if (!n) {
-            break;
-        }
-    
-        total += n;
-        left -= n;
+    pthread_mutex_lock(&client->send_mutex);
+    result = opendcp_remote_send(client->fd, REMOTE_ENCODE_REQUEST, request.id, payload, payload_length);
+    pthread_mutex_unlock(&client->send_mutex);
+
+    pthread_mutex_lock(&client->mutex);
+
+    if (result != OPENDCP_NO_ERROR) {
+        shutdown(client->fd, SHUT_RDWR);
+        remote_client_fail(client);
     }
-    
-    return n < 0 ? OPENDCP_ERROR:OPENDCP_NO_ERROR;
-}
 
-int send_data(int connection, char *buffer, int buffer_size) {
-    int total = 0;
-    int left = buffer_size;
-    int n = 0;
-    int send_size;
-
-    while (total < buffer_size) {
-        send_size = left > CHUNK_SIZE ? CHUNK_SIZE : left;
-        n = send(connection, buffer + total, send_size, 0);
-        total += n;
-        left -= n;
+    while (!request.done) {
+        pthread_cond_wait(&client->cond, &client->mutex);
     }
-    
-    return n < 0 ? OPENDCP_ERROR:OPENDCP_NO_ERROR;
-}
 
-#define BUF_SIZE 512
-#define MIN_BUF_SPACE_THRESHOLD (BUF_SIZE / 2)
+    for (r = &client->pending; *r != &request; r = &(*r)->next);
 
-char *read_response(int sock) {
-    int bytes_read;
-    char *buf = (char*)malloc(BUF_SIZE);
-    int cur_position = 0;
-    int space_left = BUF_SIZE;
+    *r = request.next;
 
-    if (buf == NULL) {
-        exit(1); /* or try to cope with out-of-memory situation */
-    }
+    pthread_mutex_unlock(&client->mutex);
 
-    while ((bytes_read = read(sock, buf + cur_position, space_left)) > 0) {
-        cur_position += bytes_read;
-        space_left -= bytes_read;
-        if (space_left < MIN_BUF_SPACE_THRESHOLD) {
-            buf = realloc(buf, cur_position + space_left + BUF_SIZE);
-            if (buf == NULL) {
-                exit(1); /* or try to cope with out-of-memory situation */
-            }
-            space_left += BUF_SIZE;
-        }
+    if (request.result != OPENDCP_NO_ERROR) {
+        free(request.data);
+        return OPENDCP_ERROR;
     }
-    
-    return buf;
+
+    *data   = request.data;
+    *length = request.length;
+
+    return OPENDCP_NO_ERROR;
 }
 
-int create_connection(const char *host, const char *port) {
-    struct addrinfo hints, *server;
-    int sockfd, rc;
-    char port_s[5];
-    
-    memset(&hints, 0, sizeof(struct addrinfo));
-    hints.ai_family = AF_INET;
-    hints.ai_socktype = SOCK_STREAM;
-
-    rc = getaddrinfo(host, port, &hints, &server);
-    
-    if (rc) {
-        printf("error: %d\n", rc);
+/* a reference to the connection of a node, reopened if it failed */
+static remote_client_t *remote_node_client(remote_node_t *node) {
+    remote_client_t *client;
+    int             failed = 0;
+
+    pthread_mutex_lock(&node->connect_mutex);
+
+    if (node->client) {
+        pthread_mutex_lock(&node->client->mutex);
+        failed = node->client->failed;
+        pthread_mutex_unlock(&node->client->mutex);
     }
-    
-    if (server == NULL) {
-        printf("error no such host\n");
-        return -1;
+
+    if (failed) {
+        remote_client_put(node->client);
+        node->client = NULL;
     }
-    
-    printf("creating connection to %s %s\n", host, port);
-    sockfd = socket(server->ai_family, server->ai_socktype, server->ai_protocol);
-
-    if (sockfd < 0) {
-        printf("failed to create socket\n");
-        freeaddrinfo(server);
-        return -1;
+
+    if (!node->client) {
+        node->client = remote_client_open(node->host, node->port);
     }
 
-    if (connect(sockfd, server->ai_addr, server->ai_addrlen) < 0 ) {
-        printf("failed to connect to server %s\n", host);
-        freeaddrinfo(server);
-        return -1;
+    client = node->client;
+
+    if (client) {
+        pthread_mutex_lock(&client->mutex);
+        client->refs++;
+        pthread_mutex_unlock(&client->mutex);
     }
-    
-    freeaddrinfo(server);
-    
-    printf("connected!\n");
 
-    return sockfd;
+    pthread_mutex_unlock(&node->connect_mutex);
+
+    return client;
 }
 
-int close_connection(int connection) {
-    printf("closed connection");
-    close(connection);
+/* split a comma separated list of host[:port] into nodes */
+static opendcp_remote_farm_t *remote_farm_create(const char *hosts, const char *port, int window) {
+    opendcp_remote_farm_t *farm;
+    remote_node_t         *node;
+    const char            *h, *end, *colon;
+    size_t                len;
+    int                   n;
 
-    return OPENDCP_NO_ERROR;
-}
+    farm = calloc(1, sizeof(opendcp_remote_farm_t));
 
-int receive_message(int connection, message_t *m) {
-    char param[HEADER_LENGTH];
-    
-    receive_data(connection, m->header, sizeof(m->header));
-    get_parameter(m->header, strlen(m->header), "length", param, sizeof(param));
-    m->data_length = atoi(param);
+    for (n = 1, h = hosts; *h; h++) {
+        n += *h == ',';
+    }
 
-    if (m->data_length) {
-        m->data = malloc(m->data_length);
-        receive_data(connection, m->data, m->data_length);
+    if (!farm || !(farm->nodes = calloc(n, sizeof(remote_node_t)))) {
+        free(farm);
+        return NULL;
     }
-    
-    return 0;
+
+    for (h = hosts; *h; h = *end ? end + 1 : end) {
+        end = strchr(h, ',');
+        end = end ? end : h + strlen(h);
+        len = end - h;
+
+        if (!len) {
+            continue;
+        }
+
+        node  = &farm->nodes[farm->nnodes++];
+        colon = memchr(h, ':', len);
+
+        /* a single colon separates the port, ipv6 addresses have several */
+        if (colon && memchr(colon + 1, ':', end - colon - 1)) {
+            colon = NULL;
+        }
+
+        snprintf(node->host, sizeof(node->host), "%.*s", (int)((colon ? colon : end) - h), h);
+        snprintf(node->port, sizeof(node->port), "%.*s", colon ? (int)(end - colon - 1) : (int)strlen(port), colon ? colon + 1 : port);
+        pthread_mutex_init(&node->connect_mutex, NULL);
+    }
+
+    farm->window = window > 0 ? window : OPENDCP_REMOTE_WINDOW;
+    pthread_mutex_init(&farm->mutex, NULL);
+    pthread_cond_init(&farm->cond, NULL);
+
+    return farm;
 }
 
-int send_message(int connection, const message_t *msg) {
-    char *m;
-    int  m_length;
+static opendcp_remote_farm_t *remote_farm(opendcp_t *opendcp) {
+    opendcp_remote_farm_t *farm;
+
+    pthread_mutex_lock(&remote_farm_mutex);
 
-    /* allocate message */
-    m_length = sizeof(msg->header) + msg->data_length;
-    m = malloc(m_length);
-    
-    if (!m) {
-        return 1;
+    if (!opendcp->remote.farm) {
+        opendcp->remote.farm = remote_farm_create(opendcp->remote.host ? opendcp->remote.host : "localhost",
+                                                  opendcp->remote.port ? opendcp->remote.port : OPENDCP_REMOTE_PORT,
+                                                  opendcp->remote.window);
+
+        if (opendcp->remote.farm && !opendcp->remote.farm->nnodes) {
+            OPENDCP_LOG(LOG_ERROR, "no remote encoders given");
+        }
     }
 
-    /* copy header into message */
-    memset(m, 0, m_length);
-    memcpy(m, msg->header, sizeof(msg->header));
+    farm = opendcp->remote.farm;
+
+    pthread_mutex_unlock(&remote_farm_mutex);
+
+    return farm && farm->nnodes ? farm : NULL;
+}
+
+/*
+   Take a slot on the node expected to finish a frame first, skipping the
+   node that just failed it. Waits while every node is busy or resting.
+*/
+static remote_node_t *remote_farm_acquire(opendcp_remote_farm_t *farm, remote_node_t *skip) {
+    remote_node_t   *node, *best;
+    struct timespec ts;
+    double          now, score, best_score, wake;
+    int             i;
+
+    pthread_mutex_lock(&farm->mutex);
+
+    while (1) {
+        now  = remote_now();
+        best = NULL;
+        wake = 0;
+        best_score = 0;
+
+        for (i = 0; i < farm->nnodes; i++) {
+            node = &farm->nodes[i];
+
+            if (node == skip && farm->nnodes > 1) {
+                continue;
+            }
+
+            if (node->retry_at > now) {
+                wake = wake && wake < node->retry_at ? wake : node->retry_at;
+                continue;
+            }
+
+            if (node->in_flight >= farm->window) {
+                continue;
+            }
 
-    /* copy data into message */
-    if (msg->data && msg->data_length) {
-        memcpy(m + sizeof(msg->header), msg->data, msg->data_length);
+            score = node->latency * (node->in_flight + 1);
+
+            if (!best || score < best_score) {
+                best       = node;
+                best_score = score;
+            }
+        }
+
+        if (best) {
+            break;
+        }
+
+        if (wake) {
+            ts.tv_sec  = (time_t)wake;
+            ts.tv_nsec = (long)((wake - (time_t)wake) * 1000000000.0);
+            pthread_cond_timedwait(&farm->cond, &farm->mutex, &ts);
+        }
+        else {
+            pthread_cond_wait(&farm->cond, &farm->mutex);
+        }
     }
 
-    /* send message */
-    printf("sending message %d\n", (m_length));
-    send_data(connection, m, m_length);
-    
-    free(m);
+    best->in_flight++;
+
+    pthread_mutex_unlock(&farm->mutex);
 
-    return 0;
+    return best;
 }
 
-int opendcp_request_encoded_file(opendcp_t *opendcp, char *file) {
-    int        connection;
-    char       md5[40];
-    char       *checksum;
-    message_t  message;
+static void remote_farm_release(opendcp_remote_farm_t *farm, remote_node_t *node, int result, double seconds) {
+    int backoff;
 
-    connection = create_connection(opendcp->remote.host, opendcp->remote.port);
-    
-    if (connection < 0 ) {
-        return OPENDCP_ERROR;
+    pthread_mutex_lock(&farm->mutex);
+
+    node->in_flight--;
+
+    if (result == OPENDCP_NO_ERROR) {
+        node->latency  = node->frames ? node->latency * 0.8 + seconds * 0.2 : seconds;
+        node->failures = 0;
+        node->frames++;
     }
-    
-    /* send file request */
-    snprintf(message.header, sizeof(message.header), ":action=%s:file=%s:length=0", "encoded_file_request", file);
-    message.data = NULL;
-    message.data_length = 0;
-    send_message(connection, &message);
-    
-    /* receive file */
-    receive_message(connection, &message);
-    get_parameter(message.header, strlen(message.header), "md5", md5, sizeof(md5));
-
-    if (write_file("foo.tif", message.data, message.data_length)) {
-        printf("File write error");
-        free(message.data);
-        return 1;
+    else {
+        node->failures++;
+        node->failed_total++;
+        backoff = node->failures < 5 ? 1 << node->failures : REMOTE_BACKOFF_MAX;
+        backoff = backoff < REMOTE_BACKOFF_MAX ? backoff : REMOTE_BACKOFF_MAX;
+        node->retry_at = remote_now() + backoff;
+        OPENDCP_LOG(LOG_WARN, "remote encoder %s:%s failed, resting it for %d seconds", node->host, node->port, backoff);
     }
-    
-    if (message.data) {
-        free(message.data);
+
+    pthread_cond_broadcast(&farm->cond);
+    pthread_mutex_unlock(&farm->mutex);
+}
+
+/*!
+ @function opendcp_remote_disconnect
+ @abstract Closes the remote encoder connections of a context, if open.
+ @discussion No encode may be in progress on the context. The frames and
+     frame time of each node are logged.
+ @param opendcp The opendcp context.
+*/
+void opendcp_remote_disconnect(opendcp_t *opendcp) {
+    opendcp_remote_farm_t *farm;
+    remote_node_t         *node;
+    int                   i;
+
+    pthread_mutex_lock(&remote_farm_mutex);
+
+    farm = opendcp->remote.farm;
+    opendcp->remote.farm = NULL;
+
+    pthread_mutex_unlock(&remote_farm_mutex);
+
+    if (!farm) {
+        return;
     }
-    
-    close(connection);
-    
-    //checksum = malloc(sizeof(MD5_DIGEST_LENGTH*2) + 1);
-    checksum = calculate_checksum("foo.tif");
-    
-    if (strcmp(checksum, md5)) {
-        printf("checksum mismatch\n");
-        free(checksum);
-        return 1;
+
+    for (i = 0; i < farm->nnodes; i++) {
+        node = &farm->nodes[i];
+
+        if (node->frames || node->failed_total) {
+            OPENDCP_LOG(LOG_INFO, "remote encoder %s:%s encoded %d frames, %.3f seconds per frame, %d failures",
+                        node->host, node->port, node->frames, node->latency, node->failed_total);
+        }
+
+        if (node->client) {
+            remote_client_put(node->client);
+        }
+
+        pthread_mutex_destroy(&node->connect_mutex);
     }
-    
-    free(checksum);
-    
-    return 0;
+
+    pthread_cond_destroy(&farm->cond);
+    pthread_mutex_destroy(&farm->mutex);
+    free(farm->nodes);
+    free(farm);
 }
 
-int opendcp_encode_request(const opendcp_t *opendcp, opendcp_image_t *image) {
-    int        connection;
-    char       *checksum = NULL;
-    message_t  message;
-    
-    connection = create_connection(opendcp->remote.host, opendcp->remote.port);
-    
-    if (connection < 0 ) {
+/*!
+ @function opendcp_encode_remote_buffer
+ @abstract Encodes an image on the remote encoders into memory.
+ @discussion Safe to call from several threads. remote.host lists the
+     encoders as host[:port] separated by commas, and up to remote.window
+     frames are in flight on each. A frame that fails is tried on other
+     nodes up to REMOTE_RETRIES more times.
+ @param opendcp The opendcp context.
+ @param opendcp_image The conformed image to encode.
+ @param data Receives the codestream, to be freed by the caller.
+ @param length Receives the codestream length.
+ @return OPENDCP_NO_ERROR on success, OPENDCP_ERROR on failure.
+*/
+int opendcp_encode_remote_buffer(opendcp_t *opendcp, opendcp_image_t *opendcp_image, unsigned char **data, int *length) {
+    opendcp_remote_farm_t *farm;
+    remote_node_t         *node = NULL;
+    remote_client_t       *client;
+    unsigned char         *payload;
+    uint32_t              payload_length;
+    double                start;
+    int                   attempt;
+    int                   result = OPENDCP_ERROR;
+
+    *data   = NULL;
+    *length = 0;
+
+    farm = remote_farm(opendcp);
+
+    if (!farm) {
         return OPENDCP_ERROR;
     }
-    
-    /* get file details and read */
-    message.data_length = opendcp_image_size(image);
-    
-    if (message.data_length < 0) {
+
+    payload = opendcp_remote_pack_image(opendcp, opendcp_image, &payload_length);
+
+    if (!payload) {
         return OPENDCP_ERROR;
     }
-    
-    /* read data */
-    message.data = malloc(message.data_length);
-    //read_file(file, message.data, message.data_length);
-    //checksum = calculate_checksum(file);
-
-    /* build request */
-    snprintf(message.header, sizeof(message.header), ":action=encode_request:length=%d:md5=%s:profile=cinema2k:bw=%d", message.data_length, checksum, opendcp->j2k.bw);
-
-    /* send encode request */
-    send_message(connection, &message);
-    
-    if (message.data) {
-        free(message.data);
-    }
-    
-    /* wait for encode to complete */
-    receive_message(connection, &message);
 
-    if (message.data_length) {
-        free(message.data);
+    for (attempt = 0; attempt <= REMOTE_RETRIES && result != OPENDCP_NO_ERROR; attempt++) {
+        node   = remote_farm_acquire(farm, node);
+        start  = remote_now();
+        client = remote_node_client(node);
+        result = OPENDCP_ERROR;
+
+        if (client) {
+            result = remote_client_encode(client, payload, payload_length, data, length);
+            remote_client_put(client);
+        }
+
+        remote_farm_release(farm, node, result, remote_now() - start);
     }
-    
-    free(checksum);
 
-    close(connection);
+    free(payload);
 
-    return OPENDCP_NO_ERROR;
+    if (result != OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_ERROR, "remote encode failed after %d attempts", attempt);
+    }
+
+    return result;
 }
 
-int opendcp_encode_remote(opendcp_t *opendcp, opendcp_image_t *simage, char *dfile) {
-    int rc;
-    char encoded_file[512];
-    
-    opendcp->remote.host = "localhost";
-    opendcp->remote.port = "8080";
-    opendcp->j2k.bw = 125;
-    
-    //for (;;) {
-    printf("encode request\n");
-    rc = opendcp_encode_request(opendcp, simage);
-    sleep(1);
-    
-    if (rc) {
-        return rc;
+int opendcp_encode_remote(opendcp_t *opendcp, opendcp_image_t *opendcp_image, char *output_file) {
+    unsigned char *data;
+    int           length;
+    int           result;
+    FILE          *fp;
+
+    result = opendcp_encode_remote_buffer(opendcp, opendcp_image, &data, &length);
+
+    if (result != OPENDCP_NO_ERROR) {
+        return result;
     }
 
-    printf("request file\n");
-    rc = opendcp_request_encoded_file(opendcp, "test.tif");
-    //}
-    
-    /* encode request complete */
-    return rc;
+    fp = fopen(output_file, "wb");
+
+    if (!fp || fwrite(data, 1, length, fp) != (size_t)length) {
+        OPENDCP_LOG(LOG_ERROR, "could not write JPEG2000 file %s", output_file);
+        result = OPENDCP_ERROR;
+    }
+
+    if (fp) {
+        fclose(fp);
+    }
+
+    free(data);
+
+    return result;
 }
+
+/* the connections are closed after each conversion, which logs the per node stats */
+const opendcp_encoder_hooks_t opendcp_remote_hooks = {
+    NULL,
+    opendcp_remote_disconnect,
+    opendcp_encode_remote_buffer,
+    NULL,
+    1,
+    NULL
+};
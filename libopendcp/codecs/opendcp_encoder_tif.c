@@ -20,24 +20,131 @@
 #include <string.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <zlib.h>
 #include <tiffio.h>
 #include "opendcp.h"
 #include "opendcp_image.h"
 
+/* rows packed and written at once */
+#define TIF_ROWS_PER_STRIP 64
+
+/* threads deflating strips */
+#define TIF_THREADS 4
+
+typedef struct {
+    opendcp_image_t *image;
+    uint32_t        strip_num;
+    size_t          row_bytes;
+    int             start;          /* first strip of the thread, strips are taken in steps of TIF_THREADS */
+    unsigned char   **data;         /* deflated strips */
+    uLongf          *size;
+    int             result;
+} tif_deflate_t;
+
+static void *tif_deflate_strips(void *arg) {
+    tif_deflate_t *t = (tif_deflate_t *)arg;
+    unsigned char *raw;
+    uint32_t      strip;
+    int           y, rows;
+    uLong         raw_size;
+
+    t->result = OPENDCP_NO_ERROR;
+    raw = malloc(t->row_bytes * TIF_ROWS_PER_STRIP);
+
+    if (!raw) {
+        t->result = OPENDCP_ERROR;
+        return NULL;
+    }
+
+    for (strip = t->start; strip < t->strip_num; strip += TIF_THREADS) {
+        y        = strip * TIF_ROWS_PER_STRIP;
+        rows     = y + TIF_ROWS_PER_STRIP < t->image->h ? TIF_ROWS_PER_STRIP : t->image->h - y;
+        raw_size = t->row_bytes * rows;
+
+        opendcp_image_readrows(t->image, y, rows, raw);
+
+        t->size[strip] = compressBound(raw_size);
+        t->data[strip] = malloc(t->size[strip]);
+
+        if (!t->data[strip] || compress2(t->data[strip], &t->size[strip], raw, raw_size, Z_BEST_SPEED) != Z_OK) {
+            t->result = OPENDCP_ERROR;
+            break;
+        }
+    }
+
+    free(raw);
+
+    return NULL;
+}
+
+/* deflate the strips in parallel on the thread pool, then write them in order */
+static int tif_write_deflate(TIFF *tif, opendcp_image_t *image, uint32_t strip_num, size_t row_bytes) {
+    tif_deflate_t t[TIF_THREADS];
+    unsigned char **data;
+    uLongf        *size;
+    uint32_t      strip;
+    int           i, n;
+    int           result = OPENDCP_NO_ERROR;
+
+    data = calloc(strip_num, sizeof(unsigned char *));
+    size = calloc(strip_num, sizeof(uLongf));
+
+    if (!data || !size) {
+        free(data);
+        free(size);
+        return OPENDCP_ERROR;
+    }
+
+    n = strip_num < TIF_THREADS ? (int)strip_num : TIF_THREADS;
+
+    for (i = 0; i < n; i++) {
+        t[i].image     = image;
+        t[i].strip_num = strip_num;
+        t[i].row_bytes = row_bytes;
+        t[i].start     = i;
+        t[i].data      = data;
+        t[i].size      = size;
+    }
+
+    opendcp_pool_run(tif_deflate_strips, t, sizeof(t[0]), n, POOL_PRIORITY_NORMAL);
+
+    for (i = 0; i < n; i++) {
+        if (t[i].result != OPENDCP_NO_ERROR) {
+            result = OPENDCP_ERROR;
+        }
+    }
+
+    for (strip = 0; strip < strip_num; strip++) {
+        if (result == OPENDCP_NO_ERROR && TIFFWriteRawStrip(tif, strip, data[strip], size[strip]) < 0) {
+            result = OPENDCP_ERROR;
+        }
+        free(data[strip]);
+    }
+
+    free(data);
+    free(size);
+
+    return result;
+}
+
 /*!
  @function opendcp_encoder_tif
  @abstract Encode image to file.
  @discussion This function will take the opendcp_image_t struct and encode it.
+     Rows are packed and written a strip of TIF_ROWS_PER_STRIP rows at a time,
+     with j2k.tif_deflate the strips are deflated on several threads.
  @param opendcp An opendcp_t context struct
  @param simage The source image memory buffer to encoder
  @param dfile The output file
  @return An OPENDCP_ERROR value
 */
 int opendcp_encode_tif(opendcp_t *opendcp, opendcp_image_t *image, const char *dfile) {
-    int y;
+    int y, rows;
+    int result = OPENDCP_NO_ERROR;
     TIFF *tif;
     tdata_t data;
-    UNUSED(opendcp);
+    uint32_t strip_num;
+    size_t row_bytes = ((size_t)image->w * 36 + 7) / 8;
 
     /* open tiff using filename or file descriptor */
     tif = TIFFOpen(dfile, "wb");
@@ -57,24 +164,41 @@ int opendcp_encode_tif(opendcp_t *opendcp, opendcp_image_t *image, const char *d
     TIFFSetField(tif, TIFFTAG_ORIENTATION, ORIENTATION_TOPLEFT);
     TIFFSetField(tif, TIFFTAG_PLANARCONFIG, PLANARCONFIG_CONTIG);
     TIFFSetField(tif, TIFFTAG_PHOTOMETRIC, PHOTOMETRIC_RGB);
-    TIFFSetField(tif, TIFFTAG_ROWSPERSTRIP, 1);
+    TIFFSetField(tif, TIFFTAG_ROWSPERSTRIP, TIF_ROWS_PER_STRIP);
 
-    /* allocate memory for read line */
-    data = _TIFFmalloc(TIFFScanlineSize(tif));
+    strip_num = (image->h + TIF_ROWS_PER_STRIP - 1) / TIF_ROWS_PER_STRIP;
 
-    if (data == NULL) {
-        OPENDCP_LOG(LOG_ERROR, "tiff memory allocation error: %s", dfile);
-        return OPENDCP_ERROR;
-    }
+    if (opendcp->j2k.tif_deflate) {
+        TIFFSetField(tif, TIFFTAG_COMPRESSION, COMPRESSION_ADOBE_DEFLATE);
+        result = tif_write_deflate(tif, image, strip_num, row_bytes);
+    } else {
+        /* allocate memory for a strip */
+        data = _TIFFmalloc(row_bytes * TIF_ROWS_PER_STRIP);
+
+        if (data == NULL) {
+            OPENDCP_LOG(LOG_ERROR, "tiff memory allocation error: %s", dfile);
+            TIFFClose(tif);
+            return OPENDCP_ERROR;
+        }
 
-    /* write each row */
-    for (y = 0; y<image->h; y++) {
-        opendcp_image_readline(image, y, data);
-        TIFFWriteScanline(tif, data, y, 0);
+        /* write each strip */
+        for (y = 0; y < image->h && result == OPENDCP_NO_ERROR; y += TIF_ROWS_PER_STRIP) {
+            rows = y + TIF_ROWS_PER_STRIP < image->h ? TIF_ROWS_PER_STRIP : image->h - y;
+            opendcp_image_readrows(image, y, rows, data);
+
+            if (TIFFWriteEncodedStrip(tif, y / TIF_ROWS_PER_STRIP, data, row_bytes * rows) < 0) {
+                result = OPENDCP_ERROR;
+            }
+        }
+
+        _TIFFfree(data);
     }
 
-    _TIFFfree(data);
     TIFFClose(tif);
 
-    return OPENDCP_NO_ERROR;
+    if (result != OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_ERROR, "failed to write tiff strips %s", dfile);
+    }
+
+    return result;
 }
@@ -0,0 +1,615 @@
+/*
+     OpenDCP: Builds Digital Cinema Packages
+     Copyright (c) 2010-2013 Terrence Meiczinger, All Rights Reserved
+
+     This program is free software: you can redistribute it and/or modify
+     it under the terms of the GNU General Public License as published by
+     the Free Software Foundation, either version 3 of the License, or
+     (at your option) any later version.
+
+     This program is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU General Public License for more details.
+
+     You should have received a copy of the GNU General Public License
+     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifdef __linux__
+#define _GNU_SOURCE
+#include <sys/mman.h>
+#include <sys/eventfd.h>
+#include <sys/prctl.h>
+#include <sys/wait.h>
+#include <sys/stat.h>
+#include <poll.h>
+#include <spawn.h>
+#include <signal.h>
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "opendcp.h"
+#include "opendcp_image.h"
+#include "opendcp_remote.h"
+#include "opendcp_encoder.h"
+#include "opendcp_worker.h"
+
+#define WORKER_RETRIES   2                  /* further processes a frame that killed its worker is tried on */
+#define WORKER_SHM_ROUND (1024 * 1024)      /* the memfd grows in these steps */
+#define WORKER_FD_MIN    10                 /* kept clear of the descriptors the workers inherit */
+#define WORKER_LOST      (-2)
+
+#ifdef __linux__
+extern char **environ;
+
+/* an encoder process and the memory it shares with the pipeline */
+typedef struct {
+    pid_t         pid;              /* 0 while not running */
+    int           shm;
+    int           request;
+    int           done;
+    int           life;             /* read end of the pipe the worker holds open */
+    unsigned char *map;
+    size_t        mapped;
+    int           busy;
+    int           frames;
+    int           restarts;
+} worker_proc_t;
+
+/*
+   One process per encoding thread by default, each encodes a frame at a
+   time. A thread takes an idle process, hands it the frame and waits for
+   the codestream. A process that dies is noticed by the closed pipe, it
+   is restarted for the next frame and the frame is tried again.
+*/
+struct opendcp_worker_pool {
+    int             nprocs;
+    worker_proc_t   *procs;
+    char            encoder[32];
+    char            command[MAX_PATH_LENGTH];
+    int             log_level;
+    pthread_mutex_t mutex;
+    pthread_cond_t  cond;
+};
+
+static pthread_mutex_t worker_pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* move a descriptor above the ones a worker inherits */
+static int worker_fd_high(int fd) {
+    int high;
+
+    if (fd < 0 || fd >= WORKER_FD_MIN) {
+        return fd;
+    }
+
+    high = fcntl(fd, F_DUPFD_CLOEXEC, WORKER_FD_MIN);
+    close(fd);
+
+    return high;
+}
+
+static int worker_map(int fd, unsigned char **map, size_t *mapped) {
+    struct stat st;
+    void        *p;
+
+    if (fstat(fd, &st) || st.st_size < OPENDCP_WORKER_SHM_DATA) {
+        return OPENDCP_ERROR;
+    }
+
+    if (*map && *mapped == (size_t)st.st_size) {
+        return OPENDCP_NO_ERROR;
+    }
+
+    if (*map) {
+        munmap(*map, *mapped);
+        *map = NULL;
+    }
+
+    p = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    if (p == MAP_FAILED) {
+        return OPENDCP_ERROR;
+    }
+
+    *map    = p;
+    *mapped = st.st_size;
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* grow the memfd to hold a payload, either side may */
+static int worker_reserve(int fd, unsigned char **map, size_t *mapped, size_t length) {
+    struct stat st;
+    size_t      size = OPENDCP_WORKER_SHM_DATA + length;
+
+    if (fstat(fd, &st)) {
+        return OPENDCP_ERROR;
+    }
+
+    if ((size_t)st.st_size < size) {
+        size = (size + WORKER_SHM_ROUND - 1) / WORKER_SHM_ROUND * WORKER_SHM_ROUND;
+
+        if (ftruncate(fd, size)) {
+            return OPENDCP_ERROR;
+        }
+    }
+
+    return worker_map(fd, map, mapped);
+}
+
+static void worker_proc_close(worker_proc_t *proc, int sig) {
+    if (proc->pid > 0) {
+        if (sig) {
+            kill(proc->pid, sig);
+        }
+
+        waitpid(proc->pid, NULL, 0);
+    }
+
+    if (proc->map) {
+        munmap(proc->map, proc->mapped);
+    }
+
+    if (proc->shm >= 0) close(proc->shm);
+    if (proc->request >= 0) close(proc->request);
+    if (proc->done >= 0) close(proc->done);
+    if (proc->life >= 0) close(proc->life);
+
+    proc->pid     = 0;
+    proc->shm     = proc->request = proc->done = proc->life = -1;
+    proc->map     = NULL;
+    proc->mapped  = 0;
+}
+
+static int worker_proc_start(opendcp_worker_pool_t *pool, worker_proc_t *proc) {
+    posix_spawn_file_actions_t actions;
+    opendcp_worker_shm_t       *header;
+    char                       level[16];
+    char                       *argv[8];
+    int                        life[2] = { -1, -1 };
+    int                        result;
+
+    proc->shm     = worker_fd_high(memfd_create("opendcp-worker", MFD_CLOEXEC));
+    proc->request = worker_fd_high(eventfd(0, EFD_CLOEXEC));
+    proc->done    = worker_fd_high(eventfd(0, EFD_CLOEXEC));
+
+    if (!pipe2(life, O_CLOEXEC)) {
+        proc->life = worker_fd_high(life[0]);
+        life[1]    = worker_fd_high(life[1]);
+    }
+
+    if (proc->shm < 0 || proc->request < 0 || proc->done < 0 || proc->life < 0 || life[1] < 0 ||
+        worker_reserve(proc->shm, &proc->map, &proc->mapped, WORKER_SHM_ROUND - OPENDCP_WORKER_SHM_DATA) != OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_ERROR, "could not create the shared memory of an encoder worker: %s", strerror(errno));
+        if (life[1] >= 0) close(life[1]);
+        worker_proc_close(proc, 0);
+        return OPENDCP_ERROR;
+    }
+
+    header = (opendcp_worker_shm_t *)proc->map;
+    header->magic  = OPENDCP_WORKER_MAGIC;
+    header->length = 0;
+
+    snprintf(level, sizeof(level), "%d", pool->log_level);
+    argv[0] = pool->command;
+    argv[1] = "--worker";
+    argv[2] = "-e";
+    argv[3] = pool->encoder;
+    argv[4] = "-l";
+    argv[5] = level;
+    argv[6] = NULL;
+
+    /* dup2 clears close on exec on the copies the worker inherits */
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_adddup2(&actions, proc->shm, OPENDCP_WORKER_FD_SHM);
+    posix_spawn_file_actions_adddup2(&actions, proc->request, OPENDCP_WORKER_FD_REQUEST);
+    posix_spawn_file_actions_adddup2(&actions, proc->done, OPENDCP_WORKER_FD_DONE);
+    posix_spawn_file_actions_adddup2(&actions, life[1], OPENDCP_WORKER_FD_LIFE);
+
+    result = posix_spawnp(&proc->pid, pool->command, &actions, NULL, argv, environ);
+
+    posix_spawn_file_actions_destroy(&actions);
+    close(life[1]);
+
+    if (result) {
+        OPENDCP_LOG(LOG_ERROR, "could not start encoder worker %s: %s", pool->command, strerror(result));
+        proc->pid = 0;
+        worker_proc_close(proc, 0);
+        return OPENDCP_ERROR;
+    }
+
+    OPENDCP_LOG(LOG_DEBUG, "started encoder worker %d", (int)proc->pid);
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* hand a frame to a worker and wait for its codestream, WORKER_LOST if the worker died */
+static int worker_proc_encode(worker_proc_t *proc, opendcp_t *opendcp, opendcp_image_t *image, size_t size,
+                              unsigned char **data, int *length) {
+    opendcp_worker_shm_t *header;
+    struct pollfd        fds[2];
+    const unsigned char  *out;
+    uint64_t             signal = 1;
+    int                  status, n;
+
+    if (worker_reserve(proc->shm, &proc->map, &proc->mapped, size) != OPENDCP_NO_ERROR ||
+        opendcp_remote_pack_into(opendcp, image, proc->map + OPENDCP_WORKER_SHM_DATA) != OPENDCP_NO_ERROR) {
+        return OPENDCP_ERROR;
+    }
+
+    header = (opendcp_worker_shm_t *)proc->map;
+    header->length = size;
+
+    if (write(proc->request, &signal, sizeof(signal)) != sizeof(signal)) {
+        return WORKER_LOST;
+    }
+
+    fds[0].fd     = proc->done;
+    fds[0].events = POLLIN;
+    fds[1].fd     = proc->life;
+    fds[1].events = POLLIN;
+
+    while (1) {
+        n = poll(fds, 2, -1);
+
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+
+        if (n > 0 && (fds[0].revents & POLLIN)) {
+            break;
+        }
+
+        if (n < 0 || fds[1].revents) {
+            return WORKER_LOST;
+        }
+    }
+
+    if (read(proc->done, &signal, sizeof(signal)) != sizeof(signal) ||
+        worker_map(proc->shm, &proc->map, &proc->mapped) != OPENDCP_NO_ERROR) {
+        return WORKER_LOST;
+    }
+
+    header = (opendcp_worker_shm_t *)proc->map;
+
+    if (header->length < 4 || header->length > proc->mapped - OPENDCP_WORKER_SHM_DATA) {
+        return WORKER_LOST;
+    }
+
+    out    = proc->map + OPENDCP_WORKER_SHM_DATA;
+    status = (out[0] << 24) | (out[1] << 16) | (out[2] << 8) | out[3];
+
+    if (status != OPENDCP_NO_ERROR || header->length == 4) {
+        return OPENDCP_ERROR;
+    }
+
+    *length = header->length - 4;
+    *data   = malloc(*length);
+
+    if (!*data) {
+        return OPENDCP_ERROR;
+    }
+
+    memcpy(*data, out + 4, *length);
+
+    return OPENDCP_NO_ERROR;
+}
+
+static opendcp_worker_pool_t *worker_pool_create(opendcp_t *opendcp) {
+    opendcp_worker_pool_t *pool;
+    int                   i;
+
+    pool = calloc(1, sizeof(opendcp_worker_pool_t));
+
+    if (!pool) {
+        return NULL;
+    }
+
+    pool->nprocs = opendcp->worker.count > 0 ? opendcp->worker.count : (opendcp->threads > 0 ? opendcp->threads : 1);
+    pool->procs  = calloc(pool->nprocs, sizeof(worker_proc_t));
+
+    if (!pool->procs) {
+        free(pool);
+        return NULL;
+    }
+
+    for (i = 0; i < pool->nprocs; i++) {
+        pool->procs[i].shm = pool->procs[i].request = pool->procs[i].done = pool->procs[i].life = -1;
+    }
+
+    snprintf(pool->encoder, sizeof(pool->encoder), "%s", opendcp->worker.encoder ? opendcp->worker.encoder : "openjpeg");
+    snprintf(pool->command, sizeof(pool->command), "%s", opendcp->worker.command ? opendcp->worker.command : OPENDCP_WORKER_COMMAND);
+    pool->log_level = opendcp->log_level;
+    pthread_mutex_init(&pool->mutex, NULL);
+    pthread_cond_init(&pool->cond, NULL);
+
+    return pool;
+}
+
+static opendcp_worker_pool_t *worker_pool(opendcp_t *opendcp) {
+    opendcp_worker_pool_t *pool;
+
+    pthread_mutex_lock(&worker_pool_mutex);
+
+    if (!opendcp->worker.pool) {
+        opendcp->worker.pool = worker_pool_create(opendcp);
+    }
+
+    pool = opendcp->worker.pool;
+
+    pthread_mutex_unlock(&worker_pool_mutex);
+
+    return pool;
+}
+
+static worker_proc_t *worker_pool_acquire(opendcp_worker_pool_t *pool) {
+    worker_proc_t *proc = NULL;
+    int           i;
+
+    pthread_mutex_lock(&pool->mutex);
+
+    while (1) {
+        /* a running process before one that has to be started */
+        for (i = 0; i < pool->nprocs; i++) {
+            if (!pool->procs[i].busy && (!proc || (!proc->pid && pool->procs[i].pid))) {
+                proc = &pool->procs[i];
+            }
+        }
+
+        if (proc) {
+            break;
+        }
+
+        pthread_cond_wait(&pool->cond, &pool->mutex);
+    }
+
+    proc->busy = 1;
+
+    pthread_mutex_unlock(&pool->mutex);
+
+    return proc;
+}
+
+static void worker_pool_release(opendcp_worker_pool_t *pool, worker_proc_t *proc) {
+    pthread_mutex_lock(&pool->mutex);
+    proc->busy = 0;
+    pthread_cond_signal(&pool->cond);
+    pthread_mutex_unlock(&pool->mutex);
+}
+
+/*!
+ @function opendcp_worker_stop
+ @abstract Stops the encoder worker processes of a context, if started.
+ @discussion No encode may be in progress on the context. The frames and
+     restarts of each worker are logged.
+ @param opendcp The opendcp context.
+*/
+void opendcp_worker_stop(opendcp_t *opendcp) {
+    opendcp_worker_pool_t *pool;
+    worker_proc_t         *proc;
+    int                   i;
+
+    pthread_mutex_lock(&worker_pool_mutex);
+
+    pool = opendcp->worker.pool;
+    opendcp->worker.pool = NULL;
+
+    pthread_mutex_unlock(&worker_pool_mutex);
+
+    if (!pool) {
+        return;
+    }
+
+    for (i = 0; i < pool->nprocs; i++) {
+        proc = &pool->procs[i];
+
+        if (proc->frames || proc->restarts) {
+            OPENDCP_LOG(LOG_INFO, "encoder worker %d encoded %d frames, restarted %d times", i, proc->frames, proc->restarts);
+        }
+
+        worker_proc_close(proc, SIGTERM);
+    }
+
+    pthread_cond_destroy(&pool->cond);
+    pthread_mutex_destroy(&pool->mutex);
+    free(pool->procs);
+    free(pool);
+}
+
+/*!
+ @function opendcp_encode_worker_buffer
+ @abstract Encodes an image in an encoder worker process into memory.
+ @discussion Safe to call from several threads. worker.encoder runs in up
+     to worker.count processes, the image and the codestream pass through
+     memory shared with the process. A frame whose worker dies is tried on
+     a restarted worker up to WORKER_RETRIES more times.
+ @param opendcp The opendcp context.
+ @param opendcp_image The conformed image to encode.
+ @param data Receives the codestream, to be freed by the caller.
+ @param length Receives the codestream length.
+ @return OPENDCP_NO_ERROR on success, OPENDCP_ERROR on failure.
+*/
+int opendcp_encode_worker_buffer(opendcp_t *opendcp, opendcp_image_t *opendcp_image, unsigned char **data, int *length) {
+    opendcp_worker_pool_t *pool;
+    worker_proc_t         *proc;
+    size_t                size;
+    int                   attempt;
+    int                   result = WORKER_LOST;
+
+    *data   = NULL;
+    *length = 0;
+
+    pool = worker_pool(opendcp);
+    size = opendcp_remote_pack_size(opendcp_image);
+
+    if (!pool || !size) {
+        OPENDCP_LOG(LOG_ERROR, "image can not be sent to an encoder worker");
+        return OPENDCP_ERROR;
+    }
+
+    for (attempt = 0; attempt <= WORKER_RETRIES && result == WORKER_LOST; attempt++) {
+        proc = worker_pool_acquire(pool);
+
+        if (!proc->pid && worker_proc_start(pool, proc) != OPENDCP_NO_ERROR) {
+            worker_pool_release(pool, proc);
+            return OPENDCP_ERROR;
+        }
+
+        result = worker_proc_encode(proc, opendcp, opendcp_image, size, data, length);
+
+        if (result == OPENDCP_NO_ERROR) {
+            proc->frames++;
+        }
+        else if (result == WORKER_LOST) {
+            OPENDCP_LOG(LOG_WARN, "encoder worker %d died, restarting it", (int)proc->pid);
+            worker_proc_close(proc, SIGKILL);
+            proc->restarts++;
+        }
+
+        worker_pool_release(pool, proc);
+    }
+
+    if (result != OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_ERROR, "worker encode failed after %d attempts", attempt);
+        return OPENDCP_ERROR;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*!
+ @function opendcp_worker_serve
+ @abstract Runs the worker side of an encoder worker process.
+ @discussion Encodes the frames the pipeline hands over the inherited
+     descriptors until the pipeline closes them or exits.
+ @param encode Encodes a request payload to a result payload.
+ @param arg Passed to encode.
+ @return OPENDCP_NO_ERROR once the pipeline is gone, OPENDCP_ERROR if the descriptors are unusable.
+*/
+int opendcp_worker_serve(opendcp_worker_encode_t encode, void *arg) {
+    opendcp_worker_shm_t *header;
+    unsigned char        *map = NULL, *out;
+    unsigned char        failed[4] = { 0, 0, 0, OPENDCP_ERROR };
+    size_t               mapped = 0;
+    uint32_t             out_length;
+    uint64_t             signal;
+
+    /* go with the pipeline rather than outlive it */
+    prctl(PR_SET_PDEATHSIG, SIGKILL);
+
+    if (getppid() == 1 || worker_map(OPENDCP_WORKER_FD_SHM, &map, &mapped) != OPENDCP_NO_ERROR ||
+        ((opendcp_worker_shm_t *)map)->magic != OPENDCP_WORKER_MAGIC) {
+        OPENDCP_LOG(LOG_ERROR, "not started as an encoder worker");
+        return OPENDCP_ERROR;
+    }
+
+    while (read(OPENDCP_WORKER_FD_REQUEST, &signal, sizeof(signal)) == sizeof(signal)) {
+        if (worker_map(OPENDCP_WORKER_FD_SHM, &map, &mapped) != OPENDCP_NO_ERROR) {
+            return OPENDCP_ERROR;
+        }
+
+        header = (opendcp_worker_shm_t *)map;
+        out    = NULL;
+
+        if (header->length <= mapped - OPENDCP_WORKER_SHM_DATA) {
+            out = encode(arg, map + OPENDCP_WORKER_SHM_DATA, header->length, &out_length);
+        }
+
+        if (out && worker_reserve(OPENDCP_WORKER_FD_SHM, &map, &mapped, out_length) != OPENDCP_NO_ERROR) {
+            free(out);
+            out = NULL;
+        }
+
+        header = (opendcp_worker_shm_t *)map;
+
+        if (out) {
+            memcpy(map + OPENDCP_WORKER_SHM_DATA, out, out_length);
+            header->length = out_length;
+            free(out);
+        }
+        else {
+            memcpy(map + OPENDCP_WORKER_SHM_DATA, failed, sizeof(failed));
+            header->length = sizeof(failed);
+        }
+
+        signal = 1;
+
+        if (write(OPENDCP_WORKER_FD_DONE, &signal, sizeof(signal)) != sizeof(signal)) {
+            break;
+        }
+    }
+
+    munmap(map, mapped);
+
+    return OPENDCP_NO_ERROR;
+}
+#else
+void opendcp_worker_stop(opendcp_t *opendcp) {
+    UNUSED(opendcp);
+}
+
+int opendcp_encode_worker_buffer(opendcp_t *opendcp, opendcp_image_t *opendcp_image, unsigned char **data, int *length) {
+    UNUSED(opendcp);
+    UNUSED(opendcp_image);
+
+    *data   = NULL;
+    *length = 0;
+
+    OPENDCP_LOG(LOG_ERROR, "encoder worker processes are only available on linux");
+
+    return OPENDCP_ERROR;
+}
+
+int opendcp_worker_serve(opendcp_worker_encode_t encode, void *arg) {
+    UNUSED(encode);
+    UNUSED(arg);
+
+    return OPENDCP_ERROR;
+}
+#endif
+
+int opendcp_encode_worker(opendcp_t *opendcp, opendcp_image_t *opendcp_image, char *output_file) {
+    unsigned char *data;
+    int           length;
+    int           result;
+    FILE          *fp;
+
+    result = opendcp_encode_worker_buffer(opendcp, opendcp_image, &data, &length);
+
+    if (result != OPENDCP_NO_ERROR) {
+        return result;
+    }
+
+    fp = fopen(output_file, "wb");
+
+    if (!fp || fwrite(data, 1, length, fp) != (size_t)length) {
+        OPENDCP_LOG(LOG_ERROR, "could not write JPEG2000 file %s", output_file);
+        result = OPENDCP_ERROR;
+    }
+
+    if (fp) {
+        fclose(fp);
+    }
+
+    free(data);
+
+    return result;
+}
+
+/* the processes are stopped after each conversion, which logs the per worker stats */
+const opendcp_encoder_hooks_t opendcp_worker_hooks = {
+    NULL,
+    opendcp_worker_stop,
+    opendcp_encode_worker_buffer,
+    NULL,
+    1,
+    NULL
+};
@@ -0,0 +1,107 @@
+/*
+     OpenDCP: Builds Digital Cinema Packages
+     Copyright (c) 2010-2013 Terrence Meiczinger, All Rights Reserved
+
+     This program is free software: you can redistribute it and/or modify
+     it under the terms of the GNU General Public License as published by
+     the Free Software Foundation, either version 3 of the License, or
+     (at your option) any later version.
+
+     This program is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU General Public License for more details.
+
+     You should have received a copy of the GNU General Public License
+     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _OPENDCP_RAW_H_
+#define _OPENDCP_RAW_H_
+
+#include <stdint.h>
+#include <string.h>
+
+/*
+   Raw planar intermediate frames (.odr), passed between tools or machines
+   instead of tiffs. A fixed header block is followed by the three planes,
+   each a row major array of 16-bit little endian samples. The header block
+   and the planes are padded to OPENDCP_RAW_ALIGN bytes so the file can be
+   written with O_DIRECT and mapped without copies.
+
+   header, little endian:
+       0  magic "ODCPRAW1"
+       8  header size, the offset of the first plane
+      12  width
+      16  height
+      20  components, always 3
+      24  precision, bits per sample, 12 or 16
+      28  flags, OPENDCP_RAW_XYZ
+      32  plane size, the distance from one plane to the next (64-bit)
+*/
+
+#define OPENDCP_RAW_MAGIC      "ODCPRAW1"
+#define OPENDCP_RAW_ALIGN      4096
+#define OPENDCP_RAW_FIELDS     40
+
+/* the samples are already X'Y'Z' */
+#define OPENDCP_RAW_XYZ        0x01
+
+typedef struct {
+    uint32_t header_size;
+    uint32_t w;
+    uint32_t h;
+    uint32_t components;
+    uint32_t precision;
+    uint32_t flags;
+    uint64_t plane_size;
+} opendcp_raw_header_t;
+
+static inline uint64_t opendcp_raw_get(const uint8_t *p, int bytes) {
+    uint64_t v = 0;
+
+    while (bytes--) {
+        v = (v << 8) | p[bytes];
+    }
+
+    return v;
+}
+
+static inline void opendcp_raw_put(uint8_t *p, uint64_t v, int bytes) {
+    int i;
+
+    for (i = 0; i < bytes; i++, v >>= 8) {
+        p[i] = (uint8_t)v;
+    }
+}
+
+/* serialize the header into the first OPENDCP_RAW_FIELDS bytes of a block */
+static inline void opendcp_raw_header_write(const opendcp_raw_header_t *header, uint8_t *p) {
+    memcpy(p, OPENDCP_RAW_MAGIC, 8);
+    opendcp_raw_put(p + 8,  header->header_size, 4);
+    opendcp_raw_put(p + 12, header->w, 4);
+    opendcp_raw_put(p + 16, header->h, 4);
+    opendcp_raw_put(p + 20, header->components, 4);
+    opendcp_raw_put(p + 24, header->precision, 4);
+    opendcp_raw_put(p + 28, header->flags, 4);
+    opendcp_raw_put(p + 32, header->plane_size, 8);
+}
+
+/* returns 0 if the bytes do not start with a raw header */
+static inline int opendcp_raw_header_read(opendcp_raw_header_t *header, const uint8_t *p, size_t size) {
+    if (size < OPENDCP_RAW_FIELDS || memcmp(p, OPENDCP_RAW_MAGIC, 8)) {
+        return 0;
+    }
+
+    header->header_size = (uint32_t)opendcp_raw_get(p + 8, 4);
+    header->w           = (uint32_t)opendcp_raw_get(p + 12, 4);
+    header->h           = (uint32_t)opendcp_raw_get(p + 16, 4);
+    header->components  = (uint32_t)opendcp_raw_get(p + 20, 4);
+    header->precision   = (uint32_t)opendcp_raw_get(p + 24, 4);
+    header->flags       = (uint32_t)opendcp_raw_get(p + 28, 4);
+    header->plane_size  = opendcp_raw_get(p + 32, 8);
+
+    return 1;
+}
+
+#endif
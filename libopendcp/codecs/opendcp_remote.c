@@ -0,0 +1,551 @@
+/*
+     OpenDCP: Builds Digital Cinema Packages
+     Copyright (c) 2010-2013 Terrence Meiczinger, All Rights Reserved
+
+     This program is free software: you can redistribute it and/or modify
+     it under the terms of the GNU General Public License as published by
+     the Free Software Foundation, either version 3 of the License, or
+     (at your option) any later version.
+
+     This program is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU General Public License for more details.
+
+     You should have received a copy of the GNU General Public License
+     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <zlib.h>
+#if WIN32
+#include <winsock2.h>
+#include <ws2ipdef.h>
+#include <ws2tcpip.h>
+#else
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+#endif
+
+#include "opendcp.h"
+#include "opendcp_image.h"
+#include "opendcp_remote.h"
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+static void put_u32(unsigned char *p, uint32_t v) {
+    v = htonl(v);
+    memcpy(p, &v, 4);
+}
+
+static uint32_t get_u32(const unsigned char *p) {
+    uint32_t v;
+
+    memcpy(&v, p, 4);
+
+    return ntohl(v);
+}
+
+/*!
+ @function opendcp_remote_connect
+ @abstract Opens a connection to a remote encoder.
+ @param host The host name or address of the encoder.
+ @param port The port of the encoder, OPENDCP_REMOTE_PORT if NULL.
+ @return The socket, or -1 if no connection could be made.
+*/
+int opendcp_remote_connect(const char *host, const char *port) {
+    struct addrinfo hints, *server, *a;
+    int fd = -1;
+    int one = 1;
+    int rc;
+
+    memset(&hints, 0, sizeof(struct addrinfo));
+    hints.ai_family   = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+
+    rc = getaddrinfo(host, port ? port : OPENDCP_REMOTE_PORT, &hints, &server);
+
+    if (rc) {
+        OPENDCP_LOG(LOG_ERROR, "could not resolve remote encoder %s: %s", host, gai_strerror(rc));
+        return -1;
+    }
+
+    for (a = server; a; a = a->ai_next) {
+        fd = socket(a->ai_family, a->ai_socktype, a->ai_protocol);
+
+        if (fd < 0) {
+            continue;
+        }
+
+        if (connect(fd, a->ai_addr, a->ai_addrlen) == 0) {
+            break;
+        }
+
+        close(fd);
+        fd = -1;
+    }
+
+    freeaddrinfo(server);
+
+    if (fd < 0) {
+        OPENDCP_LOG(LOG_ERROR, "could not connect to remote encoder %s:%s", host, port ? port : OPENDCP_REMOTE_PORT);
+        return -1;
+    }
+
+    /* requests are pipelined, do not hold back the small headers */
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, (void *)&one, sizeof(one));
+
+    OPENDCP_LOG(LOG_DEBUG, "connected to remote encoder %s:%s", host, port ? port : OPENDCP_REMOTE_PORT);
+
+    return fd;
+}
+
+void opendcp_remote_close_socket(int fd) {
+    if (fd >= 0) {
+        close(fd);
+    }
+}
+
+/* write all of a buffer */
+static int remote_send_all(int fd, const unsigned char *buffer, size_t length) {
+    ssize_t n;
+
+    while (length) {
+        n = send(fd, (const void *)buffer, length, MSG_NOSIGNAL);
+
+        if (n <= 0) {
+            return OPENDCP_ERROR;
+        }
+
+        buffer += n;
+        length -= n;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*!
+ @function opendcp_remote_send
+ @abstract Sends one message.
+ @discussion Messages from several threads on one socket must be serialized
+     by the caller.
+ @return OPENDCP_NO_ERROR on success, OPENDCP_ERROR if the connection failed.
+*/
+int opendcp_remote_send(int fd, int type, uint32_t id, const unsigned char *payload, uint32_t length) {
+    unsigned char header[OPENDCP_REMOTE_HEADER_SIZE];
+
+    put_u32(header,      OPENDCP_REMOTE_MAGIC);
+    put_u32(header + 4,  type);
+    put_u32(header + 8,  id);
+    put_u32(header + 12, length);
+
+    if (remote_send_all(fd, header, sizeof(header)) != OPENDCP_NO_ERROR) {
+        return OPENDCP_ERROR;
+    }
+
+    if (length && remote_send_all(fd, payload, length) != OPENDCP_NO_ERROR) {
+        return OPENDCP_ERROR;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*!
+ @function opendcp_remote_recv
+ @abstract Reads exactly length bytes.
+ @return OPENDCP_NO_ERROR on success, OPENDCP_ERROR on a short read or failure.
+*/
+int opendcp_remote_recv(int fd, unsigned char *buffer, size_t length) {
+    ssize_t n;
+
+    while (length) {
+        n = recv(fd, (void *)buffer, length, 0);
+
+        if (n <= 0) {
+            return OPENDCP_ERROR;
+        }
+
+        buffer += n;
+        length -= n;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*!
+ @function opendcp_remote_recv_header
+ @abstract Reads and checks a message header.
+ @return OPENDCP_NO_ERROR on success, OPENDCP_ERROR if the connection failed
+     or the header is not a valid message.
+*/
+int opendcp_remote_recv_header(int fd, opendcp_remote_header_t *header) {
+    unsigned char buffer[OPENDCP_REMOTE_HEADER_SIZE];
+
+    if (opendcp_remote_recv(fd, buffer, sizeof(buffer)) != OPENDCP_NO_ERROR) {
+        return OPENDCP_ERROR;
+    }
+
+    header->magic  = get_u32(buffer);
+    header->type   = get_u32(buffer + 4);
+    header->id     = get_u32(buffer + 8);
+    header->length = get_u32(buffer + 12);
+
+    if (header->magic != OPENDCP_REMOTE_MAGIC || header->length > OPENDCP_REMOTE_MAX_PAYLOAD) {
+        OPENDCP_LOG(LOG_ERROR, "invalid remote encoder message");
+        return OPENDCP_ERROR;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* bytes of one component at the given sample size */
+static size_t remote_plane_size(int w, int h, int bits) {
+    size_t n = (size_t)w * h;
+
+    return bits == 12 ? (n * 3 + 1) / 2 : n * 2;
+}
+
+/* the bits are resolved once per row, row holds image->w samples */
+static void remote_pack_plane(const opendcp_image_t *image, int c, int bits, int *row, unsigned char *p) {
+    int x, y, v, odd = 0, held = 0;
+
+    for (y = 0; y < image->h; y++) {
+        opendcp_image_get_row(image, c, y, row);
+
+        if (bits == 16) {
+            for (x = 0; x < image->w; x++) {
+                *p++ = (row[x] >> 8) & 0xff;
+                *p++ = row[x] & 0xff;
+            }
+
+            continue;
+        }
+
+        x = 0;
+
+        /* a pair left open by the previous row */
+        if (odd) {
+            v    = row[x++] & 0xfff;
+            *p++ = held >> 4;
+            *p++ = ((held & 0x0f) << 4) | (v >> 8);
+            *p++ = v & 0xff;
+        }
+
+        for (; x + 1 < image->w; x += 2) {
+            held = row[x] & 0xfff;
+            v    = row[x + 1] & 0xfff;
+            *p++ = held >> 4;
+            *p++ = ((held & 0x0f) << 4) | (v >> 8);
+            *p++ = v & 0xff;
+        }
+
+        odd = x < image->w;
+
+        if (odd) {
+            held = row[x] & 0xfff;
+        }
+    }
+
+    if (odd) {
+        *p++ = held >> 4;
+        *p   = (held & 0x0f) << 4;
+    }
+}
+
+/* the image is one created as int samples */
+static void remote_unpack_plane(opendcp_image_t *image, int c, int bits, const unsigned char *p) {
+    int x, y, odd = 0;
+
+    for (y = 0; y < image->h; y++) {
+        int *d = &image->component[c].data[image->component[c].stride * y];
+
+        if (bits == 16) {
+            for (x = 0; x < image->w; x++) {
+                d[x] = (p[0] << 8) | p[1];
+                p   += 2;
+            }
+
+            continue;
+        }
+
+        x = 0;
+
+        if (odd) {
+            d[x++] = ((p[1] & 0x0f) << 8) | p[2];
+            p     += 3;
+        }
+
+        for (; x + 1 < image->w; x += 2) {
+            d[x]     = (p[0] << 4) | (p[1] >> 4);
+            d[x + 1] = ((p[1] & 0x0f) << 8) | p[2];
+            p       += 3;
+        }
+
+        odd = x < image->w;
+
+        if (odd) {
+            d[x] = (p[0] << 4) | (p[1] >> 4);
+        }
+    }
+}
+
+static void remote_pack_params(opendcp_t *opendcp, opendcp_image_t *image, int bits, int compress, int xyz, unsigned char *payload) {
+    put_u32(payload,      image->w);
+    put_u32(payload + 4,  image->h);
+    put_u32(payload + 8,  image->n_components);
+    put_u32(payload + 12, image->precision);
+    put_u32(payload + 16, opendcp->cinema_profile);
+    put_u32(payload + 20, opendcp->j2k.bw);
+    put_u32(payload + 24, opendcp->frame_rate);
+    put_u32(payload + 28, opendcp->stereoscopic);
+    put_u32(payload + 32, bits);
+    put_u32(payload + 36, compress ? REMOTE_COMPRESSION_ZLIB : REMOTE_COMPRESSION_NONE);
+    put_u32(payload + 40, xyz);
+    put_u32(payload + 44, opendcp->j2k.lut);
+    put_u32(payload + 48, opendcp->j2k.xyz_method);
+}
+
+/*!
+ @function opendcp_remote_pack_size
+ @abstract Returns the length of an uncompressed encode request.
+ @param image The conformed image.
+ @return The payload length, 0 if the image can not be sent.
+*/
+size_t opendcp_remote_pack_size(opendcp_image_t *image) {
+    size_t size;
+
+    if (image->precision > 16) {
+        return 0;
+    }
+
+    size = OPENDCP_REMOTE_PARAMS_SIZE + (size_t)image->n_components * (4 + remote_plane_size(image->w, image->h, image->precision > 12 ? 16 : 12));
+
+    return size > OPENDCP_REMOTE_MAX_PAYLOAD ? 0 : size;
+}
+
+/*!
+ @function opendcp_remote_pack_into
+ @abstract Builds an uncompressed encode request in a buffer of the caller.
+ @discussion The payload is the one opendcp_remote_pack_image builds
+     without remote.compress and remote.xyz, the image is already in its
+     final color space. Used where the buffer is shared with the encoder,
+     so the samples are copied once.
+ @param opendcp The opendcp context holding the encode settings.
+ @param image The conformed image.
+ @param payload The buffer, opendcp_remote_pack_size bytes.
+ @return OPENDCP_NO_ERROR on success, OPENDCP_ERROR on failure.
+*/
+int opendcp_remote_pack_into(opendcp_t *opendcp, opendcp_image_t *image, unsigned char *payload) {
+    unsigned char *p;
+    size_t        plane_size;
+    int           bits, c;
+    int           *row;
+
+    if (!opendcp_remote_pack_size(image) || !(row = malloc(image->w * sizeof(int)))) {
+        return OPENDCP_ERROR;
+    }
+
+    bits       = image->precision > 12 ? 16 : 12;
+    plane_size = remote_plane_size(image->w, image->h, bits);
+
+    remote_pack_params(opendcp, image, bits, 0, 0, payload);
+
+    for (p = payload + OPENDCP_REMOTE_PARAMS_SIZE, c = 0; c < image->n_components; c++, p += 4 + plane_size) {
+        remote_pack_plane(image, c, bits, row, p + 4);
+        put_u32(p, plane_size);
+    }
+
+    free(row);
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*!
+ @function opendcp_remote_pack_image
+ @abstract Builds the payload of an encode request.
+ @discussion Images of up to 12 bits are sent as packed 12-bit samples,
+     deeper ones as 16-bit samples. With remote.compress set each component
+     is zlib compressed, unless that does not make it smaller.
+ @param opendcp The opendcp context holding the encode settings.
+ @param image The conformed image, its precision must not exceed 16 bits.
+ @param length Receives the payload length.
+ @return The payload, to be freed by the caller, or NULL on failure.
+*/
+unsigned char *opendcp_remote_pack_image(opendcp_t *opendcp, opendcp_image_t *image, uint32_t *length) {
+    unsigned char *payload, *p, *plane = NULL;
+    size_t        size, plane_size;
+    uLongf        packed;
+    int           bits, compress, xyz, c;
+    int           *row;
+
+    if (image->precision > 16) {
+        OPENDCP_LOG(LOG_ERROR, "remote encoding supports up to 16-bit samples");
+        return NULL;
+    }
+
+    bits       = image->precision > 12 ? 16 : 12;
+    compress   = opendcp->remote.compress;
+    xyz        = opendcp->remote.xyz && opendcp->j2k.xyz && !opendcp->j2k.cube;
+    plane_size = remote_plane_size(image->w, image->h, bits);
+    size       = OPENDCP_REMOTE_PARAMS_SIZE + (size_t)image->n_components * (4 + plane_size);
+
+    if (size > OPENDCP_REMOTE_MAX_PAYLOAD) {
+        OPENDCP_LOG(LOG_ERROR, "image is too large for remote encoding");
+        return NULL;
+    }
+
+    payload = malloc(size);
+    row     = malloc(image->w * sizeof(int));
+
+    if (compress) {
+        plane = malloc(plane_size);
+    }
+
+    if (!payload || !row || (compress && !plane)) {
+        OPENDCP_LOG(LOG_ERROR, "unable to allocate memory for remote encode request");
+        free(payload);
+        free(row);
+        free(plane);
+        return NULL;
+    }
+
+    remote_pack_params(opendcp, image, bits, compress, xyz, payload);
+
+    p = payload + OPENDCP_REMOTE_PARAMS_SIZE;
+
+    for (c = 0; c < image->n_components; c++) {
+        if (!compress) {
+            remote_pack_plane(image, c, bits, row, p + 4);
+            put_u32(p, plane_size);
+            p += 4 + plane_size;
+            continue;
+        }
+
+        /* a plane compressed into no less than its packed size is sent as is */
+        remote_pack_plane(image, c, bits, row, plane);
+        packed = plane_size - 1;
+
+        if (compress2(p + 4, &packed, plane, plane_size, Z_BEST_SPEED) != Z_OK) {
+            memcpy(p + 4, plane, plane_size);
+            packed = plane_size;
+        }
+
+        put_u32(p, packed);
+        p += 4 + packed;
+    }
+
+    free(row);
+    free(plane);
+    *length = p - payload;
+
+    return payload;
+}
+
+/*!
+ @function opendcp_remote_unpack_image
+ @abstract Rebuilds the settings and image of an encode request.
+ @param payload The request payload.
+ @param length The payload length.
+ @param params Receives the encode settings.
+ @param image Receives the image, to be freed with opendcp_image_free.
+ @return OPENDCP_NO_ERROR on success, OPENDCP_ERROR if the payload is invalid.
+*/
+int opendcp_remote_unpack_image(const unsigned char *payload, uint32_t length, opendcp_remote_params_t *params, opendcp_image_t **image) {
+    const unsigned char *p, *end;
+    unsigned char       *plane = NULL;
+    opendcp_image_t     *out;
+    size_t              plane_size, n;
+    uLongf              unpacked;
+    int                 c;
+
+    if (length < OPENDCP_REMOTE_PARAMS_SIZE) {
+        return OPENDCP_ERROR;
+    }
+
+    params->w            = get_u32(payload);
+    params->h            = get_u32(payload + 4);
+    params->n_components = get_u32(payload + 8);
+    params->precision    = get_u32(payload + 12);
+    params->profile      = get_u32(payload + 16);
+    params->bw           = get_u32(payload + 20);
+    params->frame_rate   = get_u32(payload + 24);
+    params->stereoscopic = get_u32(payload + 28);
+    params->sample_bits  = get_u32(payload + 32);
+    params->compression  = get_u32(payload + 36);
+    params->xyz          = get_u32(payload + 40);
+    params->lut          = get_u32(payload + 44);
+    params->xyz_method   = get_u32(payload + 48);
+
+    if (params->w <= 0 || params->h <= 0 || params->n_components <= 0 || params->n_components > 4 ||
+        params->precision <= 0 || params->precision > params->sample_bits ||
+        (params->sample_bits != 12 && params->sample_bits != 16) ||
+        (params->compression != REMOTE_COMPRESSION_NONE && params->compression != REMOTE_COMPRESSION_ZLIB) ||
+        (size_t)params->w * params->h > OPENDCP_REMOTE_MAX_PAYLOAD) {
+        OPENDCP_LOG(LOG_ERROR, "invalid remote encode request");
+        return OPENDCP_ERROR;
+    }
+
+    plane_size = remote_plane_size(params->w, params->h, params->sample_bits);
+
+    if (params->compression == REMOTE_COMPRESSION_ZLIB && !(plane = malloc(plane_size))) {
+        return OPENDCP_ERROR;
+    }
+
+    out = opendcp_image_create(params->n_components, params->w, params->h);
+
+    if (!out) {
+        free(plane);
+        return OPENDCP_ERROR;
+    }
+
+    out->bpp       = params->precision;
+    out->precision = params->precision;
+
+    p   = payload + OPENDCP_REMOTE_PARAMS_SIZE;
+    end = payload + length;
+
+    for (c = 0; c < params->n_components; c++) {
+        if (end - p < 4 || (size_t)(end - p - 4) < (n = get_u32(p)) || n > plane_size ||
+            (n < plane_size && params->compression != REMOTE_COMPRESSION_ZLIB)) {
+            break;
+        }
+
+        p += 4;
+
+        if (n == plane_size) {
+            remote_unpack_plane(out, c, params->sample_bits, p);
+        }
+        else {
+            unpacked = plane_size;
+
+            if (uncompress(plane, &unpacked, p, n) != Z_OK || unpacked != plane_size) {
+                break;
+            }
+
+            remote_unpack_plane(out, c, params->sample_bits, plane);
+        }
+
+        p += n;
+    }
+
+    free(plane);
+
+    if (c < params->n_components || p != end) {
+        OPENDCP_LOG(LOG_ERROR, "invalid remote encode request");
+        opendcp_image_free(out);
+        return OPENDCP_ERROR;
+    }
+
+    *image = out;
+
+    return OPENDCP_NO_ERROR;
+}
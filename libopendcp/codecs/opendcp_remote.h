@@ -0,0 +1,113 @@
+/*
+     OpenDCP: Builds Digital Cinema Packages
+     Copyright (c) 2010-2013 Terrence Meiczinger, All Rights Reserved
+
+     This program is free software: you can redistribute it and/or modify
+     it under the terms of the GNU General Public License as published by
+     the Free Software Foundation, either version 3 of the License, or
+     (at your option) any later version.
+
+     This program is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU General Public License for more details.
+
+     You should have received a copy of the GNU General Public License
+     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _OPENDCP_REMOTE_H_
+#define _OPENDCP_REMOTE_H_
+
+#include <stdint.h>
+#include "opendcp.h"
+#include "opendcp_image.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+   Remote encode protocol
+
+   Every message is a 16 byte header followed by length bytes of payload.
+   All integers are 32-bit unsigned in network byte order.
+
+       magic | type | id | length | payload
+
+   A client may send any number of requests on one connection before
+   reading the results. The server answers each request with a message
+   of the matching result type carrying the same id, not necessarily in
+   the order the requests were sent.
+
+   REMOTE_ENCODE_REQUEST payload:
+       width, height, components, precision, profile, bw, frame rate,
+       stereoscopic, sample bits, compression, xyz, lut, xyz method,
+       followed by each component in turn as its length and its samples.
+
+       The samples of a component are stored row by row as 12-bit values,
+       two in three bytes, or as 16-bit values. A component shorter than
+       its packed size is zlib compressed. When xyz is set the samples are
+       RGB and the server converts them with the lut and method given.
+
+   REMOTE_ENCODE_RESULT payload:
+       status (OPENDCP_NO_ERROR on success), followed by the JPEG2000
+       codestream.
+*/
+
+#define OPENDCP_REMOTE_MAGIC         0x4f444350  /* "ODCP" */
+#define OPENDCP_REMOTE_PORT          "8080"
+#define OPENDCP_REMOTE_HEADER_SIZE   16
+#define OPENDCP_REMOTE_PARAMS_SIZE   52
+#define OPENDCP_REMOTE_MAX_PAYLOAD   (256 * 1024 * 1024)
+#define OPENDCP_REMOTE_WINDOW        4           /* default frames in flight per connection */
+
+enum OPENDCP_REMOTE_MESSAGE {
+    REMOTE_ENCODE_REQUEST = 1,
+    REMOTE_ENCODE_RESULT  = 2
+};
+
+enum OPENDCP_REMOTE_COMPRESSION {
+    REMOTE_COMPRESSION_NONE = 0,
+    REMOTE_COMPRESSION_ZLIB = 1
+};
+
+typedef struct {
+    uint32_t magic;
+    uint32_t type;
+    uint32_t id;
+    uint32_t length;
+} opendcp_remote_header_t;
+
+/* the encode settings sent with every frame */
+typedef struct {
+    int w;
+    int h;
+    int n_components;
+    int precision;
+    int profile;
+    int bw;
+    int frame_rate;
+    int stereoscopic;
+    int sample_bits;      /* 12 or 16 */
+    int compression;
+    int xyz;              /* the server converts rgb->xyz */
+    int lut;
+    int xyz_method;
+} opendcp_remote_params_t;
+
+int  opendcp_remote_connect(const char *host, const char *port);
+void opendcp_remote_close_socket(int fd);
+int  opendcp_remote_send(int fd, int type, uint32_t id, const unsigned char *payload, uint32_t length);
+int  opendcp_remote_recv(int fd, unsigned char *buffer, size_t length);
+int  opendcp_remote_recv_header(int fd, opendcp_remote_header_t *header);
+unsigned char *opendcp_remote_pack_image(opendcp_t *opendcp, opendcp_image_t *image, uint32_t *length);
+size_t opendcp_remote_pack_size(opendcp_image_t *image);
+int  opendcp_remote_pack_into(opendcp_t *opendcp, opendcp_image_t *image, unsigned char *payload);
+int  opendcp_remote_unpack_image(const unsigned char *payload, uint32_t length, opendcp_remote_params_t *params, opendcp_image_t **image);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _OPENDCP_REMOTE_H_
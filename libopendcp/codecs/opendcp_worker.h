@@ -0,0 +1,68 @@
+/*
+     OpenDCP: Builds Digital Cinema Packages
+     Copyright (c) 2010-2013 Terrence Meiczinger, All Rights Reserved
+
+     This program is free software: you can redistribute it and/or modify
+     it under the terms of the GNU General Public License as published by
+     the Free Software Foundation, either version 3 of the License, or
+     (at your option) any later version.
+
+     This program is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU General Public License for more details.
+
+     You should have received a copy of the GNU General Public License
+     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _OPENDCP_WORKER_H_
+#define _OPENDCP_WORKER_H_
+
+#include <stdint.h>
+#include "opendcp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+   Encoder worker processes
+
+   Each worker is an opendcp_server started with --worker. It shares one
+   memfd with the pipeline and is signaled through two eventfds, inherited
+   as the descriptors below. The memfd starts with an
+   opendcp_worker_shm_t, the payload follows at OPENDCP_WORKER_SHM_DATA.
+
+   The pipeline writes a REMOTE_ENCODE_REQUEST payload, uncompressed, and
+   signals the request eventfd. The worker replaces it with the
+   REMOTE_ENCODE_RESULT payload, growing the memfd if the codestream does
+   not fit, and signals the done eventfd. Either side maps the memfd at
+   its current size, so a grown memfd is remapped by the other. The
+   worker holds the write end of a pipe the pipeline polls, so a crashed
+   worker is noticed at once.
+*/
+
+#define OPENDCP_WORKER_MAGIC      0x4f445753  /* "ODWS" */
+#define OPENDCP_WORKER_SHM_DATA   64
+#define OPENDCP_WORKER_FD_SHM     3
+#define OPENDCP_WORKER_FD_REQUEST 4
+#define OPENDCP_WORKER_FD_DONE    5
+#define OPENDCP_WORKER_FD_LIFE    6
+#define OPENDCP_WORKER_COMMAND    "opendcp_server"
+
+typedef struct {
+    uint32_t magic;
+    uint32_t length;      /* bytes of the request or result payload */
+} opendcp_worker_shm_t;
+
+/* encodes a request payload, returns the result payload to be freed by the caller */
+typedef unsigned char *(*opendcp_worker_encode_t)(void *arg, const unsigned char *payload, uint32_t length, uint32_t *result_length);
+
+int  opendcp_worker_serve(opendcp_worker_encode_t encode, void *arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _OPENDCP_WORKER_H_
@@ -24,22 +24,31 @@ extern "C" {
 #endif
 
 #include <opendcp_image.h>
+#include <signal.h>
 #include <stdint.h>
+#include <stdio.h>
 #include <string.h>
 
 #define MAX_ASSETS          10   /* Soft limit */
 #define MAX_REELS           30   /* Soft limit */
-#define MAX_PKL             1    /* Soft limit */
-#define MAX_CPL             5    /* Soft limit */
 #define MAX_PATH_LENGTH     4095
 #define MAX_FILENAME_LENGTH 254
 #define MAX_AUDIO_CHANNELS  16   /* maximum allowed audio channels */
 
 #define FILE_READ_SIZE      16384
+#define DIGEST_READ_SIZE    (8 * 1024 * 1024)  /* default digest read chunk */
+#define DIGEST_READ_BUFFERS 3
+#define DIGEST_SIDECAR_EXT  ".sha1"
+#define J2K_MANIFEST_NAME   "opendcp.crc32c"  /* codestream checksums, next to the codestreams */
 
 #define MAX_DCP_JPEG_BITRATE 250000000  /* Maximum DCI compliant bit rate for JPEG2000 */
+#define J2K_LAYERS_MAX 8                /* quality layers of a layered master */
 #define MAX_DCP_MPEG_BITRATE  80000000  /* Maximum DCI compliant bit rate for MPEG */
 
+#define OPENDCP_UPLOAD_PART_MB 32        /* object storage upload part size */
+#define OPENDCP_UPLOAD_THREADS 4         /* parts uploaded at once */
+#define OPENDCP_FETCH_CONNECTIONS 16     /* ranged reads of source frames in flight */
+
 #define MAX_WIDTH_2K        2048
 #define MAX_HEIGHT_2K       1080
 
@@ -57,7 +66,7 @@ extern "C" {
 
 #define UNUSED(x) ( (void)(x) )
 #define BASE_FILE (strrchr(__FILE__, '/') ? strrchr(__FILE__, '/') + 1 : strrchr(__FILE__, '\\') ? strrchr(__FILE__, '\\') + 1 : __FILE__)
-#define OPENDCP_LOG(LEVEL, ...) opendcp_log(LEVEL, BASE_FILE, __func__, __LINE__, __VA_ARGS__)
+#define OPENDCP_LOG(LEVEL, ...) do { if ((LEVEL) <= opendcp_log_threshold) opendcp_log(LEVEL, BASE_FILE, __func__, __LINE__, __VA_ARGS__); } while (0)
 
 /* generate error message */
 #define FOREACH_OPENDCP_ERROR_MSG(OPENDCP_ERROR_MSG) \
@@ -79,7 +88,7 @@ extern "C" {
         OPENDCP_ERROR_MSG(OPENDCP_DETECT_TRACK_TYPE,       "Could not determine MXF track type") \
         OPENDCP_ERROR_MSG(OPENDCP_INVALID_TRACK_TYPE,      "Invalid MXF track type") \
         OPENDCP_ERROR_MSG(OPENDCP_UNKNOWN_TRACK_TYPE,      "Unknown MXF track type") \
-        OPENDCP_ERROR_MSG(OPENDCP_INVALID_WAV_BITDEPTH,    "WAV is not 24-bit") \
+        OPENDCP_ERROR_MSG(OPENDCP_INVALID_WAV_BITDEPTH,    "WAV is not 8, 16, 24 or 32-bit") \
         OPENDCP_ERROR_MSG(OPENDCP_INVALID_WAV_CHANNELS,    "WAV has an incorrect number of channels") \
         OPENDCP_ERROR_MSG(OPENDCP_FILEOPEN_MPEG2,          "Could not open MPEG2 file") \
         OPENDCP_ERROR_MSG(OPENDCP_FILEOPEN_J2K,            "Could not open JPEG200 file") \
@@ -92,6 +101,18 @@ extern "C" {
         OPENDCP_ERROR_MSG(OPENDCP_PARSER_RESET,            "Could not reset MXF parser") \
         OPENDCP_ERROR_MSG(OPENDCP_STRING_LENGTH,           "Input files have differing file lengths") \
         OPENDCP_ERROR_MSG(OPENDCP_STRING_NOTSEQUENTIAL ,   "Input files are not sequential") \
+        OPENDCP_ERROR_MSG(OPENDCP_J2K_CANCELLED,           "JPEG2000 conversion cancelled") \
+        OPENDCP_ERROR_MSG(OPENDCP_VERIFY_MXF,              "MXF frame failed verification") \
+        OPENDCP_ERROR_MSG(OPENDCP_VERIFY_DCP,              "DCP asset failed verification") \
+        OPENDCP_ERROR_MSG(OPENDCP_FILECOPY,                "Could not copy file") \
+        OPENDCP_ERROR_MSG(OPENDCP_COPY_CANCELLED,          "File copy cancelled") \
+        OPENDCP_ERROR_MSG(OPENDCP_BITRATE,                 "JPEG2000 frame exceeds the bit rate limit") \
+        OPENDCP_ERROR_MSG(OPENDCP_FILEWRITE_EXTRACT,       "Could not write extracted essence") \
+        OPENDCP_ERROR_MSG(OPENDCP_FRAME_STORE,             "Could not read or write frame store") \
+        OPENDCP_ERROR_MSG(OPENDCP_STREAM_END,              "End of the input stream") \
+        OPENDCP_ERROR_MSG(OPENDCP_UPLOAD,                  "Could not upload to object storage") \
+        OPENDCP_ERROR_MSG(OPENDCP_VERIFY_MXF_STRUCTURE,    "MXF structure failed verification") \
+        OPENDCP_ERROR_MSG(OPENDCP_COMPARE_MXF,             "MXF essence differs") \
         OPENDCP_ERROR_MSG(OPENDCP_MAX_ERROR,               "Maximum error string")
 
 #define GENERATE_ENUM(ERROR, STRING) ERROR,
@@ -176,6 +197,64 @@ enum J2K_ENCODER {
     J2K_REMOTE,
 };
 
+enum XYZ_METHOD {
+    XYZ_METHOD_LUT = 0,                 /* in and out gamma luts around a float matrix */
+    XYZ_METHOD_CALCULATE,               /* the color transforms of the profile are calculated */
+    XYZ_METHOD_FIXED                    /* the lut method in fixed point, 12 bits or less, within one code value of it */
+};
+
+enum J2K_RATE_CONTROL {
+    J2K_RATE_ADAPTIVE = 0,
+    J2K_RATE_FIXED,
+    J2K_RATE_TRUNCATE
+};
+
+enum OPENDCP_METRIC_STAGE {
+    METRIC_READ = 0,
+    METRIC_RESIZE,
+    METRIC_XYZ,
+    METRIC_ENCODE,
+    METRIC_WRITE,
+    METRIC_STAGES
+};
+
+enum OPENDCP_METRICS_FORMAT {
+    OPENDCP_METRICS_JSON = 0,
+    OPENDCP_METRICS_PROMETHEUS
+};
+
+enum OPENDCP_WATCH_STATE {
+    OPENDCP_WATCH_PENDING = 0,          /* still being written */
+    OPENDCP_WATCH_READY,
+    OPENDCP_WATCH_TAKEN
+};
+
+typedef struct opendcp_metrics_s opendcp_metrics_t;
+typedef struct opendcp_cube_s opendcp_cube_t;
+
+/* file copy progress, return non-zero to cancel */
+typedef int (*opendcp_copy_cb_t)(void *argument, uint64_t copied, uint64_t total);
+
+enum POOL_PRIORITY {
+    POOL_PRIORITY_HIGH = 0,
+    POOL_PRIORITY_NORMAL,
+    POOL_PRIORITY_LOW,
+    POOL_PRIORITIES
+};
+
+enum HUGE_PAGES {
+    HUGE_PAGES_NONE = 0,
+    HUGE_PAGES_EXPLICIT,                /* reserved huge pages, MAP_HUGETLB or large pages on windows */
+    HUGE_PAGES_TRANSPARENT              /* transparent huge pages on an aligned mapping */
+};
+
+/* buffers that got each kind of page, fallback counts those that got normal pages */
+typedef struct {
+    unsigned long explicit_pages;
+    unsigned long transparent;
+    unsigned long fallback;
+} opendcp_huge_stats_t;
+
 enum DPX_MODE {
     DPX_LINEAR = 0,
     DPX_FILM,
@@ -195,13 +274,27 @@ typedef struct {
     int   level;
     void  (*callback)(void *, void *);
     void  *argument;
+    int   batch;       /* queue messages until opendcp_log_drain, which passes an opendcp_log_batch_t */
 } opendcp_log_cb_t;
 
+typedef struct {
+    int         count;
+    int         dropped;    /* messages lost to a full queue since the last batch */
+    const char  **messages;
+} opendcp_log_batch_t;
+
 typedef struct {
     int   (*callback)(void *);
     void  *argument;
 } opendcp_cb_t;
 
+typedef struct {
+    int                frames;        /* frames written to the current file */
+    unsigned long long bytes;         /* essence bytes written to the current file */
+    double             fps;           /* average rate since the file was opened */
+    double             mb_per_second;
+} opendcp_progress_t;
+
 typedef struct {
     void   *data;
     struct node_t *next;
@@ -210,6 +303,7 @@ typedef struct {
 typedef struct {
     char **files;
     int  nfiles;
+    char *arena;   /* single buffer holding every path, see filelist_alloc_arena */
 } filelist_t;
 
 typedef struct {
@@ -278,7 +372,8 @@ typedef struct {
     char           rating[32];
     char           filename[MAX_FILENAME_LENGTH];
     int            reel_count;
-    reel_t         reel[MAX_REELS];
+    int            reel_alloc;        /* reels the reel array has room for */
+    reel_t         *reel;
 } cpl_t;
 
 typedef struct {
@@ -290,29 +385,114 @@ typedef struct {
     char           timestamp[30];
     char           filename[MAX_FILENAME_LENGTH];
     int            cpl_count;
-    cpl_t          cpl[MAX_CPL];
+    int            cpl_alloc;         /* cpls the cpl array has room for */
+    cpl_t          *cpl;
 } pkl_t;
 
+typedef struct opendcp_quality_s opendcp_quality_t;
+typedef struct opendcp_gamut_s opendcp_gamut_t;
+typedef struct opendcp_manifest_s opendcp_manifest_t;
+
 typedef struct {
     int            start_frame;
     int            end_frame;
     int            encoder;
     int            no_overwrite;
     int            bw;
+    int            rate_control;
+    int            layers;            /* quality layers of an openjpeg encode, more than one makes a master to re-rate */
+    int            layer_bw[J2K_LAYERS_MAX]; /* bit rates of the layers below the top one, which takes bw */
     int            duration;
     int            dpx;
     int            lut;
     int            xyz;
     int            xyz_method;
     int            resize;
+    opendcp_cube_t *cube;             /* 3d lut applied instead of the rgb->xyz profile when set */
+    char           *cache_dir;        /* encoded frames are reused from here when set */
+    int            dedup;             /* encode runs of identical source frames once */
+    int            tif_deflate;       /* deflate the intermediate tif of the kakadu encoder, strips on several threads */
+    int            htj2k;             /* the kakadu encoder writes HTJ2K (part 15) codestreams for intermediates, not DCI compliant */
+    int            readers;           /* decoding threads per pipeline lane, 0 for a quarter of the threads */
+    int            queue_depth;       /* frames each queue of the pipeline holds, 0 for one per thread */
+    int            size_order;        /* start the largest source files of each reorder window first */
+    int            strict_plan;       /* every frame must be the kind and size of the first, instead of being resolved on its own */
+    opendcp_quality_t *quality;       /* encoded frames are decoded and compared with the source when set */
+    opendcp_gamut_t *gamut;           /* the clipping of the xyz conversion of every frame is collected when set */
+    opendcp_manifest_t *manifest;     /* the checksum of every codestream written is recorded when set */
+    volatile sig_atomic_t cancel;     /* set from any thread or a signal handler to stop the conversion */
+    opendcp_cb_t   frame_done;
 } j2k_t;
 
+typedef struct {
+    char           *in_file;
+    char           *out_file;
+    int            result;
+} j2k_frame_t;
+
+/* tuning profile of a host, written by opendcp_autotune */
+typedef struct {
+    int            threads;           /* threads of the pool and the j2k pipeline */
+    int            readers;           /* j2k.readers */
+    int            queue_depth;       /* j2k.queue_depth */
+    double         fps;               /* frames per second the calibration reached */
+    int            storage_readers;   /* frame readers opendcp_profile_storage found fastest, 0 if not profiled */
+    int            io_buffers;        /* mxf.io_buffers */
+    int            io_buffer_size;    /* mxf.io_buffer_size */
+    int            direct_io;         /* mxf.direct_io */
+    int            digest_read_size;  /* dcp.digest_read_size */
+} opendcp_tune_t;
+
+/* prediction of a conversion from a sample of its frames, from opendcp_estimate */
+#define ESTIMATE_THREAD_COUNTS 8
+
+typedef struct {
+    int            frames;            /* frames of the job */
+    int            sampled;           /* frames converted to measure it */
+    double         stage_ms[METRIC_STAGES]; /* mean time of a frame in each stage, single threaded */
+    double         frame_seconds;     /* wall time of a frame, single threaded */
+    double         serial;            /* fraction of the frame time that did not scale with threads */
+    double         frame_bytes;       /* mean codestream size */
+    unsigned long long codestream_bytes; /* every codestream of the job */
+    unsigned long long mxf_bytes;     /* the picture mxf of the job */
+    int            counts;            /* thread counts predicted */
+    int            threads[ESTIMATE_THREAD_COUNTS];
+    double         seconds[ESTIMATE_THREAD_COUNTS]; /* wall time of the job at each thread count */
+} opendcp_estimate_t;
+
+/* how a volume takes the access patterns of opendcp, from opendcp_profile_storage */
+typedef struct {
+    int            readers;           /* frames read at once that read the most */
+    double         read_mbps;         /* MB/s of frame reads with that many readers */
+    int            io_buffers;        /* mxf write buffers in flight that wrote the most */
+    int            io_buffer_size;    /* bytes per mxf write buffer that wrote the most */
+    int            direct_io;         /* mxf writes were faster with O_DIRECT */
+    double         write_mbps;        /* MB/s of mxf writes with those buffers */
+    int            digest_read_size;  /* bytes per digest read that read the most */
+    double         digest_mbps;       /* MB/s of digest reads of that size */
+} opendcp_storage_t;
+
+typedef struct opendcp_remote_farm opendcp_remote_farm_t;
+
 typedef struct {
     int            id;
-    char           *host;
-    char           *port;
+    char           *host;             /* encoders as host[:port], separated by commas */
+    char           *port;             /* port of encoders listed without one */
+    int            window;            /* frames in flight per encoder, 0 for default */
+    int            compress;          /* zlib compress frames on the wire */
+    int            xyz;               /* leave rgb->xyz to the encoders */
+    opendcp_remote_farm_t *farm;      /* connections to the encoders, opened on first use */
 } remote_t;
 
+typedef struct opendcp_worker_pool opendcp_worker_pool_t;
+
+typedef struct {
+    int            count;             /* encoder processes, 0 for one per thread */
+    char           *encoder;          /* encoder the processes run, openjpeg or kakadu, NULL for openjpeg */
+    char           *command;          /* the worker executable, NULL for opendcp_server on the PATH */
+    opendcp_worker_pool_t *pool;      /* the processes, started on first use */
+} worker_t;
+
 typedef struct {
     int            start_frame;
     int            end_frame;
@@ -324,6 +504,31 @@ typedef struct {
     byte_t         key_id[16];
     byte_t         key_value[16];
     int            write_hmac;
+    int            digest_flag;       /* hash the mxf while writing it and store a digest sidecar */
+    char           digest[40];        /* base64 SHA-1 of the last mxf written with digest_flag */
+    int            direct_io;         /* write the mxf essence with O_DIRECT, bypassing the page cache */
+    int            io_buffers;        /* mxf write buffers in flight, 0 for 8 */
+    int            io_buffer_size;    /* bytes per mxf write buffer, 0 for 1 MB */
+    int            bitrate_limit;     /* fail as soon as a codestream is over the bit rate budget */
+    char           *bitrate_report;   /* per frame size statistics are written here as json when set */
+    char           *channel_map;      /* sound channel order, 1-based source channels across the wav files, 0 is silence */
+    int            extract_single;    /* extracted picture frames go into one codestream file instead of one file each */
+    int            extract_pack;      /* extracted picture frames go into a frame store instead of one file each */
+    char           *extract_image;    /* extracted picture frames are decoded to images of this type, tif or dpx, when set */
+    int            extract_reduce;    /* resolution levels dropped when decoding extracted frames */
+    int            extract_xyz;       /* decoded frames stay X'Y'Z' instead of going back to the RGB of j2k.lut */
+    char           *loudness_report;  /* sound peaks and loudness are measured while wrapping and written here as json when set */
+    int            checkpoint;        /* a j2k mxf is committed and recorded in <mxf>.resume every this many frames, 0 for never */
+    int            resume;            /* continue an unfinished j2k mxf from its <mxf>.resume checkpoint */
+    char           *dual_file;        /* a 2D picture track is also written here with the other label set, SMPTE or Interop */
+    int            shards;            /* a long j2k mxf is wrapped in this many runs of frames at once and joined, 0 or 1 for one run */
+    char           *upload;           /* the mxf is also uploaded to this s3://bucket/key while it is written */
+    int            upload_part_mb;    /* upload part size in MB, 0 for OPENDCP_UPLOAD_PART_MB */
+    int            upload_threads;    /* parts uploaded at once, 0 for OPENDCP_UPLOAD_THREADS */
+    int            progress_frames;   /* frame_done is called every this many frames, 0 and no progress_ms for every frame */
+    int            progress_ms;       /* or once this many milliseconds have passed since the last call */
+    opendcp_progress_t progress;      /* totals of the file being written, current when frame_done is called */
+    volatile sig_atomic_t cancel;     /* checked after every frame, set from any thread to stop writing */
     opendcp_cb_t   frame_done;
     opendcp_cb_t   file_done;
 } mxf_t;
@@ -339,14 +544,23 @@ typedef struct {
     char           rating[6];
     char           aspect_ratio[20];
     int            digest_flag;
+    int            digest_read_size;  /* bytes per digest read, 0 uses DIGEST_READ_SIZE */
+    int            digest_threads;    /* assets hashed at once by calculate_digests, 0 for default */
+    int            digest_io_per_device; /* concurrent digest reads per device, 0 for default */
+    int            digest_verify;     /* ignore cached digests and recalculate every asset */
+    char           digest_cache[MAX_FILENAME_LENGTH]; /* digest cache file, empty disables the cache */
     int            pkl_count;
-    pkl_t          pkl[MAX_PKL];
+    int            pkl_alloc;         /* pkls the pkl array has room for */
+    pkl_t          *pkl;
     assetmap_t     assetmap;
     volindex_t     volindex;
     opendcp_cb_t   sha1_update;
     opendcp_cb_t   sha1_done;
 } dcp_t;
 
+typedef struct xml_sign_session xml_sign_session_t;
+typedef struct xml_verify_session xml_verify_session_t;
+
 typedef struct {
     int  sign;
     int  use_external;
@@ -354,8 +568,12 @@ typedef struct {
     char *ca;
     char *signer;
     char *private_key;
+    xml_sign_session_t *session; /* set while a signing session is open */
+    int  defer;                  /* write_cpl and write_pkl leave the signing, size and cpl digest to the caller */
 } xml_signature_t;
 
+typedef struct opendcp_session_s opendcp_session_t;
+
 typedef struct {
     int             cinema_profile;
     int             frame_rate;
@@ -369,14 +587,24 @@ typedef struct {
     char            *tmp_path;
     j2k_t           j2k;
     remote_t        remote;
+    worker_t        worker;
     mxf_t           mxf;
     dcp_t           dcp;
     xml_signature_t xml_signature;
+    opendcp_metrics_t *metrics;         /* stage timings are collected here when set */
+    int             numa;               /* spread the j2k pipeline over up to this many numa nodes, 0 disables */
+    int             memory_budget;      /* MB the j2k pipeline may hold in frames, fewer frames are in flight to stay within it, 0 for no limit */
+    opendcp_session_t *session;         /* encodes take their threads from this session when set */
 } opendcp_t;
 
 /* common functions */
+extern int opendcp_log_threshold;      /* highest level any subscriber takes */
 void  opendcp_log(int level, const char *file, const char *function, int line,  const char *fmt, ...);
 void  opendcp_log_init(int level);
+void  opendcp_log_async(int enable);
+void  opendcp_log_flush(void);
+int   opendcp_log_drain(opendcp_log_cb_t *cb);
+void  opendcp_log_asdcp(void);
 void  dcp_fatal(opendcp_t *opendcp, char *error, ...);
 void  get_timestamp(char *timestamp);
 int   get_asset_type(asset_t asset);
@@ -384,22 +612,187 @@ int   get_file_essence_class(char *filename, int raw);
 int   validate_reel(opendcp_t *opendcp, reel_t *reel, int reel_number);
 int   add_asset(opendcp_t *opendcp, asset_t *asset, char *filename);
 int   add_asset_to_reel(opendcp_t *opendcp, reel_t *reel, asset_t asset);
-void  add_reel_to_cpl(cpl_t *cpl, reel_t reel);
-void  add_cpl_to_pkl(pkl_t *pkl, cpl_t cpl);
-void  add_pkl_to_dcp(dcp_t *dcp, pkl_t pkl);
-void  create_pkl(dcp_t dcp, pkl_t *pkl);
-void  create_cpl(dcp_t dcp, cpl_t *cpl);
-void  create_reel(dcp_t dcp, reel_t *reel);
+reel_t *add_reel_to_cpl(cpl_t *cpl, reel_t *reel);
+cpl_t  *add_cpl_to_pkl(pkl_t *pkl, cpl_t *cpl);
+pkl_t  *add_pkl_to_dcp(dcp_t *dcp, pkl_t *pkl);
+void  create_pkl(const dcp_t *dcp, pkl_t *pkl);
+void  create_cpl(const dcp_t *dcp, cpl_t *cpl);
+void  create_reel(const dcp_t *dcp, reel_t *reel);
+void  free_dcp(dcp_t *dcp);
 void  dcp_set_log_level(int log_level);
 
+/* metrics functions */
+unsigned long long opendcp_metrics_now(void);
+opendcp_metrics_t *opendcp_metrics_create(void);
+void  opendcp_metrics_delete(opendcp_metrics_t *metrics);
+void  opendcp_metrics_record(opendcp_metrics_t *metrics, int stage, unsigned long long start, unsigned long long bytes);
+void  opendcp_metrics_depth(opendcp_metrics_t *metrics, int stage, int depth);
+void  opendcp_metrics_threads(opendcp_metrics_t *metrics, int stage, int threads);
+unsigned long long opendcp_metrics_rate(opendcp_metrics_t *metrics, int stage, double *fps, double *mbps);
+unsigned long long opendcp_metrics_totals(opendcp_metrics_t *metrics, int stage, unsigned long long *ns, unsigned long long *bytes);
+const char *opendcp_metrics_stage_name(int stage);
+void  opendcp_metrics_report(opendcp_metrics_t *metrics, FILE *fp);
+int   opendcp_metrics_dump(opendcp_metrics_t *metrics, const char *file, int format);
+
+/* trace functions, spans are only recorded between start and stop */
+extern int opendcp_trace_enabled;
+int   opendcp_trace_start(const char *file);
+int   opendcp_trace_stop(void);
+void  opendcp_trace_span(const char *name, unsigned long long start);
+void  opendcp_trace_asdcp(int enable);
+
+/* libasdcp file i/o totals */
+void  opendcp_io_report(FILE *fp);
+
+/* codestream bit rate functions */
+typedef struct opendcp_bitrate_s opendcp_bitrate_t;
+opendcp_bitrate_t *opendcp_bitrate_create(opendcp_t *opendcp, int stereoscopic);
+void  opendcp_bitrate_delete(opendcp_bitrate_t *bitrate);
+int   opendcp_bitrate_add(opendcp_bitrate_t *bitrate, unsigned int bytes);
+void  opendcp_bitrate_summary(opendcp_bitrate_t *bitrate);
+int   opendcp_bitrate_dump(opendcp_bitrate_t *bitrate, const char *file);
+
+/* encode quality functions */
+opendcp_quality_t *opendcp_quality_create(int reduce);
+void  opendcp_quality_delete(opendcp_quality_t *quality);
+int   opendcp_quality_measure(opendcp_quality_t *quality, const char *file, opendcp_image_t *source,
+                              const unsigned char *data, int length);
+void  opendcp_quality_summary(opendcp_quality_t *quality);
+int   opendcp_quality_dump(opendcp_quality_t *quality, const char *file);
+
+/* gamut report functions */
+opendcp_gamut_t *opendcp_gamut_create(void);
+void  opendcp_gamut_delete(opendcp_gamut_t *gamut);
+int   opendcp_gamut_record(opendcp_gamut_t *gamut, const char *file, const opendcp_image_t *image);
+void  opendcp_gamut_summary(opendcp_gamut_t *gamut);
+int   opendcp_gamut_dump(opendcp_gamut_t *gamut, const char *file);
+
+/* audio conversion functions */
+typedef struct opendcp_audio_s opendcp_audio_t;
+int   opendcp_audio_rate(int rate);
+opendcp_audio_t *opendcp_audio_create(int in_rate, int in_bits, int out_rate, int channels, int threads);
+void  opendcp_audio_delete(opendcp_audio_t *audio);
+int   opendcp_audio_push(opendcp_audio_t *audio, int channel, const unsigned char *data, int stride, int samples);
+int   opendcp_audio_flush(opendcp_audio_t *audio);
+int   opendcp_audio_ready(opendcp_audio_t *audio);
+int   opendcp_audio_pull(opendcp_audio_t *audio, unsigned char **out, int samples);
+
+/* sound peak and loudness functions */
+typedef struct opendcp_loudness_s opendcp_loudness_t;
+opendcp_loudness_t *opendcp_loudness_create(int rate, int channels, int threads);
+void  opendcp_loudness_delete(opendcp_loudness_t *loudness);
+int   opendcp_loudness_add(opendcp_loudness_t *loudness, unsigned char **data, const unsigned int *stride, int samples);
+void  opendcp_loudness_summary(opendcp_loudness_t *loudness);
+int   opendcp_loudness_dump(opendcp_loudness_t *loudness, const char *file);
+
+/* frame store functions */
+typedef struct opendcp_pack_s opendcp_pack_t;
+opendcp_pack_t *opendcp_pack_create(const char *file);
+int   opendcp_pack_add(opendcp_pack_t *pack, const unsigned char *data, unsigned int size);
+int   opendcp_pack_repeat(opendcp_pack_t *pack);
+int   opendcp_pack_close(opendcp_pack_t *pack);
+void  opendcp_pack_abort(opendcp_pack_t *pack);
+int   opendcp_pack_is(const char *file);
+opendcp_pack_t *opendcp_pack_open(const char *file);
+unsigned int opendcp_pack_count(opendcp_pack_t *pack);
+int   opendcp_pack_read(opendcp_pack_t *pack, unsigned int index, unsigned char *buffer, unsigned int capacity,
+                        unsigned int *size);
+
+/* 3d lut functions */
+opendcp_cube_t *opendcp_cube_load(const char *file, int compand);
+void  opendcp_cube_delete(opendcp_cube_t *cube);
+const char *opendcp_cube_digest(opendcp_cube_t *cube);
+int   opendcp_cube_apply(opendcp_cube_t *cube, opendcp_image_t *image);
+
+/* numa functions */
+int   opendcp_numa_nodes(void);
+int   opendcp_numa_cpus(int node);
+int   opendcp_numa_bind(int node);
+int   opendcp_numa_node(void);
+
+/* huge page functions */
+void  opendcp_huge_pages(int enable);
+int   opendcp_huge_pages_enabled(void);
+void *opendcp_huge_alloc(size_t size, int *kind);
+void  opendcp_huge_free(void *ptr, size_t size, int kind);
+void  opendcp_huge_pages_stats(opendcp_huge_stats_t *stats);
+void  opendcp_huge_pages_report(FILE *fp);
+void  opendcp_huge_pages_asdcp(int enable);
+void  opendcp_huge_pages_asdcp_stats(opendcp_huge_stats_t *stats);
+
+/* page cache functions */
+void  opendcp_cache_hints(int enable);
+void  opendcp_cache_hints_asdcp(int enable);
+
+/* gpu functions */
+int   opendcp_gpu(int enable);
+int   opendcp_gpu_enabled(void);
+
+/* thread pool functions */
+void  opendcp_pool_init(int threads);
+int   opendcp_pool_threads(void);
+void  opendcp_pool_run(void *(*fn)(void *), void *items, size_t size, int count, int priority);
+
+/* copy functions */
+int   opendcp_copy_file(const char *source, const char *destination, unsigned char *sha1,
+                        opendcp_copy_cb_t progress, void *argument);
+int   opendcp_copy_file_fanout(const char *source, const char **destinations, int count, int *results,
+                               unsigned char *sha1, opendcp_copy_cb_t progress, void *argument);
+
+/* object storage functions */
+typedef struct opendcp_upload_s opendcp_upload_t;
+int   opendcp_s3_url(const char *path);
+opendcp_upload_t *opendcp_upload_open(const char *url, int part_mb, int threads, int window);
+int   opendcp_upload_write(opendcp_upload_t *upload, uint64_t offset, const unsigned char *data, size_t length);
+int   opendcp_upload_close(opendcp_upload_t *upload);
+void  opendcp_upload_abort(opendcp_upload_t *upload);
+typedef struct opendcp_fetch_s opendcp_fetch_t;
+filelist_t *opendcp_s3_list(const char *url, const char *filter);
+opendcp_fetch_t *opendcp_fetch_open(char **urls, int count, int window, int connections);
+int   opendcp_fetch_get(opendcp_fetch_t *fetch, int index, const unsigned char **data, size_t *size);
+void  opendcp_fetch_release(opendcp_fetch_t *fetch, int index);
+void  opendcp_fetch_close(opendcp_fetch_t *fetch);
+
+/* shared storage job ledger functions */
+typedef struct opendcp_ledger_s opendcp_ledger_t;
+opendcp_ledger_t *opendcp_ledger_open(opendcp_t *opendcp, const char *dir, int frames, int chunk, int stale);
+int   opendcp_ledger_claim(opendcp_ledger_t *ledger, int *first, int *count);
+int   opendcp_ledger_done(opendcp_ledger_t *ledger);
+int   opendcp_ledger_release(opendcp_ledger_t *ledger);
+void  opendcp_ledger_close(opendcp_ledger_t *ledger);
+
+/* codestream checksum manifest functions */
+opendcp_manifest_t *opendcp_manifest_open(const char *file);
+int   opendcp_manifest_add(opendcp_manifest_t *manifest, const char *file, const unsigned char *data, int length);
+opendcp_manifest_t *opendcp_manifest_load(const char *file);
+int   opendcp_manifest_check(opendcp_manifest_t *manifest, const char *file, const unsigned char *data, int length);
+void  opendcp_manifest_close(opendcp_manifest_t *manifest);
+
+/* hot folder watch functions */
+typedef struct opendcp_watch_s opendcp_watch_t;
+opendcp_watch_t *opendcp_watch_open(const char *dir, int settle_ms);
+int   opendcp_watch_wait(opendcp_watch_t *watch, int timeout_ms);
+int   opendcp_watch_state(opendcp_watch_t *watch, const char *file);
+void  opendcp_watch_take(opendcp_watch_t *watch, const char *file);
+void  opendcp_watch_close(opendcp_watch_t *watch);
+
+/* codestream functions */
+int   opendcp_codestream_rerate(const unsigned char *data, unsigned int size, unsigned int budget, unsigned char *out,
+                                unsigned int capacity, unsigned int *out_size, int *layers);
+int   opendcp_codestream_extract_2k(const unsigned char *data, unsigned int size, unsigned char *out,
+                                    unsigned int capacity, unsigned int *out_size);
+
 /* utility functions */
 int         ensure_sequential(char *files[], int nfiles);
 int         order_indexed_files(char *files[], int nfiles);
+int         order_sequence(char *files[], int nfiles, int *gap);
 filelist_t *filelist_alloc(int nfiles);
+filelist_t *filelist_alloc_arena(int nfiles, size_t size);
 void        filelist_free(filelist_t *filelist);
 void        strnchrdel(const char *src, char *dst, int dst_len, char d);
 int         strcasefind(const char *s, const char *find);
 void        opendcp_log_subscribe(opendcp_log_cb_t *cb);
+void        opendcp_log_unsubscribe(opendcp_log_cb_t *cb);
 int         hex2bin(const char* str, byte_t* buf, unsigned int buf_len);
 int         is_key(const char *s);
 int         is_uuid(const char *s);
@@ -409,6 +802,21 @@ int         is_filename_ascii(const char *s);
 /* opendcp context */
 opendcp_t *opendcp_create();
 int        opendcp_delete(opendcp_t *opendcp);
+opendcp_t *opendcp_clone(const opendcp_t *opendcp);
+
+/* sessions, jobs of one session run at once and share its encode threads */
+typedef struct opendcp_job_s opendcp_job_t;
+opendcp_session_t *opendcp_session_create(int threads);
+void               opendcp_session_delete(opendcp_session_t *session);
+void               opendcp_session_acquire(opendcp_session_t *session);
+void               opendcp_session_release(opendcp_session_t *session);
+opendcp_job_t     *opendcp_job_create(opendcp_session_t *session, const opendcp_t *config);
+opendcp_t         *opendcp_job_context(opendcp_job_t *job);
+int                opendcp_job_j2k(opendcp_job_t *job, j2k_frame_t *frames, int nframes, char *mxf_file);
+int                opendcp_job_mxf(opendcp_job_t *job, filelist_t *filelist, char *output_file);
+void               opendcp_job_cancel(opendcp_job_t *job);
+int                opendcp_job_wait(opendcp_job_t *job);
+void               opendcp_job_delete(opendcp_job_t *job);
 
 /* image functions */
 int check_image_compliance(int profile, opendcp_image_t *image, char *file);
@@ -417,12 +825,49 @@ int check_image_compliance(int profile, opendcp_image_t *image, char *file);
 int read_asset_info(asset_t *asset);
 void uuid_random(char *uuid);
 int calculate_digest(opendcp_t *opendcp, const char *filename, char *digest);
+int calculate_digests(opendcp_t *opendcp, asset_t *assets[], int count);
+int digest_cache_lookup(opendcp_t *opendcp, const char *filename, char *digest);
+int digest_cache_store(opendcp_t *opendcp, const char *filename, const char *digest);
 int get_wav_duration(const char *filename, int frame_rate);
 int get_wav_info(const char *filename, int frame_rate, wav_info_t *wav);
 int get_file_essence_type(char *in_path);
 
 /* MXF functions */
 int write_mxf(opendcp_t *opendcp, filelist_t *filelist, char *output_file);
+int replace_j2k_mxf(opendcp_t *opendcp, const char *mxf_file, filelist_t *filelist, int first_frame,
+                    const char *output_file);
+int rerate_j2k_mxf(opendcp_t *opendcp, const char *mxf_file, int bw, const char *output_file);
+int extract_2k_j2k_mxf(opendcp_t *opendcp, const char *mxf_file, const char *output_file);
+int rekey_j2k_mxf(opendcp_t *opendcp, const char *mxf_file, const unsigned char *old_key, const char *output_file);
+int left_eye_j2k_mxf(opendcp_t *opendcp, const char *mxf_file, const unsigned char *key, const char *output_file);
+int rewrap_mxf(opendcp_t *opendcp, const char *mxf_file, const char *output_file);
+int verify_mxf(opendcp_t *opendcp, const char *mxf_file, int *bad_frame);
+int verify_mxf_structure(opendcp_t *opendcp, const char *mxf_file);
+int compare_mxf(opendcp_t *opendcp, const char *mxf_a, const unsigned char *key_a,
+                const char *mxf_b, const unsigned char *key_b, int *first_diff, int *diffs);
+int read_mxf(opendcp_t *opendcp, const char *mxf_file, const char *output);
+int read_j2k_mxf(opendcp_t *opendcp, const char *mxf_file, const char *output);
+int read_pcm_mxf(opendcp_t *opendcp, const char *mxf_file, const char *output);
+int read_tt_mxf(opendcp_t *opendcp, const char *mxf_file, const char *output);
+
+/* incremental j2k mxf writer, frames are passed as in-memory codestreams */
+typedef struct j2k_mxf_writer j2k_mxf_writer_t;
+j2k_mxf_writer_t *j2k_mxf_writer_open(opendcp_t *opendcp, char *output_file);
+int j2k_mxf_writer_write(j2k_mxf_writer_t *writer, unsigned char *data, int length);
+int j2k_mxf_writer_close(j2k_mxf_writer_t *writer);
+
+/* random access reading of picture track frames */
+typedef struct j2k_mxf_reader j2k_mxf_reader_t;
+typedef struct {
+    int frames;
+    int w;
+    int h;
+    int edit_rate_num;
+    int edit_rate_den;
+} j2k_mxf_reader_info_t;
+j2k_mxf_reader_t *j2k_mxf_reader_open(opendcp_t *opendcp, const char *mxf_file, j2k_mxf_reader_info_t *info);
+int j2k_mxf_reader_read(j2k_mxf_reader_t *reader, int frame, unsigned char **data, int *length);
+void j2k_mxf_reader_close(j2k_mxf_reader_t *reader);
 
 /* XML functions */
 int write_cpl(opendcp_t *opendcp, cpl_t *cpl);
@@ -430,10 +875,46 @@ int write_pkl(opendcp_t *opendcp, pkl_t *pkl);
 int write_assetmap(opendcp_t *opendcp);
 int write_volumeindex(opendcp_t *opendcp);
 int xml_verify(char *filename);
+int dcp_verify(opendcp_t *opendcp, const char *dcp_path);
+int dcp_verify_structure(opendcp_t *opendcp, const char *dcp_path);
+int dcp_duplicate(opendcp_t *opendcp, const char *dcp_path, const char **targets, int ntargets, int verify);
 int xml_sign(opendcp_t *opendcp, char *filename);
+xml_sign_session_t *xml_sign_session_open(opendcp_t *opendcp, int threads);
+int xml_sign_session_sign(xml_sign_session_t *session, char *files[], int count);
+void xml_sign_session_close(xml_sign_session_t *session);
+xml_verify_session_t *xml_verify_session_open(int threads);
+int xml_verify_session_verify(xml_verify_session_t *session, char *files[], int *results, int count);
+void xml_verify_session_close(xml_verify_session_t *session);
+int xml_verify_find(const char *path, char ***files, int *nfiles);
+
+/* remote encoder functions */
+void opendcp_remote_disconnect(opendcp_t *opendcp);
+
+/* encoder worker process functions */
+void opendcp_worker_stop(opendcp_t *opendcp);
 
 /* J2K functions */
 int convert_to_j2k(opendcp_t *opendcp, char *in_file, char *out_file);
+int convert_from_j2k(opendcp_t *opendcp, const unsigned char *data, int length, char *out_file);
+int convert_to_j2k_sequence(opendcp_t *opendcp, j2k_frame_t *frames, int nframes);
+int convert_htj2k_to_j2k_sequence(opendcp_t *opendcp, j2k_frame_t *frames, int nframes);
+int convert_to_j2k_mxf(opendcp_t *opendcp, j2k_frame_t *frames, int nframes, char *mxf_file);
+int convert_to_j2k_mxf_append(opendcp_t *opendcp, j2k_frame_t *frames, int nframes, j2k_mxf_writer_t *mxf);
+int convert_to_j2k_mxf_2k(opendcp_t *opendcp, j2k_frame_t *frames, int nframes, char *mxf_file, char *mxf_2k_file);
+int convert_to_j2k_pack(opendcp_t *opendcp, j2k_frame_t *frames, int nframes, char *pack_file);
+int convert_to_j2k_reels(opendcp_t *opendcp, j2k_frame_t *frames, int nframes, const int *reel_frames, int nreels,
+                         char **mxf_files);
+
+/* tuning functions */
+int  opendcp_tune_path(char *path, int size);
+int  opendcp_tune_load(opendcp_tune_t *tune, const char *file);
+int  opendcp_tune_save(const opendcp_tune_t *tune, const char *file);
+void opendcp_tune_apply(opendcp_t *opendcp, const opendcp_tune_t *tune);
+int  opendcp_autotune(opendcp_t *opendcp, j2k_frame_t *frames, int nframes, opendcp_tune_t *tune);
+void opendcp_tune_apply_storage(opendcp_t *opendcp, const opendcp_tune_t *tune);
+void opendcp_tune_storage(opendcp_tune_t *tune, const opendcp_storage_t *storage);
+int  opendcp_estimate(opendcp_t *opendcp, j2k_frame_t *frames, int nframes, int samples, opendcp_estimate_t *estimate);
+int  opendcp_profile_storage(const char *dir, opendcp_storage_t *storage);
 
 /* retrieve error string */
 char *error_string(int error_code);
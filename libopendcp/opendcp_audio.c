@@ -0,0 +1,492 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "opendcp.h"
+
+/*
+   Streaming conversion of PCM to 24-bit at 48 or 96 kHz. Every channel
+   keeps a short queue of input samples as floats. Resampling is a
+   polyphase windowed sinc filter: the rate ratio is reduced to up/down,
+   and each of the up phases has its own row of taps. An output sample is
+   one dot product of a row with the queue, so no zero-stuffed
+   intermediate signal is built. Output that is not an exact widening
+   gets TPDF dither before it is rounded to 24 bits.
+*/
+#define AUDIO_TAPS        48     /* taps per phase when upsampling, scaled up for downsampling */
+#define AUDIO_CUTOFF      0.95   /* pass band edge as a fraction of the lower nyquist rate */
+#define AUDIO_PHASES_MAX  4096   /* rate ratios needing more phases are refused */
+#define AUDIO_THREADS_MAX 16
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+typedef struct {
+    float        *queue;         /* input samples from the oldest one still needed */
+    int          length;
+    int          alloc;
+    int          index;          /* queue position of the next output sample */
+    int          phase;          /* its fractional position in 1/up of an input sample */
+    unsigned int seed;           /* dither noise */
+} audio_channel_t;
+
+struct opendcp_audio_s {
+    int             in_rate;
+    int             out_rate;
+    int             in_bits;
+    int             channels;
+    int             threads;
+    int             up;
+    int             down;
+    int             taps;
+    int             resample;
+    int             dither;
+    float           *filter;     /* up rows of taps coefficients */
+    audio_channel_t *channel;
+};
+
+typedef struct {
+    opendcp_audio_t *audio;
+    unsigned char   **out;
+    int             samples;
+    int             start;
+    int             end;
+} audio_band_t;
+
+static int audio_gcd(int a, int b) {
+    while (b) {
+        int t = a % b;
+        a = b;
+        b = t;
+    }
+
+    return a;
+}
+
+/* builds the coefficient rows, each normalised to unity gain at dc */
+static int audio_filter(opendcp_audio_t *audio) {
+    double cutoff = AUDIO_CUTOFF * (audio->up < audio->down ? (double)audio->up / audio->down : 1.0);
+    double half   = audio->taps / 2;
+    int    p, k;
+
+    audio->filter = malloc(sizeof(float) * audio->up * audio->taps);
+
+    if (!audio->filter) {
+        return OPENDCP_ERROR;
+    }
+
+    for (p = 0; p < audio->up; p++) {
+        float  *row = audio->filter + p * audio->taps;
+        double sum  = 0;
+
+        for (k = 0; k < audio->taps; k++) {
+            double d = k - (half - 1) - (double)p / audio->up;
+            double x = M_PI * cutoff * d;
+            double w = 0.42 + 0.5 * cos(M_PI * d / half) + 0.08 * cos(2 * M_PI * d / half);
+            double h = (d == 0 ? 1.0 : sin(x) / x) * (fabs(d) < half ? w : 0);
+
+            row[k] = (float)h;
+            sum   += h;
+        }
+
+        for (k = 0; k < audio->taps; k++) {
+            row[k] = (float)(row[k] / sum);
+        }
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*!
+ @function opendcp_audio_rate
+ @abstract Returns the DCP sample rate audio at a given rate is converted to.
+ @param rate The source sample rate.
+ @return 96000 for sources above 48 kHz, otherwise 48000.
+*/
+int opendcp_audio_rate(int rate) {
+    return rate > 48000 ? 96000 : 48000;
+}
+
+/*!
+ @function opendcp_audio_create
+ @abstract Creates a converter from a source rate and bit depth to 24-bit PCM.
+ @discussion When only the bit depth changes, samples are widened exactly
+             or narrowed with dither, and nothing is resampled.
+ @param in_rate The source sample rate.
+ @param in_bits The source bits per sample, 8, 16, 24 or 32.
+ @param out_rate The DCP rate, see opendcp_audio_rate.
+ @param channels The number of channels.
+ @param threads Channels are converted on up to this many threads.
+ @return The converter, or NULL for an unsupported rate or bit depth.
+*/
+opendcp_audio_t *opendcp_audio_create(int in_rate, int in_bits, int out_rate, int channels, int threads) {
+    opendcp_audio_t *audio;
+    int             gcd, c;
+
+    if (in_rate <= 0 || out_rate <= 0 || channels < 1 ||
+        (in_bits != 8 && in_bits != 16 && in_bits != 24 && in_bits != 32)) {
+        OPENDCP_LOG(LOG_ERROR, "can not convert %d-bit %d Hz audio", in_bits, in_rate);
+        return NULL;
+    }
+
+    gcd = audio_gcd(in_rate, out_rate);
+
+    if (out_rate / gcd > AUDIO_PHASES_MAX) {
+        OPENDCP_LOG(LOG_ERROR, "can not resample %d Hz to %d Hz", in_rate, out_rate);
+        return NULL;
+    }
+
+    audio = calloc(1, sizeof(opendcp_audio_t));
+
+    if (!audio) {
+        return NULL;
+    }
+
+    audio->in_rate  = in_rate;
+    audio->out_rate = out_rate;
+    audio->in_bits  = in_bits;
+    audio->channels = channels;
+    audio->threads  = threads < 1 ? 1 : (threads > AUDIO_THREADS_MAX ? AUDIO_THREADS_MAX : threads);
+    audio->up       = out_rate / gcd;
+    audio->down     = in_rate / gcd;
+    audio->resample = in_rate != out_rate;
+    audio->dither   = audio->resample || in_bits > 24;
+    audio->taps     = 1;
+    audio->channel  = calloc(channels, sizeof(audio_channel_t));
+
+    if (!audio->channel) {
+        opendcp_audio_delete(audio);
+        return NULL;
+    }
+
+    if (audio->resample) {
+        /* a lower cutoff needs a proportionally longer filter, kept a multiple of 4 */
+        audio->taps = AUDIO_TAPS * (audio->down > audio->up ? (audio->down + audio->up - 1) / audio->up : 1);
+        audio->taps = (audio->taps + 3) & ~3;
+
+        if (audio_filter(audio) != OPENDCP_NO_ERROR) {
+            opendcp_audio_delete(audio);
+            return NULL;
+        }
+    }
+
+    for (c = 0; c < channels; c++) {
+        audio_channel_t *ch = &audio->channel[c];
+
+        ch->seed = 0x0dc0ffee + c * 0x9e3779b9u;
+
+        /* leading silence puts the first input sample under the filter center */
+        if (audio->resample) {
+            ch->alloc  = audio->taps * 2;
+            ch->queue  = calloc(ch->alloc, sizeof(float));
+            ch->length = audio->taps / 2 - 1;
+            ch->index  = ch->length;
+
+            if (!ch->queue) {
+                opendcp_audio_delete(audio);
+                return NULL;
+            }
+        }
+    }
+
+    OPENDCP_LOG(LOG_INFO, "converting %d-bit %d Hz audio to 24-bit %d Hz", in_bits, in_rate, out_rate);
+
+    return audio;
+}
+
+/*!
+ @function opendcp_audio_delete
+ @abstract Frees a converter created by opendcp_audio_create.
+ @param audio The converter, may be NULL.
+*/
+void opendcp_audio_delete(opendcp_audio_t *audio) {
+    int c;
+
+    if (!audio) {
+        return;
+    }
+
+    if (audio->channel) {
+        for (c = 0; c < audio->channels; c++) {
+            free(audio->channel[c].queue);
+        }
+    }
+
+    free(audio->channel);
+    free(audio->filter);
+    free(audio);
+}
+
+static int audio_reserve(audio_channel_t *ch, int samples) {
+    float *grown;
+    int   alloc;
+
+    if (ch->length + samples <= ch->alloc) {
+        return OPENDCP_NO_ERROR;
+    }
+
+    alloc = ch->alloc ? ch->alloc : 1024;
+
+    while (alloc < ch->length + samples) {
+        alloc *= 2;
+    }
+
+    grown = realloc(ch->queue, alloc * sizeof(float));
+
+    if (!grown) {
+        return OPENDCP_ERROR;
+    }
+
+    ch->queue = grown;
+    ch->alloc = alloc;
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*!
+ @function opendcp_audio_push
+ @abstract Queues source samples of one channel.
+ @param audio The converter.
+ @param channel The channel.
+ @param data The first sample, little endian as in a wav file.
+ @param stride Bytes from one sample of the channel to the next.
+ @param samples The number of samples.
+ @return OPENDCP_NO_ERROR, or OPENDCP_ERROR when out of memory.
+*/
+int opendcp_audio_push(opendcp_audio_t *audio, int channel, const unsigned char *data, int stride, int samples) {
+    audio_channel_t *ch    = &audio->channel[channel];
+    float           scale  = 1.0f / (float)(1u << (audio->in_bits - 1));
+    float           *q;
+    int             i;
+
+    if (audio_reserve(ch, samples) != OPENDCP_NO_ERROR) {
+        return OPENDCP_ERROR;
+    }
+
+    q = ch->queue + ch->length;
+
+    switch (audio->in_bits) {
+        case 8:
+            for (i = 0; i < samples; i++, data += stride) {
+                q[i] = (float)((int)data[0] - 128) * scale;
+            }
+            break;
+        case 16:
+            for (i = 0; i < samples; i++, data += stride) {
+                q[i] = (float)(short)(data[0] | data[1] << 8) * scale;
+            }
+            break;
+        case 24:
+            for (i = 0; i < samples; i++, data += stride) {
+                q[i] = (float)((int)((unsigned int)data[0] << 8 | (unsigned int)data[1] << 16 | (unsigned int)data[2] << 24) >> 8) * scale;
+            }
+            break;
+        default:
+            for (i = 0; i < samples; i++, data += stride) {
+                q[i] = (float)(int)((unsigned int)data[0] | (unsigned int)data[1] << 8 |
+                                    (unsigned int)data[2] << 16 | (unsigned int)data[3] << 24) * scale;
+            }
+    }
+
+    ch->length += samples;
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*!
+ @function opendcp_audio_flush
+ @abstract Marks the end of the input so the last samples can be converted.
+ @discussion Pads every channel with the silence the filter needs past
+             the last source sample.
+ @param audio The converter.
+ @return OPENDCP_NO_ERROR, or OPENDCP_ERROR when out of memory.
+*/
+int opendcp_audio_flush(opendcp_audio_t *audio) {
+    int c, pad = audio->resample ? audio->taps / 2 : 0;
+
+    for (c = 0; c < audio->channels; c++) {
+        audio_channel_t *ch = &audio->channel[c];
+
+        if (audio_reserve(ch, pad) != OPENDCP_NO_ERROR) {
+            return OPENDCP_ERROR;
+        }
+
+        memset(ch->queue + ch->length, 0, pad * sizeof(float));
+        ch->length += pad;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* output samples a channel can produce from what is queued */
+static int audio_ready_channel(opendcp_audio_t *audio, audio_channel_t *ch) {
+    long long last, need;
+
+    if (!audio->resample) {
+        return ch->length - ch->index;
+    }
+
+    /* the newest input sample a row reads is taps / 2 past the index */
+    last = (long long)ch->length - audio->taps / 2 - 1 - ch->index;
+
+    if (last < 0) {
+        return 0;
+    }
+
+    need = (last * audio->up + audio->up - 1 - ch->phase) / audio->down + 1;
+
+    return need > 0x7fffffff ? 0x7fffffff : (int)need;
+}
+
+/*!
+ @function opendcp_audio_ready
+ @abstract Returns how many output samples every channel can produce now.
+ @param audio The converter.
+ @return The sample count.
+*/
+int opendcp_audio_ready(opendcp_audio_t *audio) {
+    int c, ready = 0x7fffffff;
+
+    for (c = 0; c < audio->channels; c++) {
+        int n = audio_ready_channel(audio, &audio->channel[c]);
+        ready = n < ready ? n : ready;
+    }
+
+    return ready;
+}
+
+/* tpdf noise of up to one lsb either way */
+static float audio_dither(audio_channel_t *ch) {
+    unsigned int a, b;
+
+    ch->seed = ch->seed * 1664525u + 1013904223u;
+    a        = ch->seed >> 8;
+    ch->seed = ch->seed * 1664525u + 1013904223u;
+    b        = ch->seed >> 8;
+
+    return ((float)a - (float)b) * (1.0f / 16777216.0f);
+}
+
+static void audio_store(unsigned char *out, float value, audio_channel_t *ch, int dither) {
+    float v = value * 8388608.0f;
+    int   s;
+
+    if (dither) {
+        v += audio_dither(ch);
+    }
+
+    v = floorf(v + 0.5f);
+    s = v >= 8388607.0f ? 8388607 : (v <= -8388608.0f ? -8388608 : (int)v);
+
+    out[0] = (unsigned char)s;
+    out[1] = (unsigned char)(s >> 8);
+    out[2] = (unsigned char)(s >> 16);
+}
+
+/* four partial sums so the taps loop maps onto vector multiply adds */
+static float audio_dot(const float *h, const float *x, int taps) {
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    int   k;
+
+    for (k = 0; k < taps; k += 4) {
+        s0 += h[k]     * x[k];
+        s1 += h[k + 1] * x[k + 1];
+        s2 += h[k + 2] * x[k + 2];
+        s3 += h[k + 3] * x[k + 3];
+    }
+
+    return (s0 + s1) + (s2 + s3);
+}
+
+static void audio_convert_channel(opendcp_audio_t *audio, audio_channel_t *ch, unsigned char *out, int samples) {
+    int i, keep;
+
+    if (!audio->resample) {
+        for (i = 0; i < samples; i++, out += 3) {
+            audio_store(out, ch->queue[ch->index++], ch, audio->dither);
+        }
+    }
+    else {
+        for (i = 0; i < samples; i++, out += 3) {
+            const float *x = ch->queue + ch->index - (audio->taps / 2 - 1);
+
+            audio_store(out, audio_dot(audio->filter + ch->phase * audio->taps, x, audio->taps), ch, 1);
+
+            ch->phase += audio->down;
+            ch->index += ch->phase / audio->up;
+            ch->phase %= audio->up;
+        }
+    }
+
+    /* drop the input no later row will read */
+    keep = ch->index - (audio->resample ? audio->taps / 2 - 1 : 0);
+
+    if (keep > 0) {
+        memmove(ch->queue, ch->queue + keep, (ch->length - keep) * sizeof(float));
+        ch->length -= keep;
+        ch->index  -= keep;
+    }
+}
+
+static void *audio_convert_band(void *arg) {
+    audio_band_t *band = (audio_band_t *)arg;
+    int          c;
+
+    for (c = band->start; c < band->end; c++) {
+        audio_convert_channel(band->audio, &band->audio->channel[c], band->out[c], band->samples);
+    }
+
+    return NULL;
+}
+
+/*!
+ @function opendcp_audio_pull
+ @abstract Converts queued samples of every channel to 24-bit PCM.
+ @discussion Channels are split between threads, the calling thread takes
+             the first share.
+ @param audio The converter.
+ @param out One buffer per channel, receiving 3 byte samples back to back.
+ @param samples Output samples per channel, at most opendcp_audio_ready.
+ @return OPENDCP_NO_ERROR, or OPENDCP_ERROR if not enough input is queued.
+*/
+int opendcp_audio_pull(opendcp_audio_t *audio, unsigned char **out, int samples) {
+    audio_band_t band[AUDIO_THREADS_MAX];
+    int          i, n;
+
+    if (opendcp_audio_ready(audio) < samples) {
+        return OPENDCP_ERROR;
+    }
+
+    n = audio->channels < audio->threads ? audio->channels : audio->threads;
+
+    for (i = 0; i < n; i++) {
+        band[i].audio   = audio;
+        band[i].out     = out;
+        band[i].samples = samples;
+        band[i].start   = audio->channels * i / n;
+        band[i].end     = audio->channels * (i + 1) / n;
+    }
+
+    opendcp_pool_run(audio_convert_band, band, sizeof(audio_band_t), n, POOL_PRIORITY_NORMAL);
+
+    return OPENDCP_NO_ERROR;
+}
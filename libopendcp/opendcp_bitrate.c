@@ -0,0 +1,267 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "opendcp.h"
+
+/* size histogram buckets are 1% of the codestream budget, the last one is open ended */
+#define BITRATE_BUCKETS 131
+
+/* largest codestreams kept for the report */
+#define BITRATE_TOP 10
+
+typedef struct {
+    unsigned int index;
+    unsigned int bytes;
+} bitrate_frame_t;
+
+struct opendcp_bitrate_s {
+    unsigned int       budget;          /* bytes allowed per codestream */
+    int                frame_rate;
+    int                eyes;            /* codestreams per frame */
+    int                limit;           /* fail on a codestream over budget */
+    unsigned int       count;
+    unsigned int       over;
+    unsigned long long total;
+    unsigned int       buckets[BITRATE_BUCKETS];
+    bitrate_frame_t    top[BITRATE_TOP];
+    int                ntop;
+    unsigned int       *seconds;        /* bytes written in each second of the track */
+    unsigned int       nseconds;
+    unsigned int       seconds_alloc;
+};
+
+/*!
+ @function opendcp_bitrate_create
+ @abstract Creates codestream size statistics for a picture track.
+ @discussion The budget per codestream is the bit rate limit, j2k.bw or
+             MAX_DCP_JPEG_BITRATE, divided by the frame rate and halved
+             for stereoscopic tracks, the same budget the encoders aim for.
+ @param opendcp The options, mxf.bitrate_limit makes over budget frames fail.
+ @param stereoscopic Non-zero when each frame is a left and a right codestream.
+ @return The statistics or NULL.
+*/
+opendcp_bitrate_t *opendcp_bitrate_create(opendcp_t *opendcp, int stereoscopic) {
+    opendcp_bitrate_t *bitrate = calloc(1, sizeof(opendcp_bitrate_t));
+    int               bw       = opendcp->j2k.bw ? opendcp->j2k.bw : MAX_DCP_JPEG_BITRATE;
+
+    if (!bitrate) {
+        return NULL;
+    }
+
+    bitrate->frame_rate = opendcp->frame_rate > 0 ? opendcp->frame_rate : 24;
+    bitrate->eyes       = stereoscopic ? 2 : 1;
+    bitrate->budget     = (unsigned int)((double)bw / 8 / bitrate->frame_rate / bitrate->eyes);
+    bitrate->limit      = opendcp->mxf.bitrate_limit;
+
+    return bitrate;
+}
+
+/*!
+ @function opendcp_bitrate_delete
+ @abstract Frees statistics created by opendcp_bitrate_create.
+ @param bitrate The statistics, may be NULL.
+*/
+void opendcp_bitrate_delete(opendcp_bitrate_t *bitrate) {
+    if (bitrate) {
+        free(bitrate->seconds);
+        free(bitrate);
+    }
+}
+
+/*!
+ @function opendcp_bitrate_add
+ @abstract Records the size of the next codestream written to the track.
+ @discussion Stereoscopic tracks record the left and right codestream of each frame in turn.
+ @param bitrate The statistics, nothing is recorded when NULL.
+ @param bytes The codestream size.
+ @return OPENDCP_NO_ERROR, or OPENDCP_BITRATE when the codestream is over budget and the limit is enforced.
+*/
+int opendcp_bitrate_add(opendcp_bitrate_t *bitrate, unsigned int bytes) {
+    unsigned int index, second, bucket;
+    int          i;
+
+    if (!bitrate) {
+        return OPENDCP_NO_ERROR;
+    }
+
+    index  = bitrate->count++;
+    second = index / bitrate->eyes / bitrate->frame_rate;
+    bucket = bitrate->budget ? (unsigned int)((unsigned long long)bytes * 100 / bitrate->budget) : 0;
+
+    bitrate->total += bytes;
+    bitrate->buckets[bucket < BITRATE_BUCKETS ? bucket : BITRATE_BUCKETS - 1]++;
+
+    if (second >= bitrate->seconds_alloc) {
+        unsigned int alloc   = bitrate->seconds_alloc ? bitrate->seconds_alloc * 2 : 256;
+        unsigned int *grown  = realloc(bitrate->seconds, alloc * sizeof(unsigned int));
+
+        if (grown) {
+            memset(grown + bitrate->seconds_alloc, 0, (alloc - bitrate->seconds_alloc) * sizeof(unsigned int));
+            bitrate->seconds       = grown;
+            bitrate->seconds_alloc = alloc;
+        }
+    }
+
+    if (second < bitrate->seconds_alloc) {
+        bitrate->seconds[second] += bytes;
+        bitrate->nseconds = second + 1;
+    }
+
+    /* keep the largest codestreams in descending order */
+    if (bitrate->ntop < BITRATE_TOP || bytes > bitrate->top[bitrate->ntop - 1].bytes) {
+        i = bitrate->ntop < BITRATE_TOP ? bitrate->ntop++ : BITRATE_TOP - 1;
+
+        for (; i > 0 && bitrate->top[i - 1].bytes < bytes; i--) {
+            bitrate->top[i] = bitrate->top[i - 1];
+        }
+
+        bitrate->top[i].index = index;
+        bitrate->top[i].bytes = bytes;
+    }
+
+    if (bytes > bitrate->budget) {
+        bitrate->over++;
+
+        if (bitrate->limit) {
+            OPENDCP_LOG(LOG_ERROR, "frame %u codestream is %u bytes, over the %u byte budget",
+                        index / bitrate->eyes, bytes, bitrate->budget);
+            return OPENDCP_BITRATE;
+        }
+
+        OPENDCP_LOG(LOG_WARN, "frame %u codestream is %u bytes, over the %u byte budget",
+                    index / bitrate->eyes, bytes, bitrate->budget);
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* codestream bytes to megabits per second at the track frame rate */
+static double bitrate_mbps(opendcp_bitrate_t *bitrate, double bytes) {
+    return bytes * 8 * bitrate->frame_rate * bitrate->eyes / 1e6;
+}
+
+static unsigned int bitrate_peak_second(opendcp_bitrate_t *bitrate) {
+    unsigned int s, peak = 0;
+
+    for (s = 1; s < bitrate->nseconds; s++) {
+        if (bitrate->seconds[s] > bitrate->seconds[peak]) {
+            peak = s;
+        }
+    }
+
+    return peak;
+}
+
+/*!
+ @function opendcp_bitrate_summary
+ @abstract Logs the average and peak bit rates at info level.
+ @param bitrate The statistics, may be NULL.
+*/
+void opendcp_bitrate_summary(opendcp_bitrate_t *bitrate) {
+    unsigned int peak;
+
+    if (!bitrate || !bitrate->count) {
+        return;
+    }
+
+    peak = bitrate_peak_second(bitrate);
+
+    OPENDCP_LOG(LOG_INFO, "bit rate average %.1f Mb/s, peak frame %.1f Mb/s (frame %u), peak second %.1f Mb/s (second %u)",
+                bitrate_mbps(bitrate, (double)bitrate->total / bitrate->count),
+                bitrate_mbps(bitrate, bitrate->top[0].bytes), bitrate->top[0].index / bitrate->eyes,
+                bitrate->seconds ? bitrate->seconds[peak] * 8 / 1e6 : 0.0, peak);
+
+    if (bitrate->over) {
+        OPENDCP_LOG(LOG_WARN, "%u of %u codestreams are over the %u byte budget", bitrate->over, bitrate->count, bitrate->budget);
+    }
+}
+
+/*!
+ @function opendcp_bitrate_dump
+ @abstract Writes the statistics as json.
+ @discussion The report has the averages and peaks, the largest codestreams,
+             the size histogram in percent of the budget and the bit rate of
+             every second of the track.
+ @param bitrate The statistics.
+ @param file The file to write.
+ @return OPENDCP_NO_ERROR or OPENDCP_ERROR.
+*/
+int opendcp_bitrate_dump(opendcp_bitrate_t *bitrate, const char *file) {
+    FILE         *fp;
+    unsigned int s, peak;
+    int          i, b, first;
+
+    if (!bitrate) {
+        return OPENDCP_ERROR;
+    }
+
+    fp = fopen(file, "w");
+
+    if (!fp) {
+        OPENDCP_LOG(LOG_ERROR, "could not write bit rate report to %s", file);
+        return OPENDCP_ERROR;
+    }
+
+    peak = bitrate_peak_second(bitrate);
+
+    fprintf(fp, "{\n");
+    fprintf(fp, "    \"codestreams\": %u,\n", bitrate->count);
+    fprintf(fp, "    \"frame_rate\": %d,\n", bitrate->frame_rate);
+    fprintf(fp, "    \"stereoscopic\": %s,\n", bitrate->eyes == 2 ? "true" : "false");
+    fprintf(fp, "    \"budget_bytes\": %u,\n", bitrate->budget);
+    fprintf(fp, "    \"over_budget\": %u,\n", bitrate->over);
+    fprintf(fp, "    \"total_bytes\": %llu,\n", bitrate->total);
+    fprintf(fp, "    \"average_mbps\": %.3f,\n", bitrate->count ? bitrate_mbps(bitrate, (double)bitrate->total / bitrate->count) : 0.0);
+    fprintf(fp, "    \"peak_frame_mbps\": %.3f,\n", bitrate->ntop ? bitrate_mbps(bitrate, bitrate->top[0].bytes) : 0.0);
+    fprintf(fp, "    \"peak_second_mbps\": %.3f,\n", bitrate->nseconds ? bitrate->seconds[peak] * 8 / 1e6 : 0.0);
+    fprintf(fp, "    \"largest\": [");
+
+    for (i = 0; i < bitrate->ntop; i++) {
+        fprintf(fp, "%s\n        {\"frame\": %u, \"eye\": %u, \"bytes\": %u}", i ? "," : "",
+                bitrate->top[i].index / bitrate->eyes, bitrate->top[i].index % bitrate->eyes, bitrate->top[i].bytes);
+    }
+
+    fprintf(fp, "\n    ],\n");
+    fprintf(fp, "    \"histogram_percent\": {");
+
+    for (b = 0, first = 1; b < BITRATE_BUCKETS; b++) {
+        if (bitrate->buckets[b]) {
+            fprintf(fp, "%s\"%d%s\": %u", first ? "" : ", ", b, b == BITRATE_BUCKETS - 1 ? "+" : "", bitrate->buckets[b]);
+            first = 0;
+        }
+    }
+
+    fprintf(fp, "},\n");
+    fprintf(fp, "    \"seconds_mbps\": [");
+
+    for (s = 0; s < bitrate->nseconds; s++) {
+        fprintf(fp, "%s%s%.3f", s ? "," : "", s % 10 ? " " : "\n        ", bitrate->seconds[s] * 8 / 1e6);
+    }
+
+    fprintf(fp, "\n    ]\n}\n");
+
+    if (fclose(fp)) {
+        OPENDCP_LOG(LOG_ERROR, "could not write bit rate report to %s", file);
+        return OPENDCP_ERROR;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
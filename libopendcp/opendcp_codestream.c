@@ -0,0 +1,1436 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "opendcp.h"
+
+/*
+   Re-rating rewrites a JPEG2000 codestream of several quality layers into
+   a single layer codestream of fewer bytes without decoding it. Only the
+   packet headers are parsed: for every code-block they give the coding
+   passes and bytes each layer adds. The first layers are kept and each
+   precinct is written again as one packet whose header carries the passes
+   and bytes of those layers together, the code-block data is copied.
+
+   A 2K codestream is extracted from a 4K one the same way: the packets of
+   the highest resolution are left out and the main header is written for
+   one decomposition level less, the other packets are copied whole.
+
+   The codestreams handled are those of the DCI profiles: one tile at the
+   origin, no subsampling, CPRL progression (with POC for 4K) and the
+   default code-block style.
+*/
+
+#define CS_MAX_LEVELS     32
+#define CS_MAX_LAYERS     64
+#define CS_MAX_COMPONENTS 4
+#define CS_MAX_POC        32
+#define CS_MAX_PARTS      256
+
+/* a code-block can not have more passes than a packet header can signal */
+#define CS_MAX_PASSES     164
+
+/* markers */
+#define CS_SOC 0xff4f
+#define CS_SIZ 0xff51
+#define CS_COD 0xff52
+#define CS_COC 0xff53
+#define CS_TLM 0xff55
+#define CS_PLM 0xff57
+#define CS_QCD 0xff5c
+#define CS_QCC 0xff5d
+#define CS_RGN 0xff5e
+#define CS_POC 0xff5f
+#define CS_PPM 0xff60
+#define CS_SOT 0xff90
+#define CS_SOP 0xff91
+#define CS_EPH 0xff92
+#define CS_SOD 0xff93
+#define CS_EOC 0xffd9
+
+/* coding style flags */
+#define CS_CSTY_PRECINCTS 0x01
+#define CS_CSTY_SOP       0x02
+#define CS_CSTY_EPH       0x04
+
+#define CS_CPRL 4
+
+typedef struct {
+    int rs, cs, lye, re, ce;
+} cs_poc_t;
+
+typedef struct {
+    int parent;
+    int value;
+    int low;
+    int known;
+} cs_node_t;
+
+typedef struct {
+    int       count;
+    cs_node_t *node;
+} cs_tree_t;
+
+typedef struct {
+    int       c;
+    int       r;
+    int       bands;
+    int       cw[3];
+    int       ch[3];
+    int       first[3];         /* index of the first code-block of each band */
+    cs_tree_t incl[3];
+    cs_tree_t imsb[3];
+    int       layers;           /* packets read */
+    int       part;             /* tile-part of the packets */
+} cs_precinct_t;
+
+/* the contribution of a code-block to a layer */
+typedef struct {
+    unsigned int offset;
+    unsigned int length;
+    int          passes;
+} cs_segment_t;
+
+typedef struct {
+    unsigned int data;          /* after SOD */
+    unsigned int end;
+    int          tpsot;
+    int          tnsot;
+} cs_part_t;
+
+typedef struct {
+    const unsigned char *data;
+    unsigned int        size;
+    unsigned int        w;
+    unsigned int        h;
+    int                 components;
+    int                 rsiz;
+    int                 csty;
+    int                 progression;
+    int                 layers;
+    int                 levels;
+    int                 cblkw;
+    int                 cblkh;
+    int                 cblksty;
+    int                 qcd_band;       /* bytes of a band in QCD, 0 when derived */
+    int                 ppx[CS_MAX_LEVELS + 1];
+    int                 ppy[CS_MAX_LEVELS + 1];
+    int                 pw[CS_MAX_LEVELS + 1];
+    int                 ph[CS_MAX_LEVELS + 1];
+    int                 base[CS_MAX_COMPONENTS][CS_MAX_LEVELS + 1];
+    cs_poc_t            poc[CS_MAX_POC];
+    int                 npoc;
+    unsigned int        header_end;     /* the first SOT */
+    cs_part_t           part[CS_MAX_PARTS];
+    int                 nparts;
+    cs_precinct_t       *precinct;
+    int                 nprecincts;
+    int                 *sequence;      /* precincts in the order of their packets */
+    int                 nsequence;
+    int                 cblks;
+    int                 *first_layer;   /* layer a code-block is first included in, -1 before */
+    int                 *zero_bitplanes;
+    int                 *lblock;
+    cs_segment_t        *segment;       /* code-blocks by layers */
+} cs_stream_t;
+
+/* bit io of packet headers, a byte after 0xff carries 7 bits */
+typedef struct {
+    const unsigned char *in;
+    unsigned char       *out;
+    unsigned int        pos;
+    unsigned int        end;
+    unsigned int        buf;
+    int                 ct;
+    int                 overrun;
+} cs_bio_t;
+
+static unsigned int cs_get16(const unsigned char *p) {
+    return (p[0] << 8) | p[1];
+}
+
+static unsigned int cs_get32(const unsigned char *p) {
+    return ((unsigned int)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+static void cs_put16(unsigned char *p, unsigned int v) {
+    p[0] = (unsigned char)(v >> 8);
+    p[1] = (unsigned char)v;
+}
+
+static void cs_put32(unsigned char *p, unsigned int v) {
+    cs_put16(p, v >> 16);
+    cs_put16(p + 2, v);
+}
+
+static unsigned int cs_ceildivpow2(unsigned int a, int b) {
+    return (unsigned int)(((unsigned long long)a + (1ULL << b) - 1) >> b);
+}
+
+static int cs_floorlog2(unsigned int a) {
+    int l = 0;
+
+    while (a > 1) {
+        a >>= 1;
+        l++;
+    }
+
+    return l;
+}
+
+static void cs_bio_bytein(cs_bio_t *bio) {
+    bio->buf = (bio->buf << 8) & 0xffff;
+    bio->ct  = bio->buf == 0xff00 ? 7 : 8;
+
+    if (bio->pos < bio->end) {
+        bio->buf |= bio->in[bio->pos++];
+    } else {
+        bio->overrun = 1;
+    }
+}
+
+static int cs_bio_getbit(cs_bio_t *bio) {
+    if (bio->ct == 0) {
+        cs_bio_bytein(bio);
+    }
+
+    bio->ct--;
+
+    return (bio->buf >> bio->ct) & 1;
+}
+
+static unsigned int cs_bio_read(cs_bio_t *bio, int n) {
+    unsigned int v = 0;
+
+    while (n-- > 0) {
+        v |= cs_bio_getbit(bio) << n;
+    }
+
+    return v;
+}
+
+static void cs_bio_inalign(cs_bio_t *bio) {
+    if ((bio->buf & 0xff) == 0xff) {
+        cs_bio_bytein(bio);
+    }
+
+    bio->ct = 0;
+}
+
+static void cs_bio_byteout(cs_bio_t *bio) {
+    bio->buf = (bio->buf << 8) & 0xffff;
+    bio->ct  = bio->buf == 0xff00 ? 7 : 8;
+
+    if (bio->pos < bio->end) {
+        bio->out[bio->pos++] = (unsigned char)(bio->buf >> 8);
+    } else {
+        bio->overrun = 1;
+    }
+}
+
+static void cs_bio_putbit(cs_bio_t *bio, int b) {
+    if (bio->ct == 0) {
+        cs_bio_byteout(bio);
+    }
+
+    bio->ct--;
+    bio->buf |= b << bio->ct;
+}
+
+static void cs_bio_write(cs_bio_t *bio, unsigned int v, int n) {
+    while (n-- > 0) {
+        cs_bio_putbit(bio, (v >> n) & 1);
+    }
+}
+
+static void cs_bio_flush(cs_bio_t *bio) {
+    cs_bio_byteout(bio);
+
+    if (bio->ct == 7) {
+        cs_bio_byteout(bio);
+    }
+}
+
+/* a tag tree over w x h leaves, the nodes of each level follow the level below */
+static int cs_tree_create(cs_tree_t *tree, int w, int h) {
+    int nplh[CS_MAX_LEVELS * 2], nplv[CS_MAX_LEVELS * 2];
+    int levels = 0, n, i, j, k;
+    int node, parent, parent0;
+
+    tree->count = 0;
+    tree->node  = NULL;
+
+    if (w <= 0 || h <= 0) {
+        return OPENDCP_NO_ERROR;
+    }
+
+    nplh[0] = w;
+    nplv[0] = h;
+
+    do {
+        n = nplh[levels] * nplv[levels];
+        nplh[levels + 1] = (nplh[levels] + 1) / 2;
+        nplv[levels + 1] = (nplv[levels] + 1) / 2;
+        tree->count += n;
+        levels++;
+    } while (n > 1);
+
+    tree->node = calloc(tree->count, sizeof(cs_node_t));
+
+    if (!tree->node) {
+        return OPENDCP_ERROR;
+    }
+
+    node    = 0;
+    parent  = w * h;
+    parent0 = parent;
+
+    for (i = 0; i < levels - 1; i++) {
+        for (j = 0; j < nplv[i]; j++) {
+            k = nplh[i];
+
+            while (--k >= 0) {
+                tree->node[node++].parent = parent;
+
+                if (--k >= 0) {
+                    tree->node[node++].parent = parent;
+                }
+
+                parent++;
+            }
+
+            if ((j & 1) || j == nplv[i] - 1) {
+                parent0 = parent;
+            } else {
+                parent   = parent0;
+                parent0 += nplh[i];
+            }
+        }
+    }
+
+    tree->node[node].parent = -1;
+
+    return OPENDCP_NO_ERROR;
+}
+
+static void cs_tree_reset(cs_tree_t *tree, int value) {
+    int i;
+
+    for (i = 0; i < tree->count; i++) {
+        tree->node[i].value = value;
+        tree->node[i].low   = 0;
+        tree->node[i].known = 0;
+    }
+}
+
+static void cs_tree_setvalue(cs_tree_t *tree, int leaf, int value) {
+    int node = leaf;
+
+    while (node >= 0 && tree->node[node].value > value) {
+        tree->node[node].value = value;
+        node = tree->node[node].parent;
+    }
+}
+
+/* returns 1 if the value of the leaf is below threshold */
+static int cs_tree_decode(cs_bio_t *bio, cs_tree_t *tree, int leaf, int threshold) {
+    int stack[CS_MAX_LEVELS * 2];
+    int depth = 0, node = leaf, low = 0;
+
+    while (tree->node[node].parent >= 0) {
+        stack[depth++] = node;
+        node = tree->node[node].parent;
+    }
+
+    for (;;) {
+        cs_node_t *n = &tree->node[node];
+
+        if (low > n->low) {
+            n->low = low;
+        } else {
+            low = n->low;
+        }
+
+        while (low < threshold && low < n->value) {
+            if (cs_bio_getbit(bio)) {
+                n->value = low;
+            } else {
+                low++;
+            }
+        }
+
+        n->low = low;
+
+        if (!depth) {
+            break;
+        }
+
+        node = stack[--depth];
+    }
+
+    return tree->node[node].value < threshold;
+}
+
+static void cs_tree_encode(cs_bio_t *bio, cs_tree_t *tree, int leaf, int threshold) {
+    int stack[CS_MAX_LEVELS * 2];
+    int depth = 0, node = leaf, low = 0;
+
+    while (tree->node[node].parent >= 0) {
+        stack[depth++] = node;
+        node = tree->node[node].parent;
+    }
+
+    for (;;) {
+        cs_node_t *n = &tree->node[node];
+
+        if (low > n->low) {
+            n->low = low;
+        } else {
+            low = n->low;
+        }
+
+        while (low < threshold) {
+            if (low >= n->value) {
+                if (!n->known) {
+                    cs_bio_putbit(bio, 1);
+                    n->known = 1;
+                }
+
+                break;
+            }
+
+            cs_bio_putbit(bio, 0);
+            low++;
+        }
+
+        n->low = low;
+
+        if (!depth) {
+            break;
+        }
+
+        node = stack[--depth];
+    }
+}
+
+static int cs_get_passes(cs_bio_t *bio) {
+    unsigned int n;
+
+    if (!cs_bio_getbit(bio)) {
+        return 1;
+    }
+
+    if (!cs_bio_getbit(bio)) {
+        return 2;
+    }
+
+    if ((n = cs_bio_read(bio, 2)) != 3) {
+        return 3 + n;
+    }
+
+    if ((n = cs_bio_read(bio, 5)) != 31) {
+        return 6 + n;
+    }
+
+    return 37 + cs_bio_read(bio, 7);
+}
+
+static void cs_put_passes(cs_bio_t *bio, int n) {
+    if (n == 1) {
+        cs_bio_write(bio, 0, 1);
+    } else if (n == 2) {
+        cs_bio_write(bio, 2, 2);
+    } else if (n <= 5) {
+        cs_bio_write(bio, 0xc | (n - 3), 4);
+    } else if (n <= 36) {
+        cs_bio_write(bio, 0x1e0 | (n - 6), 9);
+    } else {
+        cs_bio_write(bio, 0xff80 | (n - 37), 16);
+    }
+}
+
+static void cs_free(cs_stream_t *cs) {
+    int i, b;
+
+    if (cs->precinct) {
+        for (i = 0; i < cs->nprecincts; i++) {
+            for (b = 0; b < 3; b++) {
+                free(cs->precinct[i].incl[b].node);
+                free(cs->precinct[i].imsb[b].node);
+            }
+        }
+    }
+
+    free(cs->precinct);
+    free(cs->sequence);
+    free(cs->first_layer);
+    free(cs->zero_bitplanes);
+    free(cs->lblock);
+    free(cs->segment);
+}
+
+static int cs_parse_siz(cs_stream_t *cs, const unsigned char *p, unsigned int length) {
+    int c;
+
+    if (length < 36) {
+        return OPENDCP_ERROR;
+    }
+
+    cs->rsiz       = cs_get16(p);
+    cs->w          = cs_get32(p + 2);
+    cs->h          = cs_get32(p + 6);
+    cs->components = cs_get16(p + 34);
+
+    if (cs->components < 1 || cs->components > CS_MAX_COMPONENTS || length < 36 + 3 * (unsigned int)cs->components) {
+        OPENDCP_LOG(LOG_ERROR, "codestream has %d components", cs->components);
+        return OPENDCP_ERROR;
+    }
+
+    /* image and tile at the origin, one tile */
+    if (cs_get32(p + 10) || cs_get32(p + 14) || cs_get32(p + 26) || cs_get32(p + 30) ||
+        cs_get32(p + 18) < cs->w || cs_get32(p + 22) < cs->h || !cs->w || !cs->h) {
+        OPENDCP_LOG(LOG_ERROR, "only codestreams of one tile at the origin can be rewritten");
+        return OPENDCP_ERROR;
+    }
+
+    for (c = 0; c < cs->components; c++) {
+        if (p[36 + 3 * c + 1] != 1 || p[36 + 3 * c + 2] != 1) {
+            OPENDCP_LOG(LOG_ERROR, "subsampled codestreams can not be rewritten");
+            return OPENDCP_ERROR;
+        }
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+static int cs_parse_cod(cs_stream_t *cs, const unsigned char *p, unsigned int length) {
+    int r;
+
+    if (length < 10) {
+        return OPENDCP_ERROR;
+    }
+
+    cs->csty        = p[0];
+    cs->progression = p[1];
+    cs->layers      = cs_get16(p + 2);
+    cs->levels      = p[5];
+    cs->cblkw       = p[6] + 2;
+    cs->cblkh       = p[7] + 2;
+    cs->cblksty     = p[8];
+
+    if (cs->layers < 1 || cs->layers > CS_MAX_LAYERS || cs->levels >= CS_MAX_LEVELS) {
+        OPENDCP_LOG(LOG_ERROR, "codestream has %d layers and %d levels", cs->layers, cs->levels);
+        return OPENDCP_ERROR;
+    }
+
+    /* passes are split in segments with the other styles */
+    if (cs->cblksty) {
+        OPENDCP_LOG(LOG_ERROR, "codestreams with code-block style %d can not be rewritten", cs->cblksty);
+        return OPENDCP_ERROR;
+    }
+
+    if ((cs->csty & CS_CSTY_PRECINCTS) && length < 10 + (unsigned int)cs->levels + 1) {
+        return OPENDCP_ERROR;
+    }
+
+    for (r = 0; r <= cs->levels; r++) {
+        cs->ppx[r] = cs->csty & CS_CSTY_PRECINCTS ? p[10 + r] & 0x0f : 15;
+        cs->ppy[r] = cs->csty & CS_CSTY_PRECINCTS ? p[10 + r] >> 4 : 15;
+
+        if (r && (!cs->ppx[r] || !cs->ppy[r])) {
+            return OPENDCP_ERROR;
+        }
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+static int cs_parse_qcd(cs_stream_t *cs, const unsigned char *p, unsigned int length) {
+    int style = length ? p[0] & 0x1f : -1;
+
+    cs->qcd_band = style == 0 ? 1 : style == 2 ? 2 : 0;
+
+    /* read after COD, the bands of every level are listed unless derived from the LL band */
+    if ((style == 1 && length != 3) || ((style == 0 || style == 2) &&
+        length != 1 + (unsigned int)cs->qcd_band * (1 + 3 * cs->levels)) || style < 0 || style > 2) {
+        OPENDCP_LOG(LOG_ERROR, "codestream has an invalid QCD marker");
+        return OPENDCP_ERROR;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+static int cs_parse_poc(cs_stream_t *cs, const unsigned char *p, unsigned int length) {
+    unsigned int i;
+
+    for (i = 0; i + 7 <= length; i += 7) {
+        if (cs->npoc == CS_MAX_POC || p[i + 6] != CS_CPRL) {
+            OPENDCP_LOG(LOG_ERROR, "only CPRL progression changes can be rewritten");
+            return OPENDCP_ERROR;
+        }
+
+        cs->poc[cs->npoc].rs  = p[i];
+        cs->poc[cs->npoc].cs  = p[i + 1];
+        cs->poc[cs->npoc].lye = cs_get16(p + i + 2);
+        cs->poc[cs->npoc].re  = p[i + 4];
+        cs->poc[cs->npoc].ce  = p[i + 5] ? p[i + 5] : 256;
+        cs->npoc++;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* the main header, up to the first tile-part */
+static int cs_parse_header(cs_stream_t *cs) {
+    unsigned int pos = 2, marker, length;
+    int          siz = 0, cod = 0, qcd = 0;
+
+    if (cs->size < 2 || cs_get16(cs->data) != CS_SOC) {
+        OPENDCP_LOG(LOG_ERROR, "not a JPEG2000 codestream");
+        return OPENDCP_ERROR;
+    }
+
+    for (;;) {
+        if (pos + 4 > cs->size) {
+            return OPENDCP_ERROR;
+        }
+
+        marker = cs_get16(cs->data + pos);
+
+        if (marker == CS_SOT) {
+            break;
+        }
+
+        length = cs_get16(cs->data + pos + 2);
+
+        if (length < 2 || pos + 2 + length > cs->size) {
+            return OPENDCP_ERROR;
+        }
+
+        switch (marker) {
+            case CS_SIZ:
+                siz = 1;
+
+                if (cs_parse_siz(cs, cs->data + pos + 4, length - 2) != OPENDCP_NO_ERROR) {
+                    return OPENDCP_ERROR;
+                }
+
+                break;
+            case CS_COD:
+                cod = 1;
+
+                if (cs_parse_cod(cs, cs->data + pos + 4, length - 2) != OPENDCP_NO_ERROR) {
+                    return OPENDCP_ERROR;
+                }
+
+                break;
+            case CS_QCD:
+                qcd = 1;
+
+                if (!cod || cs_parse_qcd(cs, cs->data + pos + 4, length - 2) != OPENDCP_NO_ERROR) {
+                    return OPENDCP_ERROR;
+                }
+
+                break;
+            case CS_POC:
+                if (cs_parse_poc(cs, cs->data + pos + 4, length - 2) != OPENDCP_NO_ERROR) {
+                    return OPENDCP_ERROR;
+                }
+
+                break;
+            case CS_COC:
+            case CS_QCC:
+            case CS_RGN:
+            case CS_PPM:
+            case CS_PLM:
+                OPENDCP_LOG(LOG_ERROR, "codestreams with marker %04x can not be rewritten", marker);
+                return OPENDCP_ERROR;
+            default:
+                break;
+        }
+
+        pos += 2 + length;
+    }
+
+    if (!siz || !cod || !qcd) {
+        return OPENDCP_ERROR;
+    }
+
+    if (!cs->npoc && cs->progression != CS_CPRL) {
+        OPENDCP_LOG(LOG_ERROR, "only CPRL codestreams can be rewritten");
+        return OPENDCP_ERROR;
+    }
+
+    cs->header_end = pos;
+
+    return OPENDCP_NO_ERROR;
+}
+
+static int cs_parse_parts(cs_stream_t *cs) {
+    unsigned int pos = cs->header_end, end, psot;
+
+    while (pos + 2 <= cs->size && cs_get16(cs->data + pos) != CS_EOC) {
+        if (pos + 14 > cs->size || cs_get16(cs->data + pos) != CS_SOT || cs_get16(cs->data + pos + 2) != 10 ||
+            cs_get16(cs->data + pos + 4) != 0 || cs->nparts == CS_MAX_PARTS) {
+            OPENDCP_LOG(LOG_ERROR, "codestream has an invalid tile-part");
+            return OPENDCP_ERROR;
+        }
+
+        psot = cs_get32(cs->data + pos + 6);
+        end  = psot ? pos + psot : cs->size - 2;
+
+        if (end > cs->size || end < pos + 14) {
+            return OPENDCP_ERROR;
+        }
+
+        /* packet lengths and headers in the tile-part header would be wrong once rewritten */
+        if (cs_get16(cs->data + pos + 12) != CS_SOD) {
+            OPENDCP_LOG(LOG_ERROR, "codestreams with tile-part header markers can not be rewritten");
+            return OPENDCP_ERROR;
+        }
+
+        cs->part[cs->nparts].data  = pos + 14;
+        cs->part[cs->nparts].end   = end;
+        cs->part[cs->nparts].tpsot = cs->data[pos + 10];
+        cs->part[cs->nparts].tnsot = cs->data[pos + 11];
+        cs->nparts++;
+
+        pos = end;
+    }
+
+    return cs->nparts ? OPENDCP_NO_ERROR : OPENDCP_ERROR;
+}
+
+/* precincts and their code-blocks, laid out as B.6 and B.7 for a tile at the origin */
+static int cs_setup(cs_stream_t *cs) {
+    int c, r, k, b, n = 0;
+
+    for (r = 0; r <= cs->levels; r++) {
+        int          level = cs->levels - r;
+        unsigned int rw    = cs_ceildivpow2(cs->w, level);
+        unsigned int rh    = cs_ceildivpow2(cs->h, level);
+
+        cs->pw[r] = rw ? (int)cs_ceildivpow2(rw, cs->ppx[r]) : 0;
+        cs->ph[r] = rh ? (int)cs_ceildivpow2(rh, cs->ppy[r]) : 0;
+    }
+
+    for (c = 0; c < cs->components; c++) {
+        for (r = 0; r <= cs->levels; r++) {
+            cs->base[c][r] = n;
+            n += cs->pw[r] * cs->ph[r];
+        }
+    }
+
+    cs->nprecincts = n;
+    cs->precinct   = calloc(n ? n : 1, sizeof(cs_precinct_t));
+    cs->sequence   = malloc((n ? n : 1) * sizeof(int));
+
+    if (!cs->precinct || !cs->sequence) {
+        return OPENDCP_ERROR;
+    }
+
+    for (c = 0; c < cs->components; c++) {
+        for (r = 0; r <= cs->levels; r++) {
+            int level  = cs->levels - r;
+            int cbgw   = r ? cs->ppx[r] - 1 : cs->ppx[r];
+            int cbgh   = r ? cs->ppy[r] - 1 : cs->ppy[r];
+            int cbw    = cs->cblkw < cbgw ? cs->cblkw : cbgw;
+            int cbh    = cs->cblkh < cbgh ? cs->cblkh : cbgh;
+
+            for (k = 0; k < cs->pw[r] * cs->ph[r]; k++) {
+                cs_precinct_t *prc = &cs->precinct[cs->base[c][r] + k];
+                unsigned int  px   = (unsigned int)(k % cs->pw[r]) << cbgw;
+                unsigned int  py   = (unsigned int)(k / cs->pw[r]) << cbgh;
+
+                prc->c     = c;
+                prc->r     = r;
+                prc->bands = r ? 3 : 1;
+                prc->part  = -1;
+
+                for (b = 0; b < prc->bands; b++) {
+                    unsigned int bw, bh, x1, y1;
+
+                    /* band HL, LH and HH of a resolution, the LL band of the lowest */
+                    if (!r) {
+                        bw = cs_ceildivpow2(cs->w, level);
+                        bh = cs_ceildivpow2(cs->h, level);
+                    } else {
+                        unsigned int xo = b != 1 ? 1U << level : 0;
+                        unsigned int yo = b != 0 ? 1U << level : 0;
+
+                        bw = cs->w > xo ? cs_ceildivpow2(cs->w - xo, level + 1) : 0;
+                        bh = cs->h > yo ? cs_ceildivpow2(cs->h - yo, level + 1) : 0;
+                    }
+
+                    prc->cw[b] = 0;
+                    prc->ch[b] = 0;
+
+                    if (px < bw && py < bh) {
+                        x1 = px + (1U << cbgw) < bw ? px + (1U << cbgw) : bw;
+                        y1 = py + (1U << cbgh) < bh ? py + (1U << cbgh) : bh;
+                        prc->cw[b] = cs_ceildivpow2(x1, cbw) - (px >> cbw);
+                        prc->ch[b] = cs_ceildivpow2(y1, cbh) - (py >> cbh);
+                    }
+
+                    prc->first[b] = cs->cblks;
+                    cs->cblks    += prc->cw[b] * prc->ch[b];
+
+                    if (cs_tree_create(&prc->incl[b], prc->cw[b], prc->ch[b]) != OPENDCP_NO_ERROR ||
+                        cs_tree_create(&prc->imsb[b], prc->cw[b], prc->ch[b]) != OPENDCP_NO_ERROR) {
+                        return OPENDCP_ERROR;
+                    }
+
+                    cs_tree_reset(&prc->incl[b], 0x7fffffff);
+                    cs_tree_reset(&prc->imsb[b], 0x7fffffff);
+                }
+            }
+        }
+    }
+
+    n = cs->cblks ? cs->cblks : 1;
+    cs->first_layer    = malloc(n * sizeof(int));
+    cs->zero_bitplanes = calloc(n, sizeof(int));
+    cs->lblock         = calloc(n, sizeof(int));
+    cs->segment        = calloc((size_t)n * cs->layers, sizeof(cs_segment_t));
+
+    if (!cs->first_layer || !cs->zero_bitplanes || !cs->lblock || !cs->segment) {
+        return OPENDCP_ERROR;
+    }
+
+    memset(cs->first_layer, 0xff, n * sizeof(int));
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* reads the header of a packet and locates the code-block data after it */
+static int cs_read_packet(cs_stream_t *cs, cs_precinct_t *prc, int layer, unsigned int *pos, unsigned int end) {
+    cs_bio_t     bio;
+    unsigned int p = *pos;
+    int          b, i;
+
+    if ((cs->csty & CS_CSTY_SOP) && p + 6 <= end && cs_get16(cs->data + p) == CS_SOP) {
+        p += 6;
+    }
+
+    memset(&bio, 0, sizeof(bio));
+    bio.in  = cs->data;
+    bio.pos = p;
+    bio.end = end;
+
+    if (cs_bio_getbit(&bio)) {
+        for (b = 0; b < prc->bands; b++) {
+            for (i = 0; i < prc->cw[b] * prc->ch[b]; i++) {
+                int          cblk     = prc->first[b] + i;
+                cs_segment_t *segment = &cs->segment[(size_t)cblk * cs->layers + layer];
+                int          included, n;
+
+                if (cs->first_layer[cblk] < 0) {
+                    included = cs_tree_decode(&bio, &prc->incl[b], i, layer + 1);
+                } else {
+                    included = cs_bio_getbit(&bio);
+                }
+
+                if (!included) {
+                    continue;
+                }
+
+                if (cs->first_layer[cblk] < 0) {
+                    for (n = 0; !cs_tree_decode(&bio, &prc->imsb[b], i, n); n++) {
+                        if (bio.overrun) {
+                            return OPENDCP_ERROR;
+                        }
+                    }
+
+                    cs->first_layer[cblk]    = layer;
+                    cs->zero_bitplanes[cblk] = n - 1;
+                    cs->lblock[cblk]         = 3;
+                }
+
+                segment->passes = cs_get_passes(&bio);
+
+                while (cs_bio_getbit(&bio) && !bio.overrun) {
+                    cs->lblock[cblk]++;
+                }
+
+                if (cs->lblock[cblk] > 32) {
+                    return OPENDCP_ERROR;
+                }
+
+                segment->length = cs_bio_read(&bio, cs->lblock[cblk] + cs_floorlog2(segment->passes));
+            }
+        }
+    }
+
+    cs_bio_inalign(&bio);
+
+    if (bio.overrun) {
+        return OPENDCP_ERROR;
+    }
+
+    p = bio.pos;
+
+    if (cs->csty & CS_CSTY_EPH) {
+        if (p + 2 > end || cs_get16(cs->data + p) != CS_EPH) {
+            return OPENDCP_ERROR;
+        }
+
+        p += 2;
+    }
+
+    /* the data follows in the order of the header */
+    for (b = 0; b < prc->bands; b++) {
+        for (i = 0; i < prc->cw[b] * prc->ch[b]; i++) {
+            cs_segment_t *segment = &cs->segment[(size_t)(prc->first[b] + i) * cs->layers + layer];
+
+            if (!segment->passes) {
+                continue;
+            }
+
+            if (segment->length > end - p) {
+                return OPENDCP_ERROR;
+            }
+
+            segment->offset = p;
+            p += segment->length;
+        }
+    }
+
+    *pos = p;
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* reads the packets of the tile in CPRL order, over the progression changes if there are any */
+static int cs_parse_packets(cs_stream_t *cs) {
+    cs_poc_t          whole;
+    const cs_poc_t    *poc = cs->poc;
+    int               npoc = cs->npoc;
+    int               i, c, r, part = 0, last = -1;
+    unsigned int      pos = cs->part[0].data;
+    unsigned long long x, y, xstep = ~0ULL, ystep = ~0ULL;
+
+    if (!npoc) {
+        whole.rs  = 0;
+        whole.cs  = 0;
+        whole.lye = cs->layers;
+        whole.re  = cs->levels + 1;
+        whole.ce  = cs->components;
+        poc       = &whole;
+        npoc      = 1;
+    }
+
+    for (r = 0; r <= cs->levels; r++) {
+        int level = cs->levels - r;
+
+        if (1ULL << (cs->ppx[r] + level) < xstep) {
+            xstep = 1ULL << (cs->ppx[r] + level);
+        }
+
+        if (1ULL << (cs->ppy[r] + level) < ystep) {
+            ystep = 1ULL << (cs->ppy[r] + level);
+        }
+    }
+
+    for (i = 0; i < npoc; i++) {
+        int re  = poc[i].re < cs->levels + 1 ? poc[i].re : cs->levels + 1;
+        int ce  = poc[i].ce < cs->components ? poc[i].ce : cs->components;
+        int lye = poc[i].lye < cs->layers ? poc[i].lye : cs->layers;
+
+        for (c = poc[i].cs; c < ce; c++) {
+            for (y = 0; y < cs->h; y += ystep) {
+                for (x = 0; x < cs->w; x += xstep) {
+                    for (r = poc[i].rs; r < re; r++) {
+                        int           level = cs->levels - r;
+                        int           k;
+                        cs_precinct_t *prc;
+
+                        if (!cs->pw[r] || !cs->ph[r] || y % (1ULL << (cs->ppy[r] + level)) ||
+                            x % (1ULL << (cs->ppx[r] + level))) {
+                            continue;
+                        }
+
+                        k   = cs->base[c][r] + (int)(x >> (cs->ppx[r] + level)) +
+                              (int)(y >> (cs->ppy[r] + level)) * cs->pw[r];
+                        prc = &cs->precinct[k];
+
+                        for (; prc->layers < lye; prc->layers++) {
+                            while (pos >= cs->part[part].end && part + 1 < cs->nparts) {
+                                part++;
+                                pos = cs->part[part].data;
+                            }
+
+                            /* the layers of a precinct become one packet, they must be read together */
+                            if (prc->layers ? last != k || prc->part != part : prc->part >= 0) {
+                                OPENDCP_LOG(LOG_ERROR, "the layers of a precinct are not consecutive in the codestream");
+                                return OPENDCP_ERROR;
+                            }
+
+                            if (!prc->layers) {
+                                prc->part = part;
+                                cs->sequence[cs->nsequence++] = k;
+                            }
+
+                            if (cs_read_packet(cs, prc, prc->layers, &pos, cs->part[part].end) != OPENDCP_NO_ERROR) {
+                                OPENDCP_LOG(LOG_ERROR, "invalid packet header in the codestream");
+                                return OPENDCP_ERROR;
+                            }
+
+                            last = k;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    for (i = 0; i < cs->nprecincts; i++) {
+        if (cs->precinct[i].layers != cs->layers) {
+            OPENDCP_LOG(LOG_ERROR, "the codestream progression does not hold every packet");
+            return OPENDCP_ERROR;
+        }
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* one packet holding the first keep layers of a precinct */
+static int cs_write_packet(cs_stream_t *cs, cs_precinct_t *prc, int keep, int sequence, unsigned char *out,
+                           unsigned int *pos, unsigned int capacity) {
+    cs_bio_t bio;
+    int      b, i, l, any = 0;
+
+    if (cs->csty & CS_CSTY_SOP) {
+        if (*pos + 6 > capacity) {
+            return OPENDCP_ERROR;
+        }
+
+        cs_put16(out + *pos, CS_SOP);
+        cs_put16(out + *pos + 2, 4);
+        cs_put16(out + *pos + 4, sequence & 0xffff);
+        *pos += 6;
+    }
+
+    for (b = 0; b < prc->bands; b++) {
+        if (!prc->incl[b].count) {
+            continue;
+        }
+
+        cs_tree_reset(&prc->incl[b], 0x7fffffff);
+        cs_tree_reset(&prc->imsb[b], 0x7fffffff);
+
+        for (i = 0; i < prc->cw[b] * prc->ch[b]; i++) {
+            int cblk = prc->first[b] + i;
+
+            if (cs->first_layer[cblk] >= 0 && cs->first_layer[cblk] < keep) {
+                cs_tree_setvalue(&prc->incl[b], i, 0);
+                cs_tree_setvalue(&prc->imsb[b], i, cs->zero_bitplanes[cblk]);
+                any = 1;
+            } else {
+                cs_tree_setvalue(&prc->incl[b], i, 1);
+            }
+        }
+    }
+
+    memset(&bio, 0, sizeof(bio));
+    bio.out = out;
+    bio.pos = *pos;
+    bio.end = capacity;
+    bio.ct  = 8;
+
+    cs_bio_putbit(&bio, any);
+
+    for (b = 0; any && b < prc->bands; b++) {
+        for (i = 0; i < prc->cw[b] * prc->ch[b]; i++) {
+            int          cblk = prc->first[b] + i;
+            unsigned int length = 0;
+            int          passes = 0, increment;
+
+            cs_tree_encode(&bio, &prc->incl[b], i, 1);
+
+            if (cs->first_layer[cblk] < 0 || cs->first_layer[cblk] >= keep) {
+                continue;
+            }
+
+            for (l = cs->first_layer[cblk]; l < keep; l++) {
+                passes += cs->segment[(size_t)cblk * cs->layers + l].passes;
+                length += cs->segment[(size_t)cblk * cs->layers + l].length;
+            }
+
+            if (passes > CS_MAX_PASSES) {
+                return OPENDCP_ERROR;
+            }
+
+            cs_tree_encode(&bio, &prc->imsb[b], i, 0x7fffffff);
+            cs_put_passes(&bio, passes);
+
+            /* lblock starts at 3 for a code-block first included in this packet */
+            increment = cs_floorlog2(length) + 1 - (3 + cs_floorlog2(passes));
+            increment = increment > 0 ? increment : 0;
+
+            for (l = 0; l < increment; l++) {
+                cs_bio_putbit(&bio, 1);
+            }
+
+            cs_bio_putbit(&bio, 0);
+            cs_bio_write(&bio, length, 3 + increment + cs_floorlog2(passes));
+        }
+    }
+
+    cs_bio_flush(&bio);
+
+    if (bio.overrun) {
+        return OPENDCP_ERROR;
+    }
+
+    *pos = bio.pos;
+
+    if (cs->csty & CS_CSTY_EPH) {
+        if (*pos + 2 > capacity) {
+            return OPENDCP_ERROR;
+        }
+
+        cs_put16(out + *pos, CS_EPH);
+        *pos += 2;
+    }
+
+    for (b = 0; any && b < prc->bands; b++) {
+        for (i = 0; i < prc->cw[b] * prc->ch[b]; i++) {
+            int cblk = prc->first[b] + i;
+
+            if (cs->first_layer[cblk] < 0) {
+                continue;
+            }
+
+            for (l = cs->first_layer[cblk]; l < keep; l++) {
+                const cs_segment_t *segment = &cs->segment[(size_t)cblk * cs->layers + l];
+
+                if (segment->length > capacity - *pos) {
+                    return OPENDCP_ERROR;
+                }
+
+                memcpy(out + *pos, cs->data + segment->offset, segment->length);
+                *pos += segment->length;
+            }
+        }
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*
+   A main header marker segment as it is written, p holds a copy of it.
+   Returns the new segment length, or 0 to leave the marker out.
+*/
+static unsigned int cs_rewrite_marker(cs_stream_t *cs, int drop, unsigned char *p) {
+    unsigned int marker = cs_get16(p), length = cs_get16(p + 2);
+    unsigned int w = cs_ceildivpow2(cs->w, drop), h = cs_ceildivpow2(cs->h, drop);
+    int          resolutions = cs->levels + 1 - drop;
+    int          i, n = 0;
+
+    p += 4;
+
+    switch (marker) {
+        case CS_TLM:
+            return 0;
+        /* single layer codestreams are in a DCI profile, 2K once a level is dropped */
+        case CS_SIZ:
+            if (cs->rsiz == 0 || drop) {
+                cs_put16(p, w > 2048 || h > 1080 ? 4 : 3);
+            }
+
+            cs_put32(p + 2, w);
+            cs_put32(p + 6, h);
+            cs_put32(p + 18, cs_ceildivpow2(cs_get32(p + 18), drop));
+            cs_put32(p + 22, cs_ceildivpow2(cs_get32(p + 22), drop));
+            break;
+        case CS_COD:
+            cs_put16(p + 2, 1);
+            p[5] = (unsigned char)(cs->levels - drop);
+
+            /* the precinct sizes of the dropped resolutions are last */
+            if (cs->csty & CS_CSTY_PRECINCTS) {
+                length -= drop;
+            }
+
+            break;
+        case CS_QCD:
+            length -= 3 * drop * cs->qcd_band;
+            break;
+        case CS_POC:
+            for (i = 0; (unsigned int)i + 7 <= length - 2; i += 7) {
+                if (p[i] >= resolutions) {
+                    continue;
+                }
+
+                memmove(p + n, p + i, 7);
+
+                if (cs_get16(p + n + 2) > 1) {
+                    cs_put16(p + n + 2, 1);
+                }
+
+                if (p[n + 4] > resolutions) {
+                    p[n + 4] = (unsigned char)resolutions;
+                }
+
+                n += 7;
+            }
+
+            /* a single change over the whole tile is the CPRL progression of COD */
+            if (!n || (drop && n == 7 && cs->progression == CS_CPRL && !p[0] && !p[1] && p[4] == resolutions &&
+                       (!p[5] || p[5] >= cs->components))) {
+                return 0;
+            }
+
+            length = 2 + n;
+            break;
+        default:
+            break;
+    }
+
+    cs_put16(p - 2, length);
+
+    return length;
+}
+
+/*
+   The codestream with the first keep layers as one layer and the highest
+   drop resolutions left out, and the largest share of a component.
+*/
+static int cs_write(cs_stream_t *cs, int keep, int drop, unsigned char *out, unsigned int capacity, unsigned int *size,
+                    unsigned int *component_max) {
+    unsigned int component[CS_MAX_COMPONENTS] = {0};
+    unsigned int pos = 2, o = 2, length, tlm, sot, start;
+    int          used[CS_MAX_PARTS];
+    int          resolutions = cs->levels + 1 - drop;
+    int          i, p, s, t = 0, nparts = 0, sequence = 0;
+
+    if (capacity < 2) {
+        return OPENDCP_ERROR;
+    }
+
+    cs_put16(out, CS_SOC);
+
+    /* the main header is copied, a new TLM replaces the old one */
+    while (pos < cs->header_end) {
+        length = cs_get16(cs->data + pos + 2);
+
+        if (o + 2 + length > capacity) {
+            return OPENDCP_ERROR;
+        }
+
+        memcpy(out + o, cs->data + pos, 2 + length);
+        length = cs_rewrite_marker(cs, drop, out + o);
+        o     += length ? 2 + length : 0;
+        pos   += 2 + cs_get16(cs->data + pos + 2);
+    }
+
+    /* tile-parts left with no packets are not written */
+    for (p = 0, s = 0; p < cs->nparts; p++) {
+        used[p] = !drop;
+
+        for (; s < cs->nsequence && cs->precinct[cs->sequence[s]].part == p; s++) {
+            used[p] |= cs->precinct[cs->sequence[s]].r < resolutions;
+        }
+
+        nparts += used[p];
+    }
+
+    if (o + 6 + 5 * nparts > capacity) {
+        return OPENDCP_ERROR;
+    }
+
+    cs_put16(out + o, CS_TLM);
+    cs_put16(out + o + 2, 4 + 5 * nparts);
+    out[o + 4] = 0;
+    out[o + 5] = 0x50;
+    tlm = o + 6;
+    o  += 6 + 5 * nparts;
+
+    for (p = 0, s = 0; p < cs->nparts; p++) {
+        if (!used[p]) {
+            while (s < cs->nsequence && cs->precinct[cs->sequence[s]].part == p) {
+                s++;
+            }
+
+            continue;
+        }
+
+        if (o + 14 > capacity) {
+            return OPENDCP_ERROR;
+        }
+
+        sot = o;
+        cs_put16(out + o, CS_SOT);
+        cs_put16(out + o + 2, 10);
+        cs_put16(out + o + 4, 0);
+        out[o + 10] = (unsigned char)(drop ? t : cs->part[p].tpsot);
+        out[o + 11] = (unsigned char)(drop ? nparts : cs->part[p].tnsot);
+        cs_put16(out + o + 12, CS_SOD);
+        o += 14;
+
+        for (; s < cs->nsequence && cs->precinct[cs->sequence[s]].part == p; s++) {
+            cs_precinct_t *prc = &cs->precinct[cs->sequence[s]];
+
+            if (prc->r >= resolutions) {
+                continue;
+            }
+
+            start = o;
+
+            if (cs_write_packet(cs, prc, keep, sequence++, out, &o, capacity) != OPENDCP_NO_ERROR) {
+                return OPENDCP_ERROR;
+            }
+
+            component[prc->c] += o - start;
+        }
+
+        cs_put32(out + sot + 6, o - sot);
+        out[tlm + 5 * t] = 0;
+        cs_put32(out + tlm + 5 * t + 1, o - sot);
+        t++;
+    }
+
+    if (o + 2 > capacity) {
+        return OPENDCP_ERROR;
+    }
+
+    cs_put16(out + o, CS_EOC);
+    *size = o + 2;
+
+    *component_max = 0;
+
+    for (i = 0; i < cs->components; i++) {
+        if (component[i] > *component_max) {
+            *component_max = component[i];
+        }
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*!
+ @function opendcp_codestream_rerate
+ @abstract Truncates a codestream of several quality layers to a frame size.
+ @discussion The most layers that fit the budget are kept and written as
+             the single layer of a DCI codestream. Only packet headers are
+             parsed and written again, the code-block data is copied, so
+             this is much faster than decoding and encoding the frame. A
+             master encoded with several layers gets its DCI profile in
+             Rsiz back. As the encoder does, each component is held to
+             4/5 of the budget.
+ @param data The codestream.
+ @param size The bytes of the codestream.
+ @param budget The bytes the frame may take, 0 keeps every layer.
+ @param out The rewritten codestream.
+ @param capacity The bytes out has room for.
+ @param out_size Set to the bytes of the rewritten codestream.
+ @param layers Set to the layers kept, may be NULL.
+ @return OPENDCP_NO_ERROR, or OPENDCP_ERROR if the codestream can not be
+         rewritten or its first layer does not fit the budget.
+*/
+int opendcp_codestream_rerate(const unsigned char *data, unsigned int size, unsigned int budget, unsigned char *out,
+                              unsigned int capacity, unsigned int *out_size, int *layers) {
+    cs_stream_t  cs;
+    unsigned int component_max;
+    int          keep;
+    int          result = OPENDCP_ERROR;
+
+    memset(&cs, 0, sizeof(cs));
+    cs.data = data;
+    cs.size = size;
+
+    if (cs_parse_header(&cs) != OPENDCP_NO_ERROR || cs_parse_parts(&cs) != OPENDCP_NO_ERROR ||
+        cs_setup(&cs) != OPENDCP_NO_ERROR || cs_parse_packets(&cs) != OPENDCP_NO_ERROR) {
+        cs_free(&cs);
+        return OPENDCP_ERROR;
+    }
+
+    for (keep = cs.layers; keep > 0; keep--) {
+        if (cs_write(&cs, keep, 0, out, capacity, out_size, &component_max) != OPENDCP_NO_ERROR) {
+            continue;
+        }
+
+        if (!budget || (*out_size <= budget && component_max <= budget / 5 * 4)) {
+            result = OPENDCP_NO_ERROR;
+            break;
+        }
+    }
+
+    if (result == OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_DEBUG, "kept %d of %d layers, %u bytes", keep, cs.layers, *out_size);
+
+        if (layers) {
+            *layers = keep;
+        }
+    } else {
+        OPENDCP_LOG(LOG_ERROR, "the first layer of the codestream does not fit %u bytes", budget);
+    }
+
+    cs_free(&cs);
+
+    return result;
+}
+
+/*!
+ @function opendcp_codestream_extract_2k
+ @abstract Extracts the 2K codestream of a 4K codestream.
+ @discussion DCI 4K codestreams hold a 2K image in all but their highest
+             resolution. The packets of the highest resolution are left
+             out, the others are copied, and the main header is written
+             for the 2K size, one decomposition level less and the 2K
+             profile. Tile-parts left without packets go, a TLM is
+             written for those that remain.
+ @param data The 4K codestream.
+ @param size The bytes of the codestream.
+ @param out The 2K codestream.
+ @param capacity The bytes out has room for.
+ @param out_size Set to the bytes of the 2K codestream.
+ @return OPENDCP_NO_ERROR, or OPENDCP_ERROR if the codestream is not 4K or
+         can not be rewritten.
+*/
+int opendcp_codestream_extract_2k(const unsigned char *data, unsigned int size, unsigned char *out, unsigned int capacity,
+                                  unsigned int *out_size) {
+    cs_stream_t  cs;
+    unsigned int component_max;
+    int          result = OPENDCP_ERROR;
+
+    memset(&cs, 0, sizeof(cs));
+    cs.data = data;
+    cs.size = size;
+
+    if (cs_parse_header(&cs) != OPENDCP_NO_ERROR) {
+        return OPENDCP_ERROR;
+    }
+
+    if (cs.levels < 1 || (cs.w <= 2048 && cs.h <= 1080)) {
+        OPENDCP_LOG(LOG_ERROR, "the codestream is %ux%u, not 4K", cs.w, cs.h);
+        return OPENDCP_ERROR;
+    }
+
+    if (cs_parse_parts(&cs) == OPENDCP_NO_ERROR && cs_setup(&cs) == OPENDCP_NO_ERROR &&
+        cs_parse_packets(&cs) == OPENDCP_NO_ERROR) {
+        result = cs_write(&cs, cs.layers, 1, out, capacity, out_size, &component_max);
+    }
+
+    cs_free(&cs);
+
+    return result;
+}
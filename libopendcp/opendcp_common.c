@@ -373,6 +373,106 @@ int order_indexed_files(char *files[], int nfiles) {
     return OPENDCP_NO_ERROR;
 }
 
+/**
+Order a list of filenames and check the sequence in one pass.
+
+This gives the same order as order_indexed_files() followed by
+ensure_sequential(), but the common prefix is found and each file's index
+is parsed only once. When the indices are dense (the normal case for a
+frame sequence) the files are placed directly by index instead of being
+sorted, which also finds gaps and duplicates.
+
+@param  files is an array of file names
+@param  nfiles is the number of files
+@param  gap receives 0 if the files are sequential, otherwise the position
+        ensure_sequential() would return
+@return OPENDCP_ERROR_CODE
+*/
+int order_sequence(char *files[], int nfiles, int *gap) {
+    int  prefix_len, i;
+    int  min, max, dense = 1;
+    char prefix_buffer[MAX_FILENAME_LENGTH];
+    opendcp_sort_t *fis;
+    opendcp_sort_t **slots = NULL;
+
+    *gap = 0;
+
+    if (nfiles < 2) {
+        return OPENDCP_NO_ERROR;
+    }
+
+    prefix_of_all(files, nfiles, prefix_buffer);
+    prefix_len = strlen(prefix_buffer);
+
+    fis = malloc(sizeof(*fis) * nfiles);
+
+    if (!fis) {
+        return OPENDCP_ERROR;
+    }
+
+    for (i = 0; i < nfiles; i++) {
+        fis[i].file  = files[i];
+        fis[i].index = get_index(files[i], prefix_len);
+    }
+
+    min = max = fis[0].index;
+
+    for (i = 1; i < nfiles; i++) {
+        min = fis[i].index < min ? fis[i].index : min;
+        max = fis[i].index > max ? fis[i].index : max;
+    }
+
+    /* place by index when the range is close to the file count */
+    if ((long long)max - min < 2LL * nfiles) {
+        slots = calloc(max - min + 1, sizeof(*slots));
+    }
+
+    if (slots) {
+        for (i = 0; i < nfiles && dense; i++) {
+            if (slots[fis[i].index - min]) {
+                dense = 0;
+            }
+            else {
+                slots[fis[i].index - min] = &fis[i];
+            }
+        }
+
+        if (dense) {
+            int n = 0;
+
+            for (i = 0; i <= max - min; i++) {
+                if (slots[i]) {
+                    files[n++] = slots[i]->file;
+                }
+                else if (!*gap) {
+                    *gap = n - 1 > 0 ? n - 1 : 1;
+                }
+            }
+        }
+
+        free(slots);
+    }
+
+    /* duplicates or sparse indices, sort and scan */
+    if (!slots || !dense) {
+        qsort(fis, nfiles, sizeof(*fis), file_cmp);
+
+        for (i = 0; i < nfiles; i++) {
+            files[i] = fis[i].file;
+        }
+
+        for (i = 0; i < nfiles - 1 && !*gap; i++) {
+            if (fis[i].index + 1 != fis[i + 1].index) {
+                *gap = i ? i : 1;
+            }
+        }
+    }
+
+    free(fis);
+
+    return OPENDCP_NO_ERROR;
+}
+
 /**
 Allocate a list of filenames
 
@@ -389,6 +489,7 @@ filelist_t *filelist_alloc(int nfiles) {
 
     filelist->nfiles = nfiles;
     filelist->files  = malloc(filelist->nfiles * sizeof(char*));
+    filelist->arena  = NULL;
 
     if (filelist->nfiles) {
         for (x = 0; x < filelist->nfiles; x++) {
@@ -399,6 +500,40 @@ filelist_t *filelist_alloc(int nfiles) {
     return filelist;
 }
 
+/**
+Allocate a list of filenames backed by a single buffer
+
+The file pointers are left for the caller to point into filelist->arena,
+which holds size bytes. Unlike filelist_alloc() the entries are not
+MAX_FILENAME_LENGTH buffers and must not be written past their strings.
+
+@param  nfiles is the number of files to allocate
+@param  size is the number of bytes needed for all the names
+@return filelist_t pointer
+*/
+filelist_t *filelist_alloc_arena(int nfiles, size_t size) {
+    filelist_t *filelist;
+
+    filelist = malloc(sizeof(filelist_t));
+
+    if (!filelist) {
+        return NULL;
+    }
+
+    filelist->nfiles = nfiles;
+    filelist->files  = malloc((nfiles ? nfiles : 1) * sizeof(char*));
+    filelist->arena  = malloc(size ? size : 1);
+
+    if (!filelist->files || !filelist->arena) {
+        free(filelist->files);
+        free(filelist->arena);
+        free(filelist);
+        return NULL;
+    }
+
+    return filelist;
+}
+
 /**
 free a filelist_t structure
 
@@ -414,7 +549,11 @@ void filelist_free(filelist_t *filelist) {
         return;
     }
 
-    if (filelist->files) {
+    if (filelist->arena) {
+        free(filelist->arena);
+        free(filelist->files);
+    }
+    else if (filelist->files) {
         for (x = 0; x < filelist->nfiles; x++) {
             free(filelist->files[x]);
         }
@@ -511,6 +650,8 @@ opendcp_t *opendcp_create() {
     opendcp->mxf.write_hmac = 1;
 
     /* initialize callbacks */
+    opendcp->j2k.frame_done.callback  = opendcp_callback_null;
+    opendcp->j2k.frame_done.argument  = NULL;
     opendcp->mxf.frame_done.callback  = opendcp_callback_null;
     opendcp->mxf.frame_done.argument  = NULL;
     opendcp->mxf.file_done.callback   = opendcp_callback_null;
@@ -533,12 +674,87 @@ This function will de-allocate an opendcp context.
 */
 int opendcp_delete(opendcp_t *opendcp) {
     if ( opendcp != NULL) {
+        opendcp_remote_disconnect(opendcp);
+        opendcp_worker_stop(opendcp);
+        free_dcp(&opendcp->dcp);
         free(opendcp);
     }
 
     return OPENDCP_NO_ERROR;
 }
 
+/**
+copy the configuration of an opendcp context
+
+The copy shares nothing that a conversion changes: the composition lists,
+remote connections, encoder processes, signing session, metrics, quality and gamut reports
+and cancel flags start out empty, and the callbacks are reset. The option strings
+and the cube are shared with the source and must outlive the copy.
+
+@param  opendcp an opendcp_t structure
+@return A new opendcp_t structure on success, otherwise returns NULL
+*/
+opendcp_t *opendcp_clone(const opendcp_t *opendcp) {
+    opendcp_t *clone;
+
+    clone = malloc(sizeof(opendcp_t));
+
+    if (!clone) {
+        return NULL;
+    }
+
+    memcpy(clone, opendcp, sizeof(opendcp_t));
+
+    clone->dcp.pkl_count            = 0;
+    clone->dcp.pkl_alloc            = 0;
+    clone->dcp.pkl                  = NULL;
+    clone->remote.farm              = NULL;
+    clone->worker.pool              = NULL;
+    clone->xml_signature.session    = NULL;
+    clone->metrics                  = NULL;
+    clone->j2k.quality              = NULL;
+    clone->j2k.gamut                = NULL;
+    clone->j2k.cancel               = 0;
+    clone->mxf.cancel               = 0;
+    clone->mxf.digest[0]            = '\0';
+    memset(&clone->mxf.progress, 0, sizeof(clone->mxf.progress));
+
+    clone->j2k.frame_done.callback  = opendcp_callback_null;
+    clone->j2k.frame_done.argument  = NULL;
+    clone->mxf.frame_done.callback  = opendcp_callback_null;
+    clone->mxf.frame_done.argument  = NULL;
+    clone->mxf.file_done.callback   = opendcp_callback_null;
+    clone->mxf.file_done.argument   = NULL;
+    clone->dcp.sha1_update.callback = opendcp_callback_null;
+    clone->dcp.sha1_update.argument = NULL;
+    clone->dcp.sha1_done.callback   = opendcp_callback_null;
+    clone->dcp.sha1_done.argument   = NULL;
+
+    return clone;
+}
+
+/* make room for one more element of a composition array, returns the array or NULL */
+static void *grow_array(void *array, int *alloc, int count, size_t size) {
+    void *p;
+    int  n;
+
+    if (count < *alloc) {
+        return array;
+    }
+
+    n = *alloc ? *alloc * 2 : 4;
+    p = realloc(array, n * size);
+
+    if (!p) {
+        OPENDCP_LOG(LOG_ERROR, "could not allocate memory for %d composition entries", n);
+        return NULL;
+    }
+
+    *alloc = n;
+
+    return p;
+}
+
 /**
 create a pkl and add information
 
@@ -549,15 +765,15 @@ from a dcp_t structure.
 @param  pkl pkl_t  structure
 @return NONE
 */
-void create_pkl(dcp_t dcp, pkl_t *pkl) {
+void create_pkl(const dcp_t *dcp, pkl_t *pkl) {
     char uuid_s[40];
 
     memset(pkl, 0, sizeof(pkl_t));
 
-    strcpy(pkl->issuer,     dcp.issuer);
-    strcpy(pkl->creator,    dcp.creator);
-    strcpy(pkl->annotation, dcp.annotation);
-    strcpy(pkl->timestamp,  dcp.timestamp);
+    strcpy(pkl->issuer,     dcp->issuer);
+    strcpy(pkl->creator,    dcp->creator);
+    strcpy(pkl->annotation, dcp->annotation);
+    strcpy(pkl->timestamp,  dcp->timestamp);
     pkl->cpl_count = 0;
 
     /* Generate UUIDs */
@@ -565,11 +781,11 @@ void create_pkl(dcp_t dcp, pkl_t *pkl) {
     sprintf(pkl->uuid, "%.36s", uuid_s);
 
     /* Generate XML filename */
-    if ( !strcmp(dcp.basename, "") ) {
+    if ( !strcmp(dcp->basename, "") ) {
         sprintf(pkl->filename, "PKL_%.40s.xml", pkl->uuid);
     }
     else {
-        sprintf(pkl->filename, "PKL_%.40s.xml", dcp.basename);
+        sprintf(pkl->filename, "PKL_%.40s.xml", dcp->basename);
     }
 
     return;
@@ -578,17 +794,24 @@ void create_pkl(dcp_t dcp, pkl_t *pkl) {
 /**
 add packaging list to dcp
 
-This function adds a pkl to a dcp_t structure
+This function adds a pkl to a dcp_t structure. The dcp takes over
+the cpls of the pkl, they are freed with the dcp.
 
 @param  dcp dcp_t structure
 @param  pkl pkl_t structure
-@return NONE
+@return the pkl held by the dcp, NULL if it could not be added
 */
-void add_pkl_to_dcp(dcp_t *dcp, pkl_t pkl) {
-    memcpy(dcp[dcp->pkl_count].pkl, &pkl, sizeof(pkl_t));
-    dcp->pkl_count++;
+pkl_t *add_pkl_to_dcp(dcp_t *dcp, pkl_t *pkl) {
+    pkl_t *list = grow_array(dcp->pkl, &dcp->pkl_alloc, dcp->pkl_count, sizeof(pkl_t));
 
-    return;
+    if (!list) {
+        return NULL;
+    }
+
+    dcp->pkl = list;
+    dcp->pkl[dcp->pkl_count] = *pkl;
+
+    return &dcp->pkl[dcp->pkl_count++];
 }
 
 /**
@@ -601,29 +824,29 @@ from a dcp_t structure.
 @param  cpl cpl_t structure
 @return NONE
 */
-void create_cpl(dcp_t dcp, cpl_t *cpl) {
+void create_cpl(const dcp_t *dcp, cpl_t *cpl) {
     char uuid_s[40];
 
     memset(cpl, 0, sizeof(cpl_t));
 
-    strcpy(cpl->annotation, dcp.annotation);
-    strcpy(cpl->issuer,     dcp.issuer);
-    strcpy(cpl->creator,    dcp.creator);
-    strcpy(cpl->title,      dcp.title);
-    strcpy(cpl->kind,       dcp.kind);
-    strcpy(cpl->rating,     dcp.rating);
-    strcpy(cpl->timestamp,  dcp.timestamp);
+    strcpy(cpl->annotation, dcp->annotation);
+    strcpy(cpl->issuer,     dcp->issuer);
+    strcpy(cpl->creator,    dcp->creator);
+    strcpy(cpl->title,      dcp->title);
+    strcpy(cpl->kind,       dcp->kind);
+    strcpy(cpl->rating,     dcp->rating);
+    strcpy(cpl->timestamp,  dcp->timestamp);
     cpl->reel_count = 0;
 
     uuid_random(uuid_s);
     sprintf(cpl->uuid, "%.36s", uuid_s);
 
     /* Generate XML filename */
-    if ( !strcmp(dcp.basename, "") ) {
+    if ( !strcmp(dcp->basename, "") ) {
         sprintf(cpl->filename, "CPL_%.40s.xml", cpl->uuid);
     }
     else {
-        sprintf(cpl->filename, "CPL_%.40s.xml", dcp.basename);
+        sprintf(cpl->filename, "CPL_%.40s.xml", dcp->basename);
     }
 
     return;
@@ -632,17 +855,49 @@ void create_cpl(dcp_t dcp, cpl_t *cpl) {
 /**
 add packaging list to packaging list
 
-This functio adds a cpl to a pkl structure
+This functio adds a cpl to a pkl structure. The pkl takes over
+the reels of the cpl.
 
-@param  dcp dcp_t structure
+@param  pkl pkl_t structure
 @param  cpl cpl_t structure
+@return the cpl held by the pkl, NULL if it could not be added
+*/
+cpl_t *add_cpl_to_pkl(pkl_t *pkl, cpl_t *cpl) {
+    cpl_t *list = grow_array(pkl->cpl, &pkl->cpl_alloc, pkl->cpl_count, sizeof(cpl_t));
+
+    if (!list) {
+        return NULL;
+    }
+
+    pkl->cpl = list;
+    pkl->cpl[pkl->cpl_count] = *cpl;
+
+    return &pkl->cpl[pkl->cpl_count++];
+}
+
+/**
+free the composition of a dcp
+
+This function frees the pkls, cpls and reels added to a dcp_t structure.
+
+@param  dcp dcp_t structure
 @return NONE
 */
-void add_cpl_to_pkl(pkl_t *pkl, cpl_t cpl) {
-    memcpy(&pkl->cpl[pkl->cpl_count], &cpl, sizeof(cpl_t));
-    pkl->cpl_count++;
+void free_dcp(dcp_t *dcp) {
+    int p, c;
 
-    return;
+    for (p = 0; p < dcp->pkl_count; p++) {
+        for (c = 0; c < dcp->pkl[p].cpl_count; c++) {
+            free(dcp->pkl[p].cpl[c].reel);
+        }
+
+        free(dcp->pkl[p].cpl);
+    }
+
+    free(dcp->pkl);
+    dcp->pkl       = NULL;
+    dcp->pkl_count = 0;
+    dcp->pkl_alloc = 0;
 }
 
 int init_asset(asset_t *asset) {
@@ -651,12 +906,12 @@ int init_asset(asset_t *asset) {
     return OPENDCP_NO_ERROR;
 }
 
-void create_reel(dcp_t dcp, reel_t *reel) {
+void create_reel(const dcp_t *dcp, reel_t *reel) {
     char uuid_s[40];
 
     memset(reel, 0, sizeof(reel_t));
 
-    strcpy(reel->annotation, dcp.annotation);
+    strcpy(reel->annotation, dcp->annotation);
 
     /* Generate UUIDs */
     uuid_random(uuid_s);
@@ -728,9 +983,17 @@ int validate_reel(opendcp_t *opendcp, reel_t *reel, int reel_number) {
     return OPENDCP_NO_ERROR;
 }
 
-void add_reel_to_cpl(cpl_t *cpl, reel_t reel) {
-    memcpy(&cpl->reel[cpl->reel_count], &reel, sizeof(reel_t));
-    cpl->reel_count++;
+reel_t *add_reel_to_cpl(cpl_t *cpl, reel_t *reel) {
+    reel_t *list = grow_array(cpl->reel, &cpl->reel_alloc, cpl->reel_count, sizeof(reel_t));
+
+    if (!list) {
+        return NULL;
+    }
+
+    cpl->reel = list;
+    cpl->reel[cpl->reel_count] = *reel;
+
+    return &cpl->reel[cpl->reel_count++];
 }
 
 int add_asset(opendcp_t *opendcp, asset_t *asset, char *filename) {
@@ -0,0 +1,551 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifdef __linux__
+#define _GNU_SOURCE
+#include <sys/ioctl.h>
+#include <sys/sendfile.h>
+#include <sys/syscall.h>
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <pthread.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+#include "opendcp.h"
+#include "sha1.h"
+
+/* bytes moved between progress callbacks */
+#define COPY_CHUNK_SIZE (64 * 1024 * 1024)
+
+/* userspace copies go through a buffer of this size */
+#define COPY_BUFFER_SIZE (8 * 1024 * 1024)
+
+/* blocks read ahead of the slowest destination of a fan out copy */
+#define COPY_FANOUT_BLOCKS 8
+
+#if defined(__linux__) && !defined(FICLONE)
+#define FICLONE _IOW(0x94, 9, int)
+#endif
+
+typedef struct {
+    uint64_t          copied;
+    uint64_t          total;
+    opendcp_copy_cb_t progress;
+    void              *argument;
+} copy_state_t;
+
+static int copy_progress(copy_state_t *state, uint64_t bytes) {
+    state->copied += bytes;
+
+    if (state->progress && state->progress(state->argument, state->copied, state->total)) {
+        return OPENDCP_COPY_CANCELLED;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+#ifdef __linux__
+/* the kernel moves the data, returns OPENDCP_ERROR before the first byte when it can not */
+static int copy_kernel(int in, int out, copy_state_t *state) {
+    ssize_t n;
+    int     use_sendfile = 0;
+
+#ifndef SYS_copy_file_range
+    use_sendfile = 1;
+#endif
+
+    while (state->copied < state->total) {
+        size_t chunk = state->total - state->copied < COPY_CHUNK_SIZE ? state->total - state->copied : COPY_CHUNK_SIZE;
+
+        if (use_sendfile) {
+            n = sendfile(out, in, NULL, chunk);
+        } else {
+#ifdef SYS_copy_file_range
+            n = syscall(SYS_copy_file_range, in, NULL, out, NULL, chunk, 0);
+#else
+            n = -1;
+#endif
+        }
+
+        /* copy_file_range refuses some file system pairs, sendfile takes those */
+        if (n < 0 && !use_sendfile && state->copied == 0 &&
+            (errno == EXDEV || errno == ENOSYS || errno == EINVAL || errno == EOPNOTSUPP)) {
+            use_sendfile = 1;
+            continue;
+        }
+
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+
+        if (n <= 0) {
+            return state->copied == 0 ? OPENDCP_ERROR : OPENDCP_FILECOPY;
+        }
+
+        if (copy_progress(state, n) != OPENDCP_NO_ERROR) {
+            return OPENDCP_COPY_CANCELLED;
+        }
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+#endif
+
+/* read and write through a buffer, hashing the data on the way when asked */
+static int copy_buffered(FILE *in, FILE *out, copy_state_t *state, unsigned char *sha1) {
+    unsigned char *buffer = malloc(COPY_BUFFER_SIZE);
+    sha1_t        context;
+    size_t        n;
+    uint64_t      pending = 0;
+    int           result = OPENDCP_NO_ERROR;
+
+    if (!buffer) {
+        return OPENDCP_FILECOPY;
+    }
+
+    sha1_init(&context);
+
+    while ((n = fread(buffer, 1, COPY_BUFFER_SIZE, in)) > 0) {
+        if (fwrite(buffer, 1, n, out) != n) {
+            result = OPENDCP_FILECOPY;
+            break;
+        }
+
+        if (sha1) {
+            sha1_update(&context, buffer, n);
+        }
+
+        pending += n;
+
+        if (pending >= COPY_CHUNK_SIZE) {
+            result  = copy_progress(state, pending);
+            pending = 0;
+
+            if (result != OPENDCP_NO_ERROR) {
+                break;
+            }
+        }
+    }
+
+    if (result == OPENDCP_NO_ERROR && ferror(in)) {
+        result = OPENDCP_FILECOPY;
+    }
+
+    if (result == OPENDCP_NO_ERROR && pending) {
+        result = copy_progress(state, pending);
+    }
+
+    if (sha1) {
+        sha1_final(&context, sha1);
+    }
+
+    free(buffer);
+
+    return result;
+}
+
+#ifdef _WIN32
+static DWORD CALLBACK copy_win32_progress(LARGE_INTEGER total, LARGE_INTEGER copied, LARGE_INTEGER stream_size,
+                                          LARGE_INTEGER stream_copied, DWORD stream, DWORD reason,
+                                          HANDLE source, HANDLE destination, LPVOID data) {
+    copy_state_t *state = data;
+
+    UNUSED(stream_size);
+    UNUSED(stream_copied);
+    UNUSED(stream);
+    UNUSED(reason);
+    UNUSED(source);
+    UNUSED(destination);
+
+    state->total = total.QuadPart;
+
+    if (state->progress && state->progress(state->argument, copied.QuadPart, total.QuadPart)) {
+        return PROGRESS_CANCEL;
+    }
+
+    return PROGRESS_CONTINUE;
+}
+#endif
+
+/*!
+ @function opendcp_copy_file
+ @abstract Copies a file, letting the operating system move the data where it can.
+ @discussion Without a digest the destination is first cloned (reflink) on
+             file systems that share extents, then copied in the kernel with
+             copy_file_range or sendfile. Windows uses CopyFileEx. With a
+             digest the data is read and written through a large buffer and
+             hashed as it passes, so the copy can be checked against a
+             packing list without reading it a second time. A failed or
+             cancelled copy removes the destination.
+ @param source The file to copy.
+ @param destination The file to create or replace.
+ @param sha1 Receives the 20 byte SHA-1 of the data when not NULL.
+ @param progress Called with the bytes copied so far, non-zero cancels, may be NULL.
+ @param argument Passed to progress.
+ @return OPENDCP_NO_ERROR, OPENDCP_FILEOPEN, OPENDCP_FILECOPY or OPENDCP_COPY_CANCELLED.
+*/
+int opendcp_copy_file(const char *source, const char *destination, unsigned char *sha1,
+                      opendcp_copy_cb_t progress, void *argument) {
+    copy_state_t state;
+    struct stat  st;
+    FILE         *in, *out;
+    int          result = OPENDCP_ERROR;
+
+    if (stat(source, &st)) {
+        OPENDCP_LOG(LOG_ERROR, "could not open %s", source);
+        return OPENDCP_FILEOPEN;
+    }
+
+    memset(&state, 0, sizeof(state));
+    state.total    = st.st_size;
+    state.progress = progress;
+    state.argument = argument;
+
+#ifdef _WIN32
+    if (!sha1) {
+        BOOL cancel = FALSE;
+
+        if (CopyFileExA(source, destination, copy_win32_progress, &state, &cancel, 0)) {
+            return OPENDCP_NO_ERROR;
+        }
+
+        if (GetLastError() == ERROR_REQUEST_ABORTED) {
+            DeleteFileA(destination);
+            return OPENDCP_COPY_CANCELLED;
+        }
+
+        state.copied = 0;
+    }
+#endif
+
+    in = fopen(source, "rb");
+
+    if (!in) {
+        OPENDCP_LOG(LOG_ERROR, "could not open %s", source);
+        return OPENDCP_FILEOPEN;
+    }
+
+    out = fopen(destination, "wb");
+
+    if (!out) {
+        OPENDCP_LOG(LOG_ERROR, "could not create %s", destination);
+        fclose(in);
+        return OPENDCP_FILEOPEN;
+    }
+
+#ifdef __linux__
+    posix_fadvise(fileno(in), 0, 0, POSIX_FADV_SEQUENTIAL);
+
+    if (!sha1) {
+        if (ioctl(fileno(out), FICLONE, fileno(in)) == 0) {
+            OPENDCP_LOG(LOG_DEBUG, "cloned %s", source);
+            result = copy_progress(&state, state.total);
+        } else {
+            result = copy_kernel(fileno(in), fileno(out), &state);
+        }
+    }
+#endif
+
+    /* no fast path, or the kernel would not copy this pair of files */
+    if (result == OPENDCP_ERROR) {
+        result = copy_buffered(in, out, &state, sha1);
+    }
+
+    fclose(in);
+
+    if (fclose(out) && result == OPENDCP_NO_ERROR) {
+        result = OPENDCP_FILECOPY;
+    }
+
+    if (result != OPENDCP_NO_ERROR) {
+        if (result != OPENDCP_COPY_CANCELLED) {
+            OPENDCP_LOG(LOG_ERROR, "could not copy %s to %s", source, destination);
+        }
+
+        remove(destination);
+    }
+
+    return result;
+}
+
+typedef struct {
+    unsigned char *data;
+    size_t        length;
+    int           pending;      /* destinations that have not written the block yet */
+} fanout_block_t;
+
+typedef struct {
+    fanout_block_t  blocks[COPY_FANOUT_BLOCKS];
+    uint64_t        filled;     /* blocks read from the source */
+    int             done;       /* no more blocks will be read */
+    int             cancel;
+    pthread_mutex_t mutex;
+    pthread_cond_t  read_cond;
+    pthread_cond_t  written_cond;
+} fanout_t;
+
+typedef struct {
+    fanout_t   *fanout;
+    const char *path;
+    FILE       *fp;
+    uint64_t   next;            /* the next block to write */
+    int        result;
+    pthread_t  thread;
+} fanout_target_t;
+
+/* a destination writer, a failed destination keeps taking blocks so it never holds the others back */
+static void *copy_fanout_write(void *arg) {
+    fanout_target_t *target = arg;
+    fanout_t        *fanout = target->fanout;
+    fanout_block_t  *block;
+
+    pthread_mutex_lock(&fanout->mutex);
+
+    while (1) {
+        while (!fanout->cancel && !fanout->done && target->next >= fanout->filled) {
+            pthread_cond_wait(&fanout->read_cond, &fanout->mutex);
+        }
+
+        if (fanout->cancel || target->next >= fanout->filled) {
+            break;
+        }
+
+        block = &fanout->blocks[target->next % COPY_FANOUT_BLOCKS];
+        pthread_mutex_unlock(&fanout->mutex);
+
+        if (target->result == OPENDCP_NO_ERROR && fwrite(block->data, 1, block->length, target->fp) != block->length) {
+            OPENDCP_LOG(LOG_ERROR, "could not write %s", target->path);
+            target->result = OPENDCP_FILECOPY;
+        }
+
+        pthread_mutex_lock(&fanout->mutex);
+        target->next++;
+
+        if (--block->pending == 0) {
+            pthread_cond_broadcast(&fanout->written_cond);
+        }
+    }
+
+    pthread_mutex_unlock(&fanout->mutex);
+
+    return NULL;
+}
+
+/*!
+ @function opendcp_copy_file_fanout
+ @abstract Copies a file to several destinations, reading it once.
+ @discussion The source is read through large buffers and each destination
+             is written by a thread of its own, so slow and fast volumes are
+             written at once. At most COPY_FANOUT_BLOCKS buffers are held,
+             the reader waits for the slowest destination beyond that. The
+             data is hashed as it is read. A destination that fails is
+             removed and does not stop the others.
+ @param source The file to copy.
+ @param destinations The files to create or replace.
+ @param count The number of destinations.
+ @param results Receives the result of each destination, may be NULL.
+ @param sha1 Receives the 20 byte SHA-1 of the data when not NULL.
+ @param progress Called with the bytes read so far, non-zero cancels, may be NULL.
+ @param argument Passed to progress.
+ @return OPENDCP_NO_ERROR if every destination was written, OPENDCP_FILEOPEN
+         if the source could not be read, OPENDCP_COPY_CANCELLED, or
+         OPENDCP_FILECOPY if a destination failed, see results.
+*/
+int opendcp_copy_file_fanout(const char *source, const char **destinations, int count, int *results,
+                             unsigned char *sha1, opendcp_copy_cb_t progress, void *argument) {
+    fanout_target_t *targets;
+    fanout_block_t  *block;
+    fanout_t        fanout;
+    copy_state_t    state;
+    struct stat     st;
+    sha1_t          context;
+    FILE            *in;
+    size_t          n;
+    int             i, live = 0, result = OPENDCP_NO_ERROR;
+
+    if (stat(source, &st) || !(in = fopen(source, "rb"))) {
+        OPENDCP_LOG(LOG_ERROR, "could not open %s", source);
+        return OPENDCP_FILEOPEN;
+    }
+
+    targets = calloc(count, sizeof(fanout_target_t));
+    memset(&fanout, 0, sizeof(fanout));
+
+    for (i = 0; targets && i < COPY_FANOUT_BLOCKS; i++) {
+        if (!(fanout.blocks[i].data = malloc(COPY_BUFFER_SIZE))) {
+            result = OPENDCP_FILECOPY;
+        }
+    }
+
+    if (!targets || result != OPENDCP_NO_ERROR) {
+        for (i = 0; targets && i < COPY_FANOUT_BLOCKS; i++) {
+            free(fanout.blocks[i].data);
+        }
+
+        free(targets);
+        fclose(in);
+        return OPENDCP_FILECOPY;
+    }
+
+    memset(&state, 0, sizeof(state));
+    state.total    = st.st_size;
+    state.progress = progress;
+    state.argument = argument;
+
+    pthread_mutex_init(&fanout.mutex, NULL);
+    pthread_cond_init(&fanout.read_cond, NULL);
+    pthread_cond_init(&fanout.written_cond, NULL);
+
+#ifdef __linux__
+    posix_fadvise(fileno(in), 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+    for (i = 0; i < count; i++) {
+        targets[i].fanout = &fanout;
+        targets[i].path   = destinations[i];
+        targets[i].fp     = fopen(destinations[i], "wb");
+        targets[i].result = OPENDCP_NO_ERROR;
+
+        if (!targets[i].fp) {
+            OPENDCP_LOG(LOG_ERROR, "could not create %s", destinations[i]);
+            targets[i].result = OPENDCP_FILEOPEN;
+            continue;
+        }
+
+        /* whole buffers go straight to the file */
+        setvbuf(targets[i].fp, NULL, _IONBF, 0);
+
+        if (pthread_create(&targets[i].thread, NULL, copy_fanout_write, &targets[i])) {
+            fclose(targets[i].fp);
+            targets[i].fp     = NULL;
+            targets[i].result = OPENDCP_FILECOPY;
+            continue;
+        }
+
+        live++;
+    }
+
+    if (sha1) {
+        sha1_init(&context);
+    }
+
+    while (live) {
+        block = &fanout.blocks[fanout.filled % COPY_FANOUT_BLOCKS];
+
+        pthread_mutex_lock(&fanout.mutex);
+
+        while (block->pending) {
+            pthread_cond_wait(&fanout.written_cond, &fanout.mutex);
+        }
+
+        pthread_mutex_unlock(&fanout.mutex);
+
+        n = fread(block->data, 1, COPY_BUFFER_SIZE, in);
+
+        if (n == 0) {
+            if (ferror(in)) {
+                OPENDCP_LOG(LOG_ERROR, "could not read %s", source);
+                result = OPENDCP_FILEOPEN;
+            }
+
+            break;
+        }
+
+        if (sha1) {
+            sha1_update(&context, block->data, n);
+        }
+
+        pthread_mutex_lock(&fanout.mutex);
+        block->length  = n;
+        block->pending = live;
+        fanout.filled++;
+        pthread_cond_broadcast(&fanout.read_cond);
+        pthread_mutex_unlock(&fanout.mutex);
+
+        if (copy_progress(&state, n) != OPENDCP_NO_ERROR) {
+            result = OPENDCP_COPY_CANCELLED;
+            break;
+        }
+    }
+
+    pthread_mutex_lock(&fanout.mutex);
+    fanout.done   = 1;
+    fanout.cancel = result != OPENDCP_NO_ERROR;
+    pthread_cond_broadcast(&fanout.read_cond);
+    pthread_mutex_unlock(&fanout.mutex);
+
+    for (i = 0; i < count; i++) {
+        if (!targets[i].fp) {
+            continue;
+        }
+
+        pthread_join(targets[i].thread, NULL);
+
+        if (fclose(targets[i].fp) && targets[i].result == OPENDCP_NO_ERROR) {
+            OPENDCP_LOG(LOG_ERROR, "could not write %s", targets[i].path);
+            targets[i].result = OPENDCP_FILECOPY;
+        }
+
+        if (result != OPENDCP_NO_ERROR) {
+            targets[i].result = result;
+        }
+    }
+
+    for (i = 0; i < count; i++) {
+        if (targets[i].result != OPENDCP_NO_ERROR) {
+            if (targets[i].result != OPENDCP_FILEOPEN || targets[i].fp) {
+                remove(destinations[i]);
+            }
+
+            if (result == OPENDCP_NO_ERROR) {
+                result = OPENDCP_FILECOPY;
+            }
+        }
+
+        if (results) {
+            results[i] = targets[i].result;
+        }
+    }
+
+    if (sha1) {
+        sha1_final(&context, sha1);
+    }
+
+    pthread_cond_destroy(&fanout.written_cond);
+    pthread_cond_destroy(&fanout.read_cond);
+    pthread_mutex_destroy(&fanout.mutex);
+
+    for (i = 0; i < COPY_FANOUT_BLOCKS; i++) {
+        free(fanout.blocks[i].data);
+    }
+
+    free(targets);
+    fclose(in);
+
+    return result;
+}
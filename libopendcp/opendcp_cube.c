@@ -0,0 +1,445 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "opendcp.h"
+#include "opendcp_image.h"
+#include "sha1.h"
+#include "cpu.h"
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+/* largest lattice accepted, 256^3 entries is already 200MB */
+#define CUBE_SIZE_MAX 256
+
+/* 12-bit code values in and out */
+#define CUBE_CODE_MAX 4095
+
+/* dci companding of linear xyz, the same constants as the rgb->xyz lut */
+#define CUBE_DCI_COEFFICIENT (48.0 / 52.37)
+#define CUBE_DCI_DEGAMMA     (1 / 2.6)
+
+/*
+   The lattice is stored as three planes of 12-bit code values, red changes
+   fastest like in the file. Samples map to lattice coordinates with
+   x = v * scale + offset, which folds DOMAIN_MIN and DOMAIN_MAX in.
+*/
+struct opendcp_cube_s {
+    int   size;
+    float *plane[3];
+    float scale[3];
+    float offset[3];
+    char  digest[SHA1_BLOCK_SIZE * 2 + 1];
+};
+
+/* read three floats, returns the number read */
+static int cube_floats(const char *s, double *v) {
+    int  i;
+    char *end;
+
+    for (i = 0; i < 3; i++) {
+        v[i] = strtod(s, &end);
+
+        if (end == s) {
+            return i;
+        }
+
+        s = end;
+    }
+
+    return 3;
+}
+
+static int cube_keyword(const char *line, const char *keyword, const char **value) {
+    size_t n = strlen(keyword);
+
+    if (strncmp(line, keyword, n) || !isspace((unsigned char)line[n])) {
+        return 0;
+    }
+
+    *value = line + n;
+
+    return 1;
+}
+
+/*!
+ @function opendcp_cube_load
+ @abstract Loads a 3D LUT from a .cube file.
+ @discussion The lattice is read once and shared read-only by every thread
+     that applies it. LUT_3D_SIZE, DOMAIN_MIN, DOMAIN_MAX and
+     LUT_3D_INPUT_RANGE are supported, 1D LUTs are not. The entries are the
+     output code values in the 0 to 1 range, with compand set they are
+     linear XYZ and the DCI companding is folded into the lattice, so the
+     cube replaces the whole rgb->xyz conversion in a single lookup.
+ @param file The .cube file.
+ @param compand Non-zero when the output of the cube is linear XYZ.
+ @return The lattice or NULL.
+*/
+opendcp_cube_t *opendcp_cube_load(const char *file, int compand) {
+    opendcp_cube_t *cube;
+    FILE           *fp;
+    sha1_t         sha;
+    unsigned char  hash[SHA1_BLOCK_SIZE];
+    char           line[512];
+    const char     *value;
+    double         v[3], dmin[3] = {0, 0, 0}, dmax[3] = {1, 1, 1};
+    long           count = 0, entries = 0;
+    int            c, n = 0, result = OPENDCP_NO_ERROR;
+
+    fp = fopen(file, "r");
+
+    if (!fp) {
+        OPENDCP_LOG(LOG_ERROR, "could not open 3d lut %s", file);
+        return NULL;
+    }
+
+    cube = calloc(1, sizeof(opendcp_cube_t));
+
+    if (!cube) {
+        fclose(fp);
+        return NULL;
+    }
+
+    sha1_init(&sha);
+
+    while (result == OPENDCP_NO_ERROR && fgets(line, sizeof(line), fp)) {
+        char *s = line;
+
+        sha1_update(&sha, (byte_t *)line, strlen(line));
+
+        while (isspace((unsigned char)*s)) {
+            s++;
+        }
+
+        if (!*s || *s == '#' || cube_keyword(s, "TITLE", &value)) {
+            continue;
+        }
+
+        if (cube_keyword(s, "LUT_3D_SIZE", &value)) {
+            n = strtol(value, NULL, 10);
+
+            if (n < 2 || n > CUBE_SIZE_MAX || cube->size) {
+                OPENDCP_LOG(LOG_ERROR, "invalid LUT_3D_SIZE in %s", file);
+                result = OPENDCP_ERROR;
+                break;
+            }
+
+            entries    = (long)n * n * n;
+            cube->size = n;
+
+            for (c = 0; c < 3; c++) {
+                cube->plane[c] = malloc(entries * sizeof(float));
+
+                if (!cube->plane[c]) {
+                    OPENDCP_LOG(LOG_ERROR, "could not allocate the 3d lut of %s", file);
+                    result = OPENDCP_ERROR;
+                }
+            }
+        }
+        else if (cube_keyword(s, "DOMAIN_MIN", &value)) {
+            if (cube_floats(value, dmin) != 3) {
+                result = OPENDCP_ERROR;
+            }
+        }
+        else if (cube_keyword(s, "DOMAIN_MAX", &value)) {
+            if (cube_floats(value, dmax) != 3) {
+                result = OPENDCP_ERROR;
+            }
+        }
+        else if (cube_keyword(s, "LUT_3D_INPUT_RANGE", &value)) {
+            double range[2];
+            char   *end;
+
+            range[0] = strtod(value, &end);
+            range[1] = strtod(end, NULL);
+
+            for (c = 0; c < 3; c++) {
+                dmin[c] = range[0];
+                dmax[c] = range[1];
+            }
+        }
+        else if (cube_keyword(s, "LUT_1D_SIZE", &value)) {
+            OPENDCP_LOG(LOG_ERROR, "1d luts are not supported, %s", file);
+            result = OPENDCP_ERROR;
+        }
+        else if (isalpha((unsigned char)*s)) {
+            OPENDCP_LOG(LOG_DEBUG, "skipping 3d lut keyword %s", s);
+        }
+        else {
+            if (!cube->size || count >= entries || cube_floats(s, v) != 3) {
+                OPENDCP_LOG(LOG_ERROR, "invalid 3d lut entry in %s", file);
+                result = OPENDCP_ERROR;
+                break;
+            }
+
+            for (c = 0; c < 3; c++) {
+                double e = v[c] < 0 ? 0 : v[c];
+
+                if (compand) {
+                    e = pow(e * CUBE_DCI_COEFFICIENT, CUBE_DCI_DEGAMMA);
+                }
+
+                e = e * CUBE_CODE_MAX;
+                cube->plane[c][count] = (float)(e > CUBE_CODE_MAX ? CUBE_CODE_MAX : e);
+            }
+
+            count++;
+        }
+    }
+
+    fclose(fp);
+
+    if (result == OPENDCP_NO_ERROR && (!cube->size || count != entries)) {
+        OPENDCP_LOG(LOG_ERROR, "%s has %ld of %ld 3d lut entries", file, count, entries);
+        result = OPENDCP_ERROR;
+    }
+
+    for (c = 0; result == OPENDCP_NO_ERROR && c < 3; c++) {
+        if (dmax[c] <= dmin[c]) {
+            OPENDCP_LOG(LOG_ERROR, "invalid 3d lut domain in %s", file);
+            result = OPENDCP_ERROR;
+            break;
+        }
+
+        cube->scale[c]  = (float)((n - 1) / ((dmax[c] - dmin[c]) * CUBE_CODE_MAX));
+        cube->offset[c] = (float)(-dmin[c] * (n - 1) / (dmax[c] - dmin[c]));
+    }
+
+    if (result != OPENDCP_NO_ERROR) {
+        opendcp_cube_delete(cube);
+        return NULL;
+    }
+
+    sha1_final(&sha, hash);
+
+    for (c = 0; c < SHA1_BLOCK_SIZE; c++) {
+        sprintf(cube->digest + c * 2, "%02x", hash[c]);
+    }
+
+    OPENDCP_LOG(LOG_INFO, "loaded %dx%dx%d 3d lut %s", n, n, n, file);
+
+    return cube;
+}
+
+/*!
+ @function opendcp_cube_delete
+ @abstract Frees a lattice loaded by opendcp_cube_load.
+ @param cube The lattice, may be NULL.
+*/
+void opendcp_cube_delete(opendcp_cube_t *cube) {
+    int c;
+
+    if (!cube) {
+        return;
+    }
+
+    for (c = 0; c < 3; c++) {
+        free(cube->plane[c]);
+    }
+
+    free(cube);
+}
+
+/*!
+ @function opendcp_cube_digest
+ @abstract Returns the sha1 of the .cube file as hex.
+ @discussion Used to tell cached frames converted with another cube apart.
+ @param cube The lattice.
+ @return The digest.
+*/
+const char *opendcp_cube_digest(opendcp_cube_t *cube) {
+    return cube->digest;
+}
+
+/*
+   Tetrahedral interpolation. The fractions inside the lattice cell are
+   sorted, the cell diagonal from the origin corner through the corners of
+   the largest and the middle fraction gives the tetrahedron, and its four
+   corners are weighted with the differences of the sorted fractions. The
+   scalar and vector kernels use the same operations in the same order, so
+   they give the same result.
+*/
+static inline int cube_code(float v) {
+    int code = (int)(v + 0.5f);
+
+    return code < 0 ? 0 : (code > CUBE_CODE_MAX ? CUBE_CODE_MAX : code);
+}
+
+static void cube_apply_scalar(opendcp_cube_t *cube, opendcp_image_t *image, int start, int end) {
+    int   n  = cube->size;
+    int   nn = n * n;
+    int   i, c, base, o_max, o_min, o_a, o_b;
+    int   *p[3];
+    float x[3], f[3], hi, lo, mid, a, b, w0, w1, w2, w3;
+
+    for (c = 0; c < 3; c++) {
+        p[c] = image->component[c].data;
+    }
+
+    for (i = start; i < end; i++) {
+        base = 0;
+
+        for (c = 0; c < 3; c++) {
+            int k;
+
+            x[c] = (float)p[c][i] * cube->scale[c] + cube->offset[c];
+            x[c] = x[c] < 0 ? 0 : (x[c] > n - 1 ? (float)(n - 1) : x[c]);
+            k    = (int)x[c];
+            k    = k < n - 2 ? k : n - 2;
+            f[c] = x[c] - (float)k;
+            base += k * (c == 0 ? 1 : (c == 1 ? n : nn));
+        }
+
+        /* sort the fractions */
+        a   = f[0] > f[1] ? f[0] : f[1];
+        b   = f[0] > f[1] ? f[1] : f[0];
+        hi  = a > f[2] ? a : f[2];
+        lo  = a > f[2] ? f[2] : a;
+        mid = b > lo ? b : lo;
+        lo  = b > lo ? lo : b;
+
+        /* corner of the largest fraction, then the other two without the smallest */
+        o_max = hi == f[0] ? 1 : (hi == f[1] ? n : nn);
+        o_min = lo == f[2] ? nn : (lo == f[1] ? n : 1);
+        o_a   = base + o_max;
+        o_b   = base + 1 + n + nn - o_min;
+
+        w0 = 1.0f - hi;
+        w1 = hi - mid;
+        w2 = mid - lo;
+        w3 = lo;
+
+        for (c = 0; c < 3; c++) {
+            const float *l = cube->plane[c];
+
+            p[c][i] = cube_code(w0 * l[base] + w1 * l[o_a] + w2 * l[o_b] + w3 * l[base + 1 + n + nn]);
+        }
+    }
+}
+
+#if defined(__GNUC__) && defined(__x86_64__)
+__attribute__((target("avx2")))
+static int cube_apply_avx2(opendcp_cube_t *cube, opendcp_image_t *image, int size) {
+    int     n  = cube->size;
+    int     i, c;
+    int     *p[3];
+    __m256  zero   = _mm256_setzero_ps();
+    __m256  one    = _mm256_set1_ps(1.0f);
+    __m256  half   = _mm256_set1_ps(0.5f);
+    __m256  top    = _mm256_set1_ps((float)(n - 1));
+    __m256i last   = _mm256_set1_epi32(n - 2);
+    __m256i code   = _mm256_set1_epi32(CUBE_CODE_MAX);
+    __m256i izero  = _mm256_setzero_si256();
+    __m256i stride[3], diagonal;
+    __m256  scale[3], offset[3];
+
+    stride[0] = _mm256_set1_epi32(1);
+    stride[1] = _mm256_set1_epi32(n);
+    stride[2] = _mm256_set1_epi32(n * n);
+    diagonal  = _mm256_set1_epi32(1 + n + n * n);
+
+    for (c = 0; c < 3; c++) {
+        p[c]      = image->component[c].data;
+        scale[c]  = _mm256_set1_ps(cube->scale[c]);
+        offset[c] = _mm256_set1_ps(cube->offset[c]);
+    }
+
+    for (i = 0; i + 8 <= size; i += 8) {
+        __m256  x, f[3], a, b, hi, lo, mid, w0, w1, w2, w3, v;
+        __m256i k, base = izero, o_max, o_min, o_a, o_b, o_d;
+
+        for (c = 0; c < 3; c++) {
+            x    = _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_loadu_si256((__m256i *)(p[c] + i))), scale[c]), offset[c]);
+            x    = _mm256_min_ps(_mm256_max_ps(x, zero), top);
+            k    = _mm256_min_epi32(_mm256_cvttps_epi32(x), last);
+            f[c] = _mm256_sub_ps(x, _mm256_cvtepi32_ps(k));
+            base = _mm256_add_epi32(base, _mm256_mullo_epi32(k, stride[c]));
+        }
+
+        /* sort the fractions */
+        a   = _mm256_max_ps(f[0], f[1]);
+        b   = _mm256_min_ps(f[0], f[1]);
+        hi  = _mm256_max_ps(a, f[2]);
+        lo  = _mm256_min_ps(a, f[2]);
+        mid = _mm256_max_ps(b, lo);
+        lo  = _mm256_min_ps(b, lo);
+
+        o_max = _mm256_blendv_epi8(stride[2], stride[1], _mm256_castps_si256(_mm256_cmp_ps(hi, f[1], _CMP_EQ_OQ)));
+        o_max = _mm256_blendv_epi8(o_max, stride[0], _mm256_castps_si256(_mm256_cmp_ps(hi, f[0], _CMP_EQ_OQ)));
+        o_min = _mm256_blendv_epi8(stride[0], stride[1], _mm256_castps_si256(_mm256_cmp_ps(lo, f[1], _CMP_EQ_OQ)));
+        o_min = _mm256_blendv_epi8(o_min, stride[2], _mm256_castps_si256(_mm256_cmp_ps(lo, f[2], _CMP_EQ_OQ)));
+        o_a   = _mm256_add_epi32(base, o_max);
+        o_b   = _mm256_sub_epi32(_mm256_add_epi32(base, diagonal), o_min);
+        o_d   = _mm256_add_epi32(base, diagonal);
+
+        w0 = _mm256_sub_ps(one, hi);
+        w1 = _mm256_sub_ps(hi, mid);
+        w2 = _mm256_sub_ps(mid, lo);
+        w3 = lo;
+
+        for (c = 0; c < 3; c++) {
+            const float *l = cube->plane[c];
+
+            v = _mm256_mul_ps(w0, _mm256_i32gather_ps(l, base, 4));
+            v = _mm256_add_ps(v, _mm256_mul_ps(w1, _mm256_i32gather_ps(l, o_a, 4)));
+            v = _mm256_add_ps(v, _mm256_mul_ps(w2, _mm256_i32gather_ps(l, o_b, 4)));
+            v = _mm256_add_ps(v, _mm256_mul_ps(w3, _mm256_i32gather_ps(l, o_d, 4)));
+            k = _mm256_cvttps_epi32(_mm256_add_ps(v, half));
+            _mm256_storeu_si256((__m256i *)(p[c] + i), _mm256_min_epi32(_mm256_max_epi32(k, izero), code));
+        }
+    }
+
+    return i;
+}
+#endif
+
+/*!
+ @function opendcp_cube_apply
+ @abstract Transforms an image through a 3D LUT.
+ @discussion The image must hold 12-bit int samples, they are replaced by
+     the interpolated output of the lattice.
+ @param cube The lattice from opendcp_cube_load.
+ @param image The image.
+ @return OPENDCP_NO_ERROR or OPENDCP_ERROR.
+*/
+int opendcp_cube_apply(opendcp_cube_t *cube, opendcp_image_t *image) {
+    int size = image->w * image->h;
+    int done = 0;
+
+    if (image->sample_type != SAMPLE_TYPE_INT32 || image->n_components < 3 || image->precision > 12) {
+        OPENDCP_LOG(LOG_ERROR, "3d luts take 12-bit int images");
+        return OPENDCP_ERROR;
+    }
+
+#if defined(__GNUC__) && defined(__x86_64__)
+    if (cpu_has(CPU_AVX2)) {
+        done = cube_apply_avx2(cube, image, size);
+    }
+#endif
+
+    /* remaining pixels */
+    cube_apply_scalar(cube, image, done, size);
+
+    return OPENDCP_NO_ERROR;
+}
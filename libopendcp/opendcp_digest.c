@@ -0,0 +1,404 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include "opendcp.h"
+
+/*
+   Digest cache. Each line of dcp.digest_cache records a digest together
+   with the identity of the file it was taken from:
+
+       <digest> <size> <mtime> <device> <inode> <path>
+
+   A file is served from the cache only if every field still matches;
+   the last matching line wins, so updated digests are simply appended.
+*/
+static pthread_mutex_t digest_cache_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+typedef struct {
+    long long size;
+    long long mtime;
+    long long dev;
+    long long ino;
+} digest_identity_t;
+
+static int digest_identity(const char *filename, digest_identity_t *id) {
+    struct stat st;
+
+    if (stat(filename, &st)) {
+        return OPENDCP_ERROR;
+    }
+
+    id->size  = (long long)st.st_size;
+    id->mtime = (long long)st.st_mtime;
+    id->dev   = (long long)st.st_dev;
+    id->ino   = (long long)st.st_ino;
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* find the cached digest of a file identity, caller holds digest_cache_mutex */
+static int digest_cache_find(const char *cache, const char *filename, digest_identity_t *id, char *digest) {
+    FILE              *fp;
+    char              line[MAX_FILENAME_LENGTH + 256];
+    char              sha_buffer[64];
+    digest_identity_t entry;
+    int               offset;
+    int               found = 0;
+
+    fp = fopen(cache, "r");
+
+    if (!fp) {
+        return 0;
+    }
+
+    while (fgets(line, sizeof(line), fp)) {
+        line[strcspn(line, "\r\n")] = '\0';
+
+        if (sscanf(line, "%63s %lld %lld %lld %lld %n", sha_buffer, &entry.size, &entry.mtime,
+                   &entry.dev, &entry.ino, &offset) != 5) {
+            continue;
+        }
+
+        if (!strcmp(line + offset, filename) && !memcmp(&entry, id, sizeof(entry))) {
+            sprintf(digest, "%.36s", sha_buffer);
+            found = 1;
+        }
+    }
+
+    fclose(fp);
+
+    return found;
+}
+
+/*!
+ @function digest_cache_lookup
+ @abstract Look up the digest of a file in the digest cache.
+ @discussion The cache is only consulted if dcp.digest_cache names a file.
+     A hit requires the path, size, modification time, device and inode
+     to match the recorded entry.
+ @param opendcp The opendcp context.
+ @param filename The file to look up.
+ @param digest Receives the base64 digest on a hit.
+ @return OPENDCP_NO_ERROR on a hit, otherwise OPENDCP_ERROR.
+*/
+int digest_cache_lookup(opendcp_t *opendcp, const char *filename, char *digest) {
+    digest_identity_t id;
+    int               found;
+
+    if (!opendcp->dcp.digest_cache[0] || digest_identity(filename, &id)) {
+        return OPENDCP_ERROR;
+    }
+
+    pthread_mutex_lock(&digest_cache_mutex);
+    found = digest_cache_find(opendcp->dcp.digest_cache, filename, &id, digest);
+    pthread_mutex_unlock(&digest_cache_mutex);
+
+    if (!found) {
+        return OPENDCP_ERROR;
+    }
+
+    OPENDCP_LOG(LOG_DEBUG, "digest cache hit: %s", filename);
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*!
+ @function digest_cache_store
+ @abstract Record the digest of a file in the digest cache.
+ @discussion Nothing is written if the cached entry already holds the same
+     digest. A cached entry with a different digest for an unchanged file
+     is reported, as that means the file was modified without its size or
+     timestamp changing (or the cache was wrong); the new digest replaces it.
+ @param opendcp The opendcp context.
+ @param filename The file the digest was calculated from.
+ @param digest The base64 digest.
+ @return OPENDCP_NO_ERROR on success, otherwise OPENDCP_ERROR.
+*/
+int digest_cache_store(opendcp_t *opendcp, const char *filename, const char *digest) {
+    digest_identity_t id;
+    char              cached[64];
+    FILE              *fp;
+    int               result = OPENDCP_NO_ERROR;
+
+    if (!opendcp->dcp.digest_cache[0] || digest_identity(filename, &id)) {
+        return OPENDCP_ERROR;
+    }
+
+    pthread_mutex_lock(&digest_cache_mutex);
+
+    if (digest_cache_find(opendcp->dcp.digest_cache, filename, &id, cached)) {
+        if (!strcmp(cached, digest)) {
+            pthread_mutex_unlock(&digest_cache_mutex);
+            return OPENDCP_NO_ERROR;
+        }
+
+        OPENDCP_LOG(LOG_WARN, "digest of %s changed (cached %s, now %s)", filename, cached, digest);
+    }
+
+    fp = fopen(opendcp->dcp.digest_cache, "a");
+
+    if (fp) {
+        fprintf(fp, "%s %lld %lld %lld %lld %s\n", digest, id.size, id.mtime, id.dev, id.ino, filename);
+        fclose(fp);
+    }
+    else {
+        OPENDCP_LOG(LOG_WARN, "Could not write digest cache %s", opendcp->dcp.digest_cache);
+        result = OPENDCP_ERROR;
+    }
+
+    pthread_mutex_unlock(&digest_cache_mutex);
+
+    return result;
+}
+
+/*
+   Digest scheduler. Worker threads take the next asset whose device is
+   below its concurrency limit, so assets on different disks hash in
+   parallel while a single disk is not thrashed by too many readers. The
+   caller's sha1 callbacks are wrapped so they are only ever entered by
+   one thread at a time; a cancel from either one stops all workers.
+*/
+#define DIGEST_THREADS_DEFAULT    4
+#define DIGEST_IO_DEVICE_DEFAULT  2
+
+typedef struct {
+    asset_t *asset;
+    dev_t   dev;
+    int     claimed;
+    int     result;
+} digest_job_t;
+
+typedef struct {
+    dev_t   dev;
+    int     active;
+} digest_device_t;
+
+typedef struct {
+    opendcp_t       *opendcp;
+    digest_job_t    *jobs;
+    int             njobs;
+    digest_device_t *devices;
+    int             ndevices;
+    int             io_limit;
+    int             cancelled;
+    opendcp_cb_t    sha1_update;
+    opendcp_cb_t    sha1_done;
+    pthread_mutex_t mutex;
+    pthread_mutex_t callback_mutex;
+    pthread_cond_t  cond;
+} digest_scheduler_t;
+
+static int digest_callback(digest_scheduler_t *ds, opendcp_cb_t *cb) {
+    int cancel;
+
+    pthread_mutex_lock(&ds->callback_mutex);
+
+    if (!ds->cancelled && cb->callback && cb->callback(cb->argument)) {
+        ds->cancelled = 1;
+    }
+
+    cancel = ds->cancelled;
+    pthread_mutex_unlock(&ds->callback_mutex);
+
+    return cancel;
+}
+
+static int digest_update_cb(void *p) {
+    digest_scheduler_t *ds = p;
+
+    return digest_callback(ds, &ds->sha1_update);
+}
+
+static int digest_done_cb(void *p) {
+    digest_scheduler_t *ds = p;
+
+    return digest_callback(ds, &ds->sha1_done);
+}
+
+static digest_device_t *digest_device(digest_scheduler_t *ds, dev_t dev) {
+    int i;
+
+    for (i = 0; i < ds->ndevices; i++) {
+        if (ds->devices[i].dev == dev) {
+            return &ds->devices[i];
+        }
+    }
+
+    ds->devices[ds->ndevices].dev    = dev;
+    ds->devices[ds->ndevices].active = 0;
+
+    return &ds->devices[ds->ndevices++];
+}
+
+/* next unclaimed job on a device with a free slot, NULL when none is runnable */
+static digest_job_t *digest_next_job(digest_scheduler_t *ds, int *pending) {
+    int i;
+
+    *pending = 0;
+
+    for (i = 0; i < ds->njobs; i++) {
+        if (ds->jobs[i].claimed) {
+            continue;
+        }
+
+        *pending = 1;
+
+        if (digest_device(ds, ds->jobs[i].dev)->active < ds->io_limit) {
+            return &ds->jobs[i];
+        }
+    }
+
+    return NULL;
+}
+
+static void *digest_worker(void *arg) {
+    digest_scheduler_t *ds = arg;
+    digest_job_t       *job;
+    int                pending;
+
+    pthread_mutex_lock(&ds->mutex);
+
+    while (1) {
+        job = digest_next_job(ds, &pending);
+
+        if (ds->cancelled || !pending) {
+            break;
+        }
+
+        if (!job) {
+            pthread_cond_wait(&ds->cond, &ds->mutex);
+            continue;
+        }
+
+        job->claimed = 1;
+        digest_device(ds, job->dev)->active++;
+        pthread_mutex_unlock(&ds->mutex);
+
+        OPENDCP_LOG(LOG_DEBUG, "digest: %s", job->asset->filename);
+        job->result = calculate_digest(ds->opendcp, job->asset->filename, job->asset->digest);
+
+        pthread_mutex_lock(&ds->mutex);
+        digest_device(ds, job->dev)->active--;
+
+        if (job->result != OPENDCP_NO_ERROR) {
+            ds->cancelled = 1;
+        }
+
+        pthread_cond_broadcast(&ds->cond);
+    }
+
+    pthread_cond_broadcast(&ds->cond);
+    pthread_mutex_unlock(&ds->mutex);
+
+    return NULL;
+}
+
+/*!
+ @function calculate_digests
+ @abstract Calculate the SHA1 digest of several assets in parallel.
+ @discussion Assets are hashed on dcp.digest_threads threads (the number of
+     assets at most), with no more than dcp.digest_io_per_device of them
+     reading from the same device at once. The dcp.sha1_update and
+     dcp.sha1_done callbacks are serialized across threads; if either
+     requests a cancel, the remaining assets are skipped.
+ @param opendcp The opendcp context.
+ @param assets Assets to hash, each digest is written to the asset.
+ @param count The number of assets.
+ @return OPENDCP_NO_ERROR on success, otherwise the first failure.
+*/
+int calculate_digests(opendcp_t *opendcp, asset_t *assets[], int count) {
+    digest_scheduler_t ds;
+    pthread_t          *threads;
+    struct stat        st;
+    int                nthreads, i;
+    int                result = OPENDCP_NO_ERROR;
+
+    if (count <= 0) {
+        return OPENDCP_NO_ERROR;
+    }
+
+    memset(&ds, 0, sizeof(ds));
+    ds.opendcp  = opendcp;
+    ds.njobs    = count;
+    ds.jobs     = calloc(count, sizeof(digest_job_t));
+    ds.devices  = calloc(count, sizeof(digest_device_t));
+    ds.io_limit = opendcp->dcp.digest_io_per_device > 0 ? opendcp->dcp.digest_io_per_device : DIGEST_IO_DEVICE_DEFAULT;
+    nthreads    = opendcp->dcp.digest_threads > 0 ? opendcp->dcp.digest_threads : DIGEST_THREADS_DEFAULT;
+    nthreads    = nthreads > count ? count : nthreads;
+    threads     = malloc(nthreads * sizeof(pthread_t));
+
+    if (!ds.jobs || !ds.devices || !threads) {
+        free(ds.jobs);
+        free(ds.devices);
+        free(threads);
+        return OPENDCP_CALC_DIGEST;
+    }
+
+    for (i = 0; i < count; i++) {
+        ds.jobs[i].asset  = assets[i];
+        ds.jobs[i].result = OPENDCP_CALC_DIGEST;
+        ds.jobs[i].dev    = stat(assets[i]->filename, &st) ? 0 : st.st_dev;
+    }
+
+    /* route the callbacks through the scheduler for the duration */
+    ds.sha1_update = opendcp->dcp.sha1_update;
+    ds.sha1_done   = opendcp->dcp.sha1_done;
+    opendcp->dcp.sha1_update.callback = digest_update_cb;
+    opendcp->dcp.sha1_update.argument = &ds;
+    opendcp->dcp.sha1_done.callback   = digest_done_cb;
+    opendcp->dcp.sha1_done.argument   = &ds;
+
+    pthread_mutex_init(&ds.mutex, NULL);
+    pthread_mutex_init(&ds.callback_mutex, NULL);
+    pthread_cond_init(&ds.cond, NULL);
+
+    for (i = 0; i < nthreads; i++) {
+        pthread_create(&threads[i], NULL, digest_worker, &ds);
+    }
+
+    for (i = 0; i < nthreads; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    pthread_cond_destroy(&ds.cond);
+    pthread_mutex_destroy(&ds.callback_mutex);
+    pthread_mutex_destroy(&ds.mutex);
+
+    opendcp->dcp.sha1_update = ds.sha1_update;
+    opendcp->dcp.sha1_done   = ds.sha1_done;
+
+    for (i = 0; i < count; i++) {
+        if (ds.jobs[i].result != OPENDCP_NO_ERROR) {
+            OPENDCP_LOG(LOG_ERROR, "Could not calculate digest of %s", assets[i]->filename);
+            result = ds.jobs[i].result;
+            break;
+        }
+    }
+
+    free(threads);
+    free(ds.devices);
+    free(ds.jobs);
+
+    return result;
+}
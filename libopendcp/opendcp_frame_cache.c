@@ -0,0 +1,228 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include "opendcp.h"
+#include "opendcp_frame_cache.h"
+#include "sha1.h"
+
+#define FRAME_CACHE_READ_SIZE (1024 * 1024)
+
+/* bump when the codestream produced for the same settings changes */
+#define FRAME_CACHE_VERSION 1
+
+/*
+   Cache entries live at <cache_dir>/<first two key digits>/<key>.j2c, the
+   fan out keeps the directories small on long reels. Nothing is ever
+   evicted, the cache directory can be removed at any time.
+*/
+static void frame_cache_path(opendcp_t *opendcp, const char *key, char *path, size_t size) {
+    snprintf(path, size, "%s/%.2s/%s.j2c", opendcp->j2k.cache_dir, key, key);
+}
+
+int opendcp_frame_cache_key(opendcp_t *opendcp, const char *encoder, const char *sfile, char *key) {
+    FILE          *fp;
+    sha1_t        sha;
+    unsigned char *buffer;
+    unsigned char hash[SHA1_BLOCK_SIZE];
+    char          settings[256];
+    size_t        n;
+    int           i;
+
+    fp = fopen(sfile, "rb");
+
+    if (!fp) {
+        return OPENDCP_ERROR;
+    }
+
+    buffer = malloc(FRAME_CACHE_READ_SIZE);
+
+    if (!buffer) {
+        fclose(fp);
+        return OPENDCP_ERROR;
+    }
+
+    snprintf(settings, sizeof(settings), "%d %s %s %d %d %d %d %d %d %d %d %d %d %d %s",
+             FRAME_CACHE_VERSION, OPENDCP_VERSION, encoder, opendcp->cinema_profile, opendcp->frame_rate,
+             opendcp->stereoscopic, opendcp->j2k.bw, opendcp->j2k.rate_control, opendcp->j2k.dpx,
+             opendcp->j2k.lut, opendcp->j2k.xyz, opendcp->j2k.xyz_method, opendcp->j2k.resize,
+             opendcp->remote.xyz, opendcp->j2k.cube ? opendcp_cube_digest(opendcp->j2k.cube) : "-");
+
+    sha1_init(&sha);
+    sha1_update(&sha, (byte_t *)settings, strlen(settings) + 1);
+
+    while ((n = fread(buffer, 1, FRAME_CACHE_READ_SIZE, fp)) > 0) {
+        sha1_update(&sha, buffer, n);
+    }
+
+    i = ferror(fp);
+    fclose(fp);
+    free(buffer);
+
+    if (i) {
+        return OPENDCP_ERROR;
+    }
+
+    sha1_final(&sha, hash);
+
+    for (i = 0; i < SHA1_BLOCK_SIZE; i++) {
+        sprintf(key + i * 2, "%02x", hash[i]);
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+int opendcp_frame_cache_exists(opendcp_t *opendcp, const char *key) {
+    char        path[MAX_FILENAME_LENGTH];
+    struct stat st;
+
+    frame_cache_path(opendcp, key, path, sizeof(path));
+
+    return !stat(path, &st) && st.st_size > 0;
+}
+
+int opendcp_frame_cache_get(opendcp_t *opendcp, const char *key, unsigned char **data, int *length) {
+    FILE *fp;
+    char path[MAX_FILENAME_LENGTH];
+    long size;
+
+    frame_cache_path(opendcp, key, path, sizeof(path));
+
+    fp = fopen(path, "rb");
+
+    if (!fp) {
+        return OPENDCP_ERROR;
+    }
+
+    fseek(fp, 0, SEEK_END);
+    size = ftell(fp);
+    rewind(fp);
+
+    *data = size > 0 ? malloc(size) : NULL;
+
+    if (!*data || fread(*data, 1, size, fp) != (size_t)size) {
+        OPENDCP_LOG(LOG_ERROR, "could not read cached frame %s", path);
+        free(*data);
+        *data = NULL;
+        fclose(fp);
+        return OPENDCP_ERROR;
+    }
+
+    fclose(fp);
+    *length = size;
+
+    return OPENDCP_NO_ERROR;
+}
+
+int opendcp_frame_cache_restore(opendcp_t *opendcp, const char *key, const char *dfile) {
+    unsigned char *data;
+    FILE          *fp;
+    int           length, result = OPENDCP_NO_ERROR;
+
+    if (opendcp_frame_cache_get(opendcp, key, &data, &length) != OPENDCP_NO_ERROR) {
+        return OPENDCP_ERROR;
+    }
+
+    fp = fopen(dfile, "wb");
+
+    if (!fp || fwrite(data, 1, length, fp) != (size_t)length) {
+        OPENDCP_LOG(LOG_ERROR, "could not write JPEG2000 file %s", dfile);
+        result = OPENDCP_ERROR;
+    }
+
+    if (fp) {
+        fclose(fp);
+    }
+
+    free(data);
+
+    return result;
+}
+
+int opendcp_frame_cache_put(opendcp_t *opendcp, const char *key, const unsigned char *data, int length) {
+    char path[MAX_FILENAME_LENGTH];
+    char tmp[MAX_FILENAME_LENGTH + 64];
+    FILE *fp;
+    int  result = OPENDCP_NO_ERROR;
+
+    snprintf(path, sizeof(path), "%s/%.2s", opendcp->j2k.cache_dir, key);
+    mkdir(opendcp->j2k.cache_dir, 0777);
+    mkdir(path, 0777);
+
+    frame_cache_path(opendcp, key, path, sizeof(path));
+    snprintf(tmp, sizeof(tmp), "%s.%d.%lx.tmp", path, (int)getpid(), (unsigned long)pthread_self());
+
+    fp = fopen(tmp, "wb");
+
+    if (!fp || fwrite(data, 1, length, fp) != (size_t)length) {
+        result = OPENDCP_ERROR;
+    }
+
+    if (fp && fclose(fp)) {
+        result = OPENDCP_ERROR;
+    }
+
+    if (result == OPENDCP_NO_ERROR && rename(tmp, path)) {
+        result = OPENDCP_ERROR;
+    }
+
+    if (result != OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_WARN, "could not add frame to the cache %s", path);
+        unlink(tmp);
+    }
+
+    return result;
+}
+
+int opendcp_frame_cache_put_file(opendcp_t *opendcp, const char *key, const char *file) {
+    unsigned char *data;
+    FILE          *fp;
+    long          size;
+    int           result;
+
+    fp = fopen(file, "rb");
+
+    if (!fp) {
+        return OPENDCP_ERROR;
+    }
+
+    fseek(fp, 0, SEEK_END);
+    size = ftell(fp);
+    rewind(fp);
+
+    data = size > 0 ? malloc(size) : NULL;
+
+    if (!data || fread(data, 1, size, fp) != (size_t)size) {
+        free(data);
+        fclose(fp);
+        return OPENDCP_ERROR;
+    }
+
+    fclose(fp);
+
+    result = opendcp_frame_cache_put(opendcp, key, data, size);
+    free(data);
+
+    return result;
+}
@@ -0,0 +1,103 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _OPENDCP_FRAME_CACHE_H_
+#define _OPENDCP_FRAME_CACHE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define OPENDCP_FRAME_CACHE_KEY_LENGTH 41
+
+/*!
+ @function opendcp_frame_cache_key
+ @abstract Computes the cache key of a source frame.
+ @discussion The key is the SHA1 of the source file contents together with
+             every parameter that changes the encoded codestream, so a
+             frame is only reused when both the source and the settings
+             are unchanged.
+ @param opendcp The opendcp context.
+ @param encoder The name of the encoder.
+ @param sfile The source file.
+ @param key Receives the key, OPENDCP_FRAME_CACHE_KEY_LENGTH bytes.
+ @return OPENDCP_NO_ERROR or OPENDCP_ERROR if the source could not be read.
+*/
+int opendcp_frame_cache_key(opendcp_t *opendcp, const char *encoder, const char *sfile, char *key);
+
+/*!
+ @function opendcp_frame_cache_exists
+ @abstract Checks whether a codestream is cached under a key.
+ @param opendcp The opendcp context.
+ @param key The cache key.
+ @return 1 if the codestream is cached, 0 otherwise.
+*/
+int opendcp_frame_cache_exists(opendcp_t *opendcp, const char *key);
+
+/*!
+ @function opendcp_frame_cache_get
+ @abstract Reads a cached codestream into memory.
+ @param opendcp The opendcp context.
+ @param key The cache key.
+ @param data Receives the codestream, to be freed by the caller.
+ @param length Receives the codestream length.
+ @return OPENDCP_NO_ERROR or OPENDCP_ERROR if it is not cached.
+*/
+int opendcp_frame_cache_get(opendcp_t *opendcp, const char *key, unsigned char **data, int *length);
+
+/*!
+ @function opendcp_frame_cache_restore
+ @abstract Places a cached codestream at dfile.
+ @discussion The entry is copied rather than linked, an encoder rewriting
+             dfile in place later must not change the cache.
+ @param opendcp The opendcp context.
+ @param key The cache key.
+ @param dfile The file to create.
+ @return OPENDCP_NO_ERROR or OPENDCP_ERROR.
+*/
+int opendcp_frame_cache_restore(opendcp_t *opendcp, const char *key, const char *dfile);
+
+/*!
+ @function opendcp_frame_cache_put
+ @abstract Stores a codestream in the cache.
+ @discussion Entries are written to a temporary file and renamed into place,
+             so concurrent conversions sharing a cache never see a partial
+             entry.
+ @param opendcp The opendcp context.
+ @param key The cache key.
+ @param data The codestream.
+ @param length The codestream length.
+ @return OPENDCP_NO_ERROR or OPENDCP_ERROR.
+*/
+int opendcp_frame_cache_put(opendcp_t *opendcp, const char *key, const unsigned char *data, int length);
+
+/*!
+ @function opendcp_frame_cache_put_file
+ @abstract Stores the codestream held in a file in the cache.
+ @param opendcp The opendcp context.
+ @param key The cache key.
+ @param file The codestream file.
+ @return OPENDCP_NO_ERROR or OPENDCP_ERROR.
+*/
+int opendcp_frame_cache_put_file(opendcp_t *opendcp, const char *key, const char *file);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _OPENDCP_FRAME_CACHE_H_
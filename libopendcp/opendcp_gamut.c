@@ -0,0 +1,273 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "opendcp.h"
+#include "opendcp_image.h"
+
+/*
+   Gamut report. The xyz conversion tallies the clipping of every frame
+   into the image as it converts it (see opendcp_xyz_stats), the report
+   collects the tallies of the frames as they are conformed. No frame is
+   read again for it.
+*/
+typedef struct {
+    char                *file;
+    opendcp_xyz_stats_t stats;
+} gamut_frame_t;
+
+struct opendcp_gamut_s {
+    pthread_mutex_t mutex;
+    gamut_frame_t   *frames;
+    int             count;
+    int             alloc;
+};
+
+/*!
+ @function opendcp_gamut_create
+ @abstract Creates the gamut report of an encode.
+ @discussion Enables the clipping statistics of the xyz conversion.
+ @return The report or NULL.
+*/
+opendcp_gamut_t *opendcp_gamut_create(void) {
+    opendcp_gamut_t *gamut = calloc(1, sizeof(opendcp_gamut_t));
+
+    if (!gamut) {
+        return NULL;
+    }
+
+    pthread_mutex_init(&gamut->mutex, NULL);
+    opendcp_xyz_stats(1);
+
+    return gamut;
+}
+
+/*!
+ @function opendcp_gamut_delete
+ @abstract Frees a report created by opendcp_gamut_create.
+ @discussion Disables the clipping statistics again.
+ @param gamut The report, may be NULL.
+*/
+void opendcp_gamut_delete(opendcp_gamut_t *gamut) {
+    int i;
+
+    if (!gamut) {
+        return;
+    }
+
+    opendcp_xyz_stats(0);
+
+    for (i = 0; i < gamut->count; i++) {
+        free(gamut->frames[i].file);
+    }
+
+    pthread_mutex_destroy(&gamut->mutex);
+    free(gamut->frames);
+    free(gamut);
+}
+
+/*!
+ @function opendcp_gamut_record
+ @abstract Adds the clipping statistics of a conformed frame.
+ @discussion Safe to call from several threads at once. Frames the xyz
+             conversion did not tally are left out.
+ @param gamut The report, nothing is recorded when NULL.
+ @param file The source file, the frame's name in the report.
+ @param image The image after the xyz conversion.
+ @return OPENDCP_NO_ERROR or OPENDCP_ERROR.
+*/
+int opendcp_gamut_record(opendcp_gamut_t *gamut, const char *file, const opendcp_image_t *image) {
+    gamut_frame_t *frame;
+
+    if (!gamut || !image->xyz_stats.samples) {
+        return OPENDCP_NO_ERROR;
+    }
+
+    pthread_mutex_lock(&gamut->mutex);
+
+    if (gamut->count == gamut->alloc) {
+        int           alloc = gamut->alloc ? gamut->alloc * 2 : 256;
+        gamut_frame_t *grown = realloc(gamut->frames, alloc * sizeof(gamut_frame_t));
+
+        if (!grown) {
+            pthread_mutex_unlock(&gamut->mutex);
+            return OPENDCP_ERROR;
+        }
+
+        gamut->frames = grown;
+        gamut->alloc  = alloc;
+    }
+
+    frame        = &gamut->frames[gamut->count++];
+    frame->file  = strdup(file ? file : "");
+    frame->stats = image->xyz_stats;
+
+    pthread_mutex_unlock(&gamut->mutex);
+
+    return OPENDCP_NO_ERROR;
+}
+
+static int gamut_compare(const void *a, const void *b) {
+    return strcmp(((const gamut_frame_t *)a)->file, ((const gamut_frame_t *)b)->file);
+}
+
+/* frames are recorded as they are conformed, the report is in file order */
+static void gamut_sort(opendcp_gamut_t *gamut) {
+    qsort(gamut->frames, gamut->count, sizeof(gamut_frame_t), gamut_compare);
+}
+
+static unsigned long long gamut_clipped(const opendcp_xyz_stats_t *stats) {
+    int                c;
+    unsigned long long clipped = 0;
+
+    for (c = 0; c < 3; c++) {
+        clipped += stats->low[c] + stats->high[c];
+    }
+
+    return clipped;
+}
+
+/* statistics of the whole encode and the count of frames with clipped samples */
+static int gamut_total(opendcp_gamut_t *gamut, opendcp_xyz_stats_t *total) {
+    int i, c, clipped = 0;
+
+    memset(total, 0, sizeof(opendcp_xyz_stats_t));
+
+    for (i = 0; i < gamut->count; i++) {
+        const opendcp_xyz_stats_t *stats = &gamut->frames[i].stats;
+
+        for (c = 0; c < 3; c++) {
+            total->min[c]   = !i || stats->min[c] < total->min[c] ? stats->min[c] : total->min[c];
+            total->max[c]   = !i || stats->max[c] > total->max[c] ? stats->max[c] : total->max[c];
+            total->low[c]  += stats->low[c];
+            total->high[c] += stats->high[c];
+        }
+
+        total->samples += stats->samples;
+        clipped        += gamut_clipped(stats) > 0;
+    }
+
+    return clipped;
+}
+
+/*!
+ @function opendcp_gamut_summary
+ @abstract Logs the frames and samples that clipped at info level.
+ @param gamut The report, may be NULL.
+*/
+void opendcp_gamut_summary(opendcp_gamut_t *gamut) {
+    opendcp_xyz_stats_t total;
+    int                 frames;
+
+    if (!gamut || !gamut->count) {
+        return;
+    }
+
+    frames = gamut_total(gamut, &total);
+
+    OPENDCP_LOG(LOG_INFO, "gamut %d of %d frames clipped, x %llu below %llu over, y %llu below %llu over, z %llu below %llu over",
+                frames, gamut->count, total.low[0], total.high[0], total.low[1], total.high[1], total.low[2], total.high[2]);
+
+    if (frames) {
+        OPENDCP_LOG(LOG_WARN, "%d frames have samples outside the DCI container", frames);
+    }
+}
+
+static void gamut_json_string(FILE *fp, const char *s) {
+    fputc('"', fp);
+
+    for (; *s; s++) {
+        if (*s == '"' || *s == '\\') {
+            fprintf(fp, "\\%c", *s);
+        } else if ((unsigned char)*s < 0x20) {
+            fprintf(fp, "\\u%04x", (unsigned char)*s);
+        } else {
+            fputc(*s, fp);
+        }
+    }
+
+    fputc('"', fp);
+}
+
+static void gamut_json_stats(FILE *fp, const opendcp_xyz_stats_t *stats) {
+    static const char name[3] = { 'x', 'y', 'z' };
+    int c;
+
+    for (c = 0; c < 3; c++) {
+        fprintf(fp, "%s\"%c\": {\"min\": %d, \"max\": %d, \"below\": %llu, \"over\": %llu}",
+                c ? ", " : "", name[c], stats->min[c], stats->max[c], stats->low[c], stats->high[c]);
+    }
+}
+
+/*!
+ @function opendcp_gamut_dump
+ @abstract Writes the report as json, the totals and the statistics of every frame.
+ @param gamut The report.
+ @param file The file to write.
+ @return OPENDCP_NO_ERROR or OPENDCP_ERROR.
+*/
+int opendcp_gamut_dump(opendcp_gamut_t *gamut, const char *file) {
+    opendcp_xyz_stats_t total;
+    FILE                *fp;
+    int                 clipped, i;
+
+    if (!gamut) {
+        return OPENDCP_ERROR;
+    }
+
+    fp = fopen(file, "w");
+
+    if (!fp) {
+        OPENDCP_LOG(LOG_ERROR, "could not write gamut report to %s", file);
+        return OPENDCP_ERROR;
+    }
+
+    gamut_sort(gamut);
+    clipped = gamut_total(gamut, &total);
+
+    fprintf(fp, "{\n");
+    fprintf(fp, "    \"frames\": %d,\n", gamut->count);
+    fprintf(fp, "    \"clipped_frames\": %d,\n", clipped);
+    fprintf(fp, "    \"samples\": %llu,\n", total.samples);
+    fprintf(fp, "    \"total\": {");
+    gamut_json_stats(fp, &total);
+    fprintf(fp, "},\n");
+    fprintf(fp, "    \"per_frame\": [");
+
+    for (i = 0; i < gamut->count; i++) {
+        gamut_frame_t *frame = &gamut->frames[i];
+
+        fprintf(fp, "%s\n        {\"file\": ", i ? "," : "");
+        gamut_json_string(fp, frame->file);
+        fprintf(fp, ", \"clipped\": %llu, ", gamut_clipped(&frame->stats));
+        gamut_json_stats(fp, &frame->stats);
+        fprintf(fp, "}");
+    }
+
+    fprintf(fp, "\n    ]\n}\n");
+
+    if (fclose(fp)) {
+        OPENDCP_LOG(LOG_ERROR, "could not write gamut report to %s", file);
+        return OPENDCP_ERROR;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
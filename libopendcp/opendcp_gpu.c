@@ -0,0 +1,511 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "opendcp.h"
+#include "opendcp_image.h"
+#include "opendcp_xyz.h"
+
+#ifdef HAVE_OPENCL
+#ifdef __APPLE__
+#include <OpenCL/opencl.h>
+#else
+#include <CL/cl.h>
+#endif
+
+/*
+   GPU conform stage. The resize and the XYZ conversion of conform_image
+   run as OpenCL kernels, so the CPUs are left to the jpeg2000 encoders.
+   The kernels do the arithmetic of the CPU bands in the same order with
+   contraction off, so they give the same samples.
+
+   Each conforming thread owns a transfer queue, a compute queue, its
+   kernels and device buffers, kept until a larger frame needs more. The
+   planes of a frame are uploaded one after the other on the transfer
+   queue while the compute queue filters those already there, and a plane
+   without XYZ conversion is downloaded while the next one is filtered.
+   Several threads keep the device busy with their frames at once.
+*/
+#define GPU_PLANES 3
+
+static const char *gpu_source =
+"#pragma OPENCL FP_CONTRACT OFF\n"
+"#ifdef cl_khr_fp64\n"
+"#pragma OPENCL EXTENSION cl_khr_fp64 : enable\n"
+"#define COMPAND(v) ((float)((double)(v) * 48.0 / 52.37 * (DCI_LUT_SIZE - 1)))\n"
+"#else\n"
+"#define COMPAND(v) ((v) * (float)(48.0 / 52.37 * (DCI_LUT_SIZE - 1)))\n"
+"#endif\n"
+"\n"
+"__kernel void conform_h(__global const int *src, int stride, __global float *tmp, int w,\n"
+"                        __global const int *index, __global const float *weight, int taps) {\n"
+"    int x = get_global_id(0), y = get_global_id(1), k;\n"
+"    __global const int *row = src + (size_t)y * stride;\n"
+"    float v = 0.0f;\n"
+"\n"
+"    for (k = 0; k < taps; k++) {\n"
+"        v += (float)row[index[x * taps + k]] * weight[x * taps + k];\n"
+"    }\n"
+"\n"
+"    tmp[(size_t)y * w + x] = v;\n"
+"}\n"
+"\n"
+"__kernel void conform_v(__global const float *tmp, __global int *dst, int w,\n"
+"                        __global const int *index, __global const float *weight, int taps) {\n"
+"    int x = get_global_id(0), y = get_global_id(1), k, v;\n"
+"    float acc = 0.0f;\n"
+"\n"
+"    for (k = 0; k < taps; k++) {\n"
+"        acc += tmp[(size_t)index[y * taps + k] * w + x] * weight[y * taps + k];\n"
+"    }\n"
+"\n"
+"    v = (int)(acc + 0.5f);\n"
+"    dst[(size_t)y * w + x] = clamp(v, 0, COLOR_DEPTH);\n"
+"}\n"
+"\n"
+"int compand(float v) {\n"
+"    return clamp((int)COMPAND(v), 0, DCI_LUT_SIZE);\n"
+"}\n"
+"\n"
+"__kernel void conform_xyz(__global int *c0, __global int *c1, __global int *c2,\n"
+"                          __global const float *lut_in, __global const ushort *lut_out, __constant float *m) {\n"
+"    size_t i = get_global_id(0);\n"
+"    float  r = lut_in[clamp(c0[i], 0, COLOR_DEPTH)];\n"
+"    float  g = lut_in[clamp(c1[i], 0, COLOR_DEPTH)];\n"
+"    float  b = lut_in[clamp(c2[i], 0, COLOR_DEPTH)];\n"
+"    float  x = (r * m[0]) + (g * m[1]) + (b * m[2]);\n"
+"    float  y = (r * m[3]) + (g * m[4]) + (b * m[5]);\n"
+"    float  z = (r * m[6]) + (g * m[7]) + (b * m[8]);\n"
+"\n"
+"    c0[i] = lut_out[compand(x)];\n"
+"    c1[i] = lut_out[compand(y)];\n"
+"    c2[i] = lut_out[compand(z)];\n"
+"}\n";
+
+enum GPU_BUFFER {
+    GPU_FX_INDEX = 0,
+    GPU_FX_WEIGHT,
+    GPU_FY_INDEX,
+    GPU_FY_WEIGHT,
+    GPU_LUT_IN,
+    GPU_LUT_OUT,
+    GPU_MATRIX,
+    GPU_SRC,
+    GPU_TMP = GPU_SRC + GPU_PLANES,
+    GPU_DST = GPU_TMP + GPU_PLANES,
+    GPU_BUFFERS = GPU_DST + GPU_PLANES
+};
+
+typedef struct {
+    cl_command_queue transfer;
+    cl_command_queue compute;
+    cl_kernel        h;
+    cl_kernel        v;
+    cl_kernel        xyz;
+    cl_mem           buffer[GPU_BUFFERS];
+    size_t           size[GPU_BUFFERS];
+} gpu_context_t;
+
+static pthread_mutex_t gpu_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t  gpu_once  = PTHREAD_ONCE_INIT;
+static pthread_key_t   gpu_context_key;
+static int             gpu_enabled = 0;
+static int             gpu_ready   = 0;
+static cl_device_id    gpu_device;
+static cl_context      gpu_cl;
+static cl_program      gpu_program;
+
+static void gpu_context_free(void *arg) {
+    gpu_context_t *context = arg;
+    int i;
+
+    for (i = 0; i < GPU_BUFFERS; i++) {
+        if (context->buffer[i]) {
+            clReleaseMemObject(context->buffer[i]);
+        }
+    }
+
+    if (context->h) {
+        clReleaseKernel(context->h);
+    }
+
+    if (context->v) {
+        clReleaseKernel(context->v);
+    }
+
+    if (context->xyz) {
+        clReleaseKernel(context->xyz);
+    }
+
+    if (context->transfer) {
+        clReleaseCommandQueue(context->transfer);
+    }
+
+    if (context->compute) {
+        clReleaseCommandQueue(context->compute);
+    }
+
+    free(context);
+}
+
+static void gpu_key_init(void) {
+    pthread_key_create(&gpu_context_key, gpu_context_free);
+}
+
+/* the first gpu device of any platform, else any device, caller holds gpu_mutex */
+static int gpu_setup(void) {
+    cl_platform_id platform[8];
+    cl_uint        platforms = 0, p;
+    cl_int         err;
+    char           options[128];
+    char           name[128];
+
+    if (gpu_ready) {
+        return OPENDCP_NO_ERROR;
+    }
+
+    if (clGetPlatformIDs(8, platform, &platforms) != CL_SUCCESS || !platforms) {
+        OPENDCP_LOG(LOG_WARN, "no OpenCL platform found");
+        return OPENDCP_ERROR;
+    }
+
+    platforms = platforms > 8 ? 8 : platforms;
+
+    for (p = 0; p < platforms; p++) {
+        if (clGetDeviceIDs(platform[p], CL_DEVICE_TYPE_GPU, 1, &gpu_device, NULL) == CL_SUCCESS) {
+            break;
+        }
+    }
+
+    if (p == platforms && clGetDeviceIDs(platform[0], CL_DEVICE_TYPE_ALL, 1, &gpu_device, NULL) != CL_SUCCESS) {
+        OPENDCP_LOG(LOG_WARN, "no OpenCL device found");
+        return OPENDCP_ERROR;
+    }
+
+    gpu_cl = clCreateContext(NULL, 1, &gpu_device, NULL, NULL, &err);
+
+    if (err != CL_SUCCESS) {
+        OPENDCP_LOG(LOG_WARN, "could not create an OpenCL context");
+        return OPENDCP_ERROR;
+    }
+
+    gpu_program = clCreateProgramWithSource(gpu_cl, 1, &gpu_source, NULL, &err);
+    snprintf(options, sizeof(options), "-DCOLOR_DEPTH=%d -DDCI_LUT_SIZE=%d", COLOR_DEPTH, DCI_LUT_SIZE);
+
+    if (err != CL_SUCCESS || clBuildProgram(gpu_program, 1, &gpu_device, options, NULL, NULL) != CL_SUCCESS) {
+        OPENDCP_LOG(LOG_WARN, "could not build the OpenCL conform kernels");
+
+        if (err == CL_SUCCESS) {
+            clReleaseProgram(gpu_program);
+        }
+
+        clReleaseContext(gpu_cl);
+        return OPENDCP_ERROR;
+    }
+
+    if (clGetDeviceInfo(gpu_device, CL_DEVICE_NAME, sizeof(name), name, NULL) != CL_SUCCESS) {
+        strcpy(name, "unknown device");
+    }
+
+    OPENDCP_LOG(LOG_INFO, "conforming frames with OpenCL on %s", name);
+    gpu_ready = 1;
+
+    return OPENDCP_NO_ERROR;
+}
+
+static gpu_context_t *gpu_context(void) {
+    gpu_context_t *context;
+    cl_int        err = CL_SUCCESS;
+
+    pthread_once(&gpu_once, gpu_key_init);
+
+    context = pthread_getspecific(gpu_context_key);
+
+    if (context) {
+        return context;
+    }
+
+    context = calloc(1, sizeof(gpu_context_t));
+
+    if (!context) {
+        return NULL;
+    }
+
+    context->transfer = clCreateCommandQueue(gpu_cl, gpu_device, 0, &err);
+
+    if (err == CL_SUCCESS) {
+        context->compute = clCreateCommandQueue(gpu_cl, gpu_device, 0, &err);
+    }
+
+    if (err == CL_SUCCESS) {
+        context->h = clCreateKernel(gpu_program, "conform_h", &err);
+    }
+
+    if (err == CL_SUCCESS) {
+        context->v = clCreateKernel(gpu_program, "conform_v", &err);
+    }
+
+    if (err == CL_SUCCESS) {
+        context->xyz = clCreateKernel(gpu_program, "conform_xyz", &err);
+    }
+
+    if (err != CL_SUCCESS) {
+        OPENDCP_LOG(LOG_ERROR, "could not set up the OpenCL conform stage");
+        gpu_context_free(context);
+        return NULL;
+    }
+
+    pthread_setspecific(gpu_context_key, context);
+
+    return context;
+}
+
+/* a device buffer of at least size bytes, kept for the next frames */
+static cl_mem gpu_buffer(gpu_context_t *context, int i, size_t size) {
+    cl_int err;
+
+    if (context->buffer[i] && context->size[i] >= size) {
+        return context->buffer[i];
+    }
+
+    if (context->buffer[i]) {
+        clReleaseMemObject(context->buffer[i]);
+    }
+
+    context->buffer[i] = clCreateBuffer(gpu_cl, CL_MEM_READ_WRITE, size, NULL, &err);
+    context->size[i]   = err == CL_SUCCESS ? size : 0;
+
+    if (err != CL_SUCCESS) {
+        context->buffer[i] = NULL;
+    }
+
+    return context->buffer[i];
+}
+
+static cl_int gpu_write(gpu_context_t *context, int i, const void *data, size_t size, cl_event *event) {
+    cl_mem buffer = gpu_buffer(context, i, size);
+
+    if (!buffer) {
+        return CL_MEM_OBJECT_ALLOCATION_FAILURE;
+    }
+
+    return clEnqueueWriteBuffer(context->transfer, buffer, CL_FALSE, 0, size, data, 0, NULL, event);
+}
+
+static void gpu_events_release(cl_event *events, int n) {
+    int i;
+
+    for (i = 0; i < n; i++) {
+        if (events[i]) {
+            clReleaseEvent(events[i]);
+        }
+    }
+}
+#endif
+
+/*!
+ @function opendcp_gpu
+ @abstract Enables the GPU conform stage.
+ @discussion When enabled, conform_image resizes and color converts int
+     frames with OpenCL, and falls back to the CPU for any frame the
+     device can not take. The XYZ conversion runs on the device with the
+     LUT method only, frames of the other methods are conformed on the CPU.
+ @param enable 1 to conform on the GPU, 0 for the CPU.
+ @return OPENDCP_NO_ERROR, or OPENDCP_ERROR when no OpenCL device could be set up.
+*/
+int opendcp_gpu(int enable) {
+#ifdef HAVE_OPENCL
+    int result = OPENDCP_NO_ERROR;
+
+    pthread_mutex_lock(&gpu_mutex);
+
+    if (enable) {
+        result = gpu_setup();
+    }
+
+    gpu_enabled = enable && result == OPENDCP_NO_ERROR;
+    pthread_mutex_unlock(&gpu_mutex);
+
+    return result;
+#else
+    if (enable) {
+        OPENDCP_LOG(LOG_WARN, "OpenDCP was built without OpenCL support, frames are conformed on the CPU");
+        return OPENDCP_ERROR;
+    }
+
+    return OPENDCP_NO_ERROR;
+#endif
+}
+
+/*!
+ @function opendcp_gpu_enabled
+ @abstract Returns whether the GPU conform stage is enabled.
+ @return 1 when enabled, otherwise 0.
+*/
+int opendcp_gpu_enabled(void) {
+#ifdef HAVE_OPENCL
+    return gpu_enabled;
+#else
+    return 0;
+#endif
+}
+
+/*!
+ @function opendcp_gpu_conform
+ @abstract Resizes and color converts an int frame on the GPU.
+ @discussion Gives the samples of the conform bands of conform_image.
+ @param src The source frame, three int components.
+ @param dst The destination frame, three int components of the target size.
+ @param fx The horizontal taps, one set per destination column.
+ @param fy The vertical taps, one set per destination row.
+ @param lut_in The in gamma table of the conversion, or NULL to only resize.
+ @param lut_out The dci out gamma table.
+ @param matrix The 3x3 conversion matrix, by rows.
+ @return OPENDCP_NO_ERROR on success, OPENDCP_ERROR if the frame is to be conformed on the CPU.
+*/
+int opendcp_gpu_conform(const opendcp_image_t *src, opendcp_image_t *dst, const opendcp_gpu_filter_t *fx, const opendcp_gpu_filter_t *fy,
+                        const float *lut_in, const uint16_t *lut_out, const float *matrix) {
+#ifdef HAVE_OPENCL
+    gpu_context_t *context;
+    cl_event      tables[GPU_BUFFERS];
+    cl_event      up[GPU_PLANES], pass[GPU_PLANES], down[GPU_PLANES], xyz = NULL;
+    cl_int        err = CL_SUCCESS;
+    cl_int        w = dst->w, stride = src->component[0].stride;
+    cl_int        taps_x = fx->taps, taps_y = fy->taps;
+    size_t        src_size = (size_t)stride * src->h * sizeof(int);
+    size_t        tmp_size = (size_t)dst->w * src->h * sizeof(float);
+    size_t        dst_size = (size_t)dst->w * dst->h * sizeof(int);
+    size_t        h_size[2] = { dst->w, src->h };
+    size_t        v_size[2] = { dst->w, dst->h };
+    size_t        pixels    = (size_t)dst->w * dst->h;
+    int           c, n = 0;
+
+    if (!gpu_enabled || src->sample_type != SAMPLE_TYPE_INT32 || src->n_components < GPU_PLANES) {
+        return OPENDCP_ERROR;
+    }
+
+    context = gpu_context();
+
+    if (!context) {
+        return OPENDCP_ERROR;
+    }
+
+    memset(tables, 0, sizeof(tables));
+    memset(up, 0, sizeof(up));
+    memset(pass, 0, sizeof(pass));
+    memset(down, 0, sizeof(down));
+
+    /* the taps and tables go first, the planes stream in behind them */
+    err |= gpu_write(context, GPU_FX_INDEX,  fx->index,  (size_t)dst->w * fx->taps * sizeof(int),   &tables[n++]);
+    err |= gpu_write(context, GPU_FX_WEIGHT, fx->weight, (size_t)dst->w * fx->taps * sizeof(float), &tables[n++]);
+    err |= gpu_write(context, GPU_FY_INDEX,  fy->index,  (size_t)dst->h * fy->taps * sizeof(int),   &tables[n++]);
+    err |= gpu_write(context, GPU_FY_WEIGHT, fy->weight, (size_t)dst->h * fy->taps * sizeof(float), &tables[n++]);
+
+    if (lut_in) {
+        err |= gpu_write(context, GPU_LUT_IN,  lut_in,  (COLOR_DEPTH + 1) * sizeof(float),     &tables[n++]);
+        err |= gpu_write(context, GPU_LUT_OUT, lut_out, (DCI_LUT_SIZE + 1) * sizeof(uint16_t), &tables[n++]);
+        err |= gpu_write(context, GPU_MATRIX,  matrix,  9 * sizeof(float),                     &tables[n++]);
+    }
+
+    for (c = 0; c < GPU_PLANES && err == CL_SUCCESS; c++) {
+        err |= gpu_write(context, GPU_SRC + c, src->component[c].data, src_size, &up[c]);
+
+        if (!gpu_buffer(context, GPU_TMP + c, tmp_size) || !gpu_buffer(context, GPU_DST + c, dst_size)) {
+            err = CL_MEM_OBJECT_ALLOCATION_FAILURE;
+        }
+    }
+
+    /* each plane is filtered once it is on the device */
+    for (c = 0; c < GPU_PLANES && err == CL_SUCCESS; c++) {
+        cl_event wait[GPU_BUFFERS + 1];
+
+        memcpy(wait, tables, n * sizeof(cl_event));
+        wait[n] = up[c];
+
+        err |= clSetKernelArg(context->h, 0, sizeof(cl_mem), &context->buffer[GPU_SRC + c]);
+        err |= clSetKernelArg(context->h, 1, sizeof(cl_int), &stride);
+        err |= clSetKernelArg(context->h, 2, sizeof(cl_mem), &context->buffer[GPU_TMP + c]);
+        err |= clSetKernelArg(context->h, 3, sizeof(cl_int), &w);
+        err |= clSetKernelArg(context->h, 4, sizeof(cl_mem), &context->buffer[GPU_FX_INDEX]);
+        err |= clSetKernelArg(context->h, 5, sizeof(cl_mem), &context->buffer[GPU_FX_WEIGHT]);
+        err |= clSetKernelArg(context->h, 6, sizeof(cl_int), &taps_x);
+        err |= clEnqueueNDRangeKernel(context->compute, context->h, 2, NULL, h_size, NULL, n + 1, wait, NULL);
+
+        err |= clSetKernelArg(context->v, 0, sizeof(cl_mem), &context->buffer[GPU_TMP + c]);
+        err |= clSetKernelArg(context->v, 1, sizeof(cl_mem), &context->buffer[GPU_DST + c]);
+        err |= clSetKernelArg(context->v, 2, sizeof(cl_int), &w);
+        err |= clSetKernelArg(context->v, 3, sizeof(cl_mem), &context->buffer[GPU_FY_INDEX]);
+        err |= clSetKernelArg(context->v, 4, sizeof(cl_mem), &context->buffer[GPU_FY_WEIGHT]);
+        err |= clSetKernelArg(context->v, 5, sizeof(cl_int), &taps_y);
+        err |= clEnqueueNDRangeKernel(context->compute, context->v, 2, NULL, v_size, NULL, 0, NULL, &pass[c]);
+
+        /* without conversion a plane comes back while the next is filtered */
+        if (!lut_in && err == CL_SUCCESS) {
+            err |= clEnqueueReadBuffer(context->transfer, context->buffer[GPU_DST + c], CL_FALSE, 0, dst_size,
+                                       dst->component[c].data, 1, &pass[c], &down[c]);
+        }
+    }
+
+    if (lut_in && err == CL_SUCCESS) {
+        for (c = 0; c < GPU_PLANES; c++) {
+            err |= clSetKernelArg(context->xyz, c, sizeof(cl_mem), &context->buffer[GPU_DST + c]);
+        }
+
+        err |= clSetKernelArg(context->xyz, 3, sizeof(cl_mem), &context->buffer[GPU_LUT_IN]);
+        err |= clSetKernelArg(context->xyz, 4, sizeof(cl_mem), &context->buffer[GPU_LUT_OUT]);
+        err |= clSetKernelArg(context->xyz, 5, sizeof(cl_mem), &context->buffer[GPU_MATRIX]);
+        err |= clEnqueueNDRangeKernel(context->compute, context->xyz, 1, NULL, &pixels, NULL, 0, NULL, &xyz);
+
+        for (c = 0; c < GPU_PLANES && err == CL_SUCCESS; c++) {
+            err |= clEnqueueReadBuffer(context->transfer, context->buffer[GPU_DST + c], CL_FALSE, 0, dst_size,
+                                       dst->component[c].data, 1, &xyz, &down[c]);
+        }
+    }
+
+    /* the host planes are in use until both queues are done with them */
+    clFlush(context->compute);
+    clFinish(context->transfer);
+    clFinish(context->compute);
+
+    gpu_events_release(tables, n);
+    gpu_events_release(up, GPU_PLANES);
+    gpu_events_release(pass, GPU_PLANES);
+    gpu_events_release(down, GPU_PLANES);
+    gpu_events_release(&xyz, 1);
+
+    if (err != CL_SUCCESS) {
+        OPENDCP_LOG(LOG_WARN, "OpenCL conform failed, the frame is conformed on the CPU");
+        return OPENDCP_ERROR;
+    }
+
+    return OPENDCP_NO_ERROR;
+#else
+    UNUSED(src);
+    UNUSED(dst);
+    UNUSED(fx);
+    UNUSED(fy);
+    UNUSED(lut_in);
+    UNUSED(lut_out);
+    UNUSED(matrix);
+
+    return OPENDCP_ERROR;
+#endif
+}
@@ -21,150 +21,454 @@
 #include <string.h>
 #include <stdlib.h>
 #include <sys/stat.h>
+#include <pthread.h>
+#ifdef _WIN32
+#include <malloc.h>
+#endif
 #include "opendcp.h"
 #include "opendcp_image.h"
 #include "opendcp_xyz.h"
 #include "codecs/opendcp_decoder.h"
+#include "cpu.h"
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
 
 #define CLIP(m,max)                                 \
   (m)<0?0:((m)>max?max:(m))
 
+/* gamma and rgb to xyz matrix of each LUT_IN_ENUM input */
+static float GAMMA[5] = {
+    2.400000,    /* SRGB     */
+    2.222222,    /* REC709   */
+    2.600000,    /* P3       */
+    2.400000,    /* SRGB_COM */
+    2.222222,    /* REC709_C */
+};
+
+static float color_matrix[5][3][3] = {
+    /* SRGB */
+    {   {0.4124564, 0.3575761, 0.1804375},
+        {0.2126729, 0.7151522, 0.072175},
+        {0.0193339, 0.119192, 0.9503041}
+    },
+
+    /* REC709 */
+    {   {0.4123907993, 0.3575843394, 0.1804807884},
+        {0.2126390059, 0.7151686778, 0.0721923154},
+        {0.0193308187, 0.1191947798, 0.9505321522}
+    },
+
+    /* P3 */
+    {   {0.4451698156, 0.2771344092, 0.1722826698},
+        {0.2094916779, 0.7215952542, 0.0689130679},
+        {0.0, 0.0470605601, 0.9073553944}
+    },
+
+    /* SRGB_COMPLEX */
+    {   {0.4124564, 0.3575761, 0.1804375},
+        {0.2126729, 0.7151522, 0.072175},
+        {0.0193339, 0.119192, 0.9503041}
+    },
+
+    /* REC709_COMPLEX */
+    {   {0.4123907993, 0.3575843394, 0.1804807884},
+        {0.2126390059, 0.7151686778, 0.0721923154},
+        {0.0193308187, 0.1191947798, 0.9505321522}
+    },
+};
+
 extern int rgb_to_xyz_calculate(opendcp_image_t *image, int index);
 extern int rgb_to_xyz_lut(opendcp_image_t *image, int index);
+extern int rgb_to_xyz_fixed(opendcp_image_t *image, int index);
+static void rgb_to_xyz_rows(opendcp_image_t *image, int index, int method, int y0, int y1);
+
+/* allocate memory aligned to OPENDCP_IMAGE_ALIGN */
+static void *opendcp_image_aligned_alloc(size_t size) {
+#ifdef _WIN32
+    return _aligned_malloc(size, OPENDCP_IMAGE_ALIGN);
+#else
+    void *ptr = NULL;
+
+    if (posix_memalign(&ptr, OPENDCP_IMAGE_ALIGN, size)) {
+        return NULL;
+    }
 
-/* create opendcp image structure for int */
-opendcp_image_t *opendcp_image_create(int n_components, int w, int h) {
-    int x;
-    opendcp_image_t *image = 00;
+    return ptr;
+#endif
+}
 
-    image = (opendcp_image_t*) malloc(sizeof(opendcp_image_t));
+static void opendcp_image_aligned_free(void *ptr) {
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    free(ptr);
+#endif
+}
 
-    if (image) {
-        memset(image, 0, sizeof(opendcp_image_t));
-        image->component = (opendcp_image_component_t*) malloc(n_components * sizeof(opendcp_image_component_t));
+/* free a slab with the allocator it came from */
+static void opendcp_image_slab_free(void *slab, size_t slab_size, int pages) {
+    if (pages != HUGE_PAGES_NONE) {
+        opendcp_huge_free(slab, slab_size, pages);
+    } else {
+        opendcp_image_aligned_free(slab);
+    }
+}
 
-        if (!image->component) {
-            OPENDCP_LOG(LOG_ERROR, "unable to allocate memory for image components");
-            opendcp_image_free(image);
-            return 00;
-        }
+/* size in bytes of one sample of the given type */
+static size_t opendcp_image_sample_size(int sample_type) {
+    switch (sample_type) {
+        case SAMPLE_TYPE_UINT16:
+            return sizeof(uint16_t);
+        case SAMPLE_TYPE_FLOAT:
+            return sizeof(float);
+        default:
+            return sizeof(int);
+    }
+}
 
-        memset(image->component, 0, n_components * sizeof(opendcp_image_component_t));
+/* size of one plane rounded up to the slab alignment */
+static size_t opendcp_image_plane_size(int w, int h, int sample_type) {
+    size_t plane_size = (size_t)w * h * opendcp_image_sample_size(sample_type);
 
-        for (x = 0; x < n_components; x++) {
-            image->component[x].component_number = x;
-            image->component[x].data = (int *)malloc((w * h) * sizeof(int));
+    return (plane_size + OPENDCP_IMAGE_ALIGN - 1) & ~((size_t)OPENDCP_IMAGE_ALIGN - 1);
+}
 
-            if (!image->component[x].data) {
-                OPENDCP_LOG(LOG_ERROR, "unable to allocate memory for image components");
-                opendcp_image_free(image);
-                return NULL;
-            }
+/* point the components into the slab for the given sample type */
+static void opendcp_image_slab_layout(opendcp_image_t *image, int sample_type) {
+    int    c;
+    size_t plane_size = opendcp_image_plane_size(image->w, image->h, sample_type);
+    unsigned char *slab = image->slab;
+
+    image->sample_type = sample_type;
+    image->use_float   = (sample_type == SAMPLE_TYPE_FLOAT);
+
+    for (c = 0; c < image->n_components; c++) {
+        opendcp_image_component_t *component = &image->component[c];
+        void *plane = slab + (plane_size * c);
+
+        component->component_number = c;
+        component->data       = NULL;
+        component->data16     = NULL;
+        component->float_data = NULL;
+        component->stride     = image->w;
+
+        switch (sample_type) {
+            case SAMPLE_TYPE_UINT16:
+                component->data16 = plane;
+                break;
+            case SAMPLE_TYPE_FLOAT:
+                component->float_data = plane;
+                break;
+            default:
+                component->data = plane;
+                break;
         }
     }
+}
+
+/* allocate a single slab for all planes and point the components into it */
+static int opendcp_image_slab_alloc(opendcp_image_t *image, int sample_type) {
+    size_t slab_size;
+    void   *slab;
+    int    pages;
+
+    slab_size = opendcp_image_plane_size(image->w, image->h, sample_type) * image->n_components;
+    slab      = opendcp_huge_alloc(slab_size, &pages);
+
+    if (!slab) {
+        slab = opendcp_image_aligned_alloc(slab_size);
+    }
+
+    if (!slab) {
+        return OPENDCP_ERROR;
+    }
+
+    image->slab       = slab;
+    image->slab_size  = slab_size;
+    image->slab_pages = pages;
+    image->node      = opendcp_numa_node();
+    opendcp_image_slab_layout(image, sample_type);
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*!
+ @function opendcp_xyz_stats_reset
+ @abstract Empties the clipping statistics of an image.
+ @discussion The range starts inverted so the first sample sets it.
+ @param stats The statistics.
+*/
+void opendcp_xyz_stats_reset(opendcp_xyz_stats_t *stats) {
+    int c;
+
+    memset(stats, 0, sizeof(opendcp_xyz_stats_t));
+
+    for (c = 0; c < 3; c++) {
+        stats->min[c] = COLOR_DEPTH;
+    }
+}
 
-    /* set default image parameters 12-bit RGB integer */
-    image->bpp          = 12;
+/* set default image parameters 12-bit RGB */
+static void opendcp_image_defaults(opendcp_image_t *image, int w, int h) {
+    image->bpp          = 12; /* bit per pixel (output after transforms) */
     image->precision    = 12;
-    image->n_components = 3;
     image->signed_bit   = 0;  /* use unsigned integer */
     image->dx           = 1;
     image->dy           = 1;
     image->w            = w;  /* image width  (pixel) */
     image->h            = h;  /* image height (pixel) */
+    image->xyz_rows     = 0;
+    opendcp_xyz_stats_reset(&image->xyz_stats);
     image->x0           = 0;
     image->y0           = 0;
     image->x1 = !image->x0 ? (w - 1) * image->dx + 1 : image->x0 + (w - 1) * image->dx + 1;
     image->y1 = !image->y0 ? (h - 1) * image->dy + 1 : image->y0 + (h - 1) * image->dy + 1;
-    image->use_float    = 0;   /* use integer data */
+}
+
+/* create opendcp image structure with the given sample type, reusing a pooled image when possible */
+opendcp_image_t *opendcp_image_create_type(int n_components, int w, int h, int sample_type) {
+    opendcp_image_t *image = 00;
+    size_t slab_size = opendcp_image_plane_size(w, h, sample_type) * n_components;
+
+    image = opendcp_image_pool_get(n_components, slab_size);
+
+    if (image) {
+        opendcp_image_defaults(image, w, h);
+        opendcp_image_slab_layout(image, sample_type);
+        return image;
+    }
+
+    image = (opendcp_image_t*) malloc(sizeof(opendcp_image_t));
+
+    if (!image) {
+        OPENDCP_LOG(LOG_ERROR, "unable to allocate memory for image");
+        return 00;
+    }
+
+    memset(image, 0, sizeof(opendcp_image_t));
+    image->component = (opendcp_image_component_t*) malloc(n_components * sizeof(opendcp_image_component_t));
+
+    if (!image->component) {
+        OPENDCP_LOG(LOG_ERROR, "unable to allocate memory for image components");
+        opendcp_image_destroy(image);
+        return 00;
+    }
+
+    memset(image->component, 0, n_components * sizeof(opendcp_image_component_t));
+
+    image->n_components = n_components;
+    opendcp_image_defaults(image, w, h);
+
+    if (opendcp_image_slab_alloc(image, sample_type) != OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_ERROR, "unable to allocate memory for image components");
+        opendcp_image_destroy(image);
+        return 00;
+    }
 
     return image;
 }
 
+/* create opendcp image structure for int */
+opendcp_image_t *opendcp_image_create(int n_components, int w, int h) {
+    return opendcp_image_create_type(n_components, w, h, SAMPLE_TYPE_INT32);
+}
+
 /* create opendcp image structure for float */
-opendcp_image_t *opendcp_image_float_create(int n_components, int w, int h) {
-    int x;
-    opendcp_image_t *image = 00;
+opendcp_image_t *opendcp_image_create_float(int n_components, int w, int h) {
+    return opendcp_image_create_type(n_components, w, h, SAMPLE_TYPE_FLOAT);
+}
 
-    image = (opendcp_image_t*) malloc(sizeof(opendcp_image_t));
+/* widen a uint16 image to the int layout the encoders and color conversion read */
+int opendcp_image_to_int(opendcp_image_t *image) {
+    int    c, i, size, pages;
+    void   *slab;
+    size_t slab_size;
+    uint16_t *planes[3];
 
-    if (image) {
-        memset(image, 0, sizeof(opendcp_image_t));
-        image->component = (opendcp_image_component_t*) malloc(n_components * sizeof(opendcp_image_component_t));
+    if (image->sample_type == SAMPLE_TYPE_INT32) {
+        return OPENDCP_NO_ERROR;
+    }
 
-        if (!image->component) {
-            OPENDCP_LOG(LOG_ERROR, "unable to allocate memory for image components");
-            opendcp_image_free(image);
-            return 00;
-        }
+    if (image->sample_type != SAMPLE_TYPE_UINT16 || image->n_components > 3) {
+        return OPENDCP_ERROR;
+    }
 
-        memset(image->component, 0, n_components * sizeof(opendcp_image_component_t));
+    slab      = image->slab;
+    slab_size = image->slab_size;
+    pages     = image->slab_pages;
+    size      = image->w * image->h;
 
-        for (x = 0; x < n_components; x++) {
-            image->component[x].component_number = x;
-            image->component[x].float_data = (int *)malloc((w * h) * sizeof(int));
+    for (c = 0; c < image->n_components; c++) {
+        planes[c] = image->component[c].data16;
+    }
 
-            if (!image->component[x].float_data) {
-                OPENDCP_LOG(LOG_ERROR, "unable to allocate memory for image float components");
-                opendcp_image_free(image);
-                return NULL;
-            }
+    if (opendcp_image_slab_alloc(image, SAMPLE_TYPE_INT32) != OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_ERROR, "unable to allocate memory for image components");
+        return OPENDCP_ERROR;
+    }
+
+    for (c = 0; c < image->n_components; c++) {
+        int *d = image->component[c].data;
+
+        for (i = 0; i < size; i++) {
+            d[i] = planes[c][i];
         }
     }
 
-    /* set default image parameters 12-bit RGB integer */
-    image->bpp          = 12; /* bit per pixel (output after transforms) */
-    image->precision    = 12;
-    image->n_components = 3;
-    image->signed_bit   = 0;  /* use unsigned integer */
-    image->dx           = 1;
-    image->dy           = 1;
-    image->w            = w;  /* image width  (pixel) */
-    image->h            = h;  /* image height (pixel) */
-    image->x0           = 0;
-    image->y0           = 0;
-    image->x1 = !image->x0 ? (w - 1) * image->dx + 1 : image->x0 + (w - 1) * image->dx + 1;
-    image->y1 = !image->y0 ? (h - 1) * image->dy + 1 : image->y0 + (h - 1) * image->dy + 1;
-    image->use_float    = 1;  /* use float data */
+    opendcp_image_slab_free(slab, slab_size, pages);
 
-    return image;
+    return OPENDCP_NO_ERROR;
 }
 
-/* free open DCP image structure (int data) */
-void opendcp_image_free(opendcp_image_t *opendcp_image) {
-    int i;
+/* shift int samples kept at more than the given precision down to it */
+int opendcp_image_to_precision(opendcp_image_t *image, int precision) {
+    int c, i, size, shift;
 
-    if (opendcp_image) {
-        if (opendcp_image->component) {
-            for (i = 0; i < opendcp_image->n_components; i++) {
-                opendcp_image_component_t *component = &opendcp_image->component[i];
+    if (image->sample_type != SAMPLE_TYPE_INT32) {
+        return OPENDCP_ERROR;
+    }
 
-                if (component->data) {
-                    free(component->data);
-                }
-            }
+    shift = image->precision - precision;
 
-            free(opendcp_image->component);
+    if (shift <= 0) {
+        return OPENDCP_NO_ERROR;
+    }
+
+    size = image->w * image->h;
+
+    for (c = 0; c < image->n_components; c++) {
+        int *d = image->component[c].data;
+
+        for (i = 0; i < size; i++) {
+            d[i] >>= shift;
         }
+    }
 
-        free(opendcp_image);
+    image->precision = precision;
+    image->bpp       = precision;
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*
+   Row kernels. The sample accessors of opendcp_image.h switch on the
+   sample type for every sample, which keeps the loops that copy a frame
+   sample by sample from being vectorized. The kernels below are generated
+   once per sample type and picked once per row, so their loops are
+   straight copies or conversions.
+*/
+#define IMAGE_ROW_GET(name, field, convert)                                          \
+static void name(const opendcp_image_t *image, int c, int y, int *row) {            \
+    const opendcp_image_component_t *component = &image->component[c];              \
+    int   x, w = image->w;                                                          \
+    float scale = (float)((1 << image->precision) - 1);                             \
+                                                                                    \
+    UNUSED(scale);                                                                  \
+                                                                                    \
+    for (x = 0; x < w; x++) {                                                       \
+        row[x] = convert(component->field[x + (size_t)component->stride * y]);      \
+    }                                                                               \
+}
+
+#define IMAGE_ROW_SET(name, field, convert)                                          \
+static void name(opendcp_image_t *image, int c, int y, const int *row) {            \
+    opendcp_image_component_t *component = &image->component[c];                    \
+    int   x, w = image->w;                                                          \
+    float scale = (float)((1 << image->precision) - 1);                             \
+                                                                                    \
+    UNUSED(scale);                                                                  \
+                                                                                    \
+    for (x = 0; x < w; x++) {                                                       \
+        component->field[x + (size_t)component->stride * y] = convert(row[x]);      \
+    }                                                                               \
+}
+
+#define ROW_AS_INT(v)     (v)
+#define ROW_FROM_FLOAT(v) ((int)((v) * scale + 0.5f))
+#define ROW_TO_UINT16(v)  ((uint16_t)(v))
+#define ROW_TO_FLOAT(v)   ((float)(v) / scale)
+
+IMAGE_ROW_GET(image_get_row_int32,  data,       ROW_AS_INT)
+IMAGE_ROW_GET(image_get_row_uint16, data16,     ROW_AS_INT)
+IMAGE_ROW_GET(image_get_row_float,  float_data, ROW_FROM_FLOAT)
+IMAGE_ROW_SET(image_set_row_int32,  data,       ROW_AS_INT)
+IMAGE_ROW_SET(image_set_row_uint16, data16,     ROW_TO_UINT16)
+IMAGE_ROW_SET(image_set_row_float,  float_data, ROW_TO_FLOAT)
+
+/*!
+ @function opendcp_image_get_row
+ @abstract Reads a row of a component as int samples.
+ @discussion Gives the samples opendcp_image_get_sample would for each
+     column of the row, with the sample type resolved once for the row.
+ @param image The image.
+ @param c The component.
+ @param y The row.
+ @param row Receives image->w samples.
+*/
+void opendcp_image_get_row(const opendcp_image_t *image, int c, int y, int *row) {
+    switch (image->sample_type) {
+        case SAMPLE_TYPE_UINT16:
+            image_get_row_uint16(image, c, y, row);
+            break;
+        case SAMPLE_TYPE_FLOAT:
+            image_get_row_float(image, c, y, row);
+            break;
+        default:
+            image_get_row_int32(image, c, y, row);
+            break;
     }
 }
 
-/* free open DCP image structure (float data) */
-void opendcp_image_free_float(opendcp_image_t *opendcp_image) {
+/*!
+ @function opendcp_image_set_row
+ @abstract Writes a row of a component from int samples.
+ @discussion The row counterpart of opendcp_image_set_sample.
+ @param image The image.
+ @param c The component.
+ @param y The row.
+ @param row The image->w samples of the row.
+*/
+void opendcp_image_set_row(opendcp_image_t *image, int c, int y, const int *row) {
+    switch (image->sample_type) {
+        case SAMPLE_TYPE_UINT16:
+            image_set_row_uint16(image, c, y, row);
+            break;
+        case SAMPLE_TYPE_FLOAT:
+            image_set_row_float(image, c, y, row);
+            break;
+        default:
+            image_set_row_int32(image, c, y, row);
+            break;
+    }
+}
+
+/* release an image and its memory, bypassing the pool */
+void opendcp_image_destroy(opendcp_image_t *opendcp_image) {
     int i;
 
     if (opendcp_image) {
-        if (opendcp_image->component) {
+        if (opendcp_image->slab) {
+            opendcp_image_slab_free(opendcp_image->slab, opendcp_image->slab_size, opendcp_image->slab_pages);
+        }
+        else if (opendcp_image->component) {
             for (i = 0; i < opendcp_image->n_components; i++) {
                 opendcp_image_component_t *component = &opendcp_image->component[i];
 
+                if (component->data) {
+                    free(component->data);
+                }
+
                 if (component->float_data) {
                     free(component->float_data);
                 }
             }
+        }
 
+        if (opendcp_image->component) {
             free(opendcp_image->component);
         }
 
@@ -172,6 +476,22 @@ void opendcp_image_free_float(opendcp_image_t *opendcp_image) {
     }
 }
 
+/* free open DCP image structure, the image is returned to the pool when there is room */
+void opendcp_image_free(opendcp_image_t *opendcp_image) {
+    if (!opendcp_image) {
+        return;
+    }
+
+    if (opendcp_image_pool_put(opendcp_image) != OPENDCP_NO_ERROR) {
+        opendcp_image_destroy(opendcp_image);
+    }
+}
+
+/* free open DCP image structure (float data) */
+void opendcp_image_free_float(opendcp_image_t *opendcp_image) {
+    opendcp_image_free(opendcp_image);
+}
+
 /* open DCP image size */
 int opendcp_image_size(opendcp_image_t *opendcp_image) {
     int i, size;
@@ -179,7 +499,7 @@ int opendcp_image_size(opendcp_image_t *opendcp_image) {
     size = sizeof(opendcp_image_t);
 
     for (i = 0; i < opendcp_image->n_components; i++) {
-        size += opendcp_image->w * opendcp_image->h * sizeof(int);
+        size += opendcp_image->w * opendcp_image->h * opendcp_image_sample_size(opendcp_image->sample_type);
     }
 
     return size;
@@ -205,8 +525,9 @@ int read_image(opendcp_image_t **dimage, char *sfile) {
     /* int or float data changes with decoder */
     result  = decoder->decode(dimage, sfile);
 
+    /* the end of an input stream is not a failure */
     if (result != OPENDCP_NO_ERROR) {
-        return OPENDCP_ERROR;
+        return result == OPENDCP_STREAM_END ? result : OPENDCP_ERROR;
     }
 
     return OPENDCP_NO_ERROR;
@@ -236,42 +557,166 @@ int opendcp_image_readline(opendcp_image_t *image, int y, unsigned char *dbuffer
     return OPENDCP_NO_ERROR;
 }
 
-/* open DCP read line (float data) Need understand dbuffer before can fix this function */
+/* open DCP read line (float data), samples are quantized to 12-bit */
 int opendcp_image_readline_float(opendcp_image_t *image, int y, unsigned char *dbuffer) {
-    int x, i;
+    int x, i, c;
     int d = 0;
+    int p[2][3];
 
     for (x = 0; x < image->w; x += 2) {
         i = (x + y + 0) + ((image->w - 1) * y);
-         /* get componets for two pixels, convert to 12 bit int */
-        /* pixel 0 */
-        int pixel0_b = (int)4095*image->component[0].float_data[i];
-        int pixel0_g = (int)4095*image->component[1].float_data[i];
-        int pixel0_r = (int)4095*image->component[2].float_data[i];
-        /* pixel 1 */
-        int pixel1_b = (int)4095*image->component[0].float_data[i+1];
-        int pixel1_g = (int)4095*image->component[1].float_data[i+1];
-        int pixel1_r = (int)4095*image->component[2].float_data[i+1];
-        /* put pixel data in dbuffer */
-        dbuffer[d + 0] = pixel0_b >> 4;
-        dbuffer[d + 1] = (pixel0_b & 0x0f) << 4 ) | ((pixel0_g >> 8) & 0x0f);
-        dbuffer[d + 2] = pixel0_g;
-        dbuffer[d + 3] = pixel0_r >> 4;
-        dbuffer[d + 4] = (pixel0_r & 0x0f) << 4 ) | ((pixel1_b >> 8) & 0x0f);
-        dbuffer[d + 5] = pixel1_b;
-        dbuffer[d + 6] = (pixel1_g >> 4);
-        dbuffer[d + 7] = (pixel1_g << 4 ) | (pixel1_r >> 8) & 0x0f);
-        dbuffer[d + 8] = pixel1_r;
+
+        /* get components for two pixels, convert to 12 bit int */
+        for (c = 0; c < 3; c++) {
+            p[0][c] = CLIP((int)(image->component[c].float_data[i] * COLOR_DEPTH + 0.5f), COLOR_DEPTH);
+            p[1][c] = CLIP((int)(image->component[c].float_data[i + 1] * COLOR_DEPTH + 0.5f), COLOR_DEPTH);
+        }
+
+        dbuffer[d + 0] = (p[0][0] >> 4);
+        dbuffer[d + 1] = ((p[0][0] & 0x0f) << 4 ) | ((p[0][1] >> 8) & 0x0f);
+        dbuffer[d + 2] = p[0][1];
+        dbuffer[d + 3] = (p[0][2] >> 4);
+        dbuffer[d + 4] = ((p[0][2] & 0x0f) << 4 ) | ((p[1][0] >> 8) & 0x0f);
+        dbuffer[d + 5] = p[1][0];
+        dbuffer[d + 6] = (p[1][1] >> 4);
+        dbuffer[d + 7] = ((p[1][1] & 0x0f) << 4 ) | ((p[1][2] >> 8) & 0x0f);
+        dbuffer[d + 8] = p[1][2];
         d += 9;
     }
 
     return OPENDCP_NO_ERROR;
 }
 
-int check_image_compliance(int profile, opendcp_image_t *image, char *file) {
-    int w, h;
+/* pack interleaved 12-bit samples big endian, two samples to three bytes */
+static void image_pack_12(const int *v, int n, unsigned char *d) {
+    int i;
+
+    for (i = 0; i + 1 < n; i += 2, d += 3) {
+        d[0] = v[i] >> 4;
+        d[1] = ((v[i] & 0x0f) << 4) | ((v[i + 1] >> 8) & 0x0f);
+        d[2] = v[i + 1];
+    }
+
+    /* an odd sample pads the last byte */
+    if (i < n) {
+        d[0] = v[i] >> 4;
+        d[1] = (v[i] & 0x0f) << 4;
+    }
+}
+
+#if defined(__GNUC__) && defined(__x86_64__)
+/* interleave 8 pixels of the three components and pack them to 36 bytes */
+__attribute__((target("ssse3")))
+static int image_readrow_ssse3(opendcp_image_t *image, int i, int w, unsigned char *d) {
+    static const int8_t rgb[9][16] = {
+        {  0,  1, -1, -1, -1, -1,  2,  3, -1, -1, -1, -1,  4,  5, -1, -1 },
+        { -1, -1,  0,  1, -1, -1, -1, -1,  2,  3, -1, -1, -1, -1,  4,  5 },
+        { -1, -1, -1, -1,  0,  1, -1, -1, -1, -1,  2,  3, -1, -1, -1, -1 },
+        { -1, -1,  6,  7, -1, -1, -1, -1,  8,  9, -1, -1, -1, -1, 10, 11 },
+        { -1, -1, -1, -1,  6,  7, -1, -1, -1, -1,  8,  9, -1, -1, -1, -1 },
+        {  4,  5, -1, -1, -1, -1,  6,  7, -1, -1, -1, -1,  8,  9, -1, -1 },
+        { -1, -1, -1, -1, 12, 13, -1, -1, -1, -1, 14, 15, -1, -1, -1, -1 },
+        { 10, 11, -1, -1, -1, -1, 12, 13, -1, -1, -1, -1, 14, 15, -1, -1 },
+        { -1, -1, 10, 11, -1, -1, -1, -1, 12, 13, -1, -1, -1, -1, 14, 15 },
+    };
+    const __m128i pack  = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    const __m128i mask  = _mm_set1_epi32(0xfff);
+    const __m128i shift = _mm_set1_epi32(0x00011000);
+    __m128i c[3], o;
+    int     x, k, v;
+
+    for (x = 0; x + 8 <= w; x += 8, d += 36) {
+        for (k = 0; k < 3; k++) {
+            const int *s = image->component[k].data + i + x;
+            c[k] = _mm_packs_epi32(_mm_and_si128(_mm_loadu_si128((const __m128i *)s), mask),
+                                   _mm_and_si128(_mm_loadu_si128((const __m128i *)(s + 4)), mask));
+        }
+
+        for (v = 0; v < 3; v++) {
+            o = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(c[0], _mm_loadu_si128((const __m128i *)rgb[v * 3])),
+                                          _mm_shuffle_epi8(c[1], _mm_loadu_si128((const __m128i *)rgb[v * 3 + 1]))),
+                             _mm_shuffle_epi8(c[2], _mm_loadu_si128((const __m128i *)rgb[v * 3 + 2])));
+
+            /* two 12-bit samples to a 24-bit value, then its bytes big endian */
+            o = _mm_shuffle_epi8(_mm_madd_epi16(o, shift), pack);
+            _mm_storel_epi64((__m128i *)(d + v * 12), o);
+            k = _mm_cvtsi128_si32(_mm_srli_si128(o, 8));
+            memcpy(d + v * 12 + 8, &k, 4);
+        }
+    }
+
+    return x;
+}
+#endif
+
+/*!
+ @function opendcp_image_readrows
+ @abstract Packs rows of an image to interleaved 12-bit RGB.
+ @discussion This is the layout of opendcp_image_readline, a row takes
+     (w * 36 + 7) / 8 bytes and rows follow each other, so a strip of a
+     12-bit contiguous tiff is filled in one call.
+ @param image An int image with 12-bit samples.
+ @param y The first row.
+ @param rows The number of rows.
+ @param dbuffer The packed rows.
+ @return OPENDCP_NO_ERROR
+*/
+int opendcp_image_readrows(opendcp_image_t *image, int y, int rows, unsigned char *dbuffer) {
+    size_t stride = ((size_t)image->w * 36 + 7) / 8;
+    int    tail[6];
+    int    r, x, i, k, n;
+
+    for (r = 0; r < rows; r++, dbuffer += stride) {
+        i = (y + r) * image->w;
+        x = 0;
+
+#if defined(__GNUC__) && defined(__x86_64__)
+        if (cpu_has(CPU_SSSE3)) {
+            x = image_readrow_ssse3(image, i, image->w, dbuffer);
+        }
+#endif
+
+        /* remaining pixels, two at a time */
+        for (; x < image->w; x += 2) {
+            n = x + 1 < image->w ? 6 : 3;
+            for (k = 0; k < n; k++) {
+                tail[k] = image->component[k % 3].data[i + x + k / 3];
+            }
+            image_pack_12(tail, n, dbuffer + (size_t)x * 36 / 8);
+        }
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* the reason an image size does not fit the container, NULL if it does */
+static const char *image_compliance(int profile, int w, int h) {
     int dci_w = MAX_WIDTH_2K;
     int dci_h = MAX_HEIGHT_2K;
+
+    if (profile == DCP_CINEMA4K) {
+        dci_w = dci_w *2;
+        dci_h = dci_h *2;
+    }
+
+    if ((w != dci_w) && (h != dci_h)) {
+        return "image does not match at least one dimension of the DCI container";
+    }
+
+    if ((w > dci_w) || (h > dci_h)) {
+        return "image dimension exceeds DCI container";
+    }
+
+    if ((w % 2) || (h % 2)) {
+        return "image dimensions are not an even value";
+    }
+
+    return NULL;
+}
+
+int check_image_compliance(int profile, opendcp_image_t *image, char *file) {
+    int w, h;
+    const char *reason;
     opendcp_image_t *tmp;
 
     if (image == NULL) {
@@ -292,23 +737,10 @@ int check_image_compliance(int profile, opendcp_image_t *image, char *file) {
         w = image->w;
     }
 
-    if (profile == DCP_CINEMA4K) {
-        dci_w = dci_w *2;
-        dci_h = dci_h *2;
-    }
-
-    if ((w != dci_w) && (h != dci_h)) {
-        OPENDCP_LOG(LOG_WARN, "image does not match at least one dimension of the DCI container");
-        return OPENDCP_ERROR;
-    }
-
-    if ((w > dci_w) || (h > dci_h)) {
-        OPENDCP_LOG(LOG_WARN, "image dimension exceeds DCI container");
-        return OPENDCP_ERROR;
-    }
+    reason = image_compliance(profile, w, h);
 
-    if ((w % 2) || (h % 2)) {
-        OPENDCP_LOG(LOG_WARN, "image dimensions are not an even value");
+    if (reason) {
+        OPENDCP_LOG(LOG_WARN, "%s", reason);
         return OPENDCP_ERROR;
     }
 
@@ -337,6 +769,99 @@ rgb_pixel_float_t yuv444toRGB888_float(float y, float cb, float cr) {
     return(p);
 }
 
+/*
+   Batched YCbCr to RGB, full range with the coefficients of yuv444toRGB888().
+   The components hold Y, Cb and Cr at full resolution and are replaced by
+   R, G and B of the same bit depth. The math is done in double precision
+   and truncated through a float like yuv444toRGB888(), so both kernels give
+   its result exactly.
+*/
+static void ycbcr_to_rgb_scalar(opendcp_image_t *image, int start, int end, int bits) {
+    int   *y  = image->component[0].data;
+    int   *cb = image->component[1].data;
+    int   *cr = image->component[2].data;
+    int   half = 1 << (bits - 1);
+    int   max  = (1 << bits) - 1;
+    int   i;
+    float r, g, b;
+
+    for (i = start; i < end; i++) {
+        r = CLIP(y[i] + 1.402 * (cr[i] - half), max);
+        g = CLIP(y[i] - 0.344 * (cb[i] - half) - 0.714 * (cr[i] - half), max);
+        b = CLIP(y[i] + 1.772 * (cb[i] - half), max);
+
+        y[i]  = (int)r;
+        cb[i] = (int)g;
+        cr[i] = (int)b;
+    }
+}
+
+#if defined(__GNUC__) && defined(__x86_64__)
+__attribute__((target("avx2")))
+static int ycbcr_to_rgb_avx2(opendcp_image_t *image, int start, int end, int bits) {
+    int     *y  = image->component[0].data;
+    int     *cb = image->component[1].data;
+    int     *cr = image->component[2].data;
+    int     i;
+    __m128i half = _mm_set1_epi32(1 << (bits - 1));
+    __m256d max  = _mm256_set1_pd((1 << bits) - 1);
+    __m256d zero = _mm256_setzero_pd();
+    __m256d k_rv = _mm256_set1_pd(1.402);
+    __m256d k_gu = _mm256_set1_pd(0.344);
+    __m256d k_gv = _mm256_set1_pd(0.714);
+    __m256d k_bu = _mm256_set1_pd(1.772);
+
+    for (i = start; i + 4 <= end; i += 4) {
+        __m256d vy = _mm256_cvtepi32_pd(_mm_loadu_si128((__m128i *)(y + i)));
+        __m256d vu = _mm256_cvtepi32_pd(_mm_sub_epi32(_mm_loadu_si128((__m128i *)(cb + i)), half));
+        __m256d vv = _mm256_cvtepi32_pd(_mm_sub_epi32(_mm_loadu_si128((__m128i *)(cr + i)), half));
+        __m256d r, g, b;
+
+        r = _mm256_add_pd(vy, _mm256_mul_pd(k_rv, vv));
+        g = _mm256_sub_pd(_mm256_sub_pd(vy, _mm256_mul_pd(k_gu, vu)), _mm256_mul_pd(k_gv, vv));
+        b = _mm256_add_pd(vy, _mm256_mul_pd(k_bu, vu));
+
+        /* clip, then truncate through a float */
+        r = _mm256_min_pd(_mm256_max_pd(r, zero), max);
+        g = _mm256_min_pd(_mm256_max_pd(g, zero), max);
+        b = _mm256_min_pd(_mm256_max_pd(b, zero), max);
+
+        _mm_storeu_si128((__m128i *)(y + i),  _mm_cvttps_epi32(_mm256_cvtpd_ps(r)));
+        _mm_storeu_si128((__m128i *)(cb + i), _mm_cvttps_epi32(_mm256_cvtpd_ps(g)));
+        _mm_storeu_si128((__m128i *)(cr + i), _mm_cvttps_epi32(_mm256_cvtpd_ps(b)));
+    }
+
+    return i;
+}
+#endif
+
+/*!
+ @function ycbcr_to_rgb
+ @abstract Converts pixels of an image from YCbCr to RGB in place.
+ @discussion The decoders unpack Y, Cb and Cr into the three components,
+     with the chroma already upsampled to every pixel, and convert whole
+     rows at a time.
+ @param image An int image holding Y, Cb and Cr.
+ @param start The first pixel to convert.
+ @param end The pixel after the last pixel to convert.
+ @param bits The bit depth of the samples, the output has the same depth.
+ @return OPENDCP_NO_ERROR
+*/
+int ycbcr_to_rgb(opendcp_image_t *image, int start, int end, int bits) {
+    int done = start;
+
+#if defined(__GNUC__) && defined(__x86_64__)
+    if (cpu_has(CPU_AVX2)) {
+        done = ycbcr_to_rgb_avx2(image, start, end, bits);
+    }
+#endif
+
+    /* remaining pixels */
+    ycbcr_to_rgb_scalar(image, done, end, bits);
+
+    return OPENDCP_NO_ERROR;
+}
+
 /* complex gamma function */
 float complex_gamma(float p, float gamma, int index) {
     float v;
@@ -383,8 +908,8 @@ int dci_transfer(float p) {
     return v;
 }
 
-/* dci transfer (floatt data) */
-float dci_transfer(float p) {
+/* dci transfer (float data) */
+float dci_transfer_float(float p) {
     float v;
 
     v = pow((p * DCI_COEFFICENT), DCI_DEGAMMA);
@@ -402,19 +927,42 @@ int dci_transfer_inverse(float p) {
 }
 
 /* dci transfer inverse (float data) */
-float dci_transfer_inverse(float p) {
+float dci_transfer_inverse_float(float p) {
 
     return (pow(p, 1 / DCI_GAMMA));
 }
 
+/* rows of a band of a whole frame conversion with statistics */
+#define XYZ_STATS_ROWS 32
+
 /* rbg to xyz (int data) */
 int rgb_to_xyz(opendcp_image_t *image, int index, int method) {
-    int result;
+    int result, y;
+
+    /* with statistics the frame is converted in bands, each tallied while in cache */
+    if (opendcp_xyz_stats_enabled() && !image->use_float && image->sample_type == SAMPLE_TYPE_INT32 && image->n_components >= 3) {
+        if (method == XYZ_METHOD_CALCULATE) {
+            opendcp_image_to_precision(image, 12);
+        }
+
+        for (y = 0; y < image->h; y += XYZ_STATS_ROWS) {
+            rgb_to_xyz_rows(image, index, method, y, y + XYZ_STATS_ROWS < image->h ? y + XYZ_STATS_ROWS : image->h);
+        }
 
-    if (method) {
+        image->precision = 12;
+        image->bpp       = 12;
+
+        return OPENDCP_NO_ERROR;
+    }
+
+    if (method == XYZ_METHOD_CALCULATE) {
         OPENDCP_LOG(LOG_DEBUG, "rgb_to_xyz_calculate, index: %d", index);
         result = rgb_to_xyz_calculate(image, index);
     }
+    else if (method == XYZ_METHOD_FIXED) {
+        OPENDCP_LOG(LOG_DEBUG, "rgb_to_xyz_fixed, index: %d", index);
+        result = rgb_to_xyz_fixed(image, index);
+    }
     else {
         OPENDCP_LOG(LOG_DEBUG, "rgb_to_xyz_lut, index: %d", index);
         result = rgb_to_xyz_lut(image, index);
@@ -423,128 +971,1776 @@ int rgb_to_xyz(opendcp_image_t *image, int index, int method) {
     return result;
 }
 
-/* rbg to xyz (float data) */
-float rgb_to_xyz_float(opendcp_image_t *image, int index) {
-    int result;
-
-    OPENDCP_LOG(LOG_DEBUG, "rgb_to_xyz_calculate_float, index: %d", index);
-    result = rgb_to_xyz_calculate_float(image, index);
-
-    return result;
+/*
+   The lut tables are built the first time a profile is converted, only the
+   in gamma of the profiles in use is generated. lut_in is rounded to the 6
+   decimals the tables generated by scripts/make_lut.py had, so the output
+   is unchanged. The out gamma fits 16 bits and has a spare entry, so the
+   32-bit gathers of the vector kernels stay inside the table.
+*/
+static pthread_mutex_t xyz_lut_mutex = PTHREAD_MUTEX_INITIALIZER;
+static int      lut_in_init[LI_MAX];
+static int      lut_out_init;
+static float    lut_in[LI_MAX][COLOR_DEPTH + 1];
+static uint16_t lut_out[DCI_LUT_SIZE + 1];
+static uint32_t lut_fixed_in[LI_MAX][COLOR_DEPTH + 1];
+static uint32_t lut_fixed_matrix[LI_MAX][3][3];
+static uint32_t lut_fixed_near[LI_MAX][3];
+
+/* in gamma of code value i */
+static double lut_in_gamma(int index, int i) {
+    double p = (double)i / COLOR_DEPTH;
+
+    switch (index) {
+        case LI_SRGB:
+            return pow(p, 2.4);
+        case LI_REC709:
+            return pow(p, 1 / 0.45);
+        case LI_P3:
+            return pow(p, DCI_GAMMA);
+        case LI_SRGB_COMPLEX:
+            return p > 0.04045 ? pow((p + 0.055) / 1.055, 2.4) : p / 12.92;
+        default:
+            return p > 0.08125 ? pow((p + 0.099) / 1.099, 1 / 0.45) : p / 4.50;
+    }
 }
 
-/* rgb to xyz color conversion 12-bit LUT (only for int data) */
-int rgb_to_xyz_lut(opendcp_image_t *image, int index) {
+static void xyz_lut_fixed_init(int index);
+
+static void xyz_lut_init(int index) {
     int i;
-    int size;
-    rgb_pixel_float_t s;
-    xyz_pixel_float_t d;
 
-    size = image->w * image->h;
+    pthread_mutex_lock(&xyz_lut_mutex);
 
-    for (i = 0; i < size; i++) {
-        /* in gamma lut */
-        s.r = lut_in[index][image->component[0].data[i]];
-        s.g = lut_in[index][image->component[1].data[i]];
-        s.b = lut_in[index][image->component[2].data[i]];
+    if (!lut_out_init) {
+        OPENDCP_LOG(LOG_DEBUG, "building dci out gamma table");
 
-        /* RGB to XYZ Matrix */
-        d.x = ((s.r * color_matrix[index][0][0]) + (s.g * color_matrix[index][0][1]) + (s.b * color_matrix[index][0][2]));
-        d.y = ((s.r * color_matrix[index][1][0]) + (s.g * color_matrix[index][1][1]) + (s.b * color_matrix[index][1][2]));
-        d.z = ((s.r * color_matrix[index][2][0]) + (s.g * color_matrix[index][2][1]) + (s.b * color_matrix[index][2][2]));
+        for (i = 0; i < DCI_LUT_SIZE; i++) {
+            lut_out[i] = (uint16_t)(pow(i / (DCI_LUT_SIZE - 1.0), DCI_DEGAMMA) * COLOR_DEPTH);
+        }
+
+        lut_out[DCI_LUT_SIZE] = lut_out[DCI_LUT_SIZE - 1];
+        lut_out_init = 1;
+    }
 
-        /* DCI Companding */
-        d.x = d.x * DCI_COEFFICENT * (DCI_LUT_SIZE - 1);
-        d.y = d.y * DCI_COEFFICENT * (DCI_LUT_SIZE - 1);
-        d.z = d.z * DCI_COEFFICENT * (DCI_LUT_SIZE - 1);
+    if (!lut_in_init[index]) {
+        OPENDCP_LOG(LOG_DEBUG, "building in gamma table, index: %d", index);
 
-        /* out gamma lut */
-        image->component[0].data[i] = lut_out[LO_DCI][(int)d.x];
-        image->component[1].data[i] = lut_out[LO_DCI][(int)d.y];
-        image->component[2].data[i] = lut_out[LO_DCI][(int)d.z];
+        for (i = 0; i <= COLOR_DEPTH; i++) {
+            lut_in[index][i] = (float)(nearbyint(lut_in_gamma(index, i) * 1e6) / 1e6);
+        }
+
+        xyz_lut_fixed_init(index);
+        lut_in_init[index] = 1;
     }
 
-    return OPENDCP_NO_ERROR;
+    pthread_mutex_unlock(&xyz_lut_mutex);
 }
 
-/* rgb to xyz color conversion hard calculations (int data) */
-int rgb_to_xyz_calculate(opendcp_image_t *image, int index) {
+/* matrix, companding and out gamma lut of pixel i */
+static inline void rgb_to_xyz_lut_store(opendcp_image_t *image, int index, int i, rgb_pixel_float_t s) {
+    xyz_pixel_float_t d;
+
+    /* RGB to XYZ Matrix */
+    d.x = ((s.r * color_matrix[index][0][0]) + (s.g * color_matrix[index][0][1]) + (s.b * color_matrix[index][0][2]));
+    d.y = ((s.r * color_matrix[index][1][0]) + (s.g * color_matrix[index][1][1]) + (s.b * color_matrix[index][1][2]));
+    d.z = ((s.r * color_matrix[index][2][0]) + (s.g * color_matrix[index][2][1]) + (s.b * color_matrix[index][2][2]));
+
+    /* DCI Companding */
+    d.x = d.x * DCI_COEFFICENT * (DCI_LUT_SIZE - 1);
+    d.y = d.y * DCI_COEFFICENT * (DCI_LUT_SIZE - 1);
+    d.z = d.z * DCI_COEFFICENT * (DCI_LUT_SIZE - 1);
+
+    /* out gamma lut */
+    image->component[0].data[i] = lut_out[(int)d.x];
+    image->component[1].data[i] = lut_out[(int)d.y];
+    image->component[2].data[i] = lut_out[(int)d.z];
+}
+
+/* rgb to xyz color conversion 12-bit LUT, scalar kernel for pixels [start, end) */
+static void rgb_to_xyz_lut_scalar(opendcp_image_t *image, int index, int start, int end) {
+    int i;
+    rgb_pixel_float_t s;
+
+    for (i = start; i < end; i++) {
+        /* in gamma lut */
+        s.r = lut_in[index][image->component[0].data[i]];
+        s.g = lut_in[index][image->component[1].data[i]];
+        s.b = lut_in[index][image->component[2].data[i]];
+
+        rgb_to_xyz_lut_store(image, index, i, s);
+    }
+}
+
+/*
+   Sources with more than 12 bits keep their precision through the in gamma
+   lut: the sample is scaled to a position between two of the 4096 entries
+   and the entries are interpolated linearly. The last interval is clamped
+   so a full scale sample lands on the last entry.
+*/
+static inline float lut_in_interpolate(const float *lut, int v, int in_max, float scale) {
+    float pos;
+    int   i;
+
+    v   = v < 0 ? 0 : (v > in_max ? in_max : v);
+    pos = (float)v * scale;
+    i   = (int)pos;
+    i   = i < COLOR_DEPTH - 1 ? i : COLOR_DEPTH - 1;
+
+    return lut[i] + (lut[i + 1] - lut[i]) * (pos - (float)i);
+}
+
+/* rgb to xyz color conversion interpolated LUT, scalar kernel for pixels [start, end) */
+static void rgb_to_xyz_lut_interpolate_scalar(opendcp_image_t *image, int index, int start, int end) {
+    int   i;
+    int   in_max = (1 << image->precision) - 1;
+    float scale  = (float)COLOR_DEPTH / in_max;
+    rgb_pixel_float_t s;
+
+    for (i = start; i < end; i++) {
+        s.r = lut_in_interpolate(lut_in[index], image->component[0].data[i], in_max, scale);
+        s.g = lut_in_interpolate(lut_in[index], image->component[1].data[i], in_max, scale);
+        s.b = lut_in_interpolate(lut_in[index], image->component[2].data[i], in_max, scale);
+
+        rgb_to_xyz_lut_store(image, index, i, s);
+    }
+}
+
+/*
+   The vector kernels below are bit-exact with rgb_to_xyz_lut_scalar(). The
+   matrix is evaluated in single precision in the same order as the scalar
+   code and the companding step is done in double precision, just like the
+   scalar expression which is promoted by the double DCI_COEFFICENT. Indexes
+   are clamped to the table sizes, which only matters for out of range input.
+   The file is built with -ffp-contract=off so neither path is fused.
+*/
+#if defined(__GNUC__) && defined(__x86_64__)
+
+/* companding of 4 floats in double precision, rounded back to float */
+#define XYZ_COMPAND_SSE(v) \
+    _mm_cvtpd_ps(_mm_mul_pd(_mm_div_pd(_mm_mul_pd(_mm_cvtps_pd(v), c0), c1), c2))
+
+__attribute__((target("sse4.1")))
+static int rgb_to_xyz_lut_sse41(opendcp_image_t *image, int index, int size) {
+    int   i, k;
+    int   *r = image->component[0].data;
+    int   *g = image->component[1].data;
+    int   *b = image->component[2].data;
+    float *lut = lut_in[index];
+    uint16_t *out = lut_out;
+    int   idx[3][4];
+    __m128  m[3][3];
+    __m128d c0 = _mm_set1_pd(48.0);
+    __m128d c1 = _mm_set1_pd(52.37);
+    __m128d c2 = _mm_set1_pd(DCI_LUT_SIZE - 1);
+    __m128i in_max  = _mm_set1_epi32(COLOR_DEPTH);
+    __m128i out_max = _mm_set1_epi32(DCI_LUT_SIZE - 1);
+    __m128i zero = _mm_setzero_si128();
+
+    for (i = 0; i < 3; i++) {
+        for (k = 0; k < 3; k++) {
+            m[i][k] = _mm_set1_ps(color_matrix[index][i][k]);
+        }
+    }
+
+    for (i = 0; i + 4 <= size; i += 4) {
+        __m128i vr = _mm_min_epi32(_mm_max_epi32(_mm_loadu_si128((__m128i *)(r + i)), zero), in_max);
+        __m128i vg = _mm_min_epi32(_mm_max_epi32(_mm_loadu_si128((__m128i *)(g + i)), zero), in_max);
+        __m128i vb = _mm_min_epi32(_mm_max_epi32(_mm_loadu_si128((__m128i *)(b + i)), zero), in_max);
+        __m128 sr, sg, sb, d[3], lo, hi;
+
+        _mm_storeu_si128((__m128i *)idx[0], vr);
+        _mm_storeu_si128((__m128i *)idx[1], vg);
+        _mm_storeu_si128((__m128i *)idx[2], vb);
+
+        /* in gamma lut */
+        sr = _mm_setr_ps(lut[idx[0][0]], lut[idx[0][1]], lut[idx[0][2]], lut[idx[0][3]]);
+        sg = _mm_setr_ps(lut[idx[1][0]], lut[idx[1][1]], lut[idx[1][2]], lut[idx[1][3]]);
+        sb = _mm_setr_ps(lut[idx[2][0]], lut[idx[2][1]], lut[idx[2][2]], lut[idx[2][3]]);
+
+        for (k = 0; k < 3; k++) {
+            /* RGB to XYZ Matrix */
+            d[k] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(sr, m[k][0]), _mm_mul_ps(sg, m[k][1])), _mm_mul_ps(sb, m[k][2]));
+
+            /* DCI Companding */
+            lo = XYZ_COMPAND_SSE(d[k]);
+            hi = XYZ_COMPAND_SSE(_mm_movehl_ps(d[k], d[k]));
+            d[k] = _mm_movelh_ps(lo, hi);
+
+            _mm_storeu_si128((__m128i *)idx[k], _mm_min_epi32(_mm_max_epi32(_mm_cvttps_epi32(d[k]), zero), out_max));
+        }
+
+        /* out gamma lut */
+        for (k = 0; k < 4; k++) {
+            r[i + k] = out[idx[0][k]];
+            g[i + k] = out[idx[1][k]];
+            b[i + k] = out[idx[2][k]];
+        }
+    }
+
+    return i;
+}
+
+/* companding of 8 floats in double precision, rounded back to float */
+#define XYZ_COMPAND_AVX(v) \
+    _mm256_cvtpd_ps(_mm256_mul_pd(_mm256_div_pd(_mm256_mul_pd(_mm256_cvtps_pd(v), c0), c1), c2))
+
+/* with interpolate set the samples have image->precision bits, see lut_in_interpolate() */
+__attribute__((target("avx2")))
+static int rgb_to_xyz_lut_avx2(opendcp_image_t *image, int index, int size, int interpolate) {
+    int   i, k;
+    int   *p[3];
+    float *lut = lut_in[index];
+    uint16_t *out = lut_out;
+    int   max = interpolate ? (1 << image->precision) - 1 : COLOR_DEPTH;
+    __m256  m[3][3];
+    __m256d c0 = _mm256_set1_pd(48.0);
+    __m256d c1 = _mm256_set1_pd(52.37);
+    __m256d c2 = _mm256_set1_pd(DCI_LUT_SIZE - 1);
+    __m256i in_max  = _mm256_set1_epi32(max);
+    __m256i out_max = _mm256_set1_epi32(DCI_LUT_SIZE - 1);
+    __m256i last    = _mm256_set1_epi32(COLOR_DEPTH - 1);
+    __m256  scale   = _mm256_set1_ps((float)COLOR_DEPTH / max);
+    __m256i low16   = _mm256_set1_epi32(0xFFFF);
+    __m256i zero = _mm256_setzero_si256();
+
+    for (k = 0; k < 3; k++) {
+        p[k] = image->component[k].data;
+    }
+
+    for (i = 0; i < 3; i++) {
+        for (k = 0; k < 3; k++) {
+            m[i][k] = _mm256_set1_ps(color_matrix[index][i][k]);
+        }
+    }
+
+    for (i = 0; i + 8 <= size; i += 8) {
+        __m256 s[3], d;
+        __m128 lo, hi;
+        __m256i v;
+
+        /* in gamma lut */
+        for (k = 0; k < 3; k++) {
+            v = _mm256_min_epi32(_mm256_max_epi32(_mm256_loadu_si256((__m256i *)(p[k] + i)), zero), in_max);
+
+            if (interpolate) {
+                __m256 pos = _mm256_mul_ps(_mm256_cvtepi32_ps(v), scale);
+                __m256 a, b;
+
+                v    = _mm256_min_epi32(_mm256_cvttps_epi32(pos), last);
+                a    = _mm256_i32gather_ps(lut, v, 4);
+                b    = _mm256_i32gather_ps(lut + 1, v, 4);
+                s[k] = _mm256_add_ps(a, _mm256_mul_ps(_mm256_sub_ps(b, a), _mm256_sub_ps(pos, _mm256_cvtepi32_ps(v))));
+            }
+            else {
+                s[k] = _mm256_i32gather_ps(lut, v, 4);
+            }
+        }
+
+        for (k = 0; k < 3; k++) {
+            /* RGB to XYZ Matrix */
+            d = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(s[0], m[k][0]), _mm256_mul_ps(s[1], m[k][1])), _mm256_mul_ps(s[2], m[k][2]));
+
+            /* DCI Companding */
+            lo = XYZ_COMPAND_AVX(_mm256_castps256_ps128(d));
+            hi = XYZ_COMPAND_AVX(_mm256_extractf128_ps(d, 1));
+            d  = _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1);
+
+            /* out gamma lut */
+            v = _mm256_min_epi32(_mm256_max_epi32(_mm256_cvttps_epi32(d), zero), out_max);
+            _mm256_storeu_si256((__m256i *)(p[k] + i), _mm256_and_si256(_mm256_i32gather_epi32((const int *)out, v, 2), low16));
+        }
+    }
+
+    return i;
+}
+
+#elif defined(__aarch64__)
+
+static int rgb_to_xyz_lut_neon(opendcp_image_t *image, int index, int size) {
+    int   i, k;
+    int   *p[3];
+    float *lut = lut_in[index];
+    uint16_t *out = lut_out;
+    int32_t idx[4];
+    float32x4_t m[3][3];
+    float64x2_t c0 = vdupq_n_f64(48.0);
+    float64x2_t c1 = vdupq_n_f64(52.37);
+    float64x2_t c2 = vdupq_n_f64(DCI_LUT_SIZE - 1);
+    int32x4_t in_max  = vdupq_n_s32(COLOR_DEPTH);
+    int32x4_t out_max = vdupq_n_s32(DCI_LUT_SIZE - 1);
+    int32x4_t zero = vdupq_n_s32(0);
+
+    for (k = 0; k < 3; k++) {
+        p[k] = image->component[k].data;
+    }
+
+    for (i = 0; i < 3; i++) {
+        for (k = 0; k < 3; k++) {
+            m[i][k] = vdupq_n_f32(color_matrix[index][i][k]);
+        }
+    }
+
+    for (i = 0; i + 4 <= size; i += 4) {
+        float32x4_t s[3], d[3];
+        float64x2_t lo, hi;
+        float tmp[4];
+        int j;
+
+        /* in gamma lut */
+        for (k = 0; k < 3; k++) {
+            vst1q_s32(idx, vminq_s32(vmaxq_s32(vld1q_s32(p[k] + i), zero), in_max));
+
+            for (j = 0; j < 4; j++) {
+                tmp[j] = lut[idx[j]];
+            }
+
+            s[k] = vld1q_f32(tmp);
+        }
+
+        for (k = 0; k < 3; k++) {
+            /* RGB to XYZ Matrix */
+            d[k] = vaddq_f32(vaddq_f32(vmulq_f32(s[0], m[k][0]), vmulq_f32(s[1], m[k][1])), vmulq_f32(s[2], m[k][2]));
+
+            /* DCI Companding */
+            lo = vmulq_f64(vdivq_f64(vmulq_f64(vcvt_f64_f32(vget_low_f32(d[k])), c0), c1), c2);
+            hi = vmulq_f64(vdivq_f64(vmulq_f64(vcvt_high_f64_f32(d[k]), c0), c1), c2);
+            d[k] = vcvt_high_f32_f64(vcvt_f32_f64(lo), hi);
+
+            /* out gamma lut */
+            vst1q_s32(idx, vminq_s32(vmaxq_s32(vcvtq_s32_f32(d[k]), zero), out_max));
+
+            for (j = 0; j < 4; j++) {
+                p[k][i + j] = out[idx[j]];
+            }
+        }
+    }
+
+    return i;
+}
+
+#endif
+
+/* rgb to xyz color conversion 12-bit LUT (only for int data), up to 16-bit samples are interpolated */
+int rgb_to_xyz_lut(opendcp_image_t *image, int index) {
+    int size;
+    int done = 0;
+
+    size = image->w * image->h;
+
+    xyz_lut_init(index);
+
+    if (image->precision > 12) {
+#if defined(__GNUC__) && defined(__x86_64__)
+        if (cpu_has(CPU_AVX2)) {
+            done = rgb_to_xyz_lut_avx2(image, index, size, 1);
+        }
+#endif
+        rgb_to_xyz_lut_interpolate_scalar(image, index, done, size);
+
+        image->precision = 12;
+        image->bpp       = 12;
+
+        return OPENDCP_NO_ERROR;
+    }
+
+#if defined(__GNUC__) && defined(__x86_64__)
+
+    if (cpu_has(CPU_AVX2)) {
+        done = rgb_to_xyz_lut_avx2(image, index, size, 0);
+    }
+    else if (cpu_has(CPU_SSE41)) {
+        done = rgb_to_xyz_lut_sse41(image, index, size);
+    }
+
+#elif defined(__aarch64__)
+    if (cpu_has(CPU_NEON)) {
+        done = rgb_to_xyz_lut_neon(image, index, size);
+    }
+#endif
+
+    /* remaining pixels */
+    rgb_to_xyz_lut_scalar(image, index, done, size);
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*
+   The lut method in fixed point. The in gamma lut holds linear light in
+   Q30, and the matrix, with the companding and the scale of the out gamma
+   lut folded in, holds coefficients in Q2. A sample is split into its top
+   14 bits and the 14 bits below, so every product and their sum fit 32
+   bits, and the sum is the out gamma lut index in Q16. That index is off
+   from the float one by little where it counts: below index 256 one
+   index is worth more than a code value, so a dark pixel whose index is
+   within the error bound of its matrix row of a whole one is redone with
+   the float matrix. Elsewhere a truncation either way is a code value at
+   most.
+*/
+#define XYZ_FIXED_LIN    30              /* fractional bits of lut_fixed_in */
+#define XYZ_FIXED_MATRIX 2               /* fractional bits of lut_fixed_matrix */
+#define XYZ_FIXED_SPLIT  14              /* bits of each part of a sample */
+#define XYZ_FIXED_INDEX  16              /* fractional bits of the sum */
+#define XYZ_FIXED_DARK   (256 << XYZ_FIXED_INDEX)
+
+/* caller holds xyz_lut_mutex, lut_in of the index is built */
+static void xyz_lut_fixed_init(int index) {
+    int i, k;
+
+    for (i = 0; i <= COLOR_DEPTH; i++) {
+        lut_fixed_in[index][i] = (uint32_t)llround((double)lut_in[index][i] * (1 << XYZ_FIXED_LIN));
+    }
+
+    for (i = 0; i < 3; i++) {
+        /* the truncated bits of lut_fixed_in and the products, and the float rounding of the float matrix */
+        double bound = 3 * (65536.0 / (1 << (2 * XYZ_FIXED_SPLIT)) + 1.0 / (1 << XYZ_FIXED_INDEX)) + 5e-5;
+
+        for (k = 0; k < 3; k++) {
+            double coefficient = color_matrix[index][i][k] * (DCI_COEFFICENT) * (DCI_LUT_SIZE - 1);
+
+            lut_fixed_matrix[index][i][k] = (uint32_t)llround(coefficient * (1 << XYZ_FIXED_MATRIX));
+
+            /* the rounding of a coefficient, times the most linear light a dark index leaves its sample */
+            if (coefficient > 0) {
+                bound += fabs(lut_fixed_matrix[index][i][k] / (double)(1 << XYZ_FIXED_MATRIX) - coefficient) *
+                         (coefficient > 256 ? 256 / coefficient : 1);
+            }
+        }
+
+        lut_fixed_near[index][i] = (uint32_t)ceil(bound * (1 << XYZ_FIXED_INDEX));
+    }
+}
+
+/* sum of one matrix row in Q16 */
+static inline uint32_t xyz_fixed_row(const uint32_t *m, const uint32_t *hi, const uint32_t *lo) {
+    return m[0] * hi[0] + ((m[0] * lo[0]) >> XYZ_FIXED_SPLIT) +
+           m[1] * hi[1] + ((m[1] * lo[1]) >> XYZ_FIXED_SPLIT) +
+           m[2] * hi[2] + ((m[2] * lo[2]) >> XYZ_FIXED_SPLIT);
+}
+
+/* the out gamma lut value of a row sum, dark sums near a whole index are redone in float */
+static inline int xyz_fixed_out(int index, int k, uint32_t sum, const int *v) {
+    uint32_t near = lut_fixed_near[index][k];
+
+    if (sum < XYZ_FIXED_DARK && ((sum + near) & ((1 << XYZ_FIXED_INDEX) - 1)) < 2 * near) {
+        float d = (lut_in[index][v[0]] * color_matrix[index][k][0]) + (lut_in[index][v[1]] * color_matrix[index][k][1]) +
+                  (lut_in[index][v[2]] * color_matrix[index][k][2]);
+
+        /* rounded to float before the truncation, as rgb_to_xyz_lut_store does */
+        d = d * DCI_COEFFICENT * (DCI_LUT_SIZE - 1);
+
+        return lut_out[(int)d];
+    }
+
+    return lut_out[sum >> XYZ_FIXED_INDEX];
+}
+
+/* rgb to xyz color conversion fixed point, scalar kernel for pixels [start, end) */
+static void rgb_to_xyz_fixed_scalar(opendcp_image_t *image, int index, int start, int end) {
+    int      i, c;
+    int      v[3];
+    uint32_t hi[3], lo[3], sum[3];
+    int      *p[3];
+
+    for (c = 0; c < 3; c++) {
+        p[c] = image->component[c].data;
+    }
+
+    for (i = start; i < end; i++) {
+        for (c = 0; c < 3; c++) {
+            uint32_t l;
+
+            v[c]  = CLIP(p[c][i], COLOR_DEPTH);
+            l     = lut_fixed_in[index][v[c]];
+            hi[c] = l >> (XYZ_FIXED_LIN - XYZ_FIXED_SPLIT);
+            lo[c] = (l >> (XYZ_FIXED_LIN - 2 * XYZ_FIXED_SPLIT)) & ((1 << XYZ_FIXED_SPLIT) - 1);
+        }
+
+        for (c = 0; c < 3; c++) {
+            sum[c] = xyz_fixed_row(lut_fixed_matrix[index][c], hi, lo);
+        }
+
+        for (c = 0; c < 3; c++) {
+            p[c][i] = xyz_fixed_out(index, c, sum[c], v);
+        }
+    }
+}
+
+#if defined(__GNUC__) && defined(__x86_64__)
+
+/* 8 pixels per step on 32-bit lanes, lanes that need the float matrix go through xyz_fixed_out */
+__attribute__((target("avx2")))
+static int rgb_to_xyz_fixed_avx2(opendcp_image_t *image, int index, int size) {
+    int      i, c, k, j;
+    int      *p[3];
+    int      v[3][8];
+    uint32_t sums[8];
+    __m256i  m[3][3];
+    __m256i  in_max  = _mm256_set1_epi32(COLOR_DEPTH);
+    __m256i  zero    = _mm256_setzero_si256();
+    __m256i  split   = _mm256_set1_epi32((1 << XYZ_FIXED_SPLIT) - 1);
+    __m256i  frac    = _mm256_set1_epi32((1 << XYZ_FIXED_INDEX) - 1);
+    __m256i  low16   = _mm256_set1_epi32(0xFFFF);
+    __m256i  near[3], window[3];
+
+    for (c = 0; c < 3; c++) {
+        p[c] = image->component[c].data;
+    }
+
+    for (c = 0; c < 3; c++) {
+        for (k = 0; k < 3; k++) {
+            m[c][k] = _mm256_set1_epi32((int)lut_fixed_matrix[index][c][k]);
+        }
+
+        near[c]   = _mm256_set1_epi32((int)lut_fixed_near[index][c]);
+        window[c] = _mm256_set1_epi32((int)(2 * lut_fixed_near[index][c]));
+    }
+
+    for (i = 0; i + 8 <= size; i += 8) {
+        __m256i vin[3], hi[3], lo[3], sum[3];
+
+        /* in gamma lut */
+        for (c = 0; c < 3; c++) {
+            __m256i l;
+
+            vin[c] = _mm256_min_epi32(_mm256_max_epi32(_mm256_loadu_si256((__m256i *)(p[c] + i)), zero), in_max);
+            l      = _mm256_i32gather_epi32((const int *)lut_fixed_in[index], vin[c], 4);
+            hi[c]  = _mm256_srli_epi32(l, XYZ_FIXED_LIN - XYZ_FIXED_SPLIT);
+            lo[c]  = _mm256_and_si256(_mm256_srli_epi32(l, XYZ_FIXED_LIN - 2 * XYZ_FIXED_SPLIT), split);
+        }
+
+        /* matrix, companding and scale */
+        for (c = 0; c < 3; c++) {
+            sum[c] = zero;
+
+            for (k = 0; k < 3; k++) {
+                sum[c] = _mm256_add_epi32(sum[c], _mm256_mullo_epi32(m[c][k], hi[k]));
+                sum[c] = _mm256_add_epi32(sum[c], _mm256_srli_epi32(_mm256_mullo_epi32(m[c][k], lo[k]), XYZ_FIXED_SPLIT));
+            }
+        }
+
+        for (c = 0; c < 3; c++) {
+            /* dark lanes near a whole index, the sum is below XYZ_FIXED_DARK when its top 8 bits are clear */
+            __m256i dark = _mm256_cmpeq_epi32(_mm256_srli_epi32(sum[c], 24), zero);
+            __m256i edge = _mm256_cmpgt_epi32(window[c], _mm256_and_si256(_mm256_add_epi32(sum[c], near[c]), frac));
+            int     redo = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_and_si256(dark, edge)));
+
+            if (redo) {
+                for (k = 0; k < 3; k++) {
+                    _mm256_storeu_si256((__m256i *)v[k], vin[k]);
+                }
+
+                _mm256_storeu_si256((__m256i *)sums, sum[c]);
+            }
+
+            /* out gamma lut */
+            sum[c] = _mm256_and_si256(_mm256_i32gather_epi32((const int *)lut_out, _mm256_srli_epi32(sum[c], XYZ_FIXED_INDEX), 2), low16);
+
+            if (redo) {
+                int out[8];
+
+                _mm256_storeu_si256((__m256i *)out, sum[c]);
+
+                for (j = 0; j < 8; j++) {
+                    if (redo & (1 << j)) {
+                        int px[3] = { v[0][j], v[1][j], v[2][j] };
+
+                        out[j] = xyz_fixed_out(index, c, sums[j], px);
+                    }
+                }
+
+                sum[c] = _mm256_loadu_si256((__m256i *)out);
+            }
+        }
+
+        for (c = 0; c < 3; c++) {
+            _mm256_storeu_si256((__m256i *)(p[c] + i), sum[c]);
+        }
+    }
+
+    return i;
+}
+
+#endif
+
+/* rgb to xyz color conversion in fixed point (only for int data), sources over 12 bits take the interpolated LUT */
+int rgb_to_xyz_fixed(opendcp_image_t *image, int index) {
+    int size = image->w * image->h;
+    int done = 0;
+
+    if (image->precision > 12) {
+        return rgb_to_xyz_lut(image, index);
+    }
+
+    xyz_lut_init(index);
+
+#if defined(__GNUC__) && defined(__x86_64__)
+    if (cpu_has(CPU_AVX2)) {
+        done = rgb_to_xyz_fixed_avx2(image, index, size);
+    }
+#endif
+
+    rgb_to_xyz_fixed_scalar(image, index, done, size);
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*
+   The inverse of rgb_to_xyz_lut, for reviewing DCP pictures. The DCI out
+   gamma is undone exactly for every 12-bit code value and the matrix is
+   inverted. The in gamma of the profile is inverted by searching the same
+   lut_in table the forward conversion uses, at the resolution of the out
+   gamma table. A round trip is as good as the 16-bit linear step of that
+   table allows, a few code values except in the darkest shadows of the
+   power law profiles.
+*/
+static int      lut_rgb_init[LI_MAX];
+static float    lut_rgb_in[COLOR_DEPTH + 1];
+static uint16_t lut_rgb_out[LI_MAX][DCI_LUT_SIZE + 1];
+
+static void rgb_lut_init(int index) {
+    int i, j, lo, hi;
+
+    xyz_lut_init(index);
+
+    pthread_mutex_lock(&xyz_lut_mutex);
+
+    if (!lut_rgb_init[index]) {
+        OPENDCP_LOG(LOG_DEBUG, "building rgb out gamma table, index: %d", index);
+
+        for (i = 0; i <= COLOR_DEPTH; i++) {
+            lut_rgb_in[i] = (float)(pow((double)i / COLOR_DEPTH, DCI_GAMMA) / (DCI_COEFFICENT));
+        }
+
+        for (j = 0; j < DCI_LUT_SIZE; j++) {
+            float v = (float)(j / (DCI_LUT_SIZE - 1.0));
+
+            /* the first entry not below v, or the one before it if that is nearer */
+            for (lo = 0, hi = COLOR_DEPTH; lo < hi; ) {
+                i = (lo + hi) / 2;
+
+                if (lut_in[index][i] < v) {
+                    lo = i + 1;
+                } else {
+                    hi = i;
+                }
+            }
+
+            if (lo && v - lut_in[index][lo - 1] < lut_in[index][lo] - v) {
+                lo--;
+            }
+
+            lut_rgb_out[index][j] = (uint16_t)lo;
+        }
+
+        lut_rgb_out[index][DCI_LUT_SIZE] = lut_rgb_out[index][DCI_LUT_SIZE - 1];
+        lut_rgb_init[index] = 1;
+    }
+
+    pthread_mutex_unlock(&xyz_lut_mutex);
+}
+
+/* the inverse of a 3x3 matrix by its cofactors */
+static void rgb_matrix_inverse(float m[3][3], double inv[3][3]) {
+    double det;
+    int    r, c;
+
+    inv[0][0] =  (m[1][1] * m[2][2] - m[1][2] * m[2][1]);
+    inv[0][1] = -(m[0][1] * m[2][2] - m[0][2] * m[2][1]);
+    inv[0][2] =  (m[0][1] * m[1][2] - m[0][2] * m[1][1]);
+    inv[1][0] = -(m[1][0] * m[2][2] - m[1][2] * m[2][0]);
+    inv[1][1] =  (m[0][0] * m[2][2] - m[0][2] * m[2][0]);
+    inv[1][2] = -(m[0][0] * m[1][2] - m[0][2] * m[1][0]);
+    inv[2][0] =  (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+    inv[2][1] = -(m[0][0] * m[2][1] - m[0][1] * m[2][0]);
+    inv[2][2] =  (m[0][0] * m[1][1] - m[0][1] * m[1][0]);
+
+    det = m[0][0] * inv[0][0] + m[0][1] * inv[1][0] + m[0][2] * inv[2][0];
+
+    for (r = 0; r < 3; r++) {
+        for (c = 0; c < 3; c++) {
+            inv[r][c] /= det;
+        }
+    }
+}
+
+/* a row of X'Y'Z' codes to RGB codes, q may be p, from pixel i on */
+static void xyz_to_rgb_row_scalar(int *const p[3], int *const q[3], int i, int n, float inv[3][3], const uint16_t *out) {
+    float lx, ly, lz, d;
+    int   k;
+
+    for (; i < n; i++) {
+        lx = lut_rgb_in[CLIP(p[0][i], COLOR_DEPTH)];
+        ly = lut_rgb_in[CLIP(p[1][i], COLOR_DEPTH)];
+        lz = lut_rgb_in[CLIP(p[2][i], COLOR_DEPTH)];
+
+        for (k = 0; k < 3; k++) {
+            d = (inv[k][0] * lx + inv[k][1] * ly + inv[k][2] * lz) * (DCI_LUT_SIZE - 1) + 0.5f;
+            d = d < 0 ? 0 : (d > DCI_LUT_SIZE - 1 ? DCI_LUT_SIZE - 1 : d);
+            q[k][i] = out[(int)d];
+        }
+    }
+}
+
+#if defined(__GNUC__) && defined(__x86_64__)
+
+/* 8 pixels at a time, the in and out tables are gathered, returns the pixels done */
+__attribute__((target("avx2")))
+static int xyz_to_rgb_row_avx2(int *const p[3], int *const q[3], int n, float inv[3][3], const uint16_t *out) {
+    int     i, k;
+    __m256  m[3][3];
+    __m256  scale   = _mm256_set1_ps(DCI_LUT_SIZE - 1);
+    __m256  half    = _mm256_set1_ps(0.5f);
+    __m256  fzero   = _mm256_setzero_ps();
+    __m256  fmax    = _mm256_set1_ps(DCI_LUT_SIZE - 1);
+    __m256i in_max  = _mm256_set1_epi32(COLOR_DEPTH);
+    __m256i low16   = _mm256_set1_epi32(0xFFFF);
+    __m256i zero    = _mm256_setzero_si256();
+
+    for (i = 0; i < 3; i++) {
+        for (k = 0; k < 3; k++) {
+            m[i][k] = _mm256_set1_ps(inv[i][k]);
+        }
+    }
+
+    for (i = 0; i + 8 <= n; i += 8) {
+        __m256  s[3], d;
+        __m256i v[3];
+
+        /* DCI gamma undone */
+        for (k = 0; k < 3; k++) {
+            v[k] = _mm256_min_epi32(_mm256_max_epi32(_mm256_loadu_si256((__m256i *)(p[k] + i)), zero), in_max);
+            s[k] = _mm256_i32gather_ps(lut_rgb_in, v[k], 4);
+        }
+
+        for (k = 0; k < 3; k++) {
+            /* XYZ to RGB matrix */
+            d = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(s[0], m[k][0]), _mm256_mul_ps(s[1], m[k][1])), _mm256_mul_ps(s[2], m[k][2]));
+            d = _mm256_add_ps(_mm256_mul_ps(d, scale), half);
+            d = _mm256_min_ps(_mm256_max_ps(d, fzero), fmax);
+
+            /* out gamma lut of the profile */
+            v[k] = _mm256_and_si256(_mm256_i32gather_epi32((const int *)out, _mm256_cvttps_epi32(d), 2), low16);
+        }
+
+        for (k = 0; k < 3; k++) {
+            _mm256_storeu_si256((__m256i *)(q[k] + i), v[k]);
+        }
+    }
+
+    return i;
+}
+
+#elif defined(__aarch64__)
+
+/* 4 pixels at a time, the table lookups are done lane by lane */
+static int xyz_to_rgb_row_neon(int *const p[3], int *const q[3], int n, float inv[3][3], const uint16_t *out) {
+    int         i, j, k;
+    int32_t     idx[3][4];
+    float       tmp[4];
+    float32x4_t m[3][3];
+    float32x4_t scale  = vdupq_n_f32(DCI_LUT_SIZE - 1);
+    float32x4_t half   = vdupq_n_f32(0.5f);
+    float32x4_t fzero  = vdupq_n_f32(0);
+    float32x4_t fmax   = vdupq_n_f32(DCI_LUT_SIZE - 1);
+    int32x4_t   in_max = vdupq_n_s32(COLOR_DEPTH);
+    int32x4_t   zero   = vdupq_n_s32(0);
+
+    for (i = 0; i < 3; i++) {
+        for (k = 0; k < 3; k++) {
+            m[i][k] = vdupq_n_f32(inv[i][k]);
+        }
+    }
+
+    for (i = 0; i + 4 <= n; i += 4) {
+        float32x4_t s[3], d;
+
+        /* DCI gamma undone */
+        for (k = 0; k < 3; k++) {
+            vst1q_s32(idx[k], vminq_s32(vmaxq_s32(vld1q_s32(p[k] + i), zero), in_max));
+
+            for (j = 0; j < 4; j++) {
+                tmp[j] = lut_rgb_in[idx[k][j]];
+            }
+
+            s[k] = vld1q_f32(tmp);
+        }
+
+        for (k = 0; k < 3; k++) {
+            /* XYZ to RGB matrix */
+            d = vaddq_f32(vaddq_f32(vmulq_f32(s[0], m[k][0]), vmulq_f32(s[1], m[k][1])), vmulq_f32(s[2], m[k][2]));
+            d = vminq_f32(vmaxq_f32(vaddq_f32(vmulq_f32(d, scale), half), fzero), fmax);
+            vst1q_s32(idx[k], vcvtq_s32_f32(d));
+        }
+
+        /* out gamma lut of the profile */
+        for (k = 0; k < 3; k++) {
+            for (j = 0; j < 4; j++) {
+                q[k][i + j] = out[idx[k][j]];
+            }
+        }
+    }
+
+    return i;
+}
+
+#endif
+
+static void xyz_to_rgb_row(int *const p[3], int *const q[3], int n, float inv[3][3], const uint16_t *out) {
+    int done = 0;
+
+#if defined(__GNUC__) && defined(__x86_64__)
+    if (cpu_has(CPU_AVX2)) {
+        done = xyz_to_rgb_row_avx2(p, q, n, inv, out);
+    }
+#elif defined(__aarch64__)
+    if (cpu_has(CPU_NEON)) {
+        done = xyz_to_rgb_row_neon(p, q, n, inv, out);
+    }
+#endif
+
+    xyz_to_rgb_row_scalar(p, q, done, n, inv, out);
+}
+
+/* the inverse matrix of the profile in float, after the tables are built */
+static void xyz_to_rgb_setup(int index, float inv[3][3]) {
+    double inv_d[3][3];
+    int    r, c;
+
+    rgb_lut_init(index);
+    rgb_matrix_inverse(color_matrix[index], inv_d);
+
+    for (r = 0; r < 3; r++) {
+        for (c = 0; c < 3; c++) {
+            inv[r][c] = (float)inv_d[r][c];
+        }
+    }
+}
+
+/*!
+ @function xyz_to_rgb
+ @abstract Converts a decoded DCP picture from X'Y'Z' to RGB.
+ @discussion The inverse of rgb_to_xyz with the lut method, samples are
+     12-bit in and out. Colors outside the RGB gamut of the profile are
+     clipped.
+ @param image A 12-bit int image.
+ @param index The color LUT index of the RGB profile.
+ @return OPENDCP_NO_ERROR or OPENDCP_ERROR.
+*/
+int xyz_to_rgb(opendcp_image_t *image, int index) {
+    float inv[3][3];
+    int   *p[3];
+    int   k;
+
+    if (image->use_float || image->sample_type != SAMPLE_TYPE_INT32 || image->n_components < 3 ||
+        index < 0 || index >= LI_MAX) {
+        return OPENDCP_ERROR;
+    }
+
+    xyz_to_rgb_setup(index, inv);
+
+    for (k = 0; k < 3; k++) {
+        p[k] = image->component[k].data;
+    }
+
+    /* the planes are converted in place as one long row */
+    xyz_to_rgb_row(p, p, image->w * image->h, inv, lut_rgb_out[index]);
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* a 12-bit code at another depth */
+#define RGB_PACK_SCALE(v, max) ((uint32_t)(((v) * (max) + COLOR_DEPTH / 2) / COLOR_DEPTH))
+
+/* interleaves a row of 12-bit RGB planes into format */
+static void xyz_to_rgb_pack_row(int format, int *const q[3], int n, unsigned char *d) {
+    uint32_t *d32 = (uint32_t *)d;
+    uint16_t *d16 = (uint16_t *)d;
+    int      i;
+
+    switch (format) {
+        case RGB_PACK_RGB32:
+            for (i = 0; i < n; i++) {
+                d32[i] = 0xff000000u | RGB_PACK_SCALE(q[0][i], 255) << 16 | RGB_PACK_SCALE(q[1][i], 255) << 8 |
+                         RGB_PACK_SCALE(q[2][i], 255);
+            }
+            break;
+
+        case RGB_PACK_RGB24:
+            for (i = 0; i < n; i++) {
+                d[i * 3]     = (unsigned char)RGB_PACK_SCALE(q[0][i], 255);
+                d[i * 3 + 1] = (unsigned char)RGB_PACK_SCALE(q[1][i], 255);
+                d[i * 3 + 2] = (unsigned char)RGB_PACK_SCALE(q[2][i], 255);
+            }
+            break;
+
+        case RGB_PACK_RGB30:
+            for (i = 0; i < n; i++) {
+                d32[i] = 0xc0000000u | RGB_PACK_SCALE(q[0][i], 1023) << 20 | RGB_PACK_SCALE(q[1][i], 1023) << 10 |
+                         RGB_PACK_SCALE(q[2][i], 1023);
+            }
+            break;
+
+        default:
+            for (i = 0; i < n; i++) {
+                d16[i * 3]     = (uint16_t)RGB_PACK_SCALE(q[0][i], 65535);
+                d16[i * 3 + 1] = (uint16_t)RGB_PACK_SCALE(q[1][i], 65535);
+                d16[i * 3 + 2] = (uint16_t)RGB_PACK_SCALE(q[2][i], 65535);
+            }
+            break;
+    }
+}
+
+/*!
+ @function xyz_to_rgb_pack
+ @abstract Converts a decoded DCP picture to interleaved display RGB.
+ @discussion The conversion of xyz_to_rgb, written row by row into an
+     interleaved buffer instead of back into the planes, which are left as
+     they are. The DCI gamma is undone and the matrix of the profile
+     inverted on 8 pixels at a time where the cpu allows, and the out gamma
+     of the profile is the 12-bit table of xyz_to_rgb, scaled to the depth
+     of the format. The buffer can be the bits of a QImage of the matching
+     format, or the rows of an 8 or 16-bit file writer.
+ @param image A 12-bit int X'Y'Z' image.
+ @param index The color LUT index of the display, CP_SRGB, CP_REC709 or CP_P3.
+ @param format The RGB_PACK_FORMAT of the buffer.
+ @param dst The buffer, image->h rows of stride bytes.
+ @param stride The bytes between the start of two rows of dst.
+ @return OPENDCP_NO_ERROR or OPENDCP_ERROR.
+*/
+int xyz_to_rgb_pack(const opendcp_image_t *image, int index, int format, unsigned char *dst, int stride) {
+    float inv[3][3];
+    int   *p[3], *q[3];
+    int   *rows;
+    int   y, k;
+
+    if (image->use_float || image->sample_type != SAMPLE_TYPE_INT32 || image->n_components < 3 ||
+        index < 0 || index >= LI_MAX || format < RGB_PACK_RGB32 || format > RGB_PACK_RGB48) {
+        return OPENDCP_ERROR;
+    }
+
+    rows = malloc(3 * image->w * sizeof(int));
+
+    if (!rows) {
+        return OPENDCP_ERROR;
+    }
+
+    xyz_to_rgb_setup(index, inv);
+
+    for (k = 0; k < 3; k++) {
+        q[k] = rows + k * image->w;
+    }
+
+    for (y = 0; y < image->h; y++) {
+        for (k = 0; k < 3; k++) {
+            p[k] = image->component[k].data + y * image->component[k].stride;
+        }
+
+        xyz_to_rgb_row(p, q, image->w, inv, lut_rgb_out[index]);
+        xyz_to_rgb_pack_row(format, q, image->w, dst + (size_t)y * stride);
+    }
+
+    free(rows);
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*
+   Cached tables for the calculate method. The gamma tables hold the exact
+   complex_gamma() result for every 12-bit code value. The transfer is
+   replaced by the code value thresholds of dci_transfer(): calc_threshold[v]
+   is the smallest float that dci_transfer() maps to v - HEADROOM, and
+   calc_bucket[] gives a starting code for each interval of width
+   1 / CALC_BUCKET_SCALE. The result is identical to calling complex_gamma()
+   and dci_transfer() per pixel. The tables are built once and shared by all
+   threads.
+*/
+#define CALC_BUCKET_SCALE  32768
+#define CALC_BUCKET_MAX    2
+#define CALC_BUCKET_SIZE   (CALC_BUCKET_SCALE * CALC_BUCKET_MAX)
+#define CALC_CODE_MAX      8192
+
+static pthread_mutex_t calc_lut_mutex = PTHREAD_MUTEX_INITIALIZER;
+static int   calc_gamma_init[LI_MAX];
+static float calc_gamma[LI_MAX][COLOR_DEPTH + 1];
+static int   calc_transfer_init;
+static int   calc_code_max;
+static int   calc_bucket[CALC_BUCKET_SIZE];
+static float calc_threshold[CALC_CODE_MAX + 2];
+
+/* dci transfer before the headroom adjustment */
+static int calc_transfer_code(float p) {
+    return dci_transfer(p) + HEADROOM;
+}
+
+static void calc_transfer_build() {
+    int   v, b;
+    float t;
+
+    calc_code_max = calc_transfer_code(CALC_BUCKET_MAX);
+
+    if (calc_code_max > CALC_CODE_MAX) {
+        calc_code_max = CALC_CODE_MAX;
+    }
+
+    calc_threshold[0] = 0.0;
+
+    for (v = 1; v <= calc_code_max; v++) {
+        t = pow((double)v / COLOR_DEPTH, DCI_GAMMA) / (DCI_COEFFICENT);
+
+        while (t > 0.0 && calc_transfer_code(t) >= v) {
+            t = nextafterf(t, 0.0);
+        }
+
+        while (calc_transfer_code(t) < v) {
+            t = nextafterf(t, CALC_BUCKET_MAX);
+        }
+
+        calc_threshold[v] = t;
+    }
+
+    calc_threshold[calc_code_max + 1] = HUGE_VALF;
+
+    for (b = 0; b < CALC_BUCKET_SIZE; b++) {
+        calc_bucket[b] = calc_transfer_code((float)b / CALC_BUCKET_SCALE);
+    }
+}
+
+static void calc_lut_init(int index) {
+    int i;
+
+    pthread_mutex_lock(&calc_lut_mutex);
+
+    if (!calc_transfer_init) {
+        OPENDCP_LOG(LOG_DEBUG, "building dci transfer tables");
+        calc_transfer_build();
+        calc_transfer_init = 1;
+    }
+
+    if (!calc_gamma_init[index]) {
+        OPENDCP_LOG(LOG_DEBUG, "building gamma table, index: %d", index);
+
+        for (i = 0; i <= COLOR_DEPTH; i++) {
+            calc_gamma[index][i] = complex_gamma(i, GAMMA[index], index);
+        }
+
+        calc_gamma_init[index] = 1;
+    }
+
+    pthread_mutex_unlock(&calc_lut_mutex);
+}
+
+static inline float calc_lut_gamma(int index, int p) {
+    if (p < 0 || p > COLOR_DEPTH) {
+        return complex_gamma(p, GAMMA[index], index);
+    }
+
+    return calc_gamma[index][p];
+}
+
+static inline int calc_lut_transfer(float p) {
+    int v;
+
+    /* negative, nan and large values take the slow path */
+    if (!(p >= 0.0f && p < CALC_BUCKET_MAX)) {
+        return dci_transfer(p);
+    }
+
+    v = calc_bucket[(int)(p * CALC_BUCKET_SCALE)];
+
+    while (p >= calc_threshold[v + 1]) {
+        v++;
+    }
+
+    return v - HEADROOM;
+}
+
+/* rgb to xyz with the calculate tables for pixels [0, size) */
+static void rgb_to_xyz_calculate_pixels(opendcp_image_t *image, int index, int size) {
     int i;
-    int size;
     rgb_pixel_float_t s;
     xyz_pixel_float_t d;
 
-    size = image->w * image->h;
-    OPENDCP_LOG(LOG_DEBUG, "gamma: %f", GAMMA[index]);
+    calc_lut_init(index);
+
+    for (i = 0; i < size; i++) {
+        s.r = calc_lut_gamma(index, image->component[0].data[i]);
+        s.g = calc_lut_gamma(index, image->component[1].data[i]);
+        s.b = calc_lut_gamma(index, image->component[2].data[i]);
+
+        d.x = ((s.r * color_matrix[index][0][0]) + (s.g * color_matrix[index][0][1]) + (s.b * color_matrix[index][0][2]));
+        d.y = ((s.r * color_matrix[index][1][0]) + (s.g * color_matrix[index][1][1]) + (s.b * color_matrix[index][1][2]));
+        d.z = ((s.r * color_matrix[index][2][0]) + (s.g * color_matrix[index][2][1]) + (s.b * color_matrix[index][2][2]));
+
+        image->component[0].data[i] = calc_lut_transfer(d.x);
+        image->component[1].data[i] = calc_lut_transfer(d.y);
+        image->component[2].data[i] = calc_lut_transfer(d.z);
+    }
+}
+
+/* rgb to xyz color conversion hard calculations (int data) */
+int rgb_to_xyz_calculate(opendcp_image_t *image, int index) {
+    OPENDCP_LOG(LOG_DEBUG, "gamma: %f", GAMMA[index]);
+
+    /* the calculate tables are indexed by 12-bit code values */
+    opendcp_image_to_precision(image, 12);
+
+    rgb_to_xyz_calculate_pixels(image, index, image->w * image->h);
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*
+   Clipping statistics. When enabled, the conversion kernels tally the xyz
+   codes of each frame into image->xyz_stats: the range of each component,
+   the samples below the container and the samples that reach its peak,
+   which are the ones the out gamma lut or the clamp of the float method
+   saturated. The int methods tally the rows they just converted while
+   they are in cache, the float method counts the samples it clamps as it
+   quantizes them. A thread tallies its rows locally and adds them to the
+   frame once, as the bands of a frame may be converted on several threads
+   at once.
+*/
+static int xyz_stats_enable = 0;
+
+/*!
+ @function opendcp_xyz_stats
+ @abstract Enables the clipping statistics of the xyz conversion.
+ @discussion Images converted from then on carry their statistics in
+     xyz_stats. Disabled, the conversion runs without the tally.
+ @param enable 1 to tally, 0 to stop.
+*/
+void opendcp_xyz_stats(int enable) {
+    xyz_stats_enable = enable ? 1 : 0;
+}
+
+/*!
+ @function opendcp_xyz_stats_enabled
+ @abstract Returns whether the clipping statistics are enabled.
+ @return 1 when enabled, otherwise 0.
+*/
+int opendcp_xyz_stats_enabled(void) {
+    return xyz_stats_enable;
+}
+
+/* add the statistics a thread tallied to the frame */
+static void xyz_stats_merge(opendcp_xyz_stats_t *stats, const opendcp_xyz_stats_t *local) {
+    int c, v;
+
+    for (c = 0; c < 3; c++) {
+        while ((v = stats->min[c]) > local->min[c] && !__sync_bool_compare_and_swap(&stats->min[c], v, local->min[c]));
+        while ((v = stats->max[c]) < local->max[c] && !__sync_bool_compare_and_swap(&stats->max[c], v, local->max[c]));
+
+        __sync_fetch_and_add(&stats->low[c], local->low[c]);
+        __sync_fetch_and_add(&stats->high[c], local->high[c]);
+    }
+
+    __sync_fetch_and_add(&stats->samples, local->samples);
+}
+
+static void xyz_stats_tally_scalar(const int *v, int n, int c, opendcp_xyz_stats_t *stats) {
+    unsigned long long low  = 0;
+    unsigned long long high = 0;
+    int lo = stats->min[c];
+    int hi = stats->max[c];
+    int i;
+
+    for (i = 0; i < n; i++) {
+        lo    = v[i] < lo ? v[i] : lo;
+        hi    = v[i] > hi ? v[i] : hi;
+        low  += v[i] < 0;
+        high += v[i] >= COLOR_DEPTH;
+    }
+
+    stats->min[c]   = lo;
+    stats->max[c]   = hi;
+    stats->low[c]  += low;
+    stats->high[c] += high;
+}
+
+#if defined(__GNUC__) && defined(__x86_64__)
+/* the clip counts are kept per lane, a lane counts an eighth of a plane */
+__attribute__((target("avx2")))
+static int xyz_stats_tally_avx2(const int *v, int n, int c, opendcp_xyz_stats_t *stats) {
+    __m256i lo   = _mm256_set1_epi32(stats->min[c]);
+    __m256i hi   = _mm256_set1_epi32(stats->max[c]);
+    __m256i peak = _mm256_set1_epi32(COLOR_DEPTH - 1);
+    __m256i zero = _mm256_setzero_si256();
+    __m256i low  = _mm256_setzero_si256();
+    __m256i high = _mm256_setzero_si256();
+    int     min[8], max[8], under[8], over[8];
+    int     i, k;
+
+    for (i = 0; i + 8 <= n; i += 8) {
+        __m256i s = _mm256_loadu_si256((const __m256i *)(v + i));
+
+        lo   = _mm256_min_epi32(lo, s);
+        hi   = _mm256_max_epi32(hi, s);
+        low  = _mm256_sub_epi32(low, _mm256_cmpgt_epi32(zero, s));
+        high = _mm256_sub_epi32(high, _mm256_cmpgt_epi32(s, peak));
+    }
+
+    _mm256_storeu_si256((__m256i *)min, lo);
+    _mm256_storeu_si256((__m256i *)max, hi);
+    _mm256_storeu_si256((__m256i *)under, low);
+    _mm256_storeu_si256((__m256i *)over, high);
+
+    for (k = 0; k < 8; k++) {
+        stats->min[c]   = min[k] < stats->min[c] ? min[k] : stats->min[c];
+        stats->max[c]   = max[k] > stats->max[c] ? max[k] : stats->max[c];
+        stats->low[c]  += (unsigned int)under[k];
+        stats->high[c] += (unsigned int)over[k];
+    }
+
+    return i;
+}
+#endif
+
+/* tally the converted samples of a view and add them to the image */
+static void xyz_stats_tally(opendcp_image_t *image, const opendcp_image_t *view) {
+    opendcp_xyz_stats_t local;
+    int n = view->w * view->h;
+    int c, done;
+
+    opendcp_xyz_stats_reset(&local);
+
+    for (c = 0; c < 3; c++) {
+        done = 0;
+
+#if defined(__GNUC__) && defined(__x86_64__)
+        if (cpu_has(CPU_AVX2)) {
+            done = xyz_stats_tally_avx2(view->component[c].data, n, c, &local);
+        }
+#endif
+
+        xyz_stats_tally_scalar(view->component[c].data + done, n - done, c, &local);
+    }
+
+    local.samples = n;
+    xyz_stats_merge(&image->xyz_stats, &local);
+}
+
+/* color convert rows [y0, y1) through a view of just those rows */
+static void rgb_to_xyz_rows(opendcp_image_t *image, int index, int method, int y0, int y1) {
+    opendcp_image_t           view = *image;
+    opendcp_image_component_t component[3];
+    int c;
+
+    for (c = 0; c < 3; c++) {
+        component[c]       = image->component[c];
+        component[c].data += y0 * image->w;
+    }
+
+    view.component = component;
+    view.h         = y1 - y0;
+
+    if (method == XYZ_METHOD_CALCULATE) {
+        rgb_to_xyz_calculate_pixels(&view, index, view.w * view.h);
+    }
+    else if (method == XYZ_METHOD_FIXED) {
+        rgb_to_xyz_fixed(&view, index);
+    }
+    else {
+        rgb_to_xyz_lut(&view, index);
+    }
+
+    if (xyz_stats_enable) {
+        xyz_stats_tally(image, &view);
+    }
+}
+
+/*!
+ @function rgb_to_xyz_band
+ @abstract Color converts rows of an image as they are decoded.
+ @discussion Used as a decoder band callback. Only int images that already
+     fit the container are converted, anything that still has to be resized
+     is left for conform_image. Samples over 12 bits go through the
+     interpolated lut, the calculate method leaves them for rgb_to_xyz. The converted rows are added to
+     image->xyz_rows, bands of one image may be converted from several
+     threads at once.
+ @param image The image being decoded.
+ @param profile The cinema profile, DCP_CINEMA2K or DCP_CINEMA4K.
+ @param index The color LUT index.
+ @param method The XYZ_METHOD.
+ @param y0 The first row to convert.
+ @param y1 The row after the last row to convert.
+ @return The number of rows converted.
+*/
+int rgb_to_xyz_band(opendcp_image_t *image, int profile, int index, int method, int y0, int y1) {
+    if (image->use_float || image->sample_type != SAMPLE_TYPE_INT32 || image->n_components < 3 ||
+        (method == XYZ_METHOD_CALCULATE && image->precision > 12) || image_compliance(profile, image->w, image->h)) {
+        return 0;
+    }
+
+    rgb_to_xyz_rows(image, index, method, y0, y1);
+
+    /* the last band leaves 12-bit samples, every other band has read the precision */
+    if (__sync_add_and_fetch(&image->xyz_rows, y1 - y0) == image->h) {
+        image->precision = 12;
+        image->bpp       = 12;
+    }
+
+    return y1 - y0;
+}
+
+/*
+   Float pipeline. Float images (OpenEXR) hold linear light samples, so the
+   input transfer is skipped and only the primaries of the selected profile
+   are used. The matrix, the DCI transfer and the 12-bit quantization are
+   done in a single pass and the int samples are written over the float
+   samples, so the frame is not copied. The transfer uses fast_pow(), which
+   has a relative error around 1e-6; the result differs from pow() by at
+   most one code value, only at rounding boundaries.
+*/
+#define XYZ_FLOAT_MIN 1.0e-10f
+
+typedef union {
+    float    f;
+    uint32_t i;
+} float_bits_t;
+
+/* log2 approximation, polynomial fit on the mantissa */
+static inline float fast_log2(float x) {
+    float_bits_t v;
+    float e, m;
+
+    v.f = x;
+    e = (float)((int)(v.i >> 23) - 127);
+    v.i = (v.i & 0x007fffff) | 0x3f800000;
+    m = v.f - 1.0f;
+
+    return e + m * (1.442453526f + m * (-0.7173127803f + m * (0.4545084922f + m * (-0.2726975649f
+               + m * (0.1176130841f + m * -0.02456853475f))))) + 2.44343872e-06f;
+}
+
+/* exp2 approximation for x <= 0 */
+static inline float fast_exp2(float x) {
+    float_bits_t v;
+    float f;
+    int   e;
+
+    x = x > -126.0f ? x : -126.0f;
+    e = (int)x;
+    e = (float)e > x ? e - 1 : e;
+    f = x - (float)e;
+
+    v.f = 0.9999998984f + f * (0.6931544897f + f * (0.2401418182f + f * (0.05586033708f
+          + f * (0.008949590423f + f * 0.001893754058f))));
+    v.i += (uint32_t)e << 23;
+
+    return v.f;
+}
+
+/* pow for 0 < x <= 1 */
+static inline float fast_pow(float x, float y) {
+    return fast_exp2(fast_log2(x) * y);
+}
+
+static inline int xyz_float_quantize(float v) {
+    v = v * (float)(DCI_COEFFICENT);
+    v = v > XYZ_FLOAT_MIN ? v : XYZ_FLOAT_MIN;
+    v = v < 1.0f ? v : 1.0f;
+
+    return (int)(fast_pow(v, (float)(DCI_DEGAMMA)) * COLOR_DEPTH + 0.5f);
+}
+
+/* quantize and tally a component, the samples the clamps catch are the clipped ones */
+static inline int xyz_float_quantize_tally(float v, int c, opendcp_xyz_stats_t *stats) {
+    float s = v * (float)(DCI_COEFFICENT);
+    int   q = xyz_float_quantize(v);
+
+    stats->low[c]  += s < 0.0f;
+    stats->high[c] += s >= 1.0f;
+    stats->min[c]   = q < stats->min[c] ? q : stats->min[c];
+    stats->max[c]   = q > stats->max[c] ? q : stats->max[c];
+
+    return q;
+}
+
+/* a stats of NULL is a constant in the wrappers, so the plain loop inlines without the tally */
+static inline __attribute__((always_inline))
+void rgb_to_xyz_float_kernel(opendcp_image_t *image, int index, int size, opendcp_xyz_stats_t *stats) {
+    int   i;
+    float *r = image->component[0].float_data;
+    float *g = image->component[1].float_data;
+    float *b = image->component[2].float_data;
+    int   *x = (int *)r;
+    int   *y = (int *)g;
+    int   *z = (int *)b;
+    float m[3][3];
+
+    memcpy(m, color_matrix[index], sizeof(m));
+
+    for (i = 0; i < size; i++) {
+        float sr = r[i];
+        float sg = g[i];
+        float sb = b[i];
+
+        if (stats) {
+            x[i] = xyz_float_quantize_tally((sr * m[0][0]) + (sg * m[0][1]) + (sb * m[0][2]), 0, stats);
+            y[i] = xyz_float_quantize_tally((sr * m[1][0]) + (sg * m[1][1]) + (sb * m[1][2]), 1, stats);
+            z[i] = xyz_float_quantize_tally((sr * m[2][0]) + (sg * m[2][1]) + (sb * m[2][2]), 2, stats);
+        }
+        else {
+            x[i] = xyz_float_quantize((sr * m[0][0]) + (sg * m[0][1]) + (sb * m[0][2]));
+            y[i] = xyz_float_quantize((sr * m[1][0]) + (sg * m[1][1]) + (sb * m[1][2]));
+            z[i] = xyz_float_quantize((sr * m[2][0]) + (sg * m[2][1]) + (sb * m[2][2]));
+        }
+    }
+}
+
+static void rgb_to_xyz_float_generic(opendcp_image_t *image, int index, int size, opendcp_xyz_stats_t *stats) {
+    if (stats) {
+        rgb_to_xyz_float_kernel(image, index, size, stats);
+    }
+    else {
+        rgb_to_xyz_float_kernel(image, index, size, NULL);
+    }
+}
+
+#if defined(__GNUC__) && defined(__x86_64__)
+__attribute__((target("avx2")))
+static void rgb_to_xyz_float_avx2(opendcp_image_t *image, int index, int size, opendcp_xyz_stats_t *stats) {
+    if (stats) {
+        rgb_to_xyz_float_kernel(image, index, size, stats);
+    }
+    else {
+        rgb_to_xyz_float_kernel(image, index, size, NULL);
+    }
+}
+#endif
+
+/* hand the float planes over to the int data pointers */
+static void opendcp_image_float_release(opendcp_image_t *image) {
+    int c;
+
+    for (c = 0; c < image->n_components; c++) {
+        image->component[c].data       = (int *)image->component[c].float_data;
+        image->component[c].float_data = NULL;
+    }
+
+    image->bpp         = 12;
+    image->precision   = 12;
+    image->use_float   = 0;
+    image->sample_type = SAMPLE_TYPE_INT32;
+}
+
+/* rgb to xyz color conversion of float data into 12-bit int data */
+int rgb_to_xyz_float(opendcp_image_t *image, int index) {
+    opendcp_xyz_stats_t local;
+    opendcp_xyz_stats_t *stats = NULL;
+    int size;
+
+    if (!image->use_float) {
+        return OPENDCP_ERROR;
+    }
+
+    size = image->w * image->h;
+
+    if (xyz_stats_enable) {
+        opendcp_xyz_stats_reset(&local);
+        local.samples = size;
+        stats = &local;
+    }
+
+    OPENDCP_LOG(LOG_DEBUG, "rgb_to_xyz_float, index: %d", index);
+
+#if defined(__GNUC__) && defined(__x86_64__)
+
+    if (cpu_has(CPU_AVX2)) {
+        rgb_to_xyz_float_avx2(image, index, size, stats);
+    }
+    else {
+        rgb_to_xyz_float_generic(image, index, size, stats);
+    }
+
+#else
+    rgb_to_xyz_float_generic(image, index, size, stats);
+#endif
+
+    if (stats) {
+        xyz_stats_merge(&image->xyz_stats, stats);
+    }
+
+    opendcp_image_float_release(image);
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* quantize float data to 12-bit int data without color conversion */
+int opendcp_image_float_to_int(opendcp_image_t *image) {
+    int c, i, size;
+
+    if (!image->use_float) {
+        return OPENDCP_NO_ERROR;
+    }
+
+    size = image->w * image->h;
+
+    for (c = 0; c < image->n_components; c++) {
+        float *s = image->component[c].float_data;
+        int   *d = (int *)s;
+
+        for (i = 0; i < size; i++) {
+            float v = s[i] > 0.0f ? s[i] : 0.0f;
+            v = v < 1.0f ? v : 1.0f;
+            d[i] = (int)(v * COLOR_DEPTH + 0.5f);
+        }
+    }
+
+    opendcp_image_float_release(image);
+
+    return OPENDCP_NO_ERROR;
+}
+
+float b_spline(float x) {
+    float c = (float)1 / (float)6;
+
+    if (x > 2.0 || x < -2.0) {
+        return 0.0f;
+    }
+
+    if (x < -1.0) {
+        return(((x + 2.0f) * (x + 2.0f) * (x + 2.0f)) * c);
+    }
+
+    if (x < 0.0) {
+        return((4.0f + (x * x * (-6.0f - 3.0f * x))) * c);
+    }
+
+    if (x < 1.0) {
+        return((4.0f + (x * x * (-6.0f + 3.0f * x))) * c);
+    }
+
+    if (x < 2.0) {
+        return(((2.0f - x) * (2.0f - x) * (2.0f - x)) * c);
+    }
+
+    return 0;
+}
+
+/*
+   Bicubic resize. The b-spline kernel is separable, so the image is filtered
+   horizontally into a float buffer and then vertically into the destination.
+   The taps for every destination column and row are computed once. When
+   downscaling the kernel is stretched by the scale factor so every source
+   sample contributes. Both passes are split into bands of rows that run on
+   their own threads; the conform stage of the j2k pipeline already runs
+   several frames at once, so the band count is kept small.
+*/
+#define RESIZE_THREADS 4
+#define RESIZE_TILE    256
+
+typedef struct {
+    int   taps;     /* taps per destination sample */
+    int   *index;   /* source sample of each tap, clamped to the edges */
+    float *weight;  /* normalized weight of each tap */
+} resize_filter_t;
+
+typedef struct {
+    opendcp_image_t *src;
+    opendcp_image_t *dst;
+    resize_filter_t *fx;
+    resize_filter_t *fy;
+    float           *tmp[3];
+    int             start;
+    int             end;
+    int             xyz;        /* conform only: convert the rows to XYZ */
+    int             index;      /* conform only: gamma and matrix of the conversion */
+    int             xyz_method; /* conform only: the XYZ_METHOD */
+    int             failed;
+} resize_band_t;
+
+static void resize_filter_free(resize_filter_t *filter) {
+    free(filter->index);
+    free(filter->weight);
+}
+
+static int resize_filter_build(resize_filter_t *filter, int src_size, int dst_size) {
+    int   i, k;
+    float scale   = (float)src_size / (float)dst_size;
+    float stretch = scale > 1.0f ? scale : 1.0f;
+
+    filter->taps   = (int)ceil(4.0f * stretch) + 1;
+    filter->index  = malloc(dst_size * filter->taps * sizeof(int));
+    filter->weight = malloc(dst_size * filter->taps * sizeof(float));
+
+    if (!filter->index || !filter->weight) {
+        resize_filter_free(filter);
+        return OPENDCP_ERROR;
+    }
+
+    for (i = 0; i < dst_size; i++) {
+        float center = ((float)i + 0.5f) * scale - 0.5f;
+        int   first  = (int)floor(center - 2.0f * stretch);
+        int   *index = &filter->index[i * filter->taps];
+        float *w     = &filter->weight[i * filter->taps];
+        float sum    = 0.0f;
+
+        for (k = 0; k < filter->taps; k++) {
+            int n = first + k;
+
+            w[k]     = b_spline(((float)n - center) / stretch);
+            index[k] = n < 0 ? 0 : (n >= src_size ? src_size - 1 : n);
+            sum     += w[k];
+        }
+
+        for (k = 0; k < filter->taps; k++) {
+            w[k] /= sum;
+        }
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* horizontal pass, source rows into the float buffer */
+static void *resize_band_horizontal(void *arg) {
+    resize_band_t   *band = arg;
+    resize_filter_t *fx   = band->fx;
+    int c, x, y, k;
 
-    for (i = 0; i < size; i++) {
-        s.r = complex_gamma(image->component[0].data[i], GAMMA[index], index);
-        s.g = complex_gamma(image->component[1].data[i], GAMMA[index], index);
-        s.b = complex_gamma(image->component[2].data[i], GAMMA[index], index);
+    for (c = 0; c < 3; c++) {
+        opendcp_image_component_t *src = &band->src->component[c];
 
-        d.x = ((s.r * color_matrix[index][0][0]) + (s.g * color_matrix[index][0][1]) + (s.b * color_matrix[index][0][2]));
-        d.y = ((s.r * color_matrix[index][1][0]) + (s.g * color_matrix[index][1][1]) + (s.b * color_matrix[index][1][2]));
-        d.z = ((s.r * color_matrix[index][2][0]) + (s.g * color_matrix[index][2][1]) + (s.b * color_matrix[index][2][2]));
+        for (y = band->start; y < band->end; y++) {
+            float *d = &band->tmp[c][y * band->dst->w];
 
-        image->component[0].data[i] = dci_transfer(d.x);
-        image->component[1].data[i] = dci_transfer(d.y);
-        image->component[2].data[i] = dci_transfer(d.z);
+            for (x = 0; x < band->dst->w; x++) {
+                const int   *index = &fx->index[x * fx->taps];
+                const float *w     = &fx->weight[x * fx->taps];
+                float       v      = 0.0f;
+
+                if (band->src->use_float) {
+                    const float *row = &src->float_data[y * band->src->w];
+
+                    for (k = 0; k < fx->taps; k++) {
+                        v += row[index[k]] * w[k];
+                    }
+                }
+                else {
+                    const int *row = &src->data[y * band->src->w];
+
+                    for (k = 0; k < fx->taps; k++) {
+                        v += (float)row[index[k]] * w[k];
+                    }
+                }
+
+                d[x] = v;
+            }
+        }
     }
 
-    return OPENDCP_NO_ERROR;
+    return NULL;
 }
 
-/* rgb to xyz color conversion hard calculations (float data) */
-int rgb_to_xyz_calculate_float(opendcp_image_t *image, int index) {
-    int i;
-    int size;
-    rgb_pixel_float_t s;
-    xyz_pixel_float_t d;
+/* vertical pass, the float buffer into destination rows, in column tiles */
+static void *resize_band_vertical(void *arg) {
+    resize_band_t   *band = arg;
+    resize_filter_t *fy   = band->fy;
+    int   w = band->dst->w;
+    int   c, x, x0, x1, y, k;
+    float acc[RESIZE_TILE];
 
-    size = image->w * image->h;
-    OPENDCP_LOG(LOG_DEBUG, "gamma: %f", GAMMA[index]);
+    for (c = 0; c < 3; c++) {
+        opendcp_image_component_t *dst = &band->dst->component[c];
 
-    for (i = 0; i < size; i++) {
-        s.r = complex_gamma(image->component[0].float_data[i], GAMMA[index], index);
-        s.g = complex_gamma(image->component[1].float_data[i], GAMMA[index], index);
-        s.b = complex_gamma(image->component[2].float_data[i], GAMMA[index], index);
+        for (y = band->start; y < band->end; y++) {
+            const int   *index  = &fy->index[y * fy->taps];
+            const float *weight = &fy->weight[y * fy->taps];
 
-        d.x = ((s.r * color_matrix[index][0][0]) + (s.g * color_matrix[index][0][1]) + (s.b * color_matrix[index][0][2]));
-        d.y = ((s.r * color_matrix[index][1][0]) + (s.g * color_matrix[index][1][1]) + (s.b * color_matrix[index][1][2]));
-        d.z = ((s.r * color_matrix[index][2][0]) + (s.g * color_matrix[index][2][1]) + (s.b * color_matrix[index][2][2]));
+            for (x0 = 0; x0 < w; x0 += RESIZE_TILE) {
+                x1 = x0 + RESIZE_TILE < w ? x0 + RESIZE_TILE : w;
+
+                memset(acc, 0, sizeof(acc));
+
+                for (k = 0; k < fy->taps; k++) {
+                    const float *row = &band->tmp[c][index[k] * w];
+                    float       wk   = weight[k];
+
+                    for (x = x0; x < x1; x++) {
+                        acc[x - x0] += row[x] * wk;
+                    }
+                }
+
+                if (band->dst->use_float) {
+                    memcpy(&dst->float_data[y * w + x0], acc, (x1 - x0) * sizeof(float));
+                }
+                else {
+                    for (x = x0; x < x1; x++) {
+                        int v = (int)(acc[x - x0] + 0.5f);
+                        dst->data[y * w + x] = v < 0 ? 0 : (v > COLOR_DEPTH ? COLOR_DEPTH : v);
+                    }
+                }
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/* run a pass over rows in bands on the thread pool */
+static int resize_run_bands(resize_band_t *proto, int rows, void *(*pass)(void *)) {
+    resize_band_t band[RESIZE_THREADS];
+    int           i, n;
 
-        image->component[0].float_data[i] = dci_transfer_float(d.x);
-        image->component[1].float_data[i] = dci_transfer_float(d.y);
-        image->component[2].float_data[i] = dci_transfer_float(d.z);
+    n = rows < RESIZE_THREADS ? rows : RESIZE_THREADS;
+
+    for (i = 0; i < n; i++) {
+        band[i]       = *proto;
+        band[i].start = rows * i / n;
+        band[i].end   = rows * (i + 1) / n;
     }
 
+    opendcp_pool_run(pass, band, sizeof(resize_band_t), n, POOL_PRIORITY_HIGH);
+
     return OPENDCP_NO_ERROR;
 }
 
-float b_spline(float x) {
-    float c = (float)1 / (float)6;
+static int resize_bicubic(opendcp_image_t *src, opendcp_image_t *dst) {
+    resize_filter_t fx, fy;
+    resize_band_t   band;
+    int c;
+    int result = OPENDCP_ERROR;
 
-    if (x > 2.0 || x < -2.0) {
-        return 0.0f;
-    }
+    memset(&band, 0, sizeof(band));
 
-    if (x < -1.0) {
-        return(((x + 2.0f) * (x + 2.0f) * (x + 2.0f)) * c);
+    if (resize_filter_build(&fx, src->w, dst->w) != OPENDCP_NO_ERROR) {
+        return OPENDCP_ERROR;
     }
 
-    if (x < 0.0) {
-        return(((x + 4.0f) * (x) * (-6.0f - 3.0f * x)) * c);
+    if (resize_filter_build(&fy, src->h, dst->h) != OPENDCP_NO_ERROR) {
+        resize_filter_free(&fx);
+        return OPENDCP_ERROR;
     }
 
-    if (x < 1.0) {
-        return(((x + 4.0f) * (x) * (-6.0f + 3.0f * x)) * c);
+    band.src = src;
+    band.dst = dst;
+    band.fx  = &fx;
+    band.fy  = &fy;
+
+    for (c = 0; c < 3; c++) {
+        band.tmp[c] = malloc(src->h * dst->w * sizeof(float));
+
+        if (!band.tmp[c]) {
+            OPENDCP_LOG(LOG_ERROR, "unable to allocate memory for resize buffer");
+            goto done;
+        }
     }
 
-    if (x < 2.0) {
-        return(((2.0f - x) * (2.0f - x) * (2.0f - x)) * c);
+    resize_run_bands(&band, src->h, resize_band_horizontal);
+    resize_run_bands(&band, dst->h, resize_band_vertical);
+
+    result = OPENDCP_NO_ERROR;
+
+done:
+    for (c = 0; c < 3; c++) {
+        free(band.tmp[c]);
     }
 
-    return 0;
+    resize_filter_free(&fx);
+    resize_filter_free(&fy);
+
+    return result;
 }
 
 /* get the pixel index based on x,y (int data) */
@@ -577,11 +2773,21 @@ static inline rgb_pixel_float_t get_pixel_float(opendcp_image_t *image, int x, i
     return p;
 }
 
+/* the source rows and columns that land in a w x h frame when centered, and where they go */
+static void letterbox_window(opendcp_image_t *src, int w, int h, int *sx, int *sy, int *dx, int *dy, int *cw, int *ch) {
+    *dx = w > src->w ? (w - src->w) / 2 : 0;
+    *dy = h > src->h ? (h - src->h) / 2 : 0;
+    *sx = src->w > w ? (src->w - w) / 2 : 0;
+    *sy = src->h > h ? (src->h - h) / 2 : 0;
+    *cw = src->w < w ? src->w : w;
+    *ch = src->h < h ? src->h : h;
+}
+
+/* letter box (int data), the image is centered in a w x h black frame */
 int letterbox(opendcp_image_t **image, int w, int h) {
     int num_components = 3;
-    int x, y;
+    int c, y, sx, sy, dx, dy, cw, ch;
     opendcp_image_t *ptr = *image;
-    rgb_pixel_float_t p;
 
     /* create the image */
     opendcp_image_t *d_image = opendcp_image_create(num_components, w, h);
@@ -590,12 +2796,14 @@ int letterbox(opendcp_image_t **image, int w, int h) {
         return -1;
     }
 
-    for (y = 0; y < h; y++) {
-        for (x = 0; x < w; x++) {
-            p = get_pixel(ptr, x, y);
-            d_image->component[0].data[0] = (int)p.r;
-            d_image->component[1].data[0] = (int)p.g;
-            d_image->component[2].data[0] = (int)p.b;
+    letterbox_window(ptr, w, h, &sx, &sy, &dx, &dy, &cw, &ch);
+
+    for (c = 0; c < num_components; c++) {
+        memset(d_image->component[c].data, 0, (size_t)w * h * sizeof(int));
+
+        for (y = 0; y < ch; y++) {
+            memcpy(&d_image->component[c].data[(dy + y) * w + dx], &ptr->component[c].data[(sy + y) * ptr->w + sx],
+                   cw * sizeof(int));
         }
     }
 
@@ -605,26 +2813,108 @@ int letterbox(opendcp_image_t **image, int w, int h) {
     return OPENDCP_NO_ERROR;
 }
 
+/* the light of each 12-bit code of the 2.6 gamma container, for opendcp_image_halve */
+static pthread_once_t halve_lut_once = PTHREAD_ONCE_INIT;
+static float          halve_lut[COLOR_DEPTH + 1];
+
+static void halve_lut_init(void) {
+    int i;
+
+    for (i = 0; i <= COLOR_DEPTH; i++) {
+        halve_lut[i] = pow((double)i / COLOR_DEPTH, DCI_GAMMA);
+    }
+}
+
+/* the code whose light is nearest to v, the table rises with the code */
+static inline int halve_code(float v) {
+    int lo = 0, hi = COLOR_DEPTH, mid;
+
+    while (hi - lo > 1) {
+        mid = (lo + hi) / 2;
+
+        if (halve_lut[mid] <= v) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return v - halve_lut[lo] < halve_lut[hi] - v ? lo : hi;
+}
+
+/*!
+ @function opendcp_image_halve
+ @abstract Scales a 12-bit image down to half its width and height.
+ @discussion Each pixel is the mean of a 2x2 block of the source, averaged
+             in linear light through the 2.6 gamma of the container and
+             coded again, so detail does not darken the way averaging the
+             codes would. Every DCI 4K container halves to its 2K
+             container exactly. The source is left as it is.
+ @param image The image, 12-bit int samples.
+ @return The half size image, NULL if the image can not be halved.
+*/
+opendcp_image_t *opendcp_image_halve(const opendcp_image_t *image) {
+    opendcp_image_t *half;
+    int             c, x, y, w = image->w / 2, h = image->h / 2;
+
+    if (image->sample_type != SAMPLE_TYPE_INT32 || image->use_float || image->precision != 12 || w < 1 || h < 1) {
+        OPENDCP_LOG(LOG_ERROR, "only 12-bit int images can be halved");
+        return NULL;
+    }
+
+    pthread_once(&halve_lut_once, halve_lut_init);
+
+    half = opendcp_image_create(image->n_components, w, h);
+
+    if (!half) {
+        return NULL;
+    }
+
+    half->bpp       = image->bpp;
+    half->precision = image->precision;
+
+    for (c = 0; c < image->n_components; c++) {
+        const opendcp_image_component_t *src = &image->component[c];
+        int                             *dst = half->component[c].data;
+
+        for (y = 0; y < h; y++) {
+            const int *r0 = src->data + (size_t)src->stride * y * 2;
+            const int *r1 = r0 + src->stride;
+            int       *d  = dst + (size_t)half->component[c].stride * y;
+
+            for (x = 0; x < w; x++) {
+                float v = halve_lut[CLIP(r0[2 * x], COLOR_DEPTH)] + halve_lut[CLIP(r0[2 * x + 1], COLOR_DEPTH)] +
+                          halve_lut[CLIP(r1[2 * x], COLOR_DEPTH)] + halve_lut[CLIP(r1[2 * x + 1], COLOR_DEPTH)];
+
+                d[x] = halve_code(v * 0.25f);
+            }
+        }
+    }
+
+    return half;
+}
+
 /* letter box (float data) */
 int letterbox_float(opendcp_image_t **image, int w, int h) {
     int num_components = 3;
-    int x, y;
+    int c, y, sx, sy, dx, dy, cw, ch;
     opendcp_image_t *ptr = *image;
-    rgb_pixel_float_t p;
 
     /* create the image */
-    opendcp_image_t *d_image = opendcp_image_create(num_components, w, h);
+    opendcp_image_t *d_image = opendcp_image_create_float(num_components, w, h);
 
     if (!d_image) {
         return -1;
     }
 
-    for (y = 0; y < h; y++) {
-        for (x = 0; x < w; x++) {
-            p = get_pixel(ptr, x, y);
-            d_image->component[0].float_data[0] = p.r;
-            d_image->component[1].float_data[0] = p.g;
-            d_image->component[2].float_data[0] = p.b;
+    letterbox_window(ptr, w, h, &sx, &sy, &dx, &dy, &cw, &ch);
+
+    for (c = 0; c < num_components; c++) {
+        memset(d_image->component[c].float_data, 0, (size_t)w * h * sizeof(float));
+
+        for (y = 0; y < ch; y++) {
+            memcpy(&d_image->component[c].float_data[(dy + y) * w + dx],
+                   &ptr->component[c].float_data[(sy + y) * ptr->w + sx], cw * sizeof(float));
         }
     }
 
@@ -633,11 +2923,9 @@ int letterbox_float(opendcp_image_t **image, int w, int h) {
 
     return OPENDCP_NO_ERROR;
 }
-/* resize image (int data) */
-int resize(opendcp_image_t **image, int profile, int method) {
-    int num_components = 3;
-    opendcp_image_t *ptr = *image;
-    rgb_pixel_float_t p;
+
+/* the largest even size with the aspect ratio of the image that fits the DCI container of the profile */
+static void resize_dimensions(opendcp_image_t *ptr, int profile, int *dw, int *dh) {
     int w, h;
     float aspect;
 
@@ -681,6 +2969,21 @@ int resize(opendcp_image_t **image, int profile, int method) {
         h *= 2;
     }
 
+    *dw = w;
+    *dh = h;
+}
+
+/* resize image (int data) */
+int resize(opendcp_image_t **image, int profile, int method) {
+    int num_components = 3;
+    opendcp_image_t *ptr = *image;
+    rgb_pixel_float_t p;
+    int w, h;
+    float aspect;
+
+    aspect = (float)ptr->w / (float)ptr->h;
+    resize_dimensions(ptr, profile, &w, &h);
+
     OPENDCP_LOG(LOG_INFO, "resizing from %dx%d to %dx%d (%f) (int data)", ptr->w, ptr->h, w, h, aspect);
 
     /* create the image */
@@ -711,6 +3014,12 @@ int resize(opendcp_image_t **image, int profile, int method) {
             }
         }
     }
+    else if (method == BICUBIC) {
+        if (resize_bicubic(ptr, d_image) != OPENDCP_NO_ERROR) {
+            opendcp_image_free(d_image);
+            return OPENDCP_ERROR;
+        }
+    }
 
     opendcp_image_free(*image);
     *image = d_image;
@@ -726,45 +3035,8 @@ int resize_float(opendcp_image_t **image, int profile, int method) {
     int w, h;
     float aspect;
 
-    /* aspect ratio */
     aspect = (float)ptr->w / (float)ptr->h;
-
-    /* depending on the aspect ratio, set height or weight priority */
-    if (aspect <= 2.10) {
-        w = (ptr->w * MAX_HEIGHT_2K / ptr->h);
-        h = MAX_HEIGHT_2K;
-    }
-    else {
-        w = MAX_WIDTH_2K;
-        h = (ptr->h * MAX_WIDTH_2K / ptr->w);
-    }
-
-    /* if we overshot width, scale back */
-    if (w > MAX_WIDTH_2K) {
-        w = MAX_WIDTH_2K;
-        h = w / aspect;
-    }
-
-    /* if we overshot height, scale back */
-    if (h > MAX_HEIGHT_2K) {
-        h = MAX_HEIGHT_2K;
-        w = h * aspect;
-    }
-
-    /* the image dimensions must be even values */
-    if (w % 2) {
-        w = w - 1;
-    }
-
-    if (h % 2) {
-        h = h - 1;
-    }
-
-    /* adjust for 4K */
-    if (profile == DCP_CINEMA4K) {
-        w *= 2;
-        h *= 2;
-    }
+    resize_dimensions(ptr, profile, &w, &h);
 
     OPENDCP_LOG(LOG_INFO, "resizing from %dx%d to %dx%d (%f) (float data)", ptr->w, ptr->h, w, h, aspect);
 
@@ -788,7 +3060,7 @@ int resize_float(opendcp_image_t **image, int profile, int method) {
 
             for (x = 0; x < w; x++) {
                 dx = x * tx;
-                p = get_pixel(ptr, dx, dy);
+                p = get_pixel_float(ptr, dx, dy);
                 i = x + (w * y);
                 d_image->component[0].float_data[i] = p.r;
                 d_image->component[1].float_data[i] = p.g;
@@ -796,9 +3068,252 @@ int resize_float(opendcp_image_t **image, int profile, int method) {
             }
         }
     }
+    else if (method == BICUBIC) {
+        if (resize_bicubic(ptr, d_image) != OPENDCP_NO_ERROR) {
+            opendcp_image_free(d_image);
+            return OPENDCP_ERROR;
+        }
+    }
 
     opendcp_image_free_float(*image);
     *image = d_image;
 
     return OPENDCP_NO_ERROR;
 }
+
+/*
+   Fused conform for int data. A frame that needs resizing is scaled and
+   color converted in one pass over bands of CONFORM_BAND destination rows.
+   Each band filters the source rows it needs horizontally into a small
+   float buffer, filters those vertically into the destination rows and
+   converts the rows to XYZ while they are still in cache. The frame is
+   written once and no intermediate frame is allocated. Source rows under
+   the taps of two bands are filtered twice, a few rows per band. The
+   nearest pixel method runs through the same code with one tap weighted 1,
+   which gives the same samples as resize().
+*/
+#define CONFORM_BAND 32
+
+static int conform_filter_nearest(resize_filter_t *filter, int src_size, int dst_size) {
+    int   i;
+    float t = (float)src_size / dst_size;
+
+    filter->taps   = 1;
+    filter->index  = malloc(dst_size * sizeof(int));
+    filter->weight = malloc(dst_size * sizeof(float));
+
+    if (!filter->index || !filter->weight) {
+        resize_filter_free(filter);
+        return OPENDCP_ERROR;
+    }
+
+    for (i = 0; i < dst_size; i++) {
+        filter->index[i]  = (int)(i * t);
+        filter->weight[i] = 1.0f;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+static void *conform_band(void *arg) {
+    resize_band_t   *band = arg;
+    resize_filter_t *fx   = band->fx;
+    resize_filter_t *fy   = band->fy;
+    int    w   = band->dst->w;
+    float  *tmp = NULL;
+    size_t alloc = 0;
+    int    c, x, x0, x1, y, y0, y1, k, lo, hi, rows;
+    float  acc[RESIZE_TILE];
+
+    for (y0 = band->start; y0 < band->end; y0 = y1) {
+        y1 = y0 + CONFORM_BAND < band->end ? y0 + CONFORM_BAND : band->end;
+
+        /* the source rows under the taps of the band */
+        lo = hi = fy->index[y0 * fy->taps];
+
+        for (k = y0 * fy->taps; k < y1 * fy->taps; k++) {
+            lo = fy->index[k] < lo ? fy->index[k] : lo;
+            hi = fy->index[k] > hi ? fy->index[k] : hi;
+        }
+
+        rows = hi - lo + 1;
+
+        if ((size_t)rows * w * 3 > alloc) {
+            float *grown = realloc(tmp, (size_t)rows * w * 3 * sizeof(float));
+
+            if (!grown) {
+                band->failed = 1;
+                break;
+            }
+
+            tmp   = grown;
+            alloc = (size_t)rows * w * 3;
+        }
+
+        for (c = 0; c < 3; c++) {
+            float *plane = &tmp[(size_t)c * rows * w];
+
+            /* horizontal, source rows into the band buffer */
+            for (y = lo; y <= hi; y++) {
+                const int *row = &band->src->component[c].data[y * band->src->w];
+                float     *d   = &plane[(y - lo) * w];
+
+                for (x = 0; x < w; x++) {
+                    const int   *index = &fx->index[x * fx->taps];
+                    const float *wt    = &fx->weight[x * fx->taps];
+                    float       v      = 0.0f;
+
+                    for (k = 0; k < fx->taps; k++) {
+                        v += (float)row[index[k]] * wt[k];
+                    }
+
+                    d[x] = v;
+                }
+            }
+
+            /* vertical, the band buffer into destination rows */
+            for (y = y0; y < y1; y++) {
+                const int   *index  = &fy->index[y * fy->taps];
+                const float *weight = &fy->weight[y * fy->taps];
+                int         *dst    = &band->dst->component[c].data[y * w];
+
+                for (x0 = 0; x0 < w; x0 += RESIZE_TILE) {
+                    x1 = x0 + RESIZE_TILE < w ? x0 + RESIZE_TILE : w;
+
+                    memset(acc, 0, sizeof(acc));
+
+                    for (k = 0; k < fy->taps; k++) {
+                        const float *row = &plane[(index[k] - lo) * w];
+                        float       wk   = weight[k];
+
+                        for (x = x0; x < x1; x++) {
+                            acc[x - x0] += row[x] * wk;
+                        }
+                    }
+
+                    for (x = x0; x < x1; x++) {
+                        int v = (int)(acc[x - x0] + 0.5f);
+                        dst[x] = v < 0 ? 0 : (v > COLOR_DEPTH ? COLOR_DEPTH : v);
+                    }
+                }
+            }
+        }
+
+        if (band->xyz) {
+            rgb_to_xyz_rows(band->dst, band->index, band->xyz_method, y0, y1);
+        }
+    }
+
+    free(tmp);
+
+    return NULL;
+}
+
+/*!
+ @function conform_image
+ @abstract Resizes an int image to the DCI container and color converts it in one pass.
+ @discussion The result is the image resize() followed by rgb_to_xyz() would
+             give, but the frame is processed in bands of rows that stay in
+             cache, so it is read and written once. With opendcp_gpu
+             enabled the frame is conformed on the GPU when it can be.
+ @param image The image, replaced by the conformed image.
+ @param profile DCP_CINEMA2K or DCP_CINEMA4K.
+ @param method NEAREST_PIXEL or BICUBIC.
+ @param xyz Non-zero to convert to XYZ.
+ @param index The gamma and matrix of the conversion.
+ @param xyz_method The XYZ_METHOD.
+ @return OPENDCP_NO_ERROR or OPENDCP_ERROR, the image is unchanged on failure.
+*/
+int conform_image(opendcp_image_t **image, int profile, int method, int xyz, int index, int xyz_method) {
+    opendcp_image_t *ptr = *image;
+    opendcp_image_t *d_image;
+    resize_filter_t fx, fy;
+    resize_band_t   band;
+    int w, h, i, result;
+    int gpu = 0;
+
+    resize_dimensions(ptr, profile, &w, &h);
+
+    OPENDCP_LOG(LOG_INFO, "conforming from %dx%d to %dx%d%s", ptr->w, ptr->h, w, h, xyz ? " with XYZ conversion" : "");
+
+    result = method == BICUBIC ? resize_filter_build(&fx, ptr->w, w) : conform_filter_nearest(&fx, ptr->w, w);
+
+    if (result != OPENDCP_NO_ERROR) {
+        return OPENDCP_ERROR;
+    }
+
+    result = method == BICUBIC ? resize_filter_build(&fy, ptr->h, h) : conform_filter_nearest(&fy, ptr->h, h);
+
+    if (result != OPENDCP_NO_ERROR) {
+        resize_filter_free(&fx);
+        return OPENDCP_ERROR;
+    }
+
+    d_image = opendcp_image_create(3, w, h);
+
+    if (!d_image) {
+        resize_filter_free(&fx);
+        resize_filter_free(&fy);
+        return OPENDCP_ERROR;
+    }
+
+    memset(&band, 0, sizeof(band));
+    band.src        = ptr;
+    band.dst        = d_image;
+    band.fx         = &fx;
+    band.fy         = &fy;
+    band.xyz        = xyz;
+    band.index      = index;
+    band.xyz_method = xyz_method;
+
+    /* the gpu stage takes the frame when it can, the bands run otherwise */
+    if (opendcp_gpu_enabled() && (!xyz || xyz_method == XYZ_METHOD_LUT)) {
+        opendcp_gpu_filter_t gx = { fx.taps, fx.index, fx.weight };
+        opendcp_gpu_filter_t gy = { fy.taps, fy.index, fy.weight };
+
+        if (xyz) {
+            xyz_lut_init(index);
+        }
+
+        gpu = opendcp_gpu_conform(ptr, d_image, &gx, &gy, xyz ? lut_in[index] : NULL, lut_out, &color_matrix[index][0][0]) == OPENDCP_NO_ERROR;
+
+        /* the gpu kernels do not tally, the frame is read once more */
+        if (gpu && xyz && xyz_stats_enable) {
+            xyz_stats_tally(d_image, d_image);
+        }
+    }
+
+    /* each pool thread takes a share of the bands, a failed share fails the frame */
+    if (!gpu) {
+        resize_band_t bands[RESIZE_THREADS];
+        int           n = (h + CONFORM_BAND - 1) / CONFORM_BAND;
+
+        n = n < RESIZE_THREADS ? n : RESIZE_THREADS;
+
+        for (i = 0; i < n; i++) {
+            bands[i]       = band;
+            bands[i].start = (h / CONFORM_BAND * i / n) * CONFORM_BAND;
+            bands[i].end   = i == n - 1 ? h : (h / CONFORM_BAND * (i + 1) / n) * CONFORM_BAND;
+        }
+
+        opendcp_pool_run(conform_band, bands, sizeof(resize_band_t), n, POOL_PRIORITY_HIGH);
+
+        for (i = 0; i < n; i++) {
+            band.failed |= bands[i].failed;
+        }
+    }
+
+    resize_filter_free(&fx);
+    resize_filter_free(&fy);
+
+    if (band.failed) {
+        OPENDCP_LOG(LOG_ERROR, "unable to allocate memory for conform buffer");
+        opendcp_image_free(d_image);
+        return OPENDCP_ERROR;
+    }
+
+    opendcp_image_free(*image);
+    *image = d_image;
+
+    return OPENDCP_NO_ERROR;
+}
@@ -19,10 +19,30 @@
 #ifndef _OPENDCP_IMAGE_H_
 #define _OPENDCP_IMAGE_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/* planes in a slab start on this boundary */
+#define OPENDCP_IMAGE_ALIGN 64
+
+enum SAMPLE_TYPE {
+    SAMPLE_TYPE_INT32 = 0,  /* int samples, the layout the encoders read */
+    SAMPLE_TYPE_UINT16,     /* unsigned 16-bit samples, for sources up to 16 bits */
+    SAMPLE_TYPE_FLOAT       /* float samples, for linear light sources */
+};
+
+/* interleaved layouts of xyz_to_rgb_pack */
+enum RGB_PACK_FORMAT {
+    RGB_PACK_RGB32 = 0,     /* 32-bit words 0xffRRGGBB, QImage::Format_RGB32 */
+    RGB_PACK_RGB24,         /* 8-bit r, g, b, QImage::Format_RGB888 */
+    RGB_PACK_RGB30,         /* 32-bit words 0xc0000000 | r << 20 | g << 10 | b, QImage::Format_RGB30 */
+    RGB_PACK_RGB48          /* 16-bit r, g, b in host order, for 16-bit file writers */
+};
+
 enum SAMPLE_METHOD {
     SAMPLE_NONE = 0,
     NEAREST_PIXEL,
@@ -41,10 +61,21 @@ typedef struct {
     float z;
 } xyz_pixel_float_t;
 
+/* xyz samples of a frame as the conversion left them, tallied when opendcp_xyz_stats is enabled */
+typedef struct {
+    int                min[3];    /* smallest code per component */
+    int                max[3];    /* largest code per component */
+    unsigned long long low[3];    /* samples below the container, clamped to it by the float method */
+    unsigned long long high[3];   /* samples at or over the peak of the container, code 4095 */
+    unsigned long long samples;   /* pixels tallied */
+} opendcp_xyz_stats_t;
+
 typedef struct {
     int component_number;   /* compoenent number                    */
     int *data;              /* int data. use for integer image data */
     float *float_data;      /* float data, use for float image data */
+    uint16_t *data16;       /* 16-bit data, use for uint16 image data */
+    int stride;             /* samples between the start of two rows */
 } opendcp_image_component_t;
 
 typedef struct {
@@ -62,16 +93,100 @@ typedef struct {
     opendcp_image_component_t *component;
     int n_components;
     unsigned char use_float;      /* flag for use float */
+    int sample_type;              /* SAMPLE_TYPE of the component data */
+    void *slab;                   /* single aligned allocation holding all planes */
+    size_t slab_size;             /* size of the slab in bytes */
+    int slab_pages;               /* HUGE_PAGES kind backing the slab, HUGE_PAGES_NONE when aligned malloc */
+    int node;                     /* numa node of the thread that allocated the slab, -1 if unbound */
+    int xyz_rows;                 /* rows already color converted while decoding */
+    opendcp_xyz_stats_t xyz_stats; /* clipping of the xyz conversion of the image */
 } opendcp_image_t;
 
+/* sample accessor for any sample type, float samples are scaled to precision */
+static inline int opendcp_image_get_sample(const opendcp_image_t *image, int c, int x, int y) {
+    const opendcp_image_component_t *component = &image->component[c];
+    int i = x + (component->stride * y);
+
+    switch (image->sample_type) {
+        case SAMPLE_TYPE_UINT16:
+            return component->data16[i];
+        case SAMPLE_TYPE_FLOAT:
+            return (int)(component->float_data[i] * ((1 << image->precision) - 1) + 0.5f);
+        default:
+            return component->data[i];
+    }
+}
+
+static inline void opendcp_image_set_sample(opendcp_image_t *image, int c, int x, int y, int v) {
+    opendcp_image_component_t *component = &image->component[c];
+    int i = x + (component->stride * y);
+
+    switch (image->sample_type) {
+        case SAMPLE_TYPE_UINT16:
+            component->data16[i] = (uint16_t)v;
+            break;
+        case SAMPLE_TYPE_FLOAT:
+            component->float_data[i] = (float)v / ((1 << image->precision) - 1);
+            break;
+        default:
+            component->data[i] = v;
+            break;
+    }
+}
+
 int  read_image(opendcp_image_t **image, char *file);
 void opendcp_image_free(opendcp_image_t *image);
 int opendcp_image_size(opendcp_image_t *opendcp_image);
 int  opendcp_image_readline(opendcp_image_t *image, int y, unsigned char *data);
+int  opendcp_image_readrows(opendcp_image_t *image, int y, int rows, unsigned char *dbuffer);
 int  rgb_to_xyz(opendcp_image_t *image, int gamma, int method);
 int  resize(opendcp_image_t **image, int profile, int method);
+int  letterbox(opendcp_image_t **image, int w, int h);
+opendcp_image_t *opendcp_image_halve(const opendcp_image_t *image);
+int  xyz_to_rgb(opendcp_image_t *image, int index);
+int  xyz_to_rgb_pack(const opendcp_image_t *image, int index, int format, unsigned char *dst, int stride);
+int  rgb_to_xyz_band(opendcp_image_t *image, int profile, int index, int method, int y0, int y1);
+int  conform_image(opendcp_image_t **image, int profile, int method, int xyz, int index, int xyz_method);
+void opendcp_xyz_stats(int enable);
+int  opendcp_xyz_stats_enabled(void);
+void opendcp_xyz_stats_reset(opendcp_xyz_stats_t *stats);
+
+/* taps of one direction of the gpu conform stage */
+typedef struct {
+    int         taps;     /* taps per destination sample */
+    const int   *index;   /* source sample of each tap */
+    const float *weight;  /* weight of each tap */
+} opendcp_gpu_filter_t;
+
+int  opendcp_gpu_conform(const opendcp_image_t *src, opendcp_image_t *dst, const opendcp_gpu_filter_t *fx, const opendcp_gpu_filter_t *fy,
+                         const float *lut_in, const uint16_t *lut_out, const float *matrix);
+
 rgb_pixel_float_t yuv444toRGB888(int y, int cb, int cr);
+int  ycbcr_to_rgb(opendcp_image_t *image, int start, int end, int bits);
 opendcp_image_t *opendcp_image_create(int n_components, int w, int h);
+opendcp_image_t *opendcp_image_create_float(int n_components, int w, int h);
+opendcp_image_t *opendcp_image_create_type(int n_components, int w, int h, int sample_type);
+int  opendcp_image_to_int(opendcp_image_t *image);
+int  opendcp_image_to_precision(opendcp_image_t *image, int precision);
+void opendcp_image_get_row(const opendcp_image_t *image, int c, int y, int *row);
+void opendcp_image_set_row(opendcp_image_t *image, int c, int y, const int *row);
+void opendcp_image_destroy(opendcp_image_t *image);
+
+/* image pool counters */
+typedef struct {
+    unsigned long hits;       /* requests served from the pool    */
+    unsigned long misses;     /* requests that allocated an image */
+    unsigned long released;   /* freed images kept by the pool    */
+    unsigned long discarded;  /* pooled images freed for room     */
+} opendcp_image_pool_stats_t;
+
+opendcp_image_t *opendcp_image_pool_get(int n_components, size_t slab_size);
+int  opendcp_image_pool_put(opendcp_image_t *image);
+void opendcp_image_pool_flush();
+void opendcp_image_pool_stats(opendcp_image_pool_stats_t *stats);
+int  rgb_to_xyz_float(opendcp_image_t *image, int index);
+int  resize_float(opendcp_image_t **image, int profile, int method);
+int  opendcp_image_float_to_int(opendcp_image_t *image);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,209 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "opendcp.h"
+#include "opendcp_image.h"
+
+/*
+   Freed images are kept with their slab and handed back out to the next
+   request with the same slab size and component count. Each thread keeps
+   a small list of its own, so a thread that frees and allocates frames
+   (decode then resize) never takes a lock. When that list is full, or the
+   thread exits, images move to a shared list; beyond that they are freed.
+   Threads bound to a numa node only take shared images from their node.
+*/
+#define POOL_THREAD_MAX 1
+#define POOL_SHARED_MAX 8
+
+typedef struct {
+    opendcp_image_t *image[POOL_THREAD_MAX];
+    int             count;
+} pool_thread_t;
+
+static pthread_once_t  pool_once  = PTHREAD_ONCE_INIT;
+static pthread_key_t   pool_key;
+static pthread_mutex_t pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+static opendcp_image_t *pool_shared[POOL_SHARED_MAX];
+static int             pool_shared_count = 0;
+static opendcp_image_pool_stats_t pool_stats;
+
+static void pool_stat_add(unsigned long *counter) {
+    __sync_fetch_and_add(counter, 1);
+}
+
+/* move an image to the shared list, returns OPENDCP_ERROR when it is full */
+static int pool_shared_put(opendcp_image_t *image) {
+    int result = OPENDCP_ERROR;
+
+    pthread_mutex_lock(&pool_mutex);
+
+    if (pool_shared_count < POOL_SHARED_MAX) {
+        pool_shared[pool_shared_count++] = image;
+        result = OPENDCP_NO_ERROR;
+    }
+
+    pthread_mutex_unlock(&pool_mutex);
+
+    return result;
+}
+
+/* thread exit, hand the cached images to the shared list */
+static void pool_thread_release(void *arg) {
+    pool_thread_t *cache = arg;
+    int i;
+
+    for (i = 0; i < cache->count; i++) {
+        if (pool_shared_put(cache->image[i]) != OPENDCP_NO_ERROR) {
+            pool_stat_add(&pool_stats.discarded);
+            opendcp_image_destroy(cache->image[i]);
+        }
+    }
+
+    free(cache);
+}
+
+static void pool_init(void) {
+    pthread_key_create(&pool_key, pool_thread_release);
+}
+
+static pool_thread_t *pool_thread(void) {
+    pool_thread_t *cache;
+
+    pthread_once(&pool_once, pool_init);
+
+    cache = pthread_getspecific(pool_key);
+
+    if (!cache) {
+        cache = calloc(1, sizeof(pool_thread_t));
+
+        if (cache) {
+            pthread_setspecific(pool_key, cache);
+        }
+    }
+
+    return cache;
+}
+
+static int pool_match(opendcp_image_t *image, int n_components, size_t slab_size) {
+    return image->n_components == n_components && image->slab_size == slab_size;
+}
+
+opendcp_image_t *opendcp_image_pool_get(int n_components, size_t slab_size) {
+    pool_thread_t   *cache = pool_thread();
+    opendcp_image_t *image = NULL;
+    int i, node;
+
+    if (cache) {
+        for (i = 0; i < cache->count; i++) {
+            if (pool_match(cache->image[i], n_components, slab_size)) {
+                image = cache->image[i];
+                cache->image[i] = cache->image[--cache->count];
+                pool_stat_add(&pool_stats.hits);
+                return image;
+            }
+        }
+    }
+
+    node = opendcp_numa_node();
+
+    pthread_mutex_lock(&pool_mutex);
+
+    for (i = 0; i < pool_shared_count; i++) {
+        if (pool_match(pool_shared[i], n_components, slab_size) && pool_shared[i]->node == node) {
+            image = pool_shared[i];
+            pool_shared[i] = pool_shared[--pool_shared_count];
+            break;
+        }
+    }
+
+    pthread_mutex_unlock(&pool_mutex);
+
+    pool_stat_add(image ? &pool_stats.hits : &pool_stats.misses);
+
+    return image;
+}
+
+int opendcp_image_pool_put(opendcp_image_t *image) {
+    pool_thread_t *cache;
+
+    if (!image->slab) {
+        return OPENDCP_ERROR;
+    }
+
+    cache = pool_thread();
+
+    if (cache) {
+        /* push the oldest entry out to the shared list to make room */
+        if (cache->count == POOL_THREAD_MAX) {
+            if (pool_shared_put(cache->image[0]) != OPENDCP_NO_ERROR) {
+                pool_stat_add(&pool_stats.discarded);
+                opendcp_image_destroy(cache->image[0]);
+            }
+
+            memmove(&cache->image[0], &cache->image[1], (POOL_THREAD_MAX - 1) * sizeof(opendcp_image_t *));
+            cache->count--;
+        }
+
+        cache->image[cache->count++] = image;
+        pool_stat_add(&pool_stats.released);
+        return OPENDCP_NO_ERROR;
+    }
+
+    if (pool_shared_put(image) == OPENDCP_NO_ERROR) {
+        pool_stat_add(&pool_stats.released);
+        return OPENDCP_NO_ERROR;
+    }
+
+    return OPENDCP_ERROR;
+}
+
+void opendcp_image_pool_flush() {
+    pool_thread_t   *cache;
+    opendcp_image_t *shared[POOL_SHARED_MAX];
+    int i, count;
+
+    cache = pool_thread();
+
+    if (cache) {
+        for (i = 0; i < cache->count; i++) {
+            opendcp_image_destroy(cache->image[i]);
+        }
+
+        cache->count = 0;
+    }
+
+    pthread_mutex_lock(&pool_mutex);
+    count = pool_shared_count;
+    memcpy(shared, pool_shared, count * sizeof(opendcp_image_t *));
+    pool_shared_count = 0;
+    pthread_mutex_unlock(&pool_mutex);
+
+    for (i = 0; i < count; i++) {
+        opendcp_image_destroy(shared[i]);
+    }
+}
+
+void opendcp_image_pool_stats(opendcp_image_pool_stats_t *stats) {
+    stats->hits      = __sync_fetch_and_add(&pool_stats.hits, 0);
+    stats->misses    = __sync_fetch_and_add(&pool_stats.misses, 0);
+    stats->released  = __sync_fetch_and_add(&pool_stats.released, 0);
+    stats->discarded = __sync_fetch_and_add(&pool_stats.discarded, 0);
+}
@@ -20,68 +20,422 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <libgen.h>
+#include <pthread.h>
+#include <sys/stat.h>
 #include "opendcp.h"
 #include "opendcp_encoder.h"
+#include "codecs/opendcp_decoder.h"
+#include "opendcp_queue.h"
+#include "opendcp_reader.h"
+#include "opendcp_frame_cache.h"
 
-int convert_to_j2k(opendcp_t *opendcp, char *sfile, char *dfile) {
-    opendcp_image_t *opendcp_image;
-    opendcp_encoder_t *encoder;
-    char *extension;
-    int result = 0;
+#define J2K_BATCH_MAX 16
+#define J2K_LANES_MAX 8
+
+/* a frame travelling through the conversion pipeline */
+typedef struct {
+    j2k_frame_t     *frame;
+    opendcp_image_t *image;
+    unsigned char   *codestream;  /* encoded frame, mxf and frame store mode only */
+    int             length;
+    unsigned char   *codestream_2k; /* the frame encoded again at half size for the 2K track */
+    int             length_2k;
+    int             ready;        /* codestream waiting in the reorder buffer */
+    int             cached;       /* codestream comes from the frame cache */
+    int             repeats;      /* identical frames that follow and reuse this codestream */
+    int             repeated;     /* this frame is a repeat of an earlier one */
+    char            key[OPENDCP_FRAME_CACHE_KEY_LENGTH];
+} j2k_job_t;
+
+/* the decisions that hold for every frame of a job, made once before the first frame.
+   frames of another size than the first are resolved on their own, or fail in strict mode */
+typedef struct {
+    opendcp_encoder_t *encoder;     /* picked by the extension of the first output file */
+    opendcp_decoder_t *decoder;     /* decoder of every input file, NULL when their extensions differ */
+    int               xyz;          /* the built-in rgb->xyz is done here, see j2k_xyz_local */
+    int               reduce;       /* jpeg2000 sources are decoded at half resolution, -1 to probe each frame */
+    int               strict;       /* j2k.strict_plan, frames must match the first one */
+    int               w;            /* decoded size of the first frame conformed, 0 until then */
+    int               h;
+    int               compliant;    /* a frame of that size fits the container as it is */
+    pthread_mutex_t   mutex;
+} j2k_plan_t;
+
+typedef struct j2k_pipeline j2k_pipeline_t;
+
+/* reader, conform and encoder stages for a share of the frames, there is a lane per numa node */
+typedef struct {
+    j2k_pipeline_t    *pipeline;
+    int               node;         /* numa node the lane threads run on, -1 when unbound */
+    int               next;
+    int               *map;         /* reader index to frame index */
+    int               misses;       /* frames the reader reads */
+    opendcp_queue_t   *decoded;
+    opendcp_queue_t   *conformed;
+    opendcp_reader_t  *reader;
+} j2k_lane_t;
+
+struct j2k_pipeline {
+    opendcp_t         *opendcp;
+    j2k_plan_t        plan;
+    j2k_job_t         *jobs;
+    int               nframes;
+    int               cancel;
+    int               errors;
+    pthread_mutex_t   mutex;
+    opendcp_queue_t   *encoded;
+    j2k_mxf_writer_t  **mxf;        /* a writer per reel */
+    j2k_mxf_writer_t  *mxf_2k;      /* 2K track of a 4K conversion, the frames are halved after conform */
+    opendcp_t         *opendcp_2k;  /* options of the 2K encodes */
+    const int         *reel_end;    /* frame after the last frame of each reel */
+    int               nreels;
+    int               reel;         /* reel the writer stage is on */
+    opendcp_pack_t    *pack;
+    int               ordered;      /* codestreams go to the writer stage in track order */
+    int               written;
+    int               window;
+    pthread_cond_t    window_cond;
+    int               batch;        /* frames handed to the encoder at once */
+    int               lookup;       /* next frame to look up in the frame cache */
+    int               threads;      /* shared by frame and intra-frame encoder threads */
+    int               encoders;     /* encoder threads over all lanes */
+    int               encoding;     /* encoder threads working on a frame */
+    int               busy;         /* threads used by the frames being encoded */
+    int               pending;      /* frames no encoder has taken yet */
+    int               end;          /* frames from here on are past the end of the input stream */
+    j2k_lane_t        lanes[J2K_LANES_MAX];
+    int               nlanes;
+};
+
+static opendcp_encoder_t *j2k_encoder(opendcp_t *opendcp, char *dfile) {
+    char *extension = "j2c";
+
+    if (dfile && strrchr(dfile, '.')) {
+        extension = strrchr(dfile, '.') + 1;
+    }
+
+    /* the shared encoder table is left alone, another job may be choosing too */
+    return opendcp_encoder_select(extension, opendcp->j2k.encoder);
+}
+
+/* a 4K jpeg2000 source going to a 2K container is decoded at half resolution
+   instead of decoding every level and resizing afterwards */
+static int j2k_read_reduce(opendcp_t *opendcp, opendcp_decoder_t *decoder, char *sfile) {
+    int  w, h, resolutions;
+
+    if (!opendcp->j2k.resize || opendcp->cinema_profile != DCP_CINEMA2K || !decoder) {
+        return 0;
+    }
+
+    if (decoder->id != OPENDCP_DECODER_OPENJPEG) {
+        return 0;
+    }
+
+    if (opendcp_openjpeg_info(sfile, &w, &h, &resolutions) != OPENDCP_NO_ERROR || resolutions < 2) {
+        return 0;
+    }
+
+    /* the halved image must itself fit the 2K container */
+    if ((w != MAX_WIDTH_2K * 2 && h != MAX_HEIGHT_2K * 2) ||
+        w > MAX_WIDTH_2K * 2 || h > MAX_HEIGHT_2K * 2 || (w % 4) || (h % 4)) {
+        return 0;
+    }
+
+    return 1;
+}
+
+/* the built-in rgb->xyz is done here unless a 3d lut replaces it or the remote encoder does it */
+static int j2k_xyz_local(opendcp_t *opendcp) {
+    return opendcp->j2k.xyz && !opendcp->j2k.cube &&
+           !(opendcp->j2k.encoder == OPENDCP_ENCODER_REMOTE && opendcp->remote.xyz);
+}
+
+/* apply the 3d lut when one is set, the image is freed on failure */
+static int j2k_cube(opendcp_t *opendcp, opendcp_image_t **image, char *sfile) {
+    if (!opendcp->j2k.cube) {
+        return OPENDCP_NO_ERROR;
+    }
+
+    OPENDCP_LOG(LOG_INFO, "3d lut color transform %s", basename(sfile));
+
+    if (opendcp_cube_apply(opendcp->j2k.cube, *image) != OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_ERROR, "3d lut color transform failed %s", basename(sfile));
+        opendcp_image_free(*image);
+        return OPENDCP_ERROR;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* decoder band callback, rows of int images that need no resize are converted while in cache.
+   the lut takes 16-bit sources as they are, so they are only reduced to 12 bits by the conversion */
+static void j2k_xyz_band(void *arg, opendcp_image_t *image, int y0, int y1) {
+    opendcp_t *opendcp = arg;
+
+    rgb_to_xyz_band(image, opendcp->cinema_profile, opendcp->j2k.lut, opendcp->j2k.xyz_method, y0, y1);
+}
+
+/* the decoder of a file, NULL when there is none for its extension */
+static opendcp_decoder_t *j2k_decoder(char *sfile) {
+    opendcp_decoder_t *decoder;
+    char              *extension = strrchr(sfile, '.');
+
+    if (!extension) {
+        return NULL;
+    }
+
+    decoder = opendcp_decoder_find(NULL, extension + 1, 0);
+
+    return decoder->id == OPENDCP_DECODER_NONE ? NULL : decoder;
+}
+
+/* make the plan of a job from its first frame */
+static int j2k_plan_build(opendcp_t *opendcp, j2k_plan_t *plan, j2k_frame_t *frames, int nframes) {
+    struct stat st;
+    int         i;
+
+    memset(plan, 0, sizeof(*plan));
+    plan->encoder = j2k_encoder(opendcp, frames[0].out_file);
+    plan->decoder = j2k_decoder(frames[0].in_file);
+    plan->xyz     = j2k_xyz_local(opendcp);
+    plan->strict  = opendcp->j2k.strict_plan;
+
+    /* a sequence is normally one kind of file, a mixed one looks its decoders up per frame */
+    for (i = 1; i < nframes && plan->decoder; i++) {
+        if (j2k_decoder(frames[i].in_file) != plan->decoder) {
+            if (plan->strict) {
+                OPENDCP_LOG(LOG_ERROR, "%s is not a %s file like %s", basename(frames[i].in_file),
+                            plan->decoder->name, basename(frames[0].in_file));
+                return OPENDCP_ERROR;
+            }
+
+            plan->decoder = NULL;
+        }
+    }
+
+    /* only the first header is probed, the other frames are taken to be alike. sources
+       that are not local files yet, such as object storage frames, are probed as they are read */
+    if (plan->decoder && stat(frames[0].in_file, &st)) {
+        plan->reduce = -1;
+    }
+    else {
+        plan->reduce = plan->decoder && j2k_read_reduce(opendcp, plan->decoder, frames[0].in_file);
+    }
+
+    if (plan->reduce > 0) {
+        OPENDCP_LOG(LOG_INFO, "decoding the jpeg2000 sources at reduced resolution");
+    }
+
+    pthread_mutex_init(&plan->mutex, NULL);
+
+    return OPENDCP_NO_ERROR;
+}
+
+static void j2k_plan_free(j2k_plan_t *plan) {
+    pthread_mutex_destroy(&plan->mutex);
+}
+
+/* whether an image fits the container as it is. the first frame is checked
+   and reported, frames of the same size take its result */
+static int j2k_plan_compliant(opendcp_t *opendcp, j2k_plan_t *plan, opendcp_image_t *image, char *sfile) {
+    int compliant;
 
-    extension = strrchr(dfile, '.');
-    extension++;
+    pthread_mutex_lock(&plan->mutex);
 
-    if (opendcp_encoder_enable(extension, NULL, opendcp->j2k.encoder)) {
-        OPENDCP_LOG(LOG_ERROR, "could not enabled encoder");
+    if (!plan->w) {
+        plan->w         = image->w;
+        plan->h         = image->h;
+        plan->compliant = check_image_compliance(opendcp->cinema_profile, image, NULL) == OPENDCP_NO_ERROR;
     }
 
-    encoder = opendcp_encoder_find(NULL, extension, 0);
-    OPENDCP_LOG(LOG_INFO, "using %s encoder (%s) to convert file %s to %s", encoder->name, extension, basename(sfile), basename(dfile));
+    if (image->w == plan->w && image->h == plan->h) {
+        compliant = plan->compliant;
+    }
+    else if (plan->strict) {
+        OPENDCP_LOG(LOG_ERROR, "%s is %dx%d, the first frame is %dx%d", basename(sfile), image->w, image->h, plan->w, plan->h);
+        compliant = -1;
+    }
+    else {
+        compliant = check_image_compliance(opendcp->cinema_profile, image, NULL) == OPENDCP_NO_ERROR;
+    }
+
+    pthread_mutex_unlock(&plan->mutex);
+
+    return compliant;
+}
+
+static int j2k_read(opendcp_t *opendcp, j2k_plan_t *plan, char *sfile, opendcp_image_t **image) {
+    opendcp_decoder_band_t band = { j2k_xyz_band, opendcp, opendcp->j2k.xyz_method == XYZ_METHOD_CALCULATE ? 12 : 16 };
+    int result;
 
     OPENDCP_LOG(LOG_DEBUG, "reading input file %s", basename(sfile));
-    result = read_image(&opendcp_image, sfile);
+
+    if (plan->reduce > 0 || (plan->reduce < 0 && j2k_read_reduce(opendcp, plan->decoder, sfile))) {
+        OPENDCP_LOG(LOG_DEBUG, "decoding %s at reduced resolution", basename(sfile));
+        result = opendcp_decode_openjpeg_reduced(image, sfile, 1, 0, 0, 0, 0);
+    }
+    else {
+        if (plan->xyz) {
+            opendcp_decoder_band_set(&band);
+        }
+
+        if (plan->decoder) {
+            result = plan->decoder->decode(image, sfile);
+            result = result == OPENDCP_NO_ERROR || result == OPENDCP_STREAM_END ? result : OPENDCP_ERROR;
+        }
+        else {
+            result = read_image(image, sfile);
+        }
+
+        if (plan->xyz) {
+            opendcp_decoder_band_set(NULL);
+        }
+    }
+
+    if (result == OPENDCP_STREAM_END) {
+        return result;
+    }
 
     if (result != OPENDCP_NO_ERROR) {
         OPENDCP_LOG(LOG_ERROR, "unable to read file %s", basename(sfile));
         return OPENDCP_ERROR;
     }
 
-    if (!opendcp_image) {
+    if (!*image) {
         OPENDCP_LOG(LOG_ERROR, "could not load image");
         return OPENDCP_ERROR;
     }
 
+    return OPENDCP_NO_ERROR;
+}
+
+/* record the clipping the xyz conversion tallied into the image */
+static void j2k_gamut(opendcp_t *opendcp, opendcp_image_t *image, char *sfile) {
+    if (opendcp_gamut_record(opendcp->j2k.gamut, sfile, image) != OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_WARN, "gamut of %s not recorded", basename(sfile));
+    }
+}
+
+/* resize and color convert an image, the image is freed on failure */
+static int j2k_conform(opendcp_t *opendcp, j2k_plan_t *plan, opendcp_image_t **image, char *sfile) {
+    unsigned long long start;
+    int xyz = plan->xyz;
+    int compliant;
+
+    /* 16-bit images are widened until every stage reads them directly */
+    if ((*image)->sample_type == SAMPLE_TYPE_UINT16) {
+        if (opendcp_image_to_int(*image) != OPENDCP_NO_ERROR) {
+            opendcp_image_free(*image);
+            return OPENDCP_ERROR;
+        }
+    }
+
     /* verify image is dci compliant */
-    if (check_image_compliance(opendcp->cinema_profile, opendcp_image, NULL) != OPENDCP_NO_ERROR) {
+    compliant = j2k_plan_compliant(opendcp, plan, *image, sfile);
+
+    if (compliant < 0) {
+        opendcp_image_free(*image);
+        return OPENDCP_ERROR;
+    }
+
+    if (!compliant) {
+
+        /* int images are resized and color converted in one pass */
+        if (opendcp->j2k.resize && !(*image)->use_float) {
+            start = opendcp_metrics_now();
+            opendcp_image_to_precision(*image, 12);
+
+            if (conform_image(image, opendcp->cinema_profile, opendcp->j2k.resize, xyz,
+                              opendcp->j2k.lut, opendcp->j2k.xyz_method) != OPENDCP_NO_ERROR) {
+                OPENDCP_LOG(LOG_ERROR, "conform failed %s", basename(sfile));
+                opendcp_image_free(*image);
+                return OPENDCP_ERROR;
+            }
+
+            opendcp_metrics_record(opendcp->metrics, METRIC_RESIZE, start, 0);
+            j2k_gamut(opendcp, *image, sfile);
+
+            return j2k_cube(opendcp, image, sfile);
+        }
 
         /* resize image */
         if (opendcp->j2k.resize) {
-            if (resize(&opendcp_image, opendcp->cinema_profile, opendcp->j2k.resize) != OPENDCP_NO_ERROR) {
-                opendcp_image_free(opendcp_image);
+            start = opendcp_metrics_now();
+
+            if (resize_float(image, opendcp->cinema_profile, opendcp->j2k.resize) != OPENDCP_NO_ERROR) {
+                opendcp_image_free(*image);
                 return OPENDCP_ERROR;
             }
+
+            opendcp_metrics_record(opendcp->metrics, METRIC_RESIZE, start, 0);
         }
         else {
-            OPENDCP_LOG(LOG_WARN, "the image resolution of %s is not DCI compliant", sfile);
-            opendcp_image_free(opendcp_image);
+            OPENDCP_LOG(LOG_WARN, "the image resolution of %s is not DCI compliant", basename(sfile));
+            opendcp_image_free(*image);
             return OPENDCP_ERROR;
         }
     }
 
-    if (opendcp->j2k.xyz) {
+    start = opendcp_metrics_now();
+
+    /* float images are converted and quantized to 12-bit in place */
+    if ((*image)->use_float) {
+        int result;
+
+        if (opendcp->j2k.xyz && !opendcp->j2k.cube) {
+            OPENDCP_LOG(LOG_INFO, "RGB->XYZ color conversion %s (float data)", basename(sfile));
+            result = rgb_to_xyz_float(*image, opendcp->j2k.lut);
+        }
+        else {
+            result = opendcp_image_float_to_int(*image);
+        }
+
+        if (result != OPENDCP_NO_ERROR) {
+            OPENDCP_LOG(LOG_ERROR, "color conversion failed %s", basename(sfile));
+            opendcp_image_free(*image);
+            return OPENDCP_ERROR;
+        }
+    }
+    else if (xyz && (*image)->xyz_rows == (*image)->h) {
+        OPENDCP_LOG(LOG_DEBUG, "RGB->XYZ color conversion %s done while decoding", basename(sfile));
+    }
+    else if (xyz && (*image)->xyz_rows) {
+        OPENDCP_LOG(LOG_ERROR, "color conversion of %s stopped at %d of %d rows", basename(sfile), (*image)->xyz_rows, (*image)->h);
+        opendcp_image_free(*image);
+        return OPENDCP_ERROR;
+    }
+    else if (xyz) {
         OPENDCP_LOG(LOG_INFO, "RGB->XYZ color conversion %s", basename(sfile));
 
-        if (rgb_to_xyz(opendcp_image, opendcp->j2k.lut, opendcp->j2k.xyz_method)) {
+        if (rgb_to_xyz(*image, opendcp->j2k.lut, opendcp->j2k.xyz_method)) {
             OPENDCP_LOG(LOG_ERROR, "color conversion failed %s", basename(sfile));
-            opendcp_image_free(opendcp_image);
+            opendcp_image_free(*image);
             return OPENDCP_ERROR;
         }
     }
+    /* sources kept at 16 bits go to the encoders as 12-bit samples */
+    else {
+        opendcp_image_to_precision(*image, 12);
+    }
+
+    j2k_gamut(opendcp, *image, sfile);
+
+    if (j2k_cube(opendcp, image, sfile) != OPENDCP_NO_ERROR) {
+        return OPENDCP_ERROR;
+    }
+
+    if ((*image)->use_float || opendcp->j2k.xyz || opendcp->j2k.cube) {
+        opendcp_metrics_record(opendcp->metrics, METRIC_XYZ, start, 0);
+    }
+
+    return OPENDCP_NO_ERROR;
+}
 
-    result = encoder->encode(opendcp, opendcp_image, dfile);
+/* encode an image, the caller frees it */
+static int j2k_encode(opendcp_t *opendcp, opendcp_encoder_t *encoder, opendcp_image_t *image, char *sfile, char *dfile) {
+    int result;
 
-    opendcp_image_free(opendcp_image);
+    result = encoder->encode(opendcp, image, dfile);
 
     if ( result != OPENDCP_NO_ERROR) {
         OPENDCP_LOG(LOG_ERROR, "JPEG2000 conversion failed %s", basename(sfile));
@@ -90,3 +444,1644 @@ int convert_to_j2k(opendcp_t *opendcp, char *sfile, char *dfile) {
 
     return OPENDCP_NO_ERROR;
 }
+
+/* check an in-memory encode and write the codestream to dfile when set */
+static int j2k_encoded(opendcp_t *opendcp, int result, char *sfile, char *dfile, unsigned char *data, int length) {
+    FILE *fp;
+
+    if (result != OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_ERROR, "JPEG2000 conversion failed %s", basename(sfile));
+        return OPENDCP_ERROR;
+    }
+
+    if (dfile) {
+        fp = fopen(dfile, "wb");
+
+        if (!fp || fwrite(data, 1, length, fp) != (size_t)length) {
+            OPENDCP_LOG(LOG_ERROR, "could not write JPEG2000 file %s", dfile);
+            result = OPENDCP_ERROR;
+        }
+
+        if (fp) {
+            fclose(fp);
+        }
+
+        if (result == OPENDCP_NO_ERROR && opendcp->j2k.manifest) {
+            result = opendcp_manifest_add(opendcp->j2k.manifest, dfile, data, length);
+        }
+    }
+
+    return result;
+}
+
+/* read a JPEG2000 file into memory */
+static int j2k_read_codestream(char *file, unsigned char **data, int *length) {
+    FILE *fp;
+    long size;
+
+    fp = fopen(file, "rb");
+
+    if (!fp) {
+        OPENDCP_LOG(LOG_ERROR, "could not open JPEG2000 file %s", file);
+        return OPENDCP_ERROR;
+    }
+
+    fseek(fp, 0, SEEK_END);
+    size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+
+    *data = malloc(size > 0 ? size : 1);
+
+    if (!*data || size <= 0 || fread(*data, 1, size, fp) != (size_t)size) {
+        OPENDCP_LOG(LOG_ERROR, "could not read JPEG2000 file %s", file);
+        free(*data);
+        *data = NULL;
+        fclose(fp);
+        return OPENDCP_ERROR;
+    }
+
+    fclose(fp);
+    *length = size;
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* encode an image into memory, the codestream is also written to dfile when set */
+static int j2k_encode_buffer(opendcp_t *opendcp, opendcp_encoder_t *encoder, opendcp_image_t *image, char *sfile, char *dfile,
+                             unsigned char **data, int *length) {
+    int  result;
+
+    if (encoder->caps & OPENDCP_ENCODER_CAP_BUFFER) {
+        result = opendcp_encoder_encode_buffer(encoder, opendcp, image, data, length);
+        result = j2k_encoded(opendcp, result, sfile, dfile, *data, *length);
+
+        if (result != OPENDCP_NO_ERROR) {
+            free(*data);
+            *data = NULL;
+        }
+
+        return result;
+    }
+
+    /* external encoders only write files, read the codestream back */
+    if (!dfile) {
+        OPENDCP_LOG(LOG_ERROR, "%s encoder requires JPEG2000 output files", encoder->name);
+        return OPENDCP_ERROR;
+    }
+
+    if (j2k_encode(opendcp, encoder, image, sfile, dfile) != OPENDCP_NO_ERROR) {
+        return OPENDCP_ERROR;
+    }
+
+    if (j2k_read_codestream(dfile, data, length) != OPENDCP_NO_ERROR) {
+        return OPENDCP_ERROR;
+    }
+
+    if (opendcp->j2k.manifest && opendcp_manifest_add(opendcp->j2k.manifest, dfile, *data, *length) != OPENDCP_NO_ERROR) {
+        free(*data);
+        *data = NULL;
+        return OPENDCP_ERROR;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* encode an image to dfile, through memory when the codestream checksums are recorded */
+static int j2k_encode_file(opendcp_t *opendcp, opendcp_encoder_t *encoder, opendcp_image_t *image, char *sfile, char *dfile) {
+    unsigned char *data = NULL;
+    int           length = 0;
+    int           result;
+
+    if (!opendcp->j2k.manifest) {
+        return j2k_encode(opendcp, encoder, image, sfile, dfile);
+    }
+
+    result = j2k_encode_buffer(opendcp, encoder, image, sfile, dfile, &data, &length);
+    free(data);
+
+    return result;
+}
+
+int convert_to_j2k(opendcp_t *opendcp, char *sfile, char *dfile) {
+    opendcp_image_t *opendcp_image;
+    j2k_frame_t     frame = { sfile, dfile, OPENDCP_NO_ERROR };
+    j2k_plan_t      plan;
+    int result;
+
+    if (j2k_plan_build(opendcp, &plan, &frame, 1) != OPENDCP_NO_ERROR) {
+        return OPENDCP_ERROR;
+    }
+
+    OPENDCP_LOG(LOG_INFO, "using %s encoder to convert file %s to %s", plan.encoder->name, basename(sfile), basename(dfile));
+
+    result = j2k_read(opendcp, &plan, sfile, &opendcp_image);
+
+    if (result == OPENDCP_NO_ERROR) {
+        result = j2k_conform(opendcp, &plan, &opendcp_image, sfile);
+    }
+
+    if (result == OPENDCP_NO_ERROR) {
+        result = j2k_encode_file(opendcp, plan.encoder, opendcp_image, sfile, dfile);
+        opendcp_image_free(opendcp_image);
+    }
+
+    j2k_plan_free(&plan);
+
+    return result == OPENDCP_NO_ERROR ? OPENDCP_NO_ERROR : OPENDCP_ERROR;
+}
+
+/*!
+ @function convert_from_j2k
+ @abstract Decodes a JPEG2000 codestream to an image file.
+ @discussion Used to review the frames of a picture track. The frame is
+     decoded at mxf.extract_reduce and converted back to the RGB of
+     j2k.lut unless mxf.extract_xyz is set. The encoder is picked by the
+     extension of the output file, tif or dpx. May be called from several
+     threads at once.
+ @param opendcp The options.
+ @param data The codestream.
+ @param length The length of the codestream in bytes.
+ @param out_file The image file to write.
+ @return OPENDCP_NO_ERROR or OPENDCP_ERROR.
+*/
+int convert_from_j2k(opendcp_t *opendcp, const unsigned char *data, int length, char *out_file) {
+    opendcp_image_t   *image;
+    opendcp_encoder_t *encoder;
+    char              *ext = strrchr(out_file, '.');
+    int               result;
+
+    encoder = opendcp_encoder_find(NULL, ext ? ext + 1 : "", 0);
+
+    if (encoder->id != OPENDCP_ENCODER_TIFF && encoder->id != OPENDCP_ENCODER_DPX) {
+        OPENDCP_LOG(LOG_ERROR, "frames can only be decoded to tif or dpx images, not %s", out_file);
+        return OPENDCP_ERROR;
+    }
+
+    if (opendcp_decode_openjpeg_buffer(&image, data, length, opendcp->mxf.extract_reduce) != OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_ERROR, "could not decode frame %s", out_file);
+        return OPENDCP_ERROR;
+    }
+
+    if (!opendcp->mxf.extract_xyz && xyz_to_rgb(image, opendcp->j2k.lut) != OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_ERROR, "could not convert frame %s to rgb", out_file);
+        opendcp_image_free(image);
+        return OPENDCP_ERROR;
+    }
+
+    result = encoder->encode(opendcp, image, out_file);
+    opendcp_image_free(image);
+
+    return result;
+}
+
+/* pipeline->mutex held, picks up a cancel requested through opendcp->j2k.cancel */
+static int j2k_pipeline_stopped(j2k_pipeline_t *pipeline) {
+    if (pipeline->opendcp->j2k.cancel && !pipeline->cancel) {
+        pipeline->cancel = 1;
+        pthread_cond_broadcast(&pipeline->window_cond);
+    }
+
+    return pipeline->cancel;
+}
+
+static int j2k_pipeline_cancelled(j2k_pipeline_t *pipeline) {
+    int cancel;
+
+    pthread_mutex_lock(&pipeline->mutex);
+    cancel = j2k_pipeline_stopped(pipeline);
+    pthread_mutex_unlock(&pipeline->mutex);
+
+    return cancel;
+}
+
+static void j2k_pipeline_done(j2k_pipeline_t *pipeline, j2k_job_t *job, int result);
+
+/* repeats of a frame get a copy of its JPEG2000 file, the writer stage repeats frames itself */
+static void j2k_pipeline_repeat(j2k_pipeline_t *pipeline, j2k_job_t *job, int result) {
+    unsigned char *data = NULL;
+    int           length = 0;
+    int           i, copied;
+
+    if (result == OPENDCP_NO_ERROR && job->frame->out_file) {
+        result = j2k_read_codestream(job->frame->out_file, &data, &length);
+    }
+
+    for (i = 1; i <= job->repeats; i++) {
+        copied = result;
+
+        if (copied == OPENDCP_NO_ERROR && job[i].frame->out_file) {
+            copied = j2k_encoded(pipeline->opendcp, copied, job[i].frame->in_file, job[i].frame->out_file, data, length);
+        }
+
+        j2k_pipeline_done(pipeline, &job[i], copied);
+    }
+
+    free(data);
+}
+
+/* record the result of a frame and notify the caller, callbacks are serialized */
+static void j2k_pipeline_done(j2k_pipeline_t *pipeline, j2k_job_t *job, int result) {
+    opendcp_cb_t *cb = &pipeline->opendcp->j2k.frame_done;
+
+    if (job->repeats && !pipeline->ordered) {
+        j2k_pipeline_repeat(pipeline, job, result);
+    }
+
+    pthread_mutex_lock(&pipeline->mutex);
+
+    job->frame->result = result;
+
+    if (result != OPENDCP_NO_ERROR) {
+        pipeline->errors++;
+
+        /* an mxf track or frame store can not have gaps, stop at the first failure */
+        if (pipeline->ordered) {
+            pipeline->cancel = 1;
+        }
+    }
+
+    if (cb->callback && cb->callback(cb->argument)) {
+        pipeline->cancel = 1;
+    }
+
+    if (pipeline->cancel) {
+        pthread_cond_broadcast(&pipeline->window_cond);
+    }
+
+    pthread_mutex_unlock(&pipeline->mutex);
+}
+
+/* add a freshly encoded frame to the frame cache */
+static void j2k_pipeline_cache(j2k_pipeline_t *pipeline, j2k_job_t *job) {
+    if (!job->key[0] || !pipeline->opendcp->j2k.cache_dir) {
+        return;
+    }
+
+    if (job->codestream) {
+        opendcp_frame_cache_put(pipeline->opendcp, job->key, job->codestream, job->length);
+    } else if (job->frame->out_file) {
+        opendcp_frame_cache_put_file(pipeline->opendcp, job->key, job->frame->out_file);
+    }
+}
+
+/* lookup stage: hashes the sources, frames found in the cache or repeating the frame before are not read or encoded */
+static void *j2k_pipeline_lookup(void *arg) {
+    j2k_pipeline_t *pipeline = arg;
+    j2k_job_t      *job;
+    int            index;
+
+    while (!j2k_pipeline_cancelled(pipeline)) {
+        pthread_mutex_lock(&pipeline->mutex);
+        index = pipeline->lookup++;
+        pthread_mutex_unlock(&pipeline->mutex);
+
+        if (index >= pipeline->nframes) {
+            break;
+        }
+
+        job = &pipeline->jobs[index];
+
+        if (opendcp_frame_cache_key(pipeline->opendcp, pipeline->plan.encoder->name, job->frame->in_file, job->key) != OPENDCP_NO_ERROR) {
+            job->key[0] = '\0';
+            continue;
+        }
+
+        if (!pipeline->opendcp->j2k.cache_dir || !opendcp_frame_cache_exists(pipeline->opendcp, job->key)) {
+            continue;
+        }
+
+        if (job->frame->out_file &&
+            opendcp_frame_cache_restore(pipeline->opendcp, job->key, job->frame->out_file) != OPENDCP_NO_ERROR) {
+            continue;
+        }
+
+        OPENDCP_LOG(LOG_DEBUG, "reusing cached frame for %s", basename(job->frame->in_file));
+        job->cached = 1;
+
+        if (pipeline->ordered) {
+            job->ready = 1;
+        } else {
+            j2k_pipeline_done(pipeline, job, OPENDCP_NO_ERROR);
+        }
+    }
+
+    return NULL;
+}
+
+/* lane threads run on the lane node, the reader threads bind on their first frame */
+static void j2k_lane_bind(j2k_lane_t *lane) {
+    if (lane->node >= 0 && opendcp_numa_node() != lane->node) {
+        opendcp_numa_bind(lane->node);
+    }
+}
+
+static int j2k_pipeline_decode(void *arg, char *file, opendcp_image_t **image) {
+    j2k_lane_t         *lane = arg;
+    opendcp_t          *opendcp = lane->pipeline->opendcp;
+    unsigned long long start;
+    struct stat        st;
+    int                result;
+
+    j2k_lane_bind(lane);
+
+    if (!opendcp->metrics) {
+        return j2k_read(opendcp, &lane->pipeline->plan, file, image);
+    }
+
+    start  = opendcp_metrics_now();
+    result = j2k_read(opendcp, &lane->pipeline->plan, file, image);
+    opendcp_metrics_record(opendcp->metrics, METRIC_READ, start, stat(file, &st) ? 0 : st.st_size);
+
+    return result;
+}
+
+/* reader stage: takes frames from the prefetching reader in order */
+static void *j2k_pipeline_reader(void *arg) {
+    j2k_lane_t      *lane = arg;
+    j2k_pipeline_t  *pipeline = lane->pipeline;
+    j2k_job_t       *job;
+    opendcp_image_t *image;
+    int             index, result;
+
+    j2k_lane_bind(lane);
+
+    while (1) {
+        pthread_mutex_lock(&pipeline->mutex);
+
+        /* in mxf and frame store mode keep the reorder buffer bounded */
+        while (pipeline->ordered && !j2k_pipeline_stopped(pipeline) && lane->next < lane->misses &&
+               lane->map[lane->next] >= pipeline->written + pipeline->window && lane->map[lane->next] < pipeline->end) {
+            pthread_cond_wait(&pipeline->window_cond, &pipeline->mutex);
+        }
+
+        if (j2k_pipeline_stopped(pipeline) || (lane->next < lane->misses && lane->map[lane->next] >= pipeline->end)) {
+            pthread_mutex_unlock(&pipeline->mutex);
+            break;
+        }
+
+        lane->next++;
+        pthread_mutex_unlock(&pipeline->mutex);
+
+        index = opendcp_reader_next(lane->reader, &image, &result);
+
+        if (index < 0) {
+            break;
+        }
+
+        job = &pipeline->jobs[lane->map[index]];
+        job->image = image;
+
+        /* the frames past the end of an input stream stay cancelled, the frames before are still written */
+        if (!image && result == OPENDCP_STREAM_END) {
+            pthread_mutex_lock(&pipeline->mutex);
+
+            if (lane->map[index] < pipeline->end) {
+                pipeline->end = lane->map[index];
+            }
+
+            pthread_cond_broadcast(&pipeline->window_cond);
+            pthread_mutex_unlock(&pipeline->mutex);
+            continue;
+        }
+
+        if (!image) {
+            j2k_pipeline_done(pipeline, job, OPENDCP_ERROR);
+            continue;
+        }
+
+        if (opendcp_queue_push(lane->decoded, job) != OPENDCP_NO_ERROR) {
+            opendcp_image_free(job->image);
+            break;
+        }
+    }
+
+    /* stop decoding frames nobody will take */
+    opendcp_reader_close(lane->reader);
+    opendcp_queue_producer_done(lane->decoded);
+
+    return NULL;
+}
+
+/* conform stage: resize and rgb->xyz */
+static void *j2k_pipeline_conform(void *arg) {
+    j2k_lane_t     *lane = arg;
+    j2k_pipeline_t *pipeline = lane->pipeline;
+    j2k_job_t      *job;
+
+    j2k_lane_bind(lane);
+
+    while ((job = opendcp_queue_pop(lane->decoded))) {
+        if (pipeline->opendcp->metrics) {
+            opendcp_metrics_depth(pipeline->opendcp->metrics, METRIC_RESIZE, opendcp_queue_length(lane->decoded) + 1);
+        }
+
+        if (j2k_pipeline_cancelled(pipeline)) {
+            opendcp_image_free(job->image);
+            continue;
+        }
+
+        if (j2k_conform(pipeline->opendcp, &pipeline->plan, &job->image, job->frame->in_file) != OPENDCP_NO_ERROR) {
+            job->image = NULL;
+            j2k_pipeline_done(pipeline, job, OPENDCP_ERROR);
+            continue;
+        }
+
+        if (opendcp_queue_push(lane->conformed, job) != OPENDCP_NO_ERROR) {
+            opendcp_image_free(job->image);
+        }
+    }
+
+    opendcp_queue_producer_done(lane->conformed);
+
+    return NULL;
+}
+
+/* decode a frame again and compare it with its source for the quality report, a
+   frame encoded to a file is read back */
+static void j2k_pipeline_measure(j2k_pipeline_t *pipeline, j2k_job_t *job, opendcp_image_t *image,
+                                 unsigned char *data, int length) {
+    opendcp_quality_t *quality = pipeline->opendcp->j2k.quality;
+    unsigned char     *file_data = NULL;
+
+    if (!quality) {
+        return;
+    }
+
+    if (!data) {
+        if (j2k_read_codestream(job->frame->out_file, &file_data, &length) != OPENDCP_NO_ERROR) {
+            return;
+        }
+
+        data = file_data;
+    }
+
+    opendcp_quality_measure(quality, job->frame->in_file, image, data, length);
+    free(file_data);
+}
+
+/* encoder stage for batch encoders: takes the frames that are ready, up to a batch */
+static void j2k_pipeline_encode_batch(j2k_pipeline_t *pipeline, opendcp_queue_t *queue) {
+    j2k_job_t       *jobs[J2K_BATCH_MAX];
+    opendcp_image_t *images[J2K_BATCH_MAX];
+    unsigned char   *data[J2K_BATCH_MAX];
+    int             lengths[J2K_BATCH_MAX];
+    int             results[J2K_BATCH_MAX];
+    int             result, n, i;
+    unsigned long long start;
+
+    while ((jobs[0] = opendcp_queue_pop(queue))) {
+        for (n = 1; n < pipeline->batch && (jobs[n] = opendcp_queue_try_pop(queue)); n++);
+
+        if (j2k_pipeline_cancelled(pipeline)) {
+            for (i = 0; i < n; i++) {
+                opendcp_image_free(jobs[i]->image);
+            }
+
+            continue;
+        }
+
+        for (i = 0; i < n; i++) {
+            images[i] = jobs[i]->image;
+            jobs[i]->image = NULL;
+        }
+
+        opendcp_session_acquire(pipeline->opendcp->session);
+        start = opendcp_metrics_now();
+        opendcp_encoder_encode_batch(pipeline->plan.encoder, pipeline->opendcp, images, n, data, lengths, results);
+        opendcp_session_release(pipeline->opendcp->session);
+
+        for (i = 0; i < n; i++) {
+            opendcp_metrics_record(pipeline->opendcp->metrics, METRIC_ENCODE, start, results[i] == OPENDCP_NO_ERROR ? lengths[i] : 0);
+        }
+
+        for (i = 0; i < n; i++) {
+            if (results[i] == OPENDCP_NO_ERROR) {
+                j2k_pipeline_measure(pipeline, jobs[i], images[i], data[i], lengths[i]);
+            }
+
+            opendcp_image_free(images[i]);
+            result = j2k_encoded(pipeline->opendcp, results[i], jobs[i]->frame->in_file, jobs[i]->frame->out_file, data[i], lengths[i]);
+
+            if (pipeline->ordered && result == OPENDCP_NO_ERROR) {
+                jobs[i]->codestream = data[i];
+                jobs[i]->length     = lengths[i];
+                j2k_pipeline_cache(pipeline, jobs[i]);
+
+                if (opendcp_queue_push(pipeline->encoded, jobs[i]) != OPENDCP_NO_ERROR) {
+                    free(jobs[i]->codestream);
+                    jobs[i]->codestream = NULL;
+                }
+
+                continue;
+            }
+
+            if (result == OPENDCP_NO_ERROR) {
+                j2k_pipeline_cache(pipeline, jobs[i]);
+            }
+
+            free(data[i]);
+            j2k_pipeline_done(pipeline, jobs[i], result);
+        }
+    }
+}
+
+/* gives a frame the threads that idle encoders leave unused, returns the count to hand back */
+static int j2k_pipeline_intra_start(j2k_pipeline_t *pipeline) {
+    int count = 1;
+
+    pthread_mutex_lock(&pipeline->mutex);
+
+    if (opendcp_encoder_has_threads(pipeline->plan.encoder)) {
+        count = opendcp_encoder_thread_share(pipeline->threads, pipeline->busy,
+                                             pipeline->encoders - pipeline->encoding, pipeline->pending);
+    }
+
+    pipeline->pending--;
+    pipeline->encoding++;
+    pipeline->busy += count;
+    pthread_mutex_unlock(&pipeline->mutex);
+
+    opendcp_encoder_threads(pipeline->plan.encoder, count);
+
+    return count;
+}
+
+static void j2k_pipeline_intra_end(j2k_pipeline_t *pipeline, int count) {
+    pthread_mutex_lock(&pipeline->mutex);
+    pipeline->encoding--;
+    pipeline->busy -= count;
+    pthread_mutex_unlock(&pipeline->mutex);
+}
+
+/* halve a conformed 4K frame and encode it for the 2K track, the 4K codestream is freed on failure */
+static int j2k_encode_2k(j2k_pipeline_t *pipeline, j2k_job_t *job) {
+    opendcp_image_t    *half;
+    unsigned long long start = opendcp_metrics_now();
+    int                result;
+
+    half = opendcp_image_halve(job->image);
+    opendcp_metrics_record(pipeline->opendcp->metrics, METRIC_RESIZE, start, 0);
+
+    if (!half) {
+        OPENDCP_LOG(LOG_ERROR, "could not scale %s down to 2K", basename(job->frame->in_file));
+        result = OPENDCP_ERROR;
+    }
+    else {
+        result = j2k_encode_buffer(pipeline->opendcp_2k, pipeline->plan.encoder, half, job->frame->in_file, NULL,
+                                   &job->codestream_2k, &job->length_2k);
+        opendcp_image_free(half);
+    }
+
+    if (result != OPENDCP_NO_ERROR) {
+        free(job->codestream);
+        job->codestream = NULL;
+    }
+
+    return result;
+}
+
+/* encoder stage for single frame encoders: jpeg2000 encode and write the codestream */
+static void j2k_pipeline_encode_frames(j2k_pipeline_t *pipeline, opendcp_queue_t *queue) {
+    j2k_job_t      *job;
+    int            result, threads;
+    unsigned long long start;
+    struct stat    st;
+
+    while ((job = opendcp_queue_pop(queue))) {
+        if (pipeline->opendcp->metrics) {
+            opendcp_metrics_depth(pipeline->opendcp->metrics, METRIC_ENCODE, opendcp_queue_length(queue) + 1);
+        }
+
+        if (j2k_pipeline_cancelled(pipeline)) {
+            opendcp_image_free(job->image);
+            continue;
+        }
+
+        /* the encode slots of a session are shared with its other jobs */
+        opendcp_session_acquire(pipeline->opendcp->session);
+        threads = j2k_pipeline_intra_start(pipeline);
+        start   = opendcp_metrics_now();
+
+        if (pipeline->ordered) {
+            result = j2k_encode_buffer(pipeline->opendcp, pipeline->plan.encoder, job->image,
+                                       job->frame->in_file, job->frame->out_file,
+                                       &job->codestream, &job->length);
+
+            if (result == OPENDCP_NO_ERROR && pipeline->mxf_2k) {
+                result = j2k_encode_2k(pipeline, job);
+            }
+
+            j2k_pipeline_intra_end(pipeline, threads);
+            opendcp_session_release(pipeline->opendcp->session);
+            opendcp_metrics_record(pipeline->opendcp->metrics, METRIC_ENCODE, start, result == OPENDCP_NO_ERROR ? job->length : 0);
+
+            if (result == OPENDCP_NO_ERROR) {
+                j2k_pipeline_measure(pipeline, job, job->image, job->codestream, job->length);
+            }
+
+            opendcp_image_free(job->image);
+            job->image = NULL;
+
+            if (result == OPENDCP_NO_ERROR) {
+                j2k_pipeline_cache(pipeline, job);
+
+                if (opendcp_queue_push(pipeline->encoded, job) != OPENDCP_NO_ERROR) {
+                    free(job->codestream);
+                    free(job->codestream_2k);
+                    job->codestream    = NULL;
+                    job->codestream_2k = NULL;
+                }
+
+                continue;
+            }
+        }
+        else {
+            result = j2k_encode_file(pipeline->opendcp, pipeline->plan.encoder, job->image,
+                                     job->frame->in_file, job->frame->out_file);
+            j2k_pipeline_intra_end(pipeline, threads);
+            opendcp_session_release(pipeline->opendcp->session);
+
+            if (pipeline->opendcp->metrics || opendcp_trace_enabled) {
+                opendcp_metrics_record(pipeline->opendcp->metrics, METRIC_ENCODE, start,
+                                       result == OPENDCP_NO_ERROR && !stat(job->frame->out_file, &st) ? st.st_size : 0);
+            }
+
+            if (result == OPENDCP_NO_ERROR) {
+                j2k_pipeline_measure(pipeline, job, job->image, NULL, 0);
+            }
+
+            opendcp_image_free(job->image);
+            job->image = NULL;
+
+            if (result == OPENDCP_NO_ERROR) {
+                j2k_pipeline_cache(pipeline, job);
+            }
+        }
+
+        j2k_pipeline_done(pipeline, job, result);
+    }
+}
+
+/* encoder stage: an encoder whose lane has run dry takes frames from the
+   lanes that are still busy, so a lane with slow frames does not finish
+   the conversion on its own */
+static void *j2k_pipeline_encode(void *arg) {
+    j2k_lane_t      *lane = arg;
+    j2k_pipeline_t  *pipeline = lane->pipeline;
+    opendcp_queue_t *queue;
+    int             i;
+
+    j2k_lane_bind(lane);
+
+    for (i = 0; i < pipeline->nlanes; i++) {
+        queue = pipeline->lanes[(lane - pipeline->lanes + i) % pipeline->nlanes].conformed;
+
+        if (pipeline->batch > 1) {
+            j2k_pipeline_encode_batch(pipeline, queue);
+        } else {
+            j2k_pipeline_encode_frames(pipeline, queue);
+        }
+    }
+
+    if (pipeline->encoded) {
+        opendcp_queue_producer_done(pipeline->encoded);
+    }
+
+    return NULL;
+}
+
+/* pass frame index to the mxf writer of its reel or the frame store, a repeat of a stored frame only adds an index entry */
+static int j2k_pipeline_sink(j2k_pipeline_t *pipeline, j2k_job_t *job, int index, int repeat) {
+    if (pipeline->pack) {
+        return repeat ? opendcp_pack_repeat(pipeline->pack) :
+                        opendcp_pack_add(pipeline->pack, job->codestream, job->length);
+    }
+
+    while (pipeline->reel < pipeline->nreels - 1 && index >= pipeline->reel_end[pipeline->reel]) {
+        pipeline->reel++;
+    }
+
+    if (pipeline->mxf_2k && j2k_mxf_writer_write(pipeline->mxf_2k, job->codestream_2k, job->length_2k) != OPENDCP_NO_ERROR) {
+        return OPENDCP_ERROR;
+    }
+
+    return j2k_mxf_writer_write(pipeline->mxf[pipeline->reel], job->codestream, job->length);
+}
+
+/* write the frames that are ready in track order */
+static void j2k_pipeline_flush(j2k_pipeline_t *pipeline) {
+    j2k_job_t *job;
+    int       result, i;
+    unsigned long long start;
+
+    while (pipeline->written < pipeline->nframes && pipeline->jobs[pipeline->written].ready) {
+        job = &pipeline->jobs[pipeline->written];
+
+        if (j2k_pipeline_cancelled(pipeline)) {
+            result = OPENDCP_J2K_CANCELLED;
+        }
+        else if (job->cached &&
+                 opendcp_frame_cache_get(pipeline->opendcp, job->key, &job->codestream, &job->length) != OPENDCP_NO_ERROR) {
+            result = OPENDCP_ERROR;
+        }
+        else {
+            start  = opendcp_metrics_now();
+            result = j2k_pipeline_sink(pipeline, job, pipeline->written, 0);
+            opendcp_metrics_record(pipeline->opendcp->metrics, METRIC_WRITE, start, job->length);
+
+            /* held frames wrap the same codestream again */
+            for (i = 1; i <= job->repeats && result == OPENDCP_NO_ERROR; i++) {
+                result = j2k_pipeline_sink(pipeline, job, pipeline->written + i, 1);
+
+                if (result == OPENDCP_NO_ERROR && job[i].frame->out_file) {
+                    result = j2k_encoded(pipeline->opendcp, result, job[i].frame->in_file, job[i].frame->out_file, job->codestream, job->length);
+                }
+            }
+
+            if (result != OPENDCP_NO_ERROR) {
+                OPENDCP_LOG(LOG_ERROR, "could not write frame %s to %s", basename(job->frame->in_file),
+                            pipeline->pack ? "frame store" : "mxf");
+                result = OPENDCP_ERROR;
+            }
+        }
+
+        free(job->codestream);
+        free(job->codestream_2k);
+        job->codestream    = NULL;
+        job->codestream_2k = NULL;
+        job->ready         = 0;
+
+        if (result != OPENDCP_J2K_CANCELLED) {
+            for (i = 0; i <= job->repeats; i++) {
+                j2k_pipeline_done(pipeline, &job[i], result);
+            }
+        }
+
+        pthread_mutex_lock(&pipeline->mutex);
+        pipeline->written += 1 + job->repeats;
+        pthread_cond_broadcast(&pipeline->window_cond);
+        pthread_mutex_unlock(&pipeline->mutex);
+    }
+}
+
+/* writer stage: restores frame order and wraps the codestreams into the mxf or frame store */
+static void *j2k_pipeline_write(void *arg) {
+    j2k_pipeline_t *pipeline = arg;
+    j2k_job_t      *job;
+
+    /* cached frames at the head of the track need nothing from the encoders */
+    j2k_pipeline_flush(pipeline);
+
+    while ((job = opendcp_queue_pop(pipeline->encoded))) {
+        if (pipeline->opendcp->metrics) {
+            opendcp_metrics_depth(pipeline->opendcp->metrics, METRIC_WRITE, opendcp_queue_length(pipeline->encoded) + 1);
+        }
+
+        job->ready = 1;
+        j2k_pipeline_flush(pipeline);
+    }
+
+    /* drop frames stuck behind a gap left by a failed or cancelled frame */
+    for (job = pipeline->jobs; job < pipeline->jobs + pipeline->nframes; job++) {
+        free(job->codestream);
+        free(job->codestream_2k);
+        job->codestream    = NULL;
+        job->codestream_2k = NULL;
+    }
+
+    return NULL;
+}
+
+/* the error of the first failed frame in frame order, so the result does
+   not depend on which thread failed first */
+static int j2k_pipeline_result(j2k_pipeline_t *pipeline) {
+    int i;
+
+    for (i = 0; i < pipeline->nframes; i++) {
+        if (pipeline->jobs[i].frame->result != OPENDCP_NO_ERROR &&
+            pipeline->jobs[i].frame->result != OPENDCP_J2K_CANCELLED) {
+            return pipeline->jobs[i].frame->result;
+        }
+    }
+
+    if (pipeline->errors) {
+        return OPENDCP_ERROR;
+    }
+
+    return pipeline->cancel ? OPENDCP_J2K_CANCELLED : OPENDCP_NO_ERROR;
+}
+
+/* free what j2k_pipeline_run allocated */
+static void j2k_pipeline_free(j2k_pipeline_t *pipeline, pthread_t *threads, char **files, int *map) {
+    int i;
+
+    for (i = 0; i < pipeline->nlanes; i++) {
+        opendcp_queue_delete(pipeline->lanes[i].decoded);
+        opendcp_queue_delete(pipeline->lanes[i].conformed);
+    }
+
+    opendcp_queue_delete(pipeline->encoded);
+    free(threads);
+    free(files);
+    free(map);
+    free(pipeline->jobs);
+}
+
+/* frames a lane holds at once: the reader slots, both queues, a frame in
+   each conform thread, a batch in each encoder and one being queued */
+static int j2k_lane_frames(int readers, int conformers, int encoders, int queue, int batch) {
+    return readers * 2 + queue * 2 + conformers + encoders * batch + 1;
+}
+
+/* estimated bytes of a frame in flight and of the encoder state while it is
+   encoded, from the container size since the sources are not read yet */
+static void j2k_frame_footprint(opendcp_t *opendcp, opendcp_encoder_t *encoder, size_t *frame, size_t *encode) {
+    size_t planes = (size_t)MAX_WIDTH_2K * MAX_HEIGHT_2K * 3 * sizeof(int);
+
+    if (opendcp->cinema_profile == DCP_CINEMA4K) {
+        planes *= 4;
+    }
+
+    /* the source and the resized copy are held together while resizing */
+    *frame = opendcp->j2k.resize ? planes * 2 : planes;
+
+    /* openjpeg copies the planes into its tiles and code blocks, the others hold about one more copy */
+    *encode = encoder->id == OPENDCP_ENCODER_OPENJPEG ? planes * 2 : planes;
+}
+
+/* takes encoder threads away, along with the reader and conform threads and
+   queue slots that feed them, until the frames in flight fit the memory
+   budget. the threads of the dropped encoders are shared out as intra-frame
+   threads by opendcp_encoder_thread_share */
+static void j2k_pipeline_budget(j2k_pipeline_t *pipeline, int *readers, int *conformers, int *encoders, int *queue) {
+    opendcp_t *opendcp = pipeline->opendcp;
+    size_t    frame, encode, budget, need;
+    int       e, r, c, q;
+
+    j2k_frame_footprint(opendcp, pipeline->plan.encoder, &frame, &encode);
+    budget = (size_t)opendcp->memory_budget * 1024 * 1024 / pipeline->nlanes;
+
+    r = *readers;
+    c = *conformers;
+    q = *queue;
+
+    for (e = *encoders; ; e--) {
+        need = j2k_lane_frames(r, c, e, q, pipeline->batch) * frame + e * pipeline->batch * encode;
+
+        if (need <= budget || e == 1) {
+            break;
+        }
+
+        r = (e - 1) / 4 > 0 ? (e - 1) / 4 : 1;
+        c = r;
+        q = e - 1;
+    }
+
+    /* at a single encoder only the queues can still shrink */
+    if (need > budget) {
+        r = c = q = 1;
+        need = j2k_lane_frames(r, c, e, q, pipeline->batch) * frame + e * pipeline->batch * encode;
+    }
+
+    if (need > budget) {
+        OPENDCP_LOG(LOG_WARN, "a memory budget of %d MB is below the %lu MB a frame at a time needs",
+                    opendcp->memory_budget, (unsigned long)(need * pipeline->nlanes >> 20));
+    }
+
+    if (e != *encoders || q != *queue) {
+        OPENDCP_LOG(LOG_INFO, "memory budget of %d MB: %d of %d encoder threads per lane, about %lu MB of frames in flight",
+                    opendcp->memory_budget, e, *encoders, (unsigned long)(need * pipeline->nlanes >> 20));
+    }
+
+    *readers    = r;
+    *conformers = c;
+    *encoders   = e;
+    *queue      = q;
+}
+
+typedef struct {
+    int       frame;
+    long long cost;
+} j2k_cost_t;
+
+static int j2k_cost_compare(const void *a, const void *b) {
+    const j2k_cost_t *x = a;
+    const j2k_cost_t *y = b;
+
+    if (x->cost != y->cost) {
+        return x->cost < y->cost ? 1 : -1;
+    }
+
+    return x->frame - y->frame;
+}
+
+/* reorder the frames to read so the costliest of each block of frames is
+   started first and the cheap ones fill in behind it, instead of one large
+   frame finishing alone at the end and leaving the other threads idle. the
+   size of the source file stands in for the encode cost. the blocks are no
+   longer than the reorder window of the writer, so track order output never
+   waits on a frame the readers are held back from */
+static void j2k_pipeline_order(j2k_pipeline_t *pipeline, int *order, int count) {
+    j2k_cost_t  *cost;
+    struct stat st;
+    int         block, i, j, n;
+
+    cost = malloc(count * sizeof(j2k_cost_t));
+
+    if (!cost) {
+        return;
+    }
+
+    for (i = 0; i < count; i++) {
+        cost[i].frame = order[i];
+        cost[i].cost  = stat(pipeline->jobs[order[i]].frame->in_file, &st) ? 0 : (long long)st.st_size;
+    }
+
+    block = pipeline->ordered ? pipeline->window : count;
+
+    for (i = 0; i < count; i += block) {
+        n = count - i < block ? count - i : block;
+        qsort(cost + i, n, sizeof(j2k_cost_t), j2k_cost_compare);
+
+        for (j = i; j < i + n; j++) {
+            order[j] = cost[j].frame;
+        }
+    }
+
+    free(cost);
+}
+
+/* run the pipeline, frames go to their out_file or to the mxf writers or frame store when set, and
+   halved to the 2K track when mxf_2k is set */
+static int j2k_pipeline_run(opendcp_t *opendcp, j2k_frame_t *frames, int nframes, j2k_mxf_writer_t **mxf,
+                            const int *reel_end, int nreels, opendcp_pack_t *pack,
+                            j2k_mxf_writer_t *mxf_2k, opendcp_t *opendcp_2k) {
+    j2k_pipeline_t pipeline;
+    j2k_lane_t     *lane;
+    pthread_t      *threads;
+    int            nthreads, lane_threads, readers, conformers, encoders, writers, queue;
+    opendcp_image_pool_stats_t stats;
+    filelist_t     filelist;
+    char           **files;
+    int            *map, *order;
+    int            i, j, l, t = 0, misses = 0, repeats = 0, root, offset, failed = 0, result;
+
+    memset(&pipeline, 0, sizeof(pipeline));
+    pipeline.opendcp = opendcp;
+    pipeline.nframes = nframes;
+    pipeline.mxf      = mxf;
+    pipeline.reel_end = reel_end;
+    pipeline.nreels   = nreels;
+    pipeline.pack     = pack;
+    pipeline.mxf_2k     = mxf_2k;
+    pipeline.opendcp_2k = opendcp_2k;
+    pipeline.ordered  = mxf || pack;
+    pipeline.end      = nframes;
+    pipeline.nlanes  = 1;
+
+    /* the decoder, conform and encoder decisions are made once for the job */
+    if (j2k_plan_build(opendcp, &pipeline.plan, frames, nframes) != OPENDCP_NO_ERROR) {
+        return OPENDCP_ERROR;
+    }
+
+    if (opendcp_encoder_init(pipeline.plan.encoder, opendcp) != OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_ERROR, "could not start the %s encoder", pipeline.plan.encoder->name);
+        j2k_plan_free(&pipeline.plan);
+        return OPENDCP_ERROR;
+    }
+
+    nthreads = opendcp->threads > 0 ? opendcp->threads : 1;
+
+    /* one lane per node, the lane threads share the node's memory */
+    if (opendcp->numa) {
+        pipeline.nlanes = opendcp_numa_nodes();
+        pipeline.nlanes = pipeline.nlanes > opendcp->numa ? opendcp->numa : pipeline.nlanes;
+        pipeline.nlanes = pipeline.nlanes > J2K_LANES_MAX ? J2K_LANES_MAX : pipeline.nlanes;
+        pipeline.nlanes = pipeline.nlanes > nthreads ? nthreads : pipeline.nlanes;
+
+        if (!(pipeline.plan.encoder->caps & OPENDCP_ENCODER_CAP_THREAD_SAFE)) {
+            OPENDCP_LOG(LOG_WARN, "the %s encoder runs single threaded, numa placement is disabled", pipeline.plan.encoder->name);
+            pipeline.nlanes = 1;
+        }
+    }
+
+    lane_threads = nthreads / pipeline.nlanes;
+    readers      = lane_threads / 4 > 0 ? lane_threads / 4 : 1;
+    conformers   = lane_threads / 4 > 0 ? lane_threads / 4 : 1;
+    encoders     = pipeline.plan.encoder->caps & OPENDCP_ENCODER_CAP_THREAD_SAFE ? lane_threads : 1;
+    writers      = pipeline.ordered ? 1 : 0;
+
+    queue        = lane_threads;
+
+    /* set by hand or by a tuning profile */
+    if (opendcp->j2k.readers > 0) {
+        readers = opendcp->j2k.readers < lane_threads ? opendcp->j2k.readers : lane_threads;
+    }
+
+    if (opendcp->j2k.queue_depth > 0) {
+        queue = opendcp->j2k.queue_depth;
+    }
+
+    /* batches are encoded in memory, so only buffer encoders get them */
+    pipeline.batch = 1;
+
+    if ((pipeline.plan.encoder->caps & OPENDCP_ENCODER_CAP_BUFFER) && !mxf_2k) {
+        pipeline.batch = opendcp_encoder_batch_size(pipeline.plan.encoder);
+        pipeline.batch = pipeline.batch > J2K_BATCH_MAX ? J2K_BATCH_MAX : pipeline.batch;
+    }
+
+    if (opendcp->memory_budget > 0) {
+        j2k_pipeline_budget(&pipeline, &readers, &conformers, &encoders, &queue);
+    }
+
+    pipeline.threads  = nthreads;
+    pipeline.encoders = encoders * pipeline.nlanes;
+
+    pipeline.window = nthreads * 4 > pipeline.batch * encoders * pipeline.nlanes ?
+                      nthreads * 4 : pipeline.batch * encoders * pipeline.nlanes;
+
+    if (pipeline.nlanes > 1) {
+        OPENDCP_LOG(LOG_INFO, "using %s encoder on %d numa nodes, %d reader, %d conform, %d encoder threads per node, batches of %d",
+                    pipeline.plan.encoder->name, pipeline.nlanes, readers, conformers, encoders, pipeline.batch);
+    } else {
+        OPENDCP_LOG(LOG_INFO, "using %s encoder, %d reader, %d conform, %d encoder threads, batches of %d",
+                    pipeline.plan.encoder->name, readers, conformers, encoders, pipeline.batch);
+    }
+
+    opendcp_metrics_threads(opendcp->metrics, METRIC_READ, readers * pipeline.nlanes);
+    opendcp_metrics_threads(opendcp->metrics, METRIC_RESIZE, conformers * pipeline.nlanes);
+    opendcp_metrics_threads(opendcp->metrics, METRIC_XYZ, conformers * pipeline.nlanes);
+    opendcp_metrics_threads(opendcp->metrics, METRIC_ENCODE, encoders * pipeline.nlanes);
+    opendcp_metrics_threads(opendcp->metrics, METRIC_WRITE, writers);
+
+    pipeline.jobs = malloc(nframes * sizeof(j2k_job_t));
+    files         = malloc(nframes * sizeof(char *));
+    map           = malloc(nframes * 2 * sizeof(int));    /* reader index to frame, then the frames in read order */
+    threads       = malloc((nthreads + pipeline.nlanes * (1 + conformers + encoders) + writers) * sizeof(pthread_t));
+
+    for (l = 0; l < pipeline.nlanes; l++) {
+        lane            = &pipeline.lanes[l];
+        lane->pipeline  = &pipeline;
+        lane->node      = pipeline.nlanes > 1 ? l : -1;
+        lane->decoded   = opendcp_queue_create(queue, 1);
+        lane->conformed = opendcp_queue_create(queue, conformers);
+        failed         |= !lane->decoded || !lane->conformed;
+    }
+
+    if (pipeline.ordered) {
+        pipeline.encoded = opendcp_queue_create(nthreads, encoders * pipeline.nlanes);
+        failed          |= !pipeline.encoded;
+    }
+
+    if (!pipeline.jobs || !files || !map || !threads || failed) {
+        OPENDCP_LOG(LOG_ERROR, "could not allocate conversion pipeline");
+        j2k_pipeline_free(&pipeline, threads, files, map);
+        opendcp_encoder_shutdown(pipeline.plan.encoder, opendcp);
+        j2k_plan_free(&pipeline.plan);
+        return OPENDCP_ERROR;
+    }
+
+    memset(pipeline.jobs, 0, nframes * sizeof(j2k_job_t));
+    order = map + nframes;
+
+    for (i = 0; i < nframes; i++) {
+        frames[i].result       = OPENDCP_J2K_CANCELLED;
+        pipeline.jobs[i].frame = &frames[i];
+    }
+
+    pthread_mutex_init(&pipeline.mutex, NULL);
+    pthread_cond_init(&pipeline.window_cond, NULL);
+
+    if (opendcp->j2k.cache_dir || opendcp->j2k.dedup) {
+        for (i = 0; i < nthreads; i++) {
+            pthread_create(&threads[i], NULL, j2k_pipeline_lookup, &pipeline);
+        }
+
+        for (i = 0; i < nthreads; i++) {
+            pthread_join(threads[i], NULL);
+        }
+    }
+
+    /* runs of identical frames are encoded once */
+    if (opendcp->j2k.dedup) {
+        for (i = 1, root = 0; i < nframes; i++) {
+            j2k_job_t *job = &pipeline.jobs[i];
+
+            if (!job->cached && !pipeline.jobs[root].cached && job->key[0] && !strcmp(job->key, pipeline.jobs[root].key)) {
+                job->repeated = 1;
+                pipeline.jobs[root].repeats++;
+                repeats++;
+            } else {
+                root = i;
+            }
+        }
+
+        OPENDCP_LOG(LOG_INFO, "%d of %d frames repeat the frame before", repeats, nframes);
+    }
+
+    /* only the frames missing from the cache are read */
+    for (i = 0; i < nframes; i++) {
+        if (!pipeline.jobs[i].cached && !pipeline.jobs[i].repeated) {
+            misses++;
+        }
+    }
+
+    if (opendcp->j2k.cache_dir) {
+        OPENDCP_LOG(LOG_INFO, "%d of %d frames found in the frame cache", nframes - misses - repeats, nframes);
+    }
+
+    pipeline.pending = misses;
+
+    for (i = 0, j = 0; i < nframes; i++) {
+        if (!pipeline.jobs[i].cached && !pipeline.jobs[i].repeated) {
+            order[j++] = i;
+        }
+    }
+
+    if (opendcp->j2k.size_order) {
+        j2k_pipeline_order(&pipeline, order, misses);
+    }
+
+    /* deal the frames to the lanes in turn, so every lane stays close to
+       the head of the mxf reorder window */
+    for (l = 0, offset = 0; l < pipeline.nlanes; l++) {
+        lane         = &pipeline.lanes[l];
+        lane->map    = map + offset;
+        lane->misses = 0;
+        offset      += misses / pipeline.nlanes + (l < misses % pipeline.nlanes);
+    }
+
+    for (j = 0, l = 0; j < misses; j++) {
+        lane = &pipeline.lanes[l];
+        files[lane->map - map + lane->misses] = frames[order[j]].in_file;
+        lane->map[lane->misses++] = order[j];
+        l = (l + 1) % pipeline.nlanes;
+    }
+
+    if (!misses || j2k_pipeline_cancelled(&pipeline)) {
+        if (pipeline.ordered) {
+            j2k_pipeline_flush(&pipeline);
+        }
+
+        goto done;
+    }
+
+    /* decode a few frames ahead of the conform stage and hint the files
+       of the frames after those, which hides the first byte latency of
+       network storage */
+    for (l = 0; l < pipeline.nlanes; l++) {
+        lane = &pipeline.lanes[l];
+
+        if (!lane->misses) {
+            opendcp_queue_producer_done(lane->decoded);
+            continue;
+        }
+
+        filelist.files  = files + (lane->map - map);
+        filelist.nfiles = lane->misses;
+        filelist.arena  = NULL;
+        lane->reader    = opendcp_reader_create(&filelist, readers * 2, lane_threads * 2, readers, j2k_pipeline_decode, lane);
+
+        if (!lane->reader) {
+            OPENDCP_LOG(LOG_ERROR, "could not start the frame reader");
+            pipeline.errors++;
+            pipeline.cancel = 1;
+            opendcp_queue_producer_done(lane->decoded);
+            continue;
+        }
+
+        pthread_create(&threads[t++], NULL, j2k_pipeline_reader, lane);
+    }
+
+    for (l = 0; l < pipeline.nlanes; l++) {
+        for (i = 0; i < conformers; i++) {
+            pthread_create(&threads[t++], NULL, j2k_pipeline_conform, &pipeline.lanes[l]);
+        }
+
+        for (i = 0; i < encoders; i++) {
+            pthread_create(&threads[t++], NULL, j2k_pipeline_encode, &pipeline.lanes[l]);
+        }
+    }
+
+    for (i = 0; i < writers; i++) {
+        pthread_create(&threads[t++], NULL, j2k_pipeline_write, &pipeline);
+    }
+
+    for (i = 0; i < t; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    for (l = 0; l < pipeline.nlanes; l++) {
+        if (pipeline.lanes[l].reader) {
+            opendcp_reader_delete(pipeline.lanes[l].reader);
+        }
+    }
+
+done:
+    opendcp_encoder_shutdown(pipeline.plan.encoder, opendcp);
+    j2k_plan_free(&pipeline.plan);
+
+    opendcp_image_pool_stats(&stats);
+    OPENDCP_LOG(LOG_DEBUG, "image pool hits: %lu misses: %lu released: %lu discarded: %lu",
+                stats.hits, stats.misses, stats.released, stats.discarded);
+    opendcp_image_pool_flush();
+
+    pthread_cond_destroy(&pipeline.window_cond);
+    pthread_mutex_destroy(&pipeline.mutex);
+
+    result = j2k_pipeline_result(&pipeline);
+    j2k_pipeline_free(&pipeline, threads, files, map);
+
+    return result;
+}
+
+/*!
+ @function convert_to_j2k_sequence
+ @abstract Converts a list of images to JPEG2000 using a staged pipeline.
+ @discussion Frames are decoded ahead of demand by a prefetching reader,
+             resized and color converted by conform threads and encoded by
+             encoder threads.
+             The stages are connected with bounded queues, so a stage that
+             gets ahead blocks instead of buffering an unbounded number of
+             decoded frames. The thread count is taken from opendcp->threads.
+             After each frame opendcp->j2k.frame_done is invoked, returning
+             non-zero from the callback cancels the remaining frames. Setting
+             opendcp->j2k.cancel, which is safe from a signal handler, does
+             the same between frames.
+ @param opendcp The opendcp context.
+ @param frames The frames to convert, each result field is set on return.
+ @param nframes The number of frames.
+ @return OPENDCP_NO_ERROR if every frame converted, otherwise the error of
+         the first failed frame, or OPENDCP_J2K_CANCELLED.
+*/
+int convert_to_j2k_sequence(opendcp_t *opendcp, j2k_frame_t *frames, int nframes) {
+    if (nframes < 1) {
+        return OPENDCP_NO_ERROR;
+    }
+
+    return j2k_pipeline_run(opendcp, frames, nframes, NULL, NULL, 0, NULL, NULL, NULL);
+}
+
+/* a frame of a transcode, the frames share the lock of the callback */
+typedef struct {
+    opendcp_t       *opendcp;
+    j2k_frame_t     *frame;
+    pthread_mutex_t *mutex;
+    int             *stop;
+} j2k_transcode_t;
+
+static void *j2k_transcode_frame(void *arg) {
+    j2k_transcode_t *transcode = arg;
+    opendcp_t       *opendcp   = transcode->opendcp;
+    opendcp_cb_t    *cb        = &opendcp->j2k.frame_done;
+    int             result     = OPENDCP_J2K_CANCELLED;
+    int             stop;
+
+    pthread_mutex_lock(transcode->mutex);
+    stop = *transcode->stop || opendcp->j2k.cancel;
+    pthread_mutex_unlock(transcode->mutex);
+
+    if (!stop) {
+        result = opendcp_transcode_kakadu(opendcp, transcode->frame->in_file, transcode->frame->out_file);
+
+        if (result != OPENDCP_NO_ERROR) {
+            OPENDCP_LOG(LOG_ERROR, "transcoding %s to JPEG2000 failed", basename(transcode->frame->in_file));
+        }
+    }
+
+    pthread_mutex_lock(transcode->mutex);
+    transcode->frame->result = result;
+
+    if (!stop && cb->callback && cb->callback(cb->argument)) {
+        *transcode->stop = 1;
+    }
+
+    pthread_mutex_unlock(transcode->mutex);
+
+    return NULL;
+}
+
+/*!
+ @function convert_htj2k_to_j2k_sequence
+ @abstract Transcodes HTJ2K intermediates to DCI compliant JPEG2000 files.
+ @discussion The mastering step of an HTJ2K mezzanine, see j2k.htj2k. The
+             frames are re-coded with the part 1 block coder by kakadu, no
+             frame is decoded, so this is much cheaper than encoding the
+             sources again. Frames run on the thread pool. The result of
+             each frame is set and frame_done is called after each one.
+ @param opendcp The opendcp context.
+ @param frames The frames, in_file the HTJ2K codestream and out_file the
+               file to write.
+ @param nframes The number of frames.
+ @return OPENDCP_NO_ERROR if every frame was transcoded, otherwise OPENDCP_ERROR.
+*/
+int convert_htj2k_to_j2k_sequence(opendcp_t *opendcp, j2k_frame_t *frames, int nframes) {
+    j2k_transcode_t *transcodes;
+    pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+    int             stop = 0;
+    int             result = OPENDCP_NO_ERROR;
+    int             i;
+
+    if (nframes < 1) {
+        return OPENDCP_NO_ERROR;
+    }
+
+    transcodes = malloc(nframes * sizeof(j2k_transcode_t));
+
+    if (!transcodes) {
+        return OPENDCP_ERROR;
+    }
+
+    for (i = 0; i < nframes; i++) {
+        transcodes[i].opendcp = opendcp;
+        transcodes[i].frame   = &frames[i];
+        transcodes[i].mutex   = &mutex;
+        transcodes[i].stop    = &stop;
+    }
+
+    opendcp_pool_run(j2k_transcode_frame, transcodes, sizeof(j2k_transcode_t), nframes, POOL_PRIORITY_NORMAL);
+
+    for (i = 0; i < nframes; i++) {
+        if (frames[i].result != OPENDCP_NO_ERROR) {
+            result = OPENDCP_ERROR;
+        }
+    }
+
+    free(transcodes);
+
+    return result;
+}
+
+/*!
+ @function convert_to_j2k_mxf
+ @abstract Converts a list of images to JPEG2000 and wraps them into an MXF.
+ @discussion This runs the convert_to_j2k_sequence pipeline with a writer
+             stage added. Encoders produce codestreams in memory, a reorder
+             buffer restores frame order and the writer passes each frame to
+             the MXF writer. Readers are held back so no more than a window
+             of frames is waiting to be written. The JPEG2000 files are only
+             written for frames that have an out_file set. Any failure stops
+             the conversion, since the track can not have gaps.
+ @param opendcp The opendcp context.
+ @param frames The frames to convert, in track order.
+ @param nframes The number of frames.
+ @param mxf_file The MXF file to write.
+ @return OPENDCP_NO_ERROR if every frame was written, otherwise an error code.
+*/
+int convert_to_j2k_mxf(opendcp_t *opendcp, j2k_frame_t *frames, int nframes, char *mxf_file) {
+    j2k_mxf_writer_t *mxf;
+    int              result, close_result;
+
+    if (nframes < 1) {
+        return OPENDCP_ERROR;
+    }
+
+    if (opendcp->stereoscopic) {
+        OPENDCP_LOG(LOG_ERROR, "stereoscopic tracks can not be written directly to mxf");
+        return OPENDCP_ERROR;
+    }
+
+    mxf = j2k_mxf_writer_open(opendcp, mxf_file);
+
+    if (!mxf) {
+        return OPENDCP_FILEWRITE_MXF;
+    }
+
+    result       = j2k_pipeline_run(opendcp, frames, nframes, &mxf, &nframes, 1, NULL, NULL, NULL);
+    close_result = j2k_mxf_writer_close(mxf);
+
+    if (result != OPENDCP_NO_ERROR) {
+        return result;
+    }
+
+    return close_result;
+}
+
+/*!
+ @function convert_to_j2k_mxf_append
+ @abstract Converts a list of images to JPEG2000 and appends them to an open MXF writer.
+ @discussion This is convert_to_j2k_mxf writing into a j2k_mxf_writer_open
+             writer that stays open between calls, so a track can be wrapped
+             in several runs as its frames become available. The caller
+             closes the writer once the last frames are appended.
+ @param opendcp The opendcp context.
+ @param frames The frames to convert, in track order.
+ @param nframes The number of frames.
+ @param mxf The MXF writer.
+ @return OPENDCP_NO_ERROR if every frame was written, otherwise an error code.
+*/
+int convert_to_j2k_mxf_append(opendcp_t *opendcp, j2k_frame_t *frames, int nframes, j2k_mxf_writer_t *mxf) {
+    if (nframes < 1) {
+        return OPENDCP_NO_ERROR;
+    }
+
+    if (opendcp->stereoscopic) {
+        OPENDCP_LOG(LOG_ERROR, "stereoscopic tracks can not be written directly to mxf");
+        return OPENDCP_ERROR;
+    }
+
+    return j2k_pipeline_run(opendcp, frames, nframes, &mxf, &nframes, 1, NULL, NULL, NULL);
+}
+
+/*!
+ @function convert_to_j2k_mxf_2k
+ @abstract Converts a list of images to a 4K and a 2K MXF in one pass.
+ @discussion This is convert_to_j2k_mxf with a second track. Each source
+             frame is read, resized and color converted once. After the
+             4K encode the conformed frame is scaled down by
+             opendcp_image_halve and encoded again with the 2K profile, and
+             the writer stage wraps both codestreams in frame order. The
+             second version needs neither another read of the sources nor
+             another color conversion. The encoder must encode into memory,
+             and the frame cache is not used since it only holds one
+             codestream per frame.
+ @param opendcp The opendcp context, cinema_profile must be DCP_CINEMA4K.
+ @param frames The frames to convert, in track order.
+ @param nframes The number of frames.
+ @param mxf_file The 4K MXF file to write.
+ @param mxf_2k_file The 2K MXF file to write.
+ @return OPENDCP_NO_ERROR if every frame was written to both, otherwise an error code.
+*/
+int convert_to_j2k_mxf_2k(opendcp_t *opendcp, j2k_frame_t *frames, int nframes, char *mxf_file, char *mxf_2k_file) {
+    opendcp_t        opendcp_2k;
+    j2k_mxf_writer_t *mxf, *mxf_2k;
+    int              result, close_result, close_2k;
+
+    if (nframes < 1) {
+        return OPENDCP_ERROR;
+    }
+
+    if (opendcp->stereoscopic || opendcp->cinema_profile != DCP_CINEMA4K) {
+        OPENDCP_LOG(LOG_ERROR, "a 2K track is only made alongside a 2D 4K track");
+        return OPENDCP_ERROR;
+    }
+
+    if (opendcp->j2k.cache_dir || opendcp->mxf.dual_file || opendcp->mxf.upload) {
+        OPENDCP_LOG(LOG_ERROR, "a 2K track can not be made with the frame cache, a dual track or an upload");
+        return OPENDCP_ERROR;
+    }
+
+    /* the 2K track is written like the 4K one, without the reports of the 4K track */
+    memcpy(&opendcp_2k, opendcp, sizeof(opendcp_t));
+    opendcp_2k.cinema_profile     = DCP_CINEMA2K;
+    opendcp_2k.mxf.bitrate_report = NULL;
+    opendcp_2k.mxf.checkpoint     = 0;
+    opendcp_2k.mxf.resume         = 0;
+
+    mxf    = j2k_mxf_writer_open(opendcp, mxf_file);
+    mxf_2k = j2k_mxf_writer_open(&opendcp_2k, mxf_2k_file);
+
+    if (!mxf || !mxf_2k) {
+        if (mxf) {
+            j2k_mxf_writer_close(mxf);
+        }
+        if (mxf_2k) {
+            j2k_mxf_writer_close(mxf_2k);
+        }
+        return OPENDCP_FILEWRITE_MXF;
+    }
+
+    result       = j2k_pipeline_run(opendcp, frames, nframes, &mxf, &nframes, 1, NULL, mxf_2k, &opendcp_2k);
+    close_result = j2k_mxf_writer_close(mxf);
+    close_2k     = j2k_mxf_writer_close(mxf_2k);
+
+    if (result != OPENDCP_NO_ERROR) {
+        return result;
+    }
+
+    return close_result != OPENDCP_NO_ERROR ? close_result : close_2k;
+}
+
+/*!
+ @function convert_to_j2k_pack
+ @abstract Converts a list of images to JPEG2000 and writes them to a frame store.
+ @discussion This is convert_to_j2k_mxf with the codestreams appended to a
+             single frame store file instead of an MXF, see
+             opendcp_pack_create. Held frames are stored once. The store can
+             be wrapped later by write_mxf, which reads it front to back.
+             A failed or cancelled conversion removes the store.
+ @param opendcp The opendcp context.
+ @param frames The frames to convert, in track order.
+ @param nframes The number of frames.
+ @param pack_file The frame store to write.
+ @return OPENDCP_NO_ERROR if every frame was written, otherwise an error code.
+*/
+int convert_to_j2k_pack(opendcp_t *opendcp, j2k_frame_t *frames, int nframes, char *pack_file) {
+    opendcp_pack_t *pack;
+    int            result;
+
+    if (nframes < 1) {
+        return OPENDCP_ERROR;
+    }
+
+    if (opendcp->stereoscopic) {
+        OPENDCP_LOG(LOG_ERROR, "stereoscopic tracks can not be written to a frame store");
+        return OPENDCP_ERROR;
+    }
+
+    pack = opendcp_pack_create(pack_file);
+
+    if (!pack) {
+        return OPENDCP_FRAME_STORE;
+    }
+
+    result = j2k_pipeline_run(opendcp, frames, nframes, NULL, NULL, 0, pack, NULL, NULL);
+
+    if (result != OPENDCP_NO_ERROR) {
+        opendcp_pack_abort(pack);
+        return result;
+    }
+
+    return opendcp_pack_close(pack) == OPENDCP_NO_ERROR ? OPENDCP_NO_ERROR : OPENDCP_FRAME_STORE;
+}
+
+/*!
+ @function convert_to_j2k_reels
+ @abstract Converts one long list of images to JPEG2000, wrapping it into an MXF per reel.
+ @discussion This is convert_to_j2k_mxf over the whole list, with the writer
+             stage moving on to the next reel's MXF at each reel boundary.
+             The readers and encoders see a single sequence, so they keep
+             working across the boundaries instead of draining and starting
+             again for every reel. Every MXF is finalized once the last frame
+             is written. The reels must account for every frame.
+ @param opendcp The opendcp context.
+ @param frames The frames to convert, in track order.
+ @param nframes The number of frames.
+ @param reel_frames The number of frames of each reel.
+ @param nreels The number of reels.
+ @param mxf_files The MXF file of each reel.
+ @return OPENDCP_NO_ERROR if every reel was written, otherwise an error code.
+*/
+int convert_to_j2k_reels(opendcp_t *opendcp, j2k_frame_t *frames, int nframes, const int *reel_frames, int nreels,
+                         char **mxf_files) {
+    j2k_mxf_writer_t **mxf;
+    int              *reel_end;
+    int              r, result, close_result;
+
+    if (nframes < 1 || nreels < 1) {
+        return OPENDCP_ERROR;
+    }
+
+    if (opendcp->stereoscopic) {
+        OPENDCP_LOG(LOG_ERROR, "stereoscopic tracks can not be written directly to mxf");
+        return OPENDCP_ERROR;
+    }
+
+    /* the dual track is one file, it can not follow the reels */
+    if (opendcp->mxf.dual_file && nreels > 1) {
+        OPENDCP_LOG(LOG_ERROR, "a dual track can not be split into reels");
+        return OPENDCP_ERROR;
+    }
+
+    mxf      = calloc(nreels, sizeof(j2k_mxf_writer_t *));
+    reel_end = malloc(nreels * sizeof(int));
+
+    if (!mxf || !reel_end) {
+        free(mxf);
+        free(reel_end);
+        return OPENDCP_ERROR;
+    }
+
+    for (r = 0; r < nreels; r++) {
+        reel_end[r] = (r ? reel_end[r - 1] : 0) + reel_frames[r];
+
+        if (reel_frames[r] < 1) {
+            OPENDCP_LOG(LOG_ERROR, "reel %d has no frames", r + 1);
+            result = OPENDCP_ERROR;
+            goto done;
+        }
+    }
+
+    if (reel_end[nreels - 1] != nframes) {
+        OPENDCP_LOG(LOG_ERROR, "the reels have %d frames, the sequence %d", reel_end[nreels - 1], nframes);
+        result = OPENDCP_ERROR;
+        goto done;
+    }
+
+    for (r = 0; r < nreels; r++) {
+        mxf[r] = j2k_mxf_writer_open(opendcp, mxf_files[r]);
+
+        if (!mxf[r]) {
+            result = OPENDCP_FILEWRITE_MXF;
+            goto done;
+        }
+    }
+
+    result = j2k_pipeline_run(opendcp, frames, nframes, mxf, reel_end, nreels, NULL, NULL, NULL);
+
+done:
+    for (r = 0; r < nreels; r++) {
+        if (mxf[r]) {
+            close_result = j2k_mxf_writer_close(mxf[r]);
+
+            if (result == OPENDCP_NO_ERROR) {
+                result = close_result;
+            }
+        }
+    }
+
+    free(mxf);
+    free(reel_end);
+
+    return result;
+}
@@ -0,0 +1,478 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <utime.h>
+#ifdef _WIN32
+#include <io.h>
+#include <process.h>
+#include <direct.h>
+#define getpid _getpid
+#define ledger_mkdir(dir) _mkdir(dir)
+#else
+#include <unistd.h>
+#define ledger_mkdir(dir) mkdir(dir, 0777)
+#endif
+#include "opendcp.h"
+
+/*
+   A job ledger lets several hosts share the frames of one conversion
+   through a directory on shared storage, without a master:
+
+       job                       frames and chunk size, the first host writes it
+       host_<owner>.alive        touched by each host, its mtime is the storage clock
+       chunk_<n>.claim           the owner converting chunk n, touched as a heartbeat
+       chunk_<n>.done            chunk n is converted
+
+   Files are written under a temporary name and published with link(),
+   which fails when the name exists, so a claim and its contents appear
+   at once and only one host gets it. A claim whose heartbeat is older
+   than the stale time is taken over by renaming it away, of the hosts
+   racing for it only one rename succeeds. Ages are measured against the
+   host's own alive file, so hosts need not agree on the time.
+*/
+#define LEDGER_OWNER_LENGTH 128
+
+struct opendcp_ledger_s {
+    opendcp_t       *opendcp;
+    char            *dir;
+    char            owner[LEDGER_OWNER_LENGTH];
+    char            alive[MAX_FILENAME_LENGTH];
+    char            claim[MAX_FILENAME_LENGTH];     /* the chunk being converted, empty when none */
+    int             frames;
+    int             chunk;
+    int             chunks;
+    int             stale;
+    int             chunk_index;
+    int             lost;                           /* the claim was taken over */
+    int             running;
+    int             heartbeat_started;
+    pthread_t       heartbeat;
+    pthread_mutex_t mutex;
+    pthread_cond_t  stop;
+};
+
+static void ledger_path(opendcp_ledger_t *ledger, char *path, const char *name, int chunk, const char *ext) {
+    if (chunk < 0) {
+        snprintf(path, MAX_FILENAME_LENGTH, "%s/%s%s", ledger->dir, name, ext);
+    }
+    else {
+        snprintf(path, MAX_FILENAME_LENGTH, "%s/%s%06d%s", ledger->dir, name, chunk, ext);
+    }
+}
+
+/* write a file under a unique name and publish it, fails if the name is taken */
+static int ledger_publish(opendcp_ledger_t *ledger, const char *path, const char *text) {
+    char tmp[MAX_FILENAME_LENGTH];
+    FILE *fp;
+    int  result = OPENDCP_NO_ERROR;
+
+    snprintf(tmp, sizeof(tmp), "%s.%s.tmp", path, ledger->owner);
+    fp = fopen(tmp, "wb");
+
+    if (!fp) {
+        return OPENDCP_FILEOPEN;
+    }
+
+    if (fputs(text, fp) < 0) {
+        result = OPENDCP_ERROR;
+    }
+
+    if (fclose(fp)) {
+        result = OPENDCP_ERROR;
+    }
+
+#ifdef _WIN32
+    /* rename does not replace an existing file on windows */
+    if (result == OPENDCP_NO_ERROR && rename(tmp, path)) {
+        result = OPENDCP_ERROR;
+    }
+#else
+    if (result == OPENDCP_NO_ERROR && link(tmp, path)) {
+        result = OPENDCP_ERROR;
+    }
+#endif
+
+    unlink(tmp);
+
+    return result;
+}
+
+static int ledger_read(const char *path, char *text, int length) {
+    FILE *fp = fopen(path, "rb");
+    int  n;
+
+    if (!fp) {
+        return OPENDCP_FILEOPEN;
+    }
+
+    n = fread(text, 1, length - 1, fp);
+    text[n > 0 ? n : 0] = '\0';
+    fclose(fp);
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* touch a file, its mtime is set by the storage */
+static int ledger_touch(const char *path) {
+    return utime(path, NULL) ? OPENDCP_ERROR : OPENDCP_NO_ERROR;
+}
+
+/* the time of the storage, taken from the host's own alive file */
+static time_t ledger_now(opendcp_ledger_t *ledger) {
+    struct stat st;
+
+    ledger_touch(ledger->alive);
+
+    if (stat(ledger->alive, &st)) {
+        return time(NULL);
+    }
+
+    return st.st_mtime;
+}
+
+static void *ledger_heartbeat(void *arg) {
+    opendcp_ledger_t *ledger = arg;
+    struct timespec  ts;
+    int              interval = ledger->stale / 4 > 0 ? ledger->stale / 4 : 1;
+
+    pthread_mutex_lock(&ledger->mutex);
+
+    while (ledger->running) {
+        ts.tv_sec  = time(NULL) + interval;
+        ts.tv_nsec = 0;
+
+        if (pthread_cond_timedwait(&ledger->stop, &ledger->mutex, &ts) != ETIMEDOUT) {
+            continue;
+        }
+
+        ledger_touch(ledger->alive);
+
+        if (ledger->claim[0] && !ledger->lost && ledger_touch(ledger->claim) != OPENDCP_NO_ERROR) {
+            OPENDCP_LOG(LOG_WARN, "chunk %d was taken over by another host", ledger->chunk_index + 1);
+            ledger->lost = 1;
+        }
+    }
+
+    pthread_mutex_unlock(&ledger->mutex);
+
+    return NULL;
+}
+
+/* checks the job file against this host's job, writing it when it is the first */
+static int ledger_job(opendcp_ledger_t *ledger) {
+    char path[MAX_FILENAME_LENGTH];
+    char text[64];
+    int  frames = 0, chunk = 0;
+
+    ledger_path(ledger, path, "job", -1, "");
+    snprintf(text, sizeof(text), "%d %d\n", ledger->frames, ledger->chunk);
+
+    if (ledger_publish(ledger, path, text) == OPENDCP_NO_ERROR) {
+        return OPENDCP_NO_ERROR;
+    }
+
+    if (ledger_read(path, text, sizeof(text)) != OPENDCP_NO_ERROR || sscanf(text, "%d %d", &frames, &chunk) != 2) {
+        OPENDCP_LOG(LOG_ERROR, "could not read the job of ledger %s", ledger->dir);
+        return OPENDCP_FILEOPEN;
+    }
+
+    if (frames != ledger->frames || chunk != ledger->chunk) {
+        OPENDCP_LOG(LOG_ERROR, "ledger %s holds a job of %d frames in chunks of %d, this one has %d in chunks of %d",
+                    ledger->dir, frames, chunk, ledger->frames, ledger->chunk);
+        return OPENDCP_ERROR;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*!
+ @function opendcp_ledger_open
+ @abstract Joins the job ledger in a shared directory.
+ @discussion Every host runs the same conversion against the same ledger
+             directory, which is created if needed. The frames are divided
+             into chunks that hosts claim as they become free, see
+             opendcp_ledger_claim. The first host records the frame count
+             and chunk size, the others must match them. A heartbeat thread
+             keeps the claims of the host alive.
+ @param opendcp The opendcp context, j2k.cancel stops a wait for a chunk.
+ @param dir The ledger directory on the shared storage.
+ @param frames The frames of the job.
+ @param chunk The frames of a chunk.
+ @param stale Seconds without a heartbeat after which a claim is taken over.
+ @return The ledger, or NULL.
+*/
+opendcp_ledger_t *opendcp_ledger_open(opendcp_t *opendcp, const char *dir, int frames, int chunk, int stale) {
+    opendcp_ledger_t *ledger;
+    char             host[64] = "";
+    char             *c;
+    FILE             *fp;
+
+    if (frames < 1 || chunk < 1 || stale < 1) {
+        return NULL;
+    }
+
+    ledger = calloc(1, sizeof(opendcp_ledger_t));
+
+    if (!ledger) {
+        return NULL;
+    }
+
+    ledger->opendcp = opendcp;
+    ledger->dir     = strdup(dir);
+    ledger->frames  = frames;
+    ledger->chunk   = chunk;
+    ledger->chunks  = (frames + chunk - 1) / chunk;
+    ledger->stale   = stale;
+
+#ifdef _WIN32
+    if (getenv("COMPUTERNAME")) {
+        snprintf(host, sizeof(host), "%s", getenv("COMPUTERNAME"));
+    }
+#else
+    gethostname(host, sizeof(host) - 1);
+#endif
+
+    /* the owner is part of file names */
+    for (c = host; *c; c++) {
+        if (*c == '/' || *c == '\\' || *c == ':' || *c == ' ') {
+            *c = '_';
+        }
+    }
+
+    snprintf(ledger->owner, sizeof(ledger->owner), "%s.%d", host[0] ? host : "host", (int)getpid());
+
+    ledger_mkdir(dir);
+    ledger_path(ledger, ledger->alive, "host_", -1, "");
+    snprintf(ledger->alive + strlen(ledger->alive), MAX_FILENAME_LENGTH - strlen(ledger->alive), "%s.alive",
+             ledger->owner);
+
+    fp = fopen(ledger->alive, "wb");
+
+    if (!fp) {
+        OPENDCP_LOG(LOG_ERROR, "could not write to ledger %s", dir);
+        free(ledger->dir);
+        free(ledger);
+        return NULL;
+    }
+
+    fclose(fp);
+
+    if (ledger_job(ledger) != OPENDCP_NO_ERROR) {
+        unlink(ledger->alive);
+        free(ledger->dir);
+        free(ledger);
+        return NULL;
+    }
+
+    pthread_mutex_init(&ledger->mutex, NULL);
+    pthread_cond_init(&ledger->stop, NULL);
+    ledger->running = 1;
+    ledger->heartbeat_started = !pthread_create(&ledger->heartbeat, NULL, ledger_heartbeat, ledger);
+
+    if (!ledger->heartbeat_started) {
+        OPENDCP_LOG(LOG_WARN, "could not start the ledger heartbeat, claims may be taken over");
+    }
+
+    OPENDCP_LOG(LOG_INFO, "joined ledger %s as %s, %d chunks of %d frames", dir, ledger->owner, ledger->chunks, chunk);
+
+    return ledger;
+}
+
+/* take a chunk that nobody holds, or whose holder stopped beating */
+static int ledger_try(opendcp_ledger_t *ledger, int n, time_t now) {
+    char        path[MAX_FILENAME_LENGTH];
+    char        moved[MAX_FILENAME_LENGTH + LEDGER_OWNER_LENGTH + 8];
+    struct stat st;
+
+    ledger_path(ledger, path, "chunk_", n, ".claim");
+
+    if (ledger_publish(ledger, path, ledger->owner) == OPENDCP_NO_ERROR) {
+        return 1;
+    }
+
+    if (stat(path, &st) || now - st.st_mtime <= ledger->stale) {
+        return 0;
+    }
+
+    /* only one of the hosts racing for a stale claim moves it */
+    snprintf(moved, sizeof(moved), "%s.%s.stale", path, ledger->owner);
+
+    if (rename(path, moved)) {
+        return 0;
+    }
+
+    unlink(moved);
+    OPENDCP_LOG(LOG_WARN, "taking over chunk %d, its host stopped", n + 1);
+
+    return ledger_publish(ledger, path, ledger->owner) == OPENDCP_NO_ERROR;
+}
+
+/*!
+ @function opendcp_ledger_claim
+ @abstract Claims the next chunk of frames for this host.
+ @discussion Chunks are taken in order. While the chunks left are held by
+             other hosts this waits, taking any chunk whose host stops
+             beating. Call opendcp_ledger_done or opendcp_ledger_release
+             once the chunk is converted or has failed.
+ @param ledger The ledger.
+ @param first Set to the first frame of the chunk, counted from 0.
+ @param count Set to the frames of the chunk, 0 once every chunk is done.
+ @return OPENDCP_NO_ERROR, or OPENDCP_J2K_CANCELLED if j2k.cancel was set while waiting.
+*/
+int opendcp_ledger_claim(opendcp_ledger_t *ledger, int *first, int *count) {
+    char            path[MAX_FILENAME_LENGTH];
+    struct stat     st;
+    struct timespec ts;
+    int             n, pending;
+    time_t          now;
+
+    *first = 0;
+    *count = 0;
+
+    while (!ledger->opendcp->j2k.cancel) {
+        now     = ledger_now(ledger);
+        pending = 0;
+
+        for (n = 0; n < ledger->chunks; n++) {
+            ledger_path(ledger, path, "chunk_", n, ".done");
+
+            if (!stat(path, &st)) {
+                continue;
+            }
+
+            if (ledger_try(ledger, n, now)) {
+                pthread_mutex_lock(&ledger->mutex);
+                ledger_path(ledger, ledger->claim, "chunk_", n, ".claim");
+                ledger->chunk_index = n;
+                ledger->lost = 0;
+                pthread_mutex_unlock(&ledger->mutex);
+
+                *first = n * ledger->chunk;
+                *count = *first + ledger->chunk > ledger->frames ? ledger->frames - *first : ledger->chunk;
+
+                return OPENDCP_NO_ERROR;
+            }
+
+            pending++;
+        }
+
+        if (!pending) {
+            return OPENDCP_NO_ERROR;
+        }
+
+        /* the other hosts are still on the last chunks */
+        pthread_mutex_lock(&ledger->mutex);
+        ts.tv_sec  = time(NULL) + (ledger->stale / 4 > 0 ? ledger->stale / 4 : 1);
+        ts.tv_nsec = 0;
+        pthread_cond_timedwait(&ledger->stop, &ledger->mutex, &ts);
+        pthread_mutex_unlock(&ledger->mutex);
+    }
+
+    return OPENDCP_J2K_CANCELLED;
+}
+
+/* drop the claim of this host, marking the chunk done when converted */
+static int ledger_finish(opendcp_ledger_t *ledger, int done) {
+    char path[MAX_FILENAME_LENGTH];
+    char owner[LEDGER_OWNER_LENGTH];
+    int  result = OPENDCP_NO_ERROR;
+
+    pthread_mutex_lock(&ledger->mutex);
+
+    if (!ledger->claim[0]) {
+        pthread_mutex_unlock(&ledger->mutex);
+        return OPENDCP_ERROR;
+    }
+
+    /* a claim taken over belongs to the new host, its frames are converted again there */
+    if (!ledger->lost && ledger_read(ledger->claim, owner, sizeof(owner)) == OPENDCP_NO_ERROR &&
+        !strcmp(owner, ledger->owner)) {
+        if (done) {
+            ledger_path(ledger, path, "chunk_", ledger->chunk_index, ".done");
+            result = rename(ledger->claim, path) ? OPENDCP_ERROR : OPENDCP_NO_ERROR;
+        }
+        else {
+            unlink(ledger->claim);
+        }
+    }
+
+    ledger->claim[0] = '\0';
+    pthread_mutex_unlock(&ledger->mutex);
+
+    return result;
+}
+
+/*!
+ @function opendcp_ledger_done
+ @abstract Marks the claimed chunk as converted.
+ @param ledger The ledger.
+ @return OPENDCP_NO_ERROR or OPENDCP_ERROR.
+*/
+int opendcp_ledger_done(opendcp_ledger_t *ledger) {
+    return ledger_finish(ledger, 1);
+}
+
+/*!
+ @function opendcp_ledger_release
+ @abstract Gives up the claimed chunk so another host converts it.
+ @param ledger The ledger.
+ @return OPENDCP_NO_ERROR or OPENDCP_ERROR.
+*/
+int opendcp_ledger_release(opendcp_ledger_t *ledger) {
+    return ledger_finish(ledger, 0);
+}
+
+/*!
+ @function opendcp_ledger_close
+ @abstract Leaves the ledger, releasing a chunk still claimed.
+ @param ledger The ledger.
+*/
+void opendcp_ledger_close(opendcp_ledger_t *ledger) {
+    if (!ledger) {
+        return;
+    }
+
+    if (ledger->claim[0]) {
+        opendcp_ledger_release(ledger);
+    }
+
+    pthread_mutex_lock(&ledger->mutex);
+    ledger->running = 0;
+    pthread_cond_broadcast(&ledger->stop);
+    pthread_mutex_unlock(&ledger->mutex);
+
+    /* the thread only runs when it could be started */
+    if (ledger->heartbeat_started) {
+        pthread_join(ledger->heartbeat, NULL);
+    }
+
+    pthread_cond_destroy(&ledger->stop);
+    pthread_mutex_destroy(&ledger->mutex);
+    unlink(ledger->alive);
+    free(ledger->dir);
+    free(ledger);
+}
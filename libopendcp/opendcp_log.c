@@ -21,69 +21,438 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <time.h>
+#include <sched.h>
+#include <pthread.h>
 #include "opendcp.h"
+#include "cpu.h"
 
 #if _MSC_VER
 #define snprintf _snprintf
 #endif
 
 #define OPENDCP_LOG_MAX_SUBCRIBERS 5
+#define OPENDCP_LOG_MESSAGE_SIZE   255
+#define OPENDCP_LOG_RING_SIZE      256    /* messages per thread, a power of two */
+#define OPENDCP_LOG_DRAIN_MS       10
+#define OPENDCP_LOG_QUEUE_MAX      4096   /* messages a batch subscriber holds between drains */
+
+int opendcp_log_threshold = LOG_NONE;
 
 static int subscriber_count = 0;
 static opendcp_log_cb_t subscribers[OPENDCP_LOG_MAX_SUBCRIBERS];
+static pthread_mutex_t deliver_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* messages held for a batch subscriber, taken whole by opendcp_log_drain */
+typedef struct {
+    char *messages;
+    int  count;
+    int  dropped;
+} log_queue_t;
+
+static log_queue_t queues[OPENDCP_LOG_MAX_SUBCRIBERS];
 
 void opendcp_log_init(int level);
-char *opendcp_log_timestamp();
+static void opendcp_log_timestamp(char *buffer, size_t size);
+
+/*
+   Asynchronous logging. Each logging thread owns a ring of formatted
+   messages that only it writes and only the drain thread reads, so logging
+   takes no lock. A full ring makes its thread wait for the drain thread,
+   which keeps the messages of a thread in order. The rings of threads that
+   have exited are freed once drained.
+*/
+typedef struct {
+    int  level;
+    char msg[OPENDCP_LOG_MESSAGE_SIZE];
+} log_message_t;
+
+typedef struct log_ring_s {
+    unsigned int      head;     /* written by the owner thread */
+    unsigned int      tail;     /* written by the drain thread */
+    int               exited;
+    struct log_ring_s *next;
+    log_message_t     messages[OPENDCP_LOG_RING_SIZE];
+} log_ring_t;
+
+static int             log_async = 0;
+static int             log_stop  = 0;
+static pthread_t       log_thread;
+static pthread_key_t   log_ring_key;
+static pthread_once_t  log_ring_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t log_ring_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  log_ring_cond  = PTHREAD_COND_INITIALIZER;
+static log_ring_t      *log_rings = NULL;
 
 void opendcp_log_print_message(void *arg, const char *msg) {
     UNUSED(arg);
     fprintf(stdout, "%s\n", msg);
 }
 
+/* caller holds deliver_mutex */
+static void log_queue_push(log_queue_t *queue, const char *msg) {
+    if (!queue->messages) {
+        queue->messages = malloc((size_t)OPENDCP_LOG_QUEUE_MAX * OPENDCP_LOG_MESSAGE_SIZE);
+    }
+
+    if (!queue->messages || queue->count >= OPENDCP_LOG_QUEUE_MAX) {
+        queue->dropped++;
+        return;
+    }
+
+    snprintf(queue->messages + (size_t)queue->count++ * OPENDCP_LOG_MESSAGE_SIZE, OPENDCP_LOG_MESSAGE_SIZE, "%s", msg);
+}
+
+/* hand a message to the subscribers, callbacks are serialized */
+static void opendcp_log_deliver(int level, const char *msg) {
+    int x;
+
+    pthread_mutex_lock(&deliver_mutex);
+
+    for (x = 0; x < subscriber_count; x++) {
+        if (level > subscribers[x].level) {
+            continue;
+        }
+
+        if (subscribers[x].batch) {
+            log_queue_push(&queues[x], msg);
+        } else {
+            subscribers[x].callback(subscribers[x].argument, (void *)msg);
+        }
+    }
+
+    pthread_mutex_unlock(&deliver_mutex);
+}
+
+static void log_ring_exit(void *arg) {
+    log_ring_t *ring = arg;
+
+    __atomic_store_n(&ring->exited, 1, __ATOMIC_RELEASE);
+}
+
+static void log_ring_init(void) {
+    pthread_key_create(&log_ring_key, log_ring_exit);
+}
+
+static log_ring_t *log_ring(void) {
+    log_ring_t *ring;
+
+    pthread_once(&log_ring_once, log_ring_init);
+
+    ring = pthread_getspecific(log_ring_key);
+
+    if (ring) {
+        return ring;
+    }
+
+    ring = calloc(1, sizeof(log_ring_t));
+
+    if (!ring) {
+        return NULL;
+    }
+
+    pthread_mutex_lock(&log_ring_mutex);
+    ring->next = log_rings;
+    log_rings  = ring;
+    pthread_mutex_unlock(&log_ring_mutex);
+
+    pthread_setspecific(log_ring_key, ring);
+
+    return ring;
+}
+
+/* deliver every queued message, returns the number delivered */
+static int log_rings_drain(void) {
+    log_ring_t   *ring, **link;
+    unsigned int head, tail;
+    int          exited, count = 0;
+
+    pthread_mutex_lock(&log_ring_mutex);
+
+    for (link = &log_rings; (ring = *link);) {
+        exited = __atomic_load_n(&ring->exited, __ATOMIC_ACQUIRE);
+        head   = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+        tail   = ring->tail;
+
+        for (; tail != head; tail++, count++) {
+            log_message_t *message = &ring->messages[tail % OPENDCP_LOG_RING_SIZE];
+            opendcp_log_deliver(message->level, message->msg);
+        }
+
+        __atomic_store_n(&ring->tail, tail, __ATOMIC_RELEASE);
+
+        if (exited) {
+            *link = ring->next;
+            free(ring);
+        } else {
+            link = &ring->next;
+        }
+    }
+
+    pthread_mutex_unlock(&log_ring_mutex);
+
+    return count;
+}
+
+static void *log_drain_thread(void *arg) {
+    struct timespec ts;
+
+    UNUSED(arg);
+
+    pthread_mutex_lock(&log_ring_mutex);
+
+    while (!log_stop) {
+        clock_gettime(CLOCK_REALTIME, &ts);
+        ts.tv_nsec += OPENDCP_LOG_DRAIN_MS * 1000000L;
+
+        if (ts.tv_nsec >= 1000000000L) {
+            ts.tv_sec++;
+            ts.tv_nsec -= 1000000000L;
+        }
+
+        pthread_cond_timedwait(&log_ring_cond, &log_ring_mutex, &ts);
+        pthread_mutex_unlock(&log_ring_mutex);
+        log_rings_drain();
+        pthread_mutex_lock(&log_ring_mutex);
+    }
+
+    pthread_mutex_unlock(&log_ring_mutex);
+
+    return NULL;
+}
+
+/* queue a message on the ring of this thread, returns 0 if it has none */
+static int log_ring_push(int level, const char *msg) {
+    log_ring_t   *ring = log_ring();
+    unsigned int head;
+
+    if (!ring) {
+        return 0;
+    }
+
+    head = ring->head;
+
+    while (head - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE) >= OPENDCP_LOG_RING_SIZE) {
+        pthread_cond_signal(&log_ring_cond);
+        sched_yield();
+    }
+
+    ring->messages[head % OPENDCP_LOG_RING_SIZE].level = level;
+    memcpy(ring->messages[head % OPENDCP_LOG_RING_SIZE].msg, msg, OPENDCP_LOG_MESSAGE_SIZE);
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+
+    return 1;
+}
+
 void opendcp_log(int level, const char *file, const char *function, int line,  const char *fmt, ...) {
-    char msg[255];
+    char msg[OPENDCP_LOG_MESSAGE_SIZE];
+    char timestamp[30];
     va_list vl;
+    int pad;
+
+    /* nobody takes this level, do not format it */
+    if (level > opendcp_log_threshold) {
+        return;
+    }
+
     va_start(vl, fmt);
-    int x, pad;
 
     pad = 40 - strlen(file) - 4;
-    snprintf(msg, sizeof(msg), "%s | %5s | %s:%-4d %*s | %-30s | ", opendcp_log_timestamp(), OPENDCP_LOGLEVEL_NAME[level], file, line, pad, "", function);
+    opendcp_log_timestamp(timestamp, sizeof(timestamp));
+    snprintf(msg, sizeof(msg), "%s | %5s | %s:%-4d %*s | %-30s | ", timestamp, OPENDCP_LOGLEVEL_NAME[level], file, line, pad, "", function);
     vsnprintf(msg + strlen(msg), sizeof(msg) - strlen(msg), fmt, vl);
     va_end(vl);
 
+    if (__atomic_load_n(&log_async, __ATOMIC_ACQUIRE) && log_ring_push(level, msg)) {
+        return;
+    }
+
+    opendcp_log_deliver(level, msg);
+}
+
+/*!
+ @function opendcp_log_async
+ @abstract Moves delivery of log messages to a background thread.
+ @discussion Logging threads queue formatted messages on a ring of their own
+             and return, a drain thread hands them to the subscribers. The
+             queued messages are flushed when the process exits. Turn it
+             off only while no other thread is logging.
+ @param enable 1 to deliver asynchronously, 0 to deliver from the logging thread.
+*/
+void opendcp_log_async(int enable) {
+    if (enable && !log_async) {
+        log_stop = 0;
+
+        if (pthread_create(&log_thread, NULL, log_drain_thread, NULL)) {
+            return;
+        }
+
+        atexit(opendcp_log_flush);
+        __atomic_store_n(&log_async, 1, __ATOMIC_RELEASE);
+    } else if (!enable && log_async) {
+        __atomic_store_n(&log_async, 0, __ATOMIC_RELEASE);
+
+        pthread_mutex_lock(&log_ring_mutex);
+        log_stop = 1;
+        pthread_cond_signal(&log_ring_cond);
+        pthread_mutex_unlock(&log_ring_mutex);
+
+        pthread_join(log_thread, NULL);
+        log_rings_drain();
+    }
+}
+
+/*!
+ @function opendcp_log_flush
+ @abstract Delivers the messages queued by asynchronous logging.
+*/
+void opendcp_log_flush(void) {
+    log_rings_drain();
+}
+
+/* the subscriber registered with this callback and argument, caller holds deliver_mutex */
+static int log_subscriber(opendcp_log_cb_t *cb) {
+    int x;
+
     for (x = 0; x < subscriber_count; x++) {
-        if (level <= subscribers[x].level) {
-            subscribers[x].callback(subscribers[x].argument, msg);
+        if (subscribers[x].callback == cb->callback && subscribers[x].argument == cb->argument) {
+            return x;
         }
     }
+
+    return -1;
 }
 
+/*!
+ @function opendcp_log_subscribe
+ @abstract Adds a receiver of log messages.
+ @discussion Messages above the level of every subscriber are dropped before
+             they are formatted. A subscriber with batch set is not called
+             as messages are logged; they are queued, and each
+             opendcp_log_drain hands the callback all of them at once as an
+             opendcp_log_batch_t, on the thread that drains.
+ @param cb The level, callback and argument of the subscriber.
+*/
 void opendcp_log_subscribe(opendcp_log_cb_t *cb) {
+    pthread_mutex_lock(&deliver_mutex);
+
     if (subscriber_count >= OPENDCP_LOG_MAX_SUBCRIBERS) {
+        pthread_mutex_unlock(&deliver_mutex);
         return;
     }
 
+    memset(&queues[subscriber_count], 0, sizeof(log_queue_t));
     subscribers[subscriber_count++] = *cb;
+
+    if (cb->level > opendcp_log_threshold) {
+        opendcp_log_threshold = cb->level;
+    }
+
+    pthread_mutex_unlock(&deliver_mutex);
 }
 
-char *opendcp_log_timestamp() {
+/*!
+ @function opendcp_log_unsubscribe
+ @abstract Removes a receiver of log messages.
+ @discussion Messages still queued for a batch subscriber are discarded.
+ @param cb The callback and argument the subscriber was added with.
+*/
+void opendcp_log_unsubscribe(opendcp_log_cb_t *cb) {
+    int x;
+
+    pthread_mutex_lock(&deliver_mutex);
+
+    x = log_subscriber(cb);
+
+    if (x >= 0) {
+        free(queues[x].messages);
+        subscriber_count--;
+        memmove(&subscribers[x], &subscribers[x + 1], (subscriber_count - x) * sizeof(opendcp_log_cb_t));
+        memmove(&queues[x], &queues[x + 1], (subscriber_count - x) * sizeof(log_queue_t));
+
+        opendcp_log_threshold = LOG_NONE;
+
+        for (x = 0; x < subscriber_count; x++) {
+            if (subscribers[x].level > opendcp_log_threshold) {
+                opendcp_log_threshold = subscribers[x].level;
+            }
+        }
+    }
+
+    pthread_mutex_unlock(&deliver_mutex);
+}
+
+/*!
+ @function opendcp_log_drain
+ @abstract Delivers the messages queued for a batch subscriber.
+ @discussion The queue is taken under the lock and the callback runs
+             outside it, so logging threads carry on while the batch is
+             handled. The callback is not called when nothing was logged.
+ @param cb The callback and argument the subscriber was added with.
+ @return The number of messages delivered.
+*/
+int opendcp_log_drain(opendcp_log_cb_t *cb) {
+    opendcp_log_batch_t batch;
+    log_queue_t         queue;
+    int                 x;
+
+    pthread_mutex_lock(&deliver_mutex);
+
+    x = log_subscriber(cb);
+
+    if (x < 0 || (!queues[x].count && !queues[x].dropped)) {
+        pthread_mutex_unlock(&deliver_mutex);
+        return 0;
+    }
+
+    queue = queues[x];
+    queues[x].messages = NULL;
+    queues[x].count    = 0;
+    queues[x].dropped  = 0;
+
+    pthread_mutex_unlock(&deliver_mutex);
+
+    batch.count    = queue.count;
+    batch.dropped  = queue.dropped;
+    batch.messages = malloc((queue.count ? queue.count : 1) * sizeof(char *));
+
+    if (batch.messages) {
+        for (x = 0; x < queue.count; x++) {
+            batch.messages[x] = queue.messages + (size_t)x * OPENDCP_LOG_MESSAGE_SIZE;
+        }
+
+        cb->callback(cb->argument, &batch);
+    }
+
+    free((void *)batch.messages);
+    free(queue.messages);
+
+    return batch.count;
+}
+
+static void opendcp_log_timestamp(char *buffer, size_t size) {
     time_t time_ptr;
-    struct tm *time_struct;
-    static char buffer[30];
+    struct tm time_struct;
 
     time(&time_ptr);
-    time_struct = localtime(&time_ptr);
-    strftime(buffer, 30, "%Y%m%d%I%M%S", time_struct);
-
-    return buffer;
+#ifdef _WIN32
+    localtime_s(&time_struct, &time_ptr);
+#else
+    localtime_r(&time_ptr, &time_struct);
+#endif
+    strftime(buffer, size, "%Y%m%d%I%M%S", &time_struct);
 }
 
 void opendcp_log_init(int level) {
     opendcp_log_cb_t cb;
+    char             kernels[512];
 
     cb.level    = level;
     cb.callback = (void *)opendcp_log_print_message;
     cb.argument = NULL;
+    cb.batch    = 0;
 
     opendcp_log_subscribe(&cb);
+    opendcp_log_asdcp();
+
+    OPENDCP_LOG(LOG_DEBUG, "simd kernels, %s", cpu_describe(kernels, sizeof(kernels)));
 }
@@ -0,0 +1,654 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+#include "opendcp.h"
+
+/*
+   Peak and loudness analysis of the sound track as it is wrapped,
+   following ITU-R BS.1770. The writer copies each edit unit in and goes
+   on with the next one while worker threads, each owning some of the
+   channels, measure the copy. Every channel is K-weighted and its energy
+   kept per 100 ms segment; the gated integrated loudness is worked out
+   from the segments when the report is written. True peak is the largest
+   sample of a 4x oversampled signal.
+*/
+#define LOUDNESS_TP_PHASES   4
+#define LOUDNESS_TP_TAPS     12      /* taps per oversampling phase */
+#define LOUDNESS_BLOCK       4       /* segments in a 400 ms gating block */
+#define LOUDNESS_GATE        -70.0   /* absolute gate in LUFS */
+#define LOUDNESS_RELATIVE    -10.0   /* relative gate in LU */
+#define LOUDNESS_THREADS_MAX 16
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+typedef struct {
+    double b[3];
+    double a[2];
+} loudness_biquad_t;
+
+typedef struct {
+    float        *samples;          /* the last taps - 1 samples of the previous unit, then the current one */
+    double       state[2][2];       /* K-weighting filter stages */
+    double       peak;
+    double       true_peak;
+    unsigned int clipped;
+    double       energy;            /* of the segment being filled */
+    int          count;
+    double       *segments;         /* mean square of every whole segment */
+    unsigned int nsegments;
+    unsigned int segments_alloc;
+} loudness_channel_t;
+
+typedef struct {
+    opendcp_loudness_t *loudness;
+    int                first;
+} loudness_worker_t;
+
+struct opendcp_loudness_s {
+    int                rate;
+    int                channels;
+    int                segment;        /* samples in a segment */
+    int                alloc;          /* samples the channel buffers hold */
+    int                samples;        /* in the unit being measured */
+    unsigned long long total;
+    loudness_biquad_t  filter[2];
+    float              taps[LOUDNESS_TP_PHASES][LOUDNESS_TP_TAPS];
+    loudness_channel_t channel[MAX_AUDIO_CHANNELS];
+    pthread_t          thread[LOUDNESS_THREADS_MAX];
+    loudness_worker_t  worker[LOUDNESS_THREADS_MAX];
+    int                nthreads;
+    pthread_mutex_t    mutex;
+    pthread_cond_t     cond;
+    unsigned int       generation;     /* bumped for every unit handed to the workers */
+    int                busy;           /* workers still measuring it */
+    int                quit;
+};
+
+/* K-weighting pre-filter and RLB high pass, the BS.1770 curves designed for any sample rate */
+static void loudness_filters(opendcp_loudness_t *loudness) {
+    double k, vh, vb, a0, q;
+
+    k  = tan(M_PI * 1681.974450955533 / loudness->rate);
+    vh = pow(10.0, 3.999843853973347 / 20.0);
+    vb = pow(vh, 0.4996667741545416);
+    q  = 0.7071752369554196;
+    a0 = 1.0 + k / q + k * k;
+
+    loudness->filter[0].b[0] = (vh + vb * k / q + k * k) / a0;
+    loudness->filter[0].b[1] = 2.0 * (k * k - vh) / a0;
+    loudness->filter[0].b[2] = (vh - vb * k / q + k * k) / a0;
+    loudness->filter[0].a[0] = 2.0 * (k * k - 1.0) / a0;
+    loudness->filter[0].a[1] = (1.0 - k / q + k * k) / a0;
+
+    k  = tan(M_PI * 38.13547087602444 / loudness->rate);
+    q  = 0.5003270373238773;
+    a0 = 1.0 + k / q + k * k;
+
+    loudness->filter[1].b[0] = 1.0;
+    loudness->filter[1].b[1] = -2.0;
+    loudness->filter[1].b[2] = 1.0;
+    loudness->filter[1].a[0] = 2.0 * (k * k - 1.0) / a0;
+    loudness->filter[1].a[1] = (1.0 - k / q + k * k) / a0;
+}
+
+/* windowed sinc interpolator, each phase normalized to unity gain */
+static void loudness_true_peak_taps(opendcp_loudness_t *loudness) {
+    int    n = LOUDNESS_TP_PHASES * LOUDNESS_TP_TAPS, p, t, i;
+    double center = (n - 1) / 2.0, x, w, sum;
+
+    for (p = 0; p < LOUDNESS_TP_PHASES; p++) {
+        sum = 0.0;
+
+        for (t = 0; t < LOUDNESS_TP_TAPS; t++) {
+            i = t * LOUDNESS_TP_PHASES + p;
+            x = (i - center) / LOUDNESS_TP_PHASES;
+            w = 0.42 - 0.5 * cos(2.0 * M_PI * (i + 0.5) / n) + 0.08 * cos(4.0 * M_PI * (i + 0.5) / n);
+
+            loudness->taps[p][t] = (float)((x == 0.0 ? 1.0 : sin(M_PI * x) / (M_PI * x)) * w);
+            sum += loudness->taps[p][t];
+        }
+
+        for (t = 0; t < LOUDNESS_TP_TAPS; t++) {
+            loudness->taps[p][t] = (float)(loudness->taps[p][t] / sum);
+        }
+    }
+}
+
+static void loudness_segment(loudness_channel_t *ch, double mean_square) {
+    if (ch->nsegments >= ch->segments_alloc) {
+        unsigned int alloc  = ch->segments_alloc ? ch->segments_alloc * 2 : 1024;
+        double       *grown = realloc(ch->segments, alloc * sizeof(double));
+
+        if (!grown) {
+            return;
+        }
+
+        ch->segments       = grown;
+        ch->segments_alloc = alloc;
+    }
+
+    ch->segments[ch->nsegments++] = mean_square;
+}
+
+/* measures the current unit of one channel */
+static void loudness_measure(opendcp_loudness_t *loudness, loudness_channel_t *ch) {
+    const loudness_biquad_t *f = loudness->filter;
+    const float             *x = ch->samples + LOUDNESS_TP_TAPS - 1;
+    double                  s00 = ch->state[0][0], s01 = ch->state[0][1];
+    double                  s10 = ch->state[1][0], s11 = ch->state[1][1];
+    double                  in, y, peak = ch->peak, true_peak = ch->true_peak;
+    int                     i, p, t;
+
+    for (i = 0; i < loudness->samples; i++) {
+        in = x[i];
+
+        if (fabs(in) > peak) {
+            peak = fabs(in);
+        }
+
+        if (in >= 8388607.0 / 8388608.0 || in <= -1.0) {
+            ch->clipped++;
+        }
+
+        /* 4x oversampled, phase 0 is the sample delayed by half the filter */
+        for (p = 0; p < LOUDNESS_TP_PHASES; p++) {
+            float acc0 = 0.0f, acc1 = 0.0f;
+
+            for (t = 0; t < LOUDNESS_TP_TAPS; t += 2) {
+                acc0 += loudness->taps[p][t] * x[i - t];
+                acc1 += loudness->taps[p][t + 1] * x[i - t - 1];
+            }
+
+            if (fabs(acc0 + acc1) > true_peak) {
+                true_peak = fabs(acc0 + acc1);
+            }
+        }
+
+        /* transposed direct form II, stage one then stage two */
+        y   = f[0].b[0] * in + s00;
+        s00 = f[0].b[1] * in - f[0].a[0] * y + s01;
+        s01 = f[0].b[2] * in - f[0].a[1] * y;
+        in  = y;
+        y   = f[1].b[0] * in + s10;
+        s10 = f[1].b[1] * in - f[1].a[0] * y + s11;
+        s11 = f[1].b[2] * in - f[1].a[1] * y;
+
+        ch->energy += y * y;
+
+        if (++ch->count == loudness->segment) {
+            loudness_segment(ch, ch->energy / loudness->segment);
+            ch->energy = 0.0;
+            ch->count  = 0;
+        }
+    }
+
+    ch->state[0][0] = s00;
+    ch->state[0][1] = s01;
+    ch->state[1][0] = s10;
+    ch->state[1][1] = s11;
+    ch->peak        = peak;
+    ch->true_peak   = true_peak > peak ? true_peak : peak;
+
+    /* keep the tail for the oversampling filter of the next unit */
+    memmove(ch->samples, ch->samples + loudness->samples, (LOUDNESS_TP_TAPS - 1) * sizeof(float));
+}
+
+static void loudness_measure_band(opendcp_loudness_t *loudness, int first, int step) {
+    int c;
+
+    for (c = first; c < loudness->channels; c += step) {
+        loudness_measure(loudness, &loudness->channel[c]);
+    }
+}
+
+static void *loudness_worker(void *arg) {
+    loudness_worker_t  *worker   = arg;
+    opendcp_loudness_t *loudness = worker->loudness;
+    unsigned int       seen      = 0;
+
+    pthread_mutex_lock(&loudness->mutex);
+
+    while (1) {
+        while (!loudness->quit && loudness->generation == seen) {
+            pthread_cond_wait(&loudness->cond, &loudness->mutex);
+        }
+
+        if (loudness->quit) {
+            break;
+        }
+
+        seen = loudness->generation;
+        pthread_mutex_unlock(&loudness->mutex);
+
+        loudness_measure_band(loudness, worker->first, loudness->nthreads);
+
+        pthread_mutex_lock(&loudness->mutex);
+
+        if (--loudness->busy == 0) {
+            pthread_cond_broadcast(&loudness->cond);
+        }
+    }
+
+    pthread_mutex_unlock(&loudness->mutex);
+
+    return NULL;
+}
+
+/* waits for the workers to finish the unit they were given */
+static void loudness_wait(opendcp_loudness_t *loudness) {
+    pthread_mutex_lock(&loudness->mutex);
+
+    while (loudness->busy) {
+        pthread_cond_wait(&loudness->cond, &loudness->mutex);
+    }
+
+    pthread_mutex_unlock(&loudness->mutex);
+}
+
+/*!
+ @function opendcp_loudness_create
+ @abstract Creates peak and loudness analysis for a sound track.
+ @discussion The measurements run on worker threads, each taking every
+             threads'th channel, so the caller only copies the samples in.
+ @param rate The sample rate.
+ @param channels The number of channels, at most MAX_AUDIO_CHANNELS.
+ @param threads Worker threads, clamped to the channel count.
+ @return The analysis or NULL.
+*/
+opendcp_loudness_t *opendcp_loudness_create(int rate, int channels, int threads) {
+    opendcp_loudness_t *loudness;
+    int                t;
+
+    if (rate < 8000 || channels < 1 || channels > MAX_AUDIO_CHANNELS) {
+        return NULL;
+    }
+
+    loudness = calloc(1, sizeof(opendcp_loudness_t));
+
+    if (!loudness) {
+        return NULL;
+    }
+
+    loudness->rate     = rate;
+    loudness->channels = channels;
+    loudness->segment  = rate / 10;
+
+    loudness_filters(loudness);
+    loudness_true_peak_taps(loudness);
+
+    pthread_mutex_init(&loudness->mutex, NULL);
+    pthread_cond_init(&loudness->cond, NULL);
+
+    threads = threads < 1 ? 1 : threads;
+    threads = threads > channels ? channels : threads;
+    threads = threads > LOUDNESS_THREADS_MAX ? LOUDNESS_THREADS_MAX : threads;
+
+    /* workers read nthreads as their step, so it is set before any of them start */
+    loudness->nthreads = threads;
+
+    for (t = 0; t < threads; t++) {
+        loudness->worker[t].loudness = loudness;
+        loudness->worker[t].first    = t;
+    }
+
+    for (t = 0; t < threads; t++) {
+        if (pthread_create(&loudness->thread[t], NULL, loudness_worker, &loudness->worker[t])) {
+            break;
+        }
+    }
+
+    /* without workers the caller measures each unit itself */
+    if (t < threads) {
+        pthread_mutex_lock(&loudness->mutex);
+        loudness->quit = 1;
+        pthread_cond_broadcast(&loudness->cond);
+        pthread_mutex_unlock(&loudness->mutex);
+
+        while (t--) {
+            pthread_join(loudness->thread[t], NULL);
+        }
+
+        loudness->quit     = 0;
+        loudness->nthreads = 0;
+    }
+
+    return loudness;
+}
+
+/*!
+ @function opendcp_loudness_delete
+ @abstract Stops the workers and frees analysis created by opendcp_loudness_create.
+ @param loudness The analysis, may be NULL.
+*/
+void opendcp_loudness_delete(opendcp_loudness_t *loudness) {
+    int t;
+
+    if (!loudness) {
+        return;
+    }
+
+    loudness_wait(loudness);
+
+    pthread_mutex_lock(&loudness->mutex);
+    loudness->quit = 1;
+    pthread_cond_broadcast(&loudness->cond);
+    pthread_mutex_unlock(&loudness->mutex);
+
+    for (t = 0; t < loudness->nthreads; t++) {
+        pthread_join(loudness->thread[t], NULL);
+    }
+
+    for (t = 0; t < loudness->channels; t++) {
+        free(loudness->channel[t].samples);
+        free(loudness->channel[t].segments);
+    }
+
+    pthread_cond_destroy(&loudness->cond);
+    pthread_mutex_destroy(&loudness->mutex);
+    free(loudness);
+}
+
+/*!
+ @function opendcp_loudness_add
+ @abstract Hands the next edit unit of the track to the analysis.
+ @discussion Waits for the workers to finish the previous unit, copies the
+             samples and returns while they are measured, so the buffers
+             can be reused straight away.
+ @param loudness The analysis, nothing is done when NULL.
+ @param data The first 24-bit little endian sample of every channel.
+ @param stride The bytes from one sample of each channel to its next.
+ @param samples The samples per channel in the unit.
+ @return OPENDCP_NO_ERROR or OPENDCP_ERROR when out of memory.
+*/
+int opendcp_loudness_add(opendcp_loudness_t *loudness, unsigned char **data, const unsigned int *stride, int samples) {
+    const unsigned char *p;
+    float               *x;
+    int                 c, i;
+
+    if (!loudness) {
+        return OPENDCP_NO_ERROR;
+    }
+
+    loudness_wait(loudness);
+
+    if (samples > loudness->alloc) {
+        for (c = 0; c < loudness->channels; c++) {
+            x = realloc(loudness->channel[c].samples, (samples + LOUDNESS_TP_TAPS - 1) * sizeof(float));
+
+            if (!x) {
+                return OPENDCP_ERROR;
+            }
+
+            if (!loudness->alloc) {
+                memset(x, 0, (LOUDNESS_TP_TAPS - 1) * sizeof(float));
+            }
+
+            loudness->channel[c].samples = x;
+        }
+
+        loudness->alloc = samples;
+    }
+
+    for (c = 0; c < loudness->channels; c++) {
+        x = loudness->channel[c].samples + LOUDNESS_TP_TAPS - 1;
+        p = data[c];
+
+        for (i = 0; i < samples; i++, p += stride[c]) {
+            x[i] = (float)(((int)((unsigned int)p[2] << 24 | (unsigned int)p[1] << 16 | (unsigned int)p[0] << 8) >> 8) / 8388608.0);
+        }
+    }
+
+    loudness->samples = samples;
+    loudness->total  += samples;
+
+    if (!loudness->nthreads) {
+        loudness_measure_band(loudness, 0, 1);
+        return OPENDCP_NO_ERROR;
+    }
+
+    pthread_mutex_lock(&loudness->mutex);
+    loudness->generation++;
+    loudness->busy = loudness->nthreads;
+    pthread_cond_broadcast(&loudness->cond);
+    pthread_mutex_unlock(&loudness->mutex);
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* channel weights of BS.1770, the lfe of 5.1 and 7.1 is left out and the surrounds are weighted up */
+static double loudness_weight(opendcp_loudness_t *loudness, int c) {
+    if (loudness->channels < 6) {
+        return 1.0;
+    }
+
+    if (c == 3) {
+        return 0.0;
+    }
+
+    return c == 4 || c == 5 ? 1.41 : 1.0;
+}
+
+/* mean square of a gating block, one channel or the weighted sum of all when channel is -1 */
+static double loudness_block(opendcp_loudness_t *loudness, int channel, unsigned int block) {
+    double       z = 0.0, sum;
+    unsigned int s;
+    int          c;
+
+    for (c = channel < 0 ? 0 : channel; c < loudness->channels; c++) {
+        for (s = block, sum = 0.0; s < block + LOUDNESS_BLOCK; s++) {
+            sum += loudness->channel[c].segments[s];
+        }
+
+        z += (channel < 0 ? loudness_weight(loudness, c) : 1.0) * sum / LOUDNESS_BLOCK;
+
+        if (channel >= 0) {
+            break;
+        }
+    }
+
+    return z;
+}
+
+static double loudness_lufs(double z) {
+    return -0.691 + 10.0 * log10(z);
+}
+
+/* gated integrated loudness, returns 0 when no block is above the absolute gate */
+static int loudness_integrated(opendcp_loudness_t *loudness, int channel, double *lufs) {
+    unsigned int blocks = loudness->channel[0].nsegments, b, n;
+    double       z, sum, gate;
+    int          c;
+
+    for (c = 1; c < loudness->channels; c++) {
+        blocks = loudness->channel[c].nsegments < blocks ? loudness->channel[c].nsegments : blocks;
+    }
+
+    blocks = blocks >= LOUDNESS_BLOCK ? blocks - LOUDNESS_BLOCK + 1 : 0;
+
+    for (b = 0, n = 0, sum = 0.0; b < blocks; b++) {
+        z = loudness_block(loudness, channel, b);
+
+        if (z > 0.0 && loudness_lufs(z) > LOUDNESS_GATE) {
+            sum += z;
+            n++;
+        }
+    }
+
+    if (!n) {
+        return 0;
+    }
+
+    gate = loudness_lufs(sum / n) + LOUDNESS_RELATIVE;
+
+    for (b = 0, n = 0, sum = 0.0; b < blocks; b++) {
+        z = loudness_block(loudness, channel, b);
+
+        if (z > 0.0 && loudness_lufs(z) > LOUDNESS_GATE && loudness_lufs(z) > gate) {
+            sum += z;
+            n++;
+        }
+    }
+
+    *lufs = loudness_lufs(sum / n);
+
+    return 1;
+}
+
+static double loudness_db(double level) {
+    return 20.0 * log10(level);
+}
+
+/* largest sample and true peak across the channels */
+static void loudness_peaks(opendcp_loudness_t *loudness, double *peak, double *true_peak, unsigned int *clipped) {
+    int c;
+
+    *peak      = 0.0;
+    *true_peak = 0.0;
+    *clipped   = 0;
+
+    for (c = 0; c < loudness->channels; c++) {
+        *peak       = loudness->channel[c].peak > *peak ? loudness->channel[c].peak : *peak;
+        *true_peak  = loudness->channel[c].true_peak > *true_peak ? loudness->channel[c].true_peak : *true_peak;
+        *clipped   += loudness->channel[c].clipped;
+    }
+}
+
+/*!
+ @function opendcp_loudness_summary
+ @abstract Logs the integrated loudness and peaks at info level, clipping as a warning.
+ @param loudness The analysis, may be NULL.
+*/
+void opendcp_loudness_summary(opendcp_loudness_t *loudness) {
+    double       peak, true_peak, lufs;
+    unsigned int clipped;
+
+    if (!loudness || !loudness->total) {
+        return;
+    }
+
+    loudness_wait(loudness);
+    loudness_peaks(loudness, &peak, &true_peak, &clipped);
+
+    if (loudness_integrated(loudness, -1, &lufs)) {
+        OPENDCP_LOG(LOG_INFO, "loudness integrated %.1f LUFS, true peak %.1f dBTP, sample peak %.1f dBFS",
+                    lufs, loudness_db(true_peak), loudness_db(peak));
+    }
+    else {
+        OPENDCP_LOG(LOG_INFO, "loudness is below the %.0f LUFS gate", LOUDNESS_GATE);
+    }
+
+    if (clipped) {
+        OPENDCP_LOG(LOG_WARN, "%u samples are at full scale", clipped);
+    }
+}
+
+/* a level in dB, silence has none */
+static void loudness_print_db(FILE *fp, const char *name, double level) {
+    if (level > 0.0) {
+        fprintf(fp, "\"%s\": %.2f", name, loudness_db(level));
+    }
+    else {
+        fprintf(fp, "\"%s\": null", name);
+    }
+}
+
+static void loudness_print_integrated(FILE *fp, opendcp_loudness_t *loudness, int channel) {
+    double lufs;
+
+    if (loudness_integrated(loudness, channel, &lufs)) {
+        fprintf(fp, "\"integrated_lufs\": %.2f", lufs);
+    }
+    else {
+        fprintf(fp, "\"integrated_lufs\": null");
+    }
+}
+
+/*!
+ @function opendcp_loudness_dump
+ @abstract Writes the analysis as json.
+ @discussion The report has the program loudness and peaks, then the
+             sample peak, true peak, clipped sample count and integrated
+             loudness of every channel. Levels of silent channels are null.
+ @param loudness The analysis.
+ @param file The file to write.
+ @return OPENDCP_NO_ERROR or OPENDCP_ERROR.
+*/
+int opendcp_loudness_dump(opendcp_loudness_t *loudness, const char *file) {
+    FILE         *fp;
+    double       peak, true_peak;
+    unsigned int clipped;
+    int          c;
+
+    if (!loudness) {
+        return OPENDCP_ERROR;
+    }
+
+    loudness_wait(loudness);
+
+    fp = fopen(file, "w");
+
+    if (!fp) {
+        OPENDCP_LOG(LOG_ERROR, "could not write loudness report to %s", file);
+        return OPENDCP_ERROR;
+    }
+
+    loudness_peaks(loudness, &peak, &true_peak, &clipped);
+
+    fprintf(fp, "{\n");
+    fprintf(fp, "    \"sample_rate\": %d,\n", loudness->rate);
+    fprintf(fp, "    \"channels\": %d,\n", loudness->channels);
+    fprintf(fp, "    \"samples\": %llu,\n", loudness->total);
+    fprintf(fp, "    \"seconds\": %.3f,\n", (double)loudness->total / loudness->rate);
+    fprintf(fp, "    ");
+    loudness_print_integrated(fp, loudness, -1);
+    fprintf(fp, ",\n    ");
+    loudness_print_db(fp, "true_peak_dbtp", true_peak);
+    fprintf(fp, ",\n    ");
+    loudness_print_db(fp, "sample_peak_dbfs", peak);
+    fprintf(fp, ",\n");
+    fprintf(fp, "    \"clipped_samples\": %u,\n", clipped);
+    fprintf(fp, "    \"channel\": [");
+
+    for (c = 0; c < loudness->channels; c++) {
+        loudness_channel_t *ch = &loudness->channel[c];
+
+        fprintf(fp, "%s\n        {\"channel\": %d, ", c ? "," : "", c + 1);
+        loudness_print_integrated(fp, loudness, c);
+        fprintf(fp, ", ");
+        loudness_print_db(fp, "true_peak_dbtp", ch->true_peak);
+        fprintf(fp, ", ");
+        loudness_print_db(fp, "sample_peak_dbfs", ch->peak);
+        fprintf(fp, ", \"clipped_samples\": %u}", ch->clipped);
+    }
+
+    fprintf(fp, "\n    ]\n}\n");
+
+    if (fclose(fp)) {
+        OPENDCP_LOG(LOG_ERROR, "could not write loudness report to %s", file);
+        return OPENDCP_ERROR;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
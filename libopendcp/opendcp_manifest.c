@@ -0,0 +1,304 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "opendcp.h"
+#include "crc32c.h"
+
+/*
+   A checksum manifest sits next to the codestreams opendcp_j2k writes,
+   one line per frame:
+
+       <crc32c as 8 hex digits> <size in bytes> <file name>
+
+   Encoders append a line as each codestream is produced, so a resumed or
+   repeated conversion adds lines and the last one for a name counts.
+   The MXF wrap loads the manifest of the directory it reads from and
+   checks every codestream against it while wrapping, which catches a
+   truncated or damaged file for the cost of a CRC over data already in
+   memory. Files not listed, or in another directory, are not checked.
+*/
+typedef struct {
+    char         *name;
+    unsigned int crc;
+    long long    size;
+    int          line;
+} manifest_entry_t;
+
+struct opendcp_manifest_s {
+    char             dir[MAX_FILENAME_LENGTH];
+    FILE             *fp;                   /* open for appending, NULL when loaded for checking */
+    manifest_entry_t *entries;
+    int              nentries;
+    pthread_mutex_t  mutex;
+};
+
+static void manifest_path(const char *dir, char *path) {
+    snprintf(path, MAX_FILENAME_LENGTH, "%s/%s", dir, J2K_MANIFEST_NAME);
+}
+
+/* the directory part of a file, "." when it has none */
+static void manifest_dir(const char *file, char *dir) {
+    const char *slash = strrchr(file, '/');
+
+    if (!slash) {
+        snprintf(dir, MAX_FILENAME_LENGTH, ".");
+    }
+    else {
+        snprintf(dir, MAX_FILENAME_LENGTH, "%.*s", (int)(slash - file), file);
+    }
+}
+
+/* the file name within the manifest's directory, NULL when it is elsewhere */
+static const char *manifest_name(opendcp_manifest_t *manifest, const char *file) {
+    char dir[MAX_FILENAME_LENGTH];
+    const char *slash = strrchr(file, '/');
+
+    manifest_dir(file, dir);
+
+    if (strcmp(dir, manifest->dir)) {
+        return NULL;
+    }
+
+    return slash ? slash + 1 : file;
+}
+
+static int manifest_compare_name(const void *a, const void *b) {
+    return strcmp(((const manifest_entry_t *)a)->name, ((const manifest_entry_t *)b)->name);
+}
+
+/* by name, lines of one name in file order */
+static int manifest_compare(const void *a, const void *b) {
+    const manifest_entry_t *x = a, *y = b;
+    int c = strcmp(x->name, y->name);
+
+    return c ? c : x->line - y->line;
+}
+
+/*!
+ @function opendcp_manifest_open
+ @abstract Open the checksum manifest of a codestream directory for appending.
+ @discussion The manifest goes in the directory of file, one of the
+     codestreams about to be written. Lines are appended by
+     opendcp_manifest_add from any thread.
+ @param file A file in the directory of the manifest.
+ @return The manifest, or NULL if it could not be opened.
+*/
+opendcp_manifest_t *opendcp_manifest_open(const char *file) {
+    opendcp_manifest_t *manifest = calloc(1, sizeof(*manifest));
+    char               path[MAX_FILENAME_LENGTH];
+
+    if (!manifest) {
+        return NULL;
+    }
+
+    manifest_dir(file, manifest->dir);
+    manifest_path(manifest->dir, path);
+    manifest->fp = fopen(path, "a");
+
+    if (!manifest->fp) {
+        OPENDCP_LOG(LOG_ERROR, "could not open checksum manifest %s", path);
+        free(manifest);
+        return NULL;
+    }
+
+    pthread_mutex_init(&manifest->mutex, NULL);
+
+    return manifest;
+}
+
+/*!
+ @function opendcp_manifest_add
+ @abstract Record the checksum of a codestream that was just written.
+ @param manifest The manifest from opendcp_manifest_open.
+ @param file The codestream file.
+ @param data The codestream.
+ @param length The codestream length.
+ @return OPENDCP_NO_ERROR, or OPENDCP_ERROR if the line could not be written.
+*/
+int opendcp_manifest_add(opendcp_manifest_t *manifest, const char *file, const unsigned char *data, int length) {
+    const char   *name = manifest_name(manifest, file);
+    unsigned int crc;
+    int          result = OPENDCP_NO_ERROR;
+
+    if (!name) {
+        OPENDCP_LOG(LOG_DEBUG, "%s is not in %s, no checksum recorded", file, manifest->dir);
+        return OPENDCP_NO_ERROR;
+    }
+
+    crc = crc32c(0, data, length);
+
+    pthread_mutex_lock(&manifest->mutex);
+
+    /* whole lines, so a conversion that is killed leaves only complete ones */
+    if (fprintf(manifest->fp, "%08x %d %s\n", crc, length, name) < 0 || fflush(manifest->fp)) {
+        OPENDCP_LOG(LOG_ERROR, "could not write checksum of %s", file);
+        result = OPENDCP_ERROR;
+    }
+
+    pthread_mutex_unlock(&manifest->mutex);
+
+    return result;
+}
+
+/*!
+ @function opendcp_manifest_load
+ @abstract Load the checksum manifest of a codestream directory.
+ @param file A file in the directory of the manifest.
+ @return The manifest, or NULL if the directory has none.
+*/
+opendcp_manifest_t *opendcp_manifest_load(const char *file) {
+    opendcp_manifest_t *manifest;
+    manifest_entry_t   *entries;
+    char               path[MAX_FILENAME_LENGTH];
+    char               line[MAX_FILENAME_LENGTH + 64];
+    char               name[MAX_FILENAME_LENGTH];
+    unsigned int       crc;
+    long long          size;
+    int                capacity = 0, i, n;
+    FILE               *fp;
+
+    manifest = calloc(1, sizeof(*manifest));
+
+    if (!manifest) {
+        return NULL;
+    }
+
+    manifest_dir(file, manifest->dir);
+    manifest_path(manifest->dir, path);
+    fp = fopen(path, "r");
+
+    if (!fp) {
+        free(manifest);
+        return NULL;
+    }
+
+    while (fgets(line, sizeof(line), fp)) {
+        if (sscanf(line, "%8x %lld %[^\n]", &crc, &size, name) != 3) {
+            continue;
+        }
+
+        if (manifest->nentries == capacity) {
+            capacity = capacity ? capacity * 2 : 1024;
+            entries  = realloc(manifest->entries, capacity * sizeof(manifest_entry_t));
+
+            if (!entries) {
+                break;
+            }
+
+            manifest->entries = entries;
+        }
+
+        manifest->entries[manifest->nentries].name = strdup(name);
+        manifest->entries[manifest->nentries].crc  = crc;
+        manifest->entries[manifest->nentries].size = size;
+        manifest->entries[manifest->nentries].line = manifest->nentries;
+        manifest->nentries++;
+    }
+
+    fclose(fp);
+
+    /* sorted by name, then keep the last line of each */
+    qsort(manifest->entries, manifest->nentries, sizeof(manifest_entry_t), manifest_compare);
+
+    for (i = 0, n = 0; i < manifest->nentries; i++) {
+        if (i + 1 < manifest->nentries && !strcmp(manifest->entries[i].name, manifest->entries[i + 1].name)) {
+            free(manifest->entries[i].name);
+            continue;
+        }
+
+        manifest->entries[n++] = manifest->entries[i];
+    }
+
+    manifest->nentries = n;
+    pthread_mutex_init(&manifest->mutex, NULL);
+
+    OPENDCP_LOG(LOG_INFO, "checking codestreams against %d checksums in %s", n, path);
+
+    return manifest;
+}
+
+/*!
+ @function opendcp_manifest_check
+ @abstract Check a codestream against its recorded checksum.
+ @param manifest The manifest from opendcp_manifest_load.
+ @param file The codestream file.
+ @param data The codestream as read.
+ @param length The codestream length.
+ @return OPENDCP_NO_ERROR if it matches or is not listed, otherwise
+     OPENDCP_FILEOPEN_J2K.
+*/
+int opendcp_manifest_check(opendcp_manifest_t *manifest, const char *file, const unsigned char *data, int length) {
+    manifest_entry_t key, *entry;
+    unsigned int     crc;
+
+    key.name = (char *)manifest_name(manifest, file);
+
+    if (!key.name) {
+        return OPENDCP_NO_ERROR;
+    }
+
+    entry = bsearch(&key, manifest->entries, manifest->nentries, sizeof(manifest_entry_t), manifest_compare_name);
+
+    if (!entry) {
+        OPENDCP_LOG(LOG_DEBUG, "%s has no recorded checksum", file);
+        return OPENDCP_NO_ERROR;
+    }
+
+    if (entry->size != length) {
+        OPENDCP_LOG(LOG_ERROR, "%s is %d bytes, %lld when it was written", file, length, entry->size);
+        return OPENDCP_FILEOPEN_J2K;
+    }
+
+    crc = crc32c(0, data, length);
+
+    if (crc != entry->crc) {
+        OPENDCP_LOG(LOG_ERROR, "%s checksum is %08x, %08x when it was written", file, crc, entry->crc);
+        return OPENDCP_FILEOPEN_J2K;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*!
+ @function opendcp_manifest_close
+ @abstract Close a manifest opened for appending or loaded for checking.
+*/
+void opendcp_manifest_close(opendcp_manifest_t *manifest) {
+    int i;
+
+    if (!manifest) {
+        return;
+    }
+
+    if (manifest->fp) {
+        fclose(manifest->fp);
+    }
+
+    for (i = 0; i < manifest->nentries; i++) {
+        free(manifest->entries[i].name);
+    }
+
+    pthread_mutex_destroy(&manifest->mutex);
+    free(manifest->entries);
+    free(manifest);
+}
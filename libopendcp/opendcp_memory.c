@@ -0,0 +1,209 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifdef __linux__
+#define _GNU_SOURCE
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+#include "opendcp.h"
+
+/*
+   Huge pages. Frame planes and codestream buffers are tens of MB and are
+   swept from end to end, so with 4 KB pages the sweeps miss the TLB every
+   few rows. When enabled, large buffers are mapped with explicit huge
+   pages (MAP_HUGETLB, large pages on Windows), which need pages reserved
+   by the administrator, or else with transparent huge pages on a mapping
+   aligned to the huge page size. A buffer that gets neither comes from
+   the ordinary allocator as before.
+*/
+#define HUGE_PAGE_SIZE ((size_t)2 * 1024 * 1024)
+
+static int huge_enabled = 0;
+static opendcp_huge_stats_t huge_stats;
+
+static void huge_stat_add(unsigned long *counter) {
+    __sync_fetch_and_add(counter, 1);
+}
+
+static size_t huge_round(size_t size, size_t page) {
+    return (size + page - 1) & ~(page - 1);
+}
+
+/*!
+ @function opendcp_huge_pages
+ @abstract Enables huge pages for frame buffers.
+ @discussion Applies to the image slabs and to the libasdcp frame buffers
+     allocated from then on, buffers already allocated keep their pages.
+ @param enable 1 to back large buffers with huge pages, 0 for the ordinary allocator.
+*/
+void opendcp_huge_pages(int enable) {
+    huge_enabled = enable ? 1 : 0;
+    opendcp_huge_pages_asdcp(huge_enabled);
+}
+
+/*!
+ @function opendcp_huge_pages_enabled
+ @abstract Returns whether huge pages are enabled.
+ @return 1 when enabled, otherwise 0.
+*/
+int opendcp_huge_pages_enabled(void) {
+    return huge_enabled;
+}
+
+/*!
+ @function opendcp_huge_alloc
+ @abstract Maps a buffer backed by huge pages.
+ @discussion The buffer is aligned to the huge page size. Explicit huge
+     pages are tried first, then transparent ones. Returns NULL when huge
+     pages are disabled, the buffer is smaller than a huge page or neither
+     kind could be had, the caller then allocates as usual.
+ @param size The size of the buffer.
+ @param kind Set to a HUGE_PAGES value on success.
+ @return The buffer, freed with opendcp_huge_free, or NULL.
+*/
+void *opendcp_huge_alloc(size_t size, int *kind) {
+    void *ptr = NULL;
+
+    *kind = HUGE_PAGES_NONE;
+
+    if (!huge_enabled || size < HUGE_PAGE_SIZE) {
+        return NULL;
+    }
+
+#ifdef _WIN32
+    {
+        size_t page = GetLargePageMinimum();
+
+        /* needs the lock pages in memory privilege */
+        if (page) {
+            ptr = VirtualAlloc(NULL, huge_round(size, page), MEM_COMMIT | MEM_RESERVE | MEM_LARGE_PAGES, PAGE_READWRITE);
+        }
+
+        if (ptr) {
+            *kind = HUGE_PAGES_EXPLICIT;
+        }
+    }
+#else
+    size = huge_round(size, HUGE_PAGE_SIZE);
+
+#ifdef MAP_HUGETLB
+    ptr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+    if (ptr != MAP_FAILED) {
+        *kind = HUGE_PAGES_EXPLICIT;
+    } else {
+        ptr = NULL;
+    }
+#endif
+
+#ifdef MADV_HUGEPAGE
+    /* map a huge page more and trim it off so the buffer starts on a huge page */
+    if (!ptr) {
+        unsigned char *map = mmap(NULL, size + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        if (map != MAP_FAILED) {
+            unsigned char *start = (unsigned char *)huge_round((size_t)map, HUGE_PAGE_SIZE);
+            size_t        head   = start - map;
+
+            if (head) {
+                munmap(map, head);
+            }
+
+            munmap(start + size, HUGE_PAGE_SIZE - head);
+
+            if (madvise(start, size, MADV_HUGEPAGE)) {
+                munmap(start, size);
+            } else {
+                ptr   = start;
+                *kind = HUGE_PAGES_TRANSPARENT;
+            }
+        }
+    }
+#endif
+#endif
+
+    if (!ptr) {
+        /* the first fallback is reported, the rest are counted */
+        if (__sync_fetch_and_add(&huge_stats.fallback, 1) == 0) {
+            OPENDCP_LOG(LOG_WARN, "huge pages are not available, frame buffers use normal pages");
+        }
+
+        return NULL;
+    }
+
+    huge_stat_add(*kind == HUGE_PAGES_EXPLICIT ? &huge_stats.explicit_pages : &huge_stats.transparent);
+
+    return ptr;
+}
+
+/*!
+ @function opendcp_huge_free
+ @abstract Unmaps a buffer from opendcp_huge_alloc.
+ @param ptr The buffer.
+ @param size The size it was allocated with.
+ @param kind The HUGE_PAGES value it was allocated with.
+*/
+void opendcp_huge_free(void *ptr, size_t size, int kind) {
+    if (!ptr || kind == HUGE_PAGES_NONE) {
+        return;
+    }
+
+#ifdef _WIN32
+    UNUSED(size);
+    VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+    munmap(ptr, huge_round(size, HUGE_PAGE_SIZE));
+#endif
+}
+
+/*!
+ @function opendcp_huge_pages_stats
+ @abstract Returns how many buffers got huge pages.
+ @discussion The counts include the libasdcp frame buffers.
+ @param stats Set to the counts since the process started.
+*/
+void opendcp_huge_pages_stats(opendcp_huge_stats_t *stats) {
+    opendcp_huge_stats_t asdcp;
+
+    opendcp_huge_pages_asdcp_stats(&asdcp);
+
+    stats->explicit_pages = __sync_fetch_and_add(&huge_stats.explicit_pages, 0) + asdcp.explicit_pages;
+    stats->transparent    = __sync_fetch_and_add(&huge_stats.transparent, 0) + asdcp.transparent;
+    stats->fallback       = __sync_fetch_and_add(&huge_stats.fallback, 0) + asdcp.fallback;
+}
+
+/*!
+ @function opendcp_huge_pages_report
+ @abstract Prints how many frame buffers got huge pages.
+ @param fp The stream to print to.
+*/
+void opendcp_huge_pages_report(FILE *fp) {
+    opendcp_huge_stats_t stats;
+
+    opendcp_huge_pages_stats(&stats);
+
+    fprintf(fp, "\nhuge pages: %lu explicit, %lu transparent, %lu buffers on normal pages\n",
+            stats.explicit_pages, stats.transparent, stats.fallback);
+}
@@ -0,0 +1,398 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "opendcp.h"
+
+/* latency histograms have power of two buckets from 1us, the last one is open ended */
+#define METRIC_BUCKETS 25
+
+typedef struct {
+    unsigned long long count;
+    unsigned long long ns;
+    unsigned long long max_ns;
+    unsigned long long bytes;
+    unsigned long long depth;
+    unsigned long long depth_samples;
+    unsigned long long depth_max;
+    unsigned long long buckets[METRIC_BUCKETS];
+    int                threads;
+} metric_stage_t;
+
+struct opendcp_metrics_s {
+    unsigned long long start;
+    unsigned long long stop;
+    metric_stage_t     stages[METRIC_STAGES];
+};
+
+static const char *metric_stage_names[METRIC_STAGES] = { "read", "resize", "xyz", "encode", "write" };
+
+/*!
+ @function opendcp_metrics_now
+ @abstract Reads the monotonic clock.
+ @return The time in nanoseconds.
+*/
+unsigned long long opendcp_metrics_now(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/*!
+ @function opendcp_metrics_create
+ @abstract Creates a set of pipeline metrics.
+ @discussion Stages record into the metrics with atomic adds, so recording
+             takes no lock and any thread may record.
+ @return The metrics or NULL.
+*/
+opendcp_metrics_t *opendcp_metrics_create(void) {
+    opendcp_metrics_t *metrics = calloc(1, sizeof(opendcp_metrics_t));
+
+    if (metrics) {
+        metrics->start = opendcp_metrics_now();
+    }
+
+    return metrics;
+}
+
+/*!
+ @function opendcp_metrics_delete
+ @abstract Frees metrics created by opendcp_metrics_create.
+ @param metrics The metrics, may be NULL.
+*/
+void opendcp_metrics_delete(opendcp_metrics_t *metrics) {
+    free(metrics);
+}
+
+/*!
+ @function opendcp_metrics_record
+ @abstract Records one frame passing through a stage.
+ @discussion The frame is also recorded as a trace span while tracing.
+ @param metrics The metrics, nothing is recorded when NULL.
+ @param stage An OPENDCP_METRIC_STAGE.
+ @param start The opendcp_metrics_now time the frame entered the stage.
+ @param bytes The bytes the stage read or wrote for the frame.
+*/
+void opendcp_metrics_record(opendcp_metrics_t *metrics, int stage, unsigned long long start, unsigned long long bytes) {
+    metric_stage_t     *s;
+    unsigned long long now, ns, us, max;
+    int                bucket;
+
+    if (stage < 0 || stage >= METRIC_STAGES) {
+        return;
+    }
+
+    /* every recorded frame is a span of the trace too */
+    opendcp_trace_span(metric_stage_names[stage], start);
+
+    if (!metrics) {
+        return;
+    }
+
+    s   = &metrics->stages[stage];
+    now = opendcp_metrics_now();
+    ns  = now > start ? now - start : 0;
+
+    for (us = ns / 1000, bucket = 0; us > 1 && bucket < METRIC_BUCKETS - 1; us >>= 1) {
+        bucket++;
+    }
+
+    __atomic_fetch_add(&s->count, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&s->ns, ns, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&s->bytes, bytes, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&s->buckets[bucket], 1, __ATOMIC_RELAXED);
+
+    max = __atomic_load_n(&s->max_ns, __ATOMIC_RELAXED);
+
+    while (ns > max && !__atomic_compare_exchange_n(&s->max_ns, &max, ns, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+    __atomic_store_n(&metrics->stop, now, __ATOMIC_RELAXED);
+}
+
+/*!
+ @function opendcp_metrics_depth
+ @abstract Records the depth of the queue a stage takes its frames from.
+ @param metrics The metrics, nothing is recorded when NULL.
+ @param stage An OPENDCP_METRIC_STAGE.
+ @param depth The number of frames waiting.
+*/
+void opendcp_metrics_depth(opendcp_metrics_t *metrics, int stage, int depth) {
+    metric_stage_t     *s;
+    unsigned long long max;
+
+    if (!metrics || stage < 0 || stage >= METRIC_STAGES || depth < 0) {
+        return;
+    }
+
+    s = &metrics->stages[stage];
+
+    __atomic_fetch_add(&s->depth, depth, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&s->depth_samples, 1, __ATOMIC_RELAXED);
+
+    max = __atomic_load_n(&s->depth_max, __ATOMIC_RELAXED);
+
+    while ((unsigned long long)depth > max &&
+           !__atomic_compare_exchange_n(&s->depth_max, &max, depth, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+}
+
+/*!
+ @function opendcp_metrics_threads
+ @abstract Sets the number of threads running a stage, used for utilization.
+ @param metrics The metrics, may be NULL.
+ @param stage An OPENDCP_METRIC_STAGE.
+ @param threads The thread count.
+*/
+void opendcp_metrics_threads(opendcp_metrics_t *metrics, int stage, int threads) {
+    if (metrics && stage >= 0 && stage < METRIC_STAGES) {
+        metrics->stages[stage].threads = threads;
+    }
+}
+
+/*!
+ @function opendcp_metrics_rate
+ @abstract Reads the throughput of a stage while the pipeline is running.
+ @param metrics The metrics, may be NULL.
+ @param stage An OPENDCP_METRIC_STAGE.
+ @param fps Receives the frames per second since the metrics were created.
+ @param mbps Receives the megabytes per second since the metrics were created.
+ @return The number of frames the stage has seen.
+*/
+unsigned long long opendcp_metrics_rate(opendcp_metrics_t *metrics, int stage, double *fps, double *mbps) {
+    unsigned long long count, bytes;
+    double             wall;
+
+    *fps  = 0.0;
+    *mbps = 0.0;
+
+    if (!metrics || stage < 0 || stage >= METRIC_STAGES) {
+        return 0;
+    }
+
+    count = __atomic_load_n(&metrics->stages[stage].count, __ATOMIC_RELAXED);
+    bytes = __atomic_load_n(&metrics->stages[stage].bytes, __ATOMIC_RELAXED);
+    wall  = (opendcp_metrics_now() - metrics->start) / 1e9;
+
+    if (wall > 0) {
+        *fps  = count / wall;
+        *mbps = bytes / 1e6 / wall;
+    }
+
+    return count;
+}
+
+/*!
+ @function opendcp_metrics_totals
+ @abstract Reads what a stage has recorded so far.
+ @param metrics The metrics, may be NULL.
+ @param stage An OPENDCP_METRIC_STAGE.
+ @param ns Receives the time the frames spent in the stage, summed over its threads.
+ @param bytes Receives the bytes the stage read or wrote.
+ @return The number of frames the stage has seen.
+*/
+unsigned long long opendcp_metrics_totals(opendcp_metrics_t *metrics, int stage, unsigned long long *ns, unsigned long long *bytes) {
+    *ns    = 0;
+    *bytes = 0;
+
+    if (!metrics || stage < 0 || stage >= METRIC_STAGES) {
+        return 0;
+    }
+
+    *ns    = __atomic_load_n(&metrics->stages[stage].ns, __ATOMIC_RELAXED);
+    *bytes = __atomic_load_n(&metrics->stages[stage].bytes, __ATOMIC_RELAXED);
+
+    return __atomic_load_n(&metrics->stages[stage].count, __ATOMIC_RELAXED);
+}
+
+/*!
+ @function opendcp_metrics_stage_name
+ @abstract Returns the name of a stage.
+ @param stage An OPENDCP_METRIC_STAGE.
+ @return The name, such as "encode".
+*/
+const char *opendcp_metrics_stage_name(int stage) {
+    return stage >= 0 && stage < METRIC_STAGES ? metric_stage_names[stage] : "unknown";
+}
+
+/* latency below which the given fraction of frames fall, from the histogram */
+static double metric_percentile(metric_stage_t *s, double fraction) {
+    unsigned long long seen = 0, want;
+    int                i;
+
+    if (!s->count) {
+        return 0.0;
+    }
+
+    want = (unsigned long long)(s->count * fraction + 0.5);
+
+    for (i = 0; i < METRIC_BUCKETS; i++) {
+        seen += s->buckets[i];
+
+        if (seen >= want) {
+            break;
+        }
+    }
+
+    /* upper edge of the bucket, in ms */
+    return i >= METRIC_BUCKETS - 1 ? s->max_ns / 1e6 : (double)(2ULL << i) / 1000.0;
+}
+
+static double metric_wall(opendcp_metrics_t *metrics) {
+    return metrics->stop > metrics->start ? (metrics->stop - metrics->start) / 1e9 : 0.0;
+}
+
+static double metric_busy(opendcp_metrics_t *metrics, metric_stage_t *s) {
+    double wall = metric_wall(metrics);
+    int    threads = s->threads > 0 ? s->threads : 1;
+
+    return wall > 0 ? 100.0 * (s->ns / 1e9) / (wall * threads) : 0.0;
+}
+
+/*!
+ @function opendcp_metrics_report
+ @abstract Prints a per stage throughput and latency table.
+ @param metrics The metrics.
+ @param fp The stream to print to.
+*/
+void opendcp_metrics_report(opendcp_metrics_t *metrics, FILE *fp) {
+    metric_stage_t *s;
+    double         wall;
+    int            i;
+
+    if (!metrics) {
+        return;
+    }
+
+    wall = metric_wall(metrics);
+
+    fprintf(fp, "\n%-8s %8s %9s %9s %9s %9s %9s %7s %7s %6s %10s\n",
+            "stage", "frames", "frames/s", "mean ms", "p50 ms", "p95 ms", "max ms", "threads", "busy %", "queue", "MB");
+
+    for (i = 0; i < METRIC_STAGES; i++) {
+        s = &metrics->stages[i];
+
+        if (!s->count) {
+            continue;
+        }
+
+        fprintf(fp, "%-8s %8llu %9.2f %9.2f %9.2f %9.2f %9.2f %7d %7.1f %6.1f %10.1f\n",
+                metric_stage_names[i], s->count, wall > 0 ? s->count / wall : 0.0,
+                s->ns / 1e6 / s->count, metric_percentile(s, 0.5), metric_percentile(s, 0.95), s->max_ns / 1e6,
+                s->threads, metric_busy(metrics, s),
+                s->depth_samples ? (double)s->depth / s->depth_samples : 0.0, s->bytes / 1e6);
+    }
+
+    fprintf(fp, "elapsed %.2fs\n", wall);
+}
+
+/*!
+ @function opendcp_metrics_dump
+ @abstract Writes the metrics for a dashboard to collect.
+ @discussion The JSON form holds every stage with its histogram, the
+             Prometheus form is the text exposition format, suitable for a
+             node exporter text file collector.
+ @param metrics The metrics.
+ @param file The file to write.
+ @param format OPENDCP_METRICS_JSON or OPENDCP_METRICS_PROMETHEUS.
+ @return OPENDCP_NO_ERROR or OPENDCP_ERROR.
+*/
+int opendcp_metrics_dump(opendcp_metrics_t *metrics, const char *file, int format) {
+    metric_stage_t     *s;
+    FILE               *fp;
+    unsigned long long cumulative;
+    int                i, b;
+
+    if (!metrics) {
+        return OPENDCP_ERROR;
+    }
+
+    fp = fopen(file, "w");
+
+    if (!fp) {
+        OPENDCP_LOG(LOG_ERROR, "could not write metrics to %s", file);
+        return OPENDCP_ERROR;
+    }
+
+    if (format == OPENDCP_METRICS_PROMETHEUS) {
+        fprintf(fp, "# TYPE opendcp_elapsed_seconds gauge\nopendcp_elapsed_seconds %.6f\n", metric_wall(metrics));
+        fprintf(fp, "# TYPE opendcp_stage_seconds histogram\n");
+
+        for (i = 0; i < METRIC_STAGES; i++) {
+            s = &metrics->stages[i];
+
+            for (b = 0, cumulative = 0; b < METRIC_BUCKETS - 1; b++) {
+                cumulative += s->buckets[b];
+                fprintf(fp, "opendcp_stage_seconds_bucket{stage=\"%s\",le=\"%g\"} %llu\n",
+                        metric_stage_names[i], (double)(2ULL << b) / 1e6, cumulative);
+            }
+
+            fprintf(fp, "opendcp_stage_seconds_bucket{stage=\"%s\",le=\"+Inf\"} %llu\n", metric_stage_names[i], s->count);
+            fprintf(fp, "opendcp_stage_seconds_sum{stage=\"%s\"} %.6f\n", metric_stage_names[i], s->ns / 1e9);
+            fprintf(fp, "opendcp_stage_seconds_count{stage=\"%s\"} %llu\n", metric_stage_names[i], s->count);
+        }
+
+        fprintf(fp, "# TYPE opendcp_stage_bytes_total counter\n");
+
+        for (i = 0; i < METRIC_STAGES; i++) {
+            fprintf(fp, "opendcp_stage_bytes_total{stage=\"%s\"} %llu\n", metric_stage_names[i], metrics->stages[i].bytes);
+        }
+
+        fprintf(fp, "# TYPE opendcp_stage_busy_ratio gauge\n");
+
+        for (i = 0; i < METRIC_STAGES; i++) {
+            fprintf(fp, "opendcp_stage_busy_ratio{stage=\"%s\"} %.4f\n", metric_stage_names[i],
+                    metric_busy(metrics, &metrics->stages[i]) / 100.0);
+        }
+
+        fprintf(fp, "# TYPE opendcp_stage_queue_depth_max gauge\n");
+
+        for (i = 0; i < METRIC_STAGES; i++) {
+            fprintf(fp, "opendcp_stage_queue_depth_max{stage=\"%s\"} %llu\n", metric_stage_names[i], metrics->stages[i].depth_max);
+        }
+    } else {
+        fprintf(fp, "{\n  \"elapsed\": %.6f,\n  \"stages\": {", metric_wall(metrics));
+
+        for (i = 0; i < METRIC_STAGES; i++) {
+            s = &metrics->stages[i];
+
+            fprintf(fp, "%s\n    \"%s\": {\"frames\": %llu, \"seconds\": %.6f, \"max_seconds\": %.6f, \"bytes\": %llu, "
+                    "\"threads\": %d, \"busy\": %.4f, \"queue_mean\": %.2f, \"queue_max\": %llu, \"histogram_us\": [",
+                    i ? "," : "", metric_stage_names[i], s->count, s->ns / 1e9, s->max_ns / 1e9, s->bytes,
+                    s->threads, metric_busy(metrics, s) / 100.0,
+                    s->depth_samples ? (double)s->depth / s->depth_samples : 0.0, s->depth_max);
+
+            for (b = 0; b < METRIC_BUCKETS; b++) {
+                fprintf(fp, "%s%llu", b ? ", " : "", s->buckets[b]);
+            }
+
+            fprintf(fp, "]}");
+        }
+
+        fprintf(fp, "\n  }\n}\n");
+    }
+
+    if (fclose(fp)) {
+        return OPENDCP_ERROR;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
@@ -0,0 +1,169 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifdef __linux__
+#define _GNU_SOURCE
+#include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "opendcp.h"
+
+/*
+   Nodes and their cpus are read from sysfs, and threads are bound with
+   sched_setaffinity plus a preferred memory policy, so there is no libnuma
+   dependency. Elsewhere every thread is on node 0 and binding does nothing.
+*/
+#define NUMA_NODES_MAX     64
+#define NUMA_MPOL_PREFERRED 1
+
+static __thread int numa_thread_node = -1;
+
+#ifdef __linux__
+/* parses a sysfs cpu list such as "0-7,16-23" */
+static int numa_cpulist(int node, cpu_set_t *set) {
+    char path[64], list[1024], *token, *save, *dash;
+    FILE *fp;
+    int  first, last, count = 0;
+
+    CPU_ZERO(set);
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", node);
+    fp = fopen(path, "r");
+
+    if (!fp) {
+        return 0;
+    }
+
+    if (!fgets(list, sizeof(list), fp)) {
+        list[0] = '\0';
+    }
+
+    fclose(fp);
+
+    for (token = strtok_r(list, ",\n", &save); token; token = strtok_r(NULL, ",\n", &save)) {
+        first = last = atoi(token);
+        dash  = strchr(token, '-');
+
+        if (dash) {
+            last = atoi(dash + 1);
+        }
+
+        for (; first <= last && first < CPU_SETSIZE; first++) {
+            CPU_SET(first, set);
+            count++;
+        }
+    }
+
+    return count;
+}
+#endif
+
+/*!
+ @function opendcp_numa_nodes
+ @abstract Returns the number of NUMA nodes that have cpus.
+ @return The node count, 1 on systems without NUMA information.
+*/
+int opendcp_numa_nodes(void) {
+#ifdef __linux__
+    static int nodes = 0;
+    cpu_set_t  set;
+    int        node;
+
+    if (nodes) {
+        return nodes;
+    }
+
+    for (node = 0; node < NUMA_NODES_MAX && numa_cpulist(node, &set); node++);
+
+    nodes = node > 0 ? node : 1;
+
+    return nodes;
+#else
+    return 1;
+#endif
+}
+
+/*!
+ @function opendcp_numa_cpus
+ @abstract Returns the number of cpus on a NUMA node.
+ @param node The node.
+ @return The cpu count, 0 if the node does not exist.
+*/
+int opendcp_numa_cpus(int node) {
+#ifdef __linux__
+    cpu_set_t set;
+
+    return numa_cpulist(node, &set);
+#else
+    return node ? 0 : 1;
+#endif
+}
+
+/*!
+ @function opendcp_numa_bind
+ @abstract Runs the calling thread on the cpus of a node and allocates its memory there.
+ @discussion Memory the thread touches first after binding comes from the
+             node, so buffers a bound thread allocates stay local to it.
+ @param node The node.
+ @return OPENDCP_NO_ERROR on success, otherwise OPENDCP_ERROR.
+*/
+int opendcp_numa_bind(int node) {
+#ifdef __linux__
+    cpu_set_t     set;
+    unsigned long mask[NUMA_NODES_MAX / (8 * sizeof(unsigned long)) + 1];
+
+    if (node < 0 || node >= NUMA_NODES_MAX || !numa_cpulist(node, &set)) {
+        return OPENDCP_ERROR;
+    }
+
+    if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set)) {
+        OPENDCP_LOG(LOG_WARN, "could not bind thread to numa node %d", node);
+        return OPENDCP_ERROR;
+    }
+
+    memset(mask, 0, sizeof(mask));
+    mask[node / (8 * sizeof(unsigned long))] = 1UL << (node % (8 * sizeof(unsigned long)));
+
+#ifdef SYS_set_mempolicy
+    if (syscall(SYS_set_mempolicy, NUMA_MPOL_PREFERRED, mask, NUMA_NODES_MAX + 1)) {
+        OPENDCP_LOG(LOG_DEBUG, "could not set memory policy for numa node %d", node);
+    }
+#endif
+
+    numa_thread_node = node;
+
+    return OPENDCP_NO_ERROR;
+#else
+    numa_thread_node = node;
+
+    return OPENDCP_NO_ERROR;
+#endif
+}
+
+/*!
+ @function opendcp_numa_node
+ @abstract Returns the node the calling thread was bound to.
+ @return The node, or -1 if opendcp_numa_bind was not called by this thread.
+*/
+int opendcp_numa_node(void) {
+    return numa_thread_node;
+}
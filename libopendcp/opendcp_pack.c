@@ -0,0 +1,438 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include "opendcp.h"
+
+#ifdef _WIN32
+#define pack_seek(fp, offset) _fseeki64(fp, offset, SEEK_SET)
+#define pack_tell(fp)         _ftelli64(fp)
+#else
+#define pack_seek(fp, offset) fseeko(fp, (off_t)(offset), SEEK_SET)
+#define pack_tell(fp)         ftello(fp)
+#endif
+
+/*
+   A frame store is one file holding the codestreams of a track:
+
+       header   "ODCPPACK" version(4)
+       frames   codestreams appended in track order
+       index    offset(8) size(4) for every frame
+       trailer  index offset(8) frame count(4) "ODCPPACK"
+
+   Integers are little endian. The index is written when the store is
+   closed, so a store without a trailer was not finished. Several index
+   entries may point at the same codestream, held frames are stored once.
+*/
+#define PACK_MAGIC        "ODCPPACK"
+#define PACK_MAGIC_LENGTH 8
+#define PACK_VERSION      1
+#define PACK_HEADER_SIZE  (PACK_MAGIC_LENGTH + 4)
+#define PACK_ENTRY_SIZE   12
+#define PACK_TRAILER_SIZE (8 + 4 + PACK_MAGIC_LENGTH)
+
+typedef struct {
+    uint64_t     offset;
+    unsigned int size;
+} pack_entry_t;
+
+struct opendcp_pack_s {
+    FILE            *fp;
+    char            *file;
+    int             writing;
+    int             failed;
+    uint64_t        end;            /* where the next codestream goes */
+    pack_entry_t    *entries;
+    unsigned int    count;
+    unsigned int    alloc;
+    pthread_mutex_t mutex;          /* readers share the file position */
+};
+
+static void pack_put(unsigned char *p, uint64_t value, int bytes) {
+    int i;
+
+    for (i = 0; i < bytes; i++) {
+        p[i] = (unsigned char)(value >> (8 * i));
+    }
+}
+
+static uint64_t pack_get(const unsigned char *p, int bytes) {
+    uint64_t value = 0;
+    int      i;
+
+    for (i = bytes - 1; i >= 0; i--) {
+        value = value << 8 | p[i];
+    }
+
+    return value;
+}
+
+static opendcp_pack_t *pack_alloc(const char *file, FILE *fp, int writing) {
+    opendcp_pack_t *pack = calloc(1, sizeof(opendcp_pack_t));
+
+    if (!pack) {
+        return NULL;
+    }
+
+    pack->fp      = fp;
+    pack->file    = strdup(file);
+    pack->writing = writing;
+    pthread_mutex_init(&pack->mutex, NULL);
+
+    return pack;
+}
+
+static void pack_free(opendcp_pack_t *pack) {
+    pthread_mutex_destroy(&pack->mutex);
+    free(pack->entries);
+    free(pack->file);
+    free(pack);
+}
+
+static int pack_entry(opendcp_pack_t *pack, uint64_t offset, unsigned int size) {
+    if (pack->count == pack->alloc) {
+        unsigned int alloc  = pack->alloc ? pack->alloc * 2 : 1024;
+        pack_entry_t *grown = realloc(pack->entries, alloc * sizeof(pack_entry_t));
+
+        if (!grown) {
+            return OPENDCP_ERROR;
+        }
+
+        pack->entries = grown;
+        pack->alloc   = alloc;
+    }
+
+    pack->entries[pack->count].offset = offset;
+    pack->entries[pack->count].size   = size;
+    pack->count++;
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*!
+ @function opendcp_pack_create
+ @abstract Creates a frame store, a single file holding every codestream of a track.
+ @discussion Codestreams are appended with opendcp_pack_add in track order
+             and the index is written by opendcp_pack_close. A track of many
+             thousand frames becomes one file, which is cheaper to create,
+             copy and delete than one file per frame.
+ @param file The file to create or replace.
+ @return The store or NULL.
+*/
+opendcp_pack_t *opendcp_pack_create(const char *file) {
+    opendcp_pack_t *pack;
+    unsigned char  header[PACK_HEADER_SIZE];
+    FILE           *fp = fopen(file, "wb");
+
+    if (!fp) {
+        OPENDCP_LOG(LOG_ERROR, "could not create frame store %s", file);
+        return NULL;
+    }
+
+    memcpy(header, PACK_MAGIC, PACK_MAGIC_LENGTH);
+    pack_put(header + PACK_MAGIC_LENGTH, PACK_VERSION, 4);
+
+    if (fwrite(header, 1, PACK_HEADER_SIZE, fp) != PACK_HEADER_SIZE || !(pack = pack_alloc(file, fp, 1))) {
+        OPENDCP_LOG(LOG_ERROR, "could not create frame store %s", file);
+        fclose(fp);
+        remove(file);
+        return NULL;
+    }
+
+    pack->end = PACK_HEADER_SIZE;
+
+    return pack;
+}
+
+/*!
+ @function opendcp_pack_add
+ @abstract Appends the codestream of the next frame to a frame store.
+ @param pack The store from opendcp_pack_create.
+ @param data The codestream.
+ @param size The codestream size in bytes.
+ @return OPENDCP_NO_ERROR or OPENDCP_ERROR.
+*/
+int opendcp_pack_add(opendcp_pack_t *pack, const unsigned char *data, unsigned int size) {
+    if (!pack->writing || pack->failed) {
+        return OPENDCP_ERROR;
+    }
+
+    if (fwrite(data, 1, size, pack->fp) != size || pack_entry(pack, pack->end, size) != OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_ERROR, "could not write frame %u to %s", pack->count, pack->file);
+        pack->failed = 1;
+        return OPENDCP_ERROR;
+    }
+
+    pack->end += size;
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*!
+ @function opendcp_pack_repeat
+ @abstract Adds a frame that repeats the previous codestream.
+ @discussion The codestream is not stored again, the new index entry points
+             at the previous frame's data.
+ @param pack The store from opendcp_pack_create.
+ @return OPENDCP_NO_ERROR or OPENDCP_ERROR.
+*/
+int opendcp_pack_repeat(opendcp_pack_t *pack) {
+    if (!pack->writing || pack->failed || !pack->count) {
+        return OPENDCP_ERROR;
+    }
+
+    if (pack_entry(pack, pack->entries[pack->count - 1].offset, pack->entries[pack->count - 1].size) != OPENDCP_NO_ERROR) {
+        pack->failed = 1;
+        return OPENDCP_ERROR;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* write the index and trailer after the last codestream */
+static int pack_finish(opendcp_pack_t *pack) {
+    unsigned char entry[PACK_ENTRY_SIZE];
+    unsigned char trailer[PACK_TRAILER_SIZE];
+    unsigned int  i;
+
+    for (i = 0; i < pack->count; i++) {
+        pack_put(entry, pack->entries[i].offset, 8);
+        pack_put(entry + 8, pack->entries[i].size, 4);
+
+        if (fwrite(entry, 1, PACK_ENTRY_SIZE, pack->fp) != PACK_ENTRY_SIZE) {
+            return OPENDCP_ERROR;
+        }
+    }
+
+    pack_put(trailer, pack->end, 8);
+    pack_put(trailer + 8, pack->count, 4);
+    memcpy(trailer + 12, PACK_MAGIC, PACK_MAGIC_LENGTH);
+
+    if (fwrite(trailer, 1, PACK_TRAILER_SIZE, pack->fp) != PACK_TRAILER_SIZE) {
+        return OPENDCP_ERROR;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*!
+ @function opendcp_pack_close
+ @abstract Closes a frame store and frees it.
+ @discussion A store being written gets its index, a store that failed or
+             could not be finished is removed.
+ @param pack The store, may be NULL.
+ @return OPENDCP_NO_ERROR or OPENDCP_ERROR.
+*/
+int opendcp_pack_close(opendcp_pack_t *pack) {
+    int result = OPENDCP_NO_ERROR;
+
+    if (!pack) {
+        return OPENDCP_NO_ERROR;
+    }
+
+    if (pack->writing && (pack->failed || pack_finish(pack) != OPENDCP_NO_ERROR)) {
+        result = OPENDCP_ERROR;
+    }
+
+    if (fclose(pack->fp) && pack->writing) {
+        result = OPENDCP_ERROR;
+    }
+
+    if (pack->writing) {
+        if (result == OPENDCP_NO_ERROR) {
+            OPENDCP_LOG(LOG_INFO, "wrote %u frames, %.1f MB to frame store %s", pack->count,
+                        pack->end / 1048576.0, pack->file);
+        } else {
+            OPENDCP_LOG(LOG_ERROR, "could not finish frame store %s", pack->file);
+            remove(pack->file);
+        }
+    }
+
+    pack_free(pack);
+
+    return result;
+}
+
+/*!
+ @function opendcp_pack_abort
+ @abstract Closes a frame store without finishing it, a store being written is removed.
+ @param pack The store, may be NULL.
+*/
+void opendcp_pack_abort(opendcp_pack_t *pack) {
+    if (pack) {
+        fclose(pack->fp);
+
+        if (pack->writing) {
+            remove(pack->file);
+        }
+
+        pack_free(pack);
+    }
+}
+
+/*!
+ @function opendcp_pack_is
+ @abstract Checks whether a file starts like a frame store.
+ @param file The file to check.
+ @return Non-zero for a frame store.
+*/
+int opendcp_pack_is(const char *file) {
+    unsigned char header[PACK_HEADER_SIZE];
+    FILE          *fp = fopen(file, "rb");
+    int           is;
+
+    if (!fp) {
+        return 0;
+    }
+
+    is = fread(header, 1, PACK_HEADER_SIZE, fp) == PACK_HEADER_SIZE && !memcmp(header, PACK_MAGIC, PACK_MAGIC_LENGTH);
+    fclose(fp);
+
+    return is;
+}
+
+/* read the trailer and index of a finished store */
+static int pack_load(opendcp_pack_t *pack) {
+    unsigned char header[PACK_HEADER_SIZE];
+    unsigned char trailer[PACK_TRAILER_SIZE];
+    unsigned char entry[PACK_ENTRY_SIZE];
+    int64_t       length;
+    uint64_t      index;
+    unsigned int  count, i;
+
+    if (fread(header, 1, PACK_HEADER_SIZE, pack->fp) != PACK_HEADER_SIZE ||
+        memcmp(header, PACK_MAGIC, PACK_MAGIC_LENGTH) || pack_get(header + PACK_MAGIC_LENGTH, 4) != PACK_VERSION) {
+        return OPENDCP_ERROR;
+    }
+
+    if (fseek(pack->fp, 0, SEEK_END) || (length = pack_tell(pack->fp)) < PACK_HEADER_SIZE + PACK_TRAILER_SIZE ||
+        pack_seek(pack->fp, length - PACK_TRAILER_SIZE) ||
+        fread(trailer, 1, PACK_TRAILER_SIZE, pack->fp) != PACK_TRAILER_SIZE ||
+        memcmp(trailer + 12, PACK_MAGIC, PACK_MAGIC_LENGTH)) {
+        return OPENDCP_ERROR;
+    }
+
+    index = pack_get(trailer, 8);
+    count = (unsigned int)pack_get(trailer + 8, 4);
+
+    if (index + (uint64_t)count * PACK_ENTRY_SIZE + PACK_TRAILER_SIZE != (uint64_t)length || pack_seek(pack->fp, index)) {
+        return OPENDCP_ERROR;
+    }
+
+    for (i = 0; i < count; i++) {
+        if (fread(entry, 1, PACK_ENTRY_SIZE, pack->fp) != PACK_ENTRY_SIZE ||
+            pack_entry(pack, pack_get(entry, 8), (unsigned int)pack_get(entry + 8, 4)) != OPENDCP_NO_ERROR) {
+            return OPENDCP_ERROR;
+        }
+
+        if (pack->entries[i].offset < PACK_HEADER_SIZE || pack->entries[i].offset + pack->entries[i].size > index) {
+            return OPENDCP_ERROR;
+        }
+    }
+
+    pack->end = index;
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*!
+ @function opendcp_pack_open
+ @abstract Opens a finished frame store for reading.
+ @param file The store.
+ @return The store or NULL when the file is not a finished frame store.
+*/
+opendcp_pack_t *opendcp_pack_open(const char *file) {
+    opendcp_pack_t *pack;
+    FILE           *fp = fopen(file, "rb");
+
+    if (!fp) {
+        OPENDCP_LOG(LOG_ERROR, "could not open frame store %s", file);
+        return NULL;
+    }
+
+    if (!(pack = pack_alloc(file, fp, 0))) {
+        fclose(fp);
+        return NULL;
+    }
+
+    if (pack_load(pack) != OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_ERROR, "%s is not a finished frame store", file);
+        fclose(fp);
+        pack_free(pack);
+        return NULL;
+    }
+
+    return pack;
+}
+
+/*!
+ @function opendcp_pack_count
+ @abstract Returns the number of frames in a frame store.
+ @param pack The store.
+ @return The frame count.
+*/
+unsigned int opendcp_pack_count(opendcp_pack_t *pack) {
+    return pack->count;
+}
+
+/*!
+ @function opendcp_pack_read
+ @abstract Reads the codestream of a frame from a frame store.
+ @discussion Safe to call from several threads, reads are serialized on the
+             file. Reading the frames in order reads the file front to back.
+ @param pack The store from opendcp_pack_open.
+ @param index The frame, zero based.
+ @param buffer Receives the codestream.
+ @param capacity The size of buffer.
+ @param size Receives the codestream size.
+ @return OPENDCP_NO_ERROR or OPENDCP_ERROR, also when the codestream does not fit.
+*/
+int opendcp_pack_read(opendcp_pack_t *pack, unsigned int index, unsigned char *buffer, unsigned int capacity,
+                      unsigned int *size) {
+    pack_entry_t *entry;
+    int          result = OPENDCP_NO_ERROR;
+
+    if (pack->writing || index >= pack->count) {
+        return OPENDCP_ERROR;
+    }
+
+    entry = &pack->entries[index];
+
+    if (entry->size > capacity) {
+        OPENDCP_LOG(LOG_ERROR, "frame %u of %s is %u bytes, larger than the %u byte buffer", index, pack->file,
+                    entry->size, capacity);
+        return OPENDCP_ERROR;
+    }
+
+    pthread_mutex_lock(&pack->mutex);
+
+    if (pack_seek(pack->fp, entry->offset) || fread(buffer, 1, entry->size, pack->fp) != entry->size) {
+        OPENDCP_LOG(LOG_ERROR, "could not read frame %u of %s", index, pack->file);
+        result = OPENDCP_ERROR;
+    }
+
+    pthread_mutex_unlock(&pack->mutex);
+
+    *size = entry->size;
+
+    return result;
+}
@@ -0,0 +1,314 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+#include "opendcp.h"
+
+/*
+   Thread pool. One pool of worker threads serves every parallel stage of
+   the process. opendcp_pool_run queues the items of a call as tasks and
+   runs them on the workers and on the calling thread. A caller never
+   waits for a task no thread has started: it takes its own queued tasks
+   back and runs them, and only waits for the ones already running. So a
+   task may call opendcp_pool_run itself, the nested items run on what is
+   left of the pool and on the thread of the task, and the process runs
+   no more threads than the pool holds, however deep the nesting.
+
+   Tasks of a higher priority are started first.
+*/
+#define POOL_THREADS_MAX 256
+
+typedef struct pool_task_s  pool_task_t;
+typedef struct pool_group_s pool_group_t;
+
+struct pool_group_s {
+    int             remaining;    /* tasks queued or running */
+    pthread_cond_t  done;
+};
+
+struct pool_task_s {
+    void         *(*fn)(void *);
+    void         *arg;
+    int          priority;
+    pool_group_t *group;
+    pool_task_t  *prev;
+    pool_task_t  *next;
+    int          queued;
+};
+
+typedef struct {
+    pool_task_t *head;
+    pool_task_t *tail;
+} pool_queue_t;
+
+static pthread_mutex_t pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  pool_cond  = PTHREAD_COND_INITIALIZER;
+static pool_queue_t    pool_queues[POOL_PRIORITIES];
+static int             pool_target  = 0;    /* workers wanted, the calling threads come on top */
+static int             pool_workers = 0;    /* workers running */
+
+static int pool_cpus(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+
+    GetSystemInfo(&info);
+
+    return info.dwNumberOfProcessors > 0 ? (int)info.dwNumberOfProcessors : 1;
+#else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return n > 0 ? (int)n : 1;
+#endif
+}
+
+/* caller holds pool_mutex */
+static void pool_push(pool_task_t *task) {
+    pool_queue_t *queue = &pool_queues[task->priority];
+
+    task->prev   = queue->tail;
+    task->next   = NULL;
+    task->queued = 1;
+
+    if (queue->tail) {
+        queue->tail->next = task;
+    } else {
+        queue->head = task;
+    }
+
+    queue->tail = task;
+}
+
+/* caller holds pool_mutex */
+static void pool_unlink(pool_task_t *task) {
+    pool_queue_t *queue = &pool_queues[task->priority];
+
+    if (task->prev) {
+        task->prev->next = task->next;
+    } else {
+        queue->head = task->next;
+    }
+
+    if (task->next) {
+        task->next->prev = task->prev;
+    } else {
+        queue->tail = task->prev;
+    }
+
+    task->queued = 0;
+}
+
+/* the first task of the highest priority, caller holds pool_mutex */
+static pool_task_t *pool_pop(void) {
+    int p;
+
+    for (p = 0; p < POOL_PRIORITIES; p++) {
+        pool_task_t *task = pool_queues[p].head;
+
+        if (task) {
+            pool_unlink(task);
+            return task;
+        }
+    }
+
+    return NULL;
+}
+
+/* run a task taken off the queue, caller holds pool_mutex, which is released meanwhile */
+static void pool_execute(pool_task_t *task) {
+    pool_group_t *group = task->group;
+
+    pthread_mutex_unlock(&pool_mutex);
+    task->fn(task->arg);
+    pthread_mutex_lock(&pool_mutex);
+
+    if (--group->remaining == 0) {
+        pthread_cond_signal(&group->done);
+    }
+}
+
+static void *pool_worker(void *arg) {
+    pool_task_t *task;
+
+    UNUSED(arg);
+
+    pthread_mutex_lock(&pool_mutex);
+
+    while (pool_workers <= pool_target) {
+        task = pool_pop();
+
+        if (!task) {
+            pthread_cond_wait(&pool_cond, &pool_mutex);
+            continue;
+        }
+
+        pool_execute(task);
+    }
+
+    pool_workers--;
+    pthread_mutex_unlock(&pool_mutex);
+
+    return NULL;
+}
+
+/* start workers up to the target, caller holds pool_mutex */
+static void pool_start(void) {
+    pthread_attr_t attr;
+    pthread_t      thread;
+
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+
+    while (pool_workers < pool_target) {
+        if (pthread_create(&thread, &attr, pool_worker, NULL)) {
+            OPENDCP_LOG(LOG_WARN, "thread pool started %d of %d threads", pool_workers, pool_target);
+            pool_target = pool_workers;
+            break;
+        }
+
+        pool_workers++;
+    }
+
+    pthread_attr_destroy(&attr);
+}
+
+/*!
+ @function opendcp_pool_init
+ @abstract Sets the number of threads of the thread pool.
+ @discussion The threads count includes the calling thread of
+     opendcp_pool_run, so the pool starts one worker fewer. A pool that
+     is not set up when it is first used takes one thread per processor.
+     The pool may be resized at any time; workers above a smaller size
+     exit once they finish their task.
+ @param threads The thread count, 0 or less for one per processor.
+*/
+void opendcp_pool_init(int threads) {
+    if (threads <= 0) {
+        threads = pool_cpus();
+    }
+
+    threads = threads > POOL_THREADS_MAX ? POOL_THREADS_MAX : threads;
+
+    pthread_mutex_lock(&pool_mutex);
+    pool_target = threads - 1;
+    pool_start();
+    pthread_cond_broadcast(&pool_cond);
+    pthread_mutex_unlock(&pool_mutex);
+}
+
+/*!
+ @function opendcp_pool_threads
+ @abstract Returns the number of threads of the thread pool.
+ @discussion Before the pool is set up this is the processor count the pool
+     would be started with.
+ @return The thread count, the calling thread included.
+*/
+int opendcp_pool_threads(void) {
+    int threads;
+
+    pthread_mutex_lock(&pool_mutex);
+    threads = pool_workers || pool_target ? pool_target + 1 : pool_cpus();
+    pthread_mutex_unlock(&pool_mutex);
+
+    return threads;
+}
+
+/*!
+ @function opendcp_pool_run
+ @abstract Runs a function on each item of an array on the thread pool.
+ @discussion The first item runs on the calling thread, the others are
+     queued for the pool at the given priority. While the pool is busy the
+     calling thread takes its queued items back and runs them itself, so
+     the call may be made from within a pool task. Returns once every item
+     has run.
+ @param fn The function, called with a pointer to an item.
+ @param items The array of items.
+ @param size The size of an item.
+ @param count The number of items.
+ @param priority A POOL_PRIORITY value.
+*/
+void opendcp_pool_run(void *(*fn)(void *), void *items, size_t size, int count, int priority) {
+    pool_task_t  *tasks;
+    pool_group_t group;
+    int          i;
+
+    if (count < 1) {
+        return;
+    }
+
+    priority = priority < 0 ? 0 : (priority >= POOL_PRIORITIES ? POOL_PRIORITIES - 1 : priority);
+    tasks    = count > 1 ? malloc((count - 1) * sizeof(pool_task_t)) : NULL;
+
+    /* without room for the tasks the items run here one after the other */
+    if (!tasks) {
+        for (i = 0; i < count; i++) {
+            fn((char *)items + i * size);
+        }
+
+        return;
+    }
+
+    group.remaining = count - 1;
+    pthread_cond_init(&group.done, NULL);
+
+    pthread_mutex_lock(&pool_mutex);
+
+    if (!pool_workers && !pool_target) {
+        pool_target = pool_cpus() - 1;
+        pool_start();
+    }
+
+    for (i = 0; i < count - 1; i++) {
+        tasks[i].fn       = fn;
+        tasks[i].arg      = (char *)items + (i + 1) * size;
+        tasks[i].priority = priority;
+        tasks[i].group    = &group;
+        pool_push(&tasks[i]);
+    }
+
+    pthread_cond_broadcast(&pool_cond);
+    pthread_mutex_unlock(&pool_mutex);
+
+    fn(items);
+
+    pthread_mutex_lock(&pool_mutex);
+
+    /* take back the items no worker has started, last queued first */
+    for (i = count - 2; i >= 0; i--) {
+        if (tasks[i].queued) {
+            pool_unlink(&tasks[i]);
+            pool_execute(&tasks[i]);
+        }
+    }
+
+    while (group.remaining) {
+        pthread_cond_wait(&group.done, &pool_mutex);
+    }
+
+    pthread_mutex_unlock(&pool_mutex);
+
+    pthread_cond_destroy(&group.done);
+    free(tasks);
+}
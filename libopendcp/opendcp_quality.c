@@ -0,0 +1,584 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <pthread.h>
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#endif
+#include "opendcp.h"
+#include "opendcp_image.h"
+#include "codecs/opendcp_decoder.h"
+#include "cpu.h"
+
+/*
+   Encode quality control. An encoded frame is decoded again and compared
+   with the source as the encoder got it, after the xyz conversion. The
+   psnr is taken per component, the ssim on y over 8x8 windows stepped by
+   4. The window sums are added up from exact integer sums of 4x4 blocks,
+   so the simd and scalar kernels give the same result.
+*/
+#define QUALITY_PEAK      4095.0
+#define QUALITY_PSNR_MAX  100.0
+#define QUALITY_BLOCK     4
+#define QUALITY_C1        ((0.01 * QUALITY_PEAK) * (0.01 * QUALITY_PEAK))
+#define QUALITY_C2        ((0.03 * QUALITY_PEAK) * (0.03 * QUALITY_PEAK))
+
+typedef struct {
+    char   *file;
+    double psnr[3];
+    double psnr_all;      /* from the mean squared error of the three components */
+    double ssim;
+} quality_frame_t;
+
+/* sums of a 4x4 block of the source a and decoded b */
+typedef struct {
+    int32_t a;
+    int32_t b;
+    int32_t aa;
+    int32_t bb;
+    int32_t ab;
+} quality_block_t;
+
+struct opendcp_quality_s {
+    int             reduce;
+    pthread_mutex_t mutex;
+    quality_frame_t *frames;
+    int             count;
+    int             alloc;
+    int             skipped;
+};
+
+/*!
+ @function opendcp_quality_create
+ @abstract Creates the quality report of an encode.
+ @param reduce The resolution levels the codestreams are decoded with, 0
+               compares at full resolution. Higher levels are faster, the
+               source is then box filtered down to the decoded size.
+ @return The report or NULL.
+*/
+opendcp_quality_t *opendcp_quality_create(int reduce) {
+    opendcp_quality_t *quality = calloc(1, sizeof(opendcp_quality_t));
+
+    if (!quality) {
+        return NULL;
+    }
+
+    quality->reduce = reduce;
+    pthread_mutex_init(&quality->mutex, NULL);
+
+    return quality;
+}
+
+/*!
+ @function opendcp_quality_delete
+ @abstract Frees a report created by opendcp_quality_create.
+ @param quality The report, may be NULL.
+*/
+void opendcp_quality_delete(opendcp_quality_t *quality) {
+    int i;
+
+    if (!quality) {
+        return;
+    }
+
+    for (i = 0; i < quality->count; i++) {
+        free(quality->frames[i].file);
+    }
+
+    pthread_mutex_destroy(&quality->mutex);
+    free(quality->frames);
+    free(quality);
+}
+
+static uint64_t quality_ssd_scalar(const int *a, const int *b, int n) {
+    uint64_t sum = 0;
+    int      i;
+
+    for (i = 0; i < n; i++) {
+        int64_t d = a[i] - b[i];
+        sum += d * d;
+    }
+
+    return sum;
+}
+
+static void quality_blocks_scalar(const int *a, const int *b, int nblocks, quality_block_t *blocks) {
+    int i, k;
+
+    for (k = 0; k < nblocks; k++, a += QUALITY_BLOCK, b += QUALITY_BLOCK) {
+        for (i = 0; i < QUALITY_BLOCK; i++) {
+            blocks[k].a  += a[i];
+            blocks[k].b  += b[i];
+            blocks[k].aa += a[i] * a[i];
+            blocks[k].bb += b[i] * b[i];
+            blocks[k].ab += a[i] * b[i];
+        }
+    }
+}
+
+#if defined(__GNUC__) && defined(__x86_64__)
+/* the squares of the differences of even and odd lanes are widened to 64 bits */
+__attribute__((target("avx2")))
+static uint64_t quality_ssd_avx2(const int *a, const int *b, int n) {
+    __m256i  sum = _mm256_setzero_si256();
+    uint64_t lanes[4];
+    int      i;
+
+    for (i = 0; i + 8 <= n; i += 8) {
+        __m256i d = _mm256_sub_epi32(_mm256_loadu_si256((const __m256i *)(a + i)),
+                                     _mm256_loadu_si256((const __m256i *)(b + i)));
+
+        sum = _mm256_add_epi64(sum, _mm256_mul_epi32(d, d));
+        d   = _mm256_srli_epi64(d, 32);
+        sum = _mm256_add_epi64(sum, _mm256_mul_epi32(d, d));
+    }
+
+    _mm256_storeu_si256((__m256i *)lanes, sum);
+
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + quality_ssd_scalar(a + i, b + i, n - i);
+}
+
+/* the five sums of a block row are folded with horizontal adds */
+__attribute__((target("sse4.1")))
+static void quality_blocks_sse41(const int *a, const int *b, int nblocks, quality_block_t *blocks) {
+    int32_t s[4], p[4];
+    int     k;
+
+    for (k = 0; k < nblocks; k++, a += QUALITY_BLOCK, b += QUALITY_BLOCK) {
+        __m128i va = _mm_loadu_si128((const __m128i *)a);
+        __m128i vb = _mm_loadu_si128((const __m128i *)b);
+        __m128i sums = _mm_hadd_epi32(_mm_hadd_epi32(va, vb),
+                                      _mm_hadd_epi32(_mm_mullo_epi32(va, va), _mm_mullo_epi32(vb, vb)));
+        __m128i ab   = _mm_mullo_epi32(va, vb);
+
+        ab = _mm_hadd_epi32(ab, ab);
+        ab = _mm_hadd_epi32(ab, ab);
+
+        _mm_storeu_si128((__m128i *)s, sums);
+        _mm_storeu_si128((__m128i *)p, ab);
+
+        blocks[k].a  += s[0];
+        blocks[k].b  += s[1];
+        blocks[k].aa += s[2];
+        blocks[k].bb += s[3];
+        blocks[k].ab += p[0];
+    }
+}
+#endif
+
+static uint64_t quality_ssd(const int *a, const int *b, int n) {
+#if defined(__GNUC__) && defined(__x86_64__)
+    if (cpu_has(CPU_AVX2)) {
+        return quality_ssd_avx2(a, b, n);
+    }
+#endif
+
+    return quality_ssd_scalar(a, b, n);
+}
+
+static void quality_blocks(const int *a, const int *b, int nblocks, quality_block_t *blocks) {
+#if defined(__GNUC__) && defined(__x86_64__)
+    if (cpu_has(CPU_SSE41)) {
+        quality_blocks_sse41(a, b, nblocks, blocks);
+        return;
+    }
+#endif
+
+    quality_blocks_scalar(a, b, nblocks, blocks);
+}
+
+/* the ssim of an 8x8 window from the sums of its four blocks */
+static double quality_window(const quality_block_t *b0, const quality_block_t *b1) {
+    double n = 4 * QUALITY_BLOCK * QUALITY_BLOCK;
+    double a  = (double)b0[0].a + b0[1].a + b1[0].a + b1[1].a;
+    double b  = (double)b0[0].b + b0[1].b + b1[0].b + b1[1].b;
+    double aa = (double)b0[0].aa + b0[1].aa + b1[0].aa + b1[1].aa;
+    double bb = (double)b0[0].bb + b0[1].bb + b1[0].bb + b1[1].bb;
+    double ab = (double)b0[0].ab + b0[1].ab + b1[0].ab + b1[1].ab;
+    double mu_a = a / n, mu_b = b / n;
+    double var_a = aa / n - mu_a * mu_a;
+    double var_b = bb / n - mu_b * mu_b;
+    double cov   = ab / n - mu_a * mu_b;
+
+    return ((2 * mu_a * mu_b + QUALITY_C1) * (2 * cov + QUALITY_C2)) /
+           ((mu_a * mu_a + mu_b * mu_b + QUALITY_C1) * (var_a + var_b + QUALITY_C2));
+}
+
+/* mean ssim of two w x h planes, two rows of block sums are kept */
+static double quality_ssim(const int *a, int a_stride, const int *b, int b_stride, int w, int h) {
+    int             nblocks = w / QUALITY_BLOCK;
+    int             rows    = h / QUALITY_BLOCK;
+    quality_block_t *blocks, *prev, *cur, *swap;
+    double          sum = 0;
+    long            windows = 0;
+    int             r, y, k;
+
+    if (nblocks < 2 || rows < 2) {
+        return 1.0;
+    }
+
+    blocks = calloc(2 * nblocks, sizeof(quality_block_t));
+
+    if (!blocks) {
+        return -1.0;
+    }
+
+    prev = blocks;
+    cur  = blocks + nblocks;
+
+    for (r = 0; r < rows; r++) {
+        memset(cur, 0, nblocks * sizeof(quality_block_t));
+
+        for (y = r * QUALITY_BLOCK; y < (r + 1) * QUALITY_BLOCK; y++) {
+            quality_blocks(a + (size_t)y * a_stride, b + (size_t)y * b_stride, nblocks, cur);
+        }
+
+        if (r > 0) {
+            for (k = 0; k + 1 < nblocks; k++) {
+                sum += quality_window(prev + k, cur + k);
+                windows++;
+            }
+        }
+
+        swap = prev;
+        prev = cur;
+        cur  = swap;
+    }
+
+    free(blocks);
+
+    return sum / windows;
+}
+
+static double quality_psnr(double mse) {
+    double psnr;
+
+    if (mse <= 0) {
+        return QUALITY_PSNR_MAX;
+    }
+
+    psnr = 10 * log10(QUALITY_PEAK * QUALITY_PEAK / mse);
+
+    return psnr < QUALITY_PSNR_MAX ? psnr : QUALITY_PSNR_MAX;
+}
+
+/* box filter a source plane down by 2^reduce, the size of the decoded plane */
+static int *quality_downsample(const opendcp_image_component_t *component, int w, int h, int reduce, int dw, int dh) {
+    int *plane = malloc((size_t)dw * dh * sizeof(int));
+    int s = 1 << reduce;
+    int x, y, i, j;
+
+    if (!plane) {
+        return NULL;
+    }
+
+    for (y = 0; y < dh; y++) {
+        for (x = 0; x < dw; x++) {
+            int64_t sum = 0;
+            int     n   = 0;
+
+            for (j = y * s; j < (y + 1) * s && j < h; j++) {
+                for (i = x * s; i < (x + 1) * s && i < w; i++) {
+                    sum += component->data[i + (size_t)j * component->stride];
+                    n++;
+                }
+            }
+
+            plane[x + (size_t)y * dw] = n ? (int)((sum + n / 2) / n) : 0;
+        }
+    }
+
+    return plane;
+}
+
+static int quality_add(opendcp_quality_t *quality, const char *file, const double *psnr, double psnr_all, double ssim) {
+    quality_frame_t *frame;
+
+    pthread_mutex_lock(&quality->mutex);
+
+    if (quality->count == quality->alloc) {
+        int             alloc = quality->alloc ? quality->alloc * 2 : 256;
+        quality_frame_t *grown = realloc(quality->frames, alloc * sizeof(quality_frame_t));
+
+        if (!grown) {
+            pthread_mutex_unlock(&quality->mutex);
+            return OPENDCP_ERROR;
+        }
+
+        quality->frames = grown;
+        quality->alloc  = alloc;
+    }
+
+    frame           = &quality->frames[quality->count++];
+    frame->file     = strdup(file ? file : "");
+    frame->psnr[0]  = psnr[0];
+    frame->psnr[1]  = psnr[1];
+    frame->psnr[2]  = psnr[2];
+    frame->psnr_all = psnr_all;
+    frame->ssim     = ssim;
+
+    pthread_mutex_unlock(&quality->mutex);
+
+    return OPENDCP_NO_ERROR;
+}
+
+static void quality_skip(opendcp_quality_t *quality) {
+    pthread_mutex_lock(&quality->mutex);
+    quality->skipped++;
+    pthread_mutex_unlock(&quality->mutex);
+}
+
+/*!
+ @function opendcp_quality_measure
+ @abstract Decodes an encoded frame and records its psnr and ssim.
+ @discussion Safe to call from several encoder threads at once. The source
+             is the image the encoder got, it is converted to int samples
+             in place, so call this once the encode is done. Frames that
+             can not be compared are counted as skipped.
+ @param quality The report, nothing is measured when NULL.
+ @param file The source file, the frame's name in the report.
+ @param source The source image after conform.
+ @param data The codestream.
+ @param length The length of the codestream in bytes.
+ @return OPENDCP_NO_ERROR or OPENDCP_ERROR.
+*/
+int opendcp_quality_measure(opendcp_quality_t *quality, const char *file, opendcp_image_t *source,
+                            const unsigned char *data, int length) {
+    opendcp_image_t *decoded = NULL;
+    int             *planes[3] = {NULL, NULL, NULL};
+    const int       *a[3];
+    int             a_stride[3];
+    double          psnr[3], ssim, mse_all = 0;
+    int             w, h, c, y, result = OPENDCP_ERROR;
+
+    if (!quality) {
+        return OPENDCP_NO_ERROR;
+    }
+
+    if (source->n_components < 3 || opendcp_image_float_to_int(source) != OPENDCP_NO_ERROR ||
+        opendcp_image_to_int(source) != OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_WARN, "quality of %s not measured, unsupported source image", file);
+        quality_skip(quality);
+        return OPENDCP_ERROR;
+    }
+
+    if (opendcp_decode_openjpeg_buffer(&decoded, data, length, quality->reduce) != OPENDCP_NO_ERROR || !decoded) {
+        OPENDCP_LOG(LOG_WARN, "quality of %s not measured, could not decode the codestream", file);
+        quality_skip(quality);
+        return OPENDCP_ERROR;
+    }
+
+    if (decoded->n_components < 3 || decoded->sample_type != SAMPLE_TYPE_INT32 ||
+        decoded->precision != source->precision) {
+        OPENDCP_LOG(LOG_WARN, "quality of %s not measured, the codestream does not match the source", file);
+        goto done;
+    }
+
+    w = decoded->w;
+    h = decoded->h;
+
+    for (c = 0; c < 3; c++) {
+        if (quality->reduce) {
+            planes[c] = quality_downsample(&source->component[c], source->w, source->h, quality->reduce, w, h);
+
+            if (!planes[c]) {
+                goto done;
+            }
+
+            a[c]        = planes[c];
+            a_stride[c] = w;
+        } else {
+            a[c]        = source->component[c].data;
+            a_stride[c] = source->component[c].stride;
+        }
+    }
+
+    /* compare the area both images have */
+    w = w < source->w ? w : source->w;
+    h = h < source->h ? h : source->h;
+
+    for (c = 0; c < 3; c++) {
+        uint64_t ssd = 0;
+
+        for (y = 0; y < h; y++) {
+            ssd += quality_ssd(a[c] + (size_t)y * a_stride[c],
+                               decoded->component[c].data + (size_t)y * decoded->component[c].stride, w);
+        }
+
+        psnr[c]  = quality_psnr((double)ssd / ((double)w * h));
+        mse_all += (double)ssd / ((double)w * h) / 3;
+    }
+
+    ssim = quality_ssim(a[1], a_stride[1], decoded->component[1].data, decoded->component[1].stride, w, h);
+
+    if (ssim < 0) {
+        goto done;
+    }
+
+    result = quality_add(quality, file, psnr, quality_psnr(mse_all), ssim);
+
+done:
+    if (result != OPENDCP_NO_ERROR) {
+        quality_skip(quality);
+    }
+
+    for (c = 0; c < 3; c++) {
+        free(planes[c]);
+    }
+
+    opendcp_image_free(decoded);
+
+    return result;
+}
+
+static int quality_compare(const void *a, const void *b) {
+    return strcmp(((const quality_frame_t *)a)->file, ((const quality_frame_t *)b)->file);
+}
+
+/* frames are measured as the encoders finish them, the report is in file order */
+static void quality_sort(opendcp_quality_t *quality) {
+    qsort(quality->frames, quality->count, sizeof(quality_frame_t), quality_compare);
+}
+
+static int quality_worst(opendcp_quality_t *quality, int ssim) {
+    int i, worst = 0;
+
+    for (i = 1; i < quality->count; i++) {
+        if (ssim ? quality->frames[i].ssim < quality->frames[worst].ssim :
+                   quality->frames[i].psnr_all < quality->frames[worst].psnr_all) {
+            worst = i;
+        }
+    }
+
+    return worst;
+}
+
+static void quality_average(opendcp_quality_t *quality, double *psnr, double *ssim) {
+    int i;
+
+    *psnr = 0;
+    *ssim = 0;
+
+    for (i = 0; i < quality->count; i++) {
+        *psnr += quality->frames[i].psnr_all / quality->count;
+        *ssim += quality->frames[i].ssim / quality->count;
+    }
+}
+
+/*!
+ @function opendcp_quality_summary
+ @abstract Logs the average and worst psnr and ssim at info level.
+ @param quality The report, may be NULL.
+*/
+void opendcp_quality_summary(opendcp_quality_t *quality) {
+    double psnr, ssim;
+    int    worst_psnr, worst_ssim;
+
+    if (!quality || !quality->count) {
+        return;
+    }
+
+    quality_sort(quality);
+    quality_average(quality, &psnr, &ssim);
+    worst_psnr = quality_worst(quality, 0);
+    worst_ssim = quality_worst(quality, 1);
+
+    OPENDCP_LOG(LOG_INFO, "quality average psnr %.2f dB ssim %.4f, worst psnr %.2f dB (%s), worst ssim %.4f (%s)",
+                psnr, ssim, quality->frames[worst_psnr].psnr_all, quality->frames[worst_psnr].file,
+                quality->frames[worst_ssim].ssim, quality->frames[worst_ssim].file);
+
+    if (quality->skipped) {
+        OPENDCP_LOG(LOG_WARN, "quality of %d frames was not measured", quality->skipped);
+    }
+}
+
+static void quality_json_string(FILE *fp, const char *s) {
+    fputc('"', fp);
+
+    for (; *s; s++) {
+        if (*s == '"' || *s == '\\') {
+            fprintf(fp, "\\%c", *s);
+        } else if ((unsigned char)*s < 0x20) {
+            fprintf(fp, "\\u%04x", (unsigned char)*s);
+        } else {
+            fputc(*s, fp);
+        }
+    }
+
+    fputc('"', fp);
+}
+
+/*!
+ @function opendcp_quality_dump
+ @abstract Writes the report as json, the averages and the metrics of every frame.
+ @param quality The report.
+ @param file The file to write.
+ @return OPENDCP_NO_ERROR or OPENDCP_ERROR.
+*/
+int opendcp_quality_dump(opendcp_quality_t *quality, const char *file) {
+    FILE   *fp;
+    double psnr = 0, ssim = 0;
+    int    i;
+
+    if (!quality) {
+        return OPENDCP_ERROR;
+    }
+
+    fp = fopen(file, "w");
+
+    if (!fp) {
+        OPENDCP_LOG(LOG_ERROR, "could not write quality report to %s", file);
+        return OPENDCP_ERROR;
+    }
+
+    quality_sort(quality);
+    quality_average(quality, &psnr, &ssim);
+
+    fprintf(fp, "{\n");
+    fprintf(fp, "    \"frames\": %d,\n", quality->count);
+    fprintf(fp, "    \"skipped\": %d,\n", quality->skipped);
+    fprintf(fp, "    \"reduce\": %d,\n", quality->reduce);
+    fprintf(fp, "    \"average_psnr\": %.3f,\n", psnr);
+    fprintf(fp, "    \"average_ssim\": %.5f,\n", ssim);
+    fprintf(fp, "    \"min_psnr\": %.3f,\n", quality->count ? quality->frames[quality_worst(quality, 0)].psnr_all : 0.0);
+    fprintf(fp, "    \"min_ssim\": %.5f,\n", quality->count ? quality->frames[quality_worst(quality, 1)].ssim : 0.0);
+    fprintf(fp, "    \"per_frame\": [");
+
+    for (i = 0; i < quality->count; i++) {
+        quality_frame_t *frame = &quality->frames[i];
+
+        fprintf(fp, "%s\n        {\"file\": ", i ? "," : "");
+        quality_json_string(fp, frame->file);
+        fprintf(fp, ", \"psnr_x\": %.3f, \"psnr_y\": %.3f, \"psnr_z\": %.3f, \"psnr\": %.3f, \"ssim\": %.5f}",
+                frame->psnr[0], frame->psnr[1], frame->psnr[2], frame->psnr_all, frame->ssim);
+    }
+
+    fprintf(fp, "\n    ]\n}\n");
+
+    if (fclose(fp)) {
+        OPENDCP_LOG(LOG_ERROR, "could not write quality report to %s", file);
+        return OPENDCP_ERROR;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
@@ -0,0 +1,158 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "opendcp.h"
+#include "opendcp_queue.h"
+
+opendcp_queue_t *opendcp_queue_create(int capacity, int producers) {
+    opendcp_queue_t *queue;
+
+    if (capacity < 1) {
+        capacity = 1;
+    }
+
+    queue = malloc(sizeof(opendcp_queue_t));
+
+    if (!queue) {
+        return NULL;
+    }
+
+    memset(queue, 0, sizeof(opendcp_queue_t));
+
+    queue->items = malloc(capacity * sizeof(void *));
+
+    if (!queue->items) {
+        free(queue);
+        return NULL;
+    }
+
+    queue->capacity  = capacity;
+    queue->producers = producers;
+
+    pthread_mutex_init(&queue->mutex, NULL);
+    pthread_cond_init(&queue->not_empty, NULL);
+    pthread_cond_init(&queue->not_full, NULL);
+
+    return queue;
+}
+
+void opendcp_queue_delete(opendcp_queue_t *queue) {
+    if (!queue) {
+        return;
+    }
+
+    pthread_cond_destroy(&queue->not_full);
+    pthread_cond_destroy(&queue->not_empty);
+    pthread_mutex_destroy(&queue->mutex);
+
+    free(queue->items);
+    free(queue);
+}
+
+int opendcp_queue_push(opendcp_queue_t *queue, void *item) {
+    pthread_mutex_lock(&queue->mutex);
+
+    while (queue->count == queue->capacity && !queue->closed) {
+        pthread_cond_wait(&queue->not_full, &queue->mutex);
+    }
+
+    if (queue->closed) {
+        pthread_mutex_unlock(&queue->mutex);
+        return OPENDCP_ERROR;
+    }
+
+    queue->items[(queue->head + queue->count) % queue->capacity] = item;
+    queue->count++;
+
+    pthread_cond_signal(&queue->not_empty);
+    pthread_mutex_unlock(&queue->mutex);
+
+    return OPENDCP_NO_ERROR;
+}
+
+void *opendcp_queue_pop(opendcp_queue_t *queue) {
+    void *item = NULL;
+
+    pthread_mutex_lock(&queue->mutex);
+
+    while (queue->count == 0 && !queue->closed) {
+        pthread_cond_wait(&queue->not_empty, &queue->mutex);
+    }
+
+    if (queue->count) {
+        item = queue->items[queue->head];
+        queue->head = (queue->head + 1) % queue->capacity;
+        queue->count--;
+        pthread_cond_signal(&queue->not_full);
+    }
+
+    pthread_mutex_unlock(&queue->mutex);
+
+    return item;
+}
+
+void *opendcp_queue_try_pop(opendcp_queue_t *queue) {
+    void *item = NULL;
+
+    pthread_mutex_lock(&queue->mutex);
+
+    if (queue->count) {
+        item = queue->items[queue->head];
+        queue->head = (queue->head + 1) % queue->capacity;
+        queue->count--;
+        pthread_cond_signal(&queue->not_full);
+    }
+
+    pthread_mutex_unlock(&queue->mutex);
+
+    return item;
+}
+
+int opendcp_queue_length(opendcp_queue_t *queue) {
+    int count;
+
+    pthread_mutex_lock(&queue->mutex);
+    count = queue->count;
+    pthread_mutex_unlock(&queue->mutex);
+
+    return count;
+}
+
+void opendcp_queue_producer_done(opendcp_queue_t *queue) {
+    pthread_mutex_lock(&queue->mutex);
+
+    if (--queue->producers <= 0) {
+        queue->closed = 1;
+        pthread_cond_broadcast(&queue->not_empty);
+        pthread_cond_broadcast(&queue->not_full);
+    }
+
+    pthread_mutex_unlock(&queue->mutex);
+}
+
+void opendcp_queue_close(opendcp_queue_t *queue) {
+    pthread_mutex_lock(&queue->mutex);
+
+    queue->closed = 1;
+    pthread_cond_broadcast(&queue->not_empty);
+    pthread_cond_broadcast(&queue->not_full);
+
+    pthread_mutex_unlock(&queue->mutex);
+}
@@ -0,0 +1,122 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _OPENDCP_QUEUE_H_
+#define _OPENDCP_QUEUE_H_
+
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ @typedef opendcp_queue_t
+ @abstract bounded blocking queue
+ @discussion A fixed capacity FIFO of pointers shared between pipeline stages.
+             Pushing to a full queue blocks the producer until a consumer
+             frees a slot, which keeps the number of frames in flight bounded.
+ @field items The ring buffer of queued items.
+ @field capacity The maximum number of queued items.
+ @field count The number of items currently queued.
+ @field head The index of the next item to be popped.
+ @field producers The number of producers that have not called opendcp_queue_producer_done.
+ @field closed Set when all producers are done or the queue was closed.
+*/
+typedef struct {
+    void            **items;
+    int             capacity;
+    int             count;
+    int             head;
+    int             producers;
+    int             closed;
+    pthread_mutex_t mutex;
+    pthread_cond_t  not_empty;
+    pthread_cond_t  not_full;
+} opendcp_queue_t;
+
+/*!
+ @function opendcp_queue_create
+ @abstract Allocates a bounded queue.
+ @param capacity The maximum number of items the queue will hold.
+ @param producers The number of threads that will push to the queue.
+ @return A new queue or NULL on failure.
+*/
+opendcp_queue_t *opendcp_queue_create(int capacity, int producers);
+
+/*!
+ @function opendcp_queue_delete
+ @abstract Frees a queue. Any items still queued are not freed.
+ @param queue The queue to free.
+*/
+void opendcp_queue_delete(opendcp_queue_t *queue);
+
+/*!
+ @function opendcp_queue_push
+ @abstract Adds an item to the queue, blocking while the queue is full.
+ @param queue The queue.
+ @param item The item to add.
+ @return OPENDCP_NO_ERROR on success, OPENDCP_ERROR if the queue was closed.
+*/
+int opendcp_queue_push(opendcp_queue_t *queue, void *item);
+
+/*!
+ @function opendcp_queue_pop
+ @abstract Removes an item from the queue, blocking while the queue is empty.
+ @param queue The queue.
+ @return The next item or NULL once the queue is closed and drained.
+*/
+void *opendcp_queue_pop(opendcp_queue_t *queue);
+
+/*!
+ @function opendcp_queue_try_pop
+ @abstract Removes an item from the queue without blocking.
+ @param queue The queue.
+ @return The next item or NULL if the queue is empty.
+*/
+void *opendcp_queue_try_pop(opendcp_queue_t *queue);
+
+/*!
+ @function opendcp_queue_length
+ @abstract Returns the number of items waiting in the queue.
+ @param queue The queue.
+ @return The item count.
+*/
+int opendcp_queue_length(opendcp_queue_t *queue);
+
+/*!
+ @function opendcp_queue_producer_done
+ @abstract Signals that a producer will push no more items.
+ @discussion When the last producer is done the queue is closed and blocked
+             consumers wake up once the remaining items are drained.
+ @param queue The queue.
+*/
+void opendcp_queue_producer_done(opendcp_queue_t *queue);
+
+/*!
+ @function opendcp_queue_close
+ @abstract Closes the queue immediately, waking all blocked threads.
+ @param queue The queue.
+*/
+void opendcp_queue_close(opendcp_queue_t *queue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _OPENDCP_QUEUE_H_
@@ -0,0 +1,281 @@
+/*
+     OpenDCP: Builds Digital Cinema Packages
+     Copyright (c) 2010-2013 Terrence Meiczinger, All Rights Reserved
+
+     This program is free software: you can redistribute it and/or modify
+     it under the terms of the GNU General Public License as published by
+     the Free Software Foundation, either version 3 of the License, or
+     (at your option) any later version.
+
+     This program is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU General Public License for more details.
+
+     You should have received a copy of the GNU General Public License
+     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+#include "opendcp.h"
+#include "opendcp_reader.h"
+#include "codecs/opendcp_decoder.h"
+
+/* ask the kernel to start reading a file we will decode soon */
+static void reader_hint(const char *file) {
+#if defined(POSIX_FADV_WILLNEED)
+    int fd = open(file, O_RDONLY);
+
+    if (fd < 0) {
+        return;
+    }
+
+    posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+    close(fd);
+#else
+    (void)file;
+#endif
+}
+
+static int reader_decode(void *arg, char *file, opendcp_image_t **image) {
+    (void)arg;
+
+    return read_image(image, file);
+}
+
+/* decode a fetched frame from memory, it is dropped once decoded */
+static int reader_fetch_decode(opendcp_reader_t *reader, int index, opendcp_image_t **image) {
+    opendcp_decoder_input_t input;
+    int                     result;
+
+    input.name = reader->files[index];
+
+    if (opendcp_fetch_get(reader->fetch, index, &input.data, &input.size) != OPENDCP_NO_ERROR) {
+        opendcp_fetch_release(reader->fetch, index);
+        return OPENDCP_ERROR;
+    }
+
+    opendcp_decoder_input_set(&input);
+    result = reader->decode(reader->arg, reader->files[index], image);
+    opendcp_decoder_input_set(NULL);
+    opendcp_fetch_release(reader->fetch, index);
+
+    return result;
+}
+
+static void *reader_thread(void *arg) {
+    opendcp_reader_t      *reader = arg;
+    opendcp_reader_slot_t *slot;
+    opendcp_image_t       *image;
+    int                   index, result, first, last;
+
+    while (1) {
+        pthread_mutex_lock(&reader->mutex);
+
+        /* keep no more than depth frames decoded ahead of the consumer */
+        while (!reader->closed && reader->next < reader->nfiles && reader->next >= reader->position + reader->depth) {
+            pthread_cond_wait(&reader->taken, &reader->mutex);
+        }
+
+        if (reader->closed || reader->next >= reader->nfiles) {
+            pthread_mutex_unlock(&reader->mutex);
+            break;
+        }
+
+        index = reader->next++;
+
+        /* claim the files that came into the read ahead range */
+        first = reader->hinted;
+        last  = index + reader->depth + reader->ahead;
+        if (last > reader->nfiles) {
+            last = reader->nfiles;
+        }
+        if (last > first) {
+            reader->hinted = last;
+        }
+        pthread_mutex_unlock(&reader->mutex);
+
+        /* fetched frames are already read ahead */
+        for (; first < last && !reader->fetch; first++) {
+            reader_hint(reader->files[first]);
+        }
+
+        image  = NULL;
+
+        if (reader->fetch) {
+            result = reader_fetch_decode(reader, index, &image);
+        } else {
+            result = reader->decode(reader->arg, reader->files[index], &image);
+        }
+
+        if (result != OPENDCP_NO_ERROR && image) {
+            opendcp_image_free(image);
+            image = NULL;
+        }
+
+        pthread_mutex_lock(&reader->mutex);
+        slot = &reader->slots[index % reader->depth];
+        slot->image  = image;
+        slot->result = result;
+        slot->ready  = 1;
+        pthread_cond_broadcast(&reader->decoded);
+        pthread_mutex_unlock(&reader->mutex);
+    }
+
+    return NULL;
+}
+
+opendcp_reader_t *opendcp_reader_create(filelist_t *filelist, int depth, int ahead, int threads, opendcp_reader_decode_t decode, void *arg) {
+    opendcp_reader_t *reader;
+    int              i;
+
+    if (!filelist || filelist->nfiles < 1) {
+        return NULL;
+    }
+
+    if (threads < 1) {
+        threads = 1;
+    }
+
+    if (depth < threads) {
+        depth = threads;
+    }
+
+    reader = malloc(sizeof(opendcp_reader_t));
+
+    if (!reader) {
+        return NULL;
+    }
+
+    memset(reader, 0, sizeof(opendcp_reader_t));
+
+    reader->files   = filelist->files;
+    reader->nfiles  = filelist->nfiles;
+    reader->depth   = depth;
+    reader->ahead   = ahead > 0 ? ahead : 0;
+    reader->hinted  = depth < reader->nfiles ? depth : reader->nfiles;
+    reader->decode  = decode ? decode : reader_decode;
+    reader->arg     = arg;
+    reader->slots   = calloc(depth, sizeof(opendcp_reader_slot_t));
+    reader->threads = malloc(threads * sizeof(pthread_t));
+
+    if (!reader->slots || !reader->threads) {
+        free(reader->slots);
+        free(reader->threads);
+        free(reader);
+        return NULL;
+    }
+
+    if (opendcp_s3_url(reader->files[0])) {
+        reader->fetch = opendcp_fetch_open(reader->files, reader->nfiles, depth + reader->ahead, 0);
+
+        if (!reader->fetch) {
+            free(reader->slots);
+            free(reader->threads);
+            free(reader);
+            return NULL;
+        }
+    }
+
+    pthread_mutex_init(&reader->mutex, NULL);
+    pthread_cond_init(&reader->decoded, NULL);
+    pthread_cond_init(&reader->taken, NULL);
+
+    for (i = 0; i < threads; i++) {
+        if (pthread_create(&reader->threads[reader->nthreads], NULL, reader_thread, reader) == 0) {
+            reader->nthreads++;
+        }
+    }
+
+    if (!reader->nthreads) {
+        OPENDCP_LOG(LOG_ERROR, "could not start reader threads");
+        opendcp_reader_delete(reader);
+        return NULL;
+    }
+
+    return reader;
+}
+
+int opendcp_reader_next(opendcp_reader_t *reader, opendcp_image_t **image, int *result) {
+    opendcp_reader_slot_t *slot;
+    int                   index;
+
+    *image = NULL;
+
+    pthread_mutex_lock(&reader->mutex);
+
+    if (reader->closed || reader->position >= reader->nfiles) {
+        pthread_mutex_unlock(&reader->mutex);
+        return -1;
+    }
+
+    index = reader->position;
+    slot  = &reader->slots[index % reader->depth];
+
+    while (!reader->closed && !slot->ready) {
+        pthread_cond_wait(&reader->decoded, &reader->mutex);
+    }
+
+    if (!slot->ready) {
+        pthread_mutex_unlock(&reader->mutex);
+        return -1;
+    }
+
+    *image = slot->image;
+
+    if (result) {
+        *result = slot->result;
+    }
+
+    slot->image = NULL;
+    slot->ready = 0;
+    reader->position++;
+
+    pthread_cond_broadcast(&reader->taken);
+    pthread_mutex_unlock(&reader->mutex);
+
+    return index;
+}
+
+void opendcp_reader_close(opendcp_reader_t *reader) {
+    pthread_mutex_lock(&reader->mutex);
+    reader->closed = 1;
+    pthread_cond_broadcast(&reader->taken);
+    pthread_cond_broadcast(&reader->decoded);
+    pthread_mutex_unlock(&reader->mutex);
+}
+
+void opendcp_reader_delete(opendcp_reader_t *reader) {
+    int i;
+
+    if (!reader) {
+        return;
+    }
+
+    opendcp_reader_close(reader);
+
+    for (i = 0; i < reader->nthreads; i++) {
+        pthread_join(reader->threads[i], NULL);
+    }
+
+    opendcp_fetch_close(reader->fetch);
+
+    for (i = 0; i < reader->depth; i++) {
+        if (reader->slots[i].image) {
+            opendcp_image_free(reader->slots[i].image);
+        }
+    }
+
+    pthread_cond_destroy(&reader->taken);
+    pthread_cond_destroy(&reader->decoded);
+    pthread_mutex_destroy(&reader->mutex);
+
+    free(reader->slots);
+    free(reader->threads);
+    free(reader);
+}
@@ -0,0 +1,129 @@
+/*
+     OpenDCP: Builds Digital Cinema Packages
+     Copyright (c) 2010-2013 Terrence Meiczinger, All Rights Reserved
+
+     This program is free software: you can redistribute it and/or modify
+     it under the terms of the GNU General Public License as published by
+     the Free Software Foundation, either version 3 of the License, or
+     (at your option) any later version.
+
+     This program is distributed in the hope that it will be useful,
+     but WITHOUT ANY WARRANTY; without even the implied warranty of
+     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+     GNU General Public License for more details.
+
+     You should have received a copy of the GNU General Public License
+     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _OPENDCP_READER_H_
+#define _OPENDCP_READER_H_
+
+#include <pthread.h>
+#include "opendcp.h"
+#include "opendcp_image.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ @typedef opendcp_reader_decode_t
+ @abstract decode callback used by a sequence reader
+ @discussion Called from the reader threads, it must be thread safe.
+*/
+typedef int (*opendcp_reader_decode_t)(void *arg, char *file, opendcp_image_t **image);
+
+/* a decoded frame waiting to be handed out */
+typedef struct {
+    opendcp_image_t *image;
+    int             result;
+    int             ready;
+} opendcp_reader_slot_t;
+
+/*!
+ @typedef opendcp_reader_t
+ @abstract prefetching sequence reader
+ @discussion Decodes the files of a sequence ahead of the consumer with a
+             pool of threads. At most depth frames are decoded and not yet
+             taken, and the next ahead files past that are hinted to the
+             operating system so their reads are already in flight when a
+             thread gets to them. Frames are handed out in sequence order
+             by opendcp_reader_next. A sequence in object storage is
+             fetched instead, depth + ahead frames at a time, and decoded
+             from memory.
+ @field files The file names of the sequence.
+ @field nfiles The number of files.
+ @field depth The maximum number of decoded frames not yet taken.
+ @field ahead The number of files hinted beyond the decoded frames.
+ @field hinted The index of the first file not hinted yet.
+ @field next The index of the next frame to be decoded.
+ @field position The index of the next frame to be handed out.
+ @field closed Set when the reader is closed.
+ @field slots The decoded frames, frame n is kept in slot n % depth.
+ @field fetch The ranged reads of an object storage sequence, NULL for files.
+*/
+typedef struct {
+    char                    **files;
+    int                     nfiles;
+    int                     depth;
+    int                     ahead;
+    int                     hinted;
+    int                     next;
+    int                     position;
+    int                     closed;
+    opendcp_reader_decode_t decode;
+    void                    *arg;
+    opendcp_reader_slot_t   *slots;
+    opendcp_fetch_t         *fetch;
+    pthread_t               *threads;
+    int                     nthreads;
+    pthread_mutex_t         mutex;
+    pthread_cond_t          decoded;
+    pthread_cond_t          taken;
+} opendcp_reader_t;
+
+/*!
+ @function opendcp_reader_create
+ @abstract Starts reading a sequence of image files.
+ @param filelist The files to read, it must stay valid until the reader is deleted.
+ @param depth The maximum number of decoded frames held by the reader.
+ @param ahead The number of further files to hint for read ahead.
+ @param threads The number of decode threads.
+ @param decode The decode function or NULL to use read_image.
+ @param arg The first argument passed to decode.
+ @return A new reader or NULL on failure.
+*/
+opendcp_reader_t *opendcp_reader_create(filelist_t *filelist, int depth, int ahead, int threads, opendcp_reader_decode_t decode, void *arg);
+
+/*!
+ @function opendcp_reader_next
+ @abstract Takes the next frame of the sequence, blocking until it is decoded.
+ @discussion The caller owns the returned image. When a frame could not be
+             decoded its index is still returned and the image is set to NULL.
+ @param reader The reader.
+ @param image Receives the decoded image.
+ @param result Receives the result of the decode, may be NULL.
+ @return The index of the frame, or -1 at the end of the sequence or once closed.
+*/
+int opendcp_reader_next(opendcp_reader_t *reader, opendcp_image_t **image, int *result);
+
+/*!
+ @function opendcp_reader_close
+ @abstract Stops decoding, waking any thread blocked in opendcp_reader_next.
+ @param reader The reader.
+*/
+void opendcp_reader_close(opendcp_reader_t *reader);
+
+/*!
+ @function opendcp_reader_delete
+ @abstract Closes the reader, waits for its threads and frees frames not taken.
+ @param reader The reader.
+*/
+void opendcp_reader_delete(opendcp_reader_t *reader);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _OPENDCP_READER_H_
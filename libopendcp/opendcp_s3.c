@@ -0,0 +1,1496 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+   Object storage for S3 compatible services
+
+   Objects are named s3://bucket/key and reached with path style requests
+   at OPENDCP_S3_ENDPOINT (AWS_ENDPOINT_URL, or https://s3.<region>.amazonaws.com
+   without either), signed with AWS signature version 4 from the
+   AWS_ACCESS_KEY_ID, AWS_SECRET_ACCESS_KEY and optional AWS_SESSION_TOKEN
+   credentials of the environment. The region is AWS_REGION, us-east-1 by
+   default. Payloads are not hashed into the signature, so https endpoints
+   should be used.
+
+   An upload is a multipart upload the file is written into while it is
+   being written. The file is cut into parts of a fixed size and a part is
+   handed to the upload threads as soon as the writer moves past it, so at
+   most window parts are held in memory. The first part holds the MXF
+   header partition, which is written again when the file is finalized, so
+   it stays in memory and is uploaded last. Writing into any other part
+   that was already handed over fails the upload.
+
+   Source frames are listed with ListObjectsV2 and read by a fetch, a pool
+   of connections that each take the next range of the lowest frame in the
+   window that still has one. The first range of a frame also gives its
+   size, the rest are read in parallel straight into the frame's buffer,
+   so a large frame comes in over many connections and small frames over
+   one connection each. The decoders read the frames from memory.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+#include "opendcp.h"
+
+#ifdef HAVE_S3
+#include <curl/curl.h>
+#include <openssl/hmac.h>
+#include <openssl/sha.h>
+
+#define S3_PART_MIN       (5 * 1024 * 1024)  /* smallest part but the last a service takes */
+#define S3_PART_MAX       10000              /* parts of one upload */
+#define S3_RETRIES        3                  /* attempts per request */
+#define S3_UNSIGNED       "UNSIGNED-PAYLOAD"
+#define S3_ETAG_LENGTH    80
+#define S3_RANGE          (8 * 1024 * 1024)  /* bytes per ranged read */
+#define S3_LIST_PAGE      1000               /* keys per listing request */
+
+typedef struct {
+    char            host[256];           /* authority of the endpoint, as signed */
+    char            base[512];           /* scheme and authority */
+    char            region[64];
+    char            access_key[128];
+    char            secret_key[128];
+    char            *token;
+    char            bucket[256];
+    char            path[2048];          /* /bucket/key, uri encoded */
+} s3_object_t;
+
+typedef struct {
+    const unsigned char *data;
+    size_t          length;
+    size_t          sent;
+} s3_body_t;
+
+typedef struct {
+    char            *data;
+    size_t          length;
+} s3_response_t;
+
+/* destination of a ranged read, grown only when grow is set */
+typedef struct {
+    unsigned char   *data;
+    size_t          capacity;
+    size_t          length;
+    uint64_t        total;               /* object size from Content-Range, 0 if not given */
+    int             grow;
+} s3_range_t;
+
+enum {
+    S3_FETCH_IDLE = 0,                   /* nothing read yet */
+    S3_FETCH_PROBING,                    /* first range in flight */
+    S3_FETCH_SIZED,                      /* size known, ranges left to claim */
+    S3_FETCH_READY,
+    S3_FETCH_FAILED,
+    S3_FETCH_RELEASED
+};
+
+typedef struct {
+    unsigned char   *data;
+    uint64_t        size;
+    int             ranges;
+    int             next;                /* next range to claim */
+    int             done;                /* ranges read */
+    int             active;              /* ranges in flight */
+    int             state;
+} s3_fetch_object_t;
+
+struct opendcp_fetch_s {
+    char            **urls;
+    int             count;
+    int             window;              /* objects read ahead of the lowest one not released */
+    int             low;
+    s3_fetch_object_t *objects;
+    int             stop;
+    pthread_mutex_t lock;
+    pthread_cond_t  work;
+    pthread_cond_t  ready;
+    pthread_t       *threads;
+    int             thread_count;
+    uint64_t        fetched;
+};
+
+typedef struct s3_part_s {
+    int             number;              /* 1-based part number */
+    unsigned char   *data;
+    size_t          length;
+    struct s3_part_s *next;
+} s3_part_t;
+
+struct opendcp_upload_s {
+    s3_object_t     object;
+    char            upload_id[512];
+    size_t          part_size;
+    int             window;              /* parts held at once, the first one included */
+    s3_part_t       first;               /* part 1, uploaded by opendcp_upload_close */
+    s3_part_t       *current;            /* part being filled, NULL before the second part */
+    int             last;                /* highest part number started */
+    char            (*etags)[S3_ETAG_LENGTH];
+    int             etag_count;
+    s3_part_t       *queue;              /* full parts waiting for a thread */
+    s3_part_t       *queue_tail;
+    int             held;                /* parts queued or in flight */
+    int             failed;
+    int             stop;
+    pthread_mutex_t lock;
+    pthread_cond_t  work;
+    pthread_cond_t  room;
+    pthread_t       *threads;
+    int             thread_count;
+    uint64_t        uploaded;
+};
+
+static pthread_once_t s3_once = PTHREAD_ONCE_INIT;
+
+static void s3_global_init(void) {
+    curl_global_init(CURL_GLOBAL_DEFAULT);
+}
+
+/* percent encodes all but the unreserved characters, and '/' when slash is set */
+static void s3_encode(char *out, size_t size, const char *in, int slash) {
+    static const char hex[] = "0123456789ABCDEF";
+    size_t used = 0;
+
+    for (; *in && used + 4 < size; in++) {
+        unsigned char c = (unsigned char)*in;
+
+        if ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') ||
+            c == '-' || c == '_' || c == '.' || c == '~' || (slash && c == '/')) {
+            out[used++] = c;
+        }
+        else {
+            out[used++] = '%';
+            out[used++] = hex[c >> 4];
+            out[used++] = hex[c & 15];
+        }
+    }
+
+    out[used] = 0;
+}
+
+static void s3_hex(char *out, const unsigned char *in, size_t length) {
+    size_t i;
+
+    for (i = 0; i < length; i++) {
+        sprintf(out + i * 2, "%02x", in[i]);
+    }
+}
+
+static void s3_hmac(unsigned char *out, const void *key, size_t key_length, const char *data) {
+    unsigned int length = SHA256_DIGEST_LENGTH;
+
+    HMAC(EVP_sha256(), key, (int)key_length, (const unsigned char *)data, strlen(data), out, &length);
+}
+
+/* fills the object from an s3://bucket/key url and the environment, the bucket itself when listing */
+static int s3_object_init(s3_object_t *object, const char *url, int listing) {
+    const char *key, *env, *authority, *end;
+    char       bucket_key[2048];
+
+    memset(object, 0, sizeof(*object));
+
+    if (!opendcp_s3_url(url)) {
+        OPENDCP_LOG(LOG_ERROR, "%s is not an s3://bucket/key url", url);
+        return OPENDCP_ERROR;
+    }
+
+    url += 5;
+    key = strchr(url, '/');
+
+    if (listing && !key) {
+        key = url + strlen(url);
+    }
+
+    if (!key || key == url || (!listing && !key[1]) || (size_t)(key - url) >= sizeof(object->bucket)) {
+        OPENDCP_LOG(LOG_ERROR, "s3://%s does not name a bucket and a key", url);
+        return OPENDCP_ERROR;
+    }
+
+    snprintf(object->bucket, sizeof(object->bucket), "%.*s", (int)(key - url), url);
+    snprintf(bucket_key, sizeof(bucket_key), "/%s", listing ? object->bucket : url);
+    s3_encode(object->path, sizeof(object->path), bucket_key, 1);
+
+    env = getenv("AWS_REGION");
+    snprintf(object->region, sizeof(object->region), "%s", env && *env ? env : "us-east-1");
+
+    env = getenv("OPENDCP_S3_ENDPOINT");
+
+    if (!env || !*env) {
+        env = getenv("AWS_ENDPOINT_URL");
+    }
+
+    if (env && *env) {
+        snprintf(object->base, sizeof(object->base), "%s", env);
+    }
+    else {
+        snprintf(object->base, sizeof(object->base), "https://s3.%s.amazonaws.com", object->region);
+    }
+
+    /* the base is scheme://authority, without a trailing path */
+    authority = strstr(object->base, "://");
+    authority = authority ? authority + 3 : object->base;
+    end = strchr(authority, '/');
+
+    if (end) {
+        object->base[end - object->base] = 0;
+    }
+
+    snprintf(object->host, sizeof(object->host), "%s", authority);
+
+    env = getenv("AWS_ACCESS_KEY_ID");
+
+    if (!env || !*env || !getenv("AWS_SECRET_ACCESS_KEY")) {
+        OPENDCP_LOG(LOG_ERROR, "AWS_ACCESS_KEY_ID and AWS_SECRET_ACCESS_KEY must be set for %s", url - 5);
+        return OPENDCP_ERROR;
+    }
+
+    snprintf(object->access_key, sizeof(object->access_key), "%s", env);
+    snprintf(object->secret_key, sizeof(object->secret_key), "%s", getenv("AWS_SECRET_ACCESS_KEY"));
+
+    env = getenv("AWS_SESSION_TOKEN");
+    object->token = env && *env ? strdup(env) : NULL;
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* adds the x-amz and authorization headers of a version 4 signature */
+static struct curl_slist *s3_sign(const s3_object_t *object, const char *method, const char *query,
+                                  struct curl_slist *headers) {
+    char          date[9], stamp[17], scope[128], line[4096];
+    char          *canonical, *to_sign;
+    char          hash[SHA256_DIGEST_LENGTH * 2 + 1], signature[SHA256_DIGEST_LENGTH * 2 + 1];
+    unsigned char digest[SHA256_DIGEST_LENGTH], key[SHA256_DIGEST_LENGTH];
+    const char    *signed_headers;
+    size_t        size;
+    time_t        now = time(NULL);
+    struct tm     tm;
+
+#ifdef _WIN32
+    gmtime_s(&tm, &now);
+#else
+    gmtime_r(&now, &tm);
+#endif
+    strftime(date, sizeof(date), "%Y%m%d", &tm);
+    strftime(stamp, sizeof(stamp), "%Y%m%dT%H%M%SZ", &tm);
+    snprintf(scope, sizeof(scope), "%s/%s/s3/aws4_request", date, object->region);
+
+    signed_headers = object->token ? "host;x-amz-content-sha256;x-amz-date;x-amz-security-token"
+                                   : "host;x-amz-content-sha256;x-amz-date";
+
+    size = strlen(object->path) + strlen(query) + (object->token ? strlen(object->token) : 0) + 1024;
+    canonical = malloc(size);
+    snprintf(canonical, size, "%s\n%s\n%s\nhost:%s\nx-amz-content-sha256:%s\nx-amz-date:%s\n%s%s%s\n%s\n%s",
+             method, object->path, query, object->host, S3_UNSIGNED, stamp,
+             object->token ? "x-amz-security-token:" : "", object->token ? object->token : "",
+             object->token ? "\n" : "", signed_headers, S3_UNSIGNED);
+
+    SHA256((const unsigned char *)canonical, strlen(canonical), digest);
+    s3_hex(hash, digest, sizeof(digest));
+    free(canonical);
+
+    size = strlen(stamp) + strlen(scope) + sizeof(hash) + 64;
+    to_sign = malloc(size);
+    snprintf(to_sign, size, "AWS4-HMAC-SHA256\n%s\n%s\n%s", stamp, scope, hash);
+
+    snprintf(line, sizeof(line), "AWS4%s", object->secret_key);
+    s3_hmac(key, line, strlen(line), date);
+    s3_hmac(key, key, sizeof(key), object->region);
+    s3_hmac(key, key, sizeof(key), "s3");
+    s3_hmac(key, key, sizeof(key), "aws4_request");
+    s3_hmac(digest, key, sizeof(key), to_sign);
+    s3_hex(signature, digest, sizeof(digest));
+    free(to_sign);
+
+    snprintf(line, sizeof(line), "x-amz-content-sha256: %s", S3_UNSIGNED);
+    headers = curl_slist_append(headers, line);
+    snprintf(line, sizeof(line), "x-amz-date: %s", stamp);
+    headers = curl_slist_append(headers, line);
+
+    if (object->token) {
+        snprintf(line, sizeof(line), "x-amz-security-token: %s", object->token);
+        headers = curl_slist_append(headers, line);
+    }
+
+    snprintf(line, sizeof(line), "Authorization: AWS4-HMAC-SHA256 Credential=%s/%s, SignedHeaders=%s, Signature=%s",
+             object->access_key, scope, signed_headers, signature);
+
+    return curl_slist_append(headers, line);
+}
+
+static size_t s3_read_body(char *buffer, size_t size, size_t count, void *argument) {
+    s3_body_t *body = argument;
+    size_t    length = size * count;
+
+    if (length > body->length - body->sent) {
+        length = body->length - body->sent;
+    }
+
+    memcpy(buffer, body->data + body->sent, length);
+    body->sent += length;
+
+    return length;
+}
+
+static size_t s3_write_response(char *data, size_t size, size_t count, void *argument) {
+    s3_response_t *response = argument;
+    size_t        length = size * count;
+    char          *grown;
+
+    /* only small xml documents are read, range reads use their own callback */
+    grown = realloc(response->data, response->length + length + 1);
+
+    if (!grown) {
+        return 0;
+    }
+
+    response->data = grown;
+    memcpy(response->data + response->length, data, length);
+    response->length += length;
+    response->data[response->length] = 0;
+
+    return length;
+}
+
+/* keeps the etag header of an uploaded part */
+static size_t s3_read_header(char *data, size_t size, size_t count, void *argument) {
+    char   *etag = argument;
+    size_t length = size * count;
+    size_t start, end;
+
+    if (length > 5 && !strncasecmp(data, "ETag:", 5)) {
+        for (start = 5; start < length && data[start] == ' '; start++);
+        for (end = length; end > start && (data[end - 1] == '\r' || data[end - 1] == '\n' || data[end - 1] == ' '); end--);
+
+        if (end - start < S3_ETAG_LENGTH) {
+            memcpy(etag, data + start, end - start);
+            etag[end - start] = 0;
+        }
+    }
+
+    return length;
+}
+
+static size_t s3_write_range(char *data, size_t size, size_t count, void *argument) {
+    s3_range_t    *range = argument;
+    size_t        length = size * count;
+    size_t        capacity;
+    unsigned char *grown;
+
+    if (range->length + length > range->capacity) {
+        if (!range->grow) {
+            return 0;
+        }
+
+        for (capacity = range->capacity ? range->capacity : S3_RANGE; capacity < range->length + length; capacity *= 2);
+
+        if (!(grown = realloc(range->data, capacity))) {
+            return 0;
+        }
+
+        range->data = grown;
+        range->capacity = capacity;
+    }
+
+    memcpy(range->data + range->length, data, length);
+    range->length += length;
+
+    return length;
+}
+
+/* keeps the object size of a Content-Range: bytes first-last/size header */
+static size_t s3_read_range_header(char *data, size_t size, size_t count, void *argument) {
+    s3_range_t *range = argument;
+    size_t     length = size * count;
+    const char *total;
+
+    if (length > 14 && !strncasecmp(data, "Content-Range:", 14)) {
+        total = memchr(data, '/', length);
+
+        if (total && total[1] != '*') {
+            range->total = strtoull(total + 1, NULL, 10);
+        }
+    }
+
+    return length;
+}
+
+/* one signed request, retried on network errors and 5xx responses */
+static int s3_request(CURL *curl, const s3_object_t *object, const char *method, const char *query,
+                      const unsigned char *data, size_t length, s3_response_t *response, char *etag,
+                      const char *bytes, s3_range_t *range) {
+    char              url[4096], line[128];
+    struct curl_slist *headers;
+    s3_body_t         body;
+    long              status = 0;
+    CURLcode          code = CURLE_OK;
+    int               attempt;
+
+    snprintf(url, sizeof(url), "%s%s%s%s", object->base, object->path, *query ? "?" : "", query);
+
+    for (attempt = 0; attempt < S3_RETRIES; attempt++) {
+        if (attempt) {
+            OPENDCP_LOG(LOG_WARN, "retrying %s %s, %s", method, url,
+                        code != CURLE_OK ? curl_easy_strerror(code) : "service unavailable");
+#ifdef _WIN32
+            Sleep(500 << attempt);
+#else
+            usleep(500000 << attempt);
+#endif
+        }
+
+        if (response) {
+            free(response->data);
+            response->data = NULL;
+            response->length = 0;
+        }
+
+        if (range) {
+            range->length = 0;
+            range->total = 0;
+        }
+
+        body.data   = data;
+        body.length = length;
+        body.sent   = 0;
+
+        headers = s3_sign(object, method, query, NULL);
+        headers = curl_slist_append(headers, "Expect:");
+
+        if (bytes) {
+            snprintf(line, sizeof(line), "Range: bytes=%s", bytes);
+            headers = curl_slist_append(headers, line);
+        }
+
+        curl_easy_reset(curl);
+        curl_easy_setopt(curl, CURLOPT_URL, url);
+        curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
+        curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+        curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, method);
+
+        if (!strcmp(method, "PUT") || !strcmp(method, "POST")) {
+            curl_easy_setopt(curl, CURLOPT_UPLOAD, 1L);
+            curl_easy_setopt(curl, CURLOPT_READFUNCTION, s3_read_body);
+            curl_easy_setopt(curl, CURLOPT_READDATA, &body);
+            curl_easy_setopt(curl, CURLOPT_INFILESIZE_LARGE, (curl_off_t)length);
+        }
+
+        if (response) {
+            curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, s3_write_response);
+            curl_easy_setopt(curl, CURLOPT_WRITEDATA, response);
+        }
+
+        if (etag) {
+            etag[0] = 0;
+            curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, s3_read_header);
+            curl_easy_setopt(curl, CURLOPT_HEADERDATA, etag);
+        }
+
+        if (range) {
+            curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, s3_write_range);
+            curl_easy_setopt(curl, CURLOPT_WRITEDATA, range);
+            curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, s3_read_range_header);
+            curl_easy_setopt(curl, CURLOPT_HEADERDATA, range);
+        }
+
+        code = curl_easy_perform(curl);
+        curl_slist_free_all(headers);
+        status = 0;
+
+        if (code == CURLE_OK) {
+            curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &status);
+
+            /* a completed upload can still fail in the body of a 200 */
+            if (status >= 200 && status < 300 && !(response && response->data && strstr(response->data, "<Error>"))) {
+                return OPENDCP_NO_ERROR;
+            }
+
+            if (status < 500 && !(response && response->data && strstr(response->data, "<Error>"))) {
+                break;
+            }
+        }
+    }
+
+    OPENDCP_LOG(LOG_ERROR, "%s %s failed: %s", method, url,
+                code != CURLE_OK ? curl_easy_strerror(code) : (response && response->data ? response->data : "http error"));
+
+    return OPENDCP_UPLOAD;
+}
+
+/* text of the first <tag> of a response */
+static int s3_element(const char *xml, const char *tag, char *value, size_t size) {
+    char       open[64];
+    const char *start, *end;
+
+    snprintf(open, sizeof(open), "<%s>", tag);
+    start = xml ? strstr(xml, open) : NULL;
+
+    if (!start) {
+        return OPENDCP_ERROR;
+    }
+
+    start += strlen(open);
+    end = strchr(start, '<');
+
+    if (!end || (size_t)(end - start) >= size) {
+        return OPENDCP_ERROR;
+    }
+
+    snprintf(value, size, "%.*s", (int)(end - start), start);
+
+    return OPENDCP_NO_ERROR;
+}
+
+static int s3_upload_part(opendcp_upload_t *upload, CURL *curl, s3_part_t *part) {
+    char query[1024], encoded[1024], etag[S3_ETAG_LENGTH];
+    int  rc;
+
+    s3_encode(encoded, sizeof(encoded), upload->upload_id, 0);
+    snprintf(query, sizeof(query), "partNumber=%d&uploadId=%s", part->number, encoded);
+
+    rc = s3_request(curl, &upload->object, "PUT", query, part->data, part->length, NULL, etag, NULL, NULL);
+
+    if (rc == OPENDCP_NO_ERROR && !etag[0]) {
+        OPENDCP_LOG(LOG_ERROR, "part %d of %s was stored without an etag", part->number, upload->object.path);
+        rc = OPENDCP_UPLOAD;
+    }
+
+    pthread_mutex_lock(&upload->lock);
+
+    if (rc == OPENDCP_NO_ERROR) {
+        memcpy(upload->etags[part->number - 1], etag, S3_ETAG_LENGTH);
+        upload->uploaded += part->length;
+    }
+    else {
+        upload->failed = 1;
+    }
+
+    pthread_mutex_unlock(&upload->lock);
+
+    return rc;
+}
+
+static void *s3_upload_thread(void *argument) {
+    opendcp_upload_t *upload = argument;
+    CURL             *curl = curl_easy_init();
+    s3_part_t        *part;
+
+    for (;;) {
+        pthread_mutex_lock(&upload->lock);
+
+        while (!upload->queue && !upload->stop) {
+            pthread_cond_wait(&upload->work, &upload->lock);
+        }
+
+        part = upload->queue;
+
+        if (!part) {
+            pthread_mutex_unlock(&upload->lock);
+            break;
+        }
+
+        upload->queue = part->next;
+
+        if (!upload->queue) {
+            upload->queue_tail = NULL;
+        }
+
+        pthread_mutex_unlock(&upload->lock);
+
+        /* after a failure the rest is only drained */
+        if (!curl || upload->failed || s3_upload_part(upload, curl, part) != OPENDCP_NO_ERROR) {
+            upload->failed = 1;
+        }
+
+        free(part->data);
+        free(part);
+
+        pthread_mutex_lock(&upload->lock);
+        upload->held--;
+        pthread_cond_broadcast(&upload->room);
+        pthread_mutex_unlock(&upload->lock);
+    }
+
+    if (curl) {
+        curl_easy_cleanup(curl);
+    }
+
+    return NULL;
+}
+
+/* makes sure the etag table holds part number */
+static int s3_etag_reserve(opendcp_upload_t *upload, int number) {
+    int  count;
+    char (*etags)[S3_ETAG_LENGTH];
+
+    if (number <= upload->etag_count) {
+        return OPENDCP_NO_ERROR;
+    }
+
+    count = upload->etag_count ? upload->etag_count * 2 : 64;
+
+    if (count < number) {
+        count = number;
+    }
+
+    etags = realloc(upload->etags, count * S3_ETAG_LENGTH);
+
+    if (!etags) {
+        return OPENDCP_ERROR;
+    }
+
+    memset(etags + upload->etag_count, 0, (count - upload->etag_count) * S3_ETAG_LENGTH);
+    upload->etags = etags;
+    upload->etag_count = count;
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* hands the current part to the threads, waiting for room in the window */
+static int s3_submit_current(opendcp_upload_t *upload) {
+    s3_part_t *part = upload->current;
+
+    if (!part) {
+        return OPENDCP_NO_ERROR;
+    }
+
+    upload->current = NULL;
+    part->next = NULL;
+
+    pthread_mutex_lock(&upload->lock);
+
+    if (upload->queue_tail) {
+        upload->queue_tail->next = part;
+    }
+    else {
+        upload->queue = part;
+    }
+
+    upload->queue_tail = part;
+    pthread_cond_signal(&upload->work);
+    pthread_mutex_unlock(&upload->lock);
+
+    return upload->failed ? OPENDCP_UPLOAD : OPENDCP_NO_ERROR;
+}
+
+static int s3_start_part(opendcp_upload_t *upload, int number) {
+    s3_part_t *part;
+
+    if (number > S3_PART_MAX) {
+        OPENDCP_LOG(LOG_ERROR, "%s needs more than %d parts, use larger parts", upload->object.path, S3_PART_MAX);
+        return OPENDCP_UPLOAD;
+    }
+
+    /* part 1 and the one being filled count towards the window too */
+    pthread_mutex_lock(&upload->lock);
+
+    while (upload->held + 2 > upload->window && !upload->failed) {
+        pthread_cond_wait(&upload->room, &upload->lock);
+    }
+
+    upload->held++;
+    pthread_mutex_unlock(&upload->lock);
+
+    if (upload->failed || s3_etag_reserve(upload, number) != OPENDCP_NO_ERROR) {
+        return OPENDCP_UPLOAD;
+    }
+
+    part = calloc(1, sizeof(*part));
+
+    if (part) {
+        part->data = malloc(upload->part_size);
+    }
+
+    if (!part || !part->data) {
+        free(part);
+        return OPENDCP_UPLOAD;
+    }
+
+    part->number = number;
+    upload->current = part;
+    upload->last = number;
+
+    return OPENDCP_NO_ERROR;
+}
+
+int opendcp_s3_url(const char *path) {
+    return path && !strncmp(path, "s3://", 5);
+}
+
+opendcp_upload_t *opendcp_upload_open(const char *url, int part_mb, int threads, int window) {
+    opendcp_upload_t *upload;
+    s3_response_t    response = {NULL, 0};
+    CURL             *curl;
+    int              rc, t;
+
+    pthread_once(&s3_once, s3_global_init);
+
+    upload = calloc(1, sizeof(*upload));
+
+    if (!upload) {
+        return NULL;
+    }
+
+    if (s3_object_init(&upload->object, url, 0) != OPENDCP_NO_ERROR) {
+        free(upload);
+        return NULL;
+    }
+
+    upload->part_size = (size_t)(part_mb > 0 ? part_mb : OPENDCP_UPLOAD_PART_MB) * 1024 * 1024;
+
+    if (upload->part_size < S3_PART_MIN) {
+        upload->part_size = S3_PART_MIN;
+    }
+
+    upload->thread_count = threads > 0 ? threads : OPENDCP_UPLOAD_THREADS;
+    upload->window = window > 0 ? window : upload->thread_count + 2;
+
+    if (upload->window < 3) {
+        upload->window = 3;
+    }
+
+    curl = curl_easy_init();
+    rc = curl ? s3_request(curl, &upload->object, "POST", "uploads=", NULL, 0, &response, NULL, NULL, NULL) : OPENDCP_UPLOAD;
+
+    if (curl) {
+        curl_easy_cleanup(curl);
+    }
+
+    if (rc == OPENDCP_NO_ERROR &&
+        s3_element(response.data, "UploadId", upload->upload_id, sizeof(upload->upload_id)) != OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_ERROR, "no upload id in the response for %s", url);
+        rc = OPENDCP_UPLOAD;
+    }
+
+    free(response.data);
+
+    upload->first.number = 1;
+    upload->first.data = rc == OPENDCP_NO_ERROR ? malloc(upload->part_size) : NULL;
+
+    if (rc != OPENDCP_NO_ERROR || !upload->first.data || s3_etag_reserve(upload, 1) != OPENDCP_NO_ERROR) {
+        free(upload->object.token);
+        free(upload->first.data);
+        free(upload->etags);
+        free(upload);
+        return NULL;
+    }
+
+    upload->last = 1;
+    pthread_mutex_init(&upload->lock, NULL);
+    pthread_cond_init(&upload->work, NULL);
+    pthread_cond_init(&upload->room, NULL);
+    upload->threads = malloc(upload->thread_count * sizeof(pthread_t));
+
+    for (t = 0; t < upload->thread_count; t++) {
+        pthread_create(&upload->threads[t], NULL, s3_upload_thread, upload);
+    }
+
+    OPENDCP_LOG(LOG_INFO, "uploading to %s in %d MB parts on %d threads", url,
+                (int)(upload->part_size >> 20), upload->thread_count);
+
+    return upload;
+}
+
+int opendcp_upload_write(opendcp_upload_t *upload, uint64_t offset, const unsigned char *data, size_t length) {
+    while (length > 0) {
+        int       number = (int)(offset / upload->part_size) + 1;
+        size_t    at = (size_t)(offset % upload->part_size);
+        size_t    count = upload->part_size - at;
+        s3_part_t *part;
+
+        if (upload->failed) {
+            return OPENDCP_UPLOAD;
+        }
+
+        if (count > length) {
+            count = length;
+        }
+
+        if (number == 1) {
+            part = &upload->first;
+        }
+        else if (upload->current && number == upload->current->number) {
+            part = upload->current;
+        }
+        else if (number == upload->last + 1 &&
+                 (upload->current ? upload->current : &upload->first)->length == upload->part_size) {
+            if (s3_submit_current(upload) != OPENDCP_NO_ERROR || s3_start_part(upload, number) != OPENDCP_NO_ERROR) {
+                return OPENDCP_UPLOAD;
+            }
+
+            part = upload->current;
+        }
+        else {
+            OPENDCP_LOG(LOG_ERROR, "write at %llu of %s is outside the parts being uploaded",
+                        (unsigned long long)offset, upload->object.path);
+            upload->failed = 1;
+            return OPENDCP_UPLOAD;
+        }
+
+        /* parts are filled front to back, a gap can not be uploaded */
+        if (at > part->length) {
+            OPENDCP_LOG(LOG_ERROR, "write at %llu of %s leaves a gap", (unsigned long long)offset, upload->object.path);
+            upload->failed = 1;
+            return OPENDCP_UPLOAD;
+        }
+
+        memcpy(part->data + at, data, count);
+
+        if (at + count > part->length) {
+            part->length = at + count;
+        }
+
+        offset += count;
+        data   += count;
+        length -= count;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+static void s3_upload_free(opendcp_upload_t *upload) {
+    int t;
+
+    pthread_mutex_lock(&upload->lock);
+    upload->stop = 1;
+    pthread_cond_broadcast(&upload->work);
+    pthread_mutex_unlock(&upload->lock);
+
+    for (t = 0; t < upload->thread_count; t++) {
+        pthread_join(upload->threads[t], NULL);
+    }
+
+    if (upload->current) {
+        free(upload->current->data);
+        free(upload->current);
+    }
+
+    pthread_mutex_destroy(&upload->lock);
+    pthread_cond_destroy(&upload->work);
+    pthread_cond_destroy(&upload->room);
+    free(upload->threads);
+    free(upload->first.data);
+    free(upload->etags);
+    free(upload->object.token);
+    free(upload);
+}
+
+int opendcp_upload_close(opendcp_upload_t *upload) {
+    s3_response_t response = {NULL, 0};
+    CURL          *curl;
+    char          query[1024], encoded[1024], *xml;
+    size_t        size, used;
+    int           rc, part;
+
+    /* the last part may be short, part 1 goes up now that its header is final */
+    rc = s3_submit_current(upload);
+
+    pthread_mutex_lock(&upload->lock);
+
+    while (upload->held > 0) {
+        pthread_cond_wait(&upload->room, &upload->lock);
+    }
+
+    pthread_mutex_unlock(&upload->lock);
+
+    curl = curl_easy_init();
+
+    if (rc == OPENDCP_NO_ERROR && !upload->failed && curl) {
+        rc = s3_upload_part(upload, curl, &upload->first);
+    }
+
+    if (rc != OPENDCP_NO_ERROR || upload->failed || !curl) {
+        if (curl) {
+            curl_easy_cleanup(curl);
+        }
+
+        opendcp_upload_abort(upload);
+        return OPENDCP_UPLOAD;
+    }
+
+    size = 128 + (size_t)upload->last * (S3_ETAG_LENGTH + 64);
+    xml = malloc(size);
+    used = snprintf(xml, size, "<CompleteMultipartUpload>");
+
+    for (part = 1; part <= upload->last; part++) {
+        used += snprintf(xml + used, size - used, "<Part><PartNumber>%d</PartNumber><ETag>%s</ETag></Part>",
+                         part, upload->etags[part - 1]);
+    }
+
+    used += snprintf(xml + used, size - used, "</CompleteMultipartUpload>");
+
+    s3_encode(encoded, sizeof(encoded), upload->upload_id, 0);
+    snprintf(query, sizeof(query), "uploadId=%s", encoded);
+    rc = s3_request(curl, &upload->object, "POST", query, (unsigned char *)xml, used, &response, NULL, NULL, NULL);
+
+    free(xml);
+    free(response.data);
+    curl_easy_cleanup(curl);
+
+    if (rc != OPENDCP_NO_ERROR) {
+        opendcp_upload_abort(upload);
+        return OPENDCP_UPLOAD;
+    }
+
+    OPENDCP_LOG(LOG_INFO, "uploaded %llu bytes in %d parts to s3://%s", (unsigned long long)upload->uploaded,
+                upload->last, upload->object.path + 1);
+
+    s3_upload_free(upload);
+
+    return OPENDCP_NO_ERROR;
+}
+
+void opendcp_upload_abort(opendcp_upload_t *upload) {
+    char query[1024], encoded[1024];
+    CURL *curl;
+
+    if (!upload) {
+        return;
+    }
+
+    upload->failed = 1;
+    pthread_mutex_lock(&upload->lock);
+    pthread_cond_broadcast(&upload->room);
+    pthread_mutex_unlock(&upload->lock);
+
+    /* the stored parts are billed until the upload is aborted */
+    curl = curl_easy_init();
+
+    if (curl) {
+        s3_encode(encoded, sizeof(encoded), upload->upload_id, 0);
+        snprintf(query, sizeof(query), "uploadId=%s", encoded);
+        s3_request(curl, &upload->object, "DELETE", query, NULL, 0, NULL, NULL, NULL, NULL);
+        curl_easy_cleanup(curl);
+    }
+
+    s3_upload_free(upload);
+}
+
+/* replaces the xml entities of a key in place */
+static void s3_unescape(char *text) {
+    static const char *entities[][2] = {
+        {"&amp;", "&"}, {"&lt;", "<"}, {"&gt;", ">"}, {"&quot;", "\""}, {"&apos;", "'"}
+    };
+    char   *in, *out;
+    size_t e, length;
+
+    for (in = out = text; *in; ) {
+        for (e = 0; e < sizeof(entities) / sizeof(entities[0]); e++) {
+            length = strlen(entities[e][0]);
+
+            if (!strncmp(in, entities[e][0], length)) {
+                break;
+            }
+        }
+
+        if (e < sizeof(entities) / sizeof(entities[0])) {
+            *out++ = entities[e][1][0];
+            in += length;
+        }
+        else {
+            *out++ = *in++;
+        }
+    }
+
+    *out = 0;
+}
+
+/* the same extension match as a directory scan, every key without a filter */
+static int s3_list_select(const char *key, const char *filter) {
+    const char *extension = strrchr(key, '.');
+
+    if (!filter) {
+        return 1;
+    }
+
+    if (!extension || strchr(extension, '/') || strlen(++extension) < 3) {
+        return 0;
+    }
+
+    return strstr(filter, extension) != NULL;
+}
+
+filelist_t *opendcp_s3_list(const char *url, const char *filter) {
+    s3_object_t   object;
+    s3_response_t response = {NULL, 0};
+    CURL          *curl;
+    filelist_t    *filelist = NULL;
+    char          prefix[1024], token[1024], encoded_prefix[3072], encoded_token[3072], query[8192];
+    char          key[1024], *names = NULL, *grown, *p;
+    const char    *contents, *slash;
+    size_t        used = 0, size = 0, length, i;
+    int           count = 0, truncated = 1, rc = OPENDCP_NO_ERROR;
+
+    pthread_once(&s3_once, s3_global_init);
+
+    if (s3_object_init(&object, url, 1) != OPENDCP_NO_ERROR) {
+        return NULL;
+    }
+
+    /* the keys one level below the prefix, like the files of a directory */
+    slash = strchr(url + 5, '/');
+    snprintf(prefix, sizeof(prefix), "%s", slash ? slash + 1 : "");
+    length = strlen(prefix);
+
+    if (length && prefix[length - 1] != '/' && length + 1 < sizeof(prefix)) {
+        strcat(prefix, "/");
+    }
+
+    s3_encode(encoded_prefix, sizeof(encoded_prefix), prefix, 0);
+    token[0] = 0;
+    curl = curl_easy_init();
+
+    while (curl && truncated && rc == OPENDCP_NO_ERROR) {
+        /* the parameters of a signed query are sorted */
+        s3_encode(encoded_token, sizeof(encoded_token), token, 0);
+        snprintf(query, sizeof(query), "%s%s%sdelimiter=%%2F&list-type=2&max-keys=%d&prefix=%s",
+                 token[0] ? "continuation-token=" : "", encoded_token, token[0] ? "&" : "", S3_LIST_PAGE, encoded_prefix);
+
+        rc = s3_request(curl, &object, "GET", query, NULL, 0, &response, NULL, NULL, NULL);
+
+        if (rc != OPENDCP_NO_ERROR) {
+            break;
+        }
+
+        for (contents = strstr(response.data, "<Contents>"); contents; contents = strstr(contents + 10, "<Contents>")) {
+            if (s3_element(contents, "Key", key, sizeof(key)) != OPENDCP_NO_ERROR) {
+                continue;
+            }
+
+            s3_unescape(key);
+
+            /* a folder marker is not a frame */
+            if (!strcmp(key, prefix) || !s3_list_select(key, filter)) {
+                continue;
+            }
+
+            length = strlen(object.bucket) + strlen(key) + 7;
+
+            if (used + length > size) {
+                size = size ? size * 2 : 64 * 1024;
+
+                while (size < used + length) {
+                    size *= 2;
+                }
+
+                if (!(grown = realloc(names, size))) {
+                    rc = OPENDCP_ERROR;
+                    break;
+                }
+
+                names = grown;
+            }
+
+            used += snprintf(names + used, size - used, "s3://%s/%s", object.bucket, key) + 1;
+            count++;
+        }
+
+        truncated = s3_element(response.data, "IsTruncated", key, sizeof(key)) == OPENDCP_NO_ERROR && !strcmp(key, "true");
+
+        if (truncated && s3_element(response.data, "NextContinuationToken", token, sizeof(token)) != OPENDCP_NO_ERROR) {
+            OPENDCP_LOG(LOG_ERROR, "listing of %s is truncated without a continuation token", url);
+            rc = OPENDCP_ERROR;
+        }
+    }
+
+    if (curl) {
+        curl_easy_cleanup(curl);
+    }
+
+    if (curl && rc == OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_DEBUG, "found %d objects under %s", count, url);
+        filelist = filelist_alloc_arena(count, used ? used : 1);
+    }
+
+    if (filelist && count) {
+        memcpy(filelist->arena, names, used);
+
+        for (i = 0, p = filelist->arena; i < (size_t)count; i++) {
+            filelist->files[i] = p;
+            p += strlen(p) + 1;
+        }
+    }
+
+    free(names);
+    free(response.data);
+    free(object.token);
+
+    return filelist;
+}
+
+/* claims the next range to read, the lowest object in the window first */
+static int s3_fetch_claim(opendcp_fetch_t *fetch, int *index, int *range) {
+    s3_fetch_object_t *object;
+    int               i, end;
+
+    end = fetch->low + fetch->window;
+    end = end < fetch->count ? end : fetch->count;
+
+    for (i = fetch->low; i < end; i++) {
+        object = &fetch->objects[i];
+
+        if (object->state == S3_FETCH_IDLE) {
+            object->state = S3_FETCH_PROBING;
+            *index = i;
+            *range = 0;
+            return 1;
+        }
+
+        if (object->state == S3_FETCH_SIZED && object->next < object->ranges) {
+            *index = i;
+            *range = object->next++;
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/* reads one range, the first one also sizes the object */
+static int s3_fetch_range(opendcp_fetch_t *fetch, CURL *curl, int index, int number, size_t *length) {
+    s3_fetch_object_t *object = &fetch->objects[index];
+    s3_object_t       target;
+    s3_range_t        range;
+    char              bytes[64];
+    uint64_t          first, last;
+    unsigned char     *data;
+    int               rc;
+
+    if (s3_object_init(&target, fetch->urls[index], 0) != OPENDCP_NO_ERROR) {
+        return OPENDCP_ERROR;
+    }
+
+    memset(&range, 0, sizeof(range));
+    first = (uint64_t)number * S3_RANGE;
+
+    if (number == 0) {
+        last = S3_RANGE - 1;
+        range.grow = 1;
+    }
+    else {
+        /* only this thread writes these bytes, the buffer is stable once sized */
+        last = first + S3_RANGE - 1 < object->size - 1 ? first + S3_RANGE - 1 : object->size - 1;
+        range.data = object->data + first;
+        range.capacity = (size_t)(last - first + 1);
+    }
+
+    snprintf(bytes, sizeof(bytes), "%llu-%llu", (unsigned long long)first, (unsigned long long)last);
+    rc = s3_request(curl, &target, "GET", "", NULL, 0, NULL, NULL, bytes, &range);
+    free(target.token);
+    *length = range.length;
+
+    if (rc != OPENDCP_NO_ERROR) {
+        if (range.grow) {
+            free(range.data);
+        }
+
+        return OPENDCP_ERROR;
+    }
+
+    if (number) {
+        return range.length == range.capacity ? OPENDCP_NO_ERROR : OPENDCP_ERROR;
+    }
+
+    /* a 200 without Content-Range is the whole object */
+    if (range.total < range.length) {
+        range.total = range.length;
+    }
+
+    if (range.length < range.total && range.length != S3_RANGE) {
+        free(range.data);
+        return OPENDCP_ERROR;
+    }
+
+    if (range.capacity < range.total || range.total == 0) {
+        data = realloc(range.data, range.total ? (size_t)range.total : 1);
+
+        if (!data) {
+            free(range.data);
+            return OPENDCP_ERROR;
+        }
+
+        range.data = data;
+    }
+
+    object->data = range.data;
+    object->size = range.total;
+    object->ranges = (int)((range.total + S3_RANGE - 1) / S3_RANGE);
+    object->ranges = object->ranges ? object->ranges : 1;
+
+    return OPENDCP_NO_ERROR;
+}
+
+static void *s3_fetch_thread(void *argument) {
+    opendcp_fetch_t   *fetch = argument;
+    CURL              *curl = curl_easy_init();
+    s3_fetch_object_t *object;
+    int               index, range, rc;
+    size_t            length;
+
+    pthread_mutex_lock(&fetch->lock);
+
+    while (curl) {
+        while (!fetch->stop && !s3_fetch_claim(fetch, &index, &range)) {
+            pthread_cond_wait(&fetch->work, &fetch->lock);
+        }
+
+        if (fetch->stop) {
+            break;
+        }
+
+        object = &fetch->objects[index];
+        object->active++;
+        pthread_mutex_unlock(&fetch->lock);
+
+        rc = s3_fetch_range(fetch, curl, index, range, &length);
+
+        pthread_mutex_lock(&fetch->lock);
+        object->active--;
+
+        if (object->state == S3_FETCH_RELEASED) {
+            /* the reader gave up on a failed object, the last range out frees it */
+            if (!object->active) {
+                free(object->data);
+                object->data = NULL;
+            }
+        }
+        else if (rc != OPENDCP_NO_ERROR) {
+            OPENDCP_LOG(LOG_ERROR, "could not read %s", fetch->urls[index]);
+            object->state = S3_FETCH_FAILED;
+        }
+        else if (object->state != S3_FETCH_FAILED) {
+            fetch->fetched += length;
+
+            if (range == 0) {
+                object->state = S3_FETCH_SIZED;
+                object->next = 1;
+            }
+
+            if (++object->done == object->ranges) {
+                object->state = S3_FETCH_READY;
+            }
+        }
+
+        pthread_cond_broadcast(&fetch->ready);
+        pthread_cond_broadcast(&fetch->work);
+    }
+
+    pthread_mutex_unlock(&fetch->lock);
+
+    if (curl) {
+        curl_easy_cleanup(curl);
+    }
+
+    return NULL;
+}
+
+opendcp_fetch_t *opendcp_fetch_open(char **urls, int count, int window, int connections) {
+    opendcp_fetch_t *fetch;
+    int             t;
+
+    pthread_once(&s3_once, s3_global_init);
+
+    if (!urls || count < 1) {
+        return NULL;
+    }
+
+    fetch = calloc(1, sizeof(*fetch));
+
+    if (!fetch) {
+        return NULL;
+    }
+
+    fetch->urls = urls;
+    fetch->count = count;
+    fetch->window = window > 0 ? window : 1;
+    fetch->thread_count = connections > 0 ? connections : OPENDCP_FETCH_CONNECTIONS;
+    fetch->objects = calloc(count, sizeof(s3_fetch_object_t));
+    fetch->threads = malloc(fetch->thread_count * sizeof(pthread_t));
+
+    if (!fetch->objects || !fetch->threads) {
+        free(fetch->objects);
+        free(fetch->threads);
+        free(fetch);
+        return NULL;
+    }
+
+    pthread_mutex_init(&fetch->lock, NULL);
+    pthread_cond_init(&fetch->work, NULL);
+    pthread_cond_init(&fetch->ready, NULL);
+
+    for (t = 0; t < fetch->thread_count; t++) {
+        pthread_create(&fetch->threads[t], NULL, s3_fetch_thread, fetch);
+    }
+
+    OPENDCP_LOG(LOG_INFO, "reading %d objects over %d connections, %d ahead", count, fetch->thread_count, fetch->window);
+
+    return fetch;
+}
+
+int opendcp_fetch_get(opendcp_fetch_t *fetch, int index, const unsigned char **data, size_t *size) {
+    s3_fetch_object_t *object = &fetch->objects[index];
+    int               rc;
+
+    pthread_mutex_lock(&fetch->lock);
+
+    while (!fetch->stop && object->state != S3_FETCH_READY && object->state != S3_FETCH_FAILED &&
+           object->state != S3_FETCH_RELEASED) {
+        pthread_cond_wait(&fetch->ready, &fetch->lock);
+    }
+
+    rc = object->state == S3_FETCH_READY ? OPENDCP_NO_ERROR : OPENDCP_ERROR;
+    *data = rc == OPENDCP_NO_ERROR ? object->data : NULL;
+    *size = rc == OPENDCP_NO_ERROR ? (size_t)object->size : 0;
+
+    pthread_mutex_unlock(&fetch->lock);
+
+    return rc;
+}
+
+void opendcp_fetch_release(opendcp_fetch_t *fetch, int index) {
+    s3_fetch_object_t *object = &fetch->objects[index];
+
+    pthread_mutex_lock(&fetch->lock);
+
+    /* a probe in flight has not handed over its buffer yet */
+    if (!object->active) {
+        free(object->data);
+        object->data = NULL;
+    }
+
+    object->state = S3_FETCH_RELEASED;
+
+    /* the window moves past everything released */
+    while (fetch->low < fetch->count && fetch->objects[fetch->low].state == S3_FETCH_RELEASED) {
+        fetch->low++;
+    }
+
+    pthread_cond_broadcast(&fetch->work);
+    pthread_mutex_unlock(&fetch->lock);
+}
+
+void opendcp_fetch_close(opendcp_fetch_t *fetch) {
+    int i;
+
+    if (!fetch) {
+        return;
+    }
+
+    pthread_mutex_lock(&fetch->lock);
+    fetch->stop = 1;
+    pthread_cond_broadcast(&fetch->work);
+    pthread_cond_broadcast(&fetch->ready);
+    pthread_mutex_unlock(&fetch->lock);
+
+    for (i = 0; i < fetch->thread_count; i++) {
+        pthread_join(fetch->threads[i], NULL);
+    }
+
+    OPENDCP_LOG(LOG_INFO, "read %llu bytes from object storage", (unsigned long long)fetch->fetched);
+
+    for (i = 0; i < fetch->count; i++) {
+        free(fetch->objects[i].data);
+    }
+
+    pthread_cond_destroy(&fetch->ready);
+    pthread_cond_destroy(&fetch->work);
+    pthread_mutex_destroy(&fetch->lock);
+    free(fetch->objects);
+    free(fetch->threads);
+    free(fetch);
+}
+
+#else // HAVE_S3
+
+int opendcp_s3_url(const char *path) {
+    return path && !strncmp(path, "s3://", 5);
+}
+
+opendcp_upload_t *opendcp_upload_open(const char *url, int part_mb, int threads, int window) {
+    UNUSED(part_mb);
+    UNUSED(threads);
+    UNUSED(window);
+    OPENDCP_LOG(LOG_ERROR, "%s can not be written, object storage support was not compiled in (ENABLE_S3)", url);
+
+    return NULL;
+}
+
+int opendcp_upload_write(opendcp_upload_t *upload, uint64_t offset, const unsigned char *data, size_t length) {
+    UNUSED(upload);
+    UNUSED(offset);
+    UNUSED(data);
+    UNUSED(length);
+
+    return OPENDCP_UPLOAD;
+}
+
+int opendcp_upload_close(opendcp_upload_t *upload) {
+    UNUSED(upload);
+
+    return OPENDCP_UPLOAD;
+}
+
+void opendcp_upload_abort(opendcp_upload_t *upload) {
+    UNUSED(upload);
+}
+
+filelist_t *opendcp_s3_list(const char *url, const char *filter) {
+    UNUSED(filter);
+    OPENDCP_LOG(LOG_ERROR, "%s can not be read, object storage support was not compiled in (ENABLE_S3)", url);
+
+    return NULL;
+}
+
+opendcp_fetch_t *opendcp_fetch_open(char **urls, int count, int window, int connections) {
+    UNUSED(window);
+    UNUSED(connections);
+
+    if (urls && count > 0) {
+        OPENDCP_LOG(LOG_ERROR, "%s can not be read, object storage support was not compiled in (ENABLE_S3)", urls[0]);
+    }
+
+    return NULL;
+}
+
+int opendcp_fetch_get(opendcp_fetch_t *fetch, int index, const unsigned char **data, size_t *size) {
+    UNUSED(fetch);
+    UNUSED(index);
+    *data = NULL;
+    *size = 0;
+
+    return OPENDCP_ERROR;
+}
+
+void opendcp_fetch_release(opendcp_fetch_t *fetch, int index) {
+    UNUSED(fetch);
+    UNUSED(index);
+}
+
+void opendcp_fetch_close(opendcp_fetch_t *fetch) {
+    UNUSED(fetch);
+}
+
+#endif // HAVE_S3
@@ -0,0 +1,305 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "opendcp.h"
+
+/*
+   Sessions. A long running process creates one session and runs its
+   encodes and wraps as jobs of it. Every job converts with a context of
+   its own, copied from the configuration it was created with, so jobs
+   only share what is read during a conversion. The session holds a
+   number of encode slots: a pipeline of any job takes a slot for each
+   frame or batch it encodes, so the jobs running at once divide the
+   threads of the session between them instead of each taking all of
+   them, and a job that is reading or writing leaves its slots to the
+   others.
+*/
+struct opendcp_session_s {
+    int             threads;
+    int             busy;
+    int             jobs;
+    pthread_mutex_t mutex;
+    pthread_cond_t  cond;
+};
+
+enum JOB_TYPE {
+    JOB_J2K = 0,
+    JOB_MXF
+};
+
+struct opendcp_job_s {
+    opendcp_session_t *session;
+    opendcp_t         *opendcp;
+    int               type;
+    j2k_frame_t       *frames;
+    int               nframes;
+    filelist_t        *filelist;
+    char              *output_file;
+    int               started;
+    int               joined;
+    int               result;
+    pthread_t         thread;
+};
+
+/*!
+ @function opendcp_session_create
+ @abstract Creates a session for jobs that run at once.
+ @param threads The frames the jobs of the session may encode at once, 0 or less for one.
+ @return A new session or NULL on failure.
+*/
+opendcp_session_t *opendcp_session_create(int threads) {
+    opendcp_session_t *session = calloc(1, sizeof(opendcp_session_t));
+
+    if (!session) {
+        return NULL;
+    }
+
+    session->threads = threads > 0 ? threads : 1;
+    pthread_mutex_init(&session->mutex, NULL);
+    pthread_cond_init(&session->cond, NULL);
+
+    return session;
+}
+
+/*!
+ @function opendcp_session_delete
+ @abstract Frees a session.
+ @discussion Waits until every job of the session has been deleted.
+ @param session The session.
+*/
+void opendcp_session_delete(opendcp_session_t *session) {
+    if (!session) {
+        return;
+    }
+
+    pthread_mutex_lock(&session->mutex);
+
+    while (session->jobs) {
+        pthread_cond_wait(&session->cond, &session->mutex);
+    }
+
+    pthread_mutex_unlock(&session->mutex);
+
+    pthread_cond_destroy(&session->cond);
+    pthread_mutex_destroy(&session->mutex);
+    free(session);
+}
+
+/*!
+ @function opendcp_session_acquire
+ @abstract Takes an encode slot of a session, waiting for one to be free.
+ @param session The session, nothing is taken when NULL.
+*/
+void opendcp_session_acquire(opendcp_session_t *session) {
+    if (!session) {
+        return;
+    }
+
+    pthread_mutex_lock(&session->mutex);
+
+    while (session->busy >= session->threads) {
+        pthread_cond_wait(&session->cond, &session->mutex);
+    }
+
+    session->busy++;
+    pthread_mutex_unlock(&session->mutex);
+}
+
+/*!
+ @function opendcp_session_release
+ @abstract Gives back an encode slot taken with opendcp_session_acquire.
+ @param session The session, nothing is given back when NULL.
+*/
+void opendcp_session_release(opendcp_session_t *session) {
+    if (!session) {
+        return;
+    }
+
+    pthread_mutex_lock(&session->mutex);
+    session->busy--;
+    pthread_cond_broadcast(&session->cond);
+    pthread_mutex_unlock(&session->mutex);
+}
+
+/*!
+ @function opendcp_job_create
+ @abstract Creates a job of a session.
+ @discussion The job converts with a copy of the configuration made by
+     opendcp_clone, with the thread count of the session. The callbacks
+     of the copy are set through opendcp_job_context before the job is
+     started.
+ @param session The session.
+ @param config The configuration of the job.
+ @return A new job or NULL on failure.
+*/
+opendcp_job_t *opendcp_job_create(opendcp_session_t *session, const opendcp_t *config) {
+    opendcp_job_t *job = calloc(1, sizeof(opendcp_job_t));
+
+    if (!job) {
+        return NULL;
+    }
+
+    job->opendcp = opendcp_clone(config);
+
+    if (!job->opendcp) {
+        free(job);
+        return NULL;
+    }
+
+    /* a pipeline may start as many threads as the session has, the slots
+       keep the encodes of all jobs within that */
+    job->session          = session;
+    job->opendcp->session = session;
+    job->opendcp->threads = session->threads;
+    job->result           = OPENDCP_NO_ERROR;
+
+    pthread_mutex_lock(&session->mutex);
+    session->jobs++;
+    pthread_mutex_unlock(&session->mutex);
+
+    return job;
+}
+
+/*!
+ @function opendcp_job_context
+ @abstract Returns the context a job converts with.
+ @param job The job.
+ @return The opendcp context of the job.
+*/
+opendcp_t *opendcp_job_context(opendcp_job_t *job) {
+    return job->opendcp;
+}
+
+static void *opendcp_job_run(void *arg) {
+    opendcp_job_t *job = arg;
+
+    if (job->type == JOB_MXF) {
+        job->result = write_mxf(job->opendcp, job->filelist, job->output_file);
+    } else if (job->output_file) {
+        job->result = convert_to_j2k_mxf(job->opendcp, job->frames, job->nframes, job->output_file);
+    } else {
+        job->result = convert_to_j2k_sequence(job->opendcp, job->frames, job->nframes);
+    }
+
+    return NULL;
+}
+
+static int opendcp_job_start(opendcp_job_t *job) {
+    if (job->started) {
+        OPENDCP_LOG(LOG_ERROR, "the job was already started");
+        return OPENDCP_ERROR;
+    }
+
+    if (pthread_create(&job->thread, NULL, opendcp_job_run, job)) {
+        OPENDCP_LOG(LOG_ERROR, "could not start the job");
+        return OPENDCP_ERROR;
+    }
+
+    job->started = 1;
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*!
+ @function opendcp_job_j2k
+ @abstract Starts a jpeg2000 conversion in the background.
+ @discussion The frames and file names are used until the job finishes.
+ @param job The job, which runs once.
+ @param frames The frames to convert, each result field is set when the job finishes.
+ @param nframes The number of frames.
+ @param mxf_file The frames are wrapped into this mxf when set, otherwise they are written to their out_file.
+ @return OPENDCP_NO_ERROR if the job started, otherwise OPENDCP_ERROR.
+*/
+int opendcp_job_j2k(opendcp_job_t *job, j2k_frame_t *frames, int nframes, char *mxf_file) {
+    job->type        = JOB_J2K;
+    job->frames      = frames;
+    job->nframes     = nframes;
+    job->output_file = mxf_file;
+
+    return opendcp_job_start(job);
+}
+
+/*!
+ @function opendcp_job_mxf
+ @abstract Starts wrapping files into an mxf in the background.
+ @discussion The file list is used until the job finishes.
+ @param job The job, which runs once.
+ @param filelist The files to wrap.
+ @param output_file The mxf to write.
+ @return OPENDCP_NO_ERROR if the job started, otherwise OPENDCP_ERROR.
+*/
+int opendcp_job_mxf(opendcp_job_t *job, filelist_t *filelist, char *output_file) {
+    job->type        = JOB_MXF;
+    job->filelist    = filelist;
+    job->output_file = output_file;
+
+    return opendcp_job_start(job);
+}
+
+/*!
+ @function opendcp_job_cancel
+ @abstract Stops a job, safe from any thread.
+ @param job The job.
+*/
+void opendcp_job_cancel(opendcp_job_t *job) {
+    job->opendcp->j2k.cancel = 1;
+    job->opendcp->mxf.cancel = 1;
+}
+
+/*!
+ @function opendcp_job_wait
+ @abstract Waits for a job to finish.
+ @param job The job.
+ @return The result of the conversion, OPENDCP_NO_ERROR for a job never started.
+*/
+int opendcp_job_wait(opendcp_job_t *job) {
+    if (job->started && !job->joined) {
+        pthread_join(job->thread, NULL);
+        job->joined = 1;
+    }
+
+    return job->result;
+}
+
+/*!
+ @function opendcp_job_delete
+ @abstract Waits for a job to finish and frees it.
+ @param job The job.
+*/
+void opendcp_job_delete(opendcp_job_t *job) {
+    opendcp_session_t *session;
+
+    if (!job) {
+        return;
+    }
+
+    opendcp_job_wait(job);
+
+    session = job->session;
+    opendcp_delete(job->opendcp);
+    free(job);
+
+    pthread_mutex_lock(&session->mutex);
+    session->jobs--;
+    pthread_cond_broadcast(&session->cond);
+    pthread_mutex_unlock(&session->mutex);
+}
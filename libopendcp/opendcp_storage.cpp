@@ -0,0 +1,397 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <KM_fileio.h>
+#include <KM_prng.h>
+#include <KM_util.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "opendcp.h"
+
+/*
+   Storage profile. Runs the three ways opendcp uses a volume through the
+   Kumu files the pipeline itself uses, with a few settings each, and
+   keeps the fastest:
+
+   - frame reads, whole source frames read by several readers at once
+   - mxf writes, codestream sized writes queued with Kumu::FileWriter
+     through buffers of several sizes and counts, with and without O_DIRECT
+   - digest reads, one large file read sequentially in several chunk sizes
+
+   The test files are written to the directory given and removed. Their
+   pages are dropped before they are read, so reads come from the volume
+   and not the page cache, and writes are timed up to the end of Sync().
+   A setting within STORAGE_MARGIN of the fastest that needs fewer
+   threads or less memory is preferred to it.
+*/
+#define STORAGE_FRAMES       32
+#define STORAGE_FRAME_SIZE   (12 * Kumu::Megabyte)  /* a 2K 16-bit rgb frame */
+#define STORAGE_WRITE_SIZE   (256 * Kumu::Megabyte)
+#define STORAGE_WRITE_CHUNK  1302000                 /* a 250 Mb/s codestream at 24 fps */
+#define STORAGE_MARGIN       0.95
+
+static const int storage_readers[]     = {1, 2, 4, 8, 16};
+static const int storage_buffer_size[] = {256 * 1024, 1024 * 1024, 4 * 1024 * 1024};
+static const int storage_buffers[]     = {4, 8, 16, 32};
+static const int storage_chunk[]       = {1024 * 1024, 4 * 1024 * 1024, 8 * 1024 * 1024, 16 * 1024 * 1024};
+
+#define STORAGE_COUNT(a) (int)(sizeof(a) / sizeof(a[0]))
+
+/* drop the cached pages of a file, so the next read comes from the volume */
+static void storage_drop(const std::string &path) {
+#ifdef POSIX_FADV_DONTNEED
+    int fd = open(path.c_str(), O_RDONLY);
+
+    if (fd >= 0) {
+        posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        close(fd);
+    }
+#endif
+}
+
+static std::string storage_file(const char *dir, const char *kind, int index) {
+    char name[MAX_FILENAME_LENGTH];
+
+    snprintf(name, sizeof(name), "%s/opendcp_storage_%d_%s_%d.tmp", dir, (int)getpid(), kind, index);
+
+    return name;
+}
+
+static double storage_mbps(ui64_t bytes, unsigned long long elapsed) {
+    return elapsed ? bytes * 1e9 / elapsed / Kumu::Megabyte : 0;
+}
+
+/* write a file of size bytes in chunk sized writes, queued as the mxf writers queue theirs */
+static double storage_write(const std::string &path, const byte_t *data, ui64_t size,
+                            int buffers, int buffer_size, bool direct_io) {
+    Kumu::FileWriter   writer;
+    unsigned long long start   = opendcp_metrics_now();
+    ui64_t             written = 0;
+    Kumu::Result_t     result  = writer.OpenWrite(path);
+
+    if (KM_SUCCESS(result) && buffers) {
+        result = writer.EnableQueuedWrites(direct_io, buffers, buffer_size);
+    }
+
+    while (KM_SUCCESS(result) && written < size) {
+        ui32_t length = size - written < STORAGE_WRITE_CHUNK ? (ui32_t)(size - written) : STORAGE_WRITE_CHUNK;
+
+        result   = writer.Write(data, length);
+        written += length;
+    }
+
+    if (KM_SUCCESS(result)) {
+        result = writer.Sync();
+    }
+
+    if (KM_SUCCESS(result)) {
+        result = writer.Close();
+    }
+
+    if (KM_FAILURE(result)) {
+        return 0;
+    }
+
+    return storage_mbps(size, opendcp_metrics_now() - start);
+}
+
+/* read a file from the start in chunk sized reads */
+static ui64_t storage_read(const std::string &path, byte_t *buffer, ui32_t chunk) {
+    Kumu::FileReader reader;
+    ui64_t           total = 0;
+    ui32_t           length;
+
+    if (KM_FAILURE(reader.OpenRead(path))) {
+        return 0;
+    }
+
+    while (KM_SUCCESS(reader.Read(buffer, chunk, &length)) && length) {
+        total += length;
+    }
+
+    reader.Close();
+
+    return total;
+}
+
+typedef struct {
+    pthread_mutex_t mutex;
+    const char      *dir;
+    int             next;
+    ui64_t          bytes;
+} storage_frames_t;
+
+/* one frame reader, takes the next frame until all were read */
+static void *storage_frame_reader(void *arg) {
+    storage_frames_t *frames = (storage_frames_t *)arg;
+    byte_t           *buffer = (byte_t *)malloc(STORAGE_FRAME_SIZE);
+    ui64_t           bytes   = 0;
+    int              index;
+
+    if (!buffer) {
+        return NULL;
+    }
+
+    while (1) {
+        pthread_mutex_lock(&frames->mutex);
+        index = frames->next++;
+        pthread_mutex_unlock(&frames->mutex);
+
+        if (index >= STORAGE_FRAMES) {
+            break;
+        }
+
+        bytes += storage_read(storage_file(frames->dir, "frame", index), buffer, STORAGE_FRAME_SIZE);
+    }
+
+    free(buffer);
+
+    pthread_mutex_lock(&frames->mutex);
+    frames->bytes += bytes;
+    pthread_mutex_unlock(&frames->mutex);
+
+    return NULL;
+}
+
+/* read all frames with this many readers */
+static double storage_frame_pass(const char *dir, int readers) {
+    storage_frames_t   frames;
+    pthread_t          threads[16];
+    unsigned long long start, elapsed;
+    int                i, started = 0;
+
+    for (i = 0; i < STORAGE_FRAMES; i++) {
+        storage_drop(storage_file(dir, "frame", i));
+    }
+
+    memset(&frames, 0, sizeof(frames));
+    pthread_mutex_init(&frames.mutex, NULL);
+    frames.dir = dir;
+
+    start = opendcp_metrics_now();
+
+    for (i = 0; i < readers && i < 16; i++) {
+        if (!pthread_create(&threads[started], NULL, storage_frame_reader, &frames)) {
+            started++;
+        }
+    }
+
+    for (i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    elapsed = opendcp_metrics_now() - start;
+    pthread_mutex_destroy(&frames.mutex);
+
+    if (!started || frames.bytes < (ui64_t)STORAGE_FRAMES * STORAGE_FRAME_SIZE) {
+        return 0;
+    }
+
+    return storage_mbps(frames.bytes, elapsed);
+}
+
+/* the fewest readers within the margin of the fastest */
+static int storage_profile_frames(const char *dir, const byte_t *data, opendcp_storage_t *storage) {
+    double mbps[STORAGE_COUNT(storage_readers)];
+    double best = 0;
+    int    i, result = OPENDCP_NO_ERROR;
+
+    for (i = 0; i < STORAGE_FRAMES && result == OPENDCP_NO_ERROR; i++) {
+        if (storage_write(storage_file(dir, "frame", i), data, STORAGE_FRAME_SIZE, 0, 0, false) <= 0) {
+            OPENDCP_LOG(LOG_ERROR, "could not write the test frames to %s", dir);
+            result = OPENDCP_ERROR;
+        }
+    }
+
+    for (i = 0; i < STORAGE_COUNT(storage_readers) && result == OPENDCP_NO_ERROR; i++) {
+        mbps[i] = storage_frame_pass(dir, storage_readers[i]);
+        best    = mbps[i] > best ? mbps[i] : best;
+
+        OPENDCP_LOG(LOG_INFO, "storage frame reads, %d readers: %.1f MB/s", storage_readers[i], mbps[i]);
+    }
+
+    for (i = 0; i < STORAGE_FRAMES; i++) {
+        Kumu::DeleteFile(storage_file(dir, "frame", i));
+    }
+
+    if (result != OPENDCP_NO_ERROR || best <= 0) {
+        return OPENDCP_ERROR;
+    }
+
+    for (i = 0; mbps[i] < best * STORAGE_MARGIN; i++);
+
+    storage->readers   = storage_readers[i];
+    storage->read_mbps = mbps[i];
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* one mxf write pass, logged */
+static double storage_write_pass(const std::string &path, const byte_t *data, int buffers, int buffer_size, bool direct_io) {
+    double mbps = storage_write(path, data, STORAGE_WRITE_SIZE, buffers, buffer_size, direct_io);
+
+    OPENDCP_LOG(LOG_INFO, "storage mxf writes, %d buffers of %d KB%s: %.1f MB/s",
+                buffers, buffer_size / 1024, direct_io ? ", direct" : "", mbps);
+
+    return mbps;
+}
+
+/* the buffer size, then the fewest buffers within the margin, then O_DIRECT if it is faster */
+static int storage_profile_writes(const char *dir, const byte_t *data, opendcp_storage_t *storage) {
+    std::string path = storage_file(dir, "mxf", 0);
+    double      mbps[STORAGE_COUNT(storage_buffers)];
+    double      best = 0, result;
+    int         i;
+
+    storage->io_buffers = 8;
+
+    for (i = 0; i < STORAGE_COUNT(storage_buffer_size); i++) {
+        result = storage_write_pass(path, data, storage->io_buffers, storage_buffer_size[i], false);
+
+        if (result > best) {
+            best                    = result;
+            storage->io_buffer_size = storage_buffer_size[i];
+        }
+    }
+
+    if (best <= 0) {
+        OPENDCP_LOG(LOG_ERROR, "could not write the test mxf to %s", dir);
+        Kumu::DeleteFile(path);
+        return OPENDCP_ERROR;
+    }
+
+    for (i = 0; i < STORAGE_COUNT(storage_buffers); i++) {
+        mbps[i] = storage_buffers[i] == storage->io_buffers ? best :
+                  storage_write_pass(path, data, storage_buffers[i], storage->io_buffer_size, false);
+        best    = mbps[i] > best ? mbps[i] : best;
+    }
+
+    for (i = 0; mbps[i] < best * STORAGE_MARGIN; i++);
+
+    storage->io_buffers = storage_buffers[i];
+    storage->write_mbps = mbps[i];
+
+    /* direct writes only pay when they are clearly faster, the page cache helps the rest of the job */
+    result = storage_write_pass(path, data, storage->io_buffers, storage->io_buffer_size, true);
+
+    if (result * STORAGE_MARGIN > storage->write_mbps) {
+        storage->direct_io  = 1;
+        storage->write_mbps = result;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* read the test mxf in each chunk size, the smallest within the margin of the fastest */
+static int storage_profile_digest(const char *dir, opendcp_storage_t *storage) {
+    std::string        path = storage_file(dir, "mxf", 0);
+    double             mbps[STORAGE_COUNT(storage_chunk)];
+    double             best = 0;
+    byte_t             *buffer;
+    unsigned long long start;
+    ui64_t             bytes;
+    int                i;
+
+    buffer = (byte_t *)malloc(storage_chunk[STORAGE_COUNT(storage_chunk) - 1]);
+
+    if (!buffer) {
+        Kumu::DeleteFile(path);
+        return OPENDCP_ERROR;
+    }
+
+    for (i = 0; i < STORAGE_COUNT(storage_chunk); i++) {
+        storage_drop(path);
+
+        start   = opendcp_metrics_now();
+        bytes   = storage_read(path, buffer, storage_chunk[i]);
+        mbps[i] = bytes == STORAGE_WRITE_SIZE ? storage_mbps(bytes, opendcp_metrics_now() - start) : 0;
+        best    = mbps[i] > best ? mbps[i] : best;
+
+        OPENDCP_LOG(LOG_INFO, "storage digest reads of %d KB: %.1f MB/s", storage_chunk[i] / 1024, mbps[i]);
+    }
+
+    free(buffer);
+    Kumu::DeleteFile(path);
+
+    if (best <= 0) {
+        OPENDCP_LOG(LOG_ERROR, "could not read the test mxf in %s", dir);
+        return OPENDCP_ERROR;
+    }
+
+    for (i = 0; mbps[i] < best * STORAGE_MARGIN; i++);
+
+    storage->digest_read_size = storage_chunk[i];
+    storage->digest_mbps      = mbps[i];
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*!
+ @function opendcp_profile_storage
+ @abstract Finds the I/O settings a volume is fastest with.
+ @discussion Times frame reads with several readers, mxf writes with
+     several write buffer sizes and counts, with and without O_DIRECT,
+     and digest reads with several read sizes. About a gigabyte and a half
+     is written to dir for the tests, and removed afterwards.
+     opendcp_tune_storage keeps the result in a tuning profile.
+ @param dir A directory on the volume.
+ @param storage Receives the fastest settings.
+ @return OPENDCP_NO_ERROR or OPENDCP_ERROR when a test could not run.
+*/
+extern "C" int opendcp_profile_storage(const char *dir, opendcp_storage_t *storage) {
+    Kumu::FortunaRNG rng;
+    byte_t           *data;
+    int              result;
+
+    if (!Kumu::PathIsDirectory(dir)) {
+        OPENDCP_LOG(LOG_ERROR, "%s is not a directory", dir);
+        return OPENDCP_ERROR;
+    }
+
+    data = (byte_t *)malloc(STORAGE_FRAME_SIZE);
+
+    if (!data) {
+        return OPENDCP_ERROR;
+    }
+
+    /* random data, so compressing storage does not flatter itself */
+    rng.FillRandom(data, STORAGE_FRAME_SIZE);
+
+    memset(storage, 0, sizeof(opendcp_storage_t));
+
+    OPENDCP_LOG(LOG_INFO, "profiling the storage of %s", dir);
+
+    result = storage_profile_frames(dir, data, storage);
+
+    if (result == OPENDCP_NO_ERROR) {
+        result = storage_profile_writes(dir, data, storage);
+    }
+
+    if (result == OPENDCP_NO_ERROR) {
+        result = storage_profile_digest(dir, storage);
+    }
+
+    free(data);
+
+    return result;
+}
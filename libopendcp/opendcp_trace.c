@@ -0,0 +1,243 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "opendcp.h"
+
+/*
+   Trace spans, written as Chrome trace event JSON that chrome://tracing
+   and Perfetto load. Every thread records into its own chain of event
+   blocks, so recording takes no lock once a thread has its first block.
+   The blocks stay on a list after their thread exits and are written out
+   when tracing stops. While tracing is off a span costs one test of
+   opendcp_trace_enabled.
+*/
+#define TRACE_BLOCK_EVENTS 4096
+
+typedef struct {
+    const char         *name;
+    unsigned long long start;
+    unsigned long long end;
+} trace_event_t;
+
+typedef struct trace_block_s {
+    struct trace_block_s *next;
+    int                  count;
+    trace_event_t        events[TRACE_BLOCK_EVENTS];
+} trace_block_t;
+
+typedef struct trace_thread_s {
+    struct trace_thread_s *next;
+    int                   tid;
+    trace_block_t         *head;
+    trace_block_t         *tail;
+} trace_thread_t;
+
+int opendcp_trace_enabled = 0;
+
+static pthread_mutex_t    trace_mutex = PTHREAD_MUTEX_INITIALIZER;
+static trace_thread_t     *trace_threads = NULL;
+static int                trace_tids = 0;
+static int                trace_generation = 0;
+static char               *trace_file = NULL;
+static unsigned long long trace_origin = 0;
+
+static __thread trace_thread_t *trace_self = NULL;
+static __thread int            trace_self_generation = 0;
+
+/* the block a thread records into next, a new one once it is full */
+static trace_block_t *trace_block(void) {
+    trace_thread_t *self = trace_self;
+    trace_block_t  *block;
+
+    if (self && trace_self_generation == trace_generation && self->tail->count < TRACE_BLOCK_EVENTS) {
+        return self->tail;
+    }
+
+    block = malloc(sizeof(trace_block_t));
+
+    if (!block) {
+        return NULL;
+    }
+
+    block->next  = NULL;
+    block->count = 0;
+
+    pthread_mutex_lock(&trace_mutex);
+
+    if (!self || trace_self_generation != trace_generation) {
+        self = calloc(1, sizeof(trace_thread_t));
+
+        if (!self) {
+            pthread_mutex_unlock(&trace_mutex);
+            free(block);
+            return NULL;
+        }
+
+        self->tid             = ++trace_tids;
+        self->head            = block;
+        self->next            = trace_threads;
+        trace_threads         = self;
+        trace_self            = self;
+        trace_self_generation = trace_generation;
+    } else {
+        self->tail->next = block;
+    }
+
+    self->tail = block;
+    pthread_mutex_unlock(&trace_mutex);
+
+    return block;
+}
+
+/*!
+ @function opendcp_trace_span
+ @abstract Records a span on the calling thread, from start to now.
+ @param name The span name, a string literal such as "encode".
+ @param start The opendcp_metrics_now time the span began.
+*/
+void opendcp_trace_span(const char *name, unsigned long long start) {
+    trace_block_t *block;
+
+    if (!opendcp_trace_enabled || !start) {
+        return;
+    }
+
+    block = trace_block();
+
+    if (block) {
+        trace_event_t *event = &block->events[block->count];
+
+        event->name  = name;
+        event->start = start;
+        event->end   = opendcp_metrics_now();
+        block->count++;
+    }
+}
+
+/*!
+ @function opendcp_trace_start
+ @abstract Starts recording trace spans.
+ @discussion Spans of the pipeline stages and of libasdcp encryption and
+             hashing are recorded from here until opendcp_trace_stop.
+ @param file The Chrome trace JSON file written when tracing stops.
+ @return OPENDCP_NO_ERROR or OPENDCP_ERROR.
+*/
+int opendcp_trace_start(const char *file) {
+    pthread_mutex_lock(&trace_mutex);
+
+    if (opendcp_trace_enabled || !(trace_file = strdup(file))) {
+        pthread_mutex_unlock(&trace_mutex);
+        return OPENDCP_ERROR;
+    }
+
+    trace_origin = opendcp_metrics_now();
+    trace_generation++;
+    opendcp_trace_enabled = 1;
+    pthread_mutex_unlock(&trace_mutex);
+
+    opendcp_trace_asdcp(1);
+
+    return OPENDCP_NO_ERROR;
+}
+
+/* microseconds since tracing started */
+static double trace_us(unsigned long long t) {
+    return t > trace_origin ? (t - trace_origin) / 1000.0 : 0.0;
+}
+
+/*!
+ @function opendcp_trace_stop
+ @abstract Stops recording and writes the trace.
+ @discussion Threads that record spans must be done before this is called.
+             Each thread is a track of its own, named after its first span.
+ @return OPENDCP_NO_ERROR, or OPENDCP_ERROR if the trace could not be written.
+*/
+int opendcp_trace_stop(void) {
+    trace_thread_t *thread, *next_thread;
+    trace_block_t  *block, *next_block;
+    FILE           *fp;
+    int            i, first = 1, result = OPENDCP_NO_ERROR;
+
+    if (!opendcp_trace_enabled) {
+        return OPENDCP_ERROR;
+    }
+
+    opendcp_trace_asdcp(0);
+    opendcp_trace_enabled = 0;
+
+    pthread_mutex_lock(&trace_mutex);
+
+    fp = fopen(trace_file, "w");
+
+    if (!fp) {
+        OPENDCP_LOG(LOG_ERROR, "could not write trace to %s", trace_file);
+        result = OPENDCP_ERROR;
+    } else {
+        fprintf(fp, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [");
+
+        for (thread = trace_threads; thread; thread = thread->next) {
+            if (thread->head->count) {
+                fprintf(fp, "%s\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": %d, "
+                        "\"args\": {\"name\": \"%s %d\"}}", first ? "" : ",", thread->tid,
+                        thread->head->events[0].name, thread->tid);
+                first = 0;
+            }
+
+            for (block = thread->head; block; block = block->next) {
+                for (i = 0; i < block->count; i++) {
+                    trace_event_t *event = &block->events[i];
+
+                    fprintf(fp, "%s\n{\"name\": \"%s\", \"ph\": \"X\", \"pid\": 1, \"tid\": %d, \"ts\": %.3f, \"dur\": %.3f}",
+                            first ? "" : ",", event->name, thread->tid, trace_us(event->start),
+                            event->end > event->start ? (event->end - event->start) / 1000.0 : 0.0);
+                    first = 0;
+                }
+            }
+        }
+
+        fprintf(fp, "\n]}\n");
+
+        if (fclose(fp)) {
+            result = OPENDCP_ERROR;
+        }
+    }
+
+    for (thread = trace_threads; thread; thread = next_thread) {
+        next_thread = thread->next;
+
+        for (block = thread->head; block; block = next_block) {
+            next_block = block->next;
+            free(block);
+        }
+
+        free(thread);
+    }
+
+    trace_threads = NULL;
+    trace_tids    = 0;
+    free(trace_file);
+    trace_file = NULL;
+
+    pthread_mutex_unlock(&trace_mutex);
+
+    return result;
+}
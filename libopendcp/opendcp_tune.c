@@ -0,0 +1,623 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "opendcp.h"
+
+/*
+   Automatic tuning. The best thread count, reader count and queue depth
+   depend on the processors, the storage and the input of a host. A
+   calibration runs a sample of the actual frames through the j2k
+   pipeline a few times, writing next to the actual output, and keeps
+   the settings that gave the most frames per second. The thread count is
+   searched first, then the readers and the queue depth at that count. A
+   first pass is not measured, it warms the caches for the passes after
+   it. The result is saved as a profile of the host that later runs load.
+
+   The profile also keeps what opendcp_profile_storage found for the
+   volume the host writes to, the frame readers, the mxf write buffers and
+   the digest read size. Calibration starts from those readers and keeps
+   the storage settings, so either may run first.
+*/
+#define TUNE_SAMPLE_MIN 8
+#define TUNE_SAMPLE_MAX 64
+#define TUNE_CANDIDATES 4
+
+/*
+   Estimation. A job is predicted from a sample of its frames the same
+   way, without searching. A serial pass gives the time of each stage and
+   the size of the codestreams, a pass on every processor gives how much
+   of a frame scales with threads. With the fraction s that did not scale,
+   t threads convert 1 / (s + (1 - s) / t) times as many frames per second
+   as one. The mxf adds a klv header and an index entry to each frame, an
+   encrypted frame its cryptographic header and padding, and the
+   partitions and header metadata once.
+*/
+#define ESTIMATE_FRAME_OVERHEAD   31
+#define ESTIMATE_CRYPTO_OVERHEAD  176
+#define ESTIMATE_HEADER_OVERHEAD  65536
+
+/*!
+ @function opendcp_tune_path
+ @abstract Gives the file of the tuning profile of this host.
+ @discussion The profile is kept in the home directory, named after the
+     host, so hosts sharing a home directory keep their own.
+ @param path Receives the file name.
+ @param size The size of path.
+ @return OPENDCP_NO_ERROR or OPENDCP_ERROR.
+*/
+int opendcp_tune_path(char *path, int size) {
+    char       host[64];
+    const char *home;
+    int        n;
+
+#ifdef _WIN32
+    const char *name = getenv("COMPUTERNAME");
+
+    home = getenv("USERPROFILE");
+
+    if (!name) {
+        return OPENDCP_ERROR;
+    }
+
+    snprintf(host, sizeof(host), "%s", name);
+#else
+    home = getenv("HOME");
+
+    if (gethostname(host, sizeof(host))) {
+        return OPENDCP_ERROR;
+    }
+
+    host[sizeof(host) - 1] = '\0';
+#endif
+
+    if (!home) {
+        return OPENDCP_ERROR;
+    }
+
+    n = snprintf(path, size, "%s/.opendcp_tune_%s", home, host);
+
+    return n > 0 && n < size ? OPENDCP_NO_ERROR : OPENDCP_ERROR;
+}
+
+/*!
+ @function opendcp_tune_load
+ @abstract Reads a tuning profile.
+ @param tune Receives the profile.
+ @param file The profile, NULL for the one of this host.
+ @return OPENDCP_NO_ERROR or OPENDCP_ERROR when there is no valid profile.
+*/
+int opendcp_tune_load(opendcp_tune_t *tune, const char *file) {
+    char path[MAX_PATH_LENGTH];
+    char line[256];
+    FILE *fp;
+
+    if (!file) {
+        if (opendcp_tune_path(path, sizeof(path)) != OPENDCP_NO_ERROR) {
+            return OPENDCP_ERROR;
+        }
+
+        file = path;
+    }
+
+    fp = fopen(file, "r");
+
+    if (!fp) {
+        return OPENDCP_ERROR;
+    }
+
+    memset(tune, 0, sizeof(opendcp_tune_t));
+
+    while (fgets(line, sizeof(line), fp)) {
+        if (sscanf(line, "threads=%d", &tune->threads) == 1 ||
+            sscanf(line, "readers=%d", &tune->readers) == 1 ||
+            sscanf(line, "queue_depth=%d", &tune->queue_depth) == 1 ||
+            sscanf(line, "fps=%lf", &tune->fps) == 1 ||
+            sscanf(line, "storage_readers=%d", &tune->storage_readers) == 1 ||
+            sscanf(line, "io_buffers=%d", &tune->io_buffers) == 1 ||
+            sscanf(line, "io_buffer_size=%d", &tune->io_buffer_size) == 1 ||
+            sscanf(line, "direct_io=%d", &tune->direct_io) == 1 ||
+            sscanf(line, "digest_read_size=%d", &tune->digest_read_size) == 1) {
+            continue;
+        }
+    }
+
+    fclose(fp);
+
+    if ((tune->threads < 1 && tune->storage_readers < 1) || tune->threads < 0 || tune->readers < 0 ||
+        tune->queue_depth < 0 || tune->io_buffers < 0 || tune->io_buffer_size < 0 || tune->digest_read_size < 0) {
+        OPENDCP_LOG(LOG_WARN, "ignoring the invalid tuning profile %s", file);
+        return OPENDCP_ERROR;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*!
+ @function opendcp_tune_save
+ @abstract Writes a tuning profile.
+ @param tune The profile.
+ @param file The file, NULL for the profile of this host.
+ @return OPENDCP_NO_ERROR or OPENDCP_ERROR.
+*/
+int opendcp_tune_save(const opendcp_tune_t *tune, const char *file) {
+    char path[MAX_PATH_LENGTH];
+    FILE *fp;
+
+    if (!file) {
+        if (opendcp_tune_path(path, sizeof(path)) != OPENDCP_NO_ERROR) {
+            OPENDCP_LOG(LOG_ERROR, "could not find the home directory for the tuning profile");
+            return OPENDCP_ERROR;
+        }
+
+        file = path;
+    }
+
+    fp = fopen(file, "w");
+
+    if (!fp) {
+        OPENDCP_LOG(LOG_ERROR, "could not write tuning profile to %s", file);
+        return OPENDCP_ERROR;
+    }
+
+    fprintf(fp, "# opendcp tuning profile, written by opendcp_j2k --autotune and --profile_storage\n");
+    fprintf(fp, "threads=%d\n", tune->threads);
+    fprintf(fp, "readers=%d\n", tune->readers);
+    fprintf(fp, "queue_depth=%d\n", tune->queue_depth);
+    fprintf(fp, "fps=%.2f\n", tune->fps);
+
+    if (tune->storage_readers > 0) {
+        fprintf(fp, "storage_readers=%d\n", tune->storage_readers);
+        fprintf(fp, "io_buffers=%d\n", tune->io_buffers);
+        fprintf(fp, "io_buffer_size=%d\n", tune->io_buffer_size);
+        fprintf(fp, "direct_io=%d\n", tune->direct_io);
+        fprintf(fp, "digest_read_size=%d\n", tune->digest_read_size);
+    }
+
+    if (fclose(fp)) {
+        OPENDCP_LOG(LOG_ERROR, "could not write tuning profile to %s", file);
+        return OPENDCP_ERROR;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*!
+ @function opendcp_tune_apply
+ @abstract Sets the options a tuning profile holds.
+ @discussion Sets the thread count and the pipeline readers and queue
+     depth when the profile was calibrated, and the storage settings
+     with opendcp_tune_apply_storage. The thread pool is not resized, the
+     caller sets it up with the new thread count.
+ @param opendcp The options.
+ @param tune The profile.
+*/
+void opendcp_tune_apply(opendcp_t *opendcp, const opendcp_tune_t *tune) {
+    if (tune->threads > 0) {
+        opendcp->threads         = tune->threads;
+        opendcp->j2k.readers     = tune->readers;
+        opendcp->j2k.queue_depth = tune->queue_depth;
+    }
+
+    opendcp_tune_apply_storage(opendcp, tune);
+}
+
+/*!
+ @function opendcp_tune_apply_storage
+ @abstract Sets the storage options a tuning profile holds.
+ @discussion Sets the mxf write buffers and the digest read size, and
+     the pipeline readers of an uncalibrated profile. Options already
+     given are kept, direct_io is only ever turned on.
+ @param opendcp The options.
+ @param tune The profile.
+*/
+void opendcp_tune_apply_storage(opendcp_t *opendcp, const opendcp_tune_t *tune) {
+    if (tune->storage_readers < 1) {
+        return;
+    }
+
+    if (!opendcp->j2k.readers) {
+        opendcp->j2k.readers = tune->storage_readers;
+    }
+
+    if (!opendcp->mxf.io_buffers) {
+        opendcp->mxf.io_buffers = tune->io_buffers;
+    }
+
+    if (!opendcp->mxf.io_buffer_size) {
+        opendcp->mxf.io_buffer_size = tune->io_buffer_size;
+    }
+
+    if (tune->direct_io) {
+        opendcp->mxf.direct_io = 1;
+    }
+
+    if (!opendcp->dcp.digest_read_size) {
+        opendcp->dcp.digest_read_size = tune->digest_read_size;
+    }
+}
+
+/*!
+ @function opendcp_tune_storage
+ @abstract Keeps the result of a storage profile in a tuning profile.
+ @param tune The profile, its calibration is left as it is.
+ @param storage The result of opendcp_profile_storage.
+*/
+void opendcp_tune_storage(opendcp_tune_t *tune, const opendcp_storage_t *storage) {
+    tune->storage_readers  = storage->readers;
+    tune->io_buffers       = storage->io_buffers;
+    tune->io_buffer_size   = storage->io_buffer_size;
+    tune->direct_io        = storage->direct_io;
+    tune->digest_read_size = storage->digest_read_size;
+}
+
+/* one calibration pass over the sample, the frames per second or 0 on failure */
+static double tune_pass(opendcp_t *opendcp, j2k_frame_t *sample, int n, int threads, int readers, int queue,
+                        unsigned long long *bytes) {
+    unsigned long long start, elapsed;
+    struct stat        st;
+    int                result, i;
+
+    opendcp->threads         = threads;
+    opendcp->j2k.readers     = readers;
+    opendcp->j2k.queue_depth = queue;
+    opendcp_pool_init(threads);
+
+    start   = opendcp_metrics_now();
+    result  = convert_to_j2k_sequence(opendcp, sample, n);
+    elapsed = opendcp_metrics_now() - start;
+
+    for (i = 0; i < n; i++) {
+        if (bytes && !stat(sample[i].out_file, &st)) {
+            *bytes += st.st_size;
+        }
+        remove(sample[i].out_file);
+    }
+
+    if (result != OPENDCP_NO_ERROR || !elapsed) {
+        return 0;
+    }
+
+    return n * 1e9 / elapsed;
+}
+
+/* add a candidate unless it is already there */
+static int tune_candidate(int *candidates, int count, int value) {
+    int i;
+
+    value = value > 0 ? value : 1;
+
+    for (i = 0; i < count; i++) {
+        if (candidates[i] == value) {
+            return count;
+        }
+    }
+
+    candidates[count] = value;
+
+    return count + 1;
+}
+
+enum TUNE_SETTING {
+    TUNE_THREADS = 0,
+    TUNE_READERS,
+    TUNE_QUEUE_DEPTH
+};
+
+static int *tune_setting(opendcp_tune_t *tune, int setting) {
+    switch (setting) {
+        case TUNE_READERS:
+            return &tune->readers;
+        case TUNE_QUEUE_DEPTH:
+            return &tune->queue_depth;
+        default:
+            return &tune->threads;
+    }
+}
+
+/* try each candidate of one setting, keeping the others, and keep the fastest */
+static void tune_search(opendcp_t *opendcp, j2k_frame_t *sample, int n, opendcp_tune_t *best,
+                        const int *candidates, int count, int setting) {
+    opendcp_tune_t trial;
+    int            i;
+
+    for (i = 0; i < count && !opendcp->j2k.cancel; i++) {
+        trial = *best;
+        *tune_setting(&trial, setting) = candidates[i];
+
+        trial.fps = tune_pass(opendcp, sample, n, trial.threads, trial.readers, trial.queue_depth, NULL);
+
+        OPENDCP_LOG(LOG_INFO, "autotune %d threads, %d readers, queues of %d: %.2f frames/s",
+                    trial.threads, trial.readers, trial.queue_depth, trial.fps);
+
+        if (trial.fps > best->fps) {
+            *best = trial;
+        }
+    }
+}
+
+/* n frames spread over the sequence, written to names that are removed after each pass */
+static j2k_frame_t *tune_sample(opendcp_t *opendcp, j2k_frame_t *frames, int nframes, int n, char **names) {
+    j2k_frame_t *sample;
+    int         i;
+
+    sample = malloc(n * sizeof(j2k_frame_t));
+    *names = malloc((size_t)n * MAX_FILENAME_LENGTH);
+
+    if (!sample || !*names) {
+        free(sample);
+        free(*names);
+        return NULL;
+    }
+
+    for (i = 0; i < n; i++) {
+        j2k_frame_t *frame = &frames[(long long)i * nframes / n];
+
+        sample[i].in_file  = frame->in_file;
+        sample[i].out_file = *names + (size_t)i * MAX_FILENAME_LENGTH;
+
+        if (frame->out_file) {
+            snprintf(sample[i].out_file, MAX_FILENAME_LENGTH, "%s.tune.j2c", frame->out_file);
+        } else {
+            snprintf(sample[i].out_file, MAX_FILENAME_LENGTH, "%s/opendcp_tune_%d_%d.j2c",
+                     opendcp->tmp_path ? opendcp->tmp_path : ".", (int)getpid(), i);
+        }
+    }
+
+    return sample;
+}
+
+/* the passes measure the conversion alone */
+static void tune_isolate(opendcp_t *opendcp) {
+    opendcp->metrics                 = NULL;
+    opendcp->j2k.quality             = NULL;
+    opendcp->j2k.gamut               = NULL;
+    opendcp->j2k.cache_dir           = NULL;
+    opendcp->j2k.manifest            = NULL;
+    opendcp->j2k.dedup               = 0;
+    opendcp->j2k.frame_done.callback = NULL;
+}
+
+/*!
+ @function opendcp_autotune
+ @abstract Finds the fastest pipeline settings for this host and input.
+ @discussion Runs a sample of at most 64 frames spread over the sequence
+     through convert_to_j2k_sequence with each candidate setting. The
+     codestreams are written next to the out_file of the frames, or to
+     tmp_path, and removed after each pass. The options are restored
+     afterwards, the thread pool is left with the last thread count tried.
+ @param opendcp The options of the conversion.
+ @param frames The frames of the conversion.
+ @param nframes The number of frames.
+ @param tune Receives the fastest settings.
+ @return OPENDCP_NO_ERROR or OPENDCP_ERROR when no pass succeeded.
+*/
+int opendcp_autotune(opendcp_t *opendcp, j2k_frame_t *frames, int nframes, opendcp_tune_t *tune) {
+    opendcp_t      saved = *opendcp;
+    opendcp_tune_t best, stored;
+    j2k_frame_t    *sample;
+    char           *names;
+    int            candidates[TUNE_CANDIDATES];
+    int            cpus, n, count;
+
+    if (nframes < 1) {
+        return OPENDCP_ERROR;
+    }
+
+    opendcp_pool_init(0);
+    cpus = opendcp_pool_threads();
+
+    n = cpus * 2 > TUNE_SAMPLE_MIN ? cpus * 2 : TUNE_SAMPLE_MIN;
+    n = n > TUNE_SAMPLE_MAX ? TUNE_SAMPLE_MAX : n;
+    n = n > nframes ? nframes : n;
+
+    sample = tune_sample(opendcp, frames, nframes, n, &names);
+
+    if (!sample) {
+        return OPENDCP_ERROR;
+    }
+
+    tune_isolate(opendcp);
+
+    OPENDCP_LOG(LOG_INFO, "autotune calibrating with %d of %d frames on %d processors", n, nframes, cpus);
+
+    memset(&best, 0, sizeof(best));
+    best.threads     = cpus;
+    best.readers     = cpus / 4 > 0 ? cpus / 4 : 1;
+    best.queue_depth = cpus;
+
+    /* a storage profile of the host is kept, its readers are the first tried */
+    if (opendcp_tune_load(&stored, NULL) == OPENDCP_NO_ERROR && stored.storage_readers > 0) {
+        best.storage_readers  = stored.storage_readers;
+        best.io_buffers       = stored.io_buffers;
+        best.io_buffer_size   = stored.io_buffer_size;
+        best.direct_io        = stored.direct_io;
+        best.digest_read_size = stored.digest_read_size;
+        best.readers          = stored.storage_readers;
+    }
+
+    /* warm up, the passes after it find the same caches */
+    if (tune_pass(opendcp, sample, n, best.threads, best.readers, best.queue_depth, NULL) <= 0) {
+        OPENDCP_LOG(LOG_ERROR, "autotune could not convert the sample frames");
+        *opendcp = saved;
+        free(sample);
+        free(names);
+        return OPENDCP_ERROR;
+    }
+
+    /* a few threads over the processors cover the ones waiting on storage */
+    count = 0;
+    count = tune_candidate(candidates, count, cpus / 2);
+    count = tune_candidate(candidates, count, cpus * 3 / 4);
+    count = tune_candidate(candidates, count, cpus);
+    count = tune_candidate(candidates, count, cpus + cpus / 4);
+    tune_search(opendcp, sample, n, &best, candidates, count, TUNE_THREADS);
+
+    count = 0;
+    count = tune_candidate(candidates, count, 1);
+    count = tune_candidate(candidates, count, best.storage_readers);
+    count = tune_candidate(candidates, count, best.threads / 4);
+    count = tune_candidate(candidates, count, best.threads / 2);
+    tune_search(opendcp, sample, n, &best, candidates, count, TUNE_READERS);
+
+    count = 0;
+    count = tune_candidate(candidates, count, best.threads / 2);
+    count = tune_candidate(candidates, count, best.threads);
+    count = tune_candidate(candidates, count, best.threads * 2);
+    tune_search(opendcp, sample, n, &best, candidates, count, TUNE_QUEUE_DEPTH);
+
+    *opendcp = saved;
+    free(sample);
+    free(names);
+
+    if (best.fps <= 0) {
+        OPENDCP_LOG(LOG_ERROR, "autotune could not convert the sample frames");
+        return OPENDCP_ERROR;
+    }
+
+    OPENDCP_LOG(LOG_INFO, "autotune chose %d threads, %d readers, queues of %d: %.2f frames/s",
+                best.threads, best.readers, best.queue_depth, best.fps);
+
+    *tune = best;
+
+    return OPENDCP_NO_ERROR;
+}
+
+/*!
+ @function opendcp_estimate
+ @abstract Predicts the time and storage of a conversion from a sample of it.
+ @discussion Converts samples frames spread over the sequence through
+     convert_to_j2k_sequence, once on one thread and once on every
+     processor, like opendcp_autotune does. The codestreams are removed
+     after each pass and the options are restored afterwards.
+ @param opendcp The options of the conversion.
+ @param frames The frames of the conversion.
+ @param nframes The number of frames.
+ @param samples The number of frames to convert, 0 for the autotune sample.
+ @param estimate Receives the prediction.
+ @return OPENDCP_NO_ERROR or OPENDCP_ERROR when the sample could not be converted.
+*/
+int opendcp_estimate(opendcp_t *opendcp, j2k_frame_t *frames, int nframes, int samples, opendcp_estimate_t *estimate) {
+    opendcp_t          saved = *opendcp;
+    opendcp_metrics_t  *metrics;
+    j2k_frame_t        *sample;
+    char               *names;
+    unsigned long long bytes = 0, ns, unused;
+    double             fps1, fpsn, speedup, s;
+    int                cpus, n, p, t, i, readers;
+
+    if (nframes < 1 || samples < 0) {
+        return OPENDCP_ERROR;
+    }
+
+    opendcp_pool_init(0);
+    cpus = opendcp_pool_threads();
+
+    if (samples) {
+        n = samples;
+    } else {
+        n = cpus * 2 > TUNE_SAMPLE_MIN ? cpus * 2 : TUNE_SAMPLE_MIN;
+        n = n > TUNE_SAMPLE_MAX ? TUNE_SAMPLE_MAX : n;
+    }
+    n = n > nframes ? nframes : n;
+
+    sample = tune_sample(opendcp, frames, nframes, n, &names);
+
+    if (!sample) {
+        return OPENDCP_ERROR;
+    }
+
+    metrics = opendcp_metrics_create();
+    tune_isolate(opendcp);
+    readers = saved.j2k.readers > 0 ? saved.j2k.readers : 1;
+
+    OPENDCP_LOG(LOG_INFO, "estimate converting %d of %d frames on %d processors", n, nframes, cpus);
+
+    /* warm up on one frame, then one thread gives the cost of each stage */
+    if (!metrics || tune_pass(opendcp, sample, 1, 1, 1, 1, NULL) <= 0) {
+        fps1 = 0;
+    } else {
+        opendcp->metrics = metrics;
+        fps1 = tune_pass(opendcp, sample, n, 1, 1, 1, &bytes);
+        opendcp->metrics = NULL;
+    }
+
+    /* the same frames on every processor give the part that scales */
+    p    = cpus < n ? cpus : n;
+    fpsn = fps1;
+    if (fps1 > 0 && p > 1 && !opendcp->j2k.cancel) {
+        fpsn = tune_pass(opendcp, sample, n, p, readers, p, NULL);
+    }
+
+    *opendcp = saved;
+    free(sample);
+    free(names);
+
+    if (fps1 <= 0 || fpsn <= 0) {
+        OPENDCP_LOG(LOG_ERROR, "estimate could not convert the sample frames");
+        opendcp_metrics_delete(metrics);
+        return OPENDCP_ERROR;
+    }
+
+    memset(estimate, 0, sizeof(*estimate));
+    estimate->frames        = nframes;
+    estimate->sampled       = n;
+    estimate->frame_seconds = 1.0 / fps1;
+    estimate->frame_bytes   = (double)bytes / n;
+
+    for (i = 0; i < METRIC_STAGES; i++) {
+        unsigned long long count = opendcp_metrics_totals(metrics, i, &ns, &unused);
+        estimate->stage_ms[i] = count ? ns / 1e6 / count : 0;
+    }
+    opendcp_metrics_delete(metrics);
+
+    /* amdahl, a speedup of 1 / (s + (1 - s) / p) on p threads solved for s */
+    s = 0;
+    if (p > 1) {
+        speedup = fpsn / fps1;
+        s = (p / speedup - 1) / (p - 1);
+        s = s < 0 ? 0 : (s > 1 ? 1 : s);
+    }
+    estimate->serial = s;
+
+    for (t = 1; estimate->counts < ESTIMATE_THREAD_COUNTS; t *= 2) {
+        if (t >= cpus) {
+            t = cpus;
+        }
+        estimate->threads[estimate->counts] = t;
+        estimate->seconds[estimate->counts] = nframes / (fps1 / (s + (1 - s) / t));
+        estimate->counts++;
+        if (t == cpus) {
+            break;
+        }
+    }
+
+    estimate->codestream_bytes = (unsigned long long)(estimate->frame_bytes * nframes);
+    estimate->mxf_bytes        = estimate->codestream_bytes + ESTIMATE_HEADER_OVERHEAD +
+                                 (unsigned long long)nframes * (ESTIMATE_FRAME_OVERHEAD +
+                                 (saved.mxf.key_flag ? ESTIMATE_CRYPTO_OVERHEAD : 0));
+
+    OPENDCP_LOG(LOG_INFO, "estimate %.2f frames/s on one thread, %.2f on %d, %.0f%% serial",
+                fps1, fpsn, p, s * 100);
+
+    return OPENDCP_NO_ERROR;
+}
@@ -0,0 +1,740 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <dirent.h>
+#include <pthread.h>
+#ifdef _WIN32
+#include <direct.h>
+#define dcp_mkdir(dir) _mkdir(dir)
+#else
+#define dcp_mkdir(dir) mkdir(dir, 0777)
+#endif
+
+#include <libxml/tree.h>
+#include <libxml/parser.h>
+
+#include "opendcp.h"
+
+#define STRUCTURE_THREADS_DEFAULT 4
+
+/* an asset listed in a packing list */
+typedef struct {
+    char      uuid[40];
+    char      hash[40];
+    long long size;
+    int       mxf;
+    char      path[MAX_PATH_LENGTH];
+} dcp_verify_asset_t;
+
+typedef struct {
+    char uuid[40];
+    char path[MAX_PATH_LENGTH];
+    int  packing_list;
+} dcp_verify_entry_t;
+
+static xmlNodePtr dcp_verify_child(xmlNodePtr node, const char *name) {
+    for (node = node ? node->children : NULL; node; node = node->next) {
+        if (node->type == XML_ELEMENT_NODE && !strcmp((const char *)node->name, name)) {
+            return node;
+        }
+    }
+
+    return NULL;
+}
+
+/* copy the text of a child element, trimmed, returns 0 if it is missing */
+static int dcp_verify_text(xmlNodePtr node, const char *name, char *out, size_t len) {
+    xmlChar *text;
+    char    *s;
+    size_t  n;
+
+    node = dcp_verify_child(node, name);
+
+    if (!node || !(text = xmlNodeGetContent(node))) {
+        out[0] = '\0';
+        return 0;
+    }
+
+    for (s = (char *)text; *s == ' ' || *s == '\t' || *s == '\r' || *s == '\n'; s++);
+
+    snprintf(out, len, "%s", s);
+
+    for (n = strlen(out); n && strchr(" \t\r\n", out[n - 1]); n--) {
+        out[n - 1] = '\0';
+    }
+
+    xmlFree(text);
+
+    return 1;
+}
+
+/* strip a urn:uuid: prefix so ids from the assetmap and the pkl compare */
+static const char *dcp_verify_uuid(const char *id) {
+    return strncmp(id, "urn:uuid:", 9) ? id : id + 9;
+}
+
+/* read the assetmap, returns the number of entries or -1 */
+static int dcp_verify_read_assetmap(const char *dcp_path, dcp_verify_entry_t **entries) {
+    char               filename[MAX_PATH_LENGTH];
+    char               value[MAX_PATH_LENGTH];
+    const char         *path;
+    xmlDocPtr          doc;
+    xmlNodePtr         node;
+    dcp_verify_entry_t *list = NULL;
+    int                count = 0;
+
+    snprintf(filename, sizeof(filename), "%s/ASSETMAP.xml", dcp_path);
+    doc = xmlParseFile(filename);
+
+    if (!doc) {
+        snprintf(filename, sizeof(filename), "%s/ASSETMAP", dcp_path);
+        doc = xmlParseFile(filename);
+    }
+
+    if (!doc) {
+        OPENDCP_LOG(LOG_ERROR, "could not read the assetmap in %s", dcp_path);
+        return -1;
+    }
+
+    node = dcp_verify_child(dcp_verify_child((xmlNodePtr)doc, "AssetMap"), "AssetList");
+
+    for (node = node ? node->children : NULL; node; node = node->next) {
+        dcp_verify_entry_t *entry;
+
+        if (node->type != XML_ELEMENT_NODE || strcmp((const char *)node->name, "Asset")) {
+            continue;
+        }
+
+        entry = realloc(list, (count + 1) * sizeof(dcp_verify_entry_t));
+
+        if (!entry) {
+            free(list);
+            xmlFreeDoc(doc);
+            return -1;
+        }
+
+        list  = entry;
+        entry = &list[count++];
+        memset(entry, 0, sizeof(*entry));
+
+        dcp_verify_text(node, "Id", value, sizeof(value));
+        snprintf(entry->uuid, sizeof(entry->uuid), "%s", dcp_verify_uuid(value));
+
+        dcp_verify_text(node, "PackingList", value, sizeof(value));
+        entry->packing_list = !strcmp(value, "true") || !strcmp(value, "1");
+
+        dcp_verify_text(dcp_verify_child(dcp_verify_child(node, "ChunkList"), "Chunk"), "Path", value, sizeof(value));
+        path = strncmp(value, "file://", 7) ? value : value + 7;
+        snprintf(entry->path, sizeof(entry->path), "%s/%s", dcp_path, path);
+    }
+
+    xmlFreeDoc(doc);
+    *entries = list;
+
+    return count;
+}
+
+/* add the assets of a packing list, returns OPENDCP_NO_ERROR on success */
+static int dcp_verify_read_pkl(const char *filename, dcp_verify_entry_t *entries, int nentries,
+                               dcp_verify_asset_t **assets, int *count) {
+    char               value[64];
+    xmlDocPtr          doc;
+    xmlNodePtr         node;
+    dcp_verify_asset_t *asset;
+    int                i;
+
+    doc = xmlParseFile(filename);
+
+    if (!doc) {
+        OPENDCP_LOG(LOG_ERROR, "could not read packing list %s", filename);
+        return OPENDCP_ERROR;
+    }
+
+    node = dcp_verify_child(dcp_verify_child((xmlNodePtr)doc, "PackingList"), "AssetList");
+
+    if (!node) {
+        OPENDCP_LOG(LOG_ERROR, "%s is not a packing list", filename);
+        xmlFreeDoc(doc);
+        return OPENDCP_ERROR;
+    }
+
+    for (node = node->children; node; node = node->next) {
+        if (node->type != XML_ELEMENT_NODE || strcmp((const char *)node->name, "Asset")) {
+            continue;
+        }
+
+        asset = realloc(*assets, (*count + 1) * sizeof(dcp_verify_asset_t));
+
+        if (!asset) {
+            xmlFreeDoc(doc);
+            return OPENDCP_ERROR;
+        }
+
+        *assets = asset;
+        asset   = &asset[(*count)++];
+        memset(asset, 0, sizeof(*asset));
+
+        dcp_verify_text(node, "Id", value, sizeof(value));
+        snprintf(asset->uuid, sizeof(asset->uuid), "%s", dcp_verify_uuid(value));
+        dcp_verify_text(node, "Hash", asset->hash, sizeof(asset->hash));
+        dcp_verify_text(node, "Size", value, sizeof(value));
+        asset->size = atoll(value);
+        dcp_verify_text(node, "Type", value, sizeof(value));
+        asset->mxf = strstr(value, "mxf") != NULL;
+
+        for (i = 0; i < nentries; i++) {
+            if (!strcmp(entries[i].uuid, asset->uuid)) {
+                snprintf(asset->path, sizeof(asset->path), "%s", entries[i].path);
+                break;
+            }
+        }
+    }
+
+    xmlFreeDoc(doc);
+
+    return OPENDCP_NO_ERROR;
+}
+
+static int dcp_verify_cb(void *p) {
+    UNUSED(p);
+
+    return 0;
+}
+
+/* the base64 form of a SHA-1, as packing lists hold it */
+static void dcp_verify_base64(const unsigned char *sha1, char *out) {
+    static const char *b64 = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    unsigned int      v;
+    int               i, j = 0;
+
+    for (i = 0; i < 21; i += 3) {
+        v = sha1[i] << 16 | (i + 1 < 20 ? sha1[i + 1] << 8 : 0) | (i + 2 < 20 ? sha1[i + 2] : 0);
+
+        out[j++] = b64[v >> 18 & 63];
+        out[j++] = b64[v >> 12 & 63];
+        out[j++] = i + 1 < 20 ? b64[v >> 6 & 63] : '=';
+        out[j++] = i + 2 < 20 ? b64[v & 63] : '=';
+    }
+
+    out[j] = '\0';
+}
+
+/* add the assets of every packing list of a DCP */
+static int dcp_verify_read(const char *dcp_path, dcp_verify_asset_t **assets, int *nassets) {
+    dcp_verify_entry_t *entries = NULL;
+    int                nentries, npkl = 0, i;
+    int                result = OPENDCP_NO_ERROR;
+
+    nentries = dcp_verify_read_assetmap(dcp_path, &entries);
+
+    if (nentries < 0) {
+        return OPENDCP_FILEOPEN;
+    }
+
+    for (i = 0; i < nentries && result == OPENDCP_NO_ERROR; i++) {
+        if (entries[i].packing_list) {
+            result = dcp_verify_read_pkl(entries[i].path, entries, nentries, assets, nassets);
+            npkl++;
+        }
+    }
+
+    if (result == OPENDCP_NO_ERROR && !npkl) {
+        OPENDCP_LOG(LOG_ERROR, "assetmap of %s does not list a packing list", dcp_path);
+        result = OPENDCP_ERROR;
+    }
+
+    free(entries);
+
+    return result;
+}
+
+/* check the assets of several DCPs at once, so copies on different devices are read in parallel */
+static int dcp_verify_paths(opendcp_t *opendcp, const char **dcp_paths, int npaths) {
+    dcp_verify_asset_t *assets = NULL;
+    asset_t            *digests = NULL;
+    asset_t            **digest_ptr = NULL;
+    opendcp_cb_t       sha1_update, sha1_done;
+    struct stat        st;
+    struct timeval     start, end;
+    long long          bytes = 0;
+    double             seconds;
+    int                nassets = 0;
+    int                ndigests = 0, bad = 0;
+    int                digest_verify;
+    int                result = OPENDCP_NO_ERROR;
+    int                i, j;
+
+    for (i = 0; i < npaths && result == OPENDCP_NO_ERROR; i++) {
+        result = dcp_verify_read(dcp_paths[i], &assets, &nassets);
+    }
+
+    if (result == OPENDCP_NO_ERROR && nassets) {
+        digests    = calloc(nassets, sizeof(asset_t));
+        digest_ptr = calloc(nassets, sizeof(asset_t *));
+
+        if (!digests || !digest_ptr) {
+            result = OPENDCP_ERROR;
+        }
+    }
+
+    /* files that can not be hashed are reported up front */
+    for (i = 0; i < nassets && result == OPENDCP_NO_ERROR; i++) {
+        if (!assets[i].path[0]) {
+            OPENDCP_LOG(LOG_ERROR, "asset %s is not in the assetmap", assets[i].uuid);
+            bad++;
+        }
+        else if (stat(assets[i].path, &st)) {
+            OPENDCP_LOG(LOG_ERROR, "asset %s is missing", assets[i].path);
+            bad++;
+        }
+        else if ((long long)st.st_size != assets[i].size) {
+            OPENDCP_LOG(LOG_ERROR, "asset %s is %lld bytes, the packing list has %lld",
+                        assets[i].path, (long long)st.st_size, assets[i].size);
+            bad++;
+        }
+        else {
+            snprintf(digests[ndigests].filename, sizeof(digests[ndigests].filename), "%s", assets[i].path);
+            digest_ptr[ndigests] = &digests[ndigests];
+            ndigests++;
+            bytes += assets[i].size;
+        }
+    }
+
+    if (result == OPENDCP_NO_ERROR && ndigests) {
+        sha1_update   = opendcp->dcp.sha1_update;
+        sha1_done     = opendcp->dcp.sha1_done;
+        digest_verify = opendcp->dcp.digest_verify;
+
+        if (!sha1_update.callback) {
+            opendcp->dcp.sha1_update.callback = dcp_verify_cb;
+        }
+
+        if (!sha1_done.callback) {
+            opendcp->dcp.sha1_done.callback = dcp_verify_cb;
+        }
+
+        opendcp->dcp.digest_verify = 1;
+
+        gettimeofday(&start, NULL);
+        result = calculate_digests(opendcp, digest_ptr, ndigests);
+        gettimeofday(&end, NULL);
+
+        opendcp->dcp.sha1_update   = sha1_update;
+        opendcp->dcp.sha1_done     = sha1_done;
+        opendcp->dcp.digest_verify = digest_verify;
+
+        seconds = (end.tv_sec - start.tv_sec) + (end.tv_usec - start.tv_usec) / 1000000.0;
+
+        if (seconds > 0) {
+            OPENDCP_LOG(LOG_INFO, "hashed %d assets, %.1f MB in %.2f seconds (%.1f MB/s)",
+                        ndigests, bytes / 1048576.0, seconds, bytes / 1048576.0 / seconds);
+        }
+    }
+
+    for (i = 0, j = 0; i < nassets && result == OPENDCP_NO_ERROR; i++) {
+        if (j < ndigests && !strcmp(assets[i].path, digests[j].filename)) {
+            if (strcmp(assets[i].hash, digests[j].digest)) {
+                OPENDCP_LOG(LOG_ERROR, "asset %s hash is %s, the packing list has %s",
+                            assets[i].path, digests[j].digest, assets[i].hash);
+                bad++;
+            }
+            else {
+                OPENDCP_LOG(LOG_DEBUG, "asset %s is valid", assets[i].path);
+            }
+
+            j++;
+        }
+    }
+
+    if (result == OPENDCP_NO_ERROR && bad) {
+        result = OPENDCP_VERIFY_DCP;
+    }
+
+    free(digest_ptr);
+    free(digests);
+    free(assets);
+
+    return result;
+}
+
+/*!
+ @function dcp_verify
+ @abstract Check every asset of a DCP against the hashes in its packing lists.
+ @discussion The assetmap in dcp_path is read to find the packing lists and
+     the files of the assets they list. Every asset is read again and hashed
+     with calculate_digests, so dcp.digest_threads and
+     dcp.digest_io_per_device set how many files are hashed at once overall
+     and per device. Cached digests are never used. Each missing, short or
+     mismatched asset is logged, followed by the read throughput.
+ @param opendcp The opendcp context.
+ @param dcp_path The directory holding the assetmap.
+ @return OPENDCP_NO_ERROR if every asset matches, OPENDCP_VERIFY_DCP if one
+     does not, otherwise the error that stopped the check.
+*/
+int dcp_verify(opendcp_t *opendcp, const char *dcp_path) {
+    return dcp_verify_paths(opendcp, &dcp_path, 1);
+}
+
+/* the MXF assets shared by the structure threads, each takes the next unchecked one */
+typedef struct {
+    opendcp_t          *opendcp;
+    dcp_verify_asset_t *assets;
+    int                nassets;
+    int                next;
+    int                bad;
+    int                result;
+    pthread_mutex_t    mutex;
+} dcp_structure_t;
+
+static void *dcp_structure_thread(void *arg) {
+    dcp_structure_t *s = arg;
+    int             i, result;
+
+    while (1) {
+        pthread_mutex_lock(&s->mutex);
+
+        while (s->next < s->nassets && (!s->assets[s->next].mxf || !s->assets[s->next].path[0])) {
+            s->next++;
+        }
+
+        i = s->next++;
+        pthread_mutex_unlock(&s->mutex);
+
+        if (i >= s->nassets) {
+            break;
+        }
+
+        result = verify_mxf_structure(s->opendcp, s->assets[i].path);
+
+        pthread_mutex_lock(&s->mutex);
+
+        if (result == OPENDCP_VERIFY_MXF_STRUCTURE) {
+            s->bad++;
+        }
+        else if (result != OPENDCP_NO_ERROR) {
+            s->result = result;
+        }
+        else {
+            OPENDCP_LOG(LOG_DEBUG, "asset %s is structurally sound", s->assets[i].path);
+        }
+
+        pthread_mutex_unlock(&s->mutex);
+    }
+
+    return NULL;
+}
+
+/*!
+ @function dcp_verify_structure
+ @abstract Check the structure of every MXF asset of a DCP.
+ @discussion The packing lists are read as in dcp_verify and each MXF asset
+     they list is checked with verify_mxf_structure, which reads only packet
+     keys and lengths, the partitions and the index. dcp.digest_threads
+     assets are checked at once. Nothing is hashed, so this is a quick check
+     before delivery rather than a replacement for dcp_verify.
+ @param opendcp The opendcp context.
+ @param dcp_path The directory holding the assetmap.
+ @return OPENDCP_NO_ERROR if every MXF asset is sound, OPENDCP_VERIFY_DCP if
+     one is not, otherwise the error that stopped the check.
+*/
+int dcp_verify_structure(opendcp_t *opendcp, const char *dcp_path) {
+    dcp_structure_t s;
+    pthread_t       *threads;
+    int             nthreads, started, i;
+
+    memset(&s, 0, sizeof(s));
+    s.opendcp = opendcp;
+    s.result  = dcp_verify_read(dcp_path, &s.assets, &s.nassets);
+
+    for (i = 0; i < s.nassets && s.result == OPENDCP_NO_ERROR; i++) {
+        if (s.assets[i].mxf && !s.assets[i].path[0]) {
+            OPENDCP_LOG(LOG_ERROR, "asset %s is not in the assetmap", s.assets[i].uuid);
+            s.bad++;
+        }
+    }
+
+    if (s.result != OPENDCP_NO_ERROR) {
+        free(s.assets);
+        return s.result;
+    }
+
+    nthreads = opendcp->dcp.digest_threads > 0 ? opendcp->dcp.digest_threads : STRUCTURE_THREADS_DEFAULT;
+    threads  = malloc((nthreads - 1) * sizeof(pthread_t) + 1);
+    started  = 0;
+    pthread_mutex_init(&s.mutex, NULL);
+
+    /* this thread is the last one, and runs alone if none can be started */
+    while (threads && started < nthreads - 1 && !pthread_create(&threads[started], NULL, dcp_structure_thread, &s)) {
+        started++;
+    }
+
+    dcp_structure_thread(&s);
+
+    for (i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    pthread_mutex_destroy(&s.mutex);
+    free(threads);
+    free(s.assets);
+
+    if (s.result == OPENDCP_NO_ERROR && s.bad) {
+        return OPENDCP_VERIFY_DCP;
+    }
+
+    return s.result;
+}
+
+/* a file of the DCP being duplicated, relative to the DCP */
+typedef struct {
+    char path[MAX_PATH_LENGTH];
+} dcp_duplicate_file_t;
+
+/* list the files below dir and create its directories in every target */
+static int dcp_duplicate_walk(const char *root, const char *dir, const char **targets, int ntargets,
+                              dcp_duplicate_file_t **files, int *nfiles) {
+    char                 path[MAX_PATH_LENGTH];
+    char                 relative[MAX_PATH_LENGTH];
+    struct dirent        *entry;
+    struct stat          st;
+    dcp_duplicate_file_t *file;
+    DIR                  *d;
+    int                  i, result = OPENDCP_NO_ERROR;
+
+    snprintf(path, sizeof(path), "%s%s%s", root, dir[0] ? "/" : "", dir);
+
+    if (!(d = opendir(path))) {
+        OPENDCP_LOG(LOG_ERROR, "could not open directory %s", path);
+        return OPENDCP_FILEOPEN;
+    }
+
+    while (result == OPENDCP_NO_ERROR && (entry = readdir(d))) {
+        if (!strcmp(entry->d_name, ".") || !strcmp(entry->d_name, "..")) {
+            continue;
+        }
+
+        snprintf(relative, sizeof(relative), "%s%s%s", dir, dir[0] ? "/" : "", entry->d_name);
+        snprintf(path, sizeof(path), "%s/%s", root, relative);
+
+        if (stat(path, &st)) {
+            continue;
+        }
+
+        if (S_ISDIR(st.st_mode)) {
+            for (i = 0; i < ntargets; i++) {
+                snprintf(path, sizeof(path), "%s/%s", targets[i], relative);
+                dcp_mkdir(path);
+            }
+
+            result = dcp_duplicate_walk(root, relative, targets, ntargets, files, nfiles);
+        }
+        else if (S_ISREG(st.st_mode)) {
+            file = realloc(*files, (*nfiles + 1) * sizeof(dcp_duplicate_file_t));
+
+            if (!file) {
+                result = OPENDCP_ERROR;
+                break;
+            }
+
+            *files = file;
+            snprintf(file[(*nfiles)++].path, sizeof(file->path), "%s", relative);
+        }
+    }
+
+    closedir(d);
+
+    return result;
+}
+
+/*!
+ @function dcp_duplicate
+ @abstract Copies a DCP to several volumes, reading it once.
+ @discussion Each file is read once and written to every target at the same
+     time by a thread per target, see opendcp_copy_file_fanout. The assets
+     listed in the packing lists are hashed as they are read and checked
+     against them, so a bad read of the source is caught without a second
+     pass. A target that fails is dropped and the others carry on. With
+     verify set the finished copies are read back and checked against
+     their packing lists, all targets at once through dcp_verify.
+ @param opendcp The opendcp context.
+ @param dcp_path The directory holding the assetmap.
+ @param targets The directories to copy the DCP into, created if needed.
+ @param ntargets The number of targets.
+ @param verify Read the copies back and check them.
+ @return OPENDCP_NO_ERROR if every target holds a good copy, OPENDCP_VERIFY_DCP
+     if the source or a copy does not match its packing list, otherwise the
+     error of the first target that failed.
+*/
+int dcp_duplicate(opendcp_t *opendcp, const char *dcp_path, const char **targets, int ntargets, int verify) {
+    dcp_verify_asset_t   *assets = NULL;
+    dcp_duplicate_file_t *files = NULL;
+    const char           **destinations = NULL, **good = NULL;
+    char                 **paths = NULL;
+    char                 source[MAX_PATH_LENGTH];
+    char                 digest[40];
+    unsigned char        sha1[20];
+    struct timeval       start, end;
+    long long            bytes = 0;
+    double               seconds;
+    int                  *results = NULL, *failed = NULL;
+    int                  nassets = 0, nfiles = 0, ngood, bad = 0;
+    int                  i, j, n, rc, result;
+
+    if (ntargets < 1) {
+        return OPENDCP_ERROR;
+    }
+
+    result = dcp_verify_read(dcp_path, &assets, &nassets);
+
+    for (i = 0; i < ntargets && result == OPENDCP_NO_ERROR; i++) {
+        dcp_mkdir(targets[i]);
+    }
+
+    if (result == OPENDCP_NO_ERROR) {
+        result = dcp_duplicate_walk(dcp_path, "", targets, ntargets, &files, &nfiles);
+    }
+
+    destinations = calloc(ntargets, sizeof(char *));
+    good         = calloc(ntargets, sizeof(char *));
+    paths        = calloc(ntargets, sizeof(char *));
+    results      = calloc(ntargets, sizeof(int));
+    failed       = calloc(ntargets, sizeof(int));
+
+    for (i = 0; paths && i < ntargets; i++) {
+        if (!(paths[i] = malloc(MAX_PATH_LENGTH))) {
+            result = OPENDCP_ERROR;
+        }
+    }
+
+    if (!destinations || !good || !paths || !results || !failed) {
+        result = OPENDCP_ERROR;
+    }
+
+    gettimeofday(&start, NULL);
+
+    for (i = 0; i < nfiles && result == OPENDCP_NO_ERROR; i++) {
+        dcp_verify_asset_t *asset = NULL;
+        struct stat        st;
+
+        snprintf(source, sizeof(source), "%s/%s", dcp_path, files[i].path);
+
+        for (j = 0; j < nassets; j++) {
+            if (!strcmp(assets[j].path, source)) {
+                asset = &assets[j];
+                break;
+            }
+        }
+
+        for (j = 0, n = 0; j < ntargets; j++) {
+            if (!failed[j]) {
+                snprintf(paths[j], MAX_PATH_LENGTH, "%s/%s", targets[j], files[i].path);
+                destinations[n++] = paths[j];
+            }
+        }
+
+        if (!n) {
+            break;
+        }
+
+        OPENDCP_LOG(LOG_INFO, "copying %s to %d target%s", files[i].path, n, n > 1 ? "s" : "");
+
+        rc = opendcp_copy_file_fanout(source, destinations, n, results, asset ? sha1 : NULL, NULL, NULL);
+
+        /* the source could not be read, no target can be complete */
+        if (rc == OPENDCP_FILEOPEN || rc == OPENDCP_COPY_CANCELLED) {
+            result = rc;
+            break;
+        }
+
+        for (j = 0, n = 0; j < ntargets; j++) {
+            if (failed[j]) {
+                continue;
+            }
+
+            if (results[n++] != OPENDCP_NO_ERROR) {
+                OPENDCP_LOG(LOG_ERROR, "could not write %s, dropping target %s", files[i].path, targets[j]);
+                failed[j] = results[n - 1];
+            }
+        }
+
+        if (!stat(source, &st)) {
+            bytes += st.st_size;
+        }
+
+        if (asset) {
+            dcp_verify_base64(sha1, digest);
+
+            if (strcmp(digest, asset->hash)) {
+                OPENDCP_LOG(LOG_ERROR, "source asset %s hash is %s, the packing list has %s", source, digest, asset->hash);
+                bad++;
+            }
+        }
+    }
+
+    gettimeofday(&end, NULL);
+    seconds = (end.tv_sec - start.tv_sec) + (end.tv_usec - start.tv_usec) / 1000000.0;
+
+    if (result == OPENDCP_NO_ERROR && seconds > 0) {
+        OPENDCP_LOG(LOG_INFO, "read %.1f MB once for %d targets in %.2f seconds (%.1f MB/s)",
+                    bytes / 1048576.0, ntargets, seconds, bytes / 1048576.0 / seconds);
+    }
+
+    for (i = 0, ngood = 0; i < ntargets && result == OPENDCP_NO_ERROR; i++) {
+        if (!failed[i]) {
+            good[ngood++] = targets[i];
+        }
+    }
+
+    if (result == OPENDCP_NO_ERROR && verify && ngood && !bad) {
+        rc = dcp_verify_paths(opendcp, good, ngood);
+
+        if (rc != OPENDCP_NO_ERROR) {
+            result = rc;
+        }
+    }
+
+    for (i = 0; i < ntargets && result == OPENDCP_NO_ERROR; i++) {
+        if (failed[i]) {
+            result = failed[i];
+        }
+    }
+
+    if (result == OPENDCP_NO_ERROR && bad) {
+        result = OPENDCP_VERIFY_DCP;
+    }
+
+    for (i = 0; paths && i < ntargets; i++) {
+        free(paths[i]);
+    }
+
+    free(paths);
+    free(failed);
+    free(results);
+    free(good);
+    free(destinations);
+    free(files);
+    free(assets);
+
+    return result;
+}
@@ -0,0 +1,400 @@
+/*
+    OpenDCP: Builds Digital Cinema Packages
+    Copyright (c) 2010-2014 Terrence Meiczinger, All Rights Reserved
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#endif
+#if defined(__linux__)
+#include <sys/inotify.h>
+#define WATCH_INOTIFY
+#elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__)
+#include <sys/event.h>
+#define WATCH_KQUEUE
+#endif
+#include "opendcp.h"
+
+/*
+   A hot folder watch. The directory is watched with inotify on Linux,
+   kqueue on macOS and the BSDs and a change notification on Windows, so
+   a wait ends as soon as something lands instead of at the next poll.
+   A file is complete once its writer closed or renamed it into place,
+   which only inotify reports, or once its size and modification time
+   have not changed for the settle time. The latter also covers writers
+   on other hosts of a network share, whose writes raise no local events.
+*/
+#define WATCH_BUCKETS 4096
+
+/* files not modified for this many seconds when first seen were rendered before the watch */
+#define WATCH_OLD 60
+
+typedef struct watch_file_s {
+    struct watch_file_s *next;
+    long long           size;
+    time_t              mtime;
+    unsigned long long  changed;   /* when the size or mtime last changed */
+    int                 closed;    /* the writer closed the file */
+    int                 taken;
+    char                name[1];
+} watch_file_t;
+
+struct opendcp_watch_s {
+    char         *dir;
+    int          settle_ms;
+    watch_file_t *files[WATCH_BUCKETS];
+#if defined(WATCH_INOTIFY)
+    int          fd;
+#elif defined(WATCH_KQUEUE)
+    int          kq;
+    int          dir_fd;
+#elif defined(_WIN32)
+    HANDLE       change;
+#endif
+};
+
+static const char *watch_basename(const char *file) {
+    const char *p = strrchr(file, '/');
+
+#ifdef _WIN32
+    const char *q = strrchr(file, '\\');
+
+    if (q && (!p || q > p)) {
+        p = q;
+    }
+#endif
+
+    return p ? p + 1 : file;
+}
+
+static unsigned int watch_hash(const char *name) {
+    unsigned int h = 5381;
+
+    while (*name) {
+        h = h * 33 + (unsigned char)*name++;
+    }
+
+    return h % WATCH_BUCKETS;
+}
+
+/* the entry of a file, added when it is first seen */
+static watch_file_t *watch_file(opendcp_watch_t *watch, const char *name, int *added) {
+    unsigned int h = watch_hash(name);
+    watch_file_t *f;
+
+    *added = 0;
+
+    for (f = watch->files[h]; f; f = f->next) {
+        if (!strcmp(f->name, name)) {
+            return f;
+        }
+    }
+
+    f = calloc(1, sizeof(watch_file_t) + strlen(name));
+
+    if (!f) {
+        return NULL;
+    }
+
+    strcpy(f->name, name);
+    f->size         = -1;
+    f->next         = watch->files[h];
+    watch->files[h] = f;
+    *added          = 1;
+
+    return f;
+}
+
+static void watch_sleep(int ms) {
+#ifdef _WIN32
+    Sleep(ms);
+#else
+    poll(NULL, 0, ms);
+#endif
+}
+
+/*!
+ @function opendcp_watch_open
+ @abstract Starts watching a directory for files that are being written.
+ @discussion Where the platform has no directory notification, or it can
+             not be set up, waits fall back to polling.
+ @param dir The directory.
+ @param settle_ms How long a file must keep its size and modification
+                  time before it counts as complete.
+ @return The watch, or NULL on failure.
+*/
+opendcp_watch_t *opendcp_watch_open(const char *dir, int settle_ms) {
+    opendcp_watch_t *watch = calloc(1, sizeof(opendcp_watch_t));
+
+    if (!watch) {
+        return NULL;
+    }
+
+    watch->dir       = strdup(dir);
+    watch->settle_ms = settle_ms;
+
+    if (!watch->dir) {
+        free(watch);
+        return NULL;
+    }
+
+#if defined(WATCH_INOTIFY)
+    watch->fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+    if (watch->fd != -1 && inotify_add_watch(watch->fd, dir, IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE) == -1) {
+        close(watch->fd);
+        watch->fd = -1;
+    }
+
+    if (watch->fd == -1) {
+        OPENDCP_LOG(LOG_WARN, "could not watch %s, polling it instead", dir);
+    }
+#elif defined(WATCH_KQUEUE)
+    watch->kq     = kqueue();
+#ifdef O_EVTONLY
+    watch->dir_fd = open(dir, O_EVTONLY);
+#else
+    watch->dir_fd = open(dir, O_RDONLY);
+#endif
+
+    if (watch->kq != -1 && watch->dir_fd != -1) {
+        struct kevent change;
+
+        EV_SET(&change, watch->dir_fd, EVFILT_VNODE, EV_ADD | EV_CLEAR, NOTE_WRITE | NOTE_EXTEND, 0, NULL);
+
+        if (kevent(watch->kq, &change, 1, NULL, 0, NULL) == -1) {
+            close(watch->kq);
+            watch->kq = -1;
+        }
+    }
+
+    if (watch->kq == -1 || watch->dir_fd == -1) {
+        OPENDCP_LOG(LOG_WARN, "could not watch %s, polling it instead", dir);
+    }
+#elif defined(_WIN32)
+    watch->change = FindFirstChangeNotificationA(dir, FALSE, FILE_NOTIFY_CHANGE_FILE_NAME |
+                                                 FILE_NOTIFY_CHANGE_SIZE | FILE_NOTIFY_CHANGE_LAST_WRITE);
+
+    if (watch->change == INVALID_HANDLE_VALUE) {
+        OPENDCP_LOG(LOG_WARN, "could not watch %s, polling it instead", dir);
+    }
+#endif
+
+    return watch;
+}
+
+/*!
+ @function opendcp_watch_wait
+ @abstract Waits until the directory changes.
+ @discussion Rescan the directory after the wait. A change does not say
+             that a file is complete, see opendcp_watch_state.
+ @param watch The watch.
+ @param timeout_ms The longest wait.
+ @return 1 if the directory changed, 0 on a timeout or when polling.
+*/
+int opendcp_watch_wait(opendcp_watch_t *watch, int timeout_ms) {
+#if defined(WATCH_INOTIFY)
+    char          buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+    struct pollfd pfd;
+    ssize_t       length;
+    char          *p;
+    int           added, changed = 0;
+
+    if (watch->fd == -1) {
+        watch_sleep(timeout_ms);
+        return 0;
+    }
+
+    pfd.fd     = watch->fd;
+    pfd.events = POLLIN;
+
+    if (poll(&pfd, 1, timeout_ms) <= 0) {
+        return 0;
+    }
+
+    while ((length = read(watch->fd, buffer, sizeof(buffer))) > 0) {
+        for (p = buffer; p < buffer + length; p += sizeof(struct inotify_event) + ((struct inotify_event *)p)->len) {
+            struct inotify_event *event = (struct inotify_event *)p;
+            watch_file_t         *f;
+
+            changed = 1;
+
+            if (!event->len || (event->mask & IN_ISDIR)) {
+                continue;
+            }
+
+            f = watch_file(watch, event->name, &added);
+
+            if (f) {
+                /* a new file of the same name is written again */
+                f->closed = !(event->mask & IN_CREATE);
+            }
+        }
+    }
+
+    return changed;
+#elif defined(WATCH_KQUEUE)
+    struct kevent   event;
+    struct timespec ts;
+
+    if (watch->kq == -1 || watch->dir_fd == -1) {
+        watch_sleep(timeout_ms);
+        return 0;
+    }
+
+    ts.tv_sec  = timeout_ms / 1000;
+    ts.tv_nsec = (timeout_ms % 1000) * 1000000L;
+
+    return kevent(watch->kq, NULL, 0, &event, 1, &ts) > 0;
+#elif defined(_WIN32)
+    if (watch->change == INVALID_HANDLE_VALUE) {
+        watch_sleep(timeout_ms);
+        return 0;
+    }
+
+    if (WaitForSingleObject(watch->change, timeout_ms) != WAIT_OBJECT_0) {
+        return 0;
+    }
+
+    FindNextChangeNotification(watch->change);
+
+    return 1;
+#else
+    watch_sleep(timeout_ms);
+
+    return 0;
+#endif
+}
+
+/*!
+ @function opendcp_watch_state
+ @abstract Tells whether a file of the watched directory is complete.
+ @discussion Call it on every scan of the directory, the settle time is
+             measured between the calls that see the same size.
+ @param watch The watch.
+ @param file The file, a path in the watched directory.
+ @return OPENDCP_WATCH_PENDING, OPENDCP_WATCH_READY or OPENDCP_WATCH_TAKEN.
+*/
+int opendcp_watch_state(opendcp_watch_t *watch, const char *file) {
+    unsigned long long now = opendcp_metrics_now();
+    watch_file_t       *f;
+    struct stat        st;
+    int                added;
+
+    f = watch_file(watch, watch_basename(file), &added);
+
+    if (!f) {
+        return OPENDCP_WATCH_PENDING;
+    }
+
+    if (f->taken) {
+        return OPENDCP_WATCH_TAKEN;
+    }
+
+    if (stat(file, &st) != 0 || !S_ISREG(st.st_mode)) {
+        return OPENDCP_WATCH_PENDING;
+    }
+
+    if (f->size != (long long)st.st_size || f->mtime != st.st_mtime) {
+        f->size    = st.st_size;
+        f->mtime   = st.st_mtime;
+        f->changed = now;
+
+        /* rendered before the watch started */
+        if (added && time(NULL) - st.st_mtime > WATCH_OLD) {
+            f->closed = 1;
+        }
+    }
+
+    if (f->size <= 0) {
+        return OPENDCP_WATCH_PENDING;
+    }
+
+    if (f->closed || now - f->changed >= (unsigned long long)watch->settle_ms * 1000000ULL) {
+        return OPENDCP_WATCH_READY;
+    }
+
+    return OPENDCP_WATCH_PENDING;
+}
+
+/*!
+ @function opendcp_watch_take
+ @abstract Marks a file as taken, later states of it are OPENDCP_WATCH_TAKEN.
+ @param watch The watch.
+ @param file The file, a path in the watched directory.
+*/
+void opendcp_watch_take(opendcp_watch_t *watch, const char *file) {
+    watch_file_t *f;
+    int          added;
+
+    f = watch_file(watch, watch_basename(file), &added);
+
+    if (f) {
+        f->taken = 1;
+    }
+}
+
+/*!
+ @function opendcp_watch_close
+ @abstract Stops watching and frees the watch.
+ @param watch The watch.
+*/
+void opendcp_watch_close(opendcp_watch_t *watch) {
+    watch_file_t *f, *next;
+    int          i;
+
+    if (!watch) {
+        return;
+    }
+
+#if defined(WATCH_INOTIFY)
+    if (watch->fd != -1) {
+        close(watch->fd);
+    }
+#elif defined(WATCH_KQUEUE)
+    if (watch->kq != -1) {
+        close(watch->kq);
+    }
+
+    if (watch->dir_fd != -1) {
+        close(watch->dir_fd);
+    }
+#elif defined(_WIN32)
+    if (watch->change != INVALID_HANDLE_VALUE) {
+        FindCloseChangeNotification(watch->change);
+    }
+#endif
+
+    for (i = 0; i < WATCH_BUCKETS; i++) {
+        for (f = watch->files[i]; f; f = next) {
+            next = f->next;
+            free(f);
+        }
+    }
+
+    free(watch->dir);
+    free(watch);
+}
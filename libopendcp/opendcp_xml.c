@@ -62,15 +62,16 @@ char *strsep (char **stringp, const char *delim) {
 #endif
 
 char *get_aspect_ratio(char *dimension_string) {
-    char *p, *ratio;
+    char *copy, *p, *ratio;
     int n, d;
     float a = 0.0;
 
     ratio = malloc(sizeof(char) * 5);
-    p = malloc(strlen(dimension_string) + 1);
+    copy = p = malloc(strlen(dimension_string) + 1);
     strcpy(p, dimension_string);
     n = atoi(strsep(&p, " "));
-    d = atoi(strsep(&p, " "));
+    d = p ? atoi(strsep(&p, " ")) : 0;
+    free(copy);
 
     if (d > 0) {
         a = (n * 1.00) / (d * 1.00);
@@ -85,10 +86,10 @@ char *get_aspect_ratio(char *dimension_string) {
     return(ratio);
 }
 
-int is_valid_asset(asset_t asset) {
-    if (asset.essence_class == ACT_PICTURE ||
-            asset.essence_class == ACT_SOUND ||
-            asset.essence_class == ACT_TIMED_TEXT ) {
+int is_valid_asset(const asset_t *asset) {
+    if (asset->essence_class == ACT_PICTURE ||
+            asset->essence_class == ACT_SOUND ||
+            asset->essence_class == ACT_TIMED_TEXT ) {
 
         return 1;
     }
@@ -96,13 +97,13 @@ int is_valid_asset(asset_t asset) {
     return 0;
 }
 
-int write_cpl_asset(opendcp_t *opendcp, xmlTextWriterPtr xml, asset_t asset) {
+int write_cpl_asset(opendcp_t *opendcp, xmlTextWriterPtr xml, const asset_t *asset) {
     if (!is_valid_asset(asset)) {
         return OPENDCP_NO_ERROR;
     }
 
-    if (asset.essence_class == ACT_PICTURE) {
-        if (asset.stereoscopic) {
+    if (asset->essence_class == ACT_PICTURE) {
+        if (asset->stereoscopic) {
             xmlTextWriterStartElement(xml, BAD_CAST "msp-cpl:MainStereoscopicPicture");
             xmlTextWriterWriteAttribute(xml, BAD_CAST "xmlns:msp-cpl", BAD_CAST NS_CPL_3D[opendcp->ns]);
         }
@@ -110,37 +111,39 @@ int write_cpl_asset(opendcp_t *opendcp, xmlTextWriterPtr xml, asset_t asset) {
             xmlTextWriterStartElement(xml, BAD_CAST "MainPicture");
         }
     }
-    else if (asset.essence_class == ACT_SOUND) {
+    else if (asset->essence_class == ACT_SOUND) {
         xmlTextWriterStartElement(xml, BAD_CAST "MainSound");
     }
-    else if (asset.essence_class == ACT_TIMED_TEXT) {
+    else if (asset->essence_class == ACT_TIMED_TEXT) {
         xmlTextWriterStartElement(xml, BAD_CAST "MainSubtitle");
     }
     else {
         return OPENDCP_NO_ERROR;
     }
 
-    xmlTextWriterWriteFormatElement(xml, BAD_CAST "Id", "%s%s", "urn:uuid:", asset.uuid);
-    xmlTextWriterWriteFormatElement(xml, BAD_CAST "AnnotationText", "%s", asset.annotation);
-    xmlTextWriterWriteFormatElement(xml, BAD_CAST "EditRate", "%s", asset.edit_rate);
-    xmlTextWriterWriteFormatElement(xml, BAD_CAST "IntrinsicDuration", "%d", asset.intrinsic_duration);
-    xmlTextWriterWriteFormatElement(xml, BAD_CAST "EntryPoint", "%d", asset.entry_point);
-    xmlTextWriterWriteFormatElement(xml, BAD_CAST "Duration", "%d", asset.duration);
-    if ( asset.encrypted ) {
-        xmlTextWriterWriteFormatElement(xml, BAD_CAST "KeyId", "%s%s", "urn:uuid:", asset.key_id);
+    xmlTextWriterWriteFormatElement(xml, BAD_CAST "Id", "%s%s", "urn:uuid:", asset->uuid);
+    xmlTextWriterWriteFormatElement(xml, BAD_CAST "AnnotationText", "%s", asset->annotation);
+    xmlTextWriterWriteFormatElement(xml, BAD_CAST "EditRate", "%s", asset->edit_rate);
+    xmlTextWriterWriteFormatElement(xml, BAD_CAST "IntrinsicDuration", "%d", asset->intrinsic_duration);
+    xmlTextWriterWriteFormatElement(xml, BAD_CAST "EntryPoint", "%d", asset->entry_point);
+    xmlTextWriterWriteFormatElement(xml, BAD_CAST "Duration", "%d", asset->duration);
+    if ( asset->encrypted ) {
+        xmlTextWriterWriteFormatElement(xml, BAD_CAST "KeyId", "%s%s", "urn:uuid:", asset->key_id);
     }
     if ( opendcp->dcp.digest_flag ) {
-        xmlTextWriterWriteFormatElement(xml, BAD_CAST "Hash", "%s", asset.digest);
+        xmlTextWriterWriteFormatElement(xml, BAD_CAST "Hash", "%s", asset->digest);
     }
 
-    if (asset.essence_class == ACT_PICTURE) {
-        xmlTextWriterWriteFormatElement(xml, BAD_CAST "FrameRate", "%s", asset.frame_rate);
+    if (asset->essence_class == ACT_PICTURE) {
+        xmlTextWriterWriteFormatElement(xml, BAD_CAST "FrameRate", "%s", asset->frame_rate);
 
         if (opendcp->ns == XML_NS_SMPTE) {
-            xmlTextWriterWriteFormatElement(xml, BAD_CAST "ScreenAspectRatio", "%s", asset.aspect_ratio);
+            xmlTextWriterWriteFormatElement(xml, BAD_CAST "ScreenAspectRatio", "%s", asset->aspect_ratio);
         }
         else {
-            xmlTextWriterWriteFormatElement(xml, BAD_CAST "ScreenAspectRatio", "%s", get_aspect_ratio(asset.aspect_ratio));
+            char *ratio = get_aspect_ratio((char *)asset->aspect_ratio);
+            xmlTextWriterWriteFormatElement(xml, BAD_CAST "ScreenAspectRatio", "%s", ratio);
+            free(ratio);
         }
     }
 
@@ -149,28 +152,28 @@ int write_cpl_asset(opendcp_t *opendcp, xmlTextWriterPtr xml, asset_t asset) {
     return OPENDCP_NO_ERROR;
 }
 
-int write_pkl_asset(opendcp_t *opendcp, xmlTextWriterPtr xml, asset_t asset) {
+int write_pkl_asset(opendcp_t *opendcp, xmlTextWriterPtr xml, const asset_t *asset) {
     if (!is_valid_asset(asset)) {
         return OPENDCP_NO_ERROR;
     }
 
     xmlTextWriterStartElement(xml, BAD_CAST "Asset");
-    xmlTextWriterWriteFormatElement(xml, BAD_CAST "Id", "%s%s", "urn:uuid:", asset.uuid);
-    xmlTextWriterWriteFormatElement(xml, BAD_CAST "AnnotationText", "%s", asset.annotation);
-    xmlTextWriterWriteFormatElement(xml, BAD_CAST "Hash", "%s", asset.digest);
-    xmlTextWriterWriteFormatElement(xml, BAD_CAST "Size", "%s", asset.size);
+    xmlTextWriterWriteFormatElement(xml, BAD_CAST "Id", "%s%s", "urn:uuid:", asset->uuid);
+    xmlTextWriterWriteFormatElement(xml, BAD_CAST "AnnotationText", "%s", asset->annotation);
+    xmlTextWriterWriteFormatElement(xml, BAD_CAST "Hash", "%s", asset->digest);
+    xmlTextWriterWriteFormatElement(xml, BAD_CAST "Size", "%s", asset->size);
 
     if (opendcp->ns == XML_NS_SMPTE) {
         xmlTextWriterWriteFormatElement(xml, BAD_CAST "Type", "%s", "application/mxf");
     }
     else {
-        if (asset.essence_class == ACT_PICTURE) {
+        if (asset->essence_class == ACT_PICTURE) {
             xmlTextWriterWriteFormatElement(xml, BAD_CAST "Type", "%s", "application/x-smpte-mxf;asdcpKind=Picture");
         }
-        else if (asset.essence_class == ACT_SOUND) {
+        else if (asset->essence_class == ACT_SOUND) {
             xmlTextWriterWriteFormatElement(xml, BAD_CAST "Type", "%s", "application/x-smpte-mxf;asdcpKind=Sound");
         }
-        else if (asset.essence_class == ACT_TIMED_TEXT) {
+        else if (asset->essence_class == ACT_TIMED_TEXT) {
             xmlTextWriterWriteFormatElement(xml, BAD_CAST "Type", "%s", "application/x-smpte-mxf;asdcpKind=Subtitle");
         }
         else {
@@ -178,26 +181,26 @@ int write_pkl_asset(opendcp_t *opendcp, xmlTextWriterPtr xml, asset_t asset) {
         }
     }
 
-    xmlTextWriterWriteFormatElement(xml, BAD_CAST "OriginalFileName", "%s", basename(asset.filename));
+    xmlTextWriterWriteFormatElement(xml, BAD_CAST "OriginalFileName", "%s", basename((char *)asset->filename));
     xmlTextWriterEndElement(xml);      /* end asset */
 
     return OPENDCP_NO_ERROR;
 }
 
-int write_assetmap_asset(xmlTextWriterPtr xml, asset_t asset) {
+int write_assetmap_asset(xmlTextWriterPtr xml, const asset_t *asset) {
     if (!is_valid_asset(asset)) {
         return OPENDCP_NO_ERROR;
     }
 
-    if (asset.uuid != NULL) {
+    if (asset->uuid[0]) {
         xmlTextWriterStartElement(xml, BAD_CAST "Asset");
-        xmlTextWriterWriteFormatElement(xml, BAD_CAST "Id", "%s%s", "urn:uuid:", asset.uuid);
+        xmlTextWriterWriteFormatElement(xml, BAD_CAST "Id", "%s%s", "urn:uuid:", asset->uuid);
         xmlTextWriterStartElement(xml, BAD_CAST "ChunkList");
         xmlTextWriterStartElement(xml, BAD_CAST "Chunk");
-        xmlTextWriterWriteFormatElement(xml, BAD_CAST "Path", "%s", basename(asset.filename));
+        xmlTextWriterWriteFormatElement(xml, BAD_CAST "Path", "%s", basename((char *)asset->filename));
         xmlTextWriterWriteFormatElement(xml, BAD_CAST "VolumeIndex", "%d", 1);
         xmlTextWriterWriteFormatElement(xml, BAD_CAST "Offset", "%d", 0);
-        xmlTextWriterWriteFormatElement(xml, BAD_CAST "Length", "%s", asset.size);
+        xmlTextWriterWriteFormatElement(xml, BAD_CAST "Length", "%s", asset->size);
         xmlTextWriterEndElement(xml); /* end chunk */
         xmlTextWriterEndElement(xml); /* end chunklist */
         xmlTextWriterEndElement(xml); /* end cpl asset */
@@ -206,21 +209,53 @@ int write_assetmap_asset(xmlTextWriterPtr xml, asset_t asset) {
     return OPENDCP_NO_ERROR;
 }
 
+/* start an xml document that is written straight to its file */
+static xmlTextWriterPtr xml_writer_open(const char *filename) {
+    xmlTextWriterPtr xml;
+
+    xml = xmlNewTextWriterFilename(filename, 0);
+
+    if (xml == NULL) {
+        OPENDCP_LOG(LOG_ERROR, "could not create xml file %s", filename);
+        return NULL;
+    }
+
+    xmlTextWriterSetIndent(xml, 1);
+    xmlTextWriterSetIndentString(xml, BAD_CAST "  ");
+
+    if (xmlTextWriterStartDocument(xml, NULL, XML_ENCODING, NULL) < 0) {
+        OPENDCP_LOG(LOG_ERROR, "xmlTextWriterStartDocument failed");
+        xmlFreeTextWriter(xml);
+        return NULL;
+    }
+
+    return xml;
+}
+
+/* end the document, flushing and closing its file */
+static int xml_writer_close(xmlTextWriterPtr xml, const char *filename) {
+    int rc;
+
+    rc = xmlTextWriterEndDocument(xml);
+    xmlFreeTextWriter(xml);
+
+    if (rc < 0) {
+        OPENDCP_LOG(LOG_ERROR, "xmlTextWriterEndDocument failed %s", filename);
+        return OPENDCP_ERROR;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
 int write_cpl(opendcp_t *opendcp, cpl_t *cpl) {
-    int r, rc;
+    int r;
     struct stat st;
-    xmlIndentTreeOutput = 1;
-    xmlDocPtr        doc;
     xmlTextWriterPtr xml;
 
-    /* create XML document */
-    xml = xmlNewTextWriterDoc(&doc, 0);
-
     /* cpl start */
-    rc = xmlTextWriterStartDocument(xml, NULL, XML_ENCODING, NULL);
+    xml = xml_writer_open(cpl->filename);
 
-    if (rc < 0) {
-        OPENDCP_LOG(LOG_ERROR, "xmlTextWriterStartDocument failed");
+    if (xml == NULL) {
         return OPENDCP_ERROR;
     }
 
@@ -264,21 +299,21 @@ int write_cpl(opendcp_t *opendcp, cpl_t *cpl) {
     xmlTextWriterStartElement(xml, BAD_CAST "ReelList");
 
     for (r = 0; r < cpl->reel_count; r++) {
-        reel_t reel = cpl->reel[r];
+        reel_t *reel = &cpl->reel[r];
         xmlTextWriterStartElement(xml, BAD_CAST "Reel");
-        xmlTextWriterWriteFormatElement(xml, BAD_CAST "Id", "%s%s", "urn:uuid:", reel.uuid);
+        xmlTextWriterWriteFormatElement(xml, BAD_CAST "Id", "%s%s", "urn:uuid:", reel->uuid);
         xmlTextWriterStartElement(xml, BAD_CAST "AssetList");
 
         /* write picture first, unless stereoscopic */
-        if (cpl->reel[r].main_picture.stereoscopic) {
-            write_cpl_asset(opendcp, xml, cpl->reel[r].main_sound);
-            write_cpl_asset(opendcp, xml, cpl->reel[r].main_subtitle);
-            write_cpl_asset(opendcp, xml, cpl->reel[r].main_picture);
+        if (reel->main_picture.stereoscopic) {
+            write_cpl_asset(opendcp, xml, &reel->main_sound);
+            write_cpl_asset(opendcp, xml, &reel->main_subtitle);
+            write_cpl_asset(opendcp, xml, &reel->main_picture);
         }
         else {
-            write_cpl_asset(opendcp, xml, cpl->reel[r].main_picture);
-            write_cpl_asset(opendcp, xml, cpl->reel[r].main_sound);
-            write_cpl_asset(opendcp, xml, cpl->reel[r].main_subtitle);
+            write_cpl_asset(opendcp, xml, &reel->main_picture);
+            write_cpl_asset(opendcp, xml, &reel->main_sound);
+            write_cpl_asset(opendcp, xml, &reel->main_subtitle);
         }
 
         xmlTextWriterEndElement(xml);     /* end assetlist */
@@ -297,16 +332,14 @@ int write_cpl(opendcp_t *opendcp, cpl_t *cpl) {
 
     xmlTextWriterEndElement(xml);         /* end compositionplaylist */
 
-    rc = xmlTextWriterEndDocument(xml);
-
-    if (rc < 0) {
-        OPENDCP_LOG(LOG_ERROR, "xmlTextWriterEndDocument failed %s", cpl->filename);
+    if (xml_writer_close(xml, cpl->filename) != OPENDCP_NO_ERROR) {
         return OPENDCP_ERROR;
     }
 
-    xmlFreeTextWriter(xml);
-    xmlSaveFormatFile(cpl->filename, doc, 1);
-    xmlFreeDoc(doc);
+    /* the caller signs many documents at once, then stores the size and digest */
+    if (opendcp->xml_signature.defer) {
+        return OPENDCP_NO_ERROR;
+    }
 
 #ifdef XMLSEC
 
@@ -339,20 +372,14 @@ int write_pkl_list(opendcp_t *opendcp) {
 }
 
 int write_pkl(opendcp_t *opendcp, pkl_t *pkl) {
-    int r, c, rc;
+    int r, c;
     struct stat st;
-    xmlIndentTreeOutput = 1;
-    xmlDocPtr        doc;
     xmlTextWriterPtr xml;
 
-    /* create XML document */
-    xml = xmlNewTextWriterDoc(&doc, 0);
-
     /* pkl start */
-    rc = xmlTextWriterStartDocument(xml, NULL, XML_ENCODING, NULL);
+    xml = xml_writer_open(pkl->filename);
 
-    if (rc < 0) {
-        OPENDCP_LOG(LOG_ERROR, "xmlTextWriterStartDocument failed");
+    if (xml == NULL) {
         return OPENDCP_ERROR;
     }
 
@@ -376,20 +403,20 @@ int write_pkl(opendcp_t *opendcp, pkl_t *pkl) {
     xmlTextWriterStartElement(xml, BAD_CAST "AssetList");
 
     for (c = 0; c < pkl->cpl_count; c++) {
-        cpl_t cpl = pkl->cpl[c];
-        OPENDCP_LOG(LOG_INFO, "reels: %d", cpl.reel_count);
+        cpl_t *cpl = &pkl->cpl[c];
+        OPENDCP_LOG(LOG_INFO, "reels: %d", cpl->reel_count);
 
-        for (r = 0; r < cpl.reel_count; r++) {
-            write_pkl_asset(opendcp, xml, cpl.reel[r].main_picture);
-            write_pkl_asset(opendcp, xml, cpl.reel[r].main_sound);
-            write_pkl_asset(opendcp, xml, cpl.reel[r].main_subtitle);
+        for (r = 0; r < cpl->reel_count; r++) {
+            write_pkl_asset(opendcp, xml, &cpl->reel[r].main_picture);
+            write_pkl_asset(opendcp, xml, &cpl->reel[r].main_sound);
+            write_pkl_asset(opendcp, xml, &cpl->reel[r].main_subtitle);
         }
 
         /* cpl */
         xmlTextWriterStartElement(xml, BAD_CAST "Asset");
-        xmlTextWriterWriteFormatElement(xml, BAD_CAST "Id", "%s%s", "urn:uuid:", cpl.uuid);
-        xmlTextWriterWriteFormatElement(xml, BAD_CAST "Hash", "%s", cpl.digest);
-        xmlTextWriterWriteFormatElement(xml, BAD_CAST "Size", "%s", cpl.size);
+        xmlTextWriterWriteFormatElement(xml, BAD_CAST "Id", "%s%s", "urn:uuid:", cpl->uuid);
+        xmlTextWriterWriteFormatElement(xml, BAD_CAST "Hash", "%s", cpl->digest);
+        xmlTextWriterWriteFormatElement(xml, BAD_CAST "Size", "%s", cpl->size);
 
         if (opendcp->ns == XML_NS_SMPTE) {
             xmlTextWriterWriteFormatElement(xml, BAD_CAST "Type", "%s", "text/xml");
@@ -398,7 +425,7 @@ int write_pkl(opendcp_t *opendcp, pkl_t *pkl) {
             xmlTextWriterWriteFormatElement(xml, BAD_CAST "Type", "%s", "text/xml;asdcpKind=CPL");
         }
 
-        xmlTextWriterWriteFormatElement(xml, BAD_CAST "OriginalFileName", "%s", basename(cpl.filename));
+        xmlTextWriterWriteFormatElement(xml, BAD_CAST "OriginalFileName", "%s", basename(cpl->filename));
         xmlTextWriterEndElement(xml);      /* end cpl asset */
     }
 
@@ -414,16 +441,13 @@ int write_pkl(opendcp_t *opendcp, pkl_t *pkl) {
 
     xmlTextWriterEndElement(xml);      /* end packinglist */
 
-    rc = xmlTextWriterEndDocument(xml);
-
-    if (rc < 0) {
-        OPENDCP_LOG(LOG_ERROR, "xmlTextWriterEndDocument failed %s", pkl->filename);
+    if (xml_writer_close(xml, pkl->filename) != OPENDCP_NO_ERROR) {
         return OPENDCP_ERROR;
     }
 
-    xmlFreeTextWriter(xml);
-    xmlSaveFormatFile(pkl->filename, doc, 1);
-    xmlFreeDoc(doc);
+    if (opendcp->xml_signature.defer) {
+        return OPENDCP_NO_ERROR;
+    }
 
 #ifdef XMLSEC
 
@@ -442,28 +466,23 @@ int write_pkl(opendcp_t *opendcp, pkl_t *pkl) {
 }
 
 int write_assetmap(opendcp_t *opendcp) {
-    xmlIndentTreeOutput = 1;
-    xmlDocPtr        doc;
     xmlTextWriterPtr xml;
-    int              c, r, rc;
+    int              c, r;
     char             uuid_s[40];
-    reel_t           reel;
+    reel_t           *reel;
+    pkl_t            *pkl;
 
-    assetmap_t assetmap = opendcp->dcp.assetmap;
+    assetmap_t *assetmap = &opendcp->dcp.assetmap;
 
     /* generate assetmap UUID */
     uuid_random(uuid_s);
 
-    OPENDCP_LOG(LOG_INFO, "writing ASSETMAP file %.256s", assetmap.filename);
-
-    /* create XML document */
-    xml = xmlNewTextWriterDoc(&doc, 0);
+    OPENDCP_LOG(LOG_INFO, "writing ASSETMAP file %.256s", assetmap->filename);
 
-    /* assetmap XML Start */
-    rc = xmlTextWriterStartDocument(xml, NULL, XML_ENCODING, NULL);
+    /* assetmap start */
+    xml = xml_writer_open(assetmap->filename);
 
-    if (rc < 0) {
-        OPENDCP_LOG(LOG_ERROR, "xmlTextWriterStartDocument failed");
+    if (xml == NULL) {
         return OPENDCP_ERROR;
     }
 
@@ -490,16 +509,16 @@ int write_assetmap(opendcp_t *opendcp) {
     OPENDCP_LOG(LOG_INFO, "writing ASSETMAP PKL");
 
     /* PKL */
-    pkl_t pkl = opendcp->dcp.pkl[0];
+    pkl = &opendcp->dcp.pkl[0];
     xmlTextWriterStartElement(xml, BAD_CAST "Asset");
-    xmlTextWriterWriteFormatElement(xml, BAD_CAST "Id", "%s%s", "urn:uuid:", pkl.uuid);
+    xmlTextWriterWriteFormatElement(xml, BAD_CAST "Id", "%s%s", "urn:uuid:", pkl->uuid);
     xmlTextWriterWriteFormatElement(xml, BAD_CAST "PackingList", "%s", "true");
     xmlTextWriterStartElement(xml, BAD_CAST "ChunkList");
     xmlTextWriterStartElement(xml, BAD_CAST "Chunk");
-    xmlTextWriterWriteFormatElement(xml, BAD_CAST "Path", "%s", basename(pkl.filename));
+    xmlTextWriterWriteFormatElement(xml, BAD_CAST "Path", "%s", basename(pkl->filename));
     xmlTextWriterWriteFormatElement(xml, BAD_CAST "VolumeIndex", "%d", 1);
     xmlTextWriterWriteFormatElement(xml, BAD_CAST "Offset", "%d", 0);
-    xmlTextWriterWriteFormatElement(xml, BAD_CAST "Length", "%s", pkl.size);
+    xmlTextWriterWriteFormatElement(xml, BAD_CAST "Length", "%s", pkl->size);
     xmlTextWriterEndElement(xml); /* end chunk */
     xmlTextWriterEndElement(xml); /* end chunklist */
     xmlTextWriterEndElement(xml); /* end pkl asset */
@@ -507,65 +526,51 @@ int write_assetmap(opendcp_t *opendcp) {
     OPENDCP_LOG(LOG_INFO, "writing ASSETMAP CPLs");
 
     /* CPL */
-    for (c = 0; c < pkl.cpl_count; c++) {
-        cpl_t cpl = pkl.cpl[c];
+    for (c = 0; c < pkl->cpl_count; c++) {
+        cpl_t *cpl = &pkl->cpl[c];
         xmlTextWriterStartElement(xml, BAD_CAST "Asset");
-        xmlTextWriterWriteFormatElement(xml, BAD_CAST "Id", "%s%s", "urn:uuid:", cpl.uuid);
+        xmlTextWriterWriteFormatElement(xml, BAD_CAST "Id", "%s%s", "urn:uuid:", cpl->uuid);
         xmlTextWriterStartElement(xml, BAD_CAST "ChunkList");
         xmlTextWriterStartElement(xml, BAD_CAST "Chunk");
-        xmlTextWriterWriteFormatElement(xml, BAD_CAST "Path", "%s", basename(cpl.filename));
+        xmlTextWriterWriteFormatElement(xml, BAD_CAST "Path", "%s", basename(cpl->filename));
         xmlTextWriterWriteFormatElement(xml, BAD_CAST "VolumeIndex", "%d", 1);
         xmlTextWriterWriteFormatElement(xml, BAD_CAST "Offset", "%d", 0);
-        xmlTextWriterWriteFormatElement(xml, BAD_CAST "Length", "%s", cpl.size);
+        xmlTextWriterWriteFormatElement(xml, BAD_CAST "Length", "%s", cpl->size);
         xmlTextWriterEndElement(xml); /* end chunk */
         xmlTextWriterEndElement(xml); /* end chunklist */
         xmlTextWriterEndElement(xml); /* end cpl asset */
 
         /* assets(s) start */
-        for (r = 0; r < cpl.reel_count; r++) {
-            reel = cpl.reel[r];
+        for (r = 0; r < cpl->reel_count; r++) {
+            reel = &cpl->reel[r];
 
-            write_assetmap_asset(xml, reel.main_picture);
-            write_assetmap_asset(xml, reel.main_sound);
-            write_assetmap_asset(xml, reel.main_subtitle);
+            write_assetmap_asset(xml, &reel->main_picture);
+            write_assetmap_asset(xml, &reel->main_sound);
+            write_assetmap_asset(xml, &reel->main_subtitle);
         }
     }
 
     xmlTextWriterEndElement(xml); /* end assetlist */
     xmlTextWriterEndElement(xml); /* end assetmap */
 
-    rc = xmlTextWriterEndDocument(xml);
-
-    if (rc < 0) {
-        OPENDCP_LOG(LOG_ERROR, "xmlTextWriterEndDocument failed %s", opendcp->dcp.assetmap.filename);
+    if (xml_writer_close(xml, assetmap->filename) != OPENDCP_NO_ERROR) {
         return OPENDCP_ERROR;
     }
 
-    xmlFreeTextWriter(xml);
-    xmlSaveFormatFile(assetmap.filename, doc, 1);
-    xmlFreeDoc(doc);
-
     return OPENDCP_NO_ERROR;
 }
 
 int write_volumeindex(opendcp_t *opendcp) {
-    xmlIndentTreeOutput = 1;
-    xmlDocPtr        doc;
     xmlTextWriterPtr xml;
-    int              rc;
-
-    volindex_t volindex = opendcp->dcp.volindex;
 
-    OPENDCP_LOG(LOG_INFO, "writing VOLINDEX file %.256s", volindex.filename);
+    volindex_t *volindex = &opendcp->dcp.volindex;
 
-    /* create XML document */
-    xml = xmlNewTextWriterDoc(&doc, 0);
+    OPENDCP_LOG(LOG_INFO, "writing VOLINDEX file %.256s", volindex->filename);
 
-    /* volumeindex XML Start */
-    rc = xmlTextWriterStartDocument(xml, NULL, XML_ENCODING, NULL);
+    /* volumeindex start */
+    xml = xml_writer_open(volindex->filename);
 
-    if (rc < 0) {
-        OPENDCP_LOG(LOG_ERROR, "xmlTextWriterStartDocument failed");
+    if (xml == NULL) {
         return OPENDCP_ERROR;
     }
 
@@ -574,16 +579,9 @@ int write_volumeindex(opendcp_t *opendcp) {
     xmlTextWriterWriteFormatElement(xml, BAD_CAST "Index", "%d", 1);
     xmlTextWriterEndElement(xml);
 
-    rc = xmlTextWriterEndDocument(xml);
-
-    if (rc < 0) {
-        OPENDCP_LOG(LOG_ERROR, "xmlTextWriterEndDocument failed %s", volindex.filename);
+    if (xml_writer_close(xml, volindex->filename) != OPENDCP_NO_ERROR) {
         return OPENDCP_ERROR;
     }
 
-    xmlFreeTextWriter(xml);
-    xmlSaveFormatFile(volindex.filename, doc, 1);
-    xmlFreeDoc(doc);
-
     return OPENDCP_NO_ERROR;
 }
@@ -21,11 +21,16 @@
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <strings.h>
+#include <pthread.h>
+#include <dirent.h>
+#include <sys/stat.h>
 
 #include <libxml/tree.h>
 #include <libxml/xmlmemory.h>
 #include <libxml/parser.h>
 #include <libxml/xmlwriter.h>
+#include <libxml/xmlreader.h>
 
 #ifndef XMLSEC_NO_XSLT
 #include <libxslt/xslt.h>
@@ -40,10 +45,16 @@
 #include <xmlsec/xmldsig.h>
 #include <xmlsec/templates.h>
 #include <xmlsec/crypto.h>
+#include <xmlsec/openssl/x509.h>
+
+#include <openssl/pem.h>
 
 #include "opendcp.h"
 #include "opendcp_certificates.h"
 
+#define SIGN_THREADS_MAX   8
+#define VERIFY_THREADS_MAX 16
+
 extern int write_dsig_template(opendcp_t *opendcp, xmlTextWriterPtr xml);
 extern int xml_sign(opendcp_t *opendcp, char *filename);
 
@@ -98,87 +109,130 @@ char *strip_cert_file(char *filename) {
     return(ptr);
 }
 
-int write_dsig_template(opendcp_t *opendcp, xmlTextWriterPtr xml) {
-    BIO *bio[3];
-    X509 *x[3];
-    X509_NAME *issuer_xn[3];
-    X509_NAME *subject_xn[3];
-    char *cert[3];
+/* the signer, ca and root certificates as written into a signature template */
+typedef struct {
+    X509 *x509[3];
+    char *cert[3];    /* base64 body with the BEGIN/END lines stripped */
+    char *issuer[3];
+    char *subject;    /* subject of the signer */
+} dsig_certs_t;
+
+/* a signing session, see xml_sign_session_open */
+struct xml_sign_session {
+    opendcp_t         *opendcp;
+    int               threads;
+    xmlSecKeysMngrPtr *key_managers;
+    dsig_certs_t      certs;
+};
+
+static void free_dsig_certs(dsig_certs_t *certs) {
     int i;
 
-    OPENDCP_LOG(LOG_DEBUG, "xml_sign: write_dsig_template");
+    for (i = 0; i < 3; i++) {
+        if (certs->x509[i]) {
+            X509_free(certs->x509[i]);
+        }
 
-    if (opendcp->xml_signature.use_external) {
-        /* read certificates from file */
-        FILE *cp;
+        free(certs->cert[i]);
+        free(certs->issuer[i]);
+    }
 
-        cp = fopen(opendcp->xml_signature.signer, "rb");
+    free(certs->subject);
+    memset(certs, 0, sizeof(*certs));
+}
 
-        if (cp) {
-            x[0] = PEM_read_X509(cp, NULL, NULL, NULL);
-            fclose(cp);
-        }
+static X509 *read_cert_file(const char *filename) {
+    X509 *x = NULL;
+    FILE *cp = fopen(filename, "rb");
+
+    if (cp) {
+        x = PEM_read_X509(cp, NULL, NULL, NULL);
+        fclose(cp);
+    }
 
-        cp = fopen(opendcp->xml_signature.ca, "rb");
+    return x;
+}
 
-        if (cp) {
-            x[1] = PEM_read_X509(cp, NULL, NULL, NULL);
-            fclose(cp);
-        }
+static int load_dsig_certs(opendcp_t *opendcp, dsig_certs_t *certs) {
+    BIO *bio;
+    const char *mem_cert[3] = { opendcp_signer_cert, opendcp_ca_cert, opendcp_root_cert };
+    X509_NAME *issuer_xn;
+    X509_NAME *subject_xn;
+    int i;
+
+    memset(certs, 0, sizeof(*certs));
 
-        cp = fopen(opendcp->xml_signature.root, "rb");
+    for (i = 0; i < 3; i++) {
+        if (opendcp->xml_signature.use_external) {
+            /* read certificates from file */
+            char *filename = i == 0 ? opendcp->xml_signature.signer : i == 1 ? opendcp->xml_signature.ca : opendcp->xml_signature.root;
+            certs->x509[i] = read_cert_file(filename);
 
-        if (cp) {
-            x[2] = PEM_read_X509(cp, NULL, NULL, NULL);
-            fclose(cp);
+            if (certs->x509[i]) {
+                certs->cert[i] = strip_cert_file(filename);
+            }
         }
+        else {
+            /* read certificate from memory, and save a copy with the BEGIN/END stripped */
+            bio = BIO_new_mem_buf((void *)mem_cert[i], -1);
 
-        cert[0] = strip_cert_file(opendcp->xml_signature.signer);
-        cert[1] = strip_cert_file(opendcp->xml_signature.ca);
-        cert[2] = strip_cert_file(opendcp->xml_signature.root);
-    }
-    else {
-        /* read certificate from memory */
-        bio[0] = BIO_new_mem_buf((void *)opendcp_signer_cert, -1);
-        bio[1] = BIO_new_mem_buf((void *)opendcp_ca_cert, -1);
-        bio[2] = BIO_new_mem_buf((void *)opendcp_root_cert, -1);
-
-        /* save a copy with the BEGIN/END stripped */
-        cert[0] = strip_cert(opendcp_signer_cert);
-        cert[1] = strip_cert(opendcp_ca_cert);
-        cert[2] = strip_cert(opendcp_root_cert);
-
-        for (i = 0; i < 3; i++) {
-            if (bio[i] == NULL) {
+            if (bio == NULL) {
                 OPENDCP_LOG(LOG_ERROR, "could allocate certificate from memory");
+                free_dsig_certs(certs);
                 return OPENDCP_ERROR;
             }
 
-            x[i] = PEM_read_bio_X509(bio[i], NULL, NULL, NULL);
-
-            if (!BIO_set_close(bio[i], BIO_NOCLOSE)) {
-                OPENDCP_LOG(LOG_ERROR, "could set BIO close flag");
-                return OPENDCP_ERROR;
-            }
+            certs->x509[i] = PEM_read_bio_X509(bio, NULL, NULL, NULL);
+            certs->cert[i] = strip_cert(mem_cert[i]);
+            BIO_free(bio);
+        }
 
-            if (x[i] == NULL) {
-                OPENDCP_LOG(LOG_ERROR, "could not read certificate");
-                return OPENDCP_ERROR;
-            }
+        if (certs->x509[i] == NULL) {
+            OPENDCP_LOG(LOG_ERROR, "could not read certificate");
+            free_dsig_certs(certs);
+            return OPENDCP_ERROR;
         }
-    }
 
-    /* get issuer, subject */
-    for (i = 0; i < 3; i++) {
-        issuer_xn[i]  =  X509_get_issuer_name(x[i]);
-        subject_xn[i] =  X509_get_subject_name(x[i]);
+        /* get issuer, subject */
+        issuer_xn  = X509_get_issuer_name(certs->x509[i]);
+        subject_xn = X509_get_subject_name(certs->x509[i]);
 
-        if (issuer_xn[i] == NULL || subject_xn[i] == NULL) {
+        if (issuer_xn == NULL || subject_xn == NULL) {
             OPENDCP_LOG(LOG_ERROR, "could not parse certificate data");
+            free_dsig_certs(certs);
             return OPENDCP_ERROR;
         }
+
+        certs->issuer[i] = dn_oneline(issuer_xn);
+
+        if (i == 0) {
+            certs->subject = dn_oneline(subject_xn);
+        }
     }
 
+    return OPENDCP_NO_ERROR;
+}
+
+int write_dsig_template(opendcp_t *opendcp, xmlTextWriterPtr xml) {
+    dsig_certs_t  loaded;
+    dsig_certs_t  *certs = &loaded;
+    X509          **x;
+    char          **cert;
+    int i;
+
+    OPENDCP_LOG(LOG_DEBUG, "xml_sign: write_dsig_template");
+
+    /* a signing session keeps the certificates parsed */
+    if (opendcp->xml_signature.session) {
+        certs = &opendcp->xml_signature.session->certs;
+    }
+    else if (load_dsig_certs(opendcp, &loaded) != OPENDCP_NO_ERROR) {
+        return OPENDCP_ERROR;
+    }
+
+    x    = certs->x509;
+    cert = certs->cert;
+
     OPENDCP_LOG(LOG_DEBUG, "xml_sign: write_dsig_template: start signer");
 
     /* signer */
@@ -191,7 +245,7 @@ int write_dsig_template(opendcp_t *opendcp, xmlTextWriterPtr xml) {
 
     xmlTextWriterWriteFormatElementNS(xml, BAD_CAST "dsig",
                                       BAD_CAST "X509IssuerName", NULL, "%s",
-                                      dn_oneline(issuer_xn[0]));
+                                      certs->issuer[0]);
 
     xmlTextWriterWriteFormatElementNS(xml, BAD_CAST "dsig",
                                       BAD_CAST "X509SerialNumber", NULL, "%ld",
@@ -200,7 +254,7 @@ int write_dsig_template(opendcp_t *opendcp, xmlTextWriterPtr xml) {
 
     xmlTextWriterWriteFormatElementNS(xml, BAD_CAST "dsig",
                                       BAD_CAST "X509SubjectName", NULL,
-                                      "%s", dn_oneline(subject_xn[0]));
+                                      "%s", certs->subject);
 
     xmlTextWriterEndElement(xml);
     xmlTextWriterEndElement(xml);
@@ -278,7 +332,7 @@ int write_dsig_template(opendcp_t *opendcp, xmlTextWriterPtr xml) {
 
         xmlTextWriterWriteFormatElementNS(xml, BAD_CAST "dsig",
                                           BAD_CAST "X509IssuerName", NULL, "%s",
-                                          dn_oneline(issuer_xn[i]));
+                                          certs->issuer[i]);
 
         xmlTextWriterWriteFormatElementNS(xml, BAD_CAST "dsig",
                                           BAD_CAST "X509SerialNumber", NULL, "%ld",
@@ -295,20 +349,18 @@ int write_dsig_template(opendcp_t *opendcp, xmlTextWriterPtr xml) {
     xmlTextWriterEndElement(xml); /* KeyInfo */
     xmlTextWriterEndElement(xml); /* Signature */
 
-    if (subject_xn[0]) {
-        free(subject_xn[0]);
-    }
-
-    for (i = 0; i < 3; i++) {
-        if (issuer_xn[i]) {
-            free(issuer_xn[i]);
-        }
+    if (certs == &loaded) {
+        free_dsig_certs(&loaded);
     }
 
     return OPENDCP_NO_ERROR;
 }
 
-int xmlsec_init() {
+/* xmlsec is set up by the first user and shut down by the last */
+static pthread_mutex_t xmlsec_mutex = PTHREAD_MUTEX_INITIALIZER;
+static int             xmlsec_users = 0;
+
+static int xmlsec_init_once() {
     /* init libxml lib */
     xmlInitParser();
     xmlIndentTreeOutput = 1;
@@ -343,6 +395,24 @@ int xmlsec_init() {
     return(OPENDCP_NO_ERROR);
 }
 
+int xmlsec_init() {
+    int result = OPENDCP_NO_ERROR;
+
+    pthread_mutex_lock(&xmlsec_mutex);
+
+    if (xmlsec_users == 0) {
+        result = xmlsec_init_once();
+    }
+
+    if (result == OPENDCP_NO_ERROR) {
+        xmlsec_users++;
+    }
+
+    pthread_mutex_unlock(&xmlsec_mutex);
+
+    return result;
+}
+
 xmlSecKeysMngrPtr load_certificates_verify() {
     xmlSecKeysMngrPtr key_manager;
 
@@ -429,32 +499,35 @@ xmlSecKeysMngrPtr load_certificates_sign(opendcp_t *opendcp) {
 }
 
 int xmlsec_close() {
-    /* Shutdown xmlsec-crypto library */
-    xmlSecCryptoShutdown();
+    pthread_mutex_lock(&xmlsec_mutex);
+
+    if (xmlsec_users > 0 && --xmlsec_users == 0) {
+        /* Shutdown xmlsec-crypto library */
+        xmlSecCryptoShutdown();
 
-    /* Shutdown crypto library */
-    xmlSecCryptoAppShutdown();
+        /* Shutdown crypto library */
+        xmlSecCryptoAppShutdown();
 
-    /* Shutdown xmlsec library */
-    xmlSecShutdown();
+        /* Shutdown xmlsec library */
+        xmlSecShutdown();
+
+        /* Shutdown libxslt/libxml */
+        xmlCleanupParser();
+    }
 
-    /* Shutdown libxslt/libxml */
-    xmlCleanupParser();
+    pthread_mutex_unlock(&xmlsec_mutex);
 
     return(OPENDCP_NO_ERROR);
 }
 
-int xml_sign(opendcp_t *opendcp, char *filename) {
+/* sign the template in an xml file, the file is rewritten in place */
+static int sign_document(xmlSecKeysMngrPtr key_manager, char *filename) {
     xmlSecDSigCtxPtr dsig_ctx = NULL;
     xmlDocPtr        doc = NULL;
     xmlNodePtr       root_node;
     xmlNodePtr       sign_node;
     FILE *fp;
     int result = OPENDCP_ERROR;
-    xmlSecKeysMngrPtr key_manager = NULL;
-
-    OPENDCP_LOG(LOG_DEBUG, "xmlsec_init");
-    xmlsec_init();
 
     /* load doc file */
     OPENDCP_LOG(LOG_DEBUG, "parse file %s", filename);
@@ -483,15 +556,6 @@ int xml_sign(opendcp_t *opendcp, char *filename) {
         goto done;
     }
 
-    /* create keys manager */
-    OPENDCP_LOG(LOG_DEBUG, "load certificates");
-    key_manager = load_certificates_sign(opendcp);
-
-    if (key_manager == NULL) {
-        OPENDCP_LOG(LOG_ERROR, "failed to create key manager\n");
-        goto done;
-    }
-
     /* create signature opendcp */
     OPENDCP_LOG(LOG_DEBUG, "create signature context");
     dsig_ctx = xmlSecDSigCtxCreate(key_manager);
@@ -523,6 +587,7 @@ int xml_sign(opendcp_t *opendcp, char *filename) {
 
     if (xmlDocDump(fp, doc) < 0) {
         OPENDCP_LOG(LOG_ERROR, "Error: writing XML document failed\n");
+        fclose(fp);
         goto done;
     }
 
@@ -533,10 +598,6 @@ int xml_sign(opendcp_t *opendcp, char *filename) {
     result = 0;
 
 done:
-    /* destroy keys manager */
-    OPENDCP_LOG(LOG_DEBUG, "destroy key manager");
-    xmlSecKeysMngrDestroy(key_manager);
-
     /* destroy signature context */
     OPENDCP_LOG(LOG_DEBUG, "destroy signature context");
 
@@ -551,12 +612,322 @@ done:
         xmlFreeDoc(doc);
     }
 
+    return(result);
+}
+
+/*!
+ @function xml_sign_session_open
+ @abstract Sets up xmlsec, the keys and the certificates once for many signatures.
+ @discussion The session is stored in opendcp->xml_signature.session, so
+     write_dsig_template and xml_sign use it until it is closed. Each of the
+     threads gets its own keys manager, as xmlsec keys managers can not be
+     shared between threads signing at the same time.
+ @param opendcp The opendcp context holding the signature settings.
+ @param threads The number of documents xml_sign_session_sign signs at once.
+ @return The session, or NULL if xmlsec or the keys could not be loaded.
+*/
+xml_sign_session_t *xml_sign_session_open(opendcp_t *opendcp, int threads) {
+    xml_sign_session_t *session;
+    int                i;
+
+    if (threads < 1) {
+        threads = 1;
+    }
+
+    if (threads > SIGN_THREADS_MAX) {
+        threads = SIGN_THREADS_MAX;
+    }
+
+    if (xmlsec_init() != OPENDCP_NO_ERROR) {
+        return NULL;
+    }
+
+    session = calloc(1, sizeof(xml_sign_session_t));
+
+    if (session) {
+        session->key_managers = calloc(threads, sizeof(xmlSecKeysMngrPtr));
+    }
+
+    if (!session || !session->key_managers) {
+        free(session);
+        xmlsec_close();
+        return NULL;
+    }
+
+    session->opendcp = opendcp;
+    session->threads = threads;
+
+    if (load_dsig_certs(opendcp, &session->certs) != OPENDCP_NO_ERROR) {
+        xml_sign_session_close(session);
+        return NULL;
+    }
+
+    for (i = 0; i < threads; i++) {
+        OPENDCP_LOG(LOG_DEBUG, "load certificates");
+        session->key_managers[i] = load_certificates_sign(opendcp);
+
+        if (session->key_managers[i] == NULL) {
+            OPENDCP_LOG(LOG_ERROR, "failed to create key manager");
+            xml_sign_session_close(session);
+            return NULL;
+        }
+    }
+
+    opendcp->xml_signature.session = session;
+
+    return session;
+}
+
+typedef struct {
+    xml_sign_session_t *session;
+    char               **files;
+    int                count;
+    int                next;
+    int                result;
+    pthread_mutex_t    mutex;
+} sign_batch_t;
+
+typedef struct {
+    sign_batch_t      *batch;
+    xmlSecKeysMngrPtr key_manager;
+} sign_worker_t;
+
+static void *sign_worker(void *arg) {
+    sign_worker_t *worker = arg;
+    sign_batch_t  *batch = worker->batch;
+    int           index, result;
+
+    while (1) {
+        pthread_mutex_lock(&batch->mutex);
+        index = batch->next < batch->count ? batch->next++ : -1;
+        pthread_mutex_unlock(&batch->mutex);
+
+        if (index < 0) {
+            break;
+        }
+
+        result = sign_document(worker->key_manager, batch->files[index]);
+
+        if (result != OPENDCP_NO_ERROR) {
+            pthread_mutex_lock(&batch->mutex);
+            batch->result = result;
+            pthread_mutex_unlock(&batch->mutex);
+        }
+    }
+
+    return NULL;
+}
+
+/*!
+ @function xml_sign_session_sign
+ @abstract Signs the templates in several xml files.
+ @discussion Up to the session's thread count of files are signed at once.
+     Every file is attempted even if an earlier one fails.
+ @param session The signing session.
+ @param files The xml files, each is rewritten with its signature.
+ @param count The number of files.
+ @return OPENDCP_NO_ERROR if every file was signed, otherwise OPENDCP_ERROR.
+*/
+int xml_sign_session_sign(xml_sign_session_t *session, char *files[], int count) {
+    sign_batch_t  batch;
+    sign_worker_t workers[SIGN_THREADS_MAX];
+    pthread_t     threads[SIGN_THREADS_MAX];
+    int           started[SIGN_THREADS_MAX];
+    int           nthreads, i;
+
+    memset(&batch, 0, sizeof(batch));
+    batch.session = session;
+    batch.files   = files;
+    batch.count   = count;
+    batch.result  = OPENDCP_NO_ERROR;
+    pthread_mutex_init(&batch.mutex, NULL);
+
+    nthreads = session->threads < count ? session->threads : count;
+    nthreads = nthreads > SIGN_THREADS_MAX ? SIGN_THREADS_MAX : nthreads;
+
+    for (i = 0; i < nthreads; i++) {
+        workers[i].batch       = &batch;
+        workers[i].key_manager = session->key_managers[i];
+
+        /* sign on this thread too, or alone if no thread could be started */
+        started[i] = i < nthreads - 1 && pthread_create(&threads[i], NULL, sign_worker, &workers[i]) == 0;
+    }
+
+    if (nthreads > 0) {
+        sign_worker(&workers[nthreads - 1]);
+    }
+
+    for (i = 0; i < nthreads; i++) {
+        if (started[i]) {
+            pthread_join(threads[i], NULL);
+        }
+    }
+
+    pthread_mutex_destroy(&batch.mutex);
+
+    return batch.result;
+}
+
+/*!
+ @function xml_sign_session_close
+ @abstract Releases the keys and certificates of a signing session.
+ @param session The signing session, may be NULL.
+*/
+void xml_sign_session_close(xml_sign_session_t *session) {
+    int i;
+
+    if (!session) {
+        return;
+    }
+
+    if (session->opendcp->xml_signature.session == session) {
+        session->opendcp->xml_signature.session = NULL;
+    }
+
+    for (i = 0; i < session->threads; i++) {
+        if (session->key_managers[i]) {
+            OPENDCP_LOG(LOG_DEBUG, "destroy key manager");
+            xmlSecKeysMngrDestroy(session->key_managers[i]);
+        }
+    }
+
+    free_dsig_certs(&session->certs);
+    free(session->key_managers);
+    free(session);
+
     xmlsec_close();
+}
 
-    return(result);
+int xml_sign(opendcp_t *opendcp, char *filename) {
+    xml_sign_session_t *session = opendcp->xml_signature.session;
+    int                result;
+
+    if (session) {
+        return xml_sign_session_sign(session, &filename, 1);
+    }
+
+    OPENDCP_LOG(LOG_DEBUG, "xmlsec_init");
+    session = xml_sign_session_open(opendcp, 1);
+
+    if (session == NULL) {
+        return OPENDCP_ERROR;
+    }
+
+    result = xml_sign_session_sign(session, &filename, 1);
+    xml_sign_session_close(session);
+
+    return result;
 }
 
-int xml_verify(char *filename) {
+/* a verify session, see xml_verify_session_open */
+typedef struct {
+    xmlSecKeysMngrPtr key_manager;
+    int               loaded;     /* certificates of the session store adopted by the keys manager */
+} verify_worker_t;
+
+struct xml_verify_session {
+    int             threads;
+    verify_worker_t *workers;
+    char            **certs;      /* base64 bodies of the certificates seen so far */
+    X509            **x509;       /* the certificates, parsed once for all threads */
+    int             ncerts;
+    pthread_mutex_t mutex;
+};
+
+/* add a certificate of a document to the session store, parsing it only the first time it is seen */
+static int verify_store_add(xml_verify_session_t *session, const char *cert) {
+    char **certs;
+    X509 **x509;
+    char *pem;
+    BIO  *bio;
+    X509 *x;
+    int  i, result = OPENDCP_NO_ERROR;
+
+    pthread_mutex_lock(&session->mutex);
+
+    for (i = 0; i < session->ncerts; i++) {
+        if (!strcmp(session->certs[i], cert)) {
+            pthread_mutex_unlock(&session->mutex);
+            return OPENDCP_NO_ERROR;
+        }
+    }
+
+    x   = NULL;
+    pem = malloc(strlen(cert) + 64);
+
+    if (pem) {
+        sprintf(pem, "-----BEGIN CERTIFICATE-----\n%s\n-----END CERTIFICATE-----\n", cert);
+
+        if ((bio = BIO_new_mem_buf(pem, -1))) {
+            x = PEM_read_bio_X509(bio, NULL, NULL, NULL);
+            BIO_free(bio);
+        }
+
+        free(pem);
+    }
+
+    certs = realloc(session->certs, (session->ncerts + 1) * sizeof(char *));
+
+    if (certs) {
+        session->certs = certs;
+    }
+
+    x509 = realloc(session->x509, (session->ncerts + 1) * sizeof(X509 *));
+
+    if (x509) {
+        session->x509 = x509;
+    }
+
+    if (!x || !certs || !x509 || !(certs[session->ncerts] = strdup(cert))) {
+        X509_free(x);
+        result = OPENDCP_ERROR;
+    }
+    else {
+        x509[session->ncerts++] = x;
+    }
+
+    pthread_mutex_unlock(&session->mutex);
+
+    return result;
+}
+
+/* hand the keys manager of a thread the certificates it does not have yet */
+static int verify_worker_sync(xml_verify_session_t *session, verify_worker_t *worker) {
+    xmlSecKeyDataStorePtr store;
+    X509                  *x;
+
+    store = xmlSecKeysMngrGetDataStore(worker->key_manager, xmlSecOpenSSLX509StoreId);
+
+    if (store == NULL) {
+        return OPENDCP_ERROR;
+    }
+
+    while (1) {
+        pthread_mutex_lock(&session->mutex);
+        x = worker->loaded < session->ncerts ? session->x509[worker->loaded] : NULL;
+
+        if (x) {
+            X509_up_ref(x);
+        }
+
+        pthread_mutex_unlock(&session->mutex);
+
+        if (!x) {
+            break;
+        }
+
+        if (xmlSecOpenSSLX509StoreAdoptCert(store, x, xmlSecKeyDataTypeTrusted) < 0) {
+            X509_free(x);
+            return OPENDCP_ERROR;
+        }
+
+        worker->loaded++;
+    }
+
+    return OPENDCP_NO_ERROR;
+}
+
+static int verify_document(xml_verify_session_t *session, verify_worker_t *worker, char *filename) {
     xmlSecDSigCtxPtr dsig_ctx = NULL;
     xmlDocPtr        doc = NULL;
     xmlNodePtr       root_node;
@@ -564,12 +935,8 @@ int xml_verify(char *filename) {
     xmlNodePtr       cert_node;
     xmlNodePtr       x509d_node;
     xmlNodePtr       cur_node;
+    xmlChar          *cert;
     int              result = OPENDCP_ERROR;
-    xmlSecKeysMngrPtr key_manager = NULL;
-    unsigned char cert[5000];
-    int  cert_l;
-
-    xmlsec_init();
 
     /* load doc file */
     doc = xmlParseFile(filename);
@@ -595,14 +962,6 @@ int xml_verify(char *filename) {
         goto done;
     }
 
-    /* create keys manager */
-    key_manager = load_certificates_verify();
-
-    if (key_manager == NULL) {
-        OPENDCP_LOG(LOG_ERROR, "create key manager failed");
-        goto done;
-    }
-
     /* find certificates */
     cur_node = sign_node;
 
@@ -614,19 +973,25 @@ int xml_verify(char *filename) {
             goto done;
         }
 
-        sprintf((char *)cert, "-----BEGIN CERTIFICATE-----\n%s\n-----END CERTIFICATE-----\n", xmlNodeGetContent(cert_node));
-        cert_l = strlen((char *)cert);
+        cert = xmlNodeGetContent(cert_node);
 
-        if (xmlSecCryptoAppKeysMngrCertLoadMemory(key_manager, cert, cert_l, xmlSecKeyDataFormatPem, xmlSecKeyDataTypeTrusted) < 0) {
+        if (cert == NULL || verify_store_add(session, (char *)cert) != OPENDCP_NO_ERROR) {
             OPENDCP_LOG(LOG_ERROR, "couldn't read X509certificate node value");
+            xmlFree(cert);
             goto done;
         }
 
+        xmlFree(cert);
         cur_node = xmlNextElementSibling(x509d_node);
     }
 
+    if (verify_worker_sync(session, worker) != OPENDCP_NO_ERROR) {
+        OPENDCP_LOG(LOG_ERROR, "couldn't load certificates into key manager");
+        goto done;
+    }
+
     /* create signature context */
-    dsig_ctx = xmlSecDSigCtxCreate(key_manager);
+    dsig_ctx = xmlSecDSigCtxCreate(worker->key_manager);
 
     if (dsig_ctx == NULL) {
         OPENDCP_LOG(LOG_ERROR, "create signature opendcp failed");
@@ -648,9 +1013,6 @@ int xml_verify(char *filename) {
     result = 0;
 
 done:
-    /* destroy keys manager */
-    xmlSecKeysMngrDestroy(key_manager);
-
     /* destroy signature context */
     if (dsig_ctx != NULL) {
         xmlSecDSigCtxDestroy(dsig_ctx);
@@ -661,6 +1023,304 @@ done:
         xmlFreeDoc(doc);
     }
 
-    xmlsec_close();
     return(result);
 }
+
+/*!
+ @function xml_verify_session_open
+ @abstract Sets up xmlsec once for verifying many signatures.
+ @discussion The certificates carried in the documents are kept in a store
+     shared by the session, so a certificate that signs many CPLs and PKLs is
+     parsed once. Each of the threads gets its own keys manager, fed from the
+     store, as xmlsec keys managers can not be shared between threads. A
+     certificate stays trusted for the rest of the session once a document
+     has carried it, the same trust a single document gives its own chain.
+ @param threads The number of documents xml_verify_session_verify checks at once.
+ @return The session, or NULL if xmlsec could not be set up.
+*/
+xml_verify_session_t *xml_verify_session_open(int threads) {
+    xml_verify_session_t *session;
+    int                  i;
+
+    if (threads < 1) {
+        threads = 1;
+    }
+
+    if (threads > VERIFY_THREADS_MAX) {
+        threads = VERIFY_THREADS_MAX;
+    }
+
+    if (xmlsec_init() != OPENDCP_NO_ERROR) {
+        return NULL;
+    }
+
+    session = calloc(1, sizeof(xml_verify_session_t));
+
+    if (session) {
+        session->workers = calloc(threads, sizeof(verify_worker_t));
+    }
+
+    if (!session || !session->workers) {
+        free(session);
+        xmlsec_close();
+        return NULL;
+    }
+
+    session->threads = threads;
+    pthread_mutex_init(&session->mutex, NULL);
+
+    for (i = 0; i < threads; i++) {
+        session->workers[i].key_manager = load_certificates_verify();
+
+        if (session->workers[i].key_manager == NULL) {
+            OPENDCP_LOG(LOG_ERROR, "create key manager failed");
+            xml_verify_session_close(session);
+            return NULL;
+        }
+    }
+
+    return session;
+}
+
+typedef struct {
+    xml_verify_session_t *session;
+    char                 **files;
+    int                  *results;
+    int                  count;
+    int                  next;
+    int                  result;
+    pthread_mutex_t      mutex;
+} verify_batch_t;
+
+typedef struct {
+    verify_batch_t  *batch;
+    verify_worker_t *worker;
+} verify_thread_t;
+
+static void *verify_thread(void *arg) {
+    verify_thread_t *thread = arg;
+    verify_batch_t  *batch = thread->batch;
+    int             index, result;
+
+    while (1) {
+        pthread_mutex_lock(&batch->mutex);
+        index = batch->next < batch->count ? batch->next++ : -1;
+        pthread_mutex_unlock(&batch->mutex);
+
+        if (index < 0) {
+            break;
+        }
+
+        result = verify_document(batch->session, thread->worker, batch->files[index]);
+
+        if (batch->results) {
+            batch->results[index] = result;
+        }
+
+        if (result != OPENDCP_NO_ERROR) {
+            pthread_mutex_lock(&batch->mutex);
+            batch->result = result;
+            pthread_mutex_unlock(&batch->mutex);
+        }
+    }
+
+    return NULL;
+}
+
+/*!
+ @function xml_verify_session_verify
+ @abstract Verifies the signatures of several xml files.
+ @discussion Up to the session's thread count of files are checked at once.
+     Every file is checked even if an earlier one fails.
+ @param session The verify session.
+ @param files The xml files.
+ @param results If not NULL, receives OPENDCP_NO_ERROR or OPENDCP_ERROR for each file.
+ @param count The number of files.
+ @return OPENDCP_NO_ERROR if every signature is valid, otherwise OPENDCP_ERROR.
+*/
+int xml_verify_session_verify(xml_verify_session_t *session, char *files[], int *results, int count) {
+    verify_batch_t  batch;
+    verify_thread_t workers[VERIFY_THREADS_MAX];
+    pthread_t       threads[VERIFY_THREADS_MAX];
+    int             started[VERIFY_THREADS_MAX];
+    int             nthreads, i;
+
+    memset(&batch, 0, sizeof(batch));
+    batch.session = session;
+    batch.files   = files;
+    batch.results = results;
+    batch.count   = count;
+    batch.result  = OPENDCP_NO_ERROR;
+    pthread_mutex_init(&batch.mutex, NULL);
+
+    nthreads = session->threads < count ? session->threads : count;
+
+    for (i = 0; i < nthreads; i++) {
+        workers[i].batch  = &batch;
+        workers[i].worker = &session->workers[i];
+
+        /* verify on this thread too, or alone if no thread could be started */
+        started[i] = i < nthreads - 1 && pthread_create(&threads[i], NULL, verify_thread, &workers[i]) == 0;
+    }
+
+    if (nthreads > 0) {
+        verify_thread(&workers[nthreads - 1]);
+    }
+
+    for (i = 0; i < nthreads; i++) {
+        if (started[i]) {
+            pthread_join(threads[i], NULL);
+        }
+    }
+
+    pthread_mutex_destroy(&batch.mutex);
+
+    return batch.result;
+}
+
+/*!
+ @function xml_verify_session_close
+ @abstract Releases the keys managers and certificates of a verify session.
+ @param session The verify session, may be NULL.
+*/
+void xml_verify_session_close(xml_verify_session_t *session) {
+    int i;
+
+    if (!session) {
+        return;
+    }
+
+    for (i = 0; i < session->threads; i++) {
+        if (session->workers[i].key_manager) {
+            xmlSecKeysMngrDestroy(session->workers[i].key_manager);
+        }
+    }
+
+    for (i = 0; i < session->ncerts; i++) {
+        free(session->certs[i]);
+        X509_free(session->x509[i]);
+    }
+
+    pthread_mutex_destroy(&session->mutex);
+    free(session->certs);
+    free(session->x509);
+    free(session->workers);
+    free(session);
+
+    xmlsec_close();
+}
+
+/* the root element of a signed document, read without parsing the rest of it */
+static int xml_verify_signed_type(const char *filename) {
+    xmlTextReaderPtr reader;
+    const xmlChar    *name;
+    int              signed_type = 0;
+
+    reader = xmlReaderForFile(filename, NULL, XML_PARSE_NONET | XML_PARSE_NOERROR | XML_PARSE_NOWARNING);
+
+    if (reader == NULL) {
+        return 0;
+    }
+
+    while (xmlTextReaderRead(reader) == 1) {
+        if (xmlTextReaderNodeType(reader) == XML_READER_TYPE_ELEMENT) {
+            name = xmlTextReaderConstLocalName(reader);
+            signed_type = name && (!xmlStrcmp(name, BAD_CAST "CompositionPlaylist") || !xmlStrcmp(name, BAD_CAST "PackingList"));
+            break;
+        }
+    }
+
+    xmlFreeTextReader(reader);
+
+    return signed_type;
+}
+
+static int xml_verify_walk(const char *dir, char ***files, int *nfiles) {
+    char          path[MAX_PATH_LENGTH];
+    struct dirent *entry;
+    struct stat   st;
+    const char    *ext;
+    char          **list;
+    DIR           *d;
+    int           result = OPENDCP_NO_ERROR;
+
+    if (!(d = opendir(dir))) {
+        OPENDCP_LOG(LOG_ERROR, "could not open directory %s", dir);
+        return OPENDCP_FILEOPEN;
+    }
+
+    while (result == OPENDCP_NO_ERROR && (entry = readdir(d))) {
+        if (!strcmp(entry->d_name, ".") || !strcmp(entry->d_name, "..")) {
+            continue;
+        }
+
+        snprintf(path, sizeof(path), "%s/%s", dir, entry->d_name);
+
+        if (stat(path, &st)) {
+            continue;
+        }
+
+        if (S_ISDIR(st.st_mode)) {
+            result = xml_verify_walk(path, files, nfiles);
+            continue;
+        }
+
+        ext = strrchr(entry->d_name, '.');
+
+        if (!S_ISREG(st.st_mode) || !ext || strcasecmp(ext, ".xml") || !xml_verify_signed_type(path)) {
+            continue;
+        }
+
+        list = realloc(*files, (*nfiles + 1) * sizeof(char *));
+
+        if (!list || !(list[*nfiles] = strdup(path))) {
+            if (list) {
+                *files = list;
+            }
+
+            result = OPENDCP_ERROR;
+            break;
+        }
+
+        *files = list;
+        (*nfiles)++;
+    }
+
+    closedir(d);
+
+    return result;
+}
+
+/*!
+ @function xml_verify_find
+ @abstract Lists the signed CPLs and PKLs under a directory.
+ @discussion The directory is searched recursively. An xml file is listed
+     when its root element is a CompositionPlaylist or a PackingList, only
+     the start of each file is read to tell. The list is appended to, so
+     several directories can be gathered into one batch.
+ @param path The directory to search.
+ @param files The list of files, grown with realloc and freed by the caller.
+ @param nfiles The number of files in the list.
+ @return OPENDCP_NO_ERROR on success, otherwise an error code.
+*/
+int xml_verify_find(const char *path, char ***files, int *nfiles) {
+    xmlInitParser();
+
+    return xml_verify_walk(path, files, nfiles);
+}
+
+int xml_verify(char *filename) {
+    xml_verify_session_t *session;
+    int                  result;
+
+    session = xml_verify_session_open(1);
+
+    if (session == NULL) {
+        return OPENDCP_ERROR;
+    }
+
+    result = xml_verify_session_verify(session, &filename, NULL, 1);
+    xml_verify_session_close(session);
+
+    return result;
+}
@@ -43,3810 +43,4 @@ enum LUT_OUT_ENUM {
     LO_MAX
 };
 
-static float GAMMA[5] = {
-    2.400000,    /* SRGB     */
-    2.222222,    /* REC709   */
-    2.600000,    /* P3       */
-    2.400000,    /* SRGB_COM */
-    2.222222,    /* REC709_C */
-};
-
-static float color_matrix[5][3][3] = {
-    /* SRGB */
-    {   {0.4124564, 0.3575761, 0.1804375},
-        {0.2126729, 0.7151522, 0.072175},
-        {0.0193339, 0.119192, 0.9503041}
-    },
-
-    /* REC709 */
-    {   {0.4123907993, 0.3575843394, 0.1804807884},
-        {0.2126390059, 0.7151686778, 0.0721923154},
-        {0.0193308187, 0.1191947798, 0.9505321522}
-    },
-
-    /* P3 */
-    {   {0.4451698156, 0.2771344092, 0.1722826698},
-        {0.2094916779, 0.7215952542, 0.0689130679},
-        {0.0, 0.0470605601, 0.9073553944}
-    },
-
-    /* SRGB_COMPLEX */
-    {   {0.4124564, 0.3575761, 0.1804375},
-        {0.2126729, 0.7151522, 0.072175},
-        {0.0193339, 0.119192, 0.9503041}
-    },
-
-    /* REC709_COMPLEX */
-    {   {0.4123907993, 0.3575843394, 0.1804807884},
-        {0.2126390059, 0.7151686778, 0.0721923154},
-        {0.0193308187, 0.1191947798, 0.9505321522}
-    },
-};
-
-static float lut_in[LI_MAX][COLOR_DEPTH + 1] = {
-    // Bit Depth:       12
-    // Reference White: SRGB
-    // Gamma:           2.4
-    {
-        0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000001, 0.000001, 0.000001, 0.000001, 0.000001, 0.000001, 0.000002,
-        0.000002, 0.000002, 0.000003, 0.000003, 0.000003, 0.000004, 0.000004, 0.000004, 0.000005, 0.000005, 0.000006, 0.000006, 0.000007, 0.000008, 0.000008, 0.000009, 0.000009,
-        0.000010, 0.000011, 0.000012, 0.000012, 0.000013, 0.000014, 0.000015, 0.000016, 0.000017, 0.000018, 0.000019, 0.000020, 0.000021, 0.000022, 0.000023, 0.000024, 0.000026,
-        0.000027, 0.000028, 0.000029, 0.000031, 0.000032, 0.000034, 0.000035, 0.000037, 0.000038, 0.000040, 0.000041, 0.000043, 0.000045, 0.000046, 0.000048, 0.000050, 0.000052,
-        0.000054, 0.000055, 0.000057, 0.000059, 0.000061, 0.000063, 0.000066, 0.000068, 0.000070, 0.000072, 0.000074, 0.000077, 0.000079, 0.000081, 0.000084, 0.000086, 0.000089,
-        0.000091, 0.000094, 0.000097, 0.000099, 0.000102, 0.000105, 0.000108, 0.000111, 0.000113, 0.000116, 0.000119, 0.000122, 0.000126, 0.000129, 0.000132, 0.000135, 0.000138,
-        0.000142, 0.000145, 0.000148, 0.000152, 0.000155, 0.000159, 0.000162, 0.000166, 0.000170, 0.000174, 0.000177, 0.000181, 0.000185, 0.000189, 0.000193, 0.000197, 0.000201,
-        0.000205, 0.000209, 0.000213, 0.000218, 0.000222, 0.000226, 0.000231, 0.000235, 0.000240, 0.000244, 0.000249, 0.000254, 0.000258, 0.000263, 0.000268, 0.000273, 0.000278,
-        0.000283, 0.000288, 0.000293, 0.000298, 0.000303, 0.000308, 0.000313, 0.000319, 0.000324, 0.000330, 0.000335, 0.000341, 0.000346, 0.000352, 0.000357, 0.000363, 0.000369,
-        0.000375, 0.000381, 0.000387, 0.000393, 0.000399, 0.000405, 0.000411, 0.000417, 0.000424, 0.000430, 0.000436, 0.000443, 0.000449, 0.000456, 0.000462, 0.000469, 0.000476,
-        0.000483, 0.000490, 0.000496, 0.000503, 0.000510, 0.000517, 0.000525, 0.000532, 0.000539, 0.000546, 0.000554, 0.000561, 0.000569, 0.000576, 0.000584, 0.000591, 0.000599,
-        0.000607, 0.000615, 0.000622, 0.000630, 0.000638, 0.000646, 0.000655, 0.000663, 0.000671, 0.000679, 0.000688, 0.000696, 0.000704, 0.000713, 0.000722, 0.000730, 0.000739,
-        0.000748, 0.000756, 0.000765, 0.000774, 0.000783, 0.000792, 0.000802, 0.000811, 0.000820, 0.000829, 0.000839, 0.000848, 0.000858, 0.000867, 0.000877, 0.000886, 0.000896,
-        0.000906, 0.000916, 0.000926, 0.000936, 0.000946, 0.000956, 0.000966, 0.000976, 0.000987, 0.000997, 0.001008, 0.001018, 0.001029, 0.001039, 0.001050, 0.001061, 0.001071,
-        0.001082, 0.001093, 0.001104, 0.001115, 0.001127, 0.001138, 0.001149, 0.001160, 0.001172, 0.001183, 0.001195, 0.001206, 0.001218, 0.001230, 0.001242, 0.001253, 0.001265,
-        0.001277, 0.001289, 0.001301, 0.001314, 0.001326, 0.001338, 0.001351, 0.001363, 0.001376, 0.001388, 0.001401, 0.001414, 0.001426, 0.001439, 0.001452, 0.001465, 0.001478,
-        0.001491, 0.001504, 0.001518, 0.001531, 0.001544, 0.001558, 0.001571, 0.001585, 0.001599, 0.001612, 0.001626, 0.001640, 0.001654, 0.001668, 0.001682, 0.001696, 0.001711,
-        0.001725, 0.001739, 0.001754, 0.001768, 0.001783, 0.001797, 0.001812, 0.001827, 0.001842, 0.001857, 0.001872, 0.001887, 0.001902, 0.001917, 0.001932, 0.001948, 0.001963,
-        0.001978, 0.001994, 0.002010, 0.002025, 0.002041, 0.002057, 0.002073, 0.002089, 0.002105, 0.002121, 0.002137, 0.002153, 0.002170, 0.002186, 0.002203, 0.002219, 0.002236,
-        0.002253, 0.002269, 0.002286, 0.002303, 0.002320, 0.002337, 0.002354, 0.002372, 0.002389, 0.002406, 0.002424, 0.002441, 0.002459, 0.002476, 0.002494, 0.002512, 0.002530,
-        0.002548, 0.002566, 0.002584, 0.002602, 0.002620, 0.002638, 0.002657, 0.002675, 0.002694, 0.002713, 0.002731, 0.002750, 0.002769, 0.002788, 0.002807, 0.002826, 0.002845,
-        0.002864, 0.002883, 0.002903, 0.002922, 0.002942, 0.002961, 0.002981, 0.003001, 0.003021, 0.003041, 0.003060, 0.003081, 0.003101, 0.003121, 0.003141, 0.003162, 0.003182,
-        0.003202, 0.003223, 0.003244, 0.003264, 0.003285, 0.003306, 0.003327, 0.003348, 0.003369, 0.003391, 0.003412, 0.003433, 0.003455, 0.003476, 0.003498, 0.003519, 0.003541,
-        0.003563, 0.003585, 0.003607, 0.003629, 0.003651, 0.003673, 0.003696, 0.003718, 0.003740, 0.003763, 0.003786, 0.003808, 0.003831, 0.003854, 0.003877, 0.003900, 0.003923,
-        0.003946, 0.003969, 0.003993, 0.004016, 0.004040, 0.004063, 0.004087, 0.004111, 0.004134, 0.004158, 0.004182, 0.004206, 0.004230, 0.004255, 0.004279, 0.004303, 0.004328,
-        0.004352, 0.004377, 0.004402, 0.004426, 0.004451, 0.004476, 0.004501, 0.004526, 0.004552, 0.004577, 0.004602, 0.004628, 0.004653, 0.004679, 0.004704, 0.004730, 0.004756,
-        0.004782, 0.004808, 0.004834, 0.004860, 0.004886, 0.004913, 0.004939, 0.004966, 0.004992, 0.005019, 0.005046, 0.005073, 0.005099, 0.005126, 0.005154, 0.005181, 0.005208,
-        0.005235, 0.005263, 0.005290, 0.005318, 0.005345, 0.005373, 0.005401, 0.005429, 0.005457, 0.005485, 0.005513, 0.005541, 0.005570, 0.005598, 0.005627, 0.005655, 0.005684,
-        0.005713, 0.005742, 0.005771, 0.005800, 0.005829, 0.005858, 0.005887, 0.005916, 0.005946, 0.005975, 0.006005, 0.006035, 0.006065, 0.006094, 0.006124, 0.006154, 0.006185,
-        0.006215, 0.006245, 0.006275, 0.006306, 0.006336, 0.006367, 0.006398, 0.006429, 0.006460, 0.006491, 0.006522, 0.006553, 0.006584, 0.006615, 0.006647, 0.006678, 0.006710,
-        0.006742, 0.006773, 0.006805, 0.006837, 0.006869, 0.006901, 0.006933, 0.006966, 0.006998, 0.007031, 0.007063, 0.007096, 0.007129, 0.007161, 0.007194, 0.007227, 0.007260,
-        0.007294, 0.007327, 0.007360, 0.007394, 0.007427, 0.007461, 0.007494, 0.007528, 0.007562, 0.007596, 0.007630, 0.007664, 0.007698, 0.007733, 0.007767, 0.007802, 0.007836,
-        0.007871, 0.007906, 0.007941, 0.007976, 0.008011, 0.008046, 0.008081, 0.008116, 0.008152, 0.008187, 0.008223, 0.008258, 0.008294, 0.008330, 0.008366, 0.008402, 0.008438,
-        0.008474, 0.008511, 0.008547, 0.008583, 0.008620, 0.008657, 0.008693, 0.008730, 0.008767, 0.008804, 0.008841, 0.008879, 0.008916, 0.008953, 0.008991, 0.009028, 0.009066,
-        0.009104, 0.009142, 0.009179, 0.009218, 0.009256, 0.009294, 0.009332, 0.009371, 0.009409, 0.009448, 0.009486, 0.009525, 0.009564, 0.009603, 0.009642, 0.009681, 0.009720,
-        0.009760, 0.009799, 0.009839, 0.009878, 0.009918, 0.009958, 0.009997, 0.010037, 0.010077, 0.010118, 0.010158, 0.010198, 0.010239, 0.010279, 0.010320, 0.010361, 0.010401,
-        0.010442, 0.010483, 0.010524, 0.010566, 0.010607, 0.010648, 0.010690, 0.010731, 0.010773, 0.010815, 0.010856, 0.010898, 0.010940, 0.010983, 0.011025, 0.011067, 0.011109,
-        0.011152, 0.011195, 0.011237, 0.011280, 0.011323, 0.011366, 0.011409, 0.011452, 0.011495, 0.011539, 0.011582, 0.011626, 0.011669, 0.011713, 0.011757, 0.011801, 0.011845,
-        0.011889, 0.011933, 0.011978, 0.012022, 0.012067, 0.012111, 0.012156, 0.012201, 0.012246, 0.012291, 0.012336, 0.012381, 0.012426, 0.012471, 0.012517, 0.012562, 0.012608,
-        0.012654, 0.012700, 0.012746, 0.012792, 0.012838, 0.012884, 0.012930, 0.012977, 0.013023, 0.013070, 0.013117, 0.013164, 0.013211, 0.013258, 0.013305, 0.013352, 0.013399,
-        0.013447, 0.013494, 0.013542, 0.013589, 0.013637, 0.013685, 0.013733, 0.013781, 0.013829, 0.013878, 0.013926, 0.013975, 0.014023, 0.014072, 0.014121, 0.014169, 0.014218,
-        0.014268, 0.014317, 0.014366, 0.014415, 0.014465, 0.014514, 0.014564, 0.014614, 0.014664, 0.014714, 0.014764, 0.014814, 0.014864, 0.014915, 0.014965, 0.015016, 0.015066,
-        0.015117, 0.015168, 0.015219, 0.015270, 0.015321, 0.015372, 0.015424, 0.015475, 0.015527, 0.015578, 0.015630, 0.015682, 0.015734, 0.015786, 0.015838, 0.015890, 0.015943,
-        0.015995, 0.016048, 0.016101, 0.016153, 0.016206, 0.016259, 0.016312, 0.016365, 0.016419, 0.016472, 0.016525, 0.016579, 0.016633, 0.016687, 0.016740, 0.016794, 0.016848,
-        0.016903, 0.016957, 0.017011, 0.017066, 0.017120, 0.017175, 0.017230, 0.017285, 0.017340, 0.017395, 0.017450, 0.017505, 0.017561, 0.017616, 0.017672, 0.017728, 0.017783,
-        0.017839, 0.017895, 0.017951, 0.018008, 0.018064, 0.018120, 0.018177, 0.018234, 0.018290, 0.018347, 0.018404, 0.018461, 0.018518, 0.018576, 0.018633, 0.018690, 0.018748,
-        0.018806, 0.018863, 0.018921, 0.018979, 0.019037, 0.019095, 0.019154, 0.019212, 0.019271, 0.019329, 0.019388, 0.019447, 0.019506, 0.019565, 0.019624, 0.019683, 0.019742,
-        0.019802, 0.019861, 0.019921, 0.019981, 0.020040, 0.020100, 0.020160, 0.020221, 0.020281, 0.020341, 0.020402, 0.020462, 0.020523, 0.020584, 0.020645, 0.020706, 0.020767,
-        0.020828, 0.020889, 0.020951, 0.021012, 0.021074, 0.021136, 0.021197, 0.021259, 0.021321, 0.021384, 0.021446, 0.021508, 0.021571, 0.021633, 0.021696, 0.021759, 0.021822,
-        0.021885, 0.021948, 0.022011, 0.022074, 0.022138, 0.022201, 0.022265, 0.022329, 0.022392, 0.022456, 0.022520, 0.022585, 0.022649, 0.022713, 0.022778, 0.022842, 0.022907,
-        0.022972, 0.023037, 0.023102, 0.023167, 0.023232, 0.023297, 0.023363, 0.023429, 0.023494, 0.023560, 0.023626, 0.023692, 0.023758, 0.023824, 0.023890, 0.023957, 0.024023,
-        0.024090, 0.024157, 0.024224, 0.024291, 0.024358, 0.024425, 0.024492, 0.024559, 0.024627, 0.024695, 0.024762, 0.024830, 0.024898, 0.024966, 0.025034, 0.025102, 0.025171,
-        0.025239, 0.025308, 0.025376, 0.025445, 0.025514, 0.025583, 0.025652, 0.025722, 0.025791, 0.025860, 0.025930, 0.026000, 0.026069, 0.026139, 0.026209, 0.026279, 0.026350,
-        0.026420, 0.026490, 0.026561, 0.026631, 0.026702, 0.026773, 0.026844, 0.026915, 0.026986, 0.027058, 0.027129, 0.027201, 0.027272, 0.027344, 0.027416, 0.027488, 0.027560,
-        0.027632, 0.027704, 0.027777, 0.027849, 0.027922, 0.027995, 0.028067, 0.028140, 0.028214, 0.028287, 0.028360, 0.028433, 0.028507, 0.028581, 0.028654, 0.028728, 0.028802,
-        0.028876, 0.028950, 0.029025, 0.029099, 0.029173, 0.029248, 0.029323, 0.029398, 0.029473, 0.029548, 0.029623, 0.029698, 0.029774, 0.029849, 0.029925, 0.030000, 0.030076,
-        0.030152, 0.030228, 0.030304, 0.030381, 0.030457, 0.030534, 0.030610, 0.030687, 0.030764, 0.030841, 0.030918, 0.030995, 0.031072, 0.031150, 0.031227, 0.031305, 0.031383,
-        0.031461, 0.031539, 0.031617, 0.031695, 0.031773, 0.031852, 0.031930, 0.032009, 0.032088, 0.032167, 0.032245, 0.032325, 0.032404, 0.032483, 0.032563, 0.032642, 0.032722,
-        0.032802, 0.032882, 0.032962, 0.033042, 0.033122, 0.033202, 0.033283, 0.033363, 0.033444, 0.033525, 0.033606, 0.033687, 0.033768, 0.033849, 0.033931, 0.034012, 0.034094,
-        0.034175, 0.034257, 0.034339, 0.034421, 0.034503, 0.034586, 0.034668, 0.034751, 0.034833, 0.034916, 0.034999, 0.035082, 0.035165, 0.035248, 0.035331, 0.035415, 0.035498,
-        0.035582, 0.035666, 0.035750, 0.035834, 0.035918, 0.036002, 0.036086, 0.036171, 0.036256, 0.036340, 0.036425, 0.036510, 0.036595, 0.036680, 0.036765, 0.036851, 0.036936,
-        0.037022, 0.037108, 0.037194, 0.037280, 0.037366, 0.037452, 0.037538, 0.037625, 0.037711, 0.037798, 0.037885, 0.037971, 0.038059, 0.038146, 0.038233, 0.038320, 0.038408,
-        0.038495, 0.038583, 0.038671, 0.038759, 0.038847, 0.038935, 0.039023, 0.039112, 0.039200, 0.039289, 0.039378, 0.039467, 0.039556, 0.039645, 0.039734, 0.039823, 0.039913,
-        0.040002, 0.040092, 0.040182, 0.040272, 0.040362, 0.040452, 0.040542, 0.040633, 0.040723, 0.040814, 0.040905, 0.040995, 0.041086, 0.041178, 0.041269, 0.041360, 0.041452,
-        0.041543, 0.041635, 0.041727, 0.041819, 0.041911, 0.042003, 0.042095, 0.042188, 0.042280, 0.042373, 0.042465, 0.042558, 0.042651, 0.042744, 0.042838, 0.042931, 0.043025,
-        0.043118, 0.043212, 0.043306, 0.043400, 0.043494, 0.043588, 0.043682, 0.043777, 0.043871, 0.043966, 0.044061, 0.044155, 0.044251, 0.044346, 0.044441, 0.044536, 0.044632,
-        0.044727, 0.044823, 0.044919, 0.045015, 0.045111, 0.045207, 0.045304, 0.045400, 0.045497, 0.045593, 0.045690, 0.045787, 0.045884, 0.045981, 0.046079, 0.046176, 0.046273,
-        0.046371, 0.046469, 0.046567, 0.046665, 0.046763, 0.046861, 0.046960, 0.047058, 0.047157, 0.047255, 0.047354, 0.047453, 0.047552, 0.047651, 0.047751, 0.047850, 0.047950,
-        0.048050, 0.048149, 0.048249, 0.048349, 0.048450, 0.048550, 0.048650, 0.048751, 0.048851, 0.048952, 0.049053, 0.049154, 0.049255, 0.049357, 0.049458, 0.049560, 0.049661,
-        0.049763, 0.049865, 0.049967, 0.050069, 0.050171, 0.050274, 0.050376, 0.050479, 0.050581, 0.050684, 0.050787, 0.050890, 0.050993, 0.051097, 0.051200, 0.051304, 0.051408,
-        0.051511, 0.051615, 0.051719, 0.051824, 0.051928, 0.052032, 0.052137, 0.052242, 0.052346, 0.052451, 0.052556, 0.052662, 0.052767, 0.052872, 0.052978, 0.053083, 0.053189,
-        0.053295, 0.053401, 0.053507, 0.053614, 0.053720, 0.053827, 0.053933, 0.054040, 0.054147, 0.054254, 0.054361, 0.054468, 0.054576, 0.054683, 0.054791, 0.054899, 0.055007,
-        0.055115, 0.055223, 0.055331, 0.055439, 0.055548, 0.055656, 0.055765, 0.055874, 0.055983, 0.056092, 0.056201, 0.056311, 0.056420, 0.056530, 0.056640, 0.056749, 0.056859,
-        0.056970, 0.057080, 0.057190, 0.057301, 0.057411, 0.057522, 0.057633, 0.057744, 0.057855, 0.057966, 0.058078, 0.058189, 0.058301, 0.058412, 0.058524, 0.058636, 0.058748,
-        0.058861, 0.058973, 0.059085, 0.059198, 0.059311, 0.059424, 0.059537, 0.059650, 0.059763, 0.059876, 0.059990, 0.060103, 0.060217, 0.060331, 0.060445, 0.060559, 0.060673,
-        0.060788, 0.060902, 0.061017, 0.061131, 0.061246, 0.061361, 0.061476, 0.061592, 0.061707, 0.061823, 0.061938, 0.062054, 0.062170, 0.062286, 0.062402, 0.062518, 0.062634,
-        0.062751, 0.062868, 0.062984, 0.063101, 0.063218, 0.063335, 0.063453, 0.063570, 0.063688, 0.063805, 0.063923, 0.064041, 0.064159, 0.064277, 0.064395, 0.064514, 0.064632,
-        0.064751, 0.064870, 0.064989, 0.065108, 0.065227, 0.065346, 0.065465, 0.065585, 0.065705, 0.065825, 0.065944, 0.066064, 0.066185, 0.066305, 0.066425, 0.066546, 0.066667,
-        0.066787, 0.066908, 0.067030, 0.067151, 0.067272, 0.067393, 0.067515, 0.067637, 0.067759, 0.067881, 0.068003, 0.068125, 0.068247, 0.068370, 0.068492, 0.068615, 0.068738,
-        0.068861, 0.068984, 0.069107, 0.069231, 0.069354, 0.069478, 0.069602, 0.069726, 0.069850, 0.069974, 0.070098, 0.070222, 0.070347, 0.070472, 0.070596, 0.070721, 0.070846,
-        0.070972, 0.071097, 0.071222, 0.071348, 0.071474, 0.071599, 0.071725, 0.071851, 0.071978, 0.072104, 0.072230, 0.072357, 0.072484, 0.072611, 0.072738, 0.072865, 0.072992,
-        0.073119, 0.073247, 0.073374, 0.073502, 0.073630, 0.073758, 0.073886, 0.074015, 0.074143, 0.074272, 0.074400, 0.074529, 0.074658, 0.074787, 0.074916, 0.075046, 0.075175,
-        0.075305, 0.075434, 0.075564, 0.075694, 0.075824, 0.075954, 0.076085, 0.076215, 0.076346, 0.076477, 0.076608, 0.076739, 0.076870, 0.077001, 0.077132, 0.077264, 0.077396,
-        0.077527, 0.077659, 0.077791, 0.077924, 0.078056, 0.078188, 0.078321, 0.078454, 0.078587, 0.078720, 0.078853, 0.078986, 0.079119, 0.079253, 0.079386, 0.079520, 0.079654,
-        0.079788, 0.079922, 0.080057, 0.080191, 0.080326, 0.080460, 0.080595, 0.080730, 0.080865, 0.081000, 0.081136, 0.081271, 0.081407, 0.081543, 0.081678, 0.081814, 0.081951,
-        0.082087, 0.082223, 0.082360, 0.082496, 0.082633, 0.082770, 0.082907, 0.083044, 0.083182, 0.083319, 0.083457, 0.083595, 0.083732, 0.083870, 0.084009, 0.084147, 0.084285,
-        0.084424, 0.084562, 0.084701, 0.084840, 0.084979, 0.085118, 0.085258, 0.085397, 0.085537, 0.085676, 0.085816, 0.085956, 0.086096, 0.086237, 0.086377, 0.086517, 0.086658,
-        0.086799, 0.086940, 0.087081, 0.087222, 0.087363, 0.087505, 0.087646, 0.087788, 0.087930, 0.088072, 0.088214, 0.088356, 0.088499, 0.088641, 0.088784, 0.088927, 0.089070,
-        0.089213, 0.089356, 0.089499, 0.089643, 0.089786, 0.089930, 0.090074, 0.090218, 0.090362, 0.090506, 0.090651, 0.090795, 0.090940, 0.091085, 0.091230, 0.091375, 0.091520,
-        0.091665, 0.091811, 0.091956, 0.092102, 0.092248, 0.092394, 0.092540, 0.092686, 0.092833, 0.092979, 0.093126, 0.093273, 0.093420, 0.093567, 0.093714, 0.093861, 0.094009,
-        0.094156, 0.094304, 0.094452, 0.094600, 0.094748, 0.094897, 0.095045, 0.095194, 0.095342, 0.095491, 0.095640, 0.095789, 0.095939, 0.096088, 0.096237, 0.096387, 0.096537,
-        0.096687, 0.096837, 0.096987, 0.097137, 0.097288, 0.097439, 0.097589, 0.097740, 0.097891, 0.098042, 0.098194, 0.098345, 0.098497, 0.098648, 0.098800, 0.098952, 0.099104,
-        0.099256, 0.099409, 0.099561, 0.099714, 0.099867, 0.100020, 0.100173, 0.100326, 0.100479, 0.100633, 0.100786, 0.100940, 0.101094, 0.101248, 0.101402, 0.101557, 0.101711,
-        0.101865, 0.102020, 0.102175, 0.102330, 0.102485, 0.102640, 0.102796, 0.102951, 0.103107, 0.103263, 0.103419, 0.103575, 0.103731, 0.103887, 0.104044, 0.104200, 0.104357,
-        0.104514, 0.104671, 0.104828, 0.104986, 0.105143, 0.105301, 0.105458, 0.105616, 0.105774, 0.105932, 0.106091, 0.106249, 0.106408, 0.106566, 0.106725, 0.106884, 0.107043,
-        0.107202, 0.107362, 0.107521, 0.107681, 0.107841, 0.108001, 0.108161, 0.108321, 0.108481, 0.108642, 0.108802, 0.108963, 0.109124, 0.109285, 0.109446, 0.109608, 0.109769,
-        0.109931, 0.110092, 0.110254, 0.110416, 0.110578, 0.110741, 0.110903, 0.111066, 0.111228, 0.111391, 0.111554, 0.111717, 0.111881, 0.112044, 0.112208, 0.112371, 0.112535,
-        0.112699, 0.112863, 0.113027, 0.113192, 0.113356, 0.113521, 0.113686, 0.113851, 0.114016, 0.114181, 0.114346, 0.114512, 0.114677, 0.114843, 0.115009, 0.115175, 0.115341,
-        0.115508, 0.115674, 0.115841, 0.116007, 0.116174, 0.116341, 0.116509, 0.116676, 0.116843, 0.117011, 0.117179, 0.117346, 0.117514, 0.117683, 0.117851, 0.118019, 0.118188,
-        0.118357, 0.118525, 0.118694, 0.118864, 0.119033, 0.119202, 0.119372, 0.119542, 0.119711, 0.119881, 0.120051, 0.120222, 0.120392, 0.120563, 0.120733, 0.120904, 0.121075,
-        0.121246, 0.121417, 0.121589, 0.121760, 0.121932, 0.122104, 0.122276, 0.122448, 0.122620, 0.122792, 0.122965, 0.123138, 0.123310, 0.123483, 0.123656, 0.123830, 0.124003,
-        0.124176, 0.124350, 0.124524, 0.124698, 0.124872, 0.125046, 0.125220, 0.125395, 0.125570, 0.125744, 0.125919, 0.126094, 0.126270, 0.126445, 0.126620, 0.126796, 0.126972,
-        0.127148, 0.127324, 0.127500, 0.127676, 0.127853, 0.128029, 0.128206, 0.128383, 0.128560, 0.128737, 0.128915, 0.129092, 0.129270, 0.129447, 0.129625, 0.129803, 0.129982,
-        0.130160, 0.130338, 0.130517, 0.130696, 0.130875, 0.131054, 0.131233, 0.131412, 0.131592, 0.131771, 0.131951, 0.132131, 0.132311, 0.132491, 0.132672, 0.132852, 0.133033,
-        0.133213, 0.133394, 0.133575, 0.133757, 0.133938, 0.134119, 0.134301, 0.134483, 0.134665, 0.134847, 0.135029, 0.135211, 0.135394, 0.135576, 0.135759, 0.135942, 0.136125,
-        0.136308, 0.136492, 0.136675, 0.136859, 0.137043, 0.137226, 0.137411, 0.137595, 0.137779, 0.137964, 0.138148, 0.138333, 0.138518, 0.138703, 0.138888, 0.139074, 0.139259,
-        0.139445, 0.139631, 0.139816, 0.140003, 0.140189, 0.140375, 0.140562, 0.140748, 0.140935, 0.141122, 0.141309, 0.141496, 0.141684, 0.141871, 0.142059, 0.142247, 0.142435,
-        0.142623, 0.142811, 0.142999, 0.143188, 0.143377, 0.143566, 0.143755, 0.143944, 0.144133, 0.144322, 0.144512, 0.144702, 0.144891, 0.145081, 0.145272, 0.145462, 0.145652,
-        0.145843, 0.146034, 0.146224, 0.146415, 0.146607, 0.146798, 0.146989, 0.147181, 0.147373, 0.147565, 0.147757, 0.147949, 0.148141, 0.148333, 0.148526, 0.148719, 0.148912,
-        0.149105, 0.149298, 0.149491, 0.149685, 0.149878, 0.150072, 0.150266, 0.150460, 0.150654, 0.150849, 0.151043, 0.151238, 0.151433, 0.151628, 0.151823, 0.152018, 0.152213,
-        0.152409, 0.152605, 0.152800, 0.152996, 0.153193, 0.153389, 0.153585, 0.153782, 0.153978, 0.154175, 0.154372, 0.154569, 0.154767, 0.154964, 0.155162, 0.155360, 0.155557,
-        0.155755, 0.155954, 0.156152, 0.156350, 0.156549, 0.156748, 0.156947, 0.157146, 0.157345, 0.157544, 0.157744, 0.157943, 0.158143, 0.158343, 0.158543, 0.158743, 0.158944,
-        0.159144, 0.159345, 0.159546, 0.159747, 0.159948, 0.160149, 0.160351, 0.160552, 0.160754, 0.160956, 0.161158, 0.161360, 0.161562, 0.161765, 0.161967, 0.162170, 0.162373,
-        0.162576, 0.162779, 0.162982, 0.163186, 0.163390, 0.163593, 0.163797, 0.164001, 0.164206, 0.164410, 0.164614, 0.164819, 0.165024, 0.165229, 0.165434, 0.165639, 0.165845,
-        0.166050, 0.166256, 0.166462, 0.166668, 0.166874, 0.167080, 0.167287, 0.167493, 0.167700, 0.167907, 0.168114, 0.168321, 0.168529, 0.168736, 0.168944, 0.169152, 0.169360,
-        0.169568, 0.169776, 0.169984, 0.170193, 0.170401, 0.170610, 0.170819, 0.171028, 0.171238, 0.171447, 0.171657, 0.171866, 0.172076, 0.172286, 0.172497, 0.172707, 0.172917,
-        0.173128, 0.173339, 0.173550, 0.173761, 0.173972, 0.174183, 0.174395, 0.174607, 0.174818, 0.175030, 0.175242, 0.175455, 0.175667, 0.175880, 0.176092, 0.176305, 0.176518,
-        0.176732, 0.176945, 0.177158, 0.177372, 0.177586, 0.177800, 0.178014, 0.178228, 0.178442, 0.178657, 0.178872, 0.179086, 0.179301, 0.179517, 0.179732, 0.179947, 0.180163,
-        0.180379, 0.180594, 0.180810, 0.181027, 0.181243, 0.181459, 0.181676, 0.181893, 0.182110, 0.182327, 0.182544, 0.182762, 0.182979, 0.183197, 0.183415, 0.183633, 0.183851,
-        0.184069, 0.184287, 0.184506, 0.184725, 0.184944, 0.185163, 0.185382, 0.185601, 0.185821, 0.186041, 0.186260, 0.186480, 0.186700, 0.186921, 0.187141, 0.187362, 0.187582,
-        0.187803, 0.188024, 0.188245, 0.188467, 0.188688, 0.188910, 0.189132, 0.189354, 0.189576, 0.189798, 0.190020, 0.190243, 0.190465, 0.190688, 0.190911, 0.191134, 0.191358,
-        0.191581, 0.191805, 0.192029, 0.192252, 0.192477, 0.192701, 0.192925, 0.193150, 0.193374, 0.193599, 0.193824, 0.194049, 0.194275, 0.194500, 0.194726, 0.194951, 0.195177,
-        0.195403, 0.195629, 0.195856, 0.196082, 0.196309, 0.196536, 0.196763, 0.196990, 0.197217, 0.197444, 0.197672, 0.197900, 0.198128, 0.198356, 0.198584, 0.198812, 0.199041,
-        0.199269, 0.199498, 0.199727, 0.199956, 0.200185, 0.200415, 0.200644, 0.200874, 0.201104, 0.201334, 0.201564, 0.201794, 0.202025, 0.202256, 0.202486, 0.202717, 0.202948,
-        0.203180, 0.203411, 0.203643, 0.203874, 0.204106, 0.204338, 0.204570, 0.204803, 0.205035, 0.205268, 0.205501, 0.205733, 0.205967, 0.206200, 0.206433, 0.206667, 0.206900,
-        0.207134, 0.207368, 0.207603, 0.207837, 0.208071, 0.208306, 0.208541, 0.208776, 0.209011, 0.209246, 0.209481, 0.209717, 0.209953, 0.210189, 0.210425, 0.210661, 0.210897,
-        0.211134, 0.211370, 0.211607, 0.211844, 0.212081, 0.212318, 0.212556, 0.212793, 0.213031, 0.213269, 0.213507, 0.213745, 0.213984, 0.214222, 0.214461, 0.214699, 0.214938,
-        0.215178, 0.215417, 0.215656, 0.215896, 0.216136, 0.216375, 0.216616, 0.216856, 0.217096, 0.217337, 0.217577, 0.217818, 0.218059, 0.218300, 0.218542, 0.218783, 0.219025,
-        0.219266, 0.219508, 0.219750, 0.219993, 0.220235, 0.220477, 0.220720, 0.220963, 0.221206, 0.221449, 0.221693, 0.221936, 0.222180, 0.222423, 0.222667, 0.222911, 0.223156,
-        0.223400, 0.223645, 0.223889, 0.224134, 0.224379, 0.224624, 0.224870, 0.225115, 0.225361, 0.225607, 0.225853, 0.226099, 0.226345, 0.226592, 0.226838, 0.227085, 0.227332,
-        0.227579, 0.227826, 0.228074, 0.228321, 0.228569, 0.228817, 0.229065, 0.229313, 0.229561, 0.229810, 0.230058, 0.230307, 0.230556, 0.230805, 0.231054, 0.231304, 0.231553,
-        0.231803, 0.232053, 0.232303, 0.232553, 0.232804, 0.233054, 0.233305, 0.233556, 0.233807, 0.234058, 0.234309, 0.234560, 0.234812, 0.235064, 0.235316, 0.235568, 0.235820,
-        0.236073, 0.236325, 0.236578, 0.236831, 0.237084, 0.237337, 0.237590, 0.237844, 0.238097, 0.238351, 0.238605, 0.238859, 0.239114, 0.239368, 0.239623, 0.239878, 0.240132,
-        0.240388, 0.240643, 0.240898, 0.241154, 0.241409, 0.241665, 0.241921, 0.242178, 0.242434, 0.242690, 0.242947, 0.243204, 0.243461, 0.243718, 0.243975, 0.244233, 0.244490,
-        0.244748, 0.245006, 0.245264, 0.245523, 0.245781, 0.246039, 0.246298, 0.246557, 0.246816, 0.247075, 0.247335, 0.247594, 0.247854, 0.248114, 0.248374, 0.248634, 0.248894,
-        0.249155, 0.249415, 0.249676, 0.249937, 0.250198, 0.250459, 0.250721, 0.250982, 0.251244, 0.251506, 0.251768, 0.252030, 0.252293, 0.252555, 0.252818, 0.253081, 0.253344,
-        0.253607, 0.253870, 0.254134, 0.254398, 0.254661, 0.254925, 0.255190, 0.255454, 0.255718, 0.255983, 0.256248, 0.256513, 0.256778, 0.257043, 0.257308, 0.257574, 0.257840,
-        0.258106, 0.258372, 0.258638, 0.258904, 0.259171, 0.259437, 0.259704, 0.259971, 0.260238, 0.260506, 0.260773, 0.261041, 0.261309, 0.261577, 0.261845, 0.262113, 0.262382,
-        0.262650, 0.262919, 0.263188, 0.263457, 0.263726, 0.263996, 0.264265, 0.264535, 0.264805, 0.265075, 0.265345, 0.265616, 0.265886, 0.266157, 0.266428, 0.266699, 0.266970,
-        0.267241, 0.267513, 0.267784, 0.268056, 0.268328, 0.268600, 0.268873, 0.269145, 0.269418, 0.269691, 0.269964, 0.270237, 0.270510, 0.270783, 0.271057, 0.271331, 0.271605,
-        0.271879, 0.272153, 0.272427, 0.272702, 0.272977, 0.273252, 0.273527, 0.273802, 0.274077, 0.274353, 0.274628, 0.274904, 0.275180, 0.275457, 0.275733, 0.276009, 0.276286,
-        0.276563, 0.276840, 0.277117, 0.277394, 0.277672, 0.277949, 0.278227, 0.278505, 0.278783, 0.279062, 0.279340, 0.279619, 0.279897, 0.280176, 0.280455, 0.280735, 0.281014,
-        0.281294, 0.281573, 0.281853, 0.282133, 0.282414, 0.282694, 0.282975, 0.283255, 0.283536, 0.283817, 0.284098, 0.284380, 0.284661, 0.284943, 0.285225, 0.285507, 0.285789,
-        0.286071, 0.286354, 0.286637, 0.286919, 0.287202, 0.287486, 0.287769, 0.288052, 0.288336, 0.288620, 0.288904, 0.289188, 0.289472, 0.289757, 0.290041, 0.290326, 0.290611,
-        0.290896, 0.291181, 0.291467, 0.291752, 0.292038, 0.292324, 0.292610, 0.292897, 0.293183, 0.293470, 0.293756, 0.294043, 0.294330, 0.294617, 0.294905, 0.295192, 0.295480,
-        0.295768, 0.296056, 0.296344, 0.296633, 0.296921, 0.297210, 0.297499, 0.297788, 0.298077, 0.298366, 0.298656, 0.298946, 0.299235, 0.299525, 0.299816, 0.300106, 0.300396,
-        0.300687, 0.300978, 0.301269, 0.301560, 0.301851, 0.302143, 0.302435, 0.302726, 0.303018, 0.303311, 0.303603, 0.303895, 0.304188, 0.304481, 0.304774, 0.305067, 0.305360,
-        0.305654, 0.305947, 0.306241, 0.306535, 0.306829, 0.307123, 0.307418, 0.307713, 0.308007, 0.308302, 0.308597, 0.308893, 0.309188, 0.309484, 0.309779, 0.310075, 0.310371,
-        0.310668, 0.310964, 0.311261, 0.311558, 0.311854, 0.312152, 0.312449, 0.312746, 0.313044, 0.313342, 0.313639, 0.313938, 0.314236, 0.314534, 0.314833, 0.315131, 0.315430,
-        0.315729, 0.316029, 0.316328, 0.316628, 0.316927, 0.317227, 0.317527, 0.317828, 0.318128, 0.318429, 0.318729, 0.319030, 0.319331, 0.319632, 0.319934, 0.320235, 0.320537,
-        0.320839, 0.321141, 0.321443, 0.321746, 0.322048, 0.322351, 0.322654, 0.322957, 0.323260, 0.323563, 0.323867, 0.324171, 0.324474, 0.324779, 0.325083, 0.325387, 0.325692,
-        0.325996, 0.326301, 0.326606, 0.326911, 0.327217, 0.327522, 0.327828, 0.328134, 0.328440, 0.328746, 0.329053, 0.329359, 0.329666, 0.329973, 0.330280, 0.330587, 0.330894,
-        0.331202, 0.331509, 0.331817, 0.332125, 0.332434, 0.332742, 0.333050, 0.333359, 0.333668, 0.333977, 0.334286, 0.334596, 0.334905, 0.335215, 0.335525, 0.335835, 0.336145,
-        0.336455, 0.336766, 0.337077, 0.337387, 0.337699, 0.338010, 0.338321, 0.338633, 0.338944, 0.339256, 0.339568, 0.339880, 0.340193, 0.340505, 0.340818, 0.341131, 0.341444,
-        0.341757, 0.342071, 0.342384, 0.342698, 0.343012, 0.343326, 0.343640, 0.343954, 0.344269, 0.344584, 0.344899, 0.345214, 0.345529, 0.345844, 0.346160, 0.346476, 0.346792,
-        0.347108, 0.347424, 0.347740, 0.348057, 0.348374, 0.348690, 0.349008, 0.349325, 0.349642, 0.349960, 0.350278, 0.350595, 0.350914, 0.351232, 0.351550, 0.351869, 0.352188,
-        0.352506, 0.352826, 0.353145, 0.353464, 0.353784, 0.354104, 0.354424, 0.354744, 0.355064, 0.355384, 0.355705, 0.356026, 0.356347, 0.356668, 0.356989, 0.357311, 0.357632,
-        0.357954, 0.358276, 0.358598, 0.358920, 0.359243, 0.359565, 0.359888, 0.360211, 0.360534, 0.360858, 0.361181, 0.361505, 0.361829, 0.362153, 0.362477, 0.362801, 0.363126,
-        0.363450, 0.363775, 0.364100, 0.364425, 0.364751, 0.365076, 0.365402, 0.365728, 0.366054, 0.366380, 0.366706, 0.367033, 0.367360, 0.367686, 0.368013, 0.368341, 0.368668,
-        0.368996, 0.369323, 0.369651, 0.369979, 0.370307, 0.370636, 0.370964, 0.371293, 0.371622, 0.371951, 0.372280, 0.372610, 0.372939, 0.373269, 0.373599, 0.373929, 0.374259,
-        0.374590, 0.374920, 0.375251, 0.375582, 0.375913, 0.376245, 0.376576, 0.376908, 0.377239, 0.377571, 0.377904, 0.378236, 0.378568, 0.378901, 0.379234, 0.379567, 0.379900,
-        0.380233, 0.380567, 0.380900, 0.381234, 0.381568, 0.381903, 0.382237, 0.382571, 0.382906, 0.383241, 0.383576, 0.383911, 0.384247, 0.384582, 0.384918, 0.385254, 0.385590,
-        0.385926, 0.386262, 0.386599, 0.386936, 0.387273, 0.387610, 0.387947, 0.388284, 0.388622, 0.388960, 0.389298, 0.389636, 0.389974, 0.390313, 0.390651, 0.390990, 0.391329,
-        0.391668, 0.392007, 0.392347, 0.392687, 0.393026, 0.393366, 0.393707, 0.394047, 0.394387, 0.394728, 0.395069, 0.395410, 0.395751, 0.396093, 0.396434, 0.396776, 0.397118,
-        0.397460, 0.397802, 0.398144, 0.398487, 0.398830, 0.399173, 0.399516, 0.399859, 0.400203, 0.400546, 0.400890, 0.401234, 0.401578, 0.401922, 0.402267, 0.402611, 0.402956,
-        0.403301, 0.403646, 0.403992, 0.404337, 0.404683, 0.405029, 0.405375, 0.405721, 0.406067, 0.406414, 0.406761, 0.407107, 0.407454, 0.407802, 0.408149, 0.408497, 0.408844,
-        0.409192, 0.409540, 0.409889, 0.410237, 0.410586, 0.410934, 0.411283, 0.411633, 0.411982, 0.412331, 0.412681, 0.413031, 0.413381, 0.413731, 0.414081, 0.414432, 0.414782,
-        0.415133, 0.415484, 0.415836, 0.416187, 0.416538, 0.416890, 0.417242, 0.417594, 0.417946, 0.418299, 0.418651, 0.419004, 0.419357, 0.419710, 0.420063, 0.420417, 0.420771,
-        0.421124, 0.421478, 0.421832, 0.422187, 0.422541, 0.422896, 0.423251, 0.423606, 0.423961, 0.424316, 0.424672, 0.425028, 0.425383, 0.425739, 0.426096, 0.426452, 0.426809,
-        0.427165, 0.427522, 0.427879, 0.428237, 0.428594, 0.428952, 0.429310, 0.429668, 0.430026, 0.430384, 0.430743, 0.431101, 0.431460, 0.431819, 0.432178, 0.432538, 0.432897,
-        0.433257, 0.433617, 0.433977, 0.434337, 0.434697, 0.435058, 0.435419, 0.435780, 0.436141, 0.436502, 0.436864, 0.437225, 0.437587, 0.437949, 0.438311, 0.438673, 0.439036,
-        0.439399, 0.439761, 0.440125, 0.440488, 0.440851, 0.441215, 0.441578, 0.441942, 0.442306, 0.442671, 0.443035, 0.443400, 0.443764, 0.444129, 0.444494, 0.444860, 0.445225,
-        0.445591, 0.445957, 0.446323, 0.446689, 0.447055, 0.447422, 0.447788, 0.448155, 0.448522, 0.448890, 0.449257, 0.449625, 0.449992, 0.450360, 0.450728, 0.451097, 0.451465,
-        0.451834, 0.452203, 0.452572, 0.452941, 0.453310, 0.453680, 0.454049, 0.454419, 0.454789, 0.455159, 0.455530, 0.455900, 0.456271, 0.456642, 0.457013, 0.457384, 0.457756,
-        0.458127, 0.458499, 0.458871, 0.459243, 0.459616, 0.459988, 0.460361, 0.460734, 0.461107, 0.461480, 0.461853, 0.462227, 0.462601, 0.462974, 0.463348, 0.463723, 0.464097,
-        0.464472, 0.464847, 0.465222, 0.465597, 0.465972, 0.466348, 0.466723, 0.467099, 0.467475, 0.467851, 0.468228, 0.468604, 0.468981, 0.469358, 0.469735, 0.470112, 0.470490,
-        0.470867, 0.471245, 0.471623, 0.472001, 0.472379, 0.472758, 0.473137, 0.473515, 0.473894, 0.474274, 0.474653, 0.475033, 0.475412, 0.475792, 0.476172, 0.476553, 0.476933,
-        0.477314, 0.477694, 0.478075, 0.478457, 0.478838, 0.479219, 0.479601, 0.479983, 0.480365, 0.480747, 0.481130, 0.481512, 0.481895, 0.482278, 0.482661, 0.483044, 0.483428,
-        0.483811, 0.484195, 0.484579, 0.484963, 0.485348, 0.485732, 0.486117, 0.486502, 0.486887, 0.487272, 0.487657, 0.488043, 0.488429, 0.488815, 0.489201, 0.489587, 0.489974,
-        0.490360, 0.490747, 0.491134, 0.491521, 0.491909, 0.492296, 0.492684, 0.493072, 0.493460, 0.493848, 0.494237, 0.494625, 0.495014, 0.495403, 0.495792, 0.496182, 0.496571,
-        0.496961, 0.497351, 0.497741, 0.498131, 0.498521, 0.498912, 0.499303, 0.499693, 0.500085, 0.500476, 0.500867, 0.501259, 0.501651, 0.502043, 0.502435, 0.502827, 0.503220,
-        0.503613, 0.504006, 0.504399, 0.504792, 0.505185, 0.505579, 0.505973, 0.506367, 0.506761, 0.507155, 0.507550, 0.507944, 0.508339, 0.508734, 0.509129, 0.509525, 0.509920,
-        0.510316, 0.510712, 0.511108, 0.511505, 0.511901, 0.512298, 0.512695, 0.513092, 0.513489, 0.513886, 0.514284, 0.514681, 0.515079, 0.515477, 0.515876, 0.516274, 0.516673,
-        0.517072, 0.517471, 0.517870, 0.518269, 0.518669, 0.519068, 0.519468, 0.519868, 0.520268, 0.520669, 0.521070, 0.521470, 0.521871, 0.522272, 0.522674, 0.523075, 0.523477,
-        0.523879, 0.524281, 0.524683, 0.525085, 0.525488, 0.525891, 0.526294, 0.526697, 0.527100, 0.527504, 0.527907, 0.528311, 0.528715, 0.529119, 0.529524, 0.529928, 0.530333,
-        0.530738, 0.531143, 0.531548, 0.531954, 0.532360, 0.532765, 0.533171, 0.533578, 0.533984, 0.534390, 0.534797, 0.535204, 0.535611, 0.536018, 0.536426, 0.536834, 0.537241,
-        0.537649, 0.538057, 0.538466, 0.538874, 0.539283, 0.539692, 0.540101, 0.540510, 0.540920, 0.541329, 0.541739, 0.542149, 0.542559, 0.542970, 0.543380, 0.543791, 0.544202,
-        0.544613, 0.545024, 0.545436, 0.545847, 0.546259, 0.546671, 0.547083, 0.547495, 0.547908, 0.548321, 0.548733, 0.549147, 0.549560, 0.549973, 0.550387, 0.550801, 0.551215,
-        0.551629, 0.552043, 0.552458, 0.552872, 0.553287, 0.553702, 0.554117, 0.554533, 0.554948, 0.555364, 0.555780, 0.556196, 0.556613, 0.557029, 0.557446, 0.557863, 0.558280,
-        0.558697, 0.559114, 0.559532, 0.559950, 0.560368, 0.560786, 0.561204, 0.561623, 0.562041, 0.562460, 0.562879, 0.563299, 0.563718, 0.564138, 0.564557, 0.564977, 0.565398,
-        0.565818, 0.566238, 0.566659, 0.567080, 0.567501, 0.567922, 0.568344, 0.568765, 0.569187, 0.569609, 0.570031, 0.570454, 0.570876, 0.571299, 0.571722, 0.572145, 0.572568,
-        0.572991, 0.573415, 0.573839, 0.574263, 0.574687, 0.575111, 0.575536, 0.575961, 0.576385, 0.576811, 0.577236, 0.577661, 0.578087, 0.578513, 0.578939, 0.579365, 0.579791,
-        0.580218, 0.580644, 0.581071, 0.581498, 0.581926, 0.582353, 0.582781, 0.583209, 0.583637, 0.584065, 0.584493, 0.584922, 0.585350, 0.585779, 0.586208, 0.586638, 0.587067,
-        0.587497, 0.587927, 0.588357, 0.588787, 0.589217, 0.589648, 0.590079, 0.590510, 0.590941, 0.591372, 0.591804, 0.592235, 0.592667, 0.593099, 0.593531, 0.593964, 0.594396,
-        0.594829, 0.595262, 0.595695, 0.596128, 0.596562, 0.596996, 0.597430, 0.597864, 0.598298, 0.598732, 0.599167, 0.599602, 0.600037, 0.600472, 0.600907, 0.601343, 0.601778,
-        0.602214, 0.602650, 0.603087, 0.603523, 0.603960, 0.604397, 0.604834, 0.605271, 0.605708, 0.606146, 0.606583, 0.607021, 0.607460, 0.607898, 0.608336, 0.608775, 0.609214,
-        0.609653, 0.610092, 0.610531, 0.610971, 0.611411, 0.611851, 0.612291, 0.612731, 0.613172, 0.613612, 0.614053, 0.614494, 0.614936, 0.615377, 0.615819, 0.616261, 0.616702,
-        0.617145, 0.617587, 0.618030, 0.618472, 0.618915, 0.619358, 0.619802, 0.620245, 0.620689, 0.621133, 0.621577, 0.622021, 0.622465, 0.622910, 0.623355, 0.623799, 0.624245,
-        0.624690, 0.625135, 0.625581, 0.626027, 0.626473, 0.626919, 0.627366, 0.627812, 0.628259, 0.628706, 0.629153, 0.629601, 0.630048, 0.630496, 0.630944, 0.631392, 0.631840,
-        0.632289, 0.632737, 0.633186, 0.633635, 0.634084, 0.634534, 0.634983, 0.635433, 0.635883, 0.636333, 0.636784, 0.637234, 0.637685, 0.638136, 0.638587, 0.639038, 0.639490,
-        0.639941, 0.640393, 0.640845, 0.641297, 0.641750, 0.642202, 0.642655, 0.643108, 0.643561, 0.644014, 0.644468, 0.644921, 0.645375, 0.645829, 0.646283, 0.646738, 0.647193,
-        0.647647, 0.648102, 0.648557, 0.649013, 0.649468, 0.649924, 0.650380, 0.650836, 0.651292, 0.651749, 0.652206, 0.652662, 0.653119, 0.653577, 0.654034, 0.654492, 0.654949,
-        0.655407, 0.655866, 0.656324, 0.656782, 0.657241, 0.657700, 0.658159, 0.658618, 0.659078, 0.659537, 0.659997, 0.660457, 0.660918, 0.661378, 0.661839, 0.662299, 0.662760,
-        0.663221, 0.663683, 0.664144, 0.664606, 0.665068, 0.665530, 0.665992, 0.666455, 0.666917, 0.667380, 0.667843, 0.668306, 0.668770, 0.669233, 0.669697, 0.670161, 0.670625,
-        0.671089, 0.671554, 0.672019, 0.672484, 0.672949, 0.673414, 0.673879, 0.674345, 0.674811, 0.675277, 0.675743, 0.676209, 0.676676, 0.677143, 0.677610, 0.678077, 0.678544,
-        0.679012, 0.679479, 0.679947, 0.680415, 0.680884, 0.681352, 0.681821, 0.682290, 0.682759, 0.683228, 0.683697, 0.684167, 0.684637, 0.685107, 0.685577, 0.686047, 0.686518,
-        0.686988, 0.687459, 0.687930, 0.688402, 0.688873, 0.689345, 0.689817, 0.690289, 0.690761, 0.691233, 0.691706, 0.692179, 0.692652, 0.693125, 0.693598, 0.694072, 0.694545,
-        0.695019, 0.695493, 0.695968, 0.696442, 0.696917, 0.697392, 0.697867, 0.698342, 0.698817, 0.699293, 0.699769, 0.700245, 0.700721, 0.701197, 0.701674, 0.702151, 0.702628,
-        0.703105, 0.703582, 0.704060, 0.704537, 0.705015, 0.705493, 0.705971, 0.706450, 0.706929, 0.707407, 0.707886, 0.708366, 0.708845, 0.709325, 0.709804, 0.710284, 0.710764,
-        0.711245, 0.711725, 0.712206, 0.712687, 0.713168, 0.713649, 0.714131, 0.714613, 0.715094, 0.715576, 0.716059, 0.716541, 0.717024, 0.717506, 0.717989, 0.718473, 0.718956,
-        0.719440, 0.719923, 0.720407, 0.720891, 0.721376, 0.721860, 0.722345, 0.722830, 0.723315, 0.723800, 0.724286, 0.724771, 0.725257, 0.725743, 0.726229, 0.726716, 0.727202,
-        0.727689, 0.728176, 0.728663, 0.729151, 0.729638, 0.730126, 0.730614, 0.731102, 0.731590, 0.732079, 0.732568, 0.733056, 0.733546, 0.734035, 0.734524, 0.735014, 0.735504,
-        0.735994, 0.736484, 0.736974, 0.737465, 0.737956, 0.738447, 0.738938, 0.739429, 0.739921, 0.740412, 0.740904, 0.741397, 0.741889, 0.742381, 0.742874, 0.743367, 0.743860,
-        0.744353, 0.744847, 0.745340, 0.745834, 0.746328, 0.746822, 0.747317, 0.747811, 0.748306, 0.748801, 0.749296, 0.749792, 0.750287, 0.750783, 0.751279, 0.751775, 0.752271,
-        0.752768, 0.753265, 0.753761, 0.754259, 0.754756, 0.755253, 0.755751, 0.756249, 0.756747, 0.757245, 0.757743, 0.758242, 0.758741, 0.759240, 0.759739, 0.760238, 0.760738,
-        0.761238, 0.761738, 0.762238, 0.762738, 0.763239, 0.763739, 0.764240, 0.764741, 0.765243, 0.765744, 0.766246, 0.766748, 0.767250, 0.767752, 0.768255, 0.768757, 0.769260,
-        0.769763, 0.770266, 0.770770, 0.771273, 0.771777, 0.772281, 0.772785, 0.773290, 0.773794, 0.774299, 0.774804, 0.775309, 0.775814, 0.776320, 0.776825, 0.777331, 0.777837,
-        0.778344, 0.778850, 0.779357, 0.779864, 0.780371, 0.780878, 0.781385, 0.781893, 0.782401, 0.782909, 0.783417, 0.783925, 0.784434, 0.784943, 0.785452, 0.785961, 0.786470,
-        0.786980, 0.787490, 0.788000, 0.788510, 0.789020, 0.789531, 0.790041, 0.790552, 0.791063, 0.791574, 0.792086, 0.792598, 0.793109, 0.793622, 0.794134, 0.794646, 0.795159,
-        0.795672, 0.796185, 0.796698, 0.797211, 0.797725, 0.798239, 0.798753, 0.799267, 0.799781, 0.800296, 0.800811, 0.801326, 0.801841, 0.802356, 0.802872, 0.803387, 0.803903,
-        0.804419, 0.804936, 0.805452, 0.805969, 0.806486, 0.807003, 0.807520, 0.808037, 0.808555, 0.809073, 0.809591, 0.810109, 0.810628, 0.811146, 0.811665, 0.812184, 0.812703,
-        0.813223, 0.813742, 0.814262, 0.814782, 0.815302, 0.815823, 0.816343, 0.816864, 0.817385, 0.817906, 0.818427, 0.818949, 0.819471, 0.819992, 0.820515, 0.821037, 0.821559,
-        0.822082, 0.822605, 0.823128, 0.823651, 0.824175, 0.824698, 0.825222, 0.825746, 0.826271, 0.826795, 0.827320, 0.827844, 0.828369, 0.828895, 0.829420, 0.829946, 0.830471,
-        0.830997, 0.831524, 0.832050, 0.832577, 0.833103, 0.833630, 0.834157, 0.834685, 0.835212, 0.835740, 0.836268, 0.836796, 0.837325, 0.837853, 0.838382, 0.838911, 0.839440,
-        0.839969, 0.840499, 0.841028, 0.841558, 0.842088, 0.842618, 0.843149, 0.843680, 0.844210, 0.844741, 0.845273, 0.845804, 0.846336, 0.846868, 0.847400, 0.847932, 0.848464,
-        0.848997, 0.849530, 0.850063, 0.850596, 0.851129, 0.851663, 0.852197, 0.852731, 0.853265, 0.853799, 0.854334, 0.854868, 0.855403, 0.855938, 0.856474, 0.857009, 0.857545,
-        0.858081, 0.858617, 0.859153, 0.859690, 0.860227, 0.860764, 0.861301, 0.861838, 0.862375, 0.862913, 0.863451, 0.863989, 0.864527, 0.865066, 0.865604, 0.866143, 0.866682,
-        0.867222, 0.867761, 0.868301, 0.868841, 0.869381, 0.869921, 0.870461, 0.871002, 0.871543, 0.872084, 0.872625, 0.873166, 0.873708, 0.874250, 0.874792, 0.875334, 0.875876,
-        0.876419, 0.876962, 0.877505, 0.878048, 0.878591, 0.879135, 0.879678, 0.880222, 0.880766, 0.881311, 0.881855, 0.882400, 0.882945, 0.883490, 0.884035, 0.884581, 0.885127,
-        0.885673, 0.886219, 0.886765, 0.887311, 0.887858, 0.888405, 0.888952, 0.889499, 0.890047, 0.890595, 0.891142, 0.891691, 0.892239, 0.892787, 0.893336, 0.893885, 0.894434,
-        0.894983, 0.895533, 0.896082, 0.896632, 0.897182, 0.897732, 0.898283, 0.898833, 0.899384, 0.899935, 0.900486, 0.901038, 0.901589, 0.902141, 0.902693, 0.903246, 0.903798,
-        0.904351, 0.904903, 0.905456, 0.906009, 0.906563, 0.907116, 0.907670, 0.908224, 0.908778, 0.909333, 0.909887, 0.910442, 0.910997, 0.911552, 0.912108, 0.912663, 0.913219,
-        0.913775, 0.914331, 0.914887, 0.915444, 0.916001, 0.916558, 0.917115, 0.917672, 0.918230, 0.918787, 0.919345, 0.919903, 0.920462, 0.921020, 0.921579, 0.922138, 0.922697,
-        0.923256, 0.923816, 0.924375, 0.924935, 0.925495, 0.926056, 0.926616, 0.927177, 0.927738, 0.928299, 0.928860, 0.929422, 0.929983, 0.930545, 0.931107, 0.931670, 0.932232,
-        0.932795, 0.933358, 0.933921, 0.934484, 0.935047, 0.935611, 0.936175, 0.936739, 0.937303, 0.937868, 0.938432, 0.938997, 0.939562, 0.940128, 0.940693, 0.941259, 0.941824,
-        0.942391, 0.942957, 0.943523, 0.944090, 0.944657, 0.945224, 0.945791, 0.946358, 0.946926, 0.947494, 0.948062, 0.948630, 0.949199, 0.949767, 0.950336, 0.950905, 0.951474,
-        0.952044, 0.952613, 0.953183, 0.953753, 0.954323, 0.954894, 0.955464, 0.956035, 0.956606, 0.957177, 0.957749, 0.958320, 0.958892, 0.959464, 0.960036, 0.960609, 0.961181,
-        0.961754, 0.962327, 0.962900, 0.963474, 0.964047, 0.964621, 0.965195, 0.965769, 0.966344, 0.966918, 0.967493, 0.968068, 0.968643, 0.969219, 0.969794, 0.970370, 0.970946,
-        0.971522, 0.972099, 0.972675, 0.973252, 0.973829, 0.974406, 0.974984, 0.975561, 0.976139, 0.976717, 0.977295, 0.977873, 0.978452, 0.979031, 0.979610, 0.980189, 0.980768,
-        0.981348, 0.981928, 0.982508, 0.983088, 0.983668, 0.984249, 0.984830, 0.985411, 0.985992, 0.986573, 0.987155, 0.987736, 0.988318, 0.988901, 0.989483, 0.990066, 0.990648,
-        0.991231, 0.991814, 0.992398, 0.992981, 0.993565, 0.994149, 0.994733, 0.995318, 0.995902, 0.996487, 0.997072, 0.997657, 0.998243, 0.998828, 0.999414, 1.000000
-    },
-
-    // Bit Depth:       12
-    // Reference White: REC709
-    // Gamma:           2.22222222222
-    {
-        0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000001, 0.000001, 0.000001, 0.000001, 0.000002, 0.000002, 0.000002, 0.000003, 0.000003, 0.000004, 0.000004,
-        0.000005, 0.000006, 0.000007, 0.000007, 0.000008, 0.000009, 0.000010, 0.000011, 0.000012, 0.000013, 0.000014, 0.000015, 0.000017, 0.000018, 0.000019, 0.000021, 0.000022,
-        0.000024, 0.000025, 0.000027, 0.000029, 0.000030, 0.000032, 0.000034, 0.000036, 0.000038, 0.000040, 0.000042, 0.000044, 0.000047, 0.000049, 0.000051, 0.000054, 0.000056,
-        0.000059, 0.000061, 0.000064, 0.000066, 0.000069, 0.000072, 0.000075, 0.000078, 0.000081, 0.000084, 0.000087, 0.000090, 0.000094, 0.000097, 0.000100, 0.000104, 0.000107,
-        0.000111, 0.000115, 0.000118, 0.000122, 0.000126, 0.000130, 0.000134, 0.000138, 0.000142, 0.000146, 0.000150, 0.000155, 0.000159, 0.000164, 0.000168, 0.000173, 0.000177,
-        0.000182, 0.000187, 0.000192, 0.000197, 0.000202, 0.000207, 0.000212, 0.000217, 0.000222, 0.000228, 0.000233, 0.000239, 0.000244, 0.000250, 0.000256, 0.000261, 0.000267,
-        0.000273, 0.000279, 0.000285, 0.000291, 0.000297, 0.000304, 0.000310, 0.000317, 0.000323, 0.000330, 0.000336, 0.000343, 0.000350, 0.000357, 0.000363, 0.000370, 0.000378,
-        0.000385, 0.000392, 0.000399, 0.000407, 0.000414, 0.000422, 0.000429, 0.000437, 0.000445, 0.000452, 0.000460, 0.000468, 0.000476, 0.000484, 0.000493, 0.000501, 0.000509,
-        0.000518, 0.000526, 0.000535, 0.000543, 0.000552, 0.000561, 0.000570, 0.000579, 0.000588, 0.000597, 0.000606, 0.000615, 0.000625, 0.000634, 0.000643, 0.000653, 0.000663,
-        0.000672, 0.000682, 0.000692, 0.000702, 0.000712, 0.000722, 0.000732, 0.000743, 0.000753, 0.000763, 0.000774, 0.000785, 0.000795, 0.000806, 0.000817, 0.000828, 0.000839,
-        0.000850, 0.000861, 0.000872, 0.000883, 0.000895, 0.000906, 0.000918, 0.000930, 0.000941, 0.000953, 0.000965, 0.000977, 0.000989, 0.001001, 0.001013, 0.001025, 0.001038,
-        0.001050, 0.001063, 0.001075, 0.001088, 0.001101, 0.001114, 0.001127, 0.001140, 0.001153, 0.001166, 0.001179, 0.001193, 0.001206, 0.001219, 0.001233, 0.001247, 0.001260,
-        0.001274, 0.001288, 0.001302, 0.001316, 0.001331, 0.001345, 0.001359, 0.001374, 0.001388, 0.001403, 0.001417, 0.001432, 0.001447, 0.001462, 0.001477, 0.001492, 0.001507,
-        0.001522, 0.001538, 0.001553, 0.001569, 0.001584, 0.001600, 0.001616, 0.001632, 0.001648, 0.001664, 0.001680, 0.001696, 0.001712, 0.001729, 0.001745, 0.001762, 0.001778,
-        0.001795, 0.001812, 0.001829, 0.001846, 0.001863, 0.001880, 0.001897, 0.001914, 0.001932, 0.001949, 0.001967, 0.001985, 0.002002, 0.002020, 0.002038, 0.002056, 0.002074,
-        0.002092, 0.002111, 0.002129, 0.002147, 0.002166, 0.002185, 0.002203, 0.002222, 0.002241, 0.002260, 0.002279, 0.002298, 0.002317, 0.002337, 0.002356, 0.002376, 0.002395,
-        0.002415, 0.002435, 0.002455, 0.002475, 0.002495, 0.002515, 0.002535, 0.002555, 0.002576, 0.002596, 0.002617, 0.002637, 0.002658, 0.002679, 0.002700, 0.002721, 0.002742,
-        0.002763, 0.002785, 0.002806, 0.002827, 0.002849, 0.002871, 0.002892, 0.002914, 0.002936, 0.002958, 0.002980, 0.003002, 0.003025, 0.003047, 0.003070, 0.003092, 0.003115,
-        0.003138, 0.003160, 0.003183, 0.003206, 0.003229, 0.003253, 0.003276, 0.003299, 0.003323, 0.003346, 0.003370, 0.003394, 0.003418, 0.003442, 0.003466, 0.003490, 0.003514,
-        0.003538, 0.003563, 0.003587, 0.003612, 0.003636, 0.003661, 0.003686, 0.003711, 0.003736, 0.003761, 0.003786, 0.003811, 0.003837, 0.003862, 0.003888, 0.003914, 0.003939,
-        0.003965, 0.003991, 0.004017, 0.004043, 0.004070, 0.004096, 0.004122, 0.004149, 0.004176, 0.004202, 0.004229, 0.004256, 0.004283, 0.004310, 0.004337, 0.004365, 0.004392,
-        0.004419, 0.004447, 0.004475, 0.004502, 0.004530, 0.004558, 0.004586, 0.004614, 0.004643, 0.004671, 0.004699, 0.004728, 0.004756, 0.004785, 0.004814, 0.004843, 0.004872,
-        0.004901, 0.004930, 0.004959, 0.004989, 0.005018, 0.005048, 0.005077, 0.005107, 0.005137, 0.005167, 0.005197, 0.005227, 0.005257, 0.005287, 0.005318, 0.005348, 0.005379,
-        0.005410, 0.005440, 0.005471, 0.005502, 0.005533, 0.005564, 0.005596, 0.005627, 0.005659, 0.005690, 0.005722, 0.005754, 0.005785, 0.005817, 0.005849, 0.005882, 0.005914,
-        0.005946, 0.005979, 0.006011, 0.006044, 0.006076, 0.006109, 0.006142, 0.006175, 0.006208, 0.006242, 0.006275, 0.006308, 0.006342, 0.006375, 0.006409, 0.006443, 0.006477,
-        0.006511, 0.006545, 0.006579, 0.006613, 0.006648, 0.006682, 0.006717, 0.006751, 0.006786, 0.006821, 0.006856, 0.006891, 0.006926, 0.006962, 0.006997, 0.007032, 0.007068,
-        0.007104, 0.007139, 0.007175, 0.007211, 0.007247, 0.007284, 0.007320, 0.007356, 0.007393, 0.007429, 0.007466, 0.007503, 0.007539, 0.007576, 0.007613, 0.007651, 0.007688,
-        0.007725, 0.007763, 0.007800, 0.007838, 0.007876, 0.007913, 0.007951, 0.007989, 0.008028, 0.008066, 0.008104, 0.008143, 0.008181, 0.008220, 0.008259, 0.008297, 0.008336,
-        0.008375, 0.008415, 0.008454, 0.008493, 0.008533, 0.008572, 0.008612, 0.008652, 0.008691, 0.008731, 0.008771, 0.008812, 0.008852, 0.008892, 0.008933, 0.008973, 0.009014,
-        0.009055, 0.009096, 0.009137, 0.009178, 0.009219, 0.009260, 0.009301, 0.009343, 0.009384, 0.009426, 0.009468, 0.009510, 0.009552, 0.009594, 0.009636, 0.009678, 0.009721,
-        0.009763, 0.009806, 0.009848, 0.009891, 0.009934, 0.009977, 0.010020, 0.010063, 0.010107, 0.010150, 0.010194, 0.010237, 0.010281, 0.010325, 0.010369, 0.010413, 0.010457,
-        0.010501, 0.010545, 0.010590, 0.010634, 0.010679, 0.010724, 0.010769, 0.010814, 0.010859, 0.010904, 0.010949, 0.010994, 0.011040, 0.011085, 0.011131, 0.011177, 0.011223,
-        0.011269, 0.011315, 0.011361, 0.011407, 0.011454, 0.011500, 0.011547, 0.011594, 0.011640, 0.011687, 0.011734, 0.011781, 0.011829, 0.011876, 0.011923, 0.011971, 0.012019,
-        0.012066, 0.012114, 0.012162, 0.012210, 0.012258, 0.012307, 0.012355, 0.012403, 0.012452, 0.012501, 0.012550, 0.012598, 0.012647, 0.012697, 0.012746, 0.012795, 0.012844,
-        0.012894, 0.012944, 0.012993, 0.013043, 0.013093, 0.013143, 0.013193, 0.013244, 0.013294, 0.013344, 0.013395, 0.013446, 0.013496, 0.013547, 0.013598, 0.013649, 0.013701,
-        0.013752, 0.013803, 0.013855, 0.013906, 0.013958, 0.014010, 0.014062, 0.014114, 0.014166, 0.014218, 0.014271, 0.014323, 0.014376, 0.014429, 0.014481, 0.014534, 0.014587,
-        0.014640, 0.014694, 0.014747, 0.014800, 0.014854, 0.014907, 0.014961, 0.015015, 0.015069, 0.015123, 0.015177, 0.015231, 0.015286, 0.015340, 0.015395, 0.015450, 0.015504,
-        0.015559, 0.015614, 0.015670, 0.015725, 0.015780, 0.015836, 0.015891, 0.015947, 0.016003, 0.016058, 0.016114, 0.016171, 0.016227, 0.016283, 0.016339, 0.016396, 0.016453,
-        0.016509, 0.016566, 0.016623, 0.016680, 0.016737, 0.016795, 0.016852, 0.016910, 0.016967, 0.017025, 0.017083, 0.017141, 0.017199, 0.017257, 0.017315, 0.017373, 0.017432,
-        0.017490, 0.017549, 0.017608, 0.017667, 0.017726, 0.017785, 0.017844, 0.017903, 0.017963, 0.018022, 0.018082, 0.018142, 0.018202, 0.018262, 0.018322, 0.018382, 0.018442,
-        0.018503, 0.018563, 0.018624, 0.018685, 0.018745, 0.018806, 0.018867, 0.018929, 0.018990, 0.019051, 0.019113, 0.019174, 0.019236, 0.019298, 0.019360, 0.019422, 0.019484,
-        0.019546, 0.019609, 0.019671, 0.019734, 0.019796, 0.019859, 0.019922, 0.019985, 0.020048, 0.020112, 0.020175, 0.020238, 0.020302, 0.020366, 0.020429, 0.020493, 0.020557,
-        0.020622, 0.020686, 0.020750, 0.020815, 0.020879, 0.020944, 0.021009, 0.021073, 0.021138, 0.021204, 0.021269, 0.021334, 0.021400, 0.021465, 0.021531, 0.021597, 0.021663,
-        0.021729, 0.021795, 0.021861, 0.021927, 0.021994, 0.022060, 0.022127, 0.022194, 0.022260, 0.022327, 0.022395, 0.022462, 0.022529, 0.022597, 0.022664, 0.022732, 0.022800,
-        0.022867, 0.022935, 0.023004, 0.023072, 0.023140, 0.023208, 0.023277, 0.023346, 0.023414, 0.023483, 0.023552, 0.023621, 0.023691, 0.023760, 0.023829, 0.023899, 0.023969,
-        0.024038, 0.024108, 0.024178, 0.024248, 0.024319, 0.024389, 0.024459, 0.024530, 0.024601, 0.024671, 0.024742, 0.024813, 0.024884, 0.024956, 0.025027, 0.025098, 0.025170,
-        0.025242, 0.025313, 0.025385, 0.025457, 0.025529, 0.025602, 0.025674, 0.025746, 0.025819, 0.025892, 0.025965, 0.026037, 0.026110, 0.026184, 0.026257, 0.026330, 0.026404,
-        0.026477, 0.026551, 0.026625, 0.026699, 0.026773, 0.026847, 0.026921, 0.026996, 0.027070, 0.027145, 0.027219, 0.027294, 0.027369, 0.027444, 0.027519, 0.027595, 0.027670,
-        0.027745, 0.027821, 0.027897, 0.027973, 0.028049, 0.028125, 0.028201, 0.028277, 0.028354, 0.028430, 0.028507, 0.028583, 0.028660, 0.028737, 0.028814, 0.028892, 0.028969,
-        0.029046, 0.029124, 0.029202, 0.029279, 0.029357, 0.029435, 0.029513, 0.029592, 0.029670, 0.029748, 0.029827, 0.029906, 0.029984, 0.030063, 0.030142, 0.030221, 0.030301,
-        0.030380, 0.030460, 0.030539, 0.030619, 0.030699, 0.030779, 0.030859, 0.030939, 0.031019, 0.031100, 0.031180, 0.031261, 0.031341, 0.031422, 0.031503, 0.031584, 0.031666,
-        0.031747, 0.031828, 0.031910, 0.031991, 0.032073, 0.032155, 0.032237, 0.032319, 0.032401, 0.032484, 0.032566, 0.032649, 0.032732, 0.032814, 0.032897, 0.032980, 0.033063,
-        0.033147, 0.033230, 0.033314, 0.033397, 0.033481, 0.033565, 0.033649, 0.033733, 0.033817, 0.033901, 0.033986, 0.034070, 0.034155, 0.034240, 0.034325, 0.034410, 0.034495,
-        0.034580, 0.034665, 0.034751, 0.034836, 0.034922, 0.035008, 0.035094, 0.035180, 0.035266, 0.035352, 0.035439, 0.035525, 0.035612, 0.035698, 0.035785, 0.035872, 0.035959,
-        0.036047, 0.036134, 0.036221, 0.036309, 0.036397, 0.036484, 0.036572, 0.036660, 0.036748, 0.036837, 0.036925, 0.037013, 0.037102, 0.037191, 0.037280, 0.037369, 0.037458,
-        0.037547, 0.037636, 0.037725, 0.037815, 0.037905, 0.037994, 0.038084, 0.038174, 0.038264, 0.038355, 0.038445, 0.038535, 0.038626, 0.038717, 0.038808, 0.038898, 0.038990,
-        0.039081, 0.039172, 0.039263, 0.039355, 0.039447, 0.039538, 0.039630, 0.039722, 0.039814, 0.039906, 0.039999, 0.040091, 0.040184, 0.040277, 0.040369, 0.040462, 0.040555,
-        0.040648, 0.040742, 0.040835, 0.040929, 0.041022, 0.041116, 0.041210, 0.041304, 0.041398, 0.041492, 0.041587, 0.041681, 0.041776, 0.041870, 0.041965, 0.042060, 0.042155,
-        0.042250, 0.042345, 0.042441, 0.042536, 0.042632, 0.042728, 0.042824, 0.042920, 0.043016, 0.043112, 0.043208, 0.043305, 0.043401, 0.043498, 0.043595, 0.043692, 0.043789,
-        0.043886, 0.043983, 0.044081, 0.044178, 0.044276, 0.044374, 0.044472, 0.044570, 0.044668, 0.044766, 0.044864, 0.044963, 0.045061, 0.045160, 0.045259, 0.045358, 0.045457,
-        0.045556, 0.045655, 0.045755, 0.045854, 0.045954, 0.046054, 0.046154, 0.046254, 0.046354, 0.046454, 0.046555, 0.046655, 0.046756, 0.046856, 0.046957, 0.047058, 0.047159,
-        0.047261, 0.047362, 0.047463, 0.047565, 0.047667, 0.047769, 0.047870, 0.047973, 0.048075, 0.048177, 0.048279, 0.048382, 0.048485, 0.048587, 0.048690, 0.048793, 0.048896,
-        0.049000, 0.049103, 0.049206, 0.049310, 0.049414, 0.049518, 0.049622, 0.049726, 0.049830, 0.049934, 0.050039, 0.050143, 0.050248, 0.050353, 0.050458, 0.050563, 0.050668,
-        0.050773, 0.050879, 0.050984, 0.051090, 0.051196, 0.051301, 0.051407, 0.051514, 0.051620, 0.051726, 0.051833, 0.051939, 0.052046, 0.052153, 0.052260, 0.052367, 0.052474,
-        0.052582, 0.052689, 0.052797, 0.052904, 0.053012, 0.053120, 0.053228, 0.053336, 0.053445, 0.053553, 0.053662, 0.053770, 0.053879, 0.053988, 0.054097, 0.054206, 0.054315,
-        0.054425, 0.054534, 0.054644, 0.054754, 0.054864, 0.054974, 0.055084, 0.055194, 0.055304, 0.055415, 0.055525, 0.055636, 0.055747, 0.055858, 0.055969, 0.056080, 0.056191,
-        0.056303, 0.056415, 0.056526, 0.056638, 0.056750, 0.056862, 0.056974, 0.057086, 0.057199, 0.057311, 0.057424, 0.057537, 0.057650, 0.057763, 0.057876, 0.057989, 0.058103,
-        0.058216, 0.058330, 0.058444, 0.058558, 0.058672, 0.058786, 0.058900, 0.059014, 0.059129, 0.059243, 0.059358, 0.059473, 0.059588, 0.059703, 0.059818, 0.059934, 0.060049,
-        0.060165, 0.060280, 0.060396, 0.060512, 0.060628, 0.060745, 0.060861, 0.060977, 0.061094, 0.061211, 0.061327, 0.061444, 0.061561, 0.061679, 0.061796, 0.061913, 0.062031,
-        0.062149, 0.062266, 0.062384, 0.062502, 0.062621, 0.062739, 0.062857, 0.062976, 0.063094, 0.063213, 0.063332, 0.063451, 0.063570, 0.063690, 0.063809, 0.063929, 0.064048,
-        0.064168, 0.064288, 0.064408, 0.064528, 0.064648, 0.064769, 0.064889, 0.065010, 0.065130, 0.065251, 0.065372, 0.065493, 0.065615, 0.065736, 0.065858, 0.065979, 0.066101,
-        0.066223, 0.066345, 0.066467, 0.066589, 0.066711, 0.066834, 0.066957, 0.067079, 0.067202, 0.067325, 0.067448, 0.067571, 0.067695, 0.067818, 0.067942, 0.068066, 0.068189,
-        0.068313, 0.068437, 0.068562, 0.068686, 0.068810, 0.068935, 0.069060, 0.069185, 0.069310, 0.069435, 0.069560, 0.069685, 0.069811, 0.069936, 0.070062, 0.070188, 0.070314,
-        0.070440, 0.070566, 0.070692, 0.070819, 0.070945, 0.071072, 0.071199, 0.071326, 0.071453, 0.071580, 0.071707, 0.071835, 0.071962, 0.072090, 0.072218, 0.072346, 0.072474,
-        0.072602, 0.072730, 0.072859, 0.072987, 0.073116, 0.073245, 0.073374, 0.073503, 0.073632, 0.073761, 0.073891, 0.074020, 0.074150, 0.074280, 0.074410, 0.074540, 0.074670,
-        0.074800, 0.074931, 0.075061, 0.075192, 0.075323, 0.075454, 0.075585, 0.075716, 0.075847, 0.075979, 0.076110, 0.076242, 0.076374, 0.076506, 0.076638, 0.076770, 0.076902,
-        0.077035, 0.077167, 0.077300, 0.077433, 0.077566, 0.077699, 0.077832, 0.077965, 0.078099, 0.078232, 0.078366, 0.078500, 0.078634, 0.078768, 0.078902, 0.079036, 0.079171,
-        0.079305, 0.079440, 0.079575, 0.079710, 0.079845, 0.079980, 0.080115, 0.080251, 0.080386, 0.080522, 0.080658, 0.080794, 0.080930, 0.081066, 0.081202, 0.081339, 0.081475,
-        0.081612, 0.081749, 0.081886, 0.082023, 0.082160, 0.082298, 0.082435, 0.082573, 0.082710, 0.082848, 0.082986, 0.083124, 0.083262, 0.083401, 0.083539, 0.083678, 0.083817,
-        0.083955, 0.084094, 0.084234, 0.084373, 0.084512, 0.084652, 0.084791, 0.084931, 0.085071, 0.085211, 0.085351, 0.085491, 0.085632, 0.085772, 0.085913, 0.086054, 0.086194,
-        0.086335, 0.086477, 0.086618, 0.086759, 0.086901, 0.087042, 0.087184, 0.087326, 0.087468, 0.087610, 0.087752, 0.087895, 0.088037, 0.088180, 0.088323, 0.088466, 0.088609,
-        0.088752, 0.088895, 0.089039, 0.089182, 0.089326, 0.089470, 0.089614, 0.089758, 0.089902, 0.090046, 0.090191, 0.090335, 0.090480, 0.090625, 0.090770, 0.090915, 0.091060,
-        0.091205, 0.091351, 0.091496, 0.091642, 0.091788, 0.091934, 0.092080, 0.092226, 0.092372, 0.092519, 0.092666, 0.092812, 0.092959, 0.093106, 0.093253, 0.093400, 0.093548,
-        0.093695, 0.093843, 0.093991, 0.094139, 0.094287, 0.094435, 0.094583, 0.094731, 0.094880, 0.095029, 0.095177, 0.095326, 0.095475, 0.095624, 0.095774, 0.095923, 0.096073,
-        0.096222, 0.096372, 0.096522, 0.096672, 0.096822, 0.096973, 0.097123, 0.097274, 0.097424, 0.097575, 0.097726, 0.097877, 0.098029, 0.098180, 0.098331, 0.098483, 0.098635,
-        0.098787, 0.098938, 0.099091, 0.099243, 0.099395, 0.099548, 0.099700, 0.099853, 0.100006, 0.100159, 0.100312, 0.100465, 0.100619, 0.100772, 0.100926, 0.101080, 0.101234,
-        0.101388, 0.101542, 0.101696, 0.101851, 0.102005, 0.102160, 0.102315, 0.102470, 0.102625, 0.102780, 0.102935, 0.103091, 0.103246, 0.103402, 0.103558, 0.103714, 0.103870,
-        0.104026, 0.104183, 0.104339, 0.104496, 0.104652, 0.104809, 0.104966, 0.105123, 0.105281, 0.105438, 0.105596, 0.105753, 0.105911, 0.106069, 0.106227, 0.106385, 0.106544,
-        0.106702, 0.106861, 0.107019, 0.107178, 0.107337, 0.107496, 0.107655, 0.107815, 0.107974, 0.108134, 0.108293, 0.108453, 0.108613, 0.108773, 0.108934, 0.109094, 0.109255,
-        0.109415, 0.109576, 0.109737, 0.109898, 0.110059, 0.110220, 0.110382, 0.110543, 0.110705, 0.110867, 0.111029, 0.111191, 0.111353, 0.111515, 0.111678, 0.111840, 0.112003,
-        0.112166, 0.112329, 0.112492, 0.112655, 0.112819, 0.112982, 0.113146, 0.113310, 0.113473, 0.113637, 0.113802, 0.113966, 0.114130, 0.114295, 0.114460, 0.114624, 0.114789,
-        0.114954, 0.115120, 0.115285, 0.115450, 0.115616, 0.115782, 0.115947, 0.116113, 0.116280, 0.116446, 0.116612, 0.116779, 0.116945, 0.117112, 0.117279, 0.117446, 0.117613,
-        0.117780, 0.117948, 0.118115, 0.118283, 0.118451, 0.118619, 0.118787, 0.118955, 0.119123, 0.119292, 0.119460, 0.119629, 0.119798, 0.119967, 0.120136, 0.120305, 0.120475,
-        0.120644, 0.120814, 0.120984, 0.121154, 0.121324, 0.121494, 0.121664, 0.121834, 0.122005, 0.122176, 0.122347, 0.122518, 0.122689, 0.122860, 0.123031, 0.123203, 0.123374,
-        0.123546, 0.123718, 0.123890, 0.124062, 0.124234, 0.124407, 0.124579, 0.124752, 0.124925, 0.125098, 0.125271, 0.125444, 0.125617, 0.125791, 0.125964, 0.126138, 0.126312,
-        0.126486, 0.126660, 0.126834, 0.127008, 0.127183, 0.127358, 0.127532, 0.127707, 0.127882, 0.128057, 0.128233, 0.128408, 0.128584, 0.128759, 0.128935, 0.129111, 0.129287,
-        0.129463, 0.129640, 0.129816, 0.129993, 0.130170, 0.130347, 0.130524, 0.130701, 0.130878, 0.131055, 0.131233, 0.131411, 0.131588, 0.131766, 0.131944, 0.132123, 0.132301,
-        0.132479, 0.132658, 0.132837, 0.133016, 0.133195, 0.133374, 0.133553, 0.133732, 0.133912, 0.134092, 0.134271, 0.134451, 0.134631, 0.134811, 0.134992, 0.135172, 0.135353,
-        0.135534, 0.135714, 0.135895, 0.136077, 0.136258, 0.136439, 0.136621, 0.136802, 0.136984, 0.137166, 0.137348, 0.137530, 0.137713, 0.137895, 0.138078, 0.138260, 0.138443,
-        0.138626, 0.138809, 0.138992, 0.139176, 0.139359, 0.139543, 0.139727, 0.139911, 0.140095, 0.140279, 0.140463, 0.140648, 0.140832, 0.141017, 0.141202, 0.141387, 0.141572,
-        0.141757, 0.141942, 0.142128, 0.142313, 0.142499, 0.142685, 0.142871, 0.143057, 0.143244, 0.143430, 0.143617, 0.143803, 0.143990, 0.144177, 0.144364, 0.144552, 0.144739,
-        0.144926, 0.145114, 0.145302, 0.145490, 0.145678, 0.145866, 0.146054, 0.146243, 0.146431, 0.146620, 0.146809, 0.146998, 0.147187, 0.147376, 0.147565, 0.147755, 0.147945,
-        0.148134, 0.148324, 0.148514, 0.148705, 0.148895, 0.149085, 0.149276, 0.149467, 0.149657, 0.149848, 0.150040, 0.150231, 0.150422, 0.150614, 0.150805, 0.150997, 0.151189,
-        0.151381, 0.151573, 0.151766, 0.151958, 0.152151, 0.152343, 0.152536, 0.152729, 0.152922, 0.153116, 0.153309, 0.153503, 0.153696, 0.153890, 0.154084, 0.154278, 0.154472,
-        0.154667, 0.154861, 0.155056, 0.155250, 0.155445, 0.155640, 0.155835, 0.156031, 0.156226, 0.156422, 0.156617, 0.156813, 0.157009, 0.157205, 0.157401, 0.157598, 0.157794,
-        0.157991, 0.158188, 0.158384, 0.158581, 0.158779, 0.158976, 0.159173, 0.159371, 0.159569, 0.159766, 0.159964, 0.160163, 0.160361, 0.160559, 0.160758, 0.160956, 0.161155,
-        0.161354, 0.161553, 0.161752, 0.161952, 0.162151, 0.162351, 0.162550, 0.162750, 0.162950, 0.163150, 0.163351, 0.163551, 0.163751, 0.163952, 0.164153, 0.164354, 0.164555,
-        0.164756, 0.164958, 0.165159, 0.165361, 0.165562, 0.165764, 0.165966, 0.166168, 0.166371, 0.166573, 0.166776, 0.166978, 0.167181, 0.167384, 0.167587, 0.167791, 0.167994,
-        0.168197, 0.168401, 0.168605, 0.168809, 0.169013, 0.169217, 0.169421, 0.169626, 0.169830, 0.170035, 0.170240, 0.170445, 0.170650, 0.170855, 0.171061, 0.171266, 0.171472,
-        0.171678, 0.171884, 0.172090, 0.172296, 0.172503, 0.172709, 0.172916, 0.173122, 0.173329, 0.173536, 0.173744, 0.173951, 0.174158, 0.174366, 0.174574, 0.174782, 0.174989,
-        0.175198, 0.175406, 0.175614, 0.175823, 0.176032, 0.176240, 0.176449, 0.176658, 0.176868, 0.177077, 0.177286, 0.177496, 0.177706, 0.177916, 0.178126, 0.178336, 0.178546,
-        0.178757, 0.178967, 0.179178, 0.179389, 0.179600, 0.179811, 0.180022, 0.180234, 0.180445, 0.180657, 0.180869, 0.181081, 0.181293, 0.181505, 0.181717, 0.181930, 0.182142,
-        0.182355, 0.182568, 0.182781, 0.182994, 0.183208, 0.183421, 0.183635, 0.183848, 0.184062, 0.184276, 0.184490, 0.184705, 0.184919, 0.185133, 0.185348, 0.185563, 0.185778,
-        0.185993, 0.186208, 0.186424, 0.186639, 0.186855, 0.187070, 0.187286, 0.187502, 0.187719, 0.187935, 0.188151, 0.188368, 0.188585, 0.188802, 0.189019, 0.189236, 0.189453,
-        0.189670, 0.189888, 0.190106, 0.190324, 0.190542, 0.190760, 0.190978, 0.191196, 0.191415, 0.191633, 0.191852, 0.192071, 0.192290, 0.192509, 0.192729, 0.192948, 0.193168,
-        0.193388, 0.193607, 0.193827, 0.194048, 0.194268, 0.194488, 0.194709, 0.194930, 0.195151, 0.195372, 0.195593, 0.195814, 0.196035, 0.196257, 0.196479, 0.196700, 0.196922,
-        0.197144, 0.197367, 0.197589, 0.197812, 0.198034, 0.198257, 0.198480, 0.198703, 0.198926, 0.199149, 0.199373, 0.199596, 0.199820, 0.200044, 0.200268, 0.200492, 0.200717,
-        0.200941, 0.201166, 0.201390, 0.201615, 0.201840, 0.202065, 0.202291, 0.202516, 0.202741, 0.202967, 0.203193, 0.203419, 0.203645, 0.203871, 0.204098, 0.204324, 0.204551,
-        0.204778, 0.205004, 0.205231, 0.205459, 0.205686, 0.205913, 0.206141, 0.206369, 0.206597, 0.206825, 0.207053, 0.207281, 0.207510, 0.207738, 0.207967, 0.208196, 0.208425,
-        0.208654, 0.208883, 0.209113, 0.209342, 0.209572, 0.209802, 0.210032, 0.210262, 0.210492, 0.210722, 0.210953, 0.211184, 0.211414, 0.211645, 0.211876, 0.212108, 0.212339,
-        0.212570, 0.212802, 0.213034, 0.213266, 0.213498, 0.213730, 0.213962, 0.214195, 0.214427, 0.214660, 0.214893, 0.215126, 0.215359, 0.215592, 0.215826, 0.216059, 0.216293,
-        0.216527, 0.216761, 0.216995, 0.217229, 0.217464, 0.217698, 0.217933, 0.218168, 0.218403, 0.218638, 0.218873, 0.219108, 0.219344, 0.219580, 0.219815, 0.220051, 0.220287,
-        0.220524, 0.220760, 0.220997, 0.221233, 0.221470, 0.221707, 0.221944, 0.222181, 0.222418, 0.222656, 0.222893, 0.223131, 0.223369, 0.223607, 0.223845, 0.224084, 0.224322,
-        0.224561, 0.224799, 0.225038, 0.225277, 0.225516, 0.225756, 0.225995, 0.226235, 0.226474, 0.226714, 0.226954, 0.227194, 0.227435, 0.227675, 0.227915, 0.228156, 0.228397,
-        0.228638, 0.228879, 0.229120, 0.229362, 0.229603, 0.229845, 0.230087, 0.230329, 0.230571, 0.230813, 0.231055, 0.231298, 0.231540, 0.231783, 0.232026, 0.232269, 0.232512,
-        0.232756, 0.232999, 0.233243, 0.233486, 0.233730, 0.233974, 0.234219, 0.234463, 0.234707, 0.234952, 0.235197, 0.235441, 0.235686, 0.235932, 0.236177, 0.236422, 0.236668,
-        0.236914, 0.237160, 0.237406, 0.237652, 0.237898, 0.238144, 0.238391, 0.238638, 0.238884, 0.239131, 0.239379, 0.239626, 0.239873, 0.240121, 0.240368, 0.240616, 0.240864,
-        0.241112, 0.241361, 0.241609, 0.241857, 0.242106, 0.242355, 0.242604, 0.242853, 0.243102, 0.243352, 0.243601, 0.243851, 0.244101, 0.244350, 0.244601, 0.244851, 0.245101,
-        0.245352, 0.245602, 0.245853, 0.246104, 0.246355, 0.246606, 0.246857, 0.247109, 0.247361, 0.247612, 0.247864, 0.248116, 0.248368, 0.248621, 0.248873, 0.249126, 0.249379,
-        0.249632, 0.249885, 0.250138, 0.250391, 0.250644, 0.250898, 0.251152, 0.251406, 0.251660, 0.251914, 0.252168, 0.252423, 0.252677, 0.252932, 0.253187, 0.253442, 0.253697,
-        0.253952, 0.254208, 0.254463, 0.254719, 0.254975, 0.255231, 0.255487, 0.255743, 0.256000, 0.256256, 0.256513, 0.256770, 0.257027, 0.257284, 0.257541, 0.257798, 0.258056,
-        0.258314, 0.258571, 0.258829, 0.259088, 0.259346, 0.259604, 0.259863, 0.260121, 0.260380, 0.260639, 0.260898, 0.261158, 0.261417, 0.261676, 0.261936, 0.262196, 0.262456,
-        0.262716, 0.262976, 0.263237, 0.263497, 0.263758, 0.264019, 0.264280, 0.264541, 0.264802, 0.265063, 0.265325, 0.265586, 0.265848, 0.266110, 0.266372, 0.266634, 0.266897,
-        0.267159, 0.267422, 0.267685, 0.267948, 0.268211, 0.268474, 0.268737, 0.269001, 0.269264, 0.269528, 0.269792, 0.270056, 0.270320, 0.270585, 0.270849, 0.271114, 0.271379,
-        0.271644, 0.271909, 0.272174, 0.272439, 0.272705, 0.272970, 0.273236, 0.273502, 0.273768, 0.274034, 0.274301, 0.274567, 0.274834, 0.275101, 0.275368, 0.275635, 0.275902,
-        0.276169, 0.276437, 0.276704, 0.276972, 0.277240, 0.277508, 0.277776, 0.278044, 0.278313, 0.278582, 0.278850, 0.279119, 0.279388, 0.279657, 0.279927, 0.280196, 0.280466,
-        0.280736, 0.281006, 0.281276, 0.281546, 0.281816, 0.282087, 0.282357, 0.282628, 0.282899, 0.283170, 0.283441, 0.283712, 0.283984, 0.284256, 0.284527, 0.284799, 0.285071,
-        0.285343, 0.285616, 0.285888, 0.286161, 0.286434, 0.286707, 0.286980, 0.287253, 0.287526, 0.287800, 0.288073, 0.288347, 0.288621, 0.288895, 0.289169, 0.289443, 0.289718,
-        0.289993, 0.290267, 0.290542, 0.290817, 0.291092, 0.291368, 0.291643, 0.291919, 0.292195, 0.292471, 0.292747, 0.293023, 0.293299, 0.293576, 0.293852, 0.294129, 0.294406,
-        0.294683, 0.294960, 0.295238, 0.295515, 0.295793, 0.296070, 0.296348, 0.296626, 0.296905, 0.297183, 0.297461, 0.297740, 0.298019, 0.298298, 0.298577, 0.298856, 0.299135,
-        0.299415, 0.299695, 0.299974, 0.300254, 0.300534, 0.300815, 0.301095, 0.301375, 0.301656, 0.301937, 0.302218, 0.302499, 0.302780, 0.303061, 0.303343, 0.303625, 0.303906,
-        0.304188, 0.304470, 0.304753, 0.305035, 0.305317, 0.305600, 0.305883, 0.306166, 0.306449, 0.306732, 0.307016, 0.307299, 0.307583, 0.307867, 0.308151, 0.308435, 0.308719,
-        0.309003, 0.309288, 0.309572, 0.309857, 0.310142, 0.310427, 0.310713, 0.310998, 0.311283, 0.311569, 0.311855, 0.312141, 0.312427, 0.312713, 0.313000, 0.313286, 0.313573,
-        0.313860, 0.314147, 0.314434, 0.314721, 0.315009, 0.315296, 0.315584, 0.315872, 0.316160, 0.316448, 0.316736, 0.317024, 0.317313, 0.317602, 0.317891, 0.318180, 0.318469,
-        0.318758, 0.319047, 0.319337, 0.319627, 0.319917, 0.320207, 0.320497, 0.320787, 0.321078, 0.321368, 0.321659, 0.321950, 0.322241, 0.322532, 0.322823, 0.323115, 0.323406,
-        0.323698, 0.323990, 0.324282, 0.324574, 0.324866, 0.325159, 0.325452, 0.325744, 0.326037, 0.326330, 0.326623, 0.326917, 0.327210, 0.327504, 0.327798, 0.328092, 0.328386,
-        0.328680, 0.328974, 0.329269, 0.329563, 0.329858, 0.330153, 0.330448, 0.330743, 0.331039, 0.331334, 0.331630, 0.331926, 0.332222, 0.332518, 0.332814, 0.333110, 0.333407,
-        0.333704, 0.334000, 0.334297, 0.334594, 0.334892, 0.335189, 0.335487, 0.335784, 0.336082, 0.336380, 0.336678, 0.336976, 0.337275, 0.337573, 0.337872, 0.338171, 0.338470,
-        0.338769, 0.339068, 0.339368, 0.339667, 0.339967, 0.340267, 0.340567, 0.340867, 0.341168, 0.341468, 0.341769, 0.342069, 0.342370, 0.342671, 0.342972, 0.343274, 0.343575,
-        0.343877, 0.344179, 0.344480, 0.344782, 0.345085, 0.345387, 0.345690, 0.345992, 0.346295, 0.346598, 0.346901, 0.347204, 0.347507, 0.347811, 0.348115, 0.348418, 0.348722,
-        0.349026, 0.349331, 0.349635, 0.349940, 0.350244, 0.350549, 0.350854, 0.351159, 0.351464, 0.351770, 0.352075, 0.352381, 0.352687, 0.352993, 0.353299, 0.353605, 0.353912,
-        0.354218, 0.354525, 0.354832, 0.355139, 0.355446, 0.355753, 0.356061, 0.356368, 0.356676, 0.356984, 0.357292, 0.357600, 0.357909, 0.358217, 0.358526, 0.358834, 0.359143,
-        0.359452, 0.359762, 0.360071, 0.360380, 0.360690, 0.361000, 0.361310, 0.361620, 0.361930, 0.362240, 0.362551, 0.362862, 0.363172, 0.363483, 0.363794, 0.364106, 0.364417,
-        0.364729, 0.365040, 0.365352, 0.365664, 0.365976, 0.366289, 0.366601, 0.366914, 0.367226, 0.367539, 0.367852, 0.368165, 0.368479, 0.368792, 0.369106, 0.369419, 0.369733,
-        0.370047, 0.370361, 0.370676, 0.370990, 0.371305, 0.371620, 0.371935, 0.372250, 0.372565, 0.372880, 0.373196, 0.373511, 0.373827, 0.374143, 0.374459, 0.374775, 0.375092,
-        0.375408, 0.375725, 0.376042, 0.376359, 0.376676, 0.376993, 0.377310, 0.377628, 0.377946, 0.378264, 0.378582, 0.378900, 0.379218, 0.379536, 0.379855, 0.380174, 0.380493,
-        0.380812, 0.381131, 0.381450, 0.381770, 0.382089, 0.382409, 0.382729, 0.383049, 0.383369, 0.383690, 0.384010, 0.384331, 0.384651, 0.384972, 0.385293, 0.385615, 0.385936,
-        0.386258, 0.386579, 0.386901, 0.387223, 0.387545, 0.387867, 0.388190, 0.388512, 0.388835, 0.389158, 0.389481, 0.389804, 0.390127, 0.390451, 0.390774, 0.391098, 0.391422,
-        0.391746, 0.392070, 0.392395, 0.392719, 0.393044, 0.393368, 0.393693, 0.394018, 0.394344, 0.394669, 0.394995, 0.395320, 0.395646, 0.395972, 0.396298, 0.396624, 0.396951,
-        0.397277, 0.397604, 0.397931, 0.398258, 0.398585, 0.398912, 0.399240, 0.399567, 0.399895, 0.400223, 0.400551, 0.400879, 0.401207, 0.401536, 0.401864, 0.402193, 0.402522,
-        0.402851, 0.403180, 0.403510, 0.403839, 0.404169, 0.404498, 0.404828, 0.405159, 0.405489, 0.405819, 0.406150, 0.406480, 0.406811, 0.407142, 0.407473, 0.407805, 0.408136,
-        0.408468, 0.408799, 0.409131, 0.409463, 0.409795, 0.410128, 0.410460, 0.410793, 0.411125, 0.411458, 0.411791, 0.412125, 0.412458, 0.412791, 0.413125, 0.413459, 0.413793,
-        0.414127, 0.414461, 0.414795, 0.415130, 0.415465, 0.415800, 0.416135, 0.416470, 0.416805, 0.417140, 0.417476, 0.417812, 0.418147, 0.418484, 0.418820, 0.419156, 0.419492,
-        0.419829, 0.420166, 0.420503, 0.420840, 0.421177, 0.421514, 0.421852, 0.422189, 0.422527, 0.422865, 0.423203, 0.423542, 0.423880, 0.424219, 0.424557, 0.424896, 0.425235,
-        0.425574, 0.425913, 0.426253, 0.426592, 0.426932, 0.427272, 0.427612, 0.427952, 0.428293, 0.428633, 0.428974, 0.429314, 0.429655, 0.429996, 0.430338, 0.430679, 0.431021,
-        0.431362, 0.431704, 0.432046, 0.432388, 0.432730, 0.433073, 0.433415, 0.433758, 0.434101, 0.434444, 0.434787, 0.435130, 0.435474, 0.435817, 0.436161, 0.436505, 0.436849,
-        0.437193, 0.437538, 0.437882, 0.438227, 0.438572, 0.438917, 0.439262, 0.439607, 0.439952, 0.440298, 0.440644, 0.440989, 0.441335, 0.441682, 0.442028, 0.442374, 0.442721,
-        0.443068, 0.443414, 0.443761, 0.444109, 0.444456, 0.444803, 0.445151, 0.445499, 0.445847, 0.446195, 0.446543, 0.446892, 0.447240, 0.447589, 0.447938, 0.448287, 0.448636,
-        0.448985, 0.449334, 0.449684, 0.450034, 0.450384, 0.450734, 0.451084, 0.451434, 0.451785, 0.452135, 0.452486, 0.452837, 0.453188, 0.453539, 0.453890, 0.454242, 0.454594,
-        0.454946, 0.455297, 0.455650, 0.456002, 0.456354, 0.456707, 0.457060, 0.457412, 0.457765, 0.458119, 0.458472, 0.458825, 0.459179, 0.459533, 0.459887, 0.460241, 0.460595,
-        0.460949, 0.461304, 0.461659, 0.462013, 0.462368, 0.462723, 0.463079, 0.463434, 0.463790, 0.464145, 0.464501, 0.464857, 0.465213, 0.465570, 0.465926, 0.466283, 0.466640,
-        0.466996, 0.467354, 0.467711, 0.468068, 0.468426, 0.468783, 0.469141, 0.469499, 0.469857, 0.470215, 0.470574, 0.470932, 0.471291, 0.471650, 0.472009, 0.472368, 0.472728,
-        0.473087, 0.473447, 0.473806, 0.474166, 0.474526, 0.474887, 0.475247, 0.475607, 0.475968, 0.476329, 0.476690, 0.477051, 0.477412, 0.477774, 0.478135, 0.478497, 0.478859,
-        0.479221, 0.479583, 0.479945, 0.480308, 0.480671, 0.481033, 0.481396, 0.481759, 0.482123, 0.482486, 0.482849, 0.483213, 0.483577, 0.483941, 0.484305, 0.484669, 0.485034,
-        0.485398, 0.485763, 0.486128, 0.486493, 0.486858, 0.487224, 0.487589, 0.487955, 0.488321, 0.488686, 0.489053, 0.489419, 0.489785, 0.490152, 0.490518, 0.490885, 0.491252,
-        0.491619, 0.491987, 0.492354, 0.492722, 0.493090, 0.493457, 0.493825, 0.494194, 0.494562, 0.494931, 0.495299, 0.495668, 0.496037, 0.496406, 0.496775, 0.497145, 0.497514,
-        0.497884, 0.498254, 0.498624, 0.498994, 0.499364, 0.499735, 0.500105, 0.500476, 0.500847, 0.501218, 0.501589, 0.501961, 0.502332, 0.502704, 0.503076, 0.503448, 0.503820,
-        0.504192, 0.504565, 0.504937, 0.505310, 0.505683, 0.506056, 0.506429, 0.506802, 0.507176, 0.507550, 0.507923, 0.508297, 0.508671, 0.509046, 0.509420, 0.509795, 0.510169,
-        0.510544, 0.510919, 0.511294, 0.511670, 0.512045, 0.512421, 0.512797, 0.513172, 0.513549, 0.513925, 0.514301, 0.514678, 0.515054, 0.515431, 0.515808, 0.516185, 0.516563,
-        0.516940, 0.517318, 0.517695, 0.518073, 0.518451, 0.518829, 0.519208, 0.519586, 0.519965, 0.520344, 0.520723, 0.521102, 0.521481, 0.521860, 0.522240, 0.522620, 0.522999,
-        0.523380, 0.523760, 0.524140, 0.524520, 0.524901, 0.525282, 0.525663, 0.526044, 0.526425, 0.526806, 0.527188, 0.527570, 0.527951, 0.528333, 0.528716, 0.529098, 0.529480,
-        0.529863, 0.530246, 0.530629, 0.531012, 0.531395, 0.531778, 0.532162, 0.532545, 0.532929, 0.533313, 0.533697, 0.534081, 0.534466, 0.534850, 0.535235, 0.535620, 0.536005,
-        0.536390, 0.536776, 0.537161, 0.537547, 0.537933, 0.538318, 0.538705, 0.539091, 0.539477, 0.539864, 0.540250, 0.540637, 0.541024, 0.541411, 0.541799, 0.542186, 0.542574,
-        0.542962, 0.543350, 0.543738, 0.544126, 0.544514, 0.544903, 0.545291, 0.545680, 0.546069, 0.546458, 0.546848, 0.547237, 0.547627, 0.548016, 0.548406, 0.548796, 0.549187,
-        0.549577, 0.549967, 0.550358, 0.550749, 0.551140, 0.551531, 0.551922, 0.552314, 0.552705, 0.553097, 0.553489, 0.553881, 0.554273, 0.554666, 0.555058, 0.555451, 0.555843,
-        0.556236, 0.556630, 0.557023, 0.557416, 0.557810, 0.558203, 0.558597, 0.558991, 0.559386, 0.559780, 0.560174, 0.560569, 0.560964, 0.561359, 0.561754, 0.562149, 0.562544,
-        0.562940, 0.563336, 0.563732, 0.564128, 0.564524, 0.564920, 0.565317, 0.565713, 0.566110, 0.566507, 0.566904, 0.567301, 0.567699, 0.568096, 0.568494, 0.568892, 0.569290,
-        0.569688, 0.570086, 0.570485, 0.570883, 0.571282, 0.571681, 0.572080, 0.572479, 0.572879, 0.573278, 0.573678, 0.574078, 0.574478, 0.574878, 0.575278, 0.575679, 0.576079,
-        0.576480, 0.576881, 0.577282, 0.577683, 0.578084, 0.578486, 0.578888, 0.579289, 0.579691, 0.580094, 0.580496, 0.580898, 0.581301, 0.581704, 0.582107, 0.582510, 0.582913,
-        0.583316, 0.583720, 0.584123, 0.584527, 0.584931, 0.585335, 0.585740, 0.586144, 0.586549, 0.586953, 0.587358, 0.587763, 0.588169, 0.588574, 0.588979, 0.589385, 0.589791,
-        0.590197, 0.590603, 0.591009, 0.591416, 0.591822, 0.592229, 0.592636, 0.593043, 0.593450, 0.593858, 0.594265, 0.594673, 0.595081, 0.595489, 0.595897, 0.596305, 0.596713,
-        0.597122, 0.597531, 0.597940, 0.598349, 0.598758, 0.599167, 0.599577, 0.599986, 0.600396, 0.600806, 0.601216, 0.601627, 0.602037, 0.602448, 0.602858, 0.603269, 0.603680,
-        0.604092, 0.604503, 0.604914, 0.605326, 0.605738, 0.606150, 0.606562, 0.606974, 0.607387, 0.607799, 0.608212, 0.608625, 0.609038, 0.609451, 0.609865, 0.610278, 0.610692,
-        0.611106, 0.611520, 0.611934, 0.612348, 0.612762, 0.613177, 0.613592, 0.614007, 0.614422, 0.614837, 0.615252, 0.615668, 0.616084, 0.616499, 0.616915, 0.617331, 0.617748,
-        0.618164, 0.618581, 0.618998, 0.619415, 0.619832, 0.620249, 0.620666, 0.621084, 0.621501, 0.621919, 0.622337, 0.622755, 0.623174, 0.623592, 0.624011, 0.624429, 0.624848,
-        0.625267, 0.625687, 0.626106, 0.626526, 0.626945, 0.627365, 0.627785, 0.628205, 0.628626, 0.629046, 0.629467, 0.629887, 0.630308, 0.630729, 0.631151, 0.631572, 0.631994,
-        0.632415, 0.632837, 0.633259, 0.633681, 0.634104, 0.634526, 0.634949, 0.635372, 0.635795, 0.636218, 0.636641, 0.637064, 0.637488, 0.637912, 0.638335, 0.638759, 0.639184,
-        0.639608, 0.640032, 0.640457, 0.640882, 0.641307, 0.641732, 0.642157, 0.642583, 0.643008, 0.643434, 0.643860, 0.644286, 0.644712, 0.645138, 0.645565, 0.645992, 0.646418,
-        0.646845, 0.647272, 0.647700, 0.648127, 0.648555, 0.648983, 0.649410, 0.649838, 0.650267, 0.650695, 0.651124, 0.651552, 0.651981, 0.652410, 0.652839, 0.653268, 0.653698,
-        0.654128, 0.654557, 0.654987, 0.655417, 0.655848, 0.656278, 0.656708, 0.657139, 0.657570, 0.658001, 0.658432, 0.658863, 0.659295, 0.659727, 0.660158, 0.660590, 0.661022,
-        0.661455, 0.661887, 0.662320, 0.662752, 0.663185, 0.663618, 0.664051, 0.664485, 0.664918, 0.665352, 0.665786, 0.666220, 0.666654, 0.667088, 0.667522, 0.667957, 0.668392,
-        0.668827, 0.669262, 0.669697, 0.670132, 0.670568, 0.671003, 0.671439, 0.671875, 0.672311, 0.672748, 0.673184, 0.673621, 0.674057, 0.674494, 0.674931, 0.675369, 0.675806,
-        0.676243, 0.676681, 0.677119, 0.677557, 0.677995, 0.678433, 0.678872, 0.679311, 0.679749, 0.680188, 0.680627, 0.681067, 0.681506, 0.681946, 0.682385, 0.682825, 0.683265,
-        0.683705, 0.684146, 0.684586, 0.685027, 0.685468, 0.685909, 0.686350, 0.686791, 0.687232, 0.687674, 0.688116, 0.688558, 0.689000, 0.689442, 0.689884, 0.690327, 0.690770,
-        0.691212, 0.691655, 0.692099, 0.692542, 0.692985, 0.693429, 0.693873, 0.694317, 0.694761, 0.695205, 0.695649, 0.696094, 0.696539, 0.696983, 0.697428, 0.697874, 0.698319,
-        0.698765, 0.699210, 0.699656, 0.700102, 0.700548, 0.700994, 0.701441, 0.701887, 0.702334, 0.702781, 0.703228, 0.703675, 0.704123, 0.704570, 0.705018, 0.705466, 0.705914,
-        0.706362, 0.706810, 0.707259, 0.707707, 0.708156, 0.708605, 0.709054, 0.709503, 0.709953, 0.710402, 0.710852, 0.711302, 0.711752, 0.712202, 0.712652, 0.713103, 0.713553,
-        0.714004, 0.714455, 0.714906, 0.715358, 0.715809, 0.716261, 0.716712, 0.717164, 0.717616, 0.718069, 0.718521, 0.718974, 0.719426, 0.719879, 0.720332, 0.720785, 0.721239,
-        0.721692, 0.722146, 0.722599, 0.723053, 0.723507, 0.723962, 0.724416, 0.724871, 0.725325, 0.725780, 0.726235, 0.726691, 0.727146, 0.727601, 0.728057, 0.728513, 0.728969,
-        0.729425, 0.729881, 0.730338, 0.730794, 0.731251, 0.731708, 0.732165, 0.732622, 0.733080, 0.733537, 0.733995, 0.734453, 0.734911, 0.735369, 0.735827, 0.736286, 0.736745,
-        0.737203, 0.737662, 0.738122, 0.738581, 0.739040, 0.739500, 0.739960, 0.740420, 0.740880, 0.741340, 0.741800, 0.742261, 0.742721, 0.743182, 0.743643, 0.744104, 0.744566,
-        0.745027, 0.745489, 0.745951, 0.746413, 0.746875, 0.747337, 0.747799, 0.748262, 0.748725, 0.749188, 0.749651, 0.750114, 0.750577, 0.751041, 0.751505, 0.751968, 0.752432,
-        0.752897, 0.753361, 0.753825, 0.754290, 0.754755, 0.755220, 0.755685, 0.756150, 0.756615, 0.757081, 0.757547, 0.758013, 0.758479, 0.758945, 0.759411, 0.759878, 0.760344,
-        0.760811, 0.761278, 0.761745, 0.762213, 0.762680, 0.763148, 0.763616, 0.764084, 0.764552, 0.765020, 0.765488, 0.765957, 0.766426, 0.766894, 0.767363, 0.767833, 0.768302,
-        0.768772, 0.769241, 0.769711, 0.770181, 0.770651, 0.771121, 0.771592, 0.772063, 0.772533, 0.773004, 0.773475, 0.773947, 0.774418, 0.774890, 0.775361, 0.775833, 0.776305,
-        0.776777, 0.777250, 0.777722, 0.778195, 0.778668, 0.779141, 0.779614, 0.780087, 0.780561, 0.781034, 0.781508, 0.781982, 0.782456, 0.782930, 0.783405, 0.783879, 0.784354,
-        0.784829, 0.785304, 0.785779, 0.786255, 0.786730, 0.787206, 0.787682, 0.788158, 0.788634, 0.789110, 0.789587, 0.790063, 0.790540, 0.791017, 0.791494, 0.791971, 0.792449,
-        0.792926, 0.793404, 0.793882, 0.794360, 0.794838, 0.795316, 0.795795, 0.796274, 0.796752, 0.797231, 0.797711, 0.798190, 0.798669, 0.799149, 0.799629, 0.800109, 0.800589,
-        0.801069, 0.801550, 0.802030, 0.802511, 0.802992, 0.803473, 0.803954, 0.804435, 0.804917, 0.805399, 0.805881, 0.806363, 0.806845, 0.807327, 0.807810, 0.808292, 0.808775,
-        0.809258, 0.809741, 0.810224, 0.810708, 0.811191, 0.811675, 0.812159, 0.812643, 0.813127, 0.813612, 0.814096, 0.814581, 0.815066, 0.815551, 0.816036, 0.816521, 0.817007,
-        0.817492, 0.817978, 0.818464, 0.818950, 0.819437, 0.819923, 0.820410, 0.820897, 0.821383, 0.821871, 0.822358, 0.822845, 0.823333, 0.823820, 0.824308, 0.824796, 0.825285,
-        0.825773, 0.826261, 0.826750, 0.827239, 0.827728, 0.828217, 0.828706, 0.829196, 0.829685, 0.830175, 0.830665, 0.831155, 0.831646, 0.832136, 0.832627, 0.833117, 0.833608,
-        0.834099, 0.834591, 0.835082, 0.835573, 0.836065, 0.836557, 0.837049, 0.837541, 0.838033, 0.838526, 0.839019, 0.839511, 0.840004, 0.840498, 0.840991, 0.841484, 0.841978,
-        0.842472, 0.842966, 0.843460, 0.843954, 0.844448, 0.844943, 0.845438, 0.845932, 0.846427, 0.846923, 0.847418, 0.847914, 0.848409, 0.848905, 0.849401, 0.849897, 0.850394,
-        0.850890, 0.851387, 0.851883, 0.852380, 0.852877, 0.853375, 0.853872, 0.854370, 0.854867, 0.855365, 0.855863, 0.856362, 0.856860, 0.857359, 0.857857, 0.858356, 0.858855,
-        0.859354, 0.859854, 0.860353, 0.860853, 0.861353, 0.861853, 0.862353, 0.862853, 0.863354, 0.863854, 0.864355, 0.864856, 0.865357, 0.865858, 0.866360, 0.866861, 0.867363,
-        0.867865, 0.868367, 0.868869, 0.869372, 0.869874, 0.870377, 0.870880, 0.871383, 0.871886, 0.872389, 0.872893, 0.873396, 0.873900, 0.874404, 0.874908, 0.875412, 0.875917,
-        0.876422, 0.876926, 0.877431, 0.877936, 0.878442, 0.878947, 0.879453, 0.879958, 0.880464, 0.880970, 0.881476, 0.881983, 0.882489, 0.882996, 0.883503, 0.884010, 0.884517,
-        0.885024, 0.885532, 0.886040, 0.886547, 0.887055, 0.887563, 0.888072, 0.888580, 0.889089, 0.889598, 0.890107, 0.890616, 0.891125, 0.891634, 0.892144, 0.892654, 0.893163,
-        0.893674, 0.894184, 0.894694, 0.895205, 0.895715, 0.896226, 0.896737, 0.897248, 0.897760, 0.898271, 0.898783, 0.899295, 0.899807, 0.900319, 0.900831, 0.901343, 0.901856,
-        0.902369, 0.902882, 0.903395, 0.903908, 0.904422, 0.904935, 0.905449, 0.905963, 0.906477, 0.906991, 0.907505, 0.908020, 0.908535, 0.909050, 0.909565, 0.910080, 0.910595,
-        0.911111, 0.911626, 0.912142, 0.912658, 0.913174, 0.913691, 0.914207, 0.914724, 0.915240, 0.915757, 0.916274, 0.916792, 0.917309, 0.917827, 0.918344, 0.918862, 0.919380,
-        0.919899, 0.920417, 0.920936, 0.921454, 0.921973, 0.922492, 0.923011, 0.923531, 0.924050, 0.924570, 0.925090, 0.925610, 0.926130, 0.926650, 0.927171, 0.927691, 0.928212,
-        0.928733, 0.929254, 0.929776, 0.930297, 0.930819, 0.931340, 0.931862, 0.932384, 0.932907, 0.933429, 0.933952, 0.934474, 0.934997, 0.935520, 0.936044, 0.936567, 0.937090,
-        0.937614, 0.938138, 0.938662, 0.939186, 0.939711, 0.940235, 0.940760, 0.941285, 0.941810, 0.942335, 0.942860, 0.943385, 0.943911, 0.944437, 0.944963, 0.945489, 0.946015,
-        0.946542, 0.947068, 0.947595, 0.948122, 0.948649, 0.949176, 0.949704, 0.950231, 0.950759, 0.951287, 0.951815, 0.952343, 0.952871, 0.953400, 0.953929, 0.954457, 0.954987,
-        0.955516, 0.956045, 0.956575, 0.957104, 0.957634, 0.958164, 0.958694, 0.959224, 0.959755, 0.960285, 0.960816, 0.961347, 0.961878, 0.962410, 0.962941, 0.963473, 0.964004,
-        0.964536, 0.965068, 0.965601, 0.966133, 0.966666, 0.967198, 0.967731, 0.968264, 0.968797, 0.969331, 0.969864, 0.970398, 0.970932, 0.971466, 0.972000, 0.972534, 0.973069,
-        0.973604, 0.974138, 0.974673, 0.975209, 0.975744, 0.976279, 0.976815, 0.977351, 0.977887, 0.978423, 0.978959, 0.979496, 0.980032, 0.980569, 0.981106, 0.981643, 0.982180,
-        0.982718, 0.983255, 0.983793, 0.984331, 0.984869, 0.985407, 0.985945, 0.986484, 0.987023, 0.987561, 0.988101, 0.988640, 0.989179, 0.989719, 0.990258, 0.990798, 0.991338,
-        0.991878, 0.992419, 0.992959, 0.993500, 0.994040, 0.994581, 0.995123, 0.995664, 0.996205, 0.996747, 0.997289, 0.997831, 0.998373, 0.998915, 0.999457, 1.000000
-    },
-
-    // Bit Depth:       12
-    // Reference White: P3
-    // Gamma:           2.6
-    {
-        0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000001,
-        0.000001, 0.000001, 0.000001, 0.000001, 0.000001, 0.000001, 0.000001, 0.000002, 0.000002, 0.000002, 0.000002, 0.000002, 0.000003, 0.000003, 0.000003, 0.000003, 0.000004,
-        0.000004, 0.000004, 0.000005, 0.000005, 0.000005, 0.000006, 0.000006, 0.000006, 0.000007, 0.000007, 0.000008, 0.000008, 0.000009, 0.000009, 0.000010, 0.000010, 0.000011,
-        0.000011, 0.000012, 0.000012, 0.000013, 0.000014, 0.000014, 0.000015, 0.000016, 0.000016, 0.000017, 0.000018, 0.000019, 0.000019, 0.000020, 0.000021, 0.000022, 0.000023,
-        0.000024, 0.000024, 0.000025, 0.000026, 0.000027, 0.000028, 0.000029, 0.000030, 0.000031, 0.000033, 0.000034, 0.000035, 0.000036, 0.000037, 0.000038, 0.000040, 0.000041,
-        0.000042, 0.000043, 0.000045, 0.000046, 0.000047, 0.000049, 0.000050, 0.000052, 0.000053, 0.000055, 0.000056, 0.000058, 0.000059, 0.000061, 0.000063, 0.000064, 0.000066,
-        0.000068, 0.000069, 0.000071, 0.000073, 0.000075, 0.000077, 0.000079, 0.000080, 0.000082, 0.000084, 0.000086, 0.000088, 0.000090, 0.000092, 0.000095, 0.000097, 0.000099,
-        0.000101, 0.000103, 0.000106, 0.000108, 0.000110, 0.000112, 0.000115, 0.000117, 0.000120, 0.000122, 0.000125, 0.000127, 0.000130, 0.000132, 0.000135, 0.000138, 0.000140,
-        0.000143, 0.000146, 0.000149, 0.000151, 0.000154, 0.000157, 0.000160, 0.000163, 0.000166, 0.000169, 0.000172, 0.000175, 0.000178, 0.000181, 0.000184, 0.000188, 0.000191,
-        0.000194, 0.000198, 0.000201, 0.000204, 0.000208, 0.000211, 0.000215, 0.000218, 0.000222, 0.000225, 0.000229, 0.000233, 0.000236, 0.000240, 0.000244, 0.000248, 0.000252,
-        0.000255, 0.000259, 0.000263, 0.000267, 0.000271, 0.000275, 0.000280, 0.000284, 0.000288, 0.000292, 0.000296, 0.000301, 0.000305, 0.000309, 0.000314, 0.000318, 0.000323,
-        0.000327, 0.000332, 0.000336, 0.000341, 0.000346, 0.000351, 0.000355, 0.000360, 0.000365, 0.000370, 0.000375, 0.000380, 0.000385, 0.000390, 0.000395, 0.000400, 0.000405,
-        0.000410, 0.000416, 0.000421, 0.000426, 0.000432, 0.000437, 0.000442, 0.000448, 0.000454, 0.000459, 0.000465, 0.000470, 0.000476, 0.000482, 0.000488, 0.000494, 0.000499,
-        0.000505, 0.000511, 0.000517, 0.000523, 0.000529, 0.000536, 0.000542, 0.000548, 0.000554, 0.000561, 0.000567, 0.000573, 0.000580, 0.000586, 0.000593, 0.000599, 0.000606,
-        0.000613, 0.000619, 0.000626, 0.000633, 0.000640, 0.000647, 0.000654, 0.000661, 0.000668, 0.000675, 0.000682, 0.000689, 0.000696, 0.000704, 0.000711, 0.000718, 0.000726,
-        0.000733, 0.000741, 0.000748, 0.000756, 0.000763, 0.000771, 0.000779, 0.000787, 0.000794, 0.000802, 0.000810, 0.000818, 0.000826, 0.000834, 0.000842, 0.000851, 0.000859,
-        0.000867, 0.000875, 0.000884, 0.000892, 0.000901, 0.000909, 0.000918, 0.000926, 0.000935, 0.000944, 0.000952, 0.000961, 0.000970, 0.000979, 0.000988, 0.000997, 0.001006,
-        0.001015, 0.001024, 0.001033, 0.001043, 0.001052, 0.001061, 0.001071, 0.001080, 0.001090, 0.001099, 0.001109, 0.001119, 0.001128, 0.001138, 0.001148, 0.001158, 0.001168,
-        0.001178, 0.001188, 0.001198, 0.001208, 0.001218, 0.001228, 0.001239, 0.001249, 0.001259, 0.001270, 0.001280, 0.001291, 0.001302, 0.001312, 0.001323, 0.001334, 0.001345,
-        0.001355, 0.001366, 0.001377, 0.001388, 0.001399, 0.001411, 0.001422, 0.001433, 0.001444, 0.001456, 0.001467, 0.001479, 0.001490, 0.001502, 0.001513, 0.001525, 0.001537,
-        0.001549, 0.001561, 0.001573, 0.001585, 0.001597, 0.001609, 0.001621, 0.001633, 0.001645, 0.001658, 0.001670, 0.001682, 0.001695, 0.001707, 0.001720, 0.001733, 0.001745,
-        0.001758, 0.001771, 0.001784, 0.001797, 0.001810, 0.001823, 0.001836, 0.001849, 0.001863, 0.001876, 0.001889, 0.001903, 0.001916, 0.001930, 0.001943, 0.001957, 0.001971,
-        0.001984, 0.001998, 0.002012, 0.002026, 0.002040, 0.002054, 0.002068, 0.002082, 0.002097, 0.002111, 0.002125, 0.002140, 0.002154, 0.002169, 0.002183, 0.002198, 0.002213,
-        0.002227, 0.002242, 0.002257, 0.002272, 0.002287, 0.002302, 0.002317, 0.002333, 0.002348, 0.002363, 0.002379, 0.002394, 0.002410, 0.002425, 0.002441, 0.002456, 0.002472,
-        0.002488, 0.002504, 0.002520, 0.002536, 0.002552, 0.002568, 0.002584, 0.002601, 0.002617, 0.002633, 0.002650, 0.002666, 0.002683, 0.002699, 0.002716, 0.002733, 0.002750,
-        0.002767, 0.002784, 0.002801, 0.002818, 0.002835, 0.002852, 0.002869, 0.002887, 0.002904, 0.002922, 0.002939, 0.002957, 0.002974, 0.002992, 0.003010, 0.003028, 0.003046,
-        0.003064, 0.003082, 0.003100, 0.003118, 0.003136, 0.003155, 0.003173, 0.003191, 0.003210, 0.003228, 0.003247, 0.003266, 0.003285, 0.003303, 0.003322, 0.003341, 0.003360,
-        0.003380, 0.003399, 0.003418, 0.003437, 0.003457, 0.003476, 0.003496, 0.003515, 0.003535, 0.003555, 0.003574, 0.003594, 0.003614, 0.003634, 0.003654, 0.003674, 0.003694,
-        0.003715, 0.003735, 0.003755, 0.003776, 0.003796, 0.003817, 0.003838, 0.003858, 0.003879, 0.003900, 0.003921, 0.003942, 0.003963, 0.003984, 0.004005, 0.004027, 0.004048,
-        0.004070, 0.004091, 0.004113, 0.004134, 0.004156, 0.004178, 0.004200, 0.004221, 0.004243, 0.004265, 0.004288, 0.004310, 0.004332, 0.004354, 0.004377, 0.004399, 0.004422,
-        0.004444, 0.004467, 0.004490, 0.004513, 0.004536, 0.004559, 0.004582, 0.004605, 0.004628, 0.004651, 0.004675, 0.004698, 0.004722, 0.004745, 0.004769, 0.004792, 0.004816,
-        0.004840, 0.004864, 0.004888, 0.004912, 0.004936, 0.004960, 0.004985, 0.005009, 0.005033, 0.005058, 0.005082, 0.005107, 0.005132, 0.005157, 0.005181, 0.005206, 0.005231,
-        0.005257, 0.005282, 0.005307, 0.005332, 0.005358, 0.005383, 0.005409, 0.005434, 0.005460, 0.005486, 0.005511, 0.005537, 0.005563, 0.005589, 0.005616, 0.005642, 0.005668,
-        0.005694, 0.005721, 0.005747, 0.005774, 0.005801, 0.005827, 0.005854, 0.005881, 0.005908, 0.005935, 0.005962, 0.005989, 0.006016, 0.006044, 0.006071, 0.006099, 0.006126,
-        0.006154, 0.006182, 0.006209, 0.006237, 0.006265, 0.006293, 0.006321, 0.006350, 0.006378, 0.006406, 0.006435, 0.006463, 0.006492, 0.006520, 0.006549, 0.006578, 0.006607,
-        0.006636, 0.006665, 0.006694, 0.006723, 0.006752, 0.006782, 0.006811, 0.006841, 0.006870, 0.006900, 0.006930, 0.006959, 0.006989, 0.007019, 0.007049, 0.007079, 0.007110,
-        0.007140, 0.007170, 0.007201, 0.007231, 0.007262, 0.007293, 0.007323, 0.007354, 0.007385, 0.007416, 0.007447, 0.007478, 0.007510, 0.007541, 0.007572, 0.007604, 0.007635,
-        0.007667, 0.007699, 0.007731, 0.007763, 0.007795, 0.007827, 0.007859, 0.007891, 0.007923, 0.007956, 0.007988, 0.008021, 0.008053, 0.008086, 0.008119, 0.008152, 0.008185,
-        0.008218, 0.008251, 0.008284, 0.008317, 0.008351, 0.008384, 0.008418, 0.008451, 0.008485, 0.008519, 0.008552, 0.008586, 0.008620, 0.008654, 0.008689, 0.008723, 0.008757,
-        0.008792, 0.008826, 0.008861, 0.008896, 0.008930, 0.008965, 0.009000, 0.009035, 0.009070, 0.009105, 0.009141, 0.009176, 0.009211, 0.009247, 0.009283, 0.009318, 0.009354,
-        0.009390, 0.009426, 0.009462, 0.009498, 0.009534, 0.009571, 0.009607, 0.009643, 0.009680, 0.009716, 0.009753, 0.009790, 0.009827, 0.009864, 0.009901, 0.009938, 0.009975,
-        0.010013, 0.010050, 0.010087, 0.010125, 0.010163, 0.010200, 0.010238, 0.010276, 0.010314, 0.010352, 0.010390, 0.010429, 0.010467, 0.010505, 0.010544, 0.010582, 0.010621,
-        0.010660, 0.010699, 0.010738, 0.010777, 0.010816, 0.010855, 0.010894, 0.010934, 0.010973, 0.011013, 0.011052, 0.011092, 0.011132, 0.011172, 0.011212, 0.011252, 0.011292,
-        0.011332, 0.011373, 0.011413, 0.011454, 0.011494, 0.011535, 0.011576, 0.011617, 0.011658, 0.011699, 0.011740, 0.011781, 0.011823, 0.011864, 0.011905, 0.011947, 0.011989,
-        0.012031, 0.012072, 0.012114, 0.012156, 0.012198, 0.012241, 0.012283, 0.012325, 0.012368, 0.012410, 0.012453, 0.012496, 0.012539, 0.012582, 0.012625, 0.012668, 0.012711,
-        0.012754, 0.012798, 0.012841, 0.012885, 0.012929, 0.012972, 0.013016, 0.013060, 0.013104, 0.013148, 0.013192, 0.013237, 0.013281, 0.013326, 0.013370, 0.013415, 0.013460,
-        0.013504, 0.013549, 0.013594, 0.013640, 0.013685, 0.013730, 0.013776, 0.013821, 0.013867, 0.013912, 0.013958, 0.014004, 0.014050, 0.014096, 0.014142, 0.014188, 0.014235,
-        0.014281, 0.014328, 0.014374, 0.014421, 0.014468, 0.014515, 0.014562, 0.014609, 0.014656, 0.014703, 0.014750, 0.014798, 0.014845, 0.014893, 0.014941, 0.014989, 0.015037,
-        0.015085, 0.015133, 0.015181, 0.015229, 0.015278, 0.015326, 0.015375, 0.015423, 0.015472, 0.015521, 0.015570, 0.015619, 0.015668, 0.015717, 0.015767, 0.015816, 0.015866,
-        0.015915, 0.015965, 0.016015, 0.016065, 0.016115, 0.016165, 0.016215, 0.016265, 0.016316, 0.016366, 0.016417, 0.016468, 0.016518, 0.016569, 0.016620, 0.016671, 0.016722,
-        0.016774, 0.016825, 0.016877, 0.016928, 0.016980, 0.017031, 0.017083, 0.017135, 0.017187, 0.017239, 0.017292, 0.017344, 0.017396, 0.017449, 0.017502, 0.017554, 0.017607,
-        0.017660, 0.017713, 0.017766, 0.017819, 0.017873, 0.017926, 0.017979, 0.018033, 0.018087, 0.018141, 0.018194, 0.018248, 0.018303, 0.018357, 0.018411, 0.018465, 0.018520,
-        0.018574, 0.018629, 0.018684, 0.018739, 0.018794, 0.018849, 0.018904, 0.018959, 0.019015, 0.019070, 0.019126, 0.019181, 0.019237, 0.019293, 0.019349, 0.019405, 0.019461,
-        0.019518, 0.019574, 0.019630, 0.019687, 0.019744, 0.019800, 0.019857, 0.019914, 0.019971, 0.020028, 0.020086, 0.020143, 0.020201, 0.020258, 0.020316, 0.020374, 0.020431,
-        0.020489, 0.020548, 0.020606, 0.020664, 0.020722, 0.020781, 0.020839, 0.020898, 0.020957, 0.021016, 0.021075, 0.021134, 0.021193, 0.021252, 0.021312, 0.021371, 0.021431,
-        0.021491, 0.021550, 0.021610, 0.021670, 0.021731, 0.021791, 0.021851, 0.021912, 0.021972, 0.022033, 0.022093, 0.022154, 0.022215, 0.022276, 0.022337, 0.022399, 0.022460,
-        0.022521, 0.022583, 0.022645, 0.022706, 0.022768, 0.022830, 0.022892, 0.022955, 0.023017, 0.023079, 0.023142, 0.023204, 0.023267, 0.023330, 0.023393, 0.023456, 0.023519,
-        0.023582, 0.023645, 0.023709, 0.023772, 0.023836, 0.023900, 0.023964, 0.024028, 0.024092, 0.024156, 0.024220, 0.024284, 0.024349, 0.024413, 0.024478, 0.024543, 0.024608,
-        0.024673, 0.024738, 0.024803, 0.024869, 0.024934, 0.025000, 0.025065, 0.025131, 0.025197, 0.025263, 0.025329, 0.025395, 0.025461, 0.025528, 0.025594, 0.025661, 0.025727,
-        0.025794, 0.025861, 0.025928, 0.025995, 0.026063, 0.026130, 0.026197, 0.026265, 0.026333, 0.026400, 0.026468, 0.026536, 0.026604, 0.026672, 0.026741, 0.026809, 0.026878,
-        0.026946, 0.027015, 0.027084, 0.027153, 0.027222, 0.027291, 0.027360, 0.027430, 0.027499, 0.027569, 0.027639, 0.027708, 0.027778, 0.027848, 0.027919, 0.027989, 0.028059,
-        0.028130, 0.028200, 0.028271, 0.028342, 0.028413, 0.028484, 0.028555, 0.028626, 0.028697, 0.028769, 0.028840, 0.028912, 0.028984, 0.029056, 0.029128, 0.029200, 0.029272,
-        0.029344, 0.029417, 0.029489, 0.029562, 0.029635, 0.029708, 0.029781, 0.029854, 0.029927, 0.030000, 0.030074, 0.030147, 0.030221, 0.030295, 0.030369, 0.030443, 0.030517,
-        0.030591, 0.030665, 0.030740, 0.030814, 0.030889, 0.030964, 0.031038, 0.031113, 0.031189, 0.031264, 0.031339, 0.031415, 0.031490, 0.031566, 0.031642, 0.031717, 0.031793,
-        0.031869, 0.031946, 0.032022, 0.032098, 0.032175, 0.032252, 0.032328, 0.032405, 0.032482, 0.032559, 0.032637, 0.032714, 0.032791, 0.032869, 0.032947, 0.033024, 0.033102,
-        0.033180, 0.033259, 0.033337, 0.033415, 0.033494, 0.033572, 0.033651, 0.033730, 0.033809, 0.033888, 0.033967, 0.034046, 0.034125, 0.034205, 0.034285, 0.034364, 0.034444,
-        0.034524, 0.034604, 0.034684, 0.034765, 0.034845, 0.034925, 0.035006, 0.035087, 0.035168, 0.035249, 0.035330, 0.035411, 0.035492, 0.035574, 0.035655, 0.035737, 0.035819,
-        0.035901, 0.035983, 0.036065, 0.036147, 0.036229, 0.036312, 0.036394, 0.036477, 0.036560, 0.036643, 0.036726, 0.036809, 0.036892, 0.036976, 0.037059, 0.037143, 0.037227,
-        0.037310, 0.037394, 0.037478, 0.037563, 0.037647, 0.037731, 0.037816, 0.037901, 0.037985, 0.038070, 0.038155, 0.038241, 0.038326, 0.038411, 0.038497, 0.038582, 0.038668,
-        0.038754, 0.038840, 0.038926, 0.039012, 0.039098, 0.039185, 0.039271, 0.039358, 0.039445, 0.039532, 0.039619, 0.039706, 0.039793, 0.039880, 0.039968, 0.040056, 0.040143,
-        0.040231, 0.040319, 0.040407, 0.040495, 0.040584, 0.040672, 0.040761, 0.040849, 0.040938, 0.041027, 0.041116, 0.041205, 0.041294, 0.041384, 0.041473, 0.041563, 0.041653,
-        0.041743, 0.041833, 0.041923, 0.042013, 0.042103, 0.042194, 0.042284, 0.042375, 0.042466, 0.042557, 0.042648, 0.042739, 0.042830, 0.042922, 0.043013, 0.043105, 0.043197,
-        0.043288, 0.043380, 0.043473, 0.043565, 0.043657, 0.043750, 0.043842, 0.043935, 0.044028, 0.044121, 0.044214, 0.044307, 0.044401, 0.044494, 0.044588, 0.044681, 0.044775,
-        0.044869, 0.044963, 0.045057, 0.045152, 0.045246, 0.045341, 0.045435, 0.045530, 0.045625, 0.045720, 0.045815, 0.045910, 0.046006, 0.046101, 0.046197, 0.046293, 0.046389,
-        0.046485, 0.046581, 0.046677, 0.046773, 0.046870, 0.046967, 0.047063, 0.047160, 0.047257, 0.047354, 0.047451, 0.047549, 0.047646, 0.047744, 0.047842, 0.047940, 0.048037,
-        0.048136, 0.048234, 0.048332, 0.048431, 0.048529, 0.048628, 0.048727, 0.048826, 0.048925, 0.049024, 0.049123, 0.049223, 0.049322, 0.049422, 0.049522, 0.049622, 0.049722,
-        0.049822, 0.049922, 0.050023, 0.050123, 0.050224, 0.050325, 0.050426, 0.050527, 0.050628, 0.050730, 0.050831, 0.050933, 0.051034, 0.051136, 0.051238, 0.051340, 0.051442,
-        0.051545, 0.051647, 0.051750, 0.051852, 0.051955, 0.052058, 0.052161, 0.052264, 0.052368, 0.052471, 0.052575, 0.052678, 0.052782, 0.052886, 0.052990, 0.053094, 0.053199,
-        0.053303, 0.053408, 0.053512, 0.053617, 0.053722, 0.053827, 0.053933, 0.054038, 0.054143, 0.054249, 0.054355, 0.054460, 0.054566, 0.054673, 0.054779, 0.054885, 0.054992,
-        0.055098, 0.055205, 0.055312, 0.055419, 0.055526, 0.055633, 0.055741, 0.055848, 0.055956, 0.056063, 0.056171, 0.056279, 0.056387, 0.056496, 0.056604, 0.056713, 0.056821,
-        0.056930, 0.057039, 0.057148, 0.057257, 0.057366, 0.057476, 0.057585, 0.057695, 0.057805, 0.057915, 0.058025, 0.058135, 0.058245, 0.058356, 0.058466, 0.058577, 0.058688,
-        0.058799, 0.058910, 0.059021, 0.059132, 0.059244, 0.059355, 0.059467, 0.059579, 0.059691, 0.059803, 0.059915, 0.060028, 0.060140, 0.060253, 0.060366, 0.060479, 0.060592,
-        0.060705, 0.060818, 0.060932, 0.061045, 0.061159, 0.061273, 0.061386, 0.061501, 0.061615, 0.061729, 0.061844, 0.061958, 0.062073, 0.062188, 0.062303, 0.062418, 0.062533,
-        0.062648, 0.062764, 0.062880, 0.062995, 0.063111, 0.063227, 0.063343, 0.063460, 0.063576, 0.063693, 0.063809, 0.063926, 0.064043, 0.064160, 0.064277, 0.064395, 0.064512,
-        0.064630, 0.064748, 0.064865, 0.064983, 0.065102, 0.065220, 0.065338, 0.065457, 0.065575, 0.065694, 0.065813, 0.065932, 0.066051, 0.066171, 0.066290, 0.066410, 0.066530,
-        0.066649, 0.066769, 0.066890, 0.067010, 0.067130, 0.067251, 0.067371, 0.067492, 0.067613, 0.067734, 0.067855, 0.067977, 0.068098, 0.068220, 0.068341, 0.068463, 0.068585,
-        0.068707, 0.068830, 0.068952, 0.069074, 0.069197, 0.069320, 0.069443, 0.069566, 0.069689, 0.069812, 0.069936, 0.070059, 0.070183, 0.070307, 0.070431, 0.070555, 0.070679,
-        0.070804, 0.070928, 0.071053, 0.071178, 0.071303, 0.071428, 0.071553, 0.071678, 0.071804, 0.071930, 0.072055, 0.072181, 0.072307, 0.072433, 0.072560, 0.072686, 0.072813,
-        0.072939, 0.073066, 0.073193, 0.073320, 0.073448, 0.073575, 0.073702, 0.073830, 0.073958, 0.074086, 0.074214, 0.074342, 0.074470, 0.074599, 0.074727, 0.074856, 0.074985,
-        0.075114, 0.075243, 0.075372, 0.075502, 0.075631, 0.075761, 0.075891, 0.076021, 0.076151, 0.076281, 0.076412, 0.076542, 0.076673, 0.076804, 0.076935, 0.077066, 0.077197,
-        0.077328, 0.077460, 0.077591, 0.077723, 0.077855, 0.077987, 0.078119, 0.078251, 0.078384, 0.078516, 0.078649, 0.078782, 0.078915, 0.079048, 0.079181, 0.079315, 0.079448,
-        0.079582, 0.079716, 0.079850, 0.079984, 0.080118, 0.080252, 0.080387, 0.080522, 0.080656, 0.080791, 0.080926, 0.081062, 0.081197, 0.081332, 0.081468, 0.081604, 0.081740,
-        0.081876, 0.082012, 0.082148, 0.082285, 0.082421, 0.082558, 0.082695, 0.082832, 0.082969, 0.083106, 0.083244, 0.083381, 0.083519, 0.083657, 0.083795, 0.083933, 0.084071,
-        0.084210, 0.084348, 0.084487, 0.084626, 0.084765, 0.084904, 0.085043, 0.085183, 0.085322, 0.085462, 0.085602, 0.085742, 0.085882, 0.086022, 0.086162, 0.086303, 0.086444,
-        0.086584, 0.086725, 0.086866, 0.087008, 0.087149, 0.087291, 0.087432, 0.087574, 0.087716, 0.087858, 0.088000, 0.088143, 0.088285, 0.088428, 0.088570, 0.088713, 0.088856,
-        0.089000, 0.089143, 0.089287, 0.089430, 0.089574, 0.089718, 0.089862, 0.090006, 0.090150, 0.090295, 0.090440, 0.090584, 0.090729, 0.090874, 0.091020, 0.091165, 0.091310,
-        0.091456, 0.091602, 0.091748, 0.091894, 0.092040, 0.092186, 0.092333, 0.092479, 0.092626, 0.092773, 0.092920, 0.093067, 0.093215, 0.093362, 0.093510, 0.093658, 0.093806,
-        0.093954, 0.094102, 0.094250, 0.094399, 0.094547, 0.094696, 0.094845, 0.094994, 0.095143, 0.095293, 0.095442, 0.095592, 0.095742, 0.095892, 0.096042, 0.096192, 0.096342,
-        0.096493, 0.096643, 0.096794, 0.096945, 0.097096, 0.097248, 0.097399, 0.097550, 0.097702, 0.097854, 0.098006, 0.098158, 0.098310, 0.098463, 0.098615, 0.098768, 0.098921,
-        0.099074, 0.099227, 0.099380, 0.099534, 0.099687, 0.099841, 0.099995, 0.100149, 0.100303, 0.100457, 0.100612, 0.100766, 0.100921, 0.101076, 0.101231, 0.101386, 0.101541,
-        0.101697, 0.101852, 0.102008, 0.102164, 0.102320, 0.102476, 0.102633, 0.102789, 0.102946, 0.103103, 0.103259, 0.103417, 0.103574, 0.103731, 0.103889, 0.104046, 0.104204,
-        0.104362, 0.104520, 0.104678, 0.104837, 0.104995, 0.105154, 0.105313, 0.105472, 0.105631, 0.105790, 0.105950, 0.106109, 0.106269, 0.106429, 0.106589, 0.106749, 0.106909,
-        0.107070, 0.107231, 0.107391, 0.107552, 0.107713, 0.107874, 0.108036, 0.108197, 0.108359, 0.108521, 0.108683, 0.108845, 0.109007, 0.109170, 0.109332, 0.109495, 0.109658,
-        0.109821, 0.109984, 0.110147, 0.110310, 0.110474, 0.110638, 0.110802, 0.110966, 0.111130, 0.111294, 0.111459, 0.111623, 0.111788, 0.111953, 0.112118, 0.112283, 0.112449,
-        0.112614, 0.112780, 0.112946, 0.113112, 0.113278, 0.113444, 0.113611, 0.113777, 0.113944, 0.114111, 0.114278, 0.114445, 0.114612, 0.114780, 0.114948, 0.115115, 0.115283,
-        0.115451, 0.115620, 0.115788, 0.115957, 0.116125, 0.116294, 0.116463, 0.116632, 0.116802, 0.116971, 0.117141, 0.117310, 0.117480, 0.117650, 0.117821, 0.117991, 0.118161,
-        0.118332, 0.118503, 0.118674, 0.118845, 0.119016, 0.119188, 0.119359, 0.119531, 0.119703, 0.119875, 0.120047, 0.120219, 0.120392, 0.120564, 0.120737, 0.120910, 0.121083,
-        0.121256, 0.121430, 0.121603, 0.121777, 0.121951, 0.122125, 0.122299, 0.122473, 0.122648, 0.122823, 0.122997, 0.123172, 0.123347, 0.123522, 0.123698, 0.123873, 0.124049,
-        0.124225, 0.124401, 0.124577, 0.124753, 0.124930, 0.125106, 0.125283, 0.125460, 0.125637, 0.125814, 0.125992, 0.126169, 0.126347, 0.126525, 0.126703, 0.126881, 0.127059,
-        0.127238, 0.127416, 0.127595, 0.127774, 0.127953, 0.128132, 0.128312, 0.128491, 0.128671, 0.128851, 0.129031, 0.129211, 0.129391, 0.129572, 0.129752, 0.129933, 0.130114,
-        0.130295, 0.130476, 0.130658, 0.130839, 0.131021, 0.131203, 0.131385, 0.131567, 0.131749, 0.131932, 0.132114, 0.132297, 0.132480, 0.132663, 0.132847, 0.133030, 0.133213,
-        0.133397, 0.133581, 0.133765, 0.133949, 0.134134, 0.134318, 0.134503, 0.134688, 0.134873, 0.135058, 0.135243, 0.135428, 0.135614, 0.135800, 0.135986, 0.136172, 0.136358,
-        0.136544, 0.136731, 0.136918, 0.137104, 0.137291, 0.137479, 0.137666, 0.137853, 0.138041, 0.138229, 0.138417, 0.138605, 0.138793, 0.138982, 0.139170, 0.139359, 0.139548,
-        0.139737, 0.139926, 0.140115, 0.140305, 0.140495, 0.140684, 0.140874, 0.141065, 0.141255, 0.141445, 0.141636, 0.141827, 0.142018, 0.142209, 0.142400, 0.142592, 0.142783,
-        0.142975, 0.143167, 0.143359, 0.143551, 0.143743, 0.143936, 0.144129, 0.144321, 0.144514, 0.144708, 0.144901, 0.145094, 0.145288, 0.145482, 0.145676, 0.145870, 0.146064,
-        0.146259, 0.146453, 0.146648, 0.146843, 0.147038, 0.147233, 0.147429, 0.147624, 0.147820, 0.148016, 0.148212, 0.148408, 0.148604, 0.148801, 0.148997, 0.149194, 0.149391,
-        0.149588, 0.149786, 0.149983, 0.150181, 0.150379, 0.150576, 0.150775, 0.150973, 0.151171, 0.151370, 0.151569, 0.151768, 0.151967, 0.152166, 0.152365, 0.152565, 0.152764,
-        0.152964, 0.153164, 0.153365, 0.153565, 0.153765, 0.153966, 0.154167, 0.154368, 0.154569, 0.154770, 0.154972, 0.155174, 0.155375, 0.155577, 0.155780, 0.155982, 0.156184,
-        0.156387, 0.156590, 0.156793, 0.156996, 0.157199, 0.157402, 0.157606, 0.157810, 0.158014, 0.158218, 0.158422, 0.158626, 0.158831, 0.159036, 0.159240, 0.159445, 0.159651,
-        0.159856, 0.160062, 0.160267, 0.160473, 0.160679, 0.160885, 0.161092, 0.161298, 0.161505, 0.161712, 0.161919, 0.162126, 0.162333, 0.162541, 0.162748, 0.162956, 0.163164,
-        0.163372, 0.163581, 0.163789, 0.163998, 0.164206, 0.164415, 0.164625, 0.164834, 0.165043, 0.165253, 0.165463, 0.165673, 0.165883, 0.166093, 0.166303, 0.166514, 0.166725,
-        0.166936, 0.167147, 0.167358, 0.167569, 0.167781, 0.167993, 0.168205, 0.168417, 0.168629, 0.168841, 0.169054, 0.169267, 0.169479, 0.169693, 0.169906, 0.170119, 0.170333,
-        0.170546, 0.170760, 0.170974, 0.171189, 0.171403, 0.171617, 0.171832, 0.172047, 0.172262, 0.172477, 0.172693, 0.172908, 0.173124, 0.173340, 0.173556, 0.173772, 0.173988,
-        0.174205, 0.174422, 0.174638, 0.174855, 0.175073, 0.175290, 0.175508, 0.175725, 0.175943, 0.176161, 0.176379, 0.176598, 0.176816, 0.177035, 0.177254, 0.177473, 0.177692,
-        0.177911, 0.178131, 0.178350, 0.178570, 0.178790, 0.179011, 0.179231, 0.179451, 0.179672, 0.179893, 0.180114, 0.180335, 0.180556, 0.180778, 0.181000, 0.181222, 0.181444,
-        0.181666, 0.181888, 0.182111, 0.182333, 0.182556, 0.182779, 0.183002, 0.183226, 0.183449, 0.183673, 0.183897, 0.184121, 0.184345, 0.184569, 0.184794, 0.185019, 0.185244,
-        0.185469, 0.185694, 0.185919, 0.186145, 0.186370, 0.186596, 0.186822, 0.187049, 0.187275, 0.187502, 0.187728, 0.187955, 0.188182, 0.188409, 0.188637, 0.188864, 0.189092,
-        0.189320, 0.189548, 0.189776, 0.190005, 0.190233, 0.190462, 0.190691, 0.190920, 0.191149, 0.191379, 0.191608, 0.191838, 0.192068, 0.192298, 0.192529, 0.192759, 0.192990,
-        0.193220, 0.193451, 0.193682, 0.193914, 0.194145, 0.194377, 0.194609, 0.194841, 0.195073, 0.195305, 0.195538, 0.195770, 0.196003, 0.196236, 0.196469, 0.196703, 0.196936,
-        0.197170, 0.197404, 0.197638, 0.197872, 0.198106, 0.198341, 0.198575, 0.198810, 0.199045, 0.199281, 0.199516, 0.199751, 0.199987, 0.200223, 0.200459, 0.200695, 0.200932,
-        0.201168, 0.201405, 0.201642, 0.201879, 0.202116, 0.202354, 0.202591, 0.202829, 0.203067, 0.203305, 0.203544, 0.203782, 0.204021, 0.204260, 0.204499, 0.204738, 0.204977,
-        0.205217, 0.205456, 0.205696, 0.205936, 0.206176, 0.206417, 0.206657, 0.206898, 0.207139, 0.207380, 0.207621, 0.207862, 0.208104, 0.208346, 0.208588, 0.208830, 0.209072,
-        0.209314, 0.209557, 0.209800, 0.210043, 0.210286, 0.210529, 0.210773, 0.211016, 0.211260, 0.211504, 0.211748, 0.211993, 0.212237, 0.212482, 0.212727, 0.212972, 0.213217,
-        0.213462, 0.213708, 0.213954, 0.214200, 0.214446, 0.214692, 0.214938, 0.215185, 0.215432, 0.215679, 0.215926, 0.216173, 0.216420, 0.216668, 0.216916, 0.217164, 0.217412,
-        0.217660, 0.217909, 0.218158, 0.218407, 0.218656, 0.218905, 0.219154, 0.219404, 0.219653, 0.219903, 0.220153, 0.220404, 0.220654, 0.220905, 0.221156, 0.221407, 0.221658,
-        0.221909, 0.222160, 0.222412, 0.222664, 0.222916, 0.223168, 0.223421, 0.223673, 0.223926, 0.224179, 0.224432, 0.224685, 0.224938, 0.225192, 0.225446, 0.225700, 0.225954,
-        0.226208, 0.226463, 0.226717, 0.226972, 0.227227, 0.227482, 0.227738, 0.227993, 0.228249, 0.228505, 0.228761, 0.229017, 0.229273, 0.229530, 0.229787, 0.230044, 0.230301,
-        0.230558, 0.230816, 0.231073, 0.231331, 0.231589, 0.231847, 0.232106, 0.232364, 0.232623, 0.232882, 0.233141, 0.233400, 0.233660, 0.233919, 0.234179, 0.234439, 0.234699,
-        0.234959, 0.235220, 0.235480, 0.235741, 0.236002, 0.236264, 0.236525, 0.236786, 0.237048, 0.237310, 0.237572, 0.237834, 0.238097, 0.238360, 0.238622, 0.238885, 0.239148,
-        0.239412, 0.239675, 0.239939, 0.240203, 0.240467, 0.240731, 0.240996, 0.241260, 0.241525, 0.241790, 0.242055, 0.242320, 0.242586, 0.242851, 0.243117, 0.243383, 0.243649,
-        0.243916, 0.244182, 0.244449, 0.244716, 0.244983, 0.245250, 0.245518, 0.245785, 0.246053, 0.246321, 0.246589, 0.246858, 0.247126, 0.247395, 0.247664, 0.247933, 0.248202,
-        0.248472, 0.248741, 0.249011, 0.249281, 0.249551, 0.249821, 0.250092, 0.250363, 0.250633, 0.250905, 0.251176, 0.251447, 0.251719, 0.251990, 0.252262, 0.252535, 0.252807,
-        0.253079, 0.253352, 0.253625, 0.253898, 0.254171, 0.254445, 0.254718, 0.254992, 0.255266, 0.255540, 0.255814, 0.256089, 0.256363, 0.256638, 0.256913, 0.257188, 0.257464,
-        0.257739, 0.258015, 0.258291, 0.258567, 0.258843, 0.259120, 0.259397, 0.259673, 0.259950, 0.260228, 0.260505, 0.260783, 0.261060, 0.261338, 0.261616, 0.261895, 0.262173,
-        0.262452, 0.262731, 0.263010, 0.263289, 0.263568, 0.263848, 0.264128, 0.264407, 0.264688, 0.264968, 0.265248, 0.265529, 0.265810, 0.266091, 0.266372, 0.266654, 0.266935,
-        0.267217, 0.267499, 0.267781, 0.268063, 0.268346, 0.268628, 0.268911, 0.269194, 0.269478, 0.269761, 0.270045, 0.270328, 0.270612, 0.270896, 0.271181, 0.271465, 0.271750,
-        0.272035, 0.272320, 0.272605, 0.272891, 0.273176, 0.273462, 0.273748, 0.274034, 0.274320, 0.274607, 0.274894, 0.275181, 0.275468, 0.275755, 0.276042, 0.276330, 0.276618,
-        0.276906, 0.277194, 0.277482, 0.277771, 0.278060, 0.278349, 0.278638, 0.278927, 0.279217, 0.279506, 0.279796, 0.280086, 0.280376, 0.280667, 0.280957, 0.281248, 0.281539,
-        0.281830, 0.282122, 0.282413, 0.282705, 0.282997, 0.283289, 0.283581, 0.283873, 0.284166, 0.284459, 0.284752, 0.285045, 0.285338, 0.285632, 0.285926, 0.286220, 0.286514,
-        0.286808, 0.287103, 0.287397, 0.287692, 0.287987, 0.288282, 0.288578, 0.288873, 0.289169, 0.289465, 0.289761, 0.290058, 0.290354, 0.290651, 0.290948, 0.291245, 0.291542,
-        0.291840, 0.292137, 0.292435, 0.292733, 0.293031, 0.293330, 0.293628, 0.293927, 0.294226, 0.294525, 0.294825, 0.295124, 0.295424, 0.295724, 0.296024, 0.296324, 0.296625,
-        0.296925, 0.297226, 0.297527, 0.297828, 0.298130, 0.298431, 0.298733, 0.299035, 0.299337, 0.299640, 0.299942, 0.300245, 0.300548, 0.300851, 0.301154, 0.301457, 0.301761,
-        0.302065, 0.302369, 0.302673, 0.302978, 0.303282, 0.303587, 0.303892, 0.304197, 0.304502, 0.304808, 0.305114, 0.305420, 0.305726, 0.306032, 0.306339, 0.306645, 0.306952,
-        0.307259, 0.307566, 0.307874, 0.308181, 0.308489, 0.308797, 0.309105, 0.309414, 0.309722, 0.310031, 0.310340, 0.310649, 0.310958, 0.311268, 0.311578, 0.311887, 0.312198,
-        0.312508, 0.312818, 0.313129, 0.313440, 0.313751, 0.314062, 0.314373, 0.314685, 0.314997, 0.315309, 0.315621, 0.315933, 0.316246, 0.316559, 0.316871, 0.317185, 0.317498,
-        0.317811, 0.318125, 0.318439, 0.318753, 0.319067, 0.319382, 0.319696, 0.320011, 0.320326, 0.320641, 0.320957, 0.321272, 0.321588, 0.321904, 0.322220, 0.322537, 0.322853,
-        0.323170, 0.323487, 0.323804, 0.324121, 0.324439, 0.324757, 0.325074, 0.325392, 0.325711, 0.326029, 0.326348, 0.326667, 0.326986, 0.327305, 0.327624, 0.327944, 0.328264,
-        0.328584, 0.328904, 0.329224, 0.329545, 0.329866, 0.330187, 0.330508, 0.330829, 0.331151, 0.331472, 0.331794, 0.332116, 0.332439, 0.332761, 0.333084, 0.333407, 0.333730,
-        0.334053, 0.334377, 0.334700, 0.335024, 0.335348, 0.335672, 0.335997, 0.336321, 0.336646, 0.336971, 0.337296, 0.337622, 0.337947, 0.338273, 0.338599, 0.338925, 0.339251,
-        0.339578, 0.339905, 0.340232, 0.340559, 0.340886, 0.341214, 0.341541, 0.341869, 0.342197, 0.342526, 0.342854, 0.343183, 0.343512, 0.343841, 0.344170, 0.344499, 0.344829,
-        0.345159, 0.345489, 0.345819, 0.346150, 0.346480, 0.346811, 0.347142, 0.347473, 0.347804, 0.348136, 0.348468, 0.348800, 0.349132, 0.349464, 0.349797, 0.350130, 0.350463,
-        0.350796, 0.351129, 0.351463, 0.351796, 0.352130, 0.352464, 0.352799, 0.353133, 0.353468, 0.353803, 0.354138, 0.354473, 0.354809, 0.355144, 0.355480, 0.355816, 0.356152,
-        0.356489, 0.356826, 0.357162, 0.357499, 0.357837, 0.358174, 0.358512, 0.358850, 0.359188, 0.359526, 0.359864, 0.360203, 0.360542, 0.360881, 0.361220, 0.361559, 0.361899,
-        0.362239, 0.362579, 0.362919, 0.363259, 0.363600, 0.363941, 0.364282, 0.364623, 0.364964, 0.365306, 0.365647, 0.365989, 0.366331, 0.366674, 0.367016, 0.367359, 0.367702,
-        0.368045, 0.368388, 0.368732, 0.369076, 0.369420, 0.369764, 0.370108, 0.370453, 0.370797, 0.371142, 0.371487, 0.371833, 0.372178, 0.372524, 0.372870, 0.373216, 0.373562,
-        0.373908, 0.374255, 0.374602, 0.374949, 0.375296, 0.375644, 0.375992, 0.376339, 0.376687, 0.377036, 0.377384, 0.377733, 0.378082, 0.378431, 0.378780, 0.379129, 0.379479,
-        0.379829, 0.380179, 0.380529, 0.380880, 0.381230, 0.381581, 0.381932, 0.382283, 0.382635, 0.382987, 0.383338, 0.383690, 0.384043, 0.384395, 0.384748, 0.385101, 0.385454,
-        0.385807, 0.386160, 0.386514, 0.386868, 0.387222, 0.387576, 0.387930, 0.388285, 0.388640, 0.388995, 0.389350, 0.389705, 0.390061, 0.390417, 0.390773, 0.391129, 0.391486,
-        0.391842, 0.392199, 0.392556, 0.392913, 0.393271, 0.393628, 0.393986, 0.394344, 0.394702, 0.395061, 0.395419, 0.395778, 0.396137, 0.396496, 0.396856, 0.397215, 0.397575,
-        0.397935, 0.398296, 0.398656, 0.399017, 0.399377, 0.399738, 0.400100, 0.400461, 0.400823, 0.401185, 0.401547, 0.401909, 0.402271, 0.402634, 0.402997, 0.403360, 0.403723,
-        0.404086, 0.404450, 0.404814, 0.405178, 0.405542, 0.405907, 0.406271, 0.406636, 0.407001, 0.407366, 0.407732, 0.408098, 0.408463, 0.408829, 0.409196, 0.409562, 0.409929,
-        0.410296, 0.410663, 0.411030, 0.411397, 0.411765, 0.412133, 0.412501, 0.412869, 0.413238, 0.413607, 0.413975, 0.414345, 0.414714, 0.415083, 0.415453, 0.415823, 0.416193,
-        0.416563, 0.416934, 0.417305, 0.417675, 0.418047, 0.418418, 0.418789, 0.419161, 0.419533, 0.419905, 0.420277, 0.420650, 0.421023, 0.421396, 0.421769, 0.422142, 0.422516,
-        0.422890, 0.423263, 0.423638, 0.424012, 0.424387, 0.424761, 0.425136, 0.425511, 0.425887, 0.426262, 0.426638, 0.427014, 0.427390, 0.427767, 0.428143, 0.428520, 0.428897,
-        0.429274, 0.429652, 0.430030, 0.430407, 0.430785, 0.431164, 0.431542, 0.431921, 0.432300, 0.432679, 0.433058, 0.433437, 0.433817, 0.434197, 0.434577, 0.434957, 0.435338,
-        0.435718, 0.436099, 0.436480, 0.436862, 0.437243, 0.437625, 0.438007, 0.438389, 0.438771, 0.439154, 0.439537, 0.439920, 0.440303, 0.440686, 0.441070, 0.441453, 0.441837,
-        0.442222, 0.442606, 0.442991, 0.443375, 0.443760, 0.444146, 0.444531, 0.444917, 0.445302, 0.445689, 0.446075, 0.446461, 0.446848, 0.447235, 0.447622, 0.448009, 0.448396,
-        0.448784, 0.449172, 0.449560, 0.449948, 0.450337, 0.450726, 0.451115, 0.451504, 0.451893, 0.452283, 0.452672, 0.453062, 0.453452, 0.453843, 0.454233, 0.454624, 0.455015,
-        0.455406, 0.455798, 0.456189, 0.456581, 0.456973, 0.457365, 0.457758, 0.458150, 0.458543, 0.458936, 0.459330, 0.459723, 0.460117, 0.460511, 0.460905, 0.461299, 0.461694,
-        0.462088, 0.462483, 0.462878, 0.463274, 0.463669, 0.464065, 0.464461, 0.464857, 0.465253, 0.465650, 0.466047, 0.466444, 0.466841, 0.467238, 0.467636, 0.468034, 0.468432,
-        0.468830, 0.469229, 0.469627, 0.470026, 0.470425, 0.470825, 0.471224, 0.471624, 0.472024, 0.472424, 0.472824, 0.473225, 0.473625, 0.474026, 0.474428, 0.474829, 0.475230,
-        0.475632, 0.476034, 0.476437, 0.476839, 0.477242, 0.477644, 0.478047, 0.478451, 0.478854, 0.479258, 0.479662, 0.480066, 0.480470, 0.480875, 0.481279, 0.481684, 0.482089,
-        0.482495, 0.482900, 0.483306, 0.483712, 0.484118, 0.484525, 0.484931, 0.485338, 0.485745, 0.486152, 0.486560, 0.486968, 0.487375, 0.487783, 0.488192, 0.488600, 0.489009,
-        0.489418, 0.489827, 0.490236, 0.490646, 0.491056, 0.491466, 0.491876, 0.492286, 0.492697, 0.493108, 0.493519, 0.493930, 0.494341, 0.494753, 0.495165, 0.495577, 0.495989,
-        0.496402, 0.496815, 0.497227, 0.497641, 0.498054, 0.498468, 0.498881, 0.499295, 0.499709, 0.500124, 0.500538, 0.500953, 0.501368, 0.501784, 0.502199, 0.502615, 0.503031,
-        0.503447, 0.503863, 0.504280, 0.504696, 0.505113, 0.505530, 0.505948, 0.506365, 0.506783, 0.507201, 0.507619, 0.508038, 0.508456, 0.508875, 0.509294, 0.509714, 0.510133,
-        0.510553, 0.510973, 0.511393, 0.511813, 0.512234, 0.512655, 0.513076, 0.513497, 0.513918, 0.514340, 0.514762, 0.515184, 0.515606, 0.516028, 0.516451, 0.516874, 0.517297,
-        0.517720, 0.518144, 0.518568, 0.518992, 0.519416, 0.519840, 0.520265, 0.520690, 0.521115, 0.521540, 0.521965, 0.522391, 0.522817, 0.523243, 0.523669, 0.524096, 0.524522,
-        0.524949, 0.525377, 0.525804, 0.526232, 0.526659, 0.527087, 0.527516, 0.527944, 0.528373, 0.528802, 0.529231, 0.529660, 0.530089, 0.530519, 0.530949, 0.531379, 0.531810,
-        0.532240, 0.532671, 0.533102, 0.533533, 0.533965, 0.534396, 0.534828, 0.535260, 0.535693, 0.536125, 0.536558, 0.536991, 0.537424, 0.537857, 0.538291, 0.538725, 0.539159,
-        0.539593, 0.540028, 0.540462, 0.540897, 0.541332, 0.541768, 0.542203, 0.542639, 0.543075, 0.543511, 0.543947, 0.544384, 0.544821, 0.545258, 0.545695, 0.546133, 0.546570,
-        0.547008, 0.547446, 0.547885, 0.548323, 0.548762, 0.549201, 0.549640, 0.550080, 0.550519, 0.550959, 0.551399, 0.551839, 0.552280, 0.552721, 0.553161, 0.553603, 0.554044,
-        0.554486, 0.554927, 0.555369, 0.555812, 0.556254, 0.556697, 0.557140, 0.557583, 0.558026, 0.558469, 0.558913, 0.559357, 0.559801, 0.560246, 0.560690, 0.561135, 0.561580,
-        0.562026, 0.562471, 0.562917, 0.563363, 0.563809, 0.564255, 0.564702, 0.565148, 0.565595, 0.566043, 0.566490, 0.566938, 0.567386, 0.567834, 0.568282, 0.568731, 0.569179,
-        0.569628, 0.570077, 0.570527, 0.570976, 0.571426, 0.571876, 0.572327, 0.572777, 0.573228, 0.573679, 0.574130, 0.574581, 0.575033, 0.575485, 0.575937, 0.576389, 0.576841,
-        0.577294, 0.577747, 0.578200, 0.578653, 0.579107, 0.579561, 0.580015, 0.580469, 0.580923, 0.581378, 0.581833, 0.582288, 0.582743, 0.583199, 0.583654, 0.584110, 0.584566,
-        0.585023, 0.585479, 0.585936, 0.586393, 0.586851, 0.587308, 0.587766, 0.588224, 0.588682, 0.589140, 0.589599, 0.590058, 0.590517, 0.590976, 0.591435, 0.591895, 0.592355,
-        0.592815, 0.593275, 0.593736, 0.594197, 0.594658, 0.595119, 0.595580, 0.596042, 0.596504, 0.596966, 0.597428, 0.597891, 0.598354, 0.598817, 0.599280, 0.599743, 0.600207,
-        0.600671, 0.601135, 0.601599, 0.602064, 0.602528, 0.602993, 0.603459, 0.603924, 0.604390, 0.604856, 0.605322, 0.605788, 0.606254, 0.606721, 0.607188, 0.607655, 0.608123,
-        0.608590, 0.609058, 0.609526, 0.609995, 0.610463, 0.610932, 0.611401, 0.611870, 0.612339, 0.612809, 0.613279, 0.613749, 0.614219, 0.614690, 0.615160, 0.615631, 0.616102,
-        0.616574, 0.617045, 0.617517, 0.617989, 0.618462, 0.618934, 0.619407, 0.619880, 0.620353, 0.620826, 0.621300, 0.621774, 0.622248, 0.622722, 0.623196, 0.623671, 0.624146,
-        0.624621, 0.625097, 0.625572, 0.626048, 0.626524, 0.627000, 0.627477, 0.627954, 0.628431, 0.628908, 0.629385, 0.629863, 0.630341, 0.630819, 0.631297, 0.631775, 0.632254,
-        0.632733, 0.633212, 0.633692, 0.634171, 0.634651, 0.635131, 0.635612, 0.636092, 0.636573, 0.637054, 0.637535, 0.638016, 0.638498, 0.638980, 0.639462, 0.639944, 0.640427,
-        0.640910, 0.641393, 0.641876, 0.642359, 0.642843, 0.643327, 0.643811, 0.644295, 0.644780, 0.645264, 0.645749, 0.646235, 0.646720, 0.647206, 0.647692, 0.648178, 0.648664,
-        0.649151, 0.649637, 0.650124, 0.650612, 0.651099, 0.651587, 0.652075, 0.652563, 0.653051, 0.653540, 0.654029, 0.654518, 0.655007, 0.655496, 0.655986, 0.656476, 0.656966,
-        0.657457, 0.657947, 0.658438, 0.658929, 0.659420, 0.659912, 0.660404, 0.660896, 0.661388, 0.661880, 0.662373, 0.662866, 0.663359, 0.663852, 0.664346, 0.664839, 0.665333,
-        0.665828, 0.666322, 0.666817, 0.667312, 0.667807, 0.668302, 0.668798, 0.669293, 0.669790, 0.670286, 0.670782, 0.671279, 0.671776, 0.672273, 0.672770, 0.673268, 0.673766,
-        0.674264, 0.674762, 0.675261, 0.675759, 0.676258, 0.676758, 0.677257, 0.677757, 0.678257, 0.678757, 0.679257, 0.679758, 0.680258, 0.680759, 0.681261, 0.681762, 0.682264,
-        0.682766, 0.683268, 0.683770, 0.684273, 0.684776, 0.685279, 0.685782, 0.686286, 0.686789, 0.687293, 0.687797, 0.688302, 0.688806, 0.689311, 0.689816, 0.690322, 0.690827,
-        0.691333, 0.691839, 0.692345, 0.692852, 0.693359, 0.693866, 0.694373, 0.694880, 0.695388, 0.695895, 0.696404, 0.696912, 0.697420, 0.697929, 0.698438, 0.698947, 0.699457,
-        0.699966, 0.700476, 0.700986, 0.701497, 0.702007, 0.702518, 0.703029, 0.703540, 0.704052, 0.704564, 0.705076, 0.705588, 0.706100, 0.706613, 0.707126, 0.707639, 0.708152,
-        0.708666, 0.709180, 0.709694, 0.710208, 0.710722, 0.711237, 0.711752, 0.712267, 0.712782, 0.713298, 0.713814, 0.714330, 0.714846, 0.715363, 0.715880, 0.716397, 0.716914,
-        0.717431, 0.717949, 0.718467, 0.718985, 0.719503, 0.720022, 0.720541, 0.721060, 0.721579, 0.722099, 0.722618, 0.723138, 0.723659, 0.724179, 0.724700, 0.725221, 0.725742,
-        0.726263, 0.726785, 0.727307, 0.727829, 0.728351, 0.728873, 0.729396, 0.729919, 0.730442, 0.730966, 0.731489, 0.732013, 0.732538, 0.733062, 0.733586, 0.734111, 0.734636,
-        0.735162, 0.735687, 0.736213, 0.736739, 0.737265, 0.737792, 0.738318, 0.738845, 0.739372, 0.739900, 0.740427, 0.740955, 0.741483, 0.742011, 0.742540, 0.743069, 0.743598,
-        0.744127, 0.744656, 0.745186, 0.745716, 0.746246, 0.746777, 0.747307, 0.747838, 0.748369, 0.748900, 0.749432, 0.749964, 0.750496, 0.751028, 0.751560, 0.752093, 0.752626,
-        0.753159, 0.753693, 0.754226, 0.754760, 0.755294, 0.755829, 0.756363, 0.756898, 0.757433, 0.757968, 0.758504, 0.759039, 0.759575, 0.760112, 0.760648, 0.761185, 0.761722,
-        0.762259, 0.762796, 0.763334, 0.763871, 0.764409, 0.764948, 0.765486, 0.766025, 0.766564, 0.767103, 0.767643, 0.768182, 0.768722, 0.769262, 0.769803, 0.770343, 0.770884,
-        0.771425, 0.771967, 0.772508, 0.773050, 0.773592, 0.774134, 0.774677, 0.775220, 0.775763, 0.776306, 0.776849, 0.777393, 0.777937, 0.778481, 0.779025, 0.779570, 0.780115,
-        0.780660, 0.781205, 0.781750, 0.782296, 0.782842, 0.783389, 0.783935, 0.784482, 0.785029, 0.785576, 0.786123, 0.786671, 0.787219, 0.787767, 0.788315, 0.788864, 0.789413,
-        0.789962, 0.790511, 0.791060, 0.791610, 0.792160, 0.792710, 0.793261, 0.793812, 0.794363, 0.794914, 0.795465, 0.796017, 0.796569, 0.797121, 0.797673, 0.798226, 0.798778,
-        0.799332, 0.799885, 0.800438, 0.800992, 0.801546, 0.802100, 0.802655, 0.803210, 0.803764, 0.804320, 0.804875, 0.805431, 0.805987, 0.806543, 0.807099, 0.807656, 0.808212,
-        0.808770, 0.809327, 0.809884, 0.810442, 0.811000, 0.811558, 0.812117, 0.812676, 0.813235, 0.813794, 0.814353, 0.814913, 0.815473, 0.816033, 0.816593, 0.817154, 0.817715,
-        0.818276, 0.818837, 0.819399, 0.819960, 0.820522, 0.821085, 0.821647, 0.822210, 0.822773, 0.823336, 0.823900, 0.824463, 0.825027, 0.825591, 0.826156, 0.826720, 0.827285,
-        0.827850, 0.828416, 0.828981, 0.829547, 0.830113, 0.830680, 0.831246, 0.831813, 0.832380, 0.832947, 0.833515, 0.834082, 0.834650, 0.835219, 0.835787, 0.836356, 0.836925,
-        0.837494, 0.838063, 0.838633, 0.839203, 0.839773, 0.840343, 0.840914, 0.841485, 0.842056, 0.842627, 0.843198, 0.843770, 0.844342, 0.844915, 0.845487, 0.846060, 0.846633,
-        0.847206, 0.847779, 0.848353, 0.848927, 0.849501, 0.850076, 0.850650, 0.851225, 0.851800, 0.852376, 0.852951, 0.853527, 0.854103, 0.854679, 0.855256, 0.855833, 0.856410,
-        0.856987, 0.857565, 0.858142, 0.858720, 0.859299, 0.859877, 0.860456, 0.861035, 0.861614, 0.862193, 0.862773, 0.863353, 0.863933, 0.864513, 0.865094, 0.865675, 0.866256,
-        0.866837, 0.867419, 0.868001, 0.868583, 0.869165, 0.869748, 0.870331, 0.870914, 0.871497, 0.872080, 0.872664, 0.873248, 0.873832, 0.874417, 0.875002, 0.875586, 0.876172,
-        0.876757, 0.877343, 0.877929, 0.878515, 0.879101, 0.879688, 0.880275, 0.880862, 0.881449, 0.882037, 0.882625, 0.883213, 0.883801, 0.884390, 0.884978, 0.885568, 0.886157,
-        0.886746, 0.887336, 0.887926, 0.888516, 0.889107, 0.889698, 0.890289, 0.890880, 0.891471, 0.892063, 0.892655, 0.893247, 0.893840, 0.894432, 0.895025, 0.895618, 0.896212,
-        0.896805, 0.897399, 0.897993, 0.898588, 0.899182, 0.899777, 0.900372, 0.900968, 0.901563, 0.902159, 0.902755, 0.903351, 0.903948, 0.904545, 0.905142, 0.905739, 0.906336,
-        0.906934, 0.907532, 0.908130, 0.908729, 0.909328, 0.909927, 0.910526, 0.911125, 0.911725, 0.912325, 0.912925, 0.913526, 0.914126, 0.914727, 0.915328, 0.915930, 0.916531,
-        0.917133, 0.917735, 0.918338, 0.918940, 0.919543, 0.920146, 0.920750, 0.921353, 0.921957, 0.922561, 0.923165, 0.923770, 0.924375, 0.924980, 0.925585, 0.926191, 0.926796,
-        0.927403, 0.928009, 0.928615, 0.929222, 0.929829, 0.930436, 0.931044, 0.931652, 0.932259, 0.932868, 0.933476, 0.934085, 0.934694, 0.935303, 0.935912, 0.936522, 0.937132,
-        0.937742, 0.938353, 0.938963, 0.939574, 0.940185, 0.940797, 0.941408, 0.942020, 0.942632, 0.943245, 0.943857, 0.944470, 0.945083, 0.945697, 0.946310, 0.946924, 0.947538,
-        0.948153, 0.948767, 0.949382, 0.949997, 0.950612, 0.951228, 0.951844, 0.952460, 0.953076, 0.953693, 0.954309, 0.954926, 0.955544, 0.956161, 0.956779, 0.957397, 0.958015,
-        0.958634, 0.959253, 0.959872, 0.960491, 0.961110, 0.961730, 0.962350, 0.962970, 0.963591, 0.964211, 0.964832, 0.965454, 0.966075, 0.966697, 0.967319, 0.967941, 0.968563,
-        0.969186, 0.969809, 0.970432, 0.971056, 0.971679, 0.972303, 0.972927, 0.973552, 0.974176, 0.974801, 0.975426, 0.976052, 0.976677, 0.977303, 0.977929, 0.978556, 0.979182,
-        0.979809, 0.980436, 0.981064, 0.981691, 0.982319, 0.982947, 0.983576, 0.984204, 0.984833, 0.985462, 0.986092, 0.986721, 0.987351, 0.987981, 0.988612, 0.989242, 0.989873,
-        0.990504, 0.991135, 0.991767, 0.992399, 0.993031, 0.993663, 0.994296, 0.994929, 0.995562, 0.996195, 0.996828, 0.997462, 0.998096, 0.998731, 0.999365, 1.000000
-    },
-
-    // Bit Depth:       12
-    // Reference White: SRGB_COMPLEX
-    // Gamma:           2.4
-    {
-        0.000000, 0.000019, 0.000038, 0.000057, 0.000076, 0.000095, 0.000113, 0.000132, 0.000151, 0.000170, 0.000189, 0.000208, 0.000227, 0.000246, 0.000265, 0.000284, 0.000302,
-        0.000321, 0.000340, 0.000359, 0.000378, 0.000397, 0.000416, 0.000435, 0.000454, 0.000473, 0.000491, 0.000510, 0.000529, 0.000548, 0.000567, 0.000586, 0.000605, 0.000624,
-        0.000643, 0.000662, 0.000680, 0.000699, 0.000718, 0.000737, 0.000756, 0.000775, 0.000794, 0.000813, 0.000832, 0.000851, 0.000869, 0.000888, 0.000907, 0.000926, 0.000945,
-        0.000964, 0.000983, 0.001002, 0.001021, 0.001040, 0.001058, 0.001077, 0.001096, 0.001115, 0.001134, 0.001153, 0.001172, 0.001191, 0.001210, 0.001229, 0.001247, 0.001266,
-        0.001285, 0.001304, 0.001323, 0.001342, 0.001361, 0.001380, 0.001399, 0.001418, 0.001436, 0.001455, 0.001474, 0.001493, 0.001512, 0.001531, 0.001550, 0.001569, 0.001588,
-        0.001607, 0.001625, 0.001644, 0.001663, 0.001682, 0.001701, 0.001720, 0.001739, 0.001758, 0.001777, 0.001796, 0.001814, 0.001833, 0.001852, 0.001871, 0.001890, 0.001909,
-        0.001928, 0.001947, 0.001966, 0.001985, 0.002004, 0.002022, 0.002041, 0.002060, 0.002079, 0.002098, 0.002117, 0.002136, 0.002155, 0.002174, 0.002193, 0.002211, 0.002230,
-        0.002249, 0.002268, 0.002287, 0.002306, 0.002325, 0.002344, 0.002363, 0.002382, 0.002400, 0.002419, 0.002438, 0.002457, 0.002476, 0.002495, 0.002514, 0.002533, 0.002552,
-        0.002571, 0.002589, 0.002608, 0.002627, 0.002646, 0.002665, 0.002684, 0.002703, 0.002722, 0.002741, 0.002760, 0.002778, 0.002797, 0.002816, 0.002835, 0.002854, 0.002873,
-        0.002892, 0.002911, 0.002930, 0.002949, 0.002967, 0.002986, 0.003005, 0.003024, 0.003043, 0.003062, 0.003081, 0.003100, 0.003119, 0.003138, 0.003157, 0.003176, 0.003196,
-        0.003215, 0.003235, 0.003254, 0.003274, 0.003294, 0.003314, 0.003334, 0.003354, 0.003374, 0.003394, 0.003414, 0.003434, 0.003455, 0.003475, 0.003495, 0.003516, 0.003537,
-        0.003557, 0.003578, 0.003599, 0.003620, 0.003641, 0.003662, 0.003683, 0.003704, 0.003725, 0.003746, 0.003768, 0.003789, 0.003811, 0.003832, 0.003854, 0.003876, 0.003898,
-        0.003919, 0.003941, 0.003963, 0.003986, 0.004008, 0.004030, 0.004052, 0.004075, 0.004097, 0.004120, 0.004142, 0.004165, 0.004188, 0.004210, 0.004233, 0.004256, 0.004279,
-        0.004302, 0.004326, 0.004349, 0.004372, 0.004396, 0.004419, 0.004443, 0.004466, 0.004490, 0.004514, 0.004537, 0.004561, 0.004585, 0.004609, 0.004634, 0.004658, 0.004682,
-        0.004706, 0.004731, 0.004755, 0.004780, 0.004804, 0.004829, 0.004854, 0.004879, 0.004904, 0.004929, 0.004954, 0.004979, 0.005004, 0.005030, 0.005055, 0.005080, 0.005106,
-        0.005132, 0.005157, 0.005183, 0.005209, 0.005235, 0.005261, 0.005287, 0.005313, 0.005339, 0.005365, 0.005392, 0.005418, 0.005445, 0.005471, 0.005498, 0.005525, 0.005552,
-        0.005578, 0.005605, 0.005632, 0.005660, 0.005687, 0.005714, 0.005741, 0.005769, 0.005796, 0.005824, 0.005851, 0.005879, 0.005907, 0.005935, 0.005963, 0.005991, 0.006019,
-        0.006047, 0.006075, 0.006104, 0.006132, 0.006161, 0.006189, 0.006218, 0.006247, 0.006275, 0.006304, 0.006333, 0.006362, 0.006391, 0.006421, 0.006450, 0.006479, 0.006509,
-        0.006538, 0.006568, 0.006597, 0.006627, 0.006657, 0.006687, 0.006717, 0.006747, 0.006777, 0.006807, 0.006837, 0.006868, 0.006898, 0.006929, 0.006959, 0.006990, 0.007021,
-        0.007052, 0.007082, 0.007113, 0.007145, 0.007176, 0.007207, 0.007238, 0.007270, 0.007301, 0.007333, 0.007364, 0.007396, 0.007428, 0.007460, 0.007492, 0.007524, 0.007556,
-        0.007588, 0.007620, 0.007652, 0.007685, 0.007717, 0.007750, 0.007783, 0.007815, 0.007848, 0.007881, 0.007914, 0.007947, 0.007980, 0.008013, 0.008047, 0.008080, 0.008114,
-        0.008147, 0.008181, 0.008214, 0.008248, 0.008282, 0.008316, 0.008350, 0.008384, 0.008418, 0.008453, 0.008487, 0.008521, 0.008556, 0.008591, 0.008625, 0.008660, 0.008695,
-        0.008730, 0.008765, 0.008800, 0.008835, 0.008870, 0.008906, 0.008941, 0.008976, 0.009012, 0.009048, 0.009083, 0.009119, 0.009155, 0.009191, 0.009227, 0.009263, 0.009300,
-        0.009336, 0.009372, 0.009409, 0.009445, 0.009482, 0.009519, 0.009556, 0.009593, 0.009629, 0.009667, 0.009704, 0.009741, 0.009778, 0.009816, 0.009853, 0.009891, 0.009928,
-        0.009966, 0.010004, 0.010042, 0.010080, 0.010118, 0.010156, 0.010194, 0.010233, 0.010271, 0.010309, 0.010348, 0.010387, 0.010425, 0.010464, 0.010503, 0.010542, 0.010581,
-        0.010620, 0.010660, 0.010699, 0.010738, 0.010778, 0.010817, 0.010857, 0.010897, 0.010937, 0.010977, 0.011017, 0.011057, 0.011097, 0.011137, 0.011177, 0.011218, 0.011258,
-        0.011299, 0.011340, 0.011380, 0.011421, 0.011462, 0.011503, 0.011544, 0.011586, 0.011627, 0.011668, 0.011710, 0.011751, 0.011793, 0.011835, 0.011876, 0.011918, 0.011960,
-        0.012002, 0.012044, 0.012087, 0.012129, 0.012171, 0.012214, 0.012256, 0.012299, 0.012342, 0.012385, 0.012428, 0.012471, 0.012514, 0.012557, 0.012600, 0.012643, 0.012687,
-        0.012730, 0.012774, 0.012818, 0.012862, 0.012905, 0.012949, 0.012993, 0.013038, 0.013082, 0.013126, 0.013170, 0.013215, 0.013260, 0.013304, 0.013349, 0.013394, 0.013439,
-        0.013484, 0.013529, 0.013574, 0.013619, 0.013665, 0.013710, 0.013756, 0.013801, 0.013847, 0.013893, 0.013939, 0.013985, 0.014031, 0.014077, 0.014123, 0.014169, 0.014216,
-        0.014262, 0.014309, 0.014356, 0.014402, 0.014449, 0.014496, 0.014543, 0.014590, 0.014638, 0.014685, 0.014732, 0.014780, 0.014828, 0.014875, 0.014923, 0.014971, 0.015019,
-        0.015067, 0.015115, 0.015163, 0.015211, 0.015260, 0.015308, 0.015357, 0.015405, 0.015454, 0.015503, 0.015552, 0.015601, 0.015650, 0.015699, 0.015749, 0.015798, 0.015847,
-        0.015897, 0.015947, 0.015996, 0.016046, 0.016096, 0.016146, 0.016196, 0.016246, 0.016297, 0.016347, 0.016397, 0.016448, 0.016499, 0.016549, 0.016600, 0.016651, 0.016702,
-        0.016753, 0.016804, 0.016856, 0.016907, 0.016958, 0.017010, 0.017062, 0.017113, 0.017165, 0.017217, 0.017269, 0.017321, 0.017373, 0.017426, 0.017478, 0.017531, 0.017583,
-        0.017636, 0.017688, 0.017741, 0.017794, 0.017847, 0.017900, 0.017954, 0.018007, 0.018060, 0.018114, 0.018167, 0.018221, 0.018275, 0.018329, 0.018383, 0.018437, 0.018491,
-        0.018545, 0.018599, 0.018654, 0.018708, 0.018763, 0.018817, 0.018872, 0.018927, 0.018982, 0.019037, 0.019092, 0.019147, 0.019203, 0.019258, 0.019314, 0.019369, 0.019425,
-        0.019481, 0.019537, 0.019593, 0.019649, 0.019705, 0.019761, 0.019818, 0.019874, 0.019931, 0.019987, 0.020044, 0.020101, 0.020158, 0.020215, 0.020272, 0.020329, 0.020386,
-        0.020444, 0.020501, 0.020559, 0.020616, 0.020674, 0.020732, 0.020790, 0.020848, 0.020906, 0.020964, 0.021023, 0.021081, 0.021140, 0.021198, 0.021257, 0.021316, 0.021375,
-        0.021434, 0.021493, 0.021552, 0.021611, 0.021671, 0.021730, 0.021790, 0.021849, 0.021909, 0.021969, 0.022029, 0.022089, 0.022149, 0.022209, 0.022270, 0.022330, 0.022391,
-        0.022451, 0.022512, 0.022573, 0.022634, 0.022695, 0.022756, 0.022817, 0.022878, 0.022940, 0.023001, 0.023063, 0.023124, 0.023186, 0.023248, 0.023310, 0.023372, 0.023434,
-        0.023496, 0.023559, 0.023621, 0.023684, 0.023746, 0.023809, 0.023872, 0.023935, 0.023998, 0.024061, 0.024124, 0.024187, 0.024251, 0.024314, 0.024378, 0.024442, 0.024505,
-        0.024569, 0.024633, 0.024697, 0.024762, 0.024826, 0.024890, 0.024955, 0.025019, 0.025084, 0.025149, 0.025214, 0.025279, 0.025344, 0.025409, 0.025474, 0.025539, 0.025605,
-        0.025670, 0.025736, 0.025802, 0.025868, 0.025934, 0.026000, 0.026066, 0.026132, 0.026198, 0.026265, 0.026331, 0.026398, 0.026465, 0.026531, 0.026598, 0.026665, 0.026732,
-        0.026800, 0.026867, 0.026934, 0.027002, 0.027069, 0.027137, 0.027205, 0.027273, 0.027341, 0.027409, 0.027477, 0.027546, 0.027614, 0.027682, 0.027751, 0.027820, 0.027888,
-        0.027957, 0.028026, 0.028095, 0.028165, 0.028234, 0.028303, 0.028373, 0.028442, 0.028512, 0.028582, 0.028652, 0.028722, 0.028792, 0.028862, 0.028932, 0.029003, 0.029073,
-        0.029144, 0.029214, 0.029285, 0.029356, 0.029427, 0.029498, 0.029569, 0.029641, 0.029712, 0.029784, 0.029855, 0.029927, 0.029999, 0.030071, 0.030142, 0.030215, 0.030287,
-        0.030359, 0.030431, 0.030504, 0.030577, 0.030649, 0.030722, 0.030795, 0.030868, 0.030941, 0.031014, 0.031087, 0.031161, 0.031234, 0.031308, 0.031382, 0.031455, 0.031529,
-        0.031603, 0.031677, 0.031752, 0.031826, 0.031900, 0.031975, 0.032050, 0.032124, 0.032199, 0.032274, 0.032349, 0.032424, 0.032499, 0.032575, 0.032650, 0.032726, 0.032801,
-        0.032877, 0.032953, 0.033029, 0.033105, 0.033181, 0.033257, 0.033333, 0.033410, 0.033486, 0.033563, 0.033640, 0.033717, 0.033794, 0.033871, 0.033948, 0.034025, 0.034103,
-        0.034180, 0.034258, 0.034335, 0.034413, 0.034491, 0.034569, 0.034647, 0.034725, 0.034803, 0.034882, 0.034960, 0.035039, 0.035118, 0.035196, 0.035275, 0.035354, 0.035433,
-        0.035513, 0.035592, 0.035671, 0.035751, 0.035831, 0.035910, 0.035990, 0.036070, 0.036150, 0.036230, 0.036310, 0.036391, 0.036471, 0.036552, 0.036633, 0.036713, 0.036794,
-        0.036875, 0.036956, 0.037037, 0.037119, 0.037200, 0.037282, 0.037363, 0.037445, 0.037527, 0.037609, 0.037691, 0.037773, 0.037855, 0.037937, 0.038020, 0.038102, 0.038185,
-        0.038268, 0.038351, 0.038433, 0.038517, 0.038600, 0.038683, 0.038766, 0.038850, 0.038933, 0.039017, 0.039101, 0.039185, 0.039269, 0.039353, 0.039437, 0.039521, 0.039606,
-        0.039690, 0.039775, 0.039860, 0.039945, 0.040030, 0.040115, 0.040200, 0.040285, 0.040370, 0.040456, 0.040541, 0.040627, 0.040713, 0.040799, 0.040885, 0.040971, 0.041057,
-        0.041143, 0.041230, 0.041316, 0.041403, 0.041490, 0.041577, 0.041664, 0.041751, 0.041838, 0.041925, 0.042012, 0.042100, 0.042188, 0.042275, 0.042363, 0.042451, 0.042539,
-        0.042627, 0.042715, 0.042804, 0.042892, 0.042981, 0.043069, 0.043158, 0.043247, 0.043336, 0.043425, 0.043514, 0.043604, 0.043693, 0.043782, 0.043872, 0.043962, 0.044052,
-        0.044142, 0.044232, 0.044322, 0.044412, 0.044502, 0.044593, 0.044683, 0.044774, 0.044865, 0.044956, 0.045047, 0.045138, 0.045229, 0.045320, 0.045412, 0.045503, 0.045595,
-        0.045687, 0.045779, 0.045871, 0.045963, 0.046055, 0.046147, 0.046240, 0.046332, 0.046425, 0.046518, 0.046610, 0.046703, 0.046796, 0.046890, 0.046983, 0.047076, 0.047170,
-        0.047263, 0.047357, 0.047451, 0.047545, 0.047639, 0.047733, 0.047827, 0.047922, 0.048016, 0.048111, 0.048205, 0.048300, 0.048395, 0.048490, 0.048585, 0.048680, 0.048776,
-        0.048871, 0.048967, 0.049062, 0.049158, 0.049254, 0.049350, 0.049446, 0.049542, 0.049639, 0.049735, 0.049831, 0.049928, 0.050025, 0.050122, 0.050219, 0.050316, 0.050413,
-        0.050510, 0.050608, 0.050705, 0.050803, 0.050901, 0.050998, 0.051096, 0.051194, 0.051293, 0.051391, 0.051489, 0.051588, 0.051686, 0.051785, 0.051884, 0.051983, 0.052082,
-        0.052181, 0.052280, 0.052380, 0.052479, 0.052579, 0.052679, 0.052778, 0.052878, 0.052978, 0.053078, 0.053179, 0.053279, 0.053380, 0.053480, 0.053581, 0.053682, 0.053783,
-        0.053884, 0.053985, 0.054086, 0.054187, 0.054289, 0.054391, 0.054492, 0.054594, 0.054696, 0.054798, 0.054900, 0.055002, 0.055105, 0.055207, 0.055310, 0.055413, 0.055515,
-        0.055618, 0.055721, 0.055824, 0.055928, 0.056031, 0.056135, 0.056238, 0.056342, 0.056446, 0.056550, 0.056654, 0.056758, 0.056862, 0.056966, 0.057071, 0.057176, 0.057280,
-        0.057385, 0.057490, 0.057595, 0.057700, 0.057805, 0.057911, 0.058016, 0.058122, 0.058228, 0.058333, 0.058439, 0.058545, 0.058652, 0.058758, 0.058864, 0.058971, 0.059077,
-        0.059184, 0.059291, 0.059398, 0.059505, 0.059612, 0.059719, 0.059827, 0.059934, 0.060042, 0.060150, 0.060258, 0.060365, 0.060474, 0.060582, 0.060690, 0.060798, 0.060907,
-        0.061016, 0.061124, 0.061233, 0.061342, 0.061451, 0.061561, 0.061670, 0.061779, 0.061889, 0.061998, 0.062108, 0.062218, 0.062328, 0.062438, 0.062548, 0.062659, 0.062769,
-        0.062880, 0.062990, 0.063101, 0.063212, 0.063323, 0.063434, 0.063546, 0.063657, 0.063768, 0.063880, 0.063992, 0.064104, 0.064215, 0.064327, 0.064440, 0.064552, 0.064664,
-        0.064777, 0.064889, 0.065002, 0.065115, 0.065228, 0.065341, 0.065454, 0.065567, 0.065681, 0.065794, 0.065908, 0.066022, 0.066136, 0.066250, 0.066364, 0.066478, 0.066592,
-        0.066707, 0.066821, 0.066936, 0.067051, 0.067166, 0.067281, 0.067396, 0.067511, 0.067626, 0.067742, 0.067857, 0.067973, 0.068089, 0.068205, 0.068321, 0.068437, 0.068553,
-        0.068670, 0.068786, 0.068903, 0.069020, 0.069137, 0.069254, 0.069371, 0.069488, 0.069605, 0.069723, 0.069840, 0.069958, 0.070076, 0.070193, 0.070311, 0.070430, 0.070548,
-        0.070666, 0.070785, 0.070903, 0.071022, 0.071141, 0.071260, 0.071379, 0.071498, 0.071617, 0.071737, 0.071856, 0.071976, 0.072096, 0.072215, 0.072335, 0.072455, 0.072576,
-        0.072696, 0.072816, 0.072937, 0.073058, 0.073179, 0.073299, 0.073420, 0.073542, 0.073663, 0.073784, 0.073906, 0.074027, 0.074149, 0.074271, 0.074393, 0.074515, 0.074637,
-        0.074759, 0.074882, 0.075004, 0.075127, 0.075250, 0.075373, 0.075496, 0.075619, 0.075742, 0.075866, 0.075989, 0.076113, 0.076236, 0.076360, 0.076484, 0.076608, 0.076732,
-        0.076857, 0.076981, 0.077106, 0.077230, 0.077355, 0.077480, 0.077605, 0.077730, 0.077855, 0.077981, 0.078106, 0.078232, 0.078357, 0.078483, 0.078609, 0.078735, 0.078862,
-        0.078988, 0.079114, 0.079241, 0.079367, 0.079494, 0.079621, 0.079748, 0.079875, 0.080002, 0.080130, 0.080257, 0.080385, 0.080513, 0.080640, 0.080768, 0.080897, 0.081025,
-        0.081153, 0.081281, 0.081410, 0.081539, 0.081667, 0.081796, 0.081925, 0.082055, 0.082184, 0.082313, 0.082443, 0.082572, 0.082702, 0.082832, 0.082962, 0.083092, 0.083222,
-        0.083352, 0.083483, 0.083613, 0.083744, 0.083875, 0.084006, 0.084137, 0.084268, 0.084399, 0.084531, 0.084662, 0.084794, 0.084926, 0.085058, 0.085190, 0.085322, 0.085454,
-        0.085586, 0.085719, 0.085851, 0.085984, 0.086117, 0.086250, 0.086383, 0.086516, 0.086649, 0.086783, 0.086916, 0.087050, 0.087184, 0.087318, 0.087452, 0.087586, 0.087720,
-        0.087855, 0.087989, 0.088124, 0.088259, 0.088393, 0.088528, 0.088664, 0.088799, 0.088934, 0.089070, 0.089205, 0.089341, 0.089477, 0.089613, 0.089749, 0.089885, 0.090021,
-        0.090158, 0.090294, 0.090431, 0.090568, 0.090705, 0.090842, 0.090979, 0.091116, 0.091254, 0.091391, 0.091529, 0.091666, 0.091804, 0.091942, 0.092081, 0.092219, 0.092357,
-        0.092496, 0.092634, 0.092773, 0.092912, 0.093051, 0.093190, 0.093329, 0.093468, 0.093608, 0.093747, 0.093887, 0.094027, 0.094167, 0.094307, 0.094447, 0.094588, 0.094728,
-        0.094868, 0.095009, 0.095150, 0.095291, 0.095432, 0.095573, 0.095714, 0.095856, 0.095997, 0.096139, 0.096281, 0.096423, 0.096565, 0.096707, 0.096849, 0.096991, 0.097134,
-        0.097277, 0.097419, 0.097562, 0.097705, 0.097848, 0.097991, 0.098135, 0.098278, 0.098422, 0.098566, 0.098709, 0.098853, 0.098998, 0.099142, 0.099286, 0.099431, 0.099575,
-        0.099720, 0.099865, 0.100010, 0.100155, 0.100300, 0.100445, 0.100591, 0.100736, 0.100882, 0.101028, 0.101174, 0.101320, 0.101466, 0.101612, 0.101759, 0.101905, 0.102052,
-        0.102199, 0.102345, 0.102492, 0.102640, 0.102787, 0.102934, 0.103082, 0.103230, 0.103377, 0.103525, 0.103673, 0.103821, 0.103970, 0.104118, 0.104267, 0.104415, 0.104564,
-        0.104713, 0.104862, 0.105011, 0.105160, 0.105310, 0.105459, 0.105609, 0.105759, 0.105908, 0.106058, 0.106209, 0.106359, 0.106509, 0.106660, 0.106810, 0.106961, 0.107112,
-        0.107263, 0.107414, 0.107565, 0.107717, 0.107868, 0.108020, 0.108171, 0.108323, 0.108475, 0.108627, 0.108780, 0.108932, 0.109084, 0.109237, 0.109390, 0.109543, 0.109696,
-        0.109849, 0.110002, 0.110155, 0.110309, 0.110462, 0.110616, 0.110770, 0.110924, 0.111078, 0.111232, 0.111387, 0.111541, 0.111696, 0.111850, 0.112005, 0.112160, 0.112315,
-        0.112471, 0.112626, 0.112781, 0.112937, 0.113093, 0.113249, 0.113405, 0.113561, 0.113717, 0.113873, 0.114030, 0.114186, 0.114343, 0.114500, 0.114657, 0.114814, 0.114971,
-        0.115129, 0.115286, 0.115444, 0.115601, 0.115759, 0.115917, 0.116075, 0.116234, 0.116392, 0.116551, 0.116709, 0.116868, 0.117027, 0.117186, 0.117345, 0.117504, 0.117663,
-        0.117823, 0.117983, 0.118142, 0.118302, 0.118462, 0.118622, 0.118783, 0.118943, 0.119103, 0.119264, 0.119425, 0.119586, 0.119747, 0.119908, 0.120069, 0.120231, 0.120392,
-        0.120554, 0.120715, 0.120877, 0.121039, 0.121202, 0.121364, 0.121526, 0.121689, 0.121851, 0.122014, 0.122177, 0.122340, 0.122503, 0.122667, 0.122830, 0.122994, 0.123157,
-        0.123321, 0.123485, 0.123649, 0.123813, 0.123977, 0.124142, 0.124306, 0.124471, 0.124636, 0.124801, 0.124966, 0.125131, 0.125297, 0.125462, 0.125628, 0.125793, 0.125959,
-        0.126125, 0.126291, 0.126457, 0.126624, 0.126790, 0.126957, 0.127123, 0.127290, 0.127457, 0.127624, 0.127792, 0.127959, 0.128127, 0.128294, 0.128462, 0.128630, 0.128798,
-        0.128966, 0.129134, 0.129303, 0.129471, 0.129640, 0.129808, 0.129977, 0.130146, 0.130316, 0.130485, 0.130654, 0.130824, 0.130993, 0.131163, 0.131333, 0.131503, 0.131673,
-        0.131844, 0.132014, 0.132185, 0.132355, 0.132526, 0.132697, 0.132868, 0.133040, 0.133211, 0.133382, 0.133554, 0.133726, 0.133898, 0.134069, 0.134242, 0.134414, 0.134586,
-        0.134759, 0.134931, 0.135104, 0.135277, 0.135450, 0.135623, 0.135796, 0.135970, 0.136143, 0.136317, 0.136491, 0.136665, 0.136839, 0.137013, 0.137187, 0.137362, 0.137536,
-        0.137711, 0.137886, 0.138061, 0.138236, 0.138411, 0.138586, 0.138762, 0.138937, 0.139113, 0.139289, 0.139465, 0.139641, 0.139817, 0.139994, 0.140170, 0.140347, 0.140524,
-        0.140701, 0.140878, 0.141055, 0.141232, 0.141409, 0.141587, 0.141765, 0.141942, 0.142120, 0.142298, 0.142477, 0.142655, 0.142833, 0.143012, 0.143191, 0.143370, 0.143549,
-        0.143728, 0.143907, 0.144086, 0.144266, 0.144445, 0.144625, 0.144805, 0.144985, 0.145165, 0.145345, 0.145526, 0.145706, 0.145887, 0.146068, 0.146249, 0.146430, 0.146611,
-        0.146792, 0.146974, 0.147155, 0.147337, 0.147519, 0.147701, 0.147883, 0.148065, 0.148248, 0.148430, 0.148613, 0.148796, 0.148979, 0.149162, 0.149345, 0.149528, 0.149711,
-        0.149895, 0.150079, 0.150262, 0.150446, 0.150630, 0.150815, 0.150999, 0.151184, 0.151368, 0.151553, 0.151738, 0.151923, 0.152108, 0.152293, 0.152478, 0.152664, 0.152850,
-        0.153035, 0.153221, 0.153407, 0.153594, 0.153780, 0.153966, 0.154153, 0.154340, 0.154526, 0.154713, 0.154901, 0.155088, 0.155275, 0.155463, 0.155650, 0.155838, 0.156026,
-        0.156214, 0.156402, 0.156590, 0.156779, 0.156967, 0.157156, 0.157345, 0.157534, 0.157723, 0.157912, 0.158102, 0.158291, 0.158481, 0.158670, 0.158860, 0.159050, 0.159240,
-        0.159431, 0.159621, 0.159812, 0.160002, 0.160193, 0.160384, 0.160575, 0.160766, 0.160958, 0.161149, 0.161341, 0.161532, 0.161724, 0.161916, 0.162109, 0.162301, 0.162493,
-        0.162686, 0.162878, 0.163071, 0.163264, 0.163457, 0.163650, 0.163844, 0.164037, 0.164231, 0.164425, 0.164618, 0.164812, 0.165007, 0.165201, 0.165395, 0.165590, 0.165784,
-        0.165979, 0.166174, 0.166369, 0.166564, 0.166760, 0.166955, 0.167151, 0.167347, 0.167542, 0.167738, 0.167935, 0.168131, 0.168327, 0.168524, 0.168720, 0.168917, 0.169114,
-        0.169311, 0.169508, 0.169706, 0.169903, 0.170101, 0.170299, 0.170496, 0.170694, 0.170893, 0.171091, 0.171289, 0.171488, 0.171687, 0.171885, 0.172084, 0.172283, 0.172483,
-        0.172682, 0.172881, 0.173081, 0.173281, 0.173481, 0.173681, 0.173881, 0.174081, 0.174282, 0.174482, 0.174683, 0.174884, 0.175085, 0.175286, 0.175487, 0.175688, 0.175890,
-        0.176091, 0.176293, 0.176495, 0.176697, 0.176899, 0.177102, 0.177304, 0.177507, 0.177709, 0.177912, 0.178115, 0.178318, 0.178522, 0.178725, 0.178929, 0.179132, 0.179336,
-        0.179540, 0.179744, 0.179948, 0.180153, 0.180357, 0.180562, 0.180766, 0.180971, 0.181176, 0.181381, 0.181587, 0.181792, 0.181998, 0.182203, 0.182409, 0.182615, 0.182821,
-        0.183028, 0.183234, 0.183440, 0.183647, 0.183854, 0.184061, 0.184268, 0.184475, 0.184682, 0.184890, 0.185097, 0.185305, 0.185513, 0.185721, 0.185929, 0.186137, 0.186346,
-        0.186554, 0.186763, 0.186972, 0.187181, 0.187390, 0.187599, 0.187808, 0.188018, 0.188228, 0.188437, 0.188647, 0.188857, 0.189067, 0.189278, 0.189488, 0.189699, 0.189910,
-        0.190120, 0.190331, 0.190543, 0.190754, 0.190965, 0.191177, 0.191388, 0.191600, 0.191812, 0.192024, 0.192237, 0.192449, 0.192661, 0.192874, 0.193087, 0.193300, 0.193513,
-        0.193726, 0.193939, 0.194153, 0.194366, 0.194580, 0.194794, 0.195008, 0.195222, 0.195436, 0.195651, 0.195865, 0.196080, 0.196295, 0.196510, 0.196725, 0.196940, 0.197156,
-        0.197371, 0.197587, 0.197803, 0.198018, 0.198235, 0.198451, 0.198667, 0.198884, 0.199100, 0.199317, 0.199534, 0.199751, 0.199968, 0.200185, 0.200403, 0.200620, 0.200838,
-        0.201056, 0.201274, 0.201492, 0.201710, 0.201929, 0.202147, 0.202366, 0.202585, 0.202804, 0.203023, 0.203242, 0.203461, 0.203681, 0.203901, 0.204120, 0.204340, 0.204560,
-        0.204781, 0.205001, 0.205221, 0.205442, 0.205663, 0.205884, 0.206105, 0.206326, 0.206547, 0.206769, 0.206990, 0.207212, 0.207434, 0.207656, 0.207878, 0.208100, 0.208323,
-        0.208545, 0.208768, 0.208991, 0.209214, 0.209437, 0.209660, 0.209883, 0.210107, 0.210331, 0.210554, 0.210778, 0.211002, 0.211227, 0.211451, 0.211676, 0.211900, 0.212125,
-        0.212350, 0.212575, 0.212800, 0.213025, 0.213251, 0.213477, 0.213702, 0.213928, 0.214154, 0.214380, 0.214607, 0.214833, 0.215060, 0.215286, 0.215513, 0.215740, 0.215967,
-        0.216195, 0.216422, 0.216650, 0.216877, 0.217105, 0.217333, 0.217561, 0.217790, 0.218018, 0.218247, 0.218475, 0.218704, 0.218933, 0.219162, 0.219391, 0.219621, 0.219850,
-        0.220080, 0.220310, 0.220540, 0.220770, 0.221000, 0.221230, 0.221461, 0.221691, 0.221922, 0.222153, 0.222384, 0.222615, 0.222847, 0.223078, 0.223310, 0.223541, 0.223773,
-        0.224005, 0.224238, 0.224470, 0.224702, 0.224935, 0.225168, 0.225401, 0.225634, 0.225867, 0.226100, 0.226334, 0.226567, 0.226801, 0.227035, 0.227269, 0.227503, 0.227737,
-        0.227972, 0.228206, 0.228441, 0.228676, 0.228911, 0.229146, 0.229381, 0.229616, 0.229852, 0.230088, 0.230324, 0.230560, 0.230796, 0.231032, 0.231268, 0.231505, 0.231741,
-        0.231978, 0.232215, 0.232452, 0.232690, 0.232927, 0.233165, 0.233402, 0.233640, 0.233878, 0.234116, 0.234354, 0.234593, 0.234831, 0.235070, 0.235309, 0.235548, 0.235787,
-        0.236026, 0.236265, 0.236505, 0.236744, 0.236984, 0.237224, 0.237464, 0.237704, 0.237945, 0.238185, 0.238426, 0.238667, 0.238908, 0.239149, 0.239390, 0.239631, 0.239873,
-        0.240114, 0.240356, 0.240598, 0.240840, 0.241082, 0.241325, 0.241567, 0.241810, 0.242053, 0.242295, 0.242538, 0.242782, 0.243025, 0.243268, 0.243512, 0.243756, 0.244000,
-        0.244244, 0.244488, 0.244732, 0.244977, 0.245221, 0.245466, 0.245711, 0.245956, 0.246201, 0.246447, 0.246692, 0.246938, 0.247184, 0.247429, 0.247675, 0.247922, 0.248168,
-        0.248414, 0.248661, 0.248908, 0.249155, 0.249402, 0.249649, 0.249896, 0.250144, 0.250391, 0.250639, 0.250887, 0.251135, 0.251383, 0.251632, 0.251880, 0.252129, 0.252377,
-        0.252626, 0.252875, 0.253125, 0.253374, 0.253623, 0.253873, 0.254123, 0.254373, 0.254623, 0.254873, 0.255123, 0.255374, 0.255624, 0.255875, 0.256126, 0.256377, 0.256628,
-        0.256880, 0.257131, 0.257383, 0.257634, 0.257886, 0.258138, 0.258391, 0.258643, 0.258895, 0.259148, 0.259401, 0.259654, 0.259907, 0.260160, 0.260413, 0.260667, 0.260920,
-        0.261174, 0.261428, 0.261682, 0.261936, 0.262191, 0.262445, 0.262700, 0.262955, 0.263210, 0.263465, 0.263720, 0.263975, 0.264231, 0.264486, 0.264742, 0.264998, 0.265254,
-        0.265511, 0.265767, 0.266023, 0.266280, 0.266537, 0.266794, 0.267051, 0.267308, 0.267566, 0.267823, 0.268081, 0.268339, 0.268597, 0.268855, 0.269113, 0.269371, 0.269630,
-        0.269889, 0.270147, 0.270406, 0.270665, 0.270925, 0.271184, 0.271444, 0.271703, 0.271963, 0.272223, 0.272483, 0.272744, 0.273004, 0.273265, 0.273525, 0.273786, 0.274047,
-        0.274308, 0.274570, 0.274831, 0.275093, 0.275354, 0.275616, 0.275878, 0.276140, 0.276403, 0.276665, 0.276928, 0.277191, 0.277454, 0.277717, 0.277980, 0.278243, 0.278507,
-        0.278770, 0.279034, 0.279298, 0.279562, 0.279826, 0.280090, 0.280355, 0.280620, 0.280884, 0.281149, 0.281414, 0.281680, 0.281945, 0.282210, 0.282476, 0.282742, 0.283008,
-        0.283274, 0.283540, 0.283807, 0.284073, 0.284340, 0.284607, 0.284874, 0.285141, 0.285408, 0.285675, 0.285943, 0.286211, 0.286479, 0.286747, 0.287015, 0.287283, 0.287551,
-        0.287820, 0.288089, 0.288358, 0.288627, 0.288896, 0.289165, 0.289435, 0.289704, 0.289974, 0.290244, 0.290514, 0.290784, 0.291054, 0.291325, 0.291595, 0.291866, 0.292137,
-        0.292408, 0.292679, 0.292951, 0.293222, 0.293494, 0.293766, 0.294038, 0.294310, 0.294582, 0.294854, 0.295127, 0.295400, 0.295673, 0.295945, 0.296219, 0.296492, 0.296765,
-        0.297039, 0.297313, 0.297586, 0.297860, 0.298135, 0.298409, 0.298683, 0.298958, 0.299233, 0.299508, 0.299783, 0.300058, 0.300333, 0.300609, 0.300884, 0.301160, 0.301436,
-        0.301712, 0.301988, 0.302265, 0.302541, 0.302818, 0.303095, 0.303372, 0.303649, 0.303926, 0.304203, 0.304481, 0.304759, 0.305036, 0.305314, 0.305592, 0.305871, 0.306149,
-        0.306428, 0.306706, 0.306985, 0.307264, 0.307544, 0.307823, 0.308102, 0.308382, 0.308662, 0.308942, 0.309222, 0.309502, 0.309782, 0.310063, 0.310343, 0.310624, 0.310905,
-        0.311186, 0.311467, 0.311749, 0.312030, 0.312312, 0.312594, 0.312876, 0.313158, 0.313440, 0.313723, 0.314005, 0.314288, 0.314571, 0.314854, 0.315137, 0.315420, 0.315704,
-        0.315988, 0.316271, 0.316555, 0.316839, 0.317123, 0.317408, 0.317692, 0.317977, 0.318262, 0.318547, 0.318832, 0.319117, 0.319403, 0.319688, 0.319974, 0.320260, 0.320546,
-        0.320832, 0.321118, 0.321405, 0.321691, 0.321978, 0.322265, 0.322552, 0.322839, 0.323126, 0.323414, 0.323701, 0.323989, 0.324277, 0.324565, 0.324853, 0.325142, 0.325430,
-        0.325719, 0.326008, 0.326297, 0.326586, 0.326875, 0.327165, 0.327454, 0.327744, 0.328034, 0.328324, 0.328614, 0.328904, 0.329195, 0.329486, 0.329776, 0.330067, 0.330358,
-        0.330649, 0.330941, 0.331232, 0.331524, 0.331816, 0.332108, 0.332400, 0.332692, 0.332985, 0.333277, 0.333570, 0.333863, 0.334156, 0.334449, 0.334742, 0.335036, 0.335329,
-        0.335623, 0.335917, 0.336211, 0.336505, 0.336800, 0.337094, 0.337389, 0.337684, 0.337979, 0.338274, 0.338569, 0.338865, 0.339160, 0.339456, 0.339752, 0.340048, 0.340344,
-        0.340640, 0.340937, 0.341233, 0.341530, 0.341827, 0.342124, 0.342421, 0.342719, 0.343016, 0.343314, 0.343612, 0.343910, 0.344208, 0.344506, 0.344805, 0.345103, 0.345402,
-        0.345701, 0.346000, 0.346299, 0.346598, 0.346898, 0.347197, 0.347497, 0.347797, 0.348097, 0.348398, 0.348698, 0.348999, 0.349299, 0.349600, 0.349901, 0.350202, 0.350503,
-        0.350805, 0.351107, 0.351408, 0.351710, 0.352012, 0.352314, 0.352617, 0.352919, 0.353222, 0.353525, 0.353828, 0.354131, 0.354434, 0.354738, 0.355041, 0.355345, 0.355649,
-        0.355953, 0.356257, 0.356561, 0.356866, 0.357170, 0.357475, 0.357780, 0.358085, 0.358390, 0.358696, 0.359001, 0.359307, 0.359613, 0.359919, 0.360225, 0.360531, 0.360838,
-        0.361144, 0.361451, 0.361758, 0.362065, 0.362372, 0.362680, 0.362987, 0.363295, 0.363603, 0.363911, 0.364219, 0.364527, 0.364836, 0.365144, 0.365453, 0.365762, 0.366071,
-        0.366380, 0.366689, 0.366999, 0.367308, 0.367618, 0.367928, 0.368238, 0.368549, 0.368859, 0.369169, 0.369480, 0.369791, 0.370102, 0.370413, 0.370725, 0.371036, 0.371348,
-        0.371659, 0.371971, 0.372283, 0.372596, 0.372908, 0.373221, 0.373533, 0.373846, 0.374159, 0.374472, 0.374786, 0.375099, 0.375413, 0.375727, 0.376040, 0.376355, 0.376669,
-        0.376983, 0.377298, 0.377612, 0.377927, 0.378242, 0.378557, 0.378873, 0.379188, 0.379504, 0.379819, 0.380135, 0.380451, 0.380768, 0.381084, 0.381401, 0.381717, 0.382034,
-        0.382351, 0.382668, 0.382985, 0.383303, 0.383620, 0.383938, 0.384256, 0.384574, 0.384892, 0.385211, 0.385529, 0.385848, 0.386167, 0.386486, 0.386805, 0.387124, 0.387444,
-        0.387763, 0.388083, 0.388403, 0.388723, 0.389043, 0.389363, 0.389684, 0.390005, 0.390325, 0.390646, 0.390968, 0.391289, 0.391610, 0.391932, 0.392254, 0.392576, 0.392898,
-        0.393220, 0.393542, 0.393865, 0.394187, 0.394510, 0.394833, 0.395156, 0.395480, 0.395803, 0.396127, 0.396450, 0.396774, 0.397098, 0.397423, 0.397747, 0.398071, 0.398396,
-        0.398721, 0.399046, 0.399371, 0.399696, 0.400022, 0.400347, 0.400673, 0.400999, 0.401325, 0.401651, 0.401978, 0.402304, 0.402631, 0.402958, 0.403285, 0.403612, 0.403939,
-        0.404267, 0.404594, 0.404922, 0.405250, 0.405578, 0.405906, 0.406235, 0.406563, 0.406892, 0.407221, 0.407550, 0.407879, 0.408208, 0.408538, 0.408867, 0.409197, 0.409527,
-        0.409857, 0.410188, 0.410518, 0.410848, 0.411179, 0.411510, 0.411841, 0.412172, 0.412504, 0.412835, 0.413167, 0.413499, 0.413831, 0.414163, 0.414495, 0.414827, 0.415160,
-        0.415493, 0.415826, 0.416159, 0.416492, 0.416825, 0.417159, 0.417492, 0.417826, 0.418160, 0.418494, 0.418829, 0.419163, 0.419498, 0.419832, 0.420167, 0.420502, 0.420838,
-        0.421173, 0.421508, 0.421844, 0.422180, 0.422516, 0.422852, 0.423189, 0.423525, 0.423862, 0.424198, 0.424535, 0.424872, 0.425210, 0.425547, 0.425885, 0.426222, 0.426560,
-        0.426898, 0.427236, 0.427575, 0.427913, 0.428252, 0.428591, 0.428930, 0.429269, 0.429608, 0.429948, 0.430287, 0.430627, 0.430967, 0.431307, 0.431647, 0.431988, 0.432328,
-        0.432669, 0.433010, 0.433351, 0.433692, 0.434033, 0.434375, 0.434716, 0.435058, 0.435400, 0.435742, 0.436084, 0.436427, 0.436769, 0.437112, 0.437455, 0.437798, 0.438141,
-        0.438485, 0.438828, 0.439172, 0.439516, 0.439860, 0.440204, 0.440548, 0.440892, 0.441237, 0.441582, 0.441927, 0.442272, 0.442617, 0.442962, 0.443308, 0.443654, 0.444000,
-        0.444346, 0.444692, 0.445038, 0.445385, 0.445731, 0.446078, 0.446425, 0.446772, 0.447120, 0.447467, 0.447815, 0.448162, 0.448510, 0.448858, 0.449207, 0.449555, 0.449903,
-        0.450252, 0.450601, 0.450950, 0.451299, 0.451649, 0.451998, 0.452348, 0.452698, 0.453047, 0.453398, 0.453748, 0.454098, 0.454449, 0.454800, 0.455151, 0.455502, 0.455853,
-        0.456204, 0.456556, 0.456907, 0.457259, 0.457611, 0.457964, 0.458316, 0.458668, 0.459021, 0.459374, 0.459727, 0.460080, 0.460433, 0.460787, 0.461140, 0.461494, 0.461848,
-        0.462202, 0.462556, 0.462911, 0.463265, 0.463620, 0.463975, 0.464330, 0.464685, 0.465040, 0.465396, 0.465751, 0.466107, 0.466463, 0.466819, 0.467176, 0.467532, 0.467889,
-        0.468245, 0.468602, 0.468959, 0.469317, 0.469674, 0.470032, 0.470389, 0.470747, 0.471105, 0.471464, 0.471822, 0.472180, 0.472539, 0.472898, 0.473257, 0.473616, 0.473975,
-        0.474335, 0.474694, 0.475054, 0.475414, 0.475774, 0.476135, 0.476495, 0.476856, 0.477216, 0.477577, 0.477938, 0.478299, 0.478661, 0.479022, 0.479384, 0.479746, 0.480108,
-        0.480470, 0.480832, 0.481195, 0.481558, 0.481920, 0.482283, 0.482646, 0.483010, 0.483373, 0.483737, 0.484101, 0.484464, 0.484829, 0.485193, 0.485557, 0.485922, 0.486286,
-        0.486651, 0.487016, 0.487382, 0.487747, 0.488113, 0.488478, 0.488844, 0.489210, 0.489576, 0.489943, 0.490309, 0.490676, 0.491042, 0.491409, 0.491777, 0.492144, 0.492511,
-        0.492879, 0.493247, 0.493615, 0.493983, 0.494351, 0.494719, 0.495088, 0.495457, 0.495825, 0.496194, 0.496564, 0.496933, 0.497303, 0.497672, 0.498042, 0.498412, 0.498782,
-        0.499153, 0.499523, 0.499894, 0.500264, 0.500635, 0.501007, 0.501378, 0.501749, 0.502121, 0.502493, 0.502865, 0.503237, 0.503609, 0.503981, 0.504354, 0.504727, 0.505100,
-        0.505473, 0.505846, 0.506219, 0.506593, 0.506966, 0.507340, 0.507714, 0.508088, 0.508463, 0.508837, 0.509212, 0.509587, 0.509962, 0.510337, 0.510712, 0.511088, 0.511463,
-        0.511839, 0.512215, 0.512591, 0.512967, 0.513344, 0.513720, 0.514097, 0.514474, 0.514851, 0.515228, 0.515606, 0.515983, 0.516361, 0.516739, 0.517117, 0.517495, 0.517874,
-        0.518252, 0.518631, 0.519010, 0.519389, 0.519768, 0.520147, 0.520527, 0.520906, 0.521286, 0.521666, 0.522046, 0.522426, 0.522807, 0.523188, 0.523568, 0.523949, 0.524330,
-        0.524712, 0.525093, 0.525475, 0.525856, 0.526238, 0.526620, 0.527003, 0.527385, 0.527768, 0.528150, 0.528533, 0.528916, 0.529300, 0.529683, 0.530066, 0.530450, 0.530834,
-        0.531218, 0.531602, 0.531987, 0.532371, 0.532756, 0.533141, 0.533526, 0.533911, 0.534296, 0.534681, 0.535067, 0.535453, 0.535839, 0.536225, 0.536611, 0.536998, 0.537384,
-        0.537771, 0.538158, 0.538545, 0.538932, 0.539320, 0.539708, 0.540095, 0.540483, 0.540871, 0.541259, 0.541648, 0.542036, 0.542425, 0.542814, 0.543203, 0.543592, 0.543982,
-        0.544371, 0.544761, 0.545151, 0.545541, 0.545931, 0.546321, 0.546712, 0.547103, 0.547493, 0.547884, 0.548276, 0.548667, 0.549058, 0.549450, 0.549842, 0.550234, 0.550626,
-        0.551018, 0.551411, 0.551803, 0.552196, 0.552589, 0.552982, 0.553376, 0.553769, 0.554163, 0.554556, 0.554950, 0.555345, 0.555739, 0.556133, 0.556528, 0.556923, 0.557317,
-        0.557713, 0.558108, 0.558503, 0.558899, 0.559295, 0.559690, 0.560086, 0.560483, 0.560879, 0.561276, 0.561672, 0.562069, 0.562466, 0.562864, 0.563261, 0.563658, 0.564056,
-        0.564454, 0.564852, 0.565250, 0.565649, 0.566047, 0.566446, 0.566845, 0.567244, 0.567643, 0.568042, 0.568442, 0.568841, 0.569241, 0.569641, 0.570041, 0.570442, 0.570842,
-        0.571243, 0.571643, 0.572044, 0.572446, 0.572847, 0.573248, 0.573650, 0.574052, 0.574454, 0.574856, 0.575258, 0.575661, 0.576063, 0.576466, 0.576869, 0.577272, 0.577675,
-        0.578079, 0.578482, 0.578886, 0.579290, 0.579694, 0.580098, 0.580503, 0.580907, 0.581312, 0.581717, 0.582122, 0.582527, 0.582933, 0.583338, 0.583744, 0.584150, 0.584556,
-        0.584962, 0.585369, 0.585775, 0.586182, 0.586589, 0.586996, 0.587403, 0.587811, 0.588218, 0.588626, 0.589034, 0.589442, 0.589850, 0.590258, 0.590667, 0.591076, 0.591484,
-        0.591894, 0.592303, 0.592712, 0.593122, 0.593531, 0.593941, 0.594351, 0.594761, 0.595172, 0.595582, 0.595993, 0.596404, 0.596815, 0.597226, 0.597637, 0.598049, 0.598461,
-        0.598872, 0.599284, 0.599697, 0.600109, 0.600521, 0.600934, 0.601347, 0.601760, 0.602173, 0.602586, 0.603000, 0.603414, 0.603827, 0.604241, 0.604655, 0.605070, 0.605484,
-        0.605899, 0.606314, 0.606729, 0.607144, 0.607559, 0.607975, 0.608390, 0.608806, 0.609222, 0.609638, 0.610055, 0.610471, 0.610888, 0.611305, 0.611721, 0.612139, 0.612556,
-        0.612973, 0.613391, 0.613809, 0.614227, 0.614645, 0.615063, 0.615482, 0.615900, 0.616319, 0.616738, 0.617157, 0.617577, 0.617996, 0.618416, 0.618835, 0.619255, 0.619676,
-        0.620096, 0.620516, 0.620937, 0.621358, 0.621779, 0.622200, 0.622621, 0.623043, 0.623464, 0.623886, 0.624308, 0.624730, 0.625152, 0.625575, 0.625997, 0.626420, 0.626843,
-        0.627266, 0.627690, 0.628113, 0.628537, 0.628960, 0.629384, 0.629808, 0.630233, 0.630657, 0.631082, 0.631507, 0.631932, 0.632357, 0.632782, 0.633207, 0.633633, 0.634059,
-        0.634485, 0.634911, 0.635337, 0.635764, 0.636190, 0.636617, 0.637044, 0.637471, 0.637899, 0.638326, 0.638754, 0.639181, 0.639609, 0.640037, 0.640466, 0.640894, 0.641323,
-        0.641752, 0.642181, 0.642610, 0.643039, 0.643469, 0.643898, 0.644328, 0.644758, 0.645188, 0.645618, 0.646049, 0.646479, 0.646910, 0.647341, 0.647772, 0.648204, 0.648635,
-        0.649067, 0.649499, 0.649931, 0.650363, 0.650795, 0.651228, 0.651660, 0.652093, 0.652526, 0.652959, 0.653392, 0.653826, 0.654260, 0.654693, 0.655127, 0.655562, 0.655996,
-        0.656430, 0.656865, 0.657300, 0.657735, 0.658170, 0.658605, 0.659041, 0.659476, 0.659912, 0.660348, 0.660784, 0.661221, 0.661657, 0.662094, 0.662531, 0.662968, 0.663405,
-        0.663842, 0.664280, 0.664718, 0.665155, 0.665593, 0.666032, 0.666470, 0.666909, 0.667347, 0.667786, 0.668225, 0.668664, 0.669104, 0.669543, 0.669983, 0.670423, 0.670863,
-        0.671303, 0.671743, 0.672184, 0.672625, 0.673066, 0.673507, 0.673948, 0.674389, 0.674831, 0.675272, 0.675714, 0.676156, 0.676599, 0.677041, 0.677484, 0.677926, 0.678369,
-        0.678812, 0.679256, 0.679699, 0.680143, 0.680586, 0.681030, 0.681474, 0.681919, 0.682363, 0.682808, 0.683252, 0.683697, 0.684142, 0.684588, 0.685033, 0.685479, 0.685924,
-        0.686370, 0.686817, 0.687263, 0.687709, 0.688156, 0.688603, 0.689050, 0.689497, 0.689944, 0.690392, 0.690839, 0.691287, 0.691735, 0.692183, 0.692631, 0.693080, 0.693529,
-        0.693977, 0.694426, 0.694876, 0.695325, 0.695774, 0.696224, 0.696674, 0.697124, 0.697574, 0.698024, 0.698475, 0.698926, 0.699376, 0.699827, 0.700279, 0.700730, 0.701182,
-        0.701633, 0.702085, 0.702537, 0.702989, 0.703442, 0.703894, 0.704347, 0.704800, 0.705253, 0.705706, 0.706160, 0.706613, 0.707067, 0.707521, 0.707975, 0.708429, 0.708884,
-        0.709338, 0.709793, 0.710248, 0.710703, 0.711158, 0.711614, 0.712069, 0.712525, 0.712981, 0.713437, 0.713894, 0.714350, 0.714807, 0.715263, 0.715720, 0.716178, 0.716635,
-        0.717092, 0.717550, 0.718008, 0.718466, 0.718924, 0.719382, 0.719841, 0.720299, 0.720758, 0.721217, 0.721677, 0.722136, 0.722595, 0.723055, 0.723515, 0.723975, 0.724435,
-        0.724896, 0.725356, 0.725817, 0.726278, 0.726739, 0.727200, 0.727662, 0.728123, 0.728585, 0.729047, 0.729509, 0.729971, 0.730434, 0.730896, 0.731359, 0.731822, 0.732285,
-        0.732748, 0.733212, 0.733675, 0.734139, 0.734603, 0.735067, 0.735532, 0.735996, 0.736461, 0.736926, 0.737391, 0.737856, 0.738321, 0.738787, 0.739252, 0.739718, 0.740184,
-        0.740650, 0.741117, 0.741583, 0.742050, 0.742517, 0.742984, 0.743451, 0.743918, 0.744386, 0.744854, 0.745322, 0.745790, 0.746258, 0.746726, 0.747195, 0.747664, 0.748133,
-        0.748602, 0.749071, 0.749540, 0.750010, 0.750480, 0.750950, 0.751420, 0.751890, 0.752361, 0.752831, 0.753302, 0.753773, 0.754244, 0.754716, 0.755187, 0.755659, 0.756131,
-        0.756603, 0.757075, 0.757547, 0.758020, 0.758493, 0.758966, 0.759439, 0.759912, 0.760385, 0.760859, 0.761333, 0.761806, 0.762281, 0.762755, 0.763229, 0.763704, 0.764179,
-        0.764654, 0.765129, 0.765604, 0.766079, 0.766555, 0.767031, 0.767507, 0.767983, 0.768459, 0.768936, 0.769413, 0.769889, 0.770366, 0.770844, 0.771321, 0.771798, 0.772276,
-        0.772754, 0.773232, 0.773710, 0.774189, 0.774667, 0.775146, 0.775625, 0.776104, 0.776583, 0.777063, 0.777542, 0.778022, 0.778502, 0.778982, 0.779462, 0.779943, 0.780424,
-        0.780904, 0.781385, 0.781867, 0.782348, 0.782829, 0.783311, 0.783793, 0.784275, 0.784757, 0.785239, 0.785722, 0.786205, 0.786688, 0.787171, 0.787654, 0.788137, 0.788621,
-        0.789105, 0.789589, 0.790073, 0.790557, 0.791041, 0.791526, 0.792011, 0.792496, 0.792981, 0.793466, 0.793952, 0.794437, 0.794923, 0.795409, 0.795895, 0.796382, 0.796868,
-        0.797355, 0.797842, 0.798329, 0.798816, 0.799303, 0.799791, 0.800279, 0.800767, 0.801255, 0.801743, 0.802231, 0.802720, 0.803209, 0.803698, 0.804187, 0.804676, 0.805166,
-        0.805655, 0.806145, 0.806635, 0.807125, 0.807616, 0.808106, 0.808597, 0.809088, 0.809579, 0.810070, 0.810561, 0.811053, 0.811545, 0.812036, 0.812529, 0.813021, 0.813513,
-        0.814006, 0.814499, 0.814992, 0.815485, 0.815978, 0.816471, 0.816965, 0.817459, 0.817953, 0.818447, 0.818941, 0.819436, 0.819931, 0.820425, 0.820921, 0.821416, 0.821911,
-        0.822407, 0.822902, 0.823398, 0.823894, 0.824391, 0.824887, 0.825384, 0.825880, 0.826377, 0.826875, 0.827372, 0.827869, 0.828367, 0.828865, 0.829363, 0.829861, 0.830359,
-        0.830858, 0.831357, 0.831855, 0.832354, 0.832854, 0.833353, 0.833853, 0.834352, 0.834852, 0.835352, 0.835853, 0.836353, 0.836854, 0.837355, 0.837856, 0.838357, 0.838858,
-        0.839359, 0.839861, 0.840363, 0.840865, 0.841367, 0.841870, 0.842372, 0.842875, 0.843378, 0.843881, 0.844384, 0.844887, 0.845391, 0.845895, 0.846399, 0.846903, 0.847407,
-        0.847912, 0.848416, 0.848921, 0.849426, 0.849931, 0.850437, 0.850942, 0.851448, 0.851954, 0.852460, 0.852966, 0.853472, 0.853979, 0.854486, 0.854993, 0.855500, 0.856007,
-        0.856514, 0.857022, 0.857530, 0.858038, 0.858546, 0.859054, 0.859563, 0.860071, 0.860580, 0.861089, 0.861599, 0.862108, 0.862617, 0.863127, 0.863637, 0.864147, 0.864657,
-        0.865168, 0.865679, 0.866189, 0.866700, 0.867211, 0.867723, 0.868234, 0.868746, 0.869258, 0.869770, 0.870282, 0.870794, 0.871307, 0.871820, 0.872332, 0.872845, 0.873359,
-        0.873872, 0.874386, 0.874900, 0.875413, 0.875928, 0.876442, 0.876956, 0.877471, 0.877986, 0.878501, 0.879016, 0.879531, 0.880047, 0.880563, 0.881079, 0.881595, 0.882111,
-        0.882627, 0.883144, 0.883661, 0.884178, 0.884695, 0.885212, 0.885730, 0.886247, 0.886765, 0.887283, 0.887801, 0.888320, 0.888838, 0.889357, 0.889876, 0.890395, 0.890914,
-        0.891433, 0.891953, 0.892473, 0.892993, 0.893513, 0.894033, 0.894554, 0.895074, 0.895595, 0.896116, 0.896637, 0.897159, 0.897680, 0.898202, 0.898724, 0.899246, 0.899768,
-        0.900291, 0.900813, 0.901336, 0.901859, 0.902382, 0.902905, 0.903429, 0.903952, 0.904476, 0.905000, 0.905524, 0.906049, 0.906573, 0.907098, 0.907623, 0.908148, 0.908673,
-        0.909199, 0.909724, 0.910250, 0.910776, 0.911302, 0.911829, 0.912355, 0.912882, 0.913409, 0.913936, 0.914463, 0.914990, 0.915518, 0.916045, 0.916573, 0.917101, 0.917630,
-        0.918158, 0.918687, 0.919216, 0.919745, 0.920274, 0.920803, 0.921333, 0.921862, 0.922392, 0.922922, 0.923452, 0.923983, 0.924513, 0.925044, 0.925575, 0.926106, 0.926637,
-        0.927169, 0.927701, 0.928232, 0.928764, 0.929297, 0.929829, 0.930361, 0.930894, 0.931427, 0.931960, 0.932493, 0.933027, 0.933560, 0.934094, 0.934628, 0.935162, 0.935697,
-        0.936231, 0.936766, 0.937301, 0.937836, 0.938371, 0.938906, 0.939442, 0.939977, 0.940513, 0.941050, 0.941586, 0.942122, 0.942659, 0.943196, 0.943733, 0.944270, 0.944807,
-        0.945345, 0.945882, 0.946420, 0.946958, 0.947497, 0.948035, 0.948574, 0.949112, 0.949651, 0.950190, 0.950730, 0.951269, 0.951809, 0.952349, 0.952889, 0.953429, 0.953969,
-        0.954510, 0.955051, 0.955591, 0.956133, 0.956674, 0.957215, 0.957757, 0.958299, 0.958841, 0.959383, 0.959925, 0.960468, 0.961010, 0.961553, 0.962096, 0.962640, 0.963183,
-        0.963727, 0.964270, 0.964814, 0.965358, 0.965903, 0.966447, 0.966992, 0.967537, 0.968082, 0.968627, 0.969172, 0.969718, 0.970264, 0.970810, 0.971356, 0.971902, 0.972448,
-        0.972995, 0.973542, 0.974089, 0.974636, 0.975183, 0.975731, 0.976279, 0.976826, 0.977375, 0.977923, 0.978471, 0.979020, 0.979569, 0.980118, 0.980667, 0.981216, 0.981766,
-        0.982315, 0.982865, 0.983415, 0.983965, 0.984516, 0.985066, 0.985617, 0.986168, 0.986719, 0.987270, 0.987822, 0.988374, 0.988925, 0.989477, 0.990030, 0.990582, 0.991135,
-        0.991687, 0.992240, 0.992793, 0.993347, 0.993900, 0.994454, 0.995008, 0.995562, 0.996116, 0.996670, 0.997225, 0.997779, 0.998334, 0.998889, 0.999445, 1.000000
-    },
-
-    // Bit Depth:       12
-    // Reference White: REC709_COMPLEX
-    // Gamma:           2.22222222222
-    {
-        0.000000, 0.000054, 0.000109, 0.000163, 0.000217, 0.000271, 0.000326, 0.000380, 0.000434, 0.000488, 0.000543, 0.000597, 0.000651, 0.000705, 0.000760, 0.000814, 0.000868,
-        0.000923, 0.000977, 0.001031, 0.001085, 0.001140, 0.001194, 0.001248, 0.001302, 0.001357, 0.001411, 0.001465, 0.001519, 0.001574, 0.001628, 0.001682, 0.001737, 0.001791,
-        0.001845, 0.001899, 0.001954, 0.002008, 0.002062, 0.002116, 0.002171, 0.002225, 0.002279, 0.002333, 0.002388, 0.002442, 0.002496, 0.002551, 0.002605, 0.002659, 0.002713,
-        0.002768, 0.002822, 0.002876, 0.002930, 0.002985, 0.003039, 0.003093, 0.003147, 0.003202, 0.003256, 0.003310, 0.003365, 0.003419, 0.003473, 0.003527, 0.003582, 0.003636,
-        0.003690, 0.003744, 0.003799, 0.003853, 0.003907, 0.003961, 0.004016, 0.004070, 0.004124, 0.004179, 0.004233, 0.004287, 0.004341, 0.004396, 0.004450, 0.004504, 0.004558,
-        0.004613, 0.004667, 0.004721, 0.004775, 0.004830, 0.004884, 0.004938, 0.004993, 0.005047, 0.005101, 0.005155, 0.005210, 0.005264, 0.005318, 0.005372, 0.005427, 0.005481,
-        0.005535, 0.005589, 0.005644, 0.005698, 0.005752, 0.005807, 0.005861, 0.005915, 0.005969, 0.006024, 0.006078, 0.006132, 0.006186, 0.006241, 0.006295, 0.006349, 0.006403,
-        0.006458, 0.006512, 0.006566, 0.006621, 0.006675, 0.006729, 0.006783, 0.006838, 0.006892, 0.006946, 0.007000, 0.007055, 0.007109, 0.007163, 0.007217, 0.007272, 0.007326,
-        0.007380, 0.007435, 0.007489, 0.007543, 0.007597, 0.007652, 0.007706, 0.007760, 0.007814, 0.007869, 0.007923, 0.007977, 0.008031, 0.008086, 0.008140, 0.008194, 0.008249,
-        0.008303, 0.008357, 0.008411, 0.008466, 0.008520, 0.008574, 0.008628, 0.008683, 0.008737, 0.008791, 0.008845, 0.008900, 0.008954, 0.009008, 0.009063, 0.009117, 0.009171,
-        0.009225, 0.009280, 0.009334, 0.009388, 0.009442, 0.009497, 0.009551, 0.009605, 0.009659, 0.009714, 0.009768, 0.009822, 0.009877, 0.009931, 0.009985, 0.010039, 0.010094,
-        0.010148, 0.010202, 0.010256, 0.010311, 0.010365, 0.010419, 0.010473, 0.010528, 0.010582, 0.010636, 0.010691, 0.010745, 0.010799, 0.010853, 0.010908, 0.010962, 0.011016,
-        0.011070, 0.011125, 0.011179, 0.011233, 0.011287, 0.011342, 0.011396, 0.011450, 0.011505, 0.011559, 0.011613, 0.011667, 0.011722, 0.011776, 0.011830, 0.011884, 0.011939,
-        0.011993, 0.012047, 0.012101, 0.012156, 0.012210, 0.012264, 0.012319, 0.012373, 0.012427, 0.012481, 0.012536, 0.012590, 0.012644, 0.012698, 0.012753, 0.012807, 0.012861,
-        0.012915, 0.012970, 0.013024, 0.013078, 0.013133, 0.013187, 0.013241, 0.013295, 0.013350, 0.013404, 0.013458, 0.013512, 0.013567, 0.013621, 0.013675, 0.013729, 0.013784,
-        0.013838, 0.013892, 0.013947, 0.014001, 0.014055, 0.014109, 0.014164, 0.014218, 0.014272, 0.014326, 0.014381, 0.014435, 0.014489, 0.014543, 0.014598, 0.014652, 0.014706,
-        0.014761, 0.014815, 0.014869, 0.014923, 0.014978, 0.015032, 0.015086, 0.015140, 0.015195, 0.015249, 0.015303, 0.015357, 0.015412, 0.015466, 0.015520, 0.015575, 0.015629,
-        0.015683, 0.015737, 0.015792, 0.015846, 0.015900, 0.015954, 0.016009, 0.016063, 0.016117, 0.016171, 0.016226, 0.016280, 0.016334, 0.016389, 0.016443, 0.016497, 0.016551,
-        0.016606, 0.016660, 0.016714, 0.016768, 0.016823, 0.016877, 0.016931, 0.016985, 0.017040, 0.017094, 0.017148, 0.017203, 0.017257, 0.017311, 0.017365, 0.017420, 0.017474,
-        0.017528, 0.017582, 0.017637, 0.017691, 0.017745, 0.017799, 0.017854, 0.017908, 0.017962, 0.018017, 0.018016, 0.018070, 0.018124, 0.018179, 0.018233, 0.018288, 0.018343,
-        0.018397, 0.018452, 0.018507, 0.018562, 0.018618, 0.018673, 0.018728, 0.018784, 0.018839, 0.018895, 0.018950, 0.019006, 0.019062, 0.019118, 0.019174, 0.019230, 0.019287,
-        0.019343, 0.019399, 0.019456, 0.019512, 0.019569, 0.019626, 0.019683, 0.019740, 0.019797, 0.019854, 0.019911, 0.019968, 0.020026, 0.020083, 0.020141, 0.020199, 0.020257,
-        0.020314, 0.020372, 0.020430, 0.020489, 0.020547, 0.020605, 0.020664, 0.020722, 0.020781, 0.020839, 0.020898, 0.020957, 0.021016, 0.021075, 0.021134, 0.021193, 0.021253,
-        0.021312, 0.021372, 0.021431, 0.021491, 0.021551, 0.021611, 0.021671, 0.021731, 0.021791, 0.021851, 0.021911, 0.021972, 0.022032, 0.022093, 0.022154, 0.022214, 0.022275,
-        0.022336, 0.022397, 0.022459, 0.022520, 0.022581, 0.022643, 0.022704, 0.022766, 0.022827, 0.022889, 0.022951, 0.023013, 0.023075, 0.023137, 0.023200, 0.023262, 0.023324,
-        0.023387, 0.023450, 0.023512, 0.023575, 0.023638, 0.023701, 0.023764, 0.023827, 0.023891, 0.023954, 0.024017, 0.024081, 0.024145, 0.024208, 0.024272, 0.024336, 0.024400,
-        0.024464, 0.024528, 0.024593, 0.024657, 0.024722, 0.024786, 0.024851, 0.024916, 0.024980, 0.025045, 0.025110, 0.025176, 0.025241, 0.025306, 0.025372, 0.025437, 0.025503,
-        0.025568, 0.025634, 0.025700, 0.025766, 0.025832, 0.025898, 0.025964, 0.026031, 0.026097, 0.026164, 0.026230, 0.026297, 0.026364, 0.026431, 0.026498, 0.026565, 0.026632,
-        0.026699, 0.026767, 0.026834, 0.026902, 0.026969, 0.027037, 0.027105, 0.027173, 0.027241, 0.027309, 0.027377, 0.027445, 0.027514, 0.027582, 0.027651, 0.027719, 0.027788,
-        0.027857, 0.027926, 0.027995, 0.028064, 0.028133, 0.028203, 0.028272, 0.028342, 0.028411, 0.028481, 0.028551, 0.028621, 0.028691, 0.028761, 0.028831, 0.028901, 0.028972,
-        0.029042, 0.029113, 0.029183, 0.029254, 0.029325, 0.029396, 0.029467, 0.029538, 0.029609, 0.029680, 0.029752, 0.029823, 0.029895, 0.029966, 0.030038, 0.030110, 0.030182,
-        0.030254, 0.030326, 0.030399, 0.030471, 0.030543, 0.030616, 0.030688, 0.030761, 0.030834, 0.030907, 0.030980, 0.031053, 0.031126, 0.031199, 0.031273, 0.031346, 0.031420,
-        0.031494, 0.031567, 0.031641, 0.031715, 0.031789, 0.031863, 0.031938, 0.032012, 0.032086, 0.032161, 0.032235, 0.032310, 0.032385, 0.032460, 0.032535, 0.032610, 0.032685,
-        0.032760, 0.032836, 0.032911, 0.032987, 0.033063, 0.033138, 0.033214, 0.033290, 0.033366, 0.033442, 0.033519, 0.033595, 0.033671, 0.033748, 0.033824, 0.033901, 0.033978,
-        0.034055, 0.034132, 0.034209, 0.034286, 0.034363, 0.034441, 0.034518, 0.034596, 0.034674, 0.034751, 0.034829, 0.034907, 0.034985, 0.035063, 0.035142, 0.035220, 0.035298,
-        0.035377, 0.035456, 0.035534, 0.035613, 0.035692, 0.035771, 0.035850, 0.035929, 0.036009, 0.036088, 0.036168, 0.036247, 0.036327, 0.036407, 0.036487, 0.036567, 0.036647,
-        0.036727, 0.036807, 0.036887, 0.036968, 0.037048, 0.037129, 0.037210, 0.037291, 0.037372, 0.037453, 0.037534, 0.037615, 0.037696, 0.037778, 0.037859, 0.037941, 0.038023,
-        0.038104, 0.038186, 0.038268, 0.038350, 0.038433, 0.038515, 0.038597, 0.038680, 0.038762, 0.038845, 0.038928, 0.039011, 0.039094, 0.039177, 0.039260, 0.039343, 0.039427,
-        0.039510, 0.039594, 0.039677, 0.039761, 0.039845, 0.039929, 0.040013, 0.040097, 0.040181, 0.040266, 0.040350, 0.040435, 0.040519, 0.040604, 0.040689, 0.040774, 0.040859,
-        0.040944, 0.041029, 0.041114, 0.041200, 0.041285, 0.041371, 0.041456, 0.041542, 0.041628, 0.041714, 0.041800, 0.041886, 0.041973, 0.042059, 0.042146, 0.042232, 0.042319,
-        0.042406, 0.042492, 0.042579, 0.042666, 0.042754, 0.042841, 0.042928, 0.043016, 0.043103, 0.043191, 0.043279, 0.043366, 0.043454, 0.043542, 0.043631, 0.043719, 0.043807,
-        0.043896, 0.043984, 0.044073, 0.044162, 0.044250, 0.044339, 0.044428, 0.044517, 0.044607, 0.044696, 0.044785, 0.044875, 0.044965, 0.045054, 0.045144, 0.045234, 0.045324,
-        0.045414, 0.045504, 0.045595, 0.045685, 0.045775, 0.045866, 0.045957, 0.046048, 0.046138, 0.046229, 0.046321, 0.046412, 0.046503, 0.046594, 0.046686, 0.046777, 0.046869,
-        0.046961, 0.047053, 0.047145, 0.047237, 0.047329, 0.047421, 0.047514, 0.047606, 0.047699, 0.047791, 0.047884, 0.047977, 0.048070, 0.048163, 0.048256, 0.048350, 0.048443,
-        0.048536, 0.048630, 0.048724, 0.048817, 0.048911, 0.049005, 0.049099, 0.049193, 0.049288, 0.049382, 0.049476, 0.049571, 0.049666, 0.049760, 0.049855, 0.049950, 0.050045,
-        0.050140, 0.050236, 0.050331, 0.050426, 0.050522, 0.050618, 0.050713, 0.050809, 0.050905, 0.051001, 0.051097, 0.051194, 0.051290, 0.051386, 0.051483, 0.051580, 0.051676,
-        0.051773, 0.051870, 0.051967, 0.052064, 0.052162, 0.052259, 0.052356, 0.052454, 0.052552, 0.052649, 0.052747, 0.052845, 0.052943, 0.053041, 0.053139, 0.053238, 0.053336,
-        0.053435, 0.053533, 0.053632, 0.053731, 0.053830, 0.053929, 0.054028, 0.054127, 0.054227, 0.054326, 0.054426, 0.054525, 0.054625, 0.054725, 0.054825, 0.054925, 0.055025,
-        0.055125, 0.055226, 0.055326, 0.055427, 0.055527, 0.055628, 0.055729, 0.055830, 0.055931, 0.056032, 0.056133, 0.056235, 0.056336, 0.056438, 0.056539, 0.056641, 0.056743,
-        0.056845, 0.056947, 0.057049, 0.057151, 0.057254, 0.057356, 0.057459, 0.057561, 0.057664, 0.057767, 0.057870, 0.057973, 0.058076, 0.058179, 0.058283, 0.058386, 0.058490,
-        0.058594, 0.058697, 0.058801, 0.058905, 0.059009, 0.059113, 0.059218, 0.059322, 0.059426, 0.059531, 0.059636, 0.059741, 0.059845, 0.059950, 0.060055, 0.060161, 0.060266,
-        0.060371, 0.060477, 0.060582, 0.060688, 0.060794, 0.060900, 0.061006, 0.061112, 0.061218, 0.061324, 0.061431, 0.061537, 0.061644, 0.061751, 0.061857, 0.061964, 0.062071,
-        0.062178, 0.062286, 0.062393, 0.062500, 0.062608, 0.062715, 0.062823, 0.062931, 0.063039, 0.063147, 0.063255, 0.063363, 0.063472, 0.063580, 0.063689, 0.063797, 0.063906,
-        0.064015, 0.064124, 0.064233, 0.064342, 0.064451, 0.064561, 0.064670, 0.064780, 0.064889, 0.064999, 0.065109, 0.065219, 0.065329, 0.065439, 0.065549, 0.065660, 0.065770,
-        0.065881, 0.065991, 0.066102, 0.066213, 0.066324, 0.066435, 0.066546, 0.066658, 0.066769, 0.066880, 0.066992, 0.067104, 0.067216, 0.067327, 0.067439, 0.067552, 0.067664,
-        0.067776, 0.067889, 0.068001, 0.068114, 0.068226, 0.068339, 0.068452, 0.068565, 0.068678, 0.068792, 0.068905, 0.069018, 0.069132, 0.069245, 0.069359, 0.069473, 0.069587,
-        0.069701, 0.069815, 0.069930, 0.070044, 0.070158, 0.070273, 0.070388, 0.070502, 0.070617, 0.070732, 0.070847, 0.070963, 0.071078, 0.071193, 0.071309, 0.071424, 0.071540,
-        0.071656, 0.071772, 0.071888, 0.072004, 0.072120, 0.072236, 0.072353, 0.072469, 0.072586, 0.072703, 0.072820, 0.072936, 0.073054, 0.073171, 0.073288, 0.073405, 0.073523,
-        0.073640, 0.073758, 0.073876, 0.073994, 0.074112, 0.074230, 0.074348, 0.074466, 0.074584, 0.074703, 0.074822, 0.074940, 0.075059, 0.075178, 0.075297, 0.075416, 0.075535,
-        0.075655, 0.075774, 0.075894, 0.076013, 0.076133, 0.076253, 0.076373, 0.076493, 0.076613, 0.076733, 0.076854, 0.076974, 0.077095, 0.077215, 0.077336, 0.077457, 0.077578,
-        0.077699, 0.077820, 0.077941, 0.078063, 0.078184, 0.078306, 0.078428, 0.078549, 0.078671, 0.078793, 0.078915, 0.079038, 0.079160, 0.079282, 0.079405, 0.079528, 0.079650,
-        0.079773, 0.079896, 0.080019, 0.080142, 0.080266, 0.080389, 0.080512, 0.080636, 0.080760, 0.080884, 0.081007, 0.081131, 0.081256, 0.081380, 0.081504, 0.081628, 0.081753,
-        0.081878, 0.082002, 0.082127, 0.082252, 0.082377, 0.082502, 0.082627, 0.082753, 0.082878, 0.083004, 0.083130, 0.083255, 0.083381, 0.083507, 0.083633, 0.083759, 0.083886,
-        0.084012, 0.084139, 0.084265, 0.084392, 0.084519, 0.084646, 0.084773, 0.084900, 0.085027, 0.085154, 0.085282, 0.085409, 0.085537, 0.085665, 0.085793, 0.085921, 0.086049,
-        0.086177, 0.086305, 0.086434, 0.086562, 0.086691, 0.086819, 0.086948, 0.087077, 0.087206, 0.087335, 0.087465, 0.087594, 0.087723, 0.087853, 0.087983, 0.088112, 0.088242,
-        0.088372, 0.088502, 0.088632, 0.088763, 0.088893, 0.089024, 0.089154, 0.089285, 0.089416, 0.089547, 0.089678, 0.089809, 0.089940, 0.090071, 0.090203, 0.090334, 0.090466,
-        0.090598, 0.090730, 0.090861, 0.090994, 0.091126, 0.091258, 0.091390, 0.091523, 0.091656, 0.091788, 0.091921, 0.092054, 0.092187, 0.092320, 0.092453, 0.092587, 0.092720,
-        0.092854, 0.092987, 0.093121, 0.093255, 0.093389, 0.093523, 0.093657, 0.093792, 0.093926, 0.094060, 0.094195, 0.094330, 0.094465, 0.094599, 0.094735, 0.094870, 0.095005,
-        0.095140, 0.095276, 0.095411, 0.095547, 0.095683, 0.095819, 0.095955, 0.096091, 0.096227, 0.096363, 0.096500, 0.096636, 0.096773, 0.096910, 0.097046, 0.097183, 0.097320,
-        0.097457, 0.097595, 0.097732, 0.097870, 0.098007, 0.098145, 0.098283, 0.098421, 0.098559, 0.098697, 0.098835, 0.098973, 0.099112, 0.099250, 0.099389, 0.099528, 0.099666,
-        0.099805, 0.099944, 0.100084, 0.100223, 0.100362, 0.100502, 0.100641, 0.100781, 0.100921, 0.101061, 0.101201, 0.101341, 0.101481, 0.101622, 0.101762, 0.101903, 0.102043,
-        0.102184, 0.102325, 0.102466, 0.102607, 0.102748, 0.102890, 0.103031, 0.103173, 0.103314, 0.103456, 0.103598, 0.103740, 0.103882, 0.104024, 0.104166, 0.104309, 0.104451,
-        0.104594, 0.104736, 0.104879, 0.105022, 0.105165, 0.105308, 0.105451, 0.105595, 0.105738, 0.105882, 0.106026, 0.106169, 0.106313, 0.106457, 0.106601, 0.106745, 0.106890,
-        0.107034, 0.107179, 0.107323, 0.107468, 0.107613, 0.107758, 0.107903, 0.108048, 0.108193, 0.108339, 0.108484, 0.108630, 0.108776, 0.108921, 0.109067, 0.109213, 0.109359,
-        0.109506, 0.109652, 0.109798, 0.109945, 0.110092, 0.110238, 0.110385, 0.110532, 0.110679, 0.110827, 0.110974, 0.111121, 0.111269, 0.111417, 0.111564, 0.111712, 0.111860,
-        0.112008, 0.112156, 0.112305, 0.112453, 0.112602, 0.112750, 0.112899, 0.113048, 0.113197, 0.113346, 0.113495, 0.113644, 0.113793, 0.113943, 0.114092, 0.114242, 0.114392,
-        0.114542, 0.114692, 0.114842, 0.114992, 0.115143, 0.115293, 0.115444, 0.115594, 0.115745, 0.115896, 0.116047, 0.116198, 0.116349, 0.116500, 0.116652, 0.116803, 0.116955,
-        0.117107, 0.117259, 0.117411, 0.117563, 0.117715, 0.117867, 0.118019, 0.118172, 0.118325, 0.118477, 0.118630, 0.118783, 0.118936, 0.119089, 0.119242, 0.119396, 0.119549,
-        0.119703, 0.119857, 0.120010, 0.120164, 0.120318, 0.120472, 0.120627, 0.120781, 0.120935, 0.121090, 0.121245, 0.121399, 0.121554, 0.121709, 0.121864, 0.122020, 0.122175,
-        0.122330, 0.122486, 0.122642, 0.122797, 0.122953, 0.123109, 0.123265, 0.123421, 0.123578, 0.123734, 0.123891, 0.124047, 0.124204, 0.124361, 0.124518, 0.124675, 0.124832,
-        0.124989, 0.125147, 0.125304, 0.125462, 0.125619, 0.125777, 0.125935, 0.126093, 0.126251, 0.126410, 0.126568, 0.126727, 0.126885, 0.127044, 0.127203, 0.127362, 0.127521,
-        0.127680, 0.127839, 0.127998, 0.128158, 0.128317, 0.128477, 0.128637, 0.128797, 0.128957, 0.129117, 0.129277, 0.129437, 0.129598, 0.129758, 0.129919, 0.130080, 0.130241,
-        0.130402, 0.130563, 0.130724, 0.130885, 0.131047, 0.131208, 0.131370, 0.131532, 0.131693, 0.131855, 0.132018, 0.132180, 0.132342, 0.132504, 0.132667, 0.132830, 0.132992,
-        0.133155, 0.133318, 0.133481, 0.133644, 0.133808, 0.133971, 0.134135, 0.134298, 0.134462, 0.134626, 0.134790, 0.134954, 0.135118, 0.135282, 0.135447, 0.135611, 0.135776,
-        0.135940, 0.136105, 0.136270, 0.136435, 0.136600, 0.136766, 0.136931, 0.137096, 0.137262, 0.137428, 0.137594, 0.137759, 0.137926, 0.138092, 0.138258, 0.138424, 0.138591,
-        0.138757, 0.138924, 0.139091, 0.139258, 0.139425, 0.139592, 0.139759, 0.139927, 0.140094, 0.140262, 0.140429, 0.140597, 0.140765, 0.140933, 0.141101, 0.141269, 0.141438,
-        0.141606, 0.141775, 0.141943, 0.142112, 0.142281, 0.142450, 0.142619, 0.142788, 0.142958, 0.143127, 0.143297, 0.143466, 0.143636, 0.143806, 0.143976, 0.144146, 0.144316,
-        0.144487, 0.144657, 0.144828, 0.144998, 0.145169, 0.145340, 0.145511, 0.145682, 0.145853, 0.146025, 0.146196, 0.146368, 0.146539, 0.146711, 0.146883, 0.147055, 0.147227,
-        0.147399, 0.147572, 0.147744, 0.147917, 0.148089, 0.148262, 0.148435, 0.148608, 0.148781, 0.148954, 0.149128, 0.149301, 0.149475, 0.149648, 0.149822, 0.149996, 0.150170,
-        0.150344, 0.150518, 0.150692, 0.150867, 0.151041, 0.151216, 0.151391, 0.151566, 0.151741, 0.151916, 0.152091, 0.152266, 0.152442, 0.152617, 0.152793, 0.152969, 0.153145,
-        0.153321, 0.153497, 0.153673, 0.153849, 0.154026, 0.154202, 0.154379, 0.154556, 0.154733, 0.154910, 0.155087, 0.155264, 0.155441, 0.155619, 0.155796, 0.155974, 0.156152,
-        0.156329, 0.156507, 0.156686, 0.156864, 0.157042, 0.157220, 0.157399, 0.157578, 0.157756, 0.157935, 0.158114, 0.158293, 0.158473, 0.158652, 0.158831, 0.159011, 0.159191,
-        0.159370, 0.159550, 0.159730, 0.159910, 0.160091, 0.160271, 0.160451, 0.160632, 0.160813, 0.160993, 0.161174, 0.161355, 0.161536, 0.161718, 0.161899, 0.162080, 0.162262,
-        0.162444, 0.162625, 0.162807, 0.162989, 0.163171, 0.163354, 0.163536, 0.163718, 0.163901, 0.164084, 0.164266, 0.164449, 0.164632, 0.164816, 0.164999, 0.165182, 0.165366,
-        0.165549, 0.165733, 0.165917, 0.166101, 0.166285, 0.166469, 0.166653, 0.166837, 0.167022, 0.167206, 0.167391, 0.167576, 0.167761, 0.167946, 0.168131, 0.168316, 0.168502,
-        0.168687, 0.168873, 0.169058, 0.169244, 0.169430, 0.169616, 0.169802, 0.169989, 0.170175, 0.170361, 0.170548, 0.170735, 0.170922, 0.171109, 0.171296, 0.171483, 0.171670,
-        0.171857, 0.172045, 0.172233, 0.172420, 0.172608, 0.172796, 0.172984, 0.173172, 0.173361, 0.173549, 0.173738, 0.173926, 0.174115, 0.174304, 0.174493, 0.174682, 0.174871,
-        0.175060, 0.175250, 0.175439, 0.175629, 0.175819, 0.176009, 0.176199, 0.176389, 0.176579, 0.176769, 0.176960, 0.177150, 0.177341, 0.177532, 0.177722, 0.177913, 0.178105,
-        0.178296, 0.178487, 0.178679, 0.178870, 0.179062, 0.179254, 0.179445, 0.179637, 0.179830, 0.180022, 0.180214, 0.180407, 0.180599, 0.180792, 0.180985, 0.181178, 0.181371,
-        0.181564, 0.181757, 0.181950, 0.182144, 0.182337, 0.182531, 0.182725, 0.182919, 0.183113, 0.183307, 0.183501, 0.183696, 0.183890, 0.184085, 0.184280, 0.184474, 0.184669,
-        0.184864, 0.185060, 0.185255, 0.185450, 0.185646, 0.185841, 0.186037, 0.186233, 0.186429, 0.186625, 0.186821, 0.187018, 0.187214, 0.187411, 0.187607, 0.187804, 0.188001,
-        0.188198, 0.188395, 0.188592, 0.188790, 0.188987, 0.189185, 0.189382, 0.189580, 0.189778, 0.189976, 0.190174, 0.190372, 0.190571, 0.190769, 0.190968, 0.191166, 0.191365,
-        0.191564, 0.191763, 0.191962, 0.192162, 0.192361, 0.192560, 0.192760, 0.192960, 0.193160, 0.193360, 0.193560, 0.193760, 0.193960, 0.194160, 0.194361, 0.194562, 0.194762,
-        0.194963, 0.195164, 0.195365, 0.195566, 0.195768, 0.195969, 0.196171, 0.196372, 0.196574, 0.196776, 0.196978, 0.197180, 0.197382, 0.197585, 0.197787, 0.197990, 0.198192,
-        0.198395, 0.198598, 0.198801, 0.199004, 0.199208, 0.199411, 0.199614, 0.199818, 0.200022, 0.200226, 0.200429, 0.200634, 0.200838, 0.201042, 0.201246, 0.201451, 0.201655,
-        0.201860, 0.202065, 0.202270, 0.202475, 0.202680, 0.202886, 0.203091, 0.203297, 0.203502, 0.203708, 0.203914, 0.204120, 0.204326, 0.204532, 0.204739, 0.204945, 0.205152,
-        0.205358, 0.205565, 0.205772, 0.205979, 0.206186, 0.206393, 0.206601, 0.206808, 0.207016, 0.207223, 0.207431, 0.207639, 0.207847, 0.208055, 0.208264, 0.208472, 0.208681,
-        0.208889, 0.209098, 0.209307, 0.209516, 0.209725, 0.209934, 0.210143, 0.210353, 0.210562, 0.210772, 0.210982, 0.211192, 0.211402, 0.211612, 0.211822, 0.212032, 0.212243,
-        0.212453, 0.212664, 0.212875, 0.213086, 0.213297, 0.213508, 0.213719, 0.213931, 0.214142, 0.214354, 0.214566, 0.214777, 0.214989, 0.215201, 0.215414, 0.215626, 0.215838,
-        0.216051, 0.216264, 0.216476, 0.216689, 0.216902, 0.217115, 0.217328, 0.217542, 0.217755, 0.217969, 0.218183, 0.218396, 0.218610, 0.218824, 0.219038, 0.219253, 0.219467,
-        0.219682, 0.219896, 0.220111, 0.220326, 0.220541, 0.220756, 0.220971, 0.221186, 0.221402, 0.221617, 0.221833, 0.222049, 0.222264, 0.222480, 0.222697, 0.222913, 0.223129,
-        0.223346, 0.223562, 0.223779, 0.223996, 0.224212, 0.224429, 0.224647, 0.224864, 0.225081, 0.225299, 0.225516, 0.225734, 0.225952, 0.226170, 0.226388, 0.226606, 0.226824,
-        0.227043, 0.227261, 0.227480, 0.227699, 0.227918, 0.228137, 0.228356, 0.228575, 0.228794, 0.229014, 0.229233, 0.229453, 0.229673, 0.229893, 0.230113, 0.230333, 0.230553,
-        0.230774, 0.230994, 0.231215, 0.231435, 0.231656, 0.231877, 0.232098, 0.232319, 0.232541, 0.232762, 0.232984, 0.233205, 0.233427, 0.233649, 0.233871, 0.234093, 0.234315,
-        0.234538, 0.234760, 0.234983, 0.235206, 0.235428, 0.235651, 0.235874, 0.236097, 0.236321, 0.236544, 0.236768, 0.236991, 0.237215, 0.237439, 0.237663, 0.237887, 0.238111,
-        0.238335, 0.238560, 0.238784, 0.239009, 0.239234, 0.239459, 0.239684, 0.239909, 0.240134, 0.240360, 0.240585, 0.240811, 0.241036, 0.241262, 0.241488, 0.241714, 0.241941,
-        0.242167, 0.242393, 0.242620, 0.242846, 0.243073, 0.243300, 0.243527, 0.243754, 0.243981, 0.244209, 0.244436, 0.244664, 0.244891, 0.245119, 0.245347, 0.245575, 0.245803,
-        0.246032, 0.246260, 0.246489, 0.246717, 0.246946, 0.247175, 0.247404, 0.247633, 0.247862, 0.248092, 0.248321, 0.248551, 0.248780, 0.249010, 0.249240, 0.249470, 0.249700,
-        0.249930, 0.250161, 0.250391, 0.250622, 0.250853, 0.251083, 0.251314, 0.251545, 0.251777, 0.252008, 0.252239, 0.252471, 0.252703, 0.252934, 0.253166, 0.253398, 0.253630,
-        0.253863, 0.254095, 0.254328, 0.254560, 0.254793, 0.255026, 0.255259, 0.255492, 0.255725, 0.255958, 0.256192, 0.256425, 0.256659, 0.256893, 0.257127, 0.257361, 0.257595,
-        0.257829, 0.258063, 0.258298, 0.258532, 0.258767, 0.259002, 0.259237, 0.259472, 0.259707, 0.259942, 0.260178, 0.260413, 0.260649, 0.260885, 0.261121, 0.261357, 0.261593,
-        0.261829, 0.262065, 0.262302, 0.262538, 0.262775, 0.263012, 0.263249, 0.263486, 0.263723, 0.263960, 0.264198, 0.264435, 0.264673, 0.264911, 0.265148, 0.265386, 0.265625,
-        0.265863, 0.266101, 0.266340, 0.266578, 0.266817, 0.267056, 0.267295, 0.267534, 0.267773, 0.268012, 0.268251, 0.268491, 0.268731, 0.268970, 0.269210, 0.269450, 0.269690,
-        0.269931, 0.270171, 0.270411, 0.270652, 0.270893, 0.271133, 0.271374, 0.271615, 0.271857, 0.272098, 0.272339, 0.272581, 0.272822, 0.273064, 0.273306, 0.273548, 0.273790,
-        0.274032, 0.274275, 0.274517, 0.274760, 0.275003, 0.275245, 0.275488, 0.275731, 0.275974, 0.276218, 0.276461, 0.276705, 0.276948, 0.277192, 0.277436, 0.277680, 0.277924,
-        0.278168, 0.278413, 0.278657, 0.278902, 0.279146, 0.279391, 0.279636, 0.279881, 0.280126, 0.280372, 0.280617, 0.280863, 0.281108, 0.281354, 0.281600, 0.281846, 0.282092,
-        0.282338, 0.282585, 0.282831, 0.283078, 0.283324, 0.283571, 0.283818, 0.284065, 0.284312, 0.284560, 0.284807, 0.285055, 0.285302, 0.285550, 0.285798, 0.286046, 0.286294,
-        0.286542, 0.286791, 0.287039, 0.287288, 0.287537, 0.287785, 0.288034, 0.288283, 0.288533, 0.288782, 0.289031, 0.289281, 0.289531, 0.289780, 0.290030, 0.290280, 0.290530,
-        0.290781, 0.291031, 0.291282, 0.291532, 0.291783, 0.292034, 0.292285, 0.292536, 0.292787, 0.293038, 0.293290, 0.293541, 0.293793, 0.294045, 0.294297, 0.294549, 0.294801,
-        0.295053, 0.295306, 0.295558, 0.295811, 0.296064, 0.296317, 0.296570, 0.296823, 0.297076, 0.297329, 0.297583, 0.297836, 0.298090, 0.298344, 0.298598, 0.298852, 0.299106,
-        0.299360, 0.299615, 0.299869, 0.300124, 0.300379, 0.300634, 0.300889, 0.301144, 0.301399, 0.301654, 0.301910, 0.302165, 0.302421, 0.302677, 0.302933, 0.303189, 0.303445,
-        0.303701, 0.303958, 0.304214, 0.304471, 0.304728, 0.304985, 0.305242, 0.305499, 0.305756, 0.306014, 0.306271, 0.306529, 0.306787, 0.307044, 0.307302, 0.307561, 0.307819,
-        0.308077, 0.308336, 0.308594, 0.308853, 0.309112, 0.309371, 0.309630, 0.309889, 0.310148, 0.310408, 0.310667, 0.310927, 0.311187, 0.311446, 0.311706, 0.311967, 0.312227,
-        0.312487, 0.312748, 0.313008, 0.313269, 0.313530, 0.313791, 0.314052, 0.314313, 0.314574, 0.314836, 0.315098, 0.315359, 0.315621, 0.315883, 0.316145, 0.316407, 0.316669,
-        0.316932, 0.317194, 0.317457, 0.317720, 0.317983, 0.318246, 0.318509, 0.318772, 0.319035, 0.319299, 0.319562, 0.319826, 0.320090, 0.320354, 0.320618, 0.320882, 0.321147,
-        0.321411, 0.321676, 0.321940, 0.322205, 0.322470, 0.322735, 0.323000, 0.323265, 0.323531, 0.323796, 0.324062, 0.324328, 0.324594, 0.324860, 0.325126, 0.325392, 0.325658,
-        0.325925, 0.326191, 0.326458, 0.326725, 0.326992, 0.327259, 0.327526, 0.327793, 0.328061, 0.328328, 0.328596, 0.328864, 0.329132, 0.329400, 0.329668, 0.329936, 0.330205,
-        0.330473, 0.330742, 0.331010, 0.331279, 0.331548, 0.331817, 0.332087, 0.332356, 0.332626, 0.332895, 0.333165, 0.333435, 0.333705, 0.333975, 0.334245, 0.334515, 0.334786,
-        0.335056, 0.335327, 0.335598, 0.335869, 0.336140, 0.336411, 0.336682, 0.336953, 0.337225, 0.337497, 0.337768, 0.338040, 0.338312, 0.338584, 0.338857, 0.339129, 0.339401,
-        0.339674, 0.339947, 0.340220, 0.340493, 0.340766, 0.341039, 0.341312, 0.341586, 0.341859, 0.342133, 0.342407, 0.342681, 0.342955, 0.343229, 0.343503, 0.343777, 0.344052,
-        0.344327, 0.344601, 0.344876, 0.345151, 0.345426, 0.345702, 0.345977, 0.346252, 0.346528, 0.346804, 0.347080, 0.347356, 0.347632, 0.347908, 0.348184, 0.348461, 0.348737,
-        0.349014, 0.349291, 0.349568, 0.349845, 0.350122, 0.350399, 0.350677, 0.350954, 0.351232, 0.351510, 0.351788, 0.352066, 0.352344, 0.352622, 0.352900, 0.353179, 0.353458,
-        0.353736, 0.354015, 0.354294, 0.354573, 0.354853, 0.355132, 0.355411, 0.355691, 0.355971, 0.356251, 0.356531, 0.356811, 0.357091, 0.357371, 0.357652, 0.357932, 0.358213,
-        0.358494, 0.358775, 0.359056, 0.359337, 0.359618, 0.359899, 0.360181, 0.360463, 0.360744, 0.361026, 0.361308, 0.361590, 0.361873, 0.362155, 0.362438, 0.362720, 0.363003,
-        0.363286, 0.363569, 0.363852, 0.364135, 0.364419, 0.364702, 0.364986, 0.365269, 0.365553, 0.365837, 0.366121, 0.366405, 0.366690, 0.366974, 0.367259, 0.367543, 0.367828,
-        0.368113, 0.368398, 0.368683, 0.368969, 0.369254, 0.369540, 0.369825, 0.370111, 0.370397, 0.370683, 0.370969, 0.371255, 0.371542, 0.371828, 0.372115, 0.372402, 0.372688,
-        0.372975, 0.373263, 0.373550, 0.373837, 0.374125, 0.374412, 0.374700, 0.374988, 0.375276, 0.375564, 0.375852, 0.376140, 0.376429, 0.376717, 0.377006, 0.377295, 0.377584,
-        0.377873, 0.378162, 0.378451, 0.378741, 0.379030, 0.379320, 0.379610, 0.379900, 0.380190, 0.380480, 0.380770, 0.381061, 0.381351, 0.381642, 0.381932, 0.382223, 0.382514,
-        0.382805, 0.383097, 0.383388, 0.383680, 0.383971, 0.384263, 0.384555, 0.384847, 0.385139, 0.385431, 0.385723, 0.386016, 0.386309, 0.386601, 0.386894, 0.387187, 0.387480,
-        0.387773, 0.388067, 0.388360, 0.388654, 0.388947, 0.389241, 0.389535, 0.389829, 0.390123, 0.390418, 0.390712, 0.391007, 0.391301, 0.391596, 0.391891, 0.392186, 0.392481,
-        0.392776, 0.393072, 0.393367, 0.393663, 0.393959, 0.394255, 0.394551, 0.394847, 0.395143, 0.395439, 0.395736, 0.396032, 0.396329, 0.396626, 0.396923, 0.397220, 0.397517,
-        0.397815, 0.398112, 0.398410, 0.398708, 0.399005, 0.399303, 0.399601, 0.399900, 0.400198, 0.400496, 0.400795, 0.401094, 0.401392, 0.401691, 0.401991, 0.402290, 0.402589,
-        0.402888, 0.403188, 0.403488, 0.403787, 0.404087, 0.404387, 0.404688, 0.404988, 0.405288, 0.405589, 0.405889, 0.406190, 0.406491, 0.406792, 0.407093, 0.407395, 0.407696,
-        0.407998, 0.408299, 0.408601, 0.408903, 0.409205, 0.409507, 0.409809, 0.410112, 0.410414, 0.410717, 0.411019, 0.411322, 0.411625, 0.411928, 0.412232, 0.412535, 0.412838,
-        0.413142, 0.413446, 0.413750, 0.414054, 0.414358, 0.414662, 0.414966, 0.415271, 0.415575, 0.415880, 0.416185, 0.416490, 0.416795, 0.417100, 0.417405, 0.417711, 0.418016,
-        0.418322, 0.418628, 0.418934, 0.419240, 0.419546, 0.419852, 0.420159, 0.420465, 0.420772, 0.421079, 0.421386, 0.421693, 0.422000, 0.422307, 0.422615, 0.422922, 0.423230,
-        0.423538, 0.423845, 0.424153, 0.424462, 0.424770, 0.425078, 0.425387, 0.425695, 0.426004, 0.426313, 0.426622, 0.426931, 0.427241, 0.427550, 0.427859, 0.428169, 0.428479,
-        0.428789, 0.429099, 0.429409, 0.429719, 0.430029, 0.430340, 0.430650, 0.430961, 0.431272, 0.431583, 0.431894, 0.432205, 0.432517, 0.432828, 0.433140, 0.433452, 0.433763,
-        0.434075, 0.434387, 0.434700, 0.435012, 0.435324, 0.435637, 0.435950, 0.436263, 0.436576, 0.436889, 0.437202, 0.437515, 0.437829, 0.438142, 0.438456, 0.438770, 0.439084,
-        0.439398, 0.439712, 0.440026, 0.440341, 0.440655, 0.440970, 0.441285, 0.441600, 0.441915, 0.442230, 0.442545, 0.442861, 0.443176, 0.443492, 0.443808, 0.444124, 0.444440,
-        0.444756, 0.445072, 0.445388, 0.445705, 0.446022, 0.446338, 0.446655, 0.446972, 0.447290, 0.447607, 0.447924, 0.448242, 0.448559, 0.448877, 0.449195, 0.449513, 0.449831,
-        0.450150, 0.450468, 0.450786, 0.451105, 0.451424, 0.451743, 0.452062, 0.452381, 0.452700, 0.453020, 0.453339, 0.453659, 0.453978, 0.454298, 0.454618, 0.454938, 0.455259,
-        0.455579, 0.455900, 0.456220, 0.456541, 0.456862, 0.457183, 0.457504, 0.457825, 0.458147, 0.458468, 0.458790, 0.459111, 0.459433, 0.459755, 0.460077, 0.460400, 0.460722,
-        0.461044, 0.461367, 0.461690, 0.462013, 0.462336, 0.462659, 0.462982, 0.463305, 0.463629, 0.463952, 0.464276, 0.464600, 0.464924, 0.465248, 0.465572, 0.465897, 0.466221,
-        0.466546, 0.466870, 0.467195, 0.467520, 0.467845, 0.468171, 0.468496, 0.468821, 0.469147, 0.469473, 0.469799, 0.470125, 0.470451, 0.470777, 0.471103, 0.471430, 0.471756,
-        0.472083, 0.472410, 0.472737, 0.473064, 0.473391, 0.473718, 0.474046, 0.474373, 0.474701, 0.475029, 0.475357, 0.475685, 0.476013, 0.476341, 0.476670, 0.476999, 0.477327,
-        0.477656, 0.477985, 0.478314, 0.478643, 0.478973, 0.479302, 0.479632, 0.479961, 0.480291, 0.480621, 0.480951, 0.481281, 0.481612, 0.481942, 0.482273, 0.482603, 0.482934,
-        0.483265, 0.483596, 0.483927, 0.484259, 0.484590, 0.484922, 0.485253, 0.485585, 0.485917, 0.486249, 0.486581, 0.486914, 0.487246, 0.487579, 0.487911, 0.488244, 0.488577,
-        0.488910, 0.489243, 0.489577, 0.489910, 0.490244, 0.490578, 0.490911, 0.491245, 0.491579, 0.491914, 0.492248, 0.492582, 0.492917, 0.493252, 0.493586, 0.493921, 0.494256,
-        0.494592, 0.494927, 0.495262, 0.495598, 0.495934, 0.496269, 0.496605, 0.496941, 0.497278, 0.497614, 0.497950, 0.498287, 0.498624, 0.498960, 0.499297, 0.499634, 0.499972,
-        0.500309, 0.500646, 0.500984, 0.501322, 0.501659, 0.501997, 0.502335, 0.502674, 0.503012, 0.503350, 0.503689, 0.504028, 0.504366, 0.504705, 0.505044, 0.505384, 0.505723,
-        0.506062, 0.506402, 0.506742, 0.507081, 0.507421, 0.507762, 0.508102, 0.508442, 0.508782, 0.509123, 0.509464, 0.509805, 0.510146, 0.510487, 0.510828, 0.511169, 0.511511,
-        0.511852, 0.512194, 0.512536, 0.512878, 0.513220, 0.513562, 0.513904, 0.514247, 0.514589, 0.514932, 0.515275, 0.515618, 0.515961, 0.516304, 0.516647, 0.516991, 0.517334,
-        0.517678, 0.518022, 0.518366, 0.518710, 0.519054, 0.519399, 0.519743, 0.520088, 0.520432, 0.520777, 0.521122, 0.521467, 0.521812, 0.522158, 0.522503, 0.522849, 0.523194,
-        0.523540, 0.523886, 0.524232, 0.524579, 0.524925, 0.525271, 0.525618, 0.525965, 0.526312, 0.526659, 0.527006, 0.527353, 0.527700, 0.528048, 0.528395, 0.528743, 0.529091,
-        0.529439, 0.529787, 0.530135, 0.530484, 0.530832, 0.531181, 0.531529, 0.531878, 0.532227, 0.532576, 0.532926, 0.533275, 0.533625, 0.533974, 0.534324, 0.534674, 0.535024,
-        0.535374, 0.535724, 0.536074, 0.536425, 0.536776, 0.537126, 0.537477, 0.537828, 0.538179, 0.538531, 0.538882, 0.539234, 0.539585, 0.539937, 0.540289, 0.540641, 0.540993,
-        0.541345, 0.541698, 0.542050, 0.542403, 0.542756, 0.543108, 0.543461, 0.543815, 0.544168, 0.544521, 0.544875, 0.545228, 0.545582, 0.545936, 0.546290, 0.546644, 0.546999,
-        0.547353, 0.547708, 0.548062, 0.548417, 0.548772, 0.549127, 0.549482, 0.549837, 0.550193, 0.550548, 0.550904, 0.551260, 0.551616, 0.551972, 0.552328, 0.552684, 0.553041,
-        0.553397, 0.553754, 0.554111, 0.554468, 0.554825, 0.555182, 0.555539, 0.555897, 0.556254, 0.556612, 0.556970, 0.557328, 0.557686, 0.558044, 0.558402, 0.558761, 0.559119,
-        0.559478, 0.559837, 0.560196, 0.560555, 0.560914, 0.561274, 0.561633, 0.561993, 0.562352, 0.562712, 0.563072, 0.563432, 0.563792, 0.564153, 0.564513, 0.564874, 0.565235,
-        0.565596, 0.565956, 0.566318, 0.566679, 0.567040, 0.567402, 0.567763, 0.568125, 0.568487, 0.568849, 0.569211, 0.569573, 0.569936, 0.570298, 0.570661, 0.571024, 0.571386,
-        0.571750, 0.572113, 0.572476, 0.572839, 0.573203, 0.573566, 0.573930, 0.574294, 0.574658, 0.575022, 0.575387, 0.575751, 0.576116, 0.576480, 0.576845, 0.577210, 0.577575,
-        0.577940, 0.578305, 0.578671, 0.579036, 0.579402, 0.579768, 0.580134, 0.580500, 0.580866, 0.581232, 0.581599, 0.581965, 0.582332, 0.582699, 0.583066, 0.583433, 0.583800,
-        0.584167, 0.584535, 0.584903, 0.585270, 0.585638, 0.586006, 0.586374, 0.586742, 0.587111, 0.587479, 0.587848, 0.588217, 0.588585, 0.588954, 0.589323, 0.589693, 0.590062,
-        0.590432, 0.590801, 0.591171, 0.591541, 0.591911, 0.592281, 0.592651, 0.593022, 0.593392, 0.593763, 0.594133, 0.594504, 0.594875, 0.595247, 0.595618, 0.595989, 0.596361,
-        0.596732, 0.597104, 0.597476, 0.597848, 0.598220, 0.598593, 0.598965, 0.599338, 0.599710, 0.600083, 0.600456, 0.600829, 0.601202, 0.601575, 0.601949, 0.602322, 0.602696,
-        0.603070, 0.603444, 0.603818, 0.604192, 0.604567, 0.604941, 0.605316, 0.605690, 0.606065, 0.606440, 0.606815, 0.607190, 0.607566, 0.607941, 0.608317, 0.608693, 0.609068,
-        0.609444, 0.609821, 0.610197, 0.610573, 0.610950, 0.611326, 0.611703, 0.612080, 0.612457, 0.612834, 0.613211, 0.613589, 0.613966, 0.614344, 0.614722, 0.615100, 0.615478,
-        0.615856, 0.616234, 0.616613, 0.616991, 0.617370, 0.617749, 0.618127, 0.618507, 0.618886, 0.619265, 0.619644, 0.620024, 0.620404, 0.620784, 0.621163, 0.621544, 0.621924,
-        0.622304, 0.622685, 0.623065, 0.623446, 0.623827, 0.624208, 0.624589, 0.624970, 0.625351, 0.625733, 0.626114, 0.626496, 0.626878, 0.627260, 0.627642, 0.628024, 0.628407,
-        0.628789, 0.629172, 0.629555, 0.629938, 0.630321, 0.630704, 0.631087, 0.631470, 0.631854, 0.632238, 0.632621, 0.633005, 0.633389, 0.633774, 0.634158, 0.634542, 0.634927,
-        0.635312, 0.635696, 0.636081, 0.636466, 0.636852, 0.637237, 0.637622, 0.638008, 0.638394, 0.638780, 0.639165, 0.639552, 0.639938, 0.640324, 0.640711, 0.641097, 0.641484,
-        0.641871, 0.642258, 0.642645, 0.643032, 0.643420, 0.643807, 0.644195, 0.644583, 0.644970, 0.645358, 0.645747, 0.646135, 0.646523, 0.646912, 0.647300, 0.647689, 0.648078,
-        0.648467, 0.648856, 0.649246, 0.649635, 0.650025, 0.650414, 0.650804, 0.651194, 0.651584, 0.651974, 0.652365, 0.652755, 0.653146, 0.653537, 0.653927, 0.654318, 0.654709,
-        0.655101, 0.655492, 0.655884, 0.656275, 0.656667, 0.657059, 0.657451, 0.657843, 0.658235, 0.658628, 0.659020, 0.659413, 0.659805, 0.660198, 0.660591, 0.660985, 0.661378,
-        0.661771, 0.662165, 0.662559, 0.662952, 0.663346, 0.663740, 0.664134, 0.664529, 0.664923, 0.665318, 0.665713, 0.666107, 0.666502, 0.666897, 0.667293, 0.667688, 0.668083,
-        0.668479, 0.668875, 0.669271, 0.669667, 0.670063, 0.670459, 0.670855, 0.671252, 0.671649, 0.672045, 0.672442, 0.672839, 0.673236, 0.673634, 0.674031, 0.674429, 0.674826,
-        0.675224, 0.675622, 0.676020, 0.676418, 0.676817, 0.677215, 0.677614, 0.678012, 0.678411, 0.678810, 0.679209, 0.679608, 0.680008, 0.680407, 0.680807, 0.681207, 0.681606,
-        0.682006, 0.682407, 0.682807, 0.683207, 0.683608, 0.684008, 0.684409, 0.684810, 0.685211, 0.685612, 0.686013, 0.686415, 0.686816, 0.687218, 0.687620, 0.688022, 0.688424,
-        0.688826, 0.689228, 0.689631, 0.690033, 0.690436, 0.690839, 0.691242, 0.691645, 0.692048, 0.692451, 0.692855, 0.693259, 0.693662, 0.694066, 0.694470, 0.694874, 0.695279,
-        0.695683, 0.696087, 0.696492, 0.696897, 0.697302, 0.697707, 0.698112, 0.698517, 0.698923, 0.699328, 0.699734, 0.700140, 0.700546, 0.700952, 0.701358, 0.701764, 0.702171,
-        0.702577, 0.702984, 0.703391, 0.703798, 0.704205, 0.704612, 0.705019, 0.705427, 0.705835, 0.706242, 0.706650, 0.707058, 0.707466, 0.707875, 0.708283, 0.708691, 0.709100,
-        0.709509, 0.709918, 0.710327, 0.710736, 0.711145, 0.711555, 0.711964, 0.712374, 0.712784, 0.713194, 0.713604, 0.714014, 0.714424, 0.714835, 0.715246, 0.715656, 0.716067,
-        0.716478, 0.716889, 0.717300, 0.717712, 0.718123, 0.718535, 0.718947, 0.719359, 0.719771, 0.720183, 0.720595, 0.721008, 0.721420, 0.721833, 0.722246, 0.722658, 0.723072,
-        0.723485, 0.723898, 0.724312, 0.724725, 0.725139, 0.725553, 0.725967, 0.726381, 0.726795, 0.727209, 0.727624, 0.728038, 0.728453, 0.728868, 0.729283, 0.729698, 0.730113,
-        0.730529, 0.730944, 0.731360, 0.731776, 0.732192, 0.732608, 0.733024, 0.733440, 0.733857, 0.734273, 0.734690, 0.735107, 0.735524, 0.735941, 0.736358, 0.736776, 0.737193,
-        0.737611, 0.738028, 0.738446, 0.738864, 0.739282, 0.739701, 0.740119, 0.740538, 0.740956, 0.741375, 0.741794, 0.742213, 0.742632, 0.743051, 0.743471, 0.743890, 0.744310,
-        0.744730, 0.745150, 0.745570, 0.745990, 0.746411, 0.746831, 0.747252, 0.747672, 0.748093, 0.748514, 0.748935, 0.749357, 0.749778, 0.750200, 0.750621, 0.751043, 0.751465,
-        0.751887, 0.752309, 0.752731, 0.753154, 0.753576, 0.753999, 0.754422, 0.754845, 0.755268, 0.755691, 0.756114, 0.756538, 0.756962, 0.757385, 0.757809, 0.758233, 0.758657,
-        0.759081, 0.759506, 0.759930, 0.760355, 0.760780, 0.761205, 0.761630, 0.762055, 0.762480, 0.762906, 0.763331, 0.763757, 0.764183, 0.764609, 0.765035, 0.765461, 0.765887,
-        0.766314, 0.766740, 0.767167, 0.767594, 0.768021, 0.768448, 0.768875, 0.769303, 0.769730, 0.770158, 0.770586, 0.771014, 0.771442, 0.771870, 0.772298, 0.772727, 0.773155,
-        0.773584, 0.774013, 0.774442, 0.774871, 0.775300, 0.775729, 0.776159, 0.776588, 0.777018, 0.777448, 0.777878, 0.778308, 0.778738, 0.779169, 0.779599, 0.780030, 0.780461,
-        0.780892, 0.781323, 0.781754, 0.782185, 0.782617, 0.783048, 0.783480, 0.783912, 0.784344, 0.784776, 0.785208, 0.785640, 0.786073, 0.786506, 0.786938, 0.787371, 0.787804,
-        0.788237, 0.788671, 0.789104, 0.789538, 0.789971, 0.790405, 0.790839, 0.791273, 0.791707, 0.792141, 0.792576, 0.793011, 0.793445, 0.793880, 0.794315, 0.794750, 0.795185,
-        0.795621, 0.796056, 0.796492, 0.796928, 0.797364, 0.797800, 0.798236, 0.798672, 0.799108, 0.799545, 0.799982, 0.800419, 0.800855, 0.801293, 0.801730, 0.802167, 0.802605,
-        0.803042, 0.803480, 0.803918, 0.804356, 0.804794, 0.805232, 0.805670, 0.806109, 0.806548, 0.806986, 0.807425, 0.807864, 0.808304, 0.808743, 0.809182, 0.809622, 0.810062,
-        0.810501, 0.810941, 0.811381, 0.811822, 0.812262, 0.812703, 0.813143, 0.813584, 0.814025, 0.814466, 0.814907, 0.815348, 0.815790, 0.816231, 0.816673, 0.817115, 0.817557,
-        0.817999, 0.818441, 0.818883, 0.819326, 0.819768, 0.820211, 0.820654, 0.821097, 0.821540, 0.821983, 0.822427, 0.822870, 0.823314, 0.823757, 0.824201, 0.824645, 0.825090,
-        0.825534, 0.825978, 0.826423, 0.826868, 0.827312, 0.827757, 0.828202, 0.828648, 0.829093, 0.829538, 0.829984, 0.830430, 0.830876, 0.831322, 0.831768, 0.832214, 0.832661,
-        0.833107, 0.833554, 0.834001, 0.834447, 0.834895, 0.835342, 0.835789, 0.836237, 0.836684, 0.837132, 0.837580, 0.838028, 0.838476, 0.838924, 0.839372, 0.839821, 0.840270,
-        0.840718, 0.841167, 0.841616, 0.842065, 0.842515, 0.842964, 0.843414, 0.843863, 0.844313, 0.844763, 0.845213, 0.845664, 0.846114, 0.846564, 0.847015, 0.847466, 0.847917,
-        0.848368, 0.848819, 0.849270, 0.849722, 0.850173, 0.850625, 0.851077, 0.851529, 0.851981, 0.852433, 0.852885, 0.853338, 0.853790, 0.854243, 0.854696, 0.855149, 0.855602,
-        0.856055, 0.856509, 0.856962, 0.857416, 0.857870, 0.858323, 0.858778, 0.859232, 0.859686, 0.860140, 0.860595, 0.861050, 0.861505, 0.861960, 0.862415, 0.862870, 0.863325,
-        0.863781, 0.864236, 0.864692, 0.865148, 0.865604, 0.866060, 0.866517, 0.866973, 0.867430, 0.867886, 0.868343, 0.868800, 0.869257, 0.869714, 0.870172, 0.870629, 0.871087,
-        0.871545, 0.872003, 0.872461, 0.872919, 0.873377, 0.873835, 0.874294, 0.874753, 0.875211, 0.875670, 0.876130, 0.876589, 0.877048, 0.877508, 0.877967, 0.878427, 0.878887,
-        0.879347, 0.879807, 0.880267, 0.880728, 0.881188, 0.881649, 0.882110, 0.882570, 0.883032, 0.883493, 0.883954, 0.884416, 0.884877, 0.885339, 0.885801, 0.886263, 0.886725,
-        0.887187, 0.887649, 0.888112, 0.888575, 0.889037, 0.889500, 0.889963, 0.890427, 0.890890, 0.891353, 0.891817, 0.892281, 0.892744, 0.893208, 0.893673, 0.894137, 0.894601,
-        0.895066, 0.895530, 0.895995, 0.896460, 0.896925, 0.897390, 0.897856, 0.898321, 0.898787, 0.899252, 0.899718, 0.900184, 0.900650, 0.901116, 0.901583, 0.902049, 0.902516,
-        0.902983, 0.903450, 0.903917, 0.904384, 0.904851, 0.905318, 0.905786, 0.906254, 0.906722, 0.907190, 0.907658, 0.908126, 0.908594, 0.909063, 0.909531, 0.910000, 0.910469,
-        0.910938, 0.911407, 0.911876, 0.912346, 0.912815, 0.913285, 0.913755, 0.914225, 0.914695, 0.915165, 0.915635, 0.916106, 0.916577, 0.917047, 0.917518, 0.917989, 0.918460,
-        0.918932, 0.919403, 0.919875, 0.920346, 0.920818, 0.921290, 0.921762, 0.922234, 0.922707, 0.923179, 0.923652, 0.924125, 0.924597, 0.925070, 0.925544, 0.926017, 0.926490,
-        0.926964, 0.927437, 0.927911, 0.928385, 0.928859, 0.929334, 0.929808, 0.930282, 0.930757, 0.931232, 0.931707, 0.932182, 0.932657, 0.933132, 0.933607, 0.934083, 0.934559,
-        0.935034, 0.935510, 0.935986, 0.936463, 0.936939, 0.937415, 0.937892, 0.938369, 0.938846, 0.939323, 0.939800, 0.940277, 0.940754, 0.941232, 0.941710, 0.942187, 0.942665,
-        0.943144, 0.943622, 0.944100, 0.944579, 0.945057, 0.945536, 0.946015, 0.946494, 0.946973, 0.947452, 0.947932, 0.948411, 0.948891, 0.949371, 0.949851, 0.950331, 0.950811,
-        0.951291, 0.951772, 0.952252, 0.952733, 0.953214, 0.953695, 0.954176, 0.954657, 0.955139, 0.955620, 0.956102, 0.956584, 0.957066, 0.957548, 0.958030, 0.958512, 0.958995,
-        0.959477, 0.959960, 0.960443, 0.960926, 0.961409, 0.961892, 0.962376, 0.962859, 0.963343, 0.963827, 0.964311, 0.964795, 0.965279, 0.965763, 0.966248, 0.966732, 0.967217,
-        0.967702, 0.968187, 0.968672, 0.969158, 0.969643, 0.970128, 0.970614, 0.971100, 0.971586, 0.972072, 0.972558, 0.973045, 0.973531, 0.974018, 0.974504, 0.974991, 0.975478,
-        0.975966, 0.976453, 0.976940, 0.977428, 0.977915, 0.978403, 0.978891, 0.979379, 0.979868, 0.980356, 0.980844, 0.981333, 0.981822, 0.982311, 0.982800, 0.983289, 0.983778,
-        0.984268, 0.984757, 0.985247, 0.985737, 0.986227, 0.986717, 0.987207, 0.987697, 0.988188, 0.988678, 0.989169, 0.989660, 0.990151, 0.990642, 0.991134, 0.991625, 0.992117,
-        0.992608, 0.993100, 0.993592, 0.994084, 0.994577, 0.995069, 0.995561, 0.996054, 0.996547, 0.997040, 0.997533, 0.998026, 0.998519, 0.999013, 0.999506, 1.000000
-    },
-};
-
-static int lut_out[1][DCI_LUT_SIZE] = {
-    // Bit Depth:       12
-    // Reference White: DCI
-    // Gamma:           2.6
-    {
-        0,  57,  75,  87,  98, 106, 114, 121, 127, 133, 139, 144, 149, 154, 158, 162, 167, 171, 174, 178, 182, 185, 188, 192, 195, 198,
-        201, 204, 207, 210, 212, 215, 218, 220, 223, 225, 228, 230, 233, 235, 237, 239, 242, 244, 246, 248, 250, 252, 254, 256, 258, 260,
-        262, 264, 266, 268, 270, 272, 274, 275, 277, 279, 281, 283, 284, 286, 288, 289, 291, 293, 294, 296, 297, 299, 301, 302, 304, 305,
-        307, 308, 310, 311, 313, 314, 316, 317, 319, 320, 321, 323, 324, 326, 327, 328, 330, 331, 332, 334, 335, 336, 338, 339, 340, 341,
-        343, 344, 345, 346, 348, 349, 350, 351, 353, 354, 355, 356, 357, 359, 360, 361, 362, 363, 364, 366, 367, 368, 369, 370, 371, 372,
-        373, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400,
-        401, 402, 403, 404, 405, 406, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 421, 422, 423, 424,
-        425, 426, 427, 428, 429, 430, 430, 431, 432, 433, 434, 435, 436, 437, 437, 438, 439, 440, 441, 442, 443, 443, 444, 445, 446, 447,
-        448, 448, 449, 450, 451, 452, 452, 453, 454, 455, 456, 457, 457, 458, 459, 460, 461, 461, 462, 463, 464, 464, 465, 466, 467, 468,
-        468, 469, 470, 471, 471, 472, 473, 474, 474, 475, 476, 477, 477, 478, 479, 480, 480, 481, 482, 483, 483, 484, 485, 486, 486, 487,
-        488, 488, 489, 490, 491, 491, 492, 493, 493, 494, 495, 496, 496, 497, 498, 498, 499, 500, 500, 501, 502, 503, 503, 504, 505, 505,
-        506, 507, 507, 508, 509, 509, 510, 511, 511, 512, 513, 513, 514, 515, 515, 516, 517, 517, 518, 519, 519, 520, 521, 521, 522, 523,
-        523, 524, 524, 525, 526, 526, 527, 528, 528, 529, 530, 530, 531, 531, 532, 533, 533, 534, 535, 535, 536, 536, 537, 538, 538, 539,
-        540, 540, 541, 541, 542, 543, 543, 544, 544, 545, 546, 546, 547, 547, 548, 549, 549, 550, 550, 551, 552, 552, 553, 553, 554, 555,
-        555, 556, 556, 557, 557, 558, 559, 559, 560, 560, 561, 562, 562, 563, 563, 564, 564, 565, 566, 566, 567, 567, 568, 568, 569, 570,
-        570, 571, 571, 572, 572, 573, 573, 574, 575, 575, 576, 576, 577, 577, 578, 578, 579, 580, 580, 581, 581, 582, 582, 583, 583, 584,
-        584, 585, 586, 586, 587, 587, 588, 588, 589, 589, 590, 590, 591, 591, 592, 592, 593, 594, 594, 595, 595, 596, 596, 597, 597, 598,
-        598, 599, 599, 600, 600, 601, 601, 602, 602, 603, 603, 604, 604, 605, 605, 606, 606, 607, 607, 608, 609, 609, 610, 610, 611, 611,
-        612, 612, 613, 613, 614, 614, 615, 615, 616, 616, 617, 617, 618, 618, 619, 619, 620, 620, 620, 621, 621, 622, 622, 623, 623, 624,
-        624, 625, 625, 626, 626, 627, 627, 628, 628, 629, 629, 630, 630, 631, 631, 632, 632, 633, 633, 634, 634, 634, 635, 635, 636, 636,
-        637, 637, 638, 638, 639, 639, 640, 640, 641, 641, 642, 642, 642, 643, 643, 644, 644, 645, 645, 646, 646, 647, 647, 648, 648, 648,
-        649, 649, 650, 650, 651, 651, 652, 652, 653, 653, 653, 654, 654, 655, 655, 656, 656, 657, 657, 658, 658, 658, 659, 659, 660, 660,
-        661, 661, 662, 662, 662, 663, 663, 664, 664, 665, 665, 666, 666, 666, 667, 667, 668, 668, 669, 669, 669, 670, 670, 671, 671, 672,
-        672, 672, 673, 673, 674, 674, 675, 675, 675, 676, 676, 677, 677, 678, 678, 678, 679, 679, 680, 680, 681, 681, 681, 682, 682, 683,
-        683, 684, 684, 684, 685, 685, 686, 686, 687, 687, 687, 688, 688, 689, 689, 689, 690, 690, 691, 691, 691, 692, 692, 693, 693, 694,
-        694, 694, 695, 695, 696, 696, 696, 697, 697, 698, 698, 698, 699, 699, 700, 700, 700, 701, 701, 702, 702, 703, 703, 703, 704, 704,
-        705, 705, 705, 706, 706, 707, 707, 707, 708, 708, 709, 709, 709, 710, 710, 711, 711, 711, 712, 712, 712, 713, 713, 714, 714, 714,
-        715, 715, 716, 716, 716, 717, 717, 718, 718, 718, 719, 719, 720, 720, 720, 721, 721, 721, 722, 722, 723, 723, 723, 724, 724, 725,
-        725, 725, 726, 726, 726, 727, 727, 728, 728, 728, 729, 729, 729, 730, 730, 731, 731, 731, 732, 732, 733, 733, 733, 734, 734, 734,
-        735, 735, 736, 736, 736, 737, 737, 737, 738, 738, 739, 739, 739, 740, 740, 740, 741, 741, 741, 742, 742, 743, 743, 743, 744, 744,
-        744, 745, 745, 746, 746, 746, 747, 747, 747, 748, 748, 748, 749, 749, 750, 750, 750, 751, 751, 751, 752, 752, 752, 753, 753, 754,
-        754, 754, 755, 755, 755, 756, 756, 756, 757, 757, 757, 758, 758, 759, 759, 759, 760, 760, 760, 761, 761, 761, 762, 762, 762, 763,
-        763, 763, 764, 764, 765, 765, 765, 766, 766, 766, 767, 767, 767, 768, 768, 768, 769, 769, 769, 770, 770, 770, 771, 771, 772, 772,
-        772, 773, 773, 773, 774, 774, 774, 775, 775, 775, 776, 776, 776, 777, 777, 777, 778, 778, 778, 779, 779, 779, 780, 780, 780, 781,
-        781, 781, 782, 782, 783, 783, 783, 784, 784, 784, 785, 785, 785, 786, 786, 786, 787, 787, 787, 788, 788, 788, 789, 789, 789, 790,
-        790, 790, 791, 791, 791, 792, 792, 792, 793, 793, 793, 794, 794, 794, 795, 795, 795, 796, 796, 796, 797, 797, 797, 798, 798, 798,
-        799, 799, 799, 800, 800, 800, 800, 801, 801, 801, 802, 802, 802, 803, 803, 803, 804, 804, 804, 805, 805, 805, 806, 806, 806, 807,
-        807, 807, 808, 808, 808, 809, 809, 809, 810, 810, 810, 811, 811, 811, 811, 812, 812, 812, 813, 813, 813, 814, 814, 814, 815, 815,
-        815, 816, 816, 816, 817, 817, 817, 818, 818, 818, 818, 819, 819, 819, 820, 820, 820, 821, 821, 821, 822, 822, 822, 823, 823, 823,
-        824, 824, 824, 824, 825, 825, 825, 826, 826, 826, 827, 827, 827, 828, 828, 828, 828, 829, 829, 829, 830, 830, 830, 831, 831, 831,
-        832, 832, 832, 832, 833, 833, 833, 834, 834, 834, 835, 835, 835, 836, 836, 836, 836, 837, 837, 837, 838, 838, 838, 839, 839, 839,
-        840, 840, 840, 840, 841, 841, 841, 842, 842, 842, 843, 843, 843, 843, 844, 844, 844, 845, 845, 845, 846, 846, 846, 846, 847, 847,
-        847, 848, 848, 848, 849, 849, 849, 849, 850, 850, 850, 851, 851, 851, 851, 852, 852, 852, 853, 853, 853, 854, 854, 854, 854, 855,
-        855, 855, 856, 856, 856, 857, 857, 857, 857, 858, 858, 858, 859, 859, 859, 859, 860, 860, 860, 861, 861, 861, 861, 862, 862, 862,
-        863, 863, 863, 864, 864, 864, 864, 865, 865, 865, 866, 866, 866, 866, 867, 867, 867, 868, 868, 868, 868, 869, 869, 869, 870, 870,
-        870, 870, 871, 871, 871, 872, 872, 872, 872, 873, 873, 873, 874, 874, 874, 874, 875, 875, 875, 876, 876, 876, 876, 877, 877, 877,
-        878, 878, 878, 878, 879, 879, 879, 879, 880, 880, 880, 881, 881, 881, 881, 882, 882, 882, 883, 883, 883, 883, 884, 884, 884, 885,
-        885, 885, 885, 886, 886, 886, 886, 887, 887, 887, 888, 888, 888, 888, 889, 889, 889, 890, 890, 890, 890, 891, 891, 891, 891, 892,
-        892, 892, 893, 893, 893, 893, 894, 894, 894, 894, 895, 895, 895, 896, 896, 896, 896, 897, 897, 897, 897, 898, 898, 898, 899, 899,
-        899, 899, 900, 900, 900, 900, 901, 901, 901, 902, 902, 902, 902, 903, 903, 903, 903, 904, 904, 904, 905, 905, 905, 905, 906, 906,
-        906, 906, 907, 907, 907, 907, 908, 908, 908, 909, 909, 909, 909, 910, 910, 910, 910, 911, 911, 911, 911, 912, 912, 912, 913, 913,
-        913, 913, 914, 914, 914, 914, 915, 915, 915, 915, 916, 916, 916, 917, 917, 917, 917, 918, 918, 918, 918, 919, 919, 919, 919, 920,
-        920, 920, 920, 921, 921, 921, 921, 922, 922, 922, 923, 923, 923, 923, 924, 924, 924, 924, 925, 925, 925, 925, 926, 926, 926, 926,
-        927, 927, 927, 927, 928, 928, 928, 928, 929, 929, 929, 930, 930, 930, 930, 931, 931, 931, 931, 932, 932, 932, 932, 933, 933, 933,
-        933, 934, 934, 934, 934, 935, 935, 935, 935, 936, 936, 936, 936, 937, 937, 937, 937, 938, 938, 938, 938, 939, 939, 939, 939, 940,
-        940, 940, 940, 941, 941, 941, 942, 942, 942, 942, 943, 943, 943, 943, 944, 944, 944, 944, 945, 945, 945, 945, 946, 946, 946, 946,
-        947, 947, 947, 947, 948, 948, 948, 948, 949, 949, 949, 949, 950, 950, 950, 950, 951, 951, 951, 951, 952, 952, 952, 952, 953, 953,
-        953, 953, 953, 954, 954, 954, 954, 955, 955, 955, 955, 956, 956, 956, 956, 957, 957, 957, 957, 958, 958, 958, 958, 959, 959, 959,
-        959, 960, 960, 960, 960, 961, 961, 961, 961, 962, 962, 962, 962, 963, 963, 963, 963, 964, 964, 964, 964, 965, 965, 965, 965, 965,
-        966, 966, 966, 966, 967, 967, 967, 967, 968, 968, 968, 968, 969, 969, 969, 969, 970, 970, 970, 970, 971, 971, 971, 971, 972, 972,
-        972, 972, 972, 973, 973, 973, 973, 974, 974, 974, 974, 975, 975, 975, 975, 976, 976, 976, 976, 977, 977, 977, 977, 977, 978, 978,
-        978, 978, 979, 979, 979, 979, 980, 980, 980, 980, 981, 981, 981, 981, 982, 982, 982, 982, 982, 983, 983, 983, 983, 984, 984, 984,
-        984, 985, 985, 985, 985, 986, 986, 986, 986, 986, 987, 987, 987, 987, 988, 988, 988, 988, 989, 989, 989, 989, 989, 990, 990, 990,
-        990, 991, 991, 991, 991, 992, 992, 992, 992, 993, 993, 993, 993, 993, 994, 994, 994, 994, 995, 995, 995, 995, 996, 996, 996, 996,
-        996, 997, 997, 997, 997, 998, 998, 998, 998, 999, 999, 999, 999, 999, 1000, 1000, 1000, 1000, 1001, 1001, 1001, 1001, 1001, 1002, 1002, 1002,
-        1002, 1003, 1003, 1003, 1003, 1004, 1004, 1004, 1004, 1004, 1005, 1005, 1005, 1005, 1006, 1006, 1006, 1006, 1006, 1007, 1007, 1007, 1007, 1008, 1008, 1008,
-        1008, 1009, 1009, 1009, 1009, 1009, 1010, 1010, 1010, 1010, 1011, 1011, 1011, 1011, 1011, 1012, 1012, 1012, 1012, 1013, 1013, 1013, 1013, 1013, 1014, 1014,
-        1014, 1014, 1015, 1015, 1015, 1015, 1016, 1016, 1016, 1016, 1016, 1017, 1017, 1017, 1017, 1018, 1018, 1018, 1018, 1018, 1019, 1019, 1019, 1019, 1020, 1020,
-        1020, 1020, 1020, 1021, 1021, 1021, 1021, 1022, 1022, 1022, 1022, 1022, 1023, 1023, 1023, 1023, 1024, 1024, 1024, 1024, 1024, 1025, 1025, 1025, 1025, 1025,
-        1026, 1026, 1026, 1026, 1027, 1027, 1027, 1027, 1027, 1028, 1028, 1028, 1028, 1029, 1029, 1029, 1029, 1029, 1030, 1030, 1030, 1030, 1031, 1031, 1031, 1031,
-        1031, 1032, 1032, 1032, 1032, 1032, 1033, 1033, 1033, 1033, 1034, 1034, 1034, 1034, 1034, 1035, 1035, 1035, 1035, 1036, 1036, 1036, 1036, 1036, 1037, 1037,
-        1037, 1037, 1037, 1038, 1038, 1038, 1038, 1039, 1039, 1039, 1039, 1039, 1040, 1040, 1040, 1040, 1040, 1041, 1041, 1041, 1041, 1042, 1042, 1042, 1042, 1042,
-        1043, 1043, 1043, 1043, 1043, 1044, 1044, 1044, 1044, 1045, 1045, 1045, 1045, 1045, 1046, 1046, 1046, 1046, 1046, 1047, 1047, 1047, 1047, 1048, 1048, 1048,
-        1048, 1048, 1049, 1049, 1049, 1049, 1049, 1050, 1050, 1050, 1050, 1051, 1051, 1051, 1051, 1051, 1052, 1052, 1052, 1052, 1052, 1053, 1053, 1053, 1053, 1053,
-        1054, 1054, 1054, 1054, 1055, 1055, 1055, 1055, 1055, 1056, 1056, 1056, 1056, 1056, 1057, 1057, 1057, 1057, 1057, 1058, 1058, 1058, 1058, 1059, 1059, 1059,
-        1059, 1059, 1060, 1060, 1060, 1060, 1060, 1061, 1061, 1061, 1061, 1061, 1062, 1062, 1062, 1062, 1062, 1063, 1063, 1063, 1063, 1064, 1064, 1064, 1064, 1064,
-        1065, 1065, 1065, 1065, 1065, 1066, 1066, 1066, 1066, 1066, 1067, 1067, 1067, 1067, 1067, 1068, 1068, 1068, 1068, 1068, 1069, 1069, 1069, 1069, 1070, 1070,
-        1070, 1070, 1070, 1071, 1071, 1071, 1071, 1071, 1072, 1072, 1072, 1072, 1072, 1073, 1073, 1073, 1073, 1073, 1074, 1074, 1074, 1074, 1074, 1075, 1075, 1075,
-        1075, 1075, 1076, 1076, 1076, 1076, 1076, 1077, 1077, 1077, 1077, 1077, 1078, 1078, 1078, 1078, 1079, 1079, 1079, 1079, 1079, 1080, 1080, 1080, 1080, 1080,
-        1081, 1081, 1081, 1081, 1081, 1082, 1082, 1082, 1082, 1082, 1083, 1083, 1083, 1083, 1083, 1084, 1084, 1084, 1084, 1084, 1085, 1085, 1085, 1085, 1085, 1086,
-        1086, 1086, 1086, 1086, 1087, 1087, 1087, 1087, 1087, 1088, 1088, 1088, 1088, 1088, 1089, 1089, 1089, 1089, 1089, 1090, 1090, 1090, 1090, 1090, 1091, 1091,
-        1091, 1091, 1091, 1092, 1092, 1092, 1092, 1092, 1093, 1093, 1093, 1093, 1093, 1094, 1094, 1094, 1094, 1094, 1095, 1095, 1095, 1095, 1095, 1096, 1096, 1096,
-        1096, 1096, 1097, 1097, 1097, 1097, 1097, 1098, 1098, 1098, 1098, 1098, 1099, 1099, 1099, 1099, 1099, 1100, 1100, 1100, 1100, 1100, 1100, 1101, 1101, 1101,
-        1101, 1101, 1102, 1102, 1102, 1102, 1102, 1103, 1103, 1103, 1103, 1103, 1104, 1104, 1104, 1104, 1104, 1105, 1105, 1105, 1105, 1105, 1106, 1106, 1106, 1106,
-        1106, 1107, 1107, 1107, 1107, 1107, 1108, 1108, 1108, 1108, 1108, 1108, 1109, 1109, 1109, 1109, 1109, 1110, 1110, 1110, 1110, 1110, 1111, 1111, 1111, 1111,
-        1111, 1112, 1112, 1112, 1112, 1112, 1113, 1113, 1113, 1113, 1113, 1114, 1114, 1114, 1114, 1114, 1114, 1115, 1115, 1115, 1115, 1115, 1116, 1116, 1116, 1116,
-        1116, 1117, 1117, 1117, 1117, 1117, 1118, 1118, 1118, 1118, 1118, 1119, 1119, 1119, 1119, 1119, 1119, 1120, 1120, 1120, 1120, 1120, 1121, 1121, 1121, 1121,
-        1121, 1122, 1122, 1122, 1122, 1122, 1123, 1123, 1123, 1123, 1123, 1123, 1124, 1124, 1124, 1124, 1124, 1125, 1125, 1125, 1125, 1125, 1126, 1126, 1126, 1126,
-        1126, 1127, 1127, 1127, 1127, 1127, 1127, 1128, 1128, 1128, 1128, 1128, 1129, 1129, 1129, 1129, 1129, 1130, 1130, 1130, 1130, 1130, 1130, 1131, 1131, 1131,
-        1131, 1131, 1132, 1132, 1132, 1132, 1132, 1133, 1133, 1133, 1133, 1133, 1134, 1134, 1134, 1134, 1134, 1134, 1135, 1135, 1135, 1135, 1135, 1136, 1136, 1136,
-        1136, 1136, 1136, 1137, 1137, 1137, 1137, 1137, 1138, 1138, 1138, 1138, 1138, 1139, 1139, 1139, 1139, 1139, 1139, 1140, 1140, 1140, 1140, 1140, 1141, 1141,
-        1141, 1141, 1141, 1142, 1142, 1142, 1142, 1142, 1142, 1143, 1143, 1143, 1143, 1143, 1144, 1144, 1144, 1144, 1144, 1144, 1145, 1145, 1145, 1145, 1145, 1146,
-        1146, 1146, 1146, 1146, 1147, 1147, 1147, 1147, 1147, 1147, 1148, 1148, 1148, 1148, 1148, 1149, 1149, 1149, 1149, 1149, 1149, 1150, 1150, 1150, 1150, 1150,
-        1151, 1151, 1151, 1151, 1151, 1151, 1152, 1152, 1152, 1152, 1152, 1153, 1153, 1153, 1153, 1153, 1153, 1154, 1154, 1154, 1154, 1154, 1155, 1155, 1155, 1155,
-        1155, 1155, 1156, 1156, 1156, 1156, 1156, 1157, 1157, 1157, 1157, 1157, 1157, 1158, 1158, 1158, 1158, 1158, 1159, 1159, 1159, 1159, 1159, 1159, 1160, 1160,
-        1160, 1160, 1160, 1161, 1161, 1161, 1161, 1161, 1161, 1162, 1162, 1162, 1162, 1162, 1163, 1163, 1163, 1163, 1163, 1163, 1164, 1164, 1164, 1164, 1164, 1165,
-        1165, 1165, 1165, 1165, 1165, 1166, 1166, 1166, 1166, 1166, 1166, 1167, 1167, 1167, 1167, 1167, 1168, 1168, 1168, 1168, 1168, 1168, 1169, 1169, 1169, 1169,
-        1169, 1170, 1170, 1170, 1170, 1170, 1170, 1171, 1171, 1171, 1171, 1171, 1171, 1172, 1172, 1172, 1172, 1172, 1173, 1173, 1173, 1173, 1173, 1173, 1174, 1174,
-        1174, 1174, 1174, 1174, 1175, 1175, 1175, 1175, 1175, 1176, 1176, 1176, 1176, 1176, 1176, 1177, 1177, 1177, 1177, 1177, 1178, 1178, 1178, 1178, 1178, 1178,
-        1179, 1179, 1179, 1179, 1179, 1179, 1180, 1180, 1180, 1180, 1180, 1180, 1181, 1181, 1181, 1181, 1181, 1182, 1182, 1182, 1182, 1182, 1182, 1183, 1183, 1183,
-        1183, 1183, 1183, 1184, 1184, 1184, 1184, 1184, 1185, 1185, 1185, 1185, 1185, 1185, 1186, 1186, 1186, 1186, 1186, 1186, 1187, 1187, 1187, 1187, 1187, 1187,
-        1188, 1188, 1188, 1188, 1188, 1189, 1189, 1189, 1189, 1189, 1189, 1190, 1190, 1190, 1190, 1190, 1190, 1191, 1191, 1191, 1191, 1191, 1191, 1192, 1192, 1192,
-        1192, 1192, 1193, 1193, 1193, 1193, 1193, 1193, 1194, 1194, 1194, 1194, 1194, 1194, 1195, 1195, 1195, 1195, 1195, 1195, 1196, 1196, 1196, 1196, 1196, 1196,
-        1197, 1197, 1197, 1197, 1197, 1198, 1198, 1198, 1198, 1198, 1198, 1199, 1199, 1199, 1199, 1199, 1199, 1200, 1200, 1200, 1200, 1200, 1200, 1201, 1201, 1201,
-        1201, 1201, 1201, 1202, 1202, 1202, 1202, 1202, 1202, 1203, 1203, 1203, 1203, 1203, 1204, 1204, 1204, 1204, 1204, 1204, 1205, 1205, 1205, 1205, 1205, 1205,
-        1206, 1206, 1206, 1206, 1206, 1206, 1207, 1207, 1207, 1207, 1207, 1207, 1208, 1208, 1208, 1208, 1208, 1208, 1209, 1209, 1209, 1209, 1209, 1209, 1210, 1210,
-        1210, 1210, 1210, 1210, 1211, 1211, 1211, 1211, 1211, 1211, 1212, 1212, 1212, 1212, 1212, 1212, 1213, 1213, 1213, 1213, 1213, 1213, 1214, 1214, 1214, 1214,
-        1214, 1215, 1215, 1215, 1215, 1215, 1215, 1216, 1216, 1216, 1216, 1216, 1216, 1217, 1217, 1217, 1217, 1217, 1217, 1218, 1218, 1218, 1218, 1218, 1218, 1219,
-        1219, 1219, 1219, 1219, 1219, 1220, 1220, 1220, 1220, 1220, 1220, 1221, 1221, 1221, 1221, 1221, 1221, 1222, 1222, 1222, 1222, 1222, 1222, 1223, 1223, 1223,
-        1223, 1223, 1223, 1224, 1224, 1224, 1224, 1224, 1224, 1225, 1225, 1225, 1225, 1225, 1225, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1227, 1227, 1227, 1227,
-        1227, 1227, 1228, 1228, 1228, 1228, 1228, 1228, 1229, 1229, 1229, 1229, 1229, 1229, 1230, 1230, 1230, 1230, 1230, 1230, 1231, 1231, 1231, 1231, 1231, 1231,
-        1232, 1232, 1232, 1232, 1232, 1232, 1233, 1233, 1233, 1233, 1233, 1233, 1234, 1234, 1234, 1234, 1234, 1234, 1235, 1235, 1235, 1235, 1235, 1235, 1236, 1236,
-        1236, 1236, 1236, 1236, 1237, 1237, 1237, 1237, 1237, 1237, 1237, 1238, 1238, 1238, 1238, 1238, 1238, 1239, 1239, 1239, 1239, 1239, 1239, 1240, 1240, 1240,
-        1240, 1240, 1240, 1241, 1241, 1241, 1241, 1241, 1241, 1242, 1242, 1242, 1242, 1242, 1242, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1244, 1244, 1244, 1244,
-        1244, 1244, 1245, 1245, 1245, 1245, 1245, 1245, 1246, 1246, 1246, 1246, 1246, 1246, 1247, 1247, 1247, 1247, 1247, 1247, 1248, 1248, 1248, 1248, 1248, 1248,
-        1248, 1249, 1249, 1249, 1249, 1249, 1249, 1250, 1250, 1250, 1250, 1250, 1250, 1251, 1251, 1251, 1251, 1251, 1251, 1252, 1252, 1252, 1252, 1252, 1252, 1253,
-        1253, 1253, 1253, 1253, 1253, 1253, 1254, 1254, 1254, 1254, 1254, 1254, 1255, 1255, 1255, 1255, 1255, 1255, 1256, 1256, 1256, 1256, 1256, 1256, 1256, 1257,
-        1257, 1257, 1257, 1257, 1257, 1258, 1258, 1258, 1258, 1258, 1258, 1259, 1259, 1259, 1259, 1259, 1259, 1260, 1260, 1260, 1260, 1260, 1260, 1260, 1261, 1261,
-        1261, 1261, 1261, 1261, 1262, 1262, 1262, 1262, 1262, 1262, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1264, 1264, 1264, 1264, 1264, 1264, 1265, 1265, 1265,
-        1265, 1265, 1265, 1266, 1266, 1266, 1266, 1266, 1266, 1266, 1267, 1267, 1267, 1267, 1267, 1267, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1269, 1269, 1269,
-        1269, 1269, 1269, 1270, 1270, 1270, 1270, 1270, 1270, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1272, 1272, 1272, 1272, 1272, 1272, 1273, 1273, 1273, 1273,
-        1273, 1273, 1273, 1274, 1274, 1274, 1274, 1274, 1274, 1275, 1275, 1275, 1275, 1275, 1275, 1275, 1276, 1276, 1276, 1276, 1276, 1276, 1277, 1277, 1277, 1277,
-        1277, 1277, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1279, 1279, 1279, 1279, 1279, 1279, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1281, 1281, 1281, 1281,
-        1281, 1281, 1282, 1282, 1282, 1282, 1282, 1282, 1282, 1283, 1283, 1283, 1283, 1283, 1283, 1284, 1284, 1284, 1284, 1284, 1284, 1284, 1285, 1285, 1285, 1285,
-        1285, 1285, 1286, 1286, 1286, 1286, 1286, 1286, 1286, 1287, 1287, 1287, 1287, 1287, 1287, 1288, 1288, 1288, 1288, 1288, 1288, 1288, 1289, 1289, 1289, 1289,
-        1289, 1289, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1291, 1291, 1291, 1291, 1291, 1291, 1291, 1292, 1292, 1292, 1292, 1292, 1292, 1293, 1293, 1293, 1293,
-        1293, 1293, 1293, 1294, 1294, 1294, 1294, 1294, 1294, 1295, 1295, 1295, 1295, 1295, 1295, 1295, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1297, 1297, 1297,
-        1297, 1297, 1297, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1299, 1299, 1299, 1299, 1299, 1299, 1300, 1300, 1300, 1300, 1300, 1300, 1300, 1301, 1301, 1301,
-        1301, 1301, 1301, 1301, 1302, 1302, 1302, 1302, 1302, 1302, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1304, 1304, 1304, 1304, 1304, 1304, 1304, 1305, 1305,
-        1305, 1305, 1305, 1305, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1308, 1308, 1308, 1308, 1308, 1308, 1309, 1309,
-        1309, 1309, 1309, 1309, 1309, 1310, 1310, 1310, 1310, 1310, 1310, 1310, 1311, 1311, 1311, 1311, 1311, 1311, 1311, 1312, 1312, 1312, 1312, 1312, 1312, 1313,
-        1313, 1313, 1313, 1313, 1313, 1313, 1314, 1314, 1314, 1314, 1314, 1314, 1314, 1315, 1315, 1315, 1315, 1315, 1315, 1315, 1316, 1316, 1316, 1316, 1316, 1316,
-        1317, 1317, 1317, 1317, 1317, 1317, 1317, 1318, 1318, 1318, 1318, 1318, 1318, 1318, 1319, 1319, 1319, 1319, 1319, 1319, 1319, 1320, 1320, 1320, 1320, 1320,
-        1320, 1320, 1321, 1321, 1321, 1321, 1321, 1321, 1322, 1322, 1322, 1322, 1322, 1322, 1322, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1324, 1324, 1324, 1324,
-        1324, 1324, 1324, 1325, 1325, 1325, 1325, 1325, 1325, 1325, 1326, 1326, 1326, 1326, 1326, 1326, 1326, 1327, 1327, 1327, 1327, 1327, 1327, 1328, 1328, 1328,
-        1328, 1328, 1328, 1328, 1329, 1329, 1329, 1329, 1329, 1329, 1329, 1330, 1330, 1330, 1330, 1330, 1330, 1330, 1331, 1331, 1331, 1331, 1331, 1331, 1331, 1332,
-        1332, 1332, 1332, 1332, 1332, 1332, 1333, 1333, 1333, 1333, 1333, 1333, 1333, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1335, 1335, 1335, 1335, 1335, 1335,
-        1335, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1337, 1337, 1337, 1337, 1337, 1337, 1337, 1338, 1338, 1338, 1338, 1338, 1338, 1339, 1339, 1339, 1339, 1339,
-        1339, 1339, 1340, 1340, 1340, 1340, 1340, 1340, 1340, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1342, 1342, 1342, 1342, 1342, 1342, 1342, 1343, 1343, 1343,
-        1343, 1343, 1343, 1343, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1345, 1345, 1345, 1345, 1345, 1345, 1345, 1346, 1346, 1346, 1346, 1346, 1346, 1346, 1347,
-        1347, 1347, 1347, 1347, 1347, 1347, 1348, 1348, 1348, 1348, 1348, 1348, 1348, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1350, 1350, 1350, 1350, 1350, 1350,
-        1350, 1350, 1351, 1351, 1351, 1351, 1351, 1351, 1351, 1352, 1352, 1352, 1352, 1352, 1352, 1352, 1353, 1353, 1353, 1353, 1353, 1353, 1353, 1354, 1354, 1354,
-        1354, 1354, 1354, 1354, 1355, 1355, 1355, 1355, 1355, 1355, 1355, 1356, 1356, 1356, 1356, 1356, 1356, 1356, 1357, 1357, 1357, 1357, 1357, 1357, 1357, 1358,
-        1358, 1358, 1358, 1358, 1358, 1358, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1361, 1361, 1361, 1361, 1361,
-        1361, 1361, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1363, 1363, 1363, 1363, 1363, 1363, 1363, 1364, 1364, 1364, 1364, 1364, 1364, 1364, 1365, 1365, 1365,
-        1365, 1365, 1365, 1365, 1366, 1366, 1366, 1366, 1366, 1366, 1366, 1366, 1367, 1367, 1367, 1367, 1367, 1367, 1367, 1368, 1368, 1368, 1368, 1368, 1368, 1368,
-        1369, 1369, 1369, 1369, 1369, 1369, 1369, 1370, 1370, 1370, 1370, 1370, 1370, 1370, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1372, 1372, 1372, 1372,
-        1372, 1372, 1372, 1373, 1373, 1373, 1373, 1373, 1373, 1373, 1374, 1374, 1374, 1374, 1374, 1374, 1374, 1375, 1375, 1375, 1375, 1375, 1375, 1375, 1375, 1376,
-        1376, 1376, 1376, 1376, 1376, 1376, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1379, 1379, 1379, 1379, 1379, 1379,
-        1379, 1379, 1380, 1380, 1380, 1380, 1380, 1380, 1380, 1381, 1381, 1381, 1381, 1381, 1381, 1381, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1383, 1383,
-        1383, 1383, 1383, 1383, 1383, 1384, 1384, 1384, 1384, 1384, 1384, 1384, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 1386, 1386, 1386, 1386, 1386, 1386,
-        1386, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1389, 1389, 1389, 1389, 1389, 1389, 1389, 1390, 1390, 1390,
-        1390, 1390, 1390, 1390, 1390, 1391, 1391, 1391, 1391, 1391, 1391, 1391, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1393, 1393, 1393, 1393, 1393, 1393, 1393,
-        1393, 1394, 1394, 1394, 1394, 1394, 1394, 1394, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1397, 1397, 1397,
-        1397, 1397, 1397, 1397, 1397, 1398, 1398, 1398, 1398, 1398, 1398, 1398, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1400, 1400, 1400, 1400, 1400, 1400, 1400,
-        1400, 1401, 1401, 1401, 1401, 1401, 1401, 1401, 1402, 1402, 1402, 1402, 1402, 1402, 1402, 1402, 1403, 1403, 1403, 1403, 1403, 1403, 1403, 1404, 1404, 1404,
-        1404, 1404, 1404, 1404, 1404, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1406, 1406, 1406, 1406, 1406, 1406, 1406, 1406, 1407, 1407, 1407, 1407, 1407, 1407,
-        1407, 1407, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1409, 1409, 1409, 1409, 1409, 1409, 1409, 1409, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1411, 1411,
-        1411, 1411, 1411, 1411, 1411, 1411, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1414, 1414, 1414, 1414, 1414,
-        1414, 1414, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1418,
-        1418, 1418, 1418, 1418, 1418, 1418, 1418, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1421, 1421, 1421, 1421,
-        1421, 1421, 1421, 1421, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1424, 1424, 1424, 1424, 1424, 1424, 1424,
-        1424, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1428, 1428,
-        1428, 1428, 1428, 1428, 1428, 1428, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1431, 1431, 1431, 1431, 1431,
-        1431, 1431, 1431, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434,
-        1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1438, 1438,
-        1438, 1438, 1438, 1438, 1438, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1441, 1441, 1441, 1441, 1441,
-        1441, 1441, 1441, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1444, 1444, 1444, 1444, 1444, 1444, 1444,
-        1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1448, 1448,
-        1448, 1448, 1448, 1448, 1448, 1448, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1451, 1451, 1451, 1451,
-        1451, 1451, 1451, 1451, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
-        1454, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1458,
-        1458, 1458, 1458, 1458, 1458, 1458, 1458, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1461, 1461, 1461,
-        1461, 1461, 1461, 1461, 1461, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1464, 1464, 1464, 1464, 1464,
-        1464, 1464, 1464, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-        1467, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470,
-        1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1474, 1474,
-        1474, 1474, 1474, 1474, 1474, 1474, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1477, 1477, 1477, 1477,
-        1477, 1477, 1477, 1477, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1480, 1480, 1480, 1480, 1480,
-        1480, 1480, 1480, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
-        1483, 1483, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
-        1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1490,
-        1490, 1490, 1490, 1490, 1490, 1490, 1490, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1493, 1493,
-        1493, 1493, 1493, 1493, 1493, 1493, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1496, 1496, 1496,
-        1496, 1496, 1496, 1496, 1496, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1499, 1499, 1499, 1499,
-        1499, 1499, 1499, 1499, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1502, 1502, 1502, 1502, 1502,
-        1502, 1502, 1502, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1505, 1505, 1505, 1505, 1505, 1505,
-        1505, 1505, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1508, 1508, 1508, 1508, 1508, 1508, 1508,
-        1508, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
-        1511, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514,
-        1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1517, 1517, 1517, 1517, 1517, 1517, 1517, 1517, 1517,
-        1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1519, 1519, 1519, 1519, 1519, 1519, 1519, 1519, 1519, 1520, 1520, 1520, 1520, 1520, 1520, 1520, 1520, 1521,
-        1521, 1521, 1521, 1521, 1521, 1521, 1521, 1521, 1522, 1522, 1522, 1522, 1522, 1522, 1522, 1522, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1524,
-        1524, 1524, 1524, 1524, 1524, 1524, 1524, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1526, 1526, 1526, 1526, 1526, 1526, 1526, 1526, 1527, 1527,
-        1527, 1527, 1527, 1527, 1527, 1527, 1527, 1528, 1528, 1528, 1528, 1528, 1528, 1528, 1528, 1528, 1529, 1529, 1529, 1529, 1529, 1529, 1529, 1529, 1530, 1530,
-        1530, 1530, 1530, 1530, 1530, 1530, 1530, 1531, 1531, 1531, 1531, 1531, 1531, 1531, 1531, 1532, 1532, 1532, 1532, 1532, 1532, 1532, 1532, 1532, 1533, 1533,
-        1533, 1533, 1533, 1533, 1533, 1533, 1533, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1536, 1536,
-        1536, 1536, 1536, 1536, 1536, 1536, 1536, 1537, 1537, 1537, 1537, 1537, 1537, 1537, 1537, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1539, 1539,
-        1539, 1539, 1539, 1539, 1539, 1539, 1539, 1540, 1540, 1540, 1540, 1540, 1540, 1540, 1540, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1542, 1542,
-        1542, 1542, 1542, 1542, 1542, 1542, 1542, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1544, 1544, 1544, 1544, 1544, 1544, 1544, 1544, 1545, 1545,
-        1545, 1545, 1545, 1545, 1545, 1545, 1545, 1546, 1546, 1546, 1546, 1546, 1546, 1546, 1546, 1546, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1548,
-        1548, 1548, 1548, 1548, 1548, 1548, 1548, 1549, 1549, 1549, 1549, 1549, 1549, 1549, 1549, 1549, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1551,
-        1551, 1551, 1551, 1551, 1551, 1551, 1551, 1551, 1552, 1552, 1552, 1552, 1552, 1552, 1552, 1552, 1552, 1553, 1553, 1553, 1553, 1553, 1553, 1553, 1553, 1554,
-        1554, 1554, 1554, 1554, 1554, 1554, 1554, 1554, 1555, 1555, 1555, 1555, 1555, 1555, 1555, 1555, 1555, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
-        1557, 1557, 1557, 1557, 1557, 1557, 1557, 1557, 1557, 1558, 1558, 1558, 1558, 1558, 1558, 1558, 1558, 1558, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559,
-        1559, 1560, 1560, 1560, 1560, 1560, 1560, 1560, 1560, 1560, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562,
-        1562, 1563, 1563, 1563, 1563, 1563, 1563, 1563, 1563, 1563, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1565, 1565, 1565, 1565, 1565, 1565, 1565,
-        1565, 1565, 1566, 1566, 1566, 1566, 1566, 1566, 1566, 1566, 1566, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1568, 1568, 1568, 1568, 1568, 1568,
-        1568, 1568, 1568, 1569, 1569, 1569, 1569, 1569, 1569, 1569, 1569, 1569, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 1571, 1571, 1571, 1571, 1571,
-        1571, 1571, 1571, 1571, 1572, 1572, 1572, 1572, 1572, 1572, 1572, 1572, 1572, 1573, 1573, 1573, 1573, 1573, 1573, 1573, 1573, 1573, 1574, 1574, 1574, 1574,
-        1574, 1574, 1574, 1574, 1574, 1575, 1575, 1575, 1575, 1575, 1575, 1575, 1575, 1575, 1576, 1576, 1576, 1576, 1576, 1576, 1576, 1576, 1576, 1577, 1577, 1577,
-        1577, 1577, 1577, 1577, 1577, 1577, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1580, 1580,
-        1580, 1580, 1580, 1580, 1580, 1580, 1580, 1581, 1581, 1581, 1581, 1581, 1581, 1581, 1581, 1581, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1583,
-        1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1585, 1585, 1585, 1585, 1585, 1585, 1585, 1585,
-        1585, 1586, 1586, 1586, 1586, 1586, 1586, 1586, 1586, 1586, 1587, 1587, 1587, 1587, 1587, 1587, 1587, 1587, 1587, 1588, 1588, 1588, 1588, 1588, 1588, 1588,
-        1588, 1588, 1589, 1589, 1589, 1589, 1589, 1589, 1589, 1589, 1589, 1590, 1590, 1590, 1590, 1590, 1590, 1590, 1590, 1590, 1591, 1591, 1591, 1591, 1591, 1591,
-        1591, 1591, 1591, 1591, 1592, 1592, 1592, 1592, 1592, 1592, 1592, 1592, 1592, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1594, 1594, 1594, 1594,
-        1594, 1594, 1594, 1594, 1594, 1595, 1595, 1595, 1595, 1595, 1595, 1595, 1595, 1595, 1596, 1596, 1596, 1596, 1596, 1596, 1596, 1596, 1596, 1596, 1597, 1597,
-        1597, 1597, 1597, 1597, 1597, 1597, 1597, 1598, 1598, 1598, 1598, 1598, 1598, 1598, 1598, 1598, 1599, 1599, 1599, 1599, 1599, 1599, 1599, 1599, 1599, 1600,
-        1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1601, 1601, 1601, 1601, 1601, 1601, 1601, 1601, 1601, 1602, 1602, 1602, 1602, 1602, 1602, 1602, 1602,
-        1602, 1603, 1603, 1603, 1603, 1603, 1603, 1603, 1603, 1603, 1604, 1604, 1604, 1604, 1604, 1604, 1604, 1604, 1604, 1604, 1605, 1605, 1605, 1605, 1605, 1605,
-        1605, 1605, 1605, 1606, 1606, 1606, 1606, 1606, 1606, 1606, 1606, 1606, 1607, 1607, 1607, 1607, 1607, 1607, 1607, 1607, 1607, 1607, 1608, 1608, 1608, 1608,
-        1608, 1608, 1608, 1608, 1608, 1609, 1609, 1609, 1609, 1609, 1609, 1609, 1609, 1609, 1610, 1610, 1610, 1610, 1610, 1610, 1610, 1610, 1610, 1610, 1611, 1611,
-        1611, 1611, 1611, 1611, 1611, 1611, 1611, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1613, 1613, 1613, 1613, 1613, 1613, 1613, 1613, 1613, 1613,
-        1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1615, 1615, 1615, 1615, 1615, 1615, 1615, 1615, 1615, 1616, 1616, 1616, 1616, 1616, 1616, 1616, 1616,
-        1616, 1616, 1617, 1617, 1617, 1617, 1617, 1617, 1617, 1617, 1617, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 1619, 1619, 1619, 1619, 1619,
-        1619, 1619, 1619, 1619, 1620, 1620, 1620, 1620, 1620, 1620, 1620, 1620, 1620, 1620, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1622, 1622, 1622,
-        1622, 1622, 1622, 1622, 1622, 1622, 1622, 1623, 1623, 1623, 1623, 1623, 1623, 1623, 1623, 1623, 1624, 1624, 1624, 1624, 1624, 1624, 1624, 1624, 1624, 1625,
-        1625, 1625, 1625, 1625, 1625, 1625, 1625, 1625, 1625, 1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627,
-        1627, 1627, 1628, 1628, 1628, 1628, 1628, 1628, 1628, 1628, 1628, 1629, 1629, 1629, 1629, 1629, 1629, 1629, 1629, 1629, 1629, 1630, 1630, 1630, 1630, 1630,
-        1630, 1630, 1630, 1630, 1630, 1631, 1631, 1631, 1631, 1631, 1631, 1631, 1631, 1631, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1633, 1633,
-        1633, 1633, 1633, 1633, 1633, 1633, 1633, 1634, 1634, 1634, 1634, 1634, 1634, 1634, 1634, 1634, 1634, 1635, 1635, 1635, 1635, 1635, 1635, 1635, 1635, 1635,
-        1636, 1636, 1636, 1636, 1636, 1636, 1636, 1636, 1636, 1636, 1637, 1637, 1637, 1637, 1637, 1637, 1637, 1637, 1637, 1637, 1638, 1638, 1638, 1638, 1638, 1638,
-        1638, 1638, 1638, 1639, 1639, 1639, 1639, 1639, 1639, 1639, 1639, 1639, 1639, 1640, 1640, 1640, 1640, 1640, 1640, 1640, 1640, 1640, 1641, 1641, 1641, 1641,
-        1641, 1641, 1641, 1641, 1641, 1641, 1642, 1642, 1642, 1642, 1642, 1642, 1642, 1642, 1642, 1642, 1643, 1643, 1643, 1643, 1643, 1643, 1643, 1643, 1643, 1644,
-        1644, 1644, 1644, 1644, 1644, 1644, 1644, 1644, 1644, 1645, 1645, 1645, 1645, 1645, 1645, 1645, 1645, 1645, 1645, 1646, 1646, 1646, 1646, 1646, 1646, 1646,
-        1646, 1646, 1647, 1647, 1647, 1647, 1647, 1647, 1647, 1647, 1647, 1647, 1648, 1648, 1648, 1648, 1648, 1648, 1648, 1648, 1648, 1648, 1649, 1649, 1649, 1649,
-        1649, 1649, 1649, 1649, 1649, 1650, 1650, 1650, 1650, 1650, 1650, 1650, 1650, 1650, 1650, 1651, 1651, 1651, 1651, 1651, 1651, 1651, 1651, 1651, 1651, 1652,
-        1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654,
-        1654, 1654, 1655, 1655, 1655, 1655, 1655, 1655, 1655, 1655, 1655, 1655, 1656, 1656, 1656, 1656, 1656, 1656, 1656, 1656, 1656, 1656, 1657, 1657, 1657, 1657,
-        1657, 1657, 1657, 1657, 1657, 1657, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1659, 1659, 1659, 1659, 1659, 1659, 1659, 1659, 1659, 1659, 1660,
-        1660, 1660, 1660, 1660, 1660, 1660, 1660, 1660, 1660, 1661, 1661, 1661, 1661, 1661, 1661, 1661, 1661, 1661, 1661, 1662, 1662, 1662, 1662, 1662, 1662, 1662,
-        1662, 1662, 1662, 1663, 1663, 1663, 1663, 1663, 1663, 1663, 1663, 1663, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1665, 1665, 1665, 1665,
-        1665, 1665, 1665, 1665, 1665, 1665, 1666, 1666, 1666, 1666, 1666, 1666, 1666, 1666, 1666, 1666, 1667, 1667, 1667, 1667, 1667, 1667, 1667, 1667, 1667, 1667,
-        1668, 1668, 1668, 1668, 1668, 1668, 1668, 1668, 1668, 1668, 1669, 1669, 1669, 1669, 1669, 1669, 1669, 1669, 1669, 1669, 1670, 1670, 1670, 1670, 1670, 1670,
-        1670, 1670, 1670, 1670, 1671, 1671, 1671, 1671, 1671, 1671, 1671, 1671, 1671, 1671, 1672, 1672, 1672, 1672, 1672, 1672, 1672, 1672, 1672, 1673, 1673, 1673,
-        1673, 1673, 1673, 1673, 1673, 1673, 1673, 1674, 1674, 1674, 1674, 1674, 1674, 1674, 1674, 1674, 1674, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-        1675, 1676, 1676, 1676, 1676, 1676, 1676, 1676, 1676, 1676, 1676, 1677, 1677, 1677, 1677, 1677, 1677, 1677, 1677, 1677, 1677, 1678, 1678, 1678, 1678, 1678,
-        1678, 1678, 1678, 1678, 1678, 1679, 1679, 1679, 1679, 1679, 1679, 1679, 1679, 1679, 1679, 1680, 1680, 1680, 1680, 1680, 1680, 1680, 1680, 1680, 1680, 1681,
-        1681, 1681, 1681, 1681, 1681, 1681, 1681, 1681, 1681, 1682, 1682, 1682, 1682, 1682, 1682, 1682, 1682, 1682, 1682, 1683, 1683, 1683, 1683, 1683, 1683, 1683,
-        1683, 1683, 1683, 1684, 1684, 1684, 1684, 1684, 1684, 1684, 1684, 1684, 1684, 1685, 1685, 1685, 1685, 1685, 1685, 1685, 1685, 1685, 1685, 1686, 1686, 1686,
-        1686, 1686, 1686, 1686, 1686, 1686, 1686, 1687, 1687, 1687, 1687, 1687, 1687, 1687, 1687, 1687, 1687, 1687, 1688, 1688, 1688, 1688, 1688, 1688, 1688, 1688,
-        1688, 1688, 1689, 1689, 1689, 1689, 1689, 1689, 1689, 1689, 1689, 1689, 1690, 1690, 1690, 1690, 1690, 1690, 1690, 1690, 1690, 1690, 1691, 1691, 1691, 1691,
-        1691, 1691, 1691, 1691, 1691, 1691, 1692, 1692, 1692, 1692, 1692, 1692, 1692, 1692, 1692, 1692, 1693, 1693, 1693, 1693, 1693, 1693, 1693, 1693, 1693, 1693,
-        1694, 1694, 1694, 1694, 1694, 1694, 1694, 1694, 1694, 1694, 1695, 1695, 1695, 1695, 1695, 1695, 1695, 1695, 1695, 1695, 1695, 1696, 1696, 1696, 1696, 1696,
-        1696, 1696, 1696, 1696, 1696, 1697, 1697, 1697, 1697, 1697, 1697, 1697, 1697, 1697, 1697, 1698, 1698, 1698, 1698, 1698, 1698, 1698, 1698, 1698, 1698, 1699,
-        1699, 1699, 1699, 1699, 1699, 1699, 1699, 1699, 1699, 1700, 1700, 1700, 1700, 1700, 1700, 1700, 1700, 1700, 1700, 1701, 1701, 1701, 1701, 1701, 1701, 1701,
-        1701, 1701, 1701, 1701, 1702, 1702, 1702, 1702, 1702, 1702, 1702, 1702, 1702, 1702, 1703, 1703, 1703, 1703, 1703, 1703, 1703, 1703, 1703, 1703, 1704, 1704,
-        1704, 1704, 1704, 1704, 1704, 1704, 1704, 1704, 1705, 1705, 1705, 1705, 1705, 1705, 1705, 1705, 1705, 1705, 1705, 1706, 1706, 1706, 1706, 1706, 1706, 1706,
-        1706, 1706, 1706, 1707, 1707, 1707, 1707, 1707, 1707, 1707, 1707, 1707, 1707, 1708, 1708, 1708, 1708, 1708, 1708, 1708, 1708, 1708, 1708, 1709, 1709, 1709,
-        1709, 1709, 1709, 1709, 1709, 1709, 1709, 1709, 1710, 1710, 1710, 1710, 1710, 1710, 1710, 1710, 1710, 1710, 1711, 1711, 1711, 1711, 1711, 1711, 1711, 1711,
-        1711, 1711, 1712, 1712, 1712, 1712, 1712, 1712, 1712, 1712, 1712, 1712, 1712, 1713, 1713, 1713, 1713, 1713, 1713, 1713, 1713, 1713, 1713, 1714, 1714, 1714,
-        1714, 1714, 1714, 1714, 1714, 1714, 1714, 1715, 1715, 1715, 1715, 1715, 1715, 1715, 1715, 1715, 1715, 1715, 1716, 1716, 1716, 1716, 1716, 1716, 1716, 1716,
-        1716, 1716, 1717, 1717, 1717, 1717, 1717, 1717, 1717, 1717, 1717, 1717, 1718, 1718, 1718, 1718, 1718, 1718, 1718, 1718, 1718, 1718, 1718, 1719, 1719, 1719,
-        1719, 1719, 1719, 1719, 1719, 1719, 1719, 1720, 1720, 1720, 1720, 1720, 1720, 1720, 1720, 1720, 1720, 1721, 1721, 1721, 1721, 1721, 1721, 1721, 1721, 1721,
-        1721, 1721, 1722, 1722, 1722, 1722, 1722, 1722, 1722, 1722, 1722, 1722, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1724, 1724, 1724,
-        1724, 1724, 1724, 1724, 1724, 1724, 1724, 1725, 1725, 1725, 1725, 1725, 1725, 1725, 1725, 1725, 1725, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726,
-        1726, 1726, 1727, 1727, 1727, 1727, 1727, 1727, 1727, 1727, 1727, 1727, 1728, 1728, 1728, 1728, 1728, 1728, 1728, 1728, 1728, 1728, 1728, 1729, 1729, 1729,
-        1729, 1729, 1729, 1729, 1729, 1729, 1729, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1731, 1731, 1731, 1731, 1731, 1731, 1731, 1731,
-        1731, 1731, 1732, 1732, 1732, 1732, 1732, 1732, 1732, 1732, 1732, 1732, 1732, 1733, 1733, 1733, 1733, 1733, 1733, 1733, 1733, 1733, 1733, 1734, 1734, 1734,
-        1734, 1734, 1734, 1734, 1734, 1734, 1734, 1734, 1735, 1735, 1735, 1735, 1735, 1735, 1735, 1735, 1735, 1735, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-        1736, 1736, 1736, 1737, 1737, 1737, 1737, 1737, 1737, 1737, 1737, 1737, 1737, 1738, 1738, 1738, 1738, 1738, 1738, 1738, 1738, 1738, 1738, 1738, 1739, 1739,
-        1739, 1739, 1739, 1739, 1739, 1739, 1739, 1739, 1739, 1740, 1740, 1740, 1740, 1740, 1740, 1740, 1740, 1740, 1740, 1741, 1741, 1741, 1741, 1741, 1741, 1741,
-        1741, 1741, 1741, 1741, 1742, 1742, 1742, 1742, 1742, 1742, 1742, 1742, 1742, 1742, 1743, 1743, 1743, 1743, 1743, 1743, 1743, 1743, 1743, 1743, 1743, 1744,
-        1744, 1744, 1744, 1744, 1744, 1744, 1744, 1744, 1744, 1744, 1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745, 1746, 1746, 1746, 1746, 1746, 1746,
-        1746, 1746, 1746, 1746, 1746, 1747, 1747, 1747, 1747, 1747, 1747, 1747, 1747, 1747, 1747, 1747, 1748, 1748, 1748, 1748, 1748, 1748, 1748, 1748, 1748, 1748,
-        1749, 1749, 1749, 1749, 1749, 1749, 1749, 1749, 1749, 1749, 1749, 1750, 1750, 1750, 1750, 1750, 1750, 1750, 1750, 1750, 1750, 1750, 1751, 1751, 1751, 1751,
-        1751, 1751, 1751, 1751, 1751, 1751, 1752, 1752, 1752, 1752, 1752, 1752, 1752, 1752, 1752, 1752, 1752, 1753, 1753, 1753, 1753, 1753, 1753, 1753, 1753, 1753,
-        1753, 1753, 1754, 1754, 1754, 1754, 1754, 1754, 1754, 1754, 1754, 1754, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1756, 1756, 1756,
-        1756, 1756, 1756, 1756, 1756, 1756, 1756, 1756, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1758, 1758, 1758, 1758, 1758, 1758, 1758,
-        1758, 1758, 1758, 1759, 1759, 1759, 1759, 1759, 1759, 1759, 1759, 1759, 1759, 1759, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1761,
-        1761, 1761, 1761, 1761, 1761, 1761, 1761, 1761, 1761, 1761, 1762, 1762, 1762, 1762, 1762, 1762, 1762, 1762, 1762, 1762, 1762, 1763, 1763, 1763, 1763, 1763,
-        1763, 1763, 1763, 1763, 1763, 1764, 1764, 1764, 1764, 1764, 1764, 1764, 1764, 1764, 1764, 1764, 1765, 1765, 1765, 1765, 1765, 1765, 1765, 1765, 1765, 1765,
-        1765, 1766, 1766, 1766, 1766, 1766, 1766, 1766, 1766, 1766, 1766, 1766, 1767, 1767, 1767, 1767, 1767, 1767, 1767, 1767, 1767, 1767, 1767, 1768, 1768, 1768,
-        1768, 1768, 1768, 1768, 1768, 1768, 1768, 1768, 1769, 1769, 1769, 1769, 1769, 1769, 1769, 1769, 1769, 1769, 1770, 1770, 1770, 1770, 1770, 1770, 1770, 1770,
-        1770, 1770, 1770, 1771, 1771, 1771, 1771, 1771, 1771, 1771, 1771, 1771, 1771, 1771, 1772, 1772, 1772, 1772, 1772, 1772, 1772, 1772, 1772, 1772, 1772, 1773,
-        1773, 1773, 1773, 1773, 1773, 1773, 1773, 1773, 1773, 1773, 1774, 1774, 1774, 1774, 1774, 1774, 1774, 1774, 1774, 1774, 1774, 1775, 1775, 1775, 1775, 1775,
-        1775, 1775, 1775, 1775, 1775, 1775, 1776, 1776, 1776, 1776, 1776, 1776, 1776, 1776, 1776, 1776, 1776, 1777, 1777, 1777, 1777, 1777, 1777, 1777, 1777, 1777,
-        1777, 1777, 1778, 1778, 1778, 1778, 1778, 1778, 1778, 1778, 1778, 1778, 1778, 1779, 1779, 1779, 1779, 1779, 1779, 1779, 1779, 1779, 1779, 1779, 1780, 1780,
-        1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1781, 1781, 1781, 1781, 1781, 1781, 1781, 1781, 1781, 1781, 1781, 1782, 1782, 1782, 1782, 1782, 1782,
-        1782, 1782, 1782, 1782, 1782, 1783, 1783, 1783, 1783, 1783, 1783, 1783, 1783, 1783, 1783, 1783, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
-        1784, 1785, 1785, 1785, 1785, 1785, 1785, 1785, 1785, 1785, 1785, 1785, 1786, 1786, 1786, 1786, 1786, 1786, 1786, 1786, 1786, 1786, 1786, 1787, 1787, 1787,
-        1787, 1787, 1787, 1787, 1787, 1787, 1787, 1787, 1788, 1788, 1788, 1788, 1788, 1788, 1788, 1788, 1788, 1788, 1788, 1789, 1789, 1789, 1789, 1789, 1789, 1789,
-        1789, 1789, 1789, 1789, 1790, 1790, 1790, 1790, 1790, 1790, 1790, 1790, 1790, 1790, 1790, 1791, 1791, 1791, 1791, 1791, 1791, 1791, 1791, 1791, 1791, 1791,
-        1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1793, 1793, 1793, 1793, 1793, 1793, 1793, 1793, 1793, 1793, 1793, 1794, 1794, 1794, 1794,
-        1794, 1794, 1794, 1794, 1794, 1794, 1794, 1795, 1795, 1795, 1795, 1795, 1795, 1795, 1795, 1795, 1795, 1795, 1796, 1796, 1796, 1796, 1796, 1796, 1796, 1796,
-        1796, 1796, 1796, 1796, 1797, 1797, 1797, 1797, 1797, 1797, 1797, 1797, 1797, 1797, 1797, 1798, 1798, 1798, 1798, 1798, 1798, 1798, 1798, 1798, 1798, 1798,
-        1799, 1799, 1799, 1799, 1799, 1799, 1799, 1799, 1799, 1799, 1799, 1800, 1800, 1800, 1800, 1800, 1800, 1800, 1800, 1800, 1800, 1800, 1801, 1801, 1801, 1801,
-        1801, 1801, 1801, 1801, 1801, 1801, 1801, 1802, 1802, 1802, 1802, 1802, 1802, 1802, 1802, 1802, 1802, 1802, 1802, 1803, 1803, 1803, 1803, 1803, 1803, 1803,
-        1803, 1803, 1803, 1803, 1804, 1804, 1804, 1804, 1804, 1804, 1804, 1804, 1804, 1804, 1804, 1805, 1805, 1805, 1805, 1805, 1805, 1805, 1805, 1805, 1805, 1805,
-        1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1807, 1807, 1807, 1807, 1807, 1807, 1807, 1807, 1807, 1807, 1807, 1807, 1808, 1808, 1808,
-        1808, 1808, 1808, 1808, 1808, 1808, 1808, 1808, 1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809, 1810, 1810, 1810, 1810, 1810, 1810, 1810,
-        1810, 1810, 1810, 1810, 1811, 1811, 1811, 1811, 1811, 1811, 1811, 1811, 1811, 1811, 1811, 1811, 1812, 1812, 1812, 1812, 1812, 1812, 1812, 1812, 1812, 1812,
-        1812, 1813, 1813, 1813, 1813, 1813, 1813, 1813, 1813, 1813, 1813, 1813, 1814, 1814, 1814, 1814, 1814, 1814, 1814, 1814, 1814, 1814, 1814, 1814, 1815, 1815,
-        1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1816, 1816, 1816, 1816, 1816, 1816, 1816, 1816, 1816, 1816, 1816, 1817, 1817, 1817, 1817, 1817, 1817,
-        1817, 1817, 1817, 1817, 1817, 1817, 1818, 1818, 1818, 1818, 1818, 1818, 1818, 1818, 1818, 1818, 1818, 1819, 1819, 1819, 1819, 1819, 1819, 1819, 1819, 1819,
-        1819, 1819, 1820, 1820, 1820, 1820, 1820, 1820, 1820, 1820, 1820, 1820, 1820, 1820, 1821, 1821, 1821, 1821, 1821, 1821, 1821, 1821, 1821, 1821, 1821, 1822,
-        1822, 1822, 1822, 1822, 1822, 1822, 1822, 1822, 1822, 1822, 1822, 1823, 1823, 1823, 1823, 1823, 1823, 1823, 1823, 1823, 1823, 1823, 1824, 1824, 1824, 1824,
-        1824, 1824, 1824, 1824, 1824, 1824, 1824, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1826, 1826, 1826, 1826, 1826, 1826, 1826,
-        1826, 1826, 1826, 1826, 1827, 1827, 1827, 1827, 1827, 1827, 1827, 1827, 1827, 1827, 1827, 1827, 1828, 1828, 1828, 1828, 1828, 1828, 1828, 1828, 1828, 1828,
-        1828, 1829, 1829, 1829, 1829, 1829, 1829, 1829, 1829, 1829, 1829, 1829, 1829, 1830, 1830, 1830, 1830, 1830, 1830, 1830, 1830, 1830, 1830, 1830, 1831, 1831,
-        1831, 1831, 1831, 1831, 1831, 1831, 1831, 1831, 1831, 1831, 1832, 1832, 1832, 1832, 1832, 1832, 1832, 1832, 1832, 1832, 1832, 1833, 1833, 1833, 1833, 1833,
-        1833, 1833, 1833, 1833, 1833, 1833, 1833, 1834, 1834, 1834, 1834, 1834, 1834, 1834, 1834, 1834, 1834, 1834, 1835, 1835, 1835, 1835, 1835, 1835, 1835, 1835,
-        1835, 1835, 1835, 1835, 1836, 1836, 1836, 1836, 1836, 1836, 1836, 1836, 1836, 1836, 1836, 1837, 1837, 1837, 1837, 1837, 1837, 1837, 1837, 1837, 1837, 1837,
-        1837, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1839, 1839, 1839, 1839, 1839, 1839, 1839, 1839, 1839, 1839, 1839, 1839, 1840, 1840,
-        1840, 1840, 1840, 1840, 1840, 1840, 1840, 1840, 1840, 1841, 1841, 1841, 1841, 1841, 1841, 1841, 1841, 1841, 1841, 1841, 1841, 1842, 1842, 1842, 1842, 1842,
-        1842, 1842, 1842, 1842, 1842, 1842, 1842, 1843, 1843, 1843, 1843, 1843, 1843, 1843, 1843, 1843, 1843, 1843, 1844, 1844, 1844, 1844, 1844, 1844, 1844, 1844,
-        1844, 1844, 1844, 1844, 1845, 1845, 1845, 1845, 1845, 1845, 1845, 1845, 1845, 1845, 1845, 1846, 1846, 1846, 1846, 1846, 1846, 1846, 1846, 1846, 1846, 1846,
-        1846, 1847, 1847, 1847, 1847, 1847, 1847, 1847, 1847, 1847, 1847, 1847, 1847, 1848, 1848, 1848, 1848, 1848, 1848, 1848, 1848, 1848, 1848, 1848, 1849, 1849,
-        1849, 1849, 1849, 1849, 1849, 1849, 1849, 1849, 1849, 1849, 1850, 1850, 1850, 1850, 1850, 1850, 1850, 1850, 1850, 1850, 1850, 1850, 1851, 1851, 1851, 1851,
-        1851, 1851, 1851, 1851, 1851, 1851, 1851, 1852, 1852, 1852, 1852, 1852, 1852, 1852, 1852, 1852, 1852, 1852, 1852, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
-        1853, 1853, 1853, 1853, 1853, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1855, 1855, 1855, 1855, 1855, 1855, 1855, 1855, 1855, 1855,
-        1855, 1855, 1856, 1856, 1856, 1856, 1856, 1856, 1856, 1856, 1856, 1856, 1856, 1856, 1857, 1857, 1857, 1857, 1857, 1857, 1857, 1857, 1857, 1857, 1857, 1857,
-        1858, 1858, 1858, 1858, 1858, 1858, 1858, 1858, 1858, 1858, 1858, 1859, 1859, 1859, 1859, 1859, 1859, 1859, 1859, 1859, 1859, 1859, 1859, 1860, 1860, 1860,
-        1860, 1860, 1860, 1860, 1860, 1860, 1860, 1860, 1860, 1861, 1861, 1861, 1861, 1861, 1861, 1861, 1861, 1861, 1861, 1861, 1861, 1862, 1862, 1862, 1862, 1862,
-        1862, 1862, 1862, 1862, 1862, 1862, 1862, 1863, 1863, 1863, 1863, 1863, 1863, 1863, 1863, 1863, 1863, 1863, 1864, 1864, 1864, 1864, 1864, 1864, 1864, 1864,
-        1864, 1864, 1864, 1864, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1866, 1866, 1866, 1866, 1866, 1866, 1866, 1866, 1866, 1866,
-        1866, 1866, 1867, 1867, 1867, 1867, 1867, 1867, 1867, 1867, 1867, 1867, 1867, 1867, 1868, 1868, 1868, 1868, 1868, 1868, 1868, 1868, 1868, 1868, 1868, 1868,
-        1869, 1869, 1869, 1869, 1869, 1869, 1869, 1869, 1869, 1869, 1869, 1870, 1870, 1870, 1870, 1870, 1870, 1870, 1870, 1870, 1870, 1870, 1870, 1871, 1871, 1871,
-        1871, 1871, 1871, 1871, 1871, 1871, 1871, 1871, 1871, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1873, 1873, 1873, 1873, 1873,
-        1873, 1873, 1873, 1873, 1873, 1873, 1873, 1874, 1874, 1874, 1874, 1874, 1874, 1874, 1874, 1874, 1874, 1874, 1874, 1875, 1875, 1875, 1875, 1875, 1875, 1875,
-        1875, 1875, 1875, 1875, 1875, 1876, 1876, 1876, 1876, 1876, 1876, 1876, 1876, 1876, 1876, 1876, 1876, 1877, 1877, 1877, 1877, 1877, 1877, 1877, 1877, 1877,
-        1877, 1877, 1877, 1878, 1878, 1878, 1878, 1878, 1878, 1878, 1878, 1878, 1878, 1878, 1878, 1879, 1879, 1879, 1879, 1879, 1879, 1879, 1879, 1879, 1879, 1879,
-        1879, 1880, 1880, 1880, 1880, 1880, 1880, 1880, 1880, 1880, 1880, 1880, 1880, 1881, 1881, 1881, 1881, 1881, 1881, 1881, 1881, 1881, 1881, 1881, 1881, 1882,
-        1882, 1882, 1882, 1882, 1882, 1882, 1882, 1882, 1882, 1882, 1882, 1883, 1883, 1883, 1883, 1883, 1883, 1883, 1883, 1883, 1883, 1883, 1883, 1884, 1884, 1884,
-        1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1885, 1885, 1885, 1885, 1885, 1885, 1885, 1885, 1885, 1885, 1885, 1885, 1886, 1886, 1886, 1886, 1886,
-        1886, 1886, 1886, 1886, 1886, 1886, 1886, 1887, 1887, 1887, 1887, 1887, 1887, 1887, 1887, 1887, 1887, 1887, 1887, 1888, 1888, 1888, 1888, 1888, 1888, 1888,
-        1888, 1888, 1888, 1888, 1888, 1889, 1889, 1889, 1889, 1889, 1889, 1889, 1889, 1889, 1889, 1889, 1889, 1890, 1890, 1890, 1890, 1890, 1890, 1890, 1890, 1890,
-        1890, 1890, 1890, 1891, 1891, 1891, 1891, 1891, 1891, 1891, 1891, 1891, 1891, 1891, 1891, 1892, 1892, 1892, 1892, 1892, 1892, 1892, 1892, 1892, 1892, 1892,
-        1892, 1893, 1893, 1893, 1893, 1893, 1893, 1893, 1893, 1893, 1893, 1893, 1893, 1894, 1894, 1894, 1894, 1894, 1894, 1894, 1894, 1894, 1894, 1894, 1894, 1895,
-        1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1896, 1896, 1896, 1896, 1896, 1896, 1896, 1896, 1896, 1896, 1896, 1896, 1897, 1897,
-        1897, 1897, 1897, 1897, 1897, 1897, 1897, 1897, 1897, 1897, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1898, 1899, 1899, 1899, 1899,
-        1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1900, 1900, 1900, 1900, 1900, 1900, 1900, 1900, 1900, 1900, 1900, 1900, 1901, 1901, 1901, 1901, 1901, 1901,
-        1901, 1901, 1901, 1901, 1901, 1901, 1901, 1902, 1902, 1902, 1902, 1902, 1902, 1902, 1902, 1902, 1902, 1902, 1902, 1903, 1903, 1903, 1903, 1903, 1903, 1903,
-        1903, 1903, 1903, 1903, 1903, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1905, 1905, 1905, 1905, 1905, 1905, 1905, 1905, 1905,
-        1905, 1905, 1905, 1906, 1906, 1906, 1906, 1906, 1906, 1906, 1906, 1906, 1906, 1906, 1906, 1906, 1907, 1907, 1907, 1907, 1907, 1907, 1907, 1907, 1907, 1907,
-        1907, 1907, 1908, 1908, 1908, 1908, 1908, 1908, 1908, 1908, 1908, 1908, 1908, 1908, 1909, 1909, 1909, 1909, 1909, 1909, 1909, 1909, 1909, 1909, 1909, 1909,
-        1910, 1910, 1910, 1910, 1910, 1910, 1910, 1910, 1910, 1910, 1910, 1910, 1910, 1911, 1911, 1911, 1911, 1911, 1911, 1911, 1911, 1911, 1911, 1911, 1911, 1912,
-        1912, 1912, 1912, 1912, 1912, 1912, 1912, 1912, 1912, 1912, 1912, 1913, 1913, 1913, 1913, 1913, 1913, 1913, 1913, 1913, 1913, 1913, 1913, 1913, 1914, 1914,
-        1914, 1914, 1914, 1914, 1914, 1914, 1914, 1914, 1914, 1914, 1915, 1915, 1915, 1915, 1915, 1915, 1915, 1915, 1915, 1915, 1915, 1915, 1916, 1916, 1916, 1916,
-        1916, 1916, 1916, 1916, 1916, 1916, 1916, 1916, 1916, 1917, 1917, 1917, 1917, 1917, 1917, 1917, 1917, 1917, 1917, 1917, 1917, 1918, 1918, 1918, 1918, 1918,
-        1918, 1918, 1918, 1918, 1918, 1918, 1918, 1919, 1919, 1919, 1919, 1919, 1919, 1919, 1919, 1919, 1919, 1919, 1919, 1919, 1920, 1920, 1920, 1920, 1920, 1920,
-        1920, 1920, 1920, 1920, 1920, 1920, 1921, 1921, 1921, 1921, 1921, 1921, 1921, 1921, 1921, 1921, 1921, 1921, 1921, 1922, 1922, 1922, 1922, 1922, 1922, 1922,
-        1922, 1922, 1922, 1922, 1922, 1923, 1923, 1923, 1923, 1923, 1923, 1923, 1923, 1923, 1923, 1923, 1923, 1924, 1924, 1924, 1924, 1924, 1924, 1924, 1924, 1924,
-        1924, 1924, 1924, 1924, 1925, 1925, 1925, 1925, 1925, 1925, 1925, 1925, 1925, 1925, 1925, 1925, 1926, 1926, 1926, 1926, 1926, 1926, 1926, 1926, 1926, 1926,
-        1926, 1926, 1926, 1927, 1927, 1927, 1927, 1927, 1927, 1927, 1927, 1927, 1927, 1927, 1927, 1928, 1928, 1928, 1928, 1928, 1928, 1928, 1928, 1928, 1928, 1928,
-        1928, 1928, 1929, 1929, 1929, 1929, 1929, 1929, 1929, 1929, 1929, 1929, 1929, 1929, 1930, 1930, 1930, 1930, 1930, 1930, 1930, 1930, 1930, 1930, 1930, 1930,
-        1930, 1931, 1931, 1931, 1931, 1931, 1931, 1931, 1931, 1931, 1931, 1931, 1931, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
-        1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1934, 1934, 1934, 1934, 1934, 1934, 1934, 1934, 1934, 1934, 1934, 1934, 1934, 1935,
-        1935, 1935, 1935, 1935, 1935, 1935, 1935, 1935, 1935, 1935, 1935, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1937, 1937,
-        1937, 1937, 1937, 1937, 1937, 1937, 1937, 1937, 1937, 1937, 1938, 1938, 1938, 1938, 1938, 1938, 1938, 1938, 1938, 1938, 1938, 1938, 1938, 1939, 1939, 1939,
-        1939, 1939, 1939, 1939, 1939, 1939, 1939, 1939, 1939, 1939, 1940, 1940, 1940, 1940, 1940, 1940, 1940, 1940, 1940, 1940, 1940, 1940, 1941, 1941, 1941, 1941,
-        1941, 1941, 1941, 1941, 1941, 1941, 1941, 1941, 1941, 1942, 1942, 1942, 1942, 1942, 1942, 1942, 1942, 1942, 1942, 1942, 1942, 1943, 1943, 1943, 1943, 1943,
-        1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1944, 1944, 1944, 1944, 1944, 1944, 1944, 1944, 1944, 1944, 1944, 1944, 1944, 1945, 1945, 1945, 1945, 1945,
-        1945, 1945, 1945, 1945, 1945, 1945, 1945, 1946, 1946, 1946, 1946, 1946, 1946, 1946, 1946, 1946, 1946, 1946, 1946, 1946, 1947, 1947, 1947, 1947, 1947, 1947,
-        1947, 1947, 1947, 1947, 1947, 1947, 1947, 1948, 1948, 1948, 1948, 1948, 1948, 1948, 1948, 1948, 1948, 1948, 1948, 1949, 1949, 1949, 1949, 1949, 1949, 1949,
-        1949, 1949, 1949, 1949, 1949, 1949, 1950, 1950, 1950, 1950, 1950, 1950, 1950, 1950, 1950, 1950, 1950, 1950, 1950, 1951, 1951, 1951, 1951, 1951, 1951, 1951,
-        1951, 1951, 1951, 1951, 1951, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1953, 1953, 1953, 1953, 1953, 1953, 1953, 1953,
-        1953, 1953, 1953, 1953, 1953, 1954, 1954, 1954, 1954, 1954, 1954, 1954, 1954, 1954, 1954, 1954, 1954, 1954, 1955, 1955, 1955, 1955, 1955, 1955, 1955, 1955,
-        1955, 1955, 1955, 1955, 1956, 1956, 1956, 1956, 1956, 1956, 1956, 1956, 1956, 1956, 1956, 1956, 1956, 1957, 1957, 1957, 1957, 1957, 1957, 1957, 1957, 1957,
-        1957, 1957, 1957, 1957, 1958, 1958, 1958, 1958, 1958, 1958, 1958, 1958, 1958, 1958, 1958, 1958, 1958, 1959, 1959, 1959, 1959, 1959, 1959, 1959, 1959, 1959,
-        1959, 1959, 1959, 1960, 1960, 1960, 1960, 1960, 1960, 1960, 1960, 1960, 1960, 1960, 1960, 1960, 1961, 1961, 1961, 1961, 1961, 1961, 1961, 1961, 1961, 1961,
-        1961, 1961, 1961, 1962, 1962, 1962, 1962, 1962, 1962, 1962, 1962, 1962, 1962, 1962, 1962, 1962, 1963, 1963, 1963, 1963, 1963, 1963, 1963, 1963, 1963, 1963,
-        1963, 1963, 1963, 1964, 1964, 1964, 1964, 1964, 1964, 1964, 1964, 1964, 1964, 1964, 1964, 1964, 1965, 1965, 1965, 1965, 1965, 1965, 1965, 1965, 1965, 1965,
-        1965, 1965, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1967, 1967, 1967, 1967, 1967, 1967, 1967, 1967, 1967, 1967, 1967,
-        1967, 1967, 1968, 1968, 1968, 1968, 1968, 1968, 1968, 1968, 1968, 1968, 1968, 1968, 1968, 1969, 1969, 1969, 1969, 1969, 1969, 1969, 1969, 1969, 1969, 1969,
-        1969, 1969, 1970, 1970, 1970, 1970, 1970, 1970, 1970, 1970, 1970, 1970, 1970, 1970, 1970, 1971, 1971, 1971, 1971, 1971, 1971, 1971, 1971, 1971, 1971, 1971,
-        1971, 1971, 1972, 1972, 1972, 1972, 1972, 1972, 1972, 1972, 1972, 1972, 1972, 1972, 1972, 1973, 1973, 1973, 1973, 1973, 1973, 1973, 1973, 1973, 1973, 1973,
-        1973, 1973, 1974, 1974, 1974, 1974, 1974, 1974, 1974, 1974, 1974, 1974, 1974, 1974, 1974, 1975, 1975, 1975, 1975, 1975, 1975, 1975, 1975, 1975, 1975, 1975,
-        1975, 1975, 1976, 1976, 1976, 1976, 1976, 1976, 1976, 1976, 1976, 1976, 1976, 1976, 1976, 1977, 1977, 1977, 1977, 1977, 1977, 1977, 1977, 1977, 1977, 1977,
-        1977, 1977, 1978, 1978, 1978, 1978, 1978, 1978, 1978, 1978, 1978, 1978, 1978, 1978, 1978, 1979, 1979, 1979, 1979, 1979, 1979, 1979, 1979, 1979, 1979, 1979,
-        1979, 1979, 1980, 1980, 1980, 1980, 1980, 1980, 1980, 1980, 1980, 1980, 1980, 1980, 1980, 1981, 1981, 1981, 1981, 1981, 1981, 1981, 1981, 1981, 1981, 1981,
-        1981, 1981, 1982, 1982, 1982, 1982, 1982, 1982, 1982, 1982, 1982, 1982, 1982, 1982, 1982, 1983, 1983, 1983, 1983, 1983, 1983, 1983, 1983, 1983, 1983, 1983,
-        1983, 1983, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1985, 1985, 1985, 1985, 1985, 1985, 1985, 1985, 1985, 1985, 1985,
-        1985, 1985, 1986, 1986, 1986, 1986, 1986, 1986, 1986, 1986, 1986, 1986, 1986, 1986, 1986, 1987, 1987, 1987, 1987, 1987, 1987, 1987, 1987, 1987, 1987, 1987,
-        1987, 1987, 1988, 1988, 1988, 1988, 1988, 1988, 1988, 1988, 1988, 1988, 1988, 1988, 1988, 1989, 1989, 1989, 1989, 1989, 1989, 1989, 1989, 1989, 1989, 1989,
-        1989, 1989, 1990, 1990, 1990, 1990, 1990, 1990, 1990, 1990, 1990, 1990, 1990, 1990, 1990, 1991, 1991, 1991, 1991, 1991, 1991, 1991, 1991, 1991, 1991, 1991,
-        1991, 1991, 1992, 1992, 1992, 1992, 1992, 1992, 1992, 1992, 1992, 1992, 1992, 1992, 1992, 1992, 1993, 1993, 1993, 1993, 1993, 1993, 1993, 1993, 1993, 1993,
-        1993, 1993, 1993, 1994, 1994, 1994, 1994, 1994, 1994, 1994, 1994, 1994, 1994, 1994, 1994, 1994, 1995, 1995, 1995, 1995, 1995, 1995, 1995, 1995, 1995, 1995,
-        1995, 1995, 1995, 1996, 1996, 1996, 1996, 1996, 1996, 1996, 1996, 1996, 1996, 1996, 1996, 1996, 1997, 1997, 1997, 1997, 1997, 1997, 1997, 1997, 1997, 1997,
-        1997, 1997, 1997, 1998, 1998, 1998, 1998, 1998, 1998, 1998, 1998, 1998, 1998, 1998, 1998, 1998, 1998, 1999, 1999, 1999, 1999, 1999, 1999, 1999, 1999, 1999,
-        1999, 1999, 1999, 1999, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2001, 2001, 2001, 2001, 2001, 2001, 2001, 2001, 2001,
-        2001, 2001, 2001, 2001, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2003, 2003, 2003, 2003, 2003, 2003, 2003, 2003,
-        2003, 2003, 2003, 2003, 2003, 2004, 2004, 2004, 2004, 2004, 2004, 2004, 2004, 2004, 2004, 2004, 2004, 2004, 2005, 2005, 2005, 2005, 2005, 2005, 2005, 2005,
-        2005, 2005, 2005, 2005, 2005, 2006, 2006, 2006, 2006, 2006, 2006, 2006, 2006, 2006, 2006, 2006, 2006, 2006, 2006, 2007, 2007, 2007, 2007, 2007, 2007, 2007,
-        2007, 2007, 2007, 2007, 2007, 2007, 2008, 2008, 2008, 2008, 2008, 2008, 2008, 2008, 2008, 2008, 2008, 2008, 2008, 2009, 2009, 2009, 2009, 2009, 2009, 2009,
-        2009, 2009, 2009, 2009, 2009, 2009, 2009, 2010, 2010, 2010, 2010, 2010, 2010, 2010, 2010, 2010, 2010, 2010, 2010, 2010, 2011, 2011, 2011, 2011, 2011, 2011,
-        2011, 2011, 2011, 2011, 2011, 2011, 2011, 2012, 2012, 2012, 2012, 2012, 2012, 2012, 2012, 2012, 2012, 2012, 2012, 2012, 2012, 2013, 2013, 2013, 2013, 2013,
-        2013, 2013, 2013, 2013, 2013, 2013, 2013, 2013, 2014, 2014, 2014, 2014, 2014, 2014, 2014, 2014, 2014, 2014, 2014, 2014, 2014, 2015, 2015, 2015, 2015, 2015,
-        2015, 2015, 2015, 2015, 2015, 2015, 2015, 2015, 2015, 2016, 2016, 2016, 2016, 2016, 2016, 2016, 2016, 2016, 2016, 2016, 2016, 2016, 2017, 2017, 2017, 2017,
-        2017, 2017, 2017, 2017, 2017, 2017, 2017, 2017, 2017, 2018, 2018, 2018, 2018, 2018, 2018, 2018, 2018, 2018, 2018, 2018, 2018, 2018, 2018, 2019, 2019, 2019,
-        2019, 2019, 2019, 2019, 2019, 2019, 2019, 2019, 2019, 2019, 2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020, 2021, 2021,
-        2021, 2021, 2021, 2021, 2021, 2021, 2021, 2021, 2021, 2021, 2021, 2022, 2022, 2022, 2022, 2022, 2022, 2022, 2022, 2022, 2022, 2022, 2022, 2022, 2022, 2023,
-        2023, 2023, 2023, 2023, 2023, 2023, 2023, 2023, 2023, 2023, 2023, 2023, 2024, 2024, 2024, 2024, 2024, 2024, 2024, 2024, 2024, 2024, 2024, 2024, 2024, 2024,
-        2025, 2025, 2025, 2025, 2025, 2025, 2025, 2025, 2025, 2025, 2025, 2025, 2025, 2026, 2026, 2026, 2026, 2026, 2026, 2026, 2026, 2026, 2026, 2026, 2026, 2026,
-        2026, 2027, 2027, 2027, 2027, 2027, 2027, 2027, 2027, 2027, 2027, 2027, 2027, 2027, 2028, 2028, 2028, 2028, 2028, 2028, 2028, 2028, 2028, 2028, 2028, 2028,
-        2028, 2028, 2029, 2029, 2029, 2029, 2029, 2029, 2029, 2029, 2029, 2029, 2029, 2029, 2029, 2030, 2030, 2030, 2030, 2030, 2030, 2030, 2030, 2030, 2030, 2030,
-        2030, 2030, 2030, 2031, 2031, 2031, 2031, 2031, 2031, 2031, 2031, 2031, 2031, 2031, 2031, 2031, 2032, 2032, 2032, 2032, 2032, 2032, 2032, 2032, 2032, 2032,
-        2032, 2032, 2032, 2032, 2033, 2033, 2033, 2033, 2033, 2033, 2033, 2033, 2033, 2033, 2033, 2033, 2033, 2034, 2034, 2034, 2034, 2034, 2034, 2034, 2034, 2034,
-        2034, 2034, 2034, 2034, 2034, 2035, 2035, 2035, 2035, 2035, 2035, 2035, 2035, 2035, 2035, 2035, 2035, 2035, 2035, 2036, 2036, 2036, 2036, 2036, 2036, 2036,
-        2036, 2036, 2036, 2036, 2036, 2036, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2038, 2038, 2038, 2038, 2038, 2038,
-        2038, 2038, 2038, 2038, 2038, 2038, 2038, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2040, 2040, 2040, 2040, 2040,
-        2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2042, 2042, 2042, 2042,
-        2042, 2042, 2042, 2042, 2042, 2042, 2042, 2042, 2042, 2042, 2043, 2043, 2043, 2043, 2043, 2043, 2043, 2043, 2043, 2043, 2043, 2043, 2043, 2043, 2044, 2044,
-        2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2045, 2045, 2045, 2045, 2045, 2045, 2045, 2045, 2045, 2045, 2045, 2045, 2045, 2045, 2046,
-        2046, 2046, 2046, 2046, 2046, 2046, 2046, 2046, 2046, 2046, 2046, 2046, 2046, 2047, 2047, 2047, 2047, 2047, 2047, 2047, 2047, 2047, 2047, 2047, 2047, 2047,
-        2047, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049,
-        2049, 2049, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2051, 2051, 2051, 2051, 2051, 2051, 2051, 2051, 2051, 2051,
-        2051, 2051, 2051, 2051, 2052, 2052, 2052, 2052, 2052, 2052, 2052, 2052, 2052, 2052, 2052, 2052, 2052, 2053, 2053, 2053, 2053, 2053, 2053, 2053, 2053, 2053,
-        2053, 2053, 2053, 2053, 2053, 2054, 2054, 2054, 2054, 2054, 2054, 2054, 2054, 2054, 2054, 2054, 2054, 2054, 2054, 2055, 2055, 2055, 2055, 2055, 2055, 2055,
-        2055, 2055, 2055, 2055, 2055, 2055, 2055, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2057, 2057, 2057, 2057, 2057,
-        2057, 2057, 2057, 2057, 2057, 2057, 2057, 2057, 2058, 2058, 2058, 2058, 2058, 2058, 2058, 2058, 2058, 2058, 2058, 2058, 2058, 2058, 2059, 2059, 2059, 2059,
-        2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060, 2061, 2061,
-        2061, 2061, 2061, 2061, 2061, 2061, 2061, 2061, 2061, 2061, 2061, 2061, 2062, 2062, 2062, 2062, 2062, 2062, 2062, 2062, 2062, 2062, 2062, 2062, 2062, 2062,
-        2063, 2063, 2063, 2063, 2063, 2063, 2063, 2063, 2063, 2063, 2063, 2063, 2063, 2063, 2064, 2064, 2064, 2064, 2064, 2064, 2064, 2064, 2064, 2064, 2064, 2064,
-        2064, 2064, 2065, 2065, 2065, 2065, 2065, 2065, 2065, 2065, 2065, 2065, 2065, 2065, 2065, 2065, 2066, 2066, 2066, 2066, 2066, 2066, 2066, 2066, 2066, 2066,
-        2066, 2066, 2066, 2067, 2067, 2067, 2067, 2067, 2067, 2067, 2067, 2067, 2067, 2067, 2067, 2067, 2067, 2068, 2068, 2068, 2068, 2068, 2068, 2068, 2068, 2068,
-        2068, 2068, 2068, 2068, 2068, 2069, 2069, 2069, 2069, 2069, 2069, 2069, 2069, 2069, 2069, 2069, 2069, 2069, 2069, 2070, 2070, 2070, 2070, 2070, 2070, 2070,
-        2070, 2070, 2070, 2070, 2070, 2070, 2070, 2071, 2071, 2071, 2071, 2071, 2071, 2071, 2071, 2071, 2071, 2071, 2071, 2071, 2071, 2072, 2072, 2072, 2072, 2072,
-        2072, 2072, 2072, 2072, 2072, 2072, 2072, 2072, 2072, 2073, 2073, 2073, 2073, 2073, 2073, 2073, 2073, 2073, 2073, 2073, 2073, 2073, 2073, 2074, 2074, 2074,
-        2074, 2074, 2074, 2074, 2074, 2074, 2074, 2074, 2074, 2074, 2074, 2075, 2075, 2075, 2075, 2075, 2075, 2075, 2075, 2075, 2075, 2075, 2075, 2075, 2075, 2076,
-        2076, 2076, 2076, 2076, 2076, 2076, 2076, 2076, 2076, 2076, 2076, 2076, 2076, 2077, 2077, 2077, 2077, 2077, 2077, 2077, 2077, 2077, 2077, 2077, 2077, 2077,
-        2077, 2078, 2078, 2078, 2078, 2078, 2078, 2078, 2078, 2078, 2078, 2078, 2078, 2078, 2078, 2079, 2079, 2079, 2079, 2079, 2079, 2079, 2079, 2079, 2079, 2079,
-        2079, 2079, 2079, 2079, 2080, 2080, 2080, 2080, 2080, 2080, 2080, 2080, 2080, 2080, 2080, 2080, 2080, 2080, 2081, 2081, 2081, 2081, 2081, 2081, 2081, 2081,
-        2081, 2081, 2081, 2081, 2081, 2081, 2082, 2082, 2082, 2082, 2082, 2082, 2082, 2082, 2082, 2082, 2082, 2082, 2082, 2082, 2083, 2083, 2083, 2083, 2083, 2083,
-        2083, 2083, 2083, 2083, 2083, 2083, 2083, 2083, 2084, 2084, 2084, 2084, 2084, 2084, 2084, 2084, 2084, 2084, 2084, 2084, 2084, 2084, 2085, 2085, 2085, 2085,
-        2085, 2085, 2085, 2085, 2085, 2085, 2085, 2085, 2085, 2085, 2086, 2086, 2086, 2086, 2086, 2086, 2086, 2086, 2086, 2086, 2086, 2086, 2086, 2086, 2087, 2087,
-        2087, 2087, 2087, 2087, 2087, 2087, 2087, 2087, 2087, 2087, 2087, 2087, 2088, 2088, 2088, 2088, 2088, 2088, 2088, 2088, 2088, 2088, 2088, 2088, 2088, 2088,
-        2088, 2089, 2089, 2089, 2089, 2089, 2089, 2089, 2089, 2089, 2089, 2089, 2089, 2089, 2089, 2090, 2090, 2090, 2090, 2090, 2090, 2090, 2090, 2090, 2090, 2090,
-        2090, 2090, 2090, 2091, 2091, 2091, 2091, 2091, 2091, 2091, 2091, 2091, 2091, 2091, 2091, 2091, 2091, 2092, 2092, 2092, 2092, 2092, 2092, 2092, 2092, 2092,
-        2092, 2092, 2092, 2092, 2092, 2093, 2093, 2093, 2093, 2093, 2093, 2093, 2093, 2093, 2093, 2093, 2093, 2093, 2093, 2093, 2094, 2094, 2094, 2094, 2094, 2094,
-        2094, 2094, 2094, 2094, 2094, 2094, 2094, 2094, 2095, 2095, 2095, 2095, 2095, 2095, 2095, 2095, 2095, 2095, 2095, 2095, 2095, 2095, 2096, 2096, 2096, 2096,
-        2096, 2096, 2096, 2096, 2096, 2096, 2096, 2096, 2096, 2096, 2097, 2097, 2097, 2097, 2097, 2097, 2097, 2097, 2097, 2097, 2097, 2097, 2097, 2097, 2097, 2098,
-        2098, 2098, 2098, 2098, 2098, 2098, 2098, 2098, 2098, 2098, 2098, 2098, 2098, 2099, 2099, 2099, 2099, 2099, 2099, 2099, 2099, 2099, 2099, 2099, 2099, 2099,
-        2099, 2100, 2100, 2100, 2100, 2100, 2100, 2100, 2100, 2100, 2100, 2100, 2100, 2100, 2100, 2100, 2101, 2101, 2101, 2101, 2101, 2101, 2101, 2101, 2101, 2101,
-        2101, 2101, 2101, 2101, 2102, 2102, 2102, 2102, 2102, 2102, 2102, 2102, 2102, 2102, 2102, 2102, 2102, 2102, 2103, 2103, 2103, 2103, 2103, 2103, 2103, 2103,
-        2103, 2103, 2103, 2103, 2103, 2103, 2104, 2104, 2104, 2104, 2104, 2104, 2104, 2104, 2104, 2104, 2104, 2104, 2104, 2104, 2104, 2105, 2105, 2105, 2105, 2105,
-        2105, 2105, 2105, 2105, 2105, 2105, 2105, 2105, 2105, 2106, 2106, 2106, 2106, 2106, 2106, 2106, 2106, 2106, 2106, 2106, 2106, 2106, 2106, 2106, 2107, 2107,
-        2107, 2107, 2107, 2107, 2107, 2107, 2107, 2107, 2107, 2107, 2107, 2107, 2108, 2108, 2108, 2108, 2108, 2108, 2108, 2108, 2108, 2108, 2108, 2108, 2108, 2108,
-        2109, 2109, 2109, 2109, 2109, 2109, 2109, 2109, 2109, 2109, 2109, 2109, 2109, 2109, 2109, 2110, 2110, 2110, 2110, 2110, 2110, 2110, 2110, 2110, 2110, 2110,
-        2110, 2110, 2110, 2111, 2111, 2111, 2111, 2111, 2111, 2111, 2111, 2111, 2111, 2111, 2111, 2111, 2111, 2111, 2112, 2112, 2112, 2112, 2112, 2112, 2112, 2112,
-        2112, 2112, 2112, 2112, 2112, 2112, 2113, 2113, 2113, 2113, 2113, 2113, 2113, 2113, 2113, 2113, 2113, 2113, 2113, 2113, 2114, 2114, 2114, 2114, 2114, 2114,
-        2114, 2114, 2114, 2114, 2114, 2114, 2114, 2114, 2114, 2115, 2115, 2115, 2115, 2115, 2115, 2115, 2115, 2115, 2115, 2115, 2115, 2115, 2115, 2116, 2116, 2116,
-        2116, 2116, 2116, 2116, 2116, 2116, 2116, 2116, 2116, 2116, 2116, 2116, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117,
-        2118, 2118, 2118, 2118, 2118, 2118, 2118, 2118, 2118, 2118, 2118, 2118, 2118, 2118, 2118, 2119, 2119, 2119, 2119, 2119, 2119, 2119, 2119, 2119, 2119, 2119,
-        2119, 2119, 2119, 2120, 2120, 2120, 2120, 2120, 2120, 2120, 2120, 2120, 2120, 2120, 2120, 2120, 2120, 2120, 2121, 2121, 2121, 2121, 2121, 2121, 2121, 2121,
-        2121, 2121, 2121, 2121, 2121, 2121, 2122, 2122, 2122, 2122, 2122, 2122, 2122, 2122, 2122, 2122, 2122, 2122, 2122, 2122, 2122, 2123, 2123, 2123, 2123, 2123,
-        2123, 2123, 2123, 2123, 2123, 2123, 2123, 2123, 2123, 2124, 2124, 2124, 2124, 2124, 2124, 2124, 2124, 2124, 2124, 2124, 2124, 2124, 2124, 2124, 2125, 2125,
-        2125, 2125, 2125, 2125, 2125, 2125, 2125, 2125, 2125, 2125, 2125, 2125, 2125, 2126, 2126, 2126, 2126, 2126, 2126, 2126, 2126, 2126, 2126, 2126, 2126, 2126,
-        2126, 2127, 2127, 2127, 2127, 2127, 2127, 2127, 2127, 2127, 2127, 2127, 2127, 2127, 2127, 2127, 2128, 2128, 2128, 2128, 2128, 2128, 2128, 2128, 2128, 2128,
-        2128, 2128, 2128, 2128, 2129, 2129, 2129, 2129, 2129, 2129, 2129, 2129, 2129, 2129, 2129, 2129, 2129, 2129, 2129, 2130, 2130, 2130, 2130, 2130, 2130, 2130,
-        2130, 2130, 2130, 2130, 2130, 2130, 2130, 2130, 2131, 2131, 2131, 2131, 2131, 2131, 2131, 2131, 2131, 2131, 2131, 2131, 2131, 2131, 2132, 2132, 2132, 2132,
-        2132, 2132, 2132, 2132, 2132, 2132, 2132, 2132, 2132, 2132, 2132, 2133, 2133, 2133, 2133, 2133, 2133, 2133, 2133, 2133, 2133, 2133, 2133, 2133, 2133, 2133,
-        2134, 2134, 2134, 2134, 2134, 2134, 2134, 2134, 2134, 2134, 2134, 2134, 2134, 2134, 2135, 2135, 2135, 2135, 2135, 2135, 2135, 2135, 2135, 2135, 2135, 2135,
-        2135, 2135, 2135, 2136, 2136, 2136, 2136, 2136, 2136, 2136, 2136, 2136, 2136, 2136, 2136, 2136, 2136, 2136, 2137, 2137, 2137, 2137, 2137, 2137, 2137, 2137,
-        2137, 2137, 2137, 2137, 2137, 2137, 2138, 2138, 2138, 2138, 2138, 2138, 2138, 2138, 2138, 2138, 2138, 2138, 2138, 2138, 2138, 2139, 2139, 2139, 2139, 2139,
-        2139, 2139, 2139, 2139, 2139, 2139, 2139, 2139, 2139, 2139, 2140, 2140, 2140, 2140, 2140, 2140, 2140, 2140, 2140, 2140, 2140, 2140, 2140, 2140, 2141, 2141,
-        2141, 2141, 2141, 2141, 2141, 2141, 2141, 2141, 2141, 2141, 2141, 2141, 2141, 2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142,
-        2142, 2142, 2143, 2143, 2143, 2143, 2143, 2143, 2143, 2143, 2143, 2143, 2143, 2143, 2143, 2143, 2143, 2144, 2144, 2144, 2144, 2144, 2144, 2144, 2144, 2144,
-        2144, 2144, 2144, 2144, 2144, 2145, 2145, 2145, 2145, 2145, 2145, 2145, 2145, 2145, 2145, 2145, 2145, 2145, 2145, 2145, 2146, 2146, 2146, 2146, 2146, 2146,
-        2146, 2146, 2146, 2146, 2146, 2146, 2146, 2146, 2146, 2147, 2147, 2147, 2147, 2147, 2147, 2147, 2147, 2147, 2147, 2147, 2147, 2147, 2147, 2147, 2148, 2148,
-        2148, 2148, 2148, 2148, 2148, 2148, 2148, 2148, 2148, 2148, 2148, 2148, 2148, 2149, 2149, 2149, 2149, 2149, 2149, 2149, 2149, 2149, 2149, 2149, 2149, 2149,
-        2149, 2149, 2150, 2150, 2150, 2150, 2150, 2150, 2150, 2150, 2150, 2150, 2150, 2150, 2150, 2150, 2151, 2151, 2151, 2151, 2151, 2151, 2151, 2151, 2151, 2151,
-        2151, 2151, 2151, 2151, 2151, 2152, 2152, 2152, 2152, 2152, 2152, 2152, 2152, 2152, 2152, 2152, 2152, 2152, 2152, 2152, 2153, 2153, 2153, 2153, 2153, 2153,
-        2153, 2153, 2153, 2153, 2153, 2153, 2153, 2153, 2153, 2154, 2154, 2154, 2154, 2154, 2154, 2154, 2154, 2154, 2154, 2154, 2154, 2154, 2154, 2154, 2155, 2155,
-        2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2156, 2156, 2156, 2156, 2156, 2156, 2156, 2156, 2156, 2156, 2156, 2156, 2156,
-        2156, 2156, 2157, 2157, 2157, 2157, 2157, 2157, 2157, 2157, 2157, 2157, 2157, 2157, 2157, 2157, 2157, 2158, 2158, 2158, 2158, 2158, 2158, 2158, 2158, 2158,
-        2158, 2158, 2158, 2158, 2158, 2158, 2159, 2159, 2159, 2159, 2159, 2159, 2159, 2159, 2159, 2159, 2159, 2159, 2159, 2159, 2159, 2160, 2160, 2160, 2160, 2160,
-        2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2161, 2161, 2161, 2161, 2161, 2161, 2161, 2161, 2161, 2161, 2161, 2161, 2161, 2161, 2161, 2162, 2162,
-        2162, 2162, 2162, 2162, 2162, 2162, 2162, 2162, 2162, 2162, 2162, 2162, 2162, 2163, 2163, 2163, 2163, 2163, 2163, 2163, 2163, 2163, 2163, 2163, 2163, 2163,
-        2163, 2163, 2164, 2164, 2164, 2164, 2164, 2164, 2164, 2164, 2164, 2164, 2164, 2164, 2164, 2164, 2164, 2165, 2165, 2165, 2165, 2165, 2165, 2165, 2165, 2165,
-        2165, 2165, 2165, 2165, 2165, 2165, 2166, 2166, 2166, 2166, 2166, 2166, 2166, 2166, 2166, 2166, 2166, 2166, 2166, 2166, 2166, 2167, 2167, 2167, 2167, 2167,
-        2167, 2167, 2167, 2167, 2167, 2167, 2167, 2167, 2167, 2167, 2167, 2168, 2168, 2168, 2168, 2168, 2168, 2168, 2168, 2168, 2168, 2168, 2168, 2168, 2168, 2168,
-        2169, 2169, 2169, 2169, 2169, 2169, 2169, 2169, 2169, 2169, 2169, 2169, 2169, 2169, 2169, 2170, 2170, 2170, 2170, 2170, 2170, 2170, 2170, 2170, 2170, 2170,
-        2170, 2170, 2170, 2170, 2171, 2171, 2171, 2171, 2171, 2171, 2171, 2171, 2171, 2171, 2171, 2171, 2171, 2171, 2171, 2172, 2172, 2172, 2172, 2172, 2172, 2172,
-        2172, 2172, 2172, 2172, 2172, 2172, 2172, 2172, 2173, 2173, 2173, 2173, 2173, 2173, 2173, 2173, 2173, 2173, 2173, 2173, 2173, 2173, 2173, 2174, 2174, 2174,
-        2174, 2174, 2174, 2174, 2174, 2174, 2174, 2174, 2174, 2174, 2174, 2174, 2175, 2175, 2175, 2175, 2175, 2175, 2175, 2175, 2175, 2175, 2175, 2175, 2175, 2175,
-        2175, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2177, 2177, 2177, 2177, 2177, 2177, 2177, 2177, 2177, 2177,
-        2177, 2177, 2177, 2177, 2177, 2178, 2178, 2178, 2178, 2178, 2178, 2178, 2178, 2178, 2178, 2178, 2178, 2178, 2178, 2178, 2178, 2179, 2179, 2179, 2179, 2179,
-        2179, 2179, 2179, 2179, 2179, 2179, 2179, 2179, 2179, 2179, 2180, 2180, 2180, 2180, 2180, 2180, 2180, 2180, 2180, 2180, 2180, 2180, 2180, 2180, 2180, 2181,
-        2181, 2181, 2181, 2181, 2181, 2181, 2181, 2181, 2181, 2181, 2181, 2181, 2181, 2181, 2182, 2182, 2182, 2182, 2182, 2182, 2182, 2182, 2182, 2182, 2182, 2182,
-        2182, 2182, 2182, 2183, 2183, 2183, 2183, 2183, 2183, 2183, 2183, 2183, 2183, 2183, 2183, 2183, 2183, 2183, 2183, 2184, 2184, 2184, 2184, 2184, 2184, 2184,
-        2184, 2184, 2184, 2184, 2184, 2184, 2184, 2184, 2185, 2185, 2185, 2185, 2185, 2185, 2185, 2185, 2185, 2185, 2185, 2185, 2185, 2185, 2185, 2186, 2186, 2186,
-        2186, 2186, 2186, 2186, 2186, 2186, 2186, 2186, 2186, 2186, 2186, 2186, 2187, 2187, 2187, 2187, 2187, 2187, 2187, 2187, 2187, 2187, 2187, 2187, 2187, 2187,
-        2187, 2187, 2188, 2188, 2188, 2188, 2188, 2188, 2188, 2188, 2188, 2188, 2188, 2188, 2188, 2188, 2188, 2189, 2189, 2189, 2189, 2189, 2189, 2189, 2189, 2189,
-        2189, 2189, 2189, 2189, 2189, 2189, 2190, 2190, 2190, 2190, 2190, 2190, 2190, 2190, 2190, 2190, 2190, 2190, 2190, 2190, 2190, 2191, 2191, 2191, 2191, 2191,
-        2191, 2191, 2191, 2191, 2191, 2191, 2191, 2191, 2191, 2191, 2191, 2192, 2192, 2192, 2192, 2192, 2192, 2192, 2192, 2192, 2192, 2192, 2192, 2192, 2192, 2192,
-        2193, 2193, 2193, 2193, 2193, 2193, 2193, 2193, 2193, 2193, 2193, 2193, 2193, 2193, 2193, 2194, 2194, 2194, 2194, 2194, 2194, 2194, 2194, 2194, 2194, 2194,
-        2194, 2194, 2194, 2194, 2194, 2195, 2195, 2195, 2195, 2195, 2195, 2195, 2195, 2195, 2195, 2195, 2195, 2195, 2195, 2195, 2196, 2196, 2196, 2196, 2196, 2196,
-        2196, 2196, 2196, 2196, 2196, 2196, 2196, 2196, 2196, 2197, 2197, 2197, 2197, 2197, 2197, 2197, 2197, 2197, 2197, 2197, 2197, 2197, 2197, 2197, 2197, 2198,
-        2198, 2198, 2198, 2198, 2198, 2198, 2198, 2198, 2198, 2198, 2198, 2198, 2198, 2198, 2199, 2199, 2199, 2199, 2199, 2199, 2199, 2199, 2199, 2199, 2199, 2199,
-        2199, 2199, 2199, 2199, 2200, 2200, 2200, 2200, 2200, 2200, 2200, 2200, 2200, 2200, 2200, 2200, 2200, 2200, 2200, 2201, 2201, 2201, 2201, 2201, 2201, 2201,
-        2201, 2201, 2201, 2201, 2201, 2201, 2201, 2201, 2202, 2202, 2202, 2202, 2202, 2202, 2202, 2202, 2202, 2202, 2202, 2202, 2202, 2202, 2202, 2202, 2203, 2203,
-        2203, 2203, 2203, 2203, 2203, 2203, 2203, 2203, 2203, 2203, 2203, 2203, 2203, 2204, 2204, 2204, 2204, 2204, 2204, 2204, 2204, 2204, 2204, 2204, 2204, 2204,
-        2204, 2204, 2204, 2205, 2205, 2205, 2205, 2205, 2205, 2205, 2205, 2205, 2205, 2205, 2205, 2205, 2205, 2205, 2206, 2206, 2206, 2206, 2206, 2206, 2206, 2206,
-        2206, 2206, 2206, 2206, 2206, 2206, 2206, 2206, 2207, 2207, 2207, 2207, 2207, 2207, 2207, 2207, 2207, 2207, 2207, 2207, 2207, 2207, 2207, 2208, 2208, 2208,
-        2208, 2208, 2208, 2208, 2208, 2208, 2208, 2208, 2208, 2208, 2208, 2208, 2208, 2209, 2209, 2209, 2209, 2209, 2209, 2209, 2209, 2209, 2209, 2209, 2209, 2209,
-        2209, 2209, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2211, 2211, 2211, 2211, 2211, 2211, 2211, 2211,
-        2211, 2211, 2211, 2211, 2211, 2211, 2211, 2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212, 2213, 2213, 2213,
-        2213, 2213, 2213, 2213, 2213, 2213, 2213, 2213, 2213, 2213, 2213, 2213, 2214, 2214, 2214, 2214, 2214, 2214, 2214, 2214, 2214, 2214, 2214, 2214, 2214, 2214,
-        2214, 2214, 2215, 2215, 2215, 2215, 2215, 2215, 2215, 2215, 2215, 2215, 2215, 2215, 2215, 2215, 2215, 2216, 2216, 2216, 2216, 2216, 2216, 2216, 2216, 2216,
-        2216, 2216, 2216, 2216, 2216, 2216, 2216, 2217, 2217, 2217, 2217, 2217, 2217, 2217, 2217, 2217, 2217, 2217, 2217, 2217, 2217, 2217, 2217, 2218, 2218, 2218,
-        2218, 2218, 2218, 2218, 2218, 2218, 2218, 2218, 2218, 2218, 2218, 2218, 2219, 2219, 2219, 2219, 2219, 2219, 2219, 2219, 2219, 2219, 2219, 2219, 2219, 2219,
-        2219, 2219, 2220, 2220, 2220, 2220, 2220, 2220, 2220, 2220, 2220, 2220, 2220, 2220, 2220, 2220, 2220, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221,
-        2221, 2221, 2221, 2221, 2221, 2221, 2221, 2222, 2222, 2222, 2222, 2222, 2222, 2222, 2222, 2222, 2222, 2222, 2222, 2222, 2222, 2222, 2222, 2223, 2223, 2223,
-        2223, 2223, 2223, 2223, 2223, 2223, 2223, 2223, 2223, 2223, 2223, 2223, 2224, 2224, 2224, 2224, 2224, 2224, 2224, 2224, 2224, 2224, 2224, 2224, 2224, 2224,
-        2224, 2224, 2225, 2225, 2225, 2225, 2225, 2225, 2225, 2225, 2225, 2225, 2225, 2225, 2225, 2225, 2225, 2225, 2226, 2226, 2226, 2226, 2226, 2226, 2226, 2226,
-        2226, 2226, 2226, 2226, 2226, 2226, 2226, 2227, 2227, 2227, 2227, 2227, 2227, 2227, 2227, 2227, 2227, 2227, 2227, 2227, 2227, 2227, 2227, 2228, 2228, 2228,
-        2228, 2228, 2228, 2228, 2228, 2228, 2228, 2228, 2228, 2228, 2228, 2228, 2228, 2229, 2229, 2229, 2229, 2229, 2229, 2229, 2229, 2229, 2229, 2229, 2229, 2229,
-        2229, 2229, 2229, 2230, 2230, 2230, 2230, 2230, 2230, 2230, 2230, 2230, 2230, 2230, 2230, 2230, 2230, 2230, 2231, 2231, 2231, 2231, 2231, 2231, 2231, 2231,
-        2231, 2231, 2231, 2231, 2231, 2231, 2231, 2231, 2232, 2232, 2232, 2232, 2232, 2232, 2232, 2232, 2232, 2232, 2232, 2232, 2232, 2232, 2232, 2232, 2233, 2233,
-        2233, 2233, 2233, 2233, 2233, 2233, 2233, 2233, 2233, 2233, 2233, 2233, 2233, 2233, 2234, 2234, 2234, 2234, 2234, 2234, 2234, 2234, 2234, 2234, 2234, 2234,
-        2234, 2234, 2234, 2235, 2235, 2235, 2235, 2235, 2235, 2235, 2235, 2235, 2235, 2235, 2235, 2235, 2235, 2235, 2235, 2236, 2236, 2236, 2236, 2236, 2236, 2236,
-        2236, 2236, 2236, 2236, 2236, 2236, 2236, 2236, 2236, 2237, 2237, 2237, 2237, 2237, 2237, 2237, 2237, 2237, 2237, 2237, 2237, 2237, 2237, 2237, 2237, 2238,
-        2238, 2238, 2238, 2238, 2238, 2238, 2238, 2238, 2238, 2238, 2238, 2238, 2238, 2238, 2238, 2239, 2239, 2239, 2239, 2239, 2239, 2239, 2239, 2239, 2239, 2239,
-        2239, 2239, 2239, 2239, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2241, 2241, 2241, 2241, 2241, 2241,
-        2241, 2241, 2241, 2241, 2241, 2241, 2241, 2241, 2241, 2241, 2242, 2242, 2242, 2242, 2242, 2242, 2242, 2242, 2242, 2242, 2242, 2242, 2242, 2242, 2242, 2242,
-        2243, 2243, 2243, 2243, 2243, 2243, 2243, 2243, 2243, 2243, 2243, 2243, 2243, 2243, 2243, 2243, 2244, 2244, 2244, 2244, 2244, 2244, 2244, 2244, 2244, 2244,
-        2244, 2244, 2244, 2244, 2244, 2244, 2245, 2245, 2245, 2245, 2245, 2245, 2245, 2245, 2245, 2245, 2245, 2245, 2245, 2245, 2245, 2245, 2246, 2246, 2246, 2246,
-        2246, 2246, 2246, 2246, 2246, 2246, 2246, 2246, 2246, 2246, 2246, 2246, 2247, 2247, 2247, 2247, 2247, 2247, 2247, 2247, 2247, 2247, 2247, 2247, 2247, 2247,
-        2247, 2247, 2248, 2248, 2248, 2248, 2248, 2248, 2248, 2248, 2248, 2248, 2248, 2248, 2248, 2248, 2248, 2248, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249,
-        2249, 2249, 2249, 2249, 2249, 2249, 2249, 2250, 2250, 2250, 2250, 2250, 2250, 2250, 2250, 2250, 2250, 2250, 2250, 2250, 2250, 2250, 2250, 2251, 2251, 2251,
-        2251, 2251, 2251, 2251, 2251, 2251, 2251, 2251, 2251, 2251, 2251, 2251, 2251, 2252, 2252, 2252, 2252, 2252, 2252, 2252, 2252, 2252, 2252, 2252, 2252, 2252,
-        2252, 2252, 2252, 2253, 2253, 2253, 2253, 2253, 2253, 2253, 2253, 2253, 2253, 2253, 2253, 2253, 2253, 2253, 2253, 2254, 2254, 2254, 2254, 2254, 2254, 2254,
-        2254, 2254, 2254, 2254, 2254, 2254, 2254, 2254, 2254, 2255, 2255, 2255, 2255, 2255, 2255, 2255, 2255, 2255, 2255, 2255, 2255, 2255, 2255, 2255, 2255, 2256,
-        2256, 2256, 2256, 2256, 2256, 2256, 2256, 2256, 2256, 2256, 2256, 2256, 2256, 2256, 2256, 2257, 2257, 2257, 2257, 2257, 2257, 2257, 2257, 2257, 2257, 2257,
-        2257, 2257, 2257, 2257, 2257, 2257, 2258, 2258, 2258, 2258, 2258, 2258, 2258, 2258, 2258, 2258, 2258, 2258, 2258, 2258, 2258, 2258, 2259, 2259, 2259, 2259,
-        2259, 2259, 2259, 2259, 2259, 2259, 2259, 2259, 2259, 2259, 2259, 2259, 2260, 2260, 2260, 2260, 2260, 2260, 2260, 2260, 2260, 2260, 2260, 2260, 2260, 2260,
-        2260, 2260, 2261, 2261, 2261, 2261, 2261, 2261, 2261, 2261, 2261, 2261, 2261, 2261, 2261, 2261, 2261, 2261, 2262, 2262, 2262, 2262, 2262, 2262, 2262, 2262,
-        2262, 2262, 2262, 2262, 2262, 2262, 2262, 2262, 2263, 2263, 2263, 2263, 2263, 2263, 2263, 2263, 2263, 2263, 2263, 2263, 2263, 2263, 2263, 2263, 2264, 2264,
-        2264, 2264, 2264, 2264, 2264, 2264, 2264, 2264, 2264, 2264, 2264, 2264, 2264, 2264, 2265, 2265, 2265, 2265, 2265, 2265, 2265, 2265, 2265, 2265, 2265, 2265,
-        2265, 2265, 2265, 2265, 2266, 2266, 2266, 2266, 2266, 2266, 2266, 2266, 2266, 2266, 2266, 2266, 2266, 2266, 2266, 2266, 2267, 2267, 2267, 2267, 2267, 2267,
-        2267, 2267, 2267, 2267, 2267, 2267, 2267, 2267, 2267, 2267, 2267, 2268, 2268, 2268, 2268, 2268, 2268, 2268, 2268, 2268, 2268, 2268, 2268, 2268, 2268, 2268,
-        2268, 2269, 2269, 2269, 2269, 2269, 2269, 2269, 2269, 2269, 2269, 2269, 2269, 2269, 2269, 2269, 2269, 2270, 2270, 2270, 2270, 2270, 2270, 2270, 2270, 2270,
-        2270, 2270, 2270, 2270, 2270, 2270, 2270, 2271, 2271, 2271, 2271, 2271, 2271, 2271, 2271, 2271, 2271, 2271, 2271, 2271, 2271, 2271, 2271, 2272, 2272, 2272,
-        2272, 2272, 2272, 2272, 2272, 2272, 2272, 2272, 2272, 2272, 2272, 2272, 2272, 2272, 2273, 2273, 2273, 2273, 2273, 2273, 2273, 2273, 2273, 2273, 2273, 2273,
-        2273, 2273, 2273, 2273, 2274, 2274, 2274, 2274, 2274, 2274, 2274, 2274, 2274, 2274, 2274, 2274, 2274, 2274, 2274, 2274, 2275, 2275, 2275, 2275, 2275, 2275,
-        2275, 2275, 2275, 2275, 2275, 2275, 2275, 2275, 2275, 2275, 2276, 2276, 2276, 2276, 2276, 2276, 2276, 2276, 2276, 2276, 2276, 2276, 2276, 2276, 2276, 2276,
-        2276, 2277, 2277, 2277, 2277, 2277, 2277, 2277, 2277, 2277, 2277, 2277, 2277, 2277, 2277, 2277, 2277, 2278, 2278, 2278, 2278, 2278, 2278, 2278, 2278, 2278,
-        2278, 2278, 2278, 2278, 2278, 2278, 2278, 2279, 2279, 2279, 2279, 2279, 2279, 2279, 2279, 2279, 2279, 2279, 2279, 2279, 2279, 2279, 2279, 2280, 2280, 2280,
-        2280, 2280, 2280, 2280, 2280, 2280, 2280, 2280, 2280, 2280, 2280, 2280, 2280, 2280, 2281, 2281, 2281, 2281, 2281, 2281, 2281, 2281, 2281, 2281, 2281, 2281,
-        2281, 2281, 2281, 2281, 2282, 2282, 2282, 2282, 2282, 2282, 2282, 2282, 2282, 2282, 2282, 2282, 2282, 2282, 2282, 2282, 2283, 2283, 2283, 2283, 2283, 2283,
-        2283, 2283, 2283, 2283, 2283, 2283, 2283, 2283, 2283, 2283, 2283, 2284, 2284, 2284, 2284, 2284, 2284, 2284, 2284, 2284, 2284, 2284, 2284, 2284, 2284, 2284,
-        2284, 2285, 2285, 2285, 2285, 2285, 2285, 2285, 2285, 2285, 2285, 2285, 2285, 2285, 2285, 2285, 2285, 2286, 2286, 2286, 2286, 2286, 2286, 2286, 2286, 2286,
-        2286, 2286, 2286, 2286, 2286, 2286, 2286, 2286, 2287, 2287, 2287, 2287, 2287, 2287, 2287, 2287, 2287, 2287, 2287, 2287, 2287, 2287, 2287, 2287, 2288, 2288,
-        2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2289, 2289, 2289, 2289, 2289, 2289, 2289, 2289, 2289, 2289, 2289,
-        2289, 2289, 2289, 2289, 2289, 2290, 2290, 2290, 2290, 2290, 2290, 2290, 2290, 2290, 2290, 2290, 2290, 2290, 2290, 2290, 2290, 2291, 2291, 2291, 2291, 2291,
-        2291, 2291, 2291, 2291, 2291, 2291, 2291, 2291, 2291, 2291, 2291, 2291, 2292, 2292, 2292, 2292, 2292, 2292, 2292, 2292, 2292, 2292, 2292, 2292, 2292, 2292,
-        2292, 2292, 2293, 2293, 2293, 2293, 2293, 2293, 2293, 2293, 2293, 2293, 2293, 2293, 2293, 2293, 2293, 2293, 2293, 2294, 2294, 2294, 2294, 2294, 2294, 2294,
-        2294, 2294, 2294, 2294, 2294, 2294, 2294, 2294, 2294, 2295, 2295, 2295, 2295, 2295, 2295, 2295, 2295, 2295, 2295, 2295, 2295, 2295, 2295, 2295, 2295, 2295,
-        2296, 2296, 2296, 2296, 2296, 2296, 2296, 2296, 2296, 2296, 2296, 2296, 2296, 2296, 2296, 2296, 2297, 2297, 2297, 2297, 2297, 2297, 2297, 2297, 2297, 2297,
-        2297, 2297, 2297, 2297, 2297, 2297, 2297, 2298, 2298, 2298, 2298, 2298, 2298, 2298, 2298, 2298, 2298, 2298, 2298, 2298, 2298, 2298, 2298, 2299, 2299, 2299,
-        2299, 2299, 2299, 2299, 2299, 2299, 2299, 2299, 2299, 2299, 2299, 2299, 2299, 2299, 2300, 2300, 2300, 2300, 2300, 2300, 2300, 2300, 2300, 2300, 2300, 2300,
-        2300, 2300, 2300, 2300, 2301, 2301, 2301, 2301, 2301, 2301, 2301, 2301, 2301, 2301, 2301, 2301, 2301, 2301, 2301, 2301, 2301, 2302, 2302, 2302, 2302, 2302,
-        2302, 2302, 2302, 2302, 2302, 2302, 2302, 2302, 2302, 2302, 2302, 2303, 2303, 2303, 2303, 2303, 2303, 2303, 2303, 2303, 2303, 2303, 2303, 2303, 2303, 2303,
-        2303, 2303, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2305, 2305, 2305, 2305, 2305, 2305, 2305,
-        2305, 2305, 2305, 2305, 2305, 2305, 2305, 2305, 2305, 2306, 2306, 2306, 2306, 2306, 2306, 2306, 2306, 2306, 2306, 2306, 2306, 2306, 2306, 2306, 2306, 2306,
-        2307, 2307, 2307, 2307, 2307, 2307, 2307, 2307, 2307, 2307, 2307, 2307, 2307, 2307, 2307, 2307, 2308, 2308, 2308, 2308, 2308, 2308, 2308, 2308, 2308, 2308,
-        2308, 2308, 2308, 2308, 2308, 2308, 2308, 2309, 2309, 2309, 2309, 2309, 2309, 2309, 2309, 2309, 2309, 2309, 2309, 2309, 2309, 2309, 2309, 2309, 2310, 2310,
-        2310, 2310, 2310, 2310, 2310, 2310, 2310, 2310, 2310, 2310, 2310, 2310, 2310, 2310, 2311, 2311, 2311, 2311, 2311, 2311, 2311, 2311, 2311, 2311, 2311, 2311,
-        2311, 2311, 2311, 2311, 2311, 2312, 2312, 2312, 2312, 2312, 2312, 2312, 2312, 2312, 2312, 2312, 2312, 2312, 2312, 2312, 2312, 2312, 2313, 2313, 2313, 2313,
-        2313, 2313, 2313, 2313, 2313, 2313, 2313, 2313, 2313, 2313, 2313, 2313, 2314, 2314, 2314, 2314, 2314, 2314, 2314, 2314, 2314, 2314, 2314, 2314, 2314, 2314,
-        2314, 2314, 2314, 2315, 2315, 2315, 2315, 2315, 2315, 2315, 2315, 2315, 2315, 2315, 2315, 2315, 2315, 2315, 2315, 2315, 2316, 2316, 2316, 2316, 2316, 2316,
-        2316, 2316, 2316, 2316, 2316, 2316, 2316, 2316, 2316, 2316, 2316, 2317, 2317, 2317, 2317, 2317, 2317, 2317, 2317, 2317, 2317, 2317, 2317, 2317, 2317, 2317,
-        2317, 2318, 2318, 2318, 2318, 2318, 2318, 2318, 2318, 2318, 2318, 2318, 2318, 2318, 2318, 2318, 2318, 2318, 2319, 2319, 2319, 2319, 2319, 2319, 2319, 2319,
-        2319, 2319, 2319, 2319, 2319, 2319, 2319, 2319, 2319, 2320, 2320, 2320, 2320, 2320, 2320, 2320, 2320, 2320, 2320, 2320, 2320, 2320, 2320, 2320, 2320, 2320,
-        2321, 2321, 2321, 2321, 2321, 2321, 2321, 2321, 2321, 2321, 2321, 2321, 2321, 2321, 2321, 2321, 2322, 2322, 2322, 2322, 2322, 2322, 2322, 2322, 2322, 2322,
-        2322, 2322, 2322, 2322, 2322, 2322, 2322, 2323, 2323, 2323, 2323, 2323, 2323, 2323, 2323, 2323, 2323, 2323, 2323, 2323, 2323, 2323, 2323, 2323, 2324, 2324,
-        2324, 2324, 2324, 2324, 2324, 2324, 2324, 2324, 2324, 2324, 2324, 2324, 2324, 2324, 2324, 2325, 2325, 2325, 2325, 2325, 2325, 2325, 2325, 2325, 2325, 2325,
-        2325, 2325, 2325, 2325, 2325, 2325, 2326, 2326, 2326, 2326, 2326, 2326, 2326, 2326, 2326, 2326, 2326, 2326, 2326, 2326, 2326, 2326, 2327, 2327, 2327, 2327,
-        2327, 2327, 2327, 2327, 2327, 2327, 2327, 2327, 2327, 2327, 2327, 2327, 2327, 2328, 2328, 2328, 2328, 2328, 2328, 2328, 2328, 2328, 2328, 2328, 2328, 2328,
-        2328, 2328, 2328, 2328, 2329, 2329, 2329, 2329, 2329, 2329, 2329, 2329, 2329, 2329, 2329, 2329, 2329, 2329, 2329, 2329, 2329, 2330, 2330, 2330, 2330, 2330,
-        2330, 2330, 2330, 2330, 2330, 2330, 2330, 2330, 2330, 2330, 2330, 2330, 2331, 2331, 2331, 2331, 2331, 2331, 2331, 2331, 2331, 2331, 2331, 2331, 2331, 2331,
-        2331, 2331, 2331, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2333, 2333, 2333, 2333, 2333, 2333,
-        2333, 2333, 2333, 2333, 2333, 2333, 2333, 2333, 2333, 2333, 2333, 2334, 2334, 2334, 2334, 2334, 2334, 2334, 2334, 2334, 2334, 2334, 2334, 2334, 2334, 2334,
-        2334, 2334, 2335, 2335, 2335, 2335, 2335, 2335, 2335, 2335, 2335, 2335, 2335, 2335, 2335, 2335, 2335, 2335, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336,
-        2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2337, 2337, 2337, 2337, 2337, 2337, 2337, 2337, 2337, 2337, 2337, 2337, 2337, 2337, 2337, 2337, 2337,
-        2338, 2338, 2338, 2338, 2338, 2338, 2338, 2338, 2338, 2338, 2338, 2338, 2338, 2338, 2338, 2338, 2338, 2339, 2339, 2339, 2339, 2339, 2339, 2339, 2339, 2339,
-        2339, 2339, 2339, 2339, 2339, 2339, 2339, 2339, 2340, 2340, 2340, 2340, 2340, 2340, 2340, 2340, 2340, 2340, 2340, 2340, 2340, 2340, 2340, 2340, 2340, 2341,
-        2341, 2341, 2341, 2341, 2341, 2341, 2341, 2341, 2341, 2341, 2341, 2341, 2341, 2341, 2341, 2341, 2342, 2342, 2342, 2342, 2342, 2342, 2342, 2342, 2342, 2342,
-        2342, 2342, 2342, 2342, 2342, 2342, 2342, 2343, 2343, 2343, 2343, 2343, 2343, 2343, 2343, 2343, 2343, 2343, 2343, 2343, 2343, 2343, 2343, 2343, 2344, 2344,
-        2344, 2344, 2344, 2344, 2344, 2344, 2344, 2344, 2344, 2344, 2344, 2344, 2344, 2344, 2344, 2345, 2345, 2345, 2345, 2345, 2345, 2345, 2345, 2345, 2345, 2345,
-        2345, 2345, 2345, 2345, 2345, 2345, 2345, 2346, 2346, 2346, 2346, 2346, 2346, 2346, 2346, 2346, 2346, 2346, 2346, 2346, 2346, 2346, 2346, 2346, 2347, 2347,
-        2347, 2347, 2347, 2347, 2347, 2347, 2347, 2347, 2347, 2347, 2347, 2347, 2347, 2347, 2347, 2348, 2348, 2348, 2348, 2348, 2348, 2348, 2348, 2348, 2348, 2348,
-        2348, 2348, 2348, 2348, 2348, 2348, 2349, 2349, 2349, 2349, 2349, 2349, 2349, 2349, 2349, 2349, 2349, 2349, 2349, 2349, 2349, 2349, 2349, 2350, 2350, 2350,
-        2350, 2350, 2350, 2350, 2350, 2350, 2350, 2350, 2350, 2350, 2350, 2350, 2350, 2350, 2351, 2351, 2351, 2351, 2351, 2351, 2351, 2351, 2351, 2351, 2351, 2351,
-        2351, 2351, 2351, 2351, 2351, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2353, 2353, 2353, 2353,
-        2353, 2353, 2353, 2353, 2353, 2353, 2353, 2353, 2353, 2353, 2353, 2353, 2353, 2354, 2354, 2354, 2354, 2354, 2354, 2354, 2354, 2354, 2354, 2354, 2354, 2354,
-        2354, 2354, 2354, 2354, 2354, 2355, 2355, 2355, 2355, 2355, 2355, 2355, 2355, 2355, 2355, 2355, 2355, 2355, 2355, 2355, 2355, 2355, 2356, 2356, 2356, 2356,
-        2356, 2356, 2356, 2356, 2356, 2356, 2356, 2356, 2356, 2356, 2356, 2356, 2356, 2357, 2357, 2357, 2357, 2357, 2357, 2357, 2357, 2357, 2357, 2357, 2357, 2357,
-        2357, 2357, 2357, 2357, 2358, 2358, 2358, 2358, 2358, 2358, 2358, 2358, 2358, 2358, 2358, 2358, 2358, 2358, 2358, 2358, 2358, 2359, 2359, 2359, 2359, 2359,
-        2359, 2359, 2359, 2359, 2359, 2359, 2359, 2359, 2359, 2359, 2359, 2359, 2359, 2360, 2360, 2360, 2360, 2360, 2360, 2360, 2360, 2360, 2360, 2360, 2360, 2360,
-        2360, 2360, 2360, 2360, 2361, 2361, 2361, 2361, 2361, 2361, 2361, 2361, 2361, 2361, 2361, 2361, 2361, 2361, 2361, 2361, 2361, 2362, 2362, 2362, 2362, 2362,
-        2362, 2362, 2362, 2362, 2362, 2362, 2362, 2362, 2362, 2362, 2362, 2362, 2363, 2363, 2363, 2363, 2363, 2363, 2363, 2363, 2363, 2363, 2363, 2363, 2363, 2363,
-        2363, 2363, 2363, 2363, 2364, 2364, 2364, 2364, 2364, 2364, 2364, 2364, 2364, 2364, 2364, 2364, 2364, 2364, 2364, 2364, 2364, 2365, 2365, 2365, 2365, 2365,
-        2365, 2365, 2365, 2365, 2365, 2365, 2365, 2365, 2365, 2365, 2365, 2365, 2366, 2366, 2366, 2366, 2366, 2366, 2366, 2366, 2366, 2366, 2366, 2366, 2366, 2366,
-        2366, 2366, 2366, 2367, 2367, 2367, 2367, 2367, 2367, 2367, 2367, 2367, 2367, 2367, 2367, 2367, 2367, 2367, 2367, 2367, 2367, 2368, 2368, 2368, 2368, 2368,
-        2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2369, 2369, 2369, 2369, 2369, 2369, 2369, 2369, 2369, 2369, 2369, 2369, 2369, 2369,
-        2369, 2369, 2369, 2370, 2370, 2370, 2370, 2370, 2370, 2370, 2370, 2370, 2370, 2370, 2370, 2370, 2370, 2370, 2370, 2370, 2370, 2371, 2371, 2371, 2371, 2371,
-        2371, 2371, 2371, 2371, 2371, 2371, 2371, 2371, 2371, 2371, 2371, 2371, 2372, 2372, 2372, 2372, 2372, 2372, 2372, 2372, 2372, 2372, 2372, 2372, 2372, 2372,
-        2372, 2372, 2372, 2372, 2373, 2373, 2373, 2373, 2373, 2373, 2373, 2373, 2373, 2373, 2373, 2373, 2373, 2373, 2373, 2373, 2373, 2374, 2374, 2374, 2374, 2374,
-        2374, 2374, 2374, 2374, 2374, 2374, 2374, 2374, 2374, 2374, 2374, 2374, 2375, 2375, 2375, 2375, 2375, 2375, 2375, 2375, 2375, 2375, 2375, 2375, 2375, 2375,
-        2375, 2375, 2375, 2375, 2376, 2376, 2376, 2376, 2376, 2376, 2376, 2376, 2376, 2376, 2376, 2376, 2376, 2376, 2376, 2376, 2376, 2377, 2377, 2377, 2377, 2377,
-        2377, 2377, 2377, 2377, 2377, 2377, 2377, 2377, 2377, 2377, 2377, 2377, 2377, 2378, 2378, 2378, 2378, 2378, 2378, 2378, 2378, 2378, 2378, 2378, 2378, 2378,
-        2378, 2378, 2378, 2378, 2379, 2379, 2379, 2379, 2379, 2379, 2379, 2379, 2379, 2379, 2379, 2379, 2379, 2379, 2379, 2379, 2379, 2379, 2380, 2380, 2380, 2380,
-        2380, 2380, 2380, 2380, 2380, 2380, 2380, 2380, 2380, 2380, 2380, 2380, 2380, 2381, 2381, 2381, 2381, 2381, 2381, 2381, 2381, 2381, 2381, 2381, 2381, 2381,
-        2381, 2381, 2381, 2381, 2382, 2382, 2382, 2382, 2382, 2382, 2382, 2382, 2382, 2382, 2382, 2382, 2382, 2382, 2382, 2382, 2382, 2382, 2383, 2383, 2383, 2383,
-        2383, 2383, 2383, 2383, 2383, 2383, 2383, 2383, 2383, 2383, 2383, 2383, 2383, 2384, 2384, 2384, 2384, 2384, 2384, 2384, 2384, 2384, 2384, 2384, 2384, 2384,
-        2384, 2384, 2384, 2384, 2384, 2385, 2385, 2385, 2385, 2385, 2385, 2385, 2385, 2385, 2385, 2385, 2385, 2385, 2385, 2385, 2385, 2385, 2385, 2386, 2386, 2386,
-        2386, 2386, 2386, 2386, 2386, 2386, 2386, 2386, 2386, 2386, 2386, 2386, 2386, 2386, 2387, 2387, 2387, 2387, 2387, 2387, 2387, 2387, 2387, 2387, 2387, 2387,
-        2387, 2387, 2387, 2387, 2387, 2387, 2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388, 2389, 2389, 2389,
-        2389, 2389, 2389, 2389, 2389, 2389, 2389, 2389, 2389, 2389, 2389, 2389, 2389, 2389, 2389, 2390, 2390, 2390, 2390, 2390, 2390, 2390, 2390, 2390, 2390, 2390,
-        2390, 2390, 2390, 2390, 2390, 2390, 2391, 2391, 2391, 2391, 2391, 2391, 2391, 2391, 2391, 2391, 2391, 2391, 2391, 2391, 2391, 2391, 2391, 2391, 2392, 2392,
-        2392, 2392, 2392, 2392, 2392, 2392, 2392, 2392, 2392, 2392, 2392, 2392, 2392, 2392, 2392, 2392, 2393, 2393, 2393, 2393, 2393, 2393, 2393, 2393, 2393, 2393,
-        2393, 2393, 2393, 2393, 2393, 2393, 2393, 2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394, 2395,
-        2395, 2395, 2395, 2395, 2395, 2395, 2395, 2395, 2395, 2395, 2395, 2395, 2395, 2395, 2395, 2395, 2396, 2396, 2396, 2396, 2396, 2396, 2396, 2396, 2396, 2396,
-        2396, 2396, 2396, 2396, 2396, 2396, 2396, 2396, 2397, 2397, 2397, 2397, 2397, 2397, 2397, 2397, 2397, 2397, 2397, 2397, 2397, 2397, 2397, 2397, 2397, 2397,
-        2398, 2398, 2398, 2398, 2398, 2398, 2398, 2398, 2398, 2398, 2398, 2398, 2398, 2398, 2398, 2398, 2398, 2399, 2399, 2399, 2399, 2399, 2399, 2399, 2399, 2399,
-        2399, 2399, 2399, 2399, 2399, 2399, 2399, 2399, 2399, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-        2400, 2401, 2401, 2401, 2401, 2401, 2401, 2401, 2401, 2401, 2401, 2401, 2401, 2401, 2401, 2401, 2401, 2401, 2401, 2402, 2402, 2402, 2402, 2402, 2402, 2402,
-        2402, 2402, 2402, 2402, 2402, 2402, 2402, 2402, 2402, 2402, 2403, 2403, 2403, 2403, 2403, 2403, 2403, 2403, 2403, 2403, 2403, 2403, 2403, 2403, 2403, 2403,
-        2403, 2403, 2404, 2404, 2404, 2404, 2404, 2404, 2404, 2404, 2404, 2404, 2404, 2404, 2404, 2404, 2404, 2404, 2404, 2404, 2405, 2405, 2405, 2405, 2405, 2405,
-        2405, 2405, 2405, 2405, 2405, 2405, 2405, 2405, 2405, 2405, 2405, 2405, 2406, 2406, 2406, 2406, 2406, 2406, 2406, 2406, 2406, 2406, 2406, 2406, 2406, 2406,
-        2406, 2406, 2406, 2407, 2407, 2407, 2407, 2407, 2407, 2407, 2407, 2407, 2407, 2407, 2407, 2407, 2407, 2407, 2407, 2407, 2407, 2408, 2408, 2408, 2408, 2408,
-        2408, 2408, 2408, 2408, 2408, 2408, 2408, 2408, 2408, 2408, 2408, 2408, 2408, 2409, 2409, 2409, 2409, 2409, 2409, 2409, 2409, 2409, 2409, 2409, 2409, 2409,
-        2409, 2409, 2409, 2409, 2409, 2410, 2410, 2410, 2410, 2410, 2410, 2410, 2410, 2410, 2410, 2410, 2410, 2410, 2410, 2410, 2410, 2410, 2410, 2411, 2411, 2411,
-        2411, 2411, 2411, 2411, 2411, 2411, 2411, 2411, 2411, 2411, 2411, 2411, 2411, 2411, 2412, 2412, 2412, 2412, 2412, 2412, 2412, 2412, 2412, 2412, 2412, 2412,
-        2412, 2412, 2412, 2412, 2412, 2412, 2413, 2413, 2413, 2413, 2413, 2413, 2413, 2413, 2413, 2413, 2413, 2413, 2413, 2413, 2413, 2413, 2413, 2413, 2414, 2414,
-        2414, 2414, 2414, 2414, 2414, 2414, 2414, 2414, 2414, 2414, 2414, 2414, 2414, 2414, 2414, 2414, 2415, 2415, 2415, 2415, 2415, 2415, 2415, 2415, 2415, 2415,
-        2415, 2415, 2415, 2415, 2415, 2415, 2415, 2415, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416,
-        2417, 2417, 2417, 2417, 2417, 2417, 2417, 2417, 2417, 2417, 2417, 2417, 2417, 2417, 2417, 2417, 2417, 2417, 2418, 2418, 2418, 2418, 2418, 2418, 2418, 2418,
-        2418, 2418, 2418, 2418, 2418, 2418, 2418, 2418, 2418, 2418, 2419, 2419, 2419, 2419, 2419, 2419, 2419, 2419, 2419, 2419, 2419, 2419, 2419, 2419, 2419, 2419,
-        2419, 2420, 2420, 2420, 2420, 2420, 2420, 2420, 2420, 2420, 2420, 2420, 2420, 2420, 2420, 2420, 2420, 2420, 2420, 2421, 2421, 2421, 2421, 2421, 2421, 2421,
-        2421, 2421, 2421, 2421, 2421, 2421, 2421, 2421, 2421, 2421, 2421, 2422, 2422, 2422, 2422, 2422, 2422, 2422, 2422, 2422, 2422, 2422, 2422, 2422, 2422, 2422,
-        2422, 2422, 2422, 2423, 2423, 2423, 2423, 2423, 2423, 2423, 2423, 2423, 2423, 2423, 2423, 2423, 2423, 2423, 2423, 2423, 2423, 2424, 2424, 2424, 2424, 2424,
-        2424, 2424, 2424, 2424, 2424, 2424, 2424, 2424, 2424, 2424, 2424, 2424, 2424, 2425, 2425, 2425, 2425, 2425, 2425, 2425, 2425, 2425, 2425, 2425, 2425, 2425,
-        2425, 2425, 2425, 2425, 2425, 2426, 2426, 2426, 2426, 2426, 2426, 2426, 2426, 2426, 2426, 2426, 2426, 2426, 2426, 2426, 2426, 2426, 2426, 2427, 2427, 2427,
-        2427, 2427, 2427, 2427, 2427, 2427, 2427, 2427, 2427, 2427, 2427, 2427, 2427, 2427, 2427, 2428, 2428, 2428, 2428, 2428, 2428, 2428, 2428, 2428, 2428, 2428,
-        2428, 2428, 2428, 2428, 2428, 2428, 2428, 2429, 2429, 2429, 2429, 2429, 2429, 2429, 2429, 2429, 2429, 2429, 2429, 2429, 2429, 2429, 2429, 2429, 2429, 2430,
-        2430, 2430, 2430, 2430, 2430, 2430, 2430, 2430, 2430, 2430, 2430, 2430, 2430, 2430, 2430, 2430, 2430, 2431, 2431, 2431, 2431, 2431, 2431, 2431, 2431, 2431,
-        2431, 2431, 2431, 2431, 2431, 2431, 2431, 2431, 2431, 2431, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432,
-        2432, 2432, 2433, 2433, 2433, 2433, 2433, 2433, 2433, 2433, 2433, 2433, 2433, 2433, 2433, 2433, 2433, 2433, 2433, 2433, 2434, 2434, 2434, 2434, 2434, 2434,
-        2434, 2434, 2434, 2434, 2434, 2434, 2434, 2434, 2434, 2434, 2434, 2434, 2435, 2435, 2435, 2435, 2435, 2435, 2435, 2435, 2435, 2435, 2435, 2435, 2435, 2435,
-        2435, 2435, 2435, 2435, 2436, 2436, 2436, 2436, 2436, 2436, 2436, 2436, 2436, 2436, 2436, 2436, 2436, 2436, 2436, 2436, 2436, 2436, 2437, 2437, 2437, 2437,
-        2437, 2437, 2437, 2437, 2437, 2437, 2437, 2437, 2437, 2437, 2437, 2437, 2437, 2437, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438,
-        2438, 2438, 2438, 2438, 2438, 2438, 2439, 2439, 2439, 2439, 2439, 2439, 2439, 2439, 2439, 2439, 2439, 2439, 2439, 2439, 2439, 2439, 2439, 2439, 2439, 2440,
-        2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2441, 2441, 2441, 2441, 2441, 2441, 2441, 2441, 2441,
-        2441, 2441, 2441, 2441, 2441, 2441, 2441, 2441, 2441, 2442, 2442, 2442, 2442, 2442, 2442, 2442, 2442, 2442, 2442, 2442, 2442, 2442, 2442, 2442, 2442, 2442,
-        2442, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2444, 2444, 2444, 2444, 2444, 2444, 2444,
-        2444, 2444, 2444, 2444, 2444, 2444, 2444, 2444, 2444, 2444, 2444, 2444, 2445, 2445, 2445, 2445, 2445, 2445, 2445, 2445, 2445, 2445, 2445, 2445, 2445, 2445,
-        2445, 2445, 2445, 2445, 2446, 2446, 2446, 2446, 2446, 2446, 2446, 2446, 2446, 2446, 2446, 2446, 2446, 2446, 2446, 2446, 2446, 2446, 2447, 2447, 2447, 2447,
-        2447, 2447, 2447, 2447, 2447, 2447, 2447, 2447, 2447, 2447, 2447, 2447, 2447, 2447, 2448, 2448, 2448, 2448, 2448, 2448, 2448, 2448, 2448, 2448, 2448, 2448,
-        2448, 2448, 2448, 2448, 2448, 2448, 2448, 2449, 2449, 2449, 2449, 2449, 2449, 2449, 2449, 2449, 2449, 2449, 2449, 2449, 2449, 2449, 2449, 2449, 2449, 2450,
-        2450, 2450, 2450, 2450, 2450, 2450, 2450, 2450, 2450, 2450, 2450, 2450, 2450, 2450, 2450, 2450, 2450, 2451, 2451, 2451, 2451, 2451, 2451, 2451, 2451, 2451,
-        2451, 2451, 2451, 2451, 2451, 2451, 2451, 2451, 2451, 2452, 2452, 2452, 2452, 2452, 2452, 2452, 2452, 2452, 2452, 2452, 2452, 2452, 2452, 2452, 2452, 2452,
-        2452, 2452, 2453, 2453, 2453, 2453, 2453, 2453, 2453, 2453, 2453, 2453, 2453, 2453, 2453, 2453, 2453, 2453, 2453, 2453, 2454, 2454, 2454, 2454, 2454, 2454,
-        2454, 2454, 2454, 2454, 2454, 2454, 2454, 2454, 2454, 2454, 2454, 2454, 2455, 2455, 2455, 2455, 2455, 2455, 2455, 2455, 2455, 2455, 2455, 2455, 2455, 2455,
-        2455, 2455, 2455, 2455, 2455, 2456, 2456, 2456, 2456, 2456, 2456, 2456, 2456, 2456, 2456, 2456, 2456, 2456, 2456, 2456, 2456, 2456, 2456, 2457, 2457, 2457,
-        2457, 2457, 2457, 2457, 2457, 2457, 2457, 2457, 2457, 2457, 2457, 2457, 2457, 2457, 2457, 2457, 2458, 2458, 2458, 2458, 2458, 2458, 2458, 2458, 2458, 2458,
-        2458, 2458, 2458, 2458, 2458, 2458, 2458, 2458, 2459, 2459, 2459, 2459, 2459, 2459, 2459, 2459, 2459, 2459, 2459, 2459, 2459, 2459, 2459, 2459, 2459, 2459,
-        2460, 2460, 2460, 2460, 2460, 2460, 2460, 2460, 2460, 2460, 2460, 2460, 2460, 2460, 2460, 2460, 2460, 2460, 2460, 2461, 2461, 2461, 2461, 2461, 2461, 2461,
-        2461, 2461, 2461, 2461, 2461, 2461, 2461, 2461, 2461, 2461, 2461, 2462, 2462, 2462, 2462, 2462, 2462, 2462, 2462, 2462, 2462, 2462, 2462, 2462, 2462, 2462,
-        2462, 2462, 2462, 2462, 2463, 2463, 2463, 2463, 2463, 2463, 2463, 2463, 2463, 2463, 2463, 2463, 2463, 2463, 2463, 2463, 2463, 2463, 2464, 2464, 2464, 2464,
-        2464, 2464, 2464, 2464, 2464, 2464, 2464, 2464, 2464, 2464, 2464, 2464, 2464, 2464, 2464, 2465, 2465, 2465, 2465, 2465, 2465, 2465, 2465, 2465, 2465, 2465,
-        2465, 2465, 2465, 2465, 2465, 2465, 2465, 2466, 2466, 2466, 2466, 2466, 2466, 2466, 2466, 2466, 2466, 2466, 2466, 2466, 2466, 2466, 2466, 2466, 2466, 2466,
-        2467, 2467, 2467, 2467, 2467, 2467, 2467, 2467, 2467, 2467, 2467, 2467, 2467, 2467, 2467, 2467, 2467, 2467, 2468, 2468, 2468, 2468, 2468, 2468, 2468, 2468,
-        2468, 2468, 2468, 2468, 2468, 2468, 2468, 2468, 2468, 2468, 2468, 2469, 2469, 2469, 2469, 2469, 2469, 2469, 2469, 2469, 2469, 2469, 2469, 2469, 2469, 2469,
-        2469, 2469, 2469, 2470, 2470, 2470, 2470, 2470, 2470, 2470, 2470, 2470, 2470, 2470, 2470, 2470, 2470, 2470, 2470, 2470, 2470, 2470, 2471, 2471, 2471, 2471,
-        2471, 2471, 2471, 2471, 2471, 2471, 2471, 2471, 2471, 2471, 2471, 2471, 2471, 2471, 2472, 2472, 2472, 2472, 2472, 2472, 2472, 2472, 2472, 2472, 2472, 2472,
-        2472, 2472, 2472, 2472, 2472, 2472, 2472, 2473, 2473, 2473, 2473, 2473, 2473, 2473, 2473, 2473, 2473, 2473, 2473, 2473, 2473, 2473, 2473, 2473, 2473, 2474,
-        2474, 2474, 2474, 2474, 2474, 2474, 2474, 2474, 2474, 2474, 2474, 2474, 2474, 2474, 2474, 2474, 2474, 2474, 2475, 2475, 2475, 2475, 2475, 2475, 2475, 2475,
-        2475, 2475, 2475, 2475, 2475, 2475, 2475, 2475, 2475, 2475, 2476, 2476, 2476, 2476, 2476, 2476, 2476, 2476, 2476, 2476, 2476, 2476, 2476, 2476, 2476, 2476,
-        2476, 2476, 2476, 2477, 2477, 2477, 2477, 2477, 2477, 2477, 2477, 2477, 2477, 2477, 2477, 2477, 2477, 2477, 2477, 2477, 2477, 2477, 2478, 2478, 2478, 2478,
-        2478, 2478, 2478, 2478, 2478, 2478, 2478, 2478, 2478, 2478, 2478, 2478, 2478, 2478, 2479, 2479, 2479, 2479, 2479, 2479, 2479, 2479, 2479, 2479, 2479, 2479,
-        2479, 2479, 2479, 2479, 2479, 2479, 2479, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480,
-        2481, 2481, 2481, 2481, 2481, 2481, 2481, 2481, 2481, 2481, 2481, 2481, 2481, 2481, 2481, 2481, 2481, 2481, 2482, 2482, 2482, 2482, 2482, 2482, 2482, 2482,
-        2482, 2482, 2482, 2482, 2482, 2482, 2482, 2482, 2482, 2482, 2482, 2483, 2483, 2483, 2483, 2483, 2483, 2483, 2483, 2483, 2483, 2483, 2483, 2483, 2483, 2483,
-        2483, 2483, 2483, 2483, 2484, 2484, 2484, 2484, 2484, 2484, 2484, 2484, 2484, 2484, 2484, 2484, 2484, 2484, 2484, 2484, 2484, 2484, 2485, 2485, 2485, 2485,
-        2485, 2485, 2485, 2485, 2485, 2485, 2485, 2485, 2485, 2485, 2485, 2485, 2485, 2485, 2485, 2486, 2486, 2486, 2486, 2486, 2486, 2486, 2486, 2486, 2486, 2486,
-        2486, 2486, 2486, 2486, 2486, 2486, 2486, 2486, 2487, 2487, 2487, 2487, 2487, 2487, 2487, 2487, 2487, 2487, 2487, 2487, 2487, 2487, 2487, 2487, 2487, 2487,
-        2487, 2488, 2488, 2488, 2488, 2488, 2488, 2488, 2488, 2488, 2488, 2488, 2488, 2488, 2488, 2488, 2488, 2488, 2488, 2489, 2489, 2489, 2489, 2489, 2489, 2489,
-        2489, 2489, 2489, 2489, 2489, 2489, 2489, 2489, 2489, 2489, 2489, 2489, 2490, 2490, 2490, 2490, 2490, 2490, 2490, 2490, 2490, 2490, 2490, 2490, 2490, 2490,
-        2490, 2490, 2490, 2490, 2490, 2491, 2491, 2491, 2491, 2491, 2491, 2491, 2491, 2491, 2491, 2491, 2491, 2491, 2491, 2491, 2491, 2491, 2491, 2491, 2492, 2492,
-        2492, 2492, 2492, 2492, 2492, 2492, 2492, 2492, 2492, 2492, 2492, 2492, 2492, 2492, 2492, 2492, 2493, 2493, 2493, 2493, 2493, 2493, 2493, 2493, 2493, 2493,
-        2493, 2493, 2493, 2493, 2493, 2493, 2493, 2493, 2493, 2494, 2494, 2494, 2494, 2494, 2494, 2494, 2494, 2494, 2494, 2494, 2494, 2494, 2494, 2494, 2494, 2494,
-        2494, 2494, 2495, 2495, 2495, 2495, 2495, 2495, 2495, 2495, 2495, 2495, 2495, 2495, 2495, 2495, 2495, 2495, 2495, 2495, 2495, 2496, 2496, 2496, 2496, 2496,
-        2496, 2496, 2496, 2496, 2496, 2496, 2496, 2496, 2496, 2496, 2496, 2496, 2496, 2496, 2497, 2497, 2497, 2497, 2497, 2497, 2497, 2497, 2497, 2497, 2497, 2497,
-        2497, 2497, 2497, 2497, 2497, 2497, 2497, 2498, 2498, 2498, 2498, 2498, 2498, 2498, 2498, 2498, 2498, 2498, 2498, 2498, 2498, 2498, 2498, 2498, 2498, 2498,
-        2499, 2499, 2499, 2499, 2499, 2499, 2499, 2499, 2499, 2499, 2499, 2499, 2499, 2499, 2499, 2499, 2499, 2499, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500,
-        2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2501, 2501, 2501, 2501, 2501, 2501, 2501, 2501, 2501, 2501, 2501, 2501, 2501, 2501, 2501,
-        2501, 2501, 2501, 2501, 2502, 2502, 2502, 2502, 2502, 2502, 2502, 2502, 2502, 2502, 2502, 2502, 2502, 2502, 2502, 2502, 2502, 2502, 2502, 2503, 2503, 2503,
-        2503, 2503, 2503, 2503, 2503, 2503, 2503, 2503, 2503, 2503, 2503, 2503, 2503, 2503, 2503, 2503, 2504, 2504, 2504, 2504, 2504, 2504, 2504, 2504, 2504, 2504,
-        2504, 2504, 2504, 2504, 2504, 2504, 2504, 2504, 2504, 2505, 2505, 2505, 2505, 2505, 2505, 2505, 2505, 2505, 2505, 2505, 2505, 2505, 2505, 2505, 2505, 2505,
-        2505, 2505, 2506, 2506, 2506, 2506, 2506, 2506, 2506, 2506, 2506, 2506, 2506, 2506, 2506, 2506, 2506, 2506, 2506, 2506, 2506, 2507, 2507, 2507, 2507, 2507,
-        2507, 2507, 2507, 2507, 2507, 2507, 2507, 2507, 2507, 2507, 2507, 2507, 2507, 2507, 2508, 2508, 2508, 2508, 2508, 2508, 2508, 2508, 2508, 2508, 2508, 2508,
-        2508, 2508, 2508, 2508, 2508, 2508, 2508, 2509, 2509, 2509, 2509, 2509, 2509, 2509, 2509, 2509, 2509, 2509, 2509, 2509, 2509, 2509, 2509, 2509, 2509, 2509,
-        2510, 2510, 2510, 2510, 2510, 2510, 2510, 2510, 2510, 2510, 2510, 2510, 2510, 2510, 2510, 2510, 2510, 2510, 2510, 2511, 2511, 2511, 2511, 2511, 2511, 2511,
-        2511, 2511, 2511, 2511, 2511, 2511, 2511, 2511, 2511, 2511, 2511, 2511, 2512, 2512, 2512, 2512, 2512, 2512, 2512, 2512, 2512, 2512, 2512, 2512, 2512, 2512,
-        2512, 2512, 2512, 2512, 2512, 2513, 2513, 2513, 2513, 2513, 2513, 2513, 2513, 2513, 2513, 2513, 2513, 2513, 2513, 2513, 2513, 2513, 2513, 2513, 2514, 2514,
-        2514, 2514, 2514, 2514, 2514, 2514, 2514, 2514, 2514, 2514, 2514, 2514, 2514, 2514, 2514, 2514, 2514, 2515, 2515, 2515, 2515, 2515, 2515, 2515, 2515, 2515,
-        2515, 2515, 2515, 2515, 2515, 2515, 2515, 2515, 2515, 2515, 2516, 2516, 2516, 2516, 2516, 2516, 2516, 2516, 2516, 2516, 2516, 2516, 2516, 2516, 2516, 2516,
-        2516, 2516, 2516, 2517, 2517, 2517, 2517, 2517, 2517, 2517, 2517, 2517, 2517, 2517, 2517, 2517, 2517, 2517, 2517, 2517, 2517, 2517, 2518, 2518, 2518, 2518,
-        2518, 2518, 2518, 2518, 2518, 2518, 2518, 2518, 2518, 2518, 2518, 2518, 2518, 2518, 2518, 2518, 2519, 2519, 2519, 2519, 2519, 2519, 2519, 2519, 2519, 2519,
-        2519, 2519, 2519, 2519, 2519, 2519, 2519, 2519, 2519, 2520, 2520, 2520, 2520, 2520, 2520, 2520, 2520, 2520, 2520, 2520, 2520, 2520, 2520, 2520, 2520, 2520,
-        2520, 2520, 2521, 2521, 2521, 2521, 2521, 2521, 2521, 2521, 2521, 2521, 2521, 2521, 2521, 2521, 2521, 2521, 2521, 2521, 2521, 2522, 2522, 2522, 2522, 2522,
-        2522, 2522, 2522, 2522, 2522, 2522, 2522, 2522, 2522, 2522, 2522, 2522, 2522, 2522, 2523, 2523, 2523, 2523, 2523, 2523, 2523, 2523, 2523, 2523, 2523, 2523,
-        2523, 2523, 2523, 2523, 2523, 2523, 2523, 2524, 2524, 2524, 2524, 2524, 2524, 2524, 2524, 2524, 2524, 2524, 2524, 2524, 2524, 2524, 2524, 2524, 2524, 2524,
-        2524, 2525, 2525, 2525, 2525, 2525, 2525, 2525, 2525, 2525, 2525, 2525, 2525, 2525, 2525, 2525, 2525, 2525, 2525, 2525, 2526, 2526, 2526, 2526, 2526, 2526,
-        2526, 2526, 2526, 2526, 2526, 2526, 2526, 2526, 2526, 2526, 2526, 2526, 2526, 2527, 2527, 2527, 2527, 2527, 2527, 2527, 2527, 2527, 2527, 2527, 2527, 2527,
-        2527, 2527, 2527, 2527, 2527, 2527, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2529,
-        2529, 2529, 2529, 2529, 2529, 2529, 2529, 2529, 2529, 2529, 2529, 2529, 2529, 2529, 2529, 2529, 2529, 2529, 2529, 2530, 2530, 2530, 2530, 2530, 2530, 2530,
-        2530, 2530, 2530, 2530, 2530, 2530, 2530, 2530, 2530, 2530, 2530, 2530, 2531, 2531, 2531, 2531, 2531, 2531, 2531, 2531, 2531, 2531, 2531, 2531, 2531, 2531,
-        2531, 2531, 2531, 2531, 2531, 2532, 2532, 2532, 2532, 2532, 2532, 2532, 2532, 2532, 2532, 2532, 2532, 2532, 2532, 2532, 2532, 2532, 2532, 2532, 2533, 2533,
-        2533, 2533, 2533, 2533, 2533, 2533, 2533, 2533, 2533, 2533, 2533, 2533, 2533, 2533, 2533, 2533, 2533, 2533, 2534, 2534, 2534, 2534, 2534, 2534, 2534, 2534,
-        2534, 2534, 2534, 2534, 2534, 2534, 2534, 2534, 2534, 2534, 2534, 2535, 2535, 2535, 2535, 2535, 2535, 2535, 2535, 2535, 2535, 2535, 2535, 2535, 2535, 2535,
-        2535, 2535, 2535, 2535, 2536, 2536, 2536, 2536, 2536, 2536, 2536, 2536, 2536, 2536, 2536, 2536, 2536, 2536, 2536, 2536, 2536, 2536, 2536, 2536, 2537, 2537,
-        2537, 2537, 2537, 2537, 2537, 2537, 2537, 2537, 2537, 2537, 2537, 2537, 2537, 2537, 2537, 2537, 2537, 2538, 2538, 2538, 2538, 2538, 2538, 2538, 2538, 2538,
-        2538, 2538, 2538, 2538, 2538, 2538, 2538, 2538, 2538, 2538, 2539, 2539, 2539, 2539, 2539, 2539, 2539, 2539, 2539, 2539, 2539, 2539, 2539, 2539, 2539, 2539,
-        2539, 2539, 2539, 2539, 2540, 2540, 2540, 2540, 2540, 2540, 2540, 2540, 2540, 2540, 2540, 2540, 2540, 2540, 2540, 2540, 2540, 2540, 2540, 2541, 2541, 2541,
-        2541, 2541, 2541, 2541, 2541, 2541, 2541, 2541, 2541, 2541, 2541, 2541, 2541, 2541, 2541, 2541, 2541, 2542, 2542, 2542, 2542, 2542, 2542, 2542, 2542, 2542,
-        2542, 2542, 2542, 2542, 2542, 2542, 2542, 2542, 2542, 2542, 2543, 2543, 2543, 2543, 2543, 2543, 2543, 2543, 2543, 2543, 2543, 2543, 2543, 2543, 2543, 2543,
-        2543, 2543, 2543, 2544, 2544, 2544, 2544, 2544, 2544, 2544, 2544, 2544, 2544, 2544, 2544, 2544, 2544, 2544, 2544, 2544, 2544, 2544, 2544, 2545, 2545, 2545,
-        2545, 2545, 2545, 2545, 2545, 2545, 2545, 2545, 2545, 2545, 2545, 2545, 2545, 2545, 2545, 2545, 2546, 2546, 2546, 2546, 2546, 2546, 2546, 2546, 2546, 2546,
-        2546, 2546, 2546, 2546, 2546, 2546, 2546, 2546, 2546, 2546, 2547, 2547, 2547, 2547, 2547, 2547, 2547, 2547, 2547, 2547, 2547, 2547, 2547, 2547, 2547, 2547,
-        2547, 2547, 2547, 2548, 2548, 2548, 2548, 2548, 2548, 2548, 2548, 2548, 2548, 2548, 2548, 2548, 2548, 2548, 2548, 2548, 2548, 2548, 2548, 2549, 2549, 2549,
-        2549, 2549, 2549, 2549, 2549, 2549, 2549, 2549, 2549, 2549, 2549, 2549, 2549, 2549, 2549, 2549, 2550, 2550, 2550, 2550, 2550, 2550, 2550, 2550, 2550, 2550,
-        2550, 2550, 2550, 2550, 2550, 2550, 2550, 2550, 2550, 2550, 2551, 2551, 2551, 2551, 2551, 2551, 2551, 2551, 2551, 2551, 2551, 2551, 2551, 2551, 2551, 2551,
-        2551, 2551, 2551, 2552, 2552, 2552, 2552, 2552, 2552, 2552, 2552, 2552, 2552, 2552, 2552, 2552, 2552, 2552, 2552, 2552, 2552, 2552, 2552, 2553, 2553, 2553,
-        2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2554, 2554, 2554, 2554, 2554, 2554, 2554, 2554, 2554, 2554,
-        2554, 2554, 2554, 2554, 2554, 2554, 2554, 2554, 2554, 2554, 2555, 2555, 2555, 2555, 2555, 2555, 2555, 2555, 2555, 2555, 2555, 2555, 2555, 2555, 2555, 2555,
-        2555, 2555, 2555, 2556, 2556, 2556, 2556, 2556, 2556, 2556, 2556, 2556, 2556, 2556, 2556, 2556, 2556, 2556, 2556, 2556, 2556, 2556, 2556, 2557, 2557, 2557,
-        2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2558, 2558, 2558, 2558, 2558, 2558, 2558, 2558, 2558,
-        2558, 2558, 2558, 2558, 2558, 2558, 2558, 2558, 2558, 2558, 2559, 2559, 2559, 2559, 2559, 2559, 2559, 2559, 2559, 2559, 2559, 2559, 2559, 2559, 2559, 2559,
-        2559, 2559, 2559, 2559, 2560, 2560, 2560, 2560, 2560, 2560, 2560, 2560, 2560, 2560, 2560, 2560, 2560, 2560, 2560, 2560, 2560, 2560, 2560, 2561, 2561, 2561,
-        2561, 2561, 2561, 2561, 2561, 2561, 2561, 2561, 2561, 2561, 2561, 2561, 2561, 2561, 2561, 2561, 2561, 2562, 2562, 2562, 2562, 2562, 2562, 2562, 2562, 2562,
-        2562, 2562, 2562, 2562, 2562, 2562, 2562, 2562, 2562, 2562, 2562, 2563, 2563, 2563, 2563, 2563, 2563, 2563, 2563, 2563, 2563, 2563, 2563, 2563, 2563, 2563,
-        2563, 2563, 2563, 2563, 2564, 2564, 2564, 2564, 2564, 2564, 2564, 2564, 2564, 2564, 2564, 2564, 2564, 2564, 2564, 2564, 2564, 2564, 2564, 2564, 2565, 2565,
-        2565, 2565, 2565, 2565, 2565, 2565, 2565, 2565, 2565, 2565, 2565, 2565, 2565, 2565, 2565, 2565, 2565, 2565, 2566, 2566, 2566, 2566, 2566, 2566, 2566, 2566,
-        2566, 2566, 2566, 2566, 2566, 2566, 2566, 2566, 2566, 2566, 2566, 2567, 2567, 2567, 2567, 2567, 2567, 2567, 2567, 2567, 2567, 2567, 2567, 2567, 2567, 2567,
-        2567, 2567, 2567, 2567, 2567, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2569,
-        2569, 2569, 2569, 2569, 2569, 2569, 2569, 2569, 2569, 2569, 2569, 2569, 2569, 2569, 2569, 2569, 2569, 2569, 2569, 2570, 2570, 2570, 2570, 2570, 2570, 2570,
-        2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570, 2571, 2571, 2571, 2571, 2571, 2571, 2571, 2571, 2571, 2571, 2571, 2571, 2571, 2571,
-        2571, 2571, 2571, 2571, 2571, 2571, 2572, 2572, 2572, 2572, 2572, 2572, 2572, 2572, 2572, 2572, 2572, 2572, 2572, 2572, 2572, 2572, 2572, 2572, 2572, 2572,
-        2573, 2573, 2573, 2573, 2573, 2573, 2573, 2573, 2573, 2573, 2573, 2573, 2573, 2573, 2573, 2573, 2573, 2573, 2573, 2573, 2574, 2574, 2574, 2574, 2574, 2574,
-        2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575, 2575,
-        2575, 2575, 2575, 2575, 2575, 2575, 2575, 2576, 2576, 2576, 2576, 2576, 2576, 2576, 2576, 2576, 2576, 2576, 2576, 2576, 2576, 2576, 2576, 2576, 2576, 2576,
-        2576, 2577, 2577, 2577, 2577, 2577, 2577, 2577, 2577, 2577, 2577, 2577, 2577, 2577, 2577, 2577, 2577, 2577, 2577, 2577, 2577, 2578, 2578, 2578, 2578, 2578,
-        2578, 2578, 2578, 2578, 2578, 2578, 2578, 2578, 2578, 2578, 2578, 2578, 2578, 2578, 2578, 2579, 2579, 2579, 2579, 2579, 2579, 2579, 2579, 2579, 2579, 2579,
-        2579, 2579, 2579, 2579, 2579, 2579, 2579, 2579, 2579, 2580, 2580, 2580, 2580, 2580, 2580, 2580, 2580, 2580, 2580, 2580, 2580, 2580, 2580, 2580, 2580, 2580,
-        2580, 2580, 2580, 2581, 2581, 2581, 2581, 2581, 2581, 2581, 2581, 2581, 2581, 2581, 2581, 2581, 2581, 2581, 2581, 2581, 2581, 2581, 2581, 2582, 2582, 2582,
-        2582, 2582, 2582, 2582, 2582, 2582, 2582, 2582, 2582, 2582, 2582, 2582, 2582, 2582, 2582, 2582, 2583, 2583, 2583, 2583, 2583, 2583, 2583, 2583, 2583, 2583,
-        2583, 2583, 2583, 2583, 2583, 2583, 2583, 2583, 2583, 2583, 2584, 2584, 2584, 2584, 2584, 2584, 2584, 2584, 2584, 2584, 2584, 2584, 2584, 2584, 2584, 2584,
-        2584, 2584, 2584, 2584, 2585, 2585, 2585, 2585, 2585, 2585, 2585, 2585, 2585, 2585, 2585, 2585, 2585, 2585, 2585, 2585, 2585, 2585, 2585, 2585, 2586, 2586,
-        2586, 2586, 2586, 2586, 2586, 2586, 2586, 2586, 2586, 2586, 2586, 2586, 2586, 2586, 2586, 2586, 2586, 2586, 2587, 2587, 2587, 2587, 2587, 2587, 2587, 2587,
-        2587, 2587, 2587, 2587, 2587, 2587, 2587, 2587, 2587, 2587, 2587, 2587, 2588, 2588, 2588, 2588, 2588, 2588, 2588, 2588, 2588, 2588, 2588, 2588, 2588, 2588,
-        2588, 2588, 2588, 2588, 2588, 2588, 2589, 2589, 2589, 2589, 2589, 2589, 2589, 2589, 2589, 2589, 2589, 2589, 2589, 2589, 2589, 2589, 2589, 2589, 2589, 2589,
-        2590, 2590, 2590, 2590, 2590, 2590, 2590, 2590, 2590, 2590, 2590, 2590, 2590, 2590, 2590, 2590, 2590, 2590, 2590, 2590, 2591, 2591, 2591, 2591, 2591, 2591,
-        2591, 2591, 2591, 2591, 2591, 2591, 2591, 2591, 2591, 2591, 2591, 2591, 2591, 2591, 2592, 2592, 2592, 2592, 2592, 2592, 2592, 2592, 2592, 2592, 2592, 2592,
-        2592, 2592, 2592, 2592, 2592, 2592, 2592, 2592, 2593, 2593, 2593, 2593, 2593, 2593, 2593, 2593, 2593, 2593, 2593, 2593, 2593, 2593, 2593, 2593, 2593, 2593,
-        2593, 2593, 2594, 2594, 2594, 2594, 2594, 2594, 2594, 2594, 2594, 2594, 2594, 2594, 2594, 2594, 2594, 2594, 2594, 2594, 2594, 2594, 2595, 2595, 2595, 2595,
-        2595, 2595, 2595, 2595, 2595, 2595, 2595, 2595, 2595, 2595, 2595, 2595, 2595, 2595, 2595, 2595, 2596, 2596, 2596, 2596, 2596, 2596, 2596, 2596, 2596, 2596,
-        2596, 2596, 2596, 2596, 2596, 2596, 2596, 2596, 2596, 2596, 2597, 2597, 2597, 2597, 2597, 2597, 2597, 2597, 2597, 2597, 2597, 2597, 2597, 2597, 2597, 2597,
-        2597, 2597, 2597, 2597, 2598, 2598, 2598, 2598, 2598, 2598, 2598, 2598, 2598, 2598, 2598, 2598, 2598, 2598, 2598, 2598, 2598, 2598, 2598, 2598, 2599, 2599,
-        2599, 2599, 2599, 2599, 2599, 2599, 2599, 2599, 2599, 2599, 2599, 2599, 2599, 2599, 2599, 2599, 2599, 2599, 2599, 2600, 2600, 2600, 2600, 2600, 2600, 2600,
-        2600, 2600, 2600, 2600, 2600, 2600, 2600, 2600, 2600, 2600, 2600, 2600, 2600, 2601, 2601, 2601, 2601, 2601, 2601, 2601, 2601, 2601, 2601, 2601, 2601, 2601,
-        2601, 2601, 2601, 2601, 2601, 2601, 2601, 2602, 2602, 2602, 2602, 2602, 2602, 2602, 2602, 2602, 2602, 2602, 2602, 2602, 2602, 2602, 2602, 2602, 2602, 2602,
-        2602, 2603, 2603, 2603, 2603, 2603, 2603, 2603, 2603, 2603, 2603, 2603, 2603, 2603, 2603, 2603, 2603, 2603, 2603, 2603, 2603, 2604, 2604, 2604, 2604, 2604,
-        2604, 2604, 2604, 2604, 2604, 2604, 2604, 2604, 2604, 2604, 2604, 2604, 2604, 2604, 2604, 2605, 2605, 2605, 2605, 2605, 2605, 2605, 2605, 2605, 2605, 2605,
-        2605, 2605, 2605, 2605, 2605, 2605, 2605, 2605, 2605, 2605, 2606, 2606, 2606, 2606, 2606, 2606, 2606, 2606, 2606, 2606, 2606, 2606, 2606, 2606, 2606, 2606,
-        2606, 2606, 2606, 2606, 2607, 2607, 2607, 2607, 2607, 2607, 2607, 2607, 2607, 2607, 2607, 2607, 2607, 2607, 2607, 2607, 2607, 2607, 2607, 2607, 2608, 2608,
-        2608, 2608, 2608, 2608, 2608, 2608, 2608, 2608, 2608, 2608, 2608, 2608, 2608, 2608, 2608, 2608, 2608, 2608, 2609, 2609, 2609, 2609, 2609, 2609, 2609, 2609,
-        2609, 2609, 2609, 2609, 2609, 2609, 2609, 2609, 2609, 2609, 2609, 2609, 2610, 2610, 2610, 2610, 2610, 2610, 2610, 2610, 2610, 2610, 2610, 2610, 2610, 2610,
-        2610, 2610, 2610, 2610, 2610, 2610, 2610, 2611, 2611, 2611, 2611, 2611, 2611, 2611, 2611, 2611, 2611, 2611, 2611, 2611, 2611, 2611, 2611, 2611, 2611, 2611,
-        2611, 2612, 2612, 2612, 2612, 2612, 2612, 2612, 2612, 2612, 2612, 2612, 2612, 2612, 2612, 2612, 2612, 2612, 2612, 2612, 2612, 2613, 2613, 2613, 2613, 2613,
-        2613, 2613, 2613, 2613, 2613, 2613, 2613, 2613, 2613, 2613, 2613, 2613, 2613, 2613, 2613, 2614, 2614, 2614, 2614, 2614, 2614, 2614, 2614, 2614, 2614, 2614,
-        2614, 2614, 2614, 2614, 2614, 2614, 2614, 2614, 2614, 2614, 2615, 2615, 2615, 2615, 2615, 2615, 2615, 2615, 2615, 2615, 2615, 2615, 2615, 2615, 2615, 2615,
-        2615, 2615, 2615, 2615, 2616, 2616, 2616, 2616, 2616, 2616, 2616, 2616, 2616, 2616, 2616, 2616, 2616, 2616, 2616, 2616, 2616, 2616, 2616, 2616, 2617, 2617,
-        2617, 2617, 2617, 2617, 2617, 2617, 2617, 2617, 2617, 2617, 2617, 2617, 2617, 2617, 2617, 2617, 2617, 2617, 2617, 2618, 2618, 2618, 2618, 2618, 2618, 2618,
-        2618, 2618, 2618, 2618, 2618, 2618, 2618, 2618, 2618, 2618, 2618, 2618, 2618, 2619, 2619, 2619, 2619, 2619, 2619, 2619, 2619, 2619, 2619, 2619, 2619, 2619,
-        2619, 2619, 2619, 2619, 2619, 2619, 2619, 2620, 2620, 2620, 2620, 2620, 2620, 2620, 2620, 2620, 2620, 2620, 2620, 2620, 2620, 2620, 2620, 2620, 2620, 2620,
-        2620, 2620, 2621, 2621, 2621, 2621, 2621, 2621, 2621, 2621, 2621, 2621, 2621, 2621, 2621, 2621, 2621, 2621, 2621, 2621, 2621, 2621, 2622, 2622, 2622, 2622,
-        2622, 2622, 2622, 2622, 2622, 2622, 2622, 2622, 2622, 2622, 2622, 2622, 2622, 2622, 2622, 2622, 2622, 2623, 2623, 2623, 2623, 2623, 2623, 2623, 2623, 2623,
-        2623, 2623, 2623, 2623, 2623, 2623, 2623, 2623, 2623, 2623, 2623, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
-        2624, 2624, 2624, 2624, 2624, 2625, 2625, 2625, 2625, 2625, 2625, 2625, 2625, 2625, 2625, 2625, 2625, 2625, 2625, 2625, 2625, 2625, 2625, 2625, 2625, 2625,
-        2626, 2626, 2626, 2626, 2626, 2626, 2626, 2626, 2626, 2626, 2626, 2626, 2626, 2626, 2626, 2626, 2626, 2626, 2626, 2626, 2627, 2627, 2627, 2627, 2627, 2627,
-        2627, 2627, 2627, 2627, 2627, 2627, 2627, 2627, 2627, 2627, 2627, 2627, 2627, 2627, 2627, 2628, 2628, 2628, 2628, 2628, 2628, 2628, 2628, 2628, 2628, 2628,
-        2628, 2628, 2628, 2628, 2628, 2628, 2628, 2628, 2628, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629,
-        2629, 2629, 2629, 2629, 2630, 2630, 2630, 2630, 2630, 2630, 2630, 2630, 2630, 2630, 2630, 2630, 2630, 2630, 2630, 2630, 2630, 2630, 2630, 2630, 2631, 2631,
-        2631, 2631, 2631, 2631, 2631, 2631, 2631, 2631, 2631, 2631, 2631, 2631, 2631, 2631, 2631, 2631, 2631, 2631, 2631, 2632, 2632, 2632, 2632, 2632, 2632, 2632,
-        2632, 2632, 2632, 2632, 2632, 2632, 2632, 2632, 2632, 2632, 2632, 2632, 2632, 2633, 2633, 2633, 2633, 2633, 2633, 2633, 2633, 2633, 2633, 2633, 2633, 2633,
-        2633, 2633, 2633, 2633, 2633, 2633, 2633, 2633, 2634, 2634, 2634, 2634, 2634, 2634, 2634, 2634, 2634, 2634, 2634, 2634, 2634, 2634, 2634, 2634, 2634, 2634,
-        2634, 2634, 2635, 2635, 2635, 2635, 2635, 2635, 2635, 2635, 2635, 2635, 2635, 2635, 2635, 2635, 2635, 2635, 2635, 2635, 2635, 2635, 2635, 2636, 2636, 2636,
-        2636, 2636, 2636, 2636, 2636, 2636, 2636, 2636, 2636, 2636, 2636, 2636, 2636, 2636, 2636, 2636, 2636, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637,
-        2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2638, 2638, 2638, 2638, 2638, 2638, 2638, 2638, 2638, 2638, 2638, 2638, 2638, 2638,
-        2638, 2638, 2638, 2638, 2638, 2638, 2638, 2639, 2639, 2639, 2639, 2639, 2639, 2639, 2639, 2639, 2639, 2639, 2639, 2639, 2639, 2639, 2639, 2639, 2639, 2639,
-        2639, 2640, 2640, 2640, 2640, 2640, 2640, 2640, 2640, 2640, 2640, 2640, 2640, 2640, 2640, 2640, 2640, 2640, 2640, 2640, 2640, 2640, 2641, 2641, 2641, 2641,
-        2641, 2641, 2641, 2641, 2641, 2641, 2641, 2641, 2641, 2641, 2641, 2641, 2641, 2641, 2641, 2641, 2642, 2642, 2642, 2642, 2642, 2642, 2642, 2642, 2642, 2642,
-        2642, 2642, 2642, 2642, 2642, 2642, 2642, 2642, 2642, 2642, 2642, 2643, 2643, 2643, 2643, 2643, 2643, 2643, 2643, 2643, 2643, 2643, 2643, 2643, 2643, 2643,
-        2643, 2643, 2643, 2643, 2643, 2643, 2644, 2644, 2644, 2644, 2644, 2644, 2644, 2644, 2644, 2644, 2644, 2644, 2644, 2644, 2644, 2644, 2644, 2644, 2644, 2644,
-        2645, 2645, 2645, 2645, 2645, 2645, 2645, 2645, 2645, 2645, 2645, 2645, 2645, 2645, 2645, 2645, 2645, 2645, 2645, 2645, 2645, 2646, 2646, 2646, 2646, 2646,
-        2646, 2646, 2646, 2646, 2646, 2646, 2646, 2646, 2646, 2646, 2646, 2646, 2646, 2646, 2646, 2646, 2647, 2647, 2647, 2647, 2647, 2647, 2647, 2647, 2647, 2647,
-        2647, 2647, 2647, 2647, 2647, 2647, 2647, 2647, 2647, 2647, 2648, 2648, 2648, 2648, 2648, 2648, 2648, 2648, 2648, 2648, 2648, 2648, 2648, 2648, 2648, 2648,
-        2648, 2648, 2648, 2648, 2648, 2649, 2649, 2649, 2649, 2649, 2649, 2649, 2649, 2649, 2649, 2649, 2649, 2649, 2649, 2649, 2649, 2649, 2649, 2649, 2649, 2649,
-        2650, 2650, 2650, 2650, 2650, 2650, 2650, 2650, 2650, 2650, 2650, 2650, 2650, 2650, 2650, 2650, 2650, 2650, 2650, 2650, 2650, 2651, 2651, 2651, 2651, 2651,
-        2651, 2651, 2651, 2651, 2651, 2651, 2651, 2651, 2651, 2651, 2651, 2651, 2651, 2651, 2651, 2652, 2652, 2652, 2652, 2652, 2652, 2652, 2652, 2652, 2652, 2652,
-        2652, 2652, 2652, 2652, 2652, 2652, 2652, 2652, 2652, 2652, 2653, 2653, 2653, 2653, 2653, 2653, 2653, 2653, 2653, 2653, 2653, 2653, 2653, 2653, 2653, 2653,
-        2653, 2653, 2653, 2653, 2653, 2654, 2654, 2654, 2654, 2654, 2654, 2654, 2654, 2654, 2654, 2654, 2654, 2654, 2654, 2654, 2654, 2654, 2654, 2654, 2654, 2654,
-        2655, 2655, 2655, 2655, 2655, 2655, 2655, 2655, 2655, 2655, 2655, 2655, 2655, 2655, 2655, 2655, 2655, 2655, 2655, 2655, 2655, 2656, 2656, 2656, 2656, 2656,
-        2656, 2656, 2656, 2656, 2656, 2656, 2656, 2656, 2656, 2656, 2656, 2656, 2656, 2656, 2656, 2657, 2657, 2657, 2657, 2657, 2657, 2657, 2657, 2657, 2657, 2657,
-        2657, 2657, 2657, 2657, 2657, 2657, 2657, 2657, 2657, 2657, 2658, 2658, 2658, 2658, 2658, 2658, 2658, 2658, 2658, 2658, 2658, 2658, 2658, 2658, 2658, 2658,
-        2658, 2658, 2658, 2658, 2658, 2659, 2659, 2659, 2659, 2659, 2659, 2659, 2659, 2659, 2659, 2659, 2659, 2659, 2659, 2659, 2659, 2659, 2659, 2659, 2659, 2659,
-        2660, 2660, 2660, 2660, 2660, 2660, 2660, 2660, 2660, 2660, 2660, 2660, 2660, 2660, 2660, 2660, 2660, 2660, 2660, 2660, 2660, 2661, 2661, 2661, 2661, 2661,
-        2661, 2661, 2661, 2661, 2661, 2661, 2661, 2661, 2661, 2661, 2661, 2661, 2661, 2661, 2661, 2661, 2662, 2662, 2662, 2662, 2662, 2662, 2662, 2662, 2662, 2662,
-        2662, 2662, 2662, 2662, 2662, 2662, 2662, 2662, 2662, 2662, 2662, 2663, 2663, 2663, 2663, 2663, 2663, 2663, 2663, 2663, 2663, 2663, 2663, 2663, 2663, 2663,
-        2663, 2663, 2663, 2663, 2663, 2663, 2664, 2664, 2664, 2664, 2664, 2664, 2664, 2664, 2664, 2664, 2664, 2664, 2664, 2664, 2664, 2664, 2664, 2664, 2664, 2664,
-        2665, 2665, 2665, 2665, 2665, 2665, 2665, 2665, 2665, 2665, 2665, 2665, 2665, 2665, 2665, 2665, 2665, 2665, 2665, 2665, 2665, 2666, 2666, 2666, 2666, 2666,
-        2666, 2666, 2666, 2666, 2666, 2666, 2666, 2666, 2666, 2666, 2666, 2666, 2666, 2666, 2666, 2666, 2667, 2667, 2667, 2667, 2667, 2667, 2667, 2667, 2667, 2667,
-        2667, 2667, 2667, 2667, 2667, 2667, 2667, 2667, 2667, 2667, 2667, 2668, 2668, 2668, 2668, 2668, 2668, 2668, 2668, 2668, 2668, 2668, 2668, 2668, 2668, 2668,
-        2668, 2668, 2668, 2668, 2668, 2668, 2669, 2669, 2669, 2669, 2669, 2669, 2669, 2669, 2669, 2669, 2669, 2669, 2669, 2669, 2669, 2669, 2669, 2669, 2669, 2669,
-        2669, 2670, 2670, 2670, 2670, 2670, 2670, 2670, 2670, 2670, 2670, 2670, 2670, 2670, 2670, 2670, 2670, 2670, 2670, 2670, 2670, 2670, 2671, 2671, 2671, 2671,
-        2671, 2671, 2671, 2671, 2671, 2671, 2671, 2671, 2671, 2671, 2671, 2671, 2671, 2671, 2671, 2671, 2671, 2672, 2672, 2672, 2672, 2672, 2672, 2672, 2672, 2672,
-        2672, 2672, 2672, 2672, 2672, 2672, 2672, 2672, 2672, 2672, 2672, 2672, 2673, 2673, 2673, 2673, 2673, 2673, 2673, 2673, 2673, 2673, 2673, 2673, 2673, 2673,
-        2673, 2673, 2673, 2673, 2673, 2673, 2673, 2674, 2674, 2674, 2674, 2674, 2674, 2674, 2674, 2674, 2674, 2674, 2674, 2674, 2674, 2674, 2674, 2674, 2674, 2674,
-        2674, 2674, 2675, 2675, 2675, 2675, 2675, 2675, 2675, 2675, 2675, 2675, 2675, 2675, 2675, 2675, 2675, 2675, 2675, 2675, 2675, 2675, 2675, 2676, 2676, 2676,
-        2676, 2676, 2676, 2676, 2676, 2676, 2676, 2676, 2676, 2676, 2676, 2676, 2676, 2676, 2676, 2676, 2676, 2676, 2677, 2677, 2677, 2677, 2677, 2677, 2677, 2677,
-        2677, 2677, 2677, 2677, 2677, 2677, 2677, 2677, 2677, 2677, 2677, 2677, 2677, 2677, 2678, 2678, 2678, 2678, 2678, 2678, 2678, 2678, 2678, 2678, 2678, 2678,
-        2678, 2678, 2678, 2678, 2678, 2678, 2678, 2678, 2678, 2679, 2679, 2679, 2679, 2679, 2679, 2679, 2679, 2679, 2679, 2679, 2679, 2679, 2679, 2679, 2679, 2679,
-        2679, 2679, 2679, 2679, 2680, 2680, 2680, 2680, 2680, 2680, 2680, 2680, 2680, 2680, 2680, 2680, 2680, 2680, 2680, 2680, 2680, 2680, 2680, 2680, 2680, 2681,
-        2681, 2681, 2681, 2681, 2681, 2681, 2681, 2681, 2681, 2681, 2681, 2681, 2681, 2681, 2681, 2681, 2681, 2681, 2681, 2681, 2682, 2682, 2682, 2682, 2682, 2682,
-        2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682, 2683, 2683, 2683, 2683, 2683, 2683, 2683, 2683, 2683, 2683, 2683,
-        2683, 2683, 2683, 2683, 2683, 2683, 2683, 2683, 2683, 2683, 2684, 2684, 2684, 2684, 2684, 2684, 2684, 2684, 2684, 2684, 2684, 2684, 2684, 2684, 2684, 2684,
-        2684, 2684, 2684, 2684, 2684, 2685, 2685, 2685, 2685, 2685, 2685, 2685, 2685, 2685, 2685, 2685, 2685, 2685, 2685, 2685, 2685, 2685, 2685, 2685, 2685, 2685,
-        2685, 2686, 2686, 2686, 2686, 2686, 2686, 2686, 2686, 2686, 2686, 2686, 2686, 2686, 2686, 2686, 2686, 2686, 2686, 2686, 2686, 2686, 2687, 2687, 2687, 2687,
-        2687, 2687, 2687, 2687, 2687, 2687, 2687, 2687, 2687, 2687, 2687, 2687, 2687, 2687, 2687, 2687, 2687, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688,
-        2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2689, 2689, 2689, 2689, 2689, 2689, 2689, 2689, 2689, 2689, 2689, 2689, 2689, 2689,
-        2689, 2689, 2689, 2689, 2689, 2689, 2689, 2689, 2690, 2690, 2690, 2690, 2690, 2690, 2690, 2690, 2690, 2690, 2690, 2690, 2690, 2690, 2690, 2690, 2690, 2690,
-        2690, 2690, 2690, 2691, 2691, 2691, 2691, 2691, 2691, 2691, 2691, 2691, 2691, 2691, 2691, 2691, 2691, 2691, 2691, 2691, 2691, 2691, 2691, 2691, 2692, 2692,
-        2692, 2692, 2692, 2692, 2692, 2692, 2692, 2692, 2692, 2692, 2692, 2692, 2692, 2692, 2692, 2692, 2692, 2692, 2692, 2693, 2693, 2693, 2693, 2693, 2693, 2693,
-        2693, 2693, 2693, 2693, 2693, 2693, 2693, 2693, 2693, 2693, 2693, 2693, 2693, 2693, 2693, 2694, 2694, 2694, 2694, 2694, 2694, 2694, 2694, 2694, 2694, 2694,
-        2694, 2694, 2694, 2694, 2694, 2694, 2694, 2694, 2694, 2694, 2695, 2695, 2695, 2695, 2695, 2695, 2695, 2695, 2695, 2695, 2695, 2695, 2695, 2695, 2695, 2695,
-        2695, 2695, 2695, 2695, 2695, 2696, 2696, 2696, 2696, 2696, 2696, 2696, 2696, 2696, 2696, 2696, 2696, 2696, 2696, 2696, 2696, 2696, 2696, 2696, 2696, 2696,
-        2696, 2697, 2697, 2697, 2697, 2697, 2697, 2697, 2697, 2697, 2697, 2697, 2697, 2697, 2697, 2697, 2697, 2697, 2697, 2697, 2697, 2697, 2698, 2698, 2698, 2698,
-        2698, 2698, 2698, 2698, 2698, 2698, 2698, 2698, 2698, 2698, 2698, 2698, 2698, 2698, 2698, 2698, 2698, 2699, 2699, 2699, 2699, 2699, 2699, 2699, 2699, 2699,
-        2699, 2699, 2699, 2699, 2699, 2699, 2699, 2699, 2699, 2699, 2699, 2699, 2699, 2700, 2700, 2700, 2700, 2700, 2700, 2700, 2700, 2700, 2700, 2700, 2700, 2700,
-        2700, 2700, 2700, 2700, 2700, 2700, 2700, 2700, 2701, 2701, 2701, 2701, 2701, 2701, 2701, 2701, 2701, 2701, 2701, 2701, 2701, 2701, 2701, 2701, 2701, 2701,
-        2701, 2701, 2701, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2703,
-        2703, 2703, 2703, 2703, 2703, 2703, 2703, 2703, 2703, 2703, 2703, 2703, 2703, 2703, 2703, 2703, 2703, 2703, 2703, 2703, 2704, 2704, 2704, 2704, 2704, 2704,
-        2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2705, 2705, 2705, 2705, 2705, 2705, 2705, 2705, 2705, 2705,
-        2705, 2705, 2705, 2705, 2705, 2705, 2705, 2705, 2705, 2705, 2705, 2706, 2706, 2706, 2706, 2706, 2706, 2706, 2706, 2706, 2706, 2706, 2706, 2706, 2706, 2706,
-        2706, 2706, 2706, 2706, 2706, 2706, 2707, 2707, 2707, 2707, 2707, 2707, 2707, 2707, 2707, 2707, 2707, 2707, 2707, 2707, 2707, 2707, 2707, 2707, 2707, 2707,
-        2707, 2707, 2708, 2708, 2708, 2708, 2708, 2708, 2708, 2708, 2708, 2708, 2708, 2708, 2708, 2708, 2708, 2708, 2708, 2708, 2708, 2708, 2708, 2709, 2709, 2709,
-        2709, 2709, 2709, 2709, 2709, 2709, 2709, 2709, 2709, 2709, 2709, 2709, 2709, 2709, 2709, 2709, 2709, 2709, 2709, 2710, 2710, 2710, 2710, 2710, 2710, 2710,
-        2710, 2710, 2710, 2710, 2710, 2710, 2710, 2710, 2710, 2710, 2710, 2710, 2710, 2710, 2711, 2711, 2711, 2711, 2711, 2711, 2711, 2711, 2711, 2711, 2711, 2711,
-        2711, 2711, 2711, 2711, 2711, 2711, 2711, 2711, 2711, 2711, 2712, 2712, 2712, 2712, 2712, 2712, 2712, 2712, 2712, 2712, 2712, 2712, 2712, 2712, 2712, 2712,
-        2712, 2712, 2712, 2712, 2712, 2713, 2713, 2713, 2713, 2713, 2713, 2713, 2713, 2713, 2713, 2713, 2713, 2713, 2713, 2713, 2713, 2713, 2713, 2713, 2713, 2713,
-        2713, 2714, 2714, 2714, 2714, 2714, 2714, 2714, 2714, 2714, 2714, 2714, 2714, 2714, 2714, 2714, 2714, 2714, 2714, 2714, 2714, 2714, 2714, 2715, 2715, 2715,
-        2715, 2715, 2715, 2715, 2715, 2715, 2715, 2715, 2715, 2715, 2715, 2715, 2715, 2715, 2715, 2715, 2715, 2715, 2716, 2716, 2716, 2716, 2716, 2716, 2716, 2716,
-        2716, 2716, 2716, 2716, 2716, 2716, 2716, 2716, 2716, 2716, 2716, 2716, 2716, 2716, 2717, 2717, 2717, 2717, 2717, 2717, 2717, 2717, 2717, 2717, 2717, 2717,
-        2717, 2717, 2717, 2717, 2717, 2717, 2717, 2717, 2717, 2718, 2718, 2718, 2718, 2718, 2718, 2718, 2718, 2718, 2718, 2718, 2718, 2718, 2718, 2718, 2718, 2718,
-        2718, 2718, 2718, 2718, 2718, 2719, 2719, 2719, 2719, 2719, 2719, 2719, 2719, 2719, 2719, 2719, 2719, 2719, 2719, 2719, 2719, 2719, 2719, 2719, 2719, 2719,
-        2720, 2720, 2720, 2720, 2720, 2720, 2720, 2720, 2720, 2720, 2720, 2720, 2720, 2720, 2720, 2720, 2720, 2720, 2720, 2720, 2720, 2720, 2721, 2721, 2721, 2721,
-        2721, 2721, 2721, 2721, 2721, 2721, 2721, 2721, 2721, 2721, 2721, 2721, 2721, 2721, 2721, 2721, 2721, 2721, 2722, 2722, 2722, 2722, 2722, 2722, 2722, 2722,
-        2722, 2722, 2722, 2722, 2722, 2722, 2722, 2722, 2722, 2722, 2722, 2722, 2722, 2723, 2723, 2723, 2723, 2723, 2723, 2723, 2723, 2723, 2723, 2723, 2723, 2723,
-        2723, 2723, 2723, 2723, 2723, 2723, 2723, 2723, 2723, 2724, 2724, 2724, 2724, 2724, 2724, 2724, 2724, 2724, 2724, 2724, 2724, 2724, 2724, 2724, 2724, 2724,
-        2724, 2724, 2724, 2724, 2724, 2725, 2725, 2725, 2725, 2725, 2725, 2725, 2725, 2725, 2725, 2725, 2725, 2725, 2725, 2725, 2725, 2725, 2725, 2725, 2725, 2725,
-        2726, 2726, 2726, 2726, 2726, 2726, 2726, 2726, 2726, 2726, 2726, 2726, 2726, 2726, 2726, 2726, 2726, 2726, 2726, 2726, 2726, 2726, 2727, 2727, 2727, 2727,
-        2727, 2727, 2727, 2727, 2727, 2727, 2727, 2727, 2727, 2727, 2727, 2727, 2727, 2727, 2727, 2727, 2727, 2727, 2728, 2728, 2728, 2728, 2728, 2728, 2728, 2728,
-        2728, 2728, 2728, 2728, 2728, 2728, 2728, 2728, 2728, 2728, 2728, 2728, 2728, 2728, 2729, 2729, 2729, 2729, 2729, 2729, 2729, 2729, 2729, 2729, 2729, 2729,
-        2729, 2729, 2729, 2729, 2729, 2729, 2729, 2729, 2729, 2730, 2730, 2730, 2730, 2730, 2730, 2730, 2730, 2730, 2730, 2730, 2730, 2730, 2730, 2730, 2730, 2730,
-        2730, 2730, 2730, 2730, 2730, 2731, 2731, 2731, 2731, 2731, 2731, 2731, 2731, 2731, 2731, 2731, 2731, 2731, 2731, 2731, 2731, 2731, 2731, 2731, 2731, 2731,
-        2731, 2732, 2732, 2732, 2732, 2732, 2732, 2732, 2732, 2732, 2732, 2732, 2732, 2732, 2732, 2732, 2732, 2732, 2732, 2732, 2732, 2732, 2732, 2733, 2733, 2733,
-        2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2734, 2734, 2734, 2734, 2734, 2734, 2734, 2734,
-        2734, 2734, 2734, 2734, 2734, 2734, 2734, 2734, 2734, 2734, 2734, 2734, 2734, 2734, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735,
-        2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736,
-        2736, 2736, 2736, 2736, 2736, 2736, 2737, 2737, 2737, 2737, 2737, 2737, 2737, 2737, 2737, 2737, 2737, 2737, 2737, 2737, 2737, 2737, 2737, 2737, 2737, 2737,
-        2737, 2737, 2738, 2738, 2738, 2738, 2738, 2738, 2738, 2738, 2738, 2738, 2738, 2738, 2738, 2738, 2738, 2738, 2738, 2738, 2738, 2738, 2738, 2738, 2739, 2739,
-        2739, 2739, 2739, 2739, 2739, 2739, 2739, 2739, 2739, 2739, 2739, 2739, 2739, 2739, 2739, 2739, 2739, 2739, 2739, 2740, 2740, 2740, 2740, 2740, 2740, 2740,
-        2740, 2740, 2740, 2740, 2740, 2740, 2740, 2740, 2740, 2740, 2740, 2740, 2740, 2740, 2740, 2741, 2741, 2741, 2741, 2741, 2741, 2741, 2741, 2741, 2741, 2741,
-        2741, 2741, 2741, 2741, 2741, 2741, 2741, 2741, 2741, 2741, 2741, 2742, 2742, 2742, 2742, 2742, 2742, 2742, 2742, 2742, 2742, 2742, 2742, 2742, 2742, 2742,
-        2742, 2742, 2742, 2742, 2742, 2742, 2742, 2743, 2743, 2743, 2743, 2743, 2743, 2743, 2743, 2743, 2743, 2743, 2743, 2743, 2743, 2743, 2743, 2743, 2743, 2743,
-        2743, 2743, 2743, 2744, 2744, 2744, 2744, 2744, 2744, 2744, 2744, 2744, 2744, 2744, 2744, 2744, 2744, 2744, 2744, 2744, 2744, 2744, 2744, 2744, 2744, 2745,
-        2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2746, 2746, 2746, 2746, 2746,
-        2746, 2746, 2746, 2746, 2746, 2746, 2746, 2746, 2746, 2746, 2746, 2746, 2746, 2746, 2746, 2746, 2746, 2747, 2747, 2747, 2747, 2747, 2747, 2747, 2747, 2747,
-        2747, 2747, 2747, 2747, 2747, 2747, 2747, 2747, 2747, 2747, 2747, 2747, 2747, 2748, 2748, 2748, 2748, 2748, 2748, 2748, 2748, 2748, 2748, 2748, 2748, 2748,
-        2748, 2748, 2748, 2748, 2748, 2748, 2748, 2748, 2748, 2749, 2749, 2749, 2749, 2749, 2749, 2749, 2749, 2749, 2749, 2749, 2749, 2749, 2749, 2749, 2749, 2749,
-        2749, 2749, 2749, 2749, 2749, 2750, 2750, 2750, 2750, 2750, 2750, 2750, 2750, 2750, 2750, 2750, 2750, 2750, 2750, 2750, 2750, 2750, 2750, 2750, 2750, 2750,
-        2750, 2751, 2751, 2751, 2751, 2751, 2751, 2751, 2751, 2751, 2751, 2751, 2751, 2751, 2751, 2751, 2751, 2751, 2751, 2751, 2751, 2751, 2751, 2752, 2752, 2752,
-        2752, 2752, 2752, 2752, 2752, 2752, 2752, 2752, 2752, 2752, 2752, 2752, 2752, 2752, 2752, 2752, 2752, 2752, 2752, 2753, 2753, 2753, 2753, 2753, 2753, 2753,
-        2753, 2753, 2753, 2753, 2753, 2753, 2753, 2753, 2753, 2753, 2753, 2753, 2753, 2753, 2753, 2754, 2754, 2754, 2754, 2754, 2754, 2754, 2754, 2754, 2754, 2754,
-        2754, 2754, 2754, 2754, 2754, 2754, 2754, 2754, 2754, 2754, 2754, 2755, 2755, 2755, 2755, 2755, 2755, 2755, 2755, 2755, 2755, 2755, 2755, 2755, 2755, 2755,
-        2755, 2755, 2755, 2755, 2755, 2755, 2755, 2756, 2756, 2756, 2756, 2756, 2756, 2756, 2756, 2756, 2756, 2756, 2756, 2756, 2756, 2756, 2756, 2756, 2756, 2756,
-        2756, 2756, 2756, 2757, 2757, 2757, 2757, 2757, 2757, 2757, 2757, 2757, 2757, 2757, 2757, 2757, 2757, 2757, 2757, 2757, 2757, 2757, 2757, 2757, 2757, 2758,
-        2758, 2758, 2758, 2758, 2758, 2758, 2758, 2758, 2758, 2758, 2758, 2758, 2758, 2758, 2758, 2758, 2758, 2758, 2758, 2758, 2758, 2759, 2759, 2759, 2759, 2759,
-        2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2759, 2760, 2760, 2760, 2760, 2760, 2760, 2760, 2760,
-        2760, 2760, 2760, 2760, 2760, 2760, 2760, 2760, 2760, 2760, 2760, 2760, 2760, 2760, 2761, 2761, 2761, 2761, 2761, 2761, 2761, 2761, 2761, 2761, 2761, 2761,
-        2761, 2761, 2761, 2761, 2761, 2761, 2761, 2761, 2761, 2761, 2762, 2762, 2762, 2762, 2762, 2762, 2762, 2762, 2762, 2762, 2762, 2762, 2762, 2762, 2762, 2762,
-        2762, 2762, 2762, 2762, 2762, 2762, 2763, 2763, 2763, 2763, 2763, 2763, 2763, 2763, 2763, 2763, 2763, 2763, 2763, 2763, 2763, 2763, 2763, 2763, 2763, 2763,
-        2763, 2763, 2764, 2764, 2764, 2764, 2764, 2764, 2764, 2764, 2764, 2764, 2764, 2764, 2764, 2764, 2764, 2764, 2764, 2764, 2764, 2764, 2764, 2764, 2765, 2765,
-        2765, 2765, 2765, 2765, 2765, 2765, 2765, 2765, 2765, 2765, 2765, 2765, 2765, 2765, 2765, 2765, 2765, 2765, 2765, 2765, 2765, 2766, 2766, 2766, 2766, 2766,
-        2766, 2766, 2766, 2766, 2766, 2766, 2766, 2766, 2766, 2766, 2766, 2766, 2766, 2766, 2766, 2766, 2766, 2767, 2767, 2767, 2767, 2767, 2767, 2767, 2767, 2767,
-        2767, 2767, 2767, 2767, 2767, 2767, 2767, 2767, 2767, 2767, 2767, 2767, 2767, 2768, 2768, 2768, 2768, 2768, 2768, 2768, 2768, 2768, 2768, 2768, 2768, 2768,
-        2768, 2768, 2768, 2768, 2768, 2768, 2768, 2768, 2768, 2769, 2769, 2769, 2769, 2769, 2769, 2769, 2769, 2769, 2769, 2769, 2769, 2769, 2769, 2769, 2769, 2769,
-        2769, 2769, 2769, 2769, 2769, 2769, 2770, 2770, 2770, 2770, 2770, 2770, 2770, 2770, 2770, 2770, 2770, 2770, 2770, 2770, 2770, 2770, 2770, 2770, 2770, 2770,
-        2770, 2770, 2771, 2771, 2771, 2771, 2771, 2771, 2771, 2771, 2771, 2771, 2771, 2771, 2771, 2771, 2771, 2771, 2771, 2771, 2771, 2771, 2771, 2771, 2772, 2772,
-        2772, 2772, 2772, 2772, 2772, 2772, 2772, 2772, 2772, 2772, 2772, 2772, 2772, 2772, 2772, 2772, 2772, 2772, 2772, 2772, 2773, 2773, 2773, 2773, 2773, 2773,
-        2773, 2773, 2773, 2773, 2773, 2773, 2773, 2773, 2773, 2773, 2773, 2773, 2773, 2773, 2773, 2773, 2773, 2774, 2774, 2774, 2774, 2774, 2774, 2774, 2774, 2774,
-        2774, 2774, 2774, 2774, 2774, 2774, 2774, 2774, 2774, 2774, 2774, 2774, 2774, 2775, 2775, 2775, 2775, 2775, 2775, 2775, 2775, 2775, 2775, 2775, 2775, 2775,
-        2775, 2775, 2775, 2775, 2775, 2775, 2775, 2775, 2775, 2776, 2776, 2776, 2776, 2776, 2776, 2776, 2776, 2776, 2776, 2776, 2776, 2776, 2776, 2776, 2776, 2776,
-        2776, 2776, 2776, 2776, 2776, 2776, 2777, 2777, 2777, 2777, 2777, 2777, 2777, 2777, 2777, 2777, 2777, 2777, 2777, 2777, 2777, 2777, 2777, 2777, 2777, 2777,
-        2777, 2777, 2778, 2778, 2778, 2778, 2778, 2778, 2778, 2778, 2778, 2778, 2778, 2778, 2778, 2778, 2778, 2778, 2778, 2778, 2778, 2778, 2778, 2778, 2779, 2779,
-        2779, 2779, 2779, 2779, 2779, 2779, 2779, 2779, 2779, 2779, 2779, 2779, 2779, 2779, 2779, 2779, 2779, 2779, 2779, 2779, 2779, 2780, 2780, 2780, 2780, 2780,
-        2780, 2780, 2780, 2780, 2780, 2780, 2780, 2780, 2780, 2780, 2780, 2780, 2780, 2780, 2780, 2780, 2780, 2781, 2781, 2781, 2781, 2781, 2781, 2781, 2781, 2781,
-        2781, 2781, 2781, 2781, 2781, 2781, 2781, 2781, 2781, 2781, 2781, 2781, 2781, 2781, 2782, 2782, 2782, 2782, 2782, 2782, 2782, 2782, 2782, 2782, 2782, 2782,
-        2782, 2782, 2782, 2782, 2782, 2782, 2782, 2782, 2782, 2782, 2783, 2783, 2783, 2783, 2783, 2783, 2783, 2783, 2783, 2783, 2783, 2783, 2783, 2783, 2783, 2783,
-        2783, 2783, 2783, 2783, 2783, 2783, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784,
-        2784, 2784, 2784, 2785, 2785, 2785, 2785, 2785, 2785, 2785, 2785, 2785, 2785, 2785, 2785, 2785, 2785, 2785, 2785, 2785, 2785, 2785, 2785, 2785, 2785, 2786,
-        2786, 2786, 2786, 2786, 2786, 2786, 2786, 2786, 2786, 2786, 2786, 2786, 2786, 2786, 2786, 2786, 2786, 2786, 2786, 2786, 2786, 2786, 2787, 2787, 2787, 2787,
-        2787, 2787, 2787, 2787, 2787, 2787, 2787, 2787, 2787, 2787, 2787, 2787, 2787, 2787, 2787, 2787, 2787, 2787, 2788, 2788, 2788, 2788, 2788, 2788, 2788, 2788,
-        2788, 2788, 2788, 2788, 2788, 2788, 2788, 2788, 2788, 2788, 2788, 2788, 2788, 2788, 2788, 2789, 2789, 2789, 2789, 2789, 2789, 2789, 2789, 2789, 2789, 2789,
-        2789, 2789, 2789, 2789, 2789, 2789, 2789, 2789, 2789, 2789, 2789, 2790, 2790, 2790, 2790, 2790, 2790, 2790, 2790, 2790, 2790, 2790, 2790, 2790, 2790, 2790,
-        2790, 2790, 2790, 2790, 2790, 2790, 2790, 2790, 2791, 2791, 2791, 2791, 2791, 2791, 2791, 2791, 2791, 2791, 2791, 2791, 2791, 2791, 2791, 2791, 2791, 2791,
-        2791, 2791, 2791, 2791, 2792, 2792, 2792, 2792, 2792, 2792, 2792, 2792, 2792, 2792, 2792, 2792, 2792, 2792, 2792, 2792, 2792, 2792, 2792, 2792, 2792, 2792,
-        2792, 2793, 2793, 2793, 2793, 2793, 2793, 2793, 2793, 2793, 2793, 2793, 2793, 2793, 2793, 2793, 2793, 2793, 2793, 2793, 2793, 2793, 2793, 2793, 2794, 2794,
-        2794, 2794, 2794, 2794, 2794, 2794, 2794, 2794, 2794, 2794, 2794, 2794, 2794, 2794, 2794, 2794, 2794, 2794, 2794, 2794, 2795, 2795, 2795, 2795, 2795, 2795,
-        2795, 2795, 2795, 2795, 2795, 2795, 2795, 2795, 2795, 2795, 2795, 2795, 2795, 2795, 2795, 2795, 2795, 2796, 2796, 2796, 2796, 2796, 2796, 2796, 2796, 2796,
-        2796, 2796, 2796, 2796, 2796, 2796, 2796, 2796, 2796, 2796, 2796, 2796, 2796, 2797, 2797, 2797, 2797, 2797, 2797, 2797, 2797, 2797, 2797, 2797, 2797, 2797,
-        2797, 2797, 2797, 2797, 2797, 2797, 2797, 2797, 2797, 2797, 2798, 2798, 2798, 2798, 2798, 2798, 2798, 2798, 2798, 2798, 2798, 2798, 2798, 2798, 2798, 2798,
-        2798, 2798, 2798, 2798, 2798, 2798, 2798, 2799, 2799, 2799, 2799, 2799, 2799, 2799, 2799, 2799, 2799, 2799, 2799, 2799, 2799, 2799, 2799, 2799, 2799, 2799,
-        2799, 2799, 2799, 2800, 2800, 2800, 2800, 2800, 2800, 2800, 2800, 2800, 2800, 2800, 2800, 2800, 2800, 2800, 2800, 2800, 2800, 2800, 2800, 2800, 2800, 2800,
-        2801, 2801, 2801, 2801, 2801, 2801, 2801, 2801, 2801, 2801, 2801, 2801, 2801, 2801, 2801, 2801, 2801, 2801, 2801, 2801, 2801, 2801, 2801, 2802, 2802, 2802,
-        2802, 2802, 2802, 2802, 2802, 2802, 2802, 2802, 2802, 2802, 2802, 2802, 2802, 2802, 2802, 2802, 2802, 2802, 2802, 2803, 2803, 2803, 2803, 2803, 2803, 2803,
-        2803, 2803, 2803, 2803, 2803, 2803, 2803, 2803, 2803, 2803, 2803, 2803, 2803, 2803, 2803, 2803, 2804, 2804, 2804, 2804, 2804, 2804, 2804, 2804, 2804, 2804,
-        2804, 2804, 2804, 2804, 2804, 2804, 2804, 2804, 2804, 2804, 2804, 2804, 2804, 2805, 2805, 2805, 2805, 2805, 2805, 2805, 2805, 2805, 2805, 2805, 2805, 2805,
-        2805, 2805, 2805, 2805, 2805, 2805, 2805, 2805, 2805, 2806, 2806, 2806, 2806, 2806, 2806, 2806, 2806, 2806, 2806, 2806, 2806, 2806, 2806, 2806, 2806, 2806,
-        2806, 2806, 2806, 2806, 2806, 2806, 2807, 2807, 2807, 2807, 2807, 2807, 2807, 2807, 2807, 2807, 2807, 2807, 2807, 2807, 2807, 2807, 2807, 2807, 2807, 2807,
-        2807, 2807, 2807, 2808, 2808, 2808, 2808, 2808, 2808, 2808, 2808, 2808, 2808, 2808, 2808, 2808, 2808, 2808, 2808, 2808, 2808, 2808, 2808, 2808, 2808, 2808,
-        2809, 2809, 2809, 2809, 2809, 2809, 2809, 2809, 2809, 2809, 2809, 2809, 2809, 2809, 2809, 2809, 2809, 2809, 2809, 2809, 2809, 2809, 2810, 2810, 2810, 2810,
-        2810, 2810, 2810, 2810, 2810, 2810, 2810, 2810, 2810, 2810, 2810, 2810, 2810, 2810, 2810, 2810, 2810, 2810, 2810, 2811, 2811, 2811, 2811, 2811, 2811, 2811,
-        2811, 2811, 2811, 2811, 2811, 2811, 2811, 2811, 2811, 2811, 2811, 2811, 2811, 2811, 2811, 2811, 2812, 2812, 2812, 2812, 2812, 2812, 2812, 2812, 2812, 2812,
-        2812, 2812, 2812, 2812, 2812, 2812, 2812, 2812, 2812, 2812, 2812, 2812, 2812, 2813, 2813, 2813, 2813, 2813, 2813, 2813, 2813, 2813, 2813, 2813, 2813, 2813,
-        2813, 2813, 2813, 2813, 2813, 2813, 2813, 2813, 2813, 2813, 2814, 2814, 2814, 2814, 2814, 2814, 2814, 2814, 2814, 2814, 2814, 2814, 2814, 2814, 2814, 2814,
-        2814, 2814, 2814, 2814, 2814, 2814, 2815, 2815, 2815, 2815, 2815, 2815, 2815, 2815, 2815, 2815, 2815, 2815, 2815, 2815, 2815, 2815, 2815, 2815, 2815, 2815,
-        2815, 2815, 2815, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816,
-        2817, 2817, 2817, 2817, 2817, 2817, 2817, 2817, 2817, 2817, 2817, 2817, 2817, 2817, 2817, 2817, 2817, 2817, 2817, 2817, 2817, 2817, 2817, 2818, 2818, 2818,
-        2818, 2818, 2818, 2818, 2818, 2818, 2818, 2818, 2818, 2818, 2818, 2818, 2818, 2818, 2818, 2818, 2818, 2818, 2818, 2818, 2819, 2819, 2819, 2819, 2819, 2819,
-        2819, 2819, 2819, 2819, 2819, 2819, 2819, 2819, 2819, 2819, 2819, 2819, 2819, 2819, 2819, 2819, 2819, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820,
-        2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2821, 2821, 2821, 2821, 2821, 2821, 2821, 2821, 2821, 2821, 2821, 2821,
-        2821, 2821, 2821, 2821, 2821, 2821, 2821, 2821, 2821, 2821, 2821, 2822, 2822, 2822, 2822, 2822, 2822, 2822, 2822, 2822, 2822, 2822, 2822, 2822, 2822, 2822,
-        2822, 2822, 2822, 2822, 2822, 2822, 2822, 2822, 2823, 2823, 2823, 2823, 2823, 2823, 2823, 2823, 2823, 2823, 2823, 2823, 2823, 2823, 2823, 2823, 2823, 2823,
-        2823, 2823, 2823, 2823, 2824, 2824, 2824, 2824, 2824, 2824, 2824, 2824, 2824, 2824, 2824, 2824, 2824, 2824, 2824, 2824, 2824, 2824, 2824, 2824, 2824, 2824,
-        2824, 2825, 2825, 2825, 2825, 2825, 2825, 2825, 2825, 2825, 2825, 2825, 2825, 2825, 2825, 2825, 2825, 2825, 2825, 2825, 2825, 2825, 2825, 2825, 2826, 2826,
-        2826, 2826, 2826, 2826, 2826, 2826, 2826, 2826, 2826, 2826, 2826, 2826, 2826, 2826, 2826, 2826, 2826, 2826, 2826, 2826, 2826, 2827, 2827, 2827, 2827, 2827,
-        2827, 2827, 2827, 2827, 2827, 2827, 2827, 2827, 2827, 2827, 2827, 2827, 2827, 2827, 2827, 2827, 2827, 2827, 2828, 2828, 2828, 2828, 2828, 2828, 2828, 2828,
-        2828, 2828, 2828, 2828, 2828, 2828, 2828, 2828, 2828, 2828, 2828, 2828, 2828, 2828, 2828, 2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829,
-        2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829, 2830, 2830, 2830, 2830, 2830, 2830, 2830, 2830, 2830, 2830, 2830, 2830, 2830, 2830,
-        2830, 2830, 2830, 2830, 2830, 2830, 2830, 2830, 2830, 2830, 2831, 2831, 2831, 2831, 2831, 2831, 2831, 2831, 2831, 2831, 2831, 2831, 2831, 2831, 2831, 2831,
-        2831, 2831, 2831, 2831, 2831, 2831, 2831, 2832, 2832, 2832, 2832, 2832, 2832, 2832, 2832, 2832, 2832, 2832, 2832, 2832, 2832, 2832, 2832, 2832, 2832, 2832,
-        2832, 2832, 2832, 2832, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833,
-        2833, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2835, 2835,
-        2835, 2835, 2835, 2835, 2835, 2835, 2835, 2835, 2835, 2835, 2835, 2835, 2835, 2835, 2835, 2835, 2835, 2835, 2835, 2835, 2835, 2836, 2836, 2836, 2836, 2836,
-        2836, 2836, 2836, 2836, 2836, 2836, 2836, 2836, 2836, 2836, 2836, 2836, 2836, 2836, 2836, 2836, 2836, 2836, 2837, 2837, 2837, 2837, 2837, 2837, 2837, 2837,
-        2837, 2837, 2837, 2837, 2837, 2837, 2837, 2837, 2837, 2837, 2837, 2837, 2837, 2837, 2837, 2838, 2838, 2838, 2838, 2838, 2838, 2838, 2838, 2838, 2838, 2838,
-        2838, 2838, 2838, 2838, 2838, 2838, 2838, 2838, 2838, 2838, 2838, 2838, 2839, 2839, 2839, 2839, 2839, 2839, 2839, 2839, 2839, 2839, 2839, 2839, 2839, 2839,
-        2839, 2839, 2839, 2839, 2839, 2839, 2839, 2839, 2839, 2839, 2840, 2840, 2840, 2840, 2840, 2840, 2840, 2840, 2840, 2840, 2840, 2840, 2840, 2840, 2840, 2840,
-        2840, 2840, 2840, 2840, 2840, 2840, 2840, 2841, 2841, 2841, 2841, 2841, 2841, 2841, 2841, 2841, 2841, 2841, 2841, 2841, 2841, 2841, 2841, 2841, 2841, 2841,
-        2841, 2841, 2841, 2841, 2842, 2842, 2842, 2842, 2842, 2842, 2842, 2842, 2842, 2842, 2842, 2842, 2842, 2842, 2842, 2842, 2842, 2842, 2842, 2842, 2842, 2842,
-        2842, 2843, 2843, 2843, 2843, 2843, 2843, 2843, 2843, 2843, 2843, 2843, 2843, 2843, 2843, 2843, 2843, 2843, 2843, 2843, 2843, 2843, 2843, 2843, 2844, 2844,
-        2844, 2844, 2844, 2844, 2844, 2844, 2844, 2844, 2844, 2844, 2844, 2844, 2844, 2844, 2844, 2844, 2844, 2844, 2844, 2844, 2844, 2844, 2845, 2845, 2845, 2845,
-        2845, 2845, 2845, 2845, 2845, 2845, 2845, 2845, 2845, 2845, 2845, 2845, 2845, 2845, 2845, 2845, 2845, 2845, 2845, 2846, 2846, 2846, 2846, 2846, 2846, 2846,
-        2846, 2846, 2846, 2846, 2846, 2846, 2846, 2846, 2846, 2846, 2846, 2846, 2846, 2846, 2846, 2846, 2847, 2847, 2847, 2847, 2847, 2847, 2847, 2847, 2847, 2847,
-        2847, 2847, 2847, 2847, 2847, 2847, 2847, 2847, 2847, 2847, 2847, 2847, 2847, 2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848,
-        2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848, 2849, 2849, 2849, 2849, 2849, 2849, 2849, 2849, 2849, 2849, 2849, 2849, 2849, 2849, 2849,
-        2849, 2849, 2849, 2849, 2849, 2849, 2849, 2849, 2850, 2850, 2850, 2850, 2850, 2850, 2850, 2850, 2850, 2850, 2850, 2850, 2850, 2850, 2850, 2850, 2850, 2850,
-        2850, 2850, 2850, 2850, 2850, 2851, 2851, 2851, 2851, 2851, 2851, 2851, 2851, 2851, 2851, 2851, 2851, 2851, 2851, 2851, 2851, 2851, 2851, 2851, 2851, 2851,
-        2851, 2851, 2852, 2852, 2852, 2852, 2852, 2852, 2852, 2852, 2852, 2852, 2852, 2852, 2852, 2852, 2852, 2852, 2852, 2852, 2852, 2852, 2852, 2852, 2852, 2852,
-        2853, 2853, 2853, 2853, 2853, 2853, 2853, 2853, 2853, 2853, 2853, 2853, 2853, 2853, 2853, 2853, 2853, 2853, 2853, 2853, 2853, 2853, 2853, 2854, 2854, 2854,
-        2854, 2854, 2854, 2854, 2854, 2854, 2854, 2854, 2854, 2854, 2854, 2854, 2854, 2854, 2854, 2854, 2854, 2854, 2854, 2854, 2854, 2855, 2855, 2855, 2855, 2855,
-        2855, 2855, 2855, 2855, 2855, 2855, 2855, 2855, 2855, 2855, 2855, 2855, 2855, 2855, 2855, 2855, 2855, 2855, 2856, 2856, 2856, 2856, 2856, 2856, 2856, 2856,
-        2856, 2856, 2856, 2856, 2856, 2856, 2856, 2856, 2856, 2856, 2856, 2856, 2856, 2856, 2856, 2857, 2857, 2857, 2857, 2857, 2857, 2857, 2857, 2857, 2857, 2857,
-        2857, 2857, 2857, 2857, 2857, 2857, 2857, 2857, 2857, 2857, 2857, 2857, 2857, 2858, 2858, 2858, 2858, 2858, 2858, 2858, 2858, 2858, 2858, 2858, 2858, 2858,
-        2858, 2858, 2858, 2858, 2858, 2858, 2858, 2858, 2858, 2858, 2859, 2859, 2859, 2859, 2859, 2859, 2859, 2859, 2859, 2859, 2859, 2859, 2859, 2859, 2859, 2859,
-        2859, 2859, 2859, 2859, 2859, 2859, 2859, 2860, 2860, 2860, 2860, 2860, 2860, 2860, 2860, 2860, 2860, 2860, 2860, 2860, 2860, 2860, 2860, 2860, 2860, 2860,
-        2860, 2860, 2860, 2860, 2860, 2861, 2861, 2861, 2861, 2861, 2861, 2861, 2861, 2861, 2861, 2861, 2861, 2861, 2861, 2861, 2861, 2861, 2861, 2861, 2861, 2861,
-        2861, 2861, 2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862,
-        2863, 2863, 2863, 2863, 2863, 2863, 2863, 2863, 2863, 2863, 2863, 2863, 2863, 2863, 2863, 2863, 2863, 2863, 2863, 2863, 2863, 2863, 2863, 2864, 2864, 2864,
-        2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2865, 2865, 2865, 2865, 2865,
-        2865, 2865, 2865, 2865, 2865, 2865, 2865, 2865, 2865, 2865, 2865, 2865, 2865, 2865, 2865, 2865, 2865, 2865, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866,
-        2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2867, 2867, 2867, 2867, 2867, 2867, 2867, 2867, 2867, 2867,
-        2867, 2867, 2867, 2867, 2867, 2867, 2867, 2867, 2867, 2867, 2867, 2867, 2867, 2868, 2868, 2868, 2868, 2868, 2868, 2868, 2868, 2868, 2868, 2868, 2868, 2868,
-        2868, 2868, 2868, 2868, 2868, 2868, 2868, 2868, 2868, 2868, 2868, 2869, 2869, 2869, 2869, 2869, 2869, 2869, 2869, 2869, 2869, 2869, 2869, 2869, 2869, 2869,
-        2869, 2869, 2869, 2869, 2869, 2869, 2869, 2869, 2870, 2870, 2870, 2870, 2870, 2870, 2870, 2870, 2870, 2870, 2870, 2870, 2870, 2870, 2870, 2870, 2870, 2870,
-        2870, 2870, 2870, 2870, 2870, 2870, 2871, 2871, 2871, 2871, 2871, 2871, 2871, 2871, 2871, 2871, 2871, 2871, 2871, 2871, 2871, 2871, 2871, 2871, 2871, 2871,
-        2871, 2871, 2871, 2871, 2872, 2872, 2872, 2872, 2872, 2872, 2872, 2872, 2872, 2872, 2872, 2872, 2872, 2872, 2872, 2872, 2872, 2872, 2872, 2872, 2872, 2872,
-        2872, 2873, 2873, 2873, 2873, 2873, 2873, 2873, 2873, 2873, 2873, 2873, 2873, 2873, 2873, 2873, 2873, 2873, 2873, 2873, 2873, 2873, 2873, 2873, 2873, 2874,
-        2874, 2874, 2874, 2874, 2874, 2874, 2874, 2874, 2874, 2874, 2874, 2874, 2874, 2874, 2874, 2874, 2874, 2874, 2874, 2874, 2874, 2874, 2875, 2875, 2875, 2875,
-        2875, 2875, 2875, 2875, 2875, 2875, 2875, 2875, 2875, 2875, 2875, 2875, 2875, 2875, 2875, 2875, 2875, 2875, 2875, 2875, 2876, 2876, 2876, 2876, 2876, 2876,
-        2876, 2876, 2876, 2876, 2876, 2876, 2876, 2876, 2876, 2876, 2876, 2876, 2876, 2876, 2876, 2876, 2876, 2876, 2877, 2877, 2877, 2877, 2877, 2877, 2877, 2877,
-        2877, 2877, 2877, 2877, 2877, 2877, 2877, 2877, 2877, 2877, 2877, 2877, 2877, 2877, 2877, 2878, 2878, 2878, 2878, 2878, 2878, 2878, 2878, 2878, 2878, 2878,
-        2878, 2878, 2878, 2878, 2878, 2878, 2878, 2878, 2878, 2878, 2878, 2878, 2878, 2879, 2879, 2879, 2879, 2879, 2879, 2879, 2879, 2879, 2879, 2879, 2879, 2879,
-        2879, 2879, 2879, 2879, 2879, 2879, 2879, 2879, 2879, 2879, 2879, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880,
-        2880, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2881, 2881, 2881, 2881, 2881, 2881, 2881, 2881, 2881, 2881, 2881, 2881, 2881, 2881, 2881, 2881, 2881, 2881,
-        2881, 2881, 2881, 2881, 2881, 2881, 2882, 2882, 2882, 2882, 2882, 2882, 2882, 2882, 2882, 2882, 2882, 2882, 2882, 2882, 2882, 2882, 2882, 2882, 2882, 2882,
-        2882, 2882, 2882, 2882, 2883, 2883, 2883, 2883, 2883, 2883, 2883, 2883, 2883, 2883, 2883, 2883, 2883, 2883, 2883, 2883, 2883, 2883, 2883, 2883, 2883, 2883,
-        2883, 2883, 2884, 2884, 2884, 2884, 2884, 2884, 2884, 2884, 2884, 2884, 2884, 2884, 2884, 2884, 2884, 2884, 2884, 2884, 2884, 2884, 2884, 2884, 2884, 2885,
-        2885, 2885, 2885, 2885, 2885, 2885, 2885, 2885, 2885, 2885, 2885, 2885, 2885, 2885, 2885, 2885, 2885, 2885, 2885, 2885, 2885, 2885, 2885, 2886, 2886, 2886,
-        2886, 2886, 2886, 2886, 2886, 2886, 2886, 2886, 2886, 2886, 2886, 2886, 2886, 2886, 2886, 2886, 2886, 2886, 2886, 2886, 2886, 2887, 2887, 2887, 2887, 2887,
-        2887, 2887, 2887, 2887, 2887, 2887, 2887, 2887, 2887, 2887, 2887, 2887, 2887, 2887, 2887, 2887, 2887, 2887, 2887, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
-        2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2889, 2889, 2889, 2889, 2889, 2889, 2889, 2889, 2889, 2889,
-        2889, 2889, 2889, 2889, 2889, 2889, 2889, 2889, 2889, 2889, 2889, 2889, 2889, 2889, 2890, 2890, 2890, 2890, 2890, 2890, 2890, 2890, 2890, 2890, 2890, 2890,
-        2890, 2890, 2890, 2890, 2890, 2890, 2890, 2890, 2890, 2890, 2890, 2890, 2891, 2891, 2891, 2891, 2891, 2891, 2891, 2891, 2891, 2891, 2891, 2891, 2891, 2891,
-        2891, 2891, 2891, 2891, 2891, 2891, 2891, 2891, 2891, 2891, 2892, 2892, 2892, 2892, 2892, 2892, 2892, 2892, 2892, 2892, 2892, 2892, 2892, 2892, 2892, 2892,
-        2892, 2892, 2892, 2892, 2892, 2892, 2892, 2892, 2893, 2893, 2893, 2893, 2893, 2893, 2893, 2893, 2893, 2893, 2893, 2893, 2893, 2893, 2893, 2893, 2893, 2893,
-        2893, 2893, 2893, 2893, 2893, 2893, 2894, 2894, 2894, 2894, 2894, 2894, 2894, 2894, 2894, 2894, 2894, 2894, 2894, 2894, 2894, 2894, 2894, 2894, 2894, 2894,
-        2894, 2894, 2894, 2894, 2895, 2895, 2895, 2895, 2895, 2895, 2895, 2895, 2895, 2895, 2895, 2895, 2895, 2895, 2895, 2895, 2895, 2895, 2895, 2895, 2895, 2895,
-        2895, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2897,
-        2897, 2897, 2897, 2897, 2897, 2897, 2897, 2897, 2897, 2897, 2897, 2897, 2897, 2897, 2897, 2897, 2897, 2897, 2897, 2897, 2897, 2897, 2897, 2898, 2898, 2898,
-        2898, 2898, 2898, 2898, 2898, 2898, 2898, 2898, 2898, 2898, 2898, 2898, 2898, 2898, 2898, 2898, 2898, 2898, 2898, 2898, 2898, 2899, 2899, 2899, 2899, 2899,
-        2899, 2899, 2899, 2899, 2899, 2899, 2899, 2899, 2899, 2899, 2899, 2899, 2899, 2899, 2899, 2899, 2899, 2899, 2899, 2900, 2900, 2900, 2900, 2900, 2900, 2900,
-        2900, 2900, 2900, 2900, 2900, 2900, 2900, 2900, 2900, 2900, 2900, 2900, 2900, 2900, 2900, 2900, 2900, 2901, 2901, 2901, 2901, 2901, 2901, 2901, 2901, 2901,
-        2901, 2901, 2901, 2901, 2901, 2901, 2901, 2901, 2901, 2901, 2901, 2901, 2901, 2901, 2901, 2902, 2902, 2902, 2902, 2902, 2902, 2902, 2902, 2902, 2902, 2902,
-        2902, 2902, 2902, 2902, 2902, 2902, 2902, 2902, 2902, 2902, 2902, 2902, 2902, 2903, 2903, 2903, 2903, 2903, 2903, 2903, 2903, 2903, 2903, 2903, 2903, 2903,
-        2903, 2903, 2903, 2903, 2903, 2903, 2903, 2903, 2903, 2903, 2903, 2904, 2904, 2904, 2904, 2904, 2904, 2904, 2904, 2904, 2904, 2904, 2904, 2904, 2904, 2904,
-        2904, 2904, 2904, 2904, 2904, 2904, 2904, 2904, 2904, 2905, 2905, 2905, 2905, 2905, 2905, 2905, 2905, 2905, 2905, 2905, 2905, 2905, 2905, 2905, 2905, 2905,
-        2905, 2905, 2905, 2905, 2905, 2905, 2905, 2906, 2906, 2906, 2906, 2906, 2906, 2906, 2906, 2906, 2906, 2906, 2906, 2906, 2906, 2906, 2906, 2906, 2906, 2906,
-        2906, 2906, 2906, 2906, 2906, 2907, 2907, 2907, 2907, 2907, 2907, 2907, 2907, 2907, 2907, 2907, 2907, 2907, 2907, 2907, 2907, 2907, 2907, 2907, 2907, 2907,
-        2907, 2907, 2907, 2908, 2908, 2908, 2908, 2908, 2908, 2908, 2908, 2908, 2908, 2908, 2908, 2908, 2908, 2908, 2908, 2908, 2908, 2908, 2908, 2908, 2908, 2908,
-        2908, 2909, 2909, 2909, 2909, 2909, 2909, 2909, 2909, 2909, 2909, 2909, 2909, 2909, 2909, 2909, 2909, 2909, 2909, 2909, 2909, 2909, 2909, 2909, 2909, 2910,
-        2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2911, 2911,
-        2911, 2911, 2911, 2911, 2911, 2911, 2911, 2911, 2911, 2911, 2911, 2911, 2911, 2911, 2911, 2911, 2911, 2911, 2911, 2911, 2911, 2911, 2912, 2912, 2912, 2912,
-        2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2913, 2913, 2913, 2913, 2913, 2913,
-        2913, 2913, 2913, 2913, 2913, 2913, 2913, 2913, 2913, 2913, 2913, 2913, 2913, 2913, 2913, 2913, 2913, 2913, 2914, 2914, 2914, 2914, 2914, 2914, 2914, 2914,
-        2914, 2914, 2914, 2914, 2914, 2914, 2914, 2914, 2914, 2914, 2914, 2914, 2914, 2914, 2914, 2914, 2915, 2915, 2915, 2915, 2915, 2915, 2915, 2915, 2915, 2915,
-        2915, 2915, 2915, 2915, 2915, 2915, 2915, 2915, 2915, 2915, 2915, 2915, 2915, 2915, 2916, 2916, 2916, 2916, 2916, 2916, 2916, 2916, 2916, 2916, 2916, 2916,
-        2916, 2916, 2916, 2916, 2916, 2916, 2916, 2916, 2916, 2916, 2916, 2916, 2917, 2917, 2917, 2917, 2917, 2917, 2917, 2917, 2917, 2917, 2917, 2917, 2917, 2917,
-        2917, 2917, 2917, 2917, 2917, 2917, 2917, 2917, 2917, 2917, 2917, 2918, 2918, 2918, 2918, 2918, 2918, 2918, 2918, 2918, 2918, 2918, 2918, 2918, 2918, 2918,
-        2918, 2918, 2918, 2918, 2918, 2918, 2918, 2918, 2918, 2919, 2919, 2919, 2919, 2919, 2919, 2919, 2919, 2919, 2919, 2919, 2919, 2919, 2919, 2919, 2919, 2919,
-        2919, 2919, 2919, 2919, 2919, 2919, 2919, 2920, 2920, 2920, 2920, 2920, 2920, 2920, 2920, 2920, 2920, 2920, 2920, 2920, 2920, 2920, 2920, 2920, 2920, 2920,
-        2920, 2920, 2920, 2920, 2920, 2921, 2921, 2921, 2921, 2921, 2921, 2921, 2921, 2921, 2921, 2921, 2921, 2921, 2921, 2921, 2921, 2921, 2921, 2921, 2921, 2921,
-        2921, 2921, 2921, 2922, 2922, 2922, 2922, 2922, 2922, 2922, 2922, 2922, 2922, 2922, 2922, 2922, 2922, 2922, 2922, 2922, 2922, 2922, 2922, 2922, 2922, 2922,
-        2922, 2922, 2923, 2923, 2923, 2923, 2923, 2923, 2923, 2923, 2923, 2923, 2923, 2923, 2923, 2923, 2923, 2923, 2923, 2923, 2923, 2923, 2923, 2923, 2923, 2923,
-        2924, 2924, 2924, 2924, 2924, 2924, 2924, 2924, 2924, 2924, 2924, 2924, 2924, 2924, 2924, 2924, 2924, 2924, 2924, 2924, 2924, 2924, 2924, 2924, 2925, 2925,
-        2925, 2925, 2925, 2925, 2925, 2925, 2925, 2925, 2925, 2925, 2925, 2925, 2925, 2925, 2925, 2925, 2925, 2925, 2925, 2925, 2925, 2925, 2925, 2926, 2926, 2926,
-        2926, 2926, 2926, 2926, 2926, 2926, 2926, 2926, 2926, 2926, 2926, 2926, 2926, 2926, 2926, 2926, 2926, 2926, 2926, 2926, 2926, 2927, 2927, 2927, 2927, 2927,
-        2927, 2927, 2927, 2927, 2927, 2927, 2927, 2927, 2927, 2927, 2927, 2927, 2927, 2927, 2927, 2927, 2927, 2927, 2927, 2928, 2928, 2928, 2928, 2928, 2928, 2928,
-        2928, 2928, 2928, 2928, 2928, 2928, 2928, 2928, 2928, 2928, 2928, 2928, 2928, 2928, 2928, 2928, 2928, 2928, 2929, 2929, 2929, 2929, 2929, 2929, 2929, 2929,
-        2929, 2929, 2929, 2929, 2929, 2929, 2929, 2929, 2929, 2929, 2929, 2929, 2929, 2929, 2929, 2929, 2930, 2930, 2930, 2930, 2930, 2930, 2930, 2930, 2930, 2930,
-        2930, 2930, 2930, 2930, 2930, 2930, 2930, 2930, 2930, 2930, 2930, 2930, 2930, 2930, 2931, 2931, 2931, 2931, 2931, 2931, 2931, 2931, 2931, 2931, 2931, 2931,
-        2931, 2931, 2931, 2931, 2931, 2931, 2931, 2931, 2931, 2931, 2931, 2931, 2931, 2932, 2932, 2932, 2932, 2932, 2932, 2932, 2932, 2932, 2932, 2932, 2932, 2932,
-        2932, 2932, 2932, 2932, 2932, 2932, 2932, 2932, 2932, 2932, 2932, 2933, 2933, 2933, 2933, 2933, 2933, 2933, 2933, 2933, 2933, 2933, 2933, 2933, 2933, 2933,
-        2933, 2933, 2933, 2933, 2933, 2933, 2933, 2933, 2933, 2934, 2934, 2934, 2934, 2934, 2934, 2934, 2934, 2934, 2934, 2934, 2934, 2934, 2934, 2934, 2934, 2934,
-        2934, 2934, 2934, 2934, 2934, 2934, 2934, 2934, 2935, 2935, 2935, 2935, 2935, 2935, 2935, 2935, 2935, 2935, 2935, 2935, 2935, 2935, 2935, 2935, 2935, 2935,
-        2935, 2935, 2935, 2935, 2935, 2935, 2936, 2936, 2936, 2936, 2936, 2936, 2936, 2936, 2936, 2936, 2936, 2936, 2936, 2936, 2936, 2936, 2936, 2936, 2936, 2936,
-        2936, 2936, 2936, 2936, 2936, 2937, 2937, 2937, 2937, 2937, 2937, 2937, 2937, 2937, 2937, 2937, 2937, 2937, 2937, 2937, 2937, 2937, 2937, 2937, 2937, 2937,
-        2937, 2937, 2937, 2938, 2938, 2938, 2938, 2938, 2938, 2938, 2938, 2938, 2938, 2938, 2938, 2938, 2938, 2938, 2938, 2938, 2938, 2938, 2938, 2938, 2938, 2938,
-        2938, 2938, 2939, 2939, 2939, 2939, 2939, 2939, 2939, 2939, 2939, 2939, 2939, 2939, 2939, 2939, 2939, 2939, 2939, 2939, 2939, 2939, 2939, 2939, 2939, 2939,
-        2940, 2940, 2940, 2940, 2940, 2940, 2940, 2940, 2940, 2940, 2940, 2940, 2940, 2940, 2940, 2940, 2940, 2940, 2940, 2940, 2940, 2940, 2940, 2940, 2940, 2941,
-        2941, 2941, 2941, 2941, 2941, 2941, 2941, 2941, 2941, 2941, 2941, 2941, 2941, 2941, 2941, 2941, 2941, 2941, 2941, 2941, 2941, 2941, 2941, 2942, 2942, 2942,
-        2942, 2942, 2942, 2942, 2942, 2942, 2942, 2942, 2942, 2942, 2942, 2942, 2942, 2942, 2942, 2942, 2942, 2942, 2942, 2942, 2942, 2942, 2943, 2943, 2943, 2943,
-        2943, 2943, 2943, 2943, 2943, 2943, 2943, 2943, 2943, 2943, 2943, 2943, 2943, 2943, 2943, 2943, 2943, 2943, 2943, 2943, 2944, 2944, 2944, 2944, 2944, 2944,
-        2944, 2944, 2944, 2944, 2944, 2944, 2944, 2944, 2944, 2944, 2944, 2944, 2944, 2944, 2944, 2944, 2944, 2944, 2944, 2945, 2945, 2945, 2945, 2945, 2945, 2945,
-        2945, 2945, 2945, 2945, 2945, 2945, 2945, 2945, 2945, 2945, 2945, 2945, 2945, 2945, 2945, 2945, 2945, 2946, 2946, 2946, 2946, 2946, 2946, 2946, 2946, 2946,
-        2946, 2946, 2946, 2946, 2946, 2946, 2946, 2946, 2946, 2946, 2946, 2946, 2946, 2946, 2946, 2946, 2947, 2947, 2947, 2947, 2947, 2947, 2947, 2947, 2947, 2947,
-        2947, 2947, 2947, 2947, 2947, 2947, 2947, 2947, 2947, 2947, 2947, 2947, 2947, 2947, 2948, 2948, 2948, 2948, 2948, 2948, 2948, 2948, 2948, 2948, 2948, 2948,
-        2948, 2948, 2948, 2948, 2948, 2948, 2948, 2948, 2948, 2948, 2948, 2948, 2948, 2949, 2949, 2949, 2949, 2949, 2949, 2949, 2949, 2949, 2949, 2949, 2949, 2949,
-        2949, 2949, 2949, 2949, 2949, 2949, 2949, 2949, 2949, 2949, 2949, 2949, 2950, 2950, 2950, 2950, 2950, 2950, 2950, 2950, 2950, 2950, 2950, 2950, 2950, 2950,
-        2950, 2950, 2950, 2950, 2950, 2950, 2950, 2950, 2950, 2950, 2951, 2951, 2951, 2951, 2951, 2951, 2951, 2951, 2951, 2951, 2951, 2951, 2951, 2951, 2951, 2951,
-        2951, 2951, 2951, 2951, 2951, 2951, 2951, 2951, 2951, 2952, 2952, 2952, 2952, 2952, 2952, 2952, 2952, 2952, 2952, 2952, 2952, 2952, 2952, 2952, 2952, 2952,
-        2952, 2952, 2952, 2952, 2952, 2952, 2952, 2952, 2953, 2953, 2953, 2953, 2953, 2953, 2953, 2953, 2953, 2953, 2953, 2953, 2953, 2953, 2953, 2953, 2953, 2953,
-        2953, 2953, 2953, 2953, 2953, 2953, 2954, 2954, 2954, 2954, 2954, 2954, 2954, 2954, 2954, 2954, 2954, 2954, 2954, 2954, 2954, 2954, 2954, 2954, 2954, 2954,
-        2954, 2954, 2954, 2954, 2954, 2955, 2955, 2955, 2955, 2955, 2955, 2955, 2955, 2955, 2955, 2955, 2955, 2955, 2955, 2955, 2955, 2955, 2955, 2955, 2955, 2955,
-        2955, 2955, 2955, 2955, 2956, 2956, 2956, 2956, 2956, 2956, 2956, 2956, 2956, 2956, 2956, 2956, 2956, 2956, 2956, 2956, 2956, 2956, 2956, 2956, 2956, 2956,
-        2956, 2956, 2957, 2957, 2957, 2957, 2957, 2957, 2957, 2957, 2957, 2957, 2957, 2957, 2957, 2957, 2957, 2957, 2957, 2957, 2957, 2957, 2957, 2957, 2957, 2957,
-        2957, 2958, 2958, 2958, 2958, 2958, 2958, 2958, 2958, 2958, 2958, 2958, 2958, 2958, 2958, 2958, 2958, 2958, 2958, 2958, 2958, 2958, 2958, 2958, 2958, 2958,
-        2959, 2959, 2959, 2959, 2959, 2959, 2959, 2959, 2959, 2959, 2959, 2959, 2959, 2959, 2959, 2959, 2959, 2959, 2959, 2959, 2959, 2959, 2959, 2959, 2960, 2960,
-        2960, 2960, 2960, 2960, 2960, 2960, 2960, 2960, 2960, 2960, 2960, 2960, 2960, 2960, 2960, 2960, 2960, 2960, 2960, 2960, 2960, 2960, 2960, 2961, 2961, 2961,
-        2961, 2961, 2961, 2961, 2961, 2961, 2961, 2961, 2961, 2961, 2961, 2961, 2961, 2961, 2961, 2961, 2961, 2961, 2961, 2961, 2961, 2961, 2962, 2962, 2962, 2962,
-        2962, 2962, 2962, 2962, 2962, 2962, 2962, 2962, 2962, 2962, 2962, 2962, 2962, 2962, 2962, 2962, 2962, 2962, 2962, 2962, 2962, 2963, 2963, 2963, 2963, 2963,
-        2963, 2963, 2963, 2963, 2963, 2963, 2963, 2963, 2963, 2963, 2963, 2963, 2963, 2963, 2963, 2963, 2963, 2963, 2963, 2963, 2964, 2964, 2964, 2964, 2964, 2964,
-        2964, 2964, 2964, 2964, 2964, 2964, 2964, 2964, 2964, 2964, 2964, 2964, 2964, 2964, 2964, 2964, 2964, 2964, 2965, 2965, 2965, 2965, 2965, 2965, 2965, 2965,
-        2965, 2965, 2965, 2965, 2965, 2965, 2965, 2965, 2965, 2965, 2965, 2965, 2965, 2965, 2965, 2965, 2965, 2966, 2966, 2966, 2966, 2966, 2966, 2966, 2966, 2966,
-        2966, 2966, 2966, 2966, 2966, 2966, 2966, 2966, 2966, 2966, 2966, 2966, 2966, 2966, 2966, 2966, 2967, 2967, 2967, 2967, 2967, 2967, 2967, 2967, 2967, 2967,
-        2967, 2967, 2967, 2967, 2967, 2967, 2967, 2967, 2967, 2967, 2967, 2967, 2967, 2967, 2967, 2968, 2968, 2968, 2968, 2968, 2968, 2968, 2968, 2968, 2968, 2968,
-        2968, 2968, 2968, 2968, 2968, 2968, 2968, 2968, 2968, 2968, 2968, 2968, 2968, 2968, 2969, 2969, 2969, 2969, 2969, 2969, 2969, 2969, 2969, 2969, 2969, 2969,
-        2969, 2969, 2969, 2969, 2969, 2969, 2969, 2969, 2969, 2969, 2969, 2969, 2969, 2970, 2970, 2970, 2970, 2970, 2970, 2970, 2970, 2970, 2970, 2970, 2970, 2970,
-        2970, 2970, 2970, 2970, 2970, 2970, 2970, 2970, 2970, 2970, 2970, 2970, 2971, 2971, 2971, 2971, 2971, 2971, 2971, 2971, 2971, 2971, 2971, 2971, 2971, 2971,
-        2971, 2971, 2971, 2971, 2971, 2971, 2971, 2971, 2971, 2971, 2971, 2972, 2972, 2972, 2972, 2972, 2972, 2972, 2972, 2972, 2972, 2972, 2972, 2972, 2972, 2972,
-        2972, 2972, 2972, 2972, 2972, 2972, 2972, 2972, 2972, 2973, 2973, 2973, 2973, 2973, 2973, 2973, 2973, 2973, 2973, 2973, 2973, 2973, 2973, 2973, 2973, 2973,
-        2973, 2973, 2973, 2973, 2973, 2973, 2973, 2973, 2974, 2974, 2974, 2974, 2974, 2974, 2974, 2974, 2974, 2974, 2974, 2974, 2974, 2974, 2974, 2974, 2974, 2974,
-        2974, 2974, 2974, 2974, 2974, 2974, 2974, 2975, 2975, 2975, 2975, 2975, 2975, 2975, 2975, 2975, 2975, 2975, 2975, 2975, 2975, 2975, 2975, 2975, 2975, 2975,
-        2975, 2975, 2975, 2975, 2975, 2975, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976,
-        2976, 2976, 2976, 2976, 2976, 2977, 2977, 2977, 2977, 2977, 2977, 2977, 2977, 2977, 2977, 2977, 2977, 2977, 2977, 2977, 2977, 2977, 2977, 2977, 2977, 2977,
-        2977, 2977, 2977, 2977, 2978, 2978, 2978, 2978, 2978, 2978, 2978, 2978, 2978, 2978, 2978, 2978, 2978, 2978, 2978, 2978, 2978, 2978, 2978, 2978, 2978, 2978,
-        2978, 2978, 2978, 2979, 2979, 2979, 2979, 2979, 2979, 2979, 2979, 2979, 2979, 2979, 2979, 2979, 2979, 2979, 2979, 2979, 2979, 2979, 2979, 2979, 2979, 2979,
-        2979, 2979, 2980, 2980, 2980, 2980, 2980, 2980, 2980, 2980, 2980, 2980, 2980, 2980, 2980, 2980, 2980, 2980, 2980, 2980, 2980, 2980, 2980, 2980, 2980, 2980,
-        2980, 2981, 2981, 2981, 2981, 2981, 2981, 2981, 2981, 2981, 2981, 2981, 2981, 2981, 2981, 2981, 2981, 2981, 2981, 2981, 2981, 2981, 2981, 2981, 2981, 2981,
-        2982, 2982, 2982, 2982, 2982, 2982, 2982, 2982, 2982, 2982, 2982, 2982, 2982, 2982, 2982, 2982, 2982, 2982, 2982, 2982, 2982, 2982, 2982, 2982, 2982, 2983,
-        2983, 2983, 2983, 2983, 2983, 2983, 2983, 2983, 2983, 2983, 2983, 2983, 2983, 2983, 2983, 2983, 2983, 2983, 2983, 2983, 2983, 2983, 2983, 2983, 2984, 2984,
-        2984, 2984, 2984, 2984, 2984, 2984, 2984, 2984, 2984, 2984, 2984, 2984, 2984, 2984, 2984, 2984, 2984, 2984, 2984, 2984, 2984, 2984, 2984, 2984, 2985, 2985,
-        2985, 2985, 2985, 2985, 2985, 2985, 2985, 2985, 2985, 2985, 2985, 2985, 2985, 2985, 2985, 2985, 2985, 2985, 2985, 2985, 2985, 2985, 2985, 2986, 2986, 2986,
-        2986, 2986, 2986, 2986, 2986, 2986, 2986, 2986, 2986, 2986, 2986, 2986, 2986, 2986, 2986, 2986, 2986, 2986, 2986, 2986, 2986, 2986, 2987, 2987, 2987, 2987,
-        2987, 2987, 2987, 2987, 2987, 2987, 2987, 2987, 2987, 2987, 2987, 2987, 2987, 2987, 2987, 2987, 2987, 2987, 2987, 2987, 2987, 2988, 2988, 2988, 2988, 2988,
-        2988, 2988, 2988, 2988, 2988, 2988, 2988, 2988, 2988, 2988, 2988, 2988, 2988, 2988, 2988, 2988, 2988, 2988, 2988, 2988, 2989, 2989, 2989, 2989, 2989, 2989,
-        2989, 2989, 2989, 2989, 2989, 2989, 2989, 2989, 2989, 2989, 2989, 2989, 2989, 2989, 2989, 2989, 2989, 2989, 2989, 2990, 2990, 2990, 2990, 2990, 2990, 2990,
-        2990, 2990, 2990, 2990, 2990, 2990, 2990, 2990, 2990, 2990, 2990, 2990, 2990, 2990, 2990, 2990, 2990, 2990, 2991, 2991, 2991, 2991, 2991, 2991, 2991, 2991,
-        2991, 2991, 2991, 2991, 2991, 2991, 2991, 2991, 2991, 2991, 2991, 2991, 2991, 2991, 2991, 2991, 2991, 2992, 2992, 2992, 2992, 2992, 2992, 2992, 2992, 2992,
-        2992, 2992, 2992, 2992, 2992, 2992, 2992, 2992, 2992, 2992, 2992, 2992, 2992, 2992, 2992, 2992, 2992, 2993, 2993, 2993, 2993, 2993, 2993, 2993, 2993, 2993,
-        2993, 2993, 2993, 2993, 2993, 2993, 2993, 2993, 2993, 2993, 2993, 2993, 2993, 2993, 2993, 2993, 2994, 2994, 2994, 2994, 2994, 2994, 2994, 2994, 2994, 2994,
-        2994, 2994, 2994, 2994, 2994, 2994, 2994, 2994, 2994, 2994, 2994, 2994, 2994, 2994, 2994, 2995, 2995, 2995, 2995, 2995, 2995, 2995, 2995, 2995, 2995, 2995,
-        2995, 2995, 2995, 2995, 2995, 2995, 2995, 2995, 2995, 2995, 2995, 2995, 2995, 2995, 2996, 2996, 2996, 2996, 2996, 2996, 2996, 2996, 2996, 2996, 2996, 2996,
-        2996, 2996, 2996, 2996, 2996, 2996, 2996, 2996, 2996, 2996, 2996, 2996, 2996, 2996, 2997, 2997, 2997, 2997, 2997, 2997, 2997, 2997, 2997, 2997, 2997, 2997,
-        2997, 2997, 2997, 2997, 2997, 2997, 2997, 2997, 2997, 2997, 2997, 2997, 2997, 2998, 2998, 2998, 2998, 2998, 2998, 2998, 2998, 2998, 2998, 2998, 2998, 2998,
-        2998, 2998, 2998, 2998, 2998, 2998, 2998, 2998, 2998, 2998, 2998, 2998, 2999, 2999, 2999, 2999, 2999, 2999, 2999, 2999, 2999, 2999, 2999, 2999, 2999, 2999,
-        2999, 2999, 2999, 2999, 2999, 2999, 2999, 2999, 2999, 2999, 2999, 3000, 3000, 3000, 3000, 3000, 3000, 3000, 3000, 3000, 3000, 3000, 3000, 3000, 3000, 3000,
-        3000, 3000, 3000, 3000, 3000, 3000, 3000, 3000, 3000, 3000, 3000, 3001, 3001, 3001, 3001, 3001, 3001, 3001, 3001, 3001, 3001, 3001, 3001, 3001, 3001, 3001,
-        3001, 3001, 3001, 3001, 3001, 3001, 3001, 3001, 3001, 3001, 3002, 3002, 3002, 3002, 3002, 3002, 3002, 3002, 3002, 3002, 3002, 3002, 3002, 3002, 3002, 3002,
-        3002, 3002, 3002, 3002, 3002, 3002, 3002, 3002, 3002, 3003, 3003, 3003, 3003, 3003, 3003, 3003, 3003, 3003, 3003, 3003, 3003, 3003, 3003, 3003, 3003, 3003,
-        3003, 3003, 3003, 3003, 3003, 3003, 3003, 3003, 3003, 3004, 3004, 3004, 3004, 3004, 3004, 3004, 3004, 3004, 3004, 3004, 3004, 3004, 3004, 3004, 3004, 3004,
-        3004, 3004, 3004, 3004, 3004, 3004, 3004, 3004, 3005, 3005, 3005, 3005, 3005, 3005, 3005, 3005, 3005, 3005, 3005, 3005, 3005, 3005, 3005, 3005, 3005, 3005,
-        3005, 3005, 3005, 3005, 3005, 3005, 3005, 3006, 3006, 3006, 3006, 3006, 3006, 3006, 3006, 3006, 3006, 3006, 3006, 3006, 3006, 3006, 3006, 3006, 3006, 3006,
-        3006, 3006, 3006, 3006, 3006, 3006, 3006, 3007, 3007, 3007, 3007, 3007, 3007, 3007, 3007, 3007, 3007, 3007, 3007, 3007, 3007, 3007, 3007, 3007, 3007, 3007,
-        3007, 3007, 3007, 3007, 3007, 3007, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008,
-        3008, 3008, 3008, 3008, 3008, 3008, 3009, 3009, 3009, 3009, 3009, 3009, 3009, 3009, 3009, 3009, 3009, 3009, 3009, 3009, 3009, 3009, 3009, 3009, 3009, 3009,
-        3009, 3009, 3009, 3009, 3009, 3010, 3010, 3010, 3010, 3010, 3010, 3010, 3010, 3010, 3010, 3010, 3010, 3010, 3010, 3010, 3010, 3010, 3010, 3010, 3010, 3010,
-        3010, 3010, 3010, 3010, 3011, 3011, 3011, 3011, 3011, 3011, 3011, 3011, 3011, 3011, 3011, 3011, 3011, 3011, 3011, 3011, 3011, 3011, 3011, 3011, 3011, 3011,
-        3011, 3011, 3011, 3011, 3012, 3012, 3012, 3012, 3012, 3012, 3012, 3012, 3012, 3012, 3012, 3012, 3012, 3012, 3012, 3012, 3012, 3012, 3012, 3012, 3012, 3012,
-        3012, 3012, 3012, 3013, 3013, 3013, 3013, 3013, 3013, 3013, 3013, 3013, 3013, 3013, 3013, 3013, 3013, 3013, 3013, 3013, 3013, 3013, 3013, 3013, 3013, 3013,
-        3013, 3013, 3013, 3014, 3014, 3014, 3014, 3014, 3014, 3014, 3014, 3014, 3014, 3014, 3014, 3014, 3014, 3014, 3014, 3014, 3014, 3014, 3014, 3014, 3014, 3014,
-        3014, 3014, 3015, 3015, 3015, 3015, 3015, 3015, 3015, 3015, 3015, 3015, 3015, 3015, 3015, 3015, 3015, 3015, 3015, 3015, 3015, 3015, 3015, 3015, 3015, 3015,
-        3015, 3015, 3016, 3016, 3016, 3016, 3016, 3016, 3016, 3016, 3016, 3016, 3016, 3016, 3016, 3016, 3016, 3016, 3016, 3016, 3016, 3016, 3016, 3016, 3016, 3016,
-        3016, 3017, 3017, 3017, 3017, 3017, 3017, 3017, 3017, 3017, 3017, 3017, 3017, 3017, 3017, 3017, 3017, 3017, 3017, 3017, 3017, 3017, 3017, 3017, 3017, 3017,
-        3017, 3018, 3018, 3018, 3018, 3018, 3018, 3018, 3018, 3018, 3018, 3018, 3018, 3018, 3018, 3018, 3018, 3018, 3018, 3018, 3018, 3018, 3018, 3018, 3018, 3018,
-        3019, 3019, 3019, 3019, 3019, 3019, 3019, 3019, 3019, 3019, 3019, 3019, 3019, 3019, 3019, 3019, 3019, 3019, 3019, 3019, 3019, 3019, 3019, 3019, 3019, 3019,
-        3020, 3020, 3020, 3020, 3020, 3020, 3020, 3020, 3020, 3020, 3020, 3020, 3020, 3020, 3020, 3020, 3020, 3020, 3020, 3020, 3020, 3020, 3020, 3020, 3020, 3020,
-        3021, 3021, 3021, 3021, 3021, 3021, 3021, 3021, 3021, 3021, 3021, 3021, 3021, 3021, 3021, 3021, 3021, 3021, 3021, 3021, 3021, 3021, 3021, 3021, 3021, 3022,
-        3022, 3022, 3022, 3022, 3022, 3022, 3022, 3022, 3022, 3022, 3022, 3022, 3022, 3022, 3022, 3022, 3022, 3022, 3022, 3022, 3022, 3022, 3022, 3022, 3022, 3023,
-        3023, 3023, 3023, 3023, 3023, 3023, 3023, 3023, 3023, 3023, 3023, 3023, 3023, 3023, 3023, 3023, 3023, 3023, 3023, 3023, 3023, 3023, 3023, 3023, 3024, 3024,
-        3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3025, 3025,
-        3025, 3025, 3025, 3025, 3025, 3025, 3025, 3025, 3025, 3025, 3025, 3025, 3025, 3025, 3025, 3025, 3025, 3025, 3025, 3025, 3025, 3025, 3025, 3025, 3026, 3026,
-        3026, 3026, 3026, 3026, 3026, 3026, 3026, 3026, 3026, 3026, 3026, 3026, 3026, 3026, 3026, 3026, 3026, 3026, 3026, 3026, 3026, 3026, 3026, 3027, 3027, 3027,
-        3027, 3027, 3027, 3027, 3027, 3027, 3027, 3027, 3027, 3027, 3027, 3027, 3027, 3027, 3027, 3027, 3027, 3027, 3027, 3027, 3027, 3027, 3027, 3028, 3028, 3028,
-        3028, 3028, 3028, 3028, 3028, 3028, 3028, 3028, 3028, 3028, 3028, 3028, 3028, 3028, 3028, 3028, 3028, 3028, 3028, 3028, 3028, 3028, 3028, 3029, 3029, 3029,
-        3029, 3029, 3029, 3029, 3029, 3029, 3029, 3029, 3029, 3029, 3029, 3029, 3029, 3029, 3029, 3029, 3029, 3029, 3029, 3029, 3029, 3029, 3030, 3030, 3030, 3030,
-        3030, 3030, 3030, 3030, 3030, 3030, 3030, 3030, 3030, 3030, 3030, 3030, 3030, 3030, 3030, 3030, 3030, 3030, 3030, 3030, 3030, 3030, 3031, 3031, 3031, 3031,
-        3031, 3031, 3031, 3031, 3031, 3031, 3031, 3031, 3031, 3031, 3031, 3031, 3031, 3031, 3031, 3031, 3031, 3031, 3031, 3031, 3031, 3031, 3032, 3032, 3032, 3032,
-        3032, 3032, 3032, 3032, 3032, 3032, 3032, 3032, 3032, 3032, 3032, 3032, 3032, 3032, 3032, 3032, 3032, 3032, 3032, 3032, 3032, 3033, 3033, 3033, 3033, 3033,
-        3033, 3033, 3033, 3033, 3033, 3033, 3033, 3033, 3033, 3033, 3033, 3033, 3033, 3033, 3033, 3033, 3033, 3033, 3033, 3033, 3033, 3034, 3034, 3034, 3034, 3034,
-        3034, 3034, 3034, 3034, 3034, 3034, 3034, 3034, 3034, 3034, 3034, 3034, 3034, 3034, 3034, 3034, 3034, 3034, 3034, 3034, 3034, 3035, 3035, 3035, 3035, 3035,
-        3035, 3035, 3035, 3035, 3035, 3035, 3035, 3035, 3035, 3035, 3035, 3035, 3035, 3035, 3035, 3035, 3035, 3035, 3035, 3035, 3035, 3036, 3036, 3036, 3036, 3036,
-        3036, 3036, 3036, 3036, 3036, 3036, 3036, 3036, 3036, 3036, 3036, 3036, 3036, 3036, 3036, 3036, 3036, 3036, 3036, 3036, 3037, 3037, 3037, 3037, 3037, 3037,
-        3037, 3037, 3037, 3037, 3037, 3037, 3037, 3037, 3037, 3037, 3037, 3037, 3037, 3037, 3037, 3037, 3037, 3037, 3037, 3037, 3038, 3038, 3038, 3038, 3038, 3038,
-        3038, 3038, 3038, 3038, 3038, 3038, 3038, 3038, 3038, 3038, 3038, 3038, 3038, 3038, 3038, 3038, 3038, 3038, 3038, 3038, 3039, 3039, 3039, 3039, 3039, 3039,
-        3039, 3039, 3039, 3039, 3039, 3039, 3039, 3039, 3039, 3039, 3039, 3039, 3039, 3039, 3039, 3039, 3039, 3039, 3039, 3039, 3040, 3040, 3040, 3040, 3040, 3040,
-        3040, 3040, 3040, 3040, 3040, 3040, 3040, 3040, 3040, 3040, 3040, 3040, 3040, 3040, 3040, 3040, 3040, 3040, 3040, 3040, 3041, 3041, 3041, 3041, 3041, 3041,
-        3041, 3041, 3041, 3041, 3041, 3041, 3041, 3041, 3041, 3041, 3041, 3041, 3041, 3041, 3041, 3041, 3041, 3041, 3041, 3041, 3042, 3042, 3042, 3042, 3042, 3042,
-        3042, 3042, 3042, 3042, 3042, 3042, 3042, 3042, 3042, 3042, 3042, 3042, 3042, 3042, 3042, 3042, 3042, 3042, 3042, 3043, 3043, 3043, 3043, 3043, 3043, 3043,
-        3043, 3043, 3043, 3043, 3043, 3043, 3043, 3043, 3043, 3043, 3043, 3043, 3043, 3043, 3043, 3043, 3043, 3043, 3043, 3044, 3044, 3044, 3044, 3044, 3044, 3044,
-        3044, 3044, 3044, 3044, 3044, 3044, 3044, 3044, 3044, 3044, 3044, 3044, 3044, 3044, 3044, 3044, 3044, 3044, 3044, 3045, 3045, 3045, 3045, 3045, 3045, 3045,
-        3045, 3045, 3045, 3045, 3045, 3045, 3045, 3045, 3045, 3045, 3045, 3045, 3045, 3045, 3045, 3045, 3045, 3045, 3045, 3046, 3046, 3046, 3046, 3046, 3046, 3046,
-        3046, 3046, 3046, 3046, 3046, 3046, 3046, 3046, 3046, 3046, 3046, 3046, 3046, 3046, 3046, 3046, 3046, 3046, 3046, 3047, 3047, 3047, 3047, 3047, 3047, 3047,
-        3047, 3047, 3047, 3047, 3047, 3047, 3047, 3047, 3047, 3047, 3047, 3047, 3047, 3047, 3047, 3047, 3047, 3047, 3047, 3048, 3048, 3048, 3048, 3048, 3048, 3048,
-        3048, 3048, 3048, 3048, 3048, 3048, 3048, 3048, 3048, 3048, 3048, 3048, 3048, 3048, 3048, 3048, 3048, 3048, 3048, 3049, 3049, 3049, 3049, 3049, 3049, 3049,
-        3049, 3049, 3049, 3049, 3049, 3049, 3049, 3049, 3049, 3049, 3049, 3049, 3049, 3049, 3049, 3049, 3049, 3049, 3049, 3050, 3050, 3050, 3050, 3050, 3050, 3050,
-        3050, 3050, 3050, 3050, 3050, 3050, 3050, 3050, 3050, 3050, 3050, 3050, 3050, 3050, 3050, 3050, 3050, 3050, 3050, 3051, 3051, 3051, 3051, 3051, 3051, 3051,
-        3051, 3051, 3051, 3051, 3051, 3051, 3051, 3051, 3051, 3051, 3051, 3051, 3051, 3051, 3051, 3051, 3051, 3051, 3051, 3052, 3052, 3052, 3052, 3052, 3052, 3052,
-        3052, 3052, 3052, 3052, 3052, 3052, 3052, 3052, 3052, 3052, 3052, 3052, 3052, 3052, 3052, 3052, 3052, 3052, 3052, 3053, 3053, 3053, 3053, 3053, 3053, 3053,
-        3053, 3053, 3053, 3053, 3053, 3053, 3053, 3053, 3053, 3053, 3053, 3053, 3053, 3053, 3053, 3053, 3053, 3053, 3053, 3054, 3054, 3054, 3054, 3054, 3054, 3054,
-        3054, 3054, 3054, 3054, 3054, 3054, 3054, 3054, 3054, 3054, 3054, 3054, 3054, 3054, 3054, 3054, 3054, 3054, 3054, 3055, 3055, 3055, 3055, 3055, 3055, 3055,
-        3055, 3055, 3055, 3055, 3055, 3055, 3055, 3055, 3055, 3055, 3055, 3055, 3055, 3055, 3055, 3055, 3055, 3055, 3055, 3056, 3056, 3056, 3056, 3056, 3056, 3056,
-        3056, 3056, 3056, 3056, 3056, 3056, 3056, 3056, 3056, 3056, 3056, 3056, 3056, 3056, 3056, 3056, 3056, 3056, 3056, 3057, 3057, 3057, 3057, 3057, 3057, 3057,
-        3057, 3057, 3057, 3057, 3057, 3057, 3057, 3057, 3057, 3057, 3057, 3057, 3057, 3057, 3057, 3057, 3057, 3057, 3057, 3058, 3058, 3058, 3058, 3058, 3058, 3058,
-        3058, 3058, 3058, 3058, 3058, 3058, 3058, 3058, 3058, 3058, 3058, 3058, 3058, 3058, 3058, 3058, 3058, 3058, 3058, 3059, 3059, 3059, 3059, 3059, 3059, 3059,
-        3059, 3059, 3059, 3059, 3059, 3059, 3059, 3059, 3059, 3059, 3059, 3059, 3059, 3059, 3059, 3059, 3059, 3059, 3059, 3060, 3060, 3060, 3060, 3060, 3060, 3060,
-        3060, 3060, 3060, 3060, 3060, 3060, 3060, 3060, 3060, 3060, 3060, 3060, 3060, 3060, 3060, 3060, 3060, 3060, 3060, 3061, 3061, 3061, 3061, 3061, 3061, 3061,
-        3061, 3061, 3061, 3061, 3061, 3061, 3061, 3061, 3061, 3061, 3061, 3061, 3061, 3061, 3061, 3061, 3061, 3061, 3061, 3061, 3062, 3062, 3062, 3062, 3062, 3062,
-        3062, 3062, 3062, 3062, 3062, 3062, 3062, 3062, 3062, 3062, 3062, 3062, 3062, 3062, 3062, 3062, 3062, 3062, 3062, 3062, 3063, 3063, 3063, 3063, 3063, 3063,
-        3063, 3063, 3063, 3063, 3063, 3063, 3063, 3063, 3063, 3063, 3063, 3063, 3063, 3063, 3063, 3063, 3063, 3063, 3063, 3063, 3064, 3064, 3064, 3064, 3064, 3064,
-        3064, 3064, 3064, 3064, 3064, 3064, 3064, 3064, 3064, 3064, 3064, 3064, 3064, 3064, 3064, 3064, 3064, 3064, 3064, 3064, 3065, 3065, 3065, 3065, 3065, 3065,
-        3065, 3065, 3065, 3065, 3065, 3065, 3065, 3065, 3065, 3065, 3065, 3065, 3065, 3065, 3065, 3065, 3065, 3065, 3065, 3065, 3066, 3066, 3066, 3066, 3066, 3066,
-        3066, 3066, 3066, 3066, 3066, 3066, 3066, 3066, 3066, 3066, 3066, 3066, 3066, 3066, 3066, 3066, 3066, 3066, 3066, 3066, 3067, 3067, 3067, 3067, 3067, 3067,
-        3067, 3067, 3067, 3067, 3067, 3067, 3067, 3067, 3067, 3067, 3067, 3067, 3067, 3067, 3067, 3067, 3067, 3067, 3067, 3067, 3067, 3068, 3068, 3068, 3068, 3068,
-        3068, 3068, 3068, 3068, 3068, 3068, 3068, 3068, 3068, 3068, 3068, 3068, 3068, 3068, 3068, 3068, 3068, 3068, 3068, 3068, 3068, 3069, 3069, 3069, 3069, 3069,
-        3069, 3069, 3069, 3069, 3069, 3069, 3069, 3069, 3069, 3069, 3069, 3069, 3069, 3069, 3069, 3069, 3069, 3069, 3069, 3069, 3069, 3070, 3070, 3070, 3070, 3070,
-        3070, 3070, 3070, 3070, 3070, 3070, 3070, 3070, 3070, 3070, 3070, 3070, 3070, 3070, 3070, 3070, 3070, 3070, 3070, 3070, 3070, 3071, 3071, 3071, 3071, 3071,
-        3071, 3071, 3071, 3071, 3071, 3071, 3071, 3071, 3071, 3071, 3071, 3071, 3071, 3071, 3071, 3071, 3071, 3071, 3071, 3071, 3071, 3071, 3072, 3072, 3072, 3072,
-        3072, 3072, 3072, 3072, 3072, 3072, 3072, 3072, 3072, 3072, 3072, 3072, 3072, 3072, 3072, 3072, 3072, 3072, 3072, 3072, 3072, 3072, 3073, 3073, 3073, 3073,
-        3073, 3073, 3073, 3073, 3073, 3073, 3073, 3073, 3073, 3073, 3073, 3073, 3073, 3073, 3073, 3073, 3073, 3073, 3073, 3073, 3073, 3073, 3074, 3074, 3074, 3074,
-        3074, 3074, 3074, 3074, 3074, 3074, 3074, 3074, 3074, 3074, 3074, 3074, 3074, 3074, 3074, 3074, 3074, 3074, 3074, 3074, 3074, 3074, 3075, 3075, 3075, 3075,
-        3075, 3075, 3075, 3075, 3075, 3075, 3075, 3075, 3075, 3075, 3075, 3075, 3075, 3075, 3075, 3075, 3075, 3075, 3075, 3075, 3075, 3075, 3075, 3076, 3076, 3076,
-        3076, 3076, 3076, 3076, 3076, 3076, 3076, 3076, 3076, 3076, 3076, 3076, 3076, 3076, 3076, 3076, 3076, 3076, 3076, 3076, 3076, 3076, 3076, 3077, 3077, 3077,
-        3077, 3077, 3077, 3077, 3077, 3077, 3077, 3077, 3077, 3077, 3077, 3077, 3077, 3077, 3077, 3077, 3077, 3077, 3077, 3077, 3077, 3077, 3077, 3078, 3078, 3078,
-        3078, 3078, 3078, 3078, 3078, 3078, 3078, 3078, 3078, 3078, 3078, 3078, 3078, 3078, 3078, 3078, 3078, 3078, 3078, 3078, 3078, 3078, 3078, 3078, 3079, 3079,
-        3079, 3079, 3079, 3079, 3079, 3079, 3079, 3079, 3079, 3079, 3079, 3079, 3079, 3079, 3079, 3079, 3079, 3079, 3079, 3079, 3079, 3079, 3079, 3079, 3080, 3080,
-        3080, 3080, 3080, 3080, 3080, 3080, 3080, 3080, 3080, 3080, 3080, 3080, 3080, 3080, 3080, 3080, 3080, 3080, 3080, 3080, 3080, 3080, 3080, 3080, 3080, 3081,
-        3081, 3081, 3081, 3081, 3081, 3081, 3081, 3081, 3081, 3081, 3081, 3081, 3081, 3081, 3081, 3081, 3081, 3081, 3081, 3081, 3081, 3081, 3081, 3081, 3081, 3082,
-        3082, 3082, 3082, 3082, 3082, 3082, 3082, 3082, 3082, 3082, 3082, 3082, 3082, 3082, 3082, 3082, 3082, 3082, 3082, 3082, 3082, 3082, 3082, 3082, 3082, 3083,
-        3083, 3083, 3083, 3083, 3083, 3083, 3083, 3083, 3083, 3083, 3083, 3083, 3083, 3083, 3083, 3083, 3083, 3083, 3083, 3083, 3083, 3083, 3083, 3083, 3083, 3083,
-        3084, 3084, 3084, 3084, 3084, 3084, 3084, 3084, 3084, 3084, 3084, 3084, 3084, 3084, 3084, 3084, 3084, 3084, 3084, 3084, 3084, 3084, 3084, 3084, 3084, 3084,
-        3085, 3085, 3085, 3085, 3085, 3085, 3085, 3085, 3085, 3085, 3085, 3085, 3085, 3085, 3085, 3085, 3085, 3085, 3085, 3085, 3085, 3085, 3085, 3085, 3085, 3085,
-        3085, 3086, 3086, 3086, 3086, 3086, 3086, 3086, 3086, 3086, 3086, 3086, 3086, 3086, 3086, 3086, 3086, 3086, 3086, 3086, 3086, 3086, 3086, 3086, 3086, 3086,
-        3086, 3087, 3087, 3087, 3087, 3087, 3087, 3087, 3087, 3087, 3087, 3087, 3087, 3087, 3087, 3087, 3087, 3087, 3087, 3087, 3087, 3087, 3087, 3087, 3087, 3087,
-        3087, 3087, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088,
-        3088, 3088, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089,
-        3089, 3089, 3089, 3090, 3090, 3090, 3090, 3090, 3090, 3090, 3090, 3090, 3090, 3090, 3090, 3090, 3090, 3090, 3090, 3090, 3090, 3090, 3090, 3090, 3090, 3090,
-        3090, 3090, 3090, 3091, 3091, 3091, 3091, 3091, 3091, 3091, 3091, 3091, 3091, 3091, 3091, 3091, 3091, 3091, 3091, 3091, 3091, 3091, 3091, 3091, 3091, 3091,
-        3091, 3091, 3091, 3091, 3092, 3092, 3092, 3092, 3092, 3092, 3092, 3092, 3092, 3092, 3092, 3092, 3092, 3092, 3092, 3092, 3092, 3092, 3092, 3092, 3092, 3092,
-        3092, 3092, 3092, 3092, 3093, 3093, 3093, 3093, 3093, 3093, 3093, 3093, 3093, 3093, 3093, 3093, 3093, 3093, 3093, 3093, 3093, 3093, 3093, 3093, 3093, 3093,
-        3093, 3093, 3093, 3093, 3093, 3094, 3094, 3094, 3094, 3094, 3094, 3094, 3094, 3094, 3094, 3094, 3094, 3094, 3094, 3094, 3094, 3094, 3094, 3094, 3094, 3094,
-        3094, 3094, 3094, 3094, 3094, 3095, 3095, 3095, 3095, 3095, 3095, 3095, 3095, 3095, 3095, 3095, 3095, 3095, 3095, 3095, 3095, 3095, 3095, 3095, 3095, 3095,
-        3095, 3095, 3095, 3095, 3095, 3095, 3096, 3096, 3096, 3096, 3096, 3096, 3096, 3096, 3096, 3096, 3096, 3096, 3096, 3096, 3096, 3096, 3096, 3096, 3096, 3096,
-        3096, 3096, 3096, 3096, 3096, 3096, 3096, 3097, 3097, 3097, 3097, 3097, 3097, 3097, 3097, 3097, 3097, 3097, 3097, 3097, 3097, 3097, 3097, 3097, 3097, 3097,
-        3097, 3097, 3097, 3097, 3097, 3097, 3097, 3098, 3098, 3098, 3098, 3098, 3098, 3098, 3098, 3098, 3098, 3098, 3098, 3098, 3098, 3098, 3098, 3098, 3098, 3098,
-        3098, 3098, 3098, 3098, 3098, 3098, 3098, 3098, 3099, 3099, 3099, 3099, 3099, 3099, 3099, 3099, 3099, 3099, 3099, 3099, 3099, 3099, 3099, 3099, 3099, 3099,
-        3099, 3099, 3099, 3099, 3099, 3099, 3099, 3099, 3100, 3100, 3100, 3100, 3100, 3100, 3100, 3100, 3100, 3100, 3100, 3100, 3100, 3100, 3100, 3100, 3100, 3100,
-        3100, 3100, 3100, 3100, 3100, 3100, 3100, 3100, 3100, 3101, 3101, 3101, 3101, 3101, 3101, 3101, 3101, 3101, 3101, 3101, 3101, 3101, 3101, 3101, 3101, 3101,
-        3101, 3101, 3101, 3101, 3101, 3101, 3101, 3101, 3101, 3101, 3102, 3102, 3102, 3102, 3102, 3102, 3102, 3102, 3102, 3102, 3102, 3102, 3102, 3102, 3102, 3102,
-        3102, 3102, 3102, 3102, 3102, 3102, 3102, 3102, 3102, 3102, 3103, 3103, 3103, 3103, 3103, 3103, 3103, 3103, 3103, 3103, 3103, 3103, 3103, 3103, 3103, 3103,
-        3103, 3103, 3103, 3103, 3103, 3103, 3103, 3103, 3103, 3103, 3103, 3104, 3104, 3104, 3104, 3104, 3104, 3104, 3104, 3104, 3104, 3104, 3104, 3104, 3104, 3104,
-        3104, 3104, 3104, 3104, 3104, 3104, 3104, 3104, 3104, 3104, 3104, 3104, 3105, 3105, 3105, 3105, 3105, 3105, 3105, 3105, 3105, 3105, 3105, 3105, 3105, 3105,
-        3105, 3105, 3105, 3105, 3105, 3105, 3105, 3105, 3105, 3105, 3105, 3105, 3105, 3106, 3106, 3106, 3106, 3106, 3106, 3106, 3106, 3106, 3106, 3106, 3106, 3106,
-        3106, 3106, 3106, 3106, 3106, 3106, 3106, 3106, 3106, 3106, 3106, 3106, 3106, 3107, 3107, 3107, 3107, 3107, 3107, 3107, 3107, 3107, 3107, 3107, 3107, 3107,
-        3107, 3107, 3107, 3107, 3107, 3107, 3107, 3107, 3107, 3107, 3107, 3107, 3107, 3107, 3108, 3108, 3108, 3108, 3108, 3108, 3108, 3108, 3108, 3108, 3108, 3108,
-        3108, 3108, 3108, 3108, 3108, 3108, 3108, 3108, 3108, 3108, 3108, 3108, 3108, 3108, 3108, 3109, 3109, 3109, 3109, 3109, 3109, 3109, 3109, 3109, 3109, 3109,
-        3109, 3109, 3109, 3109, 3109, 3109, 3109, 3109, 3109, 3109, 3109, 3109, 3109, 3109, 3109, 3109, 3110, 3110, 3110, 3110, 3110, 3110, 3110, 3110, 3110, 3110,
-        3110, 3110, 3110, 3110, 3110, 3110, 3110, 3110, 3110, 3110, 3110, 3110, 3110, 3110, 3110, 3110, 3110, 3111, 3111, 3111, 3111, 3111, 3111, 3111, 3111, 3111,
-        3111, 3111, 3111, 3111, 3111, 3111, 3111, 3111, 3111, 3111, 3111, 3111, 3111, 3111, 3111, 3111, 3111, 3112, 3112, 3112, 3112, 3112, 3112, 3112, 3112, 3112,
-        3112, 3112, 3112, 3112, 3112, 3112, 3112, 3112, 3112, 3112, 3112, 3112, 3112, 3112, 3112, 3112, 3112, 3112, 3113, 3113, 3113, 3113, 3113, 3113, 3113, 3113,
-        3113, 3113, 3113, 3113, 3113, 3113, 3113, 3113, 3113, 3113, 3113, 3113, 3113, 3113, 3113, 3113, 3113, 3113, 3113, 3114, 3114, 3114, 3114, 3114, 3114, 3114,
-        3114, 3114, 3114, 3114, 3114, 3114, 3114, 3114, 3114, 3114, 3114, 3114, 3114, 3114, 3114, 3114, 3114, 3114, 3114, 3114, 3115, 3115, 3115, 3115, 3115, 3115,
-        3115, 3115, 3115, 3115, 3115, 3115, 3115, 3115, 3115, 3115, 3115, 3115, 3115, 3115, 3115, 3115, 3115, 3115, 3115, 3115, 3115, 3116, 3116, 3116, 3116, 3116,
-        3116, 3116, 3116, 3116, 3116, 3116, 3116, 3116, 3116, 3116, 3116, 3116, 3116, 3116, 3116, 3116, 3116, 3116, 3116, 3116, 3116, 3116, 3117, 3117, 3117, 3117,
-        3117, 3117, 3117, 3117, 3117, 3117, 3117, 3117, 3117, 3117, 3117, 3117, 3117, 3117, 3117, 3117, 3117, 3117, 3117, 3117, 3117, 3117, 3118, 3118, 3118, 3118,
-        3118, 3118, 3118, 3118, 3118, 3118, 3118, 3118, 3118, 3118, 3118, 3118, 3118, 3118, 3118, 3118, 3118, 3118, 3118, 3118, 3118, 3118, 3118, 3119, 3119, 3119,
-        3119, 3119, 3119, 3119, 3119, 3119, 3119, 3119, 3119, 3119, 3119, 3119, 3119, 3119, 3119, 3119, 3119, 3119, 3119, 3119, 3119, 3119, 3119, 3119, 3120, 3120,
-        3120, 3120, 3120, 3120, 3120, 3120, 3120, 3120, 3120, 3120, 3120, 3120, 3120, 3120, 3120, 3120, 3120, 3120, 3120, 3120, 3120, 3120, 3120, 3120, 3120, 3121,
-        3121, 3121, 3121, 3121, 3121, 3121, 3121, 3121, 3121, 3121, 3121, 3121, 3121, 3121, 3121, 3121, 3121, 3121, 3121, 3121, 3121, 3121, 3121, 3121, 3121, 3121,
-        3122, 3122, 3122, 3122, 3122, 3122, 3122, 3122, 3122, 3122, 3122, 3122, 3122, 3122, 3122, 3122, 3122, 3122, 3122, 3122, 3122, 3122, 3122, 3122, 3122, 3122,
-        3122, 3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123,
-        3123, 3123, 3124, 3124, 3124, 3124, 3124, 3124, 3124, 3124, 3124, 3124, 3124, 3124, 3124, 3124, 3124, 3124, 3124, 3124, 3124, 3124, 3124, 3124, 3124, 3124,
-        3124, 3124, 3124, 3125, 3125, 3125, 3125, 3125, 3125, 3125, 3125, 3125, 3125, 3125, 3125, 3125, 3125, 3125, 3125, 3125, 3125, 3125, 3125, 3125, 3125, 3125,
-        3125, 3125, 3125, 3125, 3126, 3126, 3126, 3126, 3126, 3126, 3126, 3126, 3126, 3126, 3126, 3126, 3126, 3126, 3126, 3126, 3126, 3126, 3126, 3126, 3126, 3126,
-        3126, 3126, 3126, 3126, 3126, 3127, 3127, 3127, 3127, 3127, 3127, 3127, 3127, 3127, 3127, 3127, 3127, 3127, 3127, 3127, 3127, 3127, 3127, 3127, 3127, 3127,
-        3127, 3127, 3127, 3127, 3127, 3127, 3128, 3128, 3128, 3128, 3128, 3128, 3128, 3128, 3128, 3128, 3128, 3128, 3128, 3128, 3128, 3128, 3128, 3128, 3128, 3128,
-        3128, 3128, 3128, 3128, 3128, 3128, 3128, 3129, 3129, 3129, 3129, 3129, 3129, 3129, 3129, 3129, 3129, 3129, 3129, 3129, 3129, 3129, 3129, 3129, 3129, 3129,
-        3129, 3129, 3129, 3129, 3129, 3129, 3129, 3129, 3130, 3130, 3130, 3130, 3130, 3130, 3130, 3130, 3130, 3130, 3130, 3130, 3130, 3130, 3130, 3130, 3130, 3130,
-        3130, 3130, 3130, 3130, 3130, 3130, 3130, 3130, 3130, 3131, 3131, 3131, 3131, 3131, 3131, 3131, 3131, 3131, 3131, 3131, 3131, 3131, 3131, 3131, 3131, 3131,
-        3131, 3131, 3131, 3131, 3131, 3131, 3131, 3131, 3131, 3131, 3132, 3132, 3132, 3132, 3132, 3132, 3132, 3132, 3132, 3132, 3132, 3132, 3132, 3132, 3132, 3132,
-        3132, 3132, 3132, 3132, 3132, 3132, 3132, 3132, 3132, 3132, 3132, 3132, 3133, 3133, 3133, 3133, 3133, 3133, 3133, 3133, 3133, 3133, 3133, 3133, 3133, 3133,
-        3133, 3133, 3133, 3133, 3133, 3133, 3133, 3133, 3133, 3133, 3133, 3133, 3133, 3134, 3134, 3134, 3134, 3134, 3134, 3134, 3134, 3134, 3134, 3134, 3134, 3134,
-        3134, 3134, 3134, 3134, 3134, 3134, 3134, 3134, 3134, 3134, 3134, 3134, 3134, 3134, 3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135,
-        3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136,
-        3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3137, 3137, 3137, 3137, 3137, 3137, 3137, 3137, 3137, 3137,
-        3137, 3137, 3137, 3137, 3137, 3137, 3137, 3137, 3137, 3137, 3137, 3137, 3137, 3137, 3137, 3137, 3137, 3138, 3138, 3138, 3138, 3138, 3138, 3138, 3138, 3138,
-        3138, 3138, 3138, 3138, 3138, 3138, 3138, 3138, 3138, 3138, 3138, 3138, 3138, 3138, 3138, 3138, 3138, 3138, 3139, 3139, 3139, 3139, 3139, 3139, 3139, 3139,
-        3139, 3139, 3139, 3139, 3139, 3139, 3139, 3139, 3139, 3139, 3139, 3139, 3139, 3139, 3139, 3139, 3139, 3139, 3139, 3139, 3140, 3140, 3140, 3140, 3140, 3140,
-        3140, 3140, 3140, 3140, 3140, 3140, 3140, 3140, 3140, 3140, 3140, 3140, 3140, 3140, 3140, 3140, 3140, 3140, 3140, 3140, 3140, 3141, 3141, 3141, 3141, 3141,
-        3141, 3141, 3141, 3141, 3141, 3141, 3141, 3141, 3141, 3141, 3141, 3141, 3141, 3141, 3141, 3141, 3141, 3141, 3141, 3141, 3141, 3141, 3142, 3142, 3142, 3142,
-        3142, 3142, 3142, 3142, 3142, 3142, 3142, 3142, 3142, 3142, 3142, 3142, 3142, 3142, 3142, 3142, 3142, 3142, 3142, 3142, 3142, 3142, 3142, 3143, 3143, 3143,
-        3143, 3143, 3143, 3143, 3143, 3143, 3143, 3143, 3143, 3143, 3143, 3143, 3143, 3143, 3143, 3143, 3143, 3143, 3143, 3143, 3143, 3143, 3143, 3143, 3143, 3144,
-        3144, 3144, 3144, 3144, 3144, 3144, 3144, 3144, 3144, 3144, 3144, 3144, 3144, 3144, 3144, 3144, 3144, 3144, 3144, 3144, 3144, 3144, 3144, 3144, 3144, 3144,
-        3145, 3145, 3145, 3145, 3145, 3145, 3145, 3145, 3145, 3145, 3145, 3145, 3145, 3145, 3145, 3145, 3145, 3145, 3145, 3145, 3145, 3145, 3145, 3145, 3145, 3145,
-        3145, 3146, 3146, 3146, 3146, 3146, 3146, 3146, 3146, 3146, 3146, 3146, 3146, 3146, 3146, 3146, 3146, 3146, 3146, 3146, 3146, 3146, 3146, 3146, 3146, 3146,
-        3146, 3146, 3147, 3147, 3147, 3147, 3147, 3147, 3147, 3147, 3147, 3147, 3147, 3147, 3147, 3147, 3147, 3147, 3147, 3147, 3147, 3147, 3147, 3147, 3147, 3147,
-        3147, 3147, 3147, 3147, 3148, 3148, 3148, 3148, 3148, 3148, 3148, 3148, 3148, 3148, 3148, 3148, 3148, 3148, 3148, 3148, 3148, 3148, 3148, 3148, 3148, 3148,
-        3148, 3148, 3148, 3148, 3148, 3149, 3149, 3149, 3149, 3149, 3149, 3149, 3149, 3149, 3149, 3149, 3149, 3149, 3149, 3149, 3149, 3149, 3149, 3149, 3149, 3149,
-        3149, 3149, 3149, 3149, 3149, 3149, 3150, 3150, 3150, 3150, 3150, 3150, 3150, 3150, 3150, 3150, 3150, 3150, 3150, 3150, 3150, 3150, 3150, 3150, 3150, 3150,
-        3150, 3150, 3150, 3150, 3150, 3150, 3150, 3150, 3151, 3151, 3151, 3151, 3151, 3151, 3151, 3151, 3151, 3151, 3151, 3151, 3151, 3151, 3151, 3151, 3151, 3151,
-        3151, 3151, 3151, 3151, 3151, 3151, 3151, 3151, 3151, 3152, 3152, 3152, 3152, 3152, 3152, 3152, 3152, 3152, 3152, 3152, 3152, 3152, 3152, 3152, 3152, 3152,
-        3152, 3152, 3152, 3152, 3152, 3152, 3152, 3152, 3152, 3152, 3152, 3153, 3153, 3153, 3153, 3153, 3153, 3153, 3153, 3153, 3153, 3153, 3153, 3153, 3153, 3153,
-        3153, 3153, 3153, 3153, 3153, 3153, 3153, 3153, 3153, 3153, 3153, 3153, 3154, 3154, 3154, 3154, 3154, 3154, 3154, 3154, 3154, 3154, 3154, 3154, 3154, 3154,
-        3154, 3154, 3154, 3154, 3154, 3154, 3154, 3154, 3154, 3154, 3154, 3154, 3154, 3155, 3155, 3155, 3155, 3155, 3155, 3155, 3155, 3155, 3155, 3155, 3155, 3155,
-        3155, 3155, 3155, 3155, 3155, 3155, 3155, 3155, 3155, 3155, 3155, 3155, 3155, 3155, 3155, 3156, 3156, 3156, 3156, 3156, 3156, 3156, 3156, 3156, 3156, 3156,
-        3156, 3156, 3156, 3156, 3156, 3156, 3156, 3156, 3156, 3156, 3156, 3156, 3156, 3156, 3156, 3156, 3157, 3157, 3157, 3157, 3157, 3157, 3157, 3157, 3157, 3157,
-        3157, 3157, 3157, 3157, 3157, 3157, 3157, 3157, 3157, 3157, 3157, 3157, 3157, 3157, 3157, 3157, 3157, 3157, 3158, 3158, 3158, 3158, 3158, 3158, 3158, 3158,
-        3158, 3158, 3158, 3158, 3158, 3158, 3158, 3158, 3158, 3158, 3158, 3158, 3158, 3158, 3158, 3158, 3158, 3158, 3158, 3159, 3159, 3159, 3159, 3159, 3159, 3159,
-        3159, 3159, 3159, 3159, 3159, 3159, 3159, 3159, 3159, 3159, 3159, 3159, 3159, 3159, 3159, 3159, 3159, 3159, 3159, 3159, 3159, 3160, 3160, 3160, 3160, 3160,
-        3160, 3160, 3160, 3160, 3160, 3160, 3160, 3160, 3160, 3160, 3160, 3160, 3160, 3160, 3160, 3160, 3160, 3160, 3160, 3160, 3160, 3160, 3161, 3161, 3161, 3161,
-        3161, 3161, 3161, 3161, 3161, 3161, 3161, 3161, 3161, 3161, 3161, 3161, 3161, 3161, 3161, 3161, 3161, 3161, 3161, 3161, 3161, 3161, 3161, 3161, 3162, 3162,
-        3162, 3162, 3162, 3162, 3162, 3162, 3162, 3162, 3162, 3162, 3162, 3162, 3162, 3162, 3162, 3162, 3162, 3162, 3162, 3162, 3162, 3162, 3162, 3162, 3162, 3163,
-        3163, 3163, 3163, 3163, 3163, 3163, 3163, 3163, 3163, 3163, 3163, 3163, 3163, 3163, 3163, 3163, 3163, 3163, 3163, 3163, 3163, 3163, 3163, 3163, 3163, 3163,
-        3163, 3164, 3164, 3164, 3164, 3164, 3164, 3164, 3164, 3164, 3164, 3164, 3164, 3164, 3164, 3164, 3164, 3164, 3164, 3164, 3164, 3164, 3164, 3164, 3164, 3164,
-        3164, 3164, 3165, 3165, 3165, 3165, 3165, 3165, 3165, 3165, 3165, 3165, 3165, 3165, 3165, 3165, 3165, 3165, 3165, 3165, 3165, 3165, 3165, 3165, 3165, 3165,
-        3165, 3165, 3165, 3165, 3166, 3166, 3166, 3166, 3166, 3166, 3166, 3166, 3166, 3166, 3166, 3166, 3166, 3166, 3166, 3166, 3166, 3166, 3166, 3166, 3166, 3166,
-        3166, 3166, 3166, 3166, 3166, 3167, 3167, 3167, 3167, 3167, 3167, 3167, 3167, 3167, 3167, 3167, 3167, 3167, 3167, 3167, 3167, 3167, 3167, 3167, 3167, 3167,
-        3167, 3167, 3167, 3167, 3167, 3167, 3167, 3168, 3168, 3168, 3168, 3168, 3168, 3168, 3168, 3168, 3168, 3168, 3168, 3168, 3168, 3168, 3168, 3168, 3168, 3168,
-        3168, 3168, 3168, 3168, 3168, 3168, 3168, 3168, 3168, 3169, 3169, 3169, 3169, 3169, 3169, 3169, 3169, 3169, 3169, 3169, 3169, 3169, 3169, 3169, 3169, 3169,
-        3169, 3169, 3169, 3169, 3169, 3169, 3169, 3169, 3169, 3169, 3170, 3170, 3170, 3170, 3170, 3170, 3170, 3170, 3170, 3170, 3170, 3170, 3170, 3170, 3170, 3170,
-        3170, 3170, 3170, 3170, 3170, 3170, 3170, 3170, 3170, 3170, 3170, 3170, 3171, 3171, 3171, 3171, 3171, 3171, 3171, 3171, 3171, 3171, 3171, 3171, 3171, 3171,
-        3171, 3171, 3171, 3171, 3171, 3171, 3171, 3171, 3171, 3171, 3171, 3171, 3171, 3172, 3172, 3172, 3172, 3172, 3172, 3172, 3172, 3172, 3172, 3172, 3172, 3172,
-        3172, 3172, 3172, 3172, 3172, 3172, 3172, 3172, 3172, 3172, 3172, 3172, 3172, 3172, 3172, 3173, 3173, 3173, 3173, 3173, 3173, 3173, 3173, 3173, 3173, 3173,
-        3173, 3173, 3173, 3173, 3173, 3173, 3173, 3173, 3173, 3173, 3173, 3173, 3173, 3173, 3173, 3173, 3173, 3174, 3174, 3174, 3174, 3174, 3174, 3174, 3174, 3174,
-        3174, 3174, 3174, 3174, 3174, 3174, 3174, 3174, 3174, 3174, 3174, 3174, 3174, 3174, 3174, 3174, 3174, 3174, 3175, 3175, 3175, 3175, 3175, 3175, 3175, 3175,
-        3175, 3175, 3175, 3175, 3175, 3175, 3175, 3175, 3175, 3175, 3175, 3175, 3175, 3175, 3175, 3175, 3175, 3175, 3175, 3175, 3176, 3176, 3176, 3176, 3176, 3176,
-        3176, 3176, 3176, 3176, 3176, 3176, 3176, 3176, 3176, 3176, 3176, 3176, 3176, 3176, 3176, 3176, 3176, 3176, 3176, 3176, 3176, 3176, 3177, 3177, 3177, 3177,
-        3177, 3177, 3177, 3177, 3177, 3177, 3177, 3177, 3177, 3177, 3177, 3177, 3177, 3177, 3177, 3177, 3177, 3177, 3177, 3177, 3177, 3177, 3177, 3177, 3178, 3178,
-        3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3179,
-        3179, 3179, 3179, 3179, 3179, 3179, 3179, 3179, 3179, 3179, 3179, 3179, 3179, 3179, 3179, 3179, 3179, 3179, 3179, 3179, 3179, 3179, 3179, 3179, 3179, 3179,
-        3179, 3180, 3180, 3180, 3180, 3180, 3180, 3180, 3180, 3180, 3180, 3180, 3180, 3180, 3180, 3180, 3180, 3180, 3180, 3180, 3180, 3180, 3180, 3180, 3180, 3180,
-        3180, 3180, 3180, 3181, 3181, 3181, 3181, 3181, 3181, 3181, 3181, 3181, 3181, 3181, 3181, 3181, 3181, 3181, 3181, 3181, 3181, 3181, 3181, 3181, 3181, 3181,
-        3181, 3181, 3181, 3181, 3181, 3182, 3182, 3182, 3182, 3182, 3182, 3182, 3182, 3182, 3182, 3182, 3182, 3182, 3182, 3182, 3182, 3182, 3182, 3182, 3182, 3182,
-        3182, 3182, 3182, 3182, 3182, 3182, 3183, 3183, 3183, 3183, 3183, 3183, 3183, 3183, 3183, 3183, 3183, 3183, 3183, 3183, 3183, 3183, 3183, 3183, 3183, 3183,
-        3183, 3183, 3183, 3183, 3183, 3183, 3183, 3183, 3184, 3184, 3184, 3184, 3184, 3184, 3184, 3184, 3184, 3184, 3184, 3184, 3184, 3184, 3184, 3184, 3184, 3184,
-        3184, 3184, 3184, 3184, 3184, 3184, 3184, 3184, 3184, 3184, 3185, 3185, 3185, 3185, 3185, 3185, 3185, 3185, 3185, 3185, 3185, 3185, 3185, 3185, 3185, 3185,
-        3185, 3185, 3185, 3185, 3185, 3185, 3185, 3185, 3185, 3185, 3185, 3185, 3186, 3186, 3186, 3186, 3186, 3186, 3186, 3186, 3186, 3186, 3186, 3186, 3186, 3186,
-        3186, 3186, 3186, 3186, 3186, 3186, 3186, 3186, 3186, 3186, 3186, 3186, 3186, 3186, 3187, 3187, 3187, 3187, 3187, 3187, 3187, 3187, 3187, 3187, 3187, 3187,
-        3187, 3187, 3187, 3187, 3187, 3187, 3187, 3187, 3187, 3187, 3187, 3187, 3187, 3187, 3187, 3187, 3188, 3188, 3188, 3188, 3188, 3188, 3188, 3188, 3188, 3188,
-        3188, 3188, 3188, 3188, 3188, 3188, 3188, 3188, 3188, 3188, 3188, 3188, 3188, 3188, 3188, 3188, 3188, 3189, 3189, 3189, 3189, 3189, 3189, 3189, 3189, 3189,
-        3189, 3189, 3189, 3189, 3189, 3189, 3189, 3189, 3189, 3189, 3189, 3189, 3189, 3189, 3189, 3189, 3189, 3189, 3189, 3190, 3190, 3190, 3190, 3190, 3190, 3190,
-        3190, 3190, 3190, 3190, 3190, 3190, 3190, 3190, 3190, 3190, 3190, 3190, 3190, 3190, 3190, 3190, 3190, 3190, 3190, 3190, 3190, 3191, 3191, 3191, 3191, 3191,
-        3191, 3191, 3191, 3191, 3191, 3191, 3191, 3191, 3191, 3191, 3191, 3191, 3191, 3191, 3191, 3191, 3191, 3191, 3191, 3191, 3191, 3191, 3191, 3192, 3192, 3192,
-        3192, 3192, 3192, 3192, 3192, 3192, 3192, 3192, 3192, 3192, 3192, 3192, 3192, 3192, 3192, 3192, 3192, 3192, 3192, 3192, 3192, 3192, 3192, 3192, 3192, 3193,
-        3193, 3193, 3193, 3193, 3193, 3193, 3193, 3193, 3193, 3193, 3193, 3193, 3193, 3193, 3193, 3193, 3193, 3193, 3193, 3193, 3193, 3193, 3193, 3193, 3193, 3193,
-        3193, 3194, 3194, 3194, 3194, 3194, 3194, 3194, 3194, 3194, 3194, 3194, 3194, 3194, 3194, 3194, 3194, 3194, 3194, 3194, 3194, 3194, 3194, 3194, 3194, 3194,
-        3194, 3194, 3194, 3195, 3195, 3195, 3195, 3195, 3195, 3195, 3195, 3195, 3195, 3195, 3195, 3195, 3195, 3195, 3195, 3195, 3195, 3195, 3195, 3195, 3195, 3195,
-        3195, 3195, 3195, 3195, 3195, 3196, 3196, 3196, 3196, 3196, 3196, 3196, 3196, 3196, 3196, 3196, 3196, 3196, 3196, 3196, 3196, 3196, 3196, 3196, 3196, 3196,
-        3196, 3196, 3196, 3196, 3196, 3196, 3196, 3197, 3197, 3197, 3197, 3197, 3197, 3197, 3197, 3197, 3197, 3197, 3197, 3197, 3197, 3197, 3197, 3197, 3197, 3197,
-        3197, 3197, 3197, 3197, 3197, 3197, 3197, 3197, 3197, 3198, 3198, 3198, 3198, 3198, 3198, 3198, 3198, 3198, 3198, 3198, 3198, 3198, 3198, 3198, 3198, 3198,
-        3198, 3198, 3198, 3198, 3198, 3198, 3198, 3198, 3198, 3198, 3198, 3199, 3199, 3199, 3199, 3199, 3199, 3199, 3199, 3199, 3199, 3199, 3199, 3199, 3199, 3199,
-        3199, 3199, 3199, 3199, 3199, 3199, 3199, 3199, 3199, 3199, 3199, 3199, 3199, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200,
-        3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3201, 3201, 3201, 3201, 3201, 3201, 3201, 3201, 3201, 3201, 3201,
-        3201, 3201, 3201, 3201, 3201, 3201, 3201, 3201, 3201, 3201, 3201, 3201, 3201, 3201, 3201, 3201, 3201, 3202, 3202, 3202, 3202, 3202, 3202, 3202, 3202, 3202,
-        3202, 3202, 3202, 3202, 3202, 3202, 3202, 3202, 3202, 3202, 3202, 3202, 3202, 3202, 3202, 3202, 3202, 3202, 3202, 3203, 3203, 3203, 3203, 3203, 3203, 3203,
-        3203, 3203, 3203, 3203, 3203, 3203, 3203, 3203, 3203, 3203, 3203, 3203, 3203, 3203, 3203, 3203, 3203, 3203, 3203, 3203, 3203, 3204, 3204, 3204, 3204, 3204,
-        3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3205, 3205,
-        3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205,
-        3206, 3206, 3206, 3206, 3206, 3206, 3206, 3206, 3206, 3206, 3206, 3206, 3206, 3206, 3206, 3206, 3206, 3206, 3206, 3206, 3206, 3206, 3206, 3206, 3206, 3206,
-        3206, 3206, 3207, 3207, 3207, 3207, 3207, 3207, 3207, 3207, 3207, 3207, 3207, 3207, 3207, 3207, 3207, 3207, 3207, 3207, 3207, 3207, 3207, 3207, 3207, 3207,
-        3207, 3207, 3207, 3207, 3208, 3208, 3208, 3208, 3208, 3208, 3208, 3208, 3208, 3208, 3208, 3208, 3208, 3208, 3208, 3208, 3208, 3208, 3208, 3208, 3208, 3208,
-        3208, 3208, 3208, 3208, 3208, 3208, 3209, 3209, 3209, 3209, 3209, 3209, 3209, 3209, 3209, 3209, 3209, 3209, 3209, 3209, 3209, 3209, 3209, 3209, 3209, 3209,
-        3209, 3209, 3209, 3209, 3209, 3209, 3209, 3209, 3210, 3210, 3210, 3210, 3210, 3210, 3210, 3210, 3210, 3210, 3210, 3210, 3210, 3210, 3210, 3210, 3210, 3210,
-        3210, 3210, 3210, 3210, 3210, 3210, 3210, 3210, 3210, 3210, 3211, 3211, 3211, 3211, 3211, 3211, 3211, 3211, 3211, 3211, 3211, 3211, 3211, 3211, 3211, 3211,
-        3211, 3211, 3211, 3211, 3211, 3211, 3211, 3211, 3211, 3211, 3211, 3211, 3211, 3212, 3212, 3212, 3212, 3212, 3212, 3212, 3212, 3212, 3212, 3212, 3212, 3212,
-        3212, 3212, 3212, 3212, 3212, 3212, 3212, 3212, 3212, 3212, 3212, 3212, 3212, 3212, 3212, 3213, 3213, 3213, 3213, 3213, 3213, 3213, 3213, 3213, 3213, 3213,
-        3213, 3213, 3213, 3213, 3213, 3213, 3213, 3213, 3213, 3213, 3213, 3213, 3213, 3213, 3213, 3213, 3213, 3214, 3214, 3214, 3214, 3214, 3214, 3214, 3214, 3214,
-        3214, 3214, 3214, 3214, 3214, 3214, 3214, 3214, 3214, 3214, 3214, 3214, 3214, 3214, 3214, 3214, 3214, 3214, 3214, 3215, 3215, 3215, 3215, 3215, 3215, 3215,
-        3215, 3215, 3215, 3215, 3215, 3215, 3215, 3215, 3215, 3215, 3215, 3215, 3215, 3215, 3215, 3215, 3215, 3215, 3215, 3215, 3215, 3215, 3216, 3216, 3216, 3216,
-        3216, 3216, 3216, 3216, 3216, 3216, 3216, 3216, 3216, 3216, 3216, 3216, 3216, 3216, 3216, 3216, 3216, 3216, 3216, 3216, 3216, 3216, 3216, 3216, 3217, 3217,
-        3217, 3217, 3217, 3217, 3217, 3217, 3217, 3217, 3217, 3217, 3217, 3217, 3217, 3217, 3217, 3217, 3217, 3217, 3217, 3217, 3217, 3217, 3217, 3217, 3217, 3217,
-        3218, 3218, 3218, 3218, 3218, 3218, 3218, 3218, 3218, 3218, 3218, 3218, 3218, 3218, 3218, 3218, 3218, 3218, 3218, 3218, 3218, 3218, 3218, 3218, 3218, 3218,
-        3218, 3218, 3219, 3219, 3219, 3219, 3219, 3219, 3219, 3219, 3219, 3219, 3219, 3219, 3219, 3219, 3219, 3219, 3219, 3219, 3219, 3219, 3219, 3219, 3219, 3219,
-        3219, 3219, 3219, 3219, 3219, 3220, 3220, 3220, 3220, 3220, 3220, 3220, 3220, 3220, 3220, 3220, 3220, 3220, 3220, 3220, 3220, 3220, 3220, 3220, 3220, 3220,
-        3220, 3220, 3220, 3220, 3220, 3220, 3220, 3221, 3221, 3221, 3221, 3221, 3221, 3221, 3221, 3221, 3221, 3221, 3221, 3221, 3221, 3221, 3221, 3221, 3221, 3221,
-        3221, 3221, 3221, 3221, 3221, 3221, 3221, 3221, 3221, 3222, 3222, 3222, 3222, 3222, 3222, 3222, 3222, 3222, 3222, 3222, 3222, 3222, 3222, 3222, 3222, 3222,
-        3222, 3222, 3222, 3222, 3222, 3222, 3222, 3222, 3222, 3222, 3222, 3222, 3223, 3223, 3223, 3223, 3223, 3223, 3223, 3223, 3223, 3223, 3223, 3223, 3223, 3223,
-        3223, 3223, 3223, 3223, 3223, 3223, 3223, 3223, 3223, 3223, 3223, 3223, 3223, 3223, 3224, 3224, 3224, 3224, 3224, 3224, 3224, 3224, 3224, 3224, 3224, 3224,
-        3224, 3224, 3224, 3224, 3224, 3224, 3224, 3224, 3224, 3224, 3224, 3224, 3224, 3224, 3224, 3224, 3224, 3225, 3225, 3225, 3225, 3225, 3225, 3225, 3225, 3225,
-        3225, 3225, 3225, 3225, 3225, 3225, 3225, 3225, 3225, 3225, 3225, 3225, 3225, 3225, 3225, 3225, 3225, 3225, 3225, 3226, 3226, 3226, 3226, 3226, 3226, 3226,
-        3226, 3226, 3226, 3226, 3226, 3226, 3226, 3226, 3226, 3226, 3226, 3226, 3226, 3226, 3226, 3226, 3226, 3226, 3226, 3226, 3226, 3227, 3227, 3227, 3227, 3227,
-        3227, 3227, 3227, 3227, 3227, 3227, 3227, 3227, 3227, 3227, 3227, 3227, 3227, 3227, 3227, 3227, 3227, 3227, 3227, 3227, 3227, 3227, 3227, 3227, 3228, 3228,
-        3228, 3228, 3228, 3228, 3228, 3228, 3228, 3228, 3228, 3228, 3228, 3228, 3228, 3228, 3228, 3228, 3228, 3228, 3228, 3228, 3228, 3228, 3228, 3228, 3228, 3228,
-        3229, 3229, 3229, 3229, 3229, 3229, 3229, 3229, 3229, 3229, 3229, 3229, 3229, 3229, 3229, 3229, 3229, 3229, 3229, 3229, 3229, 3229, 3229, 3229, 3229, 3229,
-        3229, 3229, 3229, 3230, 3230, 3230, 3230, 3230, 3230, 3230, 3230, 3230, 3230, 3230, 3230, 3230, 3230, 3230, 3230, 3230, 3230, 3230, 3230, 3230, 3230, 3230,
-        3230, 3230, 3230, 3230, 3230, 3231, 3231, 3231, 3231, 3231, 3231, 3231, 3231, 3231, 3231, 3231, 3231, 3231, 3231, 3231, 3231, 3231, 3231, 3231, 3231, 3231,
-        3231, 3231, 3231, 3231, 3231, 3231, 3231, 3231, 3232, 3232, 3232, 3232, 3232, 3232, 3232, 3232, 3232, 3232, 3232, 3232, 3232, 3232, 3232, 3232, 3232, 3232,
-        3232, 3232, 3232, 3232, 3232, 3232, 3232, 3232, 3232, 3232, 3233, 3233, 3233, 3233, 3233, 3233, 3233, 3233, 3233, 3233, 3233, 3233, 3233, 3233, 3233, 3233,
-        3233, 3233, 3233, 3233, 3233, 3233, 3233, 3233, 3233, 3233, 3233, 3233, 3233, 3234, 3234, 3234, 3234, 3234, 3234, 3234, 3234, 3234, 3234, 3234, 3234, 3234,
-        3234, 3234, 3234, 3234, 3234, 3234, 3234, 3234, 3234, 3234, 3234, 3234, 3234, 3234, 3234, 3235, 3235, 3235, 3235, 3235, 3235, 3235, 3235, 3235, 3235, 3235,
-        3235, 3235, 3235, 3235, 3235, 3235, 3235, 3235, 3235, 3235, 3235, 3235, 3235, 3235, 3235, 3235, 3235, 3235, 3236, 3236, 3236, 3236, 3236, 3236, 3236, 3236,
-        3236, 3236, 3236, 3236, 3236, 3236, 3236, 3236, 3236, 3236, 3236, 3236, 3236, 3236, 3236, 3236, 3236, 3236, 3236, 3236, 3237, 3237, 3237, 3237, 3237, 3237,
-        3237, 3237, 3237, 3237, 3237, 3237, 3237, 3237, 3237, 3237, 3237, 3237, 3237, 3237, 3237, 3237, 3237, 3237, 3237, 3237, 3237, 3237, 3237, 3238, 3238, 3238,
-        3238, 3238, 3238, 3238, 3238, 3238, 3238, 3238, 3238, 3238, 3238, 3238, 3238, 3238, 3238, 3238, 3238, 3238, 3238, 3238, 3238, 3238, 3238, 3238, 3238, 3239,
-        3239, 3239, 3239, 3239, 3239, 3239, 3239, 3239, 3239, 3239, 3239, 3239, 3239, 3239, 3239, 3239, 3239, 3239, 3239, 3239, 3239, 3239, 3239, 3239, 3239, 3239,
-        3239, 3239, 3240, 3240, 3240, 3240, 3240, 3240, 3240, 3240, 3240, 3240, 3240, 3240, 3240, 3240, 3240, 3240, 3240, 3240, 3240, 3240, 3240, 3240, 3240, 3240,
-        3240, 3240, 3240, 3240, 3240, 3241, 3241, 3241, 3241, 3241, 3241, 3241, 3241, 3241, 3241, 3241, 3241, 3241, 3241, 3241, 3241, 3241, 3241, 3241, 3241, 3241,
-        3241, 3241, 3241, 3241, 3241, 3241, 3241, 3242, 3242, 3242, 3242, 3242, 3242, 3242, 3242, 3242, 3242, 3242, 3242, 3242, 3242, 3242, 3242, 3242, 3242, 3242,
-        3242, 3242, 3242, 3242, 3242, 3242, 3242, 3242, 3242, 3242, 3243, 3243, 3243, 3243, 3243, 3243, 3243, 3243, 3243, 3243, 3243, 3243, 3243, 3243, 3243, 3243,
-        3243, 3243, 3243, 3243, 3243, 3243, 3243, 3243, 3243, 3243, 3243, 3243, 3243, 3244, 3244, 3244, 3244, 3244, 3244, 3244, 3244, 3244, 3244, 3244, 3244, 3244,
-        3244, 3244, 3244, 3244, 3244, 3244, 3244, 3244, 3244, 3244, 3244, 3244, 3244, 3244, 3244, 3245, 3245, 3245, 3245, 3245, 3245, 3245, 3245, 3245, 3245, 3245,
-        3245, 3245, 3245, 3245, 3245, 3245, 3245, 3245, 3245, 3245, 3245, 3245, 3245, 3245, 3245, 3245, 3245, 3245, 3246, 3246, 3246, 3246, 3246, 3246, 3246, 3246,
-        3246, 3246, 3246, 3246, 3246, 3246, 3246, 3246, 3246, 3246, 3246, 3246, 3246, 3246, 3246, 3246, 3246, 3246, 3246, 3246, 3246, 3247, 3247, 3247, 3247, 3247,
-        3247, 3247, 3247, 3247, 3247, 3247, 3247, 3247, 3247, 3247, 3247, 3247, 3247, 3247, 3247, 3247, 3247, 3247, 3247, 3247, 3247, 3247, 3247, 3248, 3248, 3248,
-        3248, 3248, 3248, 3248, 3248, 3248, 3248, 3248, 3248, 3248, 3248, 3248, 3248, 3248, 3248, 3248, 3248, 3248, 3248, 3248, 3248, 3248, 3248, 3248, 3248, 3248,
-        3249, 3249, 3249, 3249, 3249, 3249, 3249, 3249, 3249, 3249, 3249, 3249, 3249, 3249, 3249, 3249, 3249, 3249, 3249, 3249, 3249, 3249, 3249, 3249, 3249, 3249,
-        3249, 3249, 3249, 3250, 3250, 3250, 3250, 3250, 3250, 3250, 3250, 3250, 3250, 3250, 3250, 3250, 3250, 3250, 3250, 3250, 3250, 3250, 3250, 3250, 3250, 3250,
-        3250, 3250, 3250, 3250, 3250, 3250, 3251, 3251, 3251, 3251, 3251, 3251, 3251, 3251, 3251, 3251, 3251, 3251, 3251, 3251, 3251, 3251, 3251, 3251, 3251, 3251,
-        3251, 3251, 3251, 3251, 3251, 3251, 3251, 3251, 3252, 3252, 3252, 3252, 3252, 3252, 3252, 3252, 3252, 3252, 3252, 3252, 3252, 3252, 3252, 3252, 3252, 3252,
-        3252, 3252, 3252, 3252, 3252, 3252, 3252, 3252, 3252, 3252, 3252, 3253, 3253, 3253, 3253, 3253, 3253, 3253, 3253, 3253, 3253, 3253, 3253, 3253, 3253, 3253,
-        3253, 3253, 3253, 3253, 3253, 3253, 3253, 3253, 3253, 3253, 3253, 3253, 3253, 3253, 3254, 3254, 3254, 3254, 3254, 3254, 3254, 3254, 3254, 3254, 3254, 3254,
-        3254, 3254, 3254, 3254, 3254, 3254, 3254, 3254, 3254, 3254, 3254, 3254, 3254, 3254, 3254, 3254, 3254, 3255, 3255, 3255, 3255, 3255, 3255, 3255, 3255, 3255,
-        3255, 3255, 3255, 3255, 3255, 3255, 3255, 3255, 3255, 3255, 3255, 3255, 3255, 3255, 3255, 3255, 3255, 3255, 3255, 3255, 3256, 3256, 3256, 3256, 3256, 3256,
-        3256, 3256, 3256, 3256, 3256, 3256, 3256, 3256, 3256, 3256, 3256, 3256, 3256, 3256, 3256, 3256, 3256, 3256, 3256, 3256, 3256, 3256, 3257, 3257, 3257, 3257,
-        3257, 3257, 3257, 3257, 3257, 3257, 3257, 3257, 3257, 3257, 3257, 3257, 3257, 3257, 3257, 3257, 3257, 3257, 3257, 3257, 3257, 3257, 3257, 3257, 3257, 3258,
-        3258, 3258, 3258, 3258, 3258, 3258, 3258, 3258, 3258, 3258, 3258, 3258, 3258, 3258, 3258, 3258, 3258, 3258, 3258, 3258, 3258, 3258, 3258, 3258, 3258, 3258,
-        3258, 3258, 3259, 3259, 3259, 3259, 3259, 3259, 3259, 3259, 3259, 3259, 3259, 3259, 3259, 3259, 3259, 3259, 3259, 3259, 3259, 3259, 3259, 3259, 3259, 3259,
-        3259, 3259, 3259, 3259, 3259, 3260, 3260, 3260, 3260, 3260, 3260, 3260, 3260, 3260, 3260, 3260, 3260, 3260, 3260, 3260, 3260, 3260, 3260, 3260, 3260, 3260,
-        3260, 3260, 3260, 3260, 3260, 3260, 3260, 3260, 3261, 3261, 3261, 3261, 3261, 3261, 3261, 3261, 3261, 3261, 3261, 3261, 3261, 3261, 3261, 3261, 3261, 3261,
-        3261, 3261, 3261, 3261, 3261, 3261, 3261, 3261, 3261, 3261, 3261, 3262, 3262, 3262, 3262, 3262, 3262, 3262, 3262, 3262, 3262, 3262, 3262, 3262, 3262, 3262,
-        3262, 3262, 3262, 3262, 3262, 3262, 3262, 3262, 3262, 3262, 3262, 3262, 3262, 3262, 3263, 3263, 3263, 3263, 3263, 3263, 3263, 3263, 3263, 3263, 3263, 3263,
-        3263, 3263, 3263, 3263, 3263, 3263, 3263, 3263, 3263, 3263, 3263, 3263, 3263, 3263, 3263, 3263, 3263, 3264, 3264, 3264, 3264, 3264, 3264, 3264, 3264, 3264,
-        3264, 3264, 3264, 3264, 3264, 3264, 3264, 3264, 3264, 3264, 3264, 3264, 3264, 3264, 3264, 3264, 3264, 3264, 3264, 3264, 3265, 3265, 3265, 3265, 3265, 3265,
-        3265, 3265, 3265, 3265, 3265, 3265, 3265, 3265, 3265, 3265, 3265, 3265, 3265, 3265, 3265, 3265, 3265, 3265, 3265, 3265, 3265, 3265, 3265, 3266, 3266, 3266,
-        3266, 3266, 3266, 3266, 3266, 3266, 3266, 3266, 3266, 3266, 3266, 3266, 3266, 3266, 3266, 3266, 3266, 3266, 3266, 3266, 3266, 3266, 3266, 3266, 3266, 3266,
-        3267, 3267, 3267, 3267, 3267, 3267, 3267, 3267, 3267, 3267, 3267, 3267, 3267, 3267, 3267, 3267, 3267, 3267, 3267, 3267, 3267, 3267, 3267, 3267, 3267, 3267,
-        3267, 3267, 3267, 3268, 3268, 3268, 3268, 3268, 3268, 3268, 3268, 3268, 3268, 3268, 3268, 3268, 3268, 3268, 3268, 3268, 3268, 3268, 3268, 3268, 3268, 3268,
-        3268, 3268, 3268, 3268, 3268, 3268, 3269, 3269, 3269, 3269, 3269, 3269, 3269, 3269, 3269, 3269, 3269, 3269, 3269, 3269, 3269, 3269, 3269, 3269, 3269, 3269,
-        3269, 3269, 3269, 3269, 3269, 3269, 3269, 3269, 3269, 3270, 3270, 3270, 3270, 3270, 3270, 3270, 3270, 3270, 3270, 3270, 3270, 3270, 3270, 3270, 3270, 3270,
-        3270, 3270, 3270, 3270, 3270, 3270, 3270, 3270, 3270, 3270, 3270, 3270, 3271, 3271, 3271, 3271, 3271, 3271, 3271, 3271, 3271, 3271, 3271, 3271, 3271, 3271,
-        3271, 3271, 3271, 3271, 3271, 3271, 3271, 3271, 3271, 3271, 3271, 3271, 3271, 3271, 3271, 3272, 3272, 3272, 3272, 3272, 3272, 3272, 3272, 3272, 3272, 3272,
-        3272, 3272, 3272, 3272, 3272, 3272, 3272, 3272, 3272, 3272, 3272, 3272, 3272, 3272, 3272, 3272, 3272, 3272, 3273, 3273, 3273, 3273, 3273, 3273, 3273, 3273,
-        3273, 3273, 3273, 3273, 3273, 3273, 3273, 3273, 3273, 3273, 3273, 3273, 3273, 3273, 3273, 3273, 3273, 3273, 3273, 3273, 3273, 3274, 3274, 3274, 3274, 3274,
-        3274, 3274, 3274, 3274, 3274, 3274, 3274, 3274, 3274, 3274, 3274, 3274, 3274, 3274, 3274, 3274, 3274, 3274, 3274, 3274, 3274, 3274, 3274, 3274, 3275, 3275,
-        3275, 3275, 3275, 3275, 3275, 3275, 3275, 3275, 3275, 3275, 3275, 3275, 3275, 3275, 3275, 3275, 3275, 3275, 3275, 3275, 3275, 3275, 3275, 3275, 3275, 3275,
-        3275, 3276, 3276, 3276, 3276, 3276, 3276, 3276, 3276, 3276, 3276, 3276, 3276, 3276, 3276, 3276, 3276, 3276, 3276, 3276, 3276, 3276, 3276, 3276, 3276, 3276,
-        3276, 3276, 3276, 3276, 3277, 3277, 3277, 3277, 3277, 3277, 3277, 3277, 3277, 3277, 3277, 3277, 3277, 3277, 3277, 3277, 3277, 3277, 3277, 3277, 3277, 3277,
-        3277, 3277, 3277, 3277, 3277, 3277, 3277, 3278, 3278, 3278, 3278, 3278, 3278, 3278, 3278, 3278, 3278, 3278, 3278, 3278, 3278, 3278, 3278, 3278, 3278, 3278,
-        3278, 3278, 3278, 3278, 3278, 3278, 3278, 3278, 3278, 3278, 3279, 3279, 3279, 3279, 3279, 3279, 3279, 3279, 3279, 3279, 3279, 3279, 3279, 3279, 3279, 3279,
-        3279, 3279, 3279, 3279, 3279, 3279, 3279, 3279, 3279, 3279, 3279, 3279, 3279, 3279, 3280, 3280, 3280, 3280, 3280, 3280, 3280, 3280, 3280, 3280, 3280, 3280,
-        3280, 3280, 3280, 3280, 3280, 3280, 3280, 3280, 3280, 3280, 3280, 3280, 3280, 3280, 3280, 3280, 3280, 3281, 3281, 3281, 3281, 3281, 3281, 3281, 3281, 3281,
-        3281, 3281, 3281, 3281, 3281, 3281, 3281, 3281, 3281, 3281, 3281, 3281, 3281, 3281, 3281, 3281, 3281, 3281, 3281, 3281, 3282, 3282, 3282, 3282, 3282, 3282,
-        3282, 3282, 3282, 3282, 3282, 3282, 3282, 3282, 3282, 3282, 3282, 3282, 3282, 3282, 3282, 3282, 3282, 3282, 3282, 3282, 3282, 3282, 3282, 3283, 3283, 3283,
-        3283, 3283, 3283, 3283, 3283, 3283, 3283, 3283, 3283, 3283, 3283, 3283, 3283, 3283, 3283, 3283, 3283, 3283, 3283, 3283, 3283, 3283, 3283, 3283, 3283, 3283,
-        3284, 3284, 3284, 3284, 3284, 3284, 3284, 3284, 3284, 3284, 3284, 3284, 3284, 3284, 3284, 3284, 3284, 3284, 3284, 3284, 3284, 3284, 3284, 3284, 3284, 3284,
-        3284, 3284, 3284, 3284, 3285, 3285, 3285, 3285, 3285, 3285, 3285, 3285, 3285, 3285, 3285, 3285, 3285, 3285, 3285, 3285, 3285, 3285, 3285, 3285, 3285, 3285,
-        3285, 3285, 3285, 3285, 3285, 3285, 3285, 3286, 3286, 3286, 3286, 3286, 3286, 3286, 3286, 3286, 3286, 3286, 3286, 3286, 3286, 3286, 3286, 3286, 3286, 3286,
-        3286, 3286, 3286, 3286, 3286, 3286, 3286, 3286, 3286, 3286, 3287, 3287, 3287, 3287, 3287, 3287, 3287, 3287, 3287, 3287, 3287, 3287, 3287, 3287, 3287, 3287,
-        3287, 3287, 3287, 3287, 3287, 3287, 3287, 3287, 3287, 3287, 3287, 3287, 3287, 3287, 3288, 3288, 3288, 3288, 3288, 3288, 3288, 3288, 3288, 3288, 3288, 3288,
-        3288, 3288, 3288, 3288, 3288, 3288, 3288, 3288, 3288, 3288, 3288, 3288, 3288, 3288, 3288, 3288, 3288, 3289, 3289, 3289, 3289, 3289, 3289, 3289, 3289, 3289,
-        3289, 3289, 3289, 3289, 3289, 3289, 3289, 3289, 3289, 3289, 3289, 3289, 3289, 3289, 3289, 3289, 3289, 3289, 3289, 3289, 3290, 3290, 3290, 3290, 3290, 3290,
-        3290, 3290, 3290, 3290, 3290, 3290, 3290, 3290, 3290, 3290, 3290, 3290, 3290, 3290, 3290, 3290, 3290, 3290, 3290, 3290, 3290, 3290, 3290, 3291, 3291, 3291,
-        3291, 3291, 3291, 3291, 3291, 3291, 3291, 3291, 3291, 3291, 3291, 3291, 3291, 3291, 3291, 3291, 3291, 3291, 3291, 3291, 3291, 3291, 3291, 3291, 3291, 3291,
-        3291, 3292, 3292, 3292, 3292, 3292, 3292, 3292, 3292, 3292, 3292, 3292, 3292, 3292, 3292, 3292, 3292, 3292, 3292, 3292, 3292, 3292, 3292, 3292, 3292, 3292,
-        3292, 3292, 3292, 3292, 3293, 3293, 3293, 3293, 3293, 3293, 3293, 3293, 3293, 3293, 3293, 3293, 3293, 3293, 3293, 3293, 3293, 3293, 3293, 3293, 3293, 3293,
-        3293, 3293, 3293, 3293, 3293, 3293, 3293, 3294, 3294, 3294, 3294, 3294, 3294, 3294, 3294, 3294, 3294, 3294, 3294, 3294, 3294, 3294, 3294, 3294, 3294, 3294,
-        3294, 3294, 3294, 3294, 3294, 3294, 3294, 3294, 3294, 3294, 3294, 3295, 3295, 3295, 3295, 3295, 3295, 3295, 3295, 3295, 3295, 3295, 3295, 3295, 3295, 3295,
-        3295, 3295, 3295, 3295, 3295, 3295, 3295, 3295, 3295, 3295, 3295, 3295, 3295, 3295, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296,
-        3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3297, 3297, 3297, 3297, 3297, 3297, 3297, 3297,
-        3297, 3297, 3297, 3297, 3297, 3297, 3297, 3297, 3297, 3297, 3297, 3297, 3297, 3297, 3297, 3297, 3297, 3297, 3297, 3297, 3297, 3298, 3298, 3298, 3298, 3298,
-        3298, 3298, 3298, 3298, 3298, 3298, 3298, 3298, 3298, 3298, 3298, 3298, 3298, 3298, 3298, 3298, 3298, 3298, 3298, 3298, 3298, 3298, 3298, 3298, 3298, 3299,
-        3299, 3299, 3299, 3299, 3299, 3299, 3299, 3299, 3299, 3299, 3299, 3299, 3299, 3299, 3299, 3299, 3299, 3299, 3299, 3299, 3299, 3299, 3299, 3299, 3299, 3299,
-        3299, 3299, 3300, 3300, 3300, 3300, 3300, 3300, 3300, 3300, 3300, 3300, 3300, 3300, 3300, 3300, 3300, 3300, 3300, 3300, 3300, 3300, 3300, 3300, 3300, 3300,
-        3300, 3300, 3300, 3300, 3300, 3301, 3301, 3301, 3301, 3301, 3301, 3301, 3301, 3301, 3301, 3301, 3301, 3301, 3301, 3301, 3301, 3301, 3301, 3301, 3301, 3301,
-        3301, 3301, 3301, 3301, 3301, 3301, 3301, 3301, 3301, 3302, 3302, 3302, 3302, 3302, 3302, 3302, 3302, 3302, 3302, 3302, 3302, 3302, 3302, 3302, 3302, 3302,
-        3302, 3302, 3302, 3302, 3302, 3302, 3302, 3302, 3302, 3302, 3302, 3302, 3303, 3303, 3303, 3303, 3303, 3303, 3303, 3303, 3303, 3303, 3303, 3303, 3303, 3303,
-        3303, 3303, 3303, 3303, 3303, 3303, 3303, 3303, 3303, 3303, 3303, 3303, 3303, 3303, 3303, 3303, 3304, 3304, 3304, 3304, 3304, 3304, 3304, 3304, 3304, 3304,
-        3304, 3304, 3304, 3304, 3304, 3304, 3304, 3304, 3304, 3304, 3304, 3304, 3304, 3304, 3304, 3304, 3304, 3304, 3304, 3305, 3305, 3305, 3305, 3305, 3305, 3305,
-        3305, 3305, 3305, 3305, 3305, 3305, 3305, 3305, 3305, 3305, 3305, 3305, 3305, 3305, 3305, 3305, 3305, 3305, 3305, 3305, 3305, 3305, 3305, 3306, 3306, 3306,
-        3306, 3306, 3306, 3306, 3306, 3306, 3306, 3306, 3306, 3306, 3306, 3306, 3306, 3306, 3306, 3306, 3306, 3306, 3306, 3306, 3306, 3306, 3306, 3306, 3306, 3306,
-        3306, 3307, 3307, 3307, 3307, 3307, 3307, 3307, 3307, 3307, 3307, 3307, 3307, 3307, 3307, 3307, 3307, 3307, 3307, 3307, 3307, 3307, 3307, 3307, 3307, 3307,
-        3307, 3307, 3307, 3307, 3308, 3308, 3308, 3308, 3308, 3308, 3308, 3308, 3308, 3308, 3308, 3308, 3308, 3308, 3308, 3308, 3308, 3308, 3308, 3308, 3308, 3308,
-        3308, 3308, 3308, 3308, 3308, 3308, 3308, 3308, 3309, 3309, 3309, 3309, 3309, 3309, 3309, 3309, 3309, 3309, 3309, 3309, 3309, 3309, 3309, 3309, 3309, 3309,
-        3309, 3309, 3309, 3309, 3309, 3309, 3309, 3309, 3309, 3309, 3309, 3310, 3310, 3310, 3310, 3310, 3310, 3310, 3310, 3310, 3310, 3310, 3310, 3310, 3310, 3310,
-        3310, 3310, 3310, 3310, 3310, 3310, 3310, 3310, 3310, 3310, 3310, 3310, 3310, 3310, 3310, 3311, 3311, 3311, 3311, 3311, 3311, 3311, 3311, 3311, 3311, 3311,
-        3311, 3311, 3311, 3311, 3311, 3311, 3311, 3311, 3311, 3311, 3311, 3311, 3311, 3311, 3311, 3311, 3311, 3311, 3311, 3312, 3312, 3312, 3312, 3312, 3312, 3312,
-        3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3313, 3313, 3313, 3313,
-        3313, 3313, 3313, 3313, 3313, 3313, 3313, 3313, 3313, 3313, 3313, 3313, 3313, 3313, 3313, 3313, 3313, 3313, 3313, 3313, 3313, 3313, 3313, 3313, 3313, 3313,
-        3314, 3314, 3314, 3314, 3314, 3314, 3314, 3314, 3314, 3314, 3314, 3314, 3314, 3314, 3314, 3314, 3314, 3314, 3314, 3314, 3314, 3314, 3314, 3314, 3314, 3314,
-        3314, 3314, 3314, 3315, 3315, 3315, 3315, 3315, 3315, 3315, 3315, 3315, 3315, 3315, 3315, 3315, 3315, 3315, 3315, 3315, 3315, 3315, 3315, 3315, 3315, 3315,
-        3315, 3315, 3315, 3315, 3315, 3315, 3315, 3316, 3316, 3316, 3316, 3316, 3316, 3316, 3316, 3316, 3316, 3316, 3316, 3316, 3316, 3316, 3316, 3316, 3316, 3316,
-        3316, 3316, 3316, 3316, 3316, 3316, 3316, 3316, 3316, 3316, 3316, 3317, 3317, 3317, 3317, 3317, 3317, 3317, 3317, 3317, 3317, 3317, 3317, 3317, 3317, 3317,
-        3317, 3317, 3317, 3317, 3317, 3317, 3317, 3317, 3317, 3317, 3317, 3317, 3317, 3317, 3317, 3318, 3318, 3318, 3318, 3318, 3318, 3318, 3318, 3318, 3318, 3318,
-        3318, 3318, 3318, 3318, 3318, 3318, 3318, 3318, 3318, 3318, 3318, 3318, 3318, 3318, 3318, 3318, 3318, 3318, 3319, 3319, 3319, 3319, 3319, 3319, 3319, 3319,
-        3319, 3319, 3319, 3319, 3319, 3319, 3319, 3319, 3319, 3319, 3319, 3319, 3319, 3319, 3319, 3319, 3319, 3319, 3319, 3319, 3319, 3319, 3320, 3320, 3320, 3320,
-        3320, 3320, 3320, 3320, 3320, 3320, 3320, 3320, 3320, 3320, 3320, 3320, 3320, 3320, 3320, 3320, 3320, 3320, 3320, 3320, 3320, 3320, 3320, 3320, 3320, 3320,
-        3321, 3321, 3321, 3321, 3321, 3321, 3321, 3321, 3321, 3321, 3321, 3321, 3321, 3321, 3321, 3321, 3321, 3321, 3321, 3321, 3321, 3321, 3321, 3321, 3321, 3321,
-        3321, 3321, 3321, 3321, 3322, 3322, 3322, 3322, 3322, 3322, 3322, 3322, 3322, 3322, 3322, 3322, 3322, 3322, 3322, 3322, 3322, 3322, 3322, 3322, 3322, 3322,
-        3322, 3322, 3322, 3322, 3322, 3322, 3322, 3323, 3323, 3323, 3323, 3323, 3323, 3323, 3323, 3323, 3323, 3323, 3323, 3323, 3323, 3323, 3323, 3323, 3323, 3323,
-        3323, 3323, 3323, 3323, 3323, 3323, 3323, 3323, 3323, 3323, 3323, 3324, 3324, 3324, 3324, 3324, 3324, 3324, 3324, 3324, 3324, 3324, 3324, 3324, 3324, 3324,
-        3324, 3324, 3324, 3324, 3324, 3324, 3324, 3324, 3324, 3324, 3324, 3324, 3324, 3324, 3324, 3325, 3325, 3325, 3325, 3325, 3325, 3325, 3325, 3325, 3325, 3325,
-        3325, 3325, 3325, 3325, 3325, 3325, 3325, 3325, 3325, 3325, 3325, 3325, 3325, 3325, 3325, 3325, 3325, 3325, 3325, 3326, 3326, 3326, 3326, 3326, 3326, 3326,
-        3326, 3326, 3326, 3326, 3326, 3326, 3326, 3326, 3326, 3326, 3326, 3326, 3326, 3326, 3326, 3326, 3326, 3326, 3326, 3326, 3326, 3326, 3326, 3327, 3327, 3327,
-        3327, 3327, 3327, 3327, 3327, 3327, 3327, 3327, 3327, 3327, 3327, 3327, 3327, 3327, 3327, 3327, 3327, 3327, 3327, 3327, 3327, 3327, 3327, 3327, 3327, 3327,
-        3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328,
-        3328, 3328, 3328, 3328, 3329, 3329, 3329, 3329, 3329, 3329, 3329, 3329, 3329, 3329, 3329, 3329, 3329, 3329, 3329, 3329, 3329, 3329, 3329, 3329, 3329, 3329,
-        3329, 3329, 3329, 3329, 3329, 3329, 3329, 3329, 3330, 3330, 3330, 3330, 3330, 3330, 3330, 3330, 3330, 3330, 3330, 3330, 3330, 3330, 3330, 3330, 3330, 3330,
-        3330, 3330, 3330, 3330, 3330, 3330, 3330, 3330, 3330, 3330, 3330, 3330, 3331, 3331, 3331, 3331, 3331, 3331, 3331, 3331, 3331, 3331, 3331, 3331, 3331, 3331,
-        3331, 3331, 3331, 3331, 3331, 3331, 3331, 3331, 3331, 3331, 3331, 3331, 3331, 3331, 3331, 3331, 3332, 3332, 3332, 3332, 3332, 3332, 3332, 3332, 3332, 3332,
-        3332, 3332, 3332, 3332, 3332, 3332, 3332, 3332, 3332, 3332, 3332, 3332, 3332, 3332, 3332, 3332, 3332, 3332, 3332, 3332, 3333, 3333, 3333, 3333, 3333, 3333,
-        3333, 3333, 3333, 3333, 3333, 3333, 3333, 3333, 3333, 3333, 3333, 3333, 3333, 3333, 3333, 3333, 3333, 3333, 3333, 3333, 3333, 3333, 3333, 3333, 3334, 3334,
-        3334, 3334, 3334, 3334, 3334, 3334, 3334, 3334, 3334, 3334, 3334, 3334, 3334, 3334, 3334, 3334, 3334, 3334, 3334, 3334, 3334, 3334, 3334, 3334, 3334, 3334,
-        3334, 3334, 3335, 3335, 3335, 3335, 3335, 3335, 3335, 3335, 3335, 3335, 3335, 3335, 3335, 3335, 3335, 3335, 3335, 3335, 3335, 3335, 3335, 3335, 3335, 3335,
-        3335, 3335, 3335, 3335, 3335, 3335, 3336, 3336, 3336, 3336, 3336, 3336, 3336, 3336, 3336, 3336, 3336, 3336, 3336, 3336, 3336, 3336, 3336, 3336, 3336, 3336,
-        3336, 3336, 3336, 3336, 3336, 3336, 3336, 3336, 3336, 3336, 3337, 3337, 3337, 3337, 3337, 3337, 3337, 3337, 3337, 3337, 3337, 3337, 3337, 3337, 3337, 3337,
-        3337, 3337, 3337, 3337, 3337, 3337, 3337, 3337, 3337, 3337, 3337, 3337, 3337, 3337, 3338, 3338, 3338, 3338, 3338, 3338, 3338, 3338, 3338, 3338, 3338, 3338,
-        3338, 3338, 3338, 3338, 3338, 3338, 3338, 3338, 3338, 3338, 3338, 3338, 3338, 3338, 3338, 3338, 3338, 3338, 3339, 3339, 3339, 3339, 3339, 3339, 3339, 3339,
-        3339, 3339, 3339, 3339, 3339, 3339, 3339, 3339, 3339, 3339, 3339, 3339, 3339, 3339, 3339, 3339, 3339, 3339, 3339, 3339, 3339, 3339, 3340, 3340, 3340, 3340,
-        3340, 3340, 3340, 3340, 3340, 3340, 3340, 3340, 3340, 3340, 3340, 3340, 3340, 3340, 3340, 3340, 3340, 3340, 3340, 3340, 3340, 3340, 3340, 3340, 3340, 3340,
-        3341, 3341, 3341, 3341, 3341, 3341, 3341, 3341, 3341, 3341, 3341, 3341, 3341, 3341, 3341, 3341, 3341, 3341, 3341, 3341, 3341, 3341, 3341, 3341, 3341, 3341,
-        3341, 3341, 3341, 3341, 3342, 3342, 3342, 3342, 3342, 3342, 3342, 3342, 3342, 3342, 3342, 3342, 3342, 3342, 3342, 3342, 3342, 3342, 3342, 3342, 3342, 3342,
-        3342, 3342, 3342, 3342, 3342, 3342, 3342, 3342, 3343, 3343, 3343, 3343, 3343, 3343, 3343, 3343, 3343, 3343, 3343, 3343, 3343, 3343, 3343, 3343, 3343, 3343,
-        3343, 3343, 3343, 3343, 3343, 3343, 3343, 3343, 3343, 3343, 3343, 3343, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344,
-        3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3345, 3345, 3345, 3345, 3345, 3345, 3345, 3345, 3345, 3345,
-        3345, 3345, 3345, 3345, 3345, 3345, 3345, 3345, 3345, 3345, 3345, 3345, 3345, 3345, 3345, 3345, 3345, 3345, 3345, 3345, 3346, 3346, 3346, 3346, 3346, 3346,
-        3346, 3346, 3346, 3346, 3346, 3346, 3346, 3346, 3346, 3346, 3346, 3346, 3346, 3346, 3346, 3346, 3346, 3346, 3346, 3346, 3346, 3346, 3346, 3346, 3347, 3347,
-        3347, 3347, 3347, 3347, 3347, 3347, 3347, 3347, 3347, 3347, 3347, 3347, 3347, 3347, 3347, 3347, 3347, 3347, 3347, 3347, 3347, 3347, 3347, 3347, 3347, 3347,
-        3347, 3347, 3348, 3348, 3348, 3348, 3348, 3348, 3348, 3348, 3348, 3348, 3348, 3348, 3348, 3348, 3348, 3348, 3348, 3348, 3348, 3348, 3348, 3348, 3348, 3348,
-        3348, 3348, 3348, 3348, 3348, 3348, 3348, 3349, 3349, 3349, 3349, 3349, 3349, 3349, 3349, 3349, 3349, 3349, 3349, 3349, 3349, 3349, 3349, 3349, 3349, 3349,
-        3349, 3349, 3349, 3349, 3349, 3349, 3349, 3349, 3349, 3349, 3349, 3350, 3350, 3350, 3350, 3350, 3350, 3350, 3350, 3350, 3350, 3350, 3350, 3350, 3350, 3350,
-        3350, 3350, 3350, 3350, 3350, 3350, 3350, 3350, 3350, 3350, 3350, 3350, 3350, 3350, 3350, 3351, 3351, 3351, 3351, 3351, 3351, 3351, 3351, 3351, 3351, 3351,
-        3351, 3351, 3351, 3351, 3351, 3351, 3351, 3351, 3351, 3351, 3351, 3351, 3351, 3351, 3351, 3351, 3351, 3351, 3351, 3352, 3352, 3352, 3352, 3352, 3352, 3352,
-        3352, 3352, 3352, 3352, 3352, 3352, 3352, 3352, 3352, 3352, 3352, 3352, 3352, 3352, 3352, 3352, 3352, 3352, 3352, 3352, 3352, 3352, 3352, 3353, 3353, 3353,
-        3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353,
-        3353, 3353, 3354, 3354, 3354, 3354, 3354, 3354, 3354, 3354, 3354, 3354, 3354, 3354, 3354, 3354, 3354, 3354, 3354, 3354, 3354, 3354, 3354, 3354, 3354, 3354,
-        3354, 3354, 3354, 3354, 3354, 3354, 3355, 3355, 3355, 3355, 3355, 3355, 3355, 3355, 3355, 3355, 3355, 3355, 3355, 3355, 3355, 3355, 3355, 3355, 3355, 3355,
-        3355, 3355, 3355, 3355, 3355, 3355, 3355, 3355, 3355, 3355, 3356, 3356, 3356, 3356, 3356, 3356, 3356, 3356, 3356, 3356, 3356, 3356, 3356, 3356, 3356, 3356,
-        3356, 3356, 3356, 3356, 3356, 3356, 3356, 3356, 3356, 3356, 3356, 3356, 3356, 3356, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357,
-        3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3358, 3358, 3358, 3358, 3358, 3358, 3358,
-        3358, 3358, 3358, 3358, 3358, 3358, 3358, 3358, 3358, 3358, 3358, 3358, 3358, 3358, 3358, 3358, 3358, 3358, 3358, 3358, 3358, 3358, 3358, 3359, 3359, 3359,
-        3359, 3359, 3359, 3359, 3359, 3359, 3359, 3359, 3359, 3359, 3359, 3359, 3359, 3359, 3359, 3359, 3359, 3359, 3359, 3359, 3359, 3359, 3359, 3359, 3359, 3359,
-        3359, 3360, 3360, 3360, 3360, 3360, 3360, 3360, 3360, 3360, 3360, 3360, 3360, 3360, 3360, 3360, 3360, 3360, 3360, 3360, 3360, 3360, 3360, 3360, 3360, 3360,
-        3360, 3360, 3360, 3360, 3360, 3360, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-        3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3362, 3362, 3362, 3362, 3362, 3362, 3362, 3362, 3362, 3362, 3362, 3362, 3362, 3362, 3362, 3362,
-        3362, 3362, 3362, 3362, 3362, 3362, 3362, 3362, 3362, 3362, 3362, 3362, 3362, 3362, 3363, 3363, 3363, 3363, 3363, 3363, 3363, 3363, 3363, 3363, 3363, 3363,
-        3363, 3363, 3363, 3363, 3363, 3363, 3363, 3363, 3363, 3363, 3363, 3363, 3363, 3363, 3363, 3363, 3363, 3363, 3363, 3364, 3364, 3364, 3364, 3364, 3364, 3364,
-        3364, 3364, 3364, 3364, 3364, 3364, 3364, 3364, 3364, 3364, 3364, 3364, 3364, 3364, 3364, 3364, 3364, 3364, 3364, 3364, 3364, 3364, 3364, 3365, 3365, 3365,
-        3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365,
-        3365, 3366, 3366, 3366, 3366, 3366, 3366, 3366, 3366, 3366, 3366, 3366, 3366, 3366, 3366, 3366, 3366, 3366, 3366, 3366, 3366, 3366, 3366, 3366, 3366, 3366,
-        3366, 3366, 3366, 3366, 3366, 3366, 3367, 3367, 3367, 3367, 3367, 3367, 3367, 3367, 3367, 3367, 3367, 3367, 3367, 3367, 3367, 3367, 3367, 3367, 3367, 3367,
-        3367, 3367, 3367, 3367, 3367, 3367, 3367, 3367, 3367, 3367, 3368, 3368, 3368, 3368, 3368, 3368, 3368, 3368, 3368, 3368, 3368, 3368, 3368, 3368, 3368, 3368,
-        3368, 3368, 3368, 3368, 3368, 3368, 3368, 3368, 3368, 3368, 3368, 3368, 3368, 3368, 3368, 3369, 3369, 3369, 3369, 3369, 3369, 3369, 3369, 3369, 3369, 3369,
-        3369, 3369, 3369, 3369, 3369, 3369, 3369, 3369, 3369, 3369, 3369, 3369, 3369, 3369, 3369, 3369, 3369, 3369, 3369, 3370, 3370, 3370, 3370, 3370, 3370, 3370,
-        3370, 3370, 3370, 3370, 3370, 3370, 3370, 3370, 3370, 3370, 3370, 3370, 3370, 3370, 3370, 3370, 3370, 3370, 3370, 3370, 3370, 3370, 3370, 3370, 3371, 3371,
-        3371, 3371, 3371, 3371, 3371, 3371, 3371, 3371, 3371, 3371, 3371, 3371, 3371, 3371, 3371, 3371, 3371, 3371, 3371, 3371, 3371, 3371, 3371, 3371, 3371, 3371,
-        3371, 3371, 3372, 3372, 3372, 3372, 3372, 3372, 3372, 3372, 3372, 3372, 3372, 3372, 3372, 3372, 3372, 3372, 3372, 3372, 3372, 3372, 3372, 3372, 3372, 3372,
-        3372, 3372, 3372, 3372, 3372, 3372, 3372, 3373, 3373, 3373, 3373, 3373, 3373, 3373, 3373, 3373, 3373, 3373, 3373, 3373, 3373, 3373, 3373, 3373, 3373, 3373,
-        3373, 3373, 3373, 3373, 3373, 3373, 3373, 3373, 3373, 3373, 3373, 3374, 3374, 3374, 3374, 3374, 3374, 3374, 3374, 3374, 3374, 3374, 3374, 3374, 3374, 3374,
-        3374, 3374, 3374, 3374, 3374, 3374, 3374, 3374, 3374, 3374, 3374, 3374, 3374, 3374, 3374, 3374, 3375, 3375, 3375, 3375, 3375, 3375, 3375, 3375, 3375, 3375,
-        3375, 3375, 3375, 3375, 3375, 3375, 3375, 3375, 3375, 3375, 3375, 3375, 3375, 3375, 3375, 3375, 3375, 3375, 3375, 3375, 3376, 3376, 3376, 3376, 3376, 3376,
-        3376, 3376, 3376, 3376, 3376, 3376, 3376, 3376, 3376, 3376, 3376, 3376, 3376, 3376, 3376, 3376, 3376, 3376, 3376, 3376, 3376, 3376, 3376, 3376, 3376, 3377,
-        3377, 3377, 3377, 3377, 3377, 3377, 3377, 3377, 3377, 3377, 3377, 3377, 3377, 3377, 3377, 3377, 3377, 3377, 3377, 3377, 3377, 3377, 3377, 3377, 3377, 3377,
-        3377, 3377, 3377, 3378, 3378, 3378, 3378, 3378, 3378, 3378, 3378, 3378, 3378, 3378, 3378, 3378, 3378, 3378, 3378, 3378, 3378, 3378, 3378, 3378, 3378, 3378,
-        3378, 3378, 3378, 3378, 3378, 3378, 3378, 3378, 3379, 3379, 3379, 3379, 3379, 3379, 3379, 3379, 3379, 3379, 3379, 3379, 3379, 3379, 3379, 3379, 3379, 3379,
-        3379, 3379, 3379, 3379, 3379, 3379, 3379, 3379, 3379, 3379, 3379, 3379, 3379, 3380, 3380, 3380, 3380, 3380, 3380, 3380, 3380, 3380, 3380, 3380, 3380, 3380,
-        3380, 3380, 3380, 3380, 3380, 3380, 3380, 3380, 3380, 3380, 3380, 3380, 3380, 3380, 3380, 3380, 3380, 3381, 3381, 3381, 3381, 3381, 3381, 3381, 3381, 3381,
-        3381, 3381, 3381, 3381, 3381, 3381, 3381, 3381, 3381, 3381, 3381, 3381, 3381, 3381, 3381, 3381, 3381, 3381, 3381, 3381, 3381, 3381, 3382, 3382, 3382, 3382,
-        3382, 3382, 3382, 3382, 3382, 3382, 3382, 3382, 3382, 3382, 3382, 3382, 3382, 3382, 3382, 3382, 3382, 3382, 3382, 3382, 3382, 3382, 3382, 3382, 3382, 3382,
-        3383, 3383, 3383, 3383, 3383, 3383, 3383, 3383, 3383, 3383, 3383, 3383, 3383, 3383, 3383, 3383, 3383, 3383, 3383, 3383, 3383, 3383, 3383, 3383, 3383, 3383,
-        3383, 3383, 3383, 3383, 3383, 3384, 3384, 3384, 3384, 3384, 3384, 3384, 3384, 3384, 3384, 3384, 3384, 3384, 3384, 3384, 3384, 3384, 3384, 3384, 3384, 3384,
-        3384, 3384, 3384, 3384, 3384, 3384, 3384, 3384, 3384, 3384, 3385, 3385, 3385, 3385, 3385, 3385, 3385, 3385, 3385, 3385, 3385, 3385, 3385, 3385, 3385, 3385,
-        3385, 3385, 3385, 3385, 3385, 3385, 3385, 3385, 3385, 3385, 3385, 3385, 3385, 3385, 3386, 3386, 3386, 3386, 3386, 3386, 3386, 3386, 3386, 3386, 3386, 3386,
-        3386, 3386, 3386, 3386, 3386, 3386, 3386, 3386, 3386, 3386, 3386, 3386, 3386, 3386, 3386, 3386, 3386, 3386, 3386, 3387, 3387, 3387, 3387, 3387, 3387, 3387,
-        3387, 3387, 3387, 3387, 3387, 3387, 3387, 3387, 3387, 3387, 3387, 3387, 3387, 3387, 3387, 3387, 3387, 3387, 3387, 3387, 3387, 3387, 3387, 3387, 3388, 3388,
-        3388, 3388, 3388, 3388, 3388, 3388, 3388, 3388, 3388, 3388, 3388, 3388, 3388, 3388, 3388, 3388, 3388, 3388, 3388, 3388, 3388, 3388, 3388, 3388, 3388, 3388,
-        3388, 3388, 3388, 3389, 3389, 3389, 3389, 3389, 3389, 3389, 3389, 3389, 3389, 3389, 3389, 3389, 3389, 3389, 3389, 3389, 3389, 3389, 3389, 3389, 3389, 3389,
-        3389, 3389, 3389, 3389, 3389, 3389, 3389, 3390, 3390, 3390, 3390, 3390, 3390, 3390, 3390, 3390, 3390, 3390, 3390, 3390, 3390, 3390, 3390, 3390, 3390, 3390,
-        3390, 3390, 3390, 3390, 3390, 3390, 3390, 3390, 3390, 3390, 3390, 3390, 3391, 3391, 3391, 3391, 3391, 3391, 3391, 3391, 3391, 3391, 3391, 3391, 3391, 3391,
-        3391, 3391, 3391, 3391, 3391, 3391, 3391, 3391, 3391, 3391, 3391, 3391, 3391, 3391, 3391, 3391, 3391, 3392, 3392, 3392, 3392, 3392, 3392, 3392, 3392, 3392,
-        3392, 3392, 3392, 3392, 3392, 3392, 3392, 3392, 3392, 3392, 3392, 3392, 3392, 3392, 3392, 3392, 3392, 3392, 3392, 3392, 3392, 3392, 3393, 3393, 3393, 3393,
-        3393, 3393, 3393, 3393, 3393, 3393, 3393, 3393, 3393, 3393, 3393, 3393, 3393, 3393, 3393, 3393, 3393, 3393, 3393, 3393, 3393, 3393, 3393, 3393, 3393, 3393,
-        3393, 3394, 3394, 3394, 3394, 3394, 3394, 3394, 3394, 3394, 3394, 3394, 3394, 3394, 3394, 3394, 3394, 3394, 3394, 3394, 3394, 3394, 3394, 3394, 3394, 3394,
-        3394, 3394, 3394, 3394, 3394, 3395, 3395, 3395, 3395, 3395, 3395, 3395, 3395, 3395, 3395, 3395, 3395, 3395, 3395, 3395, 3395, 3395, 3395, 3395, 3395, 3395,
-        3395, 3395, 3395, 3395, 3395, 3395, 3395, 3395, 3395, 3395, 3396, 3396, 3396, 3396, 3396, 3396, 3396, 3396, 3396, 3396, 3396, 3396, 3396, 3396, 3396, 3396,
-        3396, 3396, 3396, 3396, 3396, 3396, 3396, 3396, 3396, 3396, 3396, 3396, 3396, 3396, 3396, 3397, 3397, 3397, 3397, 3397, 3397, 3397, 3397, 3397, 3397, 3397,
-        3397, 3397, 3397, 3397, 3397, 3397, 3397, 3397, 3397, 3397, 3397, 3397, 3397, 3397, 3397, 3397, 3397, 3397, 3397, 3397, 3398, 3398, 3398, 3398, 3398, 3398,
-        3398, 3398, 3398, 3398, 3398, 3398, 3398, 3398, 3398, 3398, 3398, 3398, 3398, 3398, 3398, 3398, 3398, 3398, 3398, 3398, 3398, 3398, 3398, 3398, 3398, 3399,
-        3399, 3399, 3399, 3399, 3399, 3399, 3399, 3399, 3399, 3399, 3399, 3399, 3399, 3399, 3399, 3399, 3399, 3399, 3399, 3399, 3399, 3399, 3399, 3399, 3399, 3399,
-        3399, 3399, 3399, 3399, 3400, 3400, 3400, 3400, 3400, 3400, 3400, 3400, 3400, 3400, 3400, 3400, 3400, 3400, 3400, 3400, 3400, 3400, 3400, 3400, 3400, 3400,
-        3400, 3400, 3400, 3400, 3400, 3400, 3400, 3400, 3400, 3401, 3401, 3401, 3401, 3401, 3401, 3401, 3401, 3401, 3401, 3401, 3401, 3401, 3401, 3401, 3401, 3401,
-        3401, 3401, 3401, 3401, 3401, 3401, 3401, 3401, 3401, 3401, 3401, 3401, 3401, 3402, 3402, 3402, 3402, 3402, 3402, 3402, 3402, 3402, 3402, 3402, 3402, 3402,
-        3402, 3402, 3402, 3402, 3402, 3402, 3402, 3402, 3402, 3402, 3402, 3402, 3402, 3402, 3402, 3402, 3402, 3402, 3403, 3403, 3403, 3403, 3403, 3403, 3403, 3403,
-        3403, 3403, 3403, 3403, 3403, 3403, 3403, 3403, 3403, 3403, 3403, 3403, 3403, 3403, 3403, 3403, 3403, 3403, 3403, 3403, 3403, 3403, 3403, 3404, 3404, 3404,
-        3404, 3404, 3404, 3404, 3404, 3404, 3404, 3404, 3404, 3404, 3404, 3404, 3404, 3404, 3404, 3404, 3404, 3404, 3404, 3404, 3404, 3404, 3404, 3404, 3404, 3404,
-        3404, 3404, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405,
-        3405, 3405, 3405, 3405, 3405, 3405, 3405, 3406, 3406, 3406, 3406, 3406, 3406, 3406, 3406, 3406, 3406, 3406, 3406, 3406, 3406, 3406, 3406, 3406, 3406, 3406,
-        3406, 3406, 3406, 3406, 3406, 3406, 3406, 3406, 3406, 3406, 3406, 3406, 3407, 3407, 3407, 3407, 3407, 3407, 3407, 3407, 3407, 3407, 3407, 3407, 3407, 3407,
-        3407, 3407, 3407, 3407, 3407, 3407, 3407, 3407, 3407, 3407, 3407, 3407, 3407, 3407, 3407, 3407, 3407, 3408, 3408, 3408, 3408, 3408, 3408, 3408, 3408, 3408,
-        3408, 3408, 3408, 3408, 3408, 3408, 3408, 3408, 3408, 3408, 3408, 3408, 3408, 3408, 3408, 3408, 3408, 3408, 3408, 3408, 3408, 3408, 3409, 3409, 3409, 3409,
-        3409, 3409, 3409, 3409, 3409, 3409, 3409, 3409, 3409, 3409, 3409, 3409, 3409, 3409, 3409, 3409, 3409, 3409, 3409, 3409, 3409, 3409, 3409, 3409, 3409, 3409,
-        3409, 3410, 3410, 3410, 3410, 3410, 3410, 3410, 3410, 3410, 3410, 3410, 3410, 3410, 3410, 3410, 3410, 3410, 3410, 3410, 3410, 3410, 3410, 3410, 3410, 3410,
-        3410, 3410, 3410, 3410, 3410, 3410, 3411, 3411, 3411, 3411, 3411, 3411, 3411, 3411, 3411, 3411, 3411, 3411, 3411, 3411, 3411, 3411, 3411, 3411, 3411, 3411,
-        3411, 3411, 3411, 3411, 3411, 3411, 3411, 3411, 3411, 3411, 3411, 3411, 3412, 3412, 3412, 3412, 3412, 3412, 3412, 3412, 3412, 3412, 3412, 3412, 3412, 3412,
-        3412, 3412, 3412, 3412, 3412, 3412, 3412, 3412, 3412, 3412, 3412, 3412, 3412, 3412, 3412, 3412, 3412, 3413, 3413, 3413, 3413, 3413, 3413, 3413, 3413, 3413,
-        3413, 3413, 3413, 3413, 3413, 3413, 3413, 3413, 3413, 3413, 3413, 3413, 3413, 3413, 3413, 3413, 3413, 3413, 3413, 3413, 3413, 3413, 3414, 3414, 3414, 3414,
-        3414, 3414, 3414, 3414, 3414, 3414, 3414, 3414, 3414, 3414, 3414, 3414, 3414, 3414, 3414, 3414, 3414, 3414, 3414, 3414, 3414, 3414, 3414, 3414, 3414, 3414,
-        3414, 3415, 3415, 3415, 3415, 3415, 3415, 3415, 3415, 3415, 3415, 3415, 3415, 3415, 3415, 3415, 3415, 3415, 3415, 3415, 3415, 3415, 3415, 3415, 3415, 3415,
-        3415, 3415, 3415, 3415, 3415, 3415, 3416, 3416, 3416, 3416, 3416, 3416, 3416, 3416, 3416, 3416, 3416, 3416, 3416, 3416, 3416, 3416, 3416, 3416, 3416, 3416,
-        3416, 3416, 3416, 3416, 3416, 3416, 3416, 3416, 3416, 3416, 3416, 3417, 3417, 3417, 3417, 3417, 3417, 3417, 3417, 3417, 3417, 3417, 3417, 3417, 3417, 3417,
-        3417, 3417, 3417, 3417, 3417, 3417, 3417, 3417, 3417, 3417, 3417, 3417, 3417, 3417, 3417, 3417, 3418, 3418, 3418, 3418, 3418, 3418, 3418, 3418, 3418, 3418,
-        3418, 3418, 3418, 3418, 3418, 3418, 3418, 3418, 3418, 3418, 3418, 3418, 3418, 3418, 3418, 3418, 3418, 3418, 3418, 3418, 3418, 3419, 3419, 3419, 3419, 3419,
-        3419, 3419, 3419, 3419, 3419, 3419, 3419, 3419, 3419, 3419, 3419, 3419, 3419, 3419, 3419, 3419, 3419, 3419, 3419, 3419, 3419, 3419, 3419, 3419, 3419, 3419,
-        3419, 3420, 3420, 3420, 3420, 3420, 3420, 3420, 3420, 3420, 3420, 3420, 3420, 3420, 3420, 3420, 3420, 3420, 3420, 3420, 3420, 3420, 3420, 3420, 3420, 3420,
-        3420, 3420, 3420, 3420, 3420, 3420, 3421, 3421, 3421, 3421, 3421, 3421, 3421, 3421, 3421, 3421, 3421, 3421, 3421, 3421, 3421, 3421, 3421, 3421, 3421, 3421,
-        3421, 3421, 3421, 3421, 3421, 3421, 3421, 3421, 3421, 3421, 3421, 3422, 3422, 3422, 3422, 3422, 3422, 3422, 3422, 3422, 3422, 3422, 3422, 3422, 3422, 3422,
-        3422, 3422, 3422, 3422, 3422, 3422, 3422, 3422, 3422, 3422, 3422, 3422, 3422, 3422, 3422, 3422, 3423, 3423, 3423, 3423, 3423, 3423, 3423, 3423, 3423, 3423,
-        3423, 3423, 3423, 3423, 3423, 3423, 3423, 3423, 3423, 3423, 3423, 3423, 3423, 3423, 3423, 3423, 3423, 3423, 3423, 3423, 3423, 3424, 3424, 3424, 3424, 3424,
-        3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424,
-        3424, 3425, 3425, 3425, 3425, 3425, 3425, 3425, 3425, 3425, 3425, 3425, 3425, 3425, 3425, 3425, 3425, 3425, 3425, 3425, 3425, 3425, 3425, 3425, 3425, 3425,
-        3425, 3425, 3425, 3425, 3425, 3425, 3426, 3426, 3426, 3426, 3426, 3426, 3426, 3426, 3426, 3426, 3426, 3426, 3426, 3426, 3426, 3426, 3426, 3426, 3426, 3426,
-        3426, 3426, 3426, 3426, 3426, 3426, 3426, 3426, 3426, 3426, 3426, 3427, 3427, 3427, 3427, 3427, 3427, 3427, 3427, 3427, 3427, 3427, 3427, 3427, 3427, 3427,
-        3427, 3427, 3427, 3427, 3427, 3427, 3427, 3427, 3427, 3427, 3427, 3427, 3427, 3427, 3427, 3427, 3427, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428,
-        3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3428, 3429, 3429, 3429, 3429,
-        3429, 3429, 3429, 3429, 3429, 3429, 3429, 3429, 3429, 3429, 3429, 3429, 3429, 3429, 3429, 3429, 3429, 3429, 3429, 3429, 3429, 3429, 3429, 3429, 3429, 3429,
-        3429, 3430, 3430, 3430, 3430, 3430, 3430, 3430, 3430, 3430, 3430, 3430, 3430, 3430, 3430, 3430, 3430, 3430, 3430, 3430, 3430, 3430, 3430, 3430, 3430, 3430,
-        3430, 3430, 3430, 3430, 3430, 3430, 3430, 3431, 3431, 3431, 3431, 3431, 3431, 3431, 3431, 3431, 3431, 3431, 3431, 3431, 3431, 3431, 3431, 3431, 3431, 3431,
-        3431, 3431, 3431, 3431, 3431, 3431, 3431, 3431, 3431, 3431, 3431, 3431, 3432, 3432, 3432, 3432, 3432, 3432, 3432, 3432, 3432, 3432, 3432, 3432, 3432, 3432,
-        3432, 3432, 3432, 3432, 3432, 3432, 3432, 3432, 3432, 3432, 3432, 3432, 3432, 3432, 3432, 3432, 3432, 3433, 3433, 3433, 3433, 3433, 3433, 3433, 3433, 3433,
-        3433, 3433, 3433, 3433, 3433, 3433, 3433, 3433, 3433, 3433, 3433, 3433, 3433, 3433, 3433, 3433, 3433, 3433, 3433, 3433, 3433, 3433, 3433, 3434, 3434, 3434,
-        3434, 3434, 3434, 3434, 3434, 3434, 3434, 3434, 3434, 3434, 3434, 3434, 3434, 3434, 3434, 3434, 3434, 3434, 3434, 3434, 3434, 3434, 3434, 3434, 3434, 3434,
-        3434, 3434, 3435, 3435, 3435, 3435, 3435, 3435, 3435, 3435, 3435, 3435, 3435, 3435, 3435, 3435, 3435, 3435, 3435, 3435, 3435, 3435, 3435, 3435, 3435, 3435,
-        3435, 3435, 3435, 3435, 3435, 3435, 3435, 3436, 3436, 3436, 3436, 3436, 3436, 3436, 3436, 3436, 3436, 3436, 3436, 3436, 3436, 3436, 3436, 3436, 3436, 3436,
-        3436, 3436, 3436, 3436, 3436, 3436, 3436, 3436, 3436, 3436, 3436, 3436, 3436, 3437, 3437, 3437, 3437, 3437, 3437, 3437, 3437, 3437, 3437, 3437, 3437, 3437,
-        3437, 3437, 3437, 3437, 3437, 3437, 3437, 3437, 3437, 3437, 3437, 3437, 3437, 3437, 3437, 3437, 3437, 3437, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438,
-        3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3439, 3439,
-        3439, 3439, 3439, 3439, 3439, 3439, 3439, 3439, 3439, 3439, 3439, 3439, 3439, 3439, 3439, 3439, 3439, 3439, 3439, 3439, 3439, 3439, 3439, 3439, 3439, 3439,
-        3439, 3439, 3439, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440,
-        3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3441, 3441, 3441, 3441, 3441, 3441, 3441, 3441, 3441, 3441, 3441, 3441, 3441, 3441, 3441, 3441, 3441,
-        3441, 3441, 3441, 3441, 3441, 3441, 3441, 3441, 3441, 3441, 3441, 3441, 3441, 3441, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442,
-        3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3443, 3443, 3443, 3443, 3443, 3443,
-        3443, 3443, 3443, 3443, 3443, 3443, 3443, 3443, 3443, 3443, 3443, 3443, 3443, 3443, 3443, 3443, 3443, 3443, 3443, 3443, 3443, 3443, 3443, 3443, 3443, 3444,
-        3444, 3444, 3444, 3444, 3444, 3444, 3444, 3444, 3444, 3444, 3444, 3444, 3444, 3444, 3444, 3444, 3444, 3444, 3444, 3444, 3444, 3444, 3444, 3444, 3444, 3444,
-        3444, 3444, 3444, 3444, 3444, 3445, 3445, 3445, 3445, 3445, 3445, 3445, 3445, 3445, 3445, 3445, 3445, 3445, 3445, 3445, 3445, 3445, 3445, 3445, 3445, 3445,
-        3445, 3445, 3445, 3445, 3445, 3445, 3445, 3445, 3445, 3445, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-        3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3447, 3447, 3447, 3447, 3447, 3447, 3447, 3447, 3447, 3447,
-        3447, 3447, 3447, 3447, 3447, 3447, 3447, 3447, 3447, 3447, 3447, 3447, 3447, 3447, 3447, 3447, 3447, 3447, 3447, 3447, 3447, 3447, 3448, 3448, 3448, 3448,
-        3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448, 3448,
-        3448, 3449, 3449, 3449, 3449, 3449, 3449, 3449, 3449, 3449, 3449, 3449, 3449, 3449, 3449, 3449, 3449, 3449, 3449, 3449, 3449, 3449, 3449, 3449, 3449, 3449,
-        3449, 3449, 3449, 3449, 3449, 3449, 3449, 3450, 3450, 3450, 3450, 3450, 3450, 3450, 3450, 3450, 3450, 3450, 3450, 3450, 3450, 3450, 3450, 3450, 3450, 3450,
-        3450, 3450, 3450, 3450, 3450, 3450, 3450, 3450, 3450, 3450, 3450, 3450, 3450, 3451, 3451, 3451, 3451, 3451, 3451, 3451, 3451, 3451, 3451, 3451, 3451, 3451,
-        3451, 3451, 3451, 3451, 3451, 3451, 3451, 3451, 3451, 3451, 3451, 3451, 3451, 3451, 3451, 3451, 3451, 3451, 3452, 3452, 3452, 3452, 3452, 3452, 3452, 3452,
-        3452, 3452, 3452, 3452, 3452, 3452, 3452, 3452, 3452, 3452, 3452, 3452, 3452, 3452, 3452, 3452, 3452, 3452, 3452, 3452, 3452, 3452, 3452, 3452, 3453, 3453,
-        3453, 3453, 3453, 3453, 3453, 3453, 3453, 3453, 3453, 3453, 3453, 3453, 3453, 3453, 3453, 3453, 3453, 3453, 3453, 3453, 3453, 3453, 3453, 3453, 3453, 3453,
-        3453, 3453, 3453, 3453, 3454, 3454, 3454, 3454, 3454, 3454, 3454, 3454, 3454, 3454, 3454, 3454, 3454, 3454, 3454, 3454, 3454, 3454, 3454, 3454, 3454, 3454,
-        3454, 3454, 3454, 3454, 3454, 3454, 3454, 3454, 3454, 3455, 3455, 3455, 3455, 3455, 3455, 3455, 3455, 3455, 3455, 3455, 3455, 3455, 3455, 3455, 3455, 3455,
-        3455, 3455, 3455, 3455, 3455, 3455, 3455, 3455, 3455, 3455, 3455, 3455, 3455, 3455, 3455, 3456, 3456, 3456, 3456, 3456, 3456, 3456, 3456, 3456, 3456, 3456,
-        3456, 3456, 3456, 3456, 3456, 3456, 3456, 3456, 3456, 3456, 3456, 3456, 3456, 3456, 3456, 3456, 3456, 3456, 3456, 3456, 3456, 3457, 3457, 3457, 3457, 3457,
-        3457, 3457, 3457, 3457, 3457, 3457, 3457, 3457, 3457, 3457, 3457, 3457, 3457, 3457, 3457, 3457, 3457, 3457, 3457, 3457, 3457, 3457, 3457, 3457, 3457, 3457,
-        3458, 3458, 3458, 3458, 3458, 3458, 3458, 3458, 3458, 3458, 3458, 3458, 3458, 3458, 3458, 3458, 3458, 3458, 3458, 3458, 3458, 3458, 3458, 3458, 3458, 3458,
-        3458, 3458, 3458, 3458, 3458, 3458, 3459, 3459, 3459, 3459, 3459, 3459, 3459, 3459, 3459, 3459, 3459, 3459, 3459, 3459, 3459, 3459, 3459, 3459, 3459, 3459,
-        3459, 3459, 3459, 3459, 3459, 3459, 3459, 3459, 3459, 3459, 3459, 3459, 3460, 3460, 3460, 3460, 3460, 3460, 3460, 3460, 3460, 3460, 3460, 3460, 3460, 3460,
-        3460, 3460, 3460, 3460, 3460, 3460, 3460, 3460, 3460, 3460, 3460, 3460, 3460, 3460, 3460, 3460, 3460, 3460, 3461, 3461, 3461, 3461, 3461, 3461, 3461, 3461,
-        3461, 3461, 3461, 3461, 3461, 3461, 3461, 3461, 3461, 3461, 3461, 3461, 3461, 3461, 3461, 3461, 3461, 3461, 3461, 3461, 3461, 3461, 3461, 3462, 3462, 3462,
-        3462, 3462, 3462, 3462, 3462, 3462, 3462, 3462, 3462, 3462, 3462, 3462, 3462, 3462, 3462, 3462, 3462, 3462, 3462, 3462, 3462, 3462, 3462, 3462, 3462, 3462,
-        3462, 3462, 3462, 3463, 3463, 3463, 3463, 3463, 3463, 3463, 3463, 3463, 3463, 3463, 3463, 3463, 3463, 3463, 3463, 3463, 3463, 3463, 3463, 3463, 3463, 3463,
-        3463, 3463, 3463, 3463, 3463, 3463, 3463, 3463, 3463, 3464, 3464, 3464, 3464, 3464, 3464, 3464, 3464, 3464, 3464, 3464, 3464, 3464, 3464, 3464, 3464, 3464,
-        3464, 3464, 3464, 3464, 3464, 3464, 3464, 3464, 3464, 3464, 3464, 3464, 3464, 3464, 3464, 3465, 3465, 3465, 3465, 3465, 3465, 3465, 3465, 3465, 3465, 3465,
-        3465, 3465, 3465, 3465, 3465, 3465, 3465, 3465, 3465, 3465, 3465, 3465, 3465, 3465, 3465, 3465, 3465, 3465, 3465, 3465, 3465, 3466, 3466, 3466, 3466, 3466,
-        3466, 3466, 3466, 3466, 3466, 3466, 3466, 3466, 3466, 3466, 3466, 3466, 3466, 3466, 3466, 3466, 3466, 3466, 3466, 3466, 3466, 3466, 3466, 3466, 3466, 3466,
-        3466, 3467, 3467, 3467, 3467, 3467, 3467, 3467, 3467, 3467, 3467, 3467, 3467, 3467, 3467, 3467, 3467, 3467, 3467, 3467, 3467, 3467, 3467, 3467, 3467, 3467,
-        3467, 3467, 3467, 3467, 3467, 3467, 3467, 3468, 3468, 3468, 3468, 3468, 3468, 3468, 3468, 3468, 3468, 3468, 3468, 3468, 3468, 3468, 3468, 3468, 3468, 3468,
-        3468, 3468, 3468, 3468, 3468, 3468, 3468, 3468, 3468, 3468, 3468, 3468, 3469, 3469, 3469, 3469, 3469, 3469, 3469, 3469, 3469, 3469, 3469, 3469, 3469, 3469,
-        3469, 3469, 3469, 3469, 3469, 3469, 3469, 3469, 3469, 3469, 3469, 3469, 3469, 3469, 3469, 3469, 3469, 3469, 3470, 3470, 3470, 3470, 3470, 3470, 3470, 3470,
-        3470, 3470, 3470, 3470, 3470, 3470, 3470, 3470, 3470, 3470, 3470, 3470, 3470, 3470, 3470, 3470, 3470, 3470, 3470, 3470, 3470, 3470, 3470, 3470, 3471, 3471,
-        3471, 3471, 3471, 3471, 3471, 3471, 3471, 3471, 3471, 3471, 3471, 3471, 3471, 3471, 3471, 3471, 3471, 3471, 3471, 3471, 3471, 3471, 3471, 3471, 3471, 3471,
-        3471, 3471, 3471, 3471, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472,
-        3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3473, 3473, 3473, 3473, 3473, 3473, 3473, 3473, 3473, 3473, 3473, 3473, 3473, 3473, 3473, 3473,
-        3473, 3473, 3473, 3473, 3473, 3473, 3473, 3473, 3473, 3473, 3473, 3473, 3473, 3473, 3473, 3473, 3474, 3474, 3474, 3474, 3474, 3474, 3474, 3474, 3474, 3474,
-        3474, 3474, 3474, 3474, 3474, 3474, 3474, 3474, 3474, 3474, 3474, 3474, 3474, 3474, 3474, 3474, 3474, 3474, 3474, 3474, 3474, 3474, 3475, 3475, 3475, 3475,
-        3475, 3475, 3475, 3475, 3475, 3475, 3475, 3475, 3475, 3475, 3475, 3475, 3475, 3475, 3475, 3475, 3475, 3475, 3475, 3475, 3475, 3475, 3475, 3475, 3475, 3475,
-        3475, 3475, 3476, 3476, 3476, 3476, 3476, 3476, 3476, 3476, 3476, 3476, 3476, 3476, 3476, 3476, 3476, 3476, 3476, 3476, 3476, 3476, 3476, 3476, 3476, 3476,
-        3476, 3476, 3476, 3476, 3476, 3476, 3476, 3476, 3477, 3477, 3477, 3477, 3477, 3477, 3477, 3477, 3477, 3477, 3477, 3477, 3477, 3477, 3477, 3477, 3477, 3477,
-        3477, 3477, 3477, 3477, 3477, 3477, 3477, 3477, 3477, 3477, 3477, 3477, 3477, 3477, 3478, 3478, 3478, 3478, 3478, 3478, 3478, 3478, 3478, 3478, 3478, 3478,
-        3478, 3478, 3478, 3478, 3478, 3478, 3478, 3478, 3478, 3478, 3478, 3478, 3478, 3478, 3478, 3478, 3478, 3478, 3478, 3478, 3479, 3479, 3479, 3479, 3479, 3479,
-        3479, 3479, 3479, 3479, 3479, 3479, 3479, 3479, 3479, 3479, 3479, 3479, 3479, 3479, 3479, 3479, 3479, 3479, 3479, 3479, 3479, 3479, 3479, 3479, 3479, 3479,
-        3480, 3480, 3480, 3480, 3480, 3480, 3480, 3480, 3480, 3480, 3480, 3480, 3480, 3480, 3480, 3480, 3480, 3480, 3480, 3480, 3480, 3480, 3480, 3480, 3480, 3480,
-        3480, 3480, 3480, 3480, 3480, 3480, 3481, 3481, 3481, 3481, 3481, 3481, 3481, 3481, 3481, 3481, 3481, 3481, 3481, 3481, 3481, 3481, 3481, 3481, 3481, 3481,
-        3481, 3481, 3481, 3481, 3481, 3481, 3481, 3481, 3481, 3481, 3481, 3481, 3481, 3482, 3482, 3482, 3482, 3482, 3482, 3482, 3482, 3482, 3482, 3482, 3482, 3482,
-        3482, 3482, 3482, 3482, 3482, 3482, 3482, 3482, 3482, 3482, 3482, 3482, 3482, 3482, 3482, 3482, 3482, 3482, 3482, 3483, 3483, 3483, 3483, 3483, 3483, 3483,
-        3483, 3483, 3483, 3483, 3483, 3483, 3483, 3483, 3483, 3483, 3483, 3483, 3483, 3483, 3483, 3483, 3483, 3483, 3483, 3483, 3483, 3483, 3483, 3483, 3483, 3484,
-        3484, 3484, 3484, 3484, 3484, 3484, 3484, 3484, 3484, 3484, 3484, 3484, 3484, 3484, 3484, 3484, 3484, 3484, 3484, 3484, 3484, 3484, 3484, 3484, 3484, 3484,
-        3484, 3484, 3484, 3484, 3484, 3485, 3485, 3485, 3485, 3485, 3485, 3485, 3485, 3485, 3485, 3485, 3485, 3485, 3485, 3485, 3485, 3485, 3485, 3485, 3485, 3485,
-        3485, 3485, 3485, 3485, 3485, 3485, 3485, 3485, 3485, 3485, 3485, 3486, 3486, 3486, 3486, 3486, 3486, 3486, 3486, 3486, 3486, 3486, 3486, 3486, 3486, 3486,
-        3486, 3486, 3486, 3486, 3486, 3486, 3486, 3486, 3486, 3486, 3486, 3486, 3486, 3486, 3486, 3486, 3486, 3487, 3487, 3487, 3487, 3487, 3487, 3487, 3487, 3487,
-        3487, 3487, 3487, 3487, 3487, 3487, 3487, 3487, 3487, 3487, 3487, 3487, 3487, 3487, 3487, 3487, 3487, 3487, 3487, 3487, 3487, 3487, 3487, 3488, 3488, 3488,
-        3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488,
-        3488, 3488, 3488, 3488, 3489, 3489, 3489, 3489, 3489, 3489, 3489, 3489, 3489, 3489, 3489, 3489, 3489, 3489, 3489, 3489, 3489, 3489, 3489, 3489, 3489, 3489,
-        3489, 3489, 3489, 3489, 3489, 3489, 3489, 3489, 3489, 3489, 3490, 3490, 3490, 3490, 3490, 3490, 3490, 3490, 3490, 3490, 3490, 3490, 3490, 3490, 3490, 3490,
-        3490, 3490, 3490, 3490, 3490, 3490, 3490, 3490, 3490, 3490, 3490, 3490, 3490, 3490, 3490, 3490, 3491, 3491, 3491, 3491, 3491, 3491, 3491, 3491, 3491, 3491,
-        3491, 3491, 3491, 3491, 3491, 3491, 3491, 3491, 3491, 3491, 3491, 3491, 3491, 3491, 3491, 3491, 3491, 3491, 3491, 3491, 3491, 3491, 3492, 3492, 3492, 3492,
-        3492, 3492, 3492, 3492, 3492, 3492, 3492, 3492, 3492, 3492, 3492, 3492, 3492, 3492, 3492, 3492, 3492, 3492, 3492, 3492, 3492, 3492, 3492, 3492, 3492, 3492,
-        3492, 3492, 3492, 3493, 3493, 3493, 3493, 3493, 3493, 3493, 3493, 3493, 3493, 3493, 3493, 3493, 3493, 3493, 3493, 3493, 3493, 3493, 3493, 3493, 3493, 3493,
-        3493, 3493, 3493, 3493, 3493, 3493, 3493, 3493, 3493, 3494, 3494, 3494, 3494, 3494, 3494, 3494, 3494, 3494, 3494, 3494, 3494, 3494, 3494, 3494, 3494, 3494,
-        3494, 3494, 3494, 3494, 3494, 3494, 3494, 3494, 3494, 3494, 3494, 3494, 3494, 3494, 3494, 3495, 3495, 3495, 3495, 3495, 3495, 3495, 3495, 3495, 3495, 3495,
-        3495, 3495, 3495, 3495, 3495, 3495, 3495, 3495, 3495, 3495, 3495, 3495, 3495, 3495, 3495, 3495, 3495, 3495, 3495, 3495, 3495, 3496, 3496, 3496, 3496, 3496,
-        3496, 3496, 3496, 3496, 3496, 3496, 3496, 3496, 3496, 3496, 3496, 3496, 3496, 3496, 3496, 3496, 3496, 3496, 3496, 3496, 3496, 3496, 3496, 3496, 3496, 3496,
-        3496, 3496, 3497, 3497, 3497, 3497, 3497, 3497, 3497, 3497, 3497, 3497, 3497, 3497, 3497, 3497, 3497, 3497, 3497, 3497, 3497, 3497, 3497, 3497, 3497, 3497,
-        3497, 3497, 3497, 3497, 3497, 3497, 3497, 3497, 3498, 3498, 3498, 3498, 3498, 3498, 3498, 3498, 3498, 3498, 3498, 3498, 3498, 3498, 3498, 3498, 3498, 3498,
-        3498, 3498, 3498, 3498, 3498, 3498, 3498, 3498, 3498, 3498, 3498, 3498, 3498, 3498, 3499, 3499, 3499, 3499, 3499, 3499, 3499, 3499, 3499, 3499, 3499, 3499,
-        3499, 3499, 3499, 3499, 3499, 3499, 3499, 3499, 3499, 3499, 3499, 3499, 3499, 3499, 3499, 3499, 3499, 3499, 3499, 3499, 3499, 3500, 3500, 3500, 3500, 3500,
-        3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3500,
-        3500, 3501, 3501, 3501, 3501, 3501, 3501, 3501, 3501, 3501, 3501, 3501, 3501, 3501, 3501, 3501, 3501, 3501, 3501, 3501, 3501, 3501, 3501, 3501, 3501, 3501,
-        3501, 3501, 3501, 3501, 3501, 3501, 3501, 3501, 3502, 3502, 3502, 3502, 3502, 3502, 3502, 3502, 3502, 3502, 3502, 3502, 3502, 3502, 3502, 3502, 3502, 3502,
-        3502, 3502, 3502, 3502, 3502, 3502, 3502, 3502, 3502, 3502, 3502, 3502, 3502, 3502, 3503, 3503, 3503, 3503, 3503, 3503, 3503, 3503, 3503, 3503, 3503, 3503,
-        3503, 3503, 3503, 3503, 3503, 3503, 3503, 3503, 3503, 3503, 3503, 3503, 3503, 3503, 3503, 3503, 3503, 3503, 3503, 3503, 3504, 3504, 3504, 3504, 3504, 3504,
-        3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504,
-        3504, 3505, 3505, 3505, 3505, 3505, 3505, 3505, 3505, 3505, 3505, 3505, 3505, 3505, 3505, 3505, 3505, 3505, 3505, 3505, 3505, 3505, 3505, 3505, 3505, 3505,
-        3505, 3505, 3505, 3505, 3505, 3505, 3505, 3506, 3506, 3506, 3506, 3506, 3506, 3506, 3506, 3506, 3506, 3506, 3506, 3506, 3506, 3506, 3506, 3506, 3506, 3506,
-        3506, 3506, 3506, 3506, 3506, 3506, 3506, 3506, 3506, 3506, 3506, 3506, 3506, 3506, 3507, 3507, 3507, 3507, 3507, 3507, 3507, 3507, 3507, 3507, 3507, 3507,
-        3507, 3507, 3507, 3507, 3507, 3507, 3507, 3507, 3507, 3507, 3507, 3507, 3507, 3507, 3507, 3507, 3507, 3507, 3507, 3507, 3508, 3508, 3508, 3508, 3508, 3508,
-        3508, 3508, 3508, 3508, 3508, 3508, 3508, 3508, 3508, 3508, 3508, 3508, 3508, 3508, 3508, 3508, 3508, 3508, 3508, 3508, 3508, 3508, 3508, 3508, 3508, 3508,
-        3508, 3509, 3509, 3509, 3509, 3509, 3509, 3509, 3509, 3509, 3509, 3509, 3509, 3509, 3509, 3509, 3509, 3509, 3509, 3509, 3509, 3509, 3509, 3509, 3509, 3509,
-        3509, 3509, 3509, 3509, 3509, 3509, 3509, 3510, 3510, 3510, 3510, 3510, 3510, 3510, 3510, 3510, 3510, 3510, 3510, 3510, 3510, 3510, 3510, 3510, 3510, 3510,
-        3510, 3510, 3510, 3510, 3510, 3510, 3510, 3510, 3510, 3510, 3510, 3510, 3510, 3510, 3511, 3511, 3511, 3511, 3511, 3511, 3511, 3511, 3511, 3511, 3511, 3511,
-        3511, 3511, 3511, 3511, 3511, 3511, 3511, 3511, 3511, 3511, 3511, 3511, 3511, 3511, 3511, 3511, 3511, 3511, 3511, 3511, 3512, 3512, 3512, 3512, 3512, 3512,
-        3512, 3512, 3512, 3512, 3512, 3512, 3512, 3512, 3512, 3512, 3512, 3512, 3512, 3512, 3512, 3512, 3512, 3512, 3512, 3512, 3512, 3512, 3512, 3512, 3512, 3512,
-        3512, 3513, 3513, 3513, 3513, 3513, 3513, 3513, 3513, 3513, 3513, 3513, 3513, 3513, 3513, 3513, 3513, 3513, 3513, 3513, 3513, 3513, 3513, 3513, 3513, 3513,
-        3513, 3513, 3513, 3513, 3513, 3513, 3513, 3514, 3514, 3514, 3514, 3514, 3514, 3514, 3514, 3514, 3514, 3514, 3514, 3514, 3514, 3514, 3514, 3514, 3514, 3514,
-        3514, 3514, 3514, 3514, 3514, 3514, 3514, 3514, 3514, 3514, 3514, 3514, 3514, 3514, 3515, 3515, 3515, 3515, 3515, 3515, 3515, 3515, 3515, 3515, 3515, 3515,
-        3515, 3515, 3515, 3515, 3515, 3515, 3515, 3515, 3515, 3515, 3515, 3515, 3515, 3515, 3515, 3515, 3515, 3515, 3515, 3515, 3515, 3516, 3516, 3516, 3516, 3516,
-        3516, 3516, 3516, 3516, 3516, 3516, 3516, 3516, 3516, 3516, 3516, 3516, 3516, 3516, 3516, 3516, 3516, 3516, 3516, 3516, 3516, 3516, 3516, 3516, 3516, 3516,
-        3516, 3517, 3517, 3517, 3517, 3517, 3517, 3517, 3517, 3517, 3517, 3517, 3517, 3517, 3517, 3517, 3517, 3517, 3517, 3517, 3517, 3517, 3517, 3517, 3517, 3517,
-        3517, 3517, 3517, 3517, 3517, 3517, 3517, 3517, 3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518,
-        3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518, 3519, 3519, 3519, 3519, 3519, 3519, 3519, 3519, 3519, 3519, 3519, 3519,
-        3519, 3519, 3519, 3519, 3519, 3519, 3519, 3519, 3519, 3519, 3519, 3519, 3519, 3519, 3519, 3519, 3519, 3519, 3519, 3519, 3519, 3520, 3520, 3520, 3520, 3520,
-        3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520,
-        3520, 3520, 3521, 3521, 3521, 3521, 3521, 3521, 3521, 3521, 3521, 3521, 3521, 3521, 3521, 3521, 3521, 3521, 3521, 3521, 3521, 3521, 3521, 3521, 3521, 3521,
-        3521, 3521, 3521, 3521, 3521, 3521, 3521, 3521, 3522, 3522, 3522, 3522, 3522, 3522, 3522, 3522, 3522, 3522, 3522, 3522, 3522, 3522, 3522, 3522, 3522, 3522,
-        3522, 3522, 3522, 3522, 3522, 3522, 3522, 3522, 3522, 3522, 3522, 3522, 3522, 3522, 3522, 3523, 3523, 3523, 3523, 3523, 3523, 3523, 3523, 3523, 3523, 3523,
-        3523, 3523, 3523, 3523, 3523, 3523, 3523, 3523, 3523, 3523, 3523, 3523, 3523, 3523, 3523, 3523, 3523, 3523, 3523, 3523, 3523, 3523, 3524, 3524, 3524, 3524,
-        3524, 3524, 3524, 3524, 3524, 3524, 3524, 3524, 3524, 3524, 3524, 3524, 3524, 3524, 3524, 3524, 3524, 3524, 3524, 3524, 3524, 3524, 3524, 3524, 3524, 3524,
-        3524, 3524, 3524, 3525, 3525, 3525, 3525, 3525, 3525, 3525, 3525, 3525, 3525, 3525, 3525, 3525, 3525, 3525, 3525, 3525, 3525, 3525, 3525, 3525, 3525, 3525,
-        3525, 3525, 3525, 3525, 3525, 3525, 3525, 3525, 3525, 3526, 3526, 3526, 3526, 3526, 3526, 3526, 3526, 3526, 3526, 3526, 3526, 3526, 3526, 3526, 3526, 3526,
-        3526, 3526, 3526, 3526, 3526, 3526, 3526, 3526, 3526, 3526, 3526, 3526, 3526, 3526, 3526, 3526, 3527, 3527, 3527, 3527, 3527, 3527, 3527, 3527, 3527, 3527,
-        3527, 3527, 3527, 3527, 3527, 3527, 3527, 3527, 3527, 3527, 3527, 3527, 3527, 3527, 3527, 3527, 3527, 3527, 3527, 3527, 3527, 3527, 3527, 3528, 3528, 3528,
-        3528, 3528, 3528, 3528, 3528, 3528, 3528, 3528, 3528, 3528, 3528, 3528, 3528, 3528, 3528, 3528, 3528, 3528, 3528, 3528, 3528, 3528, 3528, 3528, 3528, 3528,
-        3528, 3528, 3528, 3528, 3529, 3529, 3529, 3529, 3529, 3529, 3529, 3529, 3529, 3529, 3529, 3529, 3529, 3529, 3529, 3529, 3529, 3529, 3529, 3529, 3529, 3529,
-        3529, 3529, 3529, 3529, 3529, 3529, 3529, 3529, 3529, 3529, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530,
-        3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3531, 3531, 3531, 3531, 3531, 3531, 3531, 3531, 3531,
-        3531, 3531, 3531, 3531, 3531, 3531, 3531, 3531, 3531, 3531, 3531, 3531, 3531, 3531, 3531, 3531, 3531, 3531, 3531, 3531, 3531, 3531, 3531, 3531, 3532, 3532,
-        3532, 3532, 3532, 3532, 3532, 3532, 3532, 3532, 3532, 3532, 3532, 3532, 3532, 3532, 3532, 3532, 3532, 3532, 3532, 3532, 3532, 3532, 3532, 3532, 3532, 3532,
-        3532, 3532, 3532, 3532, 3532, 3533, 3533, 3533, 3533, 3533, 3533, 3533, 3533, 3533, 3533, 3533, 3533, 3533, 3533, 3533, 3533, 3533, 3533, 3533, 3533, 3533,
-        3533, 3533, 3533, 3533, 3533, 3533, 3533, 3533, 3533, 3533, 3533, 3533, 3534, 3534, 3534, 3534, 3534, 3534, 3534, 3534, 3534, 3534, 3534, 3534, 3534, 3534,
-        3534, 3534, 3534, 3534, 3534, 3534, 3534, 3534, 3534, 3534, 3534, 3534, 3534, 3534, 3534, 3534, 3534, 3534, 3534, 3535, 3535, 3535, 3535, 3535, 3535, 3535,
-        3535, 3535, 3535, 3535, 3535, 3535, 3535, 3535, 3535, 3535, 3535, 3535, 3535, 3535, 3535, 3535, 3535, 3535, 3535, 3535, 3535, 3535, 3535, 3535, 3535, 3535,
-        3536, 3536, 3536, 3536, 3536, 3536, 3536, 3536, 3536, 3536, 3536, 3536, 3536, 3536, 3536, 3536, 3536, 3536, 3536, 3536, 3536, 3536, 3536, 3536, 3536, 3536,
-        3536, 3536, 3536, 3536, 3536, 3536, 3537, 3537, 3537, 3537, 3537, 3537, 3537, 3537, 3537, 3537, 3537, 3537, 3537, 3537, 3537, 3537, 3537, 3537, 3537, 3537,
-        3537, 3537, 3537, 3537, 3537, 3537, 3537, 3537, 3537, 3537, 3537, 3537, 3537, 3538, 3538, 3538, 3538, 3538, 3538, 3538, 3538, 3538, 3538, 3538, 3538, 3538,
-        3538, 3538, 3538, 3538, 3538, 3538, 3538, 3538, 3538, 3538, 3538, 3538, 3538, 3538, 3538, 3538, 3538, 3538, 3538, 3538, 3539, 3539, 3539, 3539, 3539, 3539,
-        3539, 3539, 3539, 3539, 3539, 3539, 3539, 3539, 3539, 3539, 3539, 3539, 3539, 3539, 3539, 3539, 3539, 3539, 3539, 3539, 3539, 3539, 3539, 3539, 3539, 3539,
-        3539, 3540, 3540, 3540, 3540, 3540, 3540, 3540, 3540, 3540, 3540, 3540, 3540, 3540, 3540, 3540, 3540, 3540, 3540, 3540, 3540, 3540, 3540, 3540, 3540, 3540,
-        3540, 3540, 3540, 3540, 3540, 3540, 3540, 3540, 3541, 3541, 3541, 3541, 3541, 3541, 3541, 3541, 3541, 3541, 3541, 3541, 3541, 3541, 3541, 3541, 3541, 3541,
-        3541, 3541, 3541, 3541, 3541, 3541, 3541, 3541, 3541, 3541, 3541, 3541, 3541, 3541, 3541, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542,
-        3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3543, 3543, 3543, 3543,
-        3543, 3543, 3543, 3543, 3543, 3543, 3543, 3543, 3543, 3543, 3543, 3543, 3543, 3543, 3543, 3543, 3543, 3543, 3543, 3543, 3543, 3543, 3543, 3543, 3543, 3543,
-        3543, 3543, 3543, 3544, 3544, 3544, 3544, 3544, 3544, 3544, 3544, 3544, 3544, 3544, 3544, 3544, 3544, 3544, 3544, 3544, 3544, 3544, 3544, 3544, 3544, 3544,
-        3544, 3544, 3544, 3544, 3544, 3544, 3544, 3544, 3544, 3544, 3545, 3545, 3545, 3545, 3545, 3545, 3545, 3545, 3545, 3545, 3545, 3545, 3545, 3545, 3545, 3545,
-        3545, 3545, 3545, 3545, 3545, 3545, 3545, 3545, 3545, 3545, 3545, 3545, 3545, 3545, 3545, 3545, 3545, 3546, 3546, 3546, 3546, 3546, 3546, 3546, 3546, 3546,
-        3546, 3546, 3546, 3546, 3546, 3546, 3546, 3546, 3546, 3546, 3546, 3546, 3546, 3546, 3546, 3546, 3546, 3546, 3546, 3546, 3546, 3546, 3546, 3546, 3547, 3547,
-        3547, 3547, 3547, 3547, 3547, 3547, 3547, 3547, 3547, 3547, 3547, 3547, 3547, 3547, 3547, 3547, 3547, 3547, 3547, 3547, 3547, 3547, 3547, 3547, 3547, 3547,
-        3547, 3547, 3547, 3547, 3547, 3548, 3548, 3548, 3548, 3548, 3548, 3548, 3548, 3548, 3548, 3548, 3548, 3548, 3548, 3548, 3548, 3548, 3548, 3548, 3548, 3548,
-        3548, 3548, 3548, 3548, 3548, 3548, 3548, 3548, 3548, 3548, 3548, 3548, 3548, 3549, 3549, 3549, 3549, 3549, 3549, 3549, 3549, 3549, 3549, 3549, 3549, 3549,
-        3549, 3549, 3549, 3549, 3549, 3549, 3549, 3549, 3549, 3549, 3549, 3549, 3549, 3549, 3549, 3549, 3549, 3549, 3549, 3549, 3550, 3550, 3550, 3550, 3550, 3550,
-        3550, 3550, 3550, 3550, 3550, 3550, 3550, 3550, 3550, 3550, 3550, 3550, 3550, 3550, 3550, 3550, 3550, 3550, 3550, 3550, 3550, 3550, 3550, 3550, 3550, 3550,
-        3550, 3551, 3551, 3551, 3551, 3551, 3551, 3551, 3551, 3551, 3551, 3551, 3551, 3551, 3551, 3551, 3551, 3551, 3551, 3551, 3551, 3551, 3551, 3551, 3551, 3551,
-        3551, 3551, 3551, 3551, 3551, 3551, 3551, 3551, 3552, 3552, 3552, 3552, 3552, 3552, 3552, 3552, 3552, 3552, 3552, 3552, 3552, 3552, 3552, 3552, 3552, 3552,
-        3552, 3552, 3552, 3552, 3552, 3552, 3552, 3552, 3552, 3552, 3552, 3552, 3552, 3552, 3552, 3553, 3553, 3553, 3553, 3553, 3553, 3553, 3553, 3553, 3553, 3553,
-        3553, 3553, 3553, 3553, 3553, 3553, 3553, 3553, 3553, 3553, 3553, 3553, 3553, 3553, 3553, 3553, 3553, 3553, 3553, 3553, 3553, 3553, 3554, 3554, 3554, 3554,
-        3554, 3554, 3554, 3554, 3554, 3554, 3554, 3554, 3554, 3554, 3554, 3554, 3554, 3554, 3554, 3554, 3554, 3554, 3554, 3554, 3554, 3554, 3554, 3554, 3554, 3554,
-        3554, 3554, 3554, 3555, 3555, 3555, 3555, 3555, 3555, 3555, 3555, 3555, 3555, 3555, 3555, 3555, 3555, 3555, 3555, 3555, 3555, 3555, 3555, 3555, 3555, 3555,
-        3555, 3555, 3555, 3555, 3555, 3555, 3555, 3555, 3555, 3555, 3555, 3556, 3556, 3556, 3556, 3556, 3556, 3556, 3556, 3556, 3556, 3556, 3556, 3556, 3556, 3556,
-        3556, 3556, 3556, 3556, 3556, 3556, 3556, 3556, 3556, 3556, 3556, 3556, 3556, 3556, 3556, 3556, 3556, 3556, 3557, 3557, 3557, 3557, 3557, 3557, 3557, 3557,
-        3557, 3557, 3557, 3557, 3557, 3557, 3557, 3557, 3557, 3557, 3557, 3557, 3557, 3557, 3557, 3557, 3557, 3557, 3557, 3557, 3557, 3557, 3557, 3557, 3557, 3558,
-        3558, 3558, 3558, 3558, 3558, 3558, 3558, 3558, 3558, 3558, 3558, 3558, 3558, 3558, 3558, 3558, 3558, 3558, 3558, 3558, 3558, 3558, 3558, 3558, 3558, 3558,
-        3558, 3558, 3558, 3558, 3558, 3558, 3559, 3559, 3559, 3559, 3559, 3559, 3559, 3559, 3559, 3559, 3559, 3559, 3559, 3559, 3559, 3559, 3559, 3559, 3559, 3559,
-        3559, 3559, 3559, 3559, 3559, 3559, 3559, 3559, 3559, 3559, 3559, 3559, 3559, 3560, 3560, 3560, 3560, 3560, 3560, 3560, 3560, 3560, 3560, 3560, 3560, 3560,
-        3560, 3560, 3560, 3560, 3560, 3560, 3560, 3560, 3560, 3560, 3560, 3560, 3560, 3560, 3560, 3560, 3560, 3560, 3560, 3560, 3560, 3561, 3561, 3561, 3561, 3561,
-        3561, 3561, 3561, 3561, 3561, 3561, 3561, 3561, 3561, 3561, 3561, 3561, 3561, 3561, 3561, 3561, 3561, 3561, 3561, 3561, 3561, 3561, 3561, 3561, 3561, 3561,
-        3561, 3561, 3562, 3562, 3562, 3562, 3562, 3562, 3562, 3562, 3562, 3562, 3562, 3562, 3562, 3562, 3562, 3562, 3562, 3562, 3562, 3562, 3562, 3562, 3562, 3562,
-        3562, 3562, 3562, 3562, 3562, 3562, 3562, 3562, 3562, 3563, 3563, 3563, 3563, 3563, 3563, 3563, 3563, 3563, 3563, 3563, 3563, 3563, 3563, 3563, 3563, 3563,
-        3563, 3563, 3563, 3563, 3563, 3563, 3563, 3563, 3563, 3563, 3563, 3563, 3563, 3563, 3563, 3563, 3563, 3564, 3564, 3564, 3564, 3564, 3564, 3564, 3564, 3564,
-        3564, 3564, 3564, 3564, 3564, 3564, 3564, 3564, 3564, 3564, 3564, 3564, 3564, 3564, 3564, 3564, 3564, 3564, 3564, 3564, 3564, 3564, 3564, 3564, 3565, 3565,
-        3565, 3565, 3565, 3565, 3565, 3565, 3565, 3565, 3565, 3565, 3565, 3565, 3565, 3565, 3565, 3565, 3565, 3565, 3565, 3565, 3565, 3565, 3565, 3565, 3565, 3565,
-        3565, 3565, 3565, 3565, 3565, 3566, 3566, 3566, 3566, 3566, 3566, 3566, 3566, 3566, 3566, 3566, 3566, 3566, 3566, 3566, 3566, 3566, 3566, 3566, 3566, 3566,
-        3566, 3566, 3566, 3566, 3566, 3566, 3566, 3566, 3566, 3566, 3566, 3566, 3566, 3567, 3567, 3567, 3567, 3567, 3567, 3567, 3567, 3567, 3567, 3567, 3567, 3567,
-        3567, 3567, 3567, 3567, 3567, 3567, 3567, 3567, 3567, 3567, 3567, 3567, 3567, 3567, 3567, 3567, 3567, 3567, 3567, 3567, 3568, 3568, 3568, 3568, 3568, 3568,
-        3568, 3568, 3568, 3568, 3568, 3568, 3568, 3568, 3568, 3568, 3568, 3568, 3568, 3568, 3568, 3568, 3568, 3568, 3568, 3568, 3568, 3568, 3568, 3568, 3568, 3568,
-        3568, 3569, 3569, 3569, 3569, 3569, 3569, 3569, 3569, 3569, 3569, 3569, 3569, 3569, 3569, 3569, 3569, 3569, 3569, 3569, 3569, 3569, 3569, 3569, 3569, 3569,
-        3569, 3569, 3569, 3569, 3569, 3569, 3569, 3569, 3569, 3570, 3570, 3570, 3570, 3570, 3570, 3570, 3570, 3570, 3570, 3570, 3570, 3570, 3570, 3570, 3570, 3570,
-        3570, 3570, 3570, 3570, 3570, 3570, 3570, 3570, 3570, 3570, 3570, 3570, 3570, 3570, 3570, 3570, 3571, 3571, 3571, 3571, 3571, 3571, 3571, 3571, 3571, 3571,
-        3571, 3571, 3571, 3571, 3571, 3571, 3571, 3571, 3571, 3571, 3571, 3571, 3571, 3571, 3571, 3571, 3571, 3571, 3571, 3571, 3571, 3571, 3571, 3571, 3572, 3572,
-        3572, 3572, 3572, 3572, 3572, 3572, 3572, 3572, 3572, 3572, 3572, 3572, 3572, 3572, 3572, 3572, 3572, 3572, 3572, 3572, 3572, 3572, 3572, 3572, 3572, 3572,
-        3572, 3572, 3572, 3572, 3572, 3573, 3573, 3573, 3573, 3573, 3573, 3573, 3573, 3573, 3573, 3573, 3573, 3573, 3573, 3573, 3573, 3573, 3573, 3573, 3573, 3573,
-        3573, 3573, 3573, 3573, 3573, 3573, 3573, 3573, 3573, 3573, 3573, 3573, 3573, 3574, 3574, 3574, 3574, 3574, 3574, 3574, 3574, 3574, 3574, 3574, 3574, 3574,
-        3574, 3574, 3574, 3574, 3574, 3574, 3574, 3574, 3574, 3574, 3574, 3574, 3574, 3574, 3574, 3574, 3574, 3574, 3574, 3574, 3575, 3575, 3575, 3575, 3575, 3575,
-        3575, 3575, 3575, 3575, 3575, 3575, 3575, 3575, 3575, 3575, 3575, 3575, 3575, 3575, 3575, 3575, 3575, 3575, 3575, 3575, 3575, 3575, 3575, 3575, 3575, 3575,
-        3575, 3575, 3576, 3576, 3576, 3576, 3576, 3576, 3576, 3576, 3576, 3576, 3576, 3576, 3576, 3576, 3576, 3576, 3576, 3576, 3576, 3576, 3576, 3576, 3576, 3576,
-        3576, 3576, 3576, 3576, 3576, 3576, 3576, 3576, 3576, 3577, 3577, 3577, 3577, 3577, 3577, 3577, 3577, 3577, 3577, 3577, 3577, 3577, 3577, 3577, 3577, 3577,
-        3577, 3577, 3577, 3577, 3577, 3577, 3577, 3577, 3577, 3577, 3577, 3577, 3577, 3577, 3577, 3577, 3577, 3578, 3578, 3578, 3578, 3578, 3578, 3578, 3578, 3578,
-        3578, 3578, 3578, 3578, 3578, 3578, 3578, 3578, 3578, 3578, 3578, 3578, 3578, 3578, 3578, 3578, 3578, 3578, 3578, 3578, 3578, 3578, 3578, 3578, 3579, 3579,
-        3579, 3579, 3579, 3579, 3579, 3579, 3579, 3579, 3579, 3579, 3579, 3579, 3579, 3579, 3579, 3579, 3579, 3579, 3579, 3579, 3579, 3579, 3579, 3579, 3579, 3579,
-        3579, 3579, 3579, 3579, 3579, 3579, 3580, 3580, 3580, 3580, 3580, 3580, 3580, 3580, 3580, 3580, 3580, 3580, 3580, 3580, 3580, 3580, 3580, 3580, 3580, 3580,
-        3580, 3580, 3580, 3580, 3580, 3580, 3580, 3580, 3580, 3580, 3580, 3580, 3580, 3581, 3581, 3581, 3581, 3581, 3581, 3581, 3581, 3581, 3581, 3581, 3581, 3581,
-        3581, 3581, 3581, 3581, 3581, 3581, 3581, 3581, 3581, 3581, 3581, 3581, 3581, 3581, 3581, 3581, 3581, 3581, 3581, 3581, 3581, 3582, 3582, 3582, 3582, 3582,
-        3582, 3582, 3582, 3582, 3582, 3582, 3582, 3582, 3582, 3582, 3582, 3582, 3582, 3582, 3582, 3582, 3582, 3582, 3582, 3582, 3582, 3582, 3582, 3582, 3582, 3582,
-        3582, 3582, 3583, 3583, 3583, 3583, 3583, 3583, 3583, 3583, 3583, 3583, 3583, 3583, 3583, 3583, 3583, 3583, 3583, 3583, 3583, 3583, 3583, 3583, 3583, 3583,
-        3583, 3583, 3583, 3583, 3583, 3583, 3583, 3583, 3583, 3583, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
-        3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3585, 3585, 3585, 3585, 3585, 3585, 3585, 3585,
-        3585, 3585, 3585, 3585, 3585, 3585, 3585, 3585, 3585, 3585, 3585, 3585, 3585, 3585, 3585, 3585, 3585, 3585, 3585, 3585, 3585, 3585, 3585, 3585, 3585, 3586,
-        3586, 3586, 3586, 3586, 3586, 3586, 3586, 3586, 3586, 3586, 3586, 3586, 3586, 3586, 3586, 3586, 3586, 3586, 3586, 3586, 3586, 3586, 3586, 3586, 3586, 3586,
-        3586, 3586, 3586, 3586, 3586, 3586, 3586, 3587, 3587, 3587, 3587, 3587, 3587, 3587, 3587, 3587, 3587, 3587, 3587, 3587, 3587, 3587, 3587, 3587, 3587, 3587,
-        3587, 3587, 3587, 3587, 3587, 3587, 3587, 3587, 3587, 3587, 3587, 3587, 3587, 3587, 3587, 3588, 3588, 3588, 3588, 3588, 3588, 3588, 3588, 3588, 3588, 3588,
-        3588, 3588, 3588, 3588, 3588, 3588, 3588, 3588, 3588, 3588, 3588, 3588, 3588, 3588, 3588, 3588, 3588, 3588, 3588, 3588, 3588, 3588, 3589, 3589, 3589, 3589,
-        3589, 3589, 3589, 3589, 3589, 3589, 3589, 3589, 3589, 3589, 3589, 3589, 3589, 3589, 3589, 3589, 3589, 3589, 3589, 3589, 3589, 3589, 3589, 3589, 3589, 3589,
-        3589, 3589, 3589, 3589, 3590, 3590, 3590, 3590, 3590, 3590, 3590, 3590, 3590, 3590, 3590, 3590, 3590, 3590, 3590, 3590, 3590, 3590, 3590, 3590, 3590, 3590,
-        3590, 3590, 3590, 3590, 3590, 3590, 3590, 3590, 3590, 3590, 3590, 3590, 3591, 3591, 3591, 3591, 3591, 3591, 3591, 3591, 3591, 3591, 3591, 3591, 3591, 3591,
-        3591, 3591, 3591, 3591, 3591, 3591, 3591, 3591, 3591, 3591, 3591, 3591, 3591, 3591, 3591, 3591, 3591, 3591, 3591, 3592, 3592, 3592, 3592, 3592, 3592, 3592,
-        3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592, 3592,
-        3592, 3593, 3593, 3593, 3593, 3593, 3593, 3593, 3593, 3593, 3593, 3593, 3593, 3593, 3593, 3593, 3593, 3593, 3593, 3593, 3593, 3593, 3593, 3593, 3593, 3593,
-        3593, 3593, 3593, 3593, 3593, 3593, 3593, 3593, 3593, 3594, 3594, 3594, 3594, 3594, 3594, 3594, 3594, 3594, 3594, 3594, 3594, 3594, 3594, 3594, 3594, 3594,
-        3594, 3594, 3594, 3594, 3594, 3594, 3594, 3594, 3594, 3594, 3594, 3594, 3594, 3594, 3594, 3594, 3594, 3595, 3595, 3595, 3595, 3595, 3595, 3595, 3595, 3595,
-        3595, 3595, 3595, 3595, 3595, 3595, 3595, 3595, 3595, 3595, 3595, 3595, 3595, 3595, 3595, 3595, 3595, 3595, 3595, 3595, 3595, 3595, 3595, 3595, 3596, 3596,
-        3596, 3596, 3596, 3596, 3596, 3596, 3596, 3596, 3596, 3596, 3596, 3596, 3596, 3596, 3596, 3596, 3596, 3596, 3596, 3596, 3596, 3596, 3596, 3596, 3596, 3596,
-        3596, 3596, 3596, 3596, 3596, 3596, 3597, 3597, 3597, 3597, 3597, 3597, 3597, 3597, 3597, 3597, 3597, 3597, 3597, 3597, 3597, 3597, 3597, 3597, 3597, 3597,
-        3597, 3597, 3597, 3597, 3597, 3597, 3597, 3597, 3597, 3597, 3597, 3597, 3597, 3597, 3598, 3598, 3598, 3598, 3598, 3598, 3598, 3598, 3598, 3598, 3598, 3598,
-        3598, 3598, 3598, 3598, 3598, 3598, 3598, 3598, 3598, 3598, 3598, 3598, 3598, 3598, 3598, 3598, 3598, 3598, 3598, 3598, 3598, 3598, 3599, 3599, 3599, 3599,
-        3599, 3599, 3599, 3599, 3599, 3599, 3599, 3599, 3599, 3599, 3599, 3599, 3599, 3599, 3599, 3599, 3599, 3599, 3599, 3599, 3599, 3599, 3599, 3599, 3599, 3599,
-        3599, 3599, 3599, 3599, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600,
-        3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3600, 3601, 3601, 3601, 3601, 3601, 3601, 3601, 3601, 3601, 3601, 3601, 3601, 3601, 3601,
-        3601, 3601, 3601, 3601, 3601, 3601, 3601, 3601, 3601, 3601, 3601, 3601, 3601, 3601, 3601, 3601, 3601, 3601, 3601, 3601, 3602, 3602, 3602, 3602, 3602, 3602,
-        3602, 3602, 3602, 3602, 3602, 3602, 3602, 3602, 3602, 3602, 3602, 3602, 3602, 3602, 3602, 3602, 3602, 3602, 3602, 3602, 3602, 3602, 3602, 3602, 3602, 3602,
-        3602, 3603, 3603, 3603, 3603, 3603, 3603, 3603, 3603, 3603, 3603, 3603, 3603, 3603, 3603, 3603, 3603, 3603, 3603, 3603, 3603, 3603, 3603, 3603, 3603, 3603,
-        3603, 3603, 3603, 3603, 3603, 3603, 3603, 3603, 3603, 3604, 3604, 3604, 3604, 3604, 3604, 3604, 3604, 3604, 3604, 3604, 3604, 3604, 3604, 3604, 3604, 3604,
-        3604, 3604, 3604, 3604, 3604, 3604, 3604, 3604, 3604, 3604, 3604, 3604, 3604, 3604, 3604, 3604, 3604, 3605, 3605, 3605, 3605, 3605, 3605, 3605, 3605, 3605,
-        3605, 3605, 3605, 3605, 3605, 3605, 3605, 3605, 3605, 3605, 3605, 3605, 3605, 3605, 3605, 3605, 3605, 3605, 3605, 3605, 3605, 3605, 3605, 3605, 3605, 3606,
-        3606, 3606, 3606, 3606, 3606, 3606, 3606, 3606, 3606, 3606, 3606, 3606, 3606, 3606, 3606, 3606, 3606, 3606, 3606, 3606, 3606, 3606, 3606, 3606, 3606, 3606,
-        3606, 3606, 3606, 3606, 3606, 3606, 3606, 3607, 3607, 3607, 3607, 3607, 3607, 3607, 3607, 3607, 3607, 3607, 3607, 3607, 3607, 3607, 3607, 3607, 3607, 3607,
-        3607, 3607, 3607, 3607, 3607, 3607, 3607, 3607, 3607, 3607, 3607, 3607, 3607, 3607, 3607, 3608, 3608, 3608, 3608, 3608, 3608, 3608, 3608, 3608, 3608, 3608,
-        3608, 3608, 3608, 3608, 3608, 3608, 3608, 3608, 3608, 3608, 3608, 3608, 3608, 3608, 3608, 3608, 3608, 3608, 3608, 3608, 3608, 3608, 3608, 3609, 3609, 3609,
-        3609, 3609, 3609, 3609, 3609, 3609, 3609, 3609, 3609, 3609, 3609, 3609, 3609, 3609, 3609, 3609, 3609, 3609, 3609, 3609, 3609, 3609, 3609, 3609, 3609, 3609,
-        3609, 3609, 3609, 3609, 3609, 3610, 3610, 3610, 3610, 3610, 3610, 3610, 3610, 3610, 3610, 3610, 3610, 3610, 3610, 3610, 3610, 3610, 3610, 3610, 3610, 3610,
-        3610, 3610, 3610, 3610, 3610, 3610, 3610, 3610, 3610, 3610, 3610, 3610, 3610, 3611, 3611, 3611, 3611, 3611, 3611, 3611, 3611, 3611, 3611, 3611, 3611, 3611,
-        3611, 3611, 3611, 3611, 3611, 3611, 3611, 3611, 3611, 3611, 3611, 3611, 3611, 3611, 3611, 3611, 3611, 3611, 3611, 3611, 3611, 3612, 3612, 3612, 3612, 3612,
-        3612, 3612, 3612, 3612, 3612, 3612, 3612, 3612, 3612, 3612, 3612, 3612, 3612, 3612, 3612, 3612, 3612, 3612, 3612, 3612, 3612, 3612, 3612, 3612, 3612, 3612,
-        3612, 3612, 3612, 3613, 3613, 3613, 3613, 3613, 3613, 3613, 3613, 3613, 3613, 3613, 3613, 3613, 3613, 3613, 3613, 3613, 3613, 3613, 3613, 3613, 3613, 3613,
-        3613, 3613, 3613, 3613, 3613, 3613, 3613, 3613, 3613, 3613, 3613, 3614, 3614, 3614, 3614, 3614, 3614, 3614, 3614, 3614, 3614, 3614, 3614, 3614, 3614, 3614,
-        3614, 3614, 3614, 3614, 3614, 3614, 3614, 3614, 3614, 3614, 3614, 3614, 3614, 3614, 3614, 3614, 3614, 3614, 3614, 3615, 3615, 3615, 3615, 3615, 3615, 3615,
-        3615, 3615, 3615, 3615, 3615, 3615, 3615, 3615, 3615, 3615, 3615, 3615, 3615, 3615, 3615, 3615, 3615, 3615, 3615, 3615, 3615, 3615, 3615, 3615, 3615, 3615,
-        3615, 3616, 3616, 3616, 3616, 3616, 3616, 3616, 3616, 3616, 3616, 3616, 3616, 3616, 3616, 3616, 3616, 3616, 3616, 3616, 3616, 3616, 3616, 3616, 3616, 3616,
-        3616, 3616, 3616, 3616, 3616, 3616, 3616, 3616, 3616, 3616, 3617, 3617, 3617, 3617, 3617, 3617, 3617, 3617, 3617, 3617, 3617, 3617, 3617, 3617, 3617, 3617,
-        3617, 3617, 3617, 3617, 3617, 3617, 3617, 3617, 3617, 3617, 3617, 3617, 3617, 3617, 3617, 3617, 3617, 3617, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618,
-        3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618,
-        3619, 3619, 3619, 3619, 3619, 3619, 3619, 3619, 3619, 3619, 3619, 3619, 3619, 3619, 3619, 3619, 3619, 3619, 3619, 3619, 3619, 3619, 3619, 3619, 3619, 3619,
-        3619, 3619, 3619, 3619, 3619, 3619, 3619, 3619, 3620, 3620, 3620, 3620, 3620, 3620, 3620, 3620, 3620, 3620, 3620, 3620, 3620, 3620, 3620, 3620, 3620, 3620,
-        3620, 3620, 3620, 3620, 3620, 3620, 3620, 3620, 3620, 3620, 3620, 3620, 3620, 3620, 3620, 3620, 3621, 3621, 3621, 3621, 3621, 3621, 3621, 3621, 3621, 3621,
-        3621, 3621, 3621, 3621, 3621, 3621, 3621, 3621, 3621, 3621, 3621, 3621, 3621, 3621, 3621, 3621, 3621, 3621, 3621, 3621, 3621, 3621, 3621, 3621, 3622, 3622,
-        3622, 3622, 3622, 3622, 3622, 3622, 3622, 3622, 3622, 3622, 3622, 3622, 3622, 3622, 3622, 3622, 3622, 3622, 3622, 3622, 3622, 3622, 3622, 3622, 3622, 3622,
-        3622, 3622, 3622, 3622, 3622, 3622, 3622, 3623, 3623, 3623, 3623, 3623, 3623, 3623, 3623, 3623, 3623, 3623, 3623, 3623, 3623, 3623, 3623, 3623, 3623, 3623,
-        3623, 3623, 3623, 3623, 3623, 3623, 3623, 3623, 3623, 3623, 3623, 3623, 3623, 3623, 3623, 3624, 3624, 3624, 3624, 3624, 3624, 3624, 3624, 3624, 3624, 3624,
-        3624, 3624, 3624, 3624, 3624, 3624, 3624, 3624, 3624, 3624, 3624, 3624, 3624, 3624, 3624, 3624, 3624, 3624, 3624, 3624, 3624, 3624, 3624, 3625, 3625, 3625,
-        3625, 3625, 3625, 3625, 3625, 3625, 3625, 3625, 3625, 3625, 3625, 3625, 3625, 3625, 3625, 3625, 3625, 3625, 3625, 3625, 3625, 3625, 3625, 3625, 3625, 3625,
-        3625, 3625, 3625, 3625, 3625, 3626, 3626, 3626, 3626, 3626, 3626, 3626, 3626, 3626, 3626, 3626, 3626, 3626, 3626, 3626, 3626, 3626, 3626, 3626, 3626, 3626,
-        3626, 3626, 3626, 3626, 3626, 3626, 3626, 3626, 3626, 3626, 3626, 3626, 3626, 3627, 3627, 3627, 3627, 3627, 3627, 3627, 3627, 3627, 3627, 3627, 3627, 3627,
-        3627, 3627, 3627, 3627, 3627, 3627, 3627, 3627, 3627, 3627, 3627, 3627, 3627, 3627, 3627, 3627, 3627, 3627, 3627, 3627, 3627, 3627, 3628, 3628, 3628, 3628,
-        3628, 3628, 3628, 3628, 3628, 3628, 3628, 3628, 3628, 3628, 3628, 3628, 3628, 3628, 3628, 3628, 3628, 3628, 3628, 3628, 3628, 3628, 3628, 3628, 3628, 3628,
-        3628, 3628, 3628, 3628, 3629, 3629, 3629, 3629, 3629, 3629, 3629, 3629, 3629, 3629, 3629, 3629, 3629, 3629, 3629, 3629, 3629, 3629, 3629, 3629, 3629, 3629,
-        3629, 3629, 3629, 3629, 3629, 3629, 3629, 3629, 3629, 3629, 3629, 3629, 3630, 3630, 3630, 3630, 3630, 3630, 3630, 3630, 3630, 3630, 3630, 3630, 3630, 3630,
-        3630, 3630, 3630, 3630, 3630, 3630, 3630, 3630, 3630, 3630, 3630, 3630, 3630, 3630, 3630, 3630, 3630, 3630, 3630, 3630, 3630, 3631, 3631, 3631, 3631, 3631,
-        3631, 3631, 3631, 3631, 3631, 3631, 3631, 3631, 3631, 3631, 3631, 3631, 3631, 3631, 3631, 3631, 3631, 3631, 3631, 3631, 3631, 3631, 3631, 3631, 3631, 3631,
-        3631, 3631, 3631, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632,
-        3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3633, 3633, 3633, 3633, 3633, 3633, 3633, 3633, 3633, 3633, 3633, 3633, 3633, 3633, 3633,
-        3633, 3633, 3633, 3633, 3633, 3633, 3633, 3633, 3633, 3633, 3633, 3633, 3633, 3633, 3633, 3633, 3633, 3633, 3633, 3633, 3634, 3634, 3634, 3634, 3634, 3634,
-        3634, 3634, 3634, 3634, 3634, 3634, 3634, 3634, 3634, 3634, 3634, 3634, 3634, 3634, 3634, 3634, 3634, 3634, 3634, 3634, 3634, 3634, 3634, 3634, 3634, 3634,
-        3634, 3634, 3635, 3635, 3635, 3635, 3635, 3635, 3635, 3635, 3635, 3635, 3635, 3635, 3635, 3635, 3635, 3635, 3635, 3635, 3635, 3635, 3635, 3635, 3635, 3635,
-        3635, 3635, 3635, 3635, 3635, 3635, 3635, 3635, 3635, 3635, 3636, 3636, 3636, 3636, 3636, 3636, 3636, 3636, 3636, 3636, 3636, 3636, 3636, 3636, 3636, 3636,
-        3636, 3636, 3636, 3636, 3636, 3636, 3636, 3636, 3636, 3636, 3636, 3636, 3636, 3636, 3636, 3636, 3636, 3636, 3636, 3637, 3637, 3637, 3637, 3637, 3637, 3637,
-        3637, 3637, 3637, 3637, 3637, 3637, 3637, 3637, 3637, 3637, 3637, 3637, 3637, 3637, 3637, 3637, 3637, 3637, 3637, 3637, 3637, 3637, 3637, 3637, 3637, 3637,
-        3637, 3638, 3638, 3638, 3638, 3638, 3638, 3638, 3638, 3638, 3638, 3638, 3638, 3638, 3638, 3638, 3638, 3638, 3638, 3638, 3638, 3638, 3638, 3638, 3638, 3638,
-        3638, 3638, 3638, 3638, 3638, 3638, 3638, 3638, 3638, 3638, 3639, 3639, 3639, 3639, 3639, 3639, 3639, 3639, 3639, 3639, 3639, 3639, 3639, 3639, 3639, 3639,
-        3639, 3639, 3639, 3639, 3639, 3639, 3639, 3639, 3639, 3639, 3639, 3639, 3639, 3639, 3639, 3639, 3639, 3639, 3640, 3640, 3640, 3640, 3640, 3640, 3640, 3640,
-        3640, 3640, 3640, 3640, 3640, 3640, 3640, 3640, 3640, 3640, 3640, 3640, 3640, 3640, 3640, 3640, 3640, 3640, 3640, 3640, 3640, 3640, 3640, 3640, 3640, 3640,
-        3640, 3641, 3641, 3641, 3641, 3641, 3641, 3641, 3641, 3641, 3641, 3641, 3641, 3641, 3641, 3641, 3641, 3641, 3641, 3641, 3641, 3641, 3641, 3641, 3641, 3641,
-        3641, 3641, 3641, 3641, 3641, 3641, 3641, 3641, 3641, 3642, 3642, 3642, 3642, 3642, 3642, 3642, 3642, 3642, 3642, 3642, 3642, 3642, 3642, 3642, 3642, 3642,
-        3642, 3642, 3642, 3642, 3642, 3642, 3642, 3642, 3642, 3642, 3642, 3642, 3642, 3642, 3642, 3642, 3642, 3642, 3643, 3643, 3643, 3643, 3643, 3643, 3643, 3643,
-        3643, 3643, 3643, 3643, 3643, 3643, 3643, 3643, 3643, 3643, 3643, 3643, 3643, 3643, 3643, 3643, 3643, 3643, 3643, 3643, 3643, 3643, 3643, 3643, 3643, 3643,
-        3644, 3644, 3644, 3644, 3644, 3644, 3644, 3644, 3644, 3644, 3644, 3644, 3644, 3644, 3644, 3644, 3644, 3644, 3644, 3644, 3644, 3644, 3644, 3644, 3644, 3644,
-        3644, 3644, 3644, 3644, 3644, 3644, 3644, 3644, 3644, 3645, 3645, 3645, 3645, 3645, 3645, 3645, 3645, 3645, 3645, 3645, 3645, 3645, 3645, 3645, 3645, 3645,
-        3645, 3645, 3645, 3645, 3645, 3645, 3645, 3645, 3645, 3645, 3645, 3645, 3645, 3645, 3645, 3645, 3645, 3646, 3646, 3646, 3646, 3646, 3646, 3646, 3646, 3646,
-        3646, 3646, 3646, 3646, 3646, 3646, 3646, 3646, 3646, 3646, 3646, 3646, 3646, 3646, 3646, 3646, 3646, 3646, 3646, 3646, 3646, 3646, 3646, 3646, 3646, 3646,
-        3647, 3647, 3647, 3647, 3647, 3647, 3647, 3647, 3647, 3647, 3647, 3647, 3647, 3647, 3647, 3647, 3647, 3647, 3647, 3647, 3647, 3647, 3647, 3647, 3647, 3647,
-        3647, 3647, 3647, 3647, 3647, 3647, 3647, 3647, 3648, 3648, 3648, 3648, 3648, 3648, 3648, 3648, 3648, 3648, 3648, 3648, 3648, 3648, 3648, 3648, 3648, 3648,
-        3648, 3648, 3648, 3648, 3648, 3648, 3648, 3648, 3648, 3648, 3648, 3648, 3648, 3648, 3648, 3648, 3648, 3649, 3649, 3649, 3649, 3649, 3649, 3649, 3649, 3649,
-        3649, 3649, 3649, 3649, 3649, 3649, 3649, 3649, 3649, 3649, 3649, 3649, 3649, 3649, 3649, 3649, 3649, 3649, 3649, 3649, 3649, 3649, 3649, 3649, 3649, 3649,
-        3650, 3650, 3650, 3650, 3650, 3650, 3650, 3650, 3650, 3650, 3650, 3650, 3650, 3650, 3650, 3650, 3650, 3650, 3650, 3650, 3650, 3650, 3650, 3650, 3650, 3650,
-        3650, 3650, 3650, 3650, 3650, 3650, 3650, 3650, 3651, 3651, 3651, 3651, 3651, 3651, 3651, 3651, 3651, 3651, 3651, 3651, 3651, 3651, 3651, 3651, 3651, 3651,
-        3651, 3651, 3651, 3651, 3651, 3651, 3651, 3651, 3651, 3651, 3651, 3651, 3651, 3651, 3651, 3651, 3651, 3652, 3652, 3652, 3652, 3652, 3652, 3652, 3652, 3652,
-        3652, 3652, 3652, 3652, 3652, 3652, 3652, 3652, 3652, 3652, 3652, 3652, 3652, 3652, 3652, 3652, 3652, 3652, 3652, 3652, 3652, 3652, 3652, 3652, 3652, 3652,
-        3653, 3653, 3653, 3653, 3653, 3653, 3653, 3653, 3653, 3653, 3653, 3653, 3653, 3653, 3653, 3653, 3653, 3653, 3653, 3653, 3653, 3653, 3653, 3653, 3653, 3653,
-        3653, 3653, 3653, 3653, 3653, 3653, 3653, 3653, 3654, 3654, 3654, 3654, 3654, 3654, 3654, 3654, 3654, 3654, 3654, 3654, 3654, 3654, 3654, 3654, 3654, 3654,
-        3654, 3654, 3654, 3654, 3654, 3654, 3654, 3654, 3654, 3654, 3654, 3654, 3654, 3654, 3654, 3654, 3654, 3655, 3655, 3655, 3655, 3655, 3655, 3655, 3655, 3655,
-        3655, 3655, 3655, 3655, 3655, 3655, 3655, 3655, 3655, 3655, 3655, 3655, 3655, 3655, 3655, 3655, 3655, 3655, 3655, 3655, 3655, 3655, 3655, 3655, 3655, 3655,
-        3656, 3656, 3656, 3656, 3656, 3656, 3656, 3656, 3656, 3656, 3656, 3656, 3656, 3656, 3656, 3656, 3656, 3656, 3656, 3656, 3656, 3656, 3656, 3656, 3656, 3656,
-        3656, 3656, 3656, 3656, 3656, 3656, 3656, 3656, 3657, 3657, 3657, 3657, 3657, 3657, 3657, 3657, 3657, 3657, 3657, 3657, 3657, 3657, 3657, 3657, 3657, 3657,
-        3657, 3657, 3657, 3657, 3657, 3657, 3657, 3657, 3657, 3657, 3657, 3657, 3657, 3657, 3657, 3657, 3657, 3658, 3658, 3658, 3658, 3658, 3658, 3658, 3658, 3658,
-        3658, 3658, 3658, 3658, 3658, 3658, 3658, 3658, 3658, 3658, 3658, 3658, 3658, 3658, 3658, 3658, 3658, 3658, 3658, 3658, 3658, 3658, 3658, 3658, 3658, 3658,
-        3659, 3659, 3659, 3659, 3659, 3659, 3659, 3659, 3659, 3659, 3659, 3659, 3659, 3659, 3659, 3659, 3659, 3659, 3659, 3659, 3659, 3659, 3659, 3659, 3659, 3659,
-        3659, 3659, 3659, 3659, 3659, 3659, 3659, 3659, 3659, 3660, 3660, 3660, 3660, 3660, 3660, 3660, 3660, 3660, 3660, 3660, 3660, 3660, 3660, 3660, 3660, 3660,
-        3660, 3660, 3660, 3660, 3660, 3660, 3660, 3660, 3660, 3660, 3660, 3660, 3660, 3660, 3660, 3660, 3660, 3661, 3661, 3661, 3661, 3661, 3661, 3661, 3661, 3661,
-        3661, 3661, 3661, 3661, 3661, 3661, 3661, 3661, 3661, 3661, 3661, 3661, 3661, 3661, 3661, 3661, 3661, 3661, 3661, 3661, 3661, 3661, 3661, 3661, 3661, 3661,
-        3662, 3662, 3662, 3662, 3662, 3662, 3662, 3662, 3662, 3662, 3662, 3662, 3662, 3662, 3662, 3662, 3662, 3662, 3662, 3662, 3662, 3662, 3662, 3662, 3662, 3662,
-        3662, 3662, 3662, 3662, 3662, 3662, 3662, 3662, 3662, 3663, 3663, 3663, 3663, 3663, 3663, 3663, 3663, 3663, 3663, 3663, 3663, 3663, 3663, 3663, 3663, 3663,
-        3663, 3663, 3663, 3663, 3663, 3663, 3663, 3663, 3663, 3663, 3663, 3663, 3663, 3663, 3663, 3663, 3663, 3663, 3664, 3664, 3664, 3664, 3664, 3664, 3664, 3664,
-        3664, 3664, 3664, 3664, 3664, 3664, 3664, 3664, 3664, 3664, 3664, 3664, 3664, 3664, 3664, 3664, 3664, 3664, 3664, 3664, 3664, 3664, 3664, 3664, 3664, 3664,
-        3664, 3665, 3665, 3665, 3665, 3665, 3665, 3665, 3665, 3665, 3665, 3665, 3665, 3665, 3665, 3665, 3665, 3665, 3665, 3665, 3665, 3665, 3665, 3665, 3665, 3665,
-        3665, 3665, 3665, 3665, 3665, 3665, 3665, 3665, 3665, 3666, 3666, 3666, 3666, 3666, 3666, 3666, 3666, 3666, 3666, 3666, 3666, 3666, 3666, 3666, 3666, 3666,
-        3666, 3666, 3666, 3666, 3666, 3666, 3666, 3666, 3666, 3666, 3666, 3666, 3666, 3666, 3666, 3666, 3666, 3666, 3667, 3667, 3667, 3667, 3667, 3667, 3667, 3667,
-        3667, 3667, 3667, 3667, 3667, 3667, 3667, 3667, 3667, 3667, 3667, 3667, 3667, 3667, 3667, 3667, 3667, 3667, 3667, 3667, 3667, 3667, 3667, 3667, 3667, 3667,
-        3667, 3668, 3668, 3668, 3668, 3668, 3668, 3668, 3668, 3668, 3668, 3668, 3668, 3668, 3668, 3668, 3668, 3668, 3668, 3668, 3668, 3668, 3668, 3668, 3668, 3668,
-        3668, 3668, 3668, 3668, 3668, 3668, 3668, 3668, 3668, 3668, 3669, 3669, 3669, 3669, 3669, 3669, 3669, 3669, 3669, 3669, 3669, 3669, 3669, 3669, 3669, 3669,
-        3669, 3669, 3669, 3669, 3669, 3669, 3669, 3669, 3669, 3669, 3669, 3669, 3669, 3669, 3669, 3669, 3669, 3669, 3669, 3670, 3670, 3670, 3670, 3670, 3670, 3670,
-        3670, 3670, 3670, 3670, 3670, 3670, 3670, 3670, 3670, 3670, 3670, 3670, 3670, 3670, 3670, 3670, 3670, 3670, 3670, 3670, 3670, 3670, 3670, 3670, 3670, 3670,
-        3670, 3670, 3671, 3671, 3671, 3671, 3671, 3671, 3671, 3671, 3671, 3671, 3671, 3671, 3671, 3671, 3671, 3671, 3671, 3671, 3671, 3671, 3671, 3671, 3671, 3671,
-        3671, 3671, 3671, 3671, 3671, 3671, 3671, 3671, 3671, 3671, 3671, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672,
-        3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3673, 3673, 3673, 3673, 3673, 3673,
-        3673, 3673, 3673, 3673, 3673, 3673, 3673, 3673, 3673, 3673, 3673, 3673, 3673, 3673, 3673, 3673, 3673, 3673, 3673, 3673, 3673, 3673, 3673, 3673, 3673, 3673,
-        3673, 3673, 3673, 3674, 3674, 3674, 3674, 3674, 3674, 3674, 3674, 3674, 3674, 3674, 3674, 3674, 3674, 3674, 3674, 3674, 3674, 3674, 3674, 3674, 3674, 3674,
-        3674, 3674, 3674, 3674, 3674, 3674, 3674, 3674, 3674, 3674, 3674, 3674, 3675, 3675, 3675, 3675, 3675, 3675, 3675, 3675, 3675, 3675, 3675, 3675, 3675, 3675,
-        3675, 3675, 3675, 3675, 3675, 3675, 3675, 3675, 3675, 3675, 3675, 3675, 3675, 3675, 3675, 3675, 3675, 3675, 3675, 3675, 3675, 3676, 3676, 3676, 3676, 3676,
-        3676, 3676, 3676, 3676, 3676, 3676, 3676, 3676, 3676, 3676, 3676, 3676, 3676, 3676, 3676, 3676, 3676, 3676, 3676, 3676, 3676, 3676, 3676, 3676, 3676, 3676,
-        3676, 3676, 3676, 3676, 3677, 3677, 3677, 3677, 3677, 3677, 3677, 3677, 3677, 3677, 3677, 3677, 3677, 3677, 3677, 3677, 3677, 3677, 3677, 3677, 3677, 3677,
-        3677, 3677, 3677, 3677, 3677, 3677, 3677, 3677, 3677, 3677, 3677, 3677, 3677, 3678, 3678, 3678, 3678, 3678, 3678, 3678, 3678, 3678, 3678, 3678, 3678, 3678,
-        3678, 3678, 3678, 3678, 3678, 3678, 3678, 3678, 3678, 3678, 3678, 3678, 3678, 3678, 3678, 3678, 3678, 3678, 3678, 3678, 3678, 3678, 3679, 3679, 3679, 3679,
-        3679, 3679, 3679, 3679, 3679, 3679, 3679, 3679, 3679, 3679, 3679, 3679, 3679, 3679, 3679, 3679, 3679, 3679, 3679, 3679, 3679, 3679, 3679, 3679, 3679, 3679,
-        3679, 3679, 3679, 3679, 3679, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680,
-        3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3681, 3681, 3681, 3681, 3681, 3681, 3681, 3681, 3681, 3681, 3681, 3681,
-        3681, 3681, 3681, 3681, 3681, 3681, 3681, 3681, 3681, 3681, 3681, 3681, 3681, 3681, 3681, 3681, 3681, 3681, 3681, 3681, 3681, 3681, 3681, 3682, 3682, 3682,
-        3682, 3682, 3682, 3682, 3682, 3682, 3682, 3682, 3682, 3682, 3682, 3682, 3682, 3682, 3682, 3682, 3682, 3682, 3682, 3682, 3682, 3682, 3682, 3682, 3682, 3682,
-        3682, 3682, 3682, 3682, 3682, 3682, 3683, 3683, 3683, 3683, 3683, 3683, 3683, 3683, 3683, 3683, 3683, 3683, 3683, 3683, 3683, 3683, 3683, 3683, 3683, 3683,
-        3683, 3683, 3683, 3683, 3683, 3683, 3683, 3683, 3683, 3683, 3683, 3683, 3683, 3683, 3683, 3684, 3684, 3684, 3684, 3684, 3684, 3684, 3684, 3684, 3684, 3684,
-        3684, 3684, 3684, 3684, 3684, 3684, 3684, 3684, 3684, 3684, 3684, 3684, 3684, 3684, 3684, 3684, 3684, 3684, 3684, 3684, 3684, 3684, 3684, 3684, 3685, 3685,
-        3685, 3685, 3685, 3685, 3685, 3685, 3685, 3685, 3685, 3685, 3685, 3685, 3685, 3685, 3685, 3685, 3685, 3685, 3685, 3685, 3685, 3685, 3685, 3685, 3685, 3685,
-        3685, 3685, 3685, 3685, 3685, 3685, 3685, 3685, 3686, 3686, 3686, 3686, 3686, 3686, 3686, 3686, 3686, 3686, 3686, 3686, 3686, 3686, 3686, 3686, 3686, 3686,
-        3686, 3686, 3686, 3686, 3686, 3686, 3686, 3686, 3686, 3686, 3686, 3686, 3686, 3686, 3686, 3686, 3686, 3687, 3687, 3687, 3687, 3687, 3687, 3687, 3687, 3687,
-        3687, 3687, 3687, 3687, 3687, 3687, 3687, 3687, 3687, 3687, 3687, 3687, 3687, 3687, 3687, 3687, 3687, 3687, 3687, 3687, 3687, 3687, 3687, 3687, 3687, 3687,
-        3688, 3688, 3688, 3688, 3688, 3688, 3688, 3688, 3688, 3688, 3688, 3688, 3688, 3688, 3688, 3688, 3688, 3688, 3688, 3688, 3688, 3688, 3688, 3688, 3688, 3688,
-        3688, 3688, 3688, 3688, 3688, 3688, 3688, 3688, 3688, 3689, 3689, 3689, 3689, 3689, 3689, 3689, 3689, 3689, 3689, 3689, 3689, 3689, 3689, 3689, 3689, 3689,
-        3689, 3689, 3689, 3689, 3689, 3689, 3689, 3689, 3689, 3689, 3689, 3689, 3689, 3689, 3689, 3689, 3689, 3689, 3690, 3690, 3690, 3690, 3690, 3690, 3690, 3690,
-        3690, 3690, 3690, 3690, 3690, 3690, 3690, 3690, 3690, 3690, 3690, 3690, 3690, 3690, 3690, 3690, 3690, 3690, 3690, 3690, 3690, 3690, 3690, 3690, 3690, 3690,
-        3690, 3690, 3691, 3691, 3691, 3691, 3691, 3691, 3691, 3691, 3691, 3691, 3691, 3691, 3691, 3691, 3691, 3691, 3691, 3691, 3691, 3691, 3691, 3691, 3691, 3691,
-        3691, 3691, 3691, 3691, 3691, 3691, 3691, 3691, 3691, 3691, 3691, 3692, 3692, 3692, 3692, 3692, 3692, 3692, 3692, 3692, 3692, 3692, 3692, 3692, 3692, 3692,
-        3692, 3692, 3692, 3692, 3692, 3692, 3692, 3692, 3692, 3692, 3692, 3692, 3692, 3692, 3692, 3692, 3692, 3692, 3692, 3692, 3693, 3693, 3693, 3693, 3693, 3693,
-        3693, 3693, 3693, 3693, 3693, 3693, 3693, 3693, 3693, 3693, 3693, 3693, 3693, 3693, 3693, 3693, 3693, 3693, 3693, 3693, 3693, 3693, 3693, 3693, 3693, 3693,
-        3693, 3693, 3693, 3694, 3694, 3694, 3694, 3694, 3694, 3694, 3694, 3694, 3694, 3694, 3694, 3694, 3694, 3694, 3694, 3694, 3694, 3694, 3694, 3694, 3694, 3694,
-        3694, 3694, 3694, 3694, 3694, 3694, 3694, 3694, 3694, 3694, 3694, 3694, 3694, 3695, 3695, 3695, 3695, 3695, 3695, 3695, 3695, 3695, 3695, 3695, 3695, 3695,
-        3695, 3695, 3695, 3695, 3695, 3695, 3695, 3695, 3695, 3695, 3695, 3695, 3695, 3695, 3695, 3695, 3695, 3695, 3695, 3695, 3695, 3695, 3696, 3696, 3696, 3696,
-        3696, 3696, 3696, 3696, 3696, 3696, 3696, 3696, 3696, 3696, 3696, 3696, 3696, 3696, 3696, 3696, 3696, 3696, 3696, 3696, 3696, 3696, 3696, 3696, 3696, 3696,
-        3696, 3696, 3696, 3696, 3696, 3697, 3697, 3697, 3697, 3697, 3697, 3697, 3697, 3697, 3697, 3697, 3697, 3697, 3697, 3697, 3697, 3697, 3697, 3697, 3697, 3697,
-        3697, 3697, 3697, 3697, 3697, 3697, 3697, 3697, 3697, 3697, 3697, 3697, 3697, 3697, 3697, 3698, 3698, 3698, 3698, 3698, 3698, 3698, 3698, 3698, 3698, 3698,
-        3698, 3698, 3698, 3698, 3698, 3698, 3698, 3698, 3698, 3698, 3698, 3698, 3698, 3698, 3698, 3698, 3698, 3698, 3698, 3698, 3698, 3698, 3698, 3698, 3699, 3699,
-        3699, 3699, 3699, 3699, 3699, 3699, 3699, 3699, 3699, 3699, 3699, 3699, 3699, 3699, 3699, 3699, 3699, 3699, 3699, 3699, 3699, 3699, 3699, 3699, 3699, 3699,
-        3699, 3699, 3699, 3699, 3699, 3699, 3699, 3700, 3700, 3700, 3700, 3700, 3700, 3700, 3700, 3700, 3700, 3700, 3700, 3700, 3700, 3700, 3700, 3700, 3700, 3700,
-        3700, 3700, 3700, 3700, 3700, 3700, 3700, 3700, 3700, 3700, 3700, 3700, 3700, 3700, 3700, 3700, 3700, 3701, 3701, 3701, 3701, 3701, 3701, 3701, 3701, 3701,
-        3701, 3701, 3701, 3701, 3701, 3701, 3701, 3701, 3701, 3701, 3701, 3701, 3701, 3701, 3701, 3701, 3701, 3701, 3701, 3701, 3701, 3701, 3701, 3701, 3701, 3701,
-        3702, 3702, 3702, 3702, 3702, 3702, 3702, 3702, 3702, 3702, 3702, 3702, 3702, 3702, 3702, 3702, 3702, 3702, 3702, 3702, 3702, 3702, 3702, 3702, 3702, 3702,
-        3702, 3702, 3702, 3702, 3702, 3702, 3702, 3702, 3702, 3702, 3703, 3703, 3703, 3703, 3703, 3703, 3703, 3703, 3703, 3703, 3703, 3703, 3703, 3703, 3703, 3703,
-        3703, 3703, 3703, 3703, 3703, 3703, 3703, 3703, 3703, 3703, 3703, 3703, 3703, 3703, 3703, 3703, 3703, 3703, 3703, 3704, 3704, 3704, 3704, 3704, 3704, 3704,
-        3704, 3704, 3704, 3704, 3704, 3704, 3704, 3704, 3704, 3704, 3704, 3704, 3704, 3704, 3704, 3704, 3704, 3704, 3704, 3704, 3704, 3704, 3704, 3704, 3704, 3704,
-        3704, 3704, 3705, 3705, 3705, 3705, 3705, 3705, 3705, 3705, 3705, 3705, 3705, 3705, 3705, 3705, 3705, 3705, 3705, 3705, 3705, 3705, 3705, 3705, 3705, 3705,
-        3705, 3705, 3705, 3705, 3705, 3705, 3705, 3705, 3705, 3705, 3705, 3705, 3706, 3706, 3706, 3706, 3706, 3706, 3706, 3706, 3706, 3706, 3706, 3706, 3706, 3706,
-        3706, 3706, 3706, 3706, 3706, 3706, 3706, 3706, 3706, 3706, 3706, 3706, 3706, 3706, 3706, 3706, 3706, 3706, 3706, 3706, 3706, 3707, 3707, 3707, 3707, 3707,
-        3707, 3707, 3707, 3707, 3707, 3707, 3707, 3707, 3707, 3707, 3707, 3707, 3707, 3707, 3707, 3707, 3707, 3707, 3707, 3707, 3707, 3707, 3707, 3707, 3707, 3707,
-        3707, 3707, 3707, 3707, 3707, 3708, 3708, 3708, 3708, 3708, 3708, 3708, 3708, 3708, 3708, 3708, 3708, 3708, 3708, 3708, 3708, 3708, 3708, 3708, 3708, 3708,
-        3708, 3708, 3708, 3708, 3708, 3708, 3708, 3708, 3708, 3708, 3708, 3708, 3708, 3708, 3709, 3709, 3709, 3709, 3709, 3709, 3709, 3709, 3709, 3709, 3709, 3709,
-        3709, 3709, 3709, 3709, 3709, 3709, 3709, 3709, 3709, 3709, 3709, 3709, 3709, 3709, 3709, 3709, 3709, 3709, 3709, 3709, 3709, 3709, 3709, 3709, 3710, 3710,
-        3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710,
-        3710, 3710, 3710, 3710, 3710, 3710, 3710, 3711, 3711, 3711, 3711, 3711, 3711, 3711, 3711, 3711, 3711, 3711, 3711, 3711, 3711, 3711, 3711, 3711, 3711, 3711,
-        3711, 3711, 3711, 3711, 3711, 3711, 3711, 3711, 3711, 3711, 3711, 3711, 3711, 3711, 3711, 3711, 3711, 3712, 3712, 3712, 3712, 3712, 3712, 3712, 3712, 3712,
-        3712, 3712, 3712, 3712, 3712, 3712, 3712, 3712, 3712, 3712, 3712, 3712, 3712, 3712, 3712, 3712, 3712, 3712, 3712, 3712, 3712, 3712, 3712, 3712, 3712, 3712,
-        3712, 3713, 3713, 3713, 3713, 3713, 3713, 3713, 3713, 3713, 3713, 3713, 3713, 3713, 3713, 3713, 3713, 3713, 3713, 3713, 3713, 3713, 3713, 3713, 3713, 3713,
-        3713, 3713, 3713, 3713, 3713, 3713, 3713, 3713, 3713, 3713, 3714, 3714, 3714, 3714, 3714, 3714, 3714, 3714, 3714, 3714, 3714, 3714, 3714, 3714, 3714, 3714,
-        3714, 3714, 3714, 3714, 3714, 3714, 3714, 3714, 3714, 3714, 3714, 3714, 3714, 3714, 3714, 3714, 3714, 3714, 3714, 3714, 3715, 3715, 3715, 3715, 3715, 3715,
-        3715, 3715, 3715, 3715, 3715, 3715, 3715, 3715, 3715, 3715, 3715, 3715, 3715, 3715, 3715, 3715, 3715, 3715, 3715, 3715, 3715, 3715, 3715, 3715, 3715, 3715,
-        3715, 3715, 3715, 3716, 3716, 3716, 3716, 3716, 3716, 3716, 3716, 3716, 3716, 3716, 3716, 3716, 3716, 3716, 3716, 3716, 3716, 3716, 3716, 3716, 3716, 3716,
-        3716, 3716, 3716, 3716, 3716, 3716, 3716, 3716, 3716, 3716, 3716, 3716, 3716, 3717, 3717, 3717, 3717, 3717, 3717, 3717, 3717, 3717, 3717, 3717, 3717, 3717,
-        3717, 3717, 3717, 3717, 3717, 3717, 3717, 3717, 3717, 3717, 3717, 3717, 3717, 3717, 3717, 3717, 3717, 3717, 3717, 3717, 3717, 3717, 3717, 3718, 3718, 3718,
-        3718, 3718, 3718, 3718, 3718, 3718, 3718, 3718, 3718, 3718, 3718, 3718, 3718, 3718, 3718, 3718, 3718, 3718, 3718, 3718, 3718, 3718, 3718, 3718, 3718, 3718,
-        3718, 3718, 3718, 3718, 3718, 3718, 3719, 3719, 3719, 3719, 3719, 3719, 3719, 3719, 3719, 3719, 3719, 3719, 3719, 3719, 3719, 3719, 3719, 3719, 3719, 3719,
-        3719, 3719, 3719, 3719, 3719, 3719, 3719, 3719, 3719, 3719, 3719, 3719, 3719, 3719, 3719, 3719, 3720, 3720, 3720, 3720, 3720, 3720, 3720, 3720, 3720, 3720,
-        3720, 3720, 3720, 3720, 3720, 3720, 3720, 3720, 3720, 3720, 3720, 3720, 3720, 3720, 3720, 3720, 3720, 3720, 3720, 3720, 3720, 3720, 3720, 3720, 3720, 3720,
-        3721, 3721, 3721, 3721, 3721, 3721, 3721, 3721, 3721, 3721, 3721, 3721, 3721, 3721, 3721, 3721, 3721, 3721, 3721, 3721, 3721, 3721, 3721, 3721, 3721, 3721,
-        3721, 3721, 3721, 3721, 3721, 3721, 3721, 3721, 3721, 3722, 3722, 3722, 3722, 3722, 3722, 3722, 3722, 3722, 3722, 3722, 3722, 3722, 3722, 3722, 3722, 3722,
-        3722, 3722, 3722, 3722, 3722, 3722, 3722, 3722, 3722, 3722, 3722, 3722, 3722, 3722, 3722, 3722, 3722, 3722, 3722, 3723, 3723, 3723, 3723, 3723, 3723, 3723,
-        3723, 3723, 3723, 3723, 3723, 3723, 3723, 3723, 3723, 3723, 3723, 3723, 3723, 3723, 3723, 3723, 3723, 3723, 3723, 3723, 3723, 3723, 3723, 3723, 3723, 3723,
-        3723, 3723, 3723, 3724, 3724, 3724, 3724, 3724, 3724, 3724, 3724, 3724, 3724, 3724, 3724, 3724, 3724, 3724, 3724, 3724, 3724, 3724, 3724, 3724, 3724, 3724,
-        3724, 3724, 3724, 3724, 3724, 3724, 3724, 3724, 3724, 3724, 3724, 3724, 3724, 3725, 3725, 3725, 3725, 3725, 3725, 3725, 3725, 3725, 3725, 3725, 3725, 3725,
-        3725, 3725, 3725, 3725, 3725, 3725, 3725, 3725, 3725, 3725, 3725, 3725, 3725, 3725, 3725, 3725, 3725, 3725, 3725, 3725, 3725, 3725, 3726, 3726, 3726, 3726,
-        3726, 3726, 3726, 3726, 3726, 3726, 3726, 3726, 3726, 3726, 3726, 3726, 3726, 3726, 3726, 3726, 3726, 3726, 3726, 3726, 3726, 3726, 3726, 3726, 3726, 3726,
-        3726, 3726, 3726, 3726, 3726, 3726, 3727, 3727, 3727, 3727, 3727, 3727, 3727, 3727, 3727, 3727, 3727, 3727, 3727, 3727, 3727, 3727, 3727, 3727, 3727, 3727,
-        3727, 3727, 3727, 3727, 3727, 3727, 3727, 3727, 3727, 3727, 3727, 3727, 3727, 3727, 3727, 3727, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
-        3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
-        3729, 3729, 3729, 3729, 3729, 3729, 3729, 3729, 3729, 3729, 3729, 3729, 3729, 3729, 3729, 3729, 3729, 3729, 3729, 3729, 3729, 3729, 3729, 3729, 3729, 3729,
-        3729, 3729, 3729, 3729, 3729, 3729, 3729, 3729, 3729, 3729, 3730, 3730, 3730, 3730, 3730, 3730, 3730, 3730, 3730, 3730, 3730, 3730, 3730, 3730, 3730, 3730,
-        3730, 3730, 3730, 3730, 3730, 3730, 3730, 3730, 3730, 3730, 3730, 3730, 3730, 3730, 3730, 3730, 3730, 3730, 3730, 3731, 3731, 3731, 3731, 3731, 3731, 3731,
-        3731, 3731, 3731, 3731, 3731, 3731, 3731, 3731, 3731, 3731, 3731, 3731, 3731, 3731, 3731, 3731, 3731, 3731, 3731, 3731, 3731, 3731, 3731, 3731, 3731, 3731,
-        3731, 3731, 3731, 3732, 3732, 3732, 3732, 3732, 3732, 3732, 3732, 3732, 3732, 3732, 3732, 3732, 3732, 3732, 3732, 3732, 3732, 3732, 3732, 3732, 3732, 3732,
-        3732, 3732, 3732, 3732, 3732, 3732, 3732, 3732, 3732, 3732, 3732, 3732, 3732, 3733, 3733, 3733, 3733, 3733, 3733, 3733, 3733, 3733, 3733, 3733, 3733, 3733,
-        3733, 3733, 3733, 3733, 3733, 3733, 3733, 3733, 3733, 3733, 3733, 3733, 3733, 3733, 3733, 3733, 3733, 3733, 3733, 3733, 3733, 3733, 3733, 3734, 3734, 3734,
-        3734, 3734, 3734, 3734, 3734, 3734, 3734, 3734, 3734, 3734, 3734, 3734, 3734, 3734, 3734, 3734, 3734, 3734, 3734, 3734, 3734, 3734, 3734, 3734, 3734, 3734,
-        3734, 3734, 3734, 3734, 3734, 3734, 3734, 3735, 3735, 3735, 3735, 3735, 3735, 3735, 3735, 3735, 3735, 3735, 3735, 3735, 3735, 3735, 3735, 3735, 3735, 3735,
-        3735, 3735, 3735, 3735, 3735, 3735, 3735, 3735, 3735, 3735, 3735, 3735, 3735, 3735, 3735, 3735, 3735, 3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736,
-        3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736,
-        3736, 3737, 3737, 3737, 3737, 3737, 3737, 3737, 3737, 3737, 3737, 3737, 3737, 3737, 3737, 3737, 3737, 3737, 3737, 3737, 3737, 3737, 3737, 3737, 3737, 3737,
-        3737, 3737, 3737, 3737, 3737, 3737, 3737, 3737, 3737, 3737, 3737, 3738, 3738, 3738, 3738, 3738, 3738, 3738, 3738, 3738, 3738, 3738, 3738, 3738, 3738, 3738,
-        3738, 3738, 3738, 3738, 3738, 3738, 3738, 3738, 3738, 3738, 3738, 3738, 3738, 3738, 3738, 3738, 3738, 3738, 3738, 3738, 3738, 3739, 3739, 3739, 3739, 3739,
-        3739, 3739, 3739, 3739, 3739, 3739, 3739, 3739, 3739, 3739, 3739, 3739, 3739, 3739, 3739, 3739, 3739, 3739, 3739, 3739, 3739, 3739, 3739, 3739, 3739, 3739,
-        3739, 3739, 3739, 3739, 3739, 3740, 3740, 3740, 3740, 3740, 3740, 3740, 3740, 3740, 3740, 3740, 3740, 3740, 3740, 3740, 3740, 3740, 3740, 3740, 3740, 3740,
-        3740, 3740, 3740, 3740, 3740, 3740, 3740, 3740, 3740, 3740, 3740, 3740, 3740, 3740, 3740, 3741, 3741, 3741, 3741, 3741, 3741, 3741, 3741, 3741, 3741, 3741,
-        3741, 3741, 3741, 3741, 3741, 3741, 3741, 3741, 3741, 3741, 3741, 3741, 3741, 3741, 3741, 3741, 3741, 3741, 3741, 3741, 3741, 3741, 3741, 3741, 3741, 3742,
-        3742, 3742, 3742, 3742, 3742, 3742, 3742, 3742, 3742, 3742, 3742, 3742, 3742, 3742, 3742, 3742, 3742, 3742, 3742, 3742, 3742, 3742, 3742, 3742, 3742, 3742,
-        3742, 3742, 3742, 3742, 3742, 3742, 3742, 3742, 3742, 3743, 3743, 3743, 3743, 3743, 3743, 3743, 3743, 3743, 3743, 3743, 3743, 3743, 3743, 3743, 3743, 3743,
-        3743, 3743, 3743, 3743, 3743, 3743, 3743, 3743, 3743, 3743, 3743, 3743, 3743, 3743, 3743, 3743, 3743, 3743, 3743, 3744, 3744, 3744, 3744, 3744, 3744, 3744,
-        3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744,
-        3744, 3744, 3744, 3745, 3745, 3745, 3745, 3745, 3745, 3745, 3745, 3745, 3745, 3745, 3745, 3745, 3745, 3745, 3745, 3745, 3745, 3745, 3745, 3745, 3745, 3745,
-        3745, 3745, 3745, 3745, 3745, 3745, 3745, 3745, 3745, 3745, 3745, 3745, 3745, 3746, 3746, 3746, 3746, 3746, 3746, 3746, 3746, 3746, 3746, 3746, 3746, 3746,
-        3746, 3746, 3746, 3746, 3746, 3746, 3746, 3746, 3746, 3746, 3746, 3746, 3746, 3746, 3746, 3746, 3746, 3746, 3746, 3746, 3746, 3746, 3746, 3747, 3747, 3747,
-        3747, 3747, 3747, 3747, 3747, 3747, 3747, 3747, 3747, 3747, 3747, 3747, 3747, 3747, 3747, 3747, 3747, 3747, 3747, 3747, 3747, 3747, 3747, 3747, 3747, 3747,
-        3747, 3747, 3747, 3747, 3747, 3747, 3747, 3748, 3748, 3748, 3748, 3748, 3748, 3748, 3748, 3748, 3748, 3748, 3748, 3748, 3748, 3748, 3748, 3748, 3748, 3748,
-        3748, 3748, 3748, 3748, 3748, 3748, 3748, 3748, 3748, 3748, 3748, 3748, 3748, 3748, 3748, 3748, 3748, 3749, 3749, 3749, 3749, 3749, 3749, 3749, 3749, 3749,
-        3749, 3749, 3749, 3749, 3749, 3749, 3749, 3749, 3749, 3749, 3749, 3749, 3749, 3749, 3749, 3749, 3749, 3749, 3749, 3749, 3749, 3749, 3749, 3749, 3749, 3749,
-        3749, 3750, 3750, 3750, 3750, 3750, 3750, 3750, 3750, 3750, 3750, 3750, 3750, 3750, 3750, 3750, 3750, 3750, 3750, 3750, 3750, 3750, 3750, 3750, 3750, 3750,
-        3750, 3750, 3750, 3750, 3750, 3750, 3750, 3750, 3750, 3750, 3750, 3751, 3751, 3751, 3751, 3751, 3751, 3751, 3751, 3751, 3751, 3751, 3751, 3751, 3751, 3751,
-        3751, 3751, 3751, 3751, 3751, 3751, 3751, 3751, 3751, 3751, 3751, 3751, 3751, 3751, 3751, 3751, 3751, 3751, 3751, 3751, 3751, 3751, 3752, 3752, 3752, 3752,
-        3752, 3752, 3752, 3752, 3752, 3752, 3752, 3752, 3752, 3752, 3752, 3752, 3752, 3752, 3752, 3752, 3752, 3752, 3752, 3752, 3752, 3752, 3752, 3752, 3752, 3752,
-        3752, 3752, 3752, 3752, 3752, 3752, 3753, 3753, 3753, 3753, 3753, 3753, 3753, 3753, 3753, 3753, 3753, 3753, 3753, 3753, 3753, 3753, 3753, 3753, 3753, 3753,
-        3753, 3753, 3753, 3753, 3753, 3753, 3753, 3753, 3753, 3753, 3753, 3753, 3753, 3753, 3753, 3753, 3754, 3754, 3754, 3754, 3754, 3754, 3754, 3754, 3754, 3754,
-        3754, 3754, 3754, 3754, 3754, 3754, 3754, 3754, 3754, 3754, 3754, 3754, 3754, 3754, 3754, 3754, 3754, 3754, 3754, 3754, 3754, 3754, 3754, 3754, 3754, 3754,
-        3755, 3755, 3755, 3755, 3755, 3755, 3755, 3755, 3755, 3755, 3755, 3755, 3755, 3755, 3755, 3755, 3755, 3755, 3755, 3755, 3755, 3755, 3755, 3755, 3755, 3755,
-        3755, 3755, 3755, 3755, 3755, 3755, 3755, 3755, 3755, 3755, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756,
-        3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3757, 3757, 3757, 3757, 3757,
-        3757, 3757, 3757, 3757, 3757, 3757, 3757, 3757, 3757, 3757, 3757, 3757, 3757, 3757, 3757, 3757, 3757, 3757, 3757, 3757, 3757, 3757, 3757, 3757, 3757, 3757,
-        3757, 3757, 3757, 3757, 3757, 3758, 3758, 3758, 3758, 3758, 3758, 3758, 3758, 3758, 3758, 3758, 3758, 3758, 3758, 3758, 3758, 3758, 3758, 3758, 3758, 3758,
-        3758, 3758, 3758, 3758, 3758, 3758, 3758, 3758, 3758, 3758, 3758, 3758, 3758, 3758, 3758, 3759, 3759, 3759, 3759, 3759, 3759, 3759, 3759, 3759, 3759, 3759,
-        3759, 3759, 3759, 3759, 3759, 3759, 3759, 3759, 3759, 3759, 3759, 3759, 3759, 3759, 3759, 3759, 3759, 3759, 3759, 3759, 3759, 3759, 3759, 3759, 3759, 3759,
-        3760, 3760, 3760, 3760, 3760, 3760, 3760, 3760, 3760, 3760, 3760, 3760, 3760, 3760, 3760, 3760, 3760, 3760, 3760, 3760, 3760, 3760, 3760, 3760, 3760, 3760,
-        3760, 3760, 3760, 3760, 3760, 3760, 3760, 3760, 3760, 3760, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761,
-        3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3762, 3762, 3762, 3762, 3762, 3762,
-        3762, 3762, 3762, 3762, 3762, 3762, 3762, 3762, 3762, 3762, 3762, 3762, 3762, 3762, 3762, 3762, 3762, 3762, 3762, 3762, 3762, 3762, 3762, 3762, 3762, 3762,
-        3762, 3762, 3762, 3762, 3763, 3763, 3763, 3763, 3763, 3763, 3763, 3763, 3763, 3763, 3763, 3763, 3763, 3763, 3763, 3763, 3763, 3763, 3763, 3763, 3763, 3763,
-        3763, 3763, 3763, 3763, 3763, 3763, 3763, 3763, 3763, 3763, 3763, 3763, 3763, 3763, 3763, 3764, 3764, 3764, 3764, 3764, 3764, 3764, 3764, 3764, 3764, 3764,
-        3764, 3764, 3764, 3764, 3764, 3764, 3764, 3764, 3764, 3764, 3764, 3764, 3764, 3764, 3764, 3764, 3764, 3764, 3764, 3764, 3764, 3764, 3764, 3764, 3764, 3765,
-        3765, 3765, 3765, 3765, 3765, 3765, 3765, 3765, 3765, 3765, 3765, 3765, 3765, 3765, 3765, 3765, 3765, 3765, 3765, 3765, 3765, 3765, 3765, 3765, 3765, 3765,
-        3765, 3765, 3765, 3765, 3765, 3765, 3765, 3765, 3765, 3765, 3766, 3766, 3766, 3766, 3766, 3766, 3766, 3766, 3766, 3766, 3766, 3766, 3766, 3766, 3766, 3766,
-        3766, 3766, 3766, 3766, 3766, 3766, 3766, 3766, 3766, 3766, 3766, 3766, 3766, 3766, 3766, 3766, 3766, 3766, 3766, 3766, 3767, 3767, 3767, 3767, 3767, 3767,
-        3767, 3767, 3767, 3767, 3767, 3767, 3767, 3767, 3767, 3767, 3767, 3767, 3767, 3767, 3767, 3767, 3767, 3767, 3767, 3767, 3767, 3767, 3767, 3767, 3767, 3767,
-        3767, 3767, 3767, 3767, 3768, 3768, 3768, 3768, 3768, 3768, 3768, 3768, 3768, 3768, 3768, 3768, 3768, 3768, 3768, 3768, 3768, 3768, 3768, 3768, 3768, 3768,
-        3768, 3768, 3768, 3768, 3768, 3768, 3768, 3768, 3768, 3768, 3768, 3768, 3768, 3768, 3768, 3769, 3769, 3769, 3769, 3769, 3769, 3769, 3769, 3769, 3769, 3769,
-        3769, 3769, 3769, 3769, 3769, 3769, 3769, 3769, 3769, 3769, 3769, 3769, 3769, 3769, 3769, 3769, 3769, 3769, 3769, 3769, 3769, 3769, 3769, 3769, 3769, 3770,
-        3770, 3770, 3770, 3770, 3770, 3770, 3770, 3770, 3770, 3770, 3770, 3770, 3770, 3770, 3770, 3770, 3770, 3770, 3770, 3770, 3770, 3770, 3770, 3770, 3770, 3770,
-        3770, 3770, 3770, 3770, 3770, 3770, 3770, 3770, 3770, 3770, 3771, 3771, 3771, 3771, 3771, 3771, 3771, 3771, 3771, 3771, 3771, 3771, 3771, 3771, 3771, 3771,
-        3771, 3771, 3771, 3771, 3771, 3771, 3771, 3771, 3771, 3771, 3771, 3771, 3771, 3771, 3771, 3771, 3771, 3771, 3771, 3771, 3772, 3772, 3772, 3772, 3772, 3772,
-        3772, 3772, 3772, 3772, 3772, 3772, 3772, 3772, 3772, 3772, 3772, 3772, 3772, 3772, 3772, 3772, 3772, 3772, 3772, 3772, 3772, 3772, 3772, 3772, 3772, 3772,
-        3772, 3772, 3772, 3772, 3772, 3773, 3773, 3773, 3773, 3773, 3773, 3773, 3773, 3773, 3773, 3773, 3773, 3773, 3773, 3773, 3773, 3773, 3773, 3773, 3773, 3773,
-        3773, 3773, 3773, 3773, 3773, 3773, 3773, 3773, 3773, 3773, 3773, 3773, 3773, 3773, 3773, 3774, 3774, 3774, 3774, 3774, 3774, 3774, 3774, 3774, 3774, 3774,
-        3774, 3774, 3774, 3774, 3774, 3774, 3774, 3774, 3774, 3774, 3774, 3774, 3774, 3774, 3774, 3774, 3774, 3774, 3774, 3774, 3774, 3774, 3774, 3774, 3774, 3774,
-        3775, 3775, 3775, 3775, 3775, 3775, 3775, 3775, 3775, 3775, 3775, 3775, 3775, 3775, 3775, 3775, 3775, 3775, 3775, 3775, 3775, 3775, 3775, 3775, 3775, 3775,
-        3775, 3775, 3775, 3775, 3775, 3775, 3775, 3775, 3775, 3775, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776,
-        3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3777, 3777, 3777, 3777, 3777,
-        3777, 3777, 3777, 3777, 3777, 3777, 3777, 3777, 3777, 3777, 3777, 3777, 3777, 3777, 3777, 3777, 3777, 3777, 3777, 3777, 3777, 3777, 3777, 3777, 3777, 3777,
-        3777, 3777, 3777, 3777, 3777, 3778, 3778, 3778, 3778, 3778, 3778, 3778, 3778, 3778, 3778, 3778, 3778, 3778, 3778, 3778, 3778, 3778, 3778, 3778, 3778, 3778,
-        3778, 3778, 3778, 3778, 3778, 3778, 3778, 3778, 3778, 3778, 3778, 3778, 3778, 3778, 3778, 3778, 3779, 3779, 3779, 3779, 3779, 3779, 3779, 3779, 3779, 3779,
-        3779, 3779, 3779, 3779, 3779, 3779, 3779, 3779, 3779, 3779, 3779, 3779, 3779, 3779, 3779, 3779, 3779, 3779, 3779, 3779, 3779, 3779, 3779, 3779, 3779, 3779,
-        3779, 3780, 3780, 3780, 3780, 3780, 3780, 3780, 3780, 3780, 3780, 3780, 3780, 3780, 3780, 3780, 3780, 3780, 3780, 3780, 3780, 3780, 3780, 3780, 3780, 3780,
-        3780, 3780, 3780, 3780, 3780, 3780, 3780, 3780, 3780, 3780, 3780, 3781, 3781, 3781, 3781, 3781, 3781, 3781, 3781, 3781, 3781, 3781, 3781, 3781, 3781, 3781,
-        3781, 3781, 3781, 3781, 3781, 3781, 3781, 3781, 3781, 3781, 3781, 3781, 3781, 3781, 3781, 3781, 3781, 3781, 3781, 3781, 3781, 3781, 3782, 3782, 3782, 3782,
-        3782, 3782, 3782, 3782, 3782, 3782, 3782, 3782, 3782, 3782, 3782, 3782, 3782, 3782, 3782, 3782, 3782, 3782, 3782, 3782, 3782, 3782, 3782, 3782, 3782, 3782,
-        3782, 3782, 3782, 3782, 3782, 3782, 3783, 3783, 3783, 3783, 3783, 3783, 3783, 3783, 3783, 3783, 3783, 3783, 3783, 3783, 3783, 3783, 3783, 3783, 3783, 3783,
-        3783, 3783, 3783, 3783, 3783, 3783, 3783, 3783, 3783, 3783, 3783, 3783, 3783, 3783, 3783, 3783, 3783, 3784, 3784, 3784, 3784, 3784, 3784, 3784, 3784, 3784,
-        3784, 3784, 3784, 3784, 3784, 3784, 3784, 3784, 3784, 3784, 3784, 3784, 3784, 3784, 3784, 3784, 3784, 3784, 3784, 3784, 3784, 3784, 3784, 3784, 3784, 3784,
-        3784, 3784, 3785, 3785, 3785, 3785, 3785, 3785, 3785, 3785, 3785, 3785, 3785, 3785, 3785, 3785, 3785, 3785, 3785, 3785, 3785, 3785, 3785, 3785, 3785, 3785,
-        3785, 3785, 3785, 3785, 3785, 3785, 3785, 3785, 3785, 3785, 3785, 3785, 3785, 3786, 3786, 3786, 3786, 3786, 3786, 3786, 3786, 3786, 3786, 3786, 3786, 3786,
-        3786, 3786, 3786, 3786, 3786, 3786, 3786, 3786, 3786, 3786, 3786, 3786, 3786, 3786, 3786, 3786, 3786, 3786, 3786, 3786, 3786, 3786, 3786, 3787, 3787, 3787,
-        3787, 3787, 3787, 3787, 3787, 3787, 3787, 3787, 3787, 3787, 3787, 3787, 3787, 3787, 3787, 3787, 3787, 3787, 3787, 3787, 3787, 3787, 3787, 3787, 3787, 3787,
-        3787, 3787, 3787, 3787, 3787, 3787, 3787, 3787, 3788, 3788, 3788, 3788, 3788, 3788, 3788, 3788, 3788, 3788, 3788, 3788, 3788, 3788, 3788, 3788, 3788, 3788,
-        3788, 3788, 3788, 3788, 3788, 3788, 3788, 3788, 3788, 3788, 3788, 3788, 3788, 3788, 3788, 3788, 3788, 3788, 3788, 3789, 3789, 3789, 3789, 3789, 3789, 3789,
-        3789, 3789, 3789, 3789, 3789, 3789, 3789, 3789, 3789, 3789, 3789, 3789, 3789, 3789, 3789, 3789, 3789, 3789, 3789, 3789, 3789, 3789, 3789, 3789, 3789, 3789,
-        3789, 3789, 3789, 3790, 3790, 3790, 3790, 3790, 3790, 3790, 3790, 3790, 3790, 3790, 3790, 3790, 3790, 3790, 3790, 3790, 3790, 3790, 3790, 3790, 3790, 3790,
-        3790, 3790, 3790, 3790, 3790, 3790, 3790, 3790, 3790, 3790, 3790, 3790, 3790, 3790, 3791, 3791, 3791, 3791, 3791, 3791, 3791, 3791, 3791, 3791, 3791, 3791,
-        3791, 3791, 3791, 3791, 3791, 3791, 3791, 3791, 3791, 3791, 3791, 3791, 3791, 3791, 3791, 3791, 3791, 3791, 3791, 3791, 3791, 3791, 3791, 3791, 3791, 3792,
-        3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792,
-        3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3793, 3793, 3793, 3793, 3793, 3793, 3793, 3793, 3793, 3793, 3793, 3793, 3793, 3793, 3793, 3793,
-        3793, 3793, 3793, 3793, 3793, 3793, 3793, 3793, 3793, 3793, 3793, 3793, 3793, 3793, 3793, 3793, 3793, 3793, 3793, 3793, 3793, 3794, 3794, 3794, 3794, 3794,
-        3794, 3794, 3794, 3794, 3794, 3794, 3794, 3794, 3794, 3794, 3794, 3794, 3794, 3794, 3794, 3794, 3794, 3794, 3794, 3794, 3794, 3794, 3794, 3794, 3794, 3794,
-        3794, 3794, 3794, 3794, 3794, 3795, 3795, 3795, 3795, 3795, 3795, 3795, 3795, 3795, 3795, 3795, 3795, 3795, 3795, 3795, 3795, 3795, 3795, 3795, 3795, 3795,
-        3795, 3795, 3795, 3795, 3795, 3795, 3795, 3795, 3795, 3795, 3795, 3795, 3795, 3795, 3795, 3795, 3796, 3796, 3796, 3796, 3796, 3796, 3796, 3796, 3796, 3796,
-        3796, 3796, 3796, 3796, 3796, 3796, 3796, 3796, 3796, 3796, 3796, 3796, 3796, 3796, 3796, 3796, 3796, 3796, 3796, 3796, 3796, 3796, 3796, 3796, 3796, 3796,
-        3796, 3797, 3797, 3797, 3797, 3797, 3797, 3797, 3797, 3797, 3797, 3797, 3797, 3797, 3797, 3797, 3797, 3797, 3797, 3797, 3797, 3797, 3797, 3797, 3797, 3797,
-        3797, 3797, 3797, 3797, 3797, 3797, 3797, 3797, 3797, 3797, 3797, 3797, 3798, 3798, 3798, 3798, 3798, 3798, 3798, 3798, 3798, 3798, 3798, 3798, 3798, 3798,
-        3798, 3798, 3798, 3798, 3798, 3798, 3798, 3798, 3798, 3798, 3798, 3798, 3798, 3798, 3798, 3798, 3798, 3798, 3798, 3798, 3798, 3798, 3798, 3799, 3799, 3799,
-        3799, 3799, 3799, 3799, 3799, 3799, 3799, 3799, 3799, 3799, 3799, 3799, 3799, 3799, 3799, 3799, 3799, 3799, 3799, 3799, 3799, 3799, 3799, 3799, 3799, 3799,
-        3799, 3799, 3799, 3799, 3799, 3799, 3799, 3799, 3800, 3800, 3800, 3800, 3800, 3800, 3800, 3800, 3800, 3800, 3800, 3800, 3800, 3800, 3800, 3800, 3800, 3800,
-        3800, 3800, 3800, 3800, 3800, 3800, 3800, 3800, 3800, 3800, 3800, 3800, 3800, 3800, 3800, 3800, 3800, 3800, 3800, 3801, 3801, 3801, 3801, 3801, 3801, 3801,
-        3801, 3801, 3801, 3801, 3801, 3801, 3801, 3801, 3801, 3801, 3801, 3801, 3801, 3801, 3801, 3801, 3801, 3801, 3801, 3801, 3801, 3801, 3801, 3801, 3801, 3801,
-        3801, 3801, 3801, 3801, 3802, 3802, 3802, 3802, 3802, 3802, 3802, 3802, 3802, 3802, 3802, 3802, 3802, 3802, 3802, 3802, 3802, 3802, 3802, 3802, 3802, 3802,
-        3802, 3802, 3802, 3802, 3802, 3802, 3802, 3802, 3802, 3802, 3802, 3802, 3802, 3802, 3802, 3803, 3803, 3803, 3803, 3803, 3803, 3803, 3803, 3803, 3803, 3803,
-        3803, 3803, 3803, 3803, 3803, 3803, 3803, 3803, 3803, 3803, 3803, 3803, 3803, 3803, 3803, 3803, 3803, 3803, 3803, 3803, 3803, 3803, 3803, 3803, 3803, 3803,
-        3804, 3804, 3804, 3804, 3804, 3804, 3804, 3804, 3804, 3804, 3804, 3804, 3804, 3804, 3804, 3804, 3804, 3804, 3804, 3804, 3804, 3804, 3804, 3804, 3804, 3804,
-        3804, 3804, 3804, 3804, 3804, 3804, 3804, 3804, 3804, 3804, 3804, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805,
-        3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3806, 3806, 3806, 3806,
-        3806, 3806, 3806, 3806, 3806, 3806, 3806, 3806, 3806, 3806, 3806, 3806, 3806, 3806, 3806, 3806, 3806, 3806, 3806, 3806, 3806, 3806, 3806, 3806, 3806, 3806,
-        3806, 3806, 3806, 3806, 3806, 3806, 3806, 3807, 3807, 3807, 3807, 3807, 3807, 3807, 3807, 3807, 3807, 3807, 3807, 3807, 3807, 3807, 3807, 3807, 3807, 3807,
-        3807, 3807, 3807, 3807, 3807, 3807, 3807, 3807, 3807, 3807, 3807, 3807, 3807, 3807, 3807, 3807, 3807, 3807, 3808, 3808, 3808, 3808, 3808, 3808, 3808, 3808,
-        3808, 3808, 3808, 3808, 3808, 3808, 3808, 3808, 3808, 3808, 3808, 3808, 3808, 3808, 3808, 3808, 3808, 3808, 3808, 3808, 3808, 3808, 3808, 3808, 3808, 3808,
-        3808, 3808, 3808, 3809, 3809, 3809, 3809, 3809, 3809, 3809, 3809, 3809, 3809, 3809, 3809, 3809, 3809, 3809, 3809, 3809, 3809, 3809, 3809, 3809, 3809, 3809,
-        3809, 3809, 3809, 3809, 3809, 3809, 3809, 3809, 3809, 3809, 3809, 3809, 3809, 3809, 3810, 3810, 3810, 3810, 3810, 3810, 3810, 3810, 3810, 3810, 3810, 3810,
-        3810, 3810, 3810, 3810, 3810, 3810, 3810, 3810, 3810, 3810, 3810, 3810, 3810, 3810, 3810, 3810, 3810, 3810, 3810, 3810, 3810, 3810, 3810, 3810, 3810, 3811,
-        3811, 3811, 3811, 3811, 3811, 3811, 3811, 3811, 3811, 3811, 3811, 3811, 3811, 3811, 3811, 3811, 3811, 3811, 3811, 3811, 3811, 3811, 3811, 3811, 3811, 3811,
-        3811, 3811, 3811, 3811, 3811, 3811, 3811, 3811, 3811, 3811, 3812, 3812, 3812, 3812, 3812, 3812, 3812, 3812, 3812, 3812, 3812, 3812, 3812, 3812, 3812, 3812,
-        3812, 3812, 3812, 3812, 3812, 3812, 3812, 3812, 3812, 3812, 3812, 3812, 3812, 3812, 3812, 3812, 3812, 3812, 3812, 3812, 3812, 3813, 3813, 3813, 3813, 3813,
-        3813, 3813, 3813, 3813, 3813, 3813, 3813, 3813, 3813, 3813, 3813, 3813, 3813, 3813, 3813, 3813, 3813, 3813, 3813, 3813, 3813, 3813, 3813, 3813, 3813, 3813,
-        3813, 3813, 3813, 3813, 3813, 3813, 3814, 3814, 3814, 3814, 3814, 3814, 3814, 3814, 3814, 3814, 3814, 3814, 3814, 3814, 3814, 3814, 3814, 3814, 3814, 3814,
-        3814, 3814, 3814, 3814, 3814, 3814, 3814, 3814, 3814, 3814, 3814, 3814, 3814, 3814, 3814, 3814, 3814, 3815, 3815, 3815, 3815, 3815, 3815, 3815, 3815, 3815,
-        3815, 3815, 3815, 3815, 3815, 3815, 3815, 3815, 3815, 3815, 3815, 3815, 3815, 3815, 3815, 3815, 3815, 3815, 3815, 3815, 3815, 3815, 3815, 3815, 3815, 3815,
-        3815, 3815, 3815, 3816, 3816, 3816, 3816, 3816, 3816, 3816, 3816, 3816, 3816, 3816, 3816, 3816, 3816, 3816, 3816, 3816, 3816, 3816, 3816, 3816, 3816, 3816,
-        3816, 3816, 3816, 3816, 3816, 3816, 3816, 3816, 3816, 3816, 3816, 3816, 3816, 3816, 3817, 3817, 3817, 3817, 3817, 3817, 3817, 3817, 3817, 3817, 3817, 3817,
-        3817, 3817, 3817, 3817, 3817, 3817, 3817, 3817, 3817, 3817, 3817, 3817, 3817, 3817, 3817, 3817, 3817, 3817, 3817, 3817, 3817, 3817, 3817, 3817, 3817, 3818,
-        3818, 3818, 3818, 3818, 3818, 3818, 3818, 3818, 3818, 3818, 3818, 3818, 3818, 3818, 3818, 3818, 3818, 3818, 3818, 3818, 3818, 3818, 3818, 3818, 3818, 3818,
-        3818, 3818, 3818, 3818, 3818, 3818, 3818, 3818, 3818, 3818, 3819, 3819, 3819, 3819, 3819, 3819, 3819, 3819, 3819, 3819, 3819, 3819, 3819, 3819, 3819, 3819,
-        3819, 3819, 3819, 3819, 3819, 3819, 3819, 3819, 3819, 3819, 3819, 3819, 3819, 3819, 3819, 3819, 3819, 3819, 3819, 3819, 3819, 3820, 3820, 3820, 3820, 3820,
-        3820, 3820, 3820, 3820, 3820, 3820, 3820, 3820, 3820, 3820, 3820, 3820, 3820, 3820, 3820, 3820, 3820, 3820, 3820, 3820, 3820, 3820, 3820, 3820, 3820, 3820,
-        3820, 3820, 3820, 3820, 3820, 3820, 3820, 3821, 3821, 3821, 3821, 3821, 3821, 3821, 3821, 3821, 3821, 3821, 3821, 3821, 3821, 3821, 3821, 3821, 3821, 3821,
-        3821, 3821, 3821, 3821, 3821, 3821, 3821, 3821, 3821, 3821, 3821, 3821, 3821, 3821, 3821, 3821, 3821, 3821, 3822, 3822, 3822, 3822, 3822, 3822, 3822, 3822,
-        3822, 3822, 3822, 3822, 3822, 3822, 3822, 3822, 3822, 3822, 3822, 3822, 3822, 3822, 3822, 3822, 3822, 3822, 3822, 3822, 3822, 3822, 3822, 3822, 3822, 3822,
-        3822, 3822, 3822, 3823, 3823, 3823, 3823, 3823, 3823, 3823, 3823, 3823, 3823, 3823, 3823, 3823, 3823, 3823, 3823, 3823, 3823, 3823, 3823, 3823, 3823, 3823,
-        3823, 3823, 3823, 3823, 3823, 3823, 3823, 3823, 3823, 3823, 3823, 3823, 3823, 3823, 3824, 3824, 3824, 3824, 3824, 3824, 3824, 3824, 3824, 3824, 3824, 3824,
-        3824, 3824, 3824, 3824, 3824, 3824, 3824, 3824, 3824, 3824, 3824, 3824, 3824, 3824, 3824, 3824, 3824, 3824, 3824, 3824, 3824, 3824, 3824, 3824, 3824, 3824,
-        3825, 3825, 3825, 3825, 3825, 3825, 3825, 3825, 3825, 3825, 3825, 3825, 3825, 3825, 3825, 3825, 3825, 3825, 3825, 3825, 3825, 3825, 3825, 3825, 3825, 3825,
-        3825, 3825, 3825, 3825, 3825, 3825, 3825, 3825, 3825, 3825, 3825, 3826, 3826, 3826, 3826, 3826, 3826, 3826, 3826, 3826, 3826, 3826, 3826, 3826, 3826, 3826,
-        3826, 3826, 3826, 3826, 3826, 3826, 3826, 3826, 3826, 3826, 3826, 3826, 3826, 3826, 3826, 3826, 3826, 3826, 3826, 3826, 3826, 3826, 3827, 3827, 3827, 3827,
-        3827, 3827, 3827, 3827, 3827, 3827, 3827, 3827, 3827, 3827, 3827, 3827, 3827, 3827, 3827, 3827, 3827, 3827, 3827, 3827, 3827, 3827, 3827, 3827, 3827, 3827,
-        3827, 3827, 3827, 3827, 3827, 3827, 3827, 3827, 3828, 3828, 3828, 3828, 3828, 3828, 3828, 3828, 3828, 3828, 3828, 3828, 3828, 3828, 3828, 3828, 3828, 3828,
-        3828, 3828, 3828, 3828, 3828, 3828, 3828, 3828, 3828, 3828, 3828, 3828, 3828, 3828, 3828, 3828, 3828, 3828, 3828, 3829, 3829, 3829, 3829, 3829, 3829, 3829,
-        3829, 3829, 3829, 3829, 3829, 3829, 3829, 3829, 3829, 3829, 3829, 3829, 3829, 3829, 3829, 3829, 3829, 3829, 3829, 3829, 3829, 3829, 3829, 3829, 3829, 3829,
-        3829, 3829, 3829, 3829, 3830, 3830, 3830, 3830, 3830, 3830, 3830, 3830, 3830, 3830, 3830, 3830, 3830, 3830, 3830, 3830, 3830, 3830, 3830, 3830, 3830, 3830,
-        3830, 3830, 3830, 3830, 3830, 3830, 3830, 3830, 3830, 3830, 3830, 3830, 3830, 3830, 3830, 3830, 3831, 3831, 3831, 3831, 3831, 3831, 3831, 3831, 3831, 3831,
-        3831, 3831, 3831, 3831, 3831, 3831, 3831, 3831, 3831, 3831, 3831, 3831, 3831, 3831, 3831, 3831, 3831, 3831, 3831, 3831, 3831, 3831, 3831, 3831, 3831, 3831,
-        3831, 3832, 3832, 3832, 3832, 3832, 3832, 3832, 3832, 3832, 3832, 3832, 3832, 3832, 3832, 3832, 3832, 3832, 3832, 3832, 3832, 3832, 3832, 3832, 3832, 3832,
-        3832, 3832, 3832, 3832, 3832, 3832, 3832, 3832, 3832, 3832, 3832, 3832, 3832, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833,
-        3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3834, 3834,
-        3834, 3834, 3834, 3834, 3834, 3834, 3834, 3834, 3834, 3834, 3834, 3834, 3834, 3834, 3834, 3834, 3834, 3834, 3834, 3834, 3834, 3834, 3834, 3834, 3834, 3834,
-        3834, 3834, 3834, 3834, 3834, 3834, 3834, 3834, 3834, 3834, 3835, 3835, 3835, 3835, 3835, 3835, 3835, 3835, 3835, 3835, 3835, 3835, 3835, 3835, 3835, 3835,
-        3835, 3835, 3835, 3835, 3835, 3835, 3835, 3835, 3835, 3835, 3835, 3835, 3835, 3835, 3835, 3835, 3835, 3835, 3835, 3835, 3835, 3836, 3836, 3836, 3836, 3836,
-        3836, 3836, 3836, 3836, 3836, 3836, 3836, 3836, 3836, 3836, 3836, 3836, 3836, 3836, 3836, 3836, 3836, 3836, 3836, 3836, 3836, 3836, 3836, 3836, 3836, 3836,
-        3836, 3836, 3836, 3836, 3836, 3836, 3837, 3837, 3837, 3837, 3837, 3837, 3837, 3837, 3837, 3837, 3837, 3837, 3837, 3837, 3837, 3837, 3837, 3837, 3837, 3837,
-        3837, 3837, 3837, 3837, 3837, 3837, 3837, 3837, 3837, 3837, 3837, 3837, 3837, 3837, 3837, 3837, 3837, 3837, 3838, 3838, 3838, 3838, 3838, 3838, 3838, 3838,
-        3838, 3838, 3838, 3838, 3838, 3838, 3838, 3838, 3838, 3838, 3838, 3838, 3838, 3838, 3838, 3838, 3838, 3838, 3838, 3838, 3838, 3838, 3838, 3838, 3838, 3838,
-        3838, 3838, 3838, 3839, 3839, 3839, 3839, 3839, 3839, 3839, 3839, 3839, 3839, 3839, 3839, 3839, 3839, 3839, 3839, 3839, 3839, 3839, 3839, 3839, 3839, 3839,
-        3839, 3839, 3839, 3839, 3839, 3839, 3839, 3839, 3839, 3839, 3839, 3839, 3839, 3839, 3839, 3840, 3840, 3840, 3840, 3840, 3840, 3840, 3840, 3840, 3840, 3840,
-        3840, 3840, 3840, 3840, 3840, 3840, 3840, 3840, 3840, 3840, 3840, 3840, 3840, 3840, 3840, 3840, 3840, 3840, 3840, 3840, 3840, 3840, 3840, 3840, 3840, 3840,
-        3840, 3841, 3841, 3841, 3841, 3841, 3841, 3841, 3841, 3841, 3841, 3841, 3841, 3841, 3841, 3841, 3841, 3841, 3841, 3841, 3841, 3841, 3841, 3841, 3841, 3841,
-        3841, 3841, 3841, 3841, 3841, 3841, 3841, 3841, 3841, 3841, 3841, 3841, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842,
-        3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3843, 3843,
-        3843, 3843, 3843, 3843, 3843, 3843, 3843, 3843, 3843, 3843, 3843, 3843, 3843, 3843, 3843, 3843, 3843, 3843, 3843, 3843, 3843, 3843, 3843, 3843, 3843, 3843,
-        3843, 3843, 3843, 3843, 3843, 3843, 3843, 3843, 3843, 3844, 3844, 3844, 3844, 3844, 3844, 3844, 3844, 3844, 3844, 3844, 3844, 3844, 3844, 3844, 3844, 3844,
-        3844, 3844, 3844, 3844, 3844, 3844, 3844, 3844, 3844, 3844, 3844, 3844, 3844, 3844, 3844, 3844, 3844, 3844, 3844, 3844, 3844, 3845, 3845, 3845, 3845, 3845,
-        3845, 3845, 3845, 3845, 3845, 3845, 3845, 3845, 3845, 3845, 3845, 3845, 3845, 3845, 3845, 3845, 3845, 3845, 3845, 3845, 3845, 3845, 3845, 3845, 3845, 3845,
-        3845, 3845, 3845, 3845, 3845, 3845, 3845, 3846, 3846, 3846, 3846, 3846, 3846, 3846, 3846, 3846, 3846, 3846, 3846, 3846, 3846, 3846, 3846, 3846, 3846, 3846,
-        3846, 3846, 3846, 3846, 3846, 3846, 3846, 3846, 3846, 3846, 3846, 3846, 3846, 3846, 3846, 3846, 3846, 3846, 3847, 3847, 3847, 3847, 3847, 3847, 3847, 3847,
-        3847, 3847, 3847, 3847, 3847, 3847, 3847, 3847, 3847, 3847, 3847, 3847, 3847, 3847, 3847, 3847, 3847, 3847, 3847, 3847, 3847, 3847, 3847, 3847, 3847, 3847,
-        3847, 3847, 3847, 3847, 3848, 3848, 3848, 3848, 3848, 3848, 3848, 3848, 3848, 3848, 3848, 3848, 3848, 3848, 3848, 3848, 3848, 3848, 3848, 3848, 3848, 3848,
-        3848, 3848, 3848, 3848, 3848, 3848, 3848, 3848, 3848, 3848, 3848, 3848, 3848, 3848, 3848, 3848, 3849, 3849, 3849, 3849, 3849, 3849, 3849, 3849, 3849, 3849,
-        3849, 3849, 3849, 3849, 3849, 3849, 3849, 3849, 3849, 3849, 3849, 3849, 3849, 3849, 3849, 3849, 3849, 3849, 3849, 3849, 3849, 3849, 3849, 3849, 3849, 3849,
-        3849, 3850, 3850, 3850, 3850, 3850, 3850, 3850, 3850, 3850, 3850, 3850, 3850, 3850, 3850, 3850, 3850, 3850, 3850, 3850, 3850, 3850, 3850, 3850, 3850, 3850,
-        3850, 3850, 3850, 3850, 3850, 3850, 3850, 3850, 3850, 3850, 3850, 3850, 3850, 3851, 3851, 3851, 3851, 3851, 3851, 3851, 3851, 3851, 3851, 3851, 3851, 3851,
-        3851, 3851, 3851, 3851, 3851, 3851, 3851, 3851, 3851, 3851, 3851, 3851, 3851, 3851, 3851, 3851, 3851, 3851, 3851, 3851, 3851, 3851, 3851, 3851, 3851, 3852,
-        3852, 3852, 3852, 3852, 3852, 3852, 3852, 3852, 3852, 3852, 3852, 3852, 3852, 3852, 3852, 3852, 3852, 3852, 3852, 3852, 3852, 3852, 3852, 3852, 3852, 3852,
-        3852, 3852, 3852, 3852, 3852, 3852, 3852, 3852, 3852, 3852, 3853, 3853, 3853, 3853, 3853, 3853, 3853, 3853, 3853, 3853, 3853, 3853, 3853, 3853, 3853, 3853,
-        3853, 3853, 3853, 3853, 3853, 3853, 3853, 3853, 3853, 3853, 3853, 3853, 3853, 3853, 3853, 3853, 3853, 3853, 3853, 3853, 3853, 3853, 3854, 3854, 3854, 3854,
-        3854, 3854, 3854, 3854, 3854, 3854, 3854, 3854, 3854, 3854, 3854, 3854, 3854, 3854, 3854, 3854, 3854, 3854, 3854, 3854, 3854, 3854, 3854, 3854, 3854, 3854,
-        3854, 3854, 3854, 3854, 3854, 3854, 3854, 3854, 3855, 3855, 3855, 3855, 3855, 3855, 3855, 3855, 3855, 3855, 3855, 3855, 3855, 3855, 3855, 3855, 3855, 3855,
-        3855, 3855, 3855, 3855, 3855, 3855, 3855, 3855, 3855, 3855, 3855, 3855, 3855, 3855, 3855, 3855, 3855, 3855, 3855, 3855, 3856, 3856, 3856, 3856, 3856, 3856,
-        3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856,
-        3856, 3856, 3856, 3856, 3856, 3857, 3857, 3857, 3857, 3857, 3857, 3857, 3857, 3857, 3857, 3857, 3857, 3857, 3857, 3857, 3857, 3857, 3857, 3857, 3857, 3857,
-        3857, 3857, 3857, 3857, 3857, 3857, 3857, 3857, 3857, 3857, 3857, 3857, 3857, 3857, 3857, 3857, 3857, 3858, 3858, 3858, 3858, 3858, 3858, 3858, 3858, 3858,
-        3858, 3858, 3858, 3858, 3858, 3858, 3858, 3858, 3858, 3858, 3858, 3858, 3858, 3858, 3858, 3858, 3858, 3858, 3858, 3858, 3858, 3858, 3858, 3858, 3858, 3858,
-        3858, 3858, 3858, 3859, 3859, 3859, 3859, 3859, 3859, 3859, 3859, 3859, 3859, 3859, 3859, 3859, 3859, 3859, 3859, 3859, 3859, 3859, 3859, 3859, 3859, 3859,
-        3859, 3859, 3859, 3859, 3859, 3859, 3859, 3859, 3859, 3859, 3859, 3859, 3859, 3859, 3859, 3860, 3860, 3860, 3860, 3860, 3860, 3860, 3860, 3860, 3860, 3860,
-        3860, 3860, 3860, 3860, 3860, 3860, 3860, 3860, 3860, 3860, 3860, 3860, 3860, 3860, 3860, 3860, 3860, 3860, 3860, 3860, 3860, 3860, 3860, 3860, 3860, 3860,
-        3860, 3861, 3861, 3861, 3861, 3861, 3861, 3861, 3861, 3861, 3861, 3861, 3861, 3861, 3861, 3861, 3861, 3861, 3861, 3861, 3861, 3861, 3861, 3861, 3861, 3861,
-        3861, 3861, 3861, 3861, 3861, 3861, 3861, 3861, 3861, 3861, 3861, 3861, 3861, 3862, 3862, 3862, 3862, 3862, 3862, 3862, 3862, 3862, 3862, 3862, 3862, 3862,
-        3862, 3862, 3862, 3862, 3862, 3862, 3862, 3862, 3862, 3862, 3862, 3862, 3862, 3862, 3862, 3862, 3862, 3862, 3862, 3862, 3862, 3862, 3862, 3862, 3862, 3863,
-        3863, 3863, 3863, 3863, 3863, 3863, 3863, 3863, 3863, 3863, 3863, 3863, 3863, 3863, 3863, 3863, 3863, 3863, 3863, 3863, 3863, 3863, 3863, 3863, 3863, 3863,
-        3863, 3863, 3863, 3863, 3863, 3863, 3863, 3863, 3863, 3863, 3863, 3864, 3864, 3864, 3864, 3864, 3864, 3864, 3864, 3864, 3864, 3864, 3864, 3864, 3864, 3864,
-        3864, 3864, 3864, 3864, 3864, 3864, 3864, 3864, 3864, 3864, 3864, 3864, 3864, 3864, 3864, 3864, 3864, 3864, 3864, 3864, 3864, 3864, 3865, 3865, 3865, 3865,
-        3865, 3865, 3865, 3865, 3865, 3865, 3865, 3865, 3865, 3865, 3865, 3865, 3865, 3865, 3865, 3865, 3865, 3865, 3865, 3865, 3865, 3865, 3865, 3865, 3865, 3865,
-        3865, 3865, 3865, 3865, 3865, 3865, 3865, 3865, 3866, 3866, 3866, 3866, 3866, 3866, 3866, 3866, 3866, 3866, 3866, 3866, 3866, 3866, 3866, 3866, 3866, 3866,
-        3866, 3866, 3866, 3866, 3866, 3866, 3866, 3866, 3866, 3866, 3866, 3866, 3866, 3866, 3866, 3866, 3866, 3866, 3866, 3866, 3867, 3867, 3867, 3867, 3867, 3867,
-        3867, 3867, 3867, 3867, 3867, 3867, 3867, 3867, 3867, 3867, 3867, 3867, 3867, 3867, 3867, 3867, 3867, 3867, 3867, 3867, 3867, 3867, 3867, 3867, 3867, 3867,
-        3867, 3867, 3867, 3867, 3867, 3867, 3868, 3868, 3868, 3868, 3868, 3868, 3868, 3868, 3868, 3868, 3868, 3868, 3868, 3868, 3868, 3868, 3868, 3868, 3868, 3868,
-        3868, 3868, 3868, 3868, 3868, 3868, 3868, 3868, 3868, 3868, 3868, 3868, 3868, 3868, 3868, 3868, 3868, 3868, 3869, 3869, 3869, 3869, 3869, 3869, 3869, 3869,
-        3869, 3869, 3869, 3869, 3869, 3869, 3869, 3869, 3869, 3869, 3869, 3869, 3869, 3869, 3869, 3869, 3869, 3869, 3869, 3869, 3869, 3869, 3869, 3869, 3869, 3869,
-        3869, 3869, 3869, 3869, 3870, 3870, 3870, 3870, 3870, 3870, 3870, 3870, 3870, 3870, 3870, 3870, 3870, 3870, 3870, 3870, 3870, 3870, 3870, 3870, 3870, 3870,
-        3870, 3870, 3870, 3870, 3870, 3870, 3870, 3870, 3870, 3870, 3870, 3870, 3870, 3870, 3870, 3870, 3871, 3871, 3871, 3871, 3871, 3871, 3871, 3871, 3871, 3871,
-        3871, 3871, 3871, 3871, 3871, 3871, 3871, 3871, 3871, 3871, 3871, 3871, 3871, 3871, 3871, 3871, 3871, 3871, 3871, 3871, 3871, 3871, 3871, 3871, 3871, 3871,
-        3871, 3871, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872,
-        3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3873, 3873, 3873, 3873, 3873, 3873, 3873, 3873, 3873, 3873, 3873, 3873,
-        3873, 3873, 3873, 3873, 3873, 3873, 3873, 3873, 3873, 3873, 3873, 3873, 3873, 3873, 3873, 3873, 3873, 3873, 3873, 3873, 3873, 3873, 3873, 3873, 3873, 3873,
-        3873, 3874, 3874, 3874, 3874, 3874, 3874, 3874, 3874, 3874, 3874, 3874, 3874, 3874, 3874, 3874, 3874, 3874, 3874, 3874, 3874, 3874, 3874, 3874, 3874, 3874,
-        3874, 3874, 3874, 3874, 3874, 3874, 3874, 3874, 3874, 3874, 3874, 3874, 3874, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875,
-        3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3876,
-        3876, 3876, 3876, 3876, 3876, 3876, 3876, 3876, 3876, 3876, 3876, 3876, 3876, 3876, 3876, 3876, 3876, 3876, 3876, 3876, 3876, 3876, 3876, 3876, 3876, 3876,
-        3876, 3876, 3876, 3876, 3876, 3876, 3876, 3876, 3876, 3876, 3876, 3877, 3877, 3877, 3877, 3877, 3877, 3877, 3877, 3877, 3877, 3877, 3877, 3877, 3877, 3877,
-        3877, 3877, 3877, 3877, 3877, 3877, 3877, 3877, 3877, 3877, 3877, 3877, 3877, 3877, 3877, 3877, 3877, 3877, 3877, 3877, 3877, 3877, 3877, 3878, 3878, 3878,
-        3878, 3878, 3878, 3878, 3878, 3878, 3878, 3878, 3878, 3878, 3878, 3878, 3878, 3878, 3878, 3878, 3878, 3878, 3878, 3878, 3878, 3878, 3878, 3878, 3878, 3878,
-        3878, 3878, 3878, 3878, 3878, 3878, 3878, 3878, 3878, 3879, 3879, 3879, 3879, 3879, 3879, 3879, 3879, 3879, 3879, 3879, 3879, 3879, 3879, 3879, 3879, 3879,
-        3879, 3879, 3879, 3879, 3879, 3879, 3879, 3879, 3879, 3879, 3879, 3879, 3879, 3879, 3879, 3879, 3879, 3879, 3879, 3879, 3879, 3880, 3880, 3880, 3880, 3880,
-        3880, 3880, 3880, 3880, 3880, 3880, 3880, 3880, 3880, 3880, 3880, 3880, 3880, 3880, 3880, 3880, 3880, 3880, 3880, 3880, 3880, 3880, 3880, 3880, 3880, 3880,
-        3880, 3880, 3880, 3880, 3880, 3880, 3880, 3881, 3881, 3881, 3881, 3881, 3881, 3881, 3881, 3881, 3881, 3881, 3881, 3881, 3881, 3881, 3881, 3881, 3881, 3881,
-        3881, 3881, 3881, 3881, 3881, 3881, 3881, 3881, 3881, 3881, 3881, 3881, 3881, 3881, 3881, 3881, 3881, 3881, 3881, 3881, 3882, 3882, 3882, 3882, 3882, 3882,
-        3882, 3882, 3882, 3882, 3882, 3882, 3882, 3882, 3882, 3882, 3882, 3882, 3882, 3882, 3882, 3882, 3882, 3882, 3882, 3882, 3882, 3882, 3882, 3882, 3882, 3882,
-        3882, 3882, 3882, 3882, 3882, 3882, 3883, 3883, 3883, 3883, 3883, 3883, 3883, 3883, 3883, 3883, 3883, 3883, 3883, 3883, 3883, 3883, 3883, 3883, 3883, 3883,
-        3883, 3883, 3883, 3883, 3883, 3883, 3883, 3883, 3883, 3883, 3883, 3883, 3883, 3883, 3883, 3883, 3883, 3883, 3884, 3884, 3884, 3884, 3884, 3884, 3884, 3884,
-        3884, 3884, 3884, 3884, 3884, 3884, 3884, 3884, 3884, 3884, 3884, 3884, 3884, 3884, 3884, 3884, 3884, 3884, 3884, 3884, 3884, 3884, 3884, 3884, 3884, 3884,
-        3884, 3884, 3884, 3884, 3885, 3885, 3885, 3885, 3885, 3885, 3885, 3885, 3885, 3885, 3885, 3885, 3885, 3885, 3885, 3885, 3885, 3885, 3885, 3885, 3885, 3885,
-        3885, 3885, 3885, 3885, 3885, 3885, 3885, 3885, 3885, 3885, 3885, 3885, 3885, 3885, 3885, 3885, 3885, 3886, 3886, 3886, 3886, 3886, 3886, 3886, 3886, 3886,
-        3886, 3886, 3886, 3886, 3886, 3886, 3886, 3886, 3886, 3886, 3886, 3886, 3886, 3886, 3886, 3886, 3886, 3886, 3886, 3886, 3886, 3886, 3886, 3886, 3886, 3886,
-        3886, 3886, 3886, 3887, 3887, 3887, 3887, 3887, 3887, 3887, 3887, 3887, 3887, 3887, 3887, 3887, 3887, 3887, 3887, 3887, 3887, 3887, 3887, 3887, 3887, 3887,
-        3887, 3887, 3887, 3887, 3887, 3887, 3887, 3887, 3887, 3887, 3887, 3887, 3887, 3887, 3887, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888,
-        3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888,
-        3888, 3889, 3889, 3889, 3889, 3889, 3889, 3889, 3889, 3889, 3889, 3889, 3889, 3889, 3889, 3889, 3889, 3889, 3889, 3889, 3889, 3889, 3889, 3889, 3889, 3889,
-        3889, 3889, 3889, 3889, 3889, 3889, 3889, 3889, 3889, 3889, 3889, 3889, 3889, 3889, 3890, 3890, 3890, 3890, 3890, 3890, 3890, 3890, 3890, 3890, 3890, 3890,
-        3890, 3890, 3890, 3890, 3890, 3890, 3890, 3890, 3890, 3890, 3890, 3890, 3890, 3890, 3890, 3890, 3890, 3890, 3890, 3890, 3890, 3890, 3890, 3890, 3890, 3890,
-        3891, 3891, 3891, 3891, 3891, 3891, 3891, 3891, 3891, 3891, 3891, 3891, 3891, 3891, 3891, 3891, 3891, 3891, 3891, 3891, 3891, 3891, 3891, 3891, 3891, 3891,
-        3891, 3891, 3891, 3891, 3891, 3891, 3891, 3891, 3891, 3891, 3891, 3891, 3892, 3892, 3892, 3892, 3892, 3892, 3892, 3892, 3892, 3892, 3892, 3892, 3892, 3892,
-        3892, 3892, 3892, 3892, 3892, 3892, 3892, 3892, 3892, 3892, 3892, 3892, 3892, 3892, 3892, 3892, 3892, 3892, 3892, 3892, 3892, 3892, 3892, 3892, 3892, 3893,
-        3893, 3893, 3893, 3893, 3893, 3893, 3893, 3893, 3893, 3893, 3893, 3893, 3893, 3893, 3893, 3893, 3893, 3893, 3893, 3893, 3893, 3893, 3893, 3893, 3893, 3893,
-        3893, 3893, 3893, 3893, 3893, 3893, 3893, 3893, 3893, 3893, 3893, 3894, 3894, 3894, 3894, 3894, 3894, 3894, 3894, 3894, 3894, 3894, 3894, 3894, 3894, 3894,
-        3894, 3894, 3894, 3894, 3894, 3894, 3894, 3894, 3894, 3894, 3894, 3894, 3894, 3894, 3894, 3894, 3894, 3894, 3894, 3894, 3894, 3894, 3894, 3894, 3895, 3895,
-        3895, 3895, 3895, 3895, 3895, 3895, 3895, 3895, 3895, 3895, 3895, 3895, 3895, 3895, 3895, 3895, 3895, 3895, 3895, 3895, 3895, 3895, 3895, 3895, 3895, 3895,
-        3895, 3895, 3895, 3895, 3895, 3895, 3895, 3895, 3895, 3895, 3896, 3896, 3896, 3896, 3896, 3896, 3896, 3896, 3896, 3896, 3896, 3896, 3896, 3896, 3896, 3896,
-        3896, 3896, 3896, 3896, 3896, 3896, 3896, 3896, 3896, 3896, 3896, 3896, 3896, 3896, 3896, 3896, 3896, 3896, 3896, 3896, 3896, 3896, 3897, 3897, 3897, 3897,
-        3897, 3897, 3897, 3897, 3897, 3897, 3897, 3897, 3897, 3897, 3897, 3897, 3897, 3897, 3897, 3897, 3897, 3897, 3897, 3897, 3897, 3897, 3897, 3897, 3897, 3897,
-        3897, 3897, 3897, 3897, 3897, 3897, 3897, 3897, 3897, 3898, 3898, 3898, 3898, 3898, 3898, 3898, 3898, 3898, 3898, 3898, 3898, 3898, 3898, 3898, 3898, 3898,
-        3898, 3898, 3898, 3898, 3898, 3898, 3898, 3898, 3898, 3898, 3898, 3898, 3898, 3898, 3898, 3898, 3898, 3898, 3898, 3898, 3898, 3899, 3899, 3899, 3899, 3899,
-        3899, 3899, 3899, 3899, 3899, 3899, 3899, 3899, 3899, 3899, 3899, 3899, 3899, 3899, 3899, 3899, 3899, 3899, 3899, 3899, 3899, 3899, 3899, 3899, 3899, 3899,
-        3899, 3899, 3899, 3899, 3899, 3899, 3899, 3899, 3900, 3900, 3900, 3900, 3900, 3900, 3900, 3900, 3900, 3900, 3900, 3900, 3900, 3900, 3900, 3900, 3900, 3900,
-        3900, 3900, 3900, 3900, 3900, 3900, 3900, 3900, 3900, 3900, 3900, 3900, 3900, 3900, 3900, 3900, 3900, 3900, 3900, 3900, 3901, 3901, 3901, 3901, 3901, 3901,
-        3901, 3901, 3901, 3901, 3901, 3901, 3901, 3901, 3901, 3901, 3901, 3901, 3901, 3901, 3901, 3901, 3901, 3901, 3901, 3901, 3901, 3901, 3901, 3901, 3901, 3901,
-        3901, 3901, 3901, 3901, 3901, 3901, 3901, 3902, 3902, 3902, 3902, 3902, 3902, 3902, 3902, 3902, 3902, 3902, 3902, 3902, 3902, 3902, 3902, 3902, 3902, 3902,
-        3902, 3902, 3902, 3902, 3902, 3902, 3902, 3902, 3902, 3902, 3902, 3902, 3902, 3902, 3902, 3902, 3902, 3902, 3902, 3903, 3903, 3903, 3903, 3903, 3903, 3903,
-        3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903,
-        3903, 3903, 3903, 3903, 3903, 3903, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904,
-        3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3905, 3905, 3905, 3905, 3905, 3905, 3905, 3905,
-        3905, 3905, 3905, 3905, 3905, 3905, 3905, 3905, 3905, 3905, 3905, 3905, 3905, 3905, 3905, 3905, 3905, 3905, 3905, 3905, 3905, 3905, 3905, 3905, 3905, 3905,
-        3905, 3905, 3905, 3905, 3905, 3906, 3906, 3906, 3906, 3906, 3906, 3906, 3906, 3906, 3906, 3906, 3906, 3906, 3906, 3906, 3906, 3906, 3906, 3906, 3906, 3906,
-        3906, 3906, 3906, 3906, 3906, 3906, 3906, 3906, 3906, 3906, 3906, 3906, 3906, 3906, 3906, 3906, 3906, 3906, 3907, 3907, 3907, 3907, 3907, 3907, 3907, 3907,
-        3907, 3907, 3907, 3907, 3907, 3907, 3907, 3907, 3907, 3907, 3907, 3907, 3907, 3907, 3907, 3907, 3907, 3907, 3907, 3907, 3907, 3907, 3907, 3907, 3907, 3907,
-        3907, 3907, 3907, 3907, 3908, 3908, 3908, 3908, 3908, 3908, 3908, 3908, 3908, 3908, 3908, 3908, 3908, 3908, 3908, 3908, 3908, 3908, 3908, 3908, 3908, 3908,
-        3908, 3908, 3908, 3908, 3908, 3908, 3908, 3908, 3908, 3908, 3908, 3908, 3908, 3908, 3908, 3908, 3908, 3909, 3909, 3909, 3909, 3909, 3909, 3909, 3909, 3909,
-        3909, 3909, 3909, 3909, 3909, 3909, 3909, 3909, 3909, 3909, 3909, 3909, 3909, 3909, 3909, 3909, 3909, 3909, 3909, 3909, 3909, 3909, 3909, 3909, 3909, 3909,
-        3909, 3909, 3909, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910,
-        3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3911, 3911, 3911, 3911, 3911, 3911, 3911, 3911, 3911, 3911,
-        3911, 3911, 3911, 3911, 3911, 3911, 3911, 3911, 3911, 3911, 3911, 3911, 3911, 3911, 3911, 3911, 3911, 3911, 3911, 3911, 3911, 3911, 3911, 3911, 3911, 3911,
-        3911, 3911, 3911, 3912, 3912, 3912, 3912, 3912, 3912, 3912, 3912, 3912, 3912, 3912, 3912, 3912, 3912, 3912, 3912, 3912, 3912, 3912, 3912, 3912, 3912, 3912,
-        3912, 3912, 3912, 3912, 3912, 3912, 3912, 3912, 3912, 3912, 3912, 3912, 3912, 3912, 3912, 3913, 3913, 3913, 3913, 3913, 3913, 3913, 3913, 3913, 3913, 3913,
-        3913, 3913, 3913, 3913, 3913, 3913, 3913, 3913, 3913, 3913, 3913, 3913, 3913, 3913, 3913, 3913, 3913, 3913, 3913, 3913, 3913, 3913, 3913, 3913, 3913, 3913,
-        3913, 3913, 3914, 3914, 3914, 3914, 3914, 3914, 3914, 3914, 3914, 3914, 3914, 3914, 3914, 3914, 3914, 3914, 3914, 3914, 3914, 3914, 3914, 3914, 3914, 3914,
-        3914, 3914, 3914, 3914, 3914, 3914, 3914, 3914, 3914, 3914, 3914, 3914, 3914, 3914, 3914, 3915, 3915, 3915, 3915, 3915, 3915, 3915, 3915, 3915, 3915, 3915,
-        3915, 3915, 3915, 3915, 3915, 3915, 3915, 3915, 3915, 3915, 3915, 3915, 3915, 3915, 3915, 3915, 3915, 3915, 3915, 3915, 3915, 3915, 3915, 3915, 3915, 3915,
-        3915, 3915, 3916, 3916, 3916, 3916, 3916, 3916, 3916, 3916, 3916, 3916, 3916, 3916, 3916, 3916, 3916, 3916, 3916, 3916, 3916, 3916, 3916, 3916, 3916, 3916,
-        3916, 3916, 3916, 3916, 3916, 3916, 3916, 3916, 3916, 3916, 3916, 3916, 3916, 3916, 3917, 3917, 3917, 3917, 3917, 3917, 3917, 3917, 3917, 3917, 3917, 3917,
-        3917, 3917, 3917, 3917, 3917, 3917, 3917, 3917, 3917, 3917, 3917, 3917, 3917, 3917, 3917, 3917, 3917, 3917, 3917, 3917, 3917, 3917, 3917, 3917, 3917, 3917,
-        3917, 3918, 3918, 3918, 3918, 3918, 3918, 3918, 3918, 3918, 3918, 3918, 3918, 3918, 3918, 3918, 3918, 3918, 3918, 3918, 3918, 3918, 3918, 3918, 3918, 3918,
-        3918, 3918, 3918, 3918, 3918, 3918, 3918, 3918, 3918, 3918, 3918, 3918, 3918, 3918, 3919, 3919, 3919, 3919, 3919, 3919, 3919, 3919, 3919, 3919, 3919, 3919,
-        3919, 3919, 3919, 3919, 3919, 3919, 3919, 3919, 3919, 3919, 3919, 3919, 3919, 3919, 3919, 3919, 3919, 3919, 3919, 3919, 3919, 3919, 3919, 3919, 3919, 3919,
-        3919, 3920, 3920, 3920, 3920, 3920, 3920, 3920, 3920, 3920, 3920, 3920, 3920, 3920, 3920, 3920, 3920, 3920, 3920, 3920, 3920, 3920, 3920, 3920, 3920, 3920,
-        3920, 3920, 3920, 3920, 3920, 3920, 3920, 3920, 3920, 3920, 3920, 3920, 3920, 3921, 3921, 3921, 3921, 3921, 3921, 3921, 3921, 3921, 3921, 3921, 3921, 3921,
-        3921, 3921, 3921, 3921, 3921, 3921, 3921, 3921, 3921, 3921, 3921, 3921, 3921, 3921, 3921, 3921, 3921, 3921, 3921, 3921, 3921, 3921, 3921, 3921, 3921, 3921,
-        3922, 3922, 3922, 3922, 3922, 3922, 3922, 3922, 3922, 3922, 3922, 3922, 3922, 3922, 3922, 3922, 3922, 3922, 3922, 3922, 3922, 3922, 3922, 3922, 3922, 3922,
-        3922, 3922, 3922, 3922, 3922, 3922, 3922, 3922, 3922, 3922, 3922, 3922, 3922, 3923, 3923, 3923, 3923, 3923, 3923, 3923, 3923, 3923, 3923, 3923, 3923, 3923,
-        3923, 3923, 3923, 3923, 3923, 3923, 3923, 3923, 3923, 3923, 3923, 3923, 3923, 3923, 3923, 3923, 3923, 3923, 3923, 3923, 3923, 3923, 3923, 3923, 3923, 3923,
-        3924, 3924, 3924, 3924, 3924, 3924, 3924, 3924, 3924, 3924, 3924, 3924, 3924, 3924, 3924, 3924, 3924, 3924, 3924, 3924, 3924, 3924, 3924, 3924, 3924, 3924,
-        3924, 3924, 3924, 3924, 3924, 3924, 3924, 3924, 3924, 3924, 3924, 3924, 3924, 3925, 3925, 3925, 3925, 3925, 3925, 3925, 3925, 3925, 3925, 3925, 3925, 3925,
-        3925, 3925, 3925, 3925, 3925, 3925, 3925, 3925, 3925, 3925, 3925, 3925, 3925, 3925, 3925, 3925, 3925, 3925, 3925, 3925, 3925, 3925, 3925, 3925, 3925, 3925,
-        3926, 3926, 3926, 3926, 3926, 3926, 3926, 3926, 3926, 3926, 3926, 3926, 3926, 3926, 3926, 3926, 3926, 3926, 3926, 3926, 3926, 3926, 3926, 3926, 3926, 3926,
-        3926, 3926, 3926, 3926, 3926, 3926, 3926, 3926, 3926, 3926, 3926, 3926, 3926, 3927, 3927, 3927, 3927, 3927, 3927, 3927, 3927, 3927, 3927, 3927, 3927, 3927,
-        3927, 3927, 3927, 3927, 3927, 3927, 3927, 3927, 3927, 3927, 3927, 3927, 3927, 3927, 3927, 3927, 3927, 3927, 3927, 3927, 3927, 3927, 3927, 3927, 3927, 3927,
-        3928, 3928, 3928, 3928, 3928, 3928, 3928, 3928, 3928, 3928, 3928, 3928, 3928, 3928, 3928, 3928, 3928, 3928, 3928, 3928, 3928, 3928, 3928, 3928, 3928, 3928,
-        3928, 3928, 3928, 3928, 3928, 3928, 3928, 3928, 3928, 3928, 3928, 3928, 3929, 3929, 3929, 3929, 3929, 3929, 3929, 3929, 3929, 3929, 3929, 3929, 3929, 3929,
-        3929, 3929, 3929, 3929, 3929, 3929, 3929, 3929, 3929, 3929, 3929, 3929, 3929, 3929, 3929, 3929, 3929, 3929, 3929, 3929, 3929, 3929, 3929, 3929, 3929, 3930,
-        3930, 3930, 3930, 3930, 3930, 3930, 3930, 3930, 3930, 3930, 3930, 3930, 3930, 3930, 3930, 3930, 3930, 3930, 3930, 3930, 3930, 3930, 3930, 3930, 3930, 3930,
-        3930, 3930, 3930, 3930, 3930, 3930, 3930, 3930, 3930, 3930, 3930, 3930, 3931, 3931, 3931, 3931, 3931, 3931, 3931, 3931, 3931, 3931, 3931, 3931, 3931, 3931,
-        3931, 3931, 3931, 3931, 3931, 3931, 3931, 3931, 3931, 3931, 3931, 3931, 3931, 3931, 3931, 3931, 3931, 3931, 3931, 3931, 3931, 3931, 3931, 3931, 3931, 3932,
-        3932, 3932, 3932, 3932, 3932, 3932, 3932, 3932, 3932, 3932, 3932, 3932, 3932, 3932, 3932, 3932, 3932, 3932, 3932, 3932, 3932, 3932, 3932, 3932, 3932, 3932,
-        3932, 3932, 3932, 3932, 3932, 3932, 3932, 3932, 3932, 3932, 3932, 3932, 3933, 3933, 3933, 3933, 3933, 3933, 3933, 3933, 3933, 3933, 3933, 3933, 3933, 3933,
-        3933, 3933, 3933, 3933, 3933, 3933, 3933, 3933, 3933, 3933, 3933, 3933, 3933, 3933, 3933, 3933, 3933, 3933, 3933, 3933, 3933, 3933, 3933, 3933, 3933, 3934,
-        3934, 3934, 3934, 3934, 3934, 3934, 3934, 3934, 3934, 3934, 3934, 3934, 3934, 3934, 3934, 3934, 3934, 3934, 3934, 3934, 3934, 3934, 3934, 3934, 3934, 3934,
-        3934, 3934, 3934, 3934, 3934, 3934, 3934, 3934, 3934, 3934, 3934, 3934, 3935, 3935, 3935, 3935, 3935, 3935, 3935, 3935, 3935, 3935, 3935, 3935, 3935, 3935,
-        3935, 3935, 3935, 3935, 3935, 3935, 3935, 3935, 3935, 3935, 3935, 3935, 3935, 3935, 3935, 3935, 3935, 3935, 3935, 3935, 3935, 3935, 3935, 3935, 3935, 3936,
-        3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936,
-        3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3937, 3937, 3937, 3937, 3937, 3937, 3937, 3937, 3937, 3937, 3937, 3937, 3937,
-        3937, 3937, 3937, 3937, 3937, 3937, 3937, 3937, 3937, 3937, 3937, 3937, 3937, 3937, 3937, 3937, 3937, 3937, 3937, 3937, 3937, 3937, 3937, 3937, 3937, 3937,
-        3938, 3938, 3938, 3938, 3938, 3938, 3938, 3938, 3938, 3938, 3938, 3938, 3938, 3938, 3938, 3938, 3938, 3938, 3938, 3938, 3938, 3938, 3938, 3938, 3938, 3938,
-        3938, 3938, 3938, 3938, 3938, 3938, 3938, 3938, 3938, 3938, 3938, 3938, 3938, 3939, 3939, 3939, 3939, 3939, 3939, 3939, 3939, 3939, 3939, 3939, 3939, 3939,
-        3939, 3939, 3939, 3939, 3939, 3939, 3939, 3939, 3939, 3939, 3939, 3939, 3939, 3939, 3939, 3939, 3939, 3939, 3939, 3939, 3939, 3939, 3939, 3939, 3939, 3939,
-        3940, 3940, 3940, 3940, 3940, 3940, 3940, 3940, 3940, 3940, 3940, 3940, 3940, 3940, 3940, 3940, 3940, 3940, 3940, 3940, 3940, 3940, 3940, 3940, 3940, 3940,
-        3940, 3940, 3940, 3940, 3940, 3940, 3940, 3940, 3940, 3940, 3940, 3940, 3940, 3941, 3941, 3941, 3941, 3941, 3941, 3941, 3941, 3941, 3941, 3941, 3941, 3941,
-        3941, 3941, 3941, 3941, 3941, 3941, 3941, 3941, 3941, 3941, 3941, 3941, 3941, 3941, 3941, 3941, 3941, 3941, 3941, 3941, 3941, 3941, 3941, 3941, 3941, 3941,
-        3942, 3942, 3942, 3942, 3942, 3942, 3942, 3942, 3942, 3942, 3942, 3942, 3942, 3942, 3942, 3942, 3942, 3942, 3942, 3942, 3942, 3942, 3942, 3942, 3942, 3942,
-        3942, 3942, 3942, 3942, 3942, 3942, 3942, 3942, 3942, 3942, 3942, 3942, 3942, 3943, 3943, 3943, 3943, 3943, 3943, 3943, 3943, 3943, 3943, 3943, 3943, 3943,
-        3943, 3943, 3943, 3943, 3943, 3943, 3943, 3943, 3943, 3943, 3943, 3943, 3943, 3943, 3943, 3943, 3943, 3943, 3943, 3943, 3943, 3943, 3943, 3943, 3943, 3943,
-        3944, 3944, 3944, 3944, 3944, 3944, 3944, 3944, 3944, 3944, 3944, 3944, 3944, 3944, 3944, 3944, 3944, 3944, 3944, 3944, 3944, 3944, 3944, 3944, 3944, 3944,
-        3944, 3944, 3944, 3944, 3944, 3944, 3944, 3944, 3944, 3944, 3944, 3944, 3944, 3944, 3945, 3945, 3945, 3945, 3945, 3945, 3945, 3945, 3945, 3945, 3945, 3945,
-        3945, 3945, 3945, 3945, 3945, 3945, 3945, 3945, 3945, 3945, 3945, 3945, 3945, 3945, 3945, 3945, 3945, 3945, 3945, 3945, 3945, 3945, 3945, 3945, 3945, 3945,
-        3945, 3946, 3946, 3946, 3946, 3946, 3946, 3946, 3946, 3946, 3946, 3946, 3946, 3946, 3946, 3946, 3946, 3946, 3946, 3946, 3946, 3946, 3946, 3946, 3946, 3946,
-        3946, 3946, 3946, 3946, 3946, 3946, 3946, 3946, 3946, 3946, 3946, 3946, 3946, 3946, 3947, 3947, 3947, 3947, 3947, 3947, 3947, 3947, 3947, 3947, 3947, 3947,
-        3947, 3947, 3947, 3947, 3947, 3947, 3947, 3947, 3947, 3947, 3947, 3947, 3947, 3947, 3947, 3947, 3947, 3947, 3947, 3947, 3947, 3947, 3947, 3947, 3947, 3947,
-        3947, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948,
-        3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3949, 3949, 3949, 3949, 3949, 3949, 3949, 3949, 3949, 3949, 3949,
-        3949, 3949, 3949, 3949, 3949, 3949, 3949, 3949, 3949, 3949, 3949, 3949, 3949, 3949, 3949, 3949, 3949, 3949, 3949, 3949, 3949, 3949, 3949, 3949, 3949, 3949,
-        3949, 3949, 3950, 3950, 3950, 3950, 3950, 3950, 3950, 3950, 3950, 3950, 3950, 3950, 3950, 3950, 3950, 3950, 3950, 3950, 3950, 3950, 3950, 3950, 3950, 3950,
-        3950, 3950, 3950, 3950, 3950, 3950, 3950, 3950, 3950, 3950, 3950, 3950, 3950, 3950, 3950, 3951, 3951, 3951, 3951, 3951, 3951, 3951, 3951, 3951, 3951, 3951,
-        3951, 3951, 3951, 3951, 3951, 3951, 3951, 3951, 3951, 3951, 3951, 3951, 3951, 3951, 3951, 3951, 3951, 3951, 3951, 3951, 3951, 3951, 3951, 3951, 3951, 3951,
-        3951, 3951, 3952, 3952, 3952, 3952, 3952, 3952, 3952, 3952, 3952, 3952, 3952, 3952, 3952, 3952, 3952, 3952, 3952, 3952, 3952, 3952, 3952, 3952, 3952, 3952,
-        3952, 3952, 3952, 3952, 3952, 3952, 3952, 3952, 3952, 3952, 3952, 3952, 3952, 3952, 3952, 3952, 3953, 3953, 3953, 3953, 3953, 3953, 3953, 3953, 3953, 3953,
-        3953, 3953, 3953, 3953, 3953, 3953, 3953, 3953, 3953, 3953, 3953, 3953, 3953, 3953, 3953, 3953, 3953, 3953, 3953, 3953, 3953, 3953, 3953, 3953, 3953, 3953,
-        3953, 3953, 3953, 3954, 3954, 3954, 3954, 3954, 3954, 3954, 3954, 3954, 3954, 3954, 3954, 3954, 3954, 3954, 3954, 3954, 3954, 3954, 3954, 3954, 3954, 3954,
-        3954, 3954, 3954, 3954, 3954, 3954, 3954, 3954, 3954, 3954, 3954, 3954, 3954, 3954, 3954, 3954, 3955, 3955, 3955, 3955, 3955, 3955, 3955, 3955, 3955, 3955,
-        3955, 3955, 3955, 3955, 3955, 3955, 3955, 3955, 3955, 3955, 3955, 3955, 3955, 3955, 3955, 3955, 3955, 3955, 3955, 3955, 3955, 3955, 3955, 3955, 3955, 3955,
-        3955, 3955, 3955, 3955, 3956, 3956, 3956, 3956, 3956, 3956, 3956, 3956, 3956, 3956, 3956, 3956, 3956, 3956, 3956, 3956, 3956, 3956, 3956, 3956, 3956, 3956,
-        3956, 3956, 3956, 3956, 3956, 3956, 3956, 3956, 3956, 3956, 3956, 3956, 3956, 3956, 3956, 3956, 3956, 3957, 3957, 3957, 3957, 3957, 3957, 3957, 3957, 3957,
-        3957, 3957, 3957, 3957, 3957, 3957, 3957, 3957, 3957, 3957, 3957, 3957, 3957, 3957, 3957, 3957, 3957, 3957, 3957, 3957, 3957, 3957, 3957, 3957, 3957, 3957,
-        3957, 3957, 3957, 3957, 3957, 3958, 3958, 3958, 3958, 3958, 3958, 3958, 3958, 3958, 3958, 3958, 3958, 3958, 3958, 3958, 3958, 3958, 3958, 3958, 3958, 3958,
-        3958, 3958, 3958, 3958, 3958, 3958, 3958, 3958, 3958, 3958, 3958, 3958, 3958, 3958, 3958, 3958, 3958, 3958, 3959, 3959, 3959, 3959, 3959, 3959, 3959, 3959,
-        3959, 3959, 3959, 3959, 3959, 3959, 3959, 3959, 3959, 3959, 3959, 3959, 3959, 3959, 3959, 3959, 3959, 3959, 3959, 3959, 3959, 3959, 3959, 3959, 3959, 3959,
-        3959, 3959, 3959, 3959, 3959, 3960, 3960, 3960, 3960, 3960, 3960, 3960, 3960, 3960, 3960, 3960, 3960, 3960, 3960, 3960, 3960, 3960, 3960, 3960, 3960, 3960,
-        3960, 3960, 3960, 3960, 3960, 3960, 3960, 3960, 3960, 3960, 3960, 3960, 3960, 3960, 3960, 3960, 3960, 3960, 3960, 3961, 3961, 3961, 3961, 3961, 3961, 3961,
-        3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961,
-        3961, 3961, 3961, 3961, 3961, 3961, 3962, 3962, 3962, 3962, 3962, 3962, 3962, 3962, 3962, 3962, 3962, 3962, 3962, 3962, 3962, 3962, 3962, 3962, 3962, 3962,
-        3962, 3962, 3962, 3962, 3962, 3962, 3962, 3962, 3962, 3962, 3962, 3962, 3962, 3962, 3962, 3962, 3962, 3962, 3962, 3962, 3963, 3963, 3963, 3963, 3963, 3963,
-        3963, 3963, 3963, 3963, 3963, 3963, 3963, 3963, 3963, 3963, 3963, 3963, 3963, 3963, 3963, 3963, 3963, 3963, 3963, 3963, 3963, 3963, 3963, 3963, 3963, 3963,
-        3963, 3963, 3963, 3963, 3963, 3963, 3963, 3964, 3964, 3964, 3964, 3964, 3964, 3964, 3964, 3964, 3964, 3964, 3964, 3964, 3964, 3964, 3964, 3964, 3964, 3964,
-        3964, 3964, 3964, 3964, 3964, 3964, 3964, 3964, 3964, 3964, 3964, 3964, 3964, 3964, 3964, 3964, 3964, 3964, 3964, 3964, 3964, 3965, 3965, 3965, 3965, 3965,
-        3965, 3965, 3965, 3965, 3965, 3965, 3965, 3965, 3965, 3965, 3965, 3965, 3965, 3965, 3965, 3965, 3965, 3965, 3965, 3965, 3965, 3965, 3965, 3965, 3965, 3965,
-        3965, 3965, 3965, 3965, 3965, 3965, 3965, 3965, 3966, 3966, 3966, 3966, 3966, 3966, 3966, 3966, 3966, 3966, 3966, 3966, 3966, 3966, 3966, 3966, 3966, 3966,
-        3966, 3966, 3966, 3966, 3966, 3966, 3966, 3966, 3966, 3966, 3966, 3966, 3966, 3966, 3966, 3966, 3966, 3966, 3966, 3966, 3966, 3966, 3967, 3967, 3967, 3967,
-        3967, 3967, 3967, 3967, 3967, 3967, 3967, 3967, 3967, 3967, 3967, 3967, 3967, 3967, 3967, 3967, 3967, 3967, 3967, 3967, 3967, 3967, 3967, 3967, 3967, 3967,
-        3967, 3967, 3967, 3967, 3967, 3967, 3967, 3967, 3967, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968,
-        3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3969, 3969, 3969,
-        3969, 3969, 3969, 3969, 3969, 3969, 3969, 3969, 3969, 3969, 3969, 3969, 3969, 3969, 3969, 3969, 3969, 3969, 3969, 3969, 3969, 3969, 3969, 3969, 3969, 3969,
-        3969, 3969, 3969, 3969, 3969, 3969, 3969, 3969, 3969, 3969, 3969, 3970, 3970, 3970, 3970, 3970, 3970, 3970, 3970, 3970, 3970, 3970, 3970, 3970, 3970, 3970,
-        3970, 3970, 3970, 3970, 3970, 3970, 3970, 3970, 3970, 3970, 3970, 3970, 3970, 3970, 3970, 3970, 3970, 3970, 3970, 3970, 3970, 3970, 3970, 3970, 3971, 3971,
-        3971, 3971, 3971, 3971, 3971, 3971, 3971, 3971, 3971, 3971, 3971, 3971, 3971, 3971, 3971, 3971, 3971, 3971, 3971, 3971, 3971, 3971, 3971, 3971, 3971, 3971,
-        3971, 3971, 3971, 3971, 3971, 3971, 3971, 3971, 3971, 3971, 3971, 3971, 3972, 3972, 3972, 3972, 3972, 3972, 3972, 3972, 3972, 3972, 3972, 3972, 3972, 3972,
-        3972, 3972, 3972, 3972, 3972, 3972, 3972, 3972, 3972, 3972, 3972, 3972, 3972, 3972, 3972, 3972, 3972, 3972, 3972, 3972, 3972, 3972, 3972, 3972, 3972, 3973,
-        3973, 3973, 3973, 3973, 3973, 3973, 3973, 3973, 3973, 3973, 3973, 3973, 3973, 3973, 3973, 3973, 3973, 3973, 3973, 3973, 3973, 3973, 3973, 3973, 3973, 3973,
-        3973, 3973, 3973, 3973, 3973, 3973, 3973, 3973, 3973, 3973, 3973, 3973, 3973, 3974, 3974, 3974, 3974, 3974, 3974, 3974, 3974, 3974, 3974, 3974, 3974, 3974,
-        3974, 3974, 3974, 3974, 3974, 3974, 3974, 3974, 3974, 3974, 3974, 3974, 3974, 3974, 3974, 3974, 3974, 3974, 3974, 3974, 3974, 3974, 3974, 3974, 3974, 3974,
-        3974, 3975, 3975, 3975, 3975, 3975, 3975, 3975, 3975, 3975, 3975, 3975, 3975, 3975, 3975, 3975, 3975, 3975, 3975, 3975, 3975, 3975, 3975, 3975, 3975, 3975,
-        3975, 3975, 3975, 3975, 3975, 3975, 3975, 3975, 3975, 3975, 3975, 3975, 3975, 3975, 3976, 3976, 3976, 3976, 3976, 3976, 3976, 3976, 3976, 3976, 3976, 3976,
-        3976, 3976, 3976, 3976, 3976, 3976, 3976, 3976, 3976, 3976, 3976, 3976, 3976, 3976, 3976, 3976, 3976, 3976, 3976, 3976, 3976, 3976, 3976, 3976, 3976, 3976,
-        3976, 3976, 3977, 3977, 3977, 3977, 3977, 3977, 3977, 3977, 3977, 3977, 3977, 3977, 3977, 3977, 3977, 3977, 3977, 3977, 3977, 3977, 3977, 3977, 3977, 3977,
-        3977, 3977, 3977, 3977, 3977, 3977, 3977, 3977, 3977, 3977, 3977, 3977, 3977, 3977, 3977, 3977, 3978, 3978, 3978, 3978, 3978, 3978, 3978, 3978, 3978, 3978,
-        3978, 3978, 3978, 3978, 3978, 3978, 3978, 3978, 3978, 3978, 3978, 3978, 3978, 3978, 3978, 3978, 3978, 3978, 3978, 3978, 3978, 3978, 3978, 3978, 3978, 3978,
-        3978, 3978, 3978, 3978, 3979, 3979, 3979, 3979, 3979, 3979, 3979, 3979, 3979, 3979, 3979, 3979, 3979, 3979, 3979, 3979, 3979, 3979, 3979, 3979, 3979, 3979,
-        3979, 3979, 3979, 3979, 3979, 3979, 3979, 3979, 3979, 3979, 3979, 3979, 3979, 3979, 3979, 3979, 3979, 3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980,
-        3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980,
-        3980, 3980, 3980, 3980, 3980, 3981, 3981, 3981, 3981, 3981, 3981, 3981, 3981, 3981, 3981, 3981, 3981, 3981, 3981, 3981, 3981, 3981, 3981, 3981, 3981, 3981,
-        3981, 3981, 3981, 3981, 3981, 3981, 3981, 3981, 3981, 3981, 3981, 3981, 3981, 3981, 3981, 3981, 3981, 3981, 3981, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-        3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-        3982, 3982, 3982, 3982, 3982, 3982, 3982, 3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-        3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983, 3984, 3984, 3984, 3984, 3984, 3984,
-        3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-        3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3985, 3985, 3985, 3985, 3985, 3985, 3985, 3985, 3985, 3985, 3985, 3985, 3985, 3985, 3985, 3985, 3985, 3985,
-        3985, 3985, 3985, 3985, 3985, 3985, 3985, 3985, 3985, 3985, 3985, 3985, 3985, 3985, 3985, 3985, 3985, 3985, 3985, 3985, 3985, 3985, 3986, 3986, 3986, 3986,
-        3986, 3986, 3986, 3986, 3986, 3986, 3986, 3986, 3986, 3986, 3986, 3986, 3986, 3986, 3986, 3986, 3986, 3986, 3986, 3986, 3986, 3986, 3986, 3986, 3986, 3986,
-        3986, 3986, 3986, 3986, 3986, 3986, 3986, 3986, 3986, 3986, 3987, 3987, 3987, 3987, 3987, 3987, 3987, 3987, 3987, 3987, 3987, 3987, 3987, 3987, 3987, 3987,
-        3987, 3987, 3987, 3987, 3987, 3987, 3987, 3987, 3987, 3987, 3987, 3987, 3987, 3987, 3987, 3987, 3987, 3987, 3987, 3987, 3987, 3987, 3987, 3987, 3988, 3988,
-        3988, 3988, 3988, 3988, 3988, 3988, 3988, 3988, 3988, 3988, 3988, 3988, 3988, 3988, 3988, 3988, 3988, 3988, 3988, 3988, 3988, 3988, 3988, 3988, 3988, 3988,
-        3988, 3988, 3988, 3988, 3988, 3988, 3988, 3988, 3988, 3988, 3988, 3988, 3989, 3989, 3989, 3989, 3989, 3989, 3989, 3989, 3989, 3989, 3989, 3989, 3989, 3989,
-        3989, 3989, 3989, 3989, 3989, 3989, 3989, 3989, 3989, 3989, 3989, 3989, 3989, 3989, 3989, 3989, 3989, 3989, 3989, 3989, 3989, 3989, 3989, 3989, 3989, 3989,
-        3990, 3990, 3990, 3990, 3990, 3990, 3990, 3990, 3990, 3990, 3990, 3990, 3990, 3990, 3990, 3990, 3990, 3990, 3990, 3990, 3990, 3990, 3990, 3990, 3990, 3990,
-        3990, 3990, 3990, 3990, 3990, 3990, 3990, 3990, 3990, 3990, 3990, 3990, 3990, 3990, 3991, 3991, 3991, 3991, 3991, 3991, 3991, 3991, 3991, 3991, 3991, 3991,
-        3991, 3991, 3991, 3991, 3991, 3991, 3991, 3991, 3991, 3991, 3991, 3991, 3991, 3991, 3991, 3991, 3991, 3991, 3991, 3991, 3991, 3991, 3991, 3991, 3991, 3991,
-        3991, 3991, 3992, 3992, 3992, 3992, 3992, 3992, 3992, 3992, 3992, 3992, 3992, 3992, 3992, 3992, 3992, 3992, 3992, 3992, 3992, 3992, 3992, 3992, 3992, 3992,
-        3992, 3992, 3992, 3992, 3992, 3992, 3992, 3992, 3992, 3992, 3992, 3992, 3992, 3992, 3992, 3993, 3993, 3993, 3993, 3993, 3993, 3993, 3993, 3993, 3993, 3993,
-        3993, 3993, 3993, 3993, 3993, 3993, 3993, 3993, 3993, 3993, 3993, 3993, 3993, 3993, 3993, 3993, 3993, 3993, 3993, 3993, 3993, 3993, 3993, 3993, 3993, 3993,
-        3993, 3993, 3993, 3994, 3994, 3994, 3994, 3994, 3994, 3994, 3994, 3994, 3994, 3994, 3994, 3994, 3994, 3994, 3994, 3994, 3994, 3994, 3994, 3994, 3994, 3994,
-        3994, 3994, 3994, 3994, 3994, 3994, 3994, 3994, 3994, 3994, 3994, 3994, 3994, 3994, 3994, 3994, 3994, 3995, 3995, 3995, 3995, 3995, 3995, 3995, 3995, 3995,
-        3995, 3995, 3995, 3995, 3995, 3995, 3995, 3995, 3995, 3995, 3995, 3995, 3995, 3995, 3995, 3995, 3995, 3995, 3995, 3995, 3995, 3995, 3995, 3995, 3995, 3995,
-        3995, 3995, 3995, 3995, 3995, 3996, 3996, 3996, 3996, 3996, 3996, 3996, 3996, 3996, 3996, 3996, 3996, 3996, 3996, 3996, 3996, 3996, 3996, 3996, 3996, 3996,
-        3996, 3996, 3996, 3996, 3996, 3996, 3996, 3996, 3996, 3996, 3996, 3996, 3996, 3996, 3996, 3996, 3996, 3996, 3996, 3997, 3997, 3997, 3997, 3997, 3997, 3997,
-        3997, 3997, 3997, 3997, 3997, 3997, 3997, 3997, 3997, 3997, 3997, 3997, 3997, 3997, 3997, 3997, 3997, 3997, 3997, 3997, 3997, 3997, 3997, 3997, 3997, 3997,
-        3997, 3997, 3997, 3997, 3997, 3997, 3997, 3998, 3998, 3998, 3998, 3998, 3998, 3998, 3998, 3998, 3998, 3998, 3998, 3998, 3998, 3998, 3998, 3998, 3998, 3998,
-        3998, 3998, 3998, 3998, 3998, 3998, 3998, 3998, 3998, 3998, 3998, 3998, 3998, 3998, 3998, 3998, 3998, 3998, 3998, 3998, 3998, 3998, 3999, 3999, 3999, 3999,
-        3999, 3999, 3999, 3999, 3999, 3999, 3999, 3999, 3999, 3999, 3999, 3999, 3999, 3999, 3999, 3999, 3999, 3999, 3999, 3999, 3999, 3999, 3999, 3999, 3999, 3999,
-        3999, 3999, 3999, 3999, 3999, 3999, 3999, 3999, 3999, 3999, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000,
-        4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4001, 4001,
-        4001, 4001, 4001, 4001, 4001, 4001, 4001, 4001, 4001, 4001, 4001, 4001, 4001, 4001, 4001, 4001, 4001, 4001, 4001, 4001, 4001, 4001, 4001, 4001, 4001, 4001,
-        4001, 4001, 4001, 4001, 4001, 4001, 4001, 4001, 4001, 4001, 4001, 4001, 4002, 4002, 4002, 4002, 4002, 4002, 4002, 4002, 4002, 4002, 4002, 4002, 4002, 4002,
-        4002, 4002, 4002, 4002, 4002, 4002, 4002, 4002, 4002, 4002, 4002, 4002, 4002, 4002, 4002, 4002, 4002, 4002, 4002, 4002, 4002, 4002, 4002, 4002, 4002, 4002,
-        4003, 4003, 4003, 4003, 4003, 4003, 4003, 4003, 4003, 4003, 4003, 4003, 4003, 4003, 4003, 4003, 4003, 4003, 4003, 4003, 4003, 4003, 4003, 4003, 4003, 4003,
-        4003, 4003, 4003, 4003, 4003, 4003, 4003, 4003, 4003, 4003, 4003, 4003, 4003, 4003, 4004, 4004, 4004, 4004, 4004, 4004, 4004, 4004, 4004, 4004, 4004, 4004,
-        4004, 4004, 4004, 4004, 4004, 4004, 4004, 4004, 4004, 4004, 4004, 4004, 4004, 4004, 4004, 4004, 4004, 4004, 4004, 4004, 4004, 4004, 4004, 4004, 4004, 4004,
-        4004, 4004, 4005, 4005, 4005, 4005, 4005, 4005, 4005, 4005, 4005, 4005, 4005, 4005, 4005, 4005, 4005, 4005, 4005, 4005, 4005, 4005, 4005, 4005, 4005, 4005,
-        4005, 4005, 4005, 4005, 4005, 4005, 4005, 4005, 4005, 4005, 4005, 4005, 4005, 4005, 4005, 4005, 4006, 4006, 4006, 4006, 4006, 4006, 4006, 4006, 4006, 4006,
-        4006, 4006, 4006, 4006, 4006, 4006, 4006, 4006, 4006, 4006, 4006, 4006, 4006, 4006, 4006, 4006, 4006, 4006, 4006, 4006, 4006, 4006, 4006, 4006, 4006, 4006,
-        4006, 4006, 4006, 4006, 4006, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007,
-        4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4008, 4008, 4008, 4008, 4008, 4008, 4008,
-        4008, 4008, 4008, 4008, 4008, 4008, 4008, 4008, 4008, 4008, 4008, 4008, 4008, 4008, 4008, 4008, 4008, 4008, 4008, 4008, 4008, 4008, 4008, 4008, 4008, 4008,
-        4008, 4008, 4008, 4008, 4008, 4008, 4008, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009,
-        4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4010, 4010, 4010, 4010, 4010,
-        4010, 4010, 4010, 4010, 4010, 4010, 4010, 4010, 4010, 4010, 4010, 4010, 4010, 4010, 4010, 4010, 4010, 4010, 4010, 4010, 4010, 4010, 4010, 4010, 4010, 4010,
-        4010, 4010, 4010, 4010, 4010, 4010, 4010, 4010, 4010, 4011, 4011, 4011, 4011, 4011, 4011, 4011, 4011, 4011, 4011, 4011, 4011, 4011, 4011, 4011, 4011, 4011,
-        4011, 4011, 4011, 4011, 4011, 4011, 4011, 4011, 4011, 4011, 4011, 4011, 4011, 4011, 4011, 4011, 4011, 4011, 4011, 4011, 4011, 4011, 4011, 4011, 4012, 4012,
-        4012, 4012, 4012, 4012, 4012, 4012, 4012, 4012, 4012, 4012, 4012, 4012, 4012, 4012, 4012, 4012, 4012, 4012, 4012, 4012, 4012, 4012, 4012, 4012, 4012, 4012,
-        4012, 4012, 4012, 4012, 4012, 4012, 4012, 4012, 4012, 4012, 4012, 4012, 4013, 4013, 4013, 4013, 4013, 4013, 4013, 4013, 4013, 4013, 4013, 4013, 4013, 4013,
-        4013, 4013, 4013, 4013, 4013, 4013, 4013, 4013, 4013, 4013, 4013, 4013, 4013, 4013, 4013, 4013, 4013, 4013, 4013, 4013, 4013, 4013, 4013, 4013, 4013, 4013,
-        4014, 4014, 4014, 4014, 4014, 4014, 4014, 4014, 4014, 4014, 4014, 4014, 4014, 4014, 4014, 4014, 4014, 4014, 4014, 4014, 4014, 4014, 4014, 4014, 4014, 4014,
-        4014, 4014, 4014, 4014, 4014, 4014, 4014, 4014, 4014, 4014, 4014, 4014, 4014, 4014, 4014, 4015, 4015, 4015, 4015, 4015, 4015, 4015, 4015, 4015, 4015, 4015,
-        4015, 4015, 4015, 4015, 4015, 4015, 4015, 4015, 4015, 4015, 4015, 4015, 4015, 4015, 4015, 4015, 4015, 4015, 4015, 4015, 4015, 4015, 4015, 4015, 4015, 4015,
-        4015, 4015, 4015, 4016, 4016, 4016, 4016, 4016, 4016, 4016, 4016, 4016, 4016, 4016, 4016, 4016, 4016, 4016, 4016, 4016, 4016, 4016, 4016, 4016, 4016, 4016,
-        4016, 4016, 4016, 4016, 4016, 4016, 4016, 4016, 4016, 4016, 4016, 4016, 4016, 4016, 4016, 4016, 4016, 4017, 4017, 4017, 4017, 4017, 4017, 4017, 4017, 4017,
-        4017, 4017, 4017, 4017, 4017, 4017, 4017, 4017, 4017, 4017, 4017, 4017, 4017, 4017, 4017, 4017, 4017, 4017, 4017, 4017, 4017, 4017, 4017, 4017, 4017, 4017,
-        4017, 4017, 4017, 4017, 4017, 4017, 4018, 4018, 4018, 4018, 4018, 4018, 4018, 4018, 4018, 4018, 4018, 4018, 4018, 4018, 4018, 4018, 4018, 4018, 4018, 4018,
-        4018, 4018, 4018, 4018, 4018, 4018, 4018, 4018, 4018, 4018, 4018, 4018, 4018, 4018, 4018, 4018, 4018, 4018, 4018, 4018, 4019, 4019, 4019, 4019, 4019, 4019,
-        4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019,
-        4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4020, 4020, 4020, 4020, 4020, 4020, 4020, 4020, 4020, 4020, 4020, 4020, 4020, 4020, 4020, 4020, 4020, 4020,
-        4020, 4020, 4020, 4020, 4020, 4020, 4020, 4020, 4020, 4020, 4020, 4020, 4020, 4020, 4020, 4020, 4020, 4020, 4020, 4020, 4020, 4020, 4020, 4021, 4021, 4021,
-        4021, 4021, 4021, 4021, 4021, 4021, 4021, 4021, 4021, 4021, 4021, 4021, 4021, 4021, 4021, 4021, 4021, 4021, 4021, 4021, 4021, 4021, 4021, 4021, 4021, 4021,
-        4021, 4021, 4021, 4021, 4021, 4021, 4021, 4021, 4021, 4021, 4021, 4022, 4022, 4022, 4022, 4022, 4022, 4022, 4022, 4022, 4022, 4022, 4022, 4022, 4022, 4022,
-        4022, 4022, 4022, 4022, 4022, 4022, 4022, 4022, 4022, 4022, 4022, 4022, 4022, 4022, 4022, 4022, 4022, 4022, 4022, 4022, 4022, 4022, 4022, 4022, 4022, 4022,
-        4023, 4023, 4023, 4023, 4023, 4023, 4023, 4023, 4023, 4023, 4023, 4023, 4023, 4023, 4023, 4023, 4023, 4023, 4023, 4023, 4023, 4023, 4023, 4023, 4023, 4023,
-        4023, 4023, 4023, 4023, 4023, 4023, 4023, 4023, 4023, 4023, 4023, 4023, 4023, 4023, 4024, 4024, 4024, 4024, 4024, 4024, 4024, 4024, 4024, 4024, 4024, 4024,
-        4024, 4024, 4024, 4024, 4024, 4024, 4024, 4024, 4024, 4024, 4024, 4024, 4024, 4024, 4024, 4024, 4024, 4024, 4024, 4024, 4024, 4024, 4024, 4024, 4024, 4024,
-        4024, 4024, 4024, 4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025,
-        4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025, 4026, 4026, 4026, 4026, 4026, 4026, 4026, 4026, 4026,
-        4026, 4026, 4026, 4026, 4026, 4026, 4026, 4026, 4026, 4026, 4026, 4026, 4026, 4026, 4026, 4026, 4026, 4026, 4026, 4026, 4026, 4026, 4026, 4026, 4026, 4026,
-        4026, 4026, 4026, 4026, 4026, 4026, 4027, 4027, 4027, 4027, 4027, 4027, 4027, 4027, 4027, 4027, 4027, 4027, 4027, 4027, 4027, 4027, 4027, 4027, 4027, 4027,
-        4027, 4027, 4027, 4027, 4027, 4027, 4027, 4027, 4027, 4027, 4027, 4027, 4027, 4027, 4027, 4027, 4027, 4027, 4027, 4027, 4028, 4028, 4028, 4028, 4028, 4028,
-        4028, 4028, 4028, 4028, 4028, 4028, 4028, 4028, 4028, 4028, 4028, 4028, 4028, 4028, 4028, 4028, 4028, 4028, 4028, 4028, 4028, 4028, 4028, 4028, 4028, 4028,
-        4028, 4028, 4028, 4028, 4028, 4028, 4028, 4028, 4028, 4029, 4029, 4029, 4029, 4029, 4029, 4029, 4029, 4029, 4029, 4029, 4029, 4029, 4029, 4029, 4029, 4029,
-        4029, 4029, 4029, 4029, 4029, 4029, 4029, 4029, 4029, 4029, 4029, 4029, 4029, 4029, 4029, 4029, 4029, 4029, 4029, 4029, 4029, 4029, 4029, 4030, 4030, 4030,
-        4030, 4030, 4030, 4030, 4030, 4030, 4030, 4030, 4030, 4030, 4030, 4030, 4030, 4030, 4030, 4030, 4030, 4030, 4030, 4030, 4030, 4030, 4030, 4030, 4030, 4030,
-        4030, 4030, 4030, 4030, 4030, 4030, 4030, 4030, 4030, 4030, 4030, 4030, 4031, 4031, 4031, 4031, 4031, 4031, 4031, 4031, 4031, 4031, 4031, 4031, 4031, 4031,
-        4031, 4031, 4031, 4031, 4031, 4031, 4031, 4031, 4031, 4031, 4031, 4031, 4031, 4031, 4031, 4031, 4031, 4031, 4031, 4031, 4031, 4031, 4031, 4031, 4031, 4031,
-        4032, 4032, 4032, 4032, 4032, 4032, 4032, 4032, 4032, 4032, 4032, 4032, 4032, 4032, 4032, 4032, 4032, 4032, 4032, 4032, 4032, 4032, 4032, 4032, 4032, 4032,
-        4032, 4032, 4032, 4032, 4032, 4032, 4032, 4032, 4032, 4032, 4032, 4032, 4032, 4032, 4032, 4033, 4033, 4033, 4033, 4033, 4033, 4033, 4033, 4033, 4033, 4033,
-        4033, 4033, 4033, 4033, 4033, 4033, 4033, 4033, 4033, 4033, 4033, 4033, 4033, 4033, 4033, 4033, 4033, 4033, 4033, 4033, 4033, 4033, 4033, 4033, 4033, 4033,
-        4033, 4033, 4033, 4034, 4034, 4034, 4034, 4034, 4034, 4034, 4034, 4034, 4034, 4034, 4034, 4034, 4034, 4034, 4034, 4034, 4034, 4034, 4034, 4034, 4034, 4034,
-        4034, 4034, 4034, 4034, 4034, 4034, 4034, 4034, 4034, 4034, 4034, 4034, 4034, 4034, 4034, 4034, 4034, 4034, 4035, 4035, 4035, 4035, 4035, 4035, 4035, 4035,
-        4035, 4035, 4035, 4035, 4035, 4035, 4035, 4035, 4035, 4035, 4035, 4035, 4035, 4035, 4035, 4035, 4035, 4035, 4035, 4035, 4035, 4035, 4035, 4035, 4035, 4035,
-        4035, 4035, 4035, 4035, 4035, 4035, 4035, 4036, 4036, 4036, 4036, 4036, 4036, 4036, 4036, 4036, 4036, 4036, 4036, 4036, 4036, 4036, 4036, 4036, 4036, 4036,
-        4036, 4036, 4036, 4036, 4036, 4036, 4036, 4036, 4036, 4036, 4036, 4036, 4036, 4036, 4036, 4036, 4036, 4036, 4036, 4036, 4036, 4037, 4037, 4037, 4037, 4037,
-        4037, 4037, 4037, 4037, 4037, 4037, 4037, 4037, 4037, 4037, 4037, 4037, 4037, 4037, 4037, 4037, 4037, 4037, 4037, 4037, 4037, 4037, 4037, 4037, 4037, 4037,
-        4037, 4037, 4037, 4037, 4037, 4037, 4037, 4037, 4037, 4037, 4038, 4038, 4038, 4038, 4038, 4038, 4038, 4038, 4038, 4038, 4038, 4038, 4038, 4038, 4038, 4038,
-        4038, 4038, 4038, 4038, 4038, 4038, 4038, 4038, 4038, 4038, 4038, 4038, 4038, 4038, 4038, 4038, 4038, 4038, 4038, 4038, 4038, 4038, 4038, 4038, 4038, 4039,
-        4039, 4039, 4039, 4039, 4039, 4039, 4039, 4039, 4039, 4039, 4039, 4039, 4039, 4039, 4039, 4039, 4039, 4039, 4039, 4039, 4039, 4039, 4039, 4039, 4039, 4039,
-        4039, 4039, 4039, 4039, 4039, 4039, 4039, 4039, 4039, 4039, 4039, 4039, 4039, 4040, 4040, 4040, 4040, 4040, 4040, 4040, 4040, 4040, 4040, 4040, 4040, 4040,
-        4040, 4040, 4040, 4040, 4040, 4040, 4040, 4040, 4040, 4040, 4040, 4040, 4040, 4040, 4040, 4040, 4040, 4040, 4040, 4040, 4040, 4040, 4040, 4040, 4040, 4040,
-        4040, 4040, 4041, 4041, 4041, 4041, 4041, 4041, 4041, 4041, 4041, 4041, 4041, 4041, 4041, 4041, 4041, 4041, 4041, 4041, 4041, 4041, 4041, 4041, 4041, 4041,
-        4041, 4041, 4041, 4041, 4041, 4041, 4041, 4041, 4041, 4041, 4041, 4041, 4041, 4041, 4041, 4041, 4041, 4042, 4042, 4042, 4042, 4042, 4042, 4042, 4042, 4042,
-        4042, 4042, 4042, 4042, 4042, 4042, 4042, 4042, 4042, 4042, 4042, 4042, 4042, 4042, 4042, 4042, 4042, 4042, 4042, 4042, 4042, 4042, 4042, 4042, 4042, 4042,
-        4042, 4042, 4042, 4042, 4042, 4042, 4043, 4043, 4043, 4043, 4043, 4043, 4043, 4043, 4043, 4043, 4043, 4043, 4043, 4043, 4043, 4043, 4043, 4043, 4043, 4043,
-        4043, 4043, 4043, 4043, 4043, 4043, 4043, 4043, 4043, 4043, 4043, 4043, 4043, 4043, 4043, 4043, 4043, 4043, 4043, 4043, 4043, 4044, 4044, 4044, 4044, 4044,
-        4044, 4044, 4044, 4044, 4044, 4044, 4044, 4044, 4044, 4044, 4044, 4044, 4044, 4044, 4044, 4044, 4044, 4044, 4044, 4044, 4044, 4044, 4044, 4044, 4044, 4044,
-        4044, 4044, 4044, 4044, 4044, 4044, 4044, 4044, 4044, 4045, 4045, 4045, 4045, 4045, 4045, 4045, 4045, 4045, 4045, 4045, 4045, 4045, 4045, 4045, 4045, 4045,
-        4045, 4045, 4045, 4045, 4045, 4045, 4045, 4045, 4045, 4045, 4045, 4045, 4045, 4045, 4045, 4045, 4045, 4045, 4045, 4045, 4045, 4045, 4045, 4045, 4046, 4046,
-        4046, 4046, 4046, 4046, 4046, 4046, 4046, 4046, 4046, 4046, 4046, 4046, 4046, 4046, 4046, 4046, 4046, 4046, 4046, 4046, 4046, 4046, 4046, 4046, 4046, 4046,
-        4046, 4046, 4046, 4046, 4046, 4046, 4046, 4046, 4046, 4046, 4046, 4046, 4046, 4047, 4047, 4047, 4047, 4047, 4047, 4047, 4047, 4047, 4047, 4047, 4047, 4047,
-        4047, 4047, 4047, 4047, 4047, 4047, 4047, 4047, 4047, 4047, 4047, 4047, 4047, 4047, 4047, 4047, 4047, 4047, 4047, 4047, 4047, 4047, 4047, 4047, 4047, 4047,
-        4047, 4047, 4048, 4048, 4048, 4048, 4048, 4048, 4048, 4048, 4048, 4048, 4048, 4048, 4048, 4048, 4048, 4048, 4048, 4048, 4048, 4048, 4048, 4048, 4048, 4048,
-        4048, 4048, 4048, 4048, 4048, 4048, 4048, 4048, 4048, 4048, 4048, 4048, 4048, 4048, 4048, 4048, 4048, 4049, 4049, 4049, 4049, 4049, 4049, 4049, 4049, 4049,
-        4049, 4049, 4049, 4049, 4049, 4049, 4049, 4049, 4049, 4049, 4049, 4049, 4049, 4049, 4049, 4049, 4049, 4049, 4049, 4049, 4049, 4049, 4049, 4049, 4049, 4049,
-        4049, 4049, 4049, 4049, 4049, 4050, 4050, 4050, 4050, 4050, 4050, 4050, 4050, 4050, 4050, 4050, 4050, 4050, 4050, 4050, 4050, 4050, 4050, 4050, 4050, 4050,
-        4050, 4050, 4050, 4050, 4050, 4050, 4050, 4050, 4050, 4050, 4050, 4050, 4050, 4050, 4050, 4050, 4050, 4050, 4050, 4050, 4051, 4051, 4051, 4051, 4051, 4051,
-        4051, 4051, 4051, 4051, 4051, 4051, 4051, 4051, 4051, 4051, 4051, 4051, 4051, 4051, 4051, 4051, 4051, 4051, 4051, 4051, 4051, 4051, 4051, 4051, 4051, 4051,
-        4051, 4051, 4051, 4051, 4051, 4051, 4051, 4051, 4051, 4052, 4052, 4052, 4052, 4052, 4052, 4052, 4052, 4052, 4052, 4052, 4052, 4052, 4052, 4052, 4052, 4052,
-        4052, 4052, 4052, 4052, 4052, 4052, 4052, 4052, 4052, 4052, 4052, 4052, 4052, 4052, 4052, 4052, 4052, 4052, 4052, 4052, 4052, 4052, 4052, 4052, 4053, 4053,
-        4053, 4053, 4053, 4053, 4053, 4053, 4053, 4053, 4053, 4053, 4053, 4053, 4053, 4053, 4053, 4053, 4053, 4053, 4053, 4053, 4053, 4053, 4053, 4053, 4053, 4053,
-        4053, 4053, 4053, 4053, 4053, 4053, 4053, 4053, 4053, 4053, 4053, 4053, 4053, 4054, 4054, 4054, 4054, 4054, 4054, 4054, 4054, 4054, 4054, 4054, 4054, 4054,
-        4054, 4054, 4054, 4054, 4054, 4054, 4054, 4054, 4054, 4054, 4054, 4054, 4054, 4054, 4054, 4054, 4054, 4054, 4054, 4054, 4054, 4054, 4054, 4054, 4054, 4054,
-        4054, 4054, 4055, 4055, 4055, 4055, 4055, 4055, 4055, 4055, 4055, 4055, 4055, 4055, 4055, 4055, 4055, 4055, 4055, 4055, 4055, 4055, 4055, 4055, 4055, 4055,
-        4055, 4055, 4055, 4055, 4055, 4055, 4055, 4055, 4055, 4055, 4055, 4055, 4055, 4055, 4055, 4055, 4055, 4056, 4056, 4056, 4056, 4056, 4056, 4056, 4056, 4056,
-        4056, 4056, 4056, 4056, 4056, 4056, 4056, 4056, 4056, 4056, 4056, 4056, 4056, 4056, 4056, 4056, 4056, 4056, 4056, 4056, 4056, 4056, 4056, 4056, 4056, 4056,
-        4056, 4056, 4056, 4056, 4056, 4056, 4057, 4057, 4057, 4057, 4057, 4057, 4057, 4057, 4057, 4057, 4057, 4057, 4057, 4057, 4057, 4057, 4057, 4057, 4057, 4057,
-        4057, 4057, 4057, 4057, 4057, 4057, 4057, 4057, 4057, 4057, 4057, 4057, 4057, 4057, 4057, 4057, 4057, 4057, 4057, 4057, 4057, 4058, 4058, 4058, 4058, 4058,
-        4058, 4058, 4058, 4058, 4058, 4058, 4058, 4058, 4058, 4058, 4058, 4058, 4058, 4058, 4058, 4058, 4058, 4058, 4058, 4058, 4058, 4058, 4058, 4058, 4058, 4058,
-        4058, 4058, 4058, 4058, 4058, 4058, 4058, 4058, 4058, 4058, 4059, 4059, 4059, 4059, 4059, 4059, 4059, 4059, 4059, 4059, 4059, 4059, 4059, 4059, 4059, 4059,
-        4059, 4059, 4059, 4059, 4059, 4059, 4059, 4059, 4059, 4059, 4059, 4059, 4059, 4059, 4059, 4059, 4059, 4059, 4059, 4059, 4059, 4059, 4059, 4059, 4059, 4060,
-        4060, 4060, 4060, 4060, 4060, 4060, 4060, 4060, 4060, 4060, 4060, 4060, 4060, 4060, 4060, 4060, 4060, 4060, 4060, 4060, 4060, 4060, 4060, 4060, 4060, 4060,
-        4060, 4060, 4060, 4060, 4060, 4060, 4060, 4060, 4060, 4060, 4060, 4060, 4060, 4060, 4061, 4061, 4061, 4061, 4061, 4061, 4061, 4061, 4061, 4061, 4061, 4061,
-        4061, 4061, 4061, 4061, 4061, 4061, 4061, 4061, 4061, 4061, 4061, 4061, 4061, 4061, 4061, 4061, 4061, 4061, 4061, 4061, 4061, 4061, 4061, 4061, 4061, 4061,
-        4061, 4061, 4061, 4062, 4062, 4062, 4062, 4062, 4062, 4062, 4062, 4062, 4062, 4062, 4062, 4062, 4062, 4062, 4062, 4062, 4062, 4062, 4062, 4062, 4062, 4062,
-        4062, 4062, 4062, 4062, 4062, 4062, 4062, 4062, 4062, 4062, 4062, 4062, 4062, 4062, 4062, 4062, 4062, 4062, 4063, 4063, 4063, 4063, 4063, 4063, 4063, 4063,
-        4063, 4063, 4063, 4063, 4063, 4063, 4063, 4063, 4063, 4063, 4063, 4063, 4063, 4063, 4063, 4063, 4063, 4063, 4063, 4063, 4063, 4063, 4063, 4063, 4063, 4063,
-        4063, 4063, 4063, 4063, 4063, 4063, 4063, 4064, 4064, 4064, 4064, 4064, 4064, 4064, 4064, 4064, 4064, 4064, 4064, 4064, 4064, 4064, 4064, 4064, 4064, 4064,
-        4064, 4064, 4064, 4064, 4064, 4064, 4064, 4064, 4064, 4064, 4064, 4064, 4064, 4064, 4064, 4064, 4064, 4064, 4064, 4064, 4064, 4064, 4064, 4065, 4065, 4065,
-        4065, 4065, 4065, 4065, 4065, 4065, 4065, 4065, 4065, 4065, 4065, 4065, 4065, 4065, 4065, 4065, 4065, 4065, 4065, 4065, 4065, 4065, 4065, 4065, 4065, 4065,
-        4065, 4065, 4065, 4065, 4065, 4065, 4065, 4065, 4065, 4065, 4065, 4065, 4066, 4066, 4066, 4066, 4066, 4066, 4066, 4066, 4066, 4066, 4066, 4066, 4066, 4066,
-        4066, 4066, 4066, 4066, 4066, 4066, 4066, 4066, 4066, 4066, 4066, 4066, 4066, 4066, 4066, 4066, 4066, 4066, 4066, 4066, 4066, 4066, 4066, 4066, 4066, 4066,
-        4066, 4067, 4067, 4067, 4067, 4067, 4067, 4067, 4067, 4067, 4067, 4067, 4067, 4067, 4067, 4067, 4067, 4067, 4067, 4067, 4067, 4067, 4067, 4067, 4067, 4067,
-        4067, 4067, 4067, 4067, 4067, 4067, 4067, 4067, 4067, 4067, 4067, 4067, 4067, 4067, 4067, 4067, 4068, 4068, 4068, 4068, 4068, 4068, 4068, 4068, 4068, 4068,
-        4068, 4068, 4068, 4068, 4068, 4068, 4068, 4068, 4068, 4068, 4068, 4068, 4068, 4068, 4068, 4068, 4068, 4068, 4068, 4068, 4068, 4068, 4068, 4068, 4068, 4068,
-        4068, 4068, 4068, 4068, 4068, 4069, 4069, 4069, 4069, 4069, 4069, 4069, 4069, 4069, 4069, 4069, 4069, 4069, 4069, 4069, 4069, 4069, 4069, 4069, 4069, 4069,
-        4069, 4069, 4069, 4069, 4069, 4069, 4069, 4069, 4069, 4069, 4069, 4069, 4069, 4069, 4069, 4069, 4069, 4069, 4069, 4069, 4070, 4070, 4070, 4070, 4070, 4070,
-        4070, 4070, 4070, 4070, 4070, 4070, 4070, 4070, 4070, 4070, 4070, 4070, 4070, 4070, 4070, 4070, 4070, 4070, 4070, 4070, 4070, 4070, 4070, 4070, 4070, 4070,
-        4070, 4070, 4070, 4070, 4070, 4070, 4070, 4070, 4070, 4070, 4071, 4071, 4071, 4071, 4071, 4071, 4071, 4071, 4071, 4071, 4071, 4071, 4071, 4071, 4071, 4071,
-        4071, 4071, 4071, 4071, 4071, 4071, 4071, 4071, 4071, 4071, 4071, 4071, 4071, 4071, 4071, 4071, 4071, 4071, 4071, 4071, 4071, 4071, 4071, 4071, 4071, 4072,
-        4072, 4072, 4072, 4072, 4072, 4072, 4072, 4072, 4072, 4072, 4072, 4072, 4072, 4072, 4072, 4072, 4072, 4072, 4072, 4072, 4072, 4072, 4072, 4072, 4072, 4072,
-        4072, 4072, 4072, 4072, 4072, 4072, 4072, 4072, 4072, 4072, 4072, 4072, 4072, 4072, 4073, 4073, 4073, 4073, 4073, 4073, 4073, 4073, 4073, 4073, 4073, 4073,
-        4073, 4073, 4073, 4073, 4073, 4073, 4073, 4073, 4073, 4073, 4073, 4073, 4073, 4073, 4073, 4073, 4073, 4073, 4073, 4073, 4073, 4073, 4073, 4073, 4073, 4073,
-        4073, 4073, 4073, 4074, 4074, 4074, 4074, 4074, 4074, 4074, 4074, 4074, 4074, 4074, 4074, 4074, 4074, 4074, 4074, 4074, 4074, 4074, 4074, 4074, 4074, 4074,
-        4074, 4074, 4074, 4074, 4074, 4074, 4074, 4074, 4074, 4074, 4074, 4074, 4074, 4074, 4074, 4074, 4074, 4074, 4074, 4075, 4075, 4075, 4075, 4075, 4075, 4075,
-        4075, 4075, 4075, 4075, 4075, 4075, 4075, 4075, 4075, 4075, 4075, 4075, 4075, 4075, 4075, 4075, 4075, 4075, 4075, 4075, 4075, 4075, 4075, 4075, 4075, 4075,
-        4075, 4075, 4075, 4075, 4075, 4075, 4075, 4075, 4076, 4076, 4076, 4076, 4076, 4076, 4076, 4076, 4076, 4076, 4076, 4076, 4076, 4076, 4076, 4076, 4076, 4076,
-        4076, 4076, 4076, 4076, 4076, 4076, 4076, 4076, 4076, 4076, 4076, 4076, 4076, 4076, 4076, 4076, 4076, 4076, 4076, 4076, 4076, 4076, 4076, 4077, 4077, 4077,
-        4077, 4077, 4077, 4077, 4077, 4077, 4077, 4077, 4077, 4077, 4077, 4077, 4077, 4077, 4077, 4077, 4077, 4077, 4077, 4077, 4077, 4077, 4077, 4077, 4077, 4077,
-        4077, 4077, 4077, 4077, 4077, 4077, 4077, 4077, 4077, 4077, 4077, 4077, 4078, 4078, 4078, 4078, 4078, 4078, 4078, 4078, 4078, 4078, 4078, 4078, 4078, 4078,
-        4078, 4078, 4078, 4078, 4078, 4078, 4078, 4078, 4078, 4078, 4078, 4078, 4078, 4078, 4078, 4078, 4078, 4078, 4078, 4078, 4078, 4078, 4078, 4078, 4078, 4078,
-        4078, 4078, 4079, 4079, 4079, 4079, 4079, 4079, 4079, 4079, 4079, 4079, 4079, 4079, 4079, 4079, 4079, 4079, 4079, 4079, 4079, 4079, 4079, 4079, 4079, 4079,
-        4079, 4079, 4079, 4079, 4079, 4079, 4079, 4079, 4079, 4079, 4079, 4079, 4079, 4079, 4079, 4079, 4079, 4080, 4080, 4080, 4080, 4080, 4080, 4080, 4080, 4080,
-        4080, 4080, 4080, 4080, 4080, 4080, 4080, 4080, 4080, 4080, 4080, 4080, 4080, 4080, 4080, 4080, 4080, 4080, 4080, 4080, 4080, 4080, 4080, 4080, 4080, 4080,
-        4080, 4080, 4080, 4080, 4080, 4080, 4080, 4081, 4081, 4081, 4081, 4081, 4081, 4081, 4081, 4081, 4081, 4081, 4081, 4081, 4081, 4081, 4081, 4081, 4081, 4081,
-        4081, 4081, 4081, 4081, 4081, 4081, 4081, 4081, 4081, 4081, 4081, 4081, 4081, 4081, 4081, 4081, 4081, 4081, 4081, 4081, 4081, 4081, 4082, 4082, 4082, 4082,
-        4082, 4082, 4082, 4082, 4082, 4082, 4082, 4082, 4082, 4082, 4082, 4082, 4082, 4082, 4082, 4082, 4082, 4082, 4082, 4082, 4082, 4082, 4082, 4082, 4082, 4082,
-        4082, 4082, 4082, 4082, 4082, 4082, 4082, 4082, 4082, 4082, 4082, 4083, 4083, 4083, 4083, 4083, 4083, 4083, 4083, 4083, 4083, 4083, 4083, 4083, 4083, 4083,
-        4083, 4083, 4083, 4083, 4083, 4083, 4083, 4083, 4083, 4083, 4083, 4083, 4083, 4083, 4083, 4083, 4083, 4083, 4083, 4083, 4083, 4083, 4083, 4083, 4083, 4083,
-        4083, 4084, 4084, 4084, 4084, 4084, 4084, 4084, 4084, 4084, 4084, 4084, 4084, 4084, 4084, 4084, 4084, 4084, 4084, 4084, 4084, 4084, 4084, 4084, 4084, 4084,
-        4084, 4084, 4084, 4084, 4084, 4084, 4084, 4084, 4084, 4084, 4084, 4084, 4084, 4084, 4084, 4084, 4085, 4085, 4085, 4085, 4085, 4085, 4085, 4085, 4085, 4085,
-        4085, 4085, 4085, 4085, 4085, 4085, 4085, 4085, 4085, 4085, 4085, 4085, 4085, 4085, 4085, 4085, 4085, 4085, 4085, 4085, 4085, 4085, 4085, 4085, 4085, 4085,
-        4085, 4085, 4085, 4085, 4085, 4085, 4086, 4086, 4086, 4086, 4086, 4086, 4086, 4086, 4086, 4086, 4086, 4086, 4086, 4086, 4086, 4086, 4086, 4086, 4086, 4086,
-        4086, 4086, 4086, 4086, 4086, 4086, 4086, 4086, 4086, 4086, 4086, 4086, 4086, 4086, 4086, 4086, 4086, 4086, 4086, 4086, 4086, 4087, 4087, 4087, 4087, 4087,
-        4087, 4087, 4087, 4087, 4087, 4087, 4087, 4087, 4087, 4087, 4087, 4087, 4087, 4087, 4087, 4087, 4087, 4087, 4087, 4087, 4087, 4087, 4087, 4087, 4087, 4087,
-        4087, 4087, 4087, 4087, 4087, 4087, 4087, 4087, 4087, 4087, 4087, 4088, 4088, 4088, 4088, 4088, 4088, 4088, 4088, 4088, 4088, 4088, 4088, 4088, 4088, 4088,
-        4088, 4088, 4088, 4088, 4088, 4088, 4088, 4088, 4088, 4088, 4088, 4088, 4088, 4088, 4088, 4088, 4088, 4088, 4088, 4088, 4088, 4088, 4088, 4088, 4088, 4088,
-        4089, 4089, 4089, 4089, 4089, 4089, 4089, 4089, 4089, 4089, 4089, 4089, 4089, 4089, 4089, 4089, 4089, 4089, 4089, 4089, 4089, 4089, 4089, 4089, 4089, 4089,
-        4089, 4089, 4089, 4089, 4089, 4089, 4089, 4089, 4089, 4089, 4089, 4089, 4089, 4089, 4089, 4089, 4090, 4090, 4090, 4090, 4090, 4090, 4090, 4090, 4090, 4090,
-        4090, 4090, 4090, 4090, 4090, 4090, 4090, 4090, 4090, 4090, 4090, 4090, 4090, 4090, 4090, 4090, 4090, 4090, 4090, 4090, 4090, 4090, 4090, 4090, 4090, 4090,
-        4090, 4090, 4090, 4090, 4090, 4091, 4091, 4091, 4091, 4091, 4091, 4091, 4091, 4091, 4091, 4091, 4091, 4091, 4091, 4091, 4091, 4091, 4091, 4091, 4091, 4091,
-        4091, 4091, 4091, 4091, 4091, 4091, 4091, 4091, 4091, 4091, 4091, 4091, 4091, 4091, 4091, 4091, 4091, 4091, 4091, 4091, 4091, 4092, 4092, 4092, 4092, 4092,
-        4092, 4092, 4092, 4092, 4092, 4092, 4092, 4092, 4092, 4092, 4092, 4092, 4092, 4092, 4092, 4092, 4092, 4092, 4092, 4092, 4092, 4092, 4092, 4092, 4092, 4092,
-        4092, 4092, 4092, 4092, 4092, 4092, 4092, 4092, 4092, 4092, 4093, 4093, 4093, 4093, 4093, 4093, 4093, 4093, 4093, 4093, 4093, 4093, 4093, 4093, 4093, 4093,
-        4093, 4093, 4093, 4093, 4093, 4093, 4093, 4093, 4093, 4093, 4093, 4093, 4093, 4093, 4093, 4093, 4093, 4093, 4093, 4093, 4093, 4093, 4093, 4093, 4093, 4093,
-        4094, 4094, 4094, 4094, 4094, 4094, 4094, 4094, 4094, 4094, 4094, 4094, 4094, 4094, 4094, 4094, 4094, 4094, 4094, 4094, 4094, 4094, 4094, 4094, 4094, 4094,
-        4094, 4094, 4094, 4094, 4094, 4094, 4094, 4094, 4094, 4094, 4094, 4094, 4094, 4094, 4094, 4095
-    }
-};
-
 #endif //_OPEN_DCP_XYZ_H_
@@ -115,51 +115,6 @@ def test(source):
 
         print "%d, %d, %d | %f, %f, %f | %f, %f, %f | %f, %f, %f | %d, %d, %d | %s" % (i,i,i,p,p,p,r,g,b,xn,yn,zn,x,y,z,n)
 
-def generate_lut_in(lut):
-    t = ''
-    f = 'calculate_'+lut
-
-    c = 0;
-    for x in range(0, BIT_LENGTH):
-        v = eval(f)(x)
-
-        if c == 0:
-            t += "    "
-
-        if x < BIT_LENGTH - 1:
-            t += "%06f," % (v)
-            if c == 16:
-                c = 0
-                t += "\n"
-            else:
-                c = c + 1
-        else:
-            t += "%06f" %(v) 
-
-    return t 
-
-def generate_lut_out(lut):
-    c = 0
-    t = ''
-    for x in range(0, BIT_LENGTH * BIT_PRECISION):
-        v = int(((x/(BIT_LENGTH * BIT_PRECISION - 1.0)) ** (1/DCI_GAMMA)) * (BIT_LENGTH - 1.0))
-
-        if c == 0:
-            t += "    "
-
-        if x < BIT_LENGTH * BIT_PRECISION - 1:
-            t += "%4d," % (v)
-        else:
-            t += "%4d" % (v)
-
-        if c == 25:
-             c = 0
-             t += "\n"
-        else:
-            c = c + 1 
-
-    return t
-
 def calculate_srgb(i, complex=False):
     p = float(i) / (BIT_LENGTH - 1.0)
     
@@ -203,34 +158,6 @@ def calculate_dci(i, complex=False):
 
     return v
 
-def lut_in():
-    t = "static float lut_in[LI_MAX][COLOR_DEPTH+1] = {\n"
-    for i in range(0, len(color_spaces_in)):
-        c = color_spaces_in[i]
-        t += "    // Bit Depth:       %s\n" % (BIT_DEPTH)
-        t += "    // Reference White: %s\n" % (c['id'].upper())
-        t += "    // Gamma:           %s\n" % (c['gamma'])
-        t += "    {\n";
-        t += generate_lut_in(c['id'])
-        t += "    },\n"
-        if i < len(color_spaces_in) - 1:
-            t += "\n"
-    t += "};"
-
-    return t
-
-def lut_out():
-    t  = "static int lut_out[1][DCI_LUT_SIZE] = {\n"
-    t += "    // Bit Depth:       %s\n" % (BIT_DEPTH)
-    t += "    // Reference White: %s\n" % ("DCI")
-    t += "    // Gamma:           %s\n" % (DCI_GAMMA)
-    t += "    {\n"
-    t += generate_lut_out("dci")
-    t += "    }\n"
-    t += "};"
-
-    return t
-
 color_spaces_in = [
                 { 
                  'id':     'srgb',
@@ -301,6 +228,4 @@ print "%s\n" % (defines())
 print "%s\n" % (enums())
 print "%s\n" % (gamma())
 print "%s\n" % (color_matrix())
-print "%s\n" % (lut_in())
-print "%s\n" % (lut_out())
 print "%s"   % (footer())
@@ -0,0 +1,303 @@
+#!/usr/bin/env python
+"""
+End-to-end throughput and bit-exactness check for the opendcp tools.
+
+Generates a synthetic 2K and 4K DPX sequence plus a 6 channel WAV set, runs
+opendcp_j2k -> opendcp_mxf -> opendcp_xml on them and records wall time, cpu
+time and peak RSS for every stage. The essence of each MXF is hashed and
+compared to the golden file, header metadata with its random UUIDs and
+timestamps is left out of the hash.
+
+    scripts/regress.py --bin build/cli              check against the golden file
+                                                    (fails when it has no hash to check)
+    scripts/regress.py --bin build/cli --update     record new golden hashes
+    scripts/regress.py --bin build/cli --baseline old.json --tolerance 10
+"""
+
+import argparse
+import hashlib
+import json
+import os
+import shutil
+import struct
+import subprocess
+import sys
+import tempfile
+import time
+
+GOLDEN = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'regress_golden.json')
+
+SEQUENCES = {
+    '2k': {'width': 2048, 'height': 1080, 'profile': 'cinema2k'},
+    '4k': {'width': 4096, 'height': 2160, 'profile': 'cinema4k'},
+}
+
+# generic container essence element keys, picture and sound
+ESSENCE_KEY = bytes(bytearray([0x06, 0x0e, 0x2b, 0x34, 0x01, 0x02, 0x01, 0x01, 0x0d, 0x01, 0x03, 0x01]))
+
+
+def lcg(seed):
+    while True:
+        seed = (seed * 1664525 + 1013904223) & 0xffffffff
+        yield seed >> 8
+
+
+def dpx_strip(width, height, frames):
+    """Packed 10-bit words for a diagonal ramp with noise, every row and
+    frame is a slice of it so the sequence has motion and is cheap to build."""
+    rand = lcg(0x0dc0ffee)
+    length = width + height + frames
+    words = []
+
+    for i in range(length):
+        ramp = (i * 1023) // length
+        r = min(1023, max(0, ramp + next(rand) % 32 - 16))
+        g = min(1023, max(0, (ramp * 3) // 4 + next(rand) % 32 - 16))
+        b = min(1023, max(0, 1023 - ramp + next(rand) % 32 - 16))
+        words.append(r << 22 | g << 12 | b << 2)
+
+    return struct.pack('>%dI' % length, *words)
+
+
+def write_dpx(path, width, height, strip, frame):
+    header = bytearray(2048)
+    size = 2048 + width * height * 4
+
+    header[0:4] = b'SDPX'
+    struct.pack_into('>I', header, 4, 2048)
+    header[8:12] = b'V2.0'
+    struct.pack_into('>I', header, 16, size)
+    struct.pack_into('>II', header, 24, 1664, 384)
+    struct.pack_into('>I', header, 660, 0xffffffff)
+    struct.pack_into('>HII', header, 770, 1, width, height)
+    header[800] = 50
+    header[803] = 10
+    struct.pack_into('>H', header, 804, 1)
+    struct.pack_into('>I', header, 808, 2048)
+
+    with open(path, 'wb') as fp:
+        fp.write(header)
+
+        for y in range(height):
+            offset = (y + frame) * 4
+            fp.write(strip[offset:offset + width * 4])
+
+
+def write_wav(path, seconds, channel):
+    rand = lcg(0x0dc0ffee + channel)
+    second = bytearray()
+
+    for i in range(48000):
+        v = (((i * (channel + 1)) % 96) - 48) * 4096 + next(rand) % 256
+        second += struct.pack('<i', v)[0:3]
+
+    data = bytes(second) * seconds
+
+    with open(path, 'wb') as fp:
+        fp.write(b'RIFF' + struct.pack('<I', 36 + len(data)) + b'WAVEfmt ')
+        fp.write(struct.pack('<IHHIIHH', 16, 1, 1, 48000, 48000 * 3, 3, 24))
+        fp.write(b'data' + struct.pack('<I', len(data)))
+        fp.write(data)
+
+
+def generate(work, frames, seconds):
+    for name, seq in sorted(SEQUENCES.items()):
+        path = os.path.join(work, 'dpx_' + name)
+        os.makedirs(path)
+        strip = dpx_strip(seq['width'], seq['height'], frames)
+
+        for f in range(frames):
+            write_dpx(os.path.join(path, 'frame_%06d.dpx' % f), seq['width'], seq['height'], strip, f)
+
+    path = os.path.join(work, 'wav')
+    os.makedirs(path)
+
+    for c, channel in enumerate(['L', 'R', 'C', 'LFE', 'Ls', 'Rs']):
+        write_wav(os.path.join(path, 'audio_%d_%s.wav' % (c, channel)), seconds, c)
+
+
+def run(stage, cmd, cwd):
+    """Runs one tool and returns wall seconds, cpu seconds and peak RSS in MB."""
+    start = time.time()
+    proc = subprocess.Popen(cmd, cwd=cwd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+    output = proc.stdout.read()
+    pid, status, usage = os.wait4(proc.pid, 0)
+    proc.returncode = status
+    wall = time.time() - start
+
+    if status != 0:
+        sys.stderr.write(output.decode('utf-8', 'replace'))
+        raise RuntimeError('%s failed: %s' % (stage, ' '.join(cmd)))
+
+    # ru_maxrss is in kilobytes on linux and bytes on osx
+    rss = usage.ru_maxrss / (1024.0 * 1024.0 if sys.platform == 'darwin' else 1024.0)
+
+    return {'wall': wall, 'cpu': usage.ru_utime + usage.ru_stime, 'rss_mb': rss}
+
+
+def essence_hash(path):
+    """SHA-1 of every essence element value in the file, in file order."""
+    sha1 = hashlib.sha1()
+
+    with open(path, 'rb') as fp:
+        while True:
+            key = fp.read(16)
+
+            if len(key) < 16:
+                break
+
+            first = bytearray(fp.read(1))
+
+            if not first:
+                break
+
+            length = first[0]
+
+            if length & 0x80:
+                length = 0
+
+                for b in bytearray(fp.read(first[0] & 0x7f)):
+                    length = length << 8 | b
+
+            if key[0:12] == ESSENCE_KEY:
+                sha1.update(fp.read(length))
+            else:
+                fp.seek(length, os.SEEK_CUR)
+
+    return sha1.hexdigest()
+
+
+def tool(args, name):
+    return os.path.join(args.bin, name)
+
+
+def pipeline(args, work):
+    stages = {}
+    hashes = {}
+    frames = args.frames
+
+    for name, seq in sorted(SEQUENCES.items()):
+        j2c = os.path.join(work, 'j2c_' + name)
+        mxf = os.path.join(work, 'picture_%s.mxf' % name)
+        os.makedirs(j2c)
+
+        cmd = [tool(args, 'opendcp_j2k'), '-i', os.path.join(work, 'dpx_' + name), '-o', j2c,
+               '-p', seq['profile'], '-a', 'fixed', '-l', '1']
+
+        if args.threads:
+            cmd += ['-t', str(args.threads)]
+
+        stages['j2k_' + name] = run('j2k_' + name, cmd, work)
+        stages['j2k_' + name]['fps'] = frames / stages['j2k_' + name]['wall']
+
+        stages['mxf_' + name] = run('mxf_' + name, [tool(args, 'opendcp_mxf'), '-i', j2c, '-o', mxf, '-l', '1'], work)
+        stages['mxf_' + name]['fps'] = frames / stages['mxf_' + name]['wall']
+        hashes['picture_' + name] = essence_hash(mxf)
+
+    mxf = os.path.join(work, 'sound.mxf')
+    stages['mxf_pcm'] = run('mxf_pcm', [tool(args, 'opendcp_mxf'), '-i', os.path.join(work, 'wav'), '-o', mxf, '-l', '1'], work)
+    hashes['sound'] = essence_hash(mxf)
+
+    stages['xml'] = run('xml', [tool(args, 'opendcp_xml'), '-r', os.path.join(work, 'picture_2k.mxf'), mxf,
+                                '-n', str(frames), '-l', '1'], work)
+
+    return stages, hashes
+
+
+def report(stages):
+    print('%-10s %10s %10s %10s %10s' % ('stage', 'wall s', 'cpu s', 'rss MB', 'fps'))
+
+    for name in sorted(stages):
+        s = stages[name]
+        fps = '%10.2f' % s['fps'] if 'fps' in s else '%10s' % '-'
+        print('%-10s %10.2f %10.2f %10.1f %s' % (name, s['wall'], s['cpu'], s['rss_mb'], fps))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='opendcp end-to-end regression check')
+    parser.add_argument('--bin', default='build/cli', help='directory holding the opendcp tools')
+    parser.add_argument('--work', help='work directory, kept when given (default a removed temp dir)')
+    parser.add_argument('--frames', type=int, default=48, help='frames per sequence (default 48)')
+    parser.add_argument('--threads', type=int, default=0, help='opendcp_j2k threads (default tool default)')
+    parser.add_argument('--golden', default=GOLDEN, help='golden hash file (default %s)' % GOLDEN)
+    parser.add_argument('--update', action='store_true', help='record the hashes as the new golden values')
+    parser.add_argument('--output', help='write the timings and hashes as json')
+    parser.add_argument('--baseline', help='json written by --output to compare throughput against')
+    parser.add_argument('--tolerance', type=float, default=10.0, help='allowed throughput loss in percent (default 10)')
+    args = parser.parse_args()
+
+    work = args.work or tempfile.mkdtemp(prefix='opendcp_regress_')
+
+    if not os.path.isdir(work):
+        os.makedirs(work)
+
+    failed = False
+
+    try:
+        generate(work, args.frames, max(1, args.frames // 24))
+        stages, hashes = pipeline(args, work)
+    finally:
+        if not args.work:
+            shutil.rmtree(work, ignore_errors=True)
+
+    report(stages)
+    key = '%d' % args.frames
+
+    if args.update:
+        golden = {}
+
+        if os.path.exists(args.golden):
+            with open(args.golden) as fp:
+                golden = json.load(fp)
+
+        golden[key] = hashes
+
+        with open(args.golden, 'w') as fp:
+            json.dump(golden, fp, indent=4, sort_keys=True)
+            fp.write('\n')
+
+        print('recorded golden hashes for %s frames in %s' % (key, args.golden))
+    elif os.path.exists(args.golden):
+        with open(args.golden) as fp:
+            golden = json.load(fp).get(key, {})
+
+        # a hash that was never recorded is not a pass
+        for name in sorted(hashes):
+            if name not in golden:
+                print('%-12s MISSING no golden hash for %s frames, run with --update to record one' % (name, key))
+                failed = True
+            elif golden[name] != hashes[name]:
+                print('%-12s MISMATCH %s != %s' % (name, hashes[name], golden[name]))
+                failed = True
+            else:
+                print('%-12s ok' % name)
+    else:
+        print('no golden file at %s, run with --update to record one' % args.golden)
+        failed = True
+
+    if args.baseline:
+        with open(args.baseline) as fp:
+            baseline = json.load(fp)['stages']
+
+        for name in sorted(stages):
+            if 'fps' not in stages[name] or name not in baseline:
+                continue
+
+            change = (stages[name]['fps'] / baseline[name]['fps'] - 1.0) * 100.0
+
+            if change < -args.tolerance:
+                print('%-10s throughput REGRESSION %.1f%%' % (name, change))
+                failed = True
+            else:
+                print('%-10s throughput %+.1f%%' % (name, change))
+
+    if args.output:
+        with open(args.output, 'w') as fp:
+            json.dump({'frames': args.frames, 'stages': stages, 'hashes': hashes}, fp, indent=4, sort_keys=True)
+            fp.write('\n')
+
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -17,10 +17,6 @@ IF(${CMAKE_COMPILER_IS_GNUCC})
     SET(ENABLE_CLANG OFF)
 ENDIF()
 
-IF(ENABLE_OPENMP AND DARWIN_VERSION GREATER 10 AND ENABLE_CLANG)
-    SET(ENABLE_OPENMP OFF)
-ENDIF()
-
 SET(DOWNLOAD ON)
 INCLUDE_DIRECTORIES(${PROJECT_BINARY_DIR}/contrib/include)
 